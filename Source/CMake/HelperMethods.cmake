@@ -21,7 +21,7 @@ function(add_engine_dependencies target_name)
 		add_dependencies(${target_name} bsfOpenAudio)
 	endif()
 	
-	add_dependencies(${target_name} bsfSL bsfPhysX bsfRenderBeast)
+	add_dependencies(${target_name} bsfSL bsfPhysX bsfRenderBeast bsfNullRenderAPI bsfNullRenderer)
 endfunction()
 
 function(add_subdirectory_optional subdir_name)
@@ -95,7 +95,7 @@ namespace bs
 		}
 
 		// All of the memory is part of the same buffer, so we only need to free the first element
-		bs_free(layers);
+		bs_free<AnimationAlloc>(layers);
 		layers = nullptr;
 		genericCurveOutputs = nullptr;
 		sceneObjectInfos = nullptr;
@@ -106,7 +106,7 @@ namespace bs
 	}
 
 	void AnimationProxy::rebuild(const SPtr<Skeleton>& skeleton, const SkeletonMask& mask,
-		Vector<AnimationClipInfo>& clipInfos, const Vector<AnimatedSceneObject>& sceneObjects,
+		Vector<AnimationClipInfo>& clipInfos, const SmallVector<AnimatedSceneObject, 8>& sceneObjects,
 		const SPtr<MorphShapes>& morphShapes)
 	{
 		this->skeleton = skeleton;
@@ -119,15 +119,23 @@ namespace bs
 
 		numSceneObjects = (UINT32)sceneObjects.size();
 		if (numSceneObjects > 0)
+		{
 			sceneObjectPose = LocalSkeletonPose(numSceneObjects);
+			boneAttachmentPose = LocalSkeletonPose(numSceneObjects);
+
+			memset(boneAttachmentPose.hasOverride, 1, sizeof(bool) * numSceneObjects);
+		}
 		else
+		{
 			sceneObjectPose = LocalSkeletonPose();
+			boneAttachmentPose = LocalSkeletonPose();
+		}
 
 		rebuild(clipInfos, sceneObjects, morphShapes);
 	}
 
-	void AnimationProxy::rebuild(Vector<AnimationClipInfo>& clipInfos, const Vector<AnimatedSceneObject>& sceneObjects,
-		const SPtr<MorphShapes>& morphShapes)
+	void AnimationProxy::rebuild(Vector<AnimationClipInfo>& clipInfos,
+		const SmallVector<AnimatedSceneObject, 8>& sceneObjects, const SPtr<MorphShapes>& morphShapes)
 	{
 		clear();
 
@@ -242,6 +250,8 @@ namespace bs
 				}
 			}
 
+			this->morphShapes = morphShapes;
+
 			if (morphShapes != nullptr)
 			{
 				numMorphChannels = morphShapes->getNumChannels();
@@ -272,9 +282,9 @@ namespace bs
 			UINT32 morphChannelSize = numMorphChannels * sizeof(MorphChannelInfo);
 			UINT32 morphShapeSize = numMorphShapes * sizeof(MorphShapeInfo);
 
-			UINT8* data = (UINT8*)bs_alloc(layersSize + clipsSize + boneMappingSize + posCacheSize + rotCacheSize +
-				scaleCacheSize + genCacheSize + genericCurveOutputSize + sceneObjectIdsSize + sceneObjectTransformsSize +
-				morphChannelSize + morphShapeSize);
+			UINT8* data = (UINT8*)bs_alloc<AnimationAlloc>(layersSize + clipsSize + boneMappingSize + posCacheSize +
+				rotCacheSize + scaleCacheSize + genCacheSize + genericCurveOutputSize + sceneObjectIdsSize +
+				sceneObjectTransformsSize + morphChannelSize + morphShapeSize);
 
 			layers = (AnimationStateLayer*)data;
 			memcpy(layers, tempLayers.data(), layersSize);
@@ -593,7 +603,7 @@ namespace bs
 		morphChannelWeightsDirty = true;
 	}
 
-	void AnimationProxy::updateTransforms(const Vector<AnimatedSceneObject>& sceneObjects)
+	void AnimationProxy::updateTransforms(const SmallVector<AnimatedSceneObject, 8>& sceneObjects)
 	{
 		Matrix4 invRootTransform(BsIdentity);
 		for (UINT32 i = 0; i < numSceneObjects; i++)
@@ -1291,7 +1301,7 @@ namespace bs
 
 		auto getAnimatedSOList = [&]()
 		{
-			Vector<AnimatedSceneObject> animatedSO(mSceneObjects.size());
+			SmallVector<AnimatedSceneObject, 8> animatedSO(mSceneObjects.size());
 			UINT32 idx = 0;
 			for (auto& entry : mSceneObjects)
 				animatedSO[idx++] = entry.second;
@@ -1308,14 +1318,14 @@ namespace bs
 		{
 			if (mDirty.isSet(AnimDirtyStateFlag::All))
 			{
-				Vector<AnimatedSceneObject> animatedSOs = getAnimatedSOList();
+				SmallVector<AnimatedSceneObject, 8> animatedSOs = getAnimatedSOList();
 
 				mAnimProxy->rebuild(mSkeleton, mSkeletonMask, mClipInfos, animatedSOs, mMorphShapes);
 				didFullRebuild = true;
 			}
 			else if (mDirty.isSet(AnimDirtyStateFlag::Layout))
 			{
-				Vector<AnimatedSceneObject> animatedSOs = getAnimatedSOList();
+				SmallVector<AnimatedSceneObject, 8> animatedSOs = getAnimatedSOList();
 
 				mAnimProxy->rebuild(mClipInfos, animatedSOs, mMorphShapes);
 				didFullRebuild = true;
@@ -1351,7 +1361,7 @@ namespace bs
 
 				if (hash != mAnimProxy->sceneObjectInfos[i].hash)
 				{
-					Vector<AnimatedSceneObject> animatedSOs = getAnimatedSOList();
+					SmallVector<AnimatedSceneObject, 8> animatedSOs = getAnimatedSOList();
 					mAnimProxy->updateTransforms(animatedSOs);
 					break;
 				}
@@ -1383,16 +1393,16 @@ namespace bs
 
 			if(soInfo.boneIdx != -1)
 			{
-				if (mAnimProxy->skeletonPose.hasOverride[soInfo.boneIdx])
+				// Transforms were already resolved through the bone hierarchy by the animation worker
+				const LocalSkeletonPose& attachmentPose = mAnimProxy->boneAttachmentPose;
+				if (attachmentPose.hasOverride[i])
 					continue;
 
-				Vector3 position = mAnimProxy->skeletonPose.positions[soInfo.boneIdx];
-				Quaternion rotation = mAnimProxy->skeletonPose.rotations[soInfo.boneIdx];
-				Vector3 scale = mAnimProxy->skeletonPose.scales[soInfo.boneIdx];
+				Vector3 position = attachmentPose.positions[i];
+				Quaternion rotation = attachmentPose.rotations[i];
+				Vector3 scale = attachmentPose.scales[i];
 
-				const SPtr<Skeleton>& skeleton = mAnimProxy->skeleton;
-
-				UINT32 parentBoneIdx = skeleton->getBoneInfo(soInfo.boneIdx).parent;
+				UINT32 parentBoneIdx = mAnimProxy->skeleton->getBoneInfo(soInfo.boneIdx).parent;
 				if (parentBoneIdx == (UINT32)-1)
 				{
 					so->setPosition(position);
@@ -1401,23 +1411,6 @@ namespace bs
 				}
 				else
 				{
-					while(parentBoneIdx != (UINT32)-1)
-					{
-						// Update rotation
-						const Quaternion& parentOrientation = mAnimProxy->skeletonPose.rotations[parentBoneIdx];
-						rotation = parentOrientation * rotation;
-
-						// Update scale
-						const Vector3& parentScale = mAnimProxy->skeletonPose.scales[parentBoneIdx];
-						scale = parentScale * scale;
-
-						// Update position
-						position = parentOrientation.rotate(parentScale * position);
-						position += mAnimProxy->skeletonPose.positions[parentBoneIdx];
-
-						parentBoneIdx = skeleton->getBoneInfo(parentBoneIdx).parent;
-					}
-
 					// Search for root if not already found
 					if(rootSO == nullptr)
 					{
@@ -176,7 +176,7 @@ namespace bs
 		 * @note	Should be called from the sim thread when the caller is sure the animation thread is not using it.
 		 */
 		void rebuild(const SPtr<Skeleton>& skeleton, const SkeletonMask& mask, Vector<AnimationClipInfo>& clipInfos, 
-			const Vector<AnimatedSceneObject>& sceneObjects, const SPtr<MorphShapes>& morphShapes);
+			const SmallVector<AnimatedSceneObject, 8>& sceneObjects, const SPtr<MorphShapes>& morphShapes);
 
 		/** 
 		 * Rebuilds the internal proxy data according to the newly clips. This should be called whenever clips are added
@@ -190,7 +190,7 @@ namespace bs
 		 *
 		 * @note	Should be called from the sim thread when the caller is sure the animation thread is not using it.
 		 */
-		void rebuild(Vector<AnimationClipInfo>& clipInfos, const Vector<AnimatedSceneObject>& sceneObjects, 
+		void rebuild(Vector<AnimationClipInfo>& clipInfos, const SmallVector<AnimatedSceneObject, 8>& sceneObjects, 
 			const SPtr<MorphShapes>& morphShapes);
 
 		/** 
@@ -213,7 +213,7 @@ namespace bs
 		 *
 		 * @note	Should be called from the sim thread when the caller is sure the animation thread is not using it.
 		 */
-		void updateTransforms(const Vector<AnimatedSceneObject>& sceneObjects);
+		void updateTransforms(const SmallVector<AnimatedSceneObject, 8>& sceneObjects);
 
 		/** 
 		 * Updates the proxy data with new clip times. Caller must guarantee that clip layout didn't change since the last
@@ -238,6 +238,7 @@ namespace bs
 		Matrix4* sceneObjectTransforms;
 
 		// Morph shape animation
+		SPtr<MorphShapes> morphShapes;
 		MorphChannelInfo* morphChannelInfos;
 		MorphShapeInfo* morphShapeInfos;
 		UINT32 numMorphChannels;
@@ -248,10 +249,19 @@ namespace bs
 		// Culling
 		AABox mBounds;
 		bool mCullEnabled;
+		UINT32 mNumCulledFrames = 0; /**< Number of consecutive evaluations during which the animation was not visible. */
 
 		// Evaluation results
 		LocalSkeletonPose skeletonPose;
 		LocalSkeletonPose sceneObjectPose;
+
+		/** 
+		 * Transforms of scene objects attached to bones, indexed same as @p sceneObjectInfos. Transforms of objects 
+		 * attached to root bones are local, and of other objects relative to the parent of the animation's root scene
+		 * object. Entries with an override flag set should not be applied, either because the object is not attached to a
+		 * bone, or because the bone isn't animated.
+		 */
+		LocalSkeletonPose boneAttachmentPose;
 		UINT32 numGenericCurves;
 		float* genericCurveOutputs;
 	};
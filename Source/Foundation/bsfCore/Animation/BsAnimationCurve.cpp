@@ -151,9 +151,167 @@ namespace bs
 	template<>
 	Quaternion getZero<Quaternion>() { return Quaternion(BsZero); }
 
+	/** Number of 16-bit values a single compressed sample of the specified type is quantized to. */
+	template <class T>
+	struct TCompressedSampleSize { enum { count = 3 }; };
+
+	template<>
+	struct TCompressedSampleSize<float> { enum { count = 1 }; };
+
+	/** Returns a single component of a scalar or a vector value. */
+	float getComponent(float value, UINT32 idx) { return value; }
+	float getComponent(const Vector3& value, UINT32 idx) { return value[idx]; }
+
+	/** Sets a single component of a scalar or a vector value. */
+	void setComponent(float& value, UINT32 idx, float component) { value = component; }
+	void setComponent(Vector3& value, UINT32 idx, float component) { value[idx] = component; }
+
+	/** Calculates the range of values spanned by the provided samples, used for quantizing them. */
+	template <class T>
+	void calculateRange(const Vector<T>& values, CompressedCurveData& data)
+	{
+		for (UINT32 i = 0; i < (UINT32)TCompressedSampleSize<T>::count; i++)
+		{
+			float min = std::numeric_limits<float>::infinity();
+			float max = -std::numeric_limits<float>::infinity();
+
+			for (auto& entry : values)
+			{
+				min = std::min(min, getComponent(entry, i));
+				max = std::max(max, getComponent(entry, i));
+			}
+
+			data.rangeMin[i] = min;
+			data.rangeExtent[i] = max - min;
+		}
+	}
+
+	void calculateRange(const Vector<Quaternion>& values, CompressedCurveData& data)
+	{
+		// Quaternion components are quantized over a fixed range
+	}
+
+	/** Quantizes each component of the value to 16 bits, relative to the range of values in the curve. */
+	template <class T>
+	void encodeSample(const T& value, const CompressedCurveData& data, UINT16* output)
+	{
+		for (UINT32 i = 0; i < (UINT32)TCompressedSampleSize<T>::count; i++)
+		{
+			float normalized = 0.0f;
+			if (data.rangeExtent[i] > 0.0f)
+				normalized = Math::clamp01((getComponent(value, i) - data.rangeMin[i]) / data.rangeExtent[i]);
+
+			output[i] = (UINT16)Math::roundToInt(normalized * 65535.0f);
+		}
+	}
+
+	/** 
+	 * Encodes the quaternion by storing its three smallest components with 15 bits each. The largest component is 
+	 * reconstructed from the unit length constraint, and its index is stored in the lowest bits of the first two values.
+	 */
+	void encodeSample(const Quaternion& value, const CompressedCurveData& data, UINT16* output)
+	{
+		Quaternion quat = Quaternion::normalize(value);
+
+		UINT32 largest = 0;
+		for (UINT32 i = 1; i < 4; i++)
+		{
+			if (Math::abs(quat[i]) > Math::abs(quat[largest]))
+				largest = i;
+		}
+
+		// q and -q represent the same rotation, keep the largest component positive so its sign doesn't need storing
+		if (quat[largest] < 0.0f)
+			quat = -quat;
+
+		UINT32 outIdx = 0;
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			if (i == largest)
+				continue;
+
+			// Smaller components are always within [-1/sqrt(2), 1/sqrt(2)]
+			float normalized = Math::clamp01((quat[i] * 1.41421356f + 1.0f) * 0.5f);
+			output[outIdx++] = (UINT16)(Math::roundToInt(normalized * 32767.0f) << 1);
+		}
+
+		output[0] |= largest & 0x1;
+		output[1] |= (largest >> 1) & 0x1;
+	}
+
+	/** Restores a value quantized with encodeSample(). */
+	template <class T>
+	void decodeSample(const UINT16* input, const CompressedCurveData& data, T& output)
+	{
+		for (UINT32 i = 0; i < (UINT32)TCompressedSampleSize<T>::count; i++)
+			setComponent(output, i, data.rangeMin[i] + input[i] * (data.rangeExtent[i] / 65535.0f));
+	}
+
+	void decodeSample(const UINT16* input, const CompressedCurveData& data, Quaternion& output)
+	{
+		UINT32 largest = (input[0] & 0x1) | ((input[1] & 0x1) << 1);
+
+		float sqrdSum = 0.0f;
+		UINT32 inIdx = 0;
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			if (i == largest)
+				continue;
+
+			float normalized = (input[inIdx++] >> 1) / 32767.0f;
+			output[i] = (normalized * 2.0f - 1.0f) * 0.70710678f;
+			sqrdSum += output[i] * output[i];
+		}
+
+		output[largest] = Math::sqrt(std::max(0.0f, 1.0f - sqrdSum));
+	}
+
+	/** Linearly interpolates between two compressed samples. */
+	float lerpSample(float t, float lhs, float rhs)
+	{
+		return lhs + (rhs - lhs) * t;
+	}
+
+	Vector3 lerpSample(float t, const Vector3& lhs, const Vector3& rhs)
+	{
+		return lhs + (rhs - lhs) * t;
+	}
+
+	Quaternion lerpSample(float t, const Quaternion& lhs, const Quaternion& rhs)
+	{
+		return Quaternion::lerp(t, lhs, rhs);
+	}
+
+	/** Returns the largest per-component difference between two values. */
+	float getMaxError(float lhs, float rhs)
+	{
+		return Math::abs(lhs - rhs);
+	}
+
+	float getMaxError(const Vector3& lhs, const Vector3& rhs)
+	{
+		Vector3 diff = lhs - rhs;
+		return std::max(Math::abs(diff.x), std::max(Math::abs(diff.y), Math::abs(diff.z)));
+	}
+
+	float getMaxError(const Quaternion& lhs, const Quaternion& rhs)
+	{
+		// Compare against the closer of the two equivalent quaternions
+		Quaternion other = lhs.dot(rhs) >= 0.0f ? rhs : -rhs;
+
+		float error = 0.0f;
+		for (UINT32 i = 0; i < 4; i++)
+			error = std::max(error, Math::abs(lhs[i] - other[i]));
+
+		return error;
+	}
+
 	template <class T>
 	const UINT32 TAnimationCurve<T>::CACHE_LOOKAHEAD = 3;
 
+	template <class T>
+	const UINT32 TAnimationCurve<T>::MAX_COMPRESSED_SEGMENT = 128;
+
 	template <class T>
 	TAnimationCurve<T>::TAnimationCurve()
 		:mStart(0.0f), mEnd(0.0f), mLength(0.0f)
@@ -190,6 +348,12 @@ namespace bs
 	template <class T>
 	T TAnimationCurve<T>::evaluate(float time, const TCurveCache<T>& cache, bool loop) const
 	{
+		if (isCompressed())
+		{
+			AnimationUtility::wrapTime(time, mStart, mEnd, loop);
+			return evaluateCompressed(time, &cache);
+		}
+
 		if (mKeyframes.size() == 0)
 			return getZero<T>();
 
@@ -276,6 +440,12 @@ namespace bs
 	template <class T>
 	T TAnimationCurve<T>::evaluate(float time, bool loop) const
 	{
+		if (isCompressed())
+		{
+			AnimationUtility::wrapTime(time, mStart, mEnd, loop);
+			return evaluateCompressed(time, nullptr);
+		}
+
 		if (mKeyframes.size() == 0)
 			return getZero<T>();
 
@@ -323,6 +493,34 @@ namespace bs
 	template <class T>
 	TKeyframe<T> TAnimationCurve<T>::evaluateKey(float time, bool loop) const
 	{
+		if (isCompressed())
+		{
+			AnimationUtility::wrapTime(time, mStart, mEnd, loop);
+
+			UINT32 leftSample;
+			UINT32 rightSample;
+			float t;
+
+			findSamples(time, nullptr, leftSample, rightSample, t);
+
+			T leftValue = getCompressedSample(leftSample);
+			T rightValue = getCompressedSample(rightSample);
+
+			TKeyframe<T> output;
+			output.time = time;
+			output.value = lerpSample(t, leftValue, rightValue);
+
+			// Samples are interpolated linearly, so the tangent is the slope of the segment
+			float length = (getCompressedFrame(rightSample) - getCompressedFrame(leftSample)) * mCompressed.sampleInterval;
+			if (length > 0.0f)
+				output.inTangent = (rightValue - leftValue) * (1.0f / length);
+			else
+				output.inTangent = getZero<T>();
+
+			output.outTangent = output.inTangent;
+			return output;
+		}
+
 		if (mKeyframes.size() == 0)
 			return TKeyframe<T>();
 
@@ -378,14 +576,30 @@ namespace bs
 			else
 			{
 				UINT32 start = (UINT32)std::max(0, (INT32)animInstance.cachedKey - (INT32)CACHE_LOOKAHEAD);
-				for(UINT32 i = start; i < animInstance.cachedKey; i++)
+				for(UINT32 i = animInstance.cachedKey; i > start; i--)
 				{
-					const KeyFrame& prevKey = mKeyframes[i];
+					const KeyFrame& prevKey = mKeyframes[i - 1];
 
 					if (time >= prevKey.time)
 					{
-						leftKey = i;
-						rightKey = i + 1;
+						leftKey = i - 1;
+						rightKey = i;
+
+						animInstance.cachedKey = leftKey;
+						return;
+					}
+				}
+
+				// Looping animations wrap around to the start of the curve, so check the first few keys as well
+				UINT32 end = std::min(start, CACHE_LOOKAHEAD + 1);
+				for (UINT32 i = 1; i < end; i++)
+				{
+					const KeyFrame& nextKey = mKeyframes[i];
+
+					if (time < nextKey.time)
+					{
+						leftKey = i - 1;
+						rightKey = i;
 
 						animInstance.cachedKey = leftKey;
 						return;
@@ -477,6 +691,12 @@ namespace bs
 	template <class T>
 	TAnimationCurve<T> TAnimationCurve<T>::split(float start, float end)
 	{
+		if (isCompressed())
+		{
+			LOGWRN("Splitting compressed animation curves is not supported.");
+			return TAnimationCurve<T>();
+		}
+
 		Vector<TKeyframe<T>> keyFrames;
 
 		start = Math::clamp(start, mStart, mEnd);
@@ -572,6 +792,12 @@ namespace bs
 	template <class T>
 	void TAnimationCurve<T>::makeAdditive()
 	{
+		if (isCompressed())
+		{
+			LOGWRN("Compressed animation curves cannot be made additive.");
+			return;
+		}
+
 		if (mKeyframes.size() < 2)
 			return;
 
@@ -582,6 +808,190 @@ namespace bs
 			mKeyframes[i].value = getDiff(mKeyframes[i].value, refKey.value);
 	}
 
+	template <class T>
+	TAnimationCurve<T> TAnimationCurve<T>::compress(UINT32 sampleRate, float tolerance) const
+	{
+		if (isCompressed() || mKeyframes.empty())
+			return *this;
+
+		// Sample the curve at evenly spaced frames, making sure the last frame lands exactly on the curve end
+		UINT32 numFrames = 1;
+		if (mLength > 0.0f)
+			numFrames = (UINT32)std::ceil(mLength * std::max(sampleRate, 1U)) + 1;
+
+		numFrames = std::min(numFrames, (UINT32)std::numeric_limits<UINT16>::max() + 1);
+		float sampleInterval = numFrames > 1 ? mLength / (numFrames - 1) : 0.0f;
+
+		Vector<T> values(numFrames);
+		for (UINT32 i = 0; i < numFrames; i++)
+			values[i] = evaluate(mStart + i * sampleInterval, false);
+
+		bool isConstant = true;
+		for (UINT32 i = 1; i < numFrames; i++)
+		{
+			if (getMaxError(values[i], values[0]) > tolerance)
+			{
+				isConstant = false;
+				break;
+			}
+		}
+
+		// Keep only the frames that cannot be reconstructed by interpolating between their neighbours. Segments are
+		// extended greedily, and their length is limited to keep the fitting cost reasonable for long curves.
+		Vector<UINT16> keptFrames;
+		keptFrames.push_back(0);
+
+		if (!isConstant)
+		{
+			UINT32 anchor = 0;
+			while (anchor < numFrames - 1)
+			{
+				UINT32 end = anchor + 1;
+				UINT32 maxEnd = std::min(numFrames - 1, anchor + MAX_COMPRESSED_SEGMENT);
+
+				if (tolerance > 0.0f)
+				{
+					for (UINT32 candidate = anchor + 2; candidate <= maxEnd; candidate++)
+					{
+						bool fits = true;
+						for (UINT32 i = anchor + 1; i < candidate; i++)
+						{
+							float t = (i - anchor) / (float)(candidate - anchor);
+							T interpolated = lerpSample(t, values[anchor], values[candidate]);
+
+							if (getMaxError(interpolated, values[i]) > tolerance)
+							{
+								fits = false;
+								break;
+							}
+						}
+
+						if (!fits)
+							break;
+
+						end = candidate;
+					}
+				}
+
+				keptFrames.push_back((UINT16)end);
+				anchor = end;
+			}
+		}
+
+		TAnimationCurve<T> output;
+		output.mStart = mStart;
+		output.mEnd = mEnd;
+		output.mLength = mLength;
+
+		CompressedCurveData& data = output.mCompressed;
+		data.sampleInterval = sampleInterval;
+		calculateRange(values, data);
+
+		// Storing frame indices costs an extra value per sample, only worth it if enough samples were removed
+		const UINT32 sampleSize = TCompressedSampleSize<T>::count;
+		UINT32 numKept = (UINT32)keptFrames.size();
+
+		if (numKept * (sampleSize + 1) < numFrames * sampleSize)
+		{
+			data.frames = keptFrames;
+			data.samples.resize(numKept * sampleSize);
+
+			for (UINT32 i = 0; i < numKept; i++)
+				encodeSample(values[keptFrames[i]], data, &data.samples[i * sampleSize]);
+		}
+		else
+		{
+			data.samples.resize(numFrames * sampleSize);
+
+			for (UINT32 i = 0; i < numFrames; i++)
+				encodeSample(values[i], data, &data.samples[i * sampleSize]);
+		}
+
+		return output;
+	}
+
+	template <class T>
+	void TAnimationCurve<T>::findSamples(float time, const TCurveCache<T>* cache, UINT32& leftSample, 
+		UINT32& rightSample, float& t) const
+	{
+		const UINT32 numSamples = (UINT32)mCompressed.samples.size() / TCompressedSampleSize<T>::count;
+		const UINT32 lastFrame = getCompressedFrame(numSamples - 1);
+
+		float frame = 0.0f;
+		if (mCompressed.sampleInterval > 0.0f)
+			frame = Math::clamp((time - mStart) / mCompressed.sampleInterval, 0.0f, (float)lastFrame);
+
+		// Every frame has a sample, so it can be located directly
+		if (mCompressed.frames.empty())
+		{
+			leftSample = std::min((UINT32)frame, numSamples - 1);
+			rightSample = std::min(leftSample + 1, numSamples - 1);
+			t = frame - (float)leftSample;
+			return;
+		}
+
+		// Check the segment evaluated last and the one following it first, since curves are mostly evaluated in order
+		leftSample = (UINT32)-1;
+		if (cache != nullptr && cache->cachedKey < numSamples)
+		{
+			UINT32 end = std::min(cache->cachedKey + 2, numSamples - 1);
+			for (UINT32 i = cache->cachedKey; i < end; i++)
+			{
+				if (frame >= mCompressed.frames[i] && frame < mCompressed.frames[i + 1])
+				{
+					leftSample = i;
+					break;
+				}
+			}
+		}
+
+		if (leftSample == (UINT32)-1)
+		{
+			auto iterFind = std::upper_bound(mCompressed.frames.begin(), mCompressed.frames.end(), frame);
+			leftSample = (UINT32)std::max((INT32)(iterFind - mCompressed.frames.begin()) - 1, 0);
+		}
+
+		if (cache != nullptr)
+			cache->cachedKey = leftSample;
+
+		rightSample = std::min(leftSample + 1, numSamples - 1);
+
+		UINT32 leftFrame = mCompressed.frames[leftSample];
+		UINT32 rightFrame = mCompressed.frames[rightSample];
+
+		if (rightFrame > leftFrame)
+			t = Math::clamp01((frame - leftFrame) / (float)(rightFrame - leftFrame));
+		else
+			t = 0.0f;
+	}
+
+	template <class T>
+	T TAnimationCurve<T>::evaluateCompressed(float time, const TCurveCache<T>* cache) const
+	{
+		UINT32 leftSample;
+		UINT32 rightSample;
+		float t;
+
+		findSamples(time, cache, leftSample, rightSample, t);
+
+		T leftValue = getCompressedSample(leftSample);
+		if (leftSample == rightSample)
+			return leftValue;
+
+		return lerpSample(t, leftValue, getCompressedSample(rightSample));
+	}
+
+	template <class T>
+	T TAnimationCurve<T>::getCompressedSample(UINT32 idx) const
+	{
+		const UINT32 sampleSize = TCompressedSampleSize<T>::count;
+
+		T output;
+		decodeSample(&mCompressed.samples[idx * sampleSize], mCompressed, output);
+
+		return output;
+	}
+
 	template class TAnimationCurve<Vector3>;
 	template class TAnimationCurve<Quaternion>;
 	template class TAnimationCurve<float>;
@@ -27,6 +27,33 @@ namespace bs
 	template struct BS_SCRIPT_EXPORT(m:Animation,n:KeyFrameVec3,pl:true) TKeyframe<Vector3>;
 	template struct BS_SCRIPT_EXPORT(m:Animation,n:KeyFrameQuat,pl:true) TKeyframe<Quaternion>;
 
+	/** 
+	 * Compact representation of an animation curve. The curve is sampled at a fixed rate, samples that can be
+	 * reconstructed by linearly interpolating their neighbours are dropped, and the rest are quantized to 16-bit
+	 * integers. Scalars and vectors are stored relative to the range of values the curve spans, while rotations store
+	 * the three smallest components of the quaternion.
+	 */
+	struct CompressedCurveData
+	{
+		/** Time between two consecutive sample frames, in seconds. */
+		float sampleInterval = 0.0f;
+
+		/** Minimum value of each component over the entire curve. Not used by rotation curves. */
+		float rangeMin[3] = { 0.0f, 0.0f, 0.0f };
+
+		/** Difference between the maximum and the minimum value of each component. Not used by rotation curves. */
+		float rangeExtent[3] = { 0.0f, 0.0f, 0.0f };
+
+		/** 
+		 * Frame index of each stored sample. Empty if a sample is stored for every frame, in which case samples are
+		 * located directly from the evaluation time.
+		 */
+		Vector<UINT16> frames;
+
+		/** Quantized sample values. Each sample takes one 16-bit value for scalars and three for vectors and rotations. */
+		Vector<UINT16> samples;
+	};
+
 	/**
 	 * Animation spline represented by a set of keyframes, each representing an endpoint of a cubic hermite curve. The
 	 * spline can be evaluated at any time, and uses caching to speed up multiple sequential evaluations.
@@ -101,10 +128,25 @@ namespace bs
 		 */
 		void makeAdditive();
 
+		/**
+		 * Creates a compressed version of the curve. The curve is sampled at a fixed rate and samples are quantized to
+		 * 16-bit values. Samples that can be reconstructed by interpolating their neighbours within @p tolerance are
+		 * removed. The compressed curve is evaluated directly from the quantized samples but contains no keyframes, and
+		 * cannot be split or made additive.
+		 *
+		 * @param[in]	sampleRate	Number of samples per second to evaluate the curve at.
+		 * @param[in]	tolerance	Maximum per-component error allowed when removing samples. Zero keeps every sample.
+		 * @return					Compressed version of the curve.
+		 */
+		TAnimationCurve<T> compress(UINT32 sampleRate, float tolerance) const;
+
+		/** Checks does the curve store compressed samples instead of keyframes. @see compress() */
+		bool isCompressed() const { return !mCompressed.samples.empty(); }
+
 		/** Returns the length of the animation curve, from time zero to last keyframe. */
 		float getLength() const { return mEnd; }
 
-		/** Returns the total number of key-frames in the curve. */
+		/** Returns the total number of key-frames in the curve. Always zero for compressed curves. */
 		UINT32 getNumKeyFrames() const { return (UINT32)mKeyframes.size(); }
 
 		/** Returns a keyframe at the specified index. */
@@ -164,9 +206,35 @@ namespace bs
 		 */
 		T evaluateCache(float time, const TCurveCache<T>& animInstance) const;
 
+		/** 
+		 * Finds a pair of compressed samples to interpolate between to evaluate the curve at the provided time.
+		 *
+		 * @param[in]	time			Time to evaluate the curve at. It is expected to be clamped to a valid range within
+		 *								the curve.
+		 * @param[in]	cache			Optional cache holding the sample pair found on the previous call.
+		 * @param[out]	leftSample		Index of the sample to interpolate from.
+		 * @param[out]	rightSample		Index of the sample to interpolate to.
+		 * @param[out]	t				Position between the two samples, in range [0, 1].
+		 */
+		void findSamples(float time, const TCurveCache<T>* cache, UINT32& leftSample, UINT32& rightSample, float& t) const;
+
+		/** Evaluates the compressed curve at the provided time. Time is expected to be wrapped or clamped. */
+		T evaluateCompressed(float time, const TCurveCache<T>* cache) const;
+
+		/** Dequantizes the compressed sample at the specified index. */
+		T getCompressedSample(UINT32 idx) const;
+
+		/** Returns the frame index of the compressed sample at the specified index. */
+		UINT32 getCompressedFrame(UINT32 idx) const
+		{
+			return mCompressed.frames.empty() ? idx : mCompressed.frames[idx];
+		}
+
 		static const UINT32 CACHE_LOOKAHEAD;
+		static const UINT32 MAX_COMPRESSED_SEGMENT;
 
 		Vector<KeyFrame> mKeyframes;
+		CompressedCurveData mCompressed;
 		float mStart;
 		float mEnd;
 		float mLength;
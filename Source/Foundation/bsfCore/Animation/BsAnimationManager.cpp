@@ -37,21 +37,29 @@ namespace bs
 
 	const EvaluatedAnimationData* AnimationManager::update(bool async)
 	{
-		// Wait for any workers to complete
+		// Workers from the previous update are still running. In async mode don't wait for them, and instead keep
+		// providing the most recently completed data. Time keeps accumulating, so the next evaluation catches up.
+		if (mNumActiveWorkers.load(std::memory_order_acquire) > 0)
 		{
-			Lock lock(mMutex);
-
-			while (mNumActiveWorkers > 0)
-				mWorkerDoneSignal.wait(lock);
-
-			// Advance the buffers (last write buffer becomes read buffer)
-			if(mSwapBuffers)
+			if (async)
 			{
-				mPoseReadBufferIdx = (mPoseReadBufferIdx + 1) % (CoreThread::NUM_SYNC_BUFFERS + 1);
-				mPoseWriteBufferIdx = (mPoseWriteBufferIdx + 1) % (CoreThread::NUM_SYNC_BUFFERS + 1);
+				if (!mPaused)
+					mAnimationTime += gTime().getFrameDelta();
 
-				mSwapBuffers = false;
+				return &mAnimData[mPoseReadBufferIdx];
 			}
+
+			waitUntilComplete();
+		}
+
+		// Advance the buffers (last write buffer becomes read buffer)
+		if(mSwapBuffers)
+		{
+			const UINT32 numPoseBuffers = getNumPoseBuffers();
+			mPoseReadBufferIdx = (mPoseReadBufferIdx + 1) % numPoseBuffers;
+			mPoseWriteBufferIdx = (mPoseWriteBufferIdx + 1) % numPoseBuffers;
+
+			mSwapBuffers = false;
 		}
 
 		if(mPaused)
@@ -84,8 +92,11 @@ namespace bs
 			mProxies.push_back(anim.second->mAnimProxy);
 		}
 
-		// Build frustums for culling
+		// Build frustums for culling, and views for determining update levels of detail
 		mCullFrustums.clear();
+		mLODViews.clear();
+		mActiveUpdateLODs = mUpdateLODs;
+		mUpdateCount++;
 
 		auto& allCameras = gSceneManager().getAllCameras();
 		for(auto& entry : allCameras)
@@ -97,77 +108,165 @@ namespace bs
 			// TODO: Not checking if camera and animation renderable's layers match. If we checked more animations could
 			// be culled.
 			mCullFrustums.push_back(entry.second->getWorldFrustum());
+
+			LODView lodView;
+			lodView.position = entry.second->getTransform().getPosition();
+			lodView.projScale = entry.second->getProjectionMatrix()[1][1];
+			lodView.nearPlane = entry.second->getNearClipDistance();
+			lodView.perspective = entry.second->getProjectionType() == PT_PERSPECTIVE;
+
+			mLODViews.push_back(lodView);
 		}
 
-		// Prepare the write buffer
+		findSharedPoses();
+
+		// Assign each animation a range in the write buffer, and split the animations into batches. Animations sharing
+		// a pose evaluated by another animation don't need a range of their own.
+		UINT32 numProxies = (UINT32)mProxies.size();
+		mProxyBoneOffsets.resize(numProxies);
+		mBatches.clear();
+
 		UINT32 totalNumBones = 0;
-		for (auto& anim : mProxies)
+		UINT32 batchStart = 0;
+		UINT32 batchNumBones = 0;
+		for (UINT32 i = 0; i < numProxies; i++)
 		{
-			if (anim->skeleton != nullptr)
-				totalNumBones += anim->skeleton->getNumBones();
+			const SPtr<AnimationProxy>& anim = mProxies[i];
+
+			UINT32 poseSource = mProxyPoseSources[i];
+
+			UINT32 numBones = 0;
+			if (anim->skeleton != nullptr && (poseSource == (UINT32)-1 || poseSource == i))
+				numBones = anim->skeleton->getNumBones();
+
+			mProxyBoneOffsets[i] = totalNumBones;
+			totalNumBones += numBones;
+			batchNumBones += numBones;
+
+			UINT32 batchNumProxies = i + 1 - batchStart;
+			if (!mBatchedEvaluation || batchNumBones >= MAX_BONES_PER_BATCH || batchNumProxies >= MAX_PROXIES_PER_BATCH)
+			{
+				mBatches.push_back({ batchStart, i + 1 });
+
+				batchStart = i + 1;
+				batchNumBones = 0;
+			}
 		}
 
+		if (batchStart < numProxies)
+			mBatches.push_back({ batchStart, numProxies });
+
 		// Prepare the write buffer
 		EvaluatedAnimationData& renderData = mAnimData[mPoseWriteBufferIdx];
 		renderData.transforms.resize(totalNumBones);
 		renderData.infos.clear();
 
-		// Queue animation evaluation tasks
+		// Queue animation evaluation tasks. When batching, queue only as many tasks as there are workers, each pulling
+		// batches until none remain.
+		UINT32 numBatches = (UINT32)mBatches.size();
+		UINT32 numTasks = numBatches;
+		if (mBatchedEvaluation)
+			numTasks = std::min(numBatches, std::max(1U, TaskScheduler::instance().getNumWorkers()));
+
+		mNextBatchIdx = 0;
+		mNumActiveWorkers.store(numTasks, std::memory_order_release);
+
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			SPtr<Task> task = Task::create("AnimWorker", std::bind(&AnimationManager::evaluateBatches, this));
+			TaskScheduler::instance().addTask(task);
+		}
+
+		// Wait for tasks to complete
+		if(!async)
 		{
-			Lock lock(mMutex);
-			mNumActiveWorkers = (UINT32)mProxies.size();
+			waitUntilComplete();
+
+			// Trigger events and update attachments (for the data we just evaluated)
+			for (auto& anim : mAnimations)
+			{
+				anim.second->updateFromProxy();
+				anim.second->triggerEvents(mAnimationTime, gTime().getFrameDelta());
+			}
 		}
 
-		UINT32 curBoneIdx = 0;
-		for (auto& anim : mProxies)
+		mSwapBuffers = true;
+
+		return &mAnimData[mPoseReadBufferIdx];
+	}
+
+	void AnimationManager::evaluateBatches()
+	{
+		// Each worker thread has its own frame allocator, so temporary data doesn't need to touch the general heap
+		bs_frame_mark();
 		{
-			auto evaluateAnimWorker = [this, anim, curBoneIdx]()
+			FrameVector<std::pair<UINT64, EvaluatedAnimationData::AnimInfo>> animInfos;
+
+			UINT32 numBatches = (UINT32)mBatches.size();
+			while (true)
 			{
-				UINT32 boneIdx = curBoneIdx;
-				evaluateAnimation(anim.get(), boneIdx);
+				UINT32 batchIdx = mNextBatchIdx.fetch_add(1);
+				if (batchIdx >= numBatches)
+					break;
 
-				Lock lock(mMutex);
+				const AnimationBatch& batch = mBatches[batchIdx];
+				for (UINT32 i = batch.start; i < batch.end; i++)
 				{
-					assert(mNumActiveWorkers > 0);
-					mNumActiveWorkers--;
-				}
+					AnimationProxy* anim = mProxies[i].get();
+					UINT32 boneIdx = mProxyBoneOffsets[i];
 
-				mWorkerDoneSignal.notify_one();
-			};
+					UINT32 poseSource = mProxyPoseSources[i];
 
-			SPtr<Task> task = Task::create("AnimWorker", evaluateAnimWorker);
-			TaskScheduler::instance().addTask(task);
+					UINT32 poseIdx = (UINT32)-1;
+					if (poseSource != (UINT32)-1 && poseSource != i)
+						poseIdx = mProxyBoneOffsets[poseSource];
 
-			if (anim->skeleton != nullptr)
-				curBoneIdx += anim->skeleton->getNumBones();
-		}
+					EvaluatedAnimationData::AnimInfo animInfo;
+					if (evaluateAnimation(anim, boneIdx, animInfo, poseSource != (UINT32)-1, poseIdx))
+						animInfos.push_back(std::make_pair(anim->id, animInfo));
+				}
+			}
 
-		// Wait for tasks to complete
-		if(!async)
-		{
+			// Register all evaluated animations at once
 			{
 				Lock lock(mMutex);
 
-				while (mNumActiveWorkers > 0)
-					mWorkerDoneSignal.wait(lock);
+				EvaluatedAnimationData& renderData = mAnimData[mPoseWriteBufferIdx];
+				for (auto& entry : animInfos)
+					renderData.infos[entry.first] = entry.second;
 			}
 
-			// Trigger events and update attachments (for the data we just evaluated)
-			for (auto& anim : mAnimations)
+			// Publish the results, and wake up the simulation thread in case it's waiting on this worker
+			UINT32 numRemaining = mNumActiveWorkers.fetch_sub(1, std::memory_order_acq_rel);
+			assert(numRemaining > 0);
+
+			if (numRemaining == 1)
 			{
-				anim.second->updateFromProxy();
-				anim.second->triggerEvents(mAnimationTime, gTime().getFrameDelta());
+				Lock lock(mMutex);
+				mWorkerDoneSignal.notify_all();
 			}
 		}
+		bs_frame_clear();
+	}
 
-		mSwapBuffers = true;
+	void AnimationManager::waitUntilComplete()
+	{
+		Lock lock(mMutex);
 
-		return &mAnimData[mPoseReadBufferIdx];
+		while (mNumActiveWorkers.load(std::memory_order_acquire) > 0)
+			mWorkerDoneSignal.wait(lock);
 	}
 
-	void AnimationManager::evaluateAnimation(AnimationProxy* anim, UINT32& curBoneIdx)
+	void AnimationManager::onShutDown()
 	{
-		if (anim->mCullEnabled)
+		// Workers reference the manager's buffers, so they must finish before it is destroyed
+		waitUntilComplete();
+	}
+
+	bool AnimationManager::evaluateAnimation(AnimationProxy* anim, UINT32& curBoneIdx, 
+		EvaluatedAnimationData::AnimInfo& animInfo, bool sharedPose, UINT32 poseIdx)
+	{
+		if (anim->mCullEnabled && !sharedPose)
 		{
 			bool isVisible = false;
 			for (auto& frustum : mCullFrustums)
@@ -180,19 +279,55 @@ namespace bs
 			}
 
 			if (!isVisible)
-				return;
+			{
+				// Culled animations skip evaluation and keep their last pose, except for an occasional low-rate update
+				anim->mNumCulledFrames++;
+
+				bool lowRateUpdate = mCulledUpdateInterval > 0 && (anim->mNumCulledFrames % mCulledUpdateInterval) == 0;
+				if (!lowRateUpdate)
+				{
+					// Nothing is provided to the renderer, and scene object poses simply stay as they were
+					if (anim->skeleton == nullptr && anim->numMorphShapes == 0)
+						return false;
+
+					if (reusePreviousPose(anim, curBoneIdx, animInfo))
+						return true;
+				}
+			}
+			else
+			{
+				anim->mNumCulledFrames = 0;
+
+				// Small animations are evaluated less often, staggered by their ID so they don't all update together
+				UINT32 interval = getUpdateInterval(anim->mBounds);
+				if (interval > 1 && ((mUpdateCount + (UINT32)anim->id) % interval) != 0)
+				{
+					if (reusePreviousPose(anim, curBoneIdx, animInfo))
+						return true;
+				}
+			}
 		}
 
 		EvaluatedAnimationData& renderData = mAnimData[mPoseWriteBufferIdx];
 		
-		UINT32 prevPoseBufferIdx = (mPoseWriteBufferIdx + CoreThread::NUM_SYNC_BUFFERS) % (CoreThread::NUM_SYNC_BUFFERS + 1);
+		const UINT32 numPoseBuffers = getNumPoseBuffers();
+		UINT32 prevPoseBufferIdx = (mPoseWriteBufferIdx + numPoseBuffers - 1) % numPoseBuffers;
 		EvaluatedAnimationData& prevRenderData = mAnimData[prevPoseBufferIdx];
 
-		EvaluatedAnimationData::AnimInfo animInfo;
 		bool hasAnimInfo = false;
 
 		// Evaluate skeletal animation
-		if (anim->skeleton != nullptr)
+		if (anim->skeleton != nullptr && poseIdx != (UINT32)-1)
+		{
+			// Pose was evaluated by another animation
+			EvaluatedAnimationData::PoseInfo& poseInfo = animInfo.poseInfo;
+			poseInfo.animId = anim->id;
+			poseInfo.startIdx = poseIdx;
+			poseInfo.numBones = anim->skeleton->getNumBones();
+
+			hasAnimInfo = true;
+		}
+		else if (anim->skeleton != nullptr)
 		{
 			UINT32 numBones = anim->skeleton->getNumBones();
 
@@ -220,6 +355,7 @@ namespace bs
 
 			// Animate bones
 			anim->skeleton->getPose(boneDst, anim->skeletonPose, anim->skeletonMask, anim->layers, anim->numLayers);
+			evaluateBoneAttachments(*anim);
 
 			curBoneIdx += numBones;
 			hasAnimInfo = true;
@@ -424,86 +560,287 @@ namespace bs
 				}
 			}
 
-			// Generate morph shape vertices
+			// Generate morph shape vertices, or just provide the weights if the renderer blends the shapes itself
 			if (anim->morphChannelWeightsDirty || hasMorphCurves)
 			{
-				SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(anim->numMorphVertices, 0, mBlendShapeVertexDesc);
+				if (mGPUMorphBlending)
+				{
+					Vector<float>& shapeWeights = animInfo.morphShapeInfo.shapeWeights;
+					shapeWeights.resize(anim->numMorphShapes);
 
-				UINT8* bufferData = meshData->getData();
-				memset(bufferData, 0, meshData->getSize());
+					for (UINT32 i = 0; i < anim->numMorphShapes; i++)
+						shapeWeights[i] = anim->morphShapeInfos[i].finalWeight;
 
-				UINT32 tempDataSize = (sizeof(Vector3) + sizeof(float)) * anim->numMorphVertices;
-				UINT8* tempData = (UINT8*)bs_stack_alloc(tempDataSize);
-				memset(tempData, 0, tempDataSize);
+					animInfo.morphShapeInfo.meshData = nullptr;
+				}
+				else
+				{
+					SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(anim->numMorphVertices, 0, mBlendShapeVertexDesc);
 
-				Vector3* tempNormals = (Vector3*)tempData;
-				float* accumulatedWeight = (float*)(tempData + sizeof(Vector3) * anim->numMorphVertices);
+					float* weights = bs_stack_alloc<float>(anim->numMorphShapes);
+					for (UINT32 i = 0; i < anim->numMorphShapes; i++)
+						weights[i] = anim->morphShapeInfos[i].finalWeight;
 
-				UINT8* positions = meshData->getElementData(VES_POSITION, 1, 1);
-				UINT8* normals = meshData->getElementData(VES_NORMAL, 1, 1);
+					UINT8* output = meshData->getElementData(VES_POSITION, 1, 1);
+					anim->morphShapes->blend(weights, output, mBlendShapeVertexDesc->getVertexStride(1));
+					bs_stack_free(weights);
 
-				UINT32 stride = mBlendShapeVertexDesc->getVertexStride(1);
+					animInfo.morphShapeInfo.meshData = meshData;
+					animInfo.morphShapeInfo.shapeWeights.clear();
+				}
 
-				for (UINT32 i = 0; i < anim->numMorphShapes; i++)
-				{
-					const MorphShapeInfo& info = anim->morphShapeInfos[i];
-					float absWeight = Math::abs(info.finalWeight);
+				animInfo.morphShapeInfo.version++;
+				anim->morphChannelWeightsDirty = false;
+			}
 
-					if (absWeight < 0.0001f)
-						continue;
+			hasAnimInfo = true;
+		}
+		else
+			animInfo.morphShapeInfo.version = 1;
 
-					const Vector<MorphVertex>& morphVertices = info.shape->getVertices();
-					UINT32 numVertices = (UINT32)morphVertices.size();
-					for (UINT32 j = 0; j < numVertices; j++)
-					{
-						const MorphVertex& vertex = morphVertices[j];
+		return hasAnimInfo;
+	}
 
-						Vector3* destPos = (Vector3*)(positions + vertex.sourceIdx * stride);
-						*destPos += vertex.deltaPosition * info.finalWeight;
+	void AnimationManager::findSharedPoses()
+	{
+		UINT32 numProxies = (UINT32)mProxies.size();
+		mProxyPoseSources.assign(numProxies, (UINT32)-1);
 
-						tempNormals[vertex.sourceIdx] += vertex.deltaNormal * info.finalWeight;
-						accumulatedWeight[vertex.sourceIdx] += absWeight;
-					}
-				}
+		if (!mPoseSharing)
+			return;
 
-				for (UINT32 i = 0; i < anim->numMorphVertices; i++)
-				{
-					PackedNormal* destNrm = (PackedNormal*)(normals + i * stride);
+		UnorderedMap<size_t, UINT32> poseOwners;
+		for (UINT32 i = 0; i < numProxies; i++)
+		{
+			const AnimationProxy& anim = *mProxies[i];
+			if (!isPoseShareable(anim))
+				continue;
 
-					if (accumulatedWeight[i] > 0.0001f)
-					{
-						Vector3 normal = tempNormals[i] / accumulatedWeight[i];
-						normal /= 2.0f; // Accumulated normal is in range [-2, 2] but our normal packing method assumes [-1, 1] range
+			size_t hash = getPoseHash(anim);
 
-						MeshUtility::packNormals(&normal, (UINT8*)destNrm, 1, sizeof(Vector3), stride);
-						destNrm->w = (UINT8)(std::min(1.0f, accumulatedWeight[i]) * 255.999f);
-					}
-					else
-					{
-						*destNrm = { { 127, 127, 127, 0 } };
-					}
-				}
+			auto iterFind = poseOwners.find(hash);
+			if (iterFind == poseOwners.end())
+			{
+				poseOwners[hash] = i;
+				continue;
+			}
 
-				bs_stack_free(tempData);
+			// On the rare hash collision the proxy simply evaluates its own pose
+			UINT32 ownerIdx = iterFind->second;
+			if (!isPoseEqual(*mProxies[ownerIdx], anim))
+				continue;
 
-				animInfo.morphShapeInfo.meshData = meshData;
+			mProxyPoseSources[ownerIdx] = ownerIdx;
+			mProxyPoseSources[i] = ownerIdx;
+		}
+	}
 
-				animInfo.morphShapeInfo.version++;
-				anim->morphChannelWeightsDirty = false;
+	bool AnimationManager::isPoseShareable(const AnimationProxy& anim)
+	{
+		if (anim.skeleton == nullptr || anim.numLayers == 0)
+			return false;
+
+		// Scene objects attached to bones override bone transforms, and read back the proxy's own local pose
+		for (UINT32 i = 0; i < anim.numSceneObjects; i++)
+		{
+			if (anim.sceneObjectInfos[i].boneIdx != -1)
+				return false;
+		}
+
+		return true;
+	}
+
+	size_t AnimationManager::getPoseHash(const AnimationProxy& anim) const
+	{
+		size_t hash = 0;
+		hash_combine(hash, anim.skeleton.get());
+		hash_combine(hash, anim.numLayers);
+
+		for (UINT32 i = 0; i < anim.numLayers; i++)
+		{
+			const AnimationStateLayer& layer = anim.layers[i];
+			hash_combine(hash, layer.index);
+			hash_combine(hash, layer.additive);
+			hash_combine(hash, layer.numStates);
+
+			for (UINT32 j = 0; j < layer.numStates; j++)
+			{
+				const AnimationState& state = layer.states[j];
+				hash_combine(hash, state.curves.get());
+				hash_combine(hash, state.disabled);
+
+				if (state.disabled)
+					continue;
+
+				hash_combine(hash, getPoseSharingTime(state.time));
+				hash_combine(hash, state.weight);
+				hash_combine(hash, state.loop);
 			}
+		}
 
-			hasAnimInfo = true;
+		return hash;
+	}
+
+	bool AnimationManager::isPoseEqual(const AnimationProxy& lhs, const AnimationProxy& rhs) const
+	{
+		if (lhs.skeleton != rhs.skeleton || lhs.numLayers != rhs.numLayers || lhs.skeletonMask != rhs.skeletonMask)
+			return false;
+
+		for (UINT32 i = 0; i < lhs.numLayers; i++)
+		{
+			const AnimationStateLayer& lhsLayer = lhs.layers[i];
+			const AnimationStateLayer& rhsLayer = rhs.layers[i];
+
+			if (lhsLayer.index != rhsLayer.index || lhsLayer.additive != rhsLayer.additive || 
+				lhsLayer.numStates != rhsLayer.numStates)
+				return false;
+
+			for (UINT32 j = 0; j < lhsLayer.numStates; j++)
+			{
+				const AnimationState& lhsState = lhsLayer.states[j];
+				const AnimationState& rhsState = rhsLayer.states[j];
+
+				if (lhsState.curves != rhsState.curves || lhsState.disabled != rhsState.disabled)
+					return false;
+
+				if (lhsState.disabled)
+					continue;
+
+				if (getPoseSharingTime(lhsState.time) != getPoseSharingTime(rhsState.time) ||
+					lhsState.weight != rhsState.weight || lhsState.loop != rhsState.loop)
+					return false;
+			}
 		}
-		else
-			animInfo.morphShapeInfo.version = 1;
 
-		if (hasAnimInfo)
+		return true;
+	}
+
+	float AnimationManager::getPoseSharingTime(float time) const
+	{
+		if (mPoseSharingTimeStep <= 0.0f)
+			return time;
+
+		return Math::floor(time / mPoseSharingTimeStep);
+	}
+
+	void AnimationManager::evaluateBoneAttachments(AnimationProxy& anim)
+	{
+		const LocalSkeletonPose& localPose = anim.skeletonPose;
+		LocalSkeletonPose& attachmentPose = anim.boneAttachmentPose;
+
+		for (UINT32 i = 0; i < anim.numSceneObjects; i++)
 		{
-			Lock lock(mMutex);
-			renderData.infos[anim->id] = animInfo;
+			const AnimatedSceneObjectInfo& soInfo = anim.sceneObjectInfos[i];
+
+			// Bones without animation are driven by the attached scene object, rather than the other way around
+			if (soInfo.boneIdx == -1 || localPose.hasOverride[soInfo.boneIdx])
+			{
+				attachmentPose.hasOverride[i] = true;
+				continue;
+			}
+
+			Vector3 position = localPose.positions[soInfo.boneIdx];
+			Quaternion rotation = localPose.rotations[soInfo.boneIdx];
+			Vector3 scale = localPose.scales[soInfo.boneIdx];
+
+			UINT32 parentBoneIdx = anim.skeleton->getBoneInfo(soInfo.boneIdx).parent;
+			while (parentBoneIdx != (UINT32)-1)
+			{
+				// Update rotation
+				const Quaternion& parentOrientation = localPose.rotations[parentBoneIdx];
+				rotation = parentOrientation * rotation;
+
+				// Update scale
+				const Vector3& parentScale = localPose.scales[parentBoneIdx];
+				scale = parentScale * scale;
+
+				// Update position
+				position = parentOrientation.rotate(parentScale * position);
+				position += localPose.positions[parentBoneIdx];
+
+				parentBoneIdx = anim.skeleton->getBoneInfo(parentBoneIdx).parent;
+			}
+
+			attachmentPose.positions[i] = position;
+			attachmentPose.rotations[i] = rotation;
+			attachmentPose.scales[i] = scale;
+			attachmentPose.hasOverride[i] = false;
 		}
 	}
 
+	bool AnimationManager::reusePreviousPose(AnimationProxy* anim, UINT32& curBoneIdx, 
+		EvaluatedAnimationData::AnimInfo& animInfo)
+	{
+		const UINT32 numPoseBuffers = getNumPoseBuffers();
+		UINT32 prevPoseBufferIdx = (mPoseWriteBufferIdx + numPoseBuffers - 1) % numPoseBuffers;
+		const EvaluatedAnimationData& prevRenderData = mAnimData[prevPoseBufferIdx];
+
+		auto iterFind = prevRenderData.infos.find(anim->id);
+		if (iterFind == prevRenderData.infos.end())
+			return false;
+
+		const EvaluatedAnimationData::AnimInfo& prevAnimInfo = iterFind->second;
+
+		UINT32 numBones = 0;
+		if (anim->skeleton != nullptr)
+			numBones = anim->skeleton->getNumBones();
+
+		// Skeleton changed since the last update
+		if (prevAnimInfo.poseInfo.numBones != numBones)
+			return false;
+
+		// Morph shapes haven't been evaluated yet, or their weights changed
+		const EvaluatedAnimationData::MorphShapeInfo& prevMorphInfo = prevAnimInfo.morphShapeInfo;
+		bool hasMorphShapes = prevMorphInfo.meshData != nullptr || !prevMorphInfo.shapeWeights.empty();
+		if (anim->numMorphShapes > 0 && (!hasMorphShapes || anim->morphChannelWeightsDirty))
+			return false;
+
+		animInfo = prevAnimInfo;
+		animInfo.poseInfo.startIdx = numBones > 0 ? curBoneIdx : 0;
+
+		if (numBones > 0)
+		{
+			EvaluatedAnimationData& renderData = mAnimData[mPoseWriteBufferIdx];
+			memcpy(&renderData.transforms[curBoneIdx], &prevRenderData.transforms[prevAnimInfo.poseInfo.startIdx],
+				numBones * sizeof(Matrix4));
+
+			curBoneIdx += numBones;
+		}
+
+		return true;
+	}
+
+	UINT32 AnimationManager::getUpdateInterval(const AABox& bounds) const
+	{
+		if (mActiveUpdateLODs.empty() || mLODViews.empty())
+			return 1;
+
+		Vector3 center = bounds.getCenter();
+		float radius = bounds.getRadius();
+
+		// Projected diameter in NDC is 2 * radius * proj[1][1] / distance, and NDC spans two units
+		float screenSize = 0.0f;
+		for (auto& view : mLODViews)
+		{
+			float scale = view.projScale * radius;
+			if (view.perspective)
+				scale /= std::max(center.distance(view.position) - radius, view.nearPlane);
+
+			screenSize = std::max(screenSize, scale);
+		}
+
+		UINT32 interval = 1;
+		for (auto& lod : mActiveUpdateLODs)
+		{
+			if (screenSize >= lod.screenSize)
+				break;
+
+			interval = std::max(lod.interval, 1U);
+		}
+
+		return interval;
+	}
+
 	UINT64 AnimationManager::registerAnimation(Animation* anim)
 	{
 		mAnimations[mNextId] = anim;
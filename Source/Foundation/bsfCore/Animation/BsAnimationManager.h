@@ -32,6 +32,13 @@ namespace bs
 		{
 			SPtr<MeshData> meshData;
 			UINT32 version;
+
+			/** 
+			 * Weight of every morph shape, ordered by channel and then by shape within a channel. Only provided if morph
+			 * shapes are blended by the renderer (see AnimationManager::setGPUMorphBlending()), in which case 
+			 * @p meshData is null.
+			 */
+			Vector<float> shapeWeights;
 		};
 
 		/** Contains meta-data about where calculated animation data is stored. */
@@ -50,6 +57,19 @@ namespace bs
 		Vector<Matrix4> transforms;
 	};
 
+	/** Determines how often are animations evaluated when their projected size on screen falls below some threshold. */
+	struct AnimationUpdateLOD
+	{
+		/** 
+		 * Size of the animated object's bounds on screen, as a fraction of the view height, below which this level is 
+		 * used.
+		 */
+		float screenSize = 0.0f;
+
+		/** Number of animation updates between two evaluations of an animation using this level. */
+		UINT32 interval = 1;
+	};
+
 	/** 
 	 * Keeps track of all active animations, queues animation thread tasks and synchronizes data between simulation, core
 	 * and animation threads.
@@ -70,6 +90,60 @@ namespace bs
 		 */
 		void setUpdateRate(UINT32 fps);
 
+		/**
+		 * Determines should animations be evaluated in batches. When enabled animated objects are grouped into batches
+		 * that fit into the CPU cache, and only one evaluation task per worker thread is queued, with each task processing
+		 * batches until none remain. When disabled each animated object is evaluated by a separate task. Enabled by
+		 * default.
+		 */
+		void setBatchedEvaluation(bool enabled) { mBatchedEvaluation = enabled; }
+
+		/**
+		 * Determines how often are animations with culling enabled evaluated while they are not visible by any camera.
+		 * In between those evaluations culled animations keep their last evaluated pose.
+		 *
+		 * @param[in]	interval	Number of animation updates between two evaluations of a culled animation. Zero means
+		 *							culled animations are never evaluated. Default is zero.
+		 */
+		void setCulledUpdateInterval(UINT32 interval) { mCulledUpdateInterval = interval; }
+
+		/**
+		 * Sets levels of detail that reduce how often are small, distant animations evaluated. For every animation with
+		 * culling enabled the largest size of its bounds projected on any camera is calculated, and the last level whose
+		 * screen size is larger than it determines the update interval. Evaluations of animations using the same interval
+		 * are staggered across updates, so they don't all happen during the same frame. In between evaluations such
+		 * animations keep their last evaluated pose. Animations sharing a pose with other animations are always
+		 * evaluated on every update.
+		 *
+		 * @param[in]	lods	Levels of detail, sorted from largest to smallest screen size. When empty (default), all
+		 *						visible animations are evaluated on every update.
+		 */
+		void setUpdateLODs(const Vector<AnimationUpdateLOD>& lods) { mUpdateLODs = lods; }
+
+		/**
+		 * Determines should morph shapes be blended by the renderer, instead of on the animation thread. When enabled
+		 * evaluated animation data contains only the weight of each morph shape, and the renderer is expected to blend
+		 * the shapes, normally on the GPU. This is set by the renderer, depending on whether it supports blending morph
+		 * shapes itself. Disabled by default.
+		 */
+		void setGPUMorphBlending(bool enabled) { mGPUMorphBlending = enabled; }
+
+		/**
+		 * Determines should animated objects that evaluate to an identical skeleton pose share a single evaluation. Poses
+		 * are shared between objects using the same skeleton and mask that play the same clips at the same time and with
+		 * the same weights, which is common for crowds. Objects with scene objects attached to their bones always evaluate
+		 * their own pose. A shared pose is evaluated even if the objects sharing it are culled. Disabled by default.
+		 */
+		void setPoseSharing(bool enabled) { mPoseSharing = enabled; }
+
+		/**
+		 * Sets the interval, in seconds, to which clip times are rounded down when determining if objects can share a
+		 * pose. Larger intervals allow more objects to share a pose, at the cost of some objects being displayed with a
+		 * pose slightly off from their own playback time. When zero, clip times must match exactly. Default is zero. Only
+		 * relevant if pose sharing is enabled.
+		 */
+		void setPoseSharingTimeStep(float step) { mPoseSharingTimeStep = step; }
+
 		/**
 		 * Evaluates animations for all animated objects, and returns the evaluated skeleton bone poses and morph shape
 		 * meshes that can be passed along to the renderer.
@@ -79,13 +153,22 @@ namespace bs
 		 *								Therefore note that this introduces a one frame latency on the animation. If the
 		 *								latency is not acceptable set this to false, at a potential performance impact.
 		 * @return						Evaluated animation data for this frame (if @p async is false), or the previous
-		 *								frame (if @p async is true). Note that the system re-uses the returned buffers,
-		 *								and the returned buffer should stop being used after every second call to update().
-		 *								This is enough to have one buffer be processed by the core thread, one queued
-		 *								for future rendering and one that's being written to.
+		 *								frame (if @p async is true). If @p async is true and the evaluation started 
+		 *								during the previous call hasn't finished yet, the method doesn't wait for it and 
+		 *								instead returns the most recent completed data again, without starting a new
+		 *								evaluation. Note that the system re-uses the returned buffers,
+		 *								and the returned buffer should stop being used after getPoseLatency() calls to
+		 *								update(). This is enough to have one buffer be processed by the core thread, one
+		 *								queued for each additional frame in flight and one that's being written to.
 		 */
 		const EvaluatedAnimationData* update(bool async = true);
 
+		/** 
+		 * Returns the number of calls to update() between a pose being evaluated and it being returned for rendering.
+		 * Two with a single frame in flight, increasing by one for each additional frame in flight.
+		 */
+		UINT32 getPoseLatency() const { return getNumPoseBuffers() - 1; }
+
 	private:
 		friend class Animation;
 
@@ -105,8 +188,24 @@ namespace bs
 		/** Unregisters an animation with the specified ID. Must be called before an Animation is destroyed. */
 		void unregisterAnimation(UINT64 id);
 
-		/** Worker method ran on the animation thread that evaluates all animation at the provided time. */
-		void evaluateAnimation();
+		/** @copydoc Module::onShutDown */
+		void onShutDown() override;
+
+		/** Blocks the calling thread until all animation workers finish. */
+		void waitUntilComplete();
+
+		/** Range of animation proxies evaluated together by a single worker. */
+		struct AnimationBatch
+		{
+			UINT32 start;
+			UINT32 end;
+		};
+
+		/** 
+		 * Worker method ran on the animation thread that evaluates batches of animations until no unprocessed batches 
+		 * remain. 
+		 */
+		void evaluateBatches();
 
 		/** 
 		 * Evaluates animation for a single object and writes the result in the currently active write buffer. 
@@ -114,8 +213,73 @@ namespace bs
 		 * @param[in]	anim		Proxy representing the animation to evaluate.
 		 * @param[in]	boneIdx		Index in the output buffer in which to write evaluated bone information. This will be
 		 *							automatically advanced by the number of written bone transforms.
+		 * @param[out]	animInfo	Information about where the evaluated data is stored.
+		 * @param[in]	sharedPose	True if the skeleton pose of the animation is shared with other animations. Shared
+		 *							poses are never culled.
+		 * @param[in]	poseIdx		Index in the output buffer of a pose evaluated by another animation that this 
+		 *							animation shares. If -1 the animation evaluates its own pose.
+		 * @return					True if @p animInfo was populated and should be registered with the render data.
+		 */
+		bool evaluateAnimation(AnimationProxy* anim, UINT32& boneIdx, EvaluatedAnimationData::AnimInfo& animInfo,
+			bool sharedPose = false, UINT32 poseIdx = (UINT32)-1);
+
+		/** 
+		 * Resolves the transforms of scene objects attached to the animation's bones from its evaluated local skeleton
+		 * pose, so the simulation thread can apply them without walking the bone hierarchy.
+		 */
+		static void evaluateBoneAttachments(AnimationProxy& anim);
+
+		/** 
+		 * Copies the pose evaluated for the animation in the previous update into the current write buffer, without 
+		 * evaluating the animation. Returns false if no compatible pose from the previous update exists, in which case
+		 * the animation needs to be evaluated normally. Parameters are the same as for evaluateAnimation().
+		 */
+		bool reusePreviousPose(AnimationProxy* anim, UINT32& boneIdx, EvaluatedAnimationData::AnimInfo& animInfo);
+
+		/** 
+		 * Finds animation proxies that evaluate to identical skeleton poses and records in @p mProxyPoseSources which
+		 * proxy evaluates the pose for each group.
 		 */
-		void evaluateAnimation(AnimationProxy* anim, UINT32& boneIdx);
+		void findSharedPoses();
+
+		/** Checks can the animation proxy share its evaluated skeleton pose with other proxies. */
+		static bool isPoseShareable(const AnimationProxy& anim);
+
+		/** Returns a hash of all the animation proxy properties its evaluated skeleton pose depends on. */
+		size_t getPoseHash(const AnimationProxy& anim) const;
+
+		/** Checks do the two animation proxies evaluate to the same skeleton pose. */
+		bool isPoseEqual(const AnimationProxy& lhs, const AnimationProxy& rhs) const;
+
+		/** Rounds the clip time according to the pose sharing time step. */
+		float getPoseSharingTime(float time) const;
+
+		/** 
+		 * Returns the number of updates between evaluations of an animation with the provided bounds, according to the
+		 * active update levels of detail.
+		 */
+		UINT32 getUpdateInterval(const AABox& bounds) const;
+
+		/** 
+		 * Returns the number of pose buffers in use. The renderer reads poses of the oldest buffer, so it must not be
+		 * overwritten until all the frames in flight that might be reading it finish.
+		 */
+		UINT32 getNumPoseBuffers() const { return gCoreThread().getNumActiveSyncBuffers() + 1; }
+
+		/** Information about a camera used for determining animation update levels of detail. */
+		struct LODView
+		{
+			Vector3 position;
+			float projScale;
+			float nearPlane;
+			bool perspective;
+		};
+
+		/** Maximum number of bones in a single evaluation batch (keeps the batch output within the L2 cache). */
+		static constexpr UINT32 MAX_BONES_PER_BATCH = 2048;
+
+		/** Maximum number of animated objects in a single evaluation batch. */
+		static constexpr UINT32 MAX_PROXIES_PER_BATCH = 64;
 
 		UINT64 mNextId;
 		UnorderedMap<UINT64, Animation*> mAnimations;
@@ -125,12 +289,25 @@ namespace bs
 		float mLastAnimationUpdateTime;
 		float mNextAnimationUpdateTime;
 		bool mPaused;
+		bool mBatchedEvaluation = true;
+		UINT32 mCulledUpdateInterval = 0;
+		bool mPoseSharing = false;
+		bool mGPUMorphBlending = false;
+		float mPoseSharingTimeStep = 0.0f;
+		Vector<AnimationUpdateLOD> mUpdateLODs;
+		UINT32 mUpdateCount = 0;
 
 		SPtr<VertexDataDesc> mBlendShapeVertexDesc;
 
 		// Animation thread
 		Vector<SPtr<AnimationProxy>> mProxies;
+		Vector<UINT32> mProxyBoneOffsets;
+		Vector<UINT32> mProxyPoseSources; /**< Index of the proxy whose pose each proxy uses, or -1 if not shared. */
+		Vector<AnimationBatch> mBatches;
+		std::atomic<UINT32> mNextBatchIdx{0};
 		Vector<ConvexVolume> mCullFrustums;
+		Vector<LODView> mLODViews;
+		Vector<AnimationUpdateLOD> mActiveUpdateLODs;
 		EvaluatedAnimationData mAnimData[CoreThread::NUM_SYNC_BUFFERS + 1];
 
 		UINT32 mPoseReadBufferIdx;
@@ -139,7 +316,7 @@ namespace bs
 		Signal mWorkerDoneSignal;
 		Mutex mMutex;
 
-		UINT32 mNumActiveWorkers = 0;
+		std::atomic<UINT32> mNumActiveWorkers{0};
 		bool mSwapBuffers = false;
 	};
 
@@ -1,6 +1,7 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Animation/BsAnimationUtility.h"
+#include "Animation/BsAnimationClip.h"
 #include "Math/BsVector3.h"
 #include "Math/BsQuaternion.h"
 
@@ -349,6 +350,25 @@ namespace bs
 		return TAnimationCurve<T>(newKeyframes);
 	}
 
+	SPtr<AnimationCurves> AnimationUtility::compressCurves(const AnimationCurves& curves, UINT32 sampleRate, 
+		float tolerance)
+	{
+		SPtr<AnimationCurves> output = bs_shared_ptr_new<AnimationCurves>(curves);
+
+		auto compressAll = [&](auto& namedCurves)
+		{
+			for (auto& entry : namedCurves)
+				entry.curve = entry.curve.compress(sampleRate, tolerance);
+		};
+
+		compressAll(output->position);
+		compressAll(output->rotation);
+		compressAll(output->scale);
+		compressAll(output->generic);
+
+		return output;
+	}
+
 	template BS_CORE_EXPORT TAnimationCurve<Vector3> AnimationUtility::scaleCurve(const TAnimationCurve<Vector3>& curve, float factor);
 	template BS_CORE_EXPORT TAnimationCurve<Quaternion> AnimationUtility::scaleCurve(const TAnimationCurve<Quaternion>& curve, float factor);
 	template BS_CORE_EXPORT TAnimationCurve<float> AnimationUtility::scaleCurve(const TAnimationCurve<float>& curve, float factor);
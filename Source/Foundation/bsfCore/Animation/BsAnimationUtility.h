@@ -48,6 +48,18 @@ namespace bs
 		/** Adds a time offset to all keyframes in the provided curve. */
 		template<class T>
 		static TAnimationCurve<T> offsetCurve(const TAnimationCurve<T>& curve, float offset);
+
+		/** 
+		 * Creates a copy of the provided curve set with every curve compressed. 
+		 *
+		 * @param[in]	curves		Curves to compress.
+		 * @param[in]	sampleRate	Number of samples per second to evaluate the curves at.
+		 * @param[in]	tolerance	Maximum per-component error allowed when removing samples that can be interpolated.
+		 * @return					New curve set containing compressed curves.
+		 *
+		 * @see TAnimationCurve::compress()
+		 */
+		static SPtr<AnimationCurves> compressCurves(const AnimationCurves& curves, UINT32 sampleRate, float tolerance);
 	};
 
 	/** @} */
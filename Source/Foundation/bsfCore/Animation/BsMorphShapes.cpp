@@ -2,6 +2,8 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Animation/BsMorphShapes.h"
 #include "Private/RTTI/BsMorphShapesRTTI.h"
+#include "Mesh/BsMeshUtility.h"
+#include "Math/BsMath.h"
 
 namespace bs
 {
@@ -78,6 +80,70 @@ namespace bs
 		return bs_shared_ptr(raw);
 	}
 
+	UINT32 MorphShapes::getNumShapes() const
+	{
+		UINT32 numShapes = 0;
+		for (auto& channel : mChannels)
+			numShapes += channel->getNumShapes();
+
+		return numShapes;
+	}
+
+	void MorphShapes::blend(const float* weights, UINT8* output, UINT32 stride) const
+	{
+		for (UINT32 i = 0; i < mNumVertices; i++)
+			memset(output + i * stride, 0, sizeof(Vector3));
+
+		UINT32 tempDataSize = (sizeof(Vector3) + sizeof(float)) * mNumVertices;
+		UINT8* tempData = (UINT8*)bs_stack_alloc(tempDataSize);
+		memset(tempData, 0, tempDataSize);
+
+		Vector3* tempNormals = (Vector3*)tempData;
+		float* accumulatedWeight = (float*)(tempData + sizeof(Vector3) * mNumVertices);
+
+		UINT32 shapeIdx = 0;
+		for (auto& channel : mChannels)
+		{
+			for (auto& shape : channel->getShapes())
+			{
+				float weight = weights[shapeIdx++];
+				float absWeight = Math::abs(weight);
+
+				if (absWeight < 0.0001f)
+					continue;
+
+				for (auto& vertex : shape->getVertices())
+				{
+					Vector3* destPos = (Vector3*)(output + vertex.sourceIdx * stride);
+					*destPos += vertex.deltaPosition * weight;
+
+					tempNormals[vertex.sourceIdx] += vertex.deltaNormal * weight;
+					accumulatedWeight[vertex.sourceIdx] += absWeight;
+				}
+			}
+		}
+
+		for (UINT32 i = 0; i < mNumVertices; i++)
+		{
+			PackedNormal* destNrm = (PackedNormal*)(output + i * stride + sizeof(Vector3));
+
+			if (accumulatedWeight[i] > 0.0001f)
+			{
+				Vector3 normal = tempNormals[i] / accumulatedWeight[i];
+				normal /= 2.0f; // Accumulated normal is in range [-2, 2] but our normal packing method assumes [-1, 1] range
+
+				MeshUtility::packNormals(&normal, (UINT8*)destNrm, 1, sizeof(Vector3), stride);
+				destNrm->w = (UINT8)(std::min(1.0f, accumulatedWeight[i]) * 255.999f);
+			}
+			else
+			{
+				*destNrm = { { 127, 127, 127, 0 } };
+			}
+		}
+
+		bs_stack_free(tempData);
+	}
+
 	SPtr<MorphShapes> MorphShapes::createEmpty()
 	{
 		MorphShapes* raw = new (bs_alloc<MorphShapes>()) MorphShapes();
@@ -147,6 +147,21 @@ namespace bs
 		/** Returns the number of vertices per morph shape. */
 		UINT32 getNumVertices() const { return mNumVertices; }
 
+		/** Returns the total number of shapes in all channels. */
+		UINT32 getNumShapes() const;
+
+		/**
+		 * Blends the morph shapes together on the CPU. For every vertex outputs the blended position offset as three 
+		 * floats, followed by the blended normal offset packed into four normalized bytes, with the fourth byte holding
+		 * the total absolute weight of the shapes affecting the vertex. This is the layout of the morph shape vertex
+		 * stream used for rendering.
+		 *
+		 * @param[in]	weights		Weight of each shape, ordered by channel and then by shape within a channel.
+		 * @param[out]	output		Buffer to receive the blended vertices. Must have room for getNumVertices() vertices.
+		 * @param[in]	stride		Distance between two vertices in @p output, in bytes.
+		 */
+		void blend(const float* weights, UINT8* output, UINT32 stride) const;
+
 		/** Creates a new set of morph shapes. */
 		static SPtr<MorphShapes> create(const Vector<SPtr<MorphChannel>>& channels, UINT32 numVertices);
 
@@ -4,6 +4,7 @@
 #include "Animation/BsAnimationClip.h"
 #include "Animation/BsSkeletonMask.h"
 #include "Private/RTTI/BsSkeletonRTTI.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
@@ -15,7 +16,7 @@ namespace bs
 		: numBones(numBones)
 	{
 		UINT32 elementSize = sizeof(Vector3) * 2 + sizeof(Quaternion) + sizeof(bool);
-		UINT8* buffer = (UINT8*)bs_alloc(elementSize * numBones);
+		UINT8* buffer = (UINT8*)bs_alloc<AnimationAlloc>(elementSize * numBones);
 
 		positions = (Vector3*)buffer;
 		buffer += sizeof(Vector3) * numBones;
@@ -33,7 +34,7 @@ namespace bs
 		: hasOverride(nullptr), numBones(0)
 	{
 		UINT32 bufferSize = sizeof(Vector3) * numPos + sizeof(Quaternion) * numRot + sizeof(Vector3) * numScale;
-		UINT8* buffer = (UINT8*)bs_alloc(bufferSize);
+		UINT8* buffer = (UINT8*)bs_alloc<AnimationAlloc>(bufferSize);
 
 		positions = (Vector3*)buffer;
 		buffer += sizeof(Vector3) * numPos;
@@ -58,7 +59,7 @@ namespace bs
 	LocalSkeletonPose::~LocalSkeletonPose()
 	{
 		if (positions != nullptr)
-			bs_free(positions);
+			bs_free<AnimationAlloc>(positions);
 	}
 
 	LocalSkeletonPose& LocalSkeletonPose::operator=(LocalSkeletonPose&& other)
@@ -66,7 +67,7 @@ namespace bs
 		if (this != &other)
 		{
 			if (positions != nullptr)
-				bs_free(positions);
+				bs_free<AnimationAlloc>(positions);
 
 			positions = other.positions;
 			rotations = other.rotations;
@@ -98,6 +99,8 @@ namespace bs
 			mBoneInfo[i].name = bones[i].name;
 			mBoneInfo[i].parent = bones[i].parent;
 		}
+
+		buildHierarchyOrder();
 	}
 
 	Skeleton::~Skeleton()
@@ -112,6 +115,32 @@ namespace bs
 			bs_deleteN(mBoneInfo, mNumBones);
 	}
 
+	void Skeleton::buildHierarchyOrder()
+	{
+		mHierarchyOrder.clear();
+		mHierarchyOrder.reserve(mNumBones);
+
+		Vector<bool> isAdded(mNumBones, false);
+		SmallVector<UINT32, 16> chain;
+		for (UINT32 i = 0; i < mNumBones; i++)
+		{
+			// Walk up to the first bone already in the order (or a root), then add the chain top-down
+			UINT32 boneIdx = i;
+			while (boneIdx != (UINT32)-1 && boneIdx < mNumBones && !isAdded[boneIdx])
+			{
+				isAdded[boneIdx] = true;
+				chain.push_back(boneIdx);
+
+				boneIdx = mBoneInfo[boneIdx].parent;
+			}
+
+			for (auto iter = chain.rbegin(); iter != chain.rend(); ++iter)
+				mHierarchyOrder.push_back(*iter);
+
+			chain.clear();
+		}
+	}
+
 	SPtr<Skeleton> Skeleton::create(BONE_DESC* bones, UINT32 numBones)
 	{
 		Skeleton* rawPtr = new (bs_alloc<Skeleton>()) Skeleton(bones, numBones);
@@ -159,8 +188,6 @@ namespace bs
 	void Skeleton::getPose(Matrix4* pose, LocalSkeletonPose& localPose, const SkeletonMask& mask, 
 		const AnimationStateLayer* layers, UINT32 numLayers)
 	{
-		// Note: If more performance is required this method could be optimized with vector instructions
-
 		assert(localPose.numBones == mNumBones);
 
 		for(UINT32 i = 0; i < mNumBones; i++)
@@ -281,9 +308,9 @@ namespace bs
 		}
 
 		// Calculate local pose matrices
-		UINT32 isGlobalBytes = sizeof(bool) * mNumBones;
-		bool* isGlobal = (bool*)bs_stack_alloc(isGlobalBytes);
-		memset(isGlobal, 0, isGlobalBytes);
+		UINT32 transformsBytes = simd::TransformArrays::getMemorySize(mNumBones);
+		UINT8* transformsData = (UINT8*)bs_stack_alloc(transformsBytes);
+		simd::TransformArrays localTransforms(transformsData, mNumBones);
 
 		for(UINT32 i = 0; i < mNumBones; i++)
 		{
@@ -293,44 +320,28 @@ namespace bs
 			else
 				localPose.rotations[i].normalize();
 
-			if (localPose.hasOverride[i])
-			{
-				isGlobal[i] = true;
-				continue;
-			}
-
-			pose[i] = Matrix4::TRS(localPose.positions[i], localPose.rotations[i], localPose.scales[i]);
+			localTransforms.set(i, localPose.positions[i], localPose.rotations[i], localPose.scales[i]);
 		}
 
-		// Calculate global poses
-		// Note: For a possible performance improvement consider sorting bones in such order so that parents (and overrides)
-		// always come before children, we no isGlobal check is needed.
-		std::function<void(UINT32)> calcGlobal = [&](UINT32 boneIdx)
+		// Overriden bones already contain their global transforms
+		localTransforms.toMatrices(pose, localPose.hasOverride);
+
+		// Calculate global poses, parents always come before their children so their poses are already global
+		for (auto& boneIdx : mHierarchyOrder)
 		{
+			if (localPose.hasOverride[boneIdx])
+				continue;
+
 			UINT32 parentBoneIdx = mBoneInfo[boneIdx].parent;
 			if (parentBoneIdx == (UINT32)-1)
-			{
-				isGlobal[boneIdx] = true;
-				return;
-			}
-
-			if (!isGlobal[parentBoneIdx])
-				calcGlobal(parentBoneIdx);
-
-			pose[boneIdx] = pose[parentBoneIdx] * pose[boneIdx];
-			isGlobal[boneIdx] = true;
-		};
+				continue;
 
-		for (UINT32 i = 0; i < mNumBones; i++)
-		{
-			if (!isGlobal[i])
-				calcGlobal(i);
+			simd::multiplyAffine(pose[parentBoneIdx], pose[boneIdx], pose[boneIdx]);
 		}
 
-		for (UINT32 i = 0; i < mNumBones; i++)
-			pose[i] = pose[i] * mInvBindPoses[i];
+		simd::multiplyAffineArray(pose, mInvBindPoses, pose, mNumBones);
 
-		bs_stack_free(isGlobal);
+		bs_stack_free(transformsData);
 		bs_stack_free(hasAnimCurve);
 	}
 
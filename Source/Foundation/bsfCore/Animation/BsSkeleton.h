@@ -177,11 +177,17 @@ namespace bs
 		Skeleton();
 		Skeleton(BONE_DESC* bones, UINT32 numBones);
 
+		/** Populates mHierarchyOrder from the current bone parents. */
+		void buildHierarchyOrder();
+
 		UINT32 mNumBones = 0;
 		Transform* mBoneTransforms = nullptr;
 		Matrix4* mInvBindPoses = nullptr;
 		SkeletonBoneInfo* mBoneInfo = nullptr;
 
+		/** Indices of all bones, ordered so that parent bones always come before their children. */
+		Vector<UINT32> mHierarchyOrder;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
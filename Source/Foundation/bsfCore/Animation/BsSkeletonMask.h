@@ -26,6 +26,12 @@ namespace bs
 		 */
 		bool isEnabled(UINT32 boneIdx) const;
 
+		/** Checks do the two masks disable the same set of bones. */
+		bool operator== (const SkeletonMask& rhs) const { return mIsDisabled == rhs.mIsDisabled; }
+
+		/** @copydoc operator== */
+		bool operator!= (const SkeletonMask& rhs) const { return !(*this == rhs); }
+
 	private:
 		friend class SkeletonMaskBuilder;
 
@@ -66,6 +66,48 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:AllDevices,pr:getter)
 		virtual const Vector<AudioDevice>& getAllDevices() const = 0;
 
+		/** 
+		 * Determines the maximum number of audio sources that can be audible at once. When more sources are playing, the
+		 * ones with the lowest priority, and then the lowest audibility (volume attenuated by distance to the nearest 
+		 * listener), become virtual. Virtual sources produce no sound and use no playback resources, but keep advancing
+		 * their playback position, and resume from the correct position once they are among the most audible again.
+		 * Zero means no limit.
+		 */
+		virtual void setMaxVoices(UINT32 count) { }
+
+		/** @copydoc setMaxVoices() */
+		virtual UINT32 getMaxVoices() const { return 0; }
+
+		/** Returns the number of playing audio sources that are currently virtual. */
+		virtual UINT32 getNumVirtualVoices() const { return 0; }
+
+		/** 
+		 * Determines how many blocks of audio data are decoded ahead of playback for each streaming audio source. Higher
+		 * values make streaming more resilient to stalls, at the cost of memory. Only relevant for backends that decode
+		 * streamed audio themselves.
+		 */
+		virtual void setStreamingDecodeAhead(UINT32 numBlocks) { }
+
+		/** @copydoc setStreamingDecodeAhead() */
+		virtual UINT32 getStreamingDecodeAhead() const { return 0; }
+
+		/** 
+		 * Determines the maximum amount of memory in bytes used for keeping decoded samples of recently played audio 
+		 * clips using AudioReadMode::LoadCompressed. Playing a cached clip again only requires a copy instead of 
+		 * decoding it again, which benefits short and frequently played sounds. Clips larger than the budget are never
+		 * cached. Set to zero to disable the cache. Only relevant for backends that decode compressed audio themselves.
+		 */
+		virtual void setDecodedClipCacheBudget(UINT64 bytes) { }
+
+		/** @copydoc setDecodedClipCacheBudget() */
+		virtual UINT64 getDecodedClipCacheBudget() const { return 0; }
+
+		/** 
+		 * Returns the number of times a streaming audio source played out all of its data before new data could be
+		 * queued for it, since the audio system was started. Each such underrun is heard as a gap in playback.
+		 */
+		virtual UINT64 getNumStreamingUnderruns() const { return 0; }
+
 		/** @name Internal
 		 *  @{
 		 */
@@ -1,6 +1,7 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Audio/BsAudioUtility.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
@@ -15,14 +16,38 @@ namespace bs
 				++input;
 			}
 
-			*output = sum / numChannels;
+			*output = sum / (INT32)numChannels;
 			++output;
 		}
 	}
 
 	void convertToMono16(const INT16* input, INT16* output, UINT32 numSamples, UINT32 numChannels)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+
+		// Stereo is by far the most common case, so it gets a vectorized path
+		if (numChannels == 2)
+		{
+			for (; i + 8 <= numSamples; i += 8)
+			{
+				simd::int16x8 first = simd::load_u<simd::int16x8>(input);
+				simd::int16x8 second = simd::load_u<simd::int16x8>(input + 8);
+
+				simd::int16x8 left = simd::unzip8_lo(first, second);
+				simd::int16x8 right = simd::unzip8_hi(first, second);
+
+				simd::int32<8> sum = simd::add(simd::to_int32(left), simd::to_int32(right));
+
+				// Round towards zero, same as the integer division in the scalar path
+				sum = simd::add(sum, simd::int32<8>(simd::shift_r<31>(simd::uint32<8>(sum))));
+				simd::store_u(output, simd::to_int16(simd::shift_r<1>(sum)));
+
+				input += 16;
+				output += 8;
+			}
+		}
+
+		for (; i < numSamples; i++)
 		{
 			INT32 sum = 0;
 			for (UINT32 j = 0; j < numChannels; j++)
@@ -31,7 +56,7 @@ namespace bs
 				++input;
 			}
 
-			*output = sum / numChannels;
+			*output = sum / (INT32)numChannels;
 			++output;
 		}
 	}
@@ -88,7 +113,14 @@ namespace bs
 
 	void convert16To32Bits(const INT16* input, INT32* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+		for (; i + 8 <= numSamples; i += 8)
+		{
+			simd::int16x8 samples = simd::load_u<simd::int16x8>(input + i);
+			simd::store_u(output + i, simd::shift_l<16>(simd::to_int32(samples)));
+		}
+
+		for (; i < numSamples; i++)
 			output[i] = input[i] << 16;
 	}
 
@@ -109,7 +141,14 @@ namespace bs
 
 	void convert32To16Bits(const INT32* input, INT16* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+		for (; i + 8 <= numSamples; i += 8)
+		{
+			simd::int32<8> samples = simd::load_u<simd::int32<8>>(input + i);
+			simd::store_u(output + i, simd::to_int16(simd::shift_r<16>(samples)));
+		}
+
+		for (; i < numSamples; i++)
 			output[i] = (INT16)(input[i] >> 16);
 	}
 
@@ -216,7 +255,21 @@ namespace bs
 		}
 		else if (inBitDepth == 16)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
+			const INT16* input16 = (const INT16*)input;
+			const simd::float32x4 scale = simd::splat<simd::float32x4>(32767.0f);
+
+			UINT32 i = 0;
+			for (; i + 8 <= numSamples; i += 8)
+			{
+				simd::int16x8 samples = simd::load_u<simd::int16x8>(input16 + i);
+				simd::int32<8> samples32 = simd::to_int32(samples);
+
+				simd::store_u(output + i, simd::div(simd::to_float32(simd::int32x4(samples32.vec(0))), scale));
+				simd::store_u(output + i + 4, simd::div(simd::to_float32(simd::int32x4(samples32.vec(1))), scale));
+			}
+
+			input += i * 2;
+			for (; i < numSamples; i++)
 			{
 				INT16 sample = *(INT16*)input;
 				output[i] = sample / 32767.0f;
@@ -236,7 +289,18 @@ namespace bs
 		}
 		else if (inBitDepth == 32)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
+			const INT32* input32 = (const INT32*)input;
+			const simd::float32x4 scale = simd::splat<simd::float32x4>(2147483647.0f);
+
+			UINT32 i = 0;
+			for (; i + 4 <= numSamples; i += 4)
+			{
+				simd::int32x4 samples = simd::load_u<simd::int32x4>(input32 + i);
+				simd::store_u(output + i, simd::div(simd::to_float32(samples), scale));
+			}
+
+			input += i * 4;
+			for (; i < numSamples; i++)
 			{
 				INT32 sample = *(INT32*)input;
 				output[i] = sample / 2147483647.0f;
@@ -248,6 +312,53 @@ namespace bs
 			assert(false);
 	}
 
+	void AudioUtility::deinterleave(const float* input, float* const* output, UINT32 numChannels, UINT32 numFrames)
+	{
+		UINT32 i = 0;
+		if (numChannels == 2)
+		{
+			for (; i + 4 <= numFrames; i += 4)
+			{
+				simd::float32x4 first = simd::load_u<simd::float32x4>(input + i * 2);
+				simd::float32x4 second = simd::load_u<simd::float32x4>(input + i * 2 + 4);
+
+				simd::float32x4 left = simd::unzip4_lo(first, second);
+				simd::float32x4 right = simd::unzip4_hi(first, second);
+
+				simd::store_u(output[0] + i, left);
+				simd::store_u(output[1] + i, right);
+			}
+		}
+
+		for (; i < numFrames; i++)
+		{
+			for (UINT32 j = 0; j < numChannels; j++)
+				output[j][i] = input[i * numChannels + j];
+		}
+	}
+
+	void AudioUtility::interleave(const float* const* input, float* output, UINT32 numChannels, UINT32 numFrames)
+	{
+		UINT32 i = 0;
+		if (numChannels == 2)
+		{
+			for (; i + 4 <= numFrames; i += 4)
+			{
+				simd::float32x4 left = simd::load_u<simd::float32x4>(input[0] + i);
+				simd::float32x4 right = simd::load_u<simd::float32x4>(input[1] + i);
+
+				simd::store_u(output + i * 2, simd::zip4_lo(left, right));
+				simd::store_u(output + i * 2 + 4, simd::zip4_hi(left, right));
+			}
+		}
+
+		for (; i < numFrames; i++)
+		{
+			for (UINT32 j = 0; j < numChannels; j++)
+				output[i * numChannels + j] = input[j][i];
+		}
+	}
+
 	INT32 AudioUtility::convert24To32Bits(const UINT8* input)
 	{
 		return (input[2] << 24) | (input[1] << 16) | (input[0] << 8);
@@ -53,6 +53,29 @@ namespace bs
 		 */
 		static void convertToFloat(const UINT8* input, UINT32 inBitDepth, float* output, UINT32 numSamples);
 
+		/**
+		 * Splits a set of interleaved floating point samples into a separate buffer per channel.
+		 *
+		 * @param[in]	input		A set of interleaved input samples. Total size of the buffer should be @p numFrames *
+		 *							@p numChannels * sizeof(float).
+		 * @param[out]	output		Array of @p numChannels pre-allocated buffers, one per channel, each able to hold
+		 *							@p numFrames samples.
+		 * @param[in]	numChannels	Number of channels in the input data.
+		 * @param[in]	numFrames	Number of samples per a single channel.
+		 */
+		static void deinterleave(const float* input, float* const* output, UINT32 numChannels, UINT32 numFrames);
+
+		/**
+		 * Combines a set of per-channel floating point sample buffers into a single buffer of interleaved samples.
+		 *
+		 * @param[in]	input		Array of @p numChannels buffers, one per channel, each containing @p numFrames samples.
+		 * @param[out]	output		Pre-allocated buffer to store the interleaved samples in. Total size of the buffer should
+		 *							be @p numFrames * @p numChannels * sizeof(float).
+		 * @param[in]	numChannels	Number of channels in the input data.
+		 * @param[in]	numFrames	Number of samples per a single channel.
+		 */
+		static void interleave(const float* const* input, float* output, UINT32 numChannels, UINT32 numFrames);
+
 		/** 
 		 * Converts a 24-bit signed integer into a 32-bit signed integer. 
 		 *
@@ -17,6 +17,7 @@
 #include "Utility/BsDynLibManager.h"
 #include "Scene/BsSceneManager.h"
 #include "Importer/BsImporter.h"
+#include "Importer/BsImportCache.h"
 #include "Resources/BsResources.h"
 #include "Mesh/BsMesh.h"
 #include "Scene/BsSceneObject.h"
@@ -35,11 +36,17 @@
 #include "Profiling/BsProfilerCPU.h"
 #include "Profiling/BsProfilerGPU.h"
 #include "Managers/BsQueryManager.h"
+#include "Managers/BsGpuReadbackManager.h"
+#include "Managers/BsMeshMemoryManager.h"
 #include "Threading/BsThreadPool.h"
 #include "Threading/BsTaskScheduler.h"
 #include "Profiling/BsRenderStats.h"
+#include "Profiling/BsFrameTelemetry.h"
+#include "Profiling/BsHitchDetector.h"
+#include "Debug/BsSamplingProfiler.h"
 #include "Utility/BsMessageHandler.h"
 #include "Managers/BsResourceListenerManager.h"
+#include "Managers/BsTextureStreamingManager.h"
 #include "Managers/BsRenderStateManager.h"
 #include "Material/BsShaderManager.h"
 #include "Physics/BsPhysicsManager.h"
@@ -48,15 +55,39 @@
 #include "Audio/BsAudio.h"
 #include "Animation/BsAnimationManager.h"
 #include "Renderer/BsParamBlocks.h"
+#include "Material/BsShaderCompileCache.h"
 
 namespace bs
 {
-	constexpr UINT32 CoreApplication::MAX_FIXED_UPDATES_PER_FRAME;
+	constexpr UINT64 CoreApplication::LATE_FRAME_START_MARGIN;
+
+	/** Updates a running average of frame times with a new sample. */
+	static UINT64 updateAverageFrameTime(UINT64 average, UINT64 sample)
+	{
+		if(average == 0)
+			return sample;
+
+		return (average * 7 + sample) / 8;
+	}
 
 	CoreApplication::CoreApplication(START_UP_DESC desc)
-		: mPrimaryWindow(nullptr), mStartUpDesc(desc), mRendererPlugin(nullptr), mIsFrameRenderingFinished(true)
-		, mSimThreadId(BS_THREAD_CURRENT_ID), mRunMainLoop(false)
+		: mPrimaryWindow(nullptr), mStartUpDesc(desc), mRendererPlugin(nullptr), mSimThreadId(BS_THREAD_CURRENT_ID)
+		, mRunMainLoop(false)
 	{
+		mStartUpDesc.framesInFlight = Math::clamp(mStartUpDesc.framesInFlight, 1U, (UINT32)CoreThread::MAX_FRAMES_IN_FLIGHT);
+
+		if (mStartUpDesc.headless)
+		{
+			mStartUpDesc.renderAPI = "bsfNullRenderAPI";
+			mStartUpDesc.renderer = "bsfNullRenderer";
+
+			// Nothing is presented, so there's no reason for the sim thread to wait on the core thread, or to run
+			// faster than the simulation is stepped
+			mStartUpDesc.framesInFlight = CoreThread::MAX_FRAMES_IN_FLIGHT;
+			mStartUpDesc.lateFrameStart = false;
+			mFrameStep = mFixedStep;
+		}
+
 		// Ensure all errors are reported properly
 		CrashHandler::startUp();
 	}
@@ -67,17 +98,25 @@ namespace bs
 		mPrimaryWindow = nullptr;
 
 		Importer::shutDown();
+
+		if (ImportCache::isStarted())
+			ImportCache::shutDown();
+
 		MaterialManager::shutDown();
 		MeshManager::shutDown();
+		HitchDetector::shutDown();
 		ProfilerGPU::shutDown();
+		FrameTelemetry::shutDown();
 
 		SceneManager::shutDown();
 		
 		Input::shutDown();
 
+		ct::GpuReadbackManager::shutDown();
 		ct::ParamBlockManager::shutDown();
 		StringTableManager::shutDown();
 		Resources::shutDown();
+		TextureStreamingManager::shutDown();
 		GameObjectManager::shutDown();
 
 		// Audio manager must be released before the ResourceListenerManager, as any one-shot audio sources need to be
@@ -99,11 +138,13 @@ namespace bs
 		gCoreThread().update();
 		gCoreThread().submitAll(true);
 
+		ct::MeshMemoryManager::shutDown();
 		unloadPlugin(mRendererPlugin);
 
 		RenderAPIManager::shutDown();
 		ct::GpuProgramManager::shutDown();
 		GpuProgramManager::shutDown();
+		ShaderCompileCache::shutDown();
 
 		CoreObjectManager::shutDown(); // Must shut down before DynLibManager to ensure all objects are destroyed before unloading their libraries
 		DynLibManager::shutDown();
@@ -115,13 +156,18 @@ namespace bs
 		TaskScheduler::shutDown();
 		ThreadPool::shutDown();
 		ProfilingManager::shutDown();
+		SamplingProfiler::unregisterThread();
+		SamplingProfiler::shutDown();
 		ProfilerCPU::shutDown();
 		MessageHandler::shutDown();
 		ShaderManager::shutDown();
 
 		MemStack::endThread();
-		Platform::_shutDown();
 
+		if (!mStartUpDesc.headless)
+			Platform::_shutDown();
+
+		gDebug().stopAsyncOutput();
 		CrashHandler::shutDown();
 	}
 
@@ -129,18 +175,28 @@ namespace bs
 	{
 		UINT32 numWorkerThreads = BS_THREAD_HARDWARE_CONCURRENCY - 1; // Number of cores while excluding current thread.
 
-		Platform::_startUp();
+		// Platform start-up connects to the OS windowing system, which might not exist on headless machines
+		if (!mStartUpDesc.headless)
+			Platform::_startUp();
+
 		MemStack::beginThread();
+		gDebug().startAsyncOutput(mStartUpDesc.logFile);
 
 		ShaderManager::startUp(getShaderIncludeHandler());
 		MessageHandler::startUp();
 		ProfilerCPU::startUp();
+		SamplingProfiler::startUp();
+		SamplingProfiler::registerThread("Sim");
 		ProfilingManager::startUp();
 		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>((numWorkerThreads));
-		TaskScheduler::startUp();
+		setupThreadConfigs();
+
+		UINT32 numTaskWorkers = mStartUpDesc.workerPerPhysicalCore ? ThreadPool::getNumPhysicalCores() : 0;
+		TaskScheduler::startUp(mStartUpDesc.taskSchedulerMode, numTaskWorkers);
 		TaskScheduler::instance().removeWorker();
 		RenderStats::startUp();
 		CoreThread::startUp();
+		gCoreThread().setFramesInFlight(mStartUpDesc.framesInFlight);
 		StringTableManager::startUp();
 		DeferredCallManager::startUp();
 		Time::startUp();
@@ -148,7 +204,9 @@ namespace bs
 		CoreObjectManager::startUp();
 		GameObjectManager::startUp();
 		Resources::startUp();
+		TextureStreamingManager::startUp();
 		ResourceListenerManager::startUp();
+		ShaderCompileCache::startUp(mStartUpDesc.shaderCompileCacheFolder);
 		GpuProgramManager::startUp();
 		RenderStateManager::startUp();
 		ct::GpuProgramManager::startUp();
@@ -157,6 +215,8 @@ namespace bs
 		mPrimaryWindow = RenderAPIManager::instance().initialize(mStartUpDesc.renderAPI, mStartUpDesc.primaryWindowDesc);
 
 		ct::ParamBlockManager::startUp();
+		ct::GpuReadbackManager::startUp();
+		ct::MeshMemoryManager::startUp();
 		Input::startUp();
 		RendererManager::startUp();
 
@@ -167,9 +227,15 @@ namespace bs
 		startUpRenderer();
 
 		ProfilerGPU::startUp();
+		FrameTelemetry::startUp();
+		HitchDetector::startUp();
 		MeshManager::startUp();
 		MaterialManager::startUp();
 		Importer::startUp();
+
+		if (!mStartUpDesc.importCacheFolder.isEmpty())
+			ImportCache::startUp(mStartUpDesc.importCacheFolder);
+
 		AudioManager::startUp(mStartUpDesc.audio);
 		PhysicsManager::startUp(mStartUpDesc.physics, isEditor());
 		AnimationManager::startUp();
@@ -187,34 +253,24 @@ namespace bs
 			// Limit FPS if needed
 			if (mFrameStep > 0)
 			{
-				UINT64 currentTime = gTime().getTimePrecise();
-				UINT64 nextFrameTime = mLastFrameTime + mFrameStep;
-				while (nextFrameTime > currentTime)
-				{
-					UINT32 waitTime = (UINT32)(nextFrameTime - currentTime);
-
-					// If waiting for longer, sleep
-					if (waitTime >= 2000)
-					{
-						Platform::sleep(waitTime / 1000);
-						currentTime = gTime().getTimePrecise();
-					}
-					else
-					{
-						// Otherwise we just spin, sleep timer granularity is too low and we might end up wasting a 
-						// millisecond otherwise. 
-						// Note: For mobiles where power might be more important than input latency, consider using sleep.
-						while(nextFrameTime > currentTime)
-							currentTime = gTime().getTimePrecise();
-					}
-				}
+				waitUntil(mLastFrameTime + mFrameStep);
+				mLastFrameTime = gTime().getTimePrecise();
+			}
 
-				mLastFrameTime = currentTime;
+			// Start the frame later if we know we'll have to wait on the core thread anyway, to reduce input latency
+			if (mStartUpDesc.lateFrameStart && mStartUpDesc.framesInFlight > 1)
+			{
+				UINT64 delay = getLateFrameStartDelay();
+				if (delay > 0)
+					waitUntil(gTime().getTimePrecise() + delay);
 			}
 
+			UINT64 simFrameStartTime = gTime().getTimePrecise();
 			gProfilerCPU().beginThread("Sim");
 
-			Platform::_update();
+			if (!mStartUpDesc.headless)
+				Platform::_update();
+
 			DeferredCallManager::instance()._update();
 			gTime()._update();
 			gInput()._update();
@@ -242,31 +298,66 @@ namespace bs
 				UINT64 nextFrameTime = mLastFixedUpdateTime + mFixedStep;
 				if(nextFrameTime <= currentTime)
 				{
-					INT64 simulationAmount = (INT64)std::max(currentTime - mLastFixedUpdateTime, mFixedStep); // At least one step
-					UINT32 numIterations = (UINT32)Math::divideAndRoundUp(simulationAmount, (INT64)mFixedStep);
+					const INT64 maxIterations = (INT64)std::max(mStartUpDesc.maxFixedUpdatesPerFrame, 1U);
 
-					// If too many iterations are required, increase time step. This should only happen in extreme 
-					// situations (or when debugging).
+					INT64 simulationAmount = (INT64)(currentTime - mLastFixedUpdateTime);
 					INT64 step = (INT64)mFixedStep;
-					if (numIterations > (INT32)MAX_FIXED_UPDATES_PER_FRAME)
-						step = Math::divideAndRoundUp(simulationAmount, (INT64)MAX_FIXED_UPDATES_PER_FRAME);
+					INT64 numIterations;
 
-					while (simulationAmount >= step) // In case we're running really slow multiple updates might be needed
+					if (mStartUpDesc.fixedUpdateCatchUp == FixedUpdateCatchUp::StretchStep)
+					{
+						// If too many iterations are required, increase time step. This should only happen in extreme 
+						// situations (or when debugging).
+						if (Math::divideAndRoundUp(simulationAmount, step) > maxIterations)
+							step = Math::divideAndRoundUp(simulationAmount, maxIterations);
+
+						numIterations = simulationAmount / step;
+					}
+					else
+					{
+						// Forget about time we're too far behind on, otherwise a long stall (e.g. loading or debugging)
+						// would keep the following frames busy catching up, making them slow as well
+						const INT64 maxLag = std::max((INT64)(mStartUpDesc.maxFixedUpdateLag * 1000000.0f), step);
+						if (simulationAmount > maxLag)
+						{
+							mLastFixedUpdateTime = currentTime - maxLag;
+							simulationAmount = maxLag;
+						}
+
+						// Whatever doesn't fit in this frame is simulated during the next ones
+						numIterations = std::min(simulationAmount / step, maxIterations);
+					}
+
+					// In case we're running really slow multiple updates might be needed
+					for (INT64 i = 0; i < numIterations; i++)
 					{
 						float stepSeconds = step / 1000000.0f;
 
+						UINT64 physicsStartTime = gTime().getTimePrecise();
+						gPhysics().fetchResults();
+						gFrameTelemetry()._addSimTime(TelemetryMetric::PhysicsTime,
+							gTime().getTimePrecise() - physicsStartTime);
+
 						PROFILE_CALL(gSceneManager()._fixedUpdate(), "Scene fixed update");
+
+						physicsStartTime = gTime().getTimePrecise();
 						gPhysics().fixedUpdate(stepSeconds);
+						gFrameTelemetry()._addSimTime(TelemetryMetric::PhysicsTime,
+							gTime().getTimePrecise() - physicsStartTime);
 
-						simulationAmount -= step;
 						mLastFixedUpdateTime += step;
 					}
 				}
+
+				mFixedUpdateAlpha = Math::clamp01((currentTime - mLastFixedUpdateTime) / (float)mFixedStep);
 			}
 
 			PROFILE_CALL(gSceneManager()._update(), "Scene update");
 			gAudio()._update();
+
+			UINT64 physicsStartTime = gTime().getTimePrecise();
 			gPhysics().update();
+			gFrameTelemetry()._addSimTime(TelemetryMetric::PhysicsTime, gTime().getTimePrecise() - physicsStartTime);
 
 			// Update plugins
 			for (auto& pluginUpdateFunc : mPluginUpdateFunctions)
@@ -276,7 +367,15 @@ namespace bs
 
 			// Evaluate animation after scene and plugin updates because the renderer will just now be displaying the
 			// animation we sent on the previous frame, and we want the scene information to match to what is displayed.
+			UINT64 animationStartTime = gTime().getTimePrecise();
 			const EvaluatedAnimationData* animData = AnimationManager::instance().update();
+			gFrameTelemetry()._addSimTime(TelemetryMetric::AnimationTime, gTime().getTimePrecise() - animationStartTime);
+
+			// Stream texture mip levels in or out, based on what the renderer reported as visible
+			TextureStreamingManager::instance()._update();
+
+			// Unload resources that don't fit in the resource cache anymore
+			gResources()._updateCache();
 
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
@@ -288,44 +387,59 @@ namespace bs
 			gSceneManager()._updateCoreObjectTransforms();
 			PROFILE_CALL(RendererManager::instance().getActive()->renderAll(animData), "Render");
 
-			// Core and sim thread run in lockstep. This will result in a larger input latency than if I was 
-			// running just a single thread. Latency becomes worse if the core thread takes longer than sim 
-			// thread, in which case sim thread needs to wait. Optimal solution would be to get an average 
-			// difference between sim/core thread and start the sim thread a bit later so they finish at nearly the same time.
+			// Wait until the core thread catches up. With a single frame in flight core and sim thread run in lockstep. 
+			// This will result in a larger input latency than if I was running just a single thread. Latency becomes worse
+			// if the core thread takes longer than sim thread, in which case sim thread needs to wait. With more frames in
+			// flight the sim thread is allowed to run ahead, and the late frame start heuristic can be used to delay the 
+			// sim thread so both threads finish at nearly the same time.
+			UINT64 simFrameTime = gTime().getTimePrecise() - simFrameStartTime;
+			mAvgSimFrameTime = updateAverageFrameTime(mAvgSimFrameTime, simFrameTime);
+			gFrameTelemetry()._endSimFrame(simFrameTime);
+
 			{
 				Lock lock(mFrameRenderingFinishedMutex);
 
-				while(!mIsFrameRenderingFinished)
+				// With N frames in flight up to N - 1 frames may be queued beyond the one the core thread is processing
+				UINT32 maxUnfinishedFrames = mStartUpDesc.framesInFlight;
+				while((mNumFramesSubmitted - mNumFramesFinished) >= maxUnfinishedFrames)
 				{
 					TaskScheduler::instance().addWorker();
 					mFrameRenderingFinishedCondition.wait(lock);
 					TaskScheduler::instance().removeWorker();
 				}
-
-				mIsFrameRenderingFinished = false;
 			}
 
 			gCoreThread().queueCommand(std::bind(&CoreApplication::beginCoreProfiling, this), CTQF_InternalQueue);
-			gCoreThread().queueCommand(&Platform::_coreUpdate, CTQF_InternalQueue);
+
+			if (!mStartUpDesc.headless)
+				gCoreThread().queueCommand(&Platform::_coreUpdate, CTQF_InternalQueue);
+
 			gCoreThread().queueCommand(std::bind(&ct::RenderWindowManager::_update, ct::RenderWindowManager::instancePtr()), CTQF_InternalQueue);
 
 			gCoreThread().update(); 
-			gCoreThread().submitAll(); 
 
-			gCoreThread().queueCommand(std::bind(&CoreApplication::frameRenderingFinishedCallback, this), CTQF_InternalQueue);
+			// In lockstep mode wait until the per-thread queues finish executing, otherwise let the sim thread run ahead
+			gCoreThread().submitAll(mStartUpDesc.framesInFlight == 1); 
+			mNumFramesSubmitted++;
+
+			gCoreThread().queueCommand(std::bind(&CoreApplication::frameRenderingFinishedCallback, this, 
+				simFrameStartTime), CTQF_InternalQueue);
 
 			gCoreThread().queueCommand(std::bind(&ct::QueryManager::_update, ct::QueryManager::instancePtr()), CTQF_InternalQueue);
+			gCoreThread().queueCommand(std::bind(&ct::GpuReadbackManager::_update, 
+				ct::GpuReadbackManager::instancePtr()), CTQF_InternalQueue);
 			gCoreThread().queueCommand(std::bind(&CoreApplication::endCoreProfiling, this), CTQF_InternalQueue);
 
 			gProfilerCPU().endThread();
 			gProfiler()._update();
+			gHitchDetector()._update();
 		}
 
 		// Wait until last core frame is finished before exiting
 		{
 			Lock lock(mFrameRenderingFinishedMutex);
 
-			while (!mIsFrameRenderingFinished)
+			while (mNumFramesFinished != mNumFramesSubmitted)
 			{
 				TaskScheduler::instance().addWorker();
 				mFrameRenderingFinishedCondition.wait(lock);
@@ -360,14 +474,91 @@ namespace bs
 		mFrameStep = (UINT64)1000000 / limit;
 	}
 
-	void CoreApplication::frameRenderingFinishedCallback()
+	void CoreApplication::frameRenderingFinishedCallback(UINT64 simFrameStartTime)
 	{
+		UINT64 currentTime = gTime().getTimePrecise();
+		UINT64 coreFrameTime = currentTime - mCoreFrameStartTime;
+		gFrameTelemetry()._addFrameLatency(currentTime - simFrameStartTime);
+
 		Lock lock(mFrameRenderingFinishedMutex);
 
-		mIsFrameRenderingFinished = true;
+		mAvgCoreFrameTime = updateAverageFrameTime(mAvgCoreFrameTime, coreFrameTime);
+		mNumFramesFinished++;
 		mFrameRenderingFinishedCondition.notify_one();
 	}
 
+	void CoreApplication::waitUntil(UINT64 time)
+	{
+		UINT64 currentTime = gTime().getTimePrecise();
+		while (time > currentTime)
+		{
+			UINT32 waitTime = (UINT32)(time - currentTime);
+
+			// If waiting for longer, sleep
+			if (waitTime >= 2000)
+			{
+				Platform::sleep(waitTime / 1000);
+				currentTime = gTime().getTimePrecise();
+			}
+			else
+			{
+				// Otherwise we just spin, sleep timer granularity is too low and we might end up wasting a 
+				// millisecond otherwise. 
+				// Note: For mobiles where power might be more important than input latency, consider using sleep.
+				while(time > currentTime)
+					currentTime = gTime().getTimePrecise();
+			}
+		}
+	}
+
+	UINT64 CoreApplication::getLateFrameStartDelay()
+	{
+		UINT64 avgCoreFrameTime;
+		{
+			Lock lock(mFrameRenderingFinishedMutex);
+			avgCoreFrameTime = mAvgCoreFrameTime;
+		}
+
+		// If the core thread takes longer than the sim thread, the sim thread would end up waiting for the difference
+		UINT64 simFrameTime = mAvgSimFrameTime + LATE_FRAME_START_MARGIN;
+		if (avgCoreFrameTime <= simFrameTime)
+			return 0;
+
+		return avgCoreFrameTime - simFrameTime;
+	}
+
+	void CoreApplication::setupThreadConfigs()
+	{
+		ThreadConfig coreConfig;
+		coreConfig.priority = ThreadPriority::High;
+
+		// Audio streaming must keep up with playback, otherwise the sources run out of data and playback stutters
+		ThreadConfig audioConfig;
+		audioConfig.priority = ThreadPriority::Highest;
+
+		if (mStartUpDesc.isolateCoreThread)
+		{
+			Vector<UINT64> coreMasks = ThreadPool::getPhysicalCoreMasks();
+			if (coreMasks.size() >= 4)
+			{
+				UINT64 otherCoresMask = 0;
+				for (size_t i = 0; i < coreMasks.size() - 1; i++)
+					otherCoresMask |= coreMasks[i];
+
+				coreConfig.affinityMask = coreMasks.back();
+				audioConfig.affinityMask = otherCoresMask;
+
+				ThreadConfig defaultConfig;
+				defaultConfig.affinityMask = otherCoresMask;
+
+				ThreadPool::instance().setDefaultThreadConfig(defaultConfig);
+			}
+		}
+
+		ThreadPool::instance().setThreadConfig("Core", coreConfig);
+		ThreadPool::instance().setThreadConfig("AudioStream", audioConfig);
+	}
+
 	void CoreApplication::startUpRenderer()
 	{
 		RendererManager::instance().initialize();
@@ -375,12 +566,15 @@ namespace bs
 
 	void CoreApplication::beginCoreProfiling()
 	{
+		mCoreFrameStartTime = gTime().getTimePrecise();
 		gProfilerCPU().beginThread("Core");
+		gFrameTelemetry()._beginCoreFrame();
 	}
 
 	void CoreApplication::endCoreProfiling()
 	{
 		ProfilerGPU::instance()._update();
+		gFrameTelemetry()._endCoreFrame(gTime().getTimePrecise() - mCoreFrameStartTime);
 
 		gProfilerCPU().endThread();
 		gProfiler()._updateCore();
@@ -6,6 +6,7 @@
 #include "Utility/BsModule.h"
 #include "RenderAPI/BsRenderWindow.h"
 #include "Utility/BsEvent.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -13,6 +14,24 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Determines how does the main loop catch up when real time gets ahead of the fixed updates by multiple steps. */
+	enum class FixedUpdateCatchUp
+	{
+		/**
+		 * Runs fixed updates at the regular step, up to START_UP_DESC::maxFixedUpdatesPerFrame per frame. Time that
+		 * couldn't be simulated is carried over to the following frames, unless it exceeds
+		 * START_UP_DESC::maxFixedUpdateLag, in which case the excess is dropped and the simulation runs slower than
+		 * real time.
+		 */
+		DropTime,
+		/**
+		 * Increases the fixed update step so the simulation always keeps up with real time, using at most
+		 * START_UP_DESC::maxFixedUpdatesPerFrame updates per frame. Larger steps change the simulation results, so
+		 * physics behaves differently under load.
+		 */
+		StretchStep
+	};
+
 	/**	Structure containing parameters for starting the application. */
 	struct START_UP_DESC
 	{
@@ -26,6 +45,80 @@ namespace bs
 		RENDER_WINDOW_DESC primaryWindowDesc; /**< Describes the window to create during start-up. */
 
 		Vector<String> importers; /**< A list of importer plugins to load. */
+
+		/** Determines how does the TaskScheduler distribute tasks between worker threads. */
+		TaskSchedulerMode taskSchedulerMode = TaskSchedulerMode::GlobalQueue;
+
+		/**
+		 * Folder in which to persist the results of shader compilation, so they can be re-used by future runs of the
+		 * application. If empty, compilation results are only cached in memory.
+		 */
+		Path shaderCompileCacheFolder;
+
+		/**
+		 * Folder in which to store the results of resource imports, so that re-importing a file with the same import
+		 * options doesn't need to re-run the importer. May be shared between multiple applications. If empty, import 
+		 * results are not cached.
+		 */
+		Path importCacheFolder;
+
+		/**
+		 * If not empty, all logged messages are also written to a file at this path. Messages are written by a
+		 * background thread, along with console output (see Debug::startAsyncOutput()).
+		 */
+		Path logFile;
+
+		/**
+		 * Maximum number of frames the sim and core threads are allowed to process at once, in range [1, 3]. With a 
+		 * single frame in flight the threads run in lockstep, with the sim thread waiting until the core thread has
+		 * finished rendering the previous frame before submitting a new one. Each additional frame in flight allows
+		 * one more frame to be queued for the core thread, so with N frames in flight up to N - 1 frames can wait
+		 * behind the one the core thread is rendering. More frames in flight improve throughput when thread loads
+		 * vary, at the cost of increased input and animation latency.
+		 */
+		UINT32 framesInFlight = 1;
+
+		/**
+		 * If true, the sim thread will delay the start of its frame by the average amount of time it would otherwise
+		 * spend waiting on the core thread, so that input is sampled as late as possible. Only relevant when 
+		 * @p framesInFlight is larger than one.
+		 */
+		bool lateFrameStart = false;
+
+		/**
+		 * If true, the core thread is pinned to a physical CPU core of its own, and all other pooled threads are kept
+		 * off that core. Reduces stalls on the core thread caused by worker threads competing for the same core, but
+		 * leaves one less core for the workers. Ignored on machines with less than four physical cores.
+		 */
+		bool isolateCoreThread = false;
+
+		/**
+		 * If true, the TaskScheduler creates one worker per physical CPU core, instead of one per logical processor.
+		 * Can be beneficial for compute heavy tasks on CPUs with simultaneous multithreading (SMT), as such tasks
+		 * benefit little from sharing a core.
+		 */
+		bool workerPerPhysicalCore = false;
+
+		/**
+		 * If true, the application runs without a window or a GPU, for example as a dedicated server. The null render
+		 * API and renderer plugins are used in place of @p renderAPI and @p renderer, the OS windowing system is never
+		 * initialized, and imported meshes and textures keep their data on the CPU only. The main loop runs at the
+		 * fixed update rate, and the sim thread never waits on the core thread unless it falls behind by the maximum
+		 * number of frames in flight.
+		 */
+		bool headless = false;
+
+		/** Determines what happens when frames take longer than the fixed update step. */
+		FixedUpdateCatchUp fixedUpdateCatchUp = FixedUpdateCatchUp::DropTime;
+
+		/** Maximum number of fixed updates to run in a single frame. Only relevant when the framerate is low. */
+		UINT32 maxFixedUpdatesPerFrame = 4;
+
+		/**
+		 * Maximum amount of time (in seconds) the fixed updates are allowed to fall behind real time, when using
+		 * FixedUpdateCatchUp::DropTime. Any time beyond it is never simulated. Never less than a single fixed step.
+		 */
+		float maxFixedUpdateLag = 0.25f;
 	};
 
 	/**
@@ -60,12 +153,21 @@ namespace bs
 			 */
 			float getFixedUpdateStep() const { return mFixedStep / 1000000.0f; }
 
+			/**
+			 * Returns how far along the current frame is between the last and the next fixed update, in range [0, 1].
+			 * Can be used for interpolating state that is only updated during fixed updates.
+			 */
+			float getFixedUpdateAlpha() const { return mFixedUpdateAlpha; }
+
 			/**
 			 * Issues a request for the application to close. Application may choose to ignore the request depending on the
 			 * circumstances and the implementation.
 			 */
 			virtual void quitRequested();
 
+			/** Checks if the application was started without a window or a GPU. See START_UP_DESC::headless. */
+			bool isHeadless() const { return mStartUpDesc.headless; }
+
 			/**	Returns the main window that was created on application start-up. */
 			SPtr<RenderWindow> getPrimaryWindow() const { return mPrimaryWindow; }
 
@@ -110,7 +212,19 @@ namespace bs
 
 	private:
 		/**	Called when the frame finishes rendering. */
-		void frameRenderingFinishedCallback();
+		void frameRenderingFinishedCallback(UINT64 simFrameStartTime);
+
+		/** Blocks the sim thread until the specified time. Time is in microseconds, as reported by Time::getTimePrecise(). */
+		void waitUntil(UINT64 time);
+
+		/** 
+		 * Returns the amount of time (in microseconds) to delay the start of the sim thread frame by, as determined by the
+		 * late frame start heuristic.
+		 */
+		UINT64 getLateFrameStartDelay();
+
+		/** Registers thread pool priorities and affinities of the engine's threads. Called during start-up. */
+		void setupThreadConfigs();
 
 		/**	Called by the core thread to begin profiling. */
 		void beginCoreProfiling();
@@ -131,20 +245,30 @@ namespace bs
 		// Fixed update
 		UINT64 mFixedStep = 16666; // 60 times a second in microseconds
 		UINT64 mLastFixedUpdateTime = 0;
+		float mFixedUpdateAlpha = 0.0f;
 		bool mFirstFrame = true;
 		DynLib* mRendererPlugin;
 
 		Map<DynLib*, UpdatePluginFunc> mPluginUpdateFunctions;
 
-		bool mIsFrameRenderingFinished;
+		UINT32 mNumFramesSubmitted = 0; // Sim thread only
+		UINT32 mNumFramesFinished = 0; // Protected by mFrameRenderingFinishedMutex
 		Mutex mFrameRenderingFinishedMutex;
 		Signal mFrameRenderingFinishedCondition;
+
+		// Late frame start
+		UINT64 mAvgSimFrameTime = 0; // Microseconds, sim thread only
+		UINT64 mAvgCoreFrameTime = 0; // Microseconds, protected by mFrameRenderingFinishedMutex
+		UINT64 mCoreFrameStartTime = 0; // Microseconds, core thread only
 		ThreadId mSimThreadId;
 
 		volatile bool mRunMainLoop;
 
-		/** Determines how many fixed updates per frame are allowed. Only relevant when framerate is low. */
-		static constexpr UINT32 MAX_FIXED_UPDATES_PER_FRAME = 4;
+		/** 
+		 * Time (in microseconds) subtracted from the late frame start delay, so that variance in frame times doesn't cause
+		 * the core thread to wait on the sim thread.
+		 */
+		static constexpr UINT64 LATE_FRAME_START_MARGIN = 1000;
 
 	};
 
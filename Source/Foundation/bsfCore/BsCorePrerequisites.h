@@ -260,6 +260,8 @@ namespace bs
 	class GpuProgramImportOptions;
 	class MeshImportOptions;
 	struct FontBitmap;
+	class DynamicFontAtlas;
+	class FontRasterizer;
 	class GameObject;
 	class GpuResourceData;
 	struct RenderOperation;
@@ -277,6 +279,7 @@ namespace bs
 	class IShaderIncludeHandler;
 	class Prefab;
 	class PrefabDiff;
+	class PrefabPool;
 	class RendererMeshData;
 	class Light;
 	class Win32Window;
@@ -292,6 +295,7 @@ namespace bs
 	class PlaneCollider;
 	class CapsuleCollider;
 	class MeshCollider;
+	class HeightFieldCollider;
 	class CCollider;
 	class CRigidbody;
 	class CBoxCollider;
@@ -299,6 +303,7 @@ namespace bs
 	class CPlaneCollider;
 	class CCapsuleCollider;
 	class CMeshCollider;
+	class CHeightFieldCollider;
 	class Joint;
 	class FixedJoint;
 	class DistanceJoint;
@@ -355,6 +360,8 @@ namespace bs
 	class Resource;
 	class Resources;
 	class ResourceManifest;
+	class ResourceArchive;
+	class SavedResourceData;
 	class Texture;
 	class Mesh;
 	class MeshBase;
@@ -364,10 +371,13 @@ namespace bs
 	class ResourceMetaData;
 	class DropTarget;
 	class StringTable;
+	class CompiledStringTable;
 	class PhysicsMaterial;
 	class PhysicsMesh;
+	class HeightField;
 	class AudioClip;
 	class CoreObjectManager;
+	class CoreObjectBatchSync;
 	struct CollisionData;
 	// Scene
 	class SceneObject;
@@ -421,6 +431,7 @@ namespace bs
 		class TransientMesh;
 		class Texture;
 		class MeshHeap;
+		class MeshMemoryManager;
 		class VertexDeclaration;
 		class GpuBuffer;
 		class GpuParamBlockBuffer;
@@ -592,6 +603,9 @@ namespace bs
 		TID_DepthStencilStateDesc = 1152,
 		TID_SerializedGpuProgramData = 1153,
 		TID_SubShader = 1154,
+		TID_ShaderLazyVariations = 1155,
+		TID_HeightField = 1156,
+		TID_CHeightFieldCollider = 1157,
 
 		// Moved from Engine layer
 		TID_CCamera = 30000,
@@ -607,7 +621,8 @@ namespace bs
 		TID_DepthOfFieldSettings = 30020,
 		TID_AmbientOcclusionSettings = 30021,
 		TID_ScreenSpaceReflectionsSettings = 30022,
-		TID_ShadowSettings = 30023
+		TID_ShadowSettings = 30023,
+		TID_DynamicResolutionSettings = 30024
 	};
 }
 
@@ -634,6 +649,7 @@ namespace bs
 	typedef ResourceHandle<StringTable> HStringTable;
 	typedef ResourceHandle<PhysicsMaterial> HPhysicsMaterial;
 	typedef ResourceHandle<PhysicsMesh> HPhysicsMesh;
+	typedef ResourceHandle<HeightField> HHeightField;
 	typedef ResourceHandle<AudioClip> HAudioClip;
 	typedef ResourceHandle<AnimationClip> HAnimationClip;
 
@@ -663,6 +679,7 @@ namespace bs
 	typedef GameObjectHandle<CSphereCollider> HSphereCollider;
 	typedef GameObjectHandle<CCapsuleCollider> HCapsuleCollider;
 	typedef GameObjectHandle<CPlaneCollider> HPlaneCollider;
+	typedef GameObjectHandle<CHeightFieldCollider> HHeightFieldCollider;
 	typedef GameObjectHandle<CJoint> HJoint;
 	typedef GameObjectHandle<CHingeJoint> HHingeJoint;
 	typedef GameObjectHandle<CSliderJoint> HSliderJoint;
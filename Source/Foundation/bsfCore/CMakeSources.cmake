@@ -6,6 +6,7 @@ set(BS_CORE_INC_COMPONENTS
 	"bsfCore/Components/BsCCapsuleCollider.h"
 	"bsfCore/Components/BsCPlaneCollider.h"
 	"bsfCore/Components/BsCMeshCollider.h"
+	"bsfCore/Components/BsCHeightFieldCollider.h"
 	"bsfCore/Components/BsCJoint.h"
 	"bsfCore/Components/BsCFixedJoint.h"
 	"bsfCore/Components/BsCHingeJoint.h"
@@ -38,6 +39,8 @@ set(BS_CORE_INC_PHYSICS
 	"bsfCore/Physics/BsFCollider.h"
 	"bsfCore/Physics/BsPhysicsMesh.h"
 	"bsfCore/Physics/BsMeshCollider.h"
+	"bsfCore/Physics/BsHeightField.h"
+	"bsfCore/Physics/BsHeightFieldCollider.h"
 	"bsfCore/Physics/BsFJoint.h"
 	"bsfCore/Physics/BsJoint.h"
 	"bsfCore/Physics/BsFixedJoint.h"
@@ -58,6 +61,7 @@ set(BS_CORE_INC_CORETHREAD
 	"bsfCore/CoreThread/BsCoreObject.h"
 	"bsfCore/CoreThread/BsCommandQueue.h"
 	"bsfCore/CoreThread/BsCoreObjectCore.h"
+	"bsfCore/CoreThread/BsCoreObjectBatchSync.h"
 )
 
 set(BS_CORE_INC_IMPORTER
@@ -68,6 +72,7 @@ set(BS_CORE_INC_IMPORTER
 	"bsfCore/Importer/BsShaderIncludeImporter.h"
 	"bsfCore/Importer/BsMeshImportOptions.h"
 	"bsfCore/Importer/BsShaderImportOptions.h"
+	"bsfCore/Importer/BsImportCache.h"
 )
 
 set(BS_CORE_INC_SCENE
@@ -79,6 +84,7 @@ set(BS_CORE_INC_SCENE
 	"bsfCore/Scene/BsSceneManager.h"
 	"bsfCore/Scene/BsPrefab.h"
 	"bsfCore/Scene/BsPrefabDiff.h"
+	"bsfCore/Scene/BsPrefabPool.h"
 	"bsfCore/Scene/BsPrefabUtility.h"
 	"bsfCore/Scene/BsTransform.h"
 	"bsfCore/Scene/BsSceneActor.h"
@@ -113,6 +119,7 @@ set(BS_CORE_SRC_LOCALIZATION
 	"bsfCore/Localization/BsHString.cpp"
 	"bsfCore/Localization/BsStringTable.cpp"
 	"bsfCore/Localization/BsStringTableManager.cpp"
+	"bsfCore/Localization/BsCompiledStringTable.cpp"
 )
 
 set(BS_CORE_SRC_RTTI
@@ -121,6 +128,9 @@ set(BS_CORE_SRC_RTTI
 
 set(BS_CORE_INC_PROFILING
 	"bsfCore/Profiling/BsProfilerCPU.h"
+	"bsfCore/Profiling/BsFrameTelemetry.h"
+	"bsfCore/Profiling/BsHitchDetector.h"
+	"bsfCore/Profiling/BsGpuMemoryProfiler.h"
 	"bsfCore/Profiling/BsProfilerGPU.h"
 	"bsfCore/Profiling/BsProfilingManager.h"
 	"bsfCore/Profiling/BsRenderStats.h"
@@ -164,6 +174,8 @@ set(BS_CORE_INC_RENDERAPI_MANAGERS
 	"bsfCore/Managers/BsRenderWindowManager.h"
 	"bsfCore/Managers/BsRenderStateManager.h"
 	"bsfCore/Managers/BsQueryManager.h"
+	"bsfCore/Managers/BsGpuReadbackManager.h"
+	"bsfCore/Managers/BsMeshMemoryManager.h"
 	"bsfCore/Managers/BsMeshManager.h"
 	"bsfCore/Managers/BsHardwareBufferManager.h"
 	"bsfCore/Managers/BsGpuProgramManager.h"
@@ -171,6 +183,7 @@ set(BS_CORE_INC_RENDERAPI_MANAGERS
 	"bsfCore/Managers/BsRenderAPIFactory.h"
 	"bsfCore/Managers/BsCommandBufferManager.h"
 	"bsfCore/Managers/BsTextureManager.h"
+	"bsfCore/Managers/BsTextureStreamingManager.h"
 	"bsfCore/Managers/BsResourceListenerManager.h"
 )
 
@@ -200,11 +213,14 @@ set(BS_CORE_INC_MATERIAL
 	"bsfCore/Material/BsGpuParamsSet.h"
 	"bsfCore/Material/BsShaderInclude.h"
 	"bsfCore/Material/BsShaderVariation.h"
+	"bsfCore/Material/BsShaderCompileCache.h"
+	"bsfCore/Material/BsShaderLazyVariations.h"
 )
 
 set(BS_CORE_INC_RESOURCES
 	"bsfCore/Resources/BsResources.h"
 	"bsfCore/Resources/BsResourceManifest.h"
+	"bsfCore/Resources/BsResourceArchive.h"
 	"bsfCore/Resources/BsResourceHandle.h"
 	"bsfCore/Resources/BsResource.h"
 	"bsfCore/Resources/BsGpuResourceData.h"
@@ -240,12 +256,17 @@ set(BS_CORE_INC_TEXT
 	"bsfCore/Text/BsFontImportOptions.h"
 	"bsfCore/Text/BsFontDesc.h"
 	"bsfCore/Text/BsFont.h"
+	"bsfCore/Text/BsDynamicFontAtlas.h"
 )
 
 set(BS_CORE_SRC_PROFILING
 	"bsfCore/Profiling/BsProfilerCPU.cpp"
+	"bsfCore/Profiling/BsFrameTelemetry.cpp"
+	"bsfCore/Profiling/BsHitchDetector.cpp"
+	"bsfCore/Profiling/BsGpuMemoryProfiler.cpp"
 	"bsfCore/Profiling/BsProfilerGPU.cpp"
 	"bsfCore/Profiling/BsProfilingManager.cpp"
+	"bsfCore/Profiling/BsRenderStats.cpp"
 )
 
 set(BS_CORE_SRC_COMPONENTS
@@ -256,6 +277,7 @@ set(BS_CORE_SRC_COMPONENTS
 	"bsfCore/Components/BsCPlaneCollider.cpp"
 	"bsfCore/Components/BsCCapsuleCollider.cpp"
 	"bsfCore/Components/BsCMeshCollider.cpp"
+	"bsfCore/Components/BsCHeightFieldCollider.cpp"
 	"bsfCore/Components/BsCJoint.cpp"
 	"bsfCore/Components/BsCFixedJoint.cpp"
 	"bsfCore/Components/BsCHingeJoint.cpp"
@@ -284,6 +306,7 @@ set(BS_CORE_SRC_IMPORTER
 	"bsfCore/Importer/BsShaderIncludeImporter.cpp"
 	"bsfCore/Importer/BsMeshImportOptions.cpp"
 	"bsfCore/Importer/BsShaderImportOptions.cpp"
+	"bsfCore/Importer/BsImportCache.cpp"
 )
 
 set(BS_CORE_INC_UTILITY
@@ -339,6 +362,7 @@ set(BS_CORE_INC_RTTI
 	"bsfCore/Private/RTTI/BsCPlaneColliderRTTI.h"
 	"bsfCore/Private/RTTI/BsCCapsuleColliderRTTI.h"
 	"bsfCore/Private/RTTI/BsCMeshColliderRTTI.h"
+	"bsfCore/Private/RTTI/BsCHeightFieldColliderRTTI.h"
 	"bsfCore/Private/RTTI/BsCJointRTTI.h"
 	"bsfCore/Private/RTTI/BsCFixedJointRTTI.h"
 	"bsfCore/Private/RTTI/BsCHingeJointRTTI.h"
@@ -349,6 +373,7 @@ set(BS_CORE_INC_RTTI
 	"bsfCore/Private/RTTI/BsCCharacterControllerRTTI.h"
 	"bsfCore/Private/RTTI/BsShaderImportOptionsRTTI.h"
 	"bsfCore/Private/RTTI/BsPhysicsMeshRTTI.h"
+	"bsfCore/Private/RTTI/BsHeightFieldRTTI.h"
 	"bsfCore/Private/RTTI/BsAudioClipRTTI.h"
 	"bsfCore/Private/RTTI/BsCAudioSourceRTTI.h"
 	"bsfCore/Private/RTTI/BsCAudioListenerRTTI.h"
@@ -375,6 +400,7 @@ set(BS_CORE_INC_RTTI
 	"bsfCore/Private/RTTI/BsAudioListenerRTTI.h"
 	"bsfCore/Private/RTTI/BsAudioSourceRTTI.h"
 	"bsfCore/Private/RTTI/BsShaderVariationRTTI.h"
+	"bsfCore/Private/RTTI/BsShaderLazyVariationsRTTI.h"
 )
 
 set(BS_CORE_SRC_RENDERER
@@ -398,6 +424,7 @@ set(BS_CORE_SRC_RESOURCES
 	"bsfCore/Resources/BsResource.cpp"
 	"bsfCore/Resources/BsResourceHandle.cpp"
 	"bsfCore/Resources/BsResourceManifest.cpp"
+	"bsfCore/Resources/BsResourceArchive.cpp"
 	"bsfCore/Resources/BsResources.cpp"
 	"bsfCore/Resources/BsResourceMetaData.cpp"
 	"bsfCore/Resources/BsSavedResourceData.cpp"
@@ -431,6 +458,8 @@ set(BS_CORE_SRC_MATERIAL
 	"bsfCore/Material/BsGpuParamsSet.cpp"
 	"bsfCore/Material/BsShaderInclude.cpp"
 	"bsfCore/Material/BsShaderVariation.cpp"
+	"bsfCore/Material/BsShaderCompileCache.cpp"
+	"bsfCore/Material/BsShaderLazyVariations.cpp"
 )
 
 set(BS_CORE_SRC_INPUT
@@ -441,10 +470,12 @@ set(BS_CORE_INC_LOCALIZATION
 	"bsfCore/Localization/BsHString.h"
 	"bsfCore/Localization/BsStringTable.h"
 	"bsfCore/Localization/BsStringTableManager.h"
+	"bsfCore/Localization/BsCompiledStringTable.h"
 )
 
 set(BS_CORE_SRC_TEXT
 	"bsfCore/Text/BsFont.cpp"
+	"bsfCore/Text/BsDynamicFontAtlas.cpp"
 	"bsfCore/Text/BsFontImportOptions.cpp"
 	"bsfCore/Text/BsTextData.cpp"
 )
@@ -486,11 +517,14 @@ set(BS_CORE_SRC_RENDERAPI_MANAGERS
 	"bsfCore/Managers/BsHardwareBufferManager.cpp"
 	"bsfCore/Managers/BsMeshManager.cpp"
 	"bsfCore/Managers/BsQueryManager.cpp"
+	"bsfCore/Managers/BsGpuReadbackManager.cpp"
+	"bsfCore/Managers/BsMeshMemoryManager.cpp"
 	"bsfCore/Managers/BsRenderStateManager.cpp"
 	"bsfCore/Managers/BsRenderWindowManager.cpp"
 	"bsfCore/Managers/BsRenderAPIManager.cpp"
 	"bsfCore/Managers/BsCommandBufferManager.cpp"
 	"bsfCore/Managers/BsTextureManager.cpp"
+	"bsfCore/Managers/BsTextureStreamingManager.cpp"
 	"bsfCore/Managers/BsResourceListenerManager.cpp"
 )
 
@@ -511,6 +545,8 @@ set(BS_CORE_SRC_PHYSICS
 	"bsfCore/Physics/BsFCollider.cpp"
 	"bsfCore/Physics/BsPhysicsMesh.cpp"
 	"bsfCore/Physics/BsMeshCollider.cpp"
+	"bsfCore/Physics/BsHeightField.cpp"
+	"bsfCore/Physics/BsHeightFieldCollider.cpp"
 	"bsfCore/Physics/BsFJoint.cpp"
 	"bsfCore/Physics/BsJoint.cpp"
 	"bsfCore/Physics/BsFixedJoint.cpp"
@@ -531,6 +567,7 @@ set(BS_CORE_SRC_SCENE
 	"bsfCore/Scene/BsSceneManager.cpp"
 	"bsfCore/Scene/BsPrefab.cpp"
 	"bsfCore/Scene/BsPrefabDiff.cpp"
+	"bsfCore/Scene/BsPrefabPool.cpp"
 	"bsfCore/Scene/BsPrefabUtility.cpp"
 	"bsfCore/Scene/BsTransform.cpp"
 	"bsfCore/Scene/BsSceneActor.cpp"
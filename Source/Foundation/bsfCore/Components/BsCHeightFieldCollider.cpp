@@ -0,0 +1,64 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Components/BsCHeightFieldCollider.h"
+#include "Scene/BsSceneObject.h"
+#include "Components/BsCRigidbody.h"
+#include "Physics/BsHeightField.h"
+#include "Private/RTTI/BsCHeightFieldColliderRTTI.h"
+
+namespace bs
+{
+	CHeightFieldCollider::CHeightFieldCollider()
+	{
+		setName("HeightFieldCollider");
+	}
+
+	CHeightFieldCollider::CHeightFieldCollider(const HSceneObject& parent)
+		: CCollider(parent)
+	{
+		setName("HeightFieldCollider");
+	}
+
+	void CHeightFieldCollider::setHeightField(const HHeightField& heightField)
+	{
+		if (mHeightField == heightField)
+			return;
+
+		if(getIsTrigger())
+		{
+			LOGWRN("Height fields are not supported on Trigger colliders.");
+			return;
+		}
+
+		mHeightField = heightField;
+
+		if (mInternal != nullptr)
+			_getInternal()->setHeightField(heightField);
+	}
+
+	SPtr<Collider> CHeightFieldCollider::createInternal()
+	{
+		const Transform& tfrm = SO()->getTransform();
+		SPtr<HeightFieldCollider> collider = HeightFieldCollider::create(tfrm.getPosition(), tfrm.getRotation());
+		collider->setHeightField(mHeightField);
+		collider->_setOwner(PhysicsOwnerType::Component, this);
+
+		return collider;
+	}
+
+	bool CHeightFieldCollider::isValidParent(const HRigidbody& parent) const
+	{
+		// Height fields cannot be added to non-kinematic rigidbodies
+		return parent->getIsKinematic();
+	}
+
+	RTTITypeBase* CHeightFieldCollider::getRTTIStatic()
+	{
+		return CHeightFieldColliderRTTI::instance();
+	}
+
+	RTTITypeBase* CHeightFieldCollider::getRTTI() const
+	{
+		return CHeightFieldCollider::getRTTIStatic();
+	}
+}
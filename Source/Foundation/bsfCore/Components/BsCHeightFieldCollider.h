@@ -0,0 +1,68 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Physics/BsHeightFieldCollider.h"
+#include "Components/BsCCollider.h"
+
+namespace bs 
+{
+	/** @addtogroup Components-Core
+	 *  @{
+	 */
+
+	/**
+	 * @copydoc	HeightFieldCollider
+	 *
+	 * @note Wraps HeightFieldCollider as a Component.
+	 */
+	class BS_CORE_EXPORT CHeightFieldCollider : public CCollider
+	{
+	public:
+		CHeightFieldCollider(const HSceneObject& parent);
+
+		/** @copydoc HeightFieldCollider::setHeightField */
+		void setHeightField(const HHeightField& heightField);
+
+		/** @copydoc HeightFieldCollider::getHeightField */
+		HHeightField getHeightField() const { return mHeightField; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**	Returns the height field collider that this component wraps. */
+		HeightFieldCollider* _getInternal() const { return static_cast<HeightFieldCollider*>(mInternal.get()); }
+
+		/** @} */
+
+		/************************************************************************/
+		/* 						COMPONENT OVERRIDES                      		*/
+		/************************************************************************/
+	protected:
+		friend class SceneObject;
+
+		/** @copydoc CCollider::createInternal */
+		SPtr<Collider> createInternal() override;
+
+		/** @copydoc CCollider::isValidParent */
+		bool isValidParent(const HRigidbody& parent) const override;
+
+	protected:
+		HHeightField mHeightField;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class CHeightFieldColliderRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+
+	protected:
+		CHeightFieldCollider(); // Serialization only
+	};
+
+	 /** @} */
+}
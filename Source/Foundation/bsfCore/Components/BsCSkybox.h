@@ -31,6 +31,18 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:Texture,pr:setter)
 		void setTexture(const HTexture& texture) { mInternal->setTexture(texture); }
 
+		/** @copydoc Skybox::setTexture(const HTexture&, const SPtr<Texture>&, const SPtr<Texture>&) */
+		void setTexture(const HTexture& texture, const SPtr<Texture>& filteredRadiance, const SPtr<Texture>& irradiance)
+		{
+			mInternal->setTexture(texture, filteredRadiance, irradiance);
+		}
+
+		/** @copydoc Skybox::getFilteredRadiance */
+		SPtr<Texture> getFilteredRadiance() const { return mInternal->getFilteredRadiance(); }
+
+		/** @copydoc Skybox::getIrradiance */
+		SPtr<Texture> getIrradiance() const { return mInternal->getIrradiance(); }
+
 		/** @copydoc Skybox::setBrightness */
 		BS_SCRIPT_EXPORT(n:Brightness,pr:setter)
 		void setBrightness(float brightness) { mInternal->setBrightness(brightness); }
@@ -4,9 +4,33 @@
 #include "Error/BsException.h"
 #include "CoreThread/BsCoreThread.h"
 #include "Debug/BsDebug.h"
+#include "Utility/BsTimer.h"
 
 namespace bs
 {
+	/**
+	 * Number of playback() calls currently executing on this thread. Depth larger than one means a queue is being played
+	 * back from within a command of another queue.
+	 */
+	static BS_THREADLOCAL UINT32 sPlaybackDepth = 0;
+
+	/** Total number of playback() calls started on this thread. */
+	static BS_THREADLOCAL UINT32 sNumPlaybacks = 0;
+
+	constexpr UINT32 CommandPlaybackStats::NUM_SLOWEST_COMMANDS;
+
+	void CommandPlaybackStats::addCommand(const CommandTiming& timing)
+	{
+		if(timing.timeMs <= slowestCommands[NUM_SLOWEST_COMMANDS - 1].timeMs)
+			return;
+
+		UINT32 idx = NUM_SLOWEST_COMMANDS - 1;
+		for(; idx > 0 && timing.timeMs > slowestCommands[idx - 1].timeMs; idx--)
+			slowestCommands[idx] = slowestCommands[idx - 1];
+
+		slowestCommands[idx] = timing;
+	}
+
 #if BS_DEBUG_MODE
 	CommandQueueBase::CommandQueueBase(ThreadId threadId)
 		:mMyThreadId(threadId), mMaxDebugIdx(0)
@@ -46,19 +70,20 @@ namespace bs
 #if BS_DEBUG_MODE
 		breakIfNeeded(mCommandQueueIdx, mMaxDebugIdx);
 
-		QueuedCommand newCommand(commandCallback, mMaxDebugIdx++, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
+		QueuedCommand newCommand(std::move(commandCallback), mMaxDebugIdx++, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
 #else
-		QueuedCommand newCommand(commandCallback, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
+		QueuedCommand newCommand(std::move(commandCallback), mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
 #endif
 
-		mCommands->push(newCommand);
+		AsyncOp asyncOp = newCommand.asyncOp;
+		mCommands->push(std::move(newCommand));
 
 #if BS_FORCE_SINGLETHREADED_RENDERING
 		Queue<QueuedCommand>* commands = flush();
 		playback(commands);
 #endif
 
-		return newCommand.asyncOp;
+		return asyncOp;
 	}
 
 	void CommandQueueBase::queue(std::function<void()> commandCallback, bool _notifyWhenComplete, UINT32 _callbackId)
@@ -66,12 +91,12 @@ namespace bs
 #if BS_DEBUG_MODE
 		breakIfNeeded(mCommandQueueIdx, mMaxDebugIdx);
 
-		QueuedCommand newCommand(commandCallback, mMaxDebugIdx++, _notifyWhenComplete, _callbackId);
+		QueuedCommand newCommand(std::move(commandCallback), mMaxDebugIdx++, _notifyWhenComplete, _callbackId);
 #else
-		QueuedCommand newCommand(commandCallback, _notifyWhenComplete, _callbackId);
+		QueuedCommand newCommand(std::move(commandCallback), _notifyWhenComplete, _callbackId);
 #endif
 
-		mCommands->push(newCommand);
+		mCommands->push(std::move(newCommand));
 
 #if BS_FORCE_SINGLETHREADED_RENDERING
 		Queue<QueuedCommand>* commands = flush();
@@ -82,17 +107,22 @@ namespace bs
 	bs::Queue<QueuedCommand>* CommandQueueBase::flush()
 	{
 		bs::Queue<QueuedCommand>* oldCommands = mCommands;
+		bs::Queue<QueuedCommand>* newCommands = nullptr;
 
-		if(!mEmptyCommandQueues.empty())
 		{
-			mCommands = mEmptyCommandQueues.top();
-			mEmptyCommandQueues.pop();
-		}
-		else
-		{
-			mCommands = bs_new<bs::Queue<QueuedCommand>>();
+			ScopedSpinLock lock(mEmptyCommandQueuesLock);
+
+			if(!mEmptyCommandQueues.empty())
+			{
+				newCommands = mEmptyCommandQueues.top();
+				mEmptyCommandQueues.pop();
+			}
 		}
 
+		if(newCommands == nullptr)
+			newCommands = bs_new<bs::Queue<QueuedCommand>>();
+
+		mCommands = newCommands;
 		return oldCommands;
 	}
 
@@ -103,10 +133,21 @@ namespace bs
 		if(commands == nullptr)
 			return;
 
+		bool isOutermost = sPlaybackDepth == 0;
+		sPlaybackDepth++;
+		sNumPlaybacks++;
+
+		CommandPlaybackStats stats;
+		stats.numCommands = (UINT32)commands->size();
+
+		Timer timer;
 		while(!commands->empty())
 		{
 			QueuedCommand& command = commands->front();
 
+			UINT32 numPlaybacksBefore = sNumPlaybacks;
+			UINT64 commandStart = timer.getMicroseconds();
+
 			if(command.returnsValue)
 			{
 				AsyncOp& op = command.asyncOp;
@@ -124,6 +165,19 @@ namespace bs
 				command.callback();
 			}
 
+			// Commands playing back other queues are timed through the commands they execute
+			if(sNumPlaybacks == numPlaybacksBefore)
+			{
+				CommandTiming timing;
+#if BS_DEBUG_MODE
+				timing.queueIdx = mCommandQueueIdx;
+				timing.commandIdx = command.debugId;
+#endif
+				timing.timeMs = (timer.getMicroseconds() - commandStart) / 1000.0f;
+
+				stats.addCommand(timing);
+			}
+
 			if(command.notifyWhenComplete && notifyCallback != nullptr)
 			{
 				notifyCallback(command.callbackId);
@@ -132,6 +186,13 @@ namespace bs
 			commands->pop();
 		}
 
+		sPlaybackDepth--;
+		stats.timeMs = timer.getMicroseconds() / 1000.0f;
+
+		if(CoreThread::isStarted())
+			gCoreThread()._notifyPlayback(stats, isOutermost);
+
+		ScopedSpinLock lock(mEmptyCommandQueuesLock);
 		mEmptyCommandQueues.push(commands);
 	}
 
@@ -147,6 +208,7 @@ namespace bs
 		while(!commands->empty())
 			commands->pop();
 
+		ScopedSpinLock lock(mEmptyCommandQueuesLock);
 		mEmptyCommandQueues.push(commands);
 	}
 
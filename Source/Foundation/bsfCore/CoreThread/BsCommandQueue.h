@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Threading/BsAsyncOp.h"
+#include "Threading/BsLockFreeQueue.h"
 #include <functional>
 
 namespace bs
@@ -63,6 +64,27 @@ namespace bs
 		Lock mLock;
 	};
 
+	/**
+	 * Command queue policy that allows commands to be queued from multiple threads without locking. Commands are first
+	 * written into a fixed size lock-free ring buffer and moved into the command queue during flush(). Should be used with
+	 * command queues that receive commands from multiple threads, but are flushed from a single thread.
+	 *
+	 * @note	
+	 * queue() and queueReturn() are thread safe. flush(), cancelAll() and isEmpty() must only be called from a single
+	 * thread at a time.
+	 */
+	class CommandQueueLockFree
+	{
+	public:
+		CommandQueueLockFree() {}
+		virtual ~CommandQueueLockFree() {}
+
+		bool isValidThread(ThreadId ownerThread) const
+		{
+			return true;
+		}
+	};
+
 	/**
 	 * Represents a single queued command in the command list. Contains all the data for executing the command and checking 
 	 * up on the command status.
@@ -72,12 +94,12 @@ namespace bs
 #if BS_DEBUG_MODE
 		QueuedCommand(std::function<void(AsyncOp&)> _callback, UINT32 _debugId, const SPtr<AsyncOpSyncData>& asyncOpSyncData,
 			bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			: debugId(_debugId), callbackWithReturnValue(_callback), asyncOp(asyncOpSyncData), returnsValue(true)
+			: debugId(_debugId), callbackWithReturnValue(std::move(_callback)), asyncOp(asyncOpSyncData), returnsValue(true)
 			, callbackId(_callbackId), notifyWhenComplete(_notifyWhenComplete)
 		{ }
 
 		QueuedCommand(std::function<void()> _callback, UINT32 _debugId, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			:debugId(_debugId), callback(_callback), asyncOp(AsyncOpEmpty()), returnsValue(false), callbackId(_callbackId)
+			:debugId(_debugId), callback(std::move(_callback)), asyncOp(AsyncOpEmpty()), returnsValue(false), callbackId(_callbackId)
 			, notifyWhenComplete(_notifyWhenComplete)
 		{ }
 
@@ -85,12 +107,12 @@ namespace bs
 #else
 		QueuedCommand(std::function<void(AsyncOp&)> _callback, const SPtr<AsyncOpSyncData>& asyncOpSyncData, 
 			bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			: callbackWithReturnValue(_callback), asyncOp(asyncOpSyncData), returnsValue(true), callbackId(_callbackId)
+			: callbackWithReturnValue(std::move(_callback)), asyncOp(asyncOpSyncData), returnsValue(true), callbackId(_callbackId)
 			, notifyWhenComplete(_notifyWhenComplete)
 		{ }
 
 		QueuedCommand(std::function<void()> _callback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			: callback(_callback), asyncOp(AsyncOpEmpty()), returnsValue(false), callbackId(_callbackId)
+			: callback(std::move(_callback)), asyncOp(AsyncOpEmpty()), returnsValue(false), callbackId(_callbackId)
 			, notifyWhenComplete(_notifyWhenComplete)
 		{ }
 #endif
@@ -128,6 +150,9 @@ namespace bs
 			return *this;
 		}
 
+		QueuedCommand(QueuedCommand&& source) = default;
+		QueuedCommand& operator=(QueuedCommand&& rhs) = default;
+
 		std::function<void()> callback;
 		std::function<void(AsyncOp&)> callbackWithReturnValue;
 		AsyncOp asyncOp;
@@ -136,6 +161,39 @@ namespace bs
 		bool notifyWhenComplete;
 	};
 
+	/**
+	 * Execution time of a single command. In debug builds the command is identified by the same queue and command index
+	 * accepted by CommandQueueBase::addBreakpoint(), allowing the code that queued it to be found.
+	 */
+	struct CommandTiming
+	{
+		UINT32 queueIdx = (UINT32)-1; /**< Index of the queue the command was queued on. Only known in debug builds. */
+		UINT32 commandIdx = (UINT32)-1; /**< Index of the command within its queue. Only known in debug builds. */
+		float timeMs = 0.0f; /**< Time it took to execute the command, in milliseconds. */
+	};
+
+	/** Statistics about a single CommandQueueBase::playback() call. */
+	struct CommandPlaybackStats
+	{
+		/** Number of the most expensive commands that are tracked. */
+		static constexpr UINT32 NUM_SLOWEST_COMMANDS = 5;
+
+		/** Number of commands that were executed. */
+		UINT32 numCommands = 0;
+
+		/** Time spent executing all the commands, in milliseconds. */
+		float timeMs = 0.0f;
+
+		/**
+		 * Most expensive commands that were executed, from slowest to fastest. Unused entries have zero time. Commands
+		 * that play back other command queues aren't included, instead the commands they execute are.
+		 */
+		CommandTiming slowestCommands[NUM_SLOWEST_COMMANDS];
+
+		/** Registers the command with the list of slowest commands, if it is slower than any of them. */
+		void addCommand(const CommandTiming& timing);
+	};
+
 	/** Manages a list of commands that can be queued for later execution on the core thread. */
 	class BS_CORE_EXPORT CommandQueueBase
 	{
@@ -235,11 +293,12 @@ namespace bs
 		 */
 		void throwInvalidThreadException(const String& message) const;
 
-	private:
 		Queue<QueuedCommand>* mCommands;
-		Stack<Queue<QueuedCommand>*> mEmptyCommandQueues; /**< List of empty queues for reuse. */
-
 		SPtr<AsyncOpSyncData> mAsyncOpSyncData;
+
+	private:
+		Stack<Queue<QueuedCommand>*> mEmptyCommandQueues; /**< List of empty queues for reuse. */
+		SpinLock mEmptyCommandQueuesLock; /**< Playback can return queues from a different thread than the one flushing. */
 		ThreadId mMyThreadId;
 
 		// Various variables that allow for easier debugging by allowing us to trigger breakpoints
@@ -270,12 +329,14 @@ namespace bs
 		};
 
 		UINT32 mMaxDebugIdx;
-		UINT32 mCommandQueueIdx;
 		
 		static UINT32 MaxCommandQueueIdx;
 		static UnorderedSet<QueueBreakpoint, QueueBreakpoint::HashFunction, QueueBreakpoint::EqualFunction> SetBreakpoints;
 		static Mutex CommandQueueBreakpointMutex;
 
+	protected:
+		UINT32 mCommandQueueIdx;
+
 		/** Checks if the specified command has a breakpoint and throw an assert if it does. */
 		static void breakIfNeeded(UINT32 queueIdx, UINT32 commandIdx);
 #endif
@@ -310,7 +371,7 @@ namespace bs
 #endif
 
 			this->lock();
-			AsyncOp asyncOp = CommandQueueBase::queueReturn(commandCallback, _notifyWhenComplete, _callbackId);
+			AsyncOp asyncOp = CommandQueueBase::queueReturn(std::move(commandCallback), _notifyWhenComplete, _callbackId);
 			this->unlock();
 
 			return asyncOp;
@@ -327,7 +388,7 @@ namespace bs
 #endif
 
 			this->lock();
-			CommandQueueBase::queue(commandCallback, _notifyWhenComplete, _callbackId);
+			CommandQueueBase::queue(std::move(commandCallback), _notifyWhenComplete, _callbackId);
 			this->unlock();
 		}
 
@@ -381,5 +442,105 @@ namespace bs
 		}
 	};
 
+	/**
+	 * @copydoc CommandQueueBase
+	 *
+	 * Specialization that uses the CommandQueueLockFree policy. Queuing a command never locks, instead commands are
+	 * pushed into a lock-free ring buffer that is drained whenever the queue is flushed. If the ring buffer is full the
+	 * queuing thread yields until the flushing thread makes room.
+	 */
+	template<>
+	class CommandQueue<CommandQueueLockFree> : public CommandQueueBase, public CommandQueueLockFree
+	{
+	public:
+		/** @copydoc CommandQueueBase::CommandQueueBase */
+		CommandQueue(ThreadId threadId)
+			:CommandQueueBase(threadId)
+		{ }
+
+		~CommandQueue() 
+		{ }
+
+		/** @copydoc CommandQueueBase::queueReturn */
+		AsyncOp queueReturn(std::function<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+		{
+#if BS_FORCE_SINGLETHREADED_RENDERING
+			return CommandQueueBase::queueReturn(std::move(commandCallback), _notifyWhenComplete, _callbackId);
+#else
+#if BS_DEBUG_MODE
+			UINT32 debugId = mNextDebugIdx.fetch_add(1, std::memory_order_relaxed);
+			breakIfNeeded(mCommandQueueIdx, debugId);
+
+			QueuedCommand newCommand(std::move(commandCallback), debugId, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
+#else
+			QueuedCommand newCommand(std::move(commandCallback), mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
+#endif
+
+			AsyncOp asyncOp = newCommand.asyncOp;
+			pushPending(std::move(newCommand));
+
+			return asyncOp;
+#endif
+		}
+
+		/** @copydoc CommandQueueBase::queue */
+		void queue(std::function<void()> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+		{
+#if BS_FORCE_SINGLETHREADED_RENDERING
+			CommandQueueBase::queue(std::move(commandCallback), _notifyWhenComplete, _callbackId);
+#else
+#if BS_DEBUG_MODE
+			UINT32 debugId = mNextDebugIdx.fetch_add(1, std::memory_order_relaxed);
+			breakIfNeeded(mCommandQueueIdx, debugId);
+
+			pushPending(QueuedCommand(std::move(commandCallback), debugId, _notifyWhenComplete, _callbackId));
+#else
+			pushPending(QueuedCommand(std::move(commandCallback), _notifyWhenComplete, _callbackId));
+#endif
+#endif
+		}
+
+		/** @copydoc CommandQueueBase::flush */
+		bs::Queue<QueuedCommand>* flush()
+		{
+			drainPending();
+			return CommandQueueBase::flush();
+		}
+
+		/** @copydoc CommandQueueBase::cancelAll */
+		void cancelAll()
+		{
+			drainPending();
+			CommandQueueBase::cancelAll();
+		}
+
+		/** @copydoc CommandQueueBase::isEmpty */
+		bool isEmpty()
+		{
+			return mPendingCommands.isEmpty() && CommandQueueBase::isEmpty();
+		}
+
+	private:
+		/** Pushes the command into the ring buffer, yielding while the buffer is full. */
+		void pushPending(QueuedCommand&& command)
+		{
+			while(!mPendingCommands.push(std::move(command)))
+				std::this_thread::yield();
+		}
+
+		/** Moves all commands from the ring buffer into the command queue, in the order they were queued. */
+		void drainPending()
+		{
+			while(mPendingCommands.popWith([this](QueuedCommand&& command) { mCommands->push(std::move(command)); }))
+			{ }
+		}
+
+		LockFreeQueue<QueuedCommand> mPendingCommands;
+
+#if BS_DEBUG_MODE
+		std::atomic<UINT32> mNextDebugIdx{0};
+#endif
+	};
+
 	/** @} */
 }
\ No newline at end of file
@@ -9,9 +9,22 @@ using namespace std::placeholders;
 
 namespace bs
 {
+	/** Core thread objects whose destruction is being batched on this thread, or null if not batching. */
+	static BS_THREADLOCAL Vector<SPtr<ct::CoreObject>>* sDestroyBatch = nullptr;
+
+	/** Number of nested _beginDestroyBatch() calls on this thread. */
+	static BS_THREADLOCAL UINT32 sDestroyBatchDepth = 0;
+
+	/** Core thread objects whose initialization is being batched on this thread, or null if not batching. */
+	static BS_THREADLOCAL Vector<SPtr<ct::CoreObject>>* sInitializeBatch = nullptr;
+
+	/** Number of nested _beginInitializeBatch() calls on this thread. */
+	static BS_THREADLOCAL UINT32 sInitializeBatchDepth = 0;
+
 	CoreObject::CoreObject(bool initializeOnCoreThread)
 		: mFlags(initializeOnCoreThread ? CGO_INIT_ON_CORE_THREAD : 0)
 		, mCoreDirtyFlags(0)
+		, mCoreDirtyListIdx(-1)
 		, mInternalID(CoreObjectManager::instance().generateId())
 	{
 	}
@@ -81,10 +94,39 @@ namespace bs
 		markDependenciesDirty();
 	}
 
+	void CoreObject::recreateCore()
+	{
+		SPtr<ct::CoreObject> oldCore = mCoreSpecific;
+		mCoreSpecific = createCore();
+
+		if (requiresInitOnCoreThread())
+		{
+			assert(BS_THREAD_CURRENT_ID != CoreThread::instance().getCoreThreadId() && "Cannot recreate sim thread object from core thread.");
+
+			if (mCoreSpecific != nullptr)
+			{
+				mCoreSpecific->setScheduledToBeInitialized(true);
+				queueInitializeGpuCommand(mCoreSpecific);
+			}
+
+			// This will only destroy the old ct::CoreObject if this was the last reference
+			if (oldCore != nullptr)
+				queueDestroyGpuCommand(oldCore);
+		}
+		else if (mCoreSpecific != nullptr)
+			mCoreSpecific->initialize();
+	}
+
 	void CoreObject::blockUntilCoreInitialized() const
 	{
 		if (mCoreSpecific != nullptr)
+		{
+			// Object might be waiting in this thread's batch, in which case it would never get initialized
+			if (!mCoreSpecific->isInitialized())
+				_flushInitializeBatch();
+
 			mCoreSpecific->synchronize();
+		}
 	}
 
 	void CoreObject::syncToCore()
@@ -129,13 +171,87 @@ namespace bs
 
 	void CoreObject::queueInitializeGpuCommand(const SPtr<ct::CoreObject>& obj)
 	{
+		if (sInitializeBatch != nullptr)
+		{
+			sInitializeBatch->push_back(obj);
+			return;
+		}
+
 		std::function<void()> func = std::bind(&ct::CoreObject::initialize, obj.get());
 
 		CoreThread::instance().queueCommand(std::bind(&CoreObject::executeGpuCommand, obj, func), CTQF_InternalQueue);
 	}
 
+	void CoreObject::_beginDestroyBatch()
+	{
+		if (sDestroyBatchDepth++ == 0)
+			sDestroyBatch = bs_new<Vector<SPtr<ct::CoreObject>>>();
+	}
+
+	void CoreObject::_endDestroyBatch()
+	{
+		assert(sDestroyBatchDepth > 0);
+
+		if (--sDestroyBatchDepth > 0)
+			return;
+
+		SPtr<Vector<SPtr<ct::CoreObject>>> batch = bs_shared_ptr(sDestroyBatch);
+		sDestroyBatch = nullptr;
+
+		if (batch->empty())
+			return;
+
+		// The objects are released on the core thread, once all the commands previously queued on this thread execute
+		gCoreThread().queueCommand([batch]() { batch->clear(); });
+	}
+
+	void CoreObject::_beginInitializeBatch()
+	{
+		if (sInitializeBatchDepth++ == 0)
+			sInitializeBatch = bs_new<Vector<SPtr<ct::CoreObject>>>();
+	}
+
+	void CoreObject::_endInitializeBatch()
+	{
+		assert(sInitializeBatchDepth > 0);
+
+		if (--sInitializeBatchDepth > 0)
+			return;
+
+		_flushInitializeBatch();
+
+		bs_delete(sInitializeBatch);
+		sInitializeBatch = nullptr;
+	}
+
+	void CoreObject::_flushInitializeBatch()
+	{
+		if (sInitializeBatch == nullptr || sInitializeBatch->empty())
+			return;
+
+		SPtr<Vector<SPtr<ct::CoreObject>>> batch = bs_shared_ptr_new<Vector<SPtr<ct::CoreObject>>>();
+		std::swap(*batch, *sInitializeBatch);
+
+		// Initialized in the order the objects were created in, so objects are initialized after their dependencies
+		auto func = [batch]()
+		{
+			for (auto& obj : *batch)
+				obj->initialize();
+
+			batch->clear();
+		};
+
+		CoreThread::instance().queueCommand(func, CTQF_InternalQueue);
+	}
+
 	void CoreObject::queueDestroyGpuCommand(const SPtr<ct::CoreObject>& obj)
 	{
+		if (sDestroyBatch != nullptr)
+		{
+			sDestroyBatch->push_back(obj);
+			return;
+		}
+
 		std::function<void()> func = [&](){}; // Do nothing function. We just need the shared pointer to stay alive until it reaches the core thread
 
 		gCoreThread().queueCommand(std::bind(&CoreObject::executeGpuCommand, obj, func));
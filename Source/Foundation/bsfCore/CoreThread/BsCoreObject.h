@@ -114,6 +114,42 @@ namespace bs
 			bs_delete<T, MemAlloc>((T*)obj);
 		}
 
+		/**
+		 * Starts batching the destruction of core thread counterparts of objects destroyed on the calling thread. Until
+		 * the matching _endDestroyBatch() call the counterparts are collected, and then all released by a single core
+		 * thread command, instead of queuing a command per object. Calls can be nested.
+		 */
+		static void _beginDestroyBatch();
+
+		/**
+		 * Ends batching started by _beginDestroyBatch(). When the outermost batch ends, queues the command releasing
+		 * the collected objects.
+		 */
+		static void _endDestroyBatch();
+
+		/**
+		 * Starts batching the initialization of core thread counterparts of objects initialized on the calling thread.
+		 * Until the matching _endInitializeBatch() call the counterparts are collected, and then all initialized by a
+		 * single core thread command, instead of queuing a command per object. Calls can be nested.
+		 *
+		 * @note	If the calling thread queues any other core thread command, or blocks on initialization of a batched
+		 *			object, the objects collected so far are queued for initialization first. This ensures the objects
+		 *			are always initialized before they are used on the core thread.
+		 */
+		static void _beginInitializeBatch();
+
+		/**
+		 * Ends batching started by _beginInitializeBatch(). When the outermost batch ends, queues the command
+		 * initializing the collected objects.
+		 */
+		static void _endInitializeBatch();
+
+		/**
+		 * Queues the command initializing objects collected by an active initialization batch on the calling thread,
+		 * if any. The batch remains active.
+		 */
+		static void _flushInitializeBatch();
+
 		/** @} */
 	protected:
 		/**
@@ -153,6 +189,7 @@ namespace bs
 
 		volatile UINT8 mFlags;
 		UINT32 mCoreDirtyFlags;
+		INT32 mCoreDirtyListIdx; // Index in CoreObjectManager's dirty list, or -1 if not in the list
 		UINT64 mInternalID; // ID == 0 is not a valid ID
 		std::weak_ptr<CoreObject> mThis;
 
@@ -188,6 +225,13 @@ namespace bs
 		 */
 		virtual SPtr<ct::CoreObject> createCore() const { return nullptr; }
 
+		/**
+		 * Replaces the core thread counterpart of this object with a new one created through createCore(). The old object 
+		 * is released once the core thread is done with it. Objects holding onto the old core object must be notified
+		 * separately, normally by marking this object as core dirty so its dependants get re-synced.
+		 */
+		void recreateCore();
+
 		/**
 		 * Marks the core data as dirty. This causes the syncToCore() method to trigger the next time objects are synced 
 		 * between core and sim threads.
@@ -228,6 +272,13 @@ namespace bs
 		 */
 		virtual CoreSyncData syncToCore(FrameAlloc* allocator) { return CoreSyncData(); }
 
+		/**
+		 * Returns an object that can sync the current dirty data of this object in a batch together with other objects of
+		 * the same type, or null if the object needs to be synced through syncToCore(). Called once for every dirty object
+		 * during sync, so implementations can check getCoreDirtyFlags() to only batch specific kinds of updates.
+		 */
+		virtual CoreObjectBatchSync* getBatchSync() const { return nullptr; }
+
 		/**
 		 * Populates the provided array with all core objects that this core object depends upon. Dependencies are required
 		 * for syncing to the core thread, so the system can be aware to update the dependant objects if a dependency is
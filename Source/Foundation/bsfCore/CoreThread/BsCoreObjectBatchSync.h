@@ -0,0 +1,47 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup CoreThread-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Syncs a group of dirty CoreObject%s of the same type with their core thread counterparts in a single batch, as an
+	 * alternative to the per-object CoreObject::syncToCore() path. Data for all objects in the batch is written into a
+	 * single contiguous buffer of fixed size elements, avoiding per-object allocations and virtual calls.
+	 *
+	 * Objects opt into batched sync by returning an instance of this class from CoreObject::getBatchSync(). Instances are
+	 * expected to be stateless singletons, usually one per CoreObject type and kind of update.
+	 */
+	class BS_CORE_EXPORT CoreObjectBatchSync
+	{
+	public:
+		virtual ~CoreObjectBatchSync() = default;
+
+		/** Returns the number of bytes required for storing the sync data of a single object. */
+		virtual UINT32 getElementSize() const = 0;
+
+		/**
+		 * Writes the sync data of all provided objects into the provided buffer, one element after another. Buffer is
+		 * large enough to hold @p count elements.
+		 *
+		 * @note	Sim thread only.
+		 */
+		virtual void write(CoreObject* const* objects, UINT32 count, UINT8* data) = 0;
+
+		/**
+		 * Applies the sync data written by write() to the core thread counterparts of the objects. Objects are provided in
+		 * the same order as during write().
+		 *
+		 * @note	Core thread only.
+		 */
+		virtual void read(const SPtr<ct::CoreObject>* objects, UINT32 count, const UINT8* data) = 0;
+	};
+
+	/** @} */
+}
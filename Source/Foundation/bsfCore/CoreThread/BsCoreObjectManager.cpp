@@ -3,6 +3,7 @@
 #include "CoreThread/BsCoreObjectManager.h"
 #include "CoreThread/BsCoreObject.h"
 #include "CoreThread/BsCoreObjectCore.h"
+#include "CoreThread/BsCoreObjectBatchSync.h"
 #include "Error/BsException.h"
 #include "Math/BsMath.h"
 #include "CoreThread/BsCoreThread.h"
@@ -18,7 +19,7 @@ namespace bs
 	CoreObjectManager::~CoreObjectManager()
 	{
 #if BS_DEBUG_MODE
-		Lock lock(mObjectsMutex);
+		ProfiledLock lock(mObjectsMutex);
 
 		if(mObjects.size() > 0)
 		{
@@ -34,18 +35,18 @@ namespace bs
 
 	UINT64 CoreObjectManager::generateId()
 	{
-		Lock lock(mObjectsMutex);
+		ProfiledLock lock(mObjectsMutex);
 
 		return mNextAvailableID++;
 	}
 
 	void CoreObjectManager::registerObject(CoreObject* object)
 	{
-		Lock lock(mObjectsMutex);
+		ProfiledLock lock(mObjectsMutex);
 
 		UINT64 objId = object->getInternalID();
 		mObjects[objId] = object;
-		mDirtyObjects[objId] = { object, -1 };
+		addDirtyObject(object);
 	}
 
 	void CoreObjectManager::unregisterObject(CoreObject* object)
@@ -56,28 +57,37 @@ namespace bs
 
 		// If dirty, we generate sync data before it is destroyed
 		{
-			Lock lock(mObjectsMutex);
-			bool isDirty = object->isCoreDirty() || (mDirtyObjects.find(internalId) != mDirtyObjects.end());
+			ProfiledLock lock(mObjectsMutex);
+			bool isDirty = object->isCoreDirty() || object->mCoreDirtyListIdx != -1;
 
 			if (isDirty)
 			{
+				addDirtyObject(object);
+				DirtyObjectData& dirtyObjData = mDirtyObjects[object->mCoreDirtyListIdx];
+
 				SPtr<ct::CoreObject> coreObject = object->getCore();
 				if (coreObject != nullptr)
 				{
-					CoreSyncData objSyncData = object->syncToCore(gCoreThread().getFrameAlloc());
+					// Objects might get destroyed on any thread, so use the allocator belonging to the calling thread
+					FrameAlloc* allocator = gCoreThread().getThreadFrameAlloc();
+					CoreSyncData objSyncData = object->syncToCore(allocator);
 				
-					mDestroyedSyncData.push_back(CoreStoredSyncObjData(coreObject, internalId, objSyncData));
+					mDestroyedSyncData.push_back(CoreStoredSyncObjData(coreObject, internalId, objSyncData, allocator));
 
-					DirtyObjectData& dirtyObjData = mDirtyObjects[internalId];
 					dirtyObjData.syncDataId = (INT32)mDestroyedSyncData.size() - 1;
 					dirtyObjData.object = nullptr;
+
+					mSyncStats.numSyncedObjects++;
+					mSyncStats.numBytes += objSyncData.getBufferSize();
 				}
 				else
 				{
-					DirtyObjectData& dirtyObjData = mDirtyObjects[internalId];
 					dirtyObjData.syncDataId = -1;
 					dirtyObjData.object = nullptr;
 				}
+
+				// Entry stays in the list so the stored data gets synced, but it no longer references the object
+				object->mCoreDirtyListIdx = -1;
 			}
 
 			mObjects.erase(internalId);
@@ -87,7 +97,7 @@ namespace bs
 
 		// Clear dependencies from dependants
 		{
-			Lock lock(mObjectsMutex);
+			ProfiledLock lock(mObjectsMutex);
 
 			auto iterFind = mDependants.find(internalId);
 			if (iterFind != mDependants.end())
@@ -118,11 +128,43 @@ namespace bs
 
 	void CoreObjectManager::notifyCoreDirty(CoreObject* object)
 	{
-		UINT64 id = object->getInternalID();
+		ProfiledLock lock(mObjectsMutex);
+
+		addDirtyObject(object);
+	}
+
+	void CoreObjectManager::addDirtyObject(CoreObject* object)
+	{
+		if (object->mCoreDirtyListIdx != -1)
+		{
+			DirtyObjectData& dirtyObjData = mDirtyObjects[object->mCoreDirtyListIdx];
+			dirtyObjData.object = object;
+			dirtyObjData.syncDataId = -1;
+			return;
+		}
 
-		Lock lock(mObjectsMutex);
+		object->mCoreDirtyListIdx = (INT32)mDirtyObjects.size();
+		mDirtyObjects.push_back({ object->getInternalID(), object, -1 });
+	}
+
+	void CoreObjectManager::removeDirtyObject(CoreObject* object)
+	{
+		INT32 idx = object->mCoreDirtyListIdx;
+		if (idx == -1)
+			return;
+
+		// Swap with the last entry, the list is sorted before use
+		INT32 lastIdx = (INT32)mDirtyObjects.size() - 1;
+		if (idx != lastIdx)
+		{
+			mDirtyObjects[idx] = mDirtyObjects[lastIdx];
 
-		mDirtyObjects[id] = { object, -1 };
+			if (mDirtyObjects[idx].object != nullptr)
+				mDirtyObjects[idx].object->mCoreDirtyListIdx = idx;
+		}
+
+		mDirtyObjects.pop_back();
+		object->mCoreDirtyListIdx = -1;
 	}
 
 	void CoreObjectManager::notifyDependenciesDirty(CoreObject* object)
@@ -142,7 +184,7 @@ namespace bs
 			FrameVector<CoreObject*> toRemove;
 			FrameVector<CoreObject*> toAdd;
 
-			Lock lock(mObjectsMutex);
+			ProfiledLock lock(mObjectsMutex);
 
 			// Add dependencies and clear old dependencies from dependants
 			{
@@ -229,7 +271,7 @@ namespace bs
 			FrameAlloc* allocator;
 		};
 
-		Lock lock(mObjectsMutex);
+		ProfiledLock lock(mObjectsMutex);
 
 		FrameAlloc* allocator = gCoreThread().getFrameAlloc();
 		Vector<IndividualCoreSyncData> syncData;
@@ -257,7 +299,7 @@ namespace bs
 			if (objectCore == nullptr)
 			{
 				curObj->markCoreClean();
-				mDirtyObjects.erase(id);
+				removeDirtyObject(curObj);
 				return;
 			}
 
@@ -267,8 +309,11 @@ namespace bs
 			data.destination = objectCore;
 			data.syncData = curObj->syncToCore(allocator);
 
+			mSyncStats.numSyncedObjects++;
+			mSyncStats.numBytes += data.syncData.getBufferSize();
+
 			curObj->markCoreClean();
-			mDirtyObjects.erase(id);
+			removeDirtyObject(curObj);
 		};
 
 		syncObject(object);
@@ -295,7 +340,7 @@ namespace bs
 
 	void CoreObjectManager::syncDownload(FrameAlloc* allocator)
 	{
-		Lock lock(mObjectsMutex);
+		ProfiledLock lock(mObjectsMutex);
 
 		mCoreSyncData.push_back(CoreStoredSyncData());
 		CoreStoredSyncData& syncData = mCoreSyncData.back();
@@ -303,46 +348,72 @@ namespace bs
 		syncData.alloc = allocator;
 		
 		// Add all objects dependant on the dirty objects
-		bs_frame_mark();
+		UINT32 numDirtyObjects = (UINT32)mDirtyObjects.size();
+		for (UINT32 i = 0; i < numDirtyObjects; i++)
 		{
-			FrameSet<CoreObject*> dirtyDependants;
-			for (auto& objectData : mDirtyObjects)
-			{
-				auto iterFind = mDependants.find(objectData.first);
-				if (iterFind != mDependants.end())
-				{
-					const Vector<CoreObject*>& dependants = iterFind->second;
-					for (auto& dependant : dependants)
-					{
-						if (!dependant->isCoreDirty())
-							dirtyDependants.insert(dependant);
+			auto iterFind = mDependants.find(mDirtyObjects[i].id);
+			if (iterFind == mDependants.end())
+				continue;
 
-						// Note: This tells the object it was marked dirty due to a dependency, but it doesn't tell it
-						// due to which one. Eventually it might be nice to have that information as well.
-						dependant->mCoreDirtyFlags |= 0x80000000;
-					}
-				}
-			}
-
-			for (auto& dirtyDependant : dirtyDependants)
+			const Vector<CoreObject*>& dependants = iterFind->second;
+			for (auto& dependant : dependants)
 			{
-				UINT64 id = dirtyDependant->getInternalID();
+				// Note: This tells the object it was marked dirty due to a dependency, but it doesn't tell it
+				// due to which one. Eventually it might be nice to have that information as well.
+				dependant->mCoreDirtyFlags |= 0x80000000;
 
-				mDirtyObjects[id] = { dirtyDependant, -1 };
+				if (dependant->mCoreDirtyListIdx == -1)
+					addDirtyObject(dependant);
 			}
 		}
 
-		bs_frame_clear();
-		
 		// Order in which objects are recursed in matters, ones with lower ID will have been created before
 		// ones with higher ones and should be updated first.
-		for (auto& objectData : mDirtyObjects)
+		std::sort(mDirtyObjects.begin(), mDirtyObjects.end(), 
+			[](const DirtyObjectData& lhs, const DirtyObjectData& rhs) { return lhs.id < rhs.id; });
+
+		bs_frame_mark();
 		{
+			// Objects to sync with each batch in syncData.batches
+			FrameVector<FrameVector<CoreObject*>> batchObjects;
+
 			std::function<void(CoreObject*)> syncObject = [&](CoreObject* curObj)
 			{
 				if (!curObj->isCoreDirty())
 					return; // We already processed it as some other object's dependency
 
+				SPtr<ct::CoreObject> objectCore = curObj->getCore();
+				if (objectCore == nullptr)
+				{
+					curObj->markCoreClean();
+					return;
+				}
+
+				// Batched objects are synced after all individually synced objects, so their dependencies will already be
+				// up to date by then
+				CoreObjectBatchSync* batchSync = curObj->getBatchSync();
+				if (batchSync != nullptr)
+				{
+					UINT32 batchIdx = 0;
+					for (; batchIdx < (UINT32)syncData.batches.size(); batchIdx++)
+					{
+						if (syncData.batches[batchIdx].batchSync == batchSync)
+							break;
+					}
+
+					if (batchIdx == (UINT32)syncData.batches.size())
+					{
+						syncData.batches.push_back(CoreStoredBatchSyncData());
+						syncData.batches.back().batchSync = batchSync;
+
+						batchObjects.push_back(FrameVector<CoreObject*>());
+					}
+
+					syncData.batches[batchIdx].destinationObjs.push_back(objectCore);
+					batchObjects[batchIdx].push_back(curObj);
+					return;
+				}
+
 				// Sync dependencies before dependants
 				// Note: I don't check for recursion. Possible infinite loop if two objects
 				// are dependent on one another.
@@ -357,38 +428,66 @@ namespace bs
 						syncObject(dependency);
 				}
 
-				SPtr<ct::CoreObject> objectCore = curObj->getCore();
-				if (objectCore == nullptr)
-				{
-					curObj->markCoreClean();
-					return;
-				}
-
 				CoreSyncData objSyncData = curObj->syncToCore(allocator);
 				curObj->markCoreClean();
 
 				syncData.entries.push_back(CoreStoredSyncObjData(objectCore,
-					curObj->getInternalID(), objSyncData));
+					curObj->getInternalID(), objSyncData, allocator));
+
+				mSyncStats.numSyncedObjects++;
+				mSyncStats.numBytes += objSyncData.getBufferSize();
 			};
 
-			CoreObject* object = objectData.second.object;
-			if (object != nullptr)
-				syncObject(object);
-			else
+			for (auto& objectData : mDirtyObjects)
 			{
-				// Object was destroyed but we still need to sync its modifications before it was destroyed
-				if (objectData.second.syncDataId != -1)
-					syncData.entries.push_back(mDestroyedSyncData[objectData.second.syncDataId]);
+				CoreObject* object = objectData.object;
+				if (object != nullptr)
+					syncObject(object);
+				else
+				{
+					// Object was destroyed but we still need to sync its modifications before it was destroyed
+					if (objectData.syncDataId != -1)
+						syncData.entries.push_back(mDestroyedSyncData[objectData.syncDataId]);
+				}
 			}
+
+			// Write all batches, each into a single contiguous buffer
+			for (UINT32 i = 0; i < (UINT32)syncData.batches.size(); i++)
+			{
+				CoreStoredBatchSyncData& batch = syncData.batches[i];
+				const FrameVector<CoreObject*>& objects = batchObjects[i];
+				UINT32 numObjects = (UINT32)objects.size();
+
+				batch.size = batch.batchSync->getElementSize() * numObjects;
+				batch.data = allocator->alloc(batch.size);
+				batch.batchSync->write(objects.data(), numObjects, batch.data);
+
+				for (auto& object : objects)
+					object->markCoreClean();
+
+				mSyncStats.numBatchedObjects += numObjects;
+				mSyncStats.numBatches++;
+				mSyncStats.numBytes += batch.size;
+			}
+		}
+		bs_frame_clear();
+
+		for (auto& objectData : mDirtyObjects)
+		{
+			if (objectData.object != nullptr)
+				objectData.object->mCoreDirtyListIdx = -1;
 		}
 
 		mDirtyObjects.clear();
 		mDestroyedSyncData.clear();
+
+		mLastSyncStats = mSyncStats;
+		mSyncStats = CoreObjectSyncStats();
 	}
 
 	void CoreObjectManager::syncUpload()
 	{
-		Lock lock(mObjectsMutex);
+		ProfiledLock lock(mObjectsMutex);
 
 		if (mCoreSyncData.size() == 0)
 			return;
@@ -404,10 +503,27 @@ namespace bs
 			UINT8* data = objSyncData.syncData.getBuffer();
 
 			if (data != nullptr)
-				syncData.alloc->free(data);
+			{
+				FrameAlloc* alloc = objSyncData.alloc != nullptr ? objSyncData.alloc : syncData.alloc;
+				alloc->free(data);
+			}
+		}
+
+		for (auto& batch : syncData.batches)
+		{
+			batch.batchSync->read(batch.destinationObjs.data(), (UINT32)batch.destinationObjs.size(), batch.data);
+			syncData.alloc->free(batch.data);
 		}
 
 		syncData.entries.clear();
+		syncData.batches.clear();
 		mCoreSyncData.pop_front();
 	}
+
+	CoreObjectSyncStats CoreObjectManager::getSyncStats() const
+	{
+		ProfiledLock lock(mObjectsMutex);
+
+		return mLastSyncStats;
+	}
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "CoreThread/BsCoreObjectCore.h"
 #include "Utility/BsModule.h"
+#include "Threading/BsLockProfiler.h"
 
 namespace bs
 {
@@ -12,6 +13,15 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Statistics about data transferred from CoreObject%s to their core thread counterparts. */
+	struct CoreObjectSyncStats
+	{
+		UINT32 numSyncedObjects = 0; /**< Number of objects synced through CoreObject::syncToCore(). */
+		UINT32 numBatchedObjects = 0; /**< Number of objects synced through a CoreObjectBatchSync. */
+		UINT32 numBatches = 0; /**< Number of CoreObjectBatchSync batches. */
+		UINT64 numBytes = 0; /**< Total size of all sync data, in bytes. */
+	};
+
 	// TODO Low priority - Add debug option that would remember a call stack for each resource initialization,
 	// so when we fail to release one we know which one it is.
 	
@@ -33,13 +43,24 @@ namespace bs
 				:internalId(0)
 			{ }
 
-			CoreStoredSyncObjData(const SPtr<ct::CoreObject> destObj, UINT64 internalId, const CoreSyncData& syncData)
-				:destinationObj(destObj), syncData(syncData), internalId(internalId)
+			CoreStoredSyncObjData(const SPtr<ct::CoreObject> destObj, UINT64 internalId, const CoreSyncData& syncData,
+				FrameAlloc* alloc)
+				:destinationObj(destObj), syncData(syncData), internalId(internalId), alloc(alloc)
 			{ }
 
 			SPtr<ct::CoreObject> destinationObj;
 			CoreSyncData syncData;
 			UINT64 internalId;
+			FrameAlloc* alloc = nullptr; /**< Allocator the sync data was allocated with. Can belong to any thread. */
+		};
+
+		/** Objects in a single frame that use the same CoreObjectBatchSync, and their sync data. */
+		struct CoreStoredBatchSyncData
+		{
+			CoreObjectBatchSync* batchSync = nullptr;
+			Vector<SPtr<ct::CoreObject>> destinationObjs;
+			UINT8* data = nullptr;
+			UINT32 size = 0;
 		};
 
 		/**
@@ -50,13 +71,15 @@ namespace bs
 		{
 			FrameAlloc* alloc = nullptr;
 			Vector<CoreStoredSyncObjData> entries;
+			Vector<CoreStoredBatchSyncData> batches;
 		};
 
 		/** Contains information about a dirty CoreObject that requires syncing to the core thread. */	
 		struct DirtyObjectData
 		{
-			CoreObject* object;
-			INT32 syncDataId;
+			UINT64 id;
+			CoreObject* object; /**< Null if the object was destroyed. */
+			INT32 syncDataId; /**< Index into mDestroyedSyncData, if the object was destroyed while dirty. */
 		};
 
 	public:
@@ -96,6 +119,12 @@ namespace bs
 		 */
 		void syncToCore(CoreObject* object);
 
+		/**
+		 * Returns statistics about the most recent syncToCore() call. Includes objects synced individually, or due to
+		 * their destruction, since the previous syncToCore() call.
+		 */
+		CoreObjectSyncStats getSyncStats() const;
+
 	private:
 		/**
 		 * Stores all syncable data from dirty core objects into memory allocated by the provided allocator. Additional 
@@ -124,16 +153,28 @@ namespace bs
 		 */
 		void updateDependencies(CoreObject* object, Vector<CoreObject*>* dependencies);
 
+		/** 
+		 * Adds the object to the dirty list, or updates its entry if it's already in the list. Caller must hold 
+		 * mObjectsMutex.
+		 */
+		void addDirtyObject(CoreObject* object);
+
+		/** Removes the object from the dirty list, if present. Caller must hold mObjectsMutex. */
+		void removeDirtyObject(CoreObject* object);
+
 		UINT64 mNextAvailableID;
-		Map<UINT64, CoreObject*> mObjects;
-		Map<UINT64, DirtyObjectData> mDirtyObjects;
-		Map<UINT64, Vector<CoreObject*>> mDependencies;
-		Map<UINT64, Vector<CoreObject*>> mDependants;
+		UnorderedMap<UINT64, CoreObject*> mObjects;
+		Vector<DirtyObjectData> mDirtyObjects;
+		UnorderedMap<UINT64, Vector<CoreObject*>> mDependencies;
+		UnorderedMap<UINT64, Vector<CoreObject*>> mDependants;
 
 		Vector<CoreStoredSyncObjData> mDestroyedSyncData;
 		List<CoreStoredSyncData> mCoreSyncData;
 
-		Mutex mObjectsMutex;
+		CoreObjectSyncStats mSyncStats;
+		CoreObjectSyncStats mLastSyncStats;
+
+		mutable ProfiledMutex mObjectsMutex{"CoreObjectManager objects"};
 	};
 
 	/** @} */
@@ -4,6 +4,10 @@
 #include "Threading/BsThreadPool.h"
 #include "Threading/BsTaskScheduler.h"
 #include "BsCoreApplication.h"
+#include "Math/BsMath.h"
+#include "Utility/BsTimer.h"
+#include "Debug/BsSamplingProfiler.h"
+#include "CoreThread/BsCoreObject.h"
 
 using namespace std::placeholders;
 
@@ -11,12 +15,20 @@ namespace bs
 {
 	CoreThread::QueueData CoreThread::mPerThreadQueue;
 	BS_THREADLOCAL CoreThread::ThreadQueueContainer* CoreThread::QueueData::current = nullptr;
+	CoreThread::FrameAllocData CoreThread::mPerThreadFrameAllocs;
+	BS_THREADLOCAL CoreThread::ThreadFrameAllocs* CoreThread::FrameAllocData::current = nullptr;
+	BS_THREADLOCAL UINT32 CoreThread::FrameAllocData::generation = 0;
+
+	/** Generation assigned to the next CoreThread instance. Starts at one, so it never matches an unset generation. */
+	static std::atomic<UINT32> sNextFrameAllocGeneration{1};
 
 	CoreThread::CoreThread()
 		: mActiveFrameAlloc(0)
+		, mNumActiveSyncBuffers(2)
 		, mCoreThreadShutdown(false)
 		, mCoreThreadStarted(false)
 		, mCommandQueue(nullptr)
+		, mCoreThreadWaiting(false)
 		, mMaxCommandNotifyId(0)
 	{
 		for (UINT32 i = 0; i < NUM_SYNC_BUFFERS; i++)
@@ -25,9 +37,11 @@ namespace bs
 			mFrameAllocs[i]->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
 		}
 
+		mFrameAllocGeneration = sNextFrameAllocGeneration.fetch_add(1, std::memory_order_relaxed);
+
 		mSimThreadId = BS_THREAD_CURRENT_ID;
 		mCoreThreadId = mSimThreadId; // For now
-		mCommandQueue = bs_new<CommandQueue<CommandQueueSync>>(BS_THREAD_CURRENT_ID);
+		mCommandQueue = bs_new<CommandQueue<CommandQueueLockFree>>(BS_THREAD_CURRENT_ID);
 
 		initCoreThread();
 	}
@@ -38,7 +52,7 @@ namespace bs
 		shutdownCoreThread();
 
 		{
-			Lock lock(mCoreQueueMutex);
+			ProfiledLock lock(mCoreQueueMutex);
 
 			for(auto& queue : mAllQueues)
 				bs_delete(queue);
@@ -57,6 +71,24 @@ namespace bs
 			mFrameAllocs[i]->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
 			bs_delete(mFrameAllocs[i]);
 		}
+
+		{
+			ProfiledLock lock(mThreadFrameAllocMutex);
+
+			for(auto& threadAllocs : mAllThreadFrameAllocs)
+			{
+				for (UINT32 i = 0; i < NUM_SYNC_BUFFERS; i++)
+					bs_delete(threadAllocs->allocs[i]);
+
+				bs_delete(threadAllocs);
+			}
+
+			mAllThreadFrameAllocs.clear();
+		}
+
+		// Thread-local pointers to the allocators freed above are left dangling on other threads. They are never
+		// dereferenced since their generation won't match any future instance.
+		mPerThreadFrameAllocs.current = nullptr;
 	}
 
 	void CoreThread::initCoreThread()
@@ -89,6 +121,7 @@ namespace bs
 		}
 
 		mCoreThreadStartedCondition.notify_one();
+		SamplingProfiler::registerThread("Core");
 
 		while(true)
 		{
@@ -97,10 +130,15 @@ namespace bs
 			{
 				Lock lock(mCommandQueueMutex);
 
+				// Must be visible to the queuing threads before we check the queue, see notifyCommandReady()
+				mCoreThreadWaiting.store(true, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
 				while(mCommandQueue->isEmpty())
 				{
 					if(mCoreThreadShutdown)
 					{
+						SamplingProfiler::unregisterThread();
 						TaskScheduler::instance().addWorker();
 						return;
 					}
@@ -110,9 +148,11 @@ namespace bs
 					TaskScheduler::instance().removeWorker();
 				}
 
-				commands = mCommandQueue->flush();
+				mCoreThreadWaiting.store(false, std::memory_order_relaxed);
 			}
 
+			commands = mCommandQueue->flush();
+
 			// Play commands
 			mCommandQueue->playbackWithNotify(commands, std::bind(&CoreThread::commandCompletedNotify, this, _1)); 
 		}
@@ -137,6 +177,18 @@ namespace bs
 #endif
 	}
 
+	void CoreThread::notifyCommandReady()
+	{
+		// Pairs with the fence in runCoreThread(). Either the core thread sees the newly queued command, or we see that
+		// it is waiting and wake it up. The lock ensures we cannot notify in between its empty check and the wait.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if(mCoreThreadWaiting.load(std::memory_order_relaxed))
+		{
+			Lock lock(mCommandQueueMutex);
+			mCommandReadyCondition.notify_all();
+		}
+	}
+
 	SPtr<TCoreThreadQueue<CommandQueueNoSync>> CoreThread::getQueue()
 	{
 		if(mPerThreadQueue.current == nullptr)
@@ -145,8 +197,9 @@ namespace bs
 			mPerThreadQueue.current = bs_new<ThreadQueueContainer>();
 			mPerThreadQueue.current->queue = newQueue;
 			mPerThreadQueue.current->isMain = BS_THREAD_CURRENT_ID == mSimThreadId;
+			mPerThreadQueue.current->threadId = BS_THREAD_CURRENT_ID;
 
-			Lock lock(mCoreQueueMutex);
+			ProfiledLock lock(mCoreQueueMutex);
 			mAllQueues.push_back(mPerThreadQueue.current);
 		}
 
@@ -158,7 +211,7 @@ namespace bs
 		Vector<ThreadQueueContainer*> queueCopies;
 
 		{
-			Lock lock(mCoreQueueMutex);
+			ProfiledLock lock(mCoreQueueMutex);
 
 			queueCopies = mAllQueues;
 		}
@@ -187,27 +240,33 @@ namespace bs
 	{
 		assert(BS_THREAD_CURRENT_ID != getCoreThreadId() && "Cannot queue commands on the core thread for the core thread");
 
+		// Command might reference objects whose initialization is still being batched on this thread
+		CoreObject::_flushInitializeBatch();
+
 		if (!flags.isSet(CTQF_InternalQueue))
-			return getQueue()->queueReturnCommand(commandCallback);
+		{
+			SPtr<TCoreThreadQueue<CommandQueueNoSync>> queue = getQueue();
+			mPerThreadQueue.current->numQueuedCommands.fetch_add(1, std::memory_order_relaxed);
+
+			return queue->queueReturnCommand(std::move(commandCallback));
+		}
 		else
 		{
+			mNumInternalCommands.fetch_add(1, std::memory_order_relaxed);
+
 			bool blockUntilComplete = flags.isSet(CTQF_BlockUntilComplete);
 
 			AsyncOp op;
 			UINT32 commandId = -1;
+			if (blockUntilComplete)
 			{
-				Lock lock(mCommandQueueMutex);
-
-				if (blockUntilComplete)
-				{
-					commandId = mMaxCommandNotifyId++;
-					op = mCommandQueue->queueReturn(commandCallback, true, commandId);
-				}
-				else
-					op = mCommandQueue->queueReturn(commandCallback);
+				commandId = mMaxCommandNotifyId.fetch_add(1, std::memory_order_relaxed);
+				op = mCommandQueue->queueReturn(std::move(commandCallback), true, commandId);
 			}
+			else
+				op = mCommandQueue->queueReturn(std::move(commandCallback));
 
-			mCommandReadyCondition.notify_all();
+			notifyCommandReady();
 
 			if (blockUntilComplete)
 				blockUntilCommandCompleted(commandId);
@@ -220,26 +279,32 @@ namespace bs
 	{
 		assert(BS_THREAD_CURRENT_ID != getCoreThreadId() && "Cannot queue commands on the core thread for the core thread");
 
+		// Command might reference objects whose initialization is still being batched on this thread
+		CoreObject::_flushInitializeBatch();
+
 		if (!flags.isSet(CTQF_InternalQueue))
-			getQueue()->queueCommand(commandCallback);
+		{
+			SPtr<TCoreThreadQueue<CommandQueueNoSync>> queue = getQueue();
+			mPerThreadQueue.current->numQueuedCommands.fetch_add(1, std::memory_order_relaxed);
+
+			queue->queueCommand(std::move(commandCallback));
+		}
 		else
 		{
+			mNumInternalCommands.fetch_add(1, std::memory_order_relaxed);
+
 			bool blockUntilComplete = flags.isSet(CTQF_BlockUntilComplete);
 
 			UINT32 commandId = -1;
+			if (blockUntilComplete)
 			{
-				Lock lock(mCommandQueueMutex);
-
-				if (blockUntilComplete)
-				{
-					commandId = mMaxCommandNotifyId++;
-					mCommandQueue->queue(commandCallback, true, commandId);
-				}
-				else
-					mCommandQueue->queue(commandCallback);
+				commandId = mMaxCommandNotifyId.fetch_add(1, std::memory_order_relaxed);
+				mCommandQueue->queue(std::move(commandCallback), true, commandId);
 			}
+			else
+				mCommandQueue->queue(std::move(commandCallback));
 
-			mCommandReadyCondition.notify_all();
+			notifyCommandReady();
 
 			if (blockUntilComplete)
 				blockUntilCommandCompleted(commandId);
@@ -251,9 +316,78 @@ namespace bs
 		for (UINT32 i = 0; i < NUM_SYNC_BUFFERS; i++)
 			mFrameAllocs[i]->setOwnerThread(mCoreThreadId);
 
-		mActiveFrameAlloc = (mActiveFrameAlloc + 1) % 2;
+		mActiveFrameAlloc = (mActiveFrameAlloc + 1) % mNumActiveSyncBuffers;
 		mFrameAllocs[mActiveFrameAlloc]->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
 		mFrameAllocs[mActiveFrameAlloc]->clear();
+
+		// Per-thread allocators follow the same buffering as the sim thread allocators. Their owner threads are not
+		// allowed to allocate from the buffer being cleared at this point.
+		{
+			ProfiledLock lock(mThreadFrameAllocMutex);
+			for(auto& threadAllocs : mAllThreadFrameAllocs)
+				threadAllocs->allocs[mActiveFrameAlloc]->clear();
+		}
+
+		// Start a new period for the frame statistics
+		mFrameStats.threadQueues.clear();
+		{
+			ProfiledLock lock(mCoreQueueMutex);
+			for(auto& queue : mAllQueues)
+			{
+				UINT32 numCommands = queue->numQueuedCommands.exchange(0, std::memory_order_relaxed);
+				if(numCommands == 0)
+					continue;
+
+				CoreThreadQueueStats queueStats;
+				queueStats.threadId = queue->threadId;
+				queueStats.isSimThread = queue->isMain;
+				queueStats.numCommands = numCommands;
+
+				mFrameStats.threadQueues.push_back(queueStats);
+			}
+		}
+
+		mFrameStats.numInternalCommands = mNumInternalCommands.exchange(0, std::memory_order_relaxed);
+		mFrameStats.numBlockingCalls = mNumBlockingCalls.exchange(0, std::memory_order_relaxed);
+		mFrameStats.blockedTimeMs = mBlockedTimeUs.exchange(0, std::memory_order_relaxed) / 1000.0f;
+
+		{
+			Lock lock(mPlaybackStatsMutex);
+
+			mFrameStats.maxQueueDepth = mPlaybackStats.numCommands;
+			mFrameStats.playbackTimeMs = mPlaybackStats.timeMs;
+			for(UINT32 i = 0; i < CommandPlaybackStats::NUM_SLOWEST_COMMANDS; i++)
+				mFrameStats.slowestCommands[i] = mPlaybackStats.slowestCommands[i];
+
+			mPlaybackStats = CommandPlaybackStats();
+		}
+	}
+
+	void CoreThread::_notifyPlayback(const CommandPlaybackStats& stats, bool isOutermost)
+	{
+		Lock lock(mPlaybackStatsMutex);
+
+		mPlaybackStats.numCommands = std::max(mPlaybackStats.numCommands, stats.numCommands);
+
+		if(isOutermost)
+			mPlaybackStats.timeMs += stats.timeMs;
+
+		for(auto& entry : stats.slowestCommands)
+		{
+			if(entry.timeMs <= 0.0f)
+				break;
+
+			mPlaybackStats.addCommand(entry);
+		}
+	}
+
+	void CoreThread::setFramesInFlight(UINT32 count)
+	{
+		count = Math::clamp(count, 1U, (UINT32)MAX_FRAMES_IN_FLIGHT);
+
+		// One buffer for each frame the core thread can be processing or have queued, and one for the sim thread
+		mNumActiveSyncBuffers = count + 1;
+		mActiveFrameAlloc = 0;
 	}
 
 	FrameAlloc* CoreThread::getFrameAlloc() const
@@ -261,9 +395,31 @@ namespace bs
 		return mFrameAllocs[mActiveFrameAlloc];
 	}
 
+	FrameAlloc* CoreThread::getThreadFrameAlloc()
+	{
+		if(BS_THREAD_CURRENT_ID == mSimThreadId)
+			return getFrameAlloc();
+
+		if(mPerThreadFrameAllocs.current == nullptr || mPerThreadFrameAllocs.generation != mFrameAllocGeneration)
+		{
+			ThreadFrameAllocs* threadAllocs = bs_new<ThreadFrameAllocs>();
+			for (UINT32 i = 0; i < NUM_SYNC_BUFFERS; i++)
+				threadAllocs->allocs[i] = bs_new<FrameAlloc>();
+
+			mPerThreadFrameAllocs.current = threadAllocs;
+			mPerThreadFrameAllocs.generation = mFrameAllocGeneration;
+
+			ProfiledLock lock(mThreadFrameAllocMutex);
+			mAllThreadFrameAllocs.push_back(threadAllocs);
+		}
+
+		return mPerThreadFrameAllocs.current->allocs[mActiveFrameAlloc];
+	}
+
 	void CoreThread::blockUntilCommandCompleted(UINT32 commandId)
 	{
 #if !BS_FORCE_SINGLETHREADED_RENDERING
+		Timer timer;
 		Lock lock(mCommandNotifyMutex);
 
 		while(true)
@@ -284,6 +440,9 @@ namespace bs
 
 			mCommandCompleteCondition.wait(lock);
 		}
+
+		mNumBlockingCalls.fetch_add(1, std::memory_order_relaxed);
+		mBlockedTimeUs.fetch_add(timer.getMicroseconds(), std::memory_order_relaxed);
 #endif
 	}
 
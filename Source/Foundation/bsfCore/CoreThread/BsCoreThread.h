@@ -7,6 +7,7 @@
 #include "CoreThread/BsCommandQueue.h"
 #include "CoreThread/BsCoreThreadQueue.h"
 #include "Threading/BsThreadPool.h"
+#include "Threading/BsLockProfiler.h"
 
 namespace bs
 {
@@ -39,6 +40,42 @@ namespace bs
 	typedef Flags<CoreThreadQueueFlag> CoreThreadQueueFlags;
 	BS_FLAGS_OPERATORS(CoreThreadQueueFlag)
 
+	/** Number of commands a single thread queued on its per-thread core thread queue. */
+	struct CoreThreadQueueStats
+	{
+		ThreadId threadId; /**< Thread that owns the queue. */
+		bool isSimThread = false; /**< True if the queue belongs to the sim thread. */
+		UINT32 numCommands = 0; /**< Number of commands queued. */
+	};
+
+	/**
+	 * Statistics about the commands sent to, and executed on the core thread. Covers the period between two consecutive
+	 * calls to CoreThread::update(), normally a single sim thread frame.
+	 */
+	struct CoreThreadFrameStats
+	{
+		/** Commands queued on each of the per-thread queues. Only threads that queued at least one command are listed. */
+		Vector<CoreThreadQueueStats> threadQueues;
+
+		/** Number of commands queued directly on the internal queue, including the submits of per-thread queues. */
+		UINT32 numInternalCommands = 0;
+
+		/** Largest number of commands executed as a single batch, i.e. the deepest the queue was when it was flushed. */
+		UINT32 maxQueueDepth = 0;
+
+		/** Time the core thread spent executing commands, in milliseconds. */
+		float playbackTimeMs = 0.0f;
+
+		/** Number of calls that blocked the calling thread until the core thread executed the queued command. */
+		UINT32 numBlockingCalls = 0;
+
+		/** Total time the calling threads spent blocked waiting on the core thread, in milliseconds. */
+		float blockedTimeMs = 0.0f;
+
+		/** Most expensive commands executed, from slowest to fastest. Unused entries have zero time. */
+		CommandTiming slowestCommands[CommandPlaybackStats::NUM_SLOWEST_COMMANDS];
+	};
+
 	/**
 	 * Manager for the core thread. Takes care of starting, running, queuing commands and shutting down the core thread.
 	 * 				
@@ -62,6 +99,8 @@ namespace bs
 		{
 			SPtr<TCoreThreadQueue<CommandQueueNoSync>> queue;
 			bool isMain;
+			ThreadId threadId;
+			std::atomic<UINT32> numQueuedCommands{0};
 		};
 
 		/** Wrapper for the thread-local variable because MSVC can't deal with a thread-local variable marked with dllimport or dllexport,  
@@ -116,6 +155,25 @@ namespace bs
 		 */
 		void update();
 
+		/**
+		 * Returns statistics about the commands queued and executed during the last frame, as recorded between the last
+		 * two calls to update().
+		 *
+		 * @note	Sim thread only.
+		 */
+		const CoreThreadFrameStats& getFrameStats() const { return mFrameStats; }
+
+		/**
+		 * Records statistics about a finished command queue playback, to be included in the frame statistics.
+		 *
+		 * @param[in]	stats		Statistics about the playback.
+		 * @param[in]	isOutermost	False if the queue was played back from within a command of another queue, in which
+		 *							case its time was already counted by the outer playback.
+		 *
+		 * @note	Core thread only.
+		 */
+		void _notifyPlayback(const CommandPlaybackStats& stats, bool isOutermost);
+
 		/**
 		 * Returns a frame allocator that should be used for allocating temporary data being passed to the core thread. As the 
 		 * name implies the data only lasts one frame, so you need to be careful not to use it for longer than that.
@@ -124,9 +182,41 @@ namespace bs
 		 */
 		FrameAlloc* getFrameAlloc() const;
 
+		/**
+		 * Returns a frame allocator owned by the calling thread, that can be used for allocating temporary data being
+		 * passed to the core thread. Allows worker threads (e.g. TaskScheduler tasks) to prepare core thread data without
+		 * using the general heap or synchronizing with other threads. Memory remains valid for the same duration as memory
+		 * allocated through getFrameAlloc(), and may be freed from any thread. Calling this on the sim thread is equivalent
+		 * to calling getFrameAlloc().
+		 *
+		 * @note	
+		 * Thread safe. Allocations must be made during the sim thread frame they are meant for, meaning any tasks using
+		 * the allocator must complete before the next call to update().
+		 */
+		FrameAlloc* getThreadFrameAlloc();
+
+		/**
+		 * Sets the maximum number of frames the sim and core threads are allowed to process at once, in range
+		 * [1, MAX_FRAMES_IN_FLIGHT]. Determines how many sync buffers are in use.
+		 *
+		 * @note	Sim thread only. Must be called before the first call to update().
+		 */
+		void setFramesInFlight(UINT32 count);
+
 		/** 
-		 * Returns number of buffers needed to sync data between core and sim thread. Currently the sim thread can be one frame
-		 * ahead of the core thread, meaning we need two buffers. If this situation changes increase this number.
+		 * Returns the number of sync buffers actively used for the number of frames in flight set by 
+		 * setFramesInFlight(). In range [2, NUM_SYNC_BUFFERS].
+		 */
+		UINT32 getNumActiveSyncBuffers() const { return mNumActiveSyncBuffers; }
+
+		/** Maximum number of frames the sim and core threads are allowed to process at once. */
+		static const int MAX_FRAMES_IN_FLIGHT = 3;
+
+		/** 
+		 * Returns number of buffers needed to sync data between core and sim thread. By default the sim thread can be one
+		 * frame ahead of the core thread, meaning we need two buffers. Each additional frame in flight allows one more
+		 * frame to be queued on the core thread, requiring one more buffer. Only as many buffers as required by the
+		 * value provided to setFramesInFlight() are actively used.
 		 *
 		 * For example:
 		 *  - Sim thread frame starts, it writes some data to buffer 0.
@@ -140,14 +230,38 @@ namespace bs
 		 *  - New core thread frame starts, it reads some data from buffer 1.
 		 *  - ...
 		 */
-		static const int NUM_SYNC_BUFFERS = 2;
+		static const int NUM_SYNC_BUFFERS = MAX_FRAMES_IN_FLIGHT + 1;
 	private:
+		/** Frame allocators owned by a single non-sim thread, one for each sync buffer. */
+		struct ThreadFrameAllocs
+		{
+			FrameAlloc* allocs[NUM_SYNC_BUFFERS];
+		};
+
+		/** Wrapper for the thread-local variables, for the same reason as QueueData. */
+		struct FrameAllocData
+		{
+			static BS_THREADLOCAL ThreadFrameAllocs* current;
+
+			/** 
+			 * Generation of the CoreThread instance that created @p current. If it doesn't match the active instance,
+			 * @p current was freed along with a previous CoreThread instance and must not be used.
+			 */
+			static BS_THREADLOCAL UINT32 generation;
+		};
+
 		/**
 		 * Double buffered frame allocators. Means sim thread cannot be more than 1 frame ahead of core thread (If that changes
 		 * you should be able to easily add more).
 		 */
 		FrameAlloc* mFrameAllocs[NUM_SYNC_BUFFERS];
 		UINT32 mActiveFrameAlloc;
+		UINT32 mNumActiveSyncBuffers;
+
+		static FrameAllocData mPerThreadFrameAllocs;
+		UINT32 mFrameAllocGeneration;
+		Vector<ThreadFrameAllocs*> mAllThreadFrameAllocs;
+		ProfiledMutex mThreadFrameAllocMutex{"CoreThread frame alloc"};
 
 		static QueueData mPerThreadQueue;
 		Vector<ThreadQueueContainer*> mAllQueues;
@@ -159,24 +273,35 @@ namespace bs
 		ThreadId mSimThreadId;
 		ThreadId mCoreThreadId;
 		Mutex mCommandQueueMutex;
-		Mutex mCoreQueueMutex;
+		ProfiledMutex mCoreQueueMutex{"CoreThread queues"};
 		Signal mCommandReadyCondition;
 		Mutex mCommandNotifyMutex;
 		Signal mCommandCompleteCondition;
 		Mutex mThreadStartedMutex;
 		Signal mCoreThreadStartedCondition;
 
-		CommandQueue<CommandQueueSync>* mCommandQueue;
+		CommandQueue<CommandQueueLockFree>* mCommandQueue;
+		std::atomic<bool> mCoreThreadWaiting; /**< True while the core thread is (about to start) waiting for commands. */
 
-		UINT32 mMaxCommandNotifyId; /**< ID that will be assigned to the next command with a notifier callback. */
+		std::atomic<UINT32> mMaxCommandNotifyId; /**< ID that will be assigned to the next command with a notifier callback. */
 		Vector<UINT32> mCommandsCompleted; /**< Completed commands that have notifier callbacks set up */
 
+		CoreThreadFrameStats mFrameStats;
+		CommandPlaybackStats mPlaybackStats; /**< Accumulated since the last update(), numCommands being the maximum. */
+		Mutex mPlaybackStatsMutex;
+		std::atomic<UINT32> mNumInternalCommands{0};
+		std::atomic<UINT32> mNumBlockingCalls{0};
+		std::atomic<UINT64> mBlockedTimeUs{0};
+
 		/** Starts the core thread worker method. Should only be called once. */
 		void initCoreThread();
 
 		/**	Main worker method of the core thread. Called once thread is started. */
 		void runCoreThread();
 
+		/** Wakes up the core thread if it is waiting for commands. Must be called after queuing on the internal queue. */
+		void notifyCommandReady();
+
 		/** Shutdowns the core thread. It will complete all ready commands before shutdown. */
 		void shutdownCoreThread();
 
@@ -20,20 +20,23 @@ namespace bs
 
 	AsyncOp CoreThreadQueueBase::queueReturnCommand(std::function<void(AsyncOp&)> commandCallback)
 	{
-		return mCommandQueue->queueReturn(commandCallback);
+		return mCommandQueue->queueReturn(std::move(commandCallback));
 	}
 
 	void CoreThreadQueueBase::queueCommand(std::function<void()> commandCallback)
 	{
-		mCommandQueue->queue(commandCallback);
+		mCommandQueue->queue(std::move(commandCallback));
 	}
 
 	void CoreThreadQueueBase::submitToCoreThread(bool blockUntilComplete)
 	{
 		Queue<QueuedCommand>* commands = mCommandQueue->flush();
 
-		gCoreThread().queueCommand(std::bind(&CommandQueueBase::playback, mCommandQueue, commands), 
-			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+		CoreThreadQueueFlags flags = CTQF_InternalQueue;
+		if(blockUntilComplete)
+			flags |= CTQF_BlockUntilComplete;
+
+		gCoreThread().queueCommand(std::bind(&CommandQueueBase::playback, mCommandQueue, commands), flags);
 	}
 
 	void CoreThreadQueueBase::cancelAll()
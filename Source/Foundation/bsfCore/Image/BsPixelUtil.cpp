@@ -6,6 +6,8 @@
 #include "Math/BsMath.h"
 #include "Error/BsException.h"
 #include "Image/BsTexture.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Math/BsSIMD.h"
 #include <nvtt.h>
 
 namespace bs
@@ -333,6 +335,397 @@ namespace bs
 		}
 	};
 
+	/**
+	 * Performs pixel data downsampling to exactly half the size, by averaging each 2x2 block of source pixels. Only 
+	 * handles 2D pixel formats with one byte per channel. Does not perform format conversion.
+	 *
+	 * @tparam	elementSize	Size of a single pixel in bytes.
+	 */
+	template<UINT32 elementSize> struct BoxDownsampler_Byte
+	{
+		/** Checks if the destination is exactly half the size of the source, in which case scale() can be used. */
+		static bool isHalfSize(const PixelData& source, const PixelData& dest)
+		{
+			return source.getDepth() == 1 && dest.getDepth() == 1 &&
+				source.getWidth() == dest.getWidth() * 2 && source.getHeight() == dest.getHeight() * 2;
+		}
+
+		static void scale(const PixelData& source, const PixelData& dest)
+		{
+			const UINT32 srcRowPitch = source.getRowPitch() * elementSize;
+			const UINT32 dstRowPitch = dest.getRowPitch() * elementSize;
+
+			const UINT8* srcRow = source.getData() + (source.getLeft() + source.getTop() * source.getRowPitch()) * 
+				elementSize;
+			UINT8* dstRow = dest.getData() + (dest.getLeft() + dest.getTop() * dest.getRowPitch()) * elementSize;
+
+			const UINT32 width = dest.getWidth();
+			for (UINT32 y = 0; y < dest.getHeight(); y++)
+			{
+				const UINT8* srcRow0 = srcRow;
+				const UINT8* srcRow1 = srcRow + srcRowPitch;
+
+				UINT32 x = 0;
+				if (elementSize == 4)
+				{
+					// Four output pixels at a time, separating even and odd source pixels and averaging them per-channel
+					for (; x + 4 <= width; x += 4)
+					{
+						const UINT8* src0 = srcRow0 + x * 8;
+						const UINT8* src1 = srcRow1 + x * 8;
+
+						simd::uint32x4 a0 = simd::load_u<simd::uint32x4>(src0);
+						simd::uint32x4 a1 = simd::load_u<simd::uint32x4>(src0 + 16);
+						simd::uint32x4 b0 = simd::load_u<simd::uint32x4>(src1);
+						simd::uint32x4 b1 = simd::load_u<simd::uint32x4>(src1 + 16);
+
+						simd::uint16<16> sum = simd::to_uint16(simd::uint8x16(simd::unzip4_lo(a0, a1)));
+						sum = simd::add(sum, simd::to_uint16(simd::uint8x16(simd::unzip4_hi(a0, a1))));
+						sum = simd::add(sum, simd::to_uint16(simd::uint8x16(simd::unzip4_lo(b0, b1))));
+						sum = simd::add(sum, simd::to_uint16(simd::uint8x16(simd::unzip4_hi(b0, b1))));
+						sum = simd::add(sum, simd::splat<simd::uint16<16>>(2));
+
+						simd::store_u(dstRow + x * 4, simd::to_uint8(simd::shift_r<2>(sum)));
+					}
+				}
+
+				for (; x < width; x++)
+				{
+					const UINT8* src0 = srcRow0 + x * 2 * elementSize;
+					const UINT8* src1 = srcRow1 + x * 2 * elementSize;
+					UINT8* dst = dstRow + x * elementSize;
+
+					for (UINT32 k = 0; k < elementSize; k++)
+					{
+						UINT32 sum = src0[k] + src0[k + elementSize] + src1[k] + src1[k + elementSize];
+						dst[k] = (UINT8)((sum + 2) >> 2);
+					}
+				}
+
+				srcRow += srcRowPitch * 2;
+				dstRow += dstRowPitch;
+			}
+		}
+	};
+
+	/** Converts a row of pixels from one format to another. */
+	typedef void(*PixelRowConversionFunc)(const UINT8* src, UINT8* dst, UINT32 count);
+
+	/** 
+	 * Converts a 4 byte pixel with 8 bits per channel (RGBA8, BGRA8, RGB8 or BGR8) into a different 4 byte pixel format.
+	 * Optionally swaps the red and blue channels, after which the pixel is masked with @p AndMask and combined with 
+	 * @p OrMask. 
+	 */
+	template<bool SwapRB, UINT32 AndMask, UINT32 OrMask>
+	UINT32 convertPixel8888(UINT32 value)
+	{
+		if (SwapRB)
+			value = (value & 0xFF00FF00) | ((value >> 16) & 0xFF) | ((value & 0xFF) << 16);
+
+		return (value & AndMask) | OrMask;
+	}
+
+	/** @copydoc convertPixel8888 */
+	template<bool SwapRB, UINT32 AndMask, UINT32 OrMask>
+	simd::uint32x4 convertPixel8888(simd::uint32x4 value)
+	{
+		if (SwapRB)
+		{
+			value = simd::bit_or(
+				simd::bit_and(value, simd::splat<simd::uint32x4>(0xFF00FF00)),
+				simd::bit_or(
+					simd::bit_and(simd::shift_r<16>(value), simd::splat<simd::uint32x4>(0xFF)),
+					simd::shift_l<16>(simd::bit_and(value, simd::splat<simd::uint32x4>(0xFF)))));
+		}
+
+		if (AndMask != 0xFFFFFFFF)
+			value = simd::bit_and(value, simd::splat<simd::uint32x4>(AndMask));
+
+		if (OrMask != 0)
+			value = simd::bit_or(value, simd::splat<simd::uint32x4>(OrMask));
+
+		return value;
+	}
+
+	/** Converts a row of 4 byte pixels with 8 bits per channel between formats. @see convertPixel8888. */
+	template<bool SwapRB, UINT32 AndMask, UINT32 OrMask>
+	void convertRow8888(const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		UINT32 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			simd::uint32x4 value = simd::load_u<simd::uint32x4>(src + i * 4);
+			simd::store_u(dst + i * 4, convertPixel8888<SwapRB, AndMask, OrMask>(value));
+		}
+
+		for (; i < count; i++)
+		{
+			UINT32 value;
+			memcpy(&value, src + i * 4, sizeof(value));
+
+			value = convertPixel8888<SwapRB, AndMask, OrMask>(value);
+			memcpy(dst + i * 4, &value, sizeof(value));
+		}
+	}
+
+	/** 
+	 * Converts a row of 4 byte pixels with 8 bits per channel into RGBA32F. Parameters are used for converting the source
+	 * pixels into RGBA8 first. @see convertPixel8888. 
+	 */
+	template<bool SwapRB, UINT32 OrMask>
+	void convertRow8888ToRGBA32F(const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		float* output = (float*)dst;
+
+		UINT32 i = 0;
+		const simd::float32<16> scale = simd::splat<simd::float32<16>>(255.0f);
+		for (; i + 4 <= count; i += 4)
+		{
+			simd::uint32x4 value = simd::load_u<simd::uint32x4>(src + i * 4);
+			value = convertPixel8888<SwapRB, 0xFFFFFFFF, OrMask>(value);
+
+			simd::store_u(output + i * 4, simd::div(simd::to_float32(simd::uint8x16(value)), scale));
+		}
+
+		for (; i < count; i++)
+		{
+			UINT32 value;
+			memcpy(&value, src + i * 4, sizeof(value));
+			value = convertPixel8888<SwapRB, 0xFFFFFFFF, OrMask>(value);
+
+			for (UINT32 k = 0; k < 4; k++)
+				output[i * 4 + k] = Bitwise::uintToUnorm((value >> (k * 8)) & 0xFF, 8);
+		}
+	}
+
+	/** 
+	 * Converts a row of RGBA32F pixels into 4 byte pixels with 8 bits per channel. Parameters are used for converting
+	 * from RGBA8 into the destination format. @see convertPixel8888. 
+	 */
+	template<bool SwapRB, UINT32 AndMask>
+	void convertRowRGBA32FTo8888(const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		const float* input = (const float*)src;
+
+		UINT32 i = 0;
+		const simd::float32<16> scale = simd::splat<simd::float32<16>>(256.0f);
+		const simd::float32<16> minValue = simd::splat<simd::float32<16>>(0.0f);
+		const simd::float32<16> maxValue = simd::splat<simd::float32<16>>(255.0f);
+		for (; i + 4 <= count; i += 4)
+		{
+			// Matches Bitwise::unormToUint(), which truncates the value scaled by 256 and clamps it to [0, 255]
+			simd::float32<16> value = simd::load_u<simd::float32<16>>(input + i * 4);
+			value = simd::min(simd::max(simd::mul(value, scale), minValue), maxValue);
+
+			simd::uint32x4 packed = simd::uint32x4(simd::to_uint8(simd::to_int32(value)));
+			simd::store_u(dst + i * 4, convertPixel8888<SwapRB, AndMask, 0>(packed));
+		}
+
+		for (; i < count; i++)
+		{
+			UINT32 value = 0;
+			for (UINT32 k = 0; k < 4; k++)
+				value |= Bitwise::unormToUint(input[i * 4 + k], 8) << (k * 8);
+
+			value = convertPixel8888<SwapRB, AndMask, 0>(value);
+			memcpy(dst + i * 4, &value, sizeof(value));
+		}
+	}
+
+	/** Lookup table converting 8-bit normalized values into half-precision floating point values. */
+	struct UnormToHalfTable
+	{
+		UnormToHalfTable()
+		{
+			for (UINT32 i = 0; i < 256; i++)
+				values[i] = Bitwise::floatToHalf(Bitwise::uintToUnorm(i, 8));
+		}
+
+		UINT16 values[256];
+	};
+
+	/** 
+	 * Converts a row of 4 byte pixels with 8 bits per channel into RGBA16F. Parameters are used for converting the source
+	 * pixels into RGBA8 first. @see convertPixel8888. 
+	 */
+	template<bool SwapRB, UINT32 OrMask>
+	void convertRow8888ToRGBA16F(const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		static const UnormToHalfTable table;
+
+		UINT16* output = (UINT16*)dst;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			UINT32 value;
+			memcpy(&value, src + i * 4, sizeof(value));
+			value = convertPixel8888<SwapRB, 0xFFFFFFFF, OrMask>(value);
+
+			for (UINT32 k = 0; k < 4; k++)
+				output[i * 4 + k] = table.values[(value >> (k * 8)) & 0xFF];
+		}
+	}
+
+	/** 
+	 * Converts a row of RGBA16F pixels into 4 byte pixels with 8 bits per channel. Parameters are used for converting
+	 * from RGBA8 into the destination format. @see convertPixel8888. 
+	 */
+	template<bool SwapRB, UINT32 AndMask>
+	void convertRowRGBA16FTo8888(const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		const UINT16* input = (const UINT16*)src;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			UINT32 value = 0;
+			for (UINT32 k = 0; k < 4; k++)
+				value |= Bitwise::unormToUint(Bitwise::halfToFloat(input[i * 4 + k]), 8) << (k * 8);
+
+			value = convertPixel8888<SwapRB, AndMask, 0>(value);
+			memcpy(dst + i * 4, &value, sizeof(value));
+		}
+	}
+
+	/** Entry in a table of specialized conversion kernels for common pairs of pixel formats. */
+	struct PixelRowConversion
+	{
+		PixelFormat srcFormat;
+		PixelFormat dstFormat;
+		PixelRowConversionFunc func;
+	};
+
+	/** 
+	 * Specialized conversion kernels used by PixelUtil::bulkPixelConversion(), bypassing the generic per-pixel unpack and
+	 * pack. All kernels produce the same results as the generic path.
+	 */
+	static const PixelRowConversion gPixelRowConversions[] =
+	{
+		{ PF_RGBA8, PF_BGRA8, &convertRow8888<true, 0xFFFFFFFF, 0> },
+		{ PF_BGRA8, PF_RGBA8, &convertRow8888<true, 0xFFFFFFFF, 0> },
+		{ PF_RGB8, PF_BGR8, &convertRow8888<true, 0x00FFFFFF, 0> },
+		{ PF_BGR8, PF_RGB8, &convertRow8888<true, 0x00FFFFFF, 0> },
+		{ PF_RGB8, PF_RGBA8, &convertRow8888<false, 0xFFFFFFFF, 0xFF000000> },
+		{ PF_BGR8, PF_BGRA8, &convertRow8888<false, 0xFFFFFFFF, 0xFF000000> },
+		{ PF_RGB8, PF_BGRA8, &convertRow8888<true, 0xFFFFFFFF, 0xFF000000> },
+		{ PF_BGR8, PF_RGBA8, &convertRow8888<true, 0xFFFFFFFF, 0xFF000000> },
+		{ PF_RGBA8, PF_RGB8, &convertRow8888<false, 0x00FFFFFF, 0> },
+		{ PF_BGRA8, PF_BGR8, &convertRow8888<false, 0x00FFFFFF, 0> },
+		{ PF_RGBA8, PF_BGR8, &convertRow8888<true, 0x00FFFFFF, 0> },
+		{ PF_BGRA8, PF_RGB8, &convertRow8888<true, 0x00FFFFFF, 0> },
+
+		{ PF_RGBA8, PF_RGBA32F, &convertRow8888ToRGBA32F<false, 0> },
+		{ PF_BGRA8, PF_RGBA32F, &convertRow8888ToRGBA32F<true, 0> },
+		{ PF_RGB8, PF_RGBA32F, &convertRow8888ToRGBA32F<false, 0xFF000000> },
+		{ PF_BGR8, PF_RGBA32F, &convertRow8888ToRGBA32F<true, 0xFF000000> },
+		{ PF_RGBA32F, PF_RGBA8, &convertRowRGBA32FTo8888<false, 0xFFFFFFFF> },
+		{ PF_RGBA32F, PF_BGRA8, &convertRowRGBA32FTo8888<true, 0xFFFFFFFF> },
+		{ PF_RGBA32F, PF_RGB8, &convertRowRGBA32FTo8888<false, 0x00FFFFFF> },
+		{ PF_RGBA32F, PF_BGR8, &convertRowRGBA32FTo8888<true, 0x00FFFFFF> },
+
+		{ PF_RGBA8, PF_RGBA16F, &convertRow8888ToRGBA16F<false, 0> },
+		{ PF_BGRA8, PF_RGBA16F, &convertRow8888ToRGBA16F<true, 0> },
+		{ PF_RGB8, PF_RGBA16F, &convertRow8888ToRGBA16F<false, 0xFF000000> },
+		{ PF_BGR8, PF_RGBA16F, &convertRow8888ToRGBA16F<true, 0xFF000000> },
+		{ PF_RGBA16F, PF_RGBA8, &convertRowRGBA16FTo8888<false, 0xFFFFFFFF> },
+		{ PF_RGBA16F, PF_BGRA8, &convertRowRGBA16FTo8888<true, 0xFFFFFFFF> },
+		{ PF_RGBA16F, PF_RGB8, &convertRowRGBA16FTo8888<false, 0x00FFFFFF> },
+		{ PF_RGBA16F, PF_BGR8, &convertRowRGBA16FTo8888<true, 0x00FFFFFF> },
+	};
+
+	/** Returns a specialized conversion kernel for the provided pair of formats, or null if one doesn't exist. */
+	static PixelRowConversionFunc findPixelRowConversion(PixelFormat srcFormat, PixelFormat dstFormat)
+	{
+		for (auto& entry : gPixelRowConversions)
+		{
+			if (entry.srcFormat == srcFormat && entry.dstFormat == dstFormat)
+				return entry.func;
+		}
+
+		return nullptr;
+	}
+
+	/** Lookup tables for converting 8-bit color values between gamma (sRGB) and linear space. */
+	struct SRGBTables
+	{
+		SRGBTables()
+		{
+			for (UINT32 i = 0; i < 256; i++)
+			{
+				const float value = i / 255.0f;
+
+				const float linear = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+				const float gamma = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+
+				toLinear[i] = (UINT8)Math::clamp(Math::round(linear * 255.0f), 0.0f, 255.0f);
+				toSRGB[i] = (UINT8)Math::clamp(Math::round(gamma * 255.0f), 0.0f, 255.0f);
+			}
+		}
+
+		UINT8 toLinear[256];
+		UINT8 toSRGB[256];
+	};
+
+	/** 
+	 * Applies a lookup table to the color channels of every pixel of a format with 8 bits per channel. Only the first 
+	 * @p numChannels channels of each pixel are modified.
+	 */
+	static void applyLookup8(PixelData& data, const UINT8 (&table)[256], UINT32 numChannels)
+	{
+		const UINT32 pixelSize = PixelUtil::getNumElemBytes(data.getFormat());
+		UINT8* slice = data.getData() + 
+			(data.getLeft() + data.getTop() * data.getRowPitch() + data.getFront() * data.getSlicePitch()) * pixelSize;
+
+		for (UINT32 z = 0; z < data.getDepth(); z++)
+		{
+			UINT8* row = slice;
+			for (UINT32 y = 0; y < data.getHeight(); y++)
+			{
+				UINT8* pixel = row;
+				for (UINT32 x = 0; x < data.getWidth(); x++)
+				{
+					for (UINT32 k = 0; k < numChannels; k++)
+						pixel[k] = table[pixel[k]];
+
+					pixel += pixelSize;
+				}
+
+				row += data.getRowPitch() * pixelSize;
+			}
+
+			slice += data.getSlicePitch() * pixelSize;
+		}
+	}
+
+	/** 
+	 * Applies a conversion function to the color channels of every pixel of a 32-bit floating point format. Only the first 
+	 * @p numChannels channels of each pixel are modified.
+	 */
+	template<class T>
+	static void applyConversion32F(PixelData& data, UINT32 numChannels, T func)
+	{
+		const UINT32 pixelSize = PixelUtil::getNumElemBytes(data.getFormat());
+		UINT8* slice = data.getData() + 
+			(data.getLeft() + data.getTop() * data.getRowPitch() + data.getFront() * data.getSlicePitch()) * pixelSize;
+
+		for (UINT32 z = 0; z < data.getDepth(); z++)
+		{
+			UINT8* row = slice;
+			for (UINT32 y = 0; y < data.getHeight(); y++)
+			{
+				float* pixel = (float*)row;
+				for (UINT32 x = 0; x < data.getWidth(); x++)
+				{
+					for (UINT32 k = 0; k < numChannels; k++)
+						pixel[k] = func(pixel[k]);
+
+					pixel += pixelSize / sizeof(float);
+				}
+
+				row += data.getRowPitch() * pixelSize;
+			}
+
+			slice += data.getSlicePitch() * pixelSize;
+		}
+	}
+
 	/**	Data describing a pixel format. */
 	struct PixelFormatDescription
 	{
@@ -1954,6 +2347,29 @@ namespace bs
 		UINT8 *dstptr = static_cast<UINT8*>(dst.getData())
 			+ (dst.getLeft() + dst.getTop() * dst.getRowPitch() + dst.getFront() * dst.getSlicePitch()) * dstPixelSize;
 
+		// Use a specialized kernel for common format pairs, if available
+		PixelRowConversionFunc rowConversion = findPixelRowConversion(src.getFormat(), dst.getFormat());
+		if (rowConversion != nullptr)
+		{
+			for (UINT32 z = src.getFront(); z < src.getBack(); z++)
+			{
+				UINT8* srcRow = srcptr;
+				UINT8* dstRow = dstptr;
+				for (UINT32 y = src.getTop(); y < src.getBottom(); y++)
+				{
+					rowConversion(srcRow, dstRow, src.getWidth());
+
+					srcRow += src.getRowPitch() * srcPixelSize;
+					dstRow += dst.getRowPitch() * dstPixelSize;
+				}
+
+				srcptr += src.getSlicePitch() * srcPixelSize;
+				dstptr += dst.getSlicePitch() * dstPixelSize;
+			}
+
+			return;
+		}
+
 		// Calculate pitches+skips in bytes
 		UINT32 srcRowSkipBytes = src.getRowSkip()*srcPixelSize;
 		UINT32 srcSliceSkipBytes = src.getSliceSkip()*srcPixelSize;
@@ -2171,10 +2587,25 @@ namespace bs
 				// No conversion
 				switch (PixelUtil::getNumElemBytes(src.getFormat()))
 				{
-				case 1: LinearResampler_Byte<1>::scale(src, temp); break;
-				case 2: LinearResampler_Byte<2>::scale(src, temp); break;
+				case 1: 
+					if (BoxDownsampler_Byte<1>::isHalfSize(src, temp))
+						BoxDownsampler_Byte<1>::scale(src, temp);
+					else
+						LinearResampler_Byte<1>::scale(src, temp);
+					break;
+				case 2: 
+					if (BoxDownsampler_Byte<2>::isHalfSize(src, temp))
+						BoxDownsampler_Byte<2>::scale(src, temp);
+					else
+						LinearResampler_Byte<2>::scale(src, temp);
+					break;
 				case 3: LinearResampler_Byte<3>::scale(src, temp); break;
-				case 4: LinearResampler_Byte<4>::scale(src, temp); break;
+				case 4: 
+					if (BoxDownsampler_Byte<4>::isHalfSize(src, temp))
+						BoxDownsampler_Byte<4>::scale(src, temp);
+					else
+						LinearResampler_Byte<4>::scale(src, temp);
+					break;
 				default:
 					// Never reached
 					assert(false);
@@ -2337,6 +2768,54 @@ namespace bs
 		}
 	}
 
+	void PixelUtil::SRGBToLinear(PixelData& data)
+	{
+		static const SRGBTables tables;
+
+		switch (data.getFormat())
+		{
+		case PF_R8: applyLookup8(data, tables.toLinear, 1); break;
+		case PF_RG8: applyLookup8(data, tables.toLinear, 2); break;
+		case PF_RGB8: case PF_BGR8:
+		case PF_RGBA8: case PF_BGRA8:
+			applyLookup8(data, tables.toLinear, 3);
+			break;
+		case PF_R32F: case PF_RG32F: case PF_RGB32F: case PF_RGBA32F:
+			applyConversion32F(data, std::min(getNumElements(data.getFormat()), 3U), [](float value)
+			{
+				return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+			});
+			break;
+		default:
+			LOGERR("SRGBToLinear() not supported for format \"" + getFormatName(data.getFormat()) + "\".");
+			break;
+		}
+	}
+
+	void PixelUtil::linearToSRGB(PixelData& data)
+	{
+		static const SRGBTables tables;
+
+		switch (data.getFormat())
+		{
+		case PF_R8: applyLookup8(data, tables.toSRGB, 1); break;
+		case PF_RG8: applyLookup8(data, tables.toSRGB, 2); break;
+		case PF_RGB8: case PF_BGR8:
+		case PF_RGBA8: case PF_BGRA8:
+			applyLookup8(data, tables.toSRGB, 3);
+			break;
+		case PF_R32F: case PF_RG32F: case PF_RGB32F: case PF_RGBA32F:
+			applyConversion32F(data, std::min(getNumElements(data.getFormat()), 3U), [](float value)
+			{
+				return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+			});
+			break;
+		default:
+			LOGERR("linearToSRGB() not supported for format \"" + getFormatName(data.getFormat()) + "\".");
+			break;
+		}
+	}
+
 	void PixelUtil::applyGamma(UINT8* buffer, float gamma, UINT32 size, UINT8 bpp)
 	{
 		if(gamma == 1.0f)
@@ -2402,36 +2881,64 @@ namespace bs
 		interimData.allocateInternalBuffer();
 		bulkPixelConversion(src, interimData);
 
-		nvtt::InputOptions io;
-		io.setTextureLayout(nvtt::TextureType_2D, src.getWidth(), src.getHeight());
-		io.setMipmapGeneration(false);
-		io.setAlphaMode(toNVTTAlphaMode(options.alphaMode));
-		io.setNormalMap(options.isNormalMap);
+		nvtt::CompressionOptions co;
+		co.setFormat(toNVTTFormat(options.format));
+		co.setQuality(toNVTTQuality(options.quality));
 
-		if (interimFormat == PF_RGBA32F)
-			io.setFormat(nvtt::InputFormat_RGBA_32F);
-		else
-			io.setFormat(nvtt::InputFormat_BGRA_8UB);
+		// Blocks are compressed independently, so the image is split into horizontal strips of block rows which are then
+		// compressed in parallel. Each strip outputs to its own part of the destination buffer.
+		static constexpr UINT32 STRIP_HEIGHT = 64;
 
-		if (options.isSRGB)
-			io.setGamma(2.2f, 2.2f);
-		else
-			io.setGamma(1.0f, 1.0f);
+		const UINT32 width = src.getWidth();
+		const UINT32 height = src.getHeight();
+		const UINT32 interimRowSize = width * getNumElemBytes(interimFormat);
+		const UINT32 numStrips = Math::divideAndRoundUp(height, STRIP_HEIGHT);
 
-		io.setMipmapData(interimData.getData(), src.getWidth(), src.getHeight());
+		std::atomic<bool> failed{false};
+		auto compressStrips = [&](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+			{
+				const UINT32 stripY = i * STRIP_HEIGHT;
+				const UINT32 stripHeight = std::min(STRIP_HEIGHT, height - stripY);
 
-		nvtt::CompressionOptions co;
-		co.setFormat(toNVTTFormat(options.format));
-		co.setQuality(toNVTTQuality(options.quality));
+				nvtt::InputOptions io;
+				io.setTextureLayout(nvtt::TextureType_2D, width, stripHeight);
+				io.setMipmapGeneration(false);
+				io.setAlphaMode(toNVTTAlphaMode(options.alphaMode));
+				io.setNormalMap(options.isNormalMap);
 
-		NVTTCompressOutputHandler outputHandler(dst.getData(), dst.getConsecutiveSize());
+				if (interimFormat == PF_RGBA32F)
+					io.setFormat(nvtt::InputFormat_RGBA_32F);
+				else
+					io.setFormat(nvtt::InputFormat_BGRA_8UB);
 
-		nvtt::OutputOptions oo;
-		oo.setOutputHeader(false);
-		oo.setOutputHandler(&outputHandler);
+				if (options.isSRGB)
+					io.setGamma(2.2f, 2.2f);
+				else
+					io.setGamma(1.0f, 1.0f);
 
-		nvtt::Compressor compressor;
-		if (!compressor.process(io, co, oo))
+				io.setMipmapData(interimData.getData() + stripY * interimRowSize, width, stripHeight);
+
+				UINT8* stripOutput = dst.getData() + getMemorySize(width, stripY, 1, options.format);
+				NVTTCompressOutputHandler outputHandler(stripOutput, getMemorySize(width, stripHeight, 1, options.format));
+
+				nvtt::OutputOptions oo;
+				oo.setOutputHeader(false);
+				oo.setOutputHandler(&outputHandler);
+
+				nvtt::Compressor compressor;
+				if (!compressor.process(io, co, oo))
+					failed = true;
+			}
+		};
+
+		if (numStrips > 1 && TaskScheduler::isStarted())
+			TaskScheduler::instance().parallelFor(0, numStrips, 1, compressStrips);
+		else
+			compressStrips(0, numStrips);
+
+		if (failed)
 		{
 			LOGERR("Compression failed. Internal error.");
 			return;
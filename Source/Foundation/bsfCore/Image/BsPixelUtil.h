@@ -277,6 +277,18 @@ namespace bs
 		 */
 		static void copy(const PixelData& src, PixelData& dst, UINT32 offsetX = 0, UINT32 offsetY = 0, UINT32 offsetZ = 0);
 
+		/** 
+		 * Converts the color channels of the provided pixels from gamma (sRGB) to linear space, in place. Alpha is left
+		 * unchanged. Only supported for formats with 8-bit normalized or 32-bit floating point channels.
+		 */
+		static void SRGBToLinear(PixelData& data);
+
+		/** 
+		 * Converts the color channels of the provided pixels from linear to gamma (sRGB) space, in place. Alpha is left
+		 * unchanged. Only supported for formats with 8-bit normalized or 32-bit floating point channels.
+		 */
+		static void linearToSRGB(PixelData& data);
+
 		/**
 		 * Applies gamma correction to the pixels in the provided buffer.
 		 *
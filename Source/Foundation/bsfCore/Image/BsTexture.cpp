@@ -9,6 +9,9 @@
 #include "Threading/BsAsyncOp.h"
 #include "Resources/BsResources.h"
 #include "Image/BsPixelUtil.h"
+#include "Managers/BsTextureStreamingManager.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
+#include "Managers/BsGpuReadbackManager.h"
 
 namespace bs 
 {
@@ -99,13 +102,38 @@ namespace bs
 		}
 
 		Resource::initialize();
+
+		if (_isStreamed())
+		{
+			uploadStreamingData();
+
+			if (TextureStreamingManager::isStarted())
+				TextureStreamingManager::instance()._registerTexture(this);
+		}
+	}
+
+	void Texture::destroy()
+	{
+		if (_isStreamed() && TextureStreamingManager::isStarted())
+			TextureStreamingManager::instance()._unregisterTexture(this);
+
+		Resource::destroy();
 	}
 
 	SPtr<ct::CoreObject> Texture::createCore() const
 	{
 		const TextureProperties& props = getProperties();
 
-		SPtr<ct::CoreObject> coreObj = ct::TextureManager::instance().createTextureInternal(props.mDesc, mInitData);
+		// Streamed textures only keep the resident mip levels on the GPU
+		TEXTURE_DESC desc = props.mDesc;
+		if (mResidentMip > 0)
+		{
+			PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mResidentMip,
+				desc.width, desc.height, desc.depth);
+			desc.numMips -= mResidentMip;
+		}
+
+		SPtr<ct::CoreObject> coreObj = ct::TextureManager::instance().createTextureInternal(desc, mInitData);
 
 		if ((mProperties.getUsage() & TU_CPUCACHED) == 0)
 			mInitData = nullptr;
@@ -118,24 +146,89 @@ namespace bs
 		UINT32 subresourceIdx = mProperties.mapToSubresourceIdx(face, mipLevel);
 		updateCPUBuffers(subresourceIdx, *data);
 
+		if (_isStreamed())
+		{
+			// Keep the source data up to date, so the level has the new contents when it gets streamed in later
+			SPtr<PixelData> sourceData = PixelData::create(data->getWidth(), data->getHeight(), data->getDepth(),
+				data->getFormat());
+			PixelUtil::bulkPixelConversion(*data, *sourceData);
+
+			mStreamingData[subresourceIdx] = sourceData;
+		}
+
+		return writeCoreData(data, face, mipLevel, discardEntireBuffer);
+	}
+
+	AsyncOp Texture::writeCoreData(const SPtr<PixelData>& data, UINT32 face, UINT32 mipLevel, bool discardEntireBuffer)
+	{
 		data->_lock();
 
+		// Levels that aren't resident only get written to the source data
+		SPtr<ct::Texture> coreTexture;
+		if (mipLevel >= mResidentMip)
+		{
+			coreTexture = getCore();
+			mipLevel -= mResidentMip;
+		}
+
 		std::function<void(const SPtr<ct::Texture>&, UINT32, UINT32, const SPtr<PixelData>&, bool, AsyncOp&)> func =
 			[&](const SPtr<ct::Texture>& texture, UINT32 _face, UINT32 _mipLevel, const SPtr<PixelData>& _pixData,
 				bool _discardEntireBuffer, AsyncOp& asyncOp)
 		{
-			texture->writeData(*_pixData, _mipLevel, _face, _discardEntireBuffer);
+			if (texture != nullptr)
+				texture->writeData(*_pixData, _mipLevel, _face, _discardEntireBuffer);
+
 			_pixData->_unlock();
 			asyncOp._completeOperation();
 
 		};
 
-		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel,
+		return gCoreThread().queueReturnCommand(std::bind(func, coreTexture, face, mipLevel,
 			data, discardEntireBuffer, std::placeholders::_1));
 	}
 
+	void Texture::uploadStreamingData()
+	{
+		UINT32 numFaces = mProperties.getNumFaces();
+		UINT32 numMips = mProperties.getNumMipmaps() + 1;
+
+		for (UINT32 face = 0; face < numFaces; face++)
+		{
+			for (UINT32 mip = mResidentMip; mip < numMips; mip++)
+			{
+				UINT32 subresourceIdx = mProperties.mapToSubresourceIdx(face, mip);
+				writeCoreData(mStreamingData[subresourceIdx], face, mip, false);
+			}
+		}
+	}
+
+	void Texture::_setResidentMip(UINT32 mipLevel)
+	{
+		mipLevel = std::min(mipLevel, mProperties.getNumMipmaps());
+		if (!_isStreamed() || mipLevel == mResidentMip)
+			return;
+
+		mResidentMip = mipLevel;
+
+		recreateCore();
+		uploadStreamingData();
+
+		// Objects referencing the texture (e.g. materials) depend on it, which makes them re-sync and pick up the new
+		// core object
+		markCoreDirty();
+	}
+
 	AsyncOp Texture::readData(const SPtr<PixelData>& data, UINT32 face, UINT32 mipLevel)
 	{
+		// Source data of streamed textures contains all levels, including the ones not resident on the GPU
+		if (_isStreamed())
+		{
+			UINT32 subresourceIdx = mProperties.mapToSubresourceIdx(face, mipLevel);
+			PixelUtil::bulkPixelConversion(*mStreamingData[subresourceIdx], *data);
+
+			return gCoreThread().queueReturnCommand([](AsyncOp& asyncOp) { asyncOp._completeOperation(); });
+		}
+
 		data->_lock();
 
 		std::function<void(const SPtr<ct::Texture>&, UINT32, UINT32, const SPtr<PixelData>&, AsyncOp&)> func =
@@ -155,6 +248,24 @@ namespace bs
 			data, std::placeholders::_1));
 	}
 
+	AsyncOp Texture::readDataAsync(const SPtr<PixelData>& data, UINT32 face, UINT32 mipLevel)
+	{
+		// Source data of streamed textures is in CPU memory, nothing to wait on
+		if (_isStreamed())
+			return readData(data, face, mipLevel);
+
+		data->_lock();
+
+		AsyncOp op = ct::GpuReadbackManager::instance().createAsyncOp();
+		SPtr<ct::Texture> core = getCore();
+		gCoreThread().queueCommand([core, data, face, mipLevel, op]()
+		{
+			ct::GpuReadbackManager::instance().readTexture(core, data, face, mipLevel, op);
+		});
+
+		return op;
+	}
+
 	UINT32 Texture::calculateSize() const
 	{
 		return mProperties.getNumFaces() * PixelUtil::getMemorySize(mProperties.getWidth(),
@@ -329,8 +440,39 @@ namespace bs
 		:mProperties(desc), mInitData(initData)
 	{ }
 
+	Texture::~Texture()
+	{
+		BS_GPU_MEMORY_FREE(this);
+	}
+
 	void Texture::initialize()
 	{
+#if BS_PROFILING_ENABLED || BS_TELEMETRY_ENABLED
+		UINT64 size = 0;
+
+		UINT32 mipWidth = mProperties.getWidth();
+		UINT32 mipHeight = mProperties.getHeight();
+		UINT32 mipDepth = mProperties.getDepth();
+		for(UINT32 i = 0; i <= mProperties.getNumMipmaps(); i++)
+		{
+			size += PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, mProperties.getFormat());
+
+			if (mipWidth != 1) mipWidth /= 2;
+			if (mipHeight != 1) mipHeight /= 2;
+			if (mipDepth != 1) mipDepth /= 2;
+		}
+
+		size *= mProperties.getNumFaces() * std::max(1U, mProperties.getNumSamples());
+
+		const bool isRenderTarget = (mProperties.getUsage() & (TU_RENDERTARGET | TU_DEPTHSTENCIL)) != 0;
+		const GpuMemoryCategory category = isRenderTarget ? GpuMemoryCategory::RenderTarget : GpuMemoryCategory::Texture;
+
+		BS_GPU_MEMORY_ALLOC(category, this, size, toString(mProperties.getWidth()) + "x" +
+			toString(mProperties.getHeight()) + "x" + toString(mProperties.getDepth()) + " " +
+			PixelUtil::getFormatName(mProperties.getFormat()) + ", " + toString(mProperties.getNumMipmaps() + 1) +
+			" mips, " + toString(mProperties.getNumFaces()) + " faces");
+#endif
+
 		if (mInitData != nullptr)
 		{
 			writeData(*mInitData, 0, 0, true);
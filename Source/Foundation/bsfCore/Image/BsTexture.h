@@ -32,6 +32,18 @@ namespace bs
 		TU_CPUCACHED		BS_SCRIPT_EXPORT(n:CPUCached)		= 0x1000,
 		/** Allows the CPU to directly read the texture data buffers from the GPU. */
 		TU_CPUREADABLE		BS_SCRIPT_EXPORT(n:CPUReadable)		= 0x2000,
+		/** 
+		 * Only the low resolution mip levels are uploaded to the GPU on load, while higher resolution levels are streamed
+		 * in on demand by TextureStreamingManager, based on the size the texture is rendered at. 
+		 */
+		TU_STREAMED			BS_SCRIPT_EXPORT(n:Streamed)		= 0x4000,
+		/**
+		 * Render target or depth/stencil texture whose contents are only needed while it is bound for rendering. The
+		 * texture cannot be sampled, copied or read from the CPU, and its contents are undefined once another render
+		 * target is bound. This allows tile-based GPUs to keep the texture in on-chip memory only, without ever
+		 * backing it with (or writing it out to) device memory. Ignored when combined with TU_LOADSTORE.
+		 */
+		TU_TRANSIENT		BS_SCRIPT_EXPORT(n:Transient)		= 0x8000,
 		/** Default (most common) texture usage. */
 		TU_DEFAULT			BS_SCRIPT_EXPORT(ex:true)			= TU_STATIC
 	};
@@ -233,6 +245,17 @@ namespace bs
 		 */
 		AsyncOp readData(const SPtr<PixelData>& data, UINT32 face = 0, UINT32 mipLevel = 0);
 
+		/**
+		 * Same as readData(), except that the core thread doesn't wait for the GPU to finish rendering to the texture.
+		 * Instead the data is copied on the GPU and read a few frames later, once the copy is done. Use this for 
+		 * reading textures the GPU renders to (e.g. for screenshots or GPU picking) without stalling the core thread.
+		 *
+		 * @note 
+		 * This is an @ref asyncMethod "asynchronous method". Poll AsyncOp::hasCompleted() instead of blocking on the
+		 * returned operation, since the operation only completes once further frames are rendered.
+		 */
+		AsyncOp readDataAsync(const SPtr<PixelData>& data, UINT32 face = 0, UINT32 mipLevel = 0);
+
 		/**
 		 * Reads data from the cached system memory texture buffer into the provided buffer. 
 		 * 		  
@@ -255,6 +278,12 @@ namespace bs
 		/**	Retrieves a core implementation of a texture usable only from the core thread. */
 		SPtr<ct::Texture> getCore() const;
 
+		/**
+		 * Returns the most detailed mip level currently present on the GPU. Always 0 unless the texture is streamed (see
+		 * TU_STREAMED), in which case the core implementation only contains mip levels starting at this level.
+		 */
+		UINT32 getResidentMip() const { return mResidentMip; }
+
 		/************************************************************************/
 		/* 								STATICS		                     		*/
 		/************************************************************************/
@@ -295,6 +324,18 @@ namespace bs
 		static SPtr<Texture> _createPtr(const SPtr<PixelData>& pixelData, int usage = TU_DEFAULT, 
 			bool hwGammaCorrection = false);
 
+		/** 
+		 * Changes the most detailed mip level present on the GPU, for streamed textures. Re-creates the core 
+		 * implementation with the new set of mip levels and uploads them from the texture's source data. Does nothing if
+		 * the texture isn't streamed.
+		 *
+		 * @note	Internal method. Used by TextureStreamingManager.
+		 */
+		void _setResidentMip(UINT32 mipLevel);
+
+		/** Returns true if the texture keeps the source data for all mip levels, allowing them to be streamed. */
+		bool _isStreamed() const { return !mStreamingData.empty(); }
+
 		/** @} */
 
 	protected:
@@ -306,9 +347,21 @@ namespace bs
 		/** @copydoc Resource::initialize */
 		void initialize() override;
 
+		/** @copydoc CoreObject::destroy */
+		void destroy() override;
+
 		/** @copydoc CoreObject::createCore */
 		SPtr<ct::CoreObject> createCore() const override;
 
+		/** 
+		 * Queues a write of the provided data to the core implementation. @p mipLevel is relative to the mip levels
+		 * present in the core implementation.
+		 */
+		AsyncOp writeCoreData(const SPtr<PixelData>& data, UINT32 face, UINT32 mipLevel, bool discardEntireBuffer);
+
+		/** Uploads all resident mip levels of a streamed texture from its source data. */
+		void uploadStreamingData();
+
 		/** Calculates the size of the texture, in bytes. */
 		UINT32 calculateSize() const;
 
@@ -327,6 +380,9 @@ namespace bs
 		TextureProperties mProperties;
 		mutable SPtr<PixelData> mInitData;
 
+		Vector<SPtr<PixelData>> mStreamingData; /**< Data for all sub-resources of a streamed texture. */
+		UINT32 mResidentMip = 0;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -355,7 +411,7 @@ namespace bs
 	{
 	public:
 		Texture(const TEXTURE_DESC& desc, const SPtr<PixelData>& initData, GpuDeviceFlags deviceMask);
-		virtual ~Texture() {}
+		virtual ~Texture();
 
 
 		/** @copydoc CoreObject::initialize */
@@ -0,0 +1,207 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Importer/BsImportCache.h"
+#include "Importer/BsImportOptions.h"
+#include "Resources/BsResource.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "Utility/BsUtility.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	ImportCache::ImportCache(const Path& folder)
+		:mFolder(folder)
+	{
+		mFolder.makeAbsolute(FileSystem::getWorkingDirectoryPath());
+
+		Lock fileLock = FileScheduler::getLock(mFolder);
+		if (!FileSystem::exists(mFolder))
+			FileSystem::createDir(mFolder);
+	}
+
+	String ImportCache::generateKey(const SpecificImporter& importer, const Path& filePath, 
+		const SPtr<const ImportOptions>& importOptions, bool importAll) const
+	{
+		String contents;
+		{
+			Lock fileLock = FileScheduler::getLock(filePath);
+
+			SPtr<DataStream> stream = FileSystem::openFile(filePath);
+			if (stream == nullptr)
+				return StringUtil::BLANK;
+
+			contents = stream->getAsString();
+			stream->close();
+		}
+
+		String options;
+		if (importOptions != nullptr)
+		{
+			MemorySerializer serializer;
+			UINT32 numBytes = 0;
+			UINT8* bytes = serializer.encode(const_cast<ImportOptions*>(importOptions.get()), numBytes);
+
+			options = String((const char*)bytes, numBytes);
+			bs_free(bytes);
+		}
+
+		// Prefix each input with its length, so that different sets of inputs cannot concatenate into the same string
+		StringStream stream;
+		stream << CACHE_VERSION << "|" << importer.getVersion() << "|" << (importAll ? 1 : 0);
+		stream << "|" << filePath.getExtension();
+		stream << "|" << options.size() << ":" << options;
+		stream << "|" << md5(contents);
+
+		return md5(stream.str());
+	}
+
+	bool ImportCache::find(const String& key, Vector<SubResourceRaw>& resources) const
+	{
+		const Path path = getEntryPath(key);
+
+		SPtr<DataStream> stream;
+		{
+			Lock fileLock = FileScheduler::getLock(path);
+			if (!FileSystem::isFile(path))
+				return false;
+
+			SPtr<DataStream> fileStream = FileSystem::openFile(path);
+			if (fileStream == nullptr)
+				return false;
+
+			stream = bs_shared_ptr_new<MemoryDataStream>(fileStream);
+			fileStream->close();
+		}
+
+		UINT32 numResources = 0;
+		if (stream->read(&numResources, sizeof(numResources)) != sizeof(numResources))
+			return false;
+
+		Vector<SubResourceRaw> output;
+		for (UINT32 i = 0; i < numResources; i++)
+		{
+			UINT32 nameSize = 0;
+			UINT32 dataSize = 0;
+			if (stream->read(&nameSize, sizeof(nameSize)) != sizeof(nameSize) || 
+				nameSize > stream->size() - stream->tell())
+				return false;
+
+			String name(nameSize, '\0');
+			stream->read(&name[0], nameSize);
+
+			if (stream->read(&dataSize, sizeof(dataSize)) != sizeof(dataSize) || 
+				dataSize > stream->size() - stream->tell())
+				return false;
+
+			UINT8* data = static_cast<MemoryDataStream*>(stream.get())->getCurrentPtr();
+			stream->skip(dataSize);
+
+			MemorySerializer serializer;
+			SPtr<IReflectable> object = serializer.decode(data, dataSize);
+			if (object == nullptr || !object->isDerivedFrom(Resource::getRTTIStatic()))
+			{
+				LOGWRN("Ignoring corrupt import cache entry: " + path.toString());
+				return false;
+			}
+
+			output.push_back({ name, std::static_pointer_cast<Resource>(object) });
+		}
+
+		resources = output;
+		return true;
+	}
+
+	void ImportCache::store(const String& key, const Vector<SubResourceRaw>& resources)
+	{
+		struct EncodedResource
+		{
+			UINT8* data;
+			UINT32 size;
+		};
+
+		// Resources referencing other resources cannot be cached, as the referenced resources aren't a part of the entry
+		for (auto& entry : resources)
+		{
+			if (entry.value != nullptr && !Utility::findResourceDependencies(*entry.value, false).empty())
+				return;
+		}
+
+		Vector<EncodedResource> encodedResources;
+		for (auto& entry : resources)
+		{
+			if (entry.value == nullptr)
+				continue;
+
+			EncodedResource encoded;
+
+			MemorySerializer serializer;
+			encoded.data = serializer.encode(entry.value.get(), encoded.size);
+			encodedResources.push_back(encoded);
+		}
+
+		// Write to a temporary file first, so other processes sharing the cache never see a partially written entry
+		const Path path = getEntryPath(key);
+		Path tempPath = path;
+		tempPath.setExtension(".tmp");
+
+		{
+			Lock fileLock = FileScheduler::getLock(path);
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(tempPath);
+			if (stream != nullptr)
+			{
+				UINT32 numResources = (UINT32)encodedResources.size();
+				stream->write(&numResources, sizeof(numResources));
+
+				UINT32 idx = 0;
+				for (auto& entry : resources)
+				{
+					if (entry.value == nullptr)
+						continue;
+
+					UINT32 nameSize = (UINT32)entry.name.size();
+					stream->write(&nameSize, sizeof(nameSize));
+					stream->write(entry.name.data(), nameSize);
+
+					const EncodedResource& encoded = encodedResources[idx++];
+					stream->write(&encoded.size, sizeof(encoded.size));
+					stream->write(encoded.data, encoded.size);
+				}
+
+				stream->close();
+				FileSystem::move(tempPath, path);
+			}
+			else
+				LOGWRN("Unable to write import cache entry to: " + path.toString());
+		}
+
+		for (auto& entry : encodedResources)
+			bs_free(entry.data);
+	}
+
+	void ImportCache::clear()
+	{
+		Lock fileLock = FileScheduler::getLock(mFolder);
+		if (!FileSystem::exists(mFolder))
+			return;
+
+		Vector<Path> files;
+		Vector<Path> directories;
+		FileSystem::getChildren(mFolder, files, directories);
+
+		for (auto& entry : files)
+		{
+			if (entry.getExtension() == ".cache")
+				FileSystem::remove(entry);
+		}
+	}
+
+	Path ImportCache::getEntryPath(const String& key) const
+	{
+		Path path = mFolder;
+		path.append(key + ".cache");
+
+		return path;
+	}
+}
@@ -0,0 +1,71 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Importer/BsSpecificImporter.h"
+
+namespace bs
+{
+	/** @addtogroup Importer-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Cache that stores the serialized results of resource imports, keyed by a hash of the source file contents, the 
+	 * import options and the version of the importer. Allows the Importer to skip running the specific importer when the
+	 * same file is imported again with the same options. Entries are stored on disk, and the cache folder may be shared
+	 * between multiple applications or machines.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT ImportCache : public Module<ImportCache>
+	{
+	public:
+		/** @param[in]	folder	Folder in which to store the cache entries. */
+		ImportCache(const Path& folder);
+
+		/**
+		 * Generates a key identifying the result of importing a file with the provided importer and import options. 
+		 * Returns an empty string if the file cannot be read.
+		 *
+		 * @param[in]	importer		Importer that will be used for importing the file.
+		 * @param[in]	filePath		Path to the file being imported.
+		 * @param[in]	importOptions	Options the file is being imported with.
+		 * @param[in]	importAll		True if all resources in the file are being imported, or false if only the primary
+		 *								resource is being imported.
+		 */
+		String generateKey(const SpecificImporter& importer, const Path& filePath, 
+			const SPtr<const ImportOptions>& importOptions, bool importAll) const;
+
+		/**
+		 * Attempts to find an entry with the specified key and deserialize the resources stored in it. Returns false if
+		 * the entry cannot be found or is not valid.
+		 */
+		bool find(const String& key, Vector<SubResourceRaw>& resources) const;
+
+		/** Serializes the provided resources and stores them in an entry with the specified key. */
+		void store(const String& key, const Vector<SubResourceRaw>& resources);
+
+		/** Removes all entries from the cache. */
+		void clear();
+
+		/** Returns the folder the cache entries are stored in. */
+		const Path& getFolder() const { return mFolder; }
+
+	private:
+		/** Returns the path to the file storing the entry with the specified key. */
+		Path getEntryPath(const String& key) const;
+
+		/**
+		 * Version of the cache entry format. Must be increased whenever the format of the entries changes, in order to
+		 * invalidate any existing entries.
+		 */
+		static constexpr UINT32 CACHE_VERSION = 1;
+
+		Path mFolder;
+	};
+
+	/** @} */
+}
@@ -6,6 +6,9 @@
 #include "Importer/BsSpecificImporter.h"
 #include "Importer/BsShaderIncludeImporter.h"
 #include "Importer/BsImportOptions.h"
+#include "Importer/BsMeshImportOptions.h"
+#include "Importer/BsTextureImportOptions.h"
+#include "Importer/BsImportCache.h"
 #include "Debug/BsDebug.h"
 #include "FileSystem/BsDataStream.h"
 #include "Error/BsException.h"
@@ -13,9 +16,61 @@
 #include "Resources/BsResources.h"
 #include "Threading/BsThreadPool.h"
 #include "Threading/BsTaskScheduler.h"
+#include "Utility/BsTimer.h"
+#include "BsCoreApplication.h"
 
 namespace bs
 {
+	/** Progress callback of the import currently running on this thread, if any. */
+	static BS_THREADLOCAL const ImportProgressCallback* sProgressCallback = nullptr;
+
+	/** Assigns a progress callback to the import running on the current thread, for the lifetime of the object. */
+	struct ScopedProgressCallback
+	{
+		ScopedProgressCallback(const ImportProgressCallback& callback)
+			:mPrevious(sProgressCallback)
+		{
+			sProgressCallback = callback ? &callback : nullptr;
+		}
+
+		~ScopedProgressCallback()
+		{
+			sProgressCallback = mPrevious;
+		}
+
+	private:
+		const ImportProgressCallback* mPrevious;
+	};
+
+	/** State of a batch import started through Importer::importBatchAsync(). */
+	struct Importer::ImportBatch
+	{
+		/** Information about a single file in the batch. */
+		struct File
+		{
+			SpecificImporter* importer;
+			Path filePath;
+			SPtr<const ImportOptions> importOptions;
+			bool importAll;
+			UUID uuid;
+			UINT64 size;
+			AsyncOp op;
+		};
+
+		Vector<File> files;
+		List<UINT32> pending; /**< Files that haven't started importing yet, sorted by import stage. */
+		UnorderedMap<SpecificImporter*, UINT32> numActivePerImporter;
+		ImportStage stage = ImportStage::Source;
+		UINT32 numActive = 0;
+		UINT32 maxActive = 1;
+		bool handle = true;
+
+		ImportBatchProgress progress;
+		ImportBatchProgressCallback onProgress;
+		Timer timer;
+		Mutex mutex;
+	};
+
 	Importer::Importer()
 	{
 		_registerAssetImporter(bs_new<ShaderIncludeImporter>());
@@ -65,7 +120,7 @@ namespace bs
 	}
 
 	AsyncOp Importer::importAsync(const Path& inputFilePath, SPtr<const ImportOptions> importOptions, const UUID& UUID,
-		bool handle)
+		bool handle, const ImportProgressCallback& onProgress)
 	{
 		AsyncOp output;
 
@@ -80,13 +135,15 @@ namespace bs
 		ImporterAsyncMode asyncMode = importer->getAsyncMode();
 		if(asyncMode == ImporterAsyncMode::None)
 		{
+			ScopedProgressCallback progressScope(onProgress);
+
 			HResource resource = import(inputFilePath, importOptions, UUID);
 			output._completeOperation(resource);
 
 			return output;
 		}
 
-		queueForImport(importer, inputFilePath, importOptions, false, UUID, handle, output);
+		queueForImport(importer, inputFilePath, importOptions, false, UUID, handle, output, onProgress);
 		return output;
 	}
 
@@ -104,7 +161,8 @@ namespace bs
 		return output;
 	}
 
-	AsyncOp Importer::importAllAsync(const Path& inputFilePath, SPtr<const ImportOptions> importOptions, bool handle)
+	AsyncOp Importer::importAllAsync(const Path& inputFilePath, SPtr<const ImportOptions> importOptions, bool handle,
+		const ImportProgressCallback& onProgress)
 	{
 		AsyncOp output;
 
@@ -119,13 +177,97 @@ namespace bs
 		ImporterAsyncMode asyncMode = importer->getAsyncMode();
 		if(asyncMode == ImporterAsyncMode::None)
 		{
+			ScopedProgressCallback progressScope(onProgress);
+
 			Vector<SubResource> resources = importAll(inputFilePath, importOptions);
 			output._completeOperation(resources);
 
 			return output;
 		}
 
-		queueForImport(importer, inputFilePath, importOptions, true, UUID::EMPTY, handle, output);
+		queueForImport(importer, inputFilePath, importOptions, true, UUID::EMPTY, handle, output, onProgress);
+		return output;
+	}
+
+	Vector<AsyncOp> Importer::importBatchAsync(const Vector<ImportBatchEntry>& entries, bool handle,
+		const ImportBatchProgressCallback& onProgress, UINT32 maxConcurrentImports)
+	{
+		SPtr<ImportBatch> batch = bs_shared_ptr_new<ImportBatch>();
+		batch->handle = handle;
+		batch->onProgress = onProgress;
+		batch->progress.numFiles = (UINT32)entries.size();
+
+		if (maxConcurrentImports == 0)
+			maxConcurrentImports = TaskScheduler::instance().getNumWorkers();
+
+		batch->maxActive = std::max(maxConcurrentImports, 1U);
+
+		Vector<AsyncOp> output;
+		Vector<UINT32> syncFiles;
+		for (auto& entry : entries)
+		{
+			AsyncOp op;
+			output.push_back(op);
+
+			SPtr<const ImportOptions> importOptions = entry.importOptions;
+			SpecificImporter* importer = prepareForImport(entry.filePath, importOptions);
+			if (!importer)
+			{
+				if (entry.importAll)
+					op._completeOperation(Vector<SubResource>());
+				else
+					op._completeOperation(HResource());
+
+				batch->progress.numImported++;
+				continue;
+			}
+
+			ImportBatch::File file;
+			file.importer = importer;
+			file.filePath = entry.filePath;
+			file.importOptions = importOptions;
+			file.importAll = entry.importAll;
+			file.uuid = entry.uuid;
+			file.size = FileSystem::getFileSize(entry.filePath);
+			file.op = op;
+
+			UINT32 fileIdx = (UINT32)batch->files.size();
+			if (importer->getAsyncMode() == ImporterAsyncMode::None)
+				syncFiles.push_back(fileIdx);
+			else
+				batch->pending.push_back(fileIdx);
+
+			batch->progress.totalBytes += file.size;
+			batch->files.push_back(file);
+		}
+
+		// Stable sort so files within the same stage are imported in the order they were provided in
+		Vector<UINT32> pending(batch->pending.begin(), batch->pending.end());
+		std::stable_sort(pending.begin(), pending.end(), 
+			[&files = batch->files](UINT32 a, UINT32 b)
+		{
+			return files[a].importer->getImportStage() < files[b].importer->getImportStage();
+		});
+
+		batch->pending.assign(pending.begin(), pending.end());
+		batch->timer.reset();
+
+		// Fall back on sync for importers that don't support async import
+		for (auto& fileIdx : syncFiles)
+		{
+			ImportBatch::File& file = batch->files[fileIdx];
+
+			if (file.importAll)
+				file.op._completeOperation(importAll(file.filePath, file.importOptions));
+			else
+				file.op._completeOperation(import(file.filePath, file.importOptions, file.uuid));
+
+			batch->numActive++;
+			batch->numActivePerImporter[file.importer]++;
+			onBatchFileImported(batch, fileIdx);
+		}
+
+		dispatchBatch(batch);
 		return output;
 	}
 
@@ -136,7 +278,7 @@ namespace bs
 			return nullptr;
 
 		waitForAsync(importer);
-		return importer->import(inputFilePath, importOptions);
+		return importCached(importer, inputFilePath, importOptions);
 	}
 
 	Vector<SubResourceRaw> Importer::_importAll(const Path& inputFilePath, SPtr<const ImportOptions> importOptions) const
@@ -146,7 +288,58 @@ namespace bs
 			return Vector<SubResourceRaw>();
 
 		waitForAsync(importer);
-		return importer->importAll(inputFilePath, importOptions);
+		return importAllCached(importer, inputFilePath, importOptions);
+	}
+
+	SPtr<Resource> Importer::importCached(SpecificImporter* importer, const Path& filePath, 
+		const SPtr<const ImportOptions>& importOptions) const
+	{
+		String cacheKey;
+		if (ImportCache::isStarted())
+		{
+			cacheKey = ImportCache::instance().generateKey(*importer, filePath, importOptions, false);
+
+			Vector<SubResourceRaw> cachedResources;
+			if (!cacheKey.empty() && ImportCache::instance().find(cacheKey, cachedResources) && 
+				!cachedResources.empty())
+				return cachedResources[0].value;
+		}
+
+		SPtr<Resource> resource = importer->import(filePath, importOptions);
+
+		if (!cacheKey.empty() && resource != nullptr)
+			ImportCache::instance().store(cacheKey, { { u8"primary", resource } });
+
+		return resource;
+	}
+
+	Vector<SubResourceRaw> Importer::importAllCached(SpecificImporter* importer, const Path& filePath,
+		const SPtr<const ImportOptions>& importOptions) const
+	{
+		String cacheKey;
+		if (ImportCache::isStarted())
+		{
+			cacheKey = ImportCache::instance().generateKey(*importer, filePath, importOptions, true);
+
+			Vector<SubResourceRaw> cachedResources;
+			if (!cacheKey.empty() && ImportCache::instance().find(cacheKey, cachedResources))
+				return cachedResources;
+		}
+
+		Vector<SubResourceRaw> resources = importer->importAll(filePath, importOptions);
+
+		if (!cacheKey.empty() && !resources.empty())
+			ImportCache::instance().store(cacheKey, resources);
+
+		return resources;
+	}
+
+	ImportProgressCallback Importer::_getProgressCallback()
+	{
+		if (sProgressCallback == nullptr)
+			return nullptr;
+
+		return *sProgressCallback;
 	}
 
 	SpecificImporter* Importer::prepareForImport(const Path& filePath, SPtr<const ImportOptions>& importOptions) const
@@ -173,6 +366,31 @@ namespace bs
 			}
 		}
 
+		// Headless applications have no GPU to read resource data back from, so keep a CPU copy of meshes and textures
+		if (gCoreApplication().isHeadless())
+		{
+			if (importOptions->getTypeId() == TID_MeshImportOptions)
+			{
+				auto meshOptions = std::static_pointer_cast<const MeshImportOptions>(importOptions);
+				if (!meshOptions->getCPUCached())
+				{
+					SPtr<MeshImportOptions> cachedOptions = bs_shared_ptr_new<MeshImportOptions>(*meshOptions);
+					cachedOptions->setCPUCached(true);
+					importOptions = cachedOptions;
+				}
+			}
+			else if (importOptions->getTypeId() == TID_TextureImportOptions)
+			{
+				auto textureOptions = std::static_pointer_cast<const TextureImportOptions>(importOptions);
+				if (!textureOptions->getCPUCached())
+				{
+					SPtr<TextureImportOptions> cachedOptions = bs_shared_ptr_new<TextureImportOptions>(*textureOptions);
+					cachedOptions->setCPUCached(true);
+					importOptions = cachedOptions;
+				}
+			}
+		}
+
 		return importer;
 	}
 
@@ -197,7 +415,8 @@ namespace bs
 	}
 
 	void Importer::queueForImport(SpecificImporter* importer, const Path& inputFilePath, 
-		SPtr<const ImportOptions> importOptions, bool importAll, const UUID& uuid, bool handle, AsyncOp& op)
+		SPtr<const ImportOptions> importOptions, bool importAll, const UUID& uuid, bool handle, AsyncOp& op, 
+		const ImportProgressCallback& onProgress, const std::function<void()>& onComplete)
 	{
 		ImporterAsyncMode asyncMode = importer->getAsyncMode();
 
@@ -215,14 +434,17 @@ namespace bs
 				dependency = iterFind->second.task;
 		}
 
-		QueuedOperation queuedOp(importer, inputFilePath, importOptions, importAll, uuid, handle, op);
+		QueuedOperation queuedOp(importer, inputFilePath, importOptions, importAll, uuid, handle, op, onProgress,
+			onComplete);
 		SPtr<Task> task = Task::create("ImportWorker", 
 		[this, taskId, queuedOp] 
 		{ 
+			ScopedProgressCallback progressScope(queuedOp.onProgress);
+
 			AsyncOp op = queuedOp.op;
 			if (queuedOp.importAll)
 			{
-				Vector<SubResourceRaw> rawSubresources = queuedOp.importer->importAll(queuedOp.filePath,
+				Vector<SubResourceRaw> rawSubresources = importAllCached(queuedOp.importer, queuedOp.filePath,
 					queuedOp.importOptions);
 
 				if(queuedOp.handle)
@@ -241,7 +463,7 @@ namespace bs
 			}
 			else
 			{
-				SPtr<Resource> resourcePtr = queuedOp.importer->import(queuedOp.filePath, queuedOp.importOptions);
+				SPtr<Resource> resourcePtr = importCached(queuedOp.importer, queuedOp.filePath, queuedOp.importOptions);
 
 				if(queuedOp.handle)
 				{
@@ -259,16 +481,21 @@ namespace bs
 
 			// Clear itself from the task list so we don't unnecessarily keep a reference. But first make sure we are the
 			// last task by comparing the ids.
-			Lock lock(mLastTaskMutex);
-			auto iterFind = mLastQueuedTask.find(queuedOp.importer);
-			if(iterFind != mLastQueuedTask.end())
 			{
-				if(iterFind->second.id == taskId)
-					mLastQueuedTask.erase(iterFind);
+				Lock lock(mLastTaskMutex);
+				auto iterFind = mLastQueuedTask.find(queuedOp.importer);
+				if(iterFind != mLastQueuedTask.end())
+				{
+					if(iterFind->second.id == taskId)
+						mLastQueuedTask.erase(iterFind);
 
-				mTaskCompleted.notify_one();
+					mTaskCompleted.notify_one();
+				}
 			}
 
+			if(queuedOp.onComplete)
+				queuedOp.onComplete();
+
 		}, TaskPriority::Normal, dependency);
 
 		if(asyncMode == ImporterAsyncMode::Single)
@@ -280,6 +507,84 @@ namespace bs
 		TaskScheduler::instance().addTask(task);
 	}
 
+	void Importer::dispatchBatch(const SPtr<ImportBatch>& batch)
+	{
+		Vector<UINT32> filesToQueue;
+		{
+			Lock lock(batch->mutex);
+
+			auto iter = batch->pending.begin();
+			while (iter != batch->pending.end() && batch->numActive < batch->maxActive)
+			{
+				const ImportBatch::File& file = batch->files[*iter];
+
+				// Files from the next stage can only start once all files from the current stage are done
+				ImportStage stage = file.importer->getImportStage();
+				if (stage != batch->stage)
+				{
+					if (batch->numActive > 0)
+						break;
+
+					batch->stage = stage;
+				}
+
+				UINT32 maxActiveForImporter = 1;
+				if (file.importer->getAsyncMode() == ImporterAsyncMode::Multi)
+					maxActiveForImporter = std::max(file.importer->getMaxConcurrentImports(), 1U);
+
+				UINT32& numActiveForImporter = batch->numActivePerImporter[file.importer];
+				if (numActiveForImporter >= maxActiveForImporter)
+				{
+					++iter;
+					continue;
+				}
+
+				numActiveForImporter++;
+				batch->numActive++;
+
+				filesToQueue.push_back(*iter);
+				iter = batch->pending.erase(iter);
+			}
+		}
+
+		for (auto& fileIdx : filesToQueue)
+		{
+			ImportBatch::File& file = batch->files[fileIdx];
+			queueForImport(file.importer, file.filePath, file.importOptions, file.importAll, file.uuid, batch->handle,
+				file.op, nullptr, [this, batch, fileIdx]() { onBatchFileImported(batch, fileIdx); });
+		}
+	}
+
+	void Importer::onBatchFileImported(const SPtr<ImportBatch>& batch, UINT32 fileIdx)
+	{
+		ImportBatchProgress progress;
+		{
+			Lock lock(batch->mutex);
+
+			const ImportBatch::File& file = batch->files[fileIdx];
+			batch->numActive--;
+			batch->numActivePerImporter[file.importer]--;
+
+			ImportBatchProgress& batchProgress = batch->progress;
+			batchProgress.numImported++;
+			batchProgress.bytesImported += file.size;
+			batchProgress.elapsedTime = batch->timer.getMicroseconds() / 1000000.0f;
+
+			if (batchProgress.elapsedTime > 0.0f)
+			{
+				batchProgress.filesPerSecond = batchProgress.numImported / batchProgress.elapsedTime;
+				batchProgress.bytesPerSecond = batchProgress.bytesImported / batchProgress.elapsedTime;
+			}
+
+			progress = batchProgress;
+		}
+
+		if (batch->onProgress)
+			batch->onProgress(progress);
+
+		dispatchBatch(batch);
+	}
+
 	SPtr<ImportOptions> Importer::createImportOptions(const Path& inputFilePath)
 	{
 		if(!FileSystem::isFile(inputFilePath))
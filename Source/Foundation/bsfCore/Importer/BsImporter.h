@@ -23,6 +23,64 @@ namespace bs
 		HResource value; /**< Contents of the sub-resource. */
 	};
 
+	/** 
+	 * Callback used for reporting progress of a resource import, in range [0, 1]. The callback may be triggered from any 
+	 * thread and therefore must be thread safe. 
+	 */
+	typedef std::function<void(float)> ImportProgressCallback;
+
+	/** Describes a single file to import as a part of a batch import. @see Importer::importBatchAsync */
+	struct ImportBatchEntry
+	{
+		ImportBatchEntry() = default;
+		ImportBatchEntry(const Path& filePath, SPtr<const ImportOptions> importOptions = nullptr, bool importAll = false)
+			:filePath(filePath), importOptions(std::move(importOptions)), importAll(importAll)
+		{ }
+
+		/** Path to the file to import. */
+		Path filePath;
+
+		/** Options controlling the import. If null, default import options for the file type will be used. */
+		SPtr<const ImportOptions> importOptions;
+
+		/** If true, all resources in the file will be imported, same as with Importer::importAll(). */
+		bool importAll = false;
+
+		/** Specific UUID to assign to the imported resource. Only relevant if @p importAll is false. */
+		UUID uuid;
+	};
+
+	/** Reports the progress and throughput of a batch import. @see Importer::importBatchAsync */
+	struct ImportBatchProgress
+	{
+		/** Number of files that finished importing, including the ones that failed to import. */
+		UINT32 numImported = 0;
+
+		/** Total number of files in the batch. */
+		UINT32 numFiles = 0;
+
+		/** Total size of the source files that finished importing, in bytes. */
+		UINT64 bytesImported = 0;
+
+		/** Total size of all source files in the batch, in bytes. */
+		UINT64 totalBytes = 0;
+
+		/** Time since the batch import started, in seconds. */
+		float elapsedTime = 0.0f;
+
+		/** Average number of files imported per second since the batch import started. */
+		float filesPerSecond = 0.0f;
+
+		/** Average number of source file bytes imported per second since the batch import started. */
+		float bytesPerSecond = 0.0f;
+	};
+
+	/** 
+	 * Callback used for reporting progress of a batch import. The callback may be triggered from any thread and therefore
+	 * must be thread safe.
+	 */
+	typedef std::function<void(const ImportBatchProgress&)> ImportBatchProgressCallback;
+
 	/** Module responsible for importing various asset types and converting them to types usable by the engine. */
 	class BS_CORE_EXPORT Importer : public Module<Importer>
 	{
@@ -58,10 +116,11 @@ namespace bs
 		/** 
 		 * Same as import(), except it imports a resource without blocking the main thread. The resulting resource will be
 		 * placed in the returned AsyncOp object when the import ends. If @p handle is true, the returned object will be
-		 * a resource handle, otherwise it will be a SPtr to the resource.
+		 * a resource handle, otherwise it will be a SPtr to the resource. If provided, @p onProgress will be triggered as
+		 * the import progresses, for importers that support progress reporting.
 		 */
 		AsyncOp importAsync(const Path& inputFilePath, SPtr<const ImportOptions> importOptions = nullptr, 
-			const UUID& UUID = UUID::EMPTY, bool handle = true);
+			const UUID& UUID = UUID::EMPTY, bool handle = true, const ImportProgressCallback& onProgress = nullptr);
 
 		/**
 		 * Imports a resource at the specified location, and returns the loaded data. This method returns all imported
@@ -81,10 +140,32 @@ namespace bs
 		/** 
 		 * Same as importAll(), except it imports a resource without blocking the main thread. The returned AsyncOp will
 		 * contain a Vector<SubResource> containing the imported resources, after the import ends. If @p handle is true, 
-		 * the returned object will be a resource handle, otherwise it will be a SPtr to the resource.
+		 * the returned object will be a resource handle, otherwise it will be a SPtr to the resource. If provided,
+		 * @p onProgress will be triggered as the import progresses, for importers that support progress reporting.
 		 */
 		AsyncOp importAllAsync(const Path& inputFilePath, SPtr<const ImportOptions> importOptions = nullptr, 
-			bool handle = true);
+			bool handle = true, const ImportProgressCallback& onProgress = nullptr);
+
+		/**
+		 * Imports a list of files without blocking the calling thread. Files are imported in order of their importer's 
+		 * ImportStage, so resources that other resources depend on are imported first (e.g. shader includes before 
+		 * shaders). Files within the same stage are imported in parallel, limited by @p maxConcurrentImports as well as 
+		 * by the limits of the individual importers (see SpecificImporter::getMaxConcurrentImports). Files whose 
+		 * importers don't support asynchronous import at all are imported on the calling thread, before this method
+		 * returns.
+		 *
+		 * @param[in]	entries					Files to import.
+		 * @param[in]	handle					If true, the returned operations will contain resource handles, otherwise
+		 *										they will contain SPtr to the resources.
+		 * @param[in]	onProgress				Optional callback triggered every time a file finishes importing.
+		 * @param[in]	maxConcurrentImports	Maximum number of files to import at once. If zero, the number of task 
+		 *										scheduler worker threads is used.
+		 * @return								One operation for each entry in @p entries, in the same order. Each 
+		 *										operation will contain the same result as if the file was imported through
+		 *										importAsync() or importAllAsync().
+		 */
+		Vector<AsyncOp> importBatchAsync(const Vector<ImportBatchEntry>& entries, bool handle = true, 
+			const ImportBatchProgressCallback& onProgress = nullptr, UINT32 maxConcurrentImports = 0);
 
 		/**
 		 * Automatically detects the importer needed for the provided file and returns valid type of import options for 
@@ -147,6 +228,13 @@ namespace bs
 		Vector<SubResourceRaw> _importAll(const Path& inputFilePath, 
 			SPtr<const ImportOptions> importOptions = nullptr) const;
 
+		/** 
+		 * Returns the progress callback of the import running on the calling thread, or null if there is none. Meant to be
+		 * called by SpecificImporter implementations at the start of an import, after which the callback can be triggered
+		 * from any thread the import is performed on.
+		 */
+		static ImportProgressCallback _getProgressCallback();
+
 		/** @} */
 	private:
 		/** Information about a single queued import operation. */
@@ -155,9 +243,10 @@ namespace bs
 			QueuedOperation() = default;
 
 			QueuedOperation(SpecificImporter* importer, const Path& filePath, SPtr<const ImportOptions> importOptions, 
-				bool importAll, const UUID& uuid, bool handle, const AsyncOp& op)
+				bool importAll, const UUID& uuid, bool handle, const AsyncOp& op, const ImportProgressCallback& onProgress,
+				const std::function<void()>& onComplete)
 				: importer(importer), filePath(filePath), importOptions(importOptions), importAll(importAll), uuid(uuid)
-				, handle(handle), op(op)
+				, handle(handle), op(op), onProgress(onProgress), onComplete(onComplete)
 			{ }
 
 			SpecificImporter* importer;
@@ -168,8 +257,12 @@ namespace bs
 			bool handle;
 
 			AsyncOp op;
+			ImportProgressCallback onProgress;
+			std::function<void()> onComplete;
 		};
 
+		struct ImportBatch;
+
 		/** 
 		 * Searches available importers and attempts to find one that can import the file of the provided type. Returns null
 		 * if one cannot be found.
@@ -178,10 +271,32 @@ namespace bs
 
 		/** 
 		 * Queues resource for import on a secondary thread. The system will execute the import as soon as possible
-		 * and write the resulting resource to the provided @p op object. 
+		 * and write the resulting resource to the provided @p op object. If provided, @p onComplete is triggered on the
+		 * import thread once the import finishes.
 		 */
 		void queueForImport(SpecificImporter* importer, const Path& inputFilePath, SPtr<const ImportOptions> importOptions, 
-			bool importAll, const UUID& uuid, bool handle, AsyncOp& op);
+			bool importAll, const UUID& uuid, bool handle, AsyncOp& op, const ImportProgressCallback& onProgress,
+			const std::function<void()>& onComplete = nullptr);
+
+		/** 
+		 * Imports the primary resource from the specified file using the provided importer. Returns a previously imported
+		 * result from the ImportCache, if one is available.
+		 */
+		SPtr<Resource> importCached(SpecificImporter* importer, const Path& filePath, 
+			const SPtr<const ImportOptions>& importOptions) const;
+
+		/** 
+		 * Imports all resources from the specified file using the provided importer. Returns a previously imported result
+		 * from the ImportCache, if one is available.
+		 */
+		Vector<SubResourceRaw> importAllCached(SpecificImporter* importer, const Path& filePath,
+			const SPtr<const ImportOptions>& importOptions) const;
+
+		/** Queues as many pending files of the batch for import as its stage and concurrency limits allow. */
+		void dispatchBatch(const SPtr<ImportBatch>& batch);
+
+		/** Updates the progress of the batch after one of its files finished importing, and queues further files. */
+		void onBatchFileImported(const SPtr<ImportBatch>& batch, UINT32 fileIdx);
 
 		/**
 		 * Prepares for import of a file at the specified path. Returns the type of importer the file can be imported with,
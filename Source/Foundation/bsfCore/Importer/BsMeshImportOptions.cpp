@@ -27,8 +27,10 @@ namespace bs
 
 	MeshImportOptions::MeshImportOptions()
 		: mCPUCached(false), mImportNormals(true), mImportTangents(true), mImportBlendShapes(false), mImportSkin(false)
-		, mImportAnimation(false), mReduceKeyFrames(true), mImportRootMotion(false), mImportScale(1.0f)
-		, mCollisionMeshType(CollisionMeshType::None)
+		, mImportAnimation(false), mReduceKeyFrames(true), mImportRootMotion(false)
+		, mCompressAnimation(false), mAnimationCompressionTolerance(0.0005f), mImportScale(1.0f)
+		, mNumLODs(0), mLODVertexRatio(0.5f), mOptimizeVertexCache(true), mOptimizeOverdraw(true)
+		, mOptimizeVertexFetch(true), mCollisionMeshType(CollisionMeshType::None)
 	{ }
 
 	SPtr<MeshImportOptions> MeshImportOptions::create()
@@ -165,6 +165,74 @@ namespace bs
 		 */
 		bool getImportRootMotion() const { return mImportRootMotion; }
 
+		/**
+		 * Enables or disables animation compression. Compressed clips store their curves as evenly spaced samples 
+		 * quantized to 16 bits, dropping samples that can be reconstructed by interpolating their neighbours within the
+		 * tolerance set by setAnimationCompressionTolerance(). This significantly reduces the size of the clip at the cost
+		 * of some precision. Compressed curves cannot be edited.
+		 */
+		void setAnimationCompression(bool enabled) { mCompressAnimation = enabled; }
+
+		/** @copydoc setAnimationCompression */
+		bool getAnimationCompression() const { return mCompressAnimation; }
+
+		/**
+		 * Sets the maximum error allowed when removing animation samples during compression, in units of the animated
+		 * values (e.g. world units for position, quaternion components for rotation). Only relevant if 
+		 * setAnimationCompression() is enabled.
+		 */
+		void setAnimationCompressionTolerance(float tolerance) { mAnimationCompressionTolerance = tolerance; }
+
+		/** @copydoc setAnimationCompressionTolerance */
+		float getAnimationCompressionTolerance() const { return mAnimationCompressionTolerance; }
+
+		/**
+		 * Sets the number of simplified versions of the mesh (levels of detail) to generate on import, in addition to the
+		 * full detail mesh. The renderer switches to a less detailed level as the mesh gets smaller on screen. Zero by
+		 * default, in which case no levels of detail are generated.
+		 */
+		void setNumLODs(UINT32 numLODs) { mNumLODs = numLODs; }
+
+		/** @copydoc setNumLODs */
+		UINT32 getNumLODs() const { return mNumLODs; }
+
+		/**
+		 * Sets the fraction of vertices each generated level of detail keeps compared to the previous level. Also
+		 * determines when the level is used, as level n is used once the mesh covers less than vertexRatio^n of the
+		 * viewport height. Only relevant if setNumLODs() is non-zero.
+		 */
+		void setLODVertexRatio(float ratio) { mLODVertexRatio = ratio; }
+
+		/** @copydoc setLODVertexRatio */
+		float getLODVertexRatio() const { return mLODVertexRatio; }
+
+		/**
+		 * Determines should triangles be reordered so their vertices are re-used from the GPU's post-transform vertex cache
+		 * as often as possible. Reduces the number of vertex shader invocations without changing how the mesh looks.
+		 */
+		void setOptimizeVertexCache(bool enabled) { mOptimizeVertexCache = enabled; }
+
+		/** @copydoc setOptimizeVertexCache */
+		bool getOptimizeVertexCache() const { return mOptimizeVertexCache; }
+
+		/**
+		 * Determines should clusters of triangles be reordered so the ones likely to occlude the rest of the mesh are
+		 * drawn first, reducing overdraw. Retains most of the benefit of setOptimizeVertexCache().
+		 */
+		void setOptimizeOverdraw(bool enabled) { mOptimizeOverdraw = enabled; }
+
+		/** @copydoc setOptimizeOverdraw */
+		bool getOptimizeOverdraw() const { return mOptimizeOverdraw; }
+
+		/**
+		 * Determines should vertices be reordered in the order they are referenced by the triangles, improving memory 
+		 * locality of vertex fetches. Ignored for meshes with morph shapes, as those reference vertices by index.
+		 */
+		void setOptimizeVertexFetch(bool enabled) { mOptimizeVertexFetch = enabled; }
+
+		/** @copydoc setOptimizeVertexFetch */
+		bool getOptimizeVertexFetch() const { return mOptimizeVertexFetch; }
+
 		/** Creates a new import options object that allows you to customize how are meshes imported. */
 		static SPtr<MeshImportOptions> create();
 
@@ -177,7 +245,14 @@ namespace bs
 		bool mImportAnimation;
 		bool mReduceKeyFrames;
 		bool mImportRootMotion;
+		bool mCompressAnimation;
+		float mAnimationCompressionTolerance;
 		float mImportScale;
+		UINT32 mNumLODs;
+		float mLODVertexRatio;
+		bool mOptimizeVertexCache;
+		bool mOptimizeOverdraw;
+		bool mOptimizeVertexFetch;
 		CollisionMeshType mCollisionMeshType;
 		Vector<AnimationSplitInfo> mAnimationSplits;
 		Vector<ImportedAnimationEvents> mAnimationEvents;
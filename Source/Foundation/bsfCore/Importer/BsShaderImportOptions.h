@@ -21,6 +21,14 @@ namespace bs
 		/** Returns a modifiable list of defines that will control shader compilation. */
 		const UnorderedMap<String, String>& getDefines() const { return mDefines; }
 
+		/**
+		 * If true, only the default variation of the shader (one with all variation parameters at their first value) will
+		 * be compiled during import, while other variations will be compiled on demand at runtime, the first time a
+		 * material requests them. Until then the material falls back to the default variation. This reduces the import 
+		 * time and the size of shaders with many variations, at the cost of compiling the used variations at runtime.
+		 */
+		bool compileVariationsOnDemand = false;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
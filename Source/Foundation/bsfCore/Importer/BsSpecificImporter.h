@@ -31,6 +31,20 @@ namespace bs
 		Multi
 	};
 
+	/**
+	 * Determines the order in which files are imported during a batch import. All files of an earlier stage finish 
+	 * importing before files of a later stage start, so resources of later stages can depend on resources of earlier ones.
+	 */
+	enum class ImportStage
+	{
+		/** Resources that other resources are built from, but don't depend on anything themselves (e.g. shader includes). */
+		Source,
+		/** Standalone resources that may be referenced by other resources (e.g. textures, meshes). */
+		Asset,
+		/** Resources that reference other resources (e.g. shaders that reference includes and textures). */
+		Composite
+	};
+
 	/**
 	 * Abstract class that is to be specialized for converting a certain asset type into an engine usable resource
 	 * (for example a .png file into an engine usable texture).
@@ -57,6 +71,21 @@ namespace bs
 		/** Returns the level of asynchronous import supported by this importer. */
 		virtual ImporterAsyncMode getAsyncMode() const { return ImporterAsyncMode::Multi; }
 
+		/** Returns the stage at which files of this importer are imported during a batch import. */
+		virtual ImportStage getImportStage() const { return ImportStage::Asset; }
+
+		/**
+		 * Returns the maximum number of files this importer is allowed to import at once during a batch import. Only
+		 * relevant for importers using ImporterAsyncMode::Multi, as others import a single file at a time.
+		 */
+		virtual UINT32 getMaxConcurrentImports() const { return std::numeric_limits<UINT32>::max(); }
+
+		/**
+		 * Returns the version of the importer. Must be increased whenever a change to the importer changes the resources it
+		 * outputs, in order to invalidate previously cached import results (see ImportCache).
+		 */
+		virtual UINT32 getVersion() const { return 0; }
+
 		/**
 		 * Imports the given file. If file contains more than one resource only the primary resource is imported (for 
 		 * example for an FBX a mesh would be imported, but animations ignored).
@@ -33,6 +33,12 @@ namespace bs
 		/** Sets whether the texture data is also stored in main memory, available for fast CPU access. */
 		void setCPUCached(bool cached) { mCPUCached = cached; }
 
+		/** 
+		 * Sets whether the texture's mip levels should be streamed to the GPU on demand, instead of all being uploaded on
+		 * load. See TU_STREAMED. Only relevant if the texture has mipmaps.
+		 */
+		void setStreamed(bool streamed) { mStreamed = streamed; }
+
 		/** 
 		 * Sets whether the texture data should be treated as if its in sRGB (gamma) space. Such texture will be converted 
 		 * by hardware to linear space before use on the GPU.
@@ -54,6 +60,9 @@ namespace bs
 		/** Retrieves whether the texture data is also stored in main memory, available for fast CPU access. */
 		bool getCPUCached() const { return mCPUCached; }
 
+		/** Retrieves whether the texture's mip levels should be streamed to the GPU on demand. */
+		bool getStreamed() const { return mStreamed; }
+
 		/**
 		 * Retrieves whether the texture data should be treated as if its in sRGB (gamma) space. Such texture will be 
 		 * converted by hardware to linear space before use on the GPU.
@@ -100,6 +109,7 @@ namespace bs
 		bool mSRGB;
 		bool mCubemap;
 		CubemapSourceType mCubemapSourceType;
+		bool mStreamed;
 	};
 
 	/** @} */
@@ -107,6 +107,7 @@ namespace bs
 
 		mPointerDelta = Vector2I::ZERO; // Reset delta in case we don't receive any mouse input this frame
 		mPointerDoubleClicked = false;
+		mRawMouseMotion.clear();
 
 		// Capture raw input
 		if (mMouse != nullptr)
@@ -185,10 +186,13 @@ namespace bs
 			event.type = PointerEventType::CursorMoved;
 			event.screenPos = pointerPos;
 
+			// All OS cursor movement since the last frame is coalesced into this single event
+			if (mLastPositionSet)
+				event.delta = event.screenPos - mLastPointerPosition;
+
 			onPointerMoved(event);
 
-			if (mLastPositionSet)
-				mPointerDelta = event.screenPos - mLastPointerPosition;
+			mPointerDelta = event.delta;
 
 			mLastPointerPosition = event.screenPos;
 			mLastPositionSet = true;
@@ -311,6 +315,16 @@ namespace bs
 		axisMoved(0, (float)relZ, (UINT32)InputAxis::MouseZ);
 	}
 
+	void Input::_notifyMouseMotionSample(float relX, float relY, UINT64 timestamp)
+	{
+		RawMouseMotion motion;
+		motion.deltaX = relX;
+		motion.deltaY = relY;
+		motion.timestamp = timestamp - mTimestampClockOffset;
+
+		mRawMouseMotion.push_back(motion);
+	}
+
 	void Input::_notifyAxisMoved(UINT32 gamepadIdx, UINT32 axisIdx, INT32 value)
 	{
 		// Move axis values into [-1.0f, 1.0f] range
@@ -591,6 +605,14 @@ namespace bs
 		mMouseSmoothingEnabled = enable;
 	}
 
+	void Input::setRawMouseMotionEnabled(bool enabled)
+	{
+		mRawMouseMotionEnabled = enabled;
+
+		if (!enabled)
+			mRawMouseMotion.clear();
+	}
+
 	float Input::smoothMouse(float value, UINT32 idx)
 	{
 		UINT32 sampleCount = 1;
@@ -103,6 +103,23 @@ namespace bs
 		/** Returns difference between pointer position between current and last frame. */
 		Vector2I getPointerDelta() const { return mPointerDelta; }
 
+		/**
+		 * Returns every relative movement reported by the mouse during the last frame, in the order they were received.
+		 * Unlike the mouse axes, which report the movement once per frame, this preserves the full polling rate of the
+		 * device, for uses like aiming that want to process each movement individually. Only populated if enabled
+		 * through setRawMouseMotionEnabled().
+		 */
+		const Vector<RawMouseMotion>& getRawMouseMotion() const { return mRawMouseMotion; }
+
+		/**
+		 * Determines if individual relative mouse movements should be recorded and made available through
+		 * getRawMouseMotion(). Disabled by default.
+		 */
+		void setRawMouseMotionEnabled(bool enabled);
+
+		/** @copydoc setRawMouseMotionEnabled */
+		bool getRawMouseMotionEnabled() const { return mRawMouseMotionEnabled; }
+
 		/**
 		 * Query if the provided pointer button is currently being held (this frame or previous frames).
 		 *
@@ -137,29 +154,32 @@ namespace bs
 		String getDeviceName(InputDevice type, UINT32 idx);
 
 		/** Triggered whenever a button is first pressed. */
-		Event<void(const ButtonEvent&)> onButtonDown;
+		EventST<void(const ButtonEvent&)> onButtonDown;
 
 		/**	Triggered whenever a button is first released. */
-		Event<void(const ButtonEvent&)> onButtonUp;
+		EventST<void(const ButtonEvent&)> onButtonUp;
 
 		/**	Triggered whenever user inputs a text character. */
-		Event<void(const TextInputEvent&)> onCharInput;
+		EventST<void(const TextInputEvent&)> onCharInput;
 
-		/**	Triggers when some pointing device (mouse cursor, touch) moves. */
-		Event<void(const PointerEvent&)> onPointerMoved;
+		/**
+		 * Triggers when some pointing device (mouse cursor, touch) moves. Triggered at most once per frame, reporting
+		 * the latest position and the total movement since the last event.
+		 */
+		EventST<void(const PointerEvent&)> onPointerMoved;
 
 		/**	Triggers when some pointing device (mouse cursor, touch) button is pressed. */
-		Event<void(const PointerEvent&)> onPointerPressed;
+		EventST<void(const PointerEvent&)> onPointerPressed;
 
 		/**	Triggers when some pointing device (mouse cursor, touch) button is released. */
-		Event<void(const PointerEvent&)> onPointerReleased;
+		EventST<void(const PointerEvent&)> onPointerReleased;
 
 		/**	Triggers when some pointing device (mouse cursor, touch) button is double clicked. */
-		Event<void(const PointerEvent&)> onPointerDoubleClick;
+		EventST<void(const PointerEvent&)> onPointerDoubleClick;
 
 		// TODO Low priority: Remove this, I can emulate it using virtual input
 		/**	Triggers on special input commands. */
-		Event<void(InputCommandType)> onInputCommand;
+		EventST<void(InputCommandType)> onInputCommand;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
@@ -184,6 +204,12 @@ namespace bs
 		/** Called by Mouse when mouse movement is detected. */
 		void _notifyMouseMoved(INT32 relX, INT32 relY, INT32 relZ);
 
+		/**
+		 * Called by Mouse for every individual movement reported by the device, if raw mouse motion is enabled. Called
+		 * before _notifyMouseMoved() reports the accumulated movement for the frame.
+		 */
+		void _notifyMouseMotionSample(float relX, float relY, UINT64 timestamp);
+
 		/** Called by any of the raw input devices when analog axis movement is detected. */
 		void _notifyAxisMoved(UINT32 gamepadIdx, UINT32 axisIdx, INT32 value);
 
@@ -316,8 +342,11 @@ namespace bs
 
 		// Raw input
 		bool mMouseSmoothingEnabled;
+		bool mRawMouseMotionEnabled = false;
 		UINT64 mWindowHandle;
 
+		Vector<RawMouseMotion> mRawMouseMotion;
+
 		Mouse* mMouse;
 		Keyboard* mKeyboard;
 		Vector<Gamepad*> mGamepads;
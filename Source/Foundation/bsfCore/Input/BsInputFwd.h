@@ -346,6 +346,17 @@ namespace bs
 		mutable bool mIsUsed;
 	};
 
+	/**
+	 * A single relative movement reported by the mouse device, before any acceleration or smoothing is applied. Mice
+	 * report movement at their own polling rate, often many times per frame.
+	 */
+	struct RawMouseMotion
+	{
+		float deltaX = 0.0f; /**< Movement along the horizontal axis, in device units. */
+		float deltaY = 0.0f; /**< Movement along the vertical axis, in device units. */
+		UINT64 timestamp = 0; /**< Timestamp in ticks when the movement was reported. */
+	};
+
 	/**	Types of special input commands. */
 	enum class InputCommandType
 	{
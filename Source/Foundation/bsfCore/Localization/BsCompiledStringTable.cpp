@@ -0,0 +1,243 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Localization/BsCompiledStringTable.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	CompiledStringTable::CompiledStringTable(const Path& folder)
+		:mFolder(folder), mActiveLanguage(Language::Count)
+	{
+		openLanguage(StringTable::DEFAULT_LANGUAGE, mDefaultFile);
+	}
+
+	void CompiledStringTable::setActiveLanguage(Language language)
+	{
+		if (language == mActiveLanguage)
+			return;
+
+		mActiveLanguage = language;
+		mLoadedStrings.clear();
+
+		// Default language is always open, as a fallback
+		if (language == StringTable::DEFAULT_LANGUAGE)
+			mActiveFile = LanguageFile();
+		else
+			openLanguage(language, mActiveFile);
+	}
+
+	bool CompiledStringTable::contains(LocalizedStringID id) const
+	{
+		const LanguageFile* file;
+		return find(id, &file) != nullptr;
+	}
+
+	String CompiledStringTable::getString(LocalizedStringID id) const
+	{
+		const LanguageFile* file;
+		const FileEntry* entry = find(id, &file);
+		if (entry == nullptr)
+			return StringUtil::BLANK;
+
+		return String(file->chars + entry->charOffset, entry->numChars);
+	}
+
+	SPtr<LocalizedStringData> CompiledStringTable::getStringData(LocalizedStringID id)
+	{
+		auto iterFind = mLoadedStrings.find(id.value);
+		if (iterFind != mLoadedStrings.end())
+			return iterFind->second;
+
+		const LanguageFile* file;
+		const FileEntry* entry = find(id, &file);
+		if (entry == nullptr)
+			return nullptr;
+
+		SPtr<LocalizedStringData> stringData = bs_shared_ptr_new<LocalizedStringData>();
+		stringData->string.assign(file->chars + entry->charOffset, entry->numChars);
+		stringData->numParameters = entry->numParameters;
+		stringData->parameterOffsets = bs_newN<LocalizedStringData::ParamOffset>(entry->numParameters);
+
+		for (UINT32 i = 0; i < entry->numParameters; i++)
+			stringData->parameterOffsets[i] = file->parameters[entry->parameterOffset + i];
+
+		mLoadedStrings[id.value] = stringData;
+		return stringData;
+	}
+
+	const CompiledStringTable::FileEntry* CompiledStringTable::find(LocalizedStringID id,
+		const LanguageFile** file) const
+	{
+		for (auto& entry : { &mActiveFile, &mDefaultFile })
+		{
+			const UINT64* idsEnd = entry->ids + entry->numStrings;
+			const UINT64* iterFind = std::lower_bound(entry->ids, idsEnd, id.value);
+			if (iterFind != idsEnd && *iterFind == id.value)
+			{
+				*file = entry;
+				return &entry->entries[iterFind - entry->ids];
+			}
+		}
+
+		return nullptr;
+	}
+
+	void CompiledStringTable::openLanguage(Language language, LanguageFile& file) const
+	{
+		file = LanguageFile();
+
+		Path path = getLanguagePath(mFolder, language);
+		if (!FileSystem::isFile(path))
+			return;
+
+		SPtr<DataStream> stream = FileSystem::openFileMapped(path);
+		if (!stream->isMemoryMapped())
+			stream = bs_shared_ptr_new<MemoryDataStream>(stream);
+
+		const UINT8* data = static_cast<MemoryDataStream&>(*stream).getPtr();
+		size_t size = stream->size();
+
+		FileHeader header;
+		if (size < sizeof(header))
+		{
+			LOGERR("Invalid compiled string table file: " + path.toString());
+			return;
+		}
+
+		memcpy(&header, data, sizeof(header));
+
+		UINT64 expectedSize = sizeof(header) + (UINT64)header.numStrings * (sizeof(UINT64) + sizeof(FileEntry)) +
+			(UINT64)header.numParameters * sizeof(LocalizedStringData::ParamOffset) + header.numChars;
+
+		if (header.magic != FILE_MAGIC || header.version != FILE_VERSION || size < expectedSize)
+		{
+			LOGERR("Invalid compiled string table file: " + path.toString());
+			return;
+		}
+
+		const UINT8* ptr = data + sizeof(header);
+		const UINT64* ids = (const UINT64*)ptr;
+		ptr += header.numStrings * sizeof(UINT64);
+
+		const FileEntry* entries = (const FileEntry*)ptr;
+		ptr += header.numStrings * sizeof(FileEntry);
+
+		// Make sure no entry references data outside of the file, so lookups don't need to check
+		for (UINT32 i = 0; i < header.numStrings; i++)
+		{
+			const FileEntry& entry = entries[i];
+			if ((UINT64)entry.charOffset + entry.numChars > header.numChars ||
+				(UINT64)entry.parameterOffset + entry.numParameters > header.numParameters)
+			{
+				LOGERR("Invalid compiled string table file: " + path.toString());
+				return;
+			}
+		}
+
+		file.ids = ids;
+		file.entries = entries;
+
+		file.parameters = (const LocalizedStringData::ParamOffset*)ptr;
+		ptr += header.numParameters * sizeof(LocalizedStringData::ParamOffset);
+
+		file.chars = (const char*)ptr;
+		file.numStrings = header.numStrings;
+		file.stream = stream;
+	}
+
+	bool CompiledStringTable::compile(const StringTable& table, const Path& folder)
+	{
+		FileSystem::createDir(folder);
+
+		for (UINT32 i = 0; i < (UINT32)Language::Count; i++)
+		{
+			Path path = getLanguagePath(folder, (Language)i);
+
+			const LanguageData& languageData = table.mAllLanguages[i];
+			if (languageData.strings.empty())
+			{
+				// Remove strings left over from a previous compile
+				if (FileSystem::exists(path))
+					FileSystem::remove(path);
+
+				continue;
+			}
+
+			Vector<std::pair<UINT64, const UnorderedMap<String, SPtr<LocalizedStringData>>::value_type*>> sortedStrings;
+			sortedStrings.reserve(languageData.strings.size());
+
+			for (auto& entry : languageData.strings)
+				sortedStrings.push_back(std::make_pair(LocalizedStringID(entry.first).value, &entry));
+
+			std::sort(sortedStrings.begin(), sortedStrings.end(),
+				[](const auto& a, const auto& b) { return a.first < b.first; });
+
+			for (size_t j = 1; j < sortedStrings.size(); j++)
+			{
+				if (sortedStrings[j].first == sortedStrings[j - 1].first)
+				{
+					LOGERR("Cannot compile string table, identifiers \"" + sortedStrings[j - 1].second->first +
+						"\" and \"" + sortedStrings[j].second->first + "\" have the same hash.");
+					return false;
+				}
+			}
+
+			Vector<UINT64> ids;
+			Vector<FileEntry> entries;
+			Vector<LocalizedStringData::ParamOffset> parameters;
+			String chars;
+
+			ids.reserve(sortedStrings.size());
+			entries.reserve(sortedStrings.size());
+
+			for (auto& entry : sortedStrings)
+			{
+				const LocalizedStringData& stringData = *entry.second->second;
+
+				FileEntry fileEntry;
+				fileEntry.charOffset = (UINT32)chars.size();
+				fileEntry.numChars = (UINT32)stringData.string.size();
+				fileEntry.parameterOffset = (UINT32)parameters.size();
+				fileEntry.numParameters = stringData.numParameters;
+
+				ids.push_back(entry.first);
+				entries.push_back(fileEntry);
+
+				chars += stringData.string;
+				for (UINT32 k = 0; k < stringData.numParameters; k++)
+					parameters.push_back(stringData.parameterOffsets[k]);
+			}
+
+			FileHeader header;
+			header.magic = FILE_MAGIC;
+			header.version = FILE_VERSION;
+			header.numStrings = (UINT32)ids.size();
+			header.numParameters = (UINT32)parameters.size();
+			header.numChars = (UINT32)chars.size();
+			header.padding = 0;
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			if (stream == nullptr)
+			{
+				LOGERR("Cannot compile string table, unable to write to: " + path.toString());
+				return false;
+			}
+
+			stream->write(&header, sizeof(header));
+			stream->write(ids.data(), ids.size() * sizeof(UINT64));
+			stream->write(entries.data(), entries.size() * sizeof(FileEntry));
+			stream->write(parameters.data(), parameters.size() * sizeof(LocalizedStringData::ParamOffset));
+			stream->write(chars.data(), chars.size());
+			stream->close();
+		}
+
+		return true;
+	}
+
+	Path CompiledStringTable::getLanguagePath(const Path& folder, Language language)
+	{
+		return folder + Path("Language" + toString((UINT32)language) + ".strings");
+	}
+}
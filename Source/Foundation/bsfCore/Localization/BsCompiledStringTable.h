@@ -0,0 +1,118 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Localization/BsStringTable.h"
+#include "FileSystem/BsPath.h"
+
+namespace bs
+{
+	/** @addtogroup Localization
+	 *  @{
+	 */
+
+	/**
+	 * Read-only string table built from a StringTable by compile(), intended for shipping large amounts of localized
+	 * text. Each language is stored in a separate file containing a sorted index of hashed string identifiers, followed
+	 * by the UTF-8 text of all strings. Only the files for the active and the default language are opened, and they are
+	 * memory mapped, so opening them costs neither parsing nor copying. Strings are looked up by LocalizedStringID
+	 * using a binary search of the index, and converted into LocalizedStringData the first time they are requested.
+	 *
+	 * Identifier strings themselves are not stored. Use BS_LOCALIZED_ID to calculate the identifiers at compile time.
+	 */
+	class BS_CORE_EXPORT CompiledStringTable
+	{
+	public:
+		/**
+		 * Creates a table reading the compiled language files from the provided folder. No files are opened until an
+		 * active language is set.
+		 */
+		CompiledStringTable(const Path& folder);
+
+		/**
+		 * Determines the active language. Opens the file of the new language and releases the file of the previous one.
+		 * Strings missing from the active language are looked up in StringTable::DEFAULT_LANGUAGE.
+		 */
+		void setActiveLanguage(Language language);
+
+		/** @copydoc setActiveLanguage */
+		Language getActiveLanguage() const { return mActiveLanguage; }
+
+		/** Checks does the table contain the provided string, in either the active or the default language. */
+		bool contains(LocalizedStringID id) const;
+
+		/** Returns the text of the provided string in the active language, or an empty string if it doesn't exist. */
+		String getString(LocalizedStringID id) const;
+
+		/**
+		 * Returns the data of the provided string in the active language, or null if it doesn't exist. The data is kept
+		 * around so subsequent requests for the same string return the same object, until the active language changes.
+		 */
+		SPtr<LocalizedStringData> getStringData(LocalizedStringID id);
+
+		/**
+		 * Writes the strings of all languages in the provided string table into the compiled format, one file per
+		 * language.
+		 *
+		 * @param[in]	table		String table to compile.
+		 * @param[in]	folder		Folder to write the language files to. Created if it doesn't exist.
+		 * @return					True if the table was written. Fails if two identifiers hash to the same value, in
+		 *							which case one of them needs to be renamed.
+		 */
+		static bool compile(const StringTable& table, const Path& folder);
+
+		/** Returns the path of the file containing the strings of the specified language. */
+		static Path getLanguagePath(const Path& folder, Language language);
+
+	private:
+		/** Header at the start of every compiled language file. */
+		struct FileHeader
+		{
+			UINT32 magic;
+			UINT32 version;
+			UINT32 numStrings;
+			UINT32 numParameters;
+			UINT32 numChars;
+			UINT32 padding;
+		};
+
+		/** Location of a single string in a compiled language file. */
+		struct FileEntry
+		{
+			UINT32 charOffset;
+			UINT32 numChars;
+			UINT32 parameterOffset;
+			UINT32 numParameters;
+		};
+
+		/** Contents of a single opened language file, pointing directly into its memory. */
+		struct LanguageFile
+		{
+			SPtr<DataStream> stream;
+			const UINT64* ids = nullptr;
+			const FileEntry* entries = nullptr;
+			const LocalizedStringData::ParamOffset* parameters = nullptr;
+			const char* chars = nullptr;
+			UINT32 numStrings = 0;
+		};
+
+		/** Maps the file of the specified language into memory. Leaves @p file empty on failure. */
+		void openLanguage(Language language, LanguageFile& file) const;
+
+		/** Finds the provided string in the active or default language. Returns null if not found. */
+		const FileEntry* find(LocalizedStringID id, const LanguageFile** file) const;
+
+		static constexpr UINT32 FILE_MAGIC = 0x4C545342; // "BSTL"
+		static constexpr UINT32 FILE_VERSION = 1;
+
+		Path mFolder;
+		Language mActiveLanguage;
+
+		LanguageFile mActiveFile;
+		LanguageFile mDefaultFile;
+		UnorderedMap<UINT64, SPtr<LocalizedStringData>> mLoadedStrings;
+	};
+
+	/** @} */
+}
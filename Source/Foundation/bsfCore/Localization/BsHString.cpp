@@ -36,7 +36,14 @@ namespace bs
 			mParameters = bs_newN<String>(mStringData->numParameters);
 	}
 
+	HString::HString(LocalizedStringID id, UINT32 stringTableId)
+		:mParameters(nullptr), mId(id), mStringTableId(stringTableId), mIsDirty(true), mStringPtr(nullptr)
+	{
+		resolveCompiled();
+	}
+
 	HString::HString(const HString& copy)
+		:mId(copy.mId), mStringTableId(copy.mStringTableId), mLanguageVersion(copy.mLanguageVersion)
 	{
 		mStringData = copy.mStringData;
 		mIsDirty = copy.mIsDirty;
@@ -82,6 +89,9 @@ namespace bs
 		mStringData = rhs.mStringData;
 		mIsDirty = rhs.mIsDirty;
 		mCachedString = rhs.mCachedString;
+		mId = rhs.mId;
+		mStringTableId = rhs.mStringTableId;
+		mLanguageVersion = rhs.mLanguageVersion;
 
 		if (rhs.mStringData->numParameters > 0)
 		{
@@ -105,6 +115,9 @@ namespace bs
 
 	const String& HString::getValue() const
 	{
+		if (mId.value != 0 && mLanguageVersion != StringTableManager::instance()._getLanguageVersion())
+			resolveCompiled();
+
 		if (mIsDirty)
 		{
 			if (mParameters != nullptr)
@@ -132,6 +145,38 @@ namespace bs
 		mIsDirty = true;
 	}
 
+	void HString::resolveCompiled() const
+	{
+		StringTableManager& stringTableManager = StringTableManager::instance();
+
+		SPtr<LocalizedStringData> stringData = stringTableManager._getStringData(mStringTableId, mId);
+		UINT32 oldNumParameters = mStringData != nullptr ? mStringData->numParameters : 0;
+		UINT32 newNumParameters = stringData->numParameters;
+
+		// Translations should have the same number of parameters, but don't rely on it
+		if (oldNumParameters != newNumParameters)
+		{
+			String* parameters = nullptr;
+			if (newNumParameters > 0)
+			{
+				parameters = bs_newN<String>(newNumParameters);
+
+				UINT32 numToCopy = std::min(oldNumParameters, newNumParameters);
+				for (UINT32 i = 0; i < numToCopy; i++)
+					parameters[i] = mParameters[i];
+			}
+
+			if (mParameters != nullptr)
+				bs_deleteN(mParameters, oldNumParameters);
+
+			mParameters = parameters;
+		}
+
+		mStringData = stringData;
+		mLanguageVersion = stringTableManager._getLanguageVersion();
+		mIsDirty = true;
+	}
+
 	const HString& HString::dummy()
 	{
 		static HString dummyVal;
@@ -8,6 +8,48 @@ namespace bs
 	 *  @{
 	 */
 
+	/**
+	 * Identifies a localized string in a CompiledStringTable by a hash of its identifier, avoiding the need to store or
+	 * compare identifier strings at runtime. Use BS_LOCALIZED_ID to calculate the hash at compile time.
+	 */
+	struct LocalizedStringID
+	{
+		constexpr LocalizedStringID() = default;
+
+		/** Constructs the identifier from a hash calculated by hash(). */
+		constexpr explicit LocalizedStringID(UINT64 value)
+			:value(value)
+		{ }
+
+		/** Constructs the identifier by hashing the provided string identifier. */
+		explicit LocalizedStringID(const String& identifier)
+			:value(hash(identifier.c_str()))
+		{ }
+
+		/** Calculates a hash of the provided null-terminated string identifier. Can be evaluated at compile time. */
+		static constexpr UINT64 hash(const char* identifier)
+		{
+			// 64-bit FNV-1a
+			UINT64 value = 14695981039346656037ULL;
+			while (*identifier != '\0')
+			{
+				value ^= (UINT8)*identifier++;
+				value *= 1099511628211ULL;
+			}
+
+			return value;
+		}
+
+		bool operator==(const LocalizedStringID& rhs) const { return value == rhs.value; }
+		bool operator!=(const LocalizedStringID& rhs) const { return value != rhs.value; }
+
+		UINT64 value = 0;
+	};
+
+	/** Constructs a LocalizedStringID from a string literal, hashing it at compile time. */
+#define BS_LOCALIZED_ID(identifier) bs::LocalizedStringID( \
+	std::integral_constant<bs::UINT64, bs::LocalizedStringID::hash(identifier)>::value)
+
 	/**
 	 * String handle. Provides a wrapper around an Unicode string, primarily for localization purposes.
 	 * 			
@@ -39,6 +81,16 @@ namespace bs
 		 */
 		explicit HString(const String& identifier, const String& defaultString, UINT32 stringTableId = 0);
 
+		/**
+		 * Creates a new localized string referencing a string in a compiled string table. Unlike other localized
+		 * strings, the value follows the active language, and is looked up again whenever it changes.
+		 *
+		 * @param[in]	id				Hashed identifier of the string, usually created through BS_LOCALIZED_ID.
+		 * @param[in]	stringTableId	Unique identifier of the compiled string table to retrieve the string from. See
+		 *								StringTableManager::setCompiledTable().
+		 */
+		explicit HString(LocalizedStringID id, UINT32 stringTableId = 0);
+
 		/**
 		 * Creates a new empty localized string.
 		 *
@@ -64,8 +116,18 @@ namespace bs
 		/** Returns an empty string. */
 		static const HString& dummy();
 	private:
-		SPtr<LocalizedStringData> mStringData;
-		String* mParameters;
+		/**
+		 * Looks up the string data for the compiled string identifier in the currently active language. Parameters are
+		 * preserved, as long as the new string data has room for them.
+		 */
+		void resolveCompiled() const;
+
+		mutable SPtr<LocalizedStringData> mStringData;
+		mutable String* mParameters;
+
+		LocalizedStringID mId;
+		UINT32 mStringTableId = 0;
+		mutable UINT32 mLanguageVersion = 0;
 
 		mutable bool mIsDirty;
 		mutable String mCachedString;
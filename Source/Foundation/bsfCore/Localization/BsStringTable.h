@@ -334,6 +334,7 @@ namespace bs
 	private:
 		friend class HString;
 		friend class StringTableManager;
+		friend class CompiledStringTable;
 
 		/** Gets the currently active language. */
 		Language getActiveLanguage() const { return mActiveLanguage; }
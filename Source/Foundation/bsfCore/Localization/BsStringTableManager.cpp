@@ -1,13 +1,14 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Localization/BsStringTableManager.h"
+#include "Localization/BsCompiledStringTable.h"
 
 namespace bs
 {
 	StringTableManager::StringTableManager()
 		:mActiveLanguage(StringTable::DEFAULT_LANGUAGE)
 	{
-
+		mMissingStringData = bs_shared_ptr_new<LocalizedStringData>();
 	}
 
 	void StringTableManager::setActiveLanguage(Language language)
@@ -18,6 +19,11 @@ namespace bs
 
 			for (auto& tablePair : mTables)
 				tablePair.second->setActiveLanguage(language);
+
+			for (auto& tablePair : mCompiledTables)
+				tablePair.second->setActiveLanguage(language);
+
+			mLanguageVersion++;
 		}
 	}
 
@@ -46,6 +52,43 @@ namespace bs
 			table->setActiveLanguage(mActiveLanguage);
 	}
 
+	void StringTableManager::setCompiledTable(UINT32 id, const Path& folder)
+	{
+		SPtr<CompiledStringTable> table = bs_shared_ptr_new<CompiledStringTable>(folder);
+		table->setActiveLanguage(mActiveLanguage);
+
+		mCompiledTables[id] = table;
+		mLanguageVersion++;
+	}
+
+	SPtr<CompiledStringTable> StringTableManager::getCompiledTable(UINT32 id) const
+	{
+		auto iterFind = mCompiledTables.find(id);
+		if (iterFind != mCompiledTables.end())
+			return iterFind->second;
+
+		return nullptr;
+	}
+
+	void StringTableManager::removeCompiledTable(UINT32 id)
+	{
+		if (mCompiledTables.erase(id) > 0)
+			mLanguageVersion++;
+	}
+
+	SPtr<LocalizedStringData> StringTableManager::_getStringData(UINT32 tableId, LocalizedStringID id)
+	{
+		auto iterFind = mCompiledTables.find(tableId);
+		if (iterFind == mCompiledTables.end())
+			return mMissingStringData;
+
+		SPtr<LocalizedStringData> stringData = iterFind->second->getStringData(id);
+		if (stringData == nullptr)
+			return mMissingStringData;
+
+		return stringData;
+	}
+
 	StringTableManager& gStringTableManager()
 	{
 		return StringTableManager::instance();
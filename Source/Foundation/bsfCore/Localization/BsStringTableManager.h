@@ -55,9 +55,44 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		void setTable(UINT32 id, const HStringTable& table);
 
+		/**
+		 * Registers a compiled string table, or replaces an old one at the specified id. Compiled tables are separate
+		 * from normal string tables and are referenced by HString%s created from a LocalizedStringID.
+		 *
+		 * @param[in]	id		Identifier of the string table.
+		 * @param[in]	folder	Folder containing the language files written by CompiledStringTable::compile().
+		 */
+		void setCompiledTable(UINT32 id, const Path& folder);
+
+		/** Returns the compiled string table with the specified id, or null if one isn't registered. */
+		SPtr<CompiledStringTable> getCompiledTable(UINT32 id) const;
+
+		/** Removes the compiled string table with the specified id. */
+		void removeCompiledTable(UINT32 id);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Returns data for the string in the compiled table with the specified id, in the active language. Returns data
+		 * containing an empty string if the table or the string doesn't exist.
+		 */
+		SPtr<LocalizedStringData> _getStringData(UINT32 tableId, LocalizedStringID id);
+
+		/**
+		 * Returns a counter incremented whenever the active language or the compiled tables change, signaling that
+		 * localized strings need to be looked up again.
+		 */
+		UINT32 _getLanguageVersion() const { return mLanguageVersion; }
+
+		/** @} */
 	private:
 		Language mActiveLanguage;
 		UnorderedMap<UINT32, HStringTable> mTables;
+		UnorderedMap<UINT32, SPtr<CompiledStringTable>> mCompiledTables;
+		SPtr<LocalizedStringData> mMissingStringData;
+		UINT32 mLanguageVersion = 0;
 	};
 
 	/** Provides easier access to StringTableManager. */
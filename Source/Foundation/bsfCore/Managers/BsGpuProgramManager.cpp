@@ -2,6 +2,9 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Managers/BsGpuProgramManager.h"
 #include "RenderAPI/BsRenderAPI.h"
+#include "Material/BsShaderCompileCache.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
@@ -146,7 +149,40 @@ namespace bs
 	SPtr<GpuProgramBytecode> GpuProgramManager::compileBytecode(const GPU_PROGRAM_DESC& desc)
 	{
 		GpuProgramFactory* factory = getFactory(desc.language);
-		return factory->compileBytecode(desc);
+
+		String cacheKey;
+		const String compilerVersion = factory->getCompilerVersion();
+		if (!compilerVersion.empty() && ShaderCompileCache::isStarted())
+		{
+			cacheKey = ShaderCompileCache::generateKey({ compilerVersion, desc.language, toString((UINT32)desc.type),
+				desc.entryPoint, toString(desc.requiresAdjacency), desc.source });
+
+			SPtr<MemoryDataStream> cachedData = ShaderCompileCache::instance().find(cacheKey);
+			if (cachedData != nullptr)
+			{
+				MemorySerializer serializer;
+				SPtr<IReflectable> cachedBytecode = serializer.decode(cachedData->getPtr(), (UINT32)cachedData->size());
+
+				if (cachedBytecode != nullptr && cachedBytecode->isDerivedFrom(GpuProgramBytecode::getRTTIStatic()))
+					return std::static_pointer_cast<GpuProgramBytecode>(cachedBytecode);
+			}
+		}
+
+		SPtr<GpuProgramBytecode> bytecode = factory->compileBytecode(desc);
+
+		// Only cache successful compilations, so that the errors are reported every time
+		if (!cacheKey.empty() && bytecode != nullptr && bytecode->instructions.size > 0)
+		{
+			MemorySerializer serializer;
+
+			UINT32 size = 0;
+			UINT8* data = serializer.encode(bytecode.get(), size);
+			ShaderCompileCache::instance().store(cacheKey, data, size);
+
+			bs_free(data);
+		}
+
+		return bytecode;
 	}
 	}
 }
@@ -49,6 +49,13 @@ namespace bs
 
 		/** @copydoc GpuProgram::compileBytecode */
 		virtual SPtr<GpuProgramBytecode> compileBytecode(const GPU_PROGRAM_DESC& desc) = 0;
+
+		/**
+		 * Returns a string identifying the compiler and any options used by compileBytecode(). Bytecode is only cached
+		 * in ShaderCompileCache if this returns a non-empty string, and cached entries are invalidated whenever the
+		 * returned value changes.
+		 */
+		virtual String getCompilerVersion() const { return StringUtil::BLANK; }
 	};
 
 	/**
@@ -81,7 +88,11 @@ namespace bs
 		/** @copydoc GpuProgram::create */
 		SPtr<GpuProgram> create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask = GDF_DEFAULT);
 
-		/** @copydoc GpuProgram::compileBytecode */
+		/**
+		 * @copydoc GpuProgram::compileBytecode
+		 *
+		 * @note	Returns a previously compiled result from the ShaderCompileCache, if one is available.
+		 */
 		SPtr<GpuProgramBytecode> compileBytecode(const GPU_PROGRAM_DESC& desc);
 
 	protected:
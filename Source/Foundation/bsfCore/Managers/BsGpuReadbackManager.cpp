@@ -0,0 +1,192 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Managers/BsGpuReadbackManager.h"
+#include "RenderAPI/BsEventQuery.h"
+#include "Image/BsPixelData.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+#include "Math/BsMath.h"
+
+namespace bs { namespace ct
+{
+	GpuReadbackManager::GpuReadbackManager()
+		:mSyncData(bs_shared_ptr_new<AsyncOpSyncData>())
+	{ }
+
+	GpuReadbackManager::~GpuReadbackManager()
+	{
+		// Don't leave anyone waiting on reads that will never complete
+		for (auto& read : mTextureReads)
+		{
+			read.dest->_unlock();
+			read.op._completeOperation();
+		}
+
+		for (auto& read : mBufferReads)
+			read.op._completeOperation();
+	}
+
+	void GpuReadbackManager::readTexture(const SPtr<Texture>& texture, const SPtr<PixelData>& dest, UINT32 face,
+		UINT32 mipLevel, const AsyncOp& op)
+	{
+		const TextureProperties& props = texture->getProperties();
+
+		TEXTURE_DESC desc;
+		desc.type = props.getTextureType() == TEX_TYPE_CUBE_MAP ? TEX_TYPE_2D : props.getTextureType();
+		desc.format = props.getFormat();
+		desc.width = std::max(1U, props.getWidth() >> mipLevel);
+		desc.height = std::max(1U, props.getHeight() >> mipLevel);
+		desc.depth = std::max(1U, props.getDepth() >> mipLevel);
+		desc.usage = TU_CPUREADABLE;
+
+		TEXTURE_COPY_DESC copyDesc;
+		copyDesc.srcFace = face;
+		copyDesc.srcMip = mipLevel;
+
+		TextureRead read;
+		read.staging = getStagingTexture(desc);
+		read.dest = dest;
+		read.query = getQuery();
+		read.frameIdx = mFrameIdx;
+		read.op = op;
+
+		texture->copy(read.staging, copyDesc);
+		read.query->begin();
+
+		mTextureReads.push_back(read);
+	}
+
+	void GpuReadbackManager::readBuffer(const SPtr<GpuBuffer>& buffer, UINT32 offset, UINT32 length,
+		const SPtr<MemoryDataStream>& dest, const AsyncOp& op)
+	{
+		const GpuBufferProperties& props = buffer->getProperties();
+
+		if (offset + length > buffer->getSize() || dest->size() < length)
+		{
+			LOGERR("Cannot read GPU buffer data. Provided range is out of bounds.");
+			AsyncOp(op)._completeOperation();
+			return;
+		}
+
+		GPU_BUFFER_DESC desc;
+		desc.type = props.getType() == GBT_STANDARD ? GBT_STANDARD : GBT_STRUCTURED;
+		desc.format = props.getFormat();
+		desc.elementSize = desc.type == GBT_STANDARD ? 0 : props.getElementSize();
+		desc.elementCount = Math::divideAndRoundUp(length, props.getElementSize());
+		desc.usage = GBU_DYNAMIC;
+
+		BufferRead read;
+		read.staging = getStagingBuffer(desc);
+		read.dest = dest;
+		read.length = length;
+		read.query = getQuery();
+		read.frameIdx = mFrameIdx;
+		read.op = op;
+
+		read.staging->copyData(*buffer, offset, 0, length, true);
+		read.query->begin();
+
+		mBufferReads.push_back(read);
+	}
+
+	void GpuReadbackManager::_update()
+	{
+		mFrameIdx++;
+
+		// Reads complete in the order they were issued, so stop at the first one the GPU hasn't finished
+		UINT32 numCompleted = 0;
+		for (auto& read : mTextureReads)
+		{
+			if ((mFrameIdx - read.frameIdx) < mMinLatency || !read.query->isReady())
+				break;
+
+			read.staging->readData(*read.dest);
+			read.dest->_unlock();
+			read.op._completeOperation();
+
+			mFreeTextures.push_back({ read.staging, mFrameIdx });
+			mFreeQueries.push_back(read.query);
+			numCompleted++;
+		}
+
+		mTextureReads.erase(mTextureReads.begin(), mTextureReads.begin() + numCompleted);
+
+		numCompleted = 0;
+		for (auto& read : mBufferReads)
+		{
+			if ((mFrameIdx - read.frameIdx) < mMinLatency || !read.query->isReady())
+				break;
+
+			read.staging->readData(0, read.length, read.dest->getPtr());
+			read.op._completeOperation();
+
+			mFreeBuffers.push_back({ read.staging, mFrameIdx });
+			mFreeQueries.push_back(read.query);
+			numCompleted++;
+		}
+
+		mBufferReads.erase(mBufferReads.begin(), mBufferReads.begin() + numCompleted);
+
+		// Release staging resources that haven't been used in a while
+		const auto isStale = [this](UINT64 lastUsedFrame)
+		{
+			return (mFrameIdx - lastUsedFrame) > STAGING_RETAIN_FRAMES;
+		};
+
+		mFreeTextures.erase(std::remove_if(mFreeTextures.begin(), mFreeTextures.end(),
+			[&isStale](const FreeStagingResource<Texture>& entry) { return isStale(entry.lastUsedFrame); }),
+			mFreeTextures.end());
+
+		mFreeBuffers.erase(std::remove_if(mFreeBuffers.begin(), mFreeBuffers.end(),
+			[&isStale](const FreeStagingResource<GpuBuffer>& entry) { return isStale(entry.lastUsedFrame); }),
+			mFreeBuffers.end());
+	}
+
+	SPtr<Texture> GpuReadbackManager::getStagingTexture(const TEXTURE_DESC& desc)
+	{
+		for (auto iter = mFreeTextures.begin(); iter != mFreeTextures.end(); ++iter)
+		{
+			const TextureProperties& props = iter->resource->getProperties();
+			if (props.getTextureType() == desc.type && props.getFormat() == desc.format &&
+				props.getWidth() == desc.width && props.getHeight() == desc.height && props.getDepth() == desc.depth)
+			{
+				SPtr<Texture> output = iter->resource;
+				mFreeTextures.erase(iter);
+
+				return output;
+			}
+		}
+
+		return Texture::create(desc);
+	}
+
+	SPtr<GpuBuffer> GpuReadbackManager::getStagingBuffer(const GPU_BUFFER_DESC& desc)
+	{
+		for (auto iter = mFreeBuffers.begin(); iter != mFreeBuffers.end(); ++iter)
+		{
+			const GpuBufferProperties& props = iter->resource->getProperties();
+			if (props.getType() == desc.type && props.getFormat() == desc.format &&
+				props.getElementCount() == desc.elementCount &&
+				(desc.type == GBT_STANDARD || props.getElementSize() == desc.elementSize))
+			{
+				SPtr<GpuBuffer> output = iter->resource;
+				mFreeBuffers.erase(iter);
+
+				return output;
+			}
+		}
+
+		return GpuBuffer::create(desc);
+	}
+
+	SPtr<EventQuery> GpuReadbackManager::getQuery()
+	{
+		if (mFreeQueries.empty())
+			return EventQuery::create();
+
+		SPtr<EventQuery> output = mFreeQueries.back();
+		mFreeQueries.pop_back();
+
+		return output;
+	}
+}}
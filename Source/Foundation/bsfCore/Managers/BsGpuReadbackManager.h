@@ -0,0 +1,132 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Threading/BsAsyncOp.h"
+#include "Image/BsTexture.h"
+#include "RenderAPI/BsGpuBuffer.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderAPI-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Reads data from GPU resources without stalling the core thread. The requested data is copied into a CPU readable
+	 * staging resource on the GPU, followed by an event query. The staging resource is only read once the query reports
+	 * the GPU has finished the copy, which is usually a few frames later, at which point the read no longer needs to
+	 * wait on the GPU. Staging resources are kept and reused by later reads of the same size and format.
+	 *
+	 * Reads are only completed from _update(), which is called once per frame. Poll AsyncOp::hasCompleted() on the
+	 * returned operations instead of blocking on them, as blocking prevents new frames from being queued and therefore
+	 * the read from ever completing.
+	 *
+	 * @note	Core thread only, unless specified otherwise.
+	 */
+	class BS_CORE_EXPORT GpuReadbackManager : public Module<GpuReadbackManager>
+	{
+		/** Staging resource that isn't used by any in-flight reads. */
+		template<class T>
+		struct FreeStagingResource
+		{
+			SPtr<T> resource;
+			UINT64 lastUsedFrame;
+		};
+
+		/** Information about a texture read in progress. */
+		struct TextureRead
+		{
+			SPtr<Texture> staging;
+			SPtr<PixelData> dest;
+			SPtr<EventQuery> query;
+			UINT64 frameIdx;
+			AsyncOp op;
+		};
+
+		/** Information about a buffer read in progress. */
+		struct BufferRead
+		{
+			SPtr<GpuBuffer> staging;
+			SPtr<MemoryDataStream> dest;
+			UINT32 length;
+			SPtr<EventQuery> query;
+			UINT64 frameIdx;
+			AsyncOp op;
+		};
+
+	public:
+		GpuReadbackManager();
+		~GpuReadbackManager();
+
+		/**
+		 * Starts reading a single subresource of a texture.
+		 *
+		 * @param[in]	texture		Texture to read from. Multisampled textures are resolved before reading.
+		 * @param[in]	dest		Pre-allocated buffer of proper size and format where data will be read to. The
+		 *							buffer is unlocked (see GpuResourceData::_unlock()) once the read completes.
+		 * @param[in]	face		Texture face to read from.
+		 * @param[in]	mipLevel	Mipmap level to read from.
+		 * @param[in]	op			Operation to complete once the data is read. Should be created with
+		 *							createAsyncOp().
+		 */
+		void readTexture(const SPtr<Texture>& texture, const SPtr<PixelData>& dest, UINT32 face, UINT32 mipLevel,
+			const AsyncOp& op);
+
+		/**
+		 * Starts reading a range of a GPU buffer.
+		 *
+		 * @param[in]	buffer		Buffer to read from.
+		 * @param[in]	offset		Offset into the buffer to start reading from, in bytes.
+		 * @param[in]	length		Number of bytes to read.
+		 * @param[in]	dest		Stream of at least @p length bytes the data will be written to.
+		 * @param[in]	op			Operation to complete once the data is read. Should be created with
+		 *							createAsyncOp().
+		 */
+		void readBuffer(const SPtr<GpuBuffer>& buffer, UINT32 offset, UINT32 length, const SPtr<MemoryDataStream>& dest,
+			const AsyncOp& op);
+
+		/** Creates a new operation to be passed to one of the read methods. Can be called from any thread. */
+		AsyncOp createAsyncOp() const { return AsyncOp(mSyncData); }
+
+		/**
+		 * Sets the minimum number of frames between starting a read and completing it. Higher values make it less
+		 * likely the GPU is still processing the copy when the query is first checked. Default is 1.
+		 */
+		void setMinLatency(UINT32 frames) { mMinLatency = frames; }
+
+		/** Returns the latency set by setMinLatency(). */
+		UINT32 getMinLatency() const { return mMinLatency; }
+
+		/** Completes any reads the GPU is done with and releases staging resources that are no longer used. */
+		void _update();
+
+	private:
+		/** Returns a free staging texture compatible with the provided description, or creates a new one. */
+		SPtr<Texture> getStagingTexture(const TEXTURE_DESC& desc);
+
+		/** Returns a free staging buffer compatible with the provided description, or creates a new one. */
+		SPtr<GpuBuffer> getStagingBuffer(const GPU_BUFFER_DESC& desc);
+
+		/** Returns an event query that isn't used by any in-flight reads. */
+		SPtr<EventQuery> getQuery();
+
+		/** Number of frames an unused staging resource is kept around for, before being released. */
+		static constexpr UINT32 STAGING_RETAIN_FRAMES = 60;
+
+		SPtr<AsyncOpSyncData> mSyncData;
+		UINT64 mFrameIdx = 0;
+		UINT32 mMinLatency = 1;
+
+		Vector<TextureRead> mTextureReads;
+		Vector<BufferRead> mBufferReads;
+
+		Vector<FreeStagingResource<Texture>> mFreeTextures;
+		Vector<FreeStagingResource<GpuBuffer>> mFreeBuffers;
+		Vector<SPtr<EventQuery>> mFreeQueries;
+	};
+
+	/** @} */
+}}
@@ -0,0 +1,159 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Managers/BsMeshMemoryManager.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsIndexBuffer.h"
+
+namespace bs { namespace ct
+{
+	MeshMemoryManager::Allocation MeshMemoryManager::allocate(const SPtr<VertexDataDesc>& vertexDesc,
+		IndexType indexType, UINT32 numVertices, UINT32 numIndices, GpuDeviceFlags deviceMask)
+	{
+		UINT32 maxStride = 0;
+		for (UINT32 i = 0; i <= vertexDesc->getMaxStreamIdx(); i++)
+		{
+			if (vertexDesc->hasStream(i))
+				maxStride = std::max(maxStride, vertexDesc->getVertexStride(i));
+		}
+
+		UINT32 indexSize = indexType == IT_16BIT ? sizeof(UINT16) : sizeof(UINT32);
+		if (maxStride == 0 ||
+			(UINT64)numVertices * maxStride * MAX_MESH_POOL_FRACTION > VERTEX_POOL_SIZE ||
+			(UINT64)numIndices * indexSize * MAX_MESH_POOL_FRACTION > INDEX_POOL_SIZE)
+		{
+			return Allocation();
+		}
+
+		Vector<VertexElement> vertexElements = vertexDesc->createElements();
+
+		Allocation output;
+		for (UINT32 i = 0; i < (UINT32)mPools.size(); i++)
+		{
+			Pool& pool = mPools[i];
+			if (pool.indexBuffer == nullptr)
+				continue;
+
+			if (pool.indexType != indexType || pool.deviceMask != deviceMask || pool.vertexElements != vertexElements)
+				continue;
+
+			UINT32 vertexRange = pool.vertexAlloc.alloc(numVertices);
+			if (vertexRange == RangeAlloc::INVALID)
+				continue;
+
+			UINT32 indexRange = pool.indexAlloc.alloc(numIndices);
+			if (indexRange == RangeAlloc::INVALID)
+			{
+				pool.vertexAlloc.free(vertexRange);
+				continue;
+			}
+
+			output.pool = i;
+			output.vertexRange = vertexRange;
+			output.indexRange = indexRange;
+			break;
+		}
+
+		// All compatible pools are full, start a new one
+		if (!output.isValid())
+		{
+			UINT32 poolIdx = createPool(vertexDesc, maxStride, std::move(vertexElements), indexType, deviceMask);
+			Pool& pool = mPools[poolIdx];
+
+			output.pool = poolIdx;
+			output.vertexRange = pool.vertexAlloc.alloc(numVertices);
+			output.indexRange = pool.indexAlloc.alloc(numIndices);
+		}
+
+		Pool& pool = mPools[output.pool];
+		output.vertexOffset = pool.vertexAlloc.getStart(output.vertexRange);
+		output.indexOffset = pool.indexAlloc.getStart(output.indexRange);
+		pool.numAllocations++;
+
+		return output;
+	}
+
+	void MeshMemoryManager::free(const Allocation& allocation)
+	{
+		if (!allocation.isValid())
+			return;
+
+		Pool& pool = mPools[allocation.pool];
+		pool.vertexAlloc.free(allocation.vertexRange);
+		pool.indexAlloc.free(allocation.indexRange);
+		pool.numAllocations--;
+
+		// Release the buffers of empty pools. Meshes that were using them might still be referenced by commands the GPU
+		// hasn't executed yet, but the render API keeps the buffers alive until then.
+		if (pool.numAllocations == 0)
+		{
+			pool = Pool();
+			mUnusedPools.push_back(allocation.pool);
+		}
+	}
+
+	SPtr<VertexBuffer> MeshMemoryManager::getVertexBuffer(const Allocation& allocation, UINT32 streamIdx) const
+	{
+		const Pool& pool = mPools[allocation.pool];
+		if (streamIdx >= (UINT32)pool.vertexBuffers.size())
+			return nullptr;
+
+		return pool.vertexBuffers[streamIdx];
+	}
+
+	SPtr<IndexBuffer> MeshMemoryManager::getIndexBuffer(const Allocation& allocation) const
+	{
+		return mPools[allocation.pool].indexBuffer;
+	}
+
+	UINT32 MeshMemoryManager::createPool(const SPtr<VertexDataDesc>& vertexDesc, UINT32 maxStride,
+		Vector<VertexElement> vertexElements, IndexType indexType, GpuDeviceFlags deviceMask)
+	{
+		UINT32 poolIdx;
+		if (!mUnusedPools.empty())
+		{
+			poolIdx = mUnusedPools.back();
+			mUnusedPools.pop_back();
+		}
+		else
+		{
+			poolIdx = (UINT32)mPools.size();
+			mPools.push_back(Pool());
+		}
+
+		Pool& pool = mPools[poolIdx];
+		pool.vertexElements = std::move(vertexElements);
+		pool.indexType = indexType;
+		pool.deviceMask = deviceMask;
+
+		// All streams share the same vertex ranges, so they all need to hold the same number of vertices
+		UINT32 numVertices = VERTEX_POOL_SIZE / maxStride;
+		pool.vertexBuffers.resize(vertexDesc->getMaxStreamIdx() + 1);
+		for (UINT32 i = 0; i <= vertexDesc->getMaxStreamIdx(); i++)
+		{
+			if (!vertexDesc->hasStream(i))
+				continue;
+
+			VERTEX_BUFFER_DESC vbDesc;
+			vbDesc.vertexSize = vertexDesc->getVertexStride(i);
+			vbDesc.numVerts = numVertices;
+			vbDesc.usage = GBU_STATIC;
+
+			pool.vertexBuffers[i] = VertexBuffer::create(vbDesc, deviceMask);
+		}
+
+		UINT32 indexSize = indexType == IT_16BIT ? sizeof(UINT16) : sizeof(UINT32);
+
+		INDEX_BUFFER_DESC ibDesc;
+		ibDesc.indexType = indexType;
+		ibDesc.numIndices = INDEX_POOL_SIZE / indexSize;
+		ibDesc.usage = GBU_STATIC;
+
+		pool.indexBuffer = IndexBuffer::create(ibDesc, deviceMask);
+
+		pool.vertexAlloc.grow(numVertices);
+		pool.indexAlloc.grow(ibDesc.numIndices);
+
+		return poolIdx;
+	}
+}}
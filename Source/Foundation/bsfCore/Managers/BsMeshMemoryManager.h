@@ -0,0 +1,114 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Allocators/BsRangeAlloc.h"
+#include "RenderAPI/BsVertexDeclaration.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Sub-allocates vertex and index data of static meshes from a few large buffers, shared by all meshes using the
+	 * same vertex layout and index type. This keeps the number of GPU allocations low, and allows consecutive draws of
+	 * different meshes to be issued without rebinding the vertex and index buffers.
+	 *
+	 * Each mesh receives a range of vertices and indices within the shared buffers. Meshes report the start of their
+	 * ranges through MeshBase::getVertexOffset() and MeshBase::getIndexOffset(), which the renderer already applies
+	 * when issuing draw calls. Meshes too large to benefit from sharing should keep using their own buffers.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_CORE_EXPORT MeshMemoryManager : public Module<MeshMemoryManager>
+	{
+	public:
+		/** Location of a single mesh's data within the shared buffers. */
+		struct Allocation
+		{
+			UINT32 pool = (UINT32)-1;
+			UINT32 vertexRange = RangeAlloc::INVALID;
+			UINT32 indexRange = RangeAlloc::INVALID;
+			UINT32 vertexOffset = 0; /**< Offset of the first vertex, in vertices. */
+			UINT32 indexOffset = 0; /**< Offset of the first index, in indices. */
+
+			/** Checks if the allocation refers to valid ranges within the shared buffers. */
+			bool isValid() const { return pool != (UINT32)-1; }
+		};
+
+		MeshMemoryManager() = default;
+
+		/**
+		 * Allocates space for a mesh in the shared buffers.
+		 *
+		 * @param[in]	vertexDesc		Layout of the mesh's vertices.
+		 * @param[in]	indexType		Type of the mesh's indices.
+		 * @param[in]	numVertices		Number of vertices to allocate.
+		 * @param[in]	numIndices		Number of indices to allocate.
+		 * @param[in]	deviceMask		Mask that determines on which GPU devices the buffers are created on.
+		 * @return						Location of the allocated ranges. Invalid if the mesh is too large to share
+		 *								buffers with other meshes, in which case it should create its own buffers.
+		 */
+		Allocation allocate(const SPtr<VertexDataDesc>& vertexDesc, IndexType indexType, UINT32 numVertices,
+			UINT32 numIndices, GpuDeviceFlags deviceMask);
+
+		/** Releases an allocation returned by allocate(). */
+		void free(const Allocation& allocation);
+
+		/**
+		 * Returns the shared vertex buffer the allocation's vertices for the specified stream are stored in. Returns
+		 * null if the allocation's vertex layout has no such stream.
+		 */
+		SPtr<VertexBuffer> getVertexBuffer(const Allocation& allocation, UINT32 streamIdx) const;
+
+		/** Returns the shared index buffer the allocation's indices are stored in. */
+		SPtr<IndexBuffer> getIndexBuffer(const Allocation& allocation) const;
+
+		/** Returns the number of shared buffer sets currently allocated. */
+		UINT32 getNumPools() const { return (UINT32)mPools.size() - (UINT32)mUnusedPools.size(); }
+
+		/**
+		 * Size of the vertex buffers of a single pool, in bytes. Each vertex stream of a pool gets its own buffer,
+		 * sized so the largest stream fits in this many bytes.
+		 */
+		static constexpr UINT32 VERTEX_POOL_SIZE = 16 * 1024 * 1024;
+
+		/** Size of the index buffer of a single pool, in bytes. */
+		static constexpr UINT32 INDEX_POOL_SIZE = 8 * 1024 * 1024;
+
+		/** Meshes using more than 1/Nth of a pool's vertices or indices receive their own buffers instead. */
+		static constexpr UINT32 MAX_MESH_POOL_FRACTION = 4;
+
+	private:
+		/** Set of shared buffers, used by meshes with a specific vertex layout and index type. */
+		struct Pool
+		{
+			Vector<VertexElement> vertexElements;
+			IndexType indexType = IT_32BIT;
+			GpuDeviceFlags deviceMask = GDF_DEFAULT;
+
+			Vector<SPtr<VertexBuffer>> vertexBuffers; /**< One per stream, null for streams with no elements. */
+			SPtr<IndexBuffer> indexBuffer;
+
+			RangeAlloc vertexAlloc;
+			RangeAlloc indexAlloc;
+			UINT32 numAllocations = 0;
+		};
+
+		/**
+		 * Creates a new pool for meshes with the provided layout. @p maxStride is the largest vertex stride of all the
+		 * layout's streams. Returns the index of the pool.
+		 */
+		UINT32 createPool(const SPtr<VertexDataDesc>& vertexDesc, UINT32 maxStride,
+			Vector<VertexElement> vertexElements, IndexType indexType, GpuDeviceFlags deviceMask);
+
+		Vector<Pool> mPools;
+		Vector<UINT32> mUnusedPools;
+	};
+
+	/** @} */
+}}
@@ -40,6 +40,9 @@ namespace bs { namespace ct
 
 	void QueryManager::_update()
 	{
+		mFrameIdx++;
+		resolveQueries();
+
 		for(auto& query : mEventQueries)
 		{
 			if(query->isActive() && query->isReady())
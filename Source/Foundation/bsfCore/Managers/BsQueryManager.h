@@ -49,6 +49,19 @@ namespace bs { namespace ct
 		 */
 		virtual SPtr<OcclusionQuery> createOcclusionQuery(bool binary, UINT32 deviceIdx = 0) const = 0;
 
+		/**
+		 * Sets the minimum number of frames between a query being issued and its result being read. Render APIs that
+		 * read query results in batches won't report a query as ready before this many frames have passed, which lets
+		 * a single read cover more queries. Default is 1.
+		 */
+		void setMinLatency(UINT32 frames) { mMinLatency = frames; }
+
+		/** Returns the latency set by setMinLatency(). */
+		UINT32 getMinLatency() const { return mMinLatency; }
+
+		/** Returns the number of times _update() has been called. */
+		UINT64 getFrameIdx() const { return mFrameIdx; }
+
 		/** Triggers completed queries. Should be called every frame. */
 		void _update();
 
@@ -78,6 +91,12 @@ namespace bs { namespace ct
 		/** Deletes any queued queries. */
 		void processDeletedQueue();
 
+		/**
+		 * Called at the start of _update(), before any query is checked for completion. Allows the render API to read
+		 * the results of all finished queries at once, instead of reading them one by one as they are polled.
+		 */
+		virtual void resolveQueries() { }
+
 	protected:
 		mutable Vector<EventQuery*> mEventQueries;
 		mutable Vector<TimerQuery*> mTimerQueries;
@@ -86,6 +105,9 @@ namespace bs { namespace ct
 		mutable Vector<EventQuery*> mDeletedEventQueries;
 		mutable Vector<TimerQuery*> mDeletedTimerQueries;
 		mutable Vector<OcclusionQuery*> mDeletedOcclusionQueries;
+
+		UINT64 mFrameIdx = 0;
+		UINT32 mMinLatency = 1;
 	};
 
 	/** @} */
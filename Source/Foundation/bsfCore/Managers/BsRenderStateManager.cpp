@@ -140,8 +140,18 @@ namespace bs
 
 	namespace ct
 	{
+	bool RenderStateManager::PipelineStateKey::operator==(const PipelineStateKey& rhs) const
+	{
+		for (UINT32 i = 0; i < 8; i++)
+		{
+			if (objects[i] != rhs.objects[i])
+				return false;
+		}
+
+		return deviceMask == rhs.deviceMask;
+	}
+
 	RenderStateManager::RenderStateManager()
-		:mNextBlendStateId(0), mNextRasterizerStateId(0), mNextDepthStencilStateId(0)
 	{
 		
 	}
@@ -149,13 +159,15 @@ namespace bs
 	SPtr<SamplerState> RenderStateManager::createSamplerState(const SAMPLER_STATE_DESC& desc, 
 		GpuDeviceFlags deviceMask) const
 	{
-		SPtr<SamplerState> state = findCachedState(desc);
+		UINT64 hash = bs::SamplerState::generateHash(desc);
+
+		SPtr<SamplerState> state = findCachedState(desc, hash);
 		if (state == nullptr)
 		{
 			state = createSamplerStateInternal(desc, deviceMask);
 			state->initialize();
 
-			notifySamplerStateCreated(desc, state);
+			state = notifySamplerStateCreated(desc, hash, state);
 		}
 
 		return state;
@@ -163,8 +175,10 @@ namespace bs
 
 	SPtr<DepthStencilState> RenderStateManager::createDepthStencilState(const DEPTH_STENCIL_STATE_DESC& desc) const
 	{
+		UINT64 hash = bs::DepthStencilState::generateHash(desc);
+
 		UINT32 id = 0;
-		SPtr<DepthStencilState> state = findCachedState(desc, id);
+		SPtr<DepthStencilState> state = findCachedState(desc, hash, id);
 		if (state == nullptr)
 		{
 			state = createDepthStencilStateInternal(desc, id);
@@ -173,7 +187,7 @@ namespace bs
 			CachedDepthStencilState cachedData(id);
 			cachedData.state = state;
 
-			notifyDepthStencilStateCreated(desc, cachedData);
+			state = notifyDepthStencilStateCreated(desc, hash, cachedData);
 		}
 
 		return state;
@@ -181,8 +195,10 @@ namespace bs
 
 	SPtr<RasterizerState> RenderStateManager::createRasterizerState(const RASTERIZER_STATE_DESC& desc) const
 	{
+		UINT64 hash = bs::RasterizerState::generateHash(desc);
+
 		UINT32 id = 0;
-		SPtr<RasterizerState> state = findCachedState(desc, id);
+		SPtr<RasterizerState> state = findCachedState(desc, hash, id);
 		if (state == nullptr)
 		{
 			state = createRasterizerStateInternal(desc, id);
@@ -191,7 +207,7 @@ namespace bs
 			CachedRasterizerState cachedData(id);
 			cachedData.state = state;
 
-			notifyRasterizerStateCreated(desc, cachedData);
+			state = notifyRasterizerStateCreated(desc, hash, cachedData);
 		}
 
 		return state;
@@ -199,8 +215,10 @@ namespace bs
 
 	SPtr<BlendState> RenderStateManager::createBlendState(const BLEND_STATE_DESC& desc) const
 	{
+		UINT64 hash = bs::BlendState::generateHash(desc);
+
 		UINT32 id = 0;
-		SPtr<BlendState> state = findCachedState(desc, id);
+		SPtr<BlendState> state = findCachedState(desc, hash, id);
 		if (state == nullptr)
 		{
 			state = createBlendStateInternal(desc, id);
@@ -209,7 +227,7 @@ namespace bs
 			CachedBlendState cachedData(id);
 			cachedData.state = state;
 
-			notifyBlendStateCreated(desc, cachedData);
+			state = notifyBlendStateCreated(desc, hash, cachedData);
 		}
 
 		return state;
@@ -218,9 +236,49 @@ namespace bs
 	SPtr<GraphicsPipelineState> RenderStateManager::createGraphicsPipelineState(const PIPELINE_STATE_DESC& desc, 
 		GpuDeviceFlags deviceMask) const
 	{
+		UINT64 hash = 0;
+		HashedDesc<PipelineStateKey> key(getPipelineStateKey(desc, deviceMask, hash), hash);
+		auto& shard = mCachedGraphicsPipelineStates.getShard(hash);
+
+		{
+			Lock lock(shard.mutex);
+
+			auto iterFind = shard.entries.find(key);
+			if (iterFind != shard.entries.end())
+			{
+				SPtr<GraphicsPipelineState> state = iterFind->second.lock();
+				if (state != nullptr)
+					return state;
+			}
+		}
+
 		SPtr<GraphicsPipelineState> state = _createGraphicsPipelineState(desc, deviceMask);
 		state->initialize();
 
+		Lock lock(shard.mutex);
+
+		// Another thread might have created the same pipeline while we were initializing ours
+		std::weak_ptr<GraphicsPipelineState>& entry = shard.entries[key];
+		SPtr<GraphicsPipelineState> existingState = entry.lock();
+		if (existingState != nullptr)
+			return existingState;
+
+		entry = state;
+
+		// Entries are never removed when pipelines are destroyed, so clean up expired ones as the cache grows
+		if ((UINT32)shard.entries.size() >= shard.pruneThreshold)
+		{
+			for (auto iter = shard.entries.begin(); iter != shard.entries.end();)
+			{
+				if (iter->second.expired())
+					iter = shard.entries.erase(iter);
+				else
+					++iter;
+			}
+
+			shard.pruneThreshold = std::max(64U, (UINT32)shard.entries.size() * 2);
+		}
+
 		return state;
 	}
 
@@ -245,12 +303,14 @@ namespace bs
 	SPtr<SamplerState> RenderStateManager::_createSamplerState(const SAMPLER_STATE_DESC& desc, 
 		GpuDeviceFlags deviceMask) const
 	{
-		SPtr<SamplerState> state = findCachedState(desc);
+		UINT64 hash = bs::SamplerState::generateHash(desc);
+
+		SPtr<SamplerState> state = findCachedState(desc, hash);
 		if (state == nullptr)
 		{
 			state = createSamplerStateInternal(desc, deviceMask);
 
-			notifySamplerStateCreated(desc, state);
+			state = notifySamplerStateCreated(desc, hash, state);
 		}
 
 		return state;
@@ -258,8 +318,10 @@ namespace bs
 
 	SPtr<DepthStencilState> RenderStateManager::_createDepthStencilState(const DEPTH_STENCIL_STATE_DESC& desc) const
 	{
+		UINT64 hash = bs::DepthStencilState::generateHash(desc);
+
 		UINT32 id = 0;
-		SPtr<DepthStencilState> state = findCachedState(desc, id);
+		SPtr<DepthStencilState> state = findCachedState(desc, hash, id);
 		if (state == nullptr)
 		{
 			state = createDepthStencilStateInternal(desc, id);
@@ -267,7 +329,7 @@ namespace bs
 			CachedDepthStencilState cachedData(id);
 			cachedData.state = state;
 
-			notifyDepthStencilStateCreated(desc, cachedData);
+			state = notifyDepthStencilStateCreated(desc, hash, cachedData);
 		}
 
 		return state;
@@ -275,8 +337,10 @@ namespace bs
 
 	SPtr<RasterizerState> RenderStateManager::_createRasterizerState(const RASTERIZER_STATE_DESC& desc) const
 	{
+		UINT64 hash = bs::RasterizerState::generateHash(desc);
+
 		UINT32 id = 0;
-		SPtr<RasterizerState> state = findCachedState(desc, id);
+		SPtr<RasterizerState> state = findCachedState(desc, hash, id);
 		if (state == nullptr)
 		{
 			state = createRasterizerStateInternal(desc, id);
@@ -284,7 +348,7 @@ namespace bs
 			CachedRasterizerState cachedData(id);
 			cachedData.state = state;
 
-			notifyRasterizerStateCreated(desc, cachedData);
+			state = notifyRasterizerStateCreated(desc, hash, cachedData);
 		}
 
 		return state;
@@ -292,8 +356,10 @@ namespace bs
 
 	SPtr<BlendState> RenderStateManager::_createBlendState(const BLEND_STATE_DESC& desc) const
 	{
+		UINT64 hash = bs::BlendState::generateHash(desc);
+
 		UINT32 id = 0;
-		SPtr<BlendState> state = findCachedState(desc, id);
+		SPtr<BlendState> state = findCachedState(desc, hash, id);
 		if (state == nullptr)
 		{
 			state = createBlendStateInternal(desc, id);
@@ -301,7 +367,7 @@ namespace bs
 			CachedBlendState cachedData(id);
 			cachedData.state = state;
 
-			notifyBlendStateCreated(desc, cachedData);
+			state = notifyBlendStateCreated(desc, hash, cachedData);
 		}
 
 		return state;
@@ -383,65 +449,99 @@ namespace bs
 		return mDefaultDepthStencilState;
 	}
 
-	void RenderStateManager::notifySamplerStateCreated(const SAMPLER_STATE_DESC& desc, const SPtr<SamplerState>& state) const
+	SPtr<SamplerState> RenderStateManager::notifySamplerStateCreated(const SAMPLER_STATE_DESC& desc, UINT64 hash,
+		const SPtr<SamplerState>& state) const
 	{
-		Lock lock(mMutex);
+		auto& shard = mCachedSamplerStates.getShard(hash);
+		Lock lock(shard.mutex);
 
-		mCachedSamplerStates[desc] = state;
+		std::weak_ptr<SamplerState>& entry = shard.entries[HashedDesc<SAMPLER_STATE_DESC>(desc, hash)];
+		SPtr<SamplerState> existingState = entry.lock();
+		if (existingState != nullptr)
+			return existingState;
+
+		entry = state;
+		return state;
 	}
 
-	void RenderStateManager::notifyBlendStateCreated(const BLEND_STATE_DESC& desc, const CachedBlendState& state) const
+	SPtr<BlendState> RenderStateManager::notifyBlendStateCreated(const BLEND_STATE_DESC& desc, UINT64 hash,
+		const CachedBlendState& state) const
 	{
-		Lock lock(mMutex);
+		auto& shard = mCachedBlendStates.getShard(hash);
+		Lock lock(shard.mutex);
 
-		mCachedBlendStates[desc] = state;
+		CachedBlendState& entry = shard.entries[HashedDesc<BLEND_STATE_DESC>(desc, hash)];
+		SPtr<BlendState> existingState = entry.state.lock();
+		if (existingState != nullptr)
+			return existingState;
+
+		entry = state;
+		return state.state.lock();
 	}
 
-	void RenderStateManager::notifyRasterizerStateCreated(const RASTERIZER_STATE_DESC& desc, const CachedRasterizerState& state) const
+	SPtr<RasterizerState> RenderStateManager::notifyRasterizerStateCreated(const RASTERIZER_STATE_DESC& desc, UINT64 hash,
+		const CachedRasterizerState& state) const
 	{
-		Lock lock(mMutex);
+		auto& shard = mCachedRasterizerStates.getShard(hash);
+		Lock lock(shard.mutex);
+
+		CachedRasterizerState& entry = shard.entries[HashedDesc<RASTERIZER_STATE_DESC>(desc, hash)];
+		SPtr<RasterizerState> existingState = entry.state.lock();
+		if (existingState != nullptr)
+			return existingState;
 
-		mCachedRasterizerStates[desc] = state;
+		entry = state;
+		return state.state.lock();
 	}
 
-	void RenderStateManager::notifyDepthStencilStateCreated(const DEPTH_STENCIL_STATE_DESC& desc, const CachedDepthStencilState& state) const
+	SPtr<DepthStencilState> RenderStateManager::notifyDepthStencilStateCreated(const DEPTH_STENCIL_STATE_DESC& desc, UINT64 hash,
+		const CachedDepthStencilState& state) const
 	{
-		Lock lock(mMutex);
+		auto& shard = mCachedDepthStencilStates.getShard(hash);
+		Lock lock(shard.mutex);
+
+		CachedDepthStencilState& entry = shard.entries[HashedDesc<DEPTH_STENCIL_STATE_DESC>(desc, hash)];
+		SPtr<DepthStencilState> existingState = entry.state.lock();
+		if (existingState != nullptr)
+			return existingState;
 
-		mCachedDepthStencilStates[desc] = state;
+		entry = state;
+		return state.state.lock();
 	}
 
-	void RenderStateManager::notifySamplerStateDestroyed(const SAMPLER_STATE_DESC& desc) const
+	void RenderStateManager::notifySamplerStateDestroyed(const SAMPLER_STATE_DESC& desc, UINT64 hash) const
 	{
-		Lock lock(mMutex);
+		auto& shard = mCachedSamplerStates.getShard(hash);
+		Lock lock(shard.mutex);
 
-		mCachedSamplerStates.erase(desc);
+		// Entry might have been replaced by a state that is still alive
+		auto iterFind = shard.entries.find(HashedDesc<SAMPLER_STATE_DESC>(desc, hash));
+		if (iterFind != shard.entries.end() && iterFind->second.expired())
+			shard.entries.erase(iterFind);
 	}
 
-	SPtr<SamplerState> RenderStateManager::findCachedState(const SAMPLER_STATE_DESC& desc) const
+	SPtr<SamplerState> RenderStateManager::findCachedState(const SAMPLER_STATE_DESC& desc, UINT64 hash) const
 	{
-		Lock lock(mMutex);
+		auto& shard = mCachedSamplerStates.getShard(hash);
+		Lock lock(shard.mutex);
 
-		auto iterFind = mCachedSamplerStates.find(desc);
-		if (iterFind != mCachedSamplerStates.end())
+		auto iterFind = shard.entries.find(HashedDesc<SAMPLER_STATE_DESC>(desc, hash));
+		if (iterFind != shard.entries.end())
 			return iterFind->second.lock();
 
 		return nullptr;
 	}
 
-	SPtr<BlendState> RenderStateManager::findCachedState(const BLEND_STATE_DESC& desc, UINT32& id) const
+	SPtr<BlendState> RenderStateManager::findCachedState(const BLEND_STATE_DESC& desc, UINT64 hash, UINT32& id) const
 	{
-		Lock lock(mMutex);
+		auto& shard = mCachedBlendStates.getShard(hash);
+		Lock lock(shard.mutex);
 
-		auto iterFind = mCachedBlendStates.find(desc);
-		if (iterFind != mCachedBlendStates.end())
+		auto iterFind = shard.entries.find(HashedDesc<BLEND_STATE_DESC>(desc, hash));
+		if (iterFind != shard.entries.end())
 		{
 			id = iterFind->second.id;
-
-			if (!iterFind->second.state.expired())
-				return iterFind->second.state.lock();
-
-			return nullptr;
+			return iterFind->second.state.lock();
 		}
 
 		id = mNextBlendStateId++;
@@ -450,19 +550,16 @@ namespace bs
 		return nullptr;
 	}
 
-	SPtr<RasterizerState> RenderStateManager::findCachedState(const RASTERIZER_STATE_DESC& desc, UINT32& id) const
+	SPtr<RasterizerState> RenderStateManager::findCachedState(const RASTERIZER_STATE_DESC& desc, UINT64 hash, UINT32& id) const
 	{
-		Lock lock(mMutex);
+		auto& shard = mCachedRasterizerStates.getShard(hash);
+		Lock lock(shard.mutex);
 
-		auto iterFind = mCachedRasterizerStates.find(desc);
-		if (iterFind != mCachedRasterizerStates.end())
+		auto iterFind = shard.entries.find(HashedDesc<RASTERIZER_STATE_DESC>(desc, hash));
+		if (iterFind != shard.entries.end())
 		{
 			id = iterFind->second.id;
-
-			if (!iterFind->second.state.expired())
-				return iterFind->second.state.lock();
-
-			return nullptr;
+			return iterFind->second.state.lock();
 		}
 
 		id = mNextRasterizerStateId++;
@@ -471,19 +568,16 @@ namespace bs
 		return nullptr;
 	}
 
-	SPtr<DepthStencilState> RenderStateManager::findCachedState(const DEPTH_STENCIL_STATE_DESC& desc, UINT32& id) const
+	SPtr<DepthStencilState> RenderStateManager::findCachedState(const DEPTH_STENCIL_STATE_DESC& desc, UINT64 hash, UINT32& id) const
 	{
-		Lock lock(mMutex);
+		auto& shard = mCachedDepthStencilStates.getShard(hash);
+		Lock lock(shard.mutex);
 
-		auto iterFind = mCachedDepthStencilStates.find(desc);
-		if (iterFind != mCachedDepthStencilStates.end())
+		auto iterFind = shard.entries.find(HashedDesc<DEPTH_STENCIL_STATE_DESC>(desc, hash));
+		if (iterFind != shard.entries.end())
 		{
 			id = iterFind->second.id;
-
-			if (!iterFind->second.state.expired())
-				return iterFind->second.state.lock();
-
-			return nullptr;
+			return iterFind->second.state.lock();
 		}
 
 		id = mNextDepthStencilStateId++;
@@ -492,6 +586,30 @@ namespace bs
 		return nullptr;
 	}
 
+	RenderStateManager::PipelineStateKey RenderStateManager::getPipelineStateKey(const PIPELINE_STATE_DESC& desc,
+		GpuDeviceFlags deviceMask, UINT64& hash)
+	{
+		PipelineStateKey key;
+		key.objects[0] = desc.blendState.get();
+		key.objects[1] = desc.rasterizerState.get();
+		key.objects[2] = desc.depthStencilState.get();
+		key.objects[3] = desc.vertexProgram.get();
+		key.objects[4] = desc.fragmentProgram.get();
+		key.objects[5] = desc.geometryProgram.get();
+		key.objects[6] = desc.hullProgram.get();
+		key.objects[7] = desc.domainProgram.get();
+		key.deviceMask = deviceMask;
+
+		size_t keyHash = 0;
+		for (UINT32 i = 0; i < 8; i++)
+			hash_combine(keyHash, key.objects[i]);
+
+		hash_combine(keyHash, (UINT32)deviceMask);
+
+		hash = keyHash;
+		return key;
+	}
+
 	SPtr<SamplerState> RenderStateManager::createSamplerStateInternal(const SAMPLER_STATE_DESC& desc, GpuDeviceFlags deviceMask) const
 	{
 		SPtr<SamplerState> state = 
@@ -144,6 +144,59 @@ namespace bs
 			UINT32 id;
 		};
 
+		/** Number of partitions each state cache is split into. Each partition is locked separately. */
+		static constexpr UINT32 NUM_CACHE_SHARDS = 16;
+
+		/** Descriptor used as a cache key, along with its hash so the hash is only calculated once per lookup. */
+		template<class T>
+		struct HashedDesc
+		{
+			HashedDesc(const T& desc, UINT64 hash)
+				:desc(desc), hash(hash)
+			{ }
+
+			bool operator==(const HashedDesc& rhs) const { return hash == rhs.hash && desc == rhs.desc; }
+
+			T desc;
+			UINT64 hash;
+		};
+
+		/** Returns the pre-calculated hash of a HashedDesc. */
+		struct HashedDescHash
+		{
+			template<class T>
+			size_t operator()(const HashedDesc<T>& value) const { return (size_t)value.hash; }
+		};
+
+		/**
+		 * Identifies a graphics pipeline state by the objects it was created from. Raw pointers are used so the cache
+		 * doesn't keep the objects alive. A pointer cannot be re-used while a pipeline referencing it is alive.
+		 */
+		struct PipelineStateKey
+		{
+			bool operator==(const PipelineStateKey& rhs) const;
+
+			void* objects[8];
+			GpuDeviceFlags deviceMask;
+		};
+
+		/** Cache of render state objects split into separately locked partitions, selected by the descriptor hash. */
+		template<class T, class Value>
+		struct StateCache
+		{
+			struct Shard
+			{
+				FlatHashMap<HashedDesc<T>, Value, HashedDescHash> entries;
+				UINT32 pruneThreshold = 64; /**< Size at which expired entries are removed, if the cache prunes at all. */
+				Mutex mutex;
+			};
+
+			/** Returns the partition the descriptor with the provided hash belongs to. */
+			Shard& getShard(UINT64 hash) { return shards[(hash ^ (hash >> 32)) % NUM_CACHE_SHARDS]; }
+
+			Shard shards[NUM_CACHE_SHARDS];
+		};
+
 	public:
 		RenderStateManager();
 
@@ -166,6 +219,8 @@ namespace bs
 		/** 
 		 * @copydoc bs::RenderStateManager::createGraphicsPipelineState 
 		 * @param[in]	deviceMask		Mask that determines on which GPU devices should the object be created on.
+		 *
+		 * @note	If a pipeline state created from the same states and programs is still alive, it is returned instead.
 		 */
 		SPtr<GraphicsPipelineState> createGraphicsPipelineState(const PIPELINE_STATE_DESC& desc, 
 			GpuDeviceFlags deviceMask = GDF_DEFAULT) const;
@@ -206,6 +261,28 @@ namespace bs
 		virtual SPtr<GpuPipelineParamInfo> _createPipelineParamInfo(const GPU_PIPELINE_PARAMS_DESC& desc,
 																		GpuDeviceFlags deviceMask = GDF_DEFAULT) const;
 
+		/**
+		 * Requests the native pipeline object used for drawing with the provided combination of states to be created
+		 * ahead of time, instead of when it is first used for drawing. Render backends that create such objects lazily
+		 * perform the creation asynchronously on worker threads. Backends that fully create their state objects on
+		 * initialization ignore the request.
+		 *
+		 * @param[in]	pipelineState	Pipeline state that will be used for drawing.
+		 * @param[in]	vertexDecl		Declaration of the vertex buffers that will be bound when drawing.
+		 * @param[in]	target			Render target that will be bound when drawing.
+		 * @param[in]	readOnlyFlags	Combination of FrameBufferType flags that control which surfaces of the render
+		 *								target will be bound as read-only.
+		 * @param[in]	drawOp			Type of geometry that will be drawn.
+		 *
+		 * @note	Core thread only.
+		 */
+		virtual void precompileGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+			const SPtr<VertexDeclaration>& vertexDecl, const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+			DrawOperationType drawOp) { }
+
+		/** Blocks the calling thread until all pipelines queued by precompileGraphicsPipeline() are created. */
+		virtual void waitUntilPrecompiled() { }
+
 		/** Gets a sampler state initialized with default options. */
 		const SPtr<SamplerState>& getDefaultSamplerState() const;
 
@@ -244,62 +321,72 @@ namespace bs
 		virtual SPtr<DepthStencilState> createDepthStencilStateInternal(const DEPTH_STENCIL_STATE_DESC& desc, UINT32 id) const;
 
 	private:
-		/**	Triggered when a new sampler state is created. */
-		void notifySamplerStateCreated(const SAMPLER_STATE_DESC& desc, const SPtr<SamplerState>& state) const;
+		/**
+		 * Triggered when a new sampler state is created. If another thread registered a state with the same descriptor
+		 * in the meantime, that state is returned and should be used instead. Otherwise returns @p state.
+		 */
+		SPtr<SamplerState> notifySamplerStateCreated(const SAMPLER_STATE_DESC& desc, UINT64 hash,
+			const SPtr<SamplerState>& state) const;
 
-		/**	Triggered when a new sampler state is created. */
-		void notifyBlendStateCreated(const BLEND_STATE_DESC& desc, const CachedBlendState& state) const;
+		/** @copydoc notifySamplerStateCreated */
+		SPtr<BlendState> notifyBlendStateCreated(const BLEND_STATE_DESC& desc, UINT64 hash,
+			const CachedBlendState& state) const;
 
-		/**	Triggered when a new sampler state is created. */
-		void notifyRasterizerStateCreated(const RASTERIZER_STATE_DESC& desc, const CachedRasterizerState& state) const;
+		/** @copydoc notifySamplerStateCreated */
+		SPtr<RasterizerState> notifyRasterizerStateCreated(const RASTERIZER_STATE_DESC& desc, UINT64 hash,
+			const CachedRasterizerState& state) const;
 
-		/**	Triggered when a new sampler state is created. */
-		void notifyDepthStencilStateCreated(const DEPTH_STENCIL_STATE_DESC& desc, const CachedDepthStencilState& state) const;
+		/** @copydoc notifySamplerStateCreated */
+		SPtr<DepthStencilState> notifyDepthStencilStateCreated(const DEPTH_STENCIL_STATE_DESC& desc, UINT64 hash,
+			const CachedDepthStencilState& state) const;
 
 		/**
 		 * Triggered when the last reference to a specific sampler state is destroyed, which means we must clear our cached
 		 * version as well.
 		 */
-		void notifySamplerStateDestroyed(const SAMPLER_STATE_DESC& desc) const;
+		void notifySamplerStateDestroyed(const SAMPLER_STATE_DESC& desc, UINT64 hash) const;
 
 		/**
 		 * Attempts to find a cached sampler state corresponding to the provided descriptor. Returns null if one doesn't 
 		 * exist.
 		 */
-		SPtr<SamplerState> findCachedState(const SAMPLER_STATE_DESC& desc) const;
+		SPtr<SamplerState> findCachedState(const SAMPLER_STATE_DESC& desc, UINT64 hash) const;
 
 		/**
 		 * Attempts to find a cached blend state corresponding to the provided descriptor. Returns null if one doesn't exist.
 		 */
-		SPtr<BlendState> findCachedState(const BLEND_STATE_DESC& desc, UINT32& id) const;
+		SPtr<BlendState> findCachedState(const BLEND_STATE_DESC& desc, UINT64 hash, UINT32& id) const;
 
 		/**
 		 * Attempts to find a cached rasterizer state corresponding to the provided descriptor. Returns null if one doesn't 
 		 * exist.
 		 */
-		SPtr<RasterizerState> findCachedState(const RASTERIZER_STATE_DESC& desc, UINT32& id) const;
+		SPtr<RasterizerState> findCachedState(const RASTERIZER_STATE_DESC& desc, UINT64 hash, UINT32& id) const;
 
 		/**
 		 * Attempts to find a cached depth-stencil state corresponding to the provided descriptor. Returns null if one 
 		 * doesn't exist.
 		 */
-		SPtr<DepthStencilState> findCachedState(const DEPTH_STENCIL_STATE_DESC& desc, UINT32& id) const;
+		SPtr<DepthStencilState> findCachedState(const DEPTH_STENCIL_STATE_DESC& desc, UINT64 hash, UINT32& id) const;
+
+		/** Builds a key identifying the graphics pipeline state created from the provided descriptor. */
+		static PipelineStateKey getPipelineStateKey(const PIPELINE_STATE_DESC& desc, GpuDeviceFlags deviceMask, 
+			UINT64& hash);
 
 		mutable SPtr<SamplerState> mDefaultSamplerState;
 		mutable SPtr<BlendState> mDefaultBlendState;
 		mutable SPtr<RasterizerState> mDefaultRasterizerState;
 		mutable SPtr<DepthStencilState> mDefaultDepthStencilState;
 
-		mutable UnorderedMap<SAMPLER_STATE_DESC, std::weak_ptr<SamplerState>> mCachedSamplerStates;
-		mutable UnorderedMap<BLEND_STATE_DESC, CachedBlendState> mCachedBlendStates;
-		mutable UnorderedMap<RASTERIZER_STATE_DESC, CachedRasterizerState> mCachedRasterizerStates;
-		mutable UnorderedMap<DEPTH_STENCIL_STATE_DESC, CachedDepthStencilState> mCachedDepthStencilStates;
-
-		mutable UINT32 mNextBlendStateId;
-		mutable UINT32 mNextRasterizerStateId;
-		mutable UINT32 mNextDepthStencilStateId;
+		mutable StateCache<SAMPLER_STATE_DESC, std::weak_ptr<SamplerState>> mCachedSamplerStates;
+		mutable StateCache<BLEND_STATE_DESC, CachedBlendState> mCachedBlendStates;
+		mutable StateCache<RASTERIZER_STATE_DESC, CachedRasterizerState> mCachedRasterizerStates;
+		mutable StateCache<DEPTH_STENCIL_STATE_DESC, CachedDepthStencilState> mCachedDepthStencilStates;
+		mutable StateCache<PipelineStateKey, std::weak_ptr<GraphicsPipelineState>> mCachedGraphicsPipelineStates;
 
-		mutable Mutex mMutex;
+		mutable std::atomic<UINT32> mNextBlendStateId{0};
+		mutable std::atomic<UINT32> mNextRasterizerStateId{0};
+		mutable std::atomic<UINT32> mNextDepthStencilStateId{0};
 	};
 	}
 
@@ -57,13 +57,13 @@ namespace bs
 		RenderWindow* getTopMostModal() const;
 
 		/** Event that is triggered when a window gains focus. */
-		Event<void(RenderWindow&)> onFocusGained;
+		EventST<void(RenderWindow&)> onFocusGained;
 
 		/**	Event that is triggered when a window loses focus. */
-		Event<void(RenderWindow&)> onFocusLost;
+		EventST<void(RenderWindow&)> onFocusLost;
 
 		/**	Event that is triggered when mouse leaves a window. */
-		Event<void(RenderWindow&)> onMouseLeftWindow;
+		EventST<void(RenderWindow&)> onMouseLeftWindow;
 	protected:
 		friend class RenderWindow;
 
@@ -0,0 +1,230 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Managers/BsTextureStreamingManager.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelUtil.h"
+#include "Utility/BsTime.h"
+
+namespace bs
+{
+	void TextureStreamingManager::setBudget(UINT64 budget)
+	{
+		Lock lock(mMutex);
+		mBudget = budget;
+	}
+
+	UINT64 TextureStreamingManager::getBudget() const
+	{
+		Lock lock(mMutex);
+		return mBudget;
+	}
+
+	void TextureStreamingManager::setInitialMipSize(UINT32 size)
+	{
+		Lock lock(mMutex);
+		mInitialMipSize = std::max(size, 1U);
+	}
+
+	UINT32 TextureStreamingManager::getInitialMipSize() const
+	{
+		Lock lock(mMutex);
+		return mInitialMipSize;
+	}
+
+	UINT64 TextureStreamingManager::getResidentMemory() const
+	{
+		Lock lock(mMutex);
+		return mResidentMemory;
+	}
+
+	UINT32 TextureStreamingManager::getInitialMip(const TextureProperties& props) const
+	{
+		UINT32 initialMipSize = getInitialMipSize();
+		UINT32 size = std::max(props.getWidth(), props.getHeight());
+
+		UINT32 mip = 0;
+		while (mip < props.getNumMipmaps() && (size >> mip) > initialMipSize)
+			mip++;
+
+		return mip;
+	}
+
+	void TextureStreamingManager::_notifyRequiredSizes(const UnorderedMap<const ct::Texture*, UINT32>& sizes)
+	{
+		Lock lock(mRequestMutex);
+		for (auto& entry : sizes)
+		{
+			auto iterFind = mRequiredSizes.find(entry.first);
+			if (iterFind != mRequiredSizes.end())
+				iterFind->second = std::max(iterFind->second, entry.second);
+			else
+				mRequiredSizes[entry.first] = entry.second;
+		}
+	}
+
+	void TextureStreamingManager::_registerTexture(Texture* texture)
+	{
+		Lock lock(mMutex);
+
+		// Levels resident on load are kept resident for as long as the texture is alive
+		StreamedTexture& streamedTexture = mTextures[texture];
+		streamedTexture.texture = texture;
+		streamedTexture.core = texture->getCore().get();
+		streamedTexture.initialMip = texture->getResidentMip();
+		streamedTexture.requestedMip = streamedTexture.initialMip;
+		streamedTexture.targetMip = streamedTexture.initialMip;
+		streamedTexture.lastRequestFrame = gTime().getFrameIdx();
+
+		mCoreLookup[streamedTexture.core] = texture;
+		mResidentMemory += getResidentSize(texture->getProperties(), streamedTexture.initialMip);
+	}
+
+	void TextureStreamingManager::_unregisterTexture(Texture* texture)
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mTextures.find(texture);
+		if (iterFind == mTextures.end())
+			return;
+
+		mCoreLookup.erase(iterFind->second.core);
+		mResidentMemory -= getResidentSize(texture->getProperties(), texture->getResidentMip());
+
+		mTextures.erase(iterFind);
+	}
+
+	void TextureStreamingManager::_update()
+	{
+		const UINT64 frameIdx = gTime().getFrameIdx();
+
+		UnorderedMap<const ct::Texture*, UINT32> requiredSizes;
+		{
+			Lock lock(mRequestMutex);
+			std::swap(requiredSizes, mRequiredSizes);
+		}
+
+		Lock lock(mMutex);
+
+		// Find the levels required by the renderer
+		for (auto& entry : requiredSizes)
+		{
+			auto iterFind = mCoreLookup.find(entry.first);
+			if (iterFind == mCoreLookup.end())
+				continue; // Not streamed, or the texture's core object was replaced since
+
+			StreamedTexture& streamedTexture = mTextures[iterFind->second];
+			UINT32 mip = getMipForSize(streamedTexture.texture->getProperties(), entry.second);
+
+			if (streamedTexture.lastRequestFrame != frameIdx)
+			{
+				streamedTexture.requestedMip = mip;
+				streamedTexture.lastRequestFrame = frameIdx;
+			}
+			else
+				streamedTexture.requestedMip = std::min(streamedTexture.requestedMip, mip);
+		}
+
+		// Textures that haven't been rendered in a while only keep their initial levels
+		Vector<StreamedTexture*> textures;
+		textures.reserve(mTextures.size());
+
+		UINT64 totalSize = 0;
+		for (auto& entry : mTextures)
+		{
+			StreamedTexture& streamedTexture = entry.second;
+
+			bool recentlyUsed = (streamedTexture.lastRequestFrame + NUM_UNUSED_FRAMES_BEFORE_EVICT) >= frameIdx;
+			if (recentlyUsed)
+				streamedTexture.targetMip = std::min(streamedTexture.requestedMip, streamedTexture.initialMip);
+			else
+				streamedTexture.targetMip = streamedTexture.initialMip;
+
+			totalSize += getResidentSize(streamedTexture.texture->getProperties(), streamedTexture.targetMip);
+			textures.push_back(&streamedTexture);
+		}
+
+		// If over budget, drop the most detailed levels of the least recently rendered textures first
+		std::sort(textures.begin(), textures.end(),
+			[](const StreamedTexture* lhs, const StreamedTexture* rhs)
+		{
+			return lhs->lastRequestFrame < rhs->lastRequestFrame;
+		});
+
+		for (auto& streamedTexture : textures)
+		{
+			if (totalSize <= mBudget)
+				break;
+
+			const TextureProperties& props = streamedTexture->texture->getProperties();
+			while (totalSize > mBudget && streamedTexture->targetMip < streamedTexture->initialMip)
+			{
+				totalSize -= getResidentSize(props, streamedTexture->targetMip) -
+					getResidentSize(props, streamedTexture->targetMip + 1);
+
+				streamedTexture->targetMip++;
+			}
+		}
+
+		auto setResidentMip = [this](StreamedTexture& streamedTexture)
+		{
+			Texture* texture = streamedTexture.texture;
+			const TextureProperties& props = texture->getProperties();
+
+			mResidentMemory -= getResidentSize(props, texture->getResidentMip());
+			mCoreLookup.erase(streamedTexture.core);
+
+			texture->_setResidentMip(streamedTexture.targetMip);
+
+			streamedTexture.core = texture->getCore().get();
+			mCoreLookup[streamedTexture.core] = texture;
+			mResidentMemory += getResidentSize(props, texture->getResidentMip());
+		};
+
+		// Evict first to free up memory for any levels being streamed in
+		for (auto& streamedTexture : textures)
+		{
+			if (streamedTexture->targetMip > streamedTexture->texture->getResidentMip())
+				setResidentMip(*streamedTexture);
+		}
+
+		// Streaming in requires an upload, spread those over multiple frames. Most recently rendered textures go first.
+		UINT32 numStreamIns = 0;
+		for (auto iter = textures.rbegin(); iter != textures.rend(); ++iter)
+		{
+			if (numStreamIns >= MAX_STREAM_INS_PER_FRAME)
+				break;
+
+			StreamedTexture& streamedTexture = **iter;
+			if (streamedTexture.targetMip < streamedTexture.texture->getResidentMip())
+			{
+				setResidentMip(streamedTexture);
+				numStreamIns++;
+			}
+		}
+	}
+
+	UINT32 TextureStreamingManager::getMipForSize(const TextureProperties& props, UINT32 size)
+	{
+		UINT32 textureSize = std::max(props.getWidth(), props.getHeight());
+
+		UINT32 mip = 0;
+		while (mip < props.getNumMipmaps() && (textureSize >> (mip + 1)) >= size)
+			mip++;
+
+		return mip;
+	}
+
+	UINT64 TextureStreamingManager::getResidentSize(const TextureProperties& props, UINT32 mip)
+	{
+		UINT64 size = 0;
+		for (UINT32 i = mip; i <= props.getNumMipmaps(); i++)
+		{
+			UINT32 width, height, depth;
+			PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), i, width, height, depth);
+
+			size += PixelUtil::getMemorySize(width, height, depth, props.getFormat());
+		}
+
+		return size * props.getNumFaces();
+	}
+}
@@ -0,0 +1,116 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Decides which mip levels of streamed textures (see TU_STREAMED) are present on the GPU. Textures initially only
+	 * have their low resolution mip levels resident. The renderer reports the on-screen size of the textures it renders,
+	 * and higher resolution levels get streamed in as required. When the memory used by streamed textures exceeds the
+	 * budget, the high resolution levels of the least recently rendered textures are evicted first.
+	 *
+	 * @note	Sim thread only unless noted otherwise.
+	 */
+	class BS_CORE_EXPORT TextureStreamingManager : public Module<TextureStreamingManager>
+	{
+		/** Information about a single streamed texture. */
+		struct StreamedTexture
+		{
+			Texture* texture = nullptr;
+			const ct::Texture* core = nullptr;
+			UINT32 initialMip = 0; /**< Most detailed level resident on load. Less detailed levels are never evicted. */
+			UINT32 requestedMip = 0;
+			UINT32 targetMip = 0;
+			UINT64 lastRequestFrame = 0;
+		};
+
+	public:
+		/**
+		 * Sets the maximum amount of GPU memory, in bytes, used by the resident mip levels of all streamed textures. Low
+		 * resolution levels loaded initially are always kept resident, even if they exceed the budget.
+		 */
+		void setBudget(UINT64 budget);
+
+		/** @copydoc setBudget */
+		UINT64 getBudget() const;
+
+		/**
+		 * Sets the maximum size (width or height) of the most detailed mip level uploaded when a streamed texture is
+		 * loaded. Higher resolution levels are only uploaded once required. Only affects textures loaded afterwards.
+		 */
+		void setInitialMipSize(UINT32 size);
+
+		/** @copydoc setInitialMipSize */
+		UINT32 getInitialMipSize() const;
+
+		/** Returns the amount of GPU memory, in bytes, currently used by the resident mip levels of streamed textures. */
+		UINT64 getResidentMemory() const;
+
+		/** Returns the most detailed mip level resident for a texture with the provided properties when it is loaded. */
+		UINT32 getInitialMip(const TextureProperties& props) const;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Notifies the manager of the size, in pixels, textures were rendered at. Called by the renderer once it determines
+		 * which objects are visible. Textures that aren't streamed are ignored.
+		 *
+		 * @note	Thread safe.
+		 */
+		void _notifyRequiredSizes(const UnorderedMap<const ct::Texture*, UINT32>& sizes);
+
+		/**
+		 * Registers a texture whose mip levels should be streamed. Called by the texture once initialized.
+		 *
+		 * @note	Thread safe.
+		 */
+		void _registerTexture(Texture* texture);
+
+		/**
+		 * Unregisters a texture registered with _registerTexture(). Called by the texture when destroyed.
+		 *
+		 * @note	Thread safe.
+		 */
+		void _unregisterTexture(Texture* texture);
+
+		/** Processes the sizes reported by the renderer and streams mip levels in or out as required. Called once per frame. */
+		void _update();
+
+		/** @} */
+	private:
+		/** Number of frames a texture needs to go unrendered before its high resolution levels are evicted. */
+		static constexpr UINT32 NUM_UNUSED_FRAMES_BEFORE_EVICT = 120;
+
+		/** Maximum number of textures to stream additional mip levels in for, per frame. */
+		static constexpr UINT32 MAX_STREAM_INS_PER_FRAME = 4;
+
+		/** Returns the most detailed mip level of a texture with the provided properties required at the specified size. */
+		static UINT32 getMipForSize(const TextureProperties& props, UINT32 size);
+
+		/** Returns the GPU memory, in bytes, used by a texture when all levels starting at @p mip are resident. */
+		static UINT64 getResidentSize(const TextureProperties& props, UINT32 mip);
+
+		UnorderedMap<Texture*, StreamedTexture> mTextures;
+		UnorderedMap<const ct::Texture*, Texture*> mCoreLookup;
+		UnorderedMap<const ct::Texture*, UINT32> mRequiredSizes;
+
+		UINT64 mBudget = 512 * 1024 * 1024;
+		UINT32 mInitialMipSize = 128;
+		UINT64 mResidentMemory = 0;
+
+		mutable Mutex mMutex;
+		Mutex mRequestMutex;
+	};
+
+	/** @} */
+}
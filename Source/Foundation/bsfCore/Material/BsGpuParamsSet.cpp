@@ -467,6 +467,74 @@ namespace bs
 		return validParams;
 	}
 
+	/**
+	 * Keeps track of parameter block buffers shared between multiple parameter sets. Buffers are identified by a key
+	 * derived from the block layout and the contents of the buffer, and are reference counted so they get released once
+	 * no set references them.
+	 */
+	template<bool Core>
+	class SharedParamBlockPool
+	{
+		typedef typename TGpuParamBlockBufferPtrType<Core>::Type ParamBlockPtrType;
+		typedef typename TGpuParamBlockBufferType<Core>::Type ParamBlockType;
+
+		struct Entry
+		{
+			ParamBlockPtrType buffer;
+			UINT32 refCount;
+		};
+
+	public:
+		/** 
+		 * Returns a buffer with the specified key, creating a new one if one doesn't exist. @p created is set to true if a
+		 * new buffer was created. Each call must be paired with a call to release().
+		 */
+		ParamBlockPtrType acquire(UINT64 key, UINT32 size, bool& created)
+		{
+			Lock lock(mMutex);
+
+			auto iterFind = mEntries.find(key);
+			if (iterFind != mEntries.end())
+			{
+				iterFind->second.refCount++;
+
+				created = false;
+				return iterFind->second.buffer;
+			}
+
+			// Contents of shared buffers are written once, by the set that creates them
+			ParamBlockPtrType buffer = ParamBlockType::create(size, GPBU_STATIC);
+			mEntries[key] = { buffer, 1 };
+
+			created = true;
+			return buffer;
+		}
+
+		/** Releases a buffer previously retrieved from acquire(). */
+		void release(UINT64 key)
+		{
+			Lock lock(mMutex);
+
+			auto iterFind = mEntries.find(key);
+			if (iterFind == mEntries.end())
+				return;
+
+			if (--iterFind->second.refCount == 0)
+				mEntries.erase(iterFind);
+		}
+
+		/** Returns the global pool instance. */
+		static SharedParamBlockPool& instance()
+		{
+			static SharedParamBlockPool pool;
+			return pool;
+		}
+
+	private:
+		UnorderedMap<UINT64, Entry> mEntries;
+		Mutex mMutex;
+	};
+
 	template<bool Core>
 	const UINT32 TGpuParamsSet<Core>::NUM_STAGES = 6;
 
@@ -477,6 +545,10 @@ namespace bs
 	{
 		UINT32 numPasses = technique->getNumPasses();
 
+		size_t layoutKey = 0;
+		hash_combine(layoutKey, technique.get());
+		mLayoutKey = (UINT64)layoutKey;
+
 		// Create GpuParams for each pass and shader stage
 		for (UINT32 i = 0; i < numPasses; i++)
 		{
@@ -794,11 +866,66 @@ namespace bs
 			bs_frame_free(offsets);
 		}
 		bs_frame_clear();
+
+		// Build a lookup from each material parameter to all the locations it is written to, so that update() can
+		// process only the modified parameters
+		auto forEachParamRef = [&](auto func)
+		{
+			for (UINT32 i = 0; i < (UINT32)mDataParamInfos.size(); i++)
+				func(mDataParamInfos[i].paramIdx, ParamUpdateRef{ ParamUpdateType::Data, 0, 0, i });
+
+			for (UINT32 i = 0; i < numPasses; i++)
+			{
+				for (UINT32 j = 0; j < NUM_STAGES; j++)
+				{
+					const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+
+					for (UINT32 k = 0; k < stageInfo.numTextures; k++)
+						func(stageInfo.textures[k].paramIdx, ParamUpdateRef{ ParamUpdateType::Texture, i, j, k });
+
+					for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
+					{
+						func(stageInfo.loadStoreTextures[k].paramIdx, 
+							ParamUpdateRef{ ParamUpdateType::LoadStoreTexture, i, j, k });
+					}
+
+					for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
+						func(stageInfo.buffers[k].paramIdx, ParamUpdateRef{ ParamUpdateType::Buffer, i, j, k });
+
+					for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
+					{
+						func(stageInfo.samplerStates[k].paramIdx, 
+							ParamUpdateRef{ ParamUpdateType::SamplerState, i, j, k });
+					}
+				}
+			}
+		};
+
+		UINT32 numParams = params->getNumParams();
+		mParamUpdateOffsets.resize(numParams + 1, 0);
+		forEachParamRef([&](UINT32 paramIdx, const ParamUpdateRef& ref) { mParamUpdateOffsets[paramIdx + 1]++; });
+
+		for (UINT32 i = 0; i < numParams; i++)
+			mParamUpdateOffsets[i + 1] += mParamUpdateOffsets[i];
+
+		mParamUpdateRefs.resize(mParamUpdateOffsets[numParams]);
+
+		Vector<UINT32> writeOffsets(mParamUpdateOffsets.begin(), mParamUpdateOffsets.end() - 1);
+		forEachParamRef([&](UINT32 paramIdx, const ParamUpdateRef& ref) { mParamUpdateRefs[writeOffsets[paramIdx]++] = ref; });
+
+		for (auto& paramInfo : mDataParamInfos)
+			mBlocks[paramInfo.blockIdx].hasDataParams = true;
 	}
 
 	template<bool Core>
 	TGpuParamsSet<Core>::~TGpuParamsSet()
 	{
+		for (auto& block : mBlocks)
+		{
+			if (block.sharedKey != 0)
+				SharedParamBlockPool<Core>::instance().release(block.sharedKey);
+		}
+
 		// All allocations share the same memory, so we just clear it all at once
 		bs_free(mData);
 	}
@@ -813,12 +940,12 @@ namespace bs
 	}
 
 	template<bool Core>
-	UINT32 TGpuParamsSet<Core>::getParamBlockBufferIndex(const String& name) const
+	UINT32 TGpuParamsSet<Core>::getParamBlockBufferIndex(const StringID& name) const
 	{
 		for (UINT32 i = 0; i < (UINT32)mBlocks.size(); i++)
 		{
 			const BlockInfo& block = mBlocks[i];
-			if (block.name == name)
+			if (block.id == name)
 				return i;
 		}
 
@@ -841,6 +968,15 @@ namespace bs
 			return;
 
 		blockInfo.allowUpdate = !ignoreInUpdate;
+		blockInfo.isExternal = true;
+
+		if (blockInfo.sharedKey != 0)
+		{
+			SharedParamBlockPool<Core>::instance().release(blockInfo.sharedKey);
+
+			blockInfo.sharedKey = 0;
+			blockInfo.isSharedCopy = false;
+		}
 
 		if (blockInfo.buffer != paramBlock)
 		{
@@ -864,13 +1000,14 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TGpuParamsSet<Core>::setParamBlockBuffer(const String& name, const ParamBlockPtrType& paramBlock, 
+	void TGpuParamsSet<Core>::setParamBlockBuffer(const StringID& name, const ParamBlockPtrType& paramBlock, 
 		bool ignoreInUpdate)
 	{
 		UINT32 bufferIdx = getParamBlockBufferIndex(name);
 		if(bufferIdx == (UINT32)-1)
 		{
-			LOGERR("Cannot set parameter block buffer with the name \"" + name + "\". Buffer name not found. ");
+			LOGERR("Cannot set parameter block buffer with the name \"" + String(name.cstr()) + 
+				"\". Buffer name not found. ");
 			return;
 		}
 
@@ -880,107 +1017,69 @@ namespace bs
 	template<bool Core>
 	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, bool updateAll)
 	{
-		// Note: Instead of iterating over every single parameter, it might be more efficient for @p params to keep
-		// a ring buffer and a version number. Then we could just iterate over the ring buffer and only access dirty
-		// parameters. If the version number is too high (larger than ring buffer can store), then we force update for all.
+		bool transposeMatrices = ct::RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ColumnMajorMatrices);
 
-		// Update data params
-		for(auto& paramInfo : mDataParamInfos)
+		// Move to buffers shared by sets with the same data parameter values, before any data is written, so that the
+		// buffers shared with other sets are never modified
+		if (mShareParamBlocks)
 		{
-			ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
-			if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
-				continue;
-
-			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-			if (materialParamInfo->version <= mParamVersion && !updateAll)
-				continue;
+			UINT64 dataHash = params->getDataHash();
+			if (dataHash != mSharedDataHash)
+			{
+				if (bindSharedParamBlocks(dataHash))
+					updateAll = true;
 
-			UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
-			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
-			UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
+				mSharedDataHash = dataHash;
+			}
+		}
 
-			UINT8* data = params->getData(materialParamInfo->index);
+		// If the parameters keep track of all modifications since the last update, only update the modified parameters
+		if (!updateAll)
+		{
+			assert(mPassParams.size() < 64);
+			UINT64 dirtyPasses = 0;
 
-			bool transposeMatrices = ct::RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ColumnMajorMatrices);
-			if (transposeMatrices)
+			bool tracked = params->forEachDirtyParam(mParamVersion, [&](UINT32 paramIdx)
 			{
-				auto writeTransposed = [&](auto& temp)
+				if (paramIdx + 1 >= (UINT32)mParamUpdateOffsets.size())
+					return;
+
+				for (UINT32 i = mParamUpdateOffsets[paramIdx]; i < mParamUpdateOffsets[paramIdx + 1]; i++)
 				{
-					for (UINT32 i = 0; i < arraySize; i++)
+					const ParamUpdateRef& ref = mParamUpdateRefs[i];
+					if (ref.type == ParamUpdateType::Data)
+						updateDataParam(*params, mDataParamInfos[ref.entryIdx], transposeMatrices);
+					else
 					{
-						UINT32 arrayOffset = i * paramSize;
-						memcpy(&temp, data + arrayOffset, paramSize);
-						auto transposed = temp.transpose();
+						const StageParamInfo& stageInfo = mPassParamInfos[ref.passIdx].stages[ref.stageIdx];
+						updateObjectParam(*params, ref.type, *mPassParams[ref.passIdx], stageInfo, ref.entryIdx);
 
-						paramBlock->write((paramInfo.offset + arrayOffset) * sizeof(UINT32), &transposed, paramSize);
+						dirtyPasses |= 1ULL << ref.passIdx;
 					}
-				};
-
-				switch (materialParamInfo->dataType)
-				{
-				case GPDT_MATRIX_2X2:
-				{
-					MatrixNxM<2, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X3:
-				{
-					MatrixNxM<2, 3> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X4:
-				{
-					MatrixNxM<2, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X2:
-				{
-					MatrixNxM<3, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X3:
-				{
-					Matrix3 matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X4:
-				{
-					MatrixNxM<3, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X2:
-				{
-					MatrixNxM<4, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X3:
-				{
-					MatrixNxM<4, 3> matrix;
-					writeTransposed(matrix);
 				}
-					break;
-				case GPDT_MATRIX_4X4:
-				{
-					Matrix4 matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				default:
+			});
+
+			if (tracked)
+			{
+				for (UINT32 i = 0; i < (UINT32)mPassParams.size(); i++)
 				{
-					paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
-					break;
-				}
+					if ((dirtyPasses & (1ULL << i)) != 0)
+						mPassParams[i]->_markCoreDirty();
 				}
+
+				mParamVersion = params->getParamVersion();
+				return;
 			}
-			else
-				paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+		}
+
+		// Update data params
+		for(auto& paramInfo : mDataParamInfos)
+		{
+			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
+			if (materialParamInfo->version <= mParamVersion && !updateAll)
+				continue;
+
+			updateDataParam(*params, paramInfo, transposeMatrices);
 		}
 
 		// Update object params
@@ -994,69 +1093,286 @@ namespace bs
 			{
 				const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
 
-				for(UINT32 k = 0; k < stageInfo.numTextures; k++)
+				auto updateObjectParams = [&](ParamUpdateType type, const ObjectParamInfo* paramInfos, UINT32 numParams)
 				{
-					const ObjectParamInfo& paramInfo = stageInfo.textures[k];
+					for(UINT32 k = 0; k < numParams; k++)
+					{
+						const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfos[k].paramIdx);
+						if (materialParamInfo->version <= mParamVersion && !updateAll)
+							continue;
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+						updateObjectParam(*params, type, *paramPtr, stageInfo, k);
+					}
+				};
 
-					TextureSurface surface;
-					TextureType texture;
-					params->getTexture(*materialParamInfo, texture, surface);
+				updateObjectParams(ParamUpdateType::Texture, stageInfo.textures, stageInfo.numTextures);
+				updateObjectParams(ParamUpdateType::LoadStoreTexture, stageInfo.loadStoreTextures, 
+					stageInfo.numLoadStoreTextures);
+				updateObjectParams(ParamUpdateType::Buffer, stageInfo.buffers, stageInfo.numBuffers);
+				updateObjectParams(ParamUpdateType::SamplerState, stageInfo.samplerStates, stageInfo.numSamplerStates);
+			}
 
-					paramPtr->setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
-				}
+			paramPtr->_markCoreDirty();
+		}
 
-				for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.loadStoreTextures[k];
+		mParamVersion = params->getParamVersion();
+	}
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateDataParam(const MaterialParamsType& params, const DataParamInfo& paramInfo, 
+		bool transposeMatrices)
+	{
+		const BlockInfo& block = mBlocks[paramInfo.blockIdx];
+		if (block.buffer == nullptr || !block.allowUpdate || block.isSharedCopy)
+			return;
 
-					TextureSurface surface;
-					TextureType texture;
-					params->getLoadStoreTexture(*materialParamInfo, texture, surface);
+		const ParamBlockPtrType& paramBlock = block.buffer;
 
-					paramPtr->setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
-				}
+		const MaterialParams::ParamData* materialParamInfo = params.getParamData(paramInfo.paramIdx);
 
-				for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.buffers[k];
+		UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
+		const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
+		UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+		UINT8* data = params.getData(materialParamInfo->index);
 
-					BufferType buffer;
-					params->getBuffer(*materialParamInfo, buffer);
+		if (transposeMatrices)
+		{
+			auto writeTransposed = [&](auto& temp)
+			{
+				for (UINT32 i = 0; i < arraySize; i++)
+				{
+					UINT32 arrayOffset = i * paramSize;
+					memcpy(&temp, data + arrayOffset, paramSize);
+					auto transposed = temp.transpose();
 
-					paramPtr->setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
+					paramBlock->write((paramInfo.offset + arrayOffset) * sizeof(UINT32), &transposed, paramSize);
 				}
+			};
 
-				for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.samplerStates[k];
+			switch (materialParamInfo->dataType)
+			{
+			case GPDT_MATRIX_2X2:
+			{
+				MatrixNxM<2, 2> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_2X3:
+			{
+				MatrixNxM<2, 3> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_2X4:
+			{
+				MatrixNxM<2, 4> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_3X2:
+			{
+				MatrixNxM<3, 2> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_3X3:
+			{
+				Matrix3 matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_3X4:
+			{
+				MatrixNxM<3, 4> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_4X2:
+			{
+				MatrixNxM<4, 2> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_4X3:
+			{
+				MatrixNxM<4, 3> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_4X4:
+			{
+				Matrix4 matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			default:
+			{
+				paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+				break;
+			}
+			}
+		}
+		else
+			paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+	}
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateObjectParam(const MaterialParamsType& params, ParamUpdateType type, 
+		GpuParamsType& gpuParams, const StageParamInfo& stageInfo, UINT32 entryIdx)
+	{
+		switch(type)
+		{
+		case ParamUpdateType::Texture:
+		{
+			const ObjectParamInfo& paramInfo = stageInfo.textures[entryIdx];
+			const MaterialParams::ParamData* materialParamInfo = params.getParamData(paramInfo.paramIdx);
 
-					SamplerStateType samplerState;
-					params->getSamplerState(*materialParamInfo, samplerState);
+			TextureSurface surface;
+			TextureType texture;
+			params.getTexture(*materialParamInfo, texture, surface);
 
-					paramPtr->setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
-				}
-			}
+			gpuParams.setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+		}
+			break;
+		case ParamUpdateType::LoadStoreTexture:
+		{
+			const ObjectParamInfo& paramInfo = stageInfo.loadStoreTextures[entryIdx];
+			const MaterialParams::ParamData* materialParamInfo = params.getParamData(paramInfo.paramIdx);
 
-			paramPtr->_markCoreDirty();
+			TextureSurface surface;
+			TextureType texture;
+			params.getLoadStoreTexture(*materialParamInfo, texture, surface);
+
+			gpuParams.setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
 		}
+			break;
+		case ParamUpdateType::Buffer:
+		{
+			const ObjectParamInfo& paramInfo = stageInfo.buffers[entryIdx];
+			const MaterialParams::ParamData* materialParamInfo = params.getParamData(paramInfo.paramIdx);
 
-		mParamVersion = params->getParamVersion();
+			BufferType buffer;
+			params.getBuffer(*materialParamInfo, buffer);
+
+			gpuParams.setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
+		}
+			break;
+		case ParamUpdateType::SamplerState:
+		{
+			const ObjectParamInfo& paramInfo = stageInfo.samplerStates[entryIdx];
+			const MaterialParams::ParamData* materialParamInfo = params.getParamData(paramInfo.paramIdx);
+
+			SamplerStateType samplerState;
+			params.getSamplerState(*materialParamInfo, samplerState);
+
+			gpuParams.setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
+		}
+			break;
+		default:
+			break;
+		}
+	}
+
+	template<bool Core>
+	void TGpuParamsSet<Core>::setShareParamBlocks(bool share)
+	{
+		if (mShareParamBlocks == share)
+			return;
+
+		mShareParamBlocks = share;
+		mSharedDataHash = 0;
+
+		if (!share)
+			unbindSharedParamBlocks();
+	}
+
+	template<bool Core>
+	bool TGpuParamsSet<Core>::bindSharedParamBlocks(UINT64 dataHash)
+	{
+		SharedParamBlockPool<Core>& pool = SharedParamBlockPool<Core>::instance();
+
+		bool anyCreated = false;
+		for (UINT32 i = 0; i < (UINT32)mBlocks.size(); i++)
+		{
+			BlockInfo& block = mBlocks[i];
+			if (!block.hasDataParams || block.isExternal || !block.allowUpdate || block.buffer == nullptr)
+				continue;
+
+			UINT32 size = block.buffer->getSize();
+
+			size_t key = (size_t)mLayoutKey;
+			hash_combine(key, i);
+			hash_combine(key, size);
+			hash_combine(key, dataHash);
+
+			// Zero is reserved for non-shared blocks
+			if (key == 0)
+				key = 1;
+
+			if ((UINT64)key == block.sharedKey)
+				continue;
+
+			bool created;
+			ParamBlockPtrType buffer = pool.acquire((UINT64)key, size, created);
+
+			if (block.sharedKey != 0)
+				pool.release(block.sharedKey);
+
+			rebindParamBlock(block, buffer);
+			block.sharedKey = (UINT64)key;
+			block.isSharedCopy = !created;
+
+			anyCreated |= created;
+		}
+
+		return anyCreated;
+	}
+
+	template<bool Core>
+	void TGpuParamsSet<Core>::unbindSharedParamBlocks()
+	{
+		bool anyUnbound = false;
+		for (auto& block : mBlocks)
+		{
+			if (block.sharedKey == 0)
+				continue;
+
+			rebindParamBlock(block, ParamBlockType::create(block.buffer->getSize()));
+			SharedParamBlockPool<Core>::instance().release(block.sharedKey);
+
+			block.sharedKey = 0;
+			block.isSharedCopy = false;
+			anyUnbound = true;
+		}
+
+		// Newly created buffers need to be fully populated on next update
+		if (anyUnbound)
+			mParamVersion = 0;
+	}
+
+	template<bool Core>
+	void TGpuParamsSet<Core>::rebindParamBlock(BlockInfo& block, const ParamBlockPtrType& buffer)
+	{
+		UINT32 numPasses = (UINT32)mPassParams.size();
+		for (UINT32 j = 0; j < numPasses; j++)
+		{
+			SPtr<GpuParamsType> paramPtr = mPassParams[j];
+			for (UINT32 i = 0; i < NUM_STAGES; i++)
+			{
+				const BlockBinding& binding = block.passData[j].bindings[i];
+				if (binding.slot == (UINT32)-1)
+					continue;
+
+				// Leave bindings overriden directly through GpuParams, or belonging to a different block of the same name
+				if (paramPtr->getParamBlockBuffer(binding.set, binding.slot) != block.buffer)
+					continue;
+
+				paramPtr->setParamBlockBuffer(binding.set, binding.slot, buffer);
+			}
+		}
+
+		block.buffer = buffer;
 	}
 
 	template class TGpuParamsSet <false>;
@@ -52,17 +52,23 @@ namespace bs
 		struct BlockInfo
 		{
 			BlockInfo(const String& name, UINT32 set, UINT32 slot, const ParamBlockPtrType& buffer, bool shareable)
-				: name(name), set(set), slot(slot), buffer(buffer), shareable(shareable), allowUpdate(true), isUsed(true)
+				: name(name), id(name), set(set), slot(slot), buffer(buffer), shareable(shareable), allowUpdate(true)
+				, isUsed(true), isExternal(false), hasDataParams(false), isSharedCopy(false), sharedKey(0)
 				, passData(nullptr)
 			{ }
 
 			String name;
+			StringID id; // Interned name, used for fast lookups by name
 			UINT32 set;
 			UINT32 slot;
 			ParamBlockPtrType buffer;
 			bool shareable;
 			bool allowUpdate;
 			bool isUsed;
+			bool isExternal; // Assigned through setParamBlockBuffer()
+			bool hasDataParams; // Populated from material data parameters
+			bool isSharedCopy; // Bound to a shared buffer whose contents were populated by another set
+			UINT64 sharedKey; // Key of the shared buffer the block is bound to, or 0 if not shared
 
 			PassBlockBindings* passData;
 		};
@@ -102,6 +108,25 @@ namespace bs
 			StageParamInfo stages[GPT_COUNT];
 		};
 
+		/** Types of locations a material parameter can be written to. */
+		enum class ParamUpdateType
+		{
+			Data, Texture, LoadStoreTexture, Buffer, SamplerState
+		};
+
+		/**
+		 * Reference to a single location a material parameter is written to. For data parameters @p entryIdx is an index
+		 * into the data parameter list, otherwise it is an index into the object parameter list of the relevant type, for
+		 * the specified pass and stage.
+		 */
+		struct ParamUpdateRef
+		{
+			ParamUpdateType type;
+			UINT32 passIdx;
+			UINT32 stageIdx;
+			UINT32 entryIdx;
+		};
+
 	public:
 		TGpuParamsSet() {}
 		TGpuParamsSet(const SPtr<TechniqueType>& technique, const ShaderType& shader,
@@ -121,7 +146,7 @@ namespace bs
 		 * Searches for a parameter block buffer with the specified name, and returns an index you can use for accessing it.
 		 * Returns -1 if buffer was not found.
 		 */
-		UINT32 getParamBlockBufferIndex(const String& name) const;
+		UINT32 getParamBlockBufferIndex(const StringID& name) const;
 
 		/**
 		 * Assign a parameter block buffer with the specified index to all the relevant child GpuParams.
@@ -153,7 +178,8 @@ namespace bs
 		 * potentially sharing parameters between multiple materials. This reduces driver overhead as the parameters
 		 * in the buffers need only be set once and then reused multiple times.
 		 */
-		void setParamBlockBuffer(const String& name, const ParamBlockPtrType& paramBlock, bool ignoreInUpdate = false);
+		void setParamBlockBuffer(const StringID& name, const ParamBlockPtrType& paramBlock,
+			bool ignoreInUpdate = false);
 
 		/** Returns the number of passes the set contains the parameters for. */
 		UINT32 getNumPasses() const { return (UINT32)mPassParams.size(); }
@@ -169,17 +195,59 @@ namespace bs
 		 */
 		void update(const SPtr<MaterialParamsType>& params, bool updateAll = false);
 
+		/**
+		 * Determines if parameter block buffers populated from material data parameters should be shared with other
+		 * parameter sets. When enabled, all sets created from the same technique, whose material data parameters have
+		 * identical values, will reference the same buffers. This reduces memory use and the number of buffer uploads when
+		 * many materials use the same parameter values. As soon as the parameter values of a set diverge the set is moved
+		 * to a different buffer, so shared buffers are never modified. Buffers assigned through setParamBlockBuffer() are
+		 * never shared. Takes effect on the next call to update().
+		 *
+		 * @note	
+		 * Parameters in shared buffers must only be modified through the material, and not directly through the
+		 * GpuParams of the set.
+		 */
+		void setShareParamBlocks(bool share);
+
 		static const UINT32 NUM_STAGES;
 	private:
 		template<bool Core2> friend class TMaterial;
 
+		/** Writes the value of a material data parameter into its parameter block buffer. */
+		void updateDataParam(const MaterialParamsType& params, const DataParamInfo& paramInfo, bool transposeMatrices);
+
+		/** Assigns the value of a material object parameter to the GPU parameters, for a single object parameter entry. */
+		void updateObjectParam(const MaterialParamsType& params, ParamUpdateType type, GpuParamsType& gpuParams, 
+			const StageParamInfo& stageInfo, UINT32 entryIdx);
+
+		/**
+		 * Binds shared parameter block buffers for all blocks populated from material data parameters, for material
+		 * parameters with the provided data hash. Returns true if any of the bound buffers were newly created, in which
+		 * case their contents still need to be populated.
+		 */
+		bool bindSharedParamBlocks(UINT64 dataHash);
+
+		/** Releases all shared parameter block buffers used by the set, and replaces them with newly created ones. */
+		void unbindSharedParamBlocks();
+
+		/** Assigns a new buffer to the provided block, in all GpuParams still referencing its current buffer. */
+		void rebindParamBlock(BlockInfo& block, const ParamBlockPtrType& buffer);
+
 		Vector<SPtr<GpuParamsType>> mPassParams;
 		Vector<BlockInfo> mBlocks;
 		Vector<DataParamInfo> mDataParamInfos;
 		PassParamInfo* mPassParamInfos;
 
+		// For each material parameter, a range in mParamUpdateRefs containing all locations the parameter is written to
+		Vector<UINT32> mParamUpdateOffsets;
+		Vector<ParamUpdateRef> mParamUpdateRefs;
+
 		UINT64 mParamVersion;
 		UINT8* mData;
+
+		UINT64 mLayoutKey = 0;
+		UINT64 mSharedDataHash = 0;
+		bool mShareParamBlocks = false;
 	};
 
 	/** Sim thread version of TGpuParamsSet<Core>. */
@@ -58,6 +58,20 @@ namespace bs
 	{
 		paramsSet->update(mParams, updateAll);
 	}
+
+	template<bool Core>
+	UINT32 TMaterial<Core>::getGroupId() const
+	{
+		if (mParams == nullptr)
+			return 0;
+
+		size_t hash = (size_t)mParams->getHash();
+		for (auto& entry : mTechniques)
+			hash_combine(hash, entry.get());
+
+		UINT64 hash64 = (UINT64)hash;
+		return (UINT32)(hash64 ^ (hash64 >> 32));
+	}
 	
 	template<bool Core>
 	UINT32 TMaterial<Core>::findTechnique(const FIND_TECHNIQUE_DESC& desc) const
@@ -105,6 +119,14 @@ namespace bs
 				return i;
 		}
 
+		// Variation might be compiled on demand, in which case start compiling it so it's available in the future
+		if(desc.variation && isShaderValid(mShader))
+		{
+			const SPtr<ShaderLazyVariations>& lazyVariations = mShader->getLazyVariations();
+			if(lazyVariations)
+				lazyVariations->request(*desc.variation);
+		}
+
 		return (UINT32)-1;
 		
 	}
@@ -149,7 +171,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamStruct<Core> TMaterial<Core>::getParamStruct(const String& name) const
+	TMaterialParamStruct<Core> TMaterial<Core>::getParamStruct(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -157,7 +179,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamTexture<Core> TMaterial<Core>::getParamTexture(const String& name) const
+	TMaterialParamTexture<Core> TMaterial<Core>::getParamTexture(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -165,7 +187,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamLoadStoreTexture<Core> TMaterial<Core>::getParamLoadStoreTexture(const String& name) const
+	TMaterialParamLoadStoreTexture<Core> TMaterial<Core>::getParamLoadStoreTexture(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -173,7 +195,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamBuffer<Core> TMaterial<Core>::getParamBuffer(const String& name) const
+	TMaterialParamBuffer<Core> TMaterial<Core>::getParamBuffer(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -181,7 +203,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamSampState<Core> TMaterial<Core>::getParamSamplerState(const String& name) const
+	TMaterialParamSampState<Core> TMaterial<Core>::getParamSamplerState(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -341,7 +363,7 @@ namespace bs
 
 	template <bool Core>
 	template <typename T>
-	void TMaterial<Core>::getParam(const String& name, TMaterialDataParam<T, Core>& output) const
+	void TMaterial<Core>::getParam(const StringID& name, TMaterialDataParam<T, Core>& output) const
 	{
 		throwIfNotInitialized();
 
@@ -365,43 +387,43 @@ namespace bs
 	template class TMaterial < false > ;
 	template class TMaterial < true > ;
 
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<float, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<int, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Color, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector2, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector3, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector4, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector2I, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector3I, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector4I, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix2, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix2x3, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix2x4, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix3, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix3x2, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix3x4, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix4, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix4x2, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix4x3, false>&) const;
-
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<float, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<int, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Color, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector2, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector3, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector4, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector2I, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector3I, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector4I, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix2, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix2x3, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix2x4, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix3, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix3x2, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix3x4, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4x2, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4x3, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<float, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<int, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Color, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector2, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector3, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector4, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector2I, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector3I, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector4I, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix2, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix2x3, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix2x4, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix3, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix3x2, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix3x4, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix4, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix4x2, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix4x3, false>&) const;
+
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<float, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<int, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Color, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector2, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector3, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector4, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector2I, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector3I, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector4I, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix2, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix2x3, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix2x4, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix3, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix3x2, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix3x4, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix4, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix4x2, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix4x3, true>&) const;
 
 	Material::Material()
 		:mLoadFlags(Load_None)
@@ -413,6 +435,11 @@ namespace bs
 		mShader = shader;
 	}
 
+	Material::~Material()
+	{
+		mLazyVariationsConn.disconnect();
+	}
+
 	void Material::initialize()
 	{
 		_markResourcesDirty();
@@ -429,6 +456,7 @@ namespace bs
 		mShader = shader;
 		mTechniques.clear();
 		mLoadFlags = Load_None;
+		mLazyVariationsConn.disconnect();
 
 		// Make sure to clear params, because the default behaviour is to re-apply them (which won't work due to changed
 		// shader)
@@ -488,7 +516,10 @@ namespace bs
 
 	CoreSyncData Material::syncToCore(FrameAlloc* allocator)
 	{
-		bool syncAllParams = (getCoreDirtyFlags() & (UINT32)MaterialDirtyFlags::ResourceChanged) != 0;
+		// Dependencies (e.g. streamed textures) might have changed their core objects, in which case all parameters need
+		// to be re-sent to pick them up
+		UINT32 syncAllFlags = (UINT32)MaterialDirtyFlags::ResourceChanged | (UINT32)MaterialDirtyFlags::Dependency;
+		bool syncAllParams = (getCoreDirtyFlags() & syncAllFlags) != 0;
 
 		UINT32 paramsSize = 0;
 		if (mParams != nullptr)
@@ -564,6 +595,19 @@ namespace bs
 				// Shader about to change, so save parameters, rebuild material and restore parameters
 				SPtr<MaterialParams> oldParams = mParams;
 
+				// Variations compiled on demand finish on worker threads, so listeners are notified through the thread
+				// safe resource modified event, which triggers a rebuild that picks up the new techniques
+				mLazyVariationsConn.disconnect();
+				mShader->_registerCompiledVariations();
+
+				const SPtr<ShaderLazyVariations>& lazyVariations = mShader->getLazyVariations();
+				if (lazyVariations)
+				{
+					HShader shader = mShader;
+					mLazyVariationsConn = lazyVariations->onCompiled.connect(
+						[shader]() { gResources().onResourceModified(shader); });
+				}
+
 				initializeTechniques();
 				markCoreDirty();
 
@@ -8,6 +8,7 @@
 #include "Material/BsMaterialParam.h"
 #include "Material/BsMaterialParams.h"
 #include "Material/BsTechnique.h"
+#include "Utility/BsEvent.h"
 #include "Math/BsVector2.h"
 #include "Math/BsVector3.h"
 #include "Math/BsVector4.h"
@@ -44,7 +45,9 @@ namespace bs
 	enum class MaterialDirtyFlags
 	{
 		Normal				= 1 << 0,
-		ResourceChanged		= 2 << 1
+		ResourceChanged		= 2 << 1,
+		/** Set by CoreObjectManager when one of the material's dependencies (e.g. a texture) was marked dirty. */
+		Dependency			= 1 << 31
 	};
 
 	/** Structure used when searching for a specific technique in a Material. */
@@ -191,6 +194,66 @@ namespace bs
 		 */
 		void updateParamsSet(const SPtr<GpuParamsSetType>& paramsSet, bool updateAll = false);
 
+		/**
+		 * Returns an identifier of the group this material belongs to. Materials using the same techniques and
+		 * parameter values belong to the same group, allowing the renderer to order them so they are rendered
+		 * consecutively. The identifier is derived from a hash and different groups might share the same identifier,
+		 * therefore it should only be used for sorting.
+		 */
+		UINT32 getGroupId() const;
+
+		/**
+		 * Assigns a value to a data parameter identified by an ID retrieved from Shader::getParamId(). Unlike the
+		 * name-based setters this avoids looking up the parameter by name, and the same ID can be used for all materials
+		 * using the same shader.
+		 *
+		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
+		 */
+		template<class T>
+		void setDataParam(UINT32 paramId, const T& value, UINT32 arrayIdx = 0)
+		{
+			const MaterialParamsBase::ParamData* param = getDataParamById<T>(paramId, arrayIdx);
+			if (param == nullptr)
+				return;
+
+			mParams->setDataParam(*param, arrayIdx, value);
+			_markCoreDirty();
+		}
+
+		/**
+		 * Returns a value of a data parameter identified by an ID retrieved from Shader::getParamId(). Avoids looking up
+		 * the parameter by name.
+		 *
+		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
+		 */
+		template<class T>
+		T getDataParam(UINT32 paramId, UINT32 arrayIdx = 0) const
+		{
+			T output{};
+
+			const MaterialParamsBase::ParamData* param = getDataParamById<T>(paramId, arrayIdx);
+			if (param != nullptr)
+				mParams->getDataParam(*param, arrayIdx, output);
+
+			return output;
+		}
+
+		/**
+		 * Assigns the same value to a data parameter on all of the provided materials. Parameter is identified by an ID
+		 * retrieved from Shader::getParamId(), and all the materials are expected to use the shader the ID was retrieved
+		 * from.
+		 */
+		template<class T, class MaterialPtrType>
+		static void setDataParam(const Vector<MaterialPtrType>& materials, UINT32 paramId, const T& value, 
+			UINT32 arrayIdx = 0)
+		{
+			for (auto& entry : materials)
+			{
+				if (entry != nullptr)
+					entry->setDataParam(paramId, value, arrayIdx);
+			}
+		}
+
 		/**   
 		 * Assigns a float value to the shader parameter with the specified name. 
 		 *
@@ -361,7 +424,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<float, Core> getParamFloat(const String& name) const
+		TMaterialDataParam<float, Core> getParamFloat(const StringID& name) const
 		{
 			TMaterialDataParam<float, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -379,7 +442,7 @@ namespace bs
 		 * @note
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Color, Core> getParamColor(const String& name) const
+		TMaterialDataParam<Color, Core> getParamColor(const StringID& name) const
 		{
 			TMaterialDataParam<Color, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -397,7 +460,7 @@ namespace bs
 		 * @note	
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Vector2, Core> getParamVec2(const String& name) const
+		TMaterialDataParam<Vector2, Core> getParamVec2(const StringID& name) const
 		{
 			TMaterialDataParam<Vector2, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -415,7 +478,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Vector3, Core> getParamVec3(const String& name) const
+		TMaterialDataParam<Vector3, Core> getParamVec3(const StringID& name) const
 		{
 			TMaterialDataParam<Vector3, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -433,7 +496,7 @@ namespace bs
 		 * @note	
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Vector4, Core> getParamVec4(const String& name) const
+		TMaterialDataParam<Vector4, Core> getParamVec4(const StringID& name) const
 		{
 			TMaterialDataParam<Vector4, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -451,7 +514,7 @@ namespace bs
 		 * @note	
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Matrix3, Core> getParamMat3(const String& name) const
+		TMaterialDataParam<Matrix3, Core> getParamMat3(const StringID& name) const
 		{
 			TMaterialDataParam<Matrix3, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -469,7 +532,7 @@ namespace bs
 		 * @note	
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Matrix4, Core> getParamMat4(const String& name) const
+		TMaterialDataParam<Matrix4, Core> getParamMat4(const StringID& name) const
 		{
 			TMaterialDataParam<Matrix4, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -487,7 +550,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamStruct<Core> getParamStruct(const String& name) const;
+		TMaterialParamStruct<Core> getParamStruct(const StringID& name) const;
 
 		/**
 		 * Returns a texture GPU parameter. This parameter may be used for more efficiently getting/setting GPU parameter 
@@ -499,7 +562,7 @@ namespace bs
 		 * @note
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamTexture<Core> getParamTexture(const String& name) const;
+		TMaterialParamTexture<Core> getParamTexture(const StringID& name) const;
 
 		/**
 		 * Returns a GPU parameter for binding a load/store texture. This parameter may be used for more efficiently 
@@ -511,7 +574,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamLoadStoreTexture<Core> getParamLoadStoreTexture(const String& name) const;
+		TMaterialParamLoadStoreTexture<Core> getParamLoadStoreTexture(const StringID& name) const;
 
 		/**
 		 * Returns a buffer GPU parameter. This parameter may be used for more efficiently getting/setting GPU parameter 
@@ -523,7 +586,7 @@ namespace bs
 		 * @note
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamBuffer<Core> getParamBuffer(const String& name) const;
+		TMaterialParamBuffer<Core> getParamBuffer(const StringID& name) const;
 
 		/**
 		 * Returns a sampler state GPU parameter. This parameter may be used for more efficiently getting/setting GPU 
@@ -535,7 +598,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamSampState<Core> getParamSamplerState(const String& name) const;
+		TMaterialParamSampState<Core> getParamSamplerState(const StringID& name) const;
 
 		/**
 		 * Allows you to retrieve a handle to a parameter that you can then use for quickly setting and retrieving parameter
@@ -546,7 +609,7 @@ namespace bs
 		 * of that.
 		 */
 		template <typename T>
-		void getParam(const String& name, TMaterialDataParam<T, Core>& output) const;
+		void getParam(const StringID& name, TMaterialDataParam<T, Core>& output) const;
 
 		/**
 		 * @name Internal
@@ -583,6 +646,29 @@ namespace bs
 		/** Throw an exception if no shader is set, or no acceptable technique was found. */
 		void throwIfNotInitialized() const;
 
+		/**
+		 * Returns information about a data parameter with the specified ID, or null (and logs a warning) if the ID doesn't
+		 * reference a data parameter of type @p T, or if the array index is out of range.
+		 */
+		template<class T>
+		const MaterialParamsBase::ParamData* getDataParamById(UINT32 paramId, UINT32 arrayIdx) const
+		{
+			if (mParams == nullptr)
+				return nullptr;
+
+			const MaterialParamsBase::ParamData* param = nullptr;
+			auto result = mParams->getParamData(paramId, MaterialParamsBase::ParamType::Data, 
+				(GpuParamDataType)TGpuDataParamInfo<T>::TypeId, arrayIdx, &param);
+
+			if (result != MaterialParamsBase::GetParamResult::Success)
+			{
+				mParams->reportGetParamError(result, "#" + toString(paramId), arrayIdx);
+				return nullptr;
+			}
+
+			return param;
+		}
+
 		ShaderType mShader;
 		SPtr<MaterialParamsType> mParams;
 		Vector<SPtr<TechniqueType>> mTechniques;
@@ -598,7 +684,7 @@ namespace bs
 	class BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Rendering) Material: public Resource, public TMaterial<false>, public IResourceListener
 	{
 	public:
-		~Material() { }
+		~Material();
 
 		/**
 		 * Sets a shader that will be used by the material. Material will be initialized using all compatible techniques
@@ -683,6 +769,7 @@ namespace bs
 		void setParams(const SPtr<MaterialParams>& params);
 
 		UINT32 mLoadFlags;
+		HEvent mLazyVariationsConn;
 		
 		/************************************************************************/
 		/* 								RTTI		                     		*/
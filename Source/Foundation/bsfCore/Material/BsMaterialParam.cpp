@@ -8,7 +8,7 @@
 namespace bs
 {
 	template<class T, bool Core>
-	TMaterialDataParam<T, Core>::TMaterialDataParam(const String& name, const MaterialPtrType& material)
+	TMaterialDataParam<T, Core>::TMaterialDataParam(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mArraySize(0), mMaterial(nullptr)
 	{
 		if(material != nullptr)
@@ -67,7 +67,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamStruct<Core>::TMaterialParamStruct(const String& name, const MaterialPtrType& material)
+	TMaterialParamStruct<Core>::TMaterialParamStruct(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mArraySize(0), mMaterial(nullptr)
 	{
 		if (material != nullptr)
@@ -135,7 +135,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamTexture<Core>::TMaterialParamTexture(const String& name, const MaterialPtrType& material)
+	TMaterialParamTexture<Core>::TMaterialParamTexture(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mMaterial(nullptr)
 	{
 		if (material != nullptr)
@@ -192,7 +192,7 @@ namespace bs
 	}
 	
 	template<bool Core>
-	TMaterialParamLoadStoreTexture<Core>::TMaterialParamLoadStoreTexture(const String& name, 
+	TMaterialParamLoadStoreTexture<Core>::TMaterialParamLoadStoreTexture(const StringID& name, 
 		const MaterialPtrType& material)
 		:mParamIndex(0), mMaterial(nullptr)
 	{
@@ -246,7 +246,7 @@ namespace bs
 	}
 	
 	template<bool Core>
-	TMaterialParamBuffer<Core>::TMaterialParamBuffer(const String& name, const MaterialPtrType& material)
+	TMaterialParamBuffer<Core>::TMaterialParamBuffer(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mMaterial(nullptr)
 	{
 		if (material != nullptr)
@@ -295,7 +295,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamSampState<Core>::TMaterialParamSampState(const String& name, const MaterialPtrType& material)
+	TMaterialParamSampState<Core>::TMaterialParamSampState(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mMaterial(nullptr)
 	{
 		if (material != nullptr)
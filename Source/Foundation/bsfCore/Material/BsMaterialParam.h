@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "RenderAPI/BsGpuParam.h"
+#include "String/BsStringID.h"
 
 namespace bs
 {
@@ -42,7 +43,7 @@ namespace bs
 		typedef typename TMaterialParamsType<Core>::Type MaterialParamsType;
 
 	public:
-		TMaterialDataParam(const String& name, const MaterialPtrType& material);
+		TMaterialDataParam(const StringID& name, const MaterialPtrType& material);
 		TMaterialDataParam() { }
 
 		/** @copydoc TGpuDataParam::set */
@@ -71,7 +72,7 @@ namespace bs
 		typedef typename TMaterialParamsType<Core>::Type MaterialParamsType;
 
 	public:
-		TMaterialParamStruct(const String& name, const MaterialPtrType& material);
+		TMaterialParamStruct(const StringID& name, const MaterialPtrType& material);
 		TMaterialParamStruct() { }
 
 		/** @copydoc TGpuParamStruct::set */
@@ -104,7 +105,7 @@ namespace bs
 		typedef typename TGpuParamTextureType<Core>::Type TextureType;
 
 	public:
-		TMaterialParamTexture(const String& name, const MaterialPtrType& material);
+		TMaterialParamTexture(const StringID& name, const MaterialPtrType& material);
 		TMaterialParamTexture() { }
 
 		/** @copydoc GpuParamTexture::set */
@@ -133,7 +134,7 @@ namespace bs
 		typedef typename TGpuParamTextureType<Core>::Type TextureType;
 
 	public:
-		TMaterialParamLoadStoreTexture(const String& name, const MaterialPtrType& material);
+		TMaterialParamLoadStoreTexture(const StringID& name, const MaterialPtrType& material);
 		TMaterialParamLoadStoreTexture() { }
 
 		/** @copydoc GpuParamLoadStoreTexture::set */
@@ -162,7 +163,7 @@ namespace bs
 		typedef typename TGpuBufferType<Core>::Type BufferType;
 
 	public:
-		TMaterialParamBuffer(const String& name, const MaterialPtrType& material);
+		TMaterialParamBuffer(const StringID& name, const MaterialPtrType& material);
 		TMaterialParamBuffer() { }
 
 		/** @copydoc GpuParamBuffer::set */
@@ -191,7 +192,7 @@ namespace bs
 		typedef typename TGpuParamSamplerStateType<Core>::Type SamplerStateType;
 
 	public:
-		TMaterialParamSampState(const String& name, const MaterialPtrType& material);
+		TMaterialParamSampState(const StringID& name, const MaterialPtrType& material);
 		TMaterialParamSampState() { }
 
 		/** @copydoc GpuParamSampState::set */
@@ -9,6 +9,34 @@
 
 namespace bs
 {
+	/** Combines the hash of the provided raw bytes with an existing hash. */
+	static void hashData(size_t& seed, const UINT8* data, UINT32 size)
+	{
+		UINT32 offset = 0;
+		for (; offset + sizeof(size_t) <= size; offset += sizeof(size_t))
+		{
+			size_t value;
+			memcpy(&value, data + offset, sizeof(size_t));
+			hash_combine(seed, value);
+		}
+
+		for (; offset < size; offset++)
+			hash_combine(seed, data[offset]);
+	}
+
+	/** Combines the hash of a parameter object with an existing hash. Resources are identified by their UUID. */
+	static void hashObject(size_t& seed, const HTexture& value)
+	{
+		hash_combine(seed, value.getUUID());
+	}
+
+	/** @copydoc hashObject(size_t&, const HTexture&) */
+	template<class T>
+	static void hashObject(size_t& seed, const SPtr<T>& value)
+	{
+		hash_combine(seed, value.get());
+	}
+
 	MaterialParamsBase::MaterialParamsBase(
 		const Map<String, SHADER_DATA_PARAM_DESC>& dataParams,
 		const Map<String, SHADER_OBJECT_PARAM_DESC>& textureParams,
@@ -38,6 +66,7 @@ namespace bs
 		UINT32 bufferIdx = 0;
 		UINT32 samplerIdx = 0;
 
+		// Note: Parameter order must match the IDs assigned by TShader::buildParamIds()
 		for (auto& entry : dataParams)
 		{
 			if(entry.second.type == GPDT_UNKNOWN)
@@ -121,7 +150,7 @@ namespace bs
 		mAlloc.clear();
 	}
 
-	UINT32 MaterialParamsBase::getParamIndex(const String& name) const
+	UINT32 MaterialParamsBase::getParamIndex(const StringID& name) const
 	{
 		auto iterFind = mParamLookup.find(name);
 		if (iterFind == mParamLookup.end())
@@ -130,7 +159,7 @@ namespace bs
 		return iterFind->second;
 	}
 
-	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamIndex(const String& name, ParamType type,
+	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamIndex(const StringID& name, ParamType type,
 		GpuParamDataType dataType, UINT32 arrayIdx, UINT32& output) const
 	{
 		auto iterFind = mParamLookup.find(name);
@@ -150,7 +179,7 @@ namespace bs
 		return GetParamResult::Success;
 	}
 
-	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamData(const String& name, ParamType type, 
+	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamData(const StringID& name, ParamType type, 
 		GpuParamDataType dataType, UINT32 arrayIdx, const ParamData** output) const
 	{
 		auto iterFind = mParamLookup.find(name);
@@ -170,18 +199,38 @@ namespace bs
 		return GetParamResult::Success;
 	}
 
-	void MaterialParamsBase::reportGetParamError(GetParamResult errorCode, const String& name, UINT32 arrayIdx) const
+	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamData(UINT32 index, ParamType type, 
+		GpuParamDataType dataType, UINT32 arrayIdx, const ParamData** output) const
 	{
+		if (index >= (UINT32)mParams.size())
+			return GetParamResult::NotFound;
+
+		const ParamData& param = mParams[index];
+		*output = &param;
+
+		if (param.type != type || (type == ParamType::Data && param.dataType != dataType))
+			return GetParamResult::InvalidType;
+
+		if (arrayIdx >= param.arraySize)
+			return GetParamResult::IndexOutOfBounds;
+
+		return GetParamResult::Success;
+	}
+
+	void MaterialParamsBase::reportGetParamError(GetParamResult errorCode, const StringID& name, UINT32 arrayIdx) const
+	{
+		const String nameStr = name.empty() ? StringUtil::BLANK : String(name.cstr());
+
 		switch (errorCode)
 		{
 		case GetParamResult::NotFound:
-			LOGWRN("Material doesn't have a parameter named " + name + ".");
+			LOGWRN("Material doesn't have a parameter named " + nameStr + ".");
 			break;
 		case GetParamResult::InvalidType:
-			LOGWRN("Parameter \"" + name + "\" is not of the requested type.");
+			LOGWRN("Parameter \"" + nameStr + "\" is not of the requested type.");
 			break;
 		case GetParamResult::IndexOutOfBounds:
-			LOGWRN("Parameter \"" + name + "\" array index " + toString(arrayIdx) + " out of range.");
+			LOGWRN("Parameter \"" + nameStr + "\" array index " + toString(arrayIdx) + " out of range.");
 			break;
 		default:
 			break;
@@ -241,6 +290,7 @@ namespace bs
 					ParamStructDataType& param = mStructParams[structIdx];
 					param.dataSize = entry.second.elementSize;
 					param.data = mAlloc.alloc(param.dataSize);
+					memset(param.data, 0, param.dataSize);
 
 					structIdx++;
 				}
@@ -289,7 +339,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getStructData(const String& name, void* value, UINT32 size, UINT32 arrayIdx) const
+	void TMaterialParams<Core>::getStructData(const StringID& name, void* value, UINT32 size, UINT32 arrayIdx) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Data, GPDT_STRUCT, arrayIdx, &param);
@@ -303,7 +353,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setStructData(const String& name, const void* value, UINT32 size, UINT32 arrayIdx)
+	void TMaterialParams<Core>::setStructData(const StringID& name, const void* value, UINT32 size, UINT32 arrayIdx)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Data, GPDT_STRUCT, arrayIdx, &param);
@@ -317,7 +367,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getTexture(const String& name, TextureType& value, TextureSurface& surface) const
+	void TMaterialParams<Core>::getTexture(const StringID& name, TextureType& value, TextureSurface& surface) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Texture, GPDT_UNKNOWN, 0, &param);
@@ -331,7 +381,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setTexture(const String& name, const TextureType& value, const TextureSurface& surface)
+	void TMaterialParams<Core>::setTexture(const StringID& name, const TextureType& value, const TextureSurface& surface)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Texture, GPDT_UNKNOWN, 0, &param);
@@ -345,7 +395,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getLoadStoreTexture(const String& name, TextureType& value, TextureSurface& surface) const
+	void TMaterialParams<Core>::getLoadStoreTexture(const StringID& name, TextureType& value, TextureSurface& surface) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Texture, GPDT_UNKNOWN, 0, &param);
@@ -359,7 +409,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setLoadStoreTexture(const String& name, const TextureType& value, const TextureSurface& surface)
+	void TMaterialParams<Core>::setLoadStoreTexture(const StringID& name, const TextureType& value, const TextureSurface& surface)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Texture, GPDT_UNKNOWN, 0, &param);
@@ -373,7 +423,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getBuffer(const String& name, BufferType& value) const
+	void TMaterialParams<Core>::getBuffer(const StringID& name, BufferType& value) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Buffer, GPDT_UNKNOWN, 0, &param);
@@ -387,7 +437,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setBuffer(const String& name, const BufferType& value)
+	void TMaterialParams<Core>::setBuffer(const StringID& name, const BufferType& value)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Buffer, GPDT_UNKNOWN, 0, &param);
@@ -401,7 +451,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getSamplerState(const String& name, SamplerType& value) const
+	void TMaterialParams<Core>::getSamplerState(const StringID& name, SamplerType& value) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Sampler, GPDT_UNKNOWN, 0, &param);
@@ -415,7 +465,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setSamplerState(const String& name, const SamplerType& value)
+	void TMaterialParams<Core>::setSamplerState(const StringID& name, const SamplerType& value)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Sampler, GPDT_UNKNOWN, 0, &param);
@@ -454,7 +504,7 @@ namespace bs
 		}
 
 		memcpy(structParam.data, value, structParam.dataSize);
-		param.version = ++mParamVersion;
+		markParamDirty(param, ++mParamVersion);
 	}
 
 	template<bool Core>
@@ -480,7 +530,7 @@ namespace bs
 		textureParam.isLoadStore = false;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param, ++mParamVersion);
 	}
 
 	template<bool Core>
@@ -494,7 +544,7 @@ namespace bs
 	{
 		mBufferParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param, ++mParamVersion);
 	}
 
 	template<bool Core>
@@ -513,7 +563,7 @@ namespace bs
 		textureParam.isLoadStore = true;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param, ++mParamVersion);
 	}
 
 	template<bool Core>
@@ -533,7 +583,7 @@ namespace bs
 	{
 		mSamplerStateParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param, ++mParamVersion);
 	}
 
 	template<bool Core>
@@ -548,6 +598,55 @@ namespace bs
 		value = mDefaultSamplerStateParams[param.index];
 	}
 
+	template<bool Core>
+	UINT64 TMaterialParams<Core>::getDataHash() const
+	{
+		if (mDataHashVersion == mParamVersion)
+			return mDataHash;
+
+		size_t hash = 0;
+		hashData(hash, mDataParamsBuffer, mDataSize);
+
+		for (UINT32 i = 0; i < mNumStructParams; i++)
+			hashData(hash, mStructParams[i].data, mStructParams[i].dataSize);
+
+		mDataHash = (UINT64)hash;
+		mDataHashVersion = mParamVersion;
+
+		return mDataHash;
+	}
+
+	template<bool Core>
+	UINT64 TMaterialParams<Core>::getHash() const
+	{
+		if (mHashVersion == mParamVersion)
+			return mHash;
+
+		size_t hash = (size_t)getDataHash();
+		for (UINT32 i = 0; i < mNumTextureParams; i++)
+		{
+			const ParamTextureDataType& param = mTextureParams[i];
+
+			hashObject(hash, param.value);
+			hash_combine(hash, param.isLoadStore);
+			hash_combine(hash, param.surface.mipLevel);
+			hash_combine(hash, param.surface.numMipLevels);
+			hash_combine(hash, param.surface.face);
+			hash_combine(hash, param.surface.numFaces);
+		}
+
+		for (UINT32 i = 0; i < mNumBufferParams; i++)
+			hashObject(hash, mBufferParams[i].value);
+
+		for (UINT32 i = 0; i < mNumSamplerParams; i++)
+			hashObject(hash, mSamplerStateParams[i].value);
+
+		mHash = (UINT64)hash;
+		mHashVersion = mParamVersion;
+
+		return mHash;
+	}
+
 	template class TMaterialParams<true>;
 	template class TMaterialParams<false>;
 
@@ -845,7 +944,7 @@ namespace bs
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markParamDirty(param, mParamVersion);
 
 			UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const GpuParamDataTypeInfo& typeInfo = bs::GpuParams::PARAM_SIZES.lookup[(int)param.dataType];
@@ -862,7 +961,7 @@ namespace bs
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markParamDirty(param, mParamVersion);
 
 			MaterialParamTextureDataCore* sourceTexData = (MaterialParamTextureDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamTextureDataCore);
@@ -877,7 +976,7 @@ namespace bs
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markParamDirty(param, mParamVersion);
 
 			MaterialParamBufferDataCore* sourceBufferData = (MaterialParamBufferDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamBufferDataCore);
@@ -892,7 +991,7 @@ namespace bs
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markParamDirty(param, mParamVersion);
 
 			MaterialParamSamplerStateDataCore* sourceSamplerStateData = (MaterialParamSamplerStateDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamSamplerStateDataCore);
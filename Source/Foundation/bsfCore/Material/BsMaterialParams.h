@@ -6,6 +6,7 @@
 #include "Reflection/BsIReflectable.h"
 #include "Allocators/BsStaticAlloc.h"
 #include "Math/BsVector2.h"
+#include "String/BsStringID.h"
 #include "RenderAPI/BsGpuParams.h"
 
 namespace bs
@@ -71,7 +72,7 @@ namespace bs
 		 * @tparam		T			Native type of the parameter.
 		 */
 		template <typename T>
-		void getDataParam(const String& name, UINT32 arrayIdx, T& output) const
+		void getDataParam(const StringID& name, UINT32 arrayIdx, T& output) const
 		{
 			GpuParamDataType dataType = TGpuDataParamInfo<T>::TypeId;
 
@@ -98,7 +99,7 @@ namespace bs
 		 * @tparam		T			Native type of the parameter.
 		 */
 		template <typename T>
-		void setDataParam(const String& name, UINT32 arrayIdx, const T& input) const
+		void setDataParam(const StringID& name, UINT32 arrayIdx, const T& input) const
 		{
 			GpuParamDataType dataType = TGpuDataParamInfo<T>::TypeId;
 
@@ -120,7 +121,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @return					Index of the parameter, or -1 if not found.
 		 */
-		UINT32 getParamIndex(const String& name) const;
+		UINT32 getParamIndex(const StringID& name) const;
 
 		/** 
 		 * Returns an index of the parameter with the specified name. Index can be used in a call to getParamData(UINT32) to
@@ -135,7 +136,7 @@ namespace bs
 		 * @param[out]	output		Index of the requested parameter, only valid if success is returned.
 		 * @return					Success or error state of the request.
 		 */
-		GetParamResult getParamIndex(const String& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
+		GetParamResult getParamIndex(const StringID& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
 			UINT32& output) const;
 
 		/**
@@ -153,7 +154,15 @@ namespace bs
 		 *							some other error was reported.
 		 * @return					Success or error state of the request.
 		 */
-		GetParamResult getParamData(const String& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
+		GetParamResult getParamData(const StringID& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
+			const ParamData** output) const;
+
+		/**
+		 * Equivalent to getParamData(const StringID&, ParamType, GpuParamDataType, UINT32, const ParamData**) except it
+		 * looks up the parameter using its index, as retrieved by getParamIndex() or Shader::getParamId(), avoiding the
+		 * name lookup.
+		 */
+		GetParamResult getParamData(UINT32 index, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
 			const ParamData** output) const;
 
 		/**
@@ -171,10 +180,10 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter for which the error occurred.
 		 * @param[in]	arrayIdx	Array index for which the error occurred.
 		 */
-		void reportGetParamError(GetParamResult errorCode, const String& name, UINT32 arrayIdx) const;
+		void reportGetParamError(GetParamResult errorCode, const StringID& name, UINT32 arrayIdx) const;
 
 		/**
-		 * Equivalent to getDataParam(const String&, UINT32, T&) except it uses the internal parameter reference
+		 * Equivalent to getDataParam(const StringID&, UINT32, T&) except it uses the internal parameter reference
 		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
 		 * object.
 		 */
@@ -191,7 +200,7 @@ namespace bs
 		}
 
 		/**
-		 * Equivalent to setDataParam(const String&, UINT32, T&) except it uses the internal parameter reference
+		 * Equivalent to setDataParam(const StringID&, UINT32, T&) except it uses the internal parameter reference
 		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
 		 * object.
 		 */
@@ -206,7 +215,7 @@ namespace bs
 			assert(sizeof(input) == paramTypeSize);
 			memcpy(&mDataParamsBuffer[param.index + arrayIdx * paramTypeSize], &input, paramTypeSize);
 
-			param.version = ++mParamVersion;
+			markParamDirty(param, ++mParamVersion);
 		}
 
 		/** Returns pointer to the internal data buffer for a data parameter at the specified index. */
@@ -218,10 +227,59 @@ namespace bs
 		/** Returns a counter that gets incremented whenever a parameter gets updated. */
 		UINT64 getParamVersion() const { return mParamVersion; }
 
+		/**
+		 * Calls @p func with the index of every parameter that was modified after the specified version, at most once per
+		 * parameter. Only a limited number of most recent modifications is tracked. If modifications after @p version are
+		 * no longer tracked the method returns false without calling @p func, in which case the caller must assume all
+		 * parameters could have been modified.
+		 */
+		template<class T>
+		bool forEachDirtyParam(UINT64 version, T func) const
+		{
+			if (version < mDirtyListEvictedVersion)
+				return false;
+
+			UINT64 numEntries = mDirtyListCount < DIRTY_LIST_SIZE ? mDirtyListCount : DIRTY_LIST_SIZE;
+			for (UINT64 i = 0; i < numEntries; i++)
+			{
+				const DirtyParam& entry = mDirtyList[(mDirtyListCount - i - 1) % DIRTY_LIST_SIZE];
+				if (entry.version <= version)
+					break;
+
+				// Skip entries for parameters that were modified again later, as they are reported by the later entry
+				if (mParams[entry.paramIdx].version == entry.version)
+					func(entry.paramIdx);
+			}
+
+			return true;
+		}
+
 	protected:
+		/** Entry in the dirty parameter list, recording a single parameter modification. */
+		struct DirtyParam
+		{
+			UINT32 paramIdx;
+			UINT64 version;
+		};
+
+		/** Assigns a new version to the provided parameter, and records the modification in the dirty parameter list. */
+		void markParamDirty(const ParamData& param, UINT64 version) const
+		{
+			param.version = version;
+
+			DirtyParam& entry = mDirtyList[mDirtyListCount % DIRTY_LIST_SIZE];
+			if (mDirtyListCount >= DIRTY_LIST_SIZE)
+				mDirtyListEvictedVersion = entry.version;
+
+			entry.paramIdx = (UINT32)(&param - mParams.data());
+			entry.version = version;
+			mDirtyListCount++;
+		}
+
 		const static UINT32 STATIC_BUFFER_SIZE = 256;
+		const static UINT32 DIRTY_LIST_SIZE = 32;
 
-		UnorderedMap<String, UINT32> mParamLookup;
+		UnorderedMap<StringID, UINT32> mParamLookup;
 		Vector<ParamData> mParams;
 
 		UINT8* mDataParamsBuffer = nullptr;
@@ -234,6 +292,12 @@ namespace bs
 
 		mutable UINT64 mParamVersion = 1;
 		mutable StaticAlloc<STATIC_BUFFER_SIZE> mAlloc;
+
+		// Ring buffer of most recent parameter modifications. Modifications with versions up to and including
+		// mDirtyListEvictedVersion are no longer recorded, which includes the initial parameter values.
+		mutable DirtyParam mDirtyList[DIRTY_LIST_SIZE];
+		mutable UINT64 mDirtyListCount = 0;
+		mutable UINT64 mDirtyListEvictedVersion = 1;
 	};
 
 	/** Raw data for a single structure parameter. */
@@ -368,7 +432,7 @@ namespace bs
 		 * @param[in]	size		Size of the buffer into which to write the value. Must match parameter struct's size.
 		 * @param[in]	arrayIdx	If the parameter is an array, index of the entry to access.
 		 */
-		void getStructData(const String& name, void* value, UINT32 size, UINT32 arrayIdx) const;
+		void getStructData(const StringID& name, void* value, UINT32 size, UINT32 arrayIdx) const;
 
 		/**
 		 * Sets the value of a shader structure parameter with the specified name at the specified array index. If the
@@ -379,7 +443,7 @@ namespace bs
 		 * @param[in]	size		Size of the buffer from which to retrieve the value. Must match parameter struct's size.
 		 * @param[in]	arrayIdx	If the parameter is an array, index of the entry to access.
 		 */
-		void setStructData(const String& name, const void* value, UINT32 size, UINT32 arrayIdx);
+		void setStructData(const StringID& name, const void* value, UINT32 size, UINT32 arrayIdx);
 
 		/**
 		 * Returns the value of a shader texture parameter with the specified name. If the parameter name or type is not
@@ -389,7 +453,7 @@ namespace bs
 		 * @param[out]	value		Output value of the parameter.
 		 * @param[out]	surface		Surface describing which part of the texture is being accessed.
 		 */
-		void getTexture(const String& name, TextureType& value, TextureSurface& surface) const;
+		void getTexture(const StringID& name, TextureType& value, TextureSurface& surface) const;
 
 		/**
 		 * Sets the value of a shader texture parameter with the specified name. If the parameter name or type is not
@@ -399,7 +463,7 @@ namespace bs
 		 * @param[in]	value		New value of the parameter.
 		 * @param[in]	surface		Surface describing which part of the texture is being accessed.
 		 */
-		void setTexture(const String& name, const TextureType& value, 
+		void setTexture(const StringID& name, const TextureType& value, 
 						const TextureSurface& surface = TextureSurface::COMPLETE);
 
 		/**
@@ -410,7 +474,7 @@ namespace bs
 		 * @param[out]	value		Output value of the parameter.
 		 * @param[out]	surface		Surface describing which part of the texture is being accessed.
 		 */
-		void getLoadStoreTexture(const String& name, TextureType& value, TextureSurface& surface) const;
+		void getLoadStoreTexture(const StringID& name, TextureType& value, TextureSurface& surface) const;
 
 		/**
 		 * Sets the value of a shader load/store texture parameter with the specified name. If the parameter name or
@@ -420,7 +484,7 @@ namespace bs
 		 * @param[in]	value		New value of the parameter.
 		 * @param[in]	surface		Surface describing which part of the texture is being accessed.
 		 */
-		void setLoadStoreTexture(const String& name, const TextureType& value, const TextureSurface& surface);
+		void setLoadStoreTexture(const StringID& name, const TextureType& value, const TextureSurface& surface);
 
 		/**
 		 * Returns the value of a shader buffer parameter with the specified name. If the parameter name or type is not
@@ -429,7 +493,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[out]	value		Output value of the parameter.
 		 */
-		void getBuffer(const String& name, BufferType& value) const;
+		void getBuffer(const StringID& name, BufferType& value) const;
 
 		/**
 		 * Sets the value of a shader buffer parameter with the specified name. If the parameter name or type is not
@@ -438,7 +502,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[in]	value		New value of the parameter.
 		 */
-		void setBuffer(const String& name, const BufferType& value);
+		void setBuffer(const StringID& name, const BufferType& value);
 
 		/**
 		 * Sets the value of a shader sampler state parameter with the specified name. If the parameter name or type is not
@@ -447,7 +511,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[out]	value		Output value of the parameter.
 		 */
-		void getSamplerState(const String& name, SamplerType& value) const;
+		void getSamplerState(const StringID& name, SamplerType& value) const;
 
 		/**
 		 * Sets the value of a shader sampler state parameter with the specified name. If the parameter name or type is not
@@ -456,19 +520,19 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[in]	value		New value of the parameter.
 		 */
-		void setSamplerState(const String& name, const SamplerType& value);
+		void setSamplerState(const StringID& name, const SamplerType& value);
 
 		/**
-		 * Equivalent to getStructData(const String&, UINT32, void*, UINT32) except it uses the internal parameter reference
-		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
-		 * object.
+		 * Equivalent to getStructData(const StringID&, UINT32, void*, UINT32) except it uses the internal parameter
+		 * reference directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and
+		 * belongs to this object.
 		 */
 		void getStructData(const ParamData& param, void* value, UINT32 size, UINT32 arrayIdx) const;
 
 		/**
-		 * Equivalent to setStructData(const String&, UINT32, void*, UINT32) except it uses the internal parameter reference
-		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
-		 * object.
+		 * Equivalent to setStructData(const StringID&, UINT32, void*, UINT32) except it uses the internal parameter
+		 * reference directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and
+		 * belongs to this object.
 		 */
 		void setStructData(const ParamData& param, const void* value, UINT32 size, UINT32 arrayIdx);
 
@@ -479,41 +543,43 @@ namespace bs
 		UINT32 getStructSize(const ParamData& param) const;
 
 		/**
-		 * Equivalent to getTexture(const String&, HTexture&) except it uses the internal parameter reference directly,
-		 * avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this object.
+		 * Equivalent to getTexture(const StringID&, HTexture&) except it uses the internal parameter reference
+		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to
+		 * this object.
 		 */
 		void getTexture(const ParamData& param, TextureType& value, TextureSurface& surface) const;
 
 		/**
-		 * Equivalent to setTexture(const String&, HTexture&) except it uses the internal parameter reference directly,
-		 * avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this object.
+		 * Equivalent to setTexture(const StringID&, HTexture&) except it uses the internal parameter reference
+		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to
+		 * this object.
 		 */
 		void setTexture(const ParamData& param, const TextureType& value, 
 						const TextureSurface& surface = TextureSurface::COMPLETE);
 
 		/**
-		 * Equivalent to getBuffer(const String&, SPtr<GpuBuffer>&) except it uses the internal parameter reference
+		 * Equivalent to getBuffer(const StringID&, SPtr<GpuBuffer>&) except it uses the internal parameter reference
 		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
 		 * object.
 		 */
 		void getBuffer(const ParamData& param, BufferType& value) const;
 
 		/**
-		 * Equivalent to setBuffer(const String&, SPtr<GpuBuffer>&) except it uses the internal parameter reference
+		 * Equivalent to setBuffer(const StringID&, SPtr<GpuBuffer>&) except it uses the internal parameter reference
 		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
 		 * object.
 		 */
 		void setBuffer(const ParamData& param, const BufferType& value);
 
 		/**
-		 * Equivalent to getLoadStoreTexture(const String&, HTexture&, TextureSurface&) except it uses the internal
+		 * Equivalent to getLoadStoreTexture(const StringID&, HTexture&, TextureSurface&) except it uses the internal
 		 * parameter reference directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid
 		 * and belongs to this object.
 		 */
 		void getLoadStoreTexture(const ParamData& param, TextureType& value, TextureSurface& surface) const;
 
 		/**
-		 * Equivalent to setLoadStoreTexture(const String&, HTexture&, TextureSurface&) except it uses the internal
+		 * Equivalent to setLoadStoreTexture(const StringID&, HTexture&, TextureSurface&) except it uses the internal
 		 * parameter reference directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid
 		 * and belongs to this object.
 		 */
@@ -526,16 +592,16 @@ namespace bs
 		bool getIsTextureLoadStore(const ParamData& param) const;
 
 		/**
-		 * Equivalent to getSamplerState(const String&, SPtr<SamplerState>&) except it uses the internal parameter reference
-		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
-		 * object.
+		 * Equivalent to getSamplerState(const StringID&, SPtr<SamplerState>&) except it uses the internal parameter
+		 * reference directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and
+		 * belongs to this object.
 		 */
 		void getSamplerState(const ParamData& param, SamplerType& value) const;
 
 		/**
-		 * Equivalent to setSamplerState(const String&, SPtr<SamplerState>&) except it uses the internal parameter reference
-		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
-		 * object.
+		 * Equivalent to setSamplerState(const StringID&, SPtr<SamplerState>&) except it uses the internal parameter
+		 * reference directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and
+		 * belongs to this object.
 		 */
 		void setSamplerState(const ParamData& param, const SamplerType& value);
 
@@ -553,6 +619,18 @@ namespace bs
 		 */
 		void getDefaultSamplerState(const ParamData& param, SamplerType& value) const;
 
+		/**
+		 * Returns a hash of the values of all data parameters, including structures. Parameter objects with identical
+		 * data parameter values created from the same shader will return the same hash.
+		 */
+		UINT64 getDataHash() const;
+
+		/** 
+		 * Returns a hash of the values of all parameters, including textures, buffers and sampler states, in addition to
+		 * the data parameters.
+		 */
+		UINT64 getHash() const;
+
 	protected:
 		ParamStructDataType* mStructParams = nullptr;
 		ParamTextureDataType* mTextureParams = nullptr;
@@ -560,6 +638,11 @@ namespace bs
 		ParamSamplerStateDataType* mSamplerStateParams = nullptr;
 		TextureType* mDefaultTextureParams = nullptr;
 		SamplerType* mDefaultSamplerStateParams = nullptr;
+
+		mutable UINT64 mDataHash = 0;
+		mutable UINT64 mDataHashVersion = 0;
+		mutable UINT64 mHash = 0;
+		mutable UINT64 mHashVersion = 0;
 	};
 
 	/** 
@@ -164,12 +164,38 @@ namespace bs
 	template<bool Core>
 	TShader<Core>::TShader(const String& name, const TSHADER_DESC<Core>& desc, UINT32 id)
 		:mName(name), mDesc(desc), mId(id)
-	{ }
+	{
+		buildParamIds();
+	}
 
 	template<bool Core>
 	TShader<Core>::~TShader() 
 	{ }
 
+	template<bool Core>
+	void TShader<Core>::buildParamIds()
+	{
+		// Identifiers match the parameter indices assigned by MaterialParamsBase, so they can be used for indexing
+		// parameters of any material using this shader directly
+		mParamIds.clear();
+
+		UINT32 paramIdx = 0;
+		for (auto& entry : mDesc.dataParams)
+		{
+			if (entry.second.type != GPDT_UNKNOWN)
+				mParamIds[entry.first] = paramIdx++;
+		}
+
+		for (auto& entry : mDesc.textureParams)
+			mParamIds[entry.first] = paramIdx++;
+
+		for (auto& entry : mDesc.bufferParams)
+			mParamIds[entry.first] = paramIdx++;
+
+		for (auto& entry : mDesc.samplerParams)
+			mParamIds[entry.first] = paramIdx++;
+	}
+
 	template<bool Core>
 	GpuParamType TShader<Core>::getParamType(const String& name) const
 	{
@@ -291,6 +317,16 @@ namespace bs
 		return false;
 	}
 
+	template<bool Core>
+	UINT32 TShader<Core>::getParamId(const StringID& name) const
+	{
+		auto iterFind = mParamIds.find(name);
+		if (iterFind == mParamIds.end())
+			return (UINT32)-1;
+
+		return iterFind->second;
+	}
+
 	template<bool Core>
 	typename TShader<Core>::TextureType TShader<Core>::getDefaultTexture(UINT32 index) const
 	{
@@ -365,6 +401,22 @@ namespace bs
 		meta->includes = includes;
 	}
 
+	void Shader::setIncludeGraph(const ShaderIncludeGraph& graph)
+	{
+		SPtr<ShaderMetaData> meta = std::static_pointer_cast<ShaderMetaData>(getMetaData());
+		meta->includeGraph = graph;
+
+		meta->includes.clear();
+		for (auto& entry : graph)
+			meta->includes.push_back(entry.first);
+	}
+
+	void Shader::_registerCompiledVariations()
+	{
+		if (mDesc.lazyVariations != nullptr)
+			mDesc.lazyVariations->popCompiled(mDesc.techniques);
+	}
+
 	SPtr<ct::CoreObject> Shader::createCore() const
 	{
 		Vector<SPtr<ct::Technique>> techniques;
@@ -411,6 +463,7 @@ namespace bs
 		output.queueSortType = desc.queueSortType;
 		output.separablePasses = desc.separablePasses;
 		output.flags = desc.flags;
+		output.lazyVariations = desc.lazyVariations;
 
 		for(auto& entry : desc.techniques)
 		{
@@ -557,6 +610,44 @@ namespace bs
 		return Shader::getRTTIStatic();
 	}
 
+	bool ShaderMetaData::dependsOn(const String& include) const
+	{
+		return std::find(includes.begin(), includes.end(), include) != includes.end();
+	}
+
+	Vector<String> ShaderMetaData::getDependents(const String& include) const
+	{
+		Vector<String> output;
+		if (!dependsOn(include))
+			return output;
+
+		// Walk the graph in reverse, from the include towards the shader source
+		UnorderedSet<String> visited;
+		Vector<String> todo = { include };
+		while (!todo.empty())
+		{
+			const String current = todo.back();
+			todo.pop_back();
+
+			auto iterFind = includeGraph.find(current);
+			if (iterFind == includeGraph.end())
+				continue;
+
+			for (auto& includer : iterFind->second)
+			{
+				if (!visited.insert(includer).second)
+					continue;
+
+				output.push_back(includer);
+
+				if (!includer.empty())
+					todo.push_back(includer);
+			}
+		}
+
+		return output;
+	}
+
 	RTTITypeBase* ShaderMetaData::getRTTIStatic()
 	{
 		return ShaderMetaDataRTTI::instance();
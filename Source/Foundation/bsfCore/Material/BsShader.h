@@ -7,6 +7,7 @@
 #include "String/BsStringID.h"
 #include "Resources/BsResourceMetaData.h"
 #include "Material/BsTechnique.h"
+#include "Material/BsShaderLazyVariations.h"
 
 namespace bs
 {
@@ -258,6 +259,12 @@ namespace bs
 		/** Optional set of sub-shaders to initialize the shader with. */
 		Vector<SubShaderType> subShaders;
 
+		/**
+		 * Optional set of variations whose techniques are not part of @p techniques, but are instead compiled on demand
+		 * when first requested by a material.
+		 */
+		SPtr<ShaderLazyVariations> lazyVariations;
+
 		Map<String, SHADER_DATA_PARAM_DESC> dataParams;
 		Map<String, SHADER_OBJECT_PARAM_DESC> textureParams;
 		Map<String, SHADER_OBJECT_PARAM_DESC> bufferParams;
@@ -309,6 +316,9 @@ namespace bs
 		/** Returns a list of all sub-shaders in this shader. */
 		const Vector<SubShaderType>& getSubShaders() const { return mDesc.subShaders; }
 
+		/** Returns variations that are compiled on demand, if any. */
+		const SPtr<ShaderLazyVariations>& getLazyVariations() const { return mDesc.lazyVariations; }
+
 		/**
 		 * Returns currently active queue sort type.
 		 *
@@ -377,6 +387,13 @@ namespace bs
 		/** Checks if the parameter block with the specified name exists. */
 		bool hasParamBlock(const String& name) const;
 
+		/**
+		 * Returns an identifier of the parameter with the specified name, or -1 if the parameter doesn't exist. The
+		 * identifier is the same for all materials using this shader, and can be used for accessing the parameter on
+		 * those materials without looking it up by name (see Material::setDataParam(UINT32, const T&, UINT32)).
+		 */
+		UINT32 getParamId(const StringID& name) const;
+
 		/**	Returns a map of all data parameters in the shader. */
 		const Map<String, SHADER_DATA_PARAM_DESC>& getDataParams() const { return mDesc.dataParams; }
 
@@ -414,9 +431,13 @@ namespace bs
 		UINT32 getId() const { return mId; }
 
 	protected:
+		/** Assigns identifiers returned by getParamId() to all parameters in the shader description. */
+		void buildParamIds();
+
 		String mName;
 		TSHADER_DESC<Core> mDesc;
 		UINT32 mId;
+		UnorderedMap<StringID, UINT32> mParamIds;
 	};
 
 	/** @} */
@@ -441,6 +462,12 @@ namespace bs
 
 	typedef TSHADER_DESC<false> SHADER_DESC;
 
+	/**
+	 * Include graph of a shader. Maps each include file to a list of files that include it directly. An empty string is
+	 * used to reference the shader source itself.
+	 */
+	typedef UnorderedMap<String, Vector<String>> ShaderIncludeGraph;
+
 	/** 
 	 * @native
 	 * Shader represents a collection of techniques that control object rendering. They are used in Material%s, which can be
@@ -471,6 +498,12 @@ namespace bs
 		 */
 		void setIncludeFiles(const Vector<String>& includes);
 
+		/**
+		 * Sets the include graph of the shader, recording which files include each include file referenced by the shader.
+		 * Also sets the list of include files, the same as setIncludeFiles().
+		 */
+		void setIncludeGraph(const ShaderIncludeGraph& graph);
+
 		/**	Checks is the provided object type a sampler. */
 		static bool isSampler(GpuParamObjectType type);
 
@@ -508,6 +541,12 @@ namespace bs
 		 */
 		static SPtr<Shader> _createPtr(const String& name, const SHADER_DESC& desc);
 
+		/**
+		 * Appends the techniques of any variations that finished compiling on demand since the last call, to the list
+		 * of shader's techniques.
+		 */
+		void _registerCompiledVariations();
+
 		/** @} */
 
 	private:
@@ -543,8 +582,25 @@ namespace bs
 	class BS_CORE_EXPORT ShaderMetaData : public ResourceMetaData
 	{
 	public:
+		/**
+		 * Returns true if the shader depends on the provided include file, either by including it directly or through
+		 * some other include file.
+		 */
+		bool dependsOn(const String& include) const;
+
+		/**
+		 * Returns a list of all include files that depend on the provided include file, directly or indirectly. An empty
+		 * string is output if the shader source itself includes the file directly. Empty if the shader doesn't depend on
+		 * the include.
+		 */
+		Vector<String> getDependents(const String& include) const;
+
+		/** List of all include files referenced by the shader, including the ones included by other include files. */
 		Vector<String> includes;
 
+		/** Include graph of the shader. Empty for shaders imported before the graph was recorded. */
+		ShaderIncludeGraph includeGraph;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -0,0 +1,147 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Material/BsShaderCompileCache.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	ShaderCompileCache::ShaderCompileCache(const Path& folder)
+		:mFolder(folder)
+	{
+		if (!mFolder.isEmpty())
+		{
+			mFolder.makeAbsolute(FileSystem::getWorkingDirectoryPath());
+
+			Lock fileLock = FileScheduler::getLock(mFolder);
+			if (!FileSystem::exists(mFolder))
+				FileSystem::createDir(mFolder);
+		}
+	}
+
+	String ShaderCompileCache::generateKey(const Vector<String>& inputs)
+	{
+		// Prefix each input with its length, so that different sets of inputs cannot concatenate into the same string
+		StringStream stream;
+		stream << CACHE_VERSION;
+
+		for (auto& entry : inputs)
+			stream << "|" << entry.size() << ":" << entry;
+
+		return md5(stream.str());
+	}
+
+	SPtr<MemoryDataStream> ShaderCompileCache::find(const String& key)
+	{
+		SPtr<Vector<UINT8>> entry;
+		{
+			Lock lock(mMutex);
+
+			auto iterFind = mEntries.find(key);
+			if (iterFind != mEntries.end())
+				entry = iterFind->second;
+		}
+
+		if (entry == nullptr && !mFolder.isEmpty())
+		{
+			const Path path = getEntryPath(key);
+
+			{
+				Lock fileLock = FileScheduler::getLock(path);
+				if (FileSystem::isFile(path))
+				{
+					SPtr<DataStream> stream = FileSystem::openFile(path);
+					if (stream)
+					{
+						entry = bs_shared_ptr_new<Vector<UINT8>>(stream->size());
+
+						if (!entry->empty())
+							stream->read(entry->data(), entry->size());
+
+						stream->close();
+					}
+				}
+			}
+
+			if (entry != nullptr)
+			{
+				Lock lock(mMutex);
+				mEntries[key] = entry;
+			}
+		}
+
+		if (entry == nullptr)
+			return nullptr;
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>(entry->size());
+		if (!entry->empty())
+			output->write(entry->data(), entry->size());
+
+		output->seek(0);
+		return output;
+	}
+
+	void ShaderCompileCache::store(const String& key, const UINT8* data, UINT32 size)
+	{
+		SPtr<Vector<UINT8>> entry = bs_shared_ptr_new<Vector<UINT8>>(data, data + size);
+		{
+			Lock lock(mMutex);
+
+			// Entries are immutable, as the key already identifies the contents
+			if (mEntries.find(key) != mEntries.end())
+				return;
+
+			mEntries[key] = entry;
+		}
+
+		if (mFolder.isEmpty())
+			return;
+
+		const Path path = getEntryPath(key);
+
+		Lock fileLock = FileScheduler::getLock(path);
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if (stream == nullptr)
+		{
+			LOGWRN("Unable to write shader compile cache entry to: " + path.toString());
+			return;
+		}
+
+		stream->write(data, size);
+		stream->close();
+	}
+
+	void ShaderCompileCache::clear()
+	{
+		{
+			Lock lock(mMutex);
+			mEntries.clear();
+		}
+
+		if (mFolder.isEmpty())
+			return;
+
+		Lock fileLock = FileScheduler::getLock(mFolder);
+		if (!FileSystem::exists(mFolder))
+			return;
+
+		Vector<Path> files;
+		Vector<Path> directories;
+		FileSystem::getChildren(mFolder, files, directories);
+
+		for (auto& entry : files)
+		{
+			if (entry.getExtension() == ".cache")
+				FileSystem::remove(entry);
+		}
+	}
+
+	Path ShaderCompileCache::getEntryPath(const String& key) const
+	{
+		Path path = mFolder;
+		path.append(key + ".cache");
+
+		return path;
+	}
+}
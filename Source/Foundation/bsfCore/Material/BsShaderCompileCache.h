@@ -0,0 +1,68 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Material-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Cache that stores results of shader compilation (cross-compiled code, program bytecode and reflection data), keyed
+	 * by a hash of all inputs that affect the compilation result. Allows the shader compilers to skip compilation of
+	 * programs that were already compiled before, both during import and at runtime. Entries are kept in memory, and are
+	 * optionally persisted to disk so they can be re-used by future runs of the application.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT ShaderCompileCache : public Module<ShaderCompileCache>
+	{
+	public:
+		/**
+		 * @param[in]	folder	Folder in which to persist the cache entries. If empty the entries will only be kept in
+		 *						memory.
+		 */
+		ShaderCompileCache(const Path& folder = Path::BLANK);
+
+		/**
+		 * Generates a key for a cache entry, by hashing all the provided compilation inputs. Inputs should include the
+		 * source code after pre-processing, any defines, the compilation target and the version of the compiler.
+		 */
+		static String generateKey(const Vector<String>& inputs);
+
+		/**
+		 * Attempts to find an entry with the specified key, first in memory and then on disk. Returns null if the entry
+		 * cannot be found.
+		 */
+		SPtr<MemoryDataStream> find(const String& key);
+
+		/** Registers a new cache entry with the specified key. The data is copied internally. */
+		void store(const String& key, const UINT8* data, UINT32 size);
+
+		/** Removes all entries from the cache, including the ones persisted on disk. */
+		void clear();
+
+		/** Returns the folder the cache entries are persisted in. Empty if the cache is memory-only. */
+		const Path& getFolder() const { return mFolder; }
+
+	private:
+		/** Returns the path to the file storing the entry with the specified key. */
+		Path getEntryPath(const String& key) const;
+
+		/**
+		 * Version of the cache entry format. Must be increased whenever the format of the entries changes, in order to
+		 * invalidate any existing entries.
+		 */
+		static constexpr UINT32 CACHE_VERSION = 1;
+
+		Path mFolder;
+		UnorderedMap<String, SPtr<Vector<UINT8>>> mEntries;
+		Mutex mMutex;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,123 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Material/BsShaderLazyVariations.h"
+#include "Material/BsShaderManager.h"
+#include "Material/BsTechnique.h"
+#include "Private/RTTI/BsShaderLazyVariationsRTTI.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	/**
+	 * Checks if all parameters of the searched variation are present in the candidate variation, with the same values.
+	 */
+	static bool matchesVariation(const ShaderVariation& candidate, const ShaderVariation& search)
+	{
+		const auto& candidateParams = candidate.getParams();
+		for (auto& param : search.getParams())
+		{
+			auto iterFind = candidateParams.find(param.first);
+			if (iterFind == candidateParams.end())
+				return false;
+
+			if (param.second.i != iterFind->second.i)
+				return false;
+		}
+
+		return true;
+	}
+
+	ShaderLazyVariations::ShaderLazyVariations(const String& name, const String& source,
+		const UnorderedMap<String, String>& defines, const Vector<ShaderVariation>& variations)
+		:mName(name), mSource(source), mDefines(defines), mVariations(variations)
+	{ }
+
+	bool ShaderLazyVariations::request(const ShaderVariation& variation)
+	{
+		UINT32 idx = (UINT32)-1;
+		{
+			Lock lock(mMutex);
+
+			for (UINT32 i = 0; i < (UINT32)mVariations.size(); i++)
+			{
+				if (!matchesVariation(mVariations[i], variation))
+					continue;
+
+				if (mRequested.find(i) != mRequested.end())
+					return true; // Already compiling or compiled, but not yet retrieved
+
+				idx = i;
+				mRequested.insert(i);
+				break;
+			}
+		}
+
+		if (idx == (UINT32)-1)
+			return false;
+
+		if (TaskScheduler::isStarted())
+		{
+			SPtr<ShaderLazyVariations> thisPtr = shared_from_this();
+			SPtr<Task> task = Task::create("CompileShaderVariation", [thisPtr, idx]() { thisPtr->compile(idx); },
+				TaskPriority::Low);
+
+			TaskScheduler::instance().addTask(task);
+		}
+		else
+		{
+			// Techniques are sim thread objects and cannot be created on the core thread
+			if (BS_THREAD_CURRENT_ID == gCoreThread().getCoreThreadId())
+				return true;
+
+			compile(idx);
+		}
+
+		return true;
+	}
+
+	void ShaderLazyVariations::popCompiled(Vector<SPtr<Technique>>& techniques)
+	{
+		Lock lock(mMutex);
+
+		for (auto& entry : mCompiled)
+			techniques.push_back(entry);
+
+		mCompiled.clear();
+	}
+
+	void ShaderLazyVariations::compile(UINT32 idx)
+	{
+		SPtr<IShaderVariationCompiler> compiler = ShaderManager::instance().getVariationCompiler();
+		if (compiler == nullptr)
+		{
+			LOGWRN("Unable to compile a variation of shader \"" + mName + "\" as no shader variation compiler is "
+				"registered.");
+			return;
+		}
+
+		Vector<SPtr<Technique>> techniques = compiler->compileVariation(mName, mSource, mDefines, mVariations[idx]);
+		if (techniques.empty())
+			return;
+
+		{
+			Lock lock(mMutex);
+
+			for (auto& entry : techniques)
+				mCompiled.push_back(entry);
+		}
+
+		onCompiled();
+	}
+
+	RTTITypeBase* ShaderLazyVariations::getRTTIStatic()
+	{
+		return ShaderLazyVariationsRTTI::instance();
+	}
+
+	RTTITypeBase* ShaderLazyVariations::getRTTI() const
+	{
+		return ShaderLazyVariations::getRTTIStatic();
+	}
+}
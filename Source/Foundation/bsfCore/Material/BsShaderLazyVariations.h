@@ -0,0 +1,78 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Reflection/BsIReflectable.h"
+#include "Material/BsShaderVariation.h"
+#include "Utility/BsEvent.h"
+
+namespace bs
+{
+	/** @addtogroup Material-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Contains the shader source along with a list of shader variations whose techniques are compiled on demand, the
+	 * first time they are requested, instead of when the shader is created. A single object is shared between the sim
+	 * and core thread versions of a shader. Actual compilation is performed by the IShaderVariationCompiler registered
+	 * with the ShaderManager.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT ShaderLazyVariations : public IReflectable, public std::enable_shared_from_this<ShaderLazyVariations>
+	{
+	public:
+		/**
+		 * @param[in]	name		Name of the shader the variations belong to.
+		 * @param[in]	source		Source code of the shader.
+		 * @param[in]	defines		Defines the shader source is compiled with, in addition to the variation defines.
+		 * @param[in]	variations	Variations to compile on demand.
+		 */
+		ShaderLazyVariations(const String& name, const String& source, const UnorderedMap<String, String>& defines,
+			const Vector<ShaderVariation>& variations);
+
+		/**
+		 * Checks if a variation matching the provided variation is compiled on demand. If so, and its compilation hasn't
+		 * yet been started, starts compiling it on a worker thread. Returns true if a matching variation exists and its
+		 * techniques are not yet available, in which case the caller should fall back to a different variation until
+		 * onCompiled is triggered. Parameters not specified in @p variation are assumed to be irrelevant.
+		 */
+		bool request(const ShaderVariation& variation);
+
+		/** Moves the techniques of all variations that finished compiling since the last call into @p techniques. */
+		void popCompiled(Vector<SPtr<Technique>>& techniques);
+
+		/** Returns a list of all variations compiled on demand, including the ones that were already compiled. */
+		const Vector<ShaderVariation>& getVariations() const { return mVariations; }
+
+		/** Triggered when a variation finishes compiling. May be triggered from any thread. */
+		Event<void()> onCompiled;
+
+	private:
+		/** Compiles the variation at the specified index, and registers its techniques. */
+		void compile(UINT32 idx);
+
+		String mName;
+		String mSource;
+		UnorderedMap<String, String> mDefines;
+		Vector<ShaderVariation> mVariations;
+
+		UnorderedSet<UINT32> mRequested;
+		Vector<SPtr<Technique>> mCompiled;
+		Mutex mMutex;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+		ShaderLazyVariations() { }
+
+	public:
+		friend class ShaderLazyVariationsRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/** @} */
+}
@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
+#include "Material/BsShaderVariation.h"
 
 namespace bs
 {
@@ -35,6 +36,20 @@ namespace bs
 		virtual HShaderInclude findInclude(const String& name) const override;
 	};
 
+	/** Interface that provides a method for compiling a single variation of a shader from its source, on demand. */
+	class BS_CORE_EXPORT IShaderVariationCompiler
+	{
+	public:
+		virtual ~IShaderVariationCompiler() { }
+
+		/**
+		 * Compiles a single variation of a shader and returns the techniques implementing it, or an empty list if the 
+		 * compilation fails. Called from worker threads.
+		 */
+		virtual Vector<SPtr<Technique>> compileVariation(const String& name, const String& source,
+			const UnorderedMap<String, String>& defines, const ShaderVariation& variation) const = 0;
+	};
+
 	/**	A global manager that handles various shader specific operations. */
 	class BS_CORE_EXPORT ShaderManager : public Module <ShaderManager>
 	{
@@ -53,8 +68,18 @@ namespace bs
 		/** Changes the active include handler that determines how is a shader include name mapped to the actual resource. */
 		void setIncludeHandler(const SPtr<IShaderIncludeHandler>& handler) { mIncludeHandler = handler; }
 
+		/**
+		 * Changes the compiler used for compiling shader variations on demand. If null, variations that are meant to
+		 * be compiled on demand will never become available.
+		 */
+		void setVariationCompiler(const SPtr<IShaderVariationCompiler>& compiler) { mVariationCompiler = compiler; }
+
+		/** Returns the compiler used for compiling shader variations on demand, if any. */
+		const SPtr<IShaderVariationCompiler>& getVariationCompiler() const { return mVariationCompiler; }
+
 	private:
 		SPtr<IShaderIncludeHandler> mIncludeHandler;
+		SPtr<IShaderVariationCompiler> mVariationCompiler;
 	};
 
 	/** @} */
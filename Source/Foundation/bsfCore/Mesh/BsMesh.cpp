@@ -96,6 +96,13 @@ namespace bs
 		if (mCPUData != nullptr)
 			updateBounds(*mCPUData);
 
+		// Core object references the cores of the LOD meshes, so they must be created first
+		for (auto& entry : mLODs)
+		{
+			if (entry.mesh != nullptr && !entry.mesh->isInitialized())
+				entry.mesh->initialize();
+		}
+
 		MeshBase::initialize();
 
 		if ((mUsage & MU_CPUCACHED) != 0 && mCPUData == nullptr)
@@ -108,6 +115,59 @@ namespace bs
 		markCoreDirty();
 	}
 
+	void Mesh::setLODs(const Vector<MeshLOD>& lods)
+	{
+		mLODs.clear();
+		for (auto& entry : lods)
+		{
+			if (entry.mesh == nullptr || entry.mesh.get() == this)
+				continue;
+
+			if (entry.mesh->getProperties().getNumSubMeshes() != mProperties.getNumSubMeshes())
+			{
+				LOGWRN("Ignoring a mesh LOD as it doesn't have the same number of sub-meshes as the parent mesh.");
+				continue;
+			}
+
+			mLODs.push_back(entry);
+		}
+
+		std::sort(mLODs.begin(), mLODs.end(), [](const MeshLOD& lhs, const MeshLOD& rhs)
+		{
+			return lhs.screenSize > rhs.screenSize;
+		});
+
+		if (!isInitialized())
+			return;
+
+		for (auto& entry : mLODs)
+		{
+			if (!entry.mesh->isInitialized())
+				entry.mesh->initialize();
+		}
+
+		SPtr<ct::Mesh> core = getCore();
+		Vector<ct::MeshLOD> coreLODs = getCoreLODs();
+		gCoreThread().queueCommand([core, coreLODs]() { core->mLODs = coreLODs; });
+
+		// Renderables using the mesh need to pick up the new LODs
+		markCoreDirty();
+	}
+
+	Vector<ct::MeshLOD> Mesh::getCoreLODs() const
+	{
+		Vector<ct::MeshLOD> coreLODs(mLODs.size());
+		for (UINT32 i = 0; i < (UINT32)mLODs.size(); i++)
+		{
+			if (mLODs[i].mesh != nullptr)
+				coreLODs[i].mesh = mLODs[i].mesh->getCore();
+
+			coreLODs[i].screenSize = mLODs[i].screenSize;
+		}
+
+		return coreLODs;
+	}
+
 	SPtr<ct::Mesh> Mesh::getCore() const
 	{
 		return std::static_pointer_cast<ct::Mesh>(mCoreSpecific);
@@ -126,6 +186,7 @@ namespace bs
 		desc.morphShapes = mMorphShapes;
 
 		ct::Mesh* obj = new (bs_alloc<ct::Mesh>()) ct::Mesh(mCPUData, desc, GDF_DEFAULT);
+		obj->mLODs = getCoreLODs();
 
 		SPtr<ct::CoreObject> meshCore = bs_shared_ptr<ct::Mesh>(obj);
 		meshCore->_setThisPtr(meshCore);
@@ -304,6 +365,9 @@ namespace bs
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		if (mSharedAllocation.isValid() && MeshMemoryManager::isStarted())
+			MeshMemoryManager::instance().free(mSharedAllocation);
+
 		mVertexData = nullptr;
 		mIndexBuffer = nullptr;
 		mVertexDesc = nullptr;
@@ -317,29 +381,35 @@ namespace bs
 		bool isDynamic = (mUsage & MU_DYNAMIC) != 0;
 		int usage = isDynamic ? GBU_DYNAMIC : GBU_STATIC;
 
-		INDEX_BUFFER_DESC ibDesc;
-		ibDesc.indexType = mIndexType;
-		ibDesc.numIndices = mProperties.mNumIndices;
-		ibDesc.usage = (GpuBufferUsage)usage;
-
-		mIndexBuffer = IndexBuffer::create(ibDesc, mDeviceMask);
-
 		mVertexData = bs_shared_ptr_new<VertexData>();
 		mVertexData->vertexCount = mProperties.mNumVertices;
 		mVertexData->vertexDeclaration = VertexDeclaration::create(mVertexDesc, mDeviceMask);
 
-		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+		if (!allocateShared())
 		{
-			if (!mVertexDesc->hasStream(i))
-				continue;
+			INDEX_BUFFER_DESC ibDesc;
+			ibDesc.indexType = mIndexType;
+			ibDesc.numIndices = mProperties.mNumIndices;
+			ibDesc.usage = (GpuBufferUsage)usage;
+
+			mIndexBuffer = IndexBuffer::create(ibDesc, mDeviceMask);
+
+			for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+			{
+				if (!mVertexDesc->hasStream(i))
+					continue;
+
+				VERTEX_BUFFER_DESC vbDesc;
+				vbDesc.vertexSize = mVertexData->vertexDeclaration->getProperties().getVertexSize(i);
+				vbDesc.numVerts = mVertexData->vertexCount;
+				vbDesc.usage = (GpuBufferUsage)usage;
 
-			VERTEX_BUFFER_DESC vbDesc;
-			vbDesc.vertexSize = mVertexData->vertexDeclaration->getProperties().getVertexSize(i);
-			vbDesc.numVerts = mVertexData->vertexCount;
-			vbDesc.usage = (GpuBufferUsage)usage;
+				// Allow the renderer to read the vertices of animated meshes when skinning them in a compute program
+				vbDesc.supportsLoadStore = mSkeleton != nullptr && !isDynamic;
 
-			SPtr<VertexBuffer> vertexBuffer = VertexBuffer::create(vbDesc, mDeviceMask);
-			mVertexData->setBuffer(i, vertexBuffer);
+				SPtr<VertexBuffer> vertexBuffer = VertexBuffer::create(vbDesc, mDeviceMask);
+				mVertexData->setBuffer(i, vertexBuffer);
+			}
 		}
 
 		// TODO Low priority - DX11 (and maybe OpenGL)? allow an optimization that allows you to set
@@ -353,6 +423,31 @@ namespace bs
 		MeshBase::initialize();
 	}
 
+	bool Mesh::allocateShared()
+	{
+		if ((mUsage & MU_DYNAMIC) != 0 || mSkeleton != nullptr || mMorphShapes != nullptr)
+			return false;
+
+		if (!MeshMemoryManager::isStarted())
+			return false;
+
+		MeshMemoryManager& memoryManager = MeshMemoryManager::instance();
+		mSharedAllocation = memoryManager.allocate(mVertexDesc, mIndexType, mProperties.mNumVertices,
+			mProperties.mNumIndices, mDeviceMask);
+
+		if (!mSharedAllocation.isValid())
+			return false;
+
+		mIndexBuffer = memoryManager.getIndexBuffer(mSharedAllocation);
+		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+		{
+			if (mVertexDesc->hasStream(i))
+				mVertexData->setBuffer(i, memoryManager.getVertexBuffer(mSharedAllocation, i));
+		}
+
+		return true;
+	}
+
 	SPtr<VertexData> Mesh::getVertexData() const
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -409,13 +504,17 @@ namespace bs
 			return;
 		}
 
-		if (indicesSize > mIndexBuffer->getSize())
+		// Buffers might be shared with other meshes, so only the mesh's own range can be written to
+		UINT32 maxIndicesSize = mProperties.mNumIndices * ibProps.getIndexSize();
+		if (indicesSize > maxIndicesSize)
 		{
-			indicesSize = mIndexBuffer->getSize();
+			indicesSize = maxIndicesSize;
 			LOGERR("Index buffer values are being written out of valid range.");
 		}
 
-		mIndexBuffer->writeData(0, indicesSize, srcIdxData, discardEntireBuffer ? BWT_DISCARD : BWT_NORMAL, queueIdx);
+		UINT32 indexOffset = getIndexOffset() * ibProps.getIndexSize();
+		mIndexBuffer->writeData(indexOffset, indicesSize, srcIdxData, discardEntireBuffer ? BWT_DISCARD : BWT_NORMAL,
+			queueIdx);
 
 		// Vertices
 		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
@@ -442,12 +541,15 @@ namespace bs
 			UINT32 bufferSize = meshData.getStreamSize(i);
 			UINT8* srcVertBufferData = meshData.getStreamData(i);
 
-			if (bufferSize > vertexBuffer->getSize())
+			UINT32 maxBufferSize = mProperties.mNumVertices * myVertSize;
+			if (bufferSize > maxBufferSize)
 			{
-				bufferSize = vertexBuffer->getSize();
+				bufferSize = maxBufferSize;
 				LOGERR("Vertex buffer values for stream \"" + toString(i) + "\" are being written out of valid range.");
 			}
 
+			UINT32 vertexOffset = getVertexOffset() * myVertSize;
+
 			if (RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::VertexColorFlip))
 			{
 				UINT8* bufferCopy = (UINT8*)bs_alloc(bufferSize);
@@ -470,14 +572,15 @@ namespace bs
 					}
 				}
 
-				vertexBuffer->writeData(0, bufferSize, bufferCopy, discardEntireBuffer ? BWT_DISCARD : BWT_NORMAL, queueIdx);
+				vertexBuffer->writeData(vertexOffset, bufferSize, bufferCopy,
+					discardEntireBuffer ? BWT_DISCARD : BWT_NORMAL, queueIdx);
 
 				bs_free(bufferCopy);
 			}
 			else
 			{
-				vertexBuffer->writeData(0, bufferSize, srcVertBufferData, discardEntireBuffer ? BWT_DISCARD : BWT_NORMAL,
-					queueIdx);
+				vertexBuffer->writeData(vertexOffset, bufferSize, srcVertBufferData,
+					discardEntireBuffer ? BWT_DISCARD : BWT_NORMAL, queueIdx);
 			}
 		}
 
@@ -504,7 +607,6 @@ namespace bs
 				return;
 			}
 
-			UINT8* idxData = static_cast<UINT8*>(mIndexBuffer->lock(GBL_READ_ONLY, deviceIdx, queueIdx));
 			UINT32 idxElemSize = ibProps.getIndexSize();
 
 			UINT8* indices = nullptr;
@@ -523,7 +625,10 @@ namespace bs
 				return;
 			}
 
-			memcpy(indices, idxData, numIndicesToCopy * idxElemSize);
+			UINT8* idxData = static_cast<UINT8*>(mIndexBuffer->lock(getIndexOffset() * idxElemSize, indicesSize,
+				GBL_READ_ONLY, deviceIdx, queueIdx));
+
+			memcpy(indices, idxData, indicesSize);
 
 			mIndexBuffer->unlock();
 		}
@@ -555,13 +660,14 @@ namespace bs
 				UINT32 numVerticesToCopy = meshData.getNumVertices();
 				UINT32 bufferSize = vbProps.getVertexSize() * numVerticesToCopy;
 
-				if (bufferSize > vertexBuffer->getSize())
+				if (numVerticesToCopy > mProperties.mNumVertices)
 				{
 					LOGERR("Vertex buffer values for stream \"" + toString(streamIdx) + "\" are being read out of valid range.");
 					continue;
 				}
 
-				UINT8* vertDataPtr = static_cast<UINT8*>(vertexBuffer->lock(GBL_READ_ONLY, deviceIdx, queueIdx));
+				UINT8* vertDataPtr = static_cast<UINT8*>(vertexBuffer->lock(getVertexOffset() * vbProps.getVertexSize(),
+					bufferSize, GBL_READ_ONLY, deviceIdx, queueIdx));
 
 				UINT8* dest = meshData.getStreamData(streamIdx);
 				memcpy(dest, vertDataPtr, bufferSize);
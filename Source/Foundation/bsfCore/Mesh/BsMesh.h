@@ -8,9 +8,12 @@
 #include "RenderAPI/BsVertexData.h"
 #include "RenderAPI/BsSubMesh.h"
 #include "Math/BsBounds.h"
+#include "Managers/BsMeshMemoryManager.h"
 
 namespace bs
 {
+	namespace ct { struct MeshLOD; }
+
 	/** @addtogroup Resources
 	 *  @{
 	 */
@@ -57,6 +60,24 @@ namespace bs
 		static MESH_DESC DEFAULT;
 	};
 
+	/** A simplified version of a mesh, rendered in its place once the mesh gets small enough on screen. */
+	struct BS_CORE_EXPORT MeshLOD
+	{
+		MeshLOD() { }
+		MeshLOD(const SPtr<Mesh>& mesh, float screenSize)
+			:mesh(mesh), screenSize(screenSize)
+		{ }
+
+		/** Mesh to render. Must have the same number of sub-meshes as the mesh it is a level of detail of. */
+		SPtr<Mesh> mesh;
+
+		/** 
+		 * Size of the mesh's bounds on screen, as a fraction of the viewport height, below which this level of detail is 
+		 * used.
+		 */
+		float screenSize = 0.0f;
+	};
+
 	/**
 	 * Primary class for holding geometry. Stores data in the form of vertex buffers and optionally an index buffer, which 
 	 * may be bound to the pipeline for drawing. May contain multiple sub-meshes.
@@ -125,6 +146,16 @@ namespace bs
 		BS_SCRIPT_EXPORT(pr:getter,n:MorphShapes)
 		SPtr<MorphShapes> getMorphShapes() const { return mMorphShapes; }
 
+		/**
+		 * Assigns a set of simplified versions of the mesh (levels of detail). The renderer will render a level of detail
+		 * in place of this mesh once the mesh gets smaller on screen than the level's screen size. Each level is a separate
+		 * mesh with its own GPU buffers, and must have the same number of sub-meshes as this mesh.
+		 */
+		void setLODs(const Vector<MeshLOD>& lods);
+
+		/** Returns levels of detail assigned by setLODs(), ordered from the most to the least detailed. */
+		const Vector<MeshLOD>& getLODs() const { return mLODs; }
+
 		/** Retrieves a core implementation of a mesh usable only from the core thread. */
 		SPtr<ct::Mesh> getCore() const;
 
@@ -153,6 +184,9 @@ namespace bs
 		/**	Updates the cached CPU buffers with new data. */
 		void updateCPUBuffer(UINT32 subresourceIdx, const MeshData& data);
 
+		/** Returns the core thread versions of the levels of detail in mLODs. */
+		Vector<ct::MeshLOD> getCoreLODs() const;
+
 		mutable SPtr<MeshData> mCPUData;
 
 		SPtr<VertexDataDesc> mVertexDesc;
@@ -160,6 +194,7 @@ namespace bs
 		IndexType mIndexType;
 		SPtr<Skeleton> mSkeleton; // Immutable
 		SPtr<MorphShapes> mMorphShapes; // Immutable
+		Vector<MeshLOD> mLODs;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -269,6 +304,13 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Core thread version of a bs::MeshLOD. */
+	struct MeshLOD
+	{
+		SPtr<Mesh> mesh;
+		float screenSize = 0.0f;
+	};
+
 	/**
 	 * Core thread portion of a bs::Mesh.
 	 *
@@ -293,12 +335,21 @@ namespace bs
 		/** @copydoc MeshBase::getVertexDesc */
 		SPtr<VertexDataDesc> getVertexDesc() const override;
 
+		/** @copydoc MeshBase::getVertexOffset */
+		UINT32 getVertexOffset() const override { return mSharedAllocation.vertexOffset; }
+
+		/** @copydoc MeshBase::getIndexOffset */
+		UINT32 getIndexOffset() const override { return mSharedAllocation.indexOffset; }
+
 		/** Returns a skeleton that can be used for animating the mesh. */
 		SPtr<Skeleton> getSkeleton() const { return mSkeleton; }
 
 		/** Returns an object containing all shapes used for morph animation, if any are available. */
 		SPtr<MorphShapes> getMorphShapes() const { return mMorphShapes; }
 
+		/** @copydoc bs::Mesh::getLODs */
+		const Vector<MeshLOD>& getLODs() const { return mLODs; }
+
 		/**
 		 * Updates the current mesh with the provided data.
 		 *
@@ -386,6 +437,14 @@ namespace bs
 		/** Updates bounds by calculating them from the vertices in the provided mesh data object. */
 		void updateBounds(const MeshData& meshData);
 
+		/**
+		 * Attempts to place the mesh's vertices and indices in buffers shared with other meshes, instead of creating
+		 * its own. Only static meshes that aren't animated are shared, as animation reads the vertex buffers directly.
+		 *
+		 * @return	True if the mesh was placed in shared buffers.
+		 */
+		bool allocateShared();
+
 		SPtr<VertexData> mVertexData;
 		SPtr<IndexBuffer> mIndexBuffer;
 
@@ -396,6 +455,8 @@ namespace bs
 		SPtr<MeshData> mTempInitialMeshData;
 		SPtr<Skeleton> mSkeleton; // Immutable
 		SPtr<MorphShapes> mMorphShapes; // Immutable
+		Vector<MeshLOD> mLODs;
+		MeshMemoryManager::Allocation mSharedAllocation;
 	};
 
 	/** @} */
@@ -10,6 +10,7 @@
 #include "Math/BsMath.h"
 #include "RenderAPI/BsEventQuery.h"
 #include "RenderAPI/BsRenderAPI.h"
+#include "Utility/BsTime.h"
 
 namespace bs
 {
@@ -85,7 +86,7 @@ namespace bs
 	MeshHeap::MeshHeap(UINT32 numVertices, UINT32 numIndices,
 		const SPtr<VertexDataDesc>& vertexDesc, IndexType indexType, GpuDeviceFlags deviceMask)
 		: mNumVertices(numVertices), mNumIndices(numIndices), mCPUIndexData(nullptr), mVertexDesc(vertexDesc)
-		, mIndexType(indexType), mDeviceMask(deviceMask), mNextQueryId(0)
+		, mIndexType(indexType), mDeviceMask(deviceMask)
 	{
 		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
 		{
@@ -120,158 +121,45 @@ namespace bs
 
 	void MeshHeap::alloc(SPtr<TransientMesh> mesh, const SPtr<MeshData>& meshData)
 	{
-		// Find free vertex chunk and grow if needed
-		UINT32 smallestVertFit = 0;
-		UINT32 smallestVertFitIdx = 0;
+		updateFences(true);
 
-		while (smallestVertFit == 0)
+		// Find free vertex range and grow if needed
+		UINT32 vertRange = mVertAllocator.alloc(meshData->getNumVertices());
+		while (vertRange == RangeAlloc::INVALID)
 		{
-			UINT32 curIdx = 0;
-			for (auto& chunkIdx : mFreeVertChunks)
+			UINT32 newNumVertices = std::max(mNumVertices, 1U);
+			while (newNumVertices < (mNumVertices + meshData->getNumVertices() + 1))
 			{
-				ChunkData& chunk = mVertChunks[chunkIdx];
-
-				if (chunk.size >= meshData->getNumVertices() && (chunk.size < smallestVertFit || smallestVertFit == 0))
-				{
-					smallestVertFit = chunk.size;
-					smallestVertFitIdx = curIdx;
-				}
-
-				curIdx++;
-			}
-
-			if (smallestVertFit > 0)
-				break;
-
-			UINT32 newNumVertices = mNumVertices;
-			while (newNumVertices < (mNumVertices + meshData->getNumVertices()))
-			{
-				newNumVertices = Math::roundToInt(newNumVertices * GrowPercent);
+				newNumVertices = Math::roundToInt(newNumVertices * GrowPercent) + 1;
 			}
 
 			growVertexBuffer(newNumVertices);
+			vertRange = mVertAllocator.alloc(meshData->getNumVertices());
 		}
 
-		// Find free index chunk and grow if needed
-		UINT32 smallestIdxFit = 0;
-		UINT32 smallestIdxFitIdx = 0;
-
-		while (smallestIdxFit == 0)
+		// Find free index range and grow if needed
+		UINT32 idxRange = mIdxAllocator.alloc(meshData->getNumIndices());
+		while (idxRange == RangeAlloc::INVALID)
 		{
-			UINT32 curIdx = 0;
-			for (auto& chunkIdx : mFreeIdxChunks)
+			UINT32 newNumIndices = std::max(mNumIndices, 1U);
+			while (newNumIndices < (mNumIndices + meshData->getNumIndices() + 1))
 			{
-				ChunkData& chunk = mIdxChunks[chunkIdx];
-
-				if (chunk.size >= meshData->getNumIndices() && (chunk.size < smallestIdxFit || smallestIdxFit == 0))
-				{
-					smallestIdxFit = chunk.size;
-					smallestIdxFitIdx = curIdx;
-				}
-
-				curIdx++;
-			}
-
-			if (smallestIdxFit > 0)
-				break;
-
-			UINT32 newNumIndices = mNumIndices;
-			while (newNumIndices < (mNumIndices + meshData->getNumIndices()))
-			{
-				newNumIndices = Math::roundToInt(newNumIndices * GrowPercent);
+				newNumIndices = Math::roundToInt(newNumIndices * GrowPercent) + 1;
 			}
 
 			growIndexBuffer(newNumIndices);
+			idxRange = mIdxAllocator.alloc(meshData->getNumIndices());
 		}
 
-		UINT32 freeVertChunkIdx = 0;
-		UINT32 freeIdxChunkIdx = 0;
-
-		auto freeVertIter = mFreeVertChunks.begin();
-		freeVertChunkIdx = (*freeVertIter);
-		for (UINT32 i = 0; i < smallestVertFitIdx; i++)
-		{
-			freeVertIter++;
-			freeVertChunkIdx = (*freeVertIter);
-		}
-
-		mFreeVertChunks.erase(freeVertIter);
-
-		auto freeIdxIter = mFreeIdxChunks.begin();
-		freeIdxChunkIdx = (*freeIdxIter);
-		for (UINT32 i = 0; i < smallestIdxFitIdx; i++)
-		{
-			freeIdxIter++;
-			freeIdxChunkIdx = (*freeIdxIter);
-		}
-
-		mFreeIdxChunks.erase(freeIdxIter);
-
-		ChunkData& vertChunk = mVertChunks[freeVertChunkIdx];
-		ChunkData& idxChunk = mIdxChunks[freeIdxChunkIdx];
-
-		UINT32 vertChunkStart = vertChunk.start;
-		UINT32 idxChunkStart = idxChunk.start;
-
-		UINT32 remainingNumVerts = vertChunk.size - meshData->getNumVertices();
-		UINT32 remainingNumIdx = idxChunk.size - meshData->getNumIndices();
-
-		vertChunk.size = meshData->getNumVertices();
-		idxChunk.size = meshData->getNumIndices();
-
-		if (remainingNumVerts > 0)
-		{
-			if (!mEmptyVertChunks.empty())
-			{
-				UINT32 emptyChunkIdx = mEmptyVertChunks.top();
-				ChunkData& emptyChunk = mVertChunks[emptyChunkIdx];
-				mEmptyVertChunks.pop();
-
-				emptyChunk.start = vertChunkStart + meshData->getNumVertices();
-				emptyChunk.size = remainingNumVerts;
-			}
-			else
-			{
-				ChunkData newChunk;
-				newChunk.size = remainingNumVerts;
-				newChunk.start = vertChunkStart + meshData->getNumVertices();
-
-				mVertChunks.push_back(newChunk);
-				mFreeVertChunks.push_back((UINT32)(mVertChunks.size() - 1));
-			}
-		}
-
-		if (remainingNumIdx > 0)
-		{
-			if (!mEmptyIdxChunks.empty())
-			{
-				UINT32 emptyChunkIdx = mEmptyIdxChunks.top();
-				ChunkData& emptyChunk = mIdxChunks[emptyChunkIdx];
-				mEmptyIdxChunks.pop();
-
-				emptyChunk.start = idxChunkStart + meshData->getNumIndices();
-				emptyChunk.size = remainingNumIdx;
-			}
-			else
-			{
-				ChunkData newChunk;
-				newChunk.size = remainingNumIdx;
-				newChunk.start = idxChunkStart + meshData->getNumIndices();
-
-				mIdxChunks.push_back(newChunk);
-				mFreeIdxChunks.push_back((UINT32)(mIdxChunks.size() - 1));
-			}
-		}
+		UINT32 vertChunkStart = mVertAllocator.getStart(vertRange);
+		UINT32 idxChunkStart = mIdxAllocator.getStart(idxRange);
 
 		AllocatedData newAllocData;
-		newAllocData.vertChunkIdx = freeVertChunkIdx;
-		newAllocData.idxChunkIdx = freeIdxChunkIdx;
-		newAllocData.useFlags = UseFlags::GPUFree;
-		newAllocData.eventQueryIdx = createEventQuery();
+		newAllocData.vertRange = vertRange;
+		newAllocData.idxRange = idxRange;
 		newAllocData.mesh = mesh;
 
 		mMeshAllocData[mesh->getMeshHeapId()] = newAllocData;
-
 		// Actually copy data
 		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
 		{
@@ -336,28 +224,82 @@ namespace bs
 
 	void MeshHeap::dealloc(SPtr<TransientMesh> mesh)
 	{
+		updateFences(true);
+
 		auto findIter = mMeshAllocData.find(mesh->getMeshHeapId());
 		assert(findIter != mMeshAllocData.end());
 
 		AllocatedData& allocData = findIter->second;
-		if (allocData.useFlags == UseFlags::GPUFree)
+
+		FreedRanges ranges;
+		ranges.vertRange = allocData.vertRange;
+		ranges.idxRange = allocData.idxRange;
+
+		// Free immediately if the GPU is done with the mesh, otherwise wait until the first fence issued after its
+		// last use is reached
+		if (allocData.lastUsedFence <= mCompletedFenceId)
+			freeRanges(ranges);
+		else if (allocData.lastUsedFence == mNextFenceId)
+			mUnfencedFrees.push_back(ranges);
+		else
+			mFences[allocData.lastUsedFence - mCompletedFenceId - 1].pendingFrees.push_back(ranges);
+
+		mMeshAllocData.erase(findIter);
+	}
+
+	void MeshHeap::updateFences(bool reclaim)
+	{
+		// Only a single fence per frame is issued, covering all uses of the heap's meshes since the previous one
+		UINT64 frameIdx = gTime().getFrameIdx();
+		if (mFenceNeeded && frameIdx != mLastFenceFrame)
 		{
-			allocData.useFlags = UseFlags::Free;
-			freeEventQuery(allocData.eventQueryIdx);
+			Fence fence;
+			if (!mFreeQueries.empty())
+			{
+				fence.query = mFreeQueries.back();
+				mFreeQueries.pop_back();
+			}
+			else
+				fence.query = EventQuery::create();
+
+			fence.query->begin();
+			fence.pendingFrees = std::move(mUnfencedFrees);
+			mUnfencedFrees.clear();
+
+			mFences.push_back(std::move(fence));
+
+			mNextFenceId++;
+			mLastFenceFrame = frameIdx;
+			mFenceNeeded = false;
+		}
+
+		if (!reclaim)
+			return;
 
-			mFreeVertChunks.push_back(allocData.vertChunkIdx);
-			mFreeIdxChunks.push_back(allocData.idxChunkIdx);
+		// Fences are reached in the order they were issued
+		while (!mFences.empty() && mFences.front().query->isReady())
+		{
+			Fence& fence = mFences.front();
+			for (auto& entry : fence.pendingFrees)
+				freeRanges(entry);
 
-			mergeWithNearbyChunks(allocData.vertChunkIdx, allocData.idxChunkIdx);
+			mFreeQueries.push_back(fence.query);
+			mFences.pop_front();
 
-			mMeshAllocData.erase(findIter);
+			mCompletedFenceId++;
 		}
-		else if (allocData.useFlags == UseFlags::Used)
-			allocData.useFlags = UseFlags::CPUFree;
+	}
+
+	void MeshHeap::freeRanges(const FreedRanges& ranges)
+	{
+		mVertAllocator.free(ranges.vertRange);
+		mIdxAllocator.free(ranges.idxRange);
 	}
 
 	void MeshHeap::growVertexBuffer(UINT32 numVertices)
 	{
+		UINT32 oldNumVertices = mNumVertices;
+
 		mNumVertices = numVertices;
 		mVertexData = SPtr<VertexData>(bs_new<VertexData>());
 
@@ -380,71 +322,28 @@ namespace bs
 			SPtr<VertexBuffer> vertexBuffer = VertexBuffer::create(desc, mDeviceMask);
 			mVertexData->setBuffer(i, vertexBuffer);
 
-			// Copy all data to the new buffer
+			// Copy all data to the new buffer. Allocated ranges keep their offsets, new space is added at the end.
 			UINT8* oldBuffer = mCPUVertexData[i];
 			UINT8* buffer = (UINT8*)bs_alloc(vertSize * numVertices);
 
-			UINT32 destOffset = 0;
 			if (oldBuffer != nullptr)
 			{
-				for (auto& allocData : mMeshAllocData)
-				{
-					ChunkData& oldChunk = mVertChunks[allocData.second.vertChunkIdx];
-
-					UINT8* oldData = oldBuffer + oldChunk.start * vertSize;
-					memcpy(buffer + destOffset * vertSize, oldData, oldChunk.size * vertSize);
-
-					destOffset += oldChunk.size;
-				}
-
+				memcpy(buffer, oldBuffer, oldNumVertices * vertSize);
 				bs_free(oldBuffer);
-			}
 
-			if (destOffset > 0)
-				vertexBuffer->writeData(0, destOffset * vertSize, buffer, BTW_NO_OVERWRITE);
+				if (oldNumVertices > 0)
+					vertexBuffer->writeData(0, oldNumVertices * vertSize, buffer, BTW_NO_OVERWRITE);
+			}
 
 			mCPUVertexData[i] = buffer;
 		}
 
-		// Reorder chunks
-		UINT32 destOffset = 0;
-		Vector<ChunkData> newVertChunks;
-		List<UINT32> freeVertChunks;
-
-		for (auto& allocData : mMeshAllocData)
-		{
-			ChunkData& oldChunk = mVertChunks[allocData.second.vertChunkIdx];
-
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = oldChunk.size;
-
-			allocData.second.vertChunkIdx = (UINT32)newVertChunks.size();
-			newVertChunks.push_back(newChunk);
-
-			destOffset += oldChunk.size;
-		}
-
-		// Add free chunk
-		if (destOffset != mNumVertices)
-		{
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = mNumVertices - destOffset;
-
-			newVertChunks.push_back(newChunk);
-			freeVertChunks.push_back((UINT32)(newVertChunks.size() - 1));
-		}
-
-		mVertChunks = newVertChunks;
-		mFreeVertChunks = freeVertChunks;
-
-		while (!mEmptyVertChunks.empty())
-			mEmptyVertChunks.pop();
+		mVertAllocator.grow(mNumVertices);
 	}
 
 	void MeshHeap::growIndexBuffer(UINT32 numIndices)
 	{
+		UINT32 oldNumIndices = mNumIndices;
 		mNumIndices = numIndices;
 
 		INDEX_BUFFER_DESC ibDesc;
@@ -456,96 +355,23 @@ namespace bs
 
 		const IndexBufferProperties& ibProps = mIndexBuffer->getProperties();
 
-		// Copy all data to the new buffer
+		// Copy all data to the new buffer. Allocated ranges keep their offsets, the new space is appended at the end.
 		UINT32 idxSize = ibProps.getIndexSize();
 
 		UINT8* oldBuffer = mCPUIndexData;
 		UINT8* buffer = (UINT8*)bs_alloc(idxSize * numIndices);
 
-		UINT32 destOffset = 0;
 		if (oldBuffer != nullptr)
 		{
-			for (auto& allocData : mMeshAllocData)
-			{
-				ChunkData& oldChunk = mIdxChunks[allocData.second.idxChunkIdx];
-
-				UINT8* oldData = oldBuffer + oldChunk.start * idxSize;
-				memcpy(buffer + destOffset * idxSize, oldData, oldChunk.size * idxSize);
-
-				destOffset += oldChunk.size;
-			}
-
+			memcpy(buffer, oldBuffer, oldNumIndices * idxSize);
 			bs_free(oldBuffer);
-		}
-
-		if (destOffset > 0)
-			mIndexBuffer->writeData(0, destOffset * idxSize, buffer, BTW_NO_OVERWRITE);
-
-		mCPUIndexData = buffer;
-
-		// Reorder chunks
-		destOffset = 0;
-		Vector<ChunkData> newIdxChunks;
-		List<UINT32> freeIdxChunks;
 
-		for (auto& allocData : mMeshAllocData)
-		{
-			ChunkData& oldChunk = mIdxChunks[allocData.second.idxChunkIdx];
-
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = oldChunk.size;
-
-			allocData.second.idxChunkIdx = (UINT32)newIdxChunks.size();
-			newIdxChunks.push_back(newChunk);
-
-			destOffset += oldChunk.size;
+			if (oldNumIndices > 0)
+				mIndexBuffer->writeData(0, oldNumIndices * idxSize, buffer, BTW_NO_OVERWRITE);
 		}
 
-		// Add free chunk
-		if (destOffset != mNumIndices)
-		{
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = mNumIndices - destOffset;
-
-			newIdxChunks.push_back(newChunk);
-			freeIdxChunks.push_back((UINT32)(newIdxChunks.size() - 1));
-		}
-
-		mIdxChunks = newIdxChunks;
-		mFreeIdxChunks = freeIdxChunks;
-
-		while (!mEmptyIdxChunks.empty())
-			mEmptyIdxChunks.pop();
-	}
-
-	UINT32 MeshHeap::createEventQuery()
-	{
-		UINT32 idx = 0;
-		if (mFreeEventQueries.size() > 0)
-		{
-			idx = mFreeEventQueries.top();
-			mFreeEventQueries.pop();
-		}
-		else
-		{
-			QueryData newQuery;
-			newQuery.query = EventQuery::create();
-			newQuery.queryId = 0;
-
-			mEventQueries.push_back(newQuery);
-			idx = (UINT32)(mEventQueries.size() - 1);
-		}
-
-		return idx;
-	}
-
-	void MeshHeap::freeEventQuery(UINT32 idx)
-	{
-		mEventQueries[idx].query->onTriggered.clear();
-		mEventQueries[idx].queryId = 0;
-		mFreeEventQueries.push(idx);
+		mCPUIndexData = buffer;
+		mIdxAllocator.grow(mNumIndices);
 	}
 
 	SPtr<VertexData> MeshHeap::getVertexData() const
@@ -568,8 +394,7 @@ namespace bs
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		UINT32 chunkIdx = findIter->second.vertChunkIdx;
-		return mVertChunks[chunkIdx].start;
+		return mVertAllocator.getStart(findIter->second.vertRange);
 	}
 
 	UINT32 MeshHeap::getIndexOffset(UINT32 meshId) const
@@ -577,8 +402,7 @@ namespace bs
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		UINT32 chunkIdx = findIter->second.idxChunkIdx;
-		return mIdxChunks[chunkIdx].start;
+		return mIdxAllocator.getStart(findIter->second.idxRange);
 	}
 
 	void MeshHeap::notifyUsedOnGPU(UINT32 meshId)
@@ -586,128 +410,11 @@ namespace bs
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		AllocatedData& allocData = findIter->second;
-		assert(allocData.useFlags != UseFlags::Free);
-
-		if (allocData.useFlags == UseFlags::GPUFree)
-			allocData.useFlags = UseFlags::Used;
-
-		SPtr<MeshHeap> thisPtr = std::static_pointer_cast<MeshHeap>(getThisPtr());
-
-		QueryData& queryData = mEventQueries[allocData.eventQueryIdx];
-		queryData.queryId = mNextQueryId++;
-		queryData.query->onTriggered.clear();
-		queryData.query->onTriggered.connect(std::bind(&MeshHeap::queryTriggered, thisPtr, meshId, queryData.queryId));
-		queryData.query->begin();
-	}
-
-	// Note: Need to use a shared ptr here to ensure MeshHeap doesn't get deallocated sometime during this callback
-	void MeshHeap::queryTriggered(SPtr<MeshHeap> thisPtr, UINT32 meshId, UINT32 queryId)
-	{
-		auto findIter = thisPtr->mMeshAllocData.find(meshId);
-		assert(findIter != thisPtr->mMeshAllocData.end());
-
-		AllocatedData& allocData = findIter->second;
+		// Issue a fence for uses from previous frames, if not done already. This use will be covered by the next fence.
+		updateFences(false);
 
-		// If query ids don't match then it means there either a more recent query or
-		// the buffer was discarded and we are not interested in query result
-		QueryData& queryData = thisPtr->mEventQueries[allocData.eventQueryIdx];
-		if (queryId == queryData.queryId)
-		{
-			assert(allocData.useFlags != UseFlags::Free && allocData.useFlags != UseFlags::GPUFree);
-
-			if (allocData.useFlags == UseFlags::CPUFree)
-			{
-				allocData.useFlags = UseFlags::Free;
-				thisPtr->freeEventQuery(allocData.eventQueryIdx);
-
-				thisPtr->mFreeVertChunks.push_back(allocData.vertChunkIdx);
-				thisPtr->mFreeIdxChunks.push_back(allocData.idxChunkIdx);
-
-				thisPtr->mergeWithNearbyChunks(allocData.vertChunkIdx, allocData.idxChunkIdx);
-
-				thisPtr->mMeshAllocData.erase(findIter);
-			}
-			else
-				allocData.useFlags = UseFlags::GPUFree;
-		}
-
-		queryData.query->onTriggered.clear();
-	}
-
-	void MeshHeap::mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx)
-	{
-		// Merge vertex chunks
-		ChunkData& vertChunk = mVertChunks[chunkVertIdx];
-		for (auto& freeChunkIdx : mFreeVertChunks)
-		{
-			if (chunkVertIdx == freeChunkIdx)
-				continue;
-
-			ChunkData& curChunk = mVertChunks[freeChunkIdx];
-			if (curChunk.size == 0) // Already merged
-				continue;
-
-			bool merged = false;
-			if (curChunk.start == (vertChunk.start + vertChunk.size))
-			{
-				vertChunk.size += curChunk.size;
-
-				merged = true;
-			}
-			else if ((curChunk.start + curChunk.size) == vertChunk.start)
-			{
-				vertChunk.start = curChunk.start;
-				vertChunk.size += curChunk.size;
-
-				merged = true;
-			}
-
-			if (merged)
-			{
-				// We can't remove the chunk since that would break the indexing scheme, so 
-				// mark it as empty and set size to 0. It will be reused when needed.
-				curChunk.start = 0;
-				curChunk.size = 0;
-				mEmptyVertChunks.push(freeChunkIdx);
-			}
-		}
-
-		// Merge index chunks
-		ChunkData& idxChunk = mIdxChunks[chunkIdxIdx];
-		for (auto& freeChunkIdx : mFreeIdxChunks)
-		{
-			if (chunkIdxIdx == freeChunkIdx)
-				continue;
-
-			ChunkData& curChunk = mIdxChunks[freeChunkIdx];
-			if (curChunk.size == 0) // Already merged
-				continue;
-
-			bool merged = false;
-			if (curChunk.start == (idxChunk.start + idxChunk.size))
-			{
-				idxChunk.size += curChunk.size;
-
-				merged = true;
-			}
-			else if ((curChunk.start + curChunk.size) == idxChunk.start)
-			{
-				idxChunk.start = curChunk.start;
-				idxChunk.size += curChunk.size;
-
-				merged = true;
-			}
-
-			if (merged)
-			{
-				// We can't remove the chunk since that would break the indexing scheme, so 
-				// mark it as empty and set size to 0. It will be reused when needed.
-				curChunk.start = 0;
-				curChunk.size = 0;
-				mEmptyIdxChunks.push(freeChunkIdx);
-			}
-		}
+		findIter->second.lastUsedFence = mNextFenceId;
+		mFenceNeeded = true;
 	}
 	}
-}
\ No newline at end of file
+}
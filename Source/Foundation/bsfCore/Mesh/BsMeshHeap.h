@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "CoreThread/BsCoreObject.h"
 #include "RenderAPI/BsIndexBuffer.h"
+#include "Allocators/BsRangeAlloc.h"
 
 namespace bs
 {
@@ -91,37 +92,28 @@ namespace bs
 	 */
 	class BS_CORE_EXPORT MeshHeap : public CoreObject
 	{
-		/**	Signifies how is a data chunk used. */
-		enum class UseFlags
-		{
-			Used, /**< Data chunk is used by both CPU and GPU. */
-			CPUFree, /**< Data chunk was released by CPU but not GPU. */
-			GPUFree, /**< Data chunk was released by GPU but not CPU. */
-			Free /**< Data chunk was released by both CPU and GPU. */
-		};
-
-		/**	Represents a continuous chunk of memory. */
-		struct ChunkData
-		{
-			UINT32 start, size;
-		};
-
 		/**	Represents an allocated piece of data representing a mesh. */
 		struct AllocatedData
 		{
-			UINT32 vertChunkIdx;
-			UINT32 idxChunkIdx;
+			UINT32 vertRange;
+			UINT32 idxRange;
 
-			UseFlags useFlags;
-			UINT32 eventQueryIdx;
+			UINT32 lastUsedFence = 0; /**< Fence issued after the mesh was last used by the GPU, zero if never used. */
 			SPtr<TransientMesh> mesh;
 		};
 
-		/**	Data about a GPU query. */
-		struct QueryData
+		/** Vertex and index ranges of a deallocated mesh. */
+		struct FreedRanges
+		{
+			UINT32 vertRange;
+			UINT32 idxRange;
+		};
+
+		/** GPU fence issued once per frame, if the heap's meshes were used during that frame. */
+		struct Fence
 		{
 			SPtr<EventQuery> query;
-			UINT32 queryId;
+			Vector<FreedRanges> pendingFrees; /**< Ranges that can be reused once the fence is reached. */
 		};
 
 	public:
@@ -156,13 +148,13 @@ namespace bs
 		void growIndexBuffer(UINT32 numIndices);
 
 		/**
-		 * Creates a new event query or returns an existing one from the pool if available. Returned value is an index 
-		 * into event query array.
+		 * Issues a fence covering the meshes used so far, unless one was already issued during the current frame. 
+		 * Optionally also releases ranges of deallocated meshes the GPU is done with.
 		 */
-		UINT32 createEventQuery();
+		void updateFences(bool reclaim);
 
-		/** Frees the event query with the specified index and returns it to the pool so it may be reused later. */
-		void freeEventQuery(UINT32 idx);
+		/** Makes the provided ranges available for allocation. */
+		void freeRanges(const FreedRanges& ranges);
 
 		/**	Gets internal vertex data for all the meshes. */
 		SPtr<VertexData> getVertexData() const;
@@ -186,20 +178,6 @@ namespace bs
 		/** Called by the render system when a mesh gets queued to the GPU. */
 		void notifyUsedOnGPU(UINT32 meshId);
 
-		/**
-		 * Called by an GPU event query when GPU processes the query. Normally signals the heap that the GPU is done with 
-		 * the mesh.
-		 */
-		static void queryTriggered(SPtr<MeshHeap> thisPtr, UINT32 meshId, UINT32 queryId);
-
-		/**
-		 * Attempts to reorganize the vertex and index buffer chunks in order to in order to make free memory contigous.
-		 *
-		 * @note	
-		 * This will not actually copy any data from index/vertex buffers, and will only modify the chunk descriptors.
-		 */
-		void mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx);
-
 	private:
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
@@ -210,25 +188,23 @@ namespace bs
 		SPtr<VertexData> mVertexData;
 		SPtr<IndexBuffer> mIndexBuffer;
 
-		Map<UINT32, AllocatedData> mMeshAllocData;
+		UnorderedMap<UINT32, AllocatedData> mMeshAllocData;
 
 		SPtr<VertexDataDesc> mVertexDesc;
 		IndexType mIndexType;
 		GpuDeviceFlags mDeviceMask;
 
-		Vector<ChunkData> mVertChunks;
-		Vector<ChunkData> mIdxChunks;
-
-		Stack<UINT32> mEmptyVertChunks;
-		Stack<UINT32> mEmptyIdxChunks;
-
-		List<UINT32> mFreeVertChunks;
-		List<UINT32> mFreeIdxChunks;
+		RangeAlloc mVertAllocator;
+		RangeAlloc mIdxAllocator;
 
-		Vector<QueryData> mEventQueries; 
-		Stack<UINT32> mFreeEventQueries;
+		Deque<Fence> mFences; // Issued but not yet reached, the first one has ID mCompletedFenceId + 1
+		Vector<FreedRanges> mUnfencedFrees; // Freed meshes used after the last issued fence
+		Vector<SPtr<EventQuery>> mFreeQueries;
 
-		UINT32 mNextQueryId;
+		UINT32 mNextFenceId = 1;
+		UINT32 mCompletedFenceId = 0;
+		UINT64 mLastFenceFrame = 0;
+		bool mFenceNeeded = false;
 
 		static const float GrowPercent;
 	};
@@ -5,6 +5,10 @@
 #include "Math/BsVector3.h"
 #include "Math/BsVector2.h"
 #include "Math/BsPlane.h"
+#include "Math/BsSIMD.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "RenderAPI/BsSubMesh.h"
 
 namespace bs
 {
@@ -78,650 +82,219 @@ namespace bs
 		UINT32* mFaces;
 	};
 
-	/** Provides base methods required for clipping of arbitrary triangles. */
-	class TriangleClipperBase // Implementation from: http://www.geometrictools.com/Documentation/ClipMesh.pdf
-	{
-	protected:
-		/** Single vertex in the clipped mesh. */
-		struct ClipVert
-		{
-			ClipVert() { }
-
-			Vector3 point = Vector3::ZERO;
-			Vector2 uv = Vector2::ZERO;
-			float distance = 0.0f;
-			UINT32 occurs = 0;
-			bool visible = true;
-		};
-
-		/** Single edge in the clipped mesh. */
-		struct ClipEdge
-		{
-			ClipEdge() { }
-
-			UINT32 verts[2];
-			Vector<UINT32> faces;
-			bool visible = true;
-		};
-
-		/** Single polygon in the clipped mesh. */
-		struct ClipFace
-		{
-			ClipFace() { }
-
-			Vector<UINT32> edges;
-			bool visible = true;
-			Vector3 normal = Vector3::ZERO;
-		};
-
-		/** Contains vertices, edges and faces of the clipped mesh. */
-		struct ClipMesh
-		{
-			ClipMesh() { }
-
-			Vector<ClipVert> verts;
-			Vector<ClipEdge> edges;
-			Vector<ClipFace> faces;
-		};
-
-	protected:
-		/** 
-		 * Register all edges and faces, using the mesh vertices as a basis. Assumes vertices are not indexed and that
-		 * every three vertices form a face
-		 */
-		void addEdgesAndFaces();
-
-		/** Clips the current mesh with the provided plane. */
-		INT32 clipByPlane(const Plane& plane);
-
-		/** Clips vertices of the current mesh by the provided plane. */
-		INT32 processVertices(const Plane& plane);
-
-		/** Clips edges of the current mesh. processVertices() must be called beforehand. */
-		void processEdges();
-
-		/** Clips the faces (polygons) of the current mesh. processEdges() must be called beforehand. */
-		void processFaces();
-
-		/** 
-		 * Returns a set of non-culled vertex indices for every visible face in the mesh. This should be called after
-		 * clipping operation is complete to retrieve valid vertices.		 
-		 */
-		void getOrderedFaces(FrameVector<FrameVector<UINT32>>& sortedFaces);
-
-		/** Returns a set of ordered and non-culled vertices for the provided face of the mesh */
-		void getOrderedVertices(const ClipFace& face, UINT32* vertices);
+	/** Returns the position of a clipped vertex as a three-dimensional point, for testing against the clip planes. */
+	static Vector3 toClipPoint(const Vector2& position) { return Vector3(position.x, position.y, 0.0f); }
 
-		/** Calculates the normal for vertices related to the provided vertex indices. */
-		Vector3 getNormal(UINT32* sortedVertices, UINT32 numVertices);
+	/** @copydoc toClipPoint(const Vector2&) */
+	static Vector3 toClipPoint(const Vector3& position) { return position; }
 
-		/** 
-		 * Checks is the polygon shape of the provided face open or closed. If open, returns true and outputs endpoints of
-		 * the polyline.
-		 */
-		bool getOpenPolyline(ClipFace& face, UINT32& start, UINT32& end);
-
-		ClipMesh mesh;
-	};
-
-	void TriangleClipperBase::addEdgesAndFaces()
+	/** Vertex of a polygon created by clipping a triangle. */
+	template<class VertexType>
+	struct ClipPolygonVertex
 	{
-		UINT32 numTris = (UINT32)mesh.verts.size() / 3;
-
-		UINT32 numEdges = numTris * 3;
-		mesh.edges.resize(numEdges);
-		mesh.faces.resize(numTris);
-
-		for (UINT32 i = 0; i < numTris; i++)
-		{
-			UINT32 idx0 = i * 3 + 0;
-			UINT32 idx1 = i * 3 + 1;
-			UINT32 idx2 = i * 3 + 2;
-
-			ClipEdge& clipEdge0 = mesh.edges[idx0];
-			clipEdge0.verts[0] = idx0;
-			clipEdge0.verts[1] = idx1;
-
-			ClipEdge& clipEdge1 = mesh.edges[idx1];
-			clipEdge1.verts[0] = idx1;
-			clipEdge1.verts[1] = idx2;
-
-			ClipEdge& clipEdge2 = mesh.edges[idx2];
-			clipEdge2.verts[0] = idx2;
-			clipEdge2.verts[1] = idx0;
-
-			ClipFace& clipFace = mesh.faces[i];
-
-			clipFace.edges.push_back(idx0);
-			clipFace.edges.push_back(idx1);
-			clipFace.edges.push_back(idx2);
-
-			clipEdge0.faces.push_back(i);
-			clipEdge1.faces.push_back(i);
-			clipEdge2.faces.push_back(i);
-
-			UINT32 verts[] = { idx0, idx1, idx2, idx0 };
-			for (UINT32 j = 0; j < 3; j++)
-				clipFace.normal += Vector3::cross(mesh.verts[verts[j]].point, mesh.verts[verts[j + 1]].point);
-
-			clipFace.normal.normalize();
-		}
-	}
-
-	INT32 TriangleClipperBase::clipByPlane(const Plane& plane)
-	{
-		int state = processVertices(plane);
-
-		if (state == 1)
-			return +1; // Nothing is clipped
-		else if (state == -1)
-			return -1; // Everything is clipped
-
-		processEdges();
-		processFaces();
-
-		return 0;
-	}
+		VertexType position;
+		Vector2 uv;
+	};
 
-	INT32 TriangleClipperBase::processVertices(const Plane& plane)
+	/**
+	 * Clips a single polygon against the provided planes using the Sutherland-Hodgman algorithm. @p polygon must have
+	 * room for at least 3 + @p numPlanes vertices. Returns the number of vertices of the clipped polygon.
+	 */
+	template<class VertexType>
+	static UINT32 clipPolygon(ClipPolygonVertex<VertexType>* polygon, UINT32 numVertices, const Plane* clipPlanes,
+		UINT32 numPlanes)
 	{
-		static const float EPSILON = 0.00001f;
-
-		// Compute signed distances from vertices to plane
-		int positive = 0, negative = 0;
-		for (UINT32 i = 0; i < (UINT32)mesh.verts.size(); i++)
-		{
-			ClipVert& vertex = mesh.verts[i];
+		ClipPolygonVertex<VertexType> clipped[3 + MeshUtility::MAX_CLIP_PLANES];
 
-			if (vertex.visible)
-			{
-				vertex.distance = Vector3::dot(plane.normal, vertex.point) - plane.d;
-				if (vertex.distance >= EPSILON)
-				{
-					positive++;
-				}
-				else if (vertex.distance <= -EPSILON)
-				{
-					negative++;
-					vertex.visible = false;
-				}
-				else
-				{
-					// Point on the plane within floating point tolerance
-					vertex.distance = 0;
-				}
-			}
-		}
-		if (negative == 0)
+		for (UINT32 i = 0; i < numPlanes && numVertices > 0; i++)
 		{
-			// All vertices on nonnegative side, no clipping
-			return +1;
-		}
-		if (positive == 0)
-		{
-			// All vertices on nonpositive side, everything clipped
-			return -1;
-		}
-
-		return 0;
-	}
+			const Plane& plane = clipPlanes[i];
 
-	void TriangleClipperBase::processEdges()
-	{
-		for (UINT32 i = 0; i < (UINT32)mesh.edges.size(); i++)
-		{
-			ClipEdge& edge = mesh.edges[i];
+			UINT32 numClipped = 0;
+			UINT32 prevIdx = numVertices - 1;
+			float prevDist = plane.getDistance(toClipPoint(polygon[prevIdx].position));
 
-			if (edge.visible)
+			for (UINT32 j = 0; j < numVertices; j++)
 			{
-				const ClipVert& v0 = mesh.verts[edge.verts[0]];
-				const ClipVert& v1 = mesh.verts[edge.verts[1]];
-
-				float d0 = v0.distance;
-				float d1 = v1.distance;
+				float dist = plane.getDistance(toClipPoint(polygon[j].position));
 
-				if (d0 <= 0 && d1 <= 0)
+				// Edge crosses the plane, add the intersection point
+				if ((dist >= 0.0f) != (prevDist >= 0.0f))
 				{
-					// Edge is culled, remove edge from faces sharing it
-					for (UINT32 j = 0; j < (UINT32)edge.faces.size(); j++)
-					{
-						ClipFace& face = mesh.faces[edge.faces[j]];
-
-						auto iterFind = std::find(face.edges.begin(), face.edges.end(), i);
-						if (iterFind != face.edges.end())
-						{
-							face.edges.erase(iterFind);
-
-							if (face.edges.empty())
-								face.visible = false;
-						}
-					}
-
-					edge.visible = false;
-					continue;
-				}
+					float t = prevDist / (prevDist - dist);
 
-				if (d0 >= 0 && d1 >= 0)
-				{
-					// Edge is on nonnegative side, faces retain the edge
-					continue;
+					ClipPolygonVertex<VertexType>& vertex = clipped[numClipped++];
+					vertex.position = polygon[prevIdx].position + (polygon[j].position - polygon[prevIdx].position) * t;
+					vertex.uv = polygon[prevIdx].uv + (polygon[j].uv - polygon[prevIdx].uv) * t;
 				}
 
-				// The edge is split by the plane. Compute the point of intersection.
-				// If the old edge is <V0,V1> and I is the intersection point, the new
-				// edge is <V0,I> when d0 > 0 or <I,V1> when d1 > 0.
-				float t = d0 / (d0 - d1);
-				Vector3 intersectPt = (1 - t)*v0.point + t*v1.point;
-				Vector2 intersectUv = (1 - t)*v0.uv + t*v1.uv;
-
-				UINT32 newVertIdx = (UINT32)mesh.verts.size();
-				mesh.verts.push_back(ClipVert());
-
-				ClipVert& newVert = mesh.verts.back();
-				newVert.point = intersectPt;
-				newVert.uv = intersectUv;
+				if (dist >= 0.0f)
+					clipped[numClipped++] = polygon[j];
 
-				if (d0 > 0)
-					mesh.edges[i].verts[1] = newVertIdx;
-				else
-					mesh.edges[i].verts[0] = newVertIdx;
+				prevIdx = j;
+				prevDist = dist;
 			}
+
+			memcpy(polygon, clipped, numClipped * sizeof(ClipPolygonVertex<VertexType>));
+			numVertices = numClipped;
 		}
+
+		return numVertices;
 	}
 
-	void TriangleClipperBase::processFaces()
+	/** Implementation of MeshUtility::clipTriangles2D() and MeshUtility::clipTriangles3D(). */
+	template<class VertexType>
+	static UINT32 clipTriangles(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+		const Plane* clipPlanes, UINT32 numPlanes, VertexType* outVertices, Vector2* outUVs)
 	{
-		for (UINT32 i = 0; i < (UINT32)mesh.faces.size(); i++)
-		{
-			ClipFace& face = mesh.faces[i];
+		assert(numPlanes <= MeshUtility::MAX_CLIP_PLANES);
 
-			if (face.visible)
-			{
-				// The edge is culled. If the edge is exactly on the clip
-				// plane, it is possible that a visible triangle shares it.
-				// The edge will be re-added during the face loop.
-
-				for (UINT32 j = 0; j < (UINT32)face.edges.size(); j++)
-				{
-					ClipEdge& edge = mesh.edges[face.edges[j]];
-					ClipVert& v0 = mesh.verts[edge.verts[0]];
-					ClipVert& v1 = mesh.verts[edge.verts[1]];
+		static constexpr UINT32 BATCH_SIZE = 4;
 
-					v0.occurs = 0;
-					v1.occurs = 0;
-				}
-			}
-
-			UINT32 start, end;
-			if (getOpenPolyline(mesh.faces[i], start, end))
-			{
-				// Polyline is open, close it
-				UINT32 closeEdgeIdx = (UINT32)mesh.edges.size();
-				mesh.edges.push_back(ClipEdge());
-				ClipEdge& closeEdge = mesh.edges.back();
-
-				closeEdge.verts[0] = start;
-				closeEdge.verts[1] = end;
-
-				closeEdge.faces.push_back(i);
-				face.edges.push_back(closeEdgeIdx);
-			}
-		}
-	}
-
-	bool TriangleClipperBase::getOpenPolyline(ClipFace& face, UINT32& start, UINT32& end)
-	{
-		// Count the number of occurrences of each vertex in the polyline. The
-		// resulting "occurs" values must be 1 or 2.
-		for (UINT32 i = 0; i < (UINT32)face.edges.size(); i++)
+		auto getPosition = [vertices, vertexStride](UINT32 idx) -> const VertexType&
 		{
-			ClipEdge& edge = mesh.edges[face.edges[i]];
+			return *(const VertexType*)(vertices + idx * vertexStride);
+		};
 
-			if (edge.visible)
-			{
-				ClipVert& v0 = mesh.verts[edge.verts[0]];
-				ClipVert& v1 = mesh.verts[edge.verts[1]];
+		auto getUV = [uvs, vertexStride](UINT32 idx)
+		{
+			return uvs != nullptr ? *(const Vector2*)(uvs + idx * vertexStride) : Vector2::ZERO;
+		};
 
-				v0.occurs++;
-				v1.occurs++;
-			}
-		}
+		const simd::uint32x4 laneBits = simd::make_uint(1, 2, 4, 8);
+		const simd::float32x4 zero = simd::splat<simd::float32x4>(0.0f);
 
-		// Determine if the polyline is open
-		bool gotStart = false;
-		bool gotEnd = false;
-		for (UINT32 i = 0; i < (UINT32)face.edges.size(); i++)
+		UINT32 numWritten = 0;
+		for (UINT32 batchStart = 0; batchStart < numTris; batchStart += BATCH_SIZE)
 		{
-			const ClipEdge& edge = mesh.edges[face.edges[i]];
+			const UINT32 batchCount = std::min(BATCH_SIZE, numTris - batchStart);
 
-			const ClipVert& v0 = mesh.verts[edge.verts[0]];
-			const ClipVert& v1 = mesh.verts[edge.verts[1]];
+			// Classify a batch of triangles at once. Most triangles are either fully inside or fully outside of the
+			// clip planes, and only the remaining ones need to be clipped individually.
+			SIMDPP_ALIGN(16) float cornerX[3][BATCH_SIZE] = {};
+			SIMDPP_ALIGN(16) float cornerY[3][BATCH_SIZE] = {};
+			SIMDPP_ALIGN(16) float cornerZ[3][BATCH_SIZE] = {};
 
-			if (v0.occurs == 1)
+			for (UINT32 i = 0; i < batchCount; i++)
 			{
-				if (!gotStart)
-				{
-					start = edge.verts[0];
-					gotStart = true;
-				}
-				else if (!gotEnd)
+				for (UINT32 j = 0; j < 3; j++)
 				{
-					end = edge.verts[0];
-					gotEnd = true;
-				}
-			}
+					Vector3 point = toClipPoint(getPosition((batchStart + i) * 3 + j));
 
-			if (v1.occurs == 1)
-			{
-				if (!gotStart)
-				{
-					start = edge.verts[1];
-					gotStart = true;
-				}
-				else if (!gotEnd)
-				{
-					end = edge.verts[1];
-					gotEnd = true;
+					cornerX[j][i] = point.x;
+					cornerY[j][i] = point.y;
+					cornerZ[j][i] = point.z;
 				}
 			}
-		}
 
-		return gotStart;
-	}
+			simd::uint32x4 anyOutside = simd::make_zero();
+			simd::uint32x4 allOutside = simd::make_zero();
+			for (UINT32 i = 0; i < numPlanes; i++)
+			{
+				const Plane& plane = clipPlanes[i];
 
-	void TriangleClipperBase::getOrderedFaces(FrameVector<FrameVector<UINT32>>& sortedFaces)
-	{
-		for (UINT32 i = 0; i < (UINT32)mesh.faces.size(); i++)
-		{
-			const ClipFace& face = mesh.faces[i];
+				const simd::float32x4 normalX = simd::splat<simd::float32x4>(plane.normal.x);
+				const simd::float32x4 normalY = simd::splat<simd::float32x4>(plane.normal.y);
+				const simd::float32x4 normalZ = simd::splat<simd::float32x4>(plane.normal.z);
+				const simd::float32x4 planeD = simd::splat<simd::float32x4>(plane.d);
 
-			if (face.visible)
-			{
-				// Get the ordered vertices of the face. The first and last
-				// element of the array are the same since the polyline is
-				// closed.
-				UINT32 numSortedVerts = (UINT32)face.edges.size() + 1;
-				UINT32* sortedVerts = (UINT32*)bs_stack_alloc(sizeof(UINT32) * numSortedVerts);
-
-				getOrderedVertices(face, sortedVerts);
-
-				FrameVector<UINT32> faceVerts;
-
-				// The convention is that the vertices should be counterclockwise
-				// ordered when viewed from the negative side of the plane of the
-				// face. If you need the opposite convention, switch the
-				// inequality in the if-else statement.
-				Vector3 normal = getNormal(sortedVerts, numSortedVerts);
-				if (Vector3::dot(mesh.faces[i].normal, normal) < 0)
-				{
-					// Clockwise, need to swap
-					for (INT32 j = (INT32)numSortedVerts - 2; j >= 0; j--)
-						faceVerts.push_back(sortedVerts[j]);
-				}
-				else
+				simd::uint32x4 allCornersOutside = simd::make_uint(0xFFFFFFFF);
+				for (UINT32 j = 0; j < 3; j++)
 				{
-					// Counterclockwise
-					for (int j = 0; j <= (INT32)numSortedVerts - 2; j++)
-						faceVerts.push_back(sortedVerts[j]);
+					simd::float32x4 dist = simd::sub(simd::add(simd::add(
+						simd::mul(simd::load<simd::float32x4>(cornerX[j]), normalX),
+						simd::mul(simd::load<simd::float32x4>(cornerY[j]), normalY)),
+						simd::mul(simd::load<simd::float32x4>(cornerZ[j]), normalZ)),
+						planeD);
+
+					simd::uint32x4 outside = simd::bit_cast<simd::uint32x4>(simd::cmp_lt(dist, zero));
+					anyOutside = simd::bit_or(anyOutside, outside);
+					allCornersOutside = simd::bit_and(allCornersOutside, outside);
 				}
 
-				sortedFaces.push_back(faceVerts);
-				bs_stack_free(sortedVerts);
+				allOutside = simd::bit_or(allOutside, allCornersOutside);
 			}
-		}
-	}
-
-	void TriangleClipperBase::getOrderedVertices(const ClipFace& face, UINT32* sortedVerts)
-	{
-		UINT32 numEdges = (UINT32)face.edges.size();
-		UINT32* sortedEdges = (UINT32*)bs_stack_alloc(sizeof(UINT32) * numEdges);
-		for (UINT32 i = 0; i < numEdges; i++)
-			sortedEdges[i] = face.edges[i];
 
-		// Bubble sort to arrange edges in contiguous order
-		for (UINT32 i0 = 0, i1 = 1, choice = 1; i1 < numEdges - 1; i0 = i1, i1++)
-		{
-			const ClipEdge& edge0 = mesh.edges[sortedEdges[i0]];
+			const UINT32 culledBits = simd::reduce_or(simd::bit_and(laneBits, allOutside));
+			const UINT32 clippedBits = simd::reduce_or(simd::bit_and(laneBits, anyOutside));
 
-			UINT32 current = edge0.verts[choice];
-			for (UINT32 j = i1; j < numEdges; j++)
+			for (UINT32 i = 0; i < batchCount; i++)
 			{
-				const ClipEdge& edge1 = mesh.edges[sortedEdges[j]];
+				const UINT32 laneBit = 1U << i;
+				if (culledBits & laneBit)
+					continue;
 
-				if (edge1.verts[0] == current || edge1.verts[1] == current)
+				const UINT32 firstVertex = (batchStart + i) * 3;
+				if (!(clippedBits & laneBit))
 				{
-					std::swap(sortedEdges[i1], sortedEdges[j]);
-					choice = 1;
-					break;
-				}
-			}
-		}
-
-		// Add the first two vertices
-		sortedVerts[0] = mesh.edges[sortedEdges[0]].verts[0];
-		sortedVerts[1] = mesh.edges[sortedEdges[0]].verts[1];
-
-		// Add the remaining vertices
-		for (UINT32 i = 1; i < numEdges; i++)
-		{
-			const ClipEdge& edge = mesh.edges[sortedEdges[i]];
-
-			if (edge.verts[0] == sortedVerts[i])
-				sortedVerts[i + 1] = edge.verts[1];
-			else
-				sortedVerts[i + 1] = edge.verts[0];
-		}
-
-		bs_stack_free(sortedEdges);
-	}
-
-	Vector3 TriangleClipperBase::getNormal(UINT32* sortedVertices, UINT32 numVertices)
-	{
-		Vector3 normal(BsZero);
-		for (UINT32 i = 0; i <= numVertices - 2; i++)
-			normal += Vector3::cross(mesh.verts[sortedVertices[i]].point, mesh.verts[sortedVertices[i + 1]].point);
-
-		normal.normalize();
-		return normal;
-	}
-
-	/** Clips two-dimensional triangles against a set of provided planes. */
-	class TriangleClipper2D : public TriangleClipperBase
-	{
-	public:
-		/** @copydoc MeshUtility::clip2D */
-		void clip(UINT8* vertices, UINT8* uvs, UINT32 numTris, UINT32 vertexStride, const Vector<Plane>& clipPlanes,
-			const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback);
-
-	private:
-		/** Converts clipped vertices back into triangles and outputs them via the provided callback. */
-		void convertToMesh(const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback);
-
-		static const int BUFFER_SIZE = 64 * 3; // Must be a multiple of three
-		Vector2 vertexBuffer[BUFFER_SIZE];
-		Vector2 uvBuffer[BUFFER_SIZE];
-	};
-
-	void TriangleClipper2D::clip(UINT8* vertices, UINT8* uvs, UINT32 numTris, UINT32 vertexStride, const Vector<Plane>& clipPlanes,
-		const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback)
-	{
-		// Add vertices
-		UINT32 numVertices = numTris * 3;
-		mesh.verts.resize(numVertices);
-
-		if (uvs != nullptr)
-		{
-			for (UINT32 i = 0; i < numVertices; i++)
-			{
-				ClipVert& clipVert = mesh.verts[i];
-				Vector2 vector2D = *(Vector2*)(vertices + vertexStride * i);
-
-				clipVert.point = Vector3(vector2D.x, vector2D.y, 0.0f);
-				clipVert.uv = *(Vector2*)(uvs + vertexStride * i);
-			}
-		}
-		else
-		{
-			for (UINT32 i = 0; i < numVertices; i++)
-			{
-				ClipVert& clipVert = mesh.verts[i];
-				Vector2 vector2D = *(Vector2*)(vertices + vertexStride * i);
-
-				clipVert.point = Vector3(vector2D.x, vector2D.y, 0.0f);
-			}
-		}
+					for (UINT32 j = 0; j < 3; j++)
+					{
+						outVertices[numWritten] = getPosition(firstVertex + j);
 
-		addEdgesAndFaces();
+						if (outUVs != nullptr)
+							outUVs[numWritten] = getUV(firstVertex + j);
 
-		for (int i = 0; i < 4; i++)
-		{
-			if (clipByPlane(clipPlanes[i]) == -1)
-				return;
-		}
-
-		convertToMesh(writeCallback);
-	}
+						numWritten++;
+					}
 
-	void TriangleClipper2D::convertToMesh(const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback)
-	{
-		bs_frame_mark();
-		{
-			FrameVector<FrameVector<UINT32>> allFaces;
-			getOrderedFaces(allFaces);
+					continue;
+				}
 
-			// Note: Consider using Delaunay triangulation to avoid skinny triangles
-			UINT32 numWritten = 0;
-			assert(BUFFER_SIZE % 3 == 0);
-			for (auto& face : allFaces)
-			{
-				for (UINT32 i = 0; i < (UINT32)face.size() - 2; i++)
+				ClipPolygonVertex<VertexType> polygon[3 + MeshUtility::MAX_CLIP_PLANES];
+				for (UINT32 j = 0; j < 3; j++)
 				{
-					const Vector3& v0 = mesh.verts[face[0]].point;
-					const Vector3& v1 = mesh.verts[face[i + 1]].point;
-					const Vector3& v2 = mesh.verts[face[i + 2]].point;
+					polygon[j].position = getPosition(firstVertex + j);
+					polygon[j].uv = getUV(firstVertex + j);
+				}
 
-					vertexBuffer[numWritten] = Vector2(v0.x, v0.y);
-					uvBuffer[numWritten] = mesh.verts[face[0]].uv;
-					numWritten++;
+				UINT32 numPolygonVertices = clipPolygon(polygon, 3, clipPlanes, numPlanes);
 
-					vertexBuffer[numWritten] = Vector2(v1.x, v1.y);
-					uvBuffer[numWritten] = mesh.verts[face[i + 1]].uv;
-					numWritten++;
+				// Triangulate the resulting convex polygon as a fan
+				for (UINT32 j = 2; j < numPolygonVertices; j++)
+				{
+					const ClipPolygonVertex<VertexType>* fanVertices[3] = { &polygon[0], &polygon[j - 1], &polygon[j] };
+					for (auto& vertex : fanVertices)
+					{
+						outVertices[numWritten] = vertex->position;
 
-					vertexBuffer[numWritten] = Vector2(v2.x, v2.y);
-					uvBuffer[numWritten] = mesh.verts[face[i + 2]].uv;
-					numWritten++;
+						if (outUVs != nullptr)
+							outUVs[numWritten] = vertex->uv;
 
-					// Only need to check this here since we guarantee the buffer is in multiples of three
-					if (numWritten >= BUFFER_SIZE)
-					{
-						writeCallback(vertexBuffer, uvBuffer, numWritten);
-						numWritten = 0;
+						numWritten++;
 					}
 				}
 			}
-
-			if (numWritten > 0)
-				writeCallback(vertexBuffer, uvBuffer, numWritten);
 		}
-		bs_frame_clear();
+
+		return numWritten;
 	}
 
-	/** Clips three-dimensional triangles against a set of provided planes. */
-	class TriangleClipper3D : public TriangleClipperBase
+	/** 
+	 * Clips the triangles in chunks small enough to fit in a stack-allocated buffer, and outputs each chunk through the
+	 * provided callback.
+	 */
+	template<class VertexType>
+	static void clipTrianglesWithCallback(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+		const Plane* clipPlanes, UINT32 numPlanes,
+		const std::function<void(VertexType*, Vector2*, UINT32)>& writeCallback)
 	{
-	public:
-		/** @copydoc MeshUtility::clip3D */
-		void clip(UINT8* vertices, UINT8* uvs, UINT32 numTris, UINT32 vertexStride, const Vector<Plane>& clipPlanes,
-			const std::function<void(Vector3*, Vector2*, UINT32)>& writeCallback);
+		static constexpr UINT32 TRIANGLES_PER_CHUNK = 16;
+		static constexpr UINT32 BUFFER_SIZE = TRIANGLES_PER_CHUNK * (MeshUtility::MAX_CLIP_PLANES + 1) * 3;
 
-	private:
-		/** Converts clipped vertices back into triangles and outputs them via the provided callback. */
-		void convertToMesh(const std::function<void(Vector3*, Vector2*, UINT32)>& writeCallback);
-
-		static const int BUFFER_SIZE = 64 * 3; // Must be a multiple of three
-		Vector3 vertexBuffer[BUFFER_SIZE];
+		VertexType vertexBuffer[BUFFER_SIZE];
 		Vector2 uvBuffer[BUFFER_SIZE];
-	};
-
-	void TriangleClipper3D::clip(UINT8* vertices, UINT8* uvs, UINT32 numTris, UINT32 vertexStride, const Vector<Plane>& clipPlanes,
-		const std::function<void(Vector3*, Vector2*, UINT32)>& writeCallback)
-	{
-		// Add vertices
-		UINT32 numVertices = numTris * 3;
-		mesh.verts.resize(numVertices);
-
-		if (uvs != nullptr)
-		{
-			for (UINT32 i = 0; i < numVertices; i++)
-			{
-				ClipVert& clipVert = mesh.verts[i];
 
-				clipVert.point = *(Vector3*)(vertices + vertexStride * i);
-				clipVert.uv = *(Vector2*)(uvs + vertexStride * i);
-			}
-		}
-		else
+		for (UINT32 i = 0; i < numTris; i += TRIANGLES_PER_CHUNK)
 		{
-			for (UINT32 i = 0; i < numVertices; i++)
-			{
-				ClipVert& clipVert = mesh.verts[i];
-				Vector2 vector2D = *(Vector2*)(vertices + vertexStride * i);
+			const UINT32 numChunkTris = std::min(TRIANGLES_PER_CHUNK, numTris - i);
+			const UINT8* chunkUVs = uvs != nullptr ? uvs + i * 3 * vertexStride : nullptr;
 
-				clipVert.point = Vector3(vector2D.x, vector2D.y, 0.0f);
-			}
-		}
-
-		addEdgesAndFaces();
-
-		for (int i = 0; i < 4; i++)
-		{
-			if (clipByPlane(clipPlanes[i]) == -1)
-				return;
-		}
-
-		convertToMesh(writeCallback);
-	}
-
-	void TriangleClipper3D::convertToMesh(const std::function<void(Vector3*, Vector2*, UINT32)>& writeCallback)
-	{
-		bs_frame_mark();
-		{
-			FrameVector<FrameVector<UINT32>> allFaces;
-			getOrderedFaces(allFaces);
-
-			// Note: Consider using Delaunay triangulation to avoid skinny triangles
-			UINT32 numWritten = 0;
-			assert(BUFFER_SIZE % 3 == 0);
-			for (auto& face : allFaces)
-			{
-				for (UINT32 i = 0; i < (UINT32)face.size() - 2; i++)
-				{
-					vertexBuffer[numWritten] = mesh.verts[face[0]].point;
-					uvBuffer[numWritten] = mesh.verts[face[0]].uv;
-					numWritten++;
-
-					vertexBuffer[numWritten] = mesh.verts[face[i + 1]].point;
-					uvBuffer[numWritten] = mesh.verts[face[i + 1]].uv;
-					numWritten++;
-
-					vertexBuffer[numWritten] = mesh.verts[face[i + 2]].point;
-					uvBuffer[numWritten] = mesh.verts[face[i + 2]].uv;
-					numWritten++;
-
-					// Only need to check this here since we guarantee the buffer is in multiples of three
-					if (numWritten >= BUFFER_SIZE)
-					{
-						writeCallback(vertexBuffer, uvBuffer, numWritten);
-						numWritten = 0;
-					}
-				}
-			}
+			UINT32 numWritten = clipTriangles(vertices + i * 3 * vertexStride, chunkUVs, numChunkTris, vertexStride,
+				clipPlanes, numPlanes, vertexBuffer, uvBuffer);
 
 			if (numWritten > 0)
 				writeCallback(vertexBuffer, uvBuffer, numWritten);
 		}
-		bs_frame_clear();
 	}
 
 	void MeshUtility::calculateNormals(Vector3* vertices, UINT8* indices, UINT32 numVertices,
@@ -856,18 +429,28 @@ namespace bs
 		calculateTangents(vertices, normals, uv, indices, numVertices, numIndices, tangents, bitangents, indexSize);
 	}
 
-	void MeshUtility::clip2D(UINT8* vertices, UINT8* uvs, UINT32 numTris, UINT32 vertexStride, const Vector<Plane>& clipPlanes,
-		const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback)
+	void MeshUtility::clip2D(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+		const Plane* clipPlanes, UINT32 numPlanes, const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback)
 	{
-		TriangleClipper2D clipper;
-		clipper.clip(vertices, uvs, numTris, vertexStride, clipPlanes, writeCallback);
+		clipTrianglesWithCallback(vertices, uvs, numTris, vertexStride, clipPlanes, numPlanes, writeCallback);
 	}
 
-	void MeshUtility::clip3D(UINT8* vertices, UINT8* uvs, UINT32 numTris, UINT32 vertexStride, const Vector<Plane>& clipPlanes,
-		const std::function<void(Vector3*, Vector2*, UINT32)>& writeCallback)
+	void MeshUtility::clip3D(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+		const Plane* clipPlanes, UINT32 numPlanes, const std::function<void(Vector3*, Vector2*, UINT32)>& writeCallback)
 	{
-		TriangleClipper3D clipper;
-		clipper.clip(vertices, uvs, numTris, vertexStride, clipPlanes, writeCallback);
+		clipTrianglesWithCallback(vertices, uvs, numTris, vertexStride, clipPlanes, numPlanes, writeCallback);
+	}
+
+	UINT32 MeshUtility::clipTriangles2D(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+		const Plane* clipPlanes, UINT32 numPlanes, Vector2* outVertices, Vector2* outUVs)
+	{
+		return clipTriangles(vertices, uvs, numTris, vertexStride, clipPlanes, numPlanes, outVertices, outUVs);
+	}
+
+	UINT32 MeshUtility::clipTriangles3D(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+		const Plane* clipPlanes, UINT32 numPlanes, Vector3* outVertices, Vector2* outUVs)
+	{
+		return clipTriangles(vertices, uvs, numTris, vertexStride, clipPlanes, numPlanes, outVertices, outUVs);
 	}
 
 	void MeshUtility::packNormals(Vector3* source, UINT8* destination, UINT32 count, UINT32 inStride, UINT32 outStride)
@@ -938,4 +521,638 @@ namespace bs
 			ptr += stride;
 		}
 	}
-}
\ No newline at end of file
+
+	SPtr<MeshData> MeshUtility::simplify(const MeshData& meshData, const Vector<SubMesh>& subMeshes, float vertexRatio,
+		Vector<SubMesh>& outSubMeshes)
+	{
+		for (auto& subMesh : subMeshes)
+		{
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+				return nullptr;
+		}
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData.getVertexDesc();
+		UINT8* positions = nullptr;
+		UINT32 positionStride = 0;
+
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& curElement = vertexDesc->getElement(i);
+			if (curElement.getSemantic() != VES_POSITION || 
+				(curElement.getType() != VET_FLOAT3 && curElement.getType() != VET_FLOAT4))
+				continue;
+
+			positions = meshData.getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), 
+				curElement.getStreamIdx());
+			positionStride = vertexDesc->getVertexStride(curElement.getStreamIdx());
+			break;
+		}
+
+		const UINT32 numVertices = meshData.getNumVertices();
+		if (positions == nullptr || numVertices == 0)
+			return nullptr;
+
+		auto getPosition = [&](UINT32 idx) { return *(Vector3*)(positions + positionStride * idx); };
+
+		UINT32* indices32 = meshData.getIndexType() == IT_32BIT ? meshData.getIndices32() : nullptr;
+		UINT16* indices16 = meshData.getIndexType() == IT_16BIT ? meshData.getIndices16() : nullptr;
+		auto getIndex = [&](UINT32 idx) { return indices32 != nullptr ? indices32[idx] : (UINT32)indices16[idx]; };
+
+		Vector3 min = getPosition(0);
+		Vector3 max = min;
+		for (UINT32 i = 1; i < numVertices; i++)
+		{
+			Vector3 position = getPosition(i);
+			min = Vector3::min(min, position);
+			max = Vector3::max(max, position);
+		}
+
+		float maxExtent = std::max(std::max(max.x - min.x, max.y - min.y), max.z - min.z);
+		if (maxExtent <= 0.0f)
+			return nullptr;
+
+		// Assigns each vertex to a cell of a grid with the provided number of cells along its longest axis
+		Vector<UINT32> vertexClusters(numVertices);
+		UnorderedMap<UINT64, UINT32> cellClusters;
+		auto assignClusters = [&](UINT32 resolution)
+		{
+			cellClusters.clear();
+
+			float cellScale = resolution / maxExtent;
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				Vector3 cellPosition = (getPosition(i) - min) * cellScale;
+
+				UINT64 x = std::min((UINT32)cellPosition.x, resolution - 1);
+				UINT64 y = std::min((UINT32)cellPosition.y, resolution - 1);
+				UINT64 z = std::min((UINT32)cellPosition.z, resolution - 1);
+				UINT64 key = x | (y << 21) | (z << 42);
+
+				auto iterFind = cellClusters.find(key);
+				if (iterFind == cellClusters.end())
+				{
+					UINT32 clusterIdx = (UINT32)cellClusters.size();
+					cellClusters[key] = clusterIdx;
+					vertexClusters[i] = clusterIdx;
+				}
+				else
+					vertexClusters[i] = iterFind->second;
+			}
+
+			return (UINT32)cellClusters.size();
+		};
+
+		// Find the finest grid that doesn't go over the requested number of vertices
+		const UINT32 targetVertices = std::max((UINT32)(numVertices * Math::clamp01(vertexRatio)), 3U);
+		UINT32 low = 1;
+		UINT32 high = 1 << 20;
+		while (low < high)
+		{
+			UINT32 resolution = low + (high - low + 1) / 2;
+			if (assignClusters(resolution) <= targetVertices)
+				low = resolution;
+			else
+				high = resolution - 1;
+		}
+
+		const UINT32 numClusters = assignClusters(low);
+
+		// Each cluster is represented by the original vertex closest to the cluster's center
+		Vector<Vector3> clusterCenters(numClusters, Vector3::ZERO);
+		Vector<UINT32> clusterSizes(numClusters, 0);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			clusterCenters[vertexClusters[i]] += getPosition(i);
+			clusterSizes[vertexClusters[i]]++;
+		}
+
+		Vector<UINT32> clusterVertices(numClusters, (UINT32)-1);
+		Vector<float> clusterDistances(numClusters, std::numeric_limits<float>::max());
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			UINT32 clusterIdx = vertexClusters[i];
+			Vector3 center = clusterCenters[clusterIdx] / (float)clusterSizes[clusterIdx];
+
+			float distance = center.squaredDistance(getPosition(i));
+			if (distance < clusterDistances[clusterIdx])
+			{
+				clusterDistances[clusterIdx] = distance;
+				clusterVertices[clusterIdx] = i;
+			}
+		}
+
+		// Remap the triangles and drop the degenerate ones, assigning new vertex indices in order of use
+		Vector<UINT32> outputVertices;
+		Vector<UINT32> outputIndices;
+		Vector<UINT32> newVertexIndices(numVertices, (UINT32)-1);
+
+		outSubMeshes.clear();
+		for (auto& subMesh : subMeshes)
+		{
+			UINT32 indexOffset = (UINT32)outputIndices.size();
+			for (UINT32 i = 0; i + 2 < subMesh.indexCount; i += 3)
+			{
+				UINT32 triangle[3];
+				for (UINT32 j = 0; j < 3; j++)
+					triangle[j] = clusterVertices[vertexClusters[getIndex(subMesh.indexOffset + i + j)]];
+
+				if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2])
+					continue;
+
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32& newIndex = newVertexIndices[triangle[j]];
+					if (newIndex == (UINT32)-1)
+					{
+						newIndex = (UINT32)outputVertices.size();
+						outputVertices.push_back(triangle[j]);
+					}
+
+					outputIndices.push_back(newIndex);
+				}
+			}
+
+			outSubMeshes.push_back(SubMesh(indexOffset, (UINT32)outputIndices.size() - indexOffset, DOT_TRIANGLE_LIST));
+		}
+
+		if (outputIndices.empty())
+			return nullptr;
+
+		SPtr<MeshData> output = bs_shared_ptr_new<MeshData>((UINT32)outputVertices.size(), (UINT32)outputIndices.size(),
+			vertexDesc, meshData.getIndexType());
+
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& curElement = vertexDesc->getElement(i);
+
+			UINT32 stride = vertexDesc->getVertexStride(curElement.getStreamIdx());
+			UINT32 size = curElement.getSize();
+			UINT8* src = meshData.getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), 
+				curElement.getStreamIdx());
+			UINT8* dst = output->getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), 
+				curElement.getStreamIdx());
+
+			for (UINT32 j = 0; j < (UINT32)outputVertices.size(); j++)
+				memcpy(dst + j * stride, src + outputVertices[j] * stride, size);
+		}
+
+		if (meshData.getIndexType() == IT_32BIT)
+			memcpy(output->getIndices32(), outputIndices.data(), outputIndices.size() * sizeof(UINT32));
+		else
+		{
+			UINT16* dstIndices = output->getIndices16();
+			for (UINT32 i = 0; i < (UINT32)outputIndices.size(); i++)
+				dstIndices[i] = (UINT16)outputIndices[i];
+		}
+
+		return output;
+	}
+
+	/** Size of the post-transform vertex cache assumed when scoring vertices during vertex cache optimization. */
+	static constexpr UINT32 OPTIMIZE_CACHE_SIZE = 32;
+
+	/** Size of the FIFO vertex cache simulated when splitting triangles into clusters for overdraw optimization. */
+	static constexpr UINT32 OPTIMIZE_FIFO_SIZE = 16;
+
+	/**
+	 * Reorders the triangles in the provided index buffer in order to maximize post-transform vertex cache hits, using
+	 * the algorithm from "Linear-Speed Vertex Cache Optimisation" by Tom Forsyth.
+	 */
+	static void optimizeVertexCache(UINT32* indices, UINT32 numIndices)
+	{
+		const UINT32 numTriangles = numIndices / 3;
+		if (numTriangles < 2)
+			return;
+
+		// Only track the range of vertices the triangles actually reference
+		UINT32 minVertex = indices[0];
+		UINT32 maxVertex = indices[0];
+		for (UINT32 i = 1; i < numIndices; i++)
+		{
+			minVertex = std::min(minVertex, indices[i]);
+			maxVertex = std::max(maxVertex, indices[i]);
+		}
+
+		const UINT32 numVertices = maxVertex - minVertex + 1;
+
+		// Build the list of triangles using each vertex
+		Vector<UINT32> numActiveTriangles(numVertices, 0);
+		for (UINT32 i = 0; i < numIndices; i++)
+			numActiveTriangles[indices[i] - minVertex]++;
+
+		Vector<UINT32> vertexTriangleOffsets(numVertices + 1, 0);
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexTriangleOffsets[i + 1] = vertexTriangleOffsets[i] + numActiveTriangles[i];
+
+		Vector<UINT32> vertexTriangles(numIndices);
+		{
+			Vector<UINT32> writePositions(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end() - 1);
+			for (UINT32 i = 0; i < numIndices; i++)
+				vertexTriangles[writePositions[indices[i] - minVertex]++] = i / 3;
+		}
+
+		// Vertices that were just used score the same regardless of order, as they're all needed for the triangle
+		float cacheScores[OPTIMIZE_CACHE_SIZE];
+		for (UINT32 i = 0; i < OPTIMIZE_CACHE_SIZE; i++)
+		{
+			if (i < 3)
+				cacheScores[i] = 0.75f;
+			else
+				cacheScores[i] = Math::pow(1.0f - (i - 3) / (float)(OPTIMIZE_CACHE_SIZE - 3), 1.5f);
+		}
+
+		// Boost vertices with few remaining triangles, so lone triangles don't get left behind
+		auto getVertexScore = [&cacheScores](INT32 cachePosition, UINT32 numTriangles)
+		{
+			if (numTriangles == 0)
+				return -1.0f;
+
+			float score = cachePosition >= 0 ? cacheScores[cachePosition] : 0.0f;
+			return score + 2.0f / Math::sqrt((float)numTriangles);
+		};
+
+		Vector<INT32> cachePositions(numVertices, -1);
+		Vector<float> vertexScores(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexScores[i] = getVertexScore(-1, numActiveTriangles[i]);
+
+		Vector<float> triangleScores(numTriangles);
+		Vector<bool> triangleAdded(numTriangles, false);
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			triangleScores[i] = 0.0f;
+			for (UINT32 j = 0; j < 3; j++)
+				triangleScores[i] += vertexScores[indices[i * 3 + j] - minVertex];
+		}
+
+		UINT32 bestTriangle = 0;
+		for (UINT32 i = 1; i < numTriangles; i++)
+		{
+			if (triangleScores[i] > triangleScores[bestTriangle])
+				bestTriangle = i;
+		}
+
+		Vector<UINT32> output;
+		output.reserve(numIndices);
+
+		UINT32 cache[OPTIMIZE_CACHE_SIZE + 3];
+		UINT32 newCache[OPTIMIZE_CACHE_SIZE + 3];
+		UINT32 cacheSize = 0;
+		UINT32 nextUnadded = 0;
+
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			if (bestTriangle == (UINT32)-1)
+			{
+				// None of the cached vertices have any triangles left, continue with the next triangle in input order
+				while (triangleAdded[nextUnadded])
+					nextUnadded++;
+
+				bestTriangle = nextUnadded;
+			}
+
+			triangleAdded[bestTriangle] = true;
+
+			UINT32 newCacheSize = 0;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 vertex = indices[bestTriangle * 3 + j] - minVertex;
+				output.push_back(indices[bestTriangle * 3 + j]);
+
+				// Remove the triangle from the vertex's list of active triangles
+				UINT32* triangles = &vertexTriangles[vertexTriangleOffsets[vertex]];
+				UINT32 numVertexTriangles = numActiveTriangles[vertex];
+				for (UINT32 k = 0; k < numVertexTriangles; k++)
+				{
+					if (triangles[k] == bestTriangle)
+					{
+						std::swap(triangles[k], triangles[numVertexTriangles - 1]);
+						break;
+					}
+				}
+
+				numActiveTriangles[vertex]--;
+
+				// Vertices of the added triangle move to the front of the cache
+				if (cachePositions[vertex] != -2)
+				{
+					newCache[newCacheSize++] = vertex;
+					cachePositions[vertex] = -2;
+				}
+			}
+
+			for (UINT32 j = 0; j < cacheSize; j++)
+			{
+				if (cachePositions[cache[j]] != -2)
+					newCache[newCacheSize++] = cache[j];
+			}
+
+			// Update the scores of all vertices that were in the cache, including the ones that just dropped out of it
+			for (UINT32 j = 0; j < newCacheSize; j++)
+			{
+				UINT32 vertex = newCache[j];
+				cachePositions[vertex] = j < OPTIMIZE_CACHE_SIZE ? (INT32)j : -1;
+				vertexScores[vertex] = getVertexScore(cachePositions[vertex], numActiveTriangles[vertex]);
+			}
+
+			// Find the best triangle among the ones using the cached vertices
+			bestTriangle = (UINT32)-1;
+			float bestScore = -1.0f;
+			for (UINT32 j = 0; j < newCacheSize; j++)
+			{
+				UINT32 vertex = newCache[j];
+				UINT32* triangles = &vertexTriangles[vertexTriangleOffsets[vertex]];
+				for (UINT32 k = 0; k < numActiveTriangles[vertex]; k++)
+				{
+					UINT32 triangle = triangles[k];
+
+					float score = 0.0f;
+					for (UINT32 l = 0; l < 3; l++)
+						score += vertexScores[indices[triangle * 3 + l] - minVertex];
+
+					triangleScores[triangle] = score;
+					if (score > bestScore)
+					{
+						bestScore = score;
+						bestTriangle = triangle;
+					}
+				}
+			}
+
+			cacheSize = std::min(newCacheSize, OPTIMIZE_CACHE_SIZE);
+			memcpy(cache, newCache, cacheSize * sizeof(UINT32));
+		}
+
+		memcpy(indices, output.data(), numIndices * sizeof(UINT32));
+	}
+
+	/**
+	 * Reorders the triangles in the provided index buffer in order to reduce overdraw. Triangles are split into clusters
+	 * at points where the vertex cache is mostly flushed, and clusters facing away from the center of the mesh are drawn
+	 * first. Expects the triangles to already be optimized for the vertex cache.
+	 *
+	 * Algorithm is described in "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" by Sander et al.
+	 *
+	 * @param[in, out]	indices			Index buffer to reorder.
+	 * @param[in]		numIndices		Number of indices in @p indices. Must be a multiple of three.
+	 * @param[in]		positions		Vertex positions.
+	 * @param[in]		positionStride	Distance between two positions, in bytes.
+	 * @param[in]		threshold		Determines how much is the cache efficiency allowed to degrade in exchange for
+	 *									reduced overdraw. A value of 1 retains the vertex cache efficiency.
+	 */
+	static void optimizeOverdraw(UINT32* indices, UINT32 numIndices, UINT8* positions, UINT32 positionStride,
+		float threshold)
+	{
+		const UINT32 numTriangles = numIndices / 3;
+		if (numTriangles < 2)
+			return;
+
+		auto getPosition = [&](UINT32 idx) { return *(Vector3*)(positions + positionStride * idx); };
+
+		// Simulates a FIFO cache and returns the number of vertices of the triangle that weren't in the cache
+		UINT32 fifo[OPTIMIZE_FIFO_SIZE];
+		UINT32 fifoSize = 0;
+		UINT32 fifoHead = 0;
+		auto resetCache = [&]() { fifoSize = 0; fifoHead = 0; };
+		auto addTriangle = [&](UINT32 triangle)
+		{
+			UINT32 misses = 0;
+			for (UINT32 i = 0; i < 3; i++)
+			{
+				UINT32 vertex = indices[triangle * 3 + i];
+
+				bool found = false;
+				for (UINT32 j = 0; j < fifoSize; j++)
+				{
+					if (fifo[j] == vertex)
+					{
+						found = true;
+						break;
+					}
+				}
+
+				if (found)
+					continue;
+
+				misses++;
+				if (fifoSize < OPTIMIZE_FIFO_SIZE)
+					fifo[fifoSize++] = vertex;
+				else
+				{
+					fifo[fifoHead] = vertex;
+					fifoHead = (fifoHead + 1) % OPTIMIZE_FIFO_SIZE;
+				}
+			}
+
+			return misses;
+		};
+
+		// Hard boundaries are triangles at which all vertices miss the cache, meaning a cluster can start there without
+		// affecting cache efficiency
+		Vector<UINT32> hardClusters;
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			if (addTriangle(i) == 3 || i == 0)
+				hardClusters.push_back(i);
+		}
+
+		hardClusters.push_back(numTriangles);
+
+		// Split hard clusters further at points where the cluster reached the cache efficiency of the entire hard cluster
+		Vector<UINT32> clusters;
+		for (UINT32 i = 0; i + 1 < (UINT32)hardClusters.size(); i++)
+		{
+			UINT32 start = hardClusters[i];
+			UINT32 end = hardClusters[i + 1];
+
+			resetCache();
+			UINT32 totalMisses = 0;
+			for (UINT32 j = start; j < end; j++)
+				totalMisses += addTriangle(j);
+
+			float targetMissRatio = totalMisses / (float)(end - start) * threshold;
+
+			clusters.push_back(start);
+
+			resetCache();
+			UINT32 clusterStart = start;
+			UINT32 clusterMisses = 0;
+			for (UINT32 j = start; j < end; j++)
+			{
+				clusterMisses += addTriangle(j);
+
+				UINT32 clusterTriangles = j - clusterStart + 1;
+				if (j + 1 < end && clusterMisses / (float)clusterTriangles <= targetMissRatio)
+				{
+					clusters.push_back(j + 1);
+
+					resetCache();
+					clusterStart = j + 1;
+					clusterMisses = 0;
+				}
+			}
+		}
+
+		clusters.push_back(numTriangles);
+
+		// Calculate the area weighted centroid and normal of each cluster, and of the entire mesh
+		const UINT32 numClusters = (UINT32)clusters.size() - 1;
+		Vector<Vector3> clusterCentroids(numClusters, Vector3::ZERO);
+		Vector<Vector3> clusterNormals(numClusters, Vector3::ZERO);
+		Vector3 meshCentroid = Vector3::ZERO;
+		float meshArea = 0.0f;
+
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			float clusterArea = 0.0f;
+			for (UINT32 j = clusters[i]; j < clusters[i + 1]; j++)
+			{
+				Vector3 p0 = getPosition(indices[j * 3 + 0]);
+				Vector3 p1 = getPosition(indices[j * 3 + 1]);
+				Vector3 p2 = getPosition(indices[j * 3 + 2]);
+
+				Vector3 normal = Vector3::cross(p1 - p0, p2 - p0);
+				float area = normal.length();
+
+				clusterCentroids[i] += (p0 + p1 + p2) * (area / 3.0f);
+				clusterNormals[i] += normal;
+				clusterArea += area;
+			}
+
+			meshCentroid += clusterCentroids[i];
+			meshArea += clusterArea;
+
+			if (clusterArea > 0.0f)
+				clusterCentroids[i] /= clusterArea;
+
+			clusterNormals[i].normalize();
+		}
+
+		if (meshArea > 0.0f)
+			meshCentroid /= meshArea;
+
+		// Clusters facing away from the center are more likely to occlude the rest of the mesh, so draw them first
+		Vector<float> sortKeys(numClusters);
+		Vector<UINT32> clusterOrder(numClusters);
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			sortKeys[i] = clusterNormals[i].dot(clusterCentroids[i] - meshCentroid);
+			clusterOrder[i] = i;
+		}
+
+		std::stable_sort(clusterOrder.begin(), clusterOrder.end(), 
+			[&sortKeys](UINT32 a, UINT32 b) { return sortKeys[a] > sortKeys[b]; });
+
+		Vector<UINT32> output;
+		output.reserve(numIndices);
+
+		for (auto& cluster : clusterOrder)
+		{
+			for (UINT32 i = clusters[cluster] * 3; i < clusters[cluster + 1] * 3; i++)
+				output.push_back(indices[i]);
+		}
+
+		memcpy(indices, output.data(), numIndices * sizeof(UINT32));
+	}
+
+	void MeshUtility::optimize(MeshData& meshData, const Vector<SubMesh>& subMeshes, MeshOptimizationFlags flags)
+	{
+		const UINT32 numVertices = meshData.getNumVertices();
+		const UINT32 numIndices = meshData.getNumIndices();
+		if (numVertices == 0 || numIndices == 0)
+			return;
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData.getVertexDesc();
+
+		UINT32* indices32 = meshData.getIndexType() == IT_32BIT ? meshData.getIndices32() : nullptr;
+		UINT16* indices16 = meshData.getIndexType() == IT_16BIT ? meshData.getIndices16() : nullptr;
+
+		Vector<UINT32> indices(numIndices);
+		for (UINT32 i = 0; i < numIndices; i++)
+			indices[i] = indices32 != nullptr ? indices32[i] : (UINT32)indices16[i];
+
+		if (flags.isSet(MeshOptimizationFlag::VertexCache) || flags.isSet(MeshOptimizationFlag::Overdraw))
+		{
+			UINT8* positions = nullptr;
+			UINT32 positionStride = 0;
+
+			for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+			{
+				const VertexElement& curElement = vertexDesc->getElement(i);
+				if (curElement.getSemantic() != VES_POSITION || 
+					(curElement.getType() != VET_FLOAT3 && curElement.getType() != VET_FLOAT4))
+					continue;
+
+				positions = meshData.getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), 
+					curElement.getStreamIdx());
+				positionStride = vertexDesc->getVertexStride(curElement.getStreamIdx());
+				break;
+			}
+
+			for (auto& subMesh : subMeshes)
+			{
+				if (subMesh.drawOp != DOT_TRIANGLE_LIST || subMesh.indexOffset + subMesh.indexCount > numIndices)
+					continue;
+
+				UINT32* subMeshIndices = indices.data() + subMesh.indexOffset;
+				UINT32 subMeshNumIndices = subMesh.indexCount - subMesh.indexCount % 3;
+
+				if (flags.isSet(MeshOptimizationFlag::VertexCache))
+					optimizeVertexCache(subMeshIndices, subMeshNumIndices);
+
+				if (flags.isSet(MeshOptimizationFlag::Overdraw) && positions != nullptr)
+					optimizeOverdraw(subMeshIndices, subMeshNumIndices, positions, positionStride, 1.05f);
+			}
+		}
+
+		if (flags.isSet(MeshOptimizationFlag::VertexFetch))
+		{
+			// Assign new vertex indices in order of first use, with any unused vertices placed at the end
+			Vector<UINT32> newVertexIndices(numVertices, (UINT32)-1);
+			UINT32 nextVertex = 0;
+			for (auto& index : indices)
+			{
+				if (index >= numVertices)
+					continue;
+
+				UINT32& newIndex = newVertexIndices[index];
+				if (newIndex == (UINT32)-1)
+					newIndex = nextVertex++;
+
+				index = newIndex;
+			}
+
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				if (newVertexIndices[i] == (UINT32)-1)
+					newVertexIndices[i] = nextVertex++;
+			}
+
+			Vector<UINT8> elementData;
+			for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+			{
+				const VertexElement& curElement = vertexDesc->getElement(i);
+
+				UINT32 stride = vertexDesc->getVertexStride(curElement.getStreamIdx());
+				UINT32 size = curElement.getSize();
+				UINT8* data = meshData.getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), 
+					curElement.getStreamIdx());
+
+				elementData.resize(numVertices * size);
+				for (UINT32 j = 0; j < numVertices; j++)
+					memcpy(&elementData[j * size], data + j * stride, size);
+
+				for (UINT32 j = 0; j < numVertices; j++)
+					memcpy(data + newVertexIndices[j] * stride, &elementData[j * size], size);
+			}
+		}
+
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			if (indices32 != nullptr)
+				indices32[i] = indices[i];
+			else
+				indices16[i] = (UINT16)indices[i];
+		}
+	}
+}
@@ -24,10 +24,33 @@ namespace bs
 		UINT32 packed;
 	};
 
+	/** Optimizations that can be performed by MeshUtility::optimize(). */
+	enum class MeshOptimizationFlag
+	{
+		/** Reorders triangles so their vertices are re-used from the post-transform vertex cache as often as possible. */
+		VertexCache = 1 << 0,
+		/**
+		 * Reorders clusters of triangles so the outward facing ones are drawn first, reducing overdraw. Clusters are
+		 * chosen so that vertex cache efficiency is mostly retained.
+		 */
+		Overdraw = 1 << 1,
+		/**
+		 * Reorders vertices in the order they are referenced by the index buffer, improving locality of vertex fetches.
+		 * Changes the vertex indices.
+		 */
+		VertexFetch = 1 << 2
+	};
+
+	typedef Flags<MeshOptimizationFlag> MeshOptimizationFlags;
+	BS_FLAGS_OPERATORS(MeshOptimizationFlag)
+
 	/** Performs various operations on mesh geometry. */
 	class BS_CORE_EXPORT MeshUtility
 	{
 	public:
+		/** Maximum number of planes triangles can be clipped against by the clipping methods. */
+		static constexpr UINT32 MAX_CLIP_PLANES = 6;
+
 		/**
 		 * Calculates per-vertex normals based on the provided vertices and indices.
 		 *
@@ -100,7 +123,9 @@ namespace bs
 			UINT32 numIndices, Vector3* normals, Vector3* tangents, Vector3* bitangents, UINT32 indexSize = 4);
 
 		/**
-		 * Clips a set of two-dimensional vertices and uv coordinates against a set of arbitrary planes.
+		 * Clips a set of two-dimensional vertices and uv coordinates against a set of arbitrary planes. Triangles are
+		 * clipped in small batches, with the results written to a stack-allocated buffer that is then passed to the
+		 * callback, so no memory is allocated.
 		 *
 		 * @param[in]	vertices			A set of vertices in Vector2 format. Each vertex should be @p vertexStride bytes
 		 *									from each other.
@@ -110,16 +135,21 @@ namespace bs
 		 * @param[in]	vertexStride		Distance in bytes between two separate vertex or UV values in the provided
 		 *									@p vertices and @p uvs buffers.
 		 * @param[in]	clipPlanes			A set of planes to clip the vertices against. Since the vertices are 
-		 *									two-dimensional the plane's Z coordinate should be zero.
+		 *									two-dimensional the plane's Z coordinate should be zero. Parts of the
+		 *									triangles on the negative side of any of the planes are clipped away.
+		 * @param[in]	numPlanes			Number of planes in the @p clipPlanes array. At most MAX_CLIP_PLANES.
 		 * @param[in]	writeCallback		Callback that will be triggered when clipped vertices and UV coordinates are
 		 *									generated and need to be stored. Vertices are always generate in tuples of
 		 *									three, forming a single triangle.
 		 */
-		static void clip2D(UINT8* vertices, UINT8* uvs, UINT32 numTris, UINT32 vertexStride, const Vector<Plane>& clipPlanes,
+		static void clip2D(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+			const Plane* clipPlanes, UINT32 numPlanes,
 			const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback);
 
 		/**
-		 * Clips a set of three-dimensional vertices and uv coordinates against a set of arbitrary planes.
+		 * Clips a set of three-dimensional vertices and uv coordinates against a set of arbitrary planes. Triangles are
+		 * clipped in small batches, with the results written to a stack-allocated buffer that is then passed to the
+		 * callback, so no memory is allocated.
 		 *
 		 * @param[in]	vertices			A set of vertices in Vector3 format. Each vertex should be @p vertexStride bytes
 		 *									from each other.
@@ -128,14 +158,58 @@ namespace bs
 		 * @param[in]	numTris				Number of triangles to clip (must be number of vertices/uvs / 3).
 		 * @param[in]	vertexStride		Distance in bytes between two separate vertex or UV values in the provided
 		 *									@p vertices and @p uvs buffers.
-		 * @param[in]	clipPlanes			A set of planes to clip the vertices against. 
+		 * @param[in]	clipPlanes			A set of planes to clip the vertices against. Parts of the triangles on the
+		 *									negative side of any of the planes are clipped away.
+		 * @param[in]	numPlanes			Number of planes in the @p clipPlanes array. At most MAX_CLIP_PLANES.
 		 * @param[in]	writeCallback		Callback that will be triggered when clipped vertices and UV coordinates are
 		 *									generated and need to be stored. Vertices are always generate in tuples of
 		 *									three, forming a single triangle.
 		 */
-		static void clip3D(UINT8* vertices, UINT8* uvs, UINT32 numTris, UINT32 vertexStride, const Vector<Plane>& clipPlanes,
+		static void clip3D(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+			const Plane* clipPlanes, UINT32 numPlanes,
 			const std::function<void(Vector3*, Vector2*, UINT32)>& writeCallback);
 
+		/**
+		 * Clips a set of two-dimensional triangles against a set of arbitrary planes, writing the resulting triangles
+		 * to the provided output buffers. Triangles are first classified against the planes a few at a time using SIMD
+		 * operations, and only the triangles that straddle a plane are clipped individually.
+		 *
+		 * @param[in]	vertices			A set of vertices in Vector2 format. Each vertex should be @p vertexStride
+		 *									bytes from each other.
+		 * @param[in]	uvs					A set of UV coordinates in Vector2 format. Each coordinate should be
+		 *									@p vertexStride bytes from each other. Can be null if UV is not needed.
+		 * @param[in]	numTris				Number of triangles to clip (must be number of vertices/uvs / 3).
+		 * @param[in]	vertexStride		Distance in bytes between two separate vertex or UV values in the provided
+		 *									@p vertices and @p uvs buffers.
+		 * @param[in]	clipPlanes			A set of planes to clip the vertices against. Plane's Z coordinate should be
+		 *									zero.
+		 * @param[in]	numPlanes			Number of planes in the @p clipPlanes array. At most MAX_CLIP_PLANES.
+		 * @param[out]	outVertices			Buffer to write the clipped vertices to, three per triangle. Must have room
+		 *									for at least getMaxClippedVertexCount() vertices.
+		 * @param[out]	outUVs				Buffer to write the clipped UV coordinates to, same size as @p outVertices.
+		 *									Can be null if UV is not needed.
+		 * @return							Number of vertices written to the output buffers.
+		 */
+		static UINT32 clipTriangles2D(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+			const Plane* clipPlanes, UINT32 numPlanes, Vector2* outVertices, Vector2* outUVs);
+
+		/** 
+		 * Same as clipTriangles2D(), except that the vertices are three-dimensional, in Vector3 format. Output vertices
+		 * are written in the same format.
+		 */
+		static UINT32 clipTriangles3D(const UINT8* vertices, const UINT8* uvs, UINT32 numTris, UINT32 vertexStride,
+			const Plane* clipPlanes, UINT32 numPlanes, Vector3* outVertices, Vector2* outUVs);
+
+		/**
+		 * Returns the maximum number of vertices the clipping methods can output for the provided number of triangles
+		 * and planes. A triangle clipped by N planes forms a polygon of at most N + 3 vertices, which is split into
+		 * N + 1 triangles.
+		 */
+		static UINT32 getMaxClippedVertexCount(UINT32 numTris, UINT32 numPlanes)
+		{
+			return numTris * (numPlanes + 1) * 3;
+		}
+
 		/** 
 		 * Encodes normals from 32-bit float format into 4D 8-bit packed format. 
 		 *
@@ -177,6 +251,36 @@ namespace bs
 		 * @param[in]	stride			Distance between two entries in the @p source buffer, in bytes.
 		 */
 		static void unpackNormals(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride);
+
+		/**
+		 * Generates a simplified version of the provided mesh, with a reduced number of vertices and triangles. Vertices 
+		 * are clustered on a uniform grid sized so the result has roughly the requested number of vertices, and each 
+		 * cluster is replaced by the original vertex closest to its center, keeping all of that vertex's attributes.
+		 * Triangles that collapse as a result are removed.
+		 *
+		 * @param[in]	meshData		Mesh to simplify. Must contain a position attribute.
+		 * @param[in]	subMeshes		Sub-meshes of the mesh. Must all use the triangle list draw operation.
+		 * @param[in]	vertexRatio		Fraction of the vertices to keep, in range (0, 1].
+		 * @param[out]	outSubMeshes	Sub-meshes of the simplified mesh, one for each entry in @p subMeshes.
+		 * @return						Simplified mesh using the same vertex layout and index type as the source mesh,
+		 *								or null if the mesh cannot be simplified.
+		 */
+		static SPtr<MeshData> simplify(const MeshData& meshData, const Vector<SubMesh>& subMeshes, float vertexRatio,
+			Vector<SubMesh>& outSubMeshes);
+
+		/**
+		 * Reorders the triangles and vertices of the provided mesh in order to make it more efficient to render, without
+		 * changing its appearance. Triangle order is optimized for the post-transform vertex cache using the algorithm
+		 * by Tom Forsyth, and then clusters of triangles are sorted to reduce overdraw, as described in "Fast Triangle
+		 * Reordering for Vertex Locality and Reduced Overdraw" by Sander et al. Finally vertices are sorted in the order
+		 * they are first referenced. Triangles are never moved between sub-meshes.
+		 *
+		 * @param[in, out]	meshData	Mesh to optimize. Overdraw optimization requires a position attribute.
+		 * @param[in]		subMeshes	Sub-meshes of the mesh. Only sub-meshes using the triangle list draw operation 
+		 *								will have their triangles reordered.
+		 * @param[in]		flags		Determines which optimizations to perform.
+		 */
+		static void optimize(MeshData& meshData, const Vector<SubMesh>& subMeshes, MeshOptimizationFlags flags);
 	};
 
 	/** @} */
@@ -0,0 +1,87 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Physics/BsHeightField.h"
+#include "Private/RTTI/BsHeightFieldRTTI.h"
+#include "Resources/BsResources.h"
+#include "Image/BsPixelData.h"
+#include "Image/BsColor.h"
+#include "Math/BsMath.h"
+
+namespace bs
+{
+	HeightField::HeightField(UINT32 numRows, UINT32 numColumns, const Vector<float>& heights)
+		:Resource(false), mNumRows(numRows), mNumColumns(numColumns), mHeights(heights)
+	{
+		if (mNumRows < 2 || mNumColumns < 2)
+		{
+			LOGWRN("Height field needs at least two rows and two columns.");
+
+			mNumRows = std::max(mNumRows, 2U);
+			mNumColumns = std::max(mNumColumns, 2U);
+		}
+
+		mHeights.resize(mNumRows * mNumColumns, 0.0f);
+
+		for (auto& height : mHeights)
+			height = Math::clamp01(height);
+	}
+
+	float HeightField::sample(float x, float z) const
+	{
+		float column = Math::clamp01(x) * (mNumColumns - 1);
+		float row = Math::clamp01(z) * (mNumRows - 1);
+
+		UINT32 column0 = std::min((UINT32)column, mNumColumns - 2);
+		UINT32 row0 = std::min((UINT32)row, mNumRows - 2);
+
+		float fracX = column - (float)column0;
+		float fracZ = row - (float)row0;
+
+		float top = getHeight(row0, column0) * (1.0f - fracX) + getHeight(row0, column0 + 1) * fracX;
+		float bottom = getHeight(row0 + 1, column0) * (1.0f - fracX) + getHeight(row0 + 1, column0 + 1) * fracX;
+
+		return top * (1.0f - fracZ) + bottom * fracZ;
+	}
+
+	HHeightField HeightField::create(UINT32 numRows, UINT32 numColumns, const Vector<float>& heights)
+	{
+		SPtr<HeightField> heightField = _createPtr(numRows, numColumns, heights);
+
+		return static_resource_cast<HeightField>(gResources()._createResourceHandle(heightField));
+	}
+
+	HHeightField HeightField::create(const PixelData& pixelData)
+	{
+		UINT32 numColumns = pixelData.getWidth();
+		UINT32 numRows = pixelData.getHeight();
+
+		Vector<float> heights(numRows * numColumns);
+		for (UINT32 y = 0; y < numRows; y++)
+		{
+			for (UINT32 x = 0; x < numColumns; x++)
+				heights[y * numColumns + x] = pixelData.getColorAt(x, y).r;
+		}
+
+		return create(numRows, numColumns, heights);
+	}
+
+	SPtr<HeightField> HeightField::_createPtr(UINT32 numRows, UINT32 numColumns, const Vector<float>& heights)
+	{
+		SPtr<HeightField> heightFieldPtr = bs_core_ptr<HeightField>(
+			new (bs_alloc<HeightField>()) HeightField(numRows, numColumns, heights));
+		heightFieldPtr->_setThisPtr(heightFieldPtr);
+		heightFieldPtr->initialize();
+
+		return heightFieldPtr;
+	}
+
+	RTTITypeBase* HeightField::getRTTIStatic()
+	{
+		return HeightFieldRTTI::instance();
+	}
+
+	RTTITypeBase* HeightField::getRTTI() const
+	{
+		return HeightField::getRTTIStatic();
+	}
+}
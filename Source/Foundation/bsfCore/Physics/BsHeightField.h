@@ -0,0 +1,87 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Resources/BsResource.h"
+
+namespace bs
+{
+	/** @addtogroup Physics
+	 *  @{
+	 */
+
+	/**
+	 * Regular grid of height samples describing a surface, used by HeightFieldCollider and by terrain rendering.
+	 * Columns of the grid run along the X axis and rows along the Z axis. Heights are normalized to [0, 1] range.
+	 *
+	 * In local space the surface spans the [0, 1] range on all three axes, with the first sample at origin. Use the
+	 * scale of the owning scene object to give it the wanted width, height and length.
+	 */
+	class BS_CORE_EXPORT HeightField : public Resource
+	{
+	public:
+		/** Returns the number of samples along the Z axis. */
+		UINT32 getNumRows() const { return mNumRows; }
+
+		/** Returns the number of samples along the X axis. */
+		UINT32 getNumColumns() const { return mNumColumns; }
+
+		/** Returns all the height samples, row by row. */
+		const Vector<float>& getHeights() const { return mHeights; }
+
+		/** Returns the height of the sample at the specified row and column. */
+		float getHeight(UINT32 row, UINT32 column) const { return mHeights[row * mNumColumns + column]; }
+
+		/**
+		 * Returns the height of the surface at the provided location, bilinearly interpolated between the nearest
+		 * samples. Location is in local space, in [0, 1] range, and is clamped to the surface edges.
+		 */
+		float sample(float x, float z) const;
+
+		/**
+		 * Creates a new height field from a grid of samples.
+		 *
+		 * @param[in]	numRows		Number of samples along the Z axis. Must be at least two.
+		 * @param[in]	numColumns	Number of samples along the X axis. Must be at least two.
+		 * @param[in]	heights		Height of each sample, row by row, in [0, 1] range. Must contain
+		 *							@p numRows * @p numColumns entries.
+		 */
+		static HHeightField create(UINT32 numRows, UINT32 numColumns, const Vector<float>& heights);
+
+		/**
+		 * Creates a new height field from an image, such as an imported height map. Heights are read from the red
+		 * channel of each pixel. Pixel rows map to rows of the height field.
+		 */
+		static HHeightField create(const PixelData& pixelData);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * @copydoc create(UINT32, UINT32, const Vector<float>&)
+		 *
+		 * @note	Internal method. Use create() for normal use.
+		 */
+		static SPtr<HeightField> _createPtr(UINT32 numRows, UINT32 numColumns, const Vector<float>& heights);
+
+		/** @} */
+	private:
+		HeightField(UINT32 numRows, UINT32 numColumns, const Vector<float>& heights);
+
+		UINT32 mNumRows;
+		UINT32 mNumColumns;
+		Vector<float> mHeights;
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class HeightFieldRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,31 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Physics/BsHeightFieldCollider.h"
+#include "Physics/BsPhysics.h"
+
+namespace bs
+{
+	HeightFieldCollider::HeightFieldCollider()
+	{ }
+
+	SPtr<HeightFieldCollider> HeightFieldCollider::create(const Vector3& position, const Quaternion& rotation)
+	{
+		return Physics::instance().createHeightFieldCollider(position, rotation);
+	}
+
+	void HeightFieldCollider::getListenerResources(Vector<HResource>& resources)
+	{
+		if(mHeightField != nullptr)
+			resources.push_back(mHeightField);
+	}
+
+	void HeightFieldCollider::notifyResourceLoaded(const HResource& resource)
+	{
+		onHeightFieldChanged();
+	}
+
+	void HeightFieldCollider::notifyResourceChanged(const HResource& resource)
+	{
+		onHeightFieldChanged();
+	}
+}
@@ -0,0 +1,61 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Physics/BsCollider.h"
+#include "Resources/BsIResourceListener.h"
+
+namespace bs
+{
+	/** @addtogroup Physics
+	 *  @{
+	 */
+
+	/**
+	 * A collider represented by a height field. The height field spans [0, 1] range on all axes, and is sized using the
+	 * collider scale. Height field colliders cannot be triggers, nor can they be a part of non-kinematic rigidbodies.
+	 */
+	class BS_CORE_EXPORT HeightFieldCollider : public Collider, public IResourceListener
+	{
+	public:
+		HeightFieldCollider();
+
+		/** Sets the height field that represents the collider geometry. */
+		void setHeightField(const HHeightField& heightField)
+		{
+			mHeightField = heightField;
+			onHeightFieldChanged();
+			markListenerResourcesDirty();
+		}
+
+		/** @copydoc setHeightField() */
+		HHeightField getHeightField() const { return mHeightField; }
+
+		/**
+		 * Creates a new height field collider.
+		 *
+		 * @param[in]	position	Position of the collider.
+		 * @param[in]	rotation	Rotation of the collider.
+		 */
+		static SPtr<HeightFieldCollider> create(const Vector3& position = Vector3::ZERO,
+			const Quaternion& rotation = Quaternion::IDENTITY);
+
+	protected:
+		/** @copydoc IResourceListener::getListenerResources */
+		void getListenerResources(Vector<HResource>& resources) override;
+
+		/** @copydoc IResourceListener::notifyResourceLoaded */
+		void notifyResourceLoaded(const HResource& resource) override;
+
+		/** @copydoc IResourceListener::notifyResourceChanged */
+		void notifyResourceChanged(const HResource& resource) override;
+
+		/** Triggered whenever the attached height field changes or finishes loading. */
+		virtual void onHeightFieldChanged() { }
+
+		HHeightField mHeightField;
+	};
+
+	/** @} */
+}
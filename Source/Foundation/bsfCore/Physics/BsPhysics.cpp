@@ -3,6 +3,9 @@
 #include "Physics/BsPhysics.h"
 #include "Physics/BsRigidbody.h"
 #include "Math/BsRay.h"
+#include "Math/BsAABox.h"
+#include "Math/BsSphere.h"
+#include "Math/BsCapsule.h"
 #include "Components/BsCCollider.h"
 
 namespace bs
@@ -35,6 +38,26 @@ namespace bs
 		return mCollisionMap[groupA][groupB];
 	}
 
+	UINT32 Physics::addFocusPoint(const Vector3& position)
+	{
+		UINT32 handle = mNextFocusPointIdx++;
+		mFocusPoints[handle] = position;
+
+		return handle;
+	}
+
+	void Physics::setFocusPoint(UINT32 handle, const Vector3& position)
+	{
+		auto iterFind = mFocusPoints.find(handle);
+		if (iterFind != mFocusPoints.end())
+			iterFind->second = position;
+	}
+
+	void Physics::removeFocusPoint(UINT32 handle)
+	{
+		mFocusPoints.erase(handle);
+	}
+
 	bool Physics::rayCast(const Ray& ray, PhysicsQueryHit& hit, UINT64 layer, float max) const
 	{
 		return rayCast(ray.getOrigin(), ray.getDirection(), hit, layer, max);
@@ -92,6 +115,98 @@ namespace bs
 		return rawToComponent(_convexOverlap(mesh, position, rotation, layer));
 	}
 
+	/** Converts capsule query geometry into a capsule, with its axis along the local X axis. */
+	static Capsule toCapsule(const PhysicsQueryGeometry& geometry)
+	{
+		const Vector3 axis = geometry.rotation.rotate(Vector3::UNIT_X) * geometry.halfHeight;
+		return Capsule(LineSegment3(geometry.position - axis, geometry.position + axis), geometry.radius);
+	}
+
+	UINT32 Physics::rayCastBatch(const RayCastQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const
+	{
+		UINT32 numHits = 0;
+		for(UINT32 i = 0; i < numQueries; i++)
+		{
+			const RayCastQuery& query = queries[i];
+
+			hits[i] = PhysicsQueryHit();
+			if(rayCast(query.origin, query.unitDir, hits[i], query.layer, query.maxDist))
+				numHits++;
+		}
+
+		return numHits;
+	}
+
+	UINT32 Physics::sweepBatch(const SweepQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const
+	{
+		UINT32 numHits = 0;
+		for(UINT32 i = 0; i < numQueries; i++)
+		{
+			const SweepQuery& query = queries[i];
+			const PhysicsQueryGeometry& geometry = query.geometry;
+
+			hits[i] = PhysicsQueryHit();
+
+			bool wasHit = false;
+			switch(geometry.shape)
+			{
+			case PhysicsQueryShape::Box:
+				wasHit = boxCast(AABox(geometry.position - geometry.halfExtents, geometry.position + geometry.halfExtents),
+					geometry.rotation, query.unitDir, hits[i], query.layer, query.maxDist);
+				break;
+			case PhysicsQueryShape::Sphere:
+				wasHit = sphereCast(Sphere(geometry.position, geometry.radius), query.unitDir, hits[i], query.layer,
+					query.maxDist);
+				break;
+			case PhysicsQueryShape::Capsule:
+				wasHit = capsuleCast(toCapsule(geometry), geometry.rotation, query.unitDir, hits[i], query.layer,
+					query.maxDist);
+				break;
+			}
+
+			if(wasHit)
+				numHits++;
+		}
+
+		return numHits;
+	}
+
+	UINT32 Physics::overlapBatch(const OverlapQuery* queries, UINT32 numQueries, Collider** colliders,
+		UINT32 maxCollidersPerQuery, UINT32* numColliders) const
+	{
+		UINT32 numOverlapping = 0;
+		for(UINT32 i = 0; i < numQueries; i++)
+		{
+			const OverlapQuery& query = queries[i];
+			const PhysicsQueryGeometry& geometry = query.geometry;
+
+			Vector<Collider*> overlaps;
+			switch(geometry.shape)
+			{
+			case PhysicsQueryShape::Box:
+				overlaps = _boxOverlap(AABox(geometry.position - geometry.halfExtents,
+					geometry.position + geometry.halfExtents), geometry.rotation, query.layer);
+				break;
+			case PhysicsQueryShape::Sphere:
+				overlaps = _sphereOverlap(Sphere(geometry.position, geometry.radius), query.layer);
+				break;
+			case PhysicsQueryShape::Capsule:
+				overlaps = _capsuleOverlap(toCapsule(geometry), geometry.rotation, query.layer);
+				break;
+			}
+
+			const UINT32 count = std::min((UINT32)overlaps.size(), maxCollidersPerQuery);
+			for(UINT32 j = 0; j < count; j++)
+				colliders[i * maxCollidersPerQuery + j] = overlaps[j];
+
+			numColliders[i] = count;
+			if(count > 0)
+				numOverlapping++;
+		}
+
+		return numOverlapping;
+	}
+
 	Physics& gPhysics()
 	{
 		return Physics::instance();
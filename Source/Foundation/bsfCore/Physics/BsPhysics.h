@@ -46,13 +46,58 @@ namespace bs
 		 * Enables continous collision detection. This will prevent fast-moving objects from tunneling through each other.
 		 * You must also enable CCD for individual Rigidbodies. This option can have a significant performance impact.
 		 */
-		CCD_Enable = 1<<3
+		CCD_Enable = 1<<3,
+		/**
+		 * Runs the physics simulation in parallel with the rest of the frame. Each fixed update starts a simulation step
+		 * and returns immediately, and its results are applied at the start of the next fixed update. Reduces the time
+		 * the simulation thread spends waiting on the physics simulation, at the cost of an additional fixed step of
+		 * latency between physics object changes and the simulation responding to them.
+		 */
+		OverlappedSimulation = 1<<4,
+		/**
+		 * Interpolates the transforms of moving rigidbodies between the results of the last two simulation steps, based
+		 * on how far the current frame is between two fixed updates. Hides the stutter caused by the frame rate not
+		 * matching the fixed update rate, especially when used together with OverlappedSimulation. Note that in-between
+		 * fixed updates the scene objects will report the interpolated transforms.
+		 */
+		InterpolateTransforms = 1<<5
 	};
 
 	/** @copydoc CharacterCollisionFlag */
 	typedef Flags<PhysicsFlag> PhysicsFlags;
 	BS_FLAGS_OPERATORS(PhysicsFlag)
 
+	/** 
+	 * Controls how the simulation of rigidbodies far away from all physics focus points is reduced, in order to lower the
+	 * cost of simulating large worlds.
+	 *
+	 * @see Physics::addFocusPoint
+	 */
+	struct PhysicsLODSettings
+	{
+		/** Determines should the simulation of far away rigidbodies be reduced at all. */
+		bool enabled = false;
+
+		/** 
+		 * Rigidbodies farther than this distance from all focus points are put to sleep, and kept asleep until a focus
+		 * point approaches. They still collide with awake objects.
+		 */
+		float sleepDistance = 100.0f;
+
+		/** 
+		 * Rigidbodies farther than this distance from all focus points are removed from the simulation entirely, and are
+		 * re-inserted with their state intact once a focus point approaches. Removed rigidbodies are not reported by scene
+		 * queries, and forces applied to them are ignored.
+		 */
+		float removeDistance = 250.0f;
+
+		/** 
+		 * Distance a rigidbody must move back past a band boundary before it returns to a more detailed simulation. Stops
+		 * objects near a boundary from switching back and forth every step.
+		 */
+		float hysteresis = 10.0f;
+	};
+
 	/** Provides global physics settings, factory methods for physics objects and scene queries. */
 	class BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Physics) Physics : public Module<Physics>
 	{
@@ -427,6 +472,56 @@ namespace bs
 		virtual bool convexOverlapAny(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
 			UINT64 layer = BS_ALL_LAYERS) const = 0;
 
+		/**
+		 * Casts a batch of rays into the scene and returns the closest hit for each of them. Performs no allocations, and
+		 * may execute the queries in parallel on worker threads. Prefer this over calling rayCast() in a loop when issuing
+		 * a large number of queries at once.
+		 *
+		 * @param[in]	queries		Array of rays to cast, each with its own layer mask and maximum distance.
+		 * @param[in]	numQueries	Number of entries in the @p queries array.
+		 * @param[out]	hits		Array of at least @p numQueries entries that will receive the closest hit of the ray
+		 *							with the same index. PhysicsQueryHit::colliderRaw will be null for rays that hit nothing.
+		 * @return					Number of rays that hit something.
+		 *
+		 * @note	Must not be called while physics objects are being modified from another thread.
+		 */
+		virtual UINT32 rayCastBatch(const RayCastQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const;
+
+		/**
+		 * Sweeps a batch of shapes through the scene and returns the closest hit for each of them. Performs no
+		 * allocations, and may execute the queries in parallel on worker threads.
+		 *
+		 * @param[in]	queries		Array of sweeps to perform, each with its own layer mask and maximum distance.
+		 * @param[in]	numQueries	Number of entries in the @p queries array.
+		 * @param[out]	hits		Array of at least @p numQueries entries that will receive the closest hit of the sweep
+		 *							with the same index. PhysicsQueryHit::colliderRaw will be null for sweeps that hit
+		 *							nothing.
+		 * @return					Number of sweeps that hit something.
+		 *
+		 * @note	Must not be called while physics objects are being modified from another thread.
+		 */
+		virtual UINT32 sweepBatch(const SweepQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const;
+
+		/**
+		 * Finds the colliders overlapping each shape in a batch. Performs no allocations, and may execute the queries in
+		 * parallel on worker threads.
+		 *
+		 * @param[in]	queries					Array of shapes to check for overlap, each with its own layer mask.
+		 * @param[in]	numQueries				Number of entries in the @p queries array.
+		 * @param[out]	colliders				Array of at least @p numQueries * @p maxCollidersPerQuery entries. Colliders
+		 *										overlapping the query at index N are written starting at index
+		 *										N * @p maxCollidersPerQuery.
+		 * @param[in]	maxCollidersPerQuery	Maximum number of colliders to report per query. Any further overlapping
+		 *										colliders are ignored.
+		 * @param[out]	numColliders			Array of at least @p numQueries entries that will receive the number of
+		 *										colliders written for the query with the same index.
+		 * @return								Number of queries that overlap at least one collider.
+		 *
+		 * @note	Must not be called while physics objects are being modified from another thread.
+		 */
+		virtual UINT32 overlapBatch(const OverlapQuery* queries, UINT32 numQueries, Collider** colliders,
+			UINT32 maxCollidersPerQuery, UINT32* numColliders) const;
+
 		/******************************************************************************************************************/
 		/************************************************* OPTIONS ********************************************************/
 		/******************************************************************************************************************/
@@ -489,6 +584,28 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:IsCollisionEnabled)
 		bool isCollisionEnabled(UINT64 groupA, UINT64 groupB) const;
 
+		/** 
+		 * Registers a new focus point for the physics level of detail system. Rigidbodies far away from all focus points
+		 * are simulated with reduced detail, as determined by setLODSettings(). Focus points are usually placed at the
+		 * player or the main camera.
+		 *
+		 * @param[in]	position	Position of the focus point, in world space.
+		 * @return					Handle that can be used for moving or removing the focus point.
+		 */
+		UINT32 addFocusPoint(const Vector3& position);
+
+		/** Moves a focus point previously registered through addFocusPoint(). */
+		void setFocusPoint(UINT32 handle, const Vector3& position);
+
+		/** Removes a focus point previously registered through addFocusPoint(). */
+		void removeFocusPoint(UINT32 handle);
+
+		/** Determines how is the simulation of rigidbodies far away from all focus points reduced. */
+		void setLODSettings(const PhysicsLODSettings& settings) { mLODSettings = settings; }
+
+		/** @copydoc setLODSettings */
+		const PhysicsLODSettings& getLODSettings() const { return mLODSettings; }
+
 		/** @name Internal
 		 *  @{
 		 */
@@ -524,6 +641,10 @@ namespace bs
 		/** @copydoc MeshCollider::create */
 		virtual SPtr<MeshCollider> createMeshCollider(const Vector3& position, const Quaternion& rotation) = 0;
 
+		/** @copydoc HeightFieldCollider::create */
+		virtual SPtr<HeightFieldCollider> createHeightFieldCollider(const Vector3& position,
+			const Quaternion& rotation) = 0;
+
 		/** @copydoc FixedJoint::create */
 		virtual SPtr<FixedJoint> createFixedJoint(const FIXED_JOINT_DESC& desc) = 0;
 
@@ -553,8 +674,16 @@ namespace bs
 		 */
 		virtual void fixedUpdate(float step) = 0;
 
+		/**
+		 * Waits until the simulation step started by the last fixed update completes, and applies its results. Only
+		 * relevant with PhysicsFlag::OverlappedSimulation enabled, otherwise results are applied during the fixed update.
+		 * Should be called before any logic that depends on the simulation results, such as fixed updates of the scene.
+		 */
+		virtual void fetchResults() { }
+
 		/** 
-		 * Performs any physics operations that arent tied to the fixed update interval. Should be called once per frame. 
+		 * Performs any physics operations that arent tied to the fixed update interval. Should be called once per frame,
+		 * after all fixed updates for the frame have executed. 
 		 */
 		virtual void update() { }
 
@@ -601,6 +730,10 @@ namespace bs
 
 		bool mUpdateInProgress = false;
 		PhysicsFlags mFlags;
+
+		PhysicsLODSettings mLODSettings;
+		UnorderedMap<UINT32, Vector3> mFocusPoints;
+		UINT32 mNextFocusPointIdx = 1;
 	};
 
 	/** Provides easier access to Physics. */
@@ -2,9 +2,12 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #pragma once
 
+#include <cfloat>
+
 #include "BsCorePrerequisites.h"
 #include "Math/BsVector3.h"
 #include "Math/BsVector2.h"
+#include "Math/BsQuaternion.h"
 
 namespace bs
 {
@@ -87,5 +90,49 @@ namespace bs
 		Collider* colliderRaw = nullptr; /**< Collider that was hit. */
 	};
 
+	/** Types of geometry that can be used for sweep and overlap queries performed as a part of a batch. */
+	enum class PhysicsQueryShape
+	{
+		Box, /**< Oriented box described by its half-extents. */
+		Sphere, /**< Sphere described by its radius. */
+		Capsule /**< Capsule described by its radius and half-height, with its axis along the local X axis. */
+	};
+
+	/** Geometry of a single sweep or overlap query performed as a part of a batch. */
+	struct PhysicsQueryGeometry
+	{
+		PhysicsQueryShape shape = PhysicsQueryShape::Sphere;
+		Vector3 position = Vector3::ZERO; /**< Center of the shape, in world space. */
+		Quaternion rotation = Quaternion::IDENTITY; /**< Orientation of the shape. Ignored for spheres. */
+		Vector3 halfExtents = Vector3::ZERO; /**< Half-size of the box along each of its axes. Only used for boxes. */
+		float radius = 0.0f; /**< Radius of the sphere or the capsule. */
+		float halfHeight = 0.0f; /**< Half of the length of the capsule axis, not including the caps. */
+	};
+
+	/** Parameters of a single ray cast performed as a part of a batch. */
+	struct RayCastQuery
+	{
+		Vector3 origin = Vector3::ZERO; /**< Origin of the ray. */
+		Vector3 unitDir = Vector3::UNIT_Z; /**< Unit direction of the ray. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+		float maxDist = FLT_MAX; /**< Maximum distance at which to look for hits. */
+	};
+
+	/** Parameters of a single sweep performed as a part of a batch. */
+	struct SweepQuery
+	{
+		PhysicsQueryGeometry geometry; /**< Shape to sweep, at its starting position. */
+		Vector3 unitDir = Vector3::UNIT_Z; /**< Unit direction towards which to perform the sweep. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+		float maxDist = FLT_MAX; /**< Maximum distance at which to look for hits. */
+	};
+
+	/** Parameters of a single overlap test performed as a part of a batch. */
+	struct OverlapQuery
+	{
+		PhysicsQueryGeometry geometry; /**< Shape to check for overlap. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+	};
+
 	/** @} */
 }
\ No newline at end of file
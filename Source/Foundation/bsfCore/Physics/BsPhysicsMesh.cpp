@@ -23,6 +23,16 @@ namespace bs
 		return mInternal->getMeshData();
 	}
 
+	bool PhysicsMesh::isCooked() const
+	{
+		return mInternal->isCooked();
+	}
+
+	void PhysicsMesh::blockUntilCooked() const
+	{
+		mInternal->blockUntilCooked();
+	}
+
 	HPhysicsMesh PhysicsMesh::create(const SPtr<MeshData>& meshData, PhysicsMeshType type)
 	{
 		SPtr<PhysicsMesh> newMesh = _createPtr(meshData, type);
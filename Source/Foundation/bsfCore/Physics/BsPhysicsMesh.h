@@ -30,6 +30,19 @@ namespace bs
 		/** Returns the mesh's indices and vertices. */
 		SPtr<MeshData> getMeshData() const;
 
+		/**
+		 * Checks has the mesh finished cooking. Meshes created from mesh data are cooked asynchronously on a worker thread,
+		 * while meshes loaded from disk contain pre-cooked data and are ready as soon as they are loaded.
+		 */
+		BS_SCRIPT_EXPORT(n:IsCooked,pr:getter)
+		bool isCooked() const;
+
+		/**
+		 * Blocks the calling thread until the mesh has finished cooking. Note that any operation that requires the cooked
+		 * data, such as attaching the mesh to a collider, will block automatically.
+		 */
+		void blockUntilCooked() const;
+
 		/** 
 		 * Creates a new physics mesh. 
 		 *
@@ -87,6 +100,12 @@ namespace bs
 		/** Returns the mesh's indices and vertices. */
 		virtual SPtr<MeshData> getMeshData() const = 0;
 
+		/** @copydoc PhysicsMesh::isCooked */
+		virtual bool isCooked() const { return true; }
+
+		/** @copydoc PhysicsMesh::blockUntilCooked */
+		virtual void blockUntilCooked() const { }
+
 	protected:
 		friend class PhysicsMesh;
 
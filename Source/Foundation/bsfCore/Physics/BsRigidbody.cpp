@@ -19,8 +19,7 @@ namespace bs
 
 	void Rigidbody::_setTransform(const Vector3& position, const Quaternion& rotation)
 	{
-		mLinkedSO->setWorldPosition(position);
-		mLinkedSO->setWorldRotation(rotation);
+		mLinkedSO->setWorldPositionAndRotation(position, rotation);
 	}
 
 	SPtr<Rigidbody> Rigidbody::create(const HSceneObject& linkedSO)
@@ -0,0 +1,327 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsApplication.h"
+#include "Animation/BsAnimation.h"
+#include "Animation/BsAnimationClip.h"
+#include "Animation/BsAnimationManager.h"
+#include "Animation/BsSkeleton.h"
+#include "Animation/BsSkeletonMask.h"
+#include "CoreThread/BsCoreThread.h"
+#include "CoreThread/BsCoreObjectManager.h"
+#include "Mesh/BsMesh.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Renderer/BsRenderable.h"
+#include "Utility/BsTime.h"
+#include "Utility/BsTimer.h"
+#include "BsEngineConfig.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace bs;
+
+/**
+ * Benchmark for the animation pipeline. Builds a synthetic skeleton, a set of clips animating every bone, and a number
+ * of animated objects blending between the clips, then reports the time spent in each stage of the pipeline.
+ *
+ * Usage: AnimationBenchmark [numObjects] [numBones] [numKeys] [numClips] [numFrames]
+ */
+struct BenchmarkSettings
+{
+	UINT32 numObjects = 256;
+	UINT32 numBones = 64;
+	UINT32 numKeys = 30;
+	UINT32 numClips = 2;
+	UINT32 numFrames = 200;
+};
+
+/** Returns start-up settings for an application with a small hidden window, since nothing needs to be displayed. */
+START_UP_DESC getStartUpDesc()
+{
+	START_UP_DESC desc;
+	desc.renderAPI = BS_RENDER_API_MODULE;
+	desc.renderer = BS_RENDERER_MODULE;
+	desc.audio = BS_AUDIO_MODULE;
+	desc.physics = BS_PHYSICS_MODULE;
+
+	desc.primaryWindowDesc.videoMode = VideoMode(64, 64);
+	desc.primaryWindowDesc.title = "AnimationBenchmark";
+	desc.primaryWindowDesc.hidden = true;
+
+	return desc;
+}
+
+/** Creates a skeleton in the shape of a binary tree. */
+SPtr<Skeleton> createSkeleton(UINT32 numBones)
+{
+	Vector<BONE_DESC> bones(numBones);
+	for (UINT32 i = 0; i < numBones; i++)
+	{
+		bones[i].name = "Bone" + toString(i);
+		bones[i].parent = i == 0 ? (UINT32)-1 : (i - 1) / 2;
+		bones[i].localTfrm = Transform(Vector3(0.0f, 1.0f, 0.0f), Quaternion::IDENTITY, Vector3::ONE);
+		bones[i].invBindPose = Matrix4::IDENTITY;
+	}
+
+	return Skeleton::create(bones.data(), numBones);
+}
+
+/** Creates a one second long clip with position, rotation and scale curves for every bone. */
+HAnimationClip createClip(UINT32 numBones, UINT32 numKeys, UINT32 seed)
+{
+	SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+	for (UINT32 i = 0; i < numBones; i++)
+	{
+		Vector<TKeyframe<Vector3>> positionKeys(numKeys);
+		Vector<TKeyframe<Quaternion>> rotationKeys(numKeys);
+		Vector<TKeyframe<Vector3>> scaleKeys(numKeys);
+
+		for (UINT32 j = 0; j < numKeys; j++)
+		{
+			float time = j / (float)std::max(numKeys - 1, 1U);
+			float phase = time * Math::TWO_PI + (i + seed) * 0.37f;
+
+			positionKeys[j] = { Vector3(Math::sin(phase), 1.0f, Math::cos(phase)), Vector3::ZERO, Vector3::ZERO, time };
+			rotationKeys[j] = { Quaternion(Vector3::UNIT_Y, Radian(phase)), Quaternion::ZERO, Quaternion::ZERO, time };
+			scaleKeys[j] = { Vector3::ONE * (1.0f + 0.1f * Math::sin(phase)), Vector3::ZERO, Vector3::ZERO, time };
+		}
+
+		String name = "Bone" + toString(i);
+		curves->addPositionCurve(name, TAnimationCurve<Vector3>(positionKeys));
+		curves->addRotationCurve(name, TAnimationCurve<Quaternion>(rotationKeys));
+		curves->addScaleCurve(name, TAnimationCurve<Vector3>(scaleKeys));
+	}
+
+	return AnimationClip::create(curves, false, numKeys);
+}
+
+/** Creates a mesh with the minimal vertex layout required for skinning, bound to the provided skeleton. */
+HMesh createSkinnedMesh(const SPtr<Skeleton>& skeleton)
+{
+	SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+	vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+	vertexDesc->addVertElem(VET_FLOAT4, VES_BLEND_WEIGHTS);
+	vertexDesc->addVertElem(VET_UBYTE4, VES_BLEND_INDICES);
+
+	MESH_DESC desc;
+	desc.numVertices = 3;
+	desc.numIndices = 3;
+	desc.vertexDesc = vertexDesc;
+	desc.skeleton = skeleton;
+
+	return Mesh::create(desc);
+}
+
+/** Prints the average time per frame and per bone of a measured stage. */
+void printResult(const char* name, UINT64 totalMicroseconds, UINT32 numFrames, UINT64 numBonesPerFrame,
+	UINT64 numAllocs = (UINT64)-1)
+{
+	double usPerFrame = totalMicroseconds / (double)numFrames;
+	double nsPerBone = (usPerFrame * 1000.0) / (double)std::max(numBonesPerFrame, (UINT64)1);
+
+	if (numAllocs != (UINT64)-1)
+	{
+		printf("%-36s %10.1f us/frame %8.2f ns/bone %8.1f allocs/frame\n", name, usPerFrame, nsPerBone,
+			numAllocs / (double)numFrames);
+	}
+	else
+		printf("%-36s %10.1f us/frame %8.2f ns/bone\n", name, usPerFrame, nsPerBone);
+}
+
+/** Times AnimationManager::update() for all animated objects. */
+void benchmarkUpdate(const BenchmarkSettings& settings, bool async)
+{
+	// Make sure every call performs an evaluation, regardless of how fast the frames are
+	gAnimation().setUpdateRate(1000000);
+
+	UINT64 totalTime = 0;
+	UINT64 totalAllocs = 0;
+	Timer timer;
+	for (UINT32 i = 0; i < settings.numFrames; i++)
+	{
+		gTime()._update();
+
+		UINT64 allocsBefore = MemoryCounter::getNumAllocs();
+		timer.reset();
+
+		gAnimation().update(async);
+
+		totalTime += timer.getMicroseconds();
+		totalAllocs += MemoryCounter::getNumAllocs() - allocsBefore;
+	}
+
+	// Let the last asynchronous evaluation finish, so it doesn't overlap the next benchmark
+	gAnimation().update(false);
+
+	UINT64 numBonesPerFrame = (UINT64)settings.numObjects * settings.numBones;
+	printResult(async ? "AnimationManager::update (async)" : "AnimationManager::update (sync)", totalTime,
+		settings.numFrames, numBonesPerFrame, totalAllocs);
+}
+
+/** Times Skeleton::getPose() evaluating a single clip. */
+void benchmarkGetPose(const BenchmarkSettings& settings, const SPtr<Skeleton>& skeleton, const HAnimationClip& clip)
+{
+	UINT32 numBones = skeleton->getNumBones();
+	Vector<Matrix4> pose(numBones);
+	LocalSkeletonPose localPose(numBones);
+	SkeletonMask mask(numBones);
+
+	UINT64 totalTime = 0;
+	UINT64 totalAllocs = 0;
+	Timer timer;
+	for (UINT32 i = 0; i < settings.numFrames; i++)
+	{
+		float time = i / (float)settings.numFrames;
+
+		UINT64 allocsBefore = MemoryCounter::getNumAllocs();
+		timer.reset();
+
+		for (UINT32 j = 0; j < settings.numObjects; j++)
+			skeleton->getPose(pose.data(), localPose, mask, *clip, time);
+
+		totalTime += timer.getMicroseconds();
+		totalAllocs += MemoryCounter::getNumAllocs() - allocsBefore;
+	}
+
+	printResult("Skeleton::getPose", totalTime, settings.numFrames, (UINT64)settings.numObjects * numBones, totalAllocs);
+}
+
+/** Times sampling of all curves of a clip, through a per-curve cache, as done during animation evaluation. */
+void benchmarkCurveSampling(const BenchmarkSettings& settings, const HAnimationClip& clip)
+{
+	SPtr<AnimationCurves> curves = clip->getCurves();
+	Vector<TCurveCache<Vector3>> positionCaches(curves->position.size());
+	Vector<TCurveCache<Quaternion>> rotationCaches(curves->rotation.size());
+	Vector<TCurveCache<Vector3>> scaleCaches(curves->scale.size());
+
+	// Accumulate the results, so the evaluation cannot be optimized out
+	Vector3 positionSum = Vector3::ZERO;
+	Quaternion rotationSum = Quaternion::ZERO;
+
+	UINT64 totalTime = 0;
+	Timer timer;
+	for (UINT32 i = 0; i < settings.numFrames; i++)
+	{
+		float time = i / (float)settings.numFrames;
+		timer.reset();
+
+		for (UINT32 j = 0; j < settings.numObjects; j++)
+		{
+			for (UINT32 k = 0; k < (UINT32)curves->position.size(); k++)
+				positionSum += curves->position[k].curve.evaluate(time, positionCaches[k], true);
+
+			for (UINT32 k = 0; k < (UINT32)curves->rotation.size(); k++)
+				rotationSum = rotationSum + curves->rotation[k].curve.evaluate(time, rotationCaches[k], true);
+
+			for (UINT32 k = 0; k < (UINT32)curves->scale.size(); k++)
+				positionSum += curves->scale[k].curve.evaluate(time, scaleCaches[k], true);
+		}
+
+		totalTime += timer.getMicroseconds();
+	}
+
+	printResult("TAnimationCurve::evaluate (cached)", totalTime, settings.numFrames,
+		(UINT64)settings.numObjects * curves->position.size());
+
+	if (positionSum.x == 12345.0f && rotationSum.w == 12345.0f)
+		printf("\n");
+}
+
+/** Times Renderable::updateAnimationBuffers() on the core thread, for all animated renderables. */
+void benchmarkAnimationBuffers(const BenchmarkSettings& settings, const Vector<SPtr<Renderable>>& renderables)
+{
+	Vector<SPtr<ct::Renderable>> coreRenderables;
+	for (auto& renderable : renderables)
+		coreRenderables.push_back(renderable->getCore());
+
+	UINT64 totalTime = 0;
+	for (UINT32 i = 0; i < settings.numFrames; i++)
+	{
+		gTime()._update();
+		const EvaluatedAnimationData* animData = gAnimation().update(false);
+
+		auto updateBuffers = [&coreRenderables, animData, &totalTime]()
+		{
+			Timer timer;
+			for (auto& renderable : coreRenderables)
+				renderable->updateAnimationBuffers(*animData);
+
+			totalTime += timer.getMicroseconds();
+		};
+
+		gCoreThread().queueCommand(updateBuffers);
+		gCoreThread().submitAll(true);
+	}
+
+	printResult("Renderable::updateAnimationBuffers", totalTime, settings.numFrames,
+		(UINT64)settings.numObjects * settings.numBones);
+}
+
+int main(int argc, char* argv[])
+{
+	BenchmarkSettings settings;
+
+	UINT32* values[] = { &settings.numObjects, &settings.numBones, &settings.numKeys, &settings.numClips,
+		&settings.numFrames };
+	for (int i = 1; i < argc && i <= (int)(sizeof(values) / sizeof(values[0])); i++)
+		*values[i - 1] = std::max(atoi(argv[i]), 1);
+
+	Application::startUp(getStartUpDesc());
+	{
+		printf("Objects: %u, bones: %u, keys: %u, clips: %u, frames: %u\n\n", settings.numObjects, settings.numBones,
+			settings.numKeys, settings.numClips, settings.numFrames);
+
+		SPtr<Skeleton> skeleton = createSkeleton(settings.numBones);
+		HMesh mesh = createSkinnedMesh(skeleton);
+
+		Blend1DInfo blendInfo;
+		for (UINT32 i = 0; i < settings.numClips; i++)
+		{
+			BlendClipInfo clipInfo;
+			clipInfo.clip = createClip(settings.numBones, settings.numKeys, i);
+			clipInfo.position = i / (float)std::max(settings.numClips - 1, 1U);
+
+			blendInfo.clips.push_back(clipInfo);
+		}
+
+		Vector<SPtr<Animation>> animations;
+		Vector<SPtr<Renderable>> renderables;
+		for (UINT32 i = 0; i < settings.numObjects; i++)
+		{
+			SPtr<Animation> animation = Animation::create();
+			animation->setSkeleton(skeleton);
+			animation->setCulling(false);
+
+			// Use a different blend factor for each object, so the evaluated poses differ
+			animation->blend1D(blendInfo, i / (float)settings.numObjects);
+
+			SPtr<Renderable> renderable = Renderable::create();
+			renderable->setMesh(mesh);
+			renderable->setAnimation(animation);
+
+			animations.push_back(animation);
+			renderables.push_back(renderable);
+		}
+
+		CoreObjectManager::instance().syncToCore();
+		gCoreThread().submitAll(true);
+
+		// Warm up, so one-time allocations (proxies, output buffers, caches) aren't counted
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			gTime()._update();
+			gAnimation().update(false);
+		}
+
+		benchmarkUpdate(settings, false);
+		benchmarkUpdate(settings, true);
+		benchmarkGetPose(settings, skeleton, blendInfo.clips[0].clip);
+		benchmarkCurveSampling(settings, blendInfo.clips[0].clip);
+		benchmarkAnimationBuffers(settings, renderables);
+
+		printf("\nAllocation counts are for the calling thread only.\n");
+	}
+	Application::shutDown();
+
+	return 0;
+}
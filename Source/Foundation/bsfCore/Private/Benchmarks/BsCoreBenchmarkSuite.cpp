@@ -0,0 +1,137 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/Benchmarks/BsCoreBenchmarkSuite.h"
+#include "Image/BsPixelData.h"
+#include "Image/BsPixelUtil.h"
+#include "Audio/BsAudioUtility.h"
+
+namespace bs
+{
+	/** Width and height of the images converted by the pixel conversion benchmarks. */
+	static constexpr UINT32 PIXEL_CONVERSION_SIZE = 512;
+
+	/** Number of stereo frames processed by the audio conversion benchmarks (one second at 48kHz). */
+	static constexpr UINT32 AUDIO_NUM_FRAMES = 48000;
+
+	CoreBenchmarkSuite::CoreBenchmarkSuite()
+	{
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchPixelConversionSwizzle,
+			PIXEL_CONVERSION_SIZE * PIXEL_CONVERSION_SIZE);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchPixelConversionToFloat,
+			PIXEL_CONVERSION_SIZE * PIXEL_CONVERSION_SIZE);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchPixelConversionFromFloat,
+			PIXEL_CONVERSION_SIZE * PIXEL_CONVERSION_SIZE);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchPixelConversionToHalf,
+			PIXEL_CONVERSION_SIZE * PIXEL_CONVERSION_SIZE);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchPixelDownsample,
+			PIXEL_CONVERSION_SIZE * PIXEL_CONVERSION_SIZE / 4);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchPixelLinearToSRGB,
+			PIXEL_CONVERSION_SIZE * PIXEL_CONVERSION_SIZE);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchAudioBitDepth16To32, AUDIO_NUM_FRAMES * 2);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchAudioBitDepth32To16, AUDIO_NUM_FRAMES * 2);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchAudioToFloat, AUDIO_NUM_FRAMES * 2);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchAudioToMono, AUDIO_NUM_FRAMES);
+		BS_ADD_BENCHMARK_OPS(CoreBenchmarkSuite::benchAudioDeinterleave, AUDIO_NUM_FRAMES);
+	}
+
+	void CoreBenchmarkSuite::startUp()
+	{
+		mSourcePixels = PixelData::create(PIXEL_CONVERSION_SIZE, PIXEL_CONVERSION_SIZE, 1, PF_RGBA8);
+		mSwizzledPixels = PixelData::create(PIXEL_CONVERSION_SIZE, PIXEL_CONVERSION_SIZE, 1, PF_BGRA8);
+		mFloatPixels = PixelData::create(PIXEL_CONVERSION_SIZE, PIXEL_CONVERSION_SIZE, 1, PF_RGBA32F);
+		mHalfPixels = PixelData::create(PIXEL_CONVERSION_SIZE, PIXEL_CONVERSION_SIZE, 1, PF_RGBA16F);
+		mDownsampledPixels = PixelData::create(PIXEL_CONVERSION_SIZE / 2, PIXEL_CONVERSION_SIZE / 2, 1, PF_RGBA8);
+
+		UINT8* data = mSourcePixels->getData();
+		for (UINT32 i = 0; i < mSourcePixels->getSize(); i++)
+			data[i] = (UINT8)(rand() % 256);
+
+		PixelUtil::bulkPixelConversion(*mSourcePixels, *mFloatPixels);
+
+		mAudioSamples16.resize(AUDIO_NUM_FRAMES * 2);
+		mAudioSamples32.resize(AUDIO_NUM_FRAMES * 2);
+		mAudioSamplesFloat.resize(AUDIO_NUM_FRAMES * 2);
+		mAudioChannels[0].resize(AUDIO_NUM_FRAMES);
+		mAudioChannels[1].resize(AUDIO_NUM_FRAMES);
+
+		for (auto& entry : mAudioSamples16)
+			entry = (INT16)(rand() % 65536 - 32768);
+
+		AudioUtility::convertBitDepth((UINT8*)mAudioSamples16.data(), 16, (UINT8*)mAudioSamples32.data(), 32,
+			AUDIO_NUM_FRAMES * 2);
+	}
+
+	void CoreBenchmarkSuite::shutDown()
+	{
+		mSourcePixels = nullptr;
+		mSwizzledPixels = nullptr;
+		mFloatPixels = nullptr;
+		mHalfPixels = nullptr;
+		mDownsampledPixels = nullptr;
+
+		mAudioSamples16.clear();
+		mAudioSamples32.clear();
+		mAudioSamplesFloat.clear();
+		mAudioChannels[0].clear();
+		mAudioChannels[1].clear();
+	}
+
+	void CoreBenchmarkSuite::benchPixelConversionSwizzle()
+	{
+		PixelUtil::bulkPixelConversion(*mSourcePixels, *mSwizzledPixels);
+	}
+
+	void CoreBenchmarkSuite::benchPixelConversionToFloat()
+	{
+		PixelUtil::bulkPixelConversion(*mSourcePixels, *mFloatPixels);
+	}
+
+	void CoreBenchmarkSuite::benchPixelConversionFromFloat()
+	{
+		PixelUtil::bulkPixelConversion(*mFloatPixels, *mSwizzledPixels);
+	}
+
+	void CoreBenchmarkSuite::benchPixelConversionToHalf()
+	{
+		PixelUtil::bulkPixelConversion(*mSourcePixels, *mHalfPixels);
+	}
+
+	void CoreBenchmarkSuite::benchPixelDownsample()
+	{
+		PixelUtil::scale(*mSourcePixels, *mDownsampledPixels, PixelUtil::FILTER_LINEAR);
+	}
+
+	void CoreBenchmarkSuite::benchPixelLinearToSRGB()
+	{
+		PixelUtil::linearToSRGB(*mSwizzledPixels);
+	}
+
+	void CoreBenchmarkSuite::benchAudioBitDepth16To32()
+	{
+		AudioUtility::convertBitDepth((UINT8*)mAudioSamples16.data(), 16, (UINT8*)mAudioSamples32.data(), 32,
+			AUDIO_NUM_FRAMES * 2);
+	}
+
+	void CoreBenchmarkSuite::benchAudioBitDepth32To16()
+	{
+		AudioUtility::convertBitDepth((UINT8*)mAudioSamples32.data(), 32, (UINT8*)mAudioSamples16.data(), 16,
+			AUDIO_NUM_FRAMES * 2);
+	}
+
+	void CoreBenchmarkSuite::benchAudioToFloat()
+	{
+		AudioUtility::convertToFloat((UINT8*)mAudioSamples16.data(), 16, mAudioSamplesFloat.data(), AUDIO_NUM_FRAMES * 2);
+	}
+
+	void CoreBenchmarkSuite::benchAudioToMono()
+	{
+		AudioUtility::convertToMono((UINT8*)mAudioSamples16.data(), (UINT8*)mAudioSamples32.data(), 16, AUDIO_NUM_FRAMES,
+			2);
+	}
+
+	void CoreBenchmarkSuite::benchAudioDeinterleave()
+	{
+		float* channels[] = { mAudioChannels[0].data(), mAudioChannels[1].data() };
+		AudioUtility::deinterleave(mAudioSamplesFloat.data(), channels, 2, AUDIO_NUM_FRAMES);
+	}
+}
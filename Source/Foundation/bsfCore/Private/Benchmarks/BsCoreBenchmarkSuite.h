@@ -0,0 +1,41 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Testing/BsBenchmarkSuite.h"
+
+namespace bs
+{
+	class CoreBenchmarkSuite : public BenchmarkSuite
+	{
+	public:
+		CoreBenchmarkSuite();
+		void startUp() override;
+		void shutDown() override;
+
+	private:
+		void benchPixelConversionSwizzle();
+		void benchPixelConversionToFloat();
+		void benchPixelConversionFromFloat();
+		void benchPixelConversionToHalf();
+		void benchPixelDownsample();
+		void benchPixelLinearToSRGB();
+		void benchAudioBitDepth16To32();
+		void benchAudioBitDepth32To16();
+		void benchAudioToFloat();
+		void benchAudioToMono();
+		void benchAudioDeinterleave();
+
+		SPtr<PixelData> mSourcePixels;
+		SPtr<PixelData> mSwizzledPixels;
+		SPtr<PixelData> mFloatPixels;
+		SPtr<PixelData> mHalfPixels;
+		SPtr<PixelData> mDownsampledPixels;
+
+		Vector<INT16> mAudioSamples16;
+		Vector<INT32> mAudioSamples32;
+		Vector<float> mAudioSamplesFloat;
+		Vector<float> mAudioChannels[2];
+	};
+}
@@ -0,0 +1,41 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Testing/BsBenchmarkOutput.h"
+#include "Private/Benchmarks/BsCoreBenchmarkSuite.h"
+#include "Private/Benchmarks/BsUtilityBenchmarkSuite.h"
+#include "Threading/BsThreadPool.h"
+#include "Threading/BsTaskScheduler.h"
+
+using namespace bs;
+
+/**
+ * Runs micro-benchmarks for various framework systems and prints the results.
+ *
+ * Usage: FrameworkBenchmarks [outputPath]
+ *
+ * If an output path is provided the results are also saved to it in JSON format.
+ */
+int main(int argc, char* argv[])
+{
+	MemStack::beginThread();
+	ThreadPool::startUp<TThreadPool<>>(BS_THREAD_HARDWARE_CONCURRENCY);
+	TaskScheduler::startUp();
+	{
+		SPtr<BenchmarkSuite> benchmarks = BenchmarkSuite::create<UtilityBenchmarkSuite>();
+		benchmarks->add(BenchmarkSuite::create<CoreBenchmarkSuite>());
+
+		ConsoleBenchmarkOutput consoleOutput;
+		if (argc > 1)
+		{
+			JSONBenchmarkOutput jsonOutput(Path(argv[1]), &consoleOutput);
+			benchmarks->run(jsonOutput);
+		}
+		else
+			benchmarks->run(consoleOutput);
+	}
+	TaskScheduler::shutDown();
+	ThreadPool::shutDown();
+	MemStack::endThread();
+
+	return 0;
+}
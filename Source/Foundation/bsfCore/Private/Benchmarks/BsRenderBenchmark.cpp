@@ -0,0 +1,526 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsApplication.h"
+#include "Animation/BsAnimation.h"
+#include "Animation/BsAnimationClip.h"
+#include "Animation/BsAnimationManager.h"
+#include "Animation/BsSkeleton.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Material/BsMaterial.h"
+#include "Mesh/BsMesh.h"
+#include "Mesh/BsMeshData.h"
+#include "Profiling/BsFrameTelemetry.h"
+#include "Profiling/BsProfilerGPU.h"
+#include "Profiling/BsProfilingManager.h"
+#include "RenderAPI/BsRenderTexture.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "RenderAPI/BsViewport.h"
+#include "Renderer/BsCamera.h"
+#include "Renderer/BsLight.h"
+#include "Renderer/BsReflectionProbe.h"
+#include "Renderer/BsRenderable.h"
+#include "Renderer/BsRenderer.h"
+#include "Resources/BsBuiltinResources.h"
+#include "Utility/BsShapeMeshes3D.h"
+#include "BsRenderBeastOptions.h"
+#include "BsEngineConfig.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace bs;
+
+/**
+ * Benchmark for the renderer. Generates a scene with a configurable number of renderables, lights, shadow casting
+ * lights, reflection probes and animated meshes, renders it into an off-screen render texture while moving the camera
+ * along a fixed path, and reports the average CPU and GPU time spent in each render compositor node. The scene is
+ * generated from a fixed seed and the camera path doesn't depend on frame timing, so results are comparable between
+ * runs, builds and render backends. Also reports the frame and animation pose latency for the used number of frames in
+ * flight, so the latency of different modes can be compared by running the benchmark once per mode.
+ *
+ * Usage: RenderBenchmark [key=value]...
+ *
+ * Keys: renderables, lights, shadowLights, probes, animated, frames, warmup, width, height, framesInFlight, renderAPI.
+ * The render API is specified using the plugin name (e.g. bsfVulkanRenderAPI, bsfD3D11RenderAPI, bsfGLRenderAPI).
+ */
+struct BenchmarkSettings
+{
+	UINT32 numRenderables = 2000;
+	UINT32 numLights = 64;
+	UINT32 numShadowLights = 4;
+	UINT32 numReflProbes = 4;
+	UINT32 numAnimated = 64;
+	UINT32 numFrames = 150;
+	UINT32 numWarmupFrames = 30;
+	UINT32 width = 1920;
+	UINT32 height = 1080;
+	UINT32 framesInFlight = 1;
+	String renderAPI = BS_RENDER_API_MODULE;
+};
+
+/** Size of the area the scene objects are placed in, along the X and Z axes. */
+static constexpr float SCENE_EXTENT = 100.0f;
+
+/** Number of frames the camera takes to complete a full orbit around the scene. */
+static constexpr UINT32 CAMERA_ORBIT_FRAMES = 600;
+
+/** Accumulated timings of a single profiler sample, across all measured frames. */
+struct SampleTiming
+{
+	String name;
+	UINT32 depth = 0;
+	double totalMs = 0.0;
+};
+
+/** Returns a random value in range [0, 1]. */
+float randomUNorm()
+{
+	return rand() / (float)RAND_MAX;
+}
+
+/** Returns a random position on the scene floor, at the provided height. */
+Vector3 randomPosition(float height)
+{
+	return Vector3((randomUNorm() * 2.0f - 1.0f) * SCENE_EXTENT, height, (randomUNorm() * 2.0f - 1.0f) * SCENE_EXTENT);
+}
+
+/** Creates a box mesh skinned to a two bone skeleton, with the top half of the box following the second bone. */
+HMesh createSkinnedBox(const SPtr<Skeleton>& skeleton)
+{
+	SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+	vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+	vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+	vertexDesc->addVertElem(VET_FLOAT4, VES_TANGENT);
+	vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+	vertexDesc->addVertElem(VET_FLOAT4, VES_BLEND_WEIGHTS);
+	vertexDesc->addVertElem(VET_UBYTE4, VES_BLEND_INDICES);
+
+	UINT32 numVertices, numIndices;
+	ShapeMeshes3D::getNumElementsAABox(numVertices, numIndices);
+
+	SPtr<MeshData> meshData = MeshData::create(numVertices, numIndices, vertexDesc);
+	ShapeMeshes3D::solidAABox(AABox(Vector3(-0.5f, 0.0f, -0.5f), Vector3(0.5f, 2.0f, 0.5f)), meshData, 0, 0);
+
+	Vector<Vector4> weights(numVertices, Vector4(1.0f, 0.0f, 0.0f, 0.0f));
+	Vector<UINT32> indices(numVertices, 0);
+
+	auto positionIter = meshData->getVec3DataIter(VES_POSITION);
+	for (UINT32 i = 0; i < numVertices; i++)
+	{
+		if (positionIter.getValue().y > 1.0f)
+			indices[i] = 1;
+
+		positionIter.moveNext();
+	}
+
+	meshData->setVertexData(VES_BLEND_WEIGHTS, (UINT8*)weights.data(), numVertices * sizeof(Vector4));
+	meshData->setVertexData(VES_BLEND_INDICES, (UINT8*)indices.data(), numVertices * sizeof(UINT32));
+
+	MESH_DESC desc;
+	desc.numVertices = numVertices;
+	desc.numIndices = numIndices;
+	desc.vertexDesc = vertexDesc;
+	desc.skeleton = skeleton;
+
+	return Mesh::create(meshData, desc);
+}
+
+/** Creates a skeleton with a root bone and a single child bone, positioned at the middle of the skinned box. */
+SPtr<Skeleton> createSkeleton()
+{
+	BONE_DESC bones[2];
+	bones[0].name = "Root";
+	bones[0].parent = (UINT32)-1;
+	bones[0].localTfrm = Transform(Vector3::ZERO, Quaternion::IDENTITY, Vector3::ONE);
+	bones[0].invBindPose = Matrix4::IDENTITY;
+
+	bones[1].name = "Top";
+	bones[1].parent = 0;
+	bones[1].localTfrm = Transform(Vector3(0.0f, 1.0f, 0.0f), Quaternion::IDENTITY, Vector3::ONE);
+	bones[1].invBindPose = Matrix4::translation(Vector3(0.0f, -1.0f, 0.0f));
+
+	return Skeleton::create(bones, 2);
+}
+
+/** Creates a looping clip that swings the top bone of the skeleton from side to side. */
+HAnimationClip createSwingClip()
+{
+	static constexpr UINT32 NUM_KEYS = 9;
+
+	Vector<TKeyframe<Quaternion>> rotationKeys(NUM_KEYS);
+	for (UINT32 i = 0; i < NUM_KEYS; i++)
+	{
+		float time = i / (float)(NUM_KEYS - 1);
+		Degree angle(Math::sin(time * Math::TWO_PI) * 45.0f);
+
+		rotationKeys[i] = { Quaternion(Vector3::UNIT_Z, angle), Quaternion::ZERO, Quaternion::ZERO, time };
+	}
+
+	SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+	curves->addRotationCurve("Top", TAnimationCurve<Quaternion>(rotationKeys));
+
+	return AnimationClip::create(curves, false, NUM_KEYS);
+}
+
+/** Application that renders the benchmark scene for a fixed number of frames, then stops the main loop. */
+class RenderBenchmarkApplication : public Application
+{
+public:
+	RenderBenchmarkApplication(const START_UP_DESC& desc)
+		:Application(desc)
+	{ }
+
+	/** Generates the benchmark scene and enables the per-node renderer profiling. */
+	void setUpScene(const BenchmarkSettings& settings);
+
+	/** Releases all scene objects. */
+	void clearScene();
+
+	/** Prints the average per-frame timings of all the measured frames. */
+	void printResults() const;
+
+protected:
+	/** @copydoc Application::postUpdate */
+	void postUpdate() override;
+
+private:
+	/** Adds timings of the provided CPU sample, and all its children, to the list of timings. */
+	void accumulateCPUSample(const CPUProfilerBasicSamplingEntry& entry, UINT32 depth);
+
+	/** Adds the provided time to the timing with the specified name, creating a new timing if needed. */
+	static void accumulateTiming(Vector<SampleTiming>& timings, const String& name, UINT32 depth, double timeMs);
+
+	BenchmarkSettings mSettings;
+	UINT32 mFrameIdx = 0;
+
+	SPtr<RenderTexture> mRenderTexture;
+	SPtr<Camera> mCamera;
+	Vector<SPtr<Renderable>> mRenderables;
+	Vector<SPtr<Light>> mLights;
+	Vector<SPtr<ReflectionProbe>> mReflProbes;
+	Vector<SPtr<Animation>> mAnimations;
+
+	Vector<SampleTiming> mCPUTimings;
+	Vector<SampleTiming> mGPUTimings;
+	UINT32 mNumCPUFrames = 0;
+	UINT32 mNumGPUFrames = 0;
+	UINT32 mNumSkippedGPUFrames = 0;
+};
+
+void RenderBenchmarkApplication::setUpScene(const BenchmarkSettings& settings)
+{
+	mSettings = settings;
+	srand(0);
+
+	// Profile each compositor node separately
+	SPtr<ct::RenderBeastOptions> options =
+		std::static_pointer_cast<ct::RenderBeastOptions>(ct::gRenderer()->getOptions());
+	if (options != nullptr)
+	{
+		options->profileCompositorNodes = true;
+		ct::gRenderer()->setOptions(options);
+	}
+	else
+		printf("Active renderer isn't RenderBeast. Per-node timings will not be available.\n");
+
+	TEXTURE_DESC colorDesc;
+	colorDesc.type = TEX_TYPE_2D;
+	colorDesc.width = settings.width;
+	colorDesc.height = settings.height;
+	colorDesc.format = PF_RGBA8;
+	colorDesc.usage = TU_RENDERTARGET;
+
+	mRenderTexture = RenderTexture::create(colorDesc);
+
+	mCamera = Camera::create();
+	mCamera->getViewport()->setTarget(mRenderTexture);
+	mCamera->setHorzFOV(Degree(90.0f));
+	mCamera->setFarClipDistance(SCENE_EXTENT * 4.0f);
+
+	BuiltinResources& builtin = BuiltinResources::instance();
+	HShader standardShader = builtin.getBuiltinShader(BuiltinShader::Standard);
+
+	// A few different materials, so that the renderer has to switch state
+	static constexpr UINT32 NUM_MATERIALS = 8;
+	HMaterial materials[NUM_MATERIALS];
+	for (UINT32 i = 0; i < NUM_MATERIALS; i++)
+	{
+		materials[i] = Material::create(standardShader);
+		materials[i]->setColor("gAlbedoColor", Color(randomUNorm(), randomUNorm(), randomUNorm()));
+	}
+
+	// Floor
+	HMesh boxMesh = builtin.getMesh(BuiltinMesh::Box);
+	SPtr<Renderable> floor = Renderable::create();
+	floor->setMesh(boxMesh);
+	floor->setMaterial(materials[0]);
+	floor->setTransform(Transform(Vector3(0.0f, -0.5f, 0.0f), Quaternion::IDENTITY,
+		Vector3(SCENE_EXTENT * 2.0f, 1.0f, SCENE_EXTENT * 2.0f)));
+	mRenderables.push_back(floor);
+
+	// Static objects of various sizes and meshes
+	HMesh meshes[] = { boxMesh, builtin.getMesh(BuiltinMesh::Sphere), builtin.getMesh(BuiltinMesh::Cone) };
+	for (UINT32 i = 0; i < settings.numRenderables; i++)
+	{
+		float scale = 0.5f + randomUNorm() * randomUNorm() * 4.0f;
+		Quaternion rotation(Vector3::UNIT_Y, Degree(randomUNorm() * 360.0f));
+
+		SPtr<Renderable> renderable = Renderable::create();
+		renderable->setMesh(meshes[i % (sizeof(meshes) / sizeof(meshes[0]))]);
+		renderable->setMaterial(materials[i % NUM_MATERIALS]);
+		renderable->setTransform(Transform(randomPosition(scale * 0.5f), rotation, Vector3::ONE * scale));
+		renderable->setMobility(ObjectMobility::Static);
+		mRenderables.push_back(renderable);
+	}
+
+	// Skinned objects
+	SPtr<Skeleton> skeleton = createSkeleton();
+	HMesh skinnedMesh = createSkinnedBox(skeleton);
+	HAnimationClip clip = createSwingClip();
+	for (UINT32 i = 0; i < settings.numAnimated; i++)
+	{
+		SPtr<Animation> animation = Animation::create();
+		animation->setSkeleton(skeleton);
+		animation->setWrapMode(AnimWrapMode::Loop);
+		animation->setCulling(false);
+		animation->play(clip);
+
+		SPtr<Renderable> renderable = Renderable::create();
+		renderable->setMesh(skinnedMesh);
+		renderable->setMaterial(materials[i % NUM_MATERIALS]);
+		renderable->setAnimation(animation);
+		renderable->setTransform(Transform(randomPosition(0.0f), Quaternion::IDENTITY, Vector3::ONE));
+
+		mAnimations.push_back(animation);
+		mRenderables.push_back(renderable);
+	}
+
+	// Lights, with the first few casting shadows
+	for (UINT32 i = 0; i < settings.numLights; i++)
+	{
+		bool castsShadows = i < settings.numShadowLights;
+		LightType type = i % 2 == 0 ? LightType::Radial : LightType::Spot;
+		Color color(0.5f + randomUNorm() * 0.5f, 0.5f + randomUNorm() * 0.5f, 0.5f + randomUNorm() * 0.5f);
+
+		SPtr<Light> light = Light::create(type, color, 2000.0f, 20.0f, castsShadows, Degree(60.0f), Degree(50.0f));
+
+		Transform transform(randomPosition(8.0f), Quaternion::IDENTITY, Vector3::ONE);
+		transform.lookAt(transform.getPosition() + Vector3(0.0f, -1.0f, 0.01f));
+		light->setTransform(transform);
+
+		mLights.push_back(light);
+	}
+
+	// Directional light illuminating the whole scene
+	SPtr<Light> sun = Light::create(LightType::Directional, Color::White, 10.0f, 0.0f, settings.numShadowLights > 0);
+	sun->setTransform(Transform(Vector3::ZERO, Quaternion(Degree(-60.0f), Degree(30.0f), Degree(0.0f)),
+		Vector3::ONE));
+	mLights.push_back(sun);
+
+	// Reflection probes, placed on a grid
+	UINT32 probesPerRow = std::max((UINT32)Math::ceilToInt(Math::sqrt((float)settings.numReflProbes)), 1U);
+	float probeSpacing = (SCENE_EXTENT * 2.0f) / probesPerRow;
+	for (UINT32 i = 0; i < settings.numReflProbes; i++)
+	{
+		Vector3 position(
+			-SCENE_EXTENT + probeSpacing * ((i % probesPerRow) + 0.5f),
+			5.0f,
+			-SCENE_EXTENT + probeSpacing * ((i / probesPerRow) + 0.5f));
+
+		SPtr<ReflectionProbe> probe = ReflectionProbe::createBox(Vector3(probeSpacing * 0.5f, 10.0f,
+			probeSpacing * 0.5f));
+		probe->setTransform(Transform(position, Quaternion::IDENTITY, Vector3::ONE));
+
+		mReflProbes.push_back(probe);
+	}
+}
+
+void RenderBenchmarkApplication::clearScene()
+{
+	mCamera = nullptr;
+	mRenderTexture = nullptr;
+	mRenderables.clear();
+	mLights.clear();
+	mReflProbes.clear();
+	mAnimations.clear();
+}
+
+void RenderBenchmarkApplication::postUpdate()
+{
+	Application::postUpdate();
+
+	// Camera orbits the scene at a fixed angular step per frame, regardless of the frame time
+	Radian angle(mFrameIdx * Math::TWO_PI / CAMERA_ORBIT_FRAMES);
+	Vector3 position(Math::cos(angle) * SCENE_EXTENT * 0.75f, 20.0f, Math::sin(angle) * SCENE_EXTENT * 0.75f);
+
+	Transform cameraTransform(position, Quaternion::IDENTITY, Vector3::ONE);
+	cameraTransform.lookAt(Vector3::ZERO);
+	mCamera->setTransform(cameraTransform);
+
+	// GPU reports come in with a delay of a few frames. Skip the ones belonging to the warm-up frames.
+	while (gProfilerGPU().getNumAvailableReports() > 0)
+	{
+		GPUProfilerReport report = gProfilerGPU().getNextReport();
+		if (mNumSkippedGPUFrames < mSettings.numWarmupFrames)
+		{
+			mNumSkippedGPUFrames++;
+			continue;
+		}
+
+		accumulateTiming(mGPUTimings, "Frame", 0, report.frameSample.timeMs);
+		for (auto& sample : report.samples)
+			accumulateTiming(mGPUTimings, sample.name, 1, sample.timeMs);
+
+		mNumGPUFrames++;
+	}
+
+	mFrameIdx++;
+	if (mFrameIdx >= mSettings.numWarmupFrames + mSettings.numFrames)
+		stopMainLoop();
+}
+
+void RenderBenchmarkApplication::accumulateCPUSample(const CPUProfilerBasicSamplingEntry& entry, UINT32 depth)
+{
+	accumulateTiming(mCPUTimings, entry.data.name, depth, entry.data.totalTimeMs);
+
+	for (auto& child : entry.childEntries)
+		accumulateCPUSample(child, depth + 1);
+}
+
+void RenderBenchmarkApplication::accumulateTiming(Vector<SampleTiming>& timings, const String& name, UINT32 depth,
+	double timeMs)
+{
+	auto iterFind = std::find_if(timings.begin(), timings.end(),
+		[&name, depth](const SampleTiming& entry) { return entry.name == name && entry.depth == depth; });
+
+	if (iterFind == timings.end())
+	{
+		SampleTiming timing;
+		timing.name = name;
+		timing.depth = depth;
+		timings.push_back(timing);
+
+		iterFind = timings.end() - 1;
+	}
+
+	iterFind->totalMs += timeMs;
+}
+
+void RenderBenchmarkApplication::printResults() const
+{
+	// Core thread reports are generated once per frame and kept for a limited number of frames, which is why the
+	// number of measured frames is limited. Accumulate them now that all frames are finished.
+	RenderBenchmarkApplication* self = const_cast<RenderBenchmarkApplication*>(this);
+	for (UINT32 i = 0; i < mSettings.numFrames; i++)
+	{
+		const ProfilerReport& report = gProfiler().getReport(ProfiledThread::Core, i);
+		self->accumulateCPUSample(report.cpuReport.getBasicSamplingData(), 0);
+		self->mNumCPUFrames++;
+	}
+
+	printf("Render API: %s, resolution: %ux%u\n", mSettings.renderAPI.c_str(), mSettings.width, mSettings.height);
+	printf("Renderables: %u, animated: %u, lights: %u (%u shadowed), reflection probes: %u\n", mSettings.numRenderables,
+		mSettings.numAnimated, mSettings.numLights, mSettings.numShadowLights, mSettings.numReflProbes);
+	printf("Measured frames: %u (after %u warm-up frames)\n\n", mSettings.numFrames, mSettings.numWarmupFrames);
+
+	// Telemetry keeps more frames than can be measured, so the warm-up frames are included as well
+	const TelemetryMetricStats frameTime = gFrameTelemetry().getStats(TelemetryMetric::FrameTime);
+	const TelemetryMetricStats latency = gFrameTelemetry().getStats(TelemetryMetric::FrameLatency);
+	printf("Frames in flight: %u\n", mSettings.framesInFlight);
+	printf("Frame latency (ms): median %.3f, p95 %.3f, max %.3f (%.2f frames on average)\n", latency.p50, latency.p95,
+		latency.max, latency.average / std::max(frameTime.average, 0.001f));
+	printf("Animation pose latency: %u updates\n\n", AnimationManager::instance().getPoseLatency());
+
+	printf("Core thread CPU time (ms/frame, averaged over %u frames):\n", mNumCPUFrames);
+	for (auto& timing : mCPUTimings)
+	{
+		printf("%*s%-*s %10.3f\n", timing.depth * 2, "", 60 - timing.depth * 2, timing.name.c_str(),
+			timing.totalMs / std::max(mNumCPUFrames, 1U));
+	}
+
+	printf("\nGPU time (ms/frame, averaged over %u frames):\n", mNumGPUFrames);
+	for (auto& timing : mGPUTimings)
+	{
+		printf("%*s%-*s %10.3f\n", timing.depth * 2, "", 60 - timing.depth * 2, timing.name.c_str(),
+			timing.totalMs / std::max(mNumGPUFrames, 1U));
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	BenchmarkSettings settings;
+
+	std::pair<const char*, UINT32*> values[] =
+	{
+		{ "renderables", &settings.numRenderables },
+		{ "lights", &settings.numLights },
+		{ "shadowLights", &settings.numShadowLights },
+		{ "probes", &settings.numReflProbes },
+		{ "animated", &settings.numAnimated },
+		{ "frames", &settings.numFrames },
+		{ "warmup", &settings.numWarmupFrames },
+		{ "width", &settings.width },
+		{ "height", &settings.height },
+		{ "framesInFlight", &settings.framesInFlight }
+	};
+
+	for (int i = 1; i < argc; i++)
+	{
+		String arg = argv[i];
+		String::size_type separator = arg.find('=');
+		if (separator == String::npos)
+			continue;
+
+		String key = arg.substr(0, separator);
+		String value = arg.substr(separator + 1);
+
+		if (key == "renderAPI")
+		{
+			settings.renderAPI = value;
+			continue;
+		}
+
+		for (auto& entry : values)
+		{
+			if (key == entry.first)
+				*entry.second = (UINT32)std::max(atoi(value.c_str()), 0);
+		}
+	}
+
+	// Core thread profiler reports are only kept for a limited number of frames
+	static constexpr UINT32 MAX_MEASURED_FRAMES = 200;
+	settings.numFrames = Math::clamp(settings.numFrames, 1U, MAX_MEASURED_FRAMES);
+	settings.width = std::max(settings.width, 1U);
+	settings.height = std::max(settings.height, 1U);
+	settings.framesInFlight = Math::clamp(settings.framesInFlight, 1U, (UINT32)CoreThread::MAX_FRAMES_IN_FLIGHT);
+
+	START_UP_DESC desc;
+	desc.renderAPI = settings.renderAPI;
+	desc.renderer = BS_RENDERER_MODULE;
+	desc.audio = BS_AUDIO_MODULE;
+	desc.physics = BS_PHYSICS_MODULE;
+
+	// Threads run in lockstep by default, so the timings of different frames don't overlap. The primary window is
+	// required by the render API, but it's never rendered to.
+	desc.framesInFlight = settings.framesInFlight;
+	desc.primaryWindowDesc.videoMode = VideoMode(64, 64);
+	desc.primaryWindowDesc.title = "RenderBenchmark";
+	desc.primaryWindowDesc.hidden = true;
+
+	Application::startUp<RenderBenchmarkApplication>(desc);
+	{
+		RenderBenchmarkApplication& app = static_cast<RenderBenchmarkApplication&>(gApplication());
+
+		app.setUpScene(settings);
+		app.runMainLoop();
+
+		// Make sure the core thread finished processing the last frame, including its profiling report
+		gCoreThread().submitAll(true);
+
+		app.printResults();
+		app.clearScene();
+	}
+	Application::shutDown();
+
+	return 0;
+}
@@ -35,12 +35,26 @@ namespace bs
 		Vector<GamepadInfo> gamepadInfos;
 	};
 
+	/** A single relative pointer movement, as reported by the device. */
+	struct LinuxMouseMotionSample
+	{
+		float deltaX; /**< Relative pointer movement in X direction. */
+		float deltaY; /**< Relative pointer movement in Y direction. */
+		UINT64 timestamp; /**< Time when the movement was reported, in milliseconds. */
+	};
+
 	/** Data about relative pointer / scroll wheel movement. */
 	struct LinuxMouseMotionEvent
 	{
 		double deltaX; /**< Relative pointer movement in X direction. */
 		double deltaY; /**< Relative pointer movement in Y direction. */
 		double deltaZ; /**< Relative vertical scroll amount. */
+
+		/** True if individual movements should be recorded in @p samples, in addition to being accumulated. */
+		bool recordSamples;
+
+		/** Individual movements received since the last capture. Only populated if @p recordSamples is true. */
+		Vector<LinuxMouseMotionSample> samples;
 	};
 
 	/** Data about a single button press or release. */
@@ -28,8 +28,13 @@ namespace bs
 	{
 		Lock lock(LinuxPlatform::eventLock);
 
+		LinuxPlatform::mouseMotionEvent.recordSamples = mOwner->getRawMouseMotionEnabled();
+
 		if(m->hasInputFocus)
 		{
+			for(auto& sample : LinuxPlatform::mouseMotionEvent.samples)
+				mOwner->_notifyMouseMotionSample(sample.deltaX, sample.deltaY, sample.timestamp);
+
 			double deltaX = round(LinuxPlatform::mouseMotionEvent.deltaX);
 			double deltaY = round(LinuxPlatform::mouseMotionEvent.deltaY);
 			double deltaZ = round(LinuxPlatform::mouseMotionEvent.deltaZ);
@@ -40,6 +45,7 @@ namespace bs
 			LinuxPlatform::mouseMotionEvent.deltaX -= deltaX;
 			LinuxPlatform::mouseMotionEvent.deltaY -= deltaY;
 			LinuxPlatform::mouseMotionEvent.deltaZ -= deltaZ;
+			LinuxPlatform::mouseMotionEvent.samples.clear();
 		}
 		else
 		{
@@ -47,6 +53,7 @@ namespace bs
 			LinuxPlatform::mouseMotionEvent.deltaX = 0;
 			LinuxPlatform::mouseMotionEvent.deltaY = 0;
 			LinuxPlatform::mouseMotionEvent.deltaZ = 0;
+			LinuxPlatform::mouseMotionEvent.samples.clear();
 		}
 	}
 
@@ -858,6 +858,16 @@ namespace bs
 						LinuxPlatform::mouseMotionEvent.deltaX += deltas[0];
 						LinuxPlatform::mouseMotionEvent.deltaY += deltas[1];
 						LinuxPlatform::mouseMotionEvent.deltaZ += deltas[3]; // Not a typo - 2 is for horizontal scroll.
+
+						if (LinuxPlatform::mouseMotionEvent.recordSamples && (deltas[0] != 0.0f || deltas[1] != 0.0f))
+						{
+							LinuxMouseMotionSample sample;
+							sample.deltaX = deltas[0];
+							sample.deltaY = deltas[1];
+							sample.timestamp = (UINT64)xInput2Event->time;
+
+							LinuxPlatform::mouseMotionEvent.samples.push_back(sample);
+						}
 					}
 					break;
 				}
@@ -1061,6 +1071,17 @@ namespace bs
 			}
 			case MotionNotify:
 			{
+				// High polling rate mice can queue up many motion events per frame. Only the latest position matters,
+				// so skip this one if another motion event is already queued right after it.
+				if (XEventsQueued(mData->xDisplay, QueuedAlready) > 0)
+				{
+					XEvent nextEvent;
+					XPeekEvent(mData->xDisplay, &nextEvent);
+
+					if (nextEvent.type == MotionNotify && nextEvent.xmotion.window == event.xmotion.window)
+						break;
+				}
+
 				Vector2I pos;
 				pos.x = event.xmotion.x_root;
 				pos.y = event.xmotion.y_root;
@@ -56,13 +56,25 @@ namespace bs
 			char* memoryStart = memory;
 			memory += sizeof(UINT32);
 
-			UINT32 version = 0; // In case the data structure changes
+			UINT32 version = 1; // In case the data structure changes
 			memory = rttiWriteElem(version, memory, size);
 			memory = rttiWriteElem(data.mStart, memory, size);
 			memory = rttiWriteElem(data.mEnd, memory, size);
 			memory = rttiWriteElem(data.mLength, memory, size);
 			memory = rttiWriteElem(data.mKeyframes, memory, size);
 
+			const CompressedCurveData& compressed = data.mCompressed;
+			memory = rttiWriteElem(compressed.sampleInterval, memory, size);
+
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				memory = rttiWriteElem(compressed.rangeMin[i], memory, size);
+				memory = rttiWriteElem(compressed.rangeExtent[i], memory, size);
+			}
+
+			memory = rttiWriteElem(compressed.frames, memory, size);
+			memory = rttiWriteElem(compressed.samples, memory, size);
+
 			memcpy(memoryStart, &size, sizeof(UINT32));
 		}
 
@@ -80,6 +92,21 @@ namespace bs
 			memory = rttiReadElem(data.mLength, memory);
 			memory = rttiReadElem(data.mKeyframes, memory);
 
+			if(version >= 1)
+			{
+				CompressedCurveData& compressed = data.mCompressed;
+				memory = rttiReadElem(compressed.sampleInterval, memory);
+
+				for(UINT32 i = 0; i < 3; i++)
+				{
+					memory = rttiReadElem(compressed.rangeMin[i], memory);
+					memory = rttiReadElem(compressed.rangeExtent[i], memory);
+				}
+
+				memory = rttiReadElem(compressed.frames, memory);
+				memory = rttiReadElem(compressed.samples, memory);
+			}
+
 			return size;
 		}
 
@@ -92,6 +119,12 @@ namespace bs
 			dataSize += rttiGetElemSize(data.mLength);
 			dataSize += rttiGetElemSize(data.mKeyframes);
 
+			const CompressedCurveData& compressed = data.mCompressed;
+			dataSize += rttiGetElemSize(compressed.sampleInterval);
+			dataSize += sizeof(compressed.rangeMin) + sizeof(compressed.rangeExtent);
+			dataSize += rttiGetElemSize(compressed.frames);
+			dataSize += rttiGetElemSize(compressed.samples);
+
 			assert(dataSize <= std::numeric_limits<UINT32>::max());
 
 			return (UINT32)dataSize;
@@ -0,0 +1,43 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "Components/BsCHeightFieldCollider.h"
+#include "Private/RTTI/BsGameObjectRTTI.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Core
+	 *  @{
+	 */
+
+	class BS_CORE_EXPORT CHeightFieldColliderRTTI : public RTTIType<CHeightFieldCollider, CCollider, CHeightFieldColliderRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_REFL(mHeightField, 0)
+		BS_END_RTTI_MEMBERS
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "CHeightFieldCollider";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_CHeightFieldCollider;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return GameObjectRTTI::createGameObject<CHeightFieldCollider>();
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
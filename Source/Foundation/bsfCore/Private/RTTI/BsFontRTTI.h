@@ -25,6 +25,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(spaceWidth, 4)
 			BS_RTTI_MEMBER_REFL_ARRAY(texturePages, 5)
 			BS_RTTI_MEMBER_PLAIN(characters, 6)
+			BS_RTTI_MEMBER_PLAIN(distanceField, 7)
 		BS_END_RTTI_MEMBERS
 
 	public:
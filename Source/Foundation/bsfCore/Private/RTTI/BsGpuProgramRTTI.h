@@ -83,6 +83,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(mEntryPoint, 4)
 			BS_RTTI_MEMBER_PLAIN(mSource, 6)
 			BS_RTTI_MEMBER_PLAIN(mLanguage, 7)
+			BS_RTTI_MEMBER_PLAIN(mSpecializationConstants, 8)
 		BS_END_RTTI_MEMBERS
 
 	public:
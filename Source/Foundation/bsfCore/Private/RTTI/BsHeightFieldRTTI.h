@@ -0,0 +1,45 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "Physics/BsHeightField.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Core
+	 *  @{
+	 */
+
+	class BS_CORE_EXPORT HeightFieldRTTI : public RTTIType<HeightField, Resource, HeightFieldRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(mNumRows, 0)
+			BS_RTTI_MEMBER_PLAIN(mNumColumns, 1)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mHeights, 2)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "HeightField";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_HeightField;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return HeightField::_createPtr(2, 2, Vector<float>());
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
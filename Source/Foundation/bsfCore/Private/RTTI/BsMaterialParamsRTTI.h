@@ -204,7 +204,7 @@ namespace bs
 			for (auto& entry : paramsObj->mParamLookup)
 			{
 				UINT32 paramIdx = entry.second;
-				matParams.push_back({ entry.first, paramsObj->mParams[paramIdx] });
+				matParams.push_back({ entry.first.cstr(), paramsObj->mParams[paramIdx] });
 			}
 
 			paramsObj->mRTTIData = matParams;
@@ -30,6 +30,13 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(mReduceKeyFrames, 9)
 			BS_RTTI_MEMBER_REFL_ARRAY(mAnimationEvents, 10)
 			BS_RTTI_MEMBER_PLAIN(mImportRootMotion, 11)
+			BS_RTTI_MEMBER_PLAIN(mNumLODs, 12)
+			BS_RTTI_MEMBER_PLAIN(mLODVertexRatio, 13)
+			BS_RTTI_MEMBER_PLAIN(mCompressAnimation, 14)
+			BS_RTTI_MEMBER_PLAIN(mAnimationCompressionTolerance, 15)
+			BS_RTTI_MEMBER_PLAIN(mOptimizeVertexCache, 16)
+			BS_RTTI_MEMBER_PLAIN(mOptimizeOverdraw, 17)
+			BS_RTTI_MEMBER_PLAIN(mOptimizeVertexFetch, 18)
 		BS_END_RTTI_MEMBERS
 	public:
 		const String& getRTTIName() override
@@ -42,16 +42,31 @@ namespace bs
 			obj->mCPUData = meshData;
 		}
 
+		SPtr<Mesh> getLODMesh(Mesh* obj, UINT32 idx) { return obj->mLODs[idx].mesh; }
+		void setLODMesh(Mesh* obj, UINT32 idx, SPtr<Mesh> mesh) { obj->mLODs[idx].mesh = mesh; }
+
+		float& getLODScreenSize(Mesh* obj, UINT32 idx) { return obj->mLODs[idx].screenSize; }
+		void setLODScreenSize(Mesh* obj, UINT32 idx, float& size) { obj->mLODs[idx].screenSize = size; }
+
+		UINT32 getNumLODs(Mesh* obj) { return (UINT32)obj->mLODs.size(); }
+		void setNumLODs(Mesh* obj, UINT32 size) { obj->mLODs.resize(size); }
+
 	public:
 		MeshRTTI()
 		{
 			addReflectablePtrField("mMeshData", 3, &MeshRTTI::getMeshData, &MeshRTTI::setMeshData);
+			addReflectablePtrArrayField("mLODMeshes", 6, &MeshRTTI::getLODMesh, &MeshRTTI::getNumLODs, 
+				&MeshRTTI::setLODMesh, &MeshRTTI::setNumLODs);
+			addPlainArrayField("mLODScreenSizes", 7, &MeshRTTI::getLODScreenSize, &MeshRTTI::getNumLODs, 
+				&MeshRTTI::setLODScreenSize, &MeshRTTI::setNumLODs);
 		}
 
 		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
 		{
+			// LOD meshes are initialized by their parent, which might happen before their own deserialization ends
 			Mesh* mesh = static_cast<Mesh*>(obj);
-			mesh->initialize();
+			if (!mesh->isInitialized())
+				mesh->initialize();
 		}
 
 		SPtr<IReflectable> newRTTIObject() override
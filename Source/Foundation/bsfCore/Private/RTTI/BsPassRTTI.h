@@ -25,6 +25,7 @@ namespace bs
 			type = desc.type;
 			requiresAdjacency = desc.requiresAdjacency;
 			bytecode = desc.bytecode;
+			specializationConstants = desc.specializationConstants;
 
 			return *this;
 		}
@@ -48,6 +49,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(type, 3)
 			BS_RTTI_MEMBER_PLAIN(requiresAdjacency, 4)
 			BS_RTTI_MEMBER_REFLPTR(bytecode, 5)
+			BS_RTTI_MEMBER_PLAIN(specializationConstants, 6)
 		BS_END_RTTI_MEMBERS
 
 	public:
@@ -249,6 +249,35 @@ namespace bs
 		}
 	};
 
+	class BS_CORE_EXPORT DynamicResolutionSettingsRTTI : public RTTIType <DynamicResolutionSettings, IReflectable, DynamicResolutionSettingsRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(enabled, 0)
+			BS_RTTI_MEMBER_PLAIN(targetFrameTime, 1)
+			BS_RTTI_MEMBER_PLAIN(minScale, 2)
+			BS_RTTI_MEMBER_PLAIN(maxScale, 3)
+			BS_RTTI_MEMBER_PLAIN(sharpness, 4)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "DynamicResolutionSettings";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_DynamicResolutionSettings;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<DynamicResolutionSettings>();
+		}
+	};
+
 	class BS_CORE_EXPORT RenderSettingsRTTI : public RTTIType <RenderSettings, IReflectable, RenderSettingsRTTI>
 	{
 	private:
@@ -271,6 +300,9 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(overlayOnly, 15)
 			BS_RTTI_MEMBER_PLAIN(enableIndirectLighting, 16)
 			BS_RTTI_MEMBER_REFL(shadowSettings, 17)
+			BS_RTTI_MEMBER_REFL(dynamicResolution, 18)
+			BS_RTTI_MEMBER_PLAIN(enableTemporalAA, 19)
+			BS_RTTI_MEMBER_PLAIN(reducedRateShading, 20)
 		BS_END_RTTI_MEMBERS
 
 	public:
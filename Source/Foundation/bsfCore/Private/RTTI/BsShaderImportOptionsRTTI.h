@@ -33,12 +33,17 @@ namespace bs
 		UINT32 getNumDefines(ShaderImportOptions* obj) { return (UINT32)obj->getDefines().size(); }
 		void setNumDefines(ShaderImportOptions* obj, UINT32 val) { /* Do nothing */ }
 
+		bool& getCompileVariationsOnDemand(ShaderImportOptions* obj) { return obj->compileVariationsOnDemand; }
+		void setCompileVariationsOnDemand(ShaderImportOptions* obj, bool& val) { obj->compileVariationsOnDemand = val; }
+
 	public:
 		ShaderImportOptionsRTTI()
 		{
 			addPlainArrayField("mDefines", 0, &ShaderImportOptionsRTTI::getDefinePair, 
 				&ShaderImportOptionsRTTI::getNumDefines, &ShaderImportOptionsRTTI::setDefinePair, 
 				&ShaderImportOptionsRTTI::setNumDefines);
+			addPlainField("compileVariationsOnDemand", 1, &ShaderImportOptionsRTTI::getCompileVariationsOnDemand,
+				&ShaderImportOptionsRTTI::setCompileVariationsOnDemand);
 		}
 
 		/** @copydoc ShaderImportOptionsRTTI::onSerializationStarted */
@@ -0,0 +1,46 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "Material/BsShaderLazyVariations.h"
+#include "Private/RTTI/BsShaderVariationRTTI.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Core
+	 *  @{
+	 */
+
+	class BS_CORE_EXPORT ShaderLazyVariationsRTTI : public RTTIType<ShaderLazyVariations, IReflectable, ShaderLazyVariationsRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(mName, 0)
+			BS_RTTI_MEMBER_PLAIN(mSource, 1)
+			BS_RTTI_MEMBER_PLAIN(mDefines, 2)
+			BS_RTTI_MEMBER_REFL_ARRAY(mVariations, 3)
+		BS_END_RTTI_MEMBERS
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "ShaderLazyVariations";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_ShaderLazyVariations;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr<ShaderLazyVariations>(new (bs_alloc<ShaderLazyVariations>()) ShaderLazyVariations());
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
@@ -6,6 +6,7 @@
 #include "Reflection/BsRTTIType.h"
 #include "Material/BsShader.h"
 #include "Material/BsMaterial.h"
+#include "Private/RTTI/BsShaderLazyVariationsRTTI.h"
 
 namespace bs
 {
@@ -211,6 +212,7 @@ namespace bs
 
 			BS_RTTI_MEMBER_PLAIN_NAMED(mFlags, mDesc.flags, 13)
 			BS_RTTI_MEMBER_REFL_ARRAY_NAMED(mSubShaders, mDesc.subShaders, 14)
+			BS_RTTI_MEMBER_REFLPTR_NAMED(mLazyVariations, mDesc.lazyVariations, 15)
 		BS_END_RTTI_MEMBERS
 
 		SHADER_DATA_PARAM_DESC& getDataParam(Shader* obj, UINT32 idx)
@@ -291,6 +293,7 @@ namespace bs
 		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
 		{
 			Shader* shader = static_cast<Shader*>(obj);
+			shader->buildParamIds();
 			shader->initialize();
 		}
 
@@ -317,10 +320,14 @@ namespace bs
 		Vector<String>& getIncludes(ShaderMetaData* obj) { return obj->includes; }
 		void setIncludes(ShaderMetaData* obj, Vector<String>& includes) { obj->includes = includes; }
 
+		ShaderIncludeGraph& getIncludeGraph(ShaderMetaData* obj) { return obj->includeGraph; }
+		void setIncludeGraph(ShaderMetaData* obj, ShaderIncludeGraph& graph) { obj->includeGraph = graph; }
+
 	public:
 		ShaderMetaDataRTTI()
 		{
 			addPlainField("includes", 0, &ShaderMetaDataRTTI::getIncludes, &ShaderMetaDataRTTI::setIncludes);
+			addPlainField("includeGraph", 1, &ShaderMetaDataRTTI::getIncludeGraph, &ShaderMetaDataRTTI::setIncludeGraph);
 		}
 
 		const String& getRTTIName() override
@@ -9,6 +9,7 @@
 #include "CoreThread/BsCoreThread.h"
 #include "RenderAPI/BsRenderAPI.h"
 #include "Managers/BsTextureManager.h"
+#include "Managers/BsTextureStreamingManager.h"
 #include "Image/BsPixelData.h"
 
 namespace bs
@@ -52,6 +53,10 @@ namespace bs
 
 		SPtr<PixelData> getPixelData(Texture* obj, UINT32 idx)
 		{
+			// Streamed textures don't have all levels on the GPU, but keep the source data for all of them
+			if (obj->_isStreamed())
+				return obj->mStreamingData[idx];
+
 			UINT32 face = (size_t)Math::floor(idx / (float)(obj->mProperties.getNumMipmaps() + 1));
 			UINT32 mipmap = idx % (obj->mProperties.getNumMipmaps() + 1);
 
@@ -128,16 +133,30 @@ namespace bs
 				}
 			}
 
+			// Streamed textures keep the data for all levels, but only upload the low resolution ones initially. Higher
+			// resolution levels get uploaded later by TextureStreamingManager, as required.
+			bool streamed = (texProps.getUsage() & TU_STREAMED) != 0 && texProps.getNumMipmaps() > 0 &&
+				TextureStreamingManager::isStarted();
+
+			if (streamed)
+			{
+				texture->mStreamingData = *pixelData;
+				texture->mResidentMip = TextureStreamingManager::instance().getInitialMip(texProps);
+			}
+
 			// A bit clumsy initializing with already set values, but I feel its better than complicating things and storing the values
 			// in mRTTIData.
 			texture->initialize();
 
-			for(size_t i = 0; i < pixelData->size(); i++)
+			if (!streamed)
 			{
-				UINT32 face = (size_t)Math::floor(i / (float)(texProps.getNumMipmaps() + 1));
-				UINT32 mipmap = i % (texProps.getNumMipmaps() + 1);
+				for(size_t i = 0; i < pixelData->size(); i++)
+				{
+					UINT32 face = (size_t)Math::floor(i / (float)(texProps.getNumMipmaps() + 1));
+					UINT32 mipmap = i % (texProps.getNumMipmaps() + 1);
 
-				texture->writeData(pixelData->at(i), face, mipmap, false);
+					texture->writeData(pixelData->at(i), face, mipmap, false);
+				}
 			}
 
 			bs_delete(pixelData);
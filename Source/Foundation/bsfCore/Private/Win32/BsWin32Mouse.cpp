@@ -112,6 +112,31 @@ namespace bs
 		INT32 relX, relY, relZ;
 		relX = relY = relZ = 0;
 
+		// DirectInput reports X and Y movement as separate entries, sharing the same sequence number if they were
+		// reported by the device together
+		bool recordSamples = mOwner->getRawMouseMotionEnabled();
+		RawMouseMotion sample;
+		DWORD sampleSequence = 0;
+		bool hasSample = false;
+
+		auto recordSample = [&](const DIDEVICEOBJECTDATA& data, float& axisDelta)
+		{
+			if (!recordSamples)
+				return;
+
+			if (hasSample && data.dwSequence != sampleSequence)
+			{
+				mOwner->_notifyMouseMotionSample(sample.deltaX, sample.deltaY, sample.timestamp);
+				sample = RawMouseMotion();
+			}
+
+			sample.timestamp = data.dwTimeStamp;
+			sampleSequence = data.dwSequence;
+			hasSample = true;
+
+			axisDelta += (float)(INT32)data.dwData;
+		};
+
 		bool axesMoved = false;
 		for (UINT32 i = 0; i < numEntries; ++i)
 		{
@@ -143,10 +168,12 @@ namespace bs
 				break;
 			case DIMOFS_X:
 				relX += diBuff[i].dwData;
+				recordSample(diBuff[i], sample.deltaX);
 				axesMoved = true;
 				break;
 			case DIMOFS_Y:
 				relY += diBuff[i].dwData;
+				recordSample(diBuff[i], sample.deltaY);
 				axesMoved = true;
 				break;
 			case DIMOFS_Z:
@@ -157,6 +184,9 @@ namespace bs
 			}
 		}
 
+		if (hasSample)
+			mOwner->_notifyMouseMotionSample(sample.deltaX, sample.deltaY, sample.timestamp);
+
 		if (axesMoved)
 			mOwner->_notifyMouseMoved(relX, relY, relZ);
 
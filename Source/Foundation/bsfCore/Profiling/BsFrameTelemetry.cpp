@@ -0,0 +1,244 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Profiling/BsFrameTelemetry.h"
+#include "RenderAPI/BsTimerQuery.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Utility/BsTime.h"
+
+namespace bs
+{
+	constexpr UINT32 FrameTelemetry::FRAME_COUNT;
+
+	/** Returns the value at the provided percentile (in range [0, 1]) of an array of sorted values. */
+	static float getPercentile(const float* sortedValues, UINT32 count, float percentile)
+	{
+		UINT32 rank = (UINT32)std::ceil(percentile * count);
+		return sortedValues[std::max(rank, 1U) - 1];
+	}
+
+	TelemetryMetricStats FrameTelemetry::getStats(TelemetryMetric metric) const
+	{
+		Lock lock(mMutex);
+		return calculateStats(metric);
+	}
+
+	FrameTelemetryReport FrameTelemetry::getReport() const
+	{
+		FrameTelemetryReport report;
+
+		Lock lock(mMutex);
+		for (UINT32 i = 0; i < (UINT32)TelemetryMetric::Count; i++)
+			report.metrics[i] = calculateStats((TelemetryMetric)i);
+
+		report.numHitches = countHitches();
+		report.totalHitches = mNumHitches;
+		report.frameCount = mNumSamples[(UINT32)TelemetryMetric::SimTime];
+
+		return report;
+	}
+
+	void FrameTelemetry::setHitchThreshold(float thresholdMs)
+	{
+		Lock lock(mMutex);
+		mHitchThreshold = thresholdMs;
+	}
+
+	float FrameTelemetry::getHitchThreshold() const
+	{
+		Lock lock(mMutex);
+		return mHitchThreshold;
+	}
+
+	UINT64 FrameTelemetry::getNumHitches() const
+	{
+		Lock lock(mMutex);
+		return mNumHitches;
+	}
+
+	void FrameTelemetry::setReportInterval(UINT32 numFrames)
+	{
+		Lock lock(mMutex);
+		mReportInterval = numFrames;
+	}
+
+	UINT32 FrameTelemetry::getReportInterval() const
+	{
+		Lock lock(mMutex);
+		return mReportInterval;
+	}
+
+	void FrameTelemetry::_addSimTime(TelemetryMetric metric, UINT64 time)
+	{
+		mSimTimes[(UINT32)metric] += time;
+	}
+
+	void FrameTelemetry::_endSimFrame(UINT64 simTime)
+	{
+		UINT64 frameEnd = gTime().getTimePrecise();
+		UINT64 frameTime = mLastSimFrameEnd != 0 ? frameEnd - mLastSimFrameEnd : simTime;
+		mLastSimFrameEnd = frameEnd;
+
+		bool triggerReport = false;
+		{
+			Lock lock(mMutex);
+
+			float frameTimeMs = frameTime / 1000.0f;
+			if (frameTimeMs > mHitchThreshold)
+				mNumHitches++;
+
+			addSample(TelemetryMetric::FrameTime, frameTimeMs);
+			addSample(TelemetryMetric::SimTime, simTime / 1000.0f);
+			addSample(TelemetryMetric::AnimationTime, mSimTimes[(UINT32)TelemetryMetric::AnimationTime] / 1000.0f);
+			addSample(TelemetryMetric::PhysicsTime, mSimTimes[(UINT32)TelemetryMetric::PhysicsTime] / 1000.0f);
+			addSample(TelemetryMetric::GUITime, mSimTimes[(UINT32)TelemetryMetric::GUITime] / 1000.0f);
+
+			// Core thread statistics are collected in CoreThread::update(), and cover the previous frame
+			const CoreThreadFrameStats& coreThreadStats = gCoreThread().getFrameStats();
+
+			UINT32 numCommands = coreThreadStats.numInternalCommands;
+			for (auto& entry : coreThreadStats.threadQueues)
+				numCommands += entry.numCommands;
+
+			addSample(TelemetryMetric::CoreThreadCommands, (float)numCommands);
+			addSample(TelemetryMetric::CommandPlaybackTime, coreThreadStats.playbackTimeMs);
+			addSample(TelemetryMetric::CoreThreadBlockedTime, coreThreadStats.blockedTimeMs);
+
+			addSample(TelemetryMetric::ScriptGCTime, mScriptGCTime.exchange(0, std::memory_order_relaxed) / 1000.0f);
+			addSample(TelemetryMetric::ScriptGCCount, (float)mScriptGCCount.exchange(0, std::memory_order_relaxed));
+
+			if (mReportInterval > 0)
+			{
+				mFramesSinceReport++;
+				if (mFramesSinceReport >= mReportInterval)
+				{
+					mFramesSinceReport = 0;
+					triggerReport = true;
+				}
+			}
+		}
+
+		for (auto& entry : mSimTimes)
+			entry = 0;
+
+		// Statistics are only calculated if someone is listening, so an unused interval costs nothing
+		if (triggerReport && !onReport.empty())
+			onReport(getReport());
+	}
+
+	void FrameTelemetry::_addScriptGCPause(UINT64 time)
+	{
+		mScriptGCTime.fetch_add(time, std::memory_order_relaxed);
+		mScriptGCCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void FrameTelemetry::_beginCoreFrame()
+	{
+		while (!mActiveTimerQueries.empty())
+		{
+			SPtr<ct::TimerQuery> query = mActiveTimerQueries.front();
+			if (!query->isReady())
+				break;
+
+			float gpuTime = query->getTimeMs();
+			{
+				Lock lock(mMutex);
+				addSample(TelemetryMetric::GpuTime, gpuTime);
+			}
+
+			mActiveTimerQueries.pop();
+			mFreeTimerQueries.push(query);
+		}
+
+		if (!mFreeTimerQueries.empty())
+		{
+			mFrameTimerQuery = mFreeTimerQueries.top();
+			mFreeTimerQueries.pop();
+		}
+		else
+			mFrameTimerQuery = ct::TimerQuery::create();
+
+		mFrameTimerQuery->begin();
+	}
+
+	void FrameTelemetry::_endCoreFrame(UINT64 coreTime)
+	{
+		if (mFrameTimerQuery != nullptr)
+		{
+			mFrameTimerQuery->end();
+			mActiveTimerQueries.push(mFrameTimerQuery);
+			mFrameTimerQuery = nullptr;
+		}
+
+		const RenderStatsData& stats = RenderStats::instance().getData();
+
+		{
+			Lock lock(mMutex);
+
+			addSample(TelemetryMetric::CoreTime, coreTime / 1000.0f);
+			addSample(TelemetryMetric::DrawCalls, (float)(stats.numDrawCalls - mLastRenderStats.numDrawCalls));
+			addSample(TelemetryMetric::ComputeCalls, (float)(stats.numComputeCalls - mLastRenderStats.numComputeCalls));
+			addSample(TelemetryMetric::Primitives, (float)(stats.numPrimitives - mLastRenderStats.numPrimitives));
+			addSample(TelemetryMetric::PipelineStateChanges,
+				(float)(stats.numPipelineStateChanges - mLastRenderStats.numPipelineStateChanges));
+			addSample(TelemetryMetric::RenderTargetChanges,
+				(float)(stats.numRenderTargetChanges - mLastRenderStats.numRenderTargetChanges));
+			addSample(TelemetryMetric::GpuParamBinds, (float)(stats.numGpuParamBinds - mLastRenderStats.numGpuParamBinds));
+		}
+
+		mLastRenderStats = stats;
+	}
+
+	void FrameTelemetry::_addFrameLatency(UINT64 latency)
+	{
+		Lock lock(mMutex);
+		addSample(TelemetryMetric::FrameLatency, latency / 1000.0f);
+	}
+
+	TelemetryMetricStats FrameTelemetry::calculateStats(TelemetryMetric metric) const
+	{
+		UINT32 metricIdx = (UINT32)metric;
+		UINT32 count = (UINT32)std::min(mNumSamples[metricIdx], (UINT64)FRAME_COUNT);
+
+		TelemetryMetricStats output;
+		output.numSamples = count;
+
+		if (count == 0)
+			return output;
+
+		float sortedValues[FRAME_COUNT];
+		memcpy(sortedValues, mSamples[metricIdx], count * sizeof(float));
+		std::sort(sortedValues, sortedValues + count);
+
+		float sum = 0.0f;
+		for (UINT32 i = 0; i < count; i++)
+			sum += sortedValues[i];
+
+		output.p50 = getPercentile(sortedValues, count, 0.50f);
+		output.p95 = getPercentile(sortedValues, count, 0.95f);
+		output.p99 = getPercentile(sortedValues, count, 0.99f);
+		output.average = sum / count;
+		output.max = sortedValues[count - 1];
+
+		return output;
+	}
+
+	UINT32 FrameTelemetry::countHitches() const
+	{
+		UINT32 metricIdx = (UINT32)TelemetryMetric::FrameTime;
+		UINT32 count = (UINT32)std::min(mNumSamples[metricIdx], (UINT64)FRAME_COUNT);
+
+		UINT32 numHitches = 0;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			if (mSamples[metricIdx][i] > mHitchThreshold)
+				numHitches++;
+		}
+
+		return numHitches;
+	}
+
+	FrameTelemetry& gFrameTelemetry()
+	{
+		return FrameTelemetry::instance();
+	}
+}
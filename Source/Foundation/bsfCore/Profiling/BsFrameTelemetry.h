@@ -0,0 +1,222 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Utility/BsEvent.h"
+#include "Profiling/BsRenderStats.h"
+
+namespace bs
+{
+	/** @addtogroup Profiling
+	 *  @{
+	 */
+
+	/** Per-frame values tracked by FrameTelemetry. Times are in milliseconds. */
+	enum class TelemetryMetric
+	{
+		FrameTime, /**< Time between the end of two consecutive sim thread frames. */
+		SimTime, /**< Time the sim thread spent on a frame, excluding any time spent waiting on the core thread. */
+		CoreTime, /**< Time the core thread spent on a frame. */
+		FrameLatency, /**< Time from the start of a sim thread frame until the core thread finished processing it. */
+		GpuTime, /**< Time the GPU spent executing the commands of a frame. */
+		AnimationTime, /**< Time spent evaluating animation on the sim thread. */
+		PhysicsTime, /**< Time spent updating physics on the sim thread, including fixed updates. */
+		GUITime, /**< Time spent updating the GUI on the sim thread. */
+		DrawCalls, /**< Number of draw calls issued during a frame. */
+		ComputeCalls, /**< Number of compute dispatches issued during a frame. */
+		Primitives, /**< Number of primitives sent to the GPU during a frame. */
+		PipelineStateChanges, /**< Number of pipeline state changes during a frame. */
+		RenderTargetChanges, /**< Number of render target changes during a frame. */
+		GpuParamBinds, /**< Number of times GPU parameters were bound during a frame. */
+		CoreThreadCommands, /**< Number of commands queued for the core thread during a frame, on all queues. */
+		CommandPlaybackTime, /**< Time the core thread spent executing queued commands during a frame. */
+		CoreThreadBlockedTime, /**< Time other threads spent blocked waiting on the core thread to execute a command. */
+		ScriptGCTime, /**< Time all threads were paused by managed garbage collection during a frame. */
+		ScriptGCCount, /**< Number of managed garbage collections during a frame. */
+		Count // Keep at end
+	};
+
+	/** Distribution of a single telemetry metric over the recently recorded frames. */
+	struct TelemetryMetricStats
+	{
+		float p50 = 0.0f; /**< Median value. */
+		float p95 = 0.0f; /**< Value that 95% of the frames are at or below. */
+		float p99 = 0.0f; /**< Value that 99% of the frames are at or below. */
+		float average = 0.0f; /**< Mean value. */
+		float max = 0.0f; /**< Largest value. */
+		UINT32 numSamples = 0; /**< Number of frames the statistics were calculated from. */
+	};
+
+	/** Summary of the recently recorded frames, as reported by FrameTelemetry. */
+	struct FrameTelemetryReport
+	{
+		/** Statistics for each metric, indexed by TelemetryMetric. */
+		TelemetryMetricStats metrics[(UINT32)TelemetryMetric::Count];
+
+		/** Number of hitches within the frames the statistics were calculated from. */
+		UINT32 numHitches = 0;
+
+		/** Number of hitches since the application started. */
+		UINT64 totalHitches = 0;
+
+		/** Number of sim thread frames recorded since the application started. */
+		UINT64 frameCount = 0;
+
+		/** Returns the statistics for the specified metric. */
+		const TelemetryMetricStats& operator[](TelemetryMetric metric) const { return metrics[(UINT32)metric]; }
+	};
+
+	/**
+	 * Keeps a small set of per-frame timings and render counters for the last FRAME_COUNT frames, and reports their
+	 * distribution. Unlike the CPU and GPU profilers it is always active, including in builds with profiling disabled,
+	 * and its per-frame cost is limited to a handful of stores into fixed-size ring buffers. Statistics are only
+	 * calculated when they are requested, or when a periodic report is triggered.
+	 *
+	 * @note	Thread safe unless specified otherwise.
+	 */
+	class BS_CORE_EXPORT FrameTelemetry : public Module<FrameTelemetry>
+	{
+	public:
+		/** Number of most recent frames the statistics are calculated from. */
+		static constexpr UINT32 FRAME_COUNT = 512;
+
+		FrameTelemetry() = default;
+
+		/** Calculates the statistics for a single metric over the recently recorded frames. */
+		TelemetryMetricStats getStats(TelemetryMetric metric) const;
+
+		/** Calculates the statistics for all metrics over the recently recorded frames. */
+		FrameTelemetryReport getReport() const;
+
+		/**
+		 * Sets the frame time in milliseconds above which a frame is considered a hitch. Defaults to 50ms (i.e. the frame
+		 * took long enough for the drop to be visible to the user even with a lower frame rate target).
+		 */
+		void setHitchThreshold(float thresholdMs);
+
+		/** @copydoc setHitchThreshold */
+		float getHitchThreshold() const;
+
+		/** Returns the number of hitches since the application started. */
+		UINT64 getNumHitches() const;
+
+		/**
+		 * Sets the interval, in sim thread frames, at which the onReport event is triggered. Zero disables periodic
+		 * reports.
+		 */
+		void setReportInterval(UINT32 numFrames);
+
+		/** @copydoc setReportInterval */
+		UINT32 getReportInterval() const;
+
+		/**
+		 * Triggered periodically on the sim thread with a report on the recently recorded frames, as determined by
+		 * setReportInterval(). Can be used for forwarding the statistics to an external service.
+		 */
+		Event<void(const FrameTelemetryReport&)> onReport;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Adds time to a metric recorded on the sim thread (e.g. animation or physics), for the current frame. Can be
+		 * called multiple times per frame.
+		 *
+		 * @param[in]	metric	Metric to add the time to.
+		 * @param[in]	time	Time in microseconds.
+		 *
+		 * @note	Sim thread only.
+		 */
+		void _addSimTime(TelemetryMetric metric, UINT64 time);
+
+		/**
+		 * Records the values accumulated by _addSimTime() for the current frame and starts a new frame.
+		 *
+		 * @param[in]	simTime		Time in microseconds the sim thread spent working on the frame.
+		 *
+		 * @note	Sim thread only.
+		 */
+		void _endSimFrame(UINT64 simTime);
+
+		/**
+		 * Starts GPU timing for a new core thread frame and retrieves GPU timings for any earlier frames the GPU has
+		 * finished executing.
+		 *
+		 * @note	Core thread only.
+		 */
+		void _beginCoreFrame();
+
+		/**
+		 * Records the values for the current core thread frame.
+		 *
+		 * @param[in]	coreTime	Time in microseconds the core thread spent working on the frame.
+		 *
+		 * @note	Core thread only.
+		 */
+		void _endCoreFrame(UINT64 coreTime);
+
+		/**
+		 * Records the latency of a sim thread frame, once the core thread finished processing it.
+		 *
+		 * @param[in]	latency		Time in microseconds from the start of the sim thread frame, including any time the
+		 *							frame spent queued for the core thread.
+		 *
+		 * @note	Core thread only.
+		 */
+		void _addFrameLatency(UINT64 latency);
+
+		/**
+		 * Records a pause caused by managed garbage collection, counted towards the current sim thread frame.
+		 *
+		 * @param[in]	time	Duration of the pause in microseconds.
+		 *
+		 * @note	Thread safe.
+		 */
+		void _addScriptGCPause(UINT64 time);
+
+		/** @} */
+	private:
+		/** Records a new value for the provided metric. Caller must hold mMutex. */
+		void addSample(TelemetryMetric metric, float value)
+		{
+			UINT32 metricIdx = (UINT32)metric;
+			mSamples[metricIdx][mNumSamples[metricIdx] % FRAME_COUNT] = value;
+			mNumSamples[metricIdx]++;
+		}
+
+		/** Calculates the statistics for a single metric. Caller must hold mMutex. */
+		TelemetryMetricStats calculateStats(TelemetryMetric metric) const;
+
+		/** Returns the number of hitches among the frames currently in the ring buffer. Caller must hold mMutex. */
+		UINT32 countHitches() const;
+
+		float mSamples[(UINT32)TelemetryMetric::Count][FRAME_COUNT];
+		UINT64 mNumSamples[(UINT32)TelemetryMetric::Count] = { };
+		UINT64 mNumHitches = 0;
+		float mHitchThreshold = 50.0f;
+		UINT32 mReportInterval = 0;
+		mutable Mutex mMutex;
+
+		std::atomic<UINT64> mScriptGCTime{0};
+		std::atomic<UINT32> mScriptGCCount{0};
+
+		// Sim thread only
+		UINT64 mSimTimes[(UINT32)TelemetryMetric::Count] = { };
+		UINT64 mLastSimFrameEnd = 0;
+		UINT32 mFramesSinceReport = 0;
+
+		// Core thread only
+		RenderStatsData mLastRenderStats;
+		Queue<SPtr<ct::TimerQuery>> mActiveTimerQueries;
+		Stack<SPtr<ct::TimerQuery>> mFreeTimerQueries;
+		SPtr<ct::TimerQuery> mFrameTimerQuery;
+	};
+
+	/** Provides easy access to FrameTelemetry. */
+	BS_CORE_EXPORT FrameTelemetry& gFrameTelemetry();
+
+	/** @} */
+}
@@ -0,0 +1,210 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Profiling/BsGpuMemoryProfiler.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	static constexpr UINT32 NUM_GPU_CATEGORIES = (UINT32)GpuMemoryCategory::Count;
+
+	/** Running totals for a single GPU memory category. */
+	struct GpuMemoryCategoryCounters
+	{
+		std::atomic<UINT64> liveBytes;
+		std::atomic<UINT64> peakBytes;
+		std::atomic<UINT64> totalBytesAllocated;
+		std::atomic<UINT64> totalBytesFreed;
+		std::atomic<UINT64> numAllocs;
+		std::atomic<UINT64> numFrees;
+		std::atomic<UINT64> budgetBytes;
+	};
+
+	/** Counter values at the time of the last generated report, used for calculating per-frame churn. */
+	struct GpuMemoryCategorySnapshot
+	{
+		UINT64 totalBytesAllocated = 0;
+		UINT64 totalBytesFreed = 0;
+		UINT64 numAllocs = 0;
+		UINT64 numFrees = 0;
+		bool overBudget = false;
+	};
+
+	/** Information about a single live GPU allocation. */
+	struct GpuAllocationInfo
+	{
+		GpuMemoryCategory category;
+		UINT64 bytes;
+		String description;
+	};
+
+	static GpuMemoryCategoryCounters gGpuMemoryCounters[NUM_GPU_CATEGORIES];
+	static GpuMemoryCategorySnapshot gGpuMemorySnapshots[NUM_GPU_CATEGORIES];
+	static SpinLock gGpuMemoryReportLock;
+
+	/** Returns the map of all live allocations, keyed by their owner. */
+	static UnorderedMap<const void*, GpuAllocationInfo>& getGpuAllocations()
+	{
+		static UnorderedMap<const void*, GpuAllocationInfo> allocations;
+		return allocations;
+	}
+
+	static Mutex gGpuAllocationsMutex;
+
+	const char* GpuMemoryProfiler::getCategoryName(GpuMemoryCategory category)
+	{
+		switch(category)
+		{
+		case GpuMemoryCategory::RenderTarget: return "Render targets";
+		case GpuMemoryCategory::Texture: return "Textures";
+		case GpuMemoryCategory::Mesh: return "Meshes";
+		case GpuMemoryCategory::ParamBuffer: return "Param buffers";
+		case GpuMemoryCategory::Buffer: return "Buffers";
+		case GpuMemoryCategory::Staging: return "Staging";
+		default: return "Unknown";
+		}
+	}
+
+	UINT64 GpuMemoryProfiler::getLiveBytes(GpuMemoryCategory category)
+	{
+		return gGpuMemoryCounters[(UINT32)category].liveBytes.load(std::memory_order_relaxed);
+	}
+
+	UINT64 GpuMemoryProfiler::getPeakBytes(GpuMemoryCategory category)
+	{
+		return gGpuMemoryCounters[(UINT32)category].peakBytes.load(std::memory_order_relaxed);
+	}
+
+	void GpuMemoryProfiler::setBudget(GpuMemoryCategory category, UINT64 bytes)
+	{
+		gGpuMemoryCounters[(UINT32)category].budgetBytes.store(bytes, std::memory_order_relaxed);
+	}
+
+	UINT64 GpuMemoryProfiler::getBudget(GpuMemoryCategory category)
+	{
+		return gGpuMemoryCounters[(UINT32)category].budgetBytes.load(std::memory_order_relaxed);
+	}
+
+	GpuMemoryReport GpuMemoryProfiler::generateReport()
+	{
+		GpuMemoryReport report;
+
+		ScopedSpinLock lock(gGpuMemoryReportLock);
+		for(UINT32 i = 0; i < NUM_GPU_CATEGORIES; i++)
+		{
+			const GpuMemoryCategoryCounters& counters = gGpuMemoryCounters[i];
+			GpuMemoryCategorySnapshot& snapshot = gGpuMemorySnapshots[i];
+			MemoryCategoryReport& entry = report.categories[i];
+
+			const UINT64 totalBytesAllocated = counters.totalBytesAllocated.load(std::memory_order_relaxed);
+			const UINT64 totalBytesFreed = counters.totalBytesFreed.load(std::memory_order_relaxed);
+			const UINT64 numAllocs = counters.numAllocs.load(std::memory_order_relaxed);
+			const UINT64 numFrees = counters.numFrees.load(std::memory_order_relaxed);
+
+			entry.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+			entry.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+			entry.budgetBytes = counters.budgetBytes.load(std::memory_order_relaxed);
+			entry.bytesAllocated = totalBytesAllocated - snapshot.totalBytesAllocated;
+			entry.bytesFreed = totalBytesFreed - snapshot.totalBytesFreed;
+			entry.numAllocs = numAllocs - snapshot.numAllocs;
+			entry.numFrees = numFrees - snapshot.numFrees;
+
+			snapshot.totalBytesAllocated = totalBytesAllocated;
+			snapshot.totalBytesFreed = totalBytesFreed;
+			snapshot.numAllocs = numAllocs;
+			snapshot.numFrees = numFrees;
+
+			const bool overBudget = entry.budgetBytes > 0 && entry.liveBytes > entry.budgetBytes;
+			if(overBudget && !snapshot.overBudget)
+			{
+				LOGWRN("GPU memory category \"" + String(getCategoryName((GpuMemoryCategory)i)) + "\" exceeded its " +
+					"budget. Using " + toString(entry.liveBytes) + " bytes, budget is " + toString(entry.budgetBytes) +
+					" bytes.");
+			}
+
+			snapshot.overBudget = overBudget;
+		}
+
+		return report;
+	}
+
+	void GpuMemoryProfiler::logLargestAllocations(UINT32 count)
+	{
+		Vector<GpuAllocationInfo> allocations;
+		{
+			Lock lock(gGpuAllocationsMutex);
+
+			const UnorderedMap<const void*, GpuAllocationInfo>& liveAllocations = getGpuAllocations();
+			allocations.reserve(liveAllocations.size());
+
+			for(auto& entry : liveAllocations)
+				allocations.push_back(entry.second);
+		}
+
+		count = std::min(count, (UINT32)allocations.size());
+		std::partial_sort(allocations.begin(), allocations.begin() + count, allocations.end(),
+			[](const GpuAllocationInfo& a, const GpuAllocationInfo& b) { return a.bytes > b.bytes; });
+
+		StringStream output;
+		output << "Largest GPU allocations (" << count << " of " << allocations.size() << "):";
+
+		for(UINT32 i = 0; i < count; i++)
+		{
+			const GpuAllocationInfo& allocation = allocations[i];
+
+			output << "\n  " << (allocation.bytes / 1024) << " KB - " << getCategoryName(allocation.category);
+			if(!allocation.description.empty())
+				output << " - " << allocation.description;
+		}
+
+		LOGDBG(output.str());
+	}
+
+	void GpuMemoryProfiler::_registerAlloc(GpuMemoryCategory category, const void* owner, UINT64 bytes,
+		const String& description)
+	{
+		{
+			Lock lock(gGpuAllocationsMutex);
+
+			auto result = getGpuAllocations().insert(std::make_pair(owner, GpuAllocationInfo{ category, bytes, description }));
+			if(!result.second)
+				return; // Already registered
+		}
+
+		GpuMemoryCategoryCounters& counters = gGpuMemoryCounters[(UINT32)category];
+
+		const UINT64 liveBytes = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+		counters.totalBytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+		counters.numAllocs.fetch_add(1, std::memory_order_relaxed);
+
+		UINT64 peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+		while(liveBytes > peakBytes)
+		{
+			if(counters.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+				break;
+		}
+	}
+
+	void GpuMemoryProfiler::_registerFree(const void* owner)
+	{
+		GpuMemoryCategory category;
+		UINT64 bytes;
+		{
+			Lock lock(gGpuAllocationsMutex);
+
+			UnorderedMap<const void*, GpuAllocationInfo>& allocations = getGpuAllocations();
+			auto iterFind = allocations.find(owner);
+			if(iterFind == allocations.end())
+				return;
+
+			category = iterFind->second.category;
+			bytes = iterFind->second.bytes;
+			allocations.erase(iterFind);
+		}
+
+		GpuMemoryCategoryCounters& counters = gGpuMemoryCounters[(UINT32)category];
+
+		counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+		counters.totalBytesFreed.fetch_add(bytes, std::memory_order_relaxed);
+		counters.numFrees.fetch_add(1, std::memory_order_relaxed);
+	}
+}
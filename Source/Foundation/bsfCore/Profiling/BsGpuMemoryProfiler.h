@@ -0,0 +1,115 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Profiling
+	 *  @{
+	 */
+
+	/** Types of GPU resources that GPU memory usage is attributed to. */
+	enum class GpuMemoryCategory
+	{
+		RenderTarget, /**< Textures usable as color or depth-stencil render targets. */
+		Texture, /**< All other textures. */
+		Mesh, /**< Vertex and index buffers. */
+		ParamBuffer, /**< GPU parameter block (uniform/constant) buffers. */
+		Buffer, /**< Generic GPU buffers. */
+		Staging, /**< Host visible buffers used for uploading data to, or reading data from, other resources. */
+		Count // Keep last
+	};
+
+	/** Memory statistics for all GPU memory categories, over a single frame. */
+	struct GpuMemoryReport
+	{
+		MemoryCategoryReport categories[(UINT32)GpuMemoryCategory::Count];
+	};
+
+	/** Information about a single memory heap exposed by the GPU. */
+	struct GpuMemoryHeapStats
+	{
+		UINT64 size = 0; /**< Total size of the heap, in bytes. */
+		UINT64 usedBytes = 0; /**< Number of bytes allocated from the heap by the render API. */
+		UINT32 numAllocations = 0; /**< Number of allocations the used bytes are split between. */
+		bool deviceLocal = false; /**< True if the heap resides in dedicated GPU memory, false if in system memory. */
+	};
+
+	/** GPU memory usage as reported by ct::RenderAPI::getGpuMemoryStats(). */
+	struct GpuMemoryStats
+	{
+		/** Number of bytes currently allocated per resource category. See GpuMemoryProfiler. */
+		UINT64 categoryBytes[(UINT32)GpuMemoryCategory::Count] = { };
+
+		/** Usage of the individual memory heaps. Empty if the render API doesn't expose its heaps. */
+		Vector<GpuMemoryHeapStats> heaps;
+	};
+
+	/**
+	 * Tracks GPU memory used by textures and buffers, keeping live and peak byte counts per GPU memory category, and
+	 * optionally enforcing per-category memory budgets. Sizes are estimated from the resource descriptions and don't
+	 * account for padding and alignment the driver might add.
+	 *
+	 * Resources are registered through BS_GPU_MEMORY_ALLOC and BS_GPU_MEMORY_FREE, which only track memory when
+	 * profiling or telemetry is enabled.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT GpuMemoryProfiler
+	{
+	public:
+		/** Returns a human readable name of the GPU memory category. */
+		static const char* getCategoryName(GpuMemoryCategory category);
+
+		/** Returns the number of bytes currently allocated in the specified category. */
+		static UINT64 getLiveBytes(GpuMemoryCategory category);
+
+		/** Returns the highest number of bytes that were allocated in the specified category at any point. */
+		static UINT64 getPeakBytes(GpuMemoryCategory category);
+
+		/**
+		 * Assigns a memory budget to the specified category. A warning is logged during report generation whenever the
+		 * number of live bytes in the category first exceeds the budget. Set to 0 to disable the budget.
+		 */
+		static void setBudget(GpuMemoryCategory category, UINT64 bytes);
+
+		/** Returns the budget previously assigned with setBudget(). */
+		static UINT64 getBudget(GpuMemoryCategory category);
+
+		/**
+		 * Generates a report containing the current GPU memory statistics, as well as the amount of memory churn
+		 * (allocations and frees) since the last call. Logs a warning for any categories that went over budget since the
+		 * last call. Normally called once per frame by the profiling manager.
+		 */
+		static GpuMemoryReport generateReport();
+
+		/** Logs the @p count largest live GPU allocations, largest first. */
+		static void logLargestAllocations(UINT32 count = 10);
+
+		/**
+		 * Registers a new GPU allocation.
+		 *
+		 * @param[in]	category	Category to attribute the allocation to.
+		 * @param[in]	owner		Object owning the allocation. Used for identifying the allocation when it is freed.
+		 * @param[in]	bytes		Size of the allocation in bytes.
+		 * @param[in]	description	Optional description of the allocation, used when logging the largest allocations.
+		 */
+		static void _registerAlloc(GpuMemoryCategory category, const void* owner, UINT64 bytes,
+			const String& description = StringUtil::BLANK);
+
+		/** Registers that the allocation belonging to @p owner has been freed. Does nothing if @p owner isn't registered. */
+		static void _registerFree(const void* owner);
+	};
+
+#if BS_PROFILING_ENABLED || BS_TELEMETRY_ENABLED
+	#define BS_GPU_MEMORY_ALLOC(Category, Owner, ...) GpuMemoryProfiler::_registerAlloc(Category, Owner, __VA_ARGS__)
+	#define BS_GPU_MEMORY_FREE(Owner) GpuMemoryProfiler::_registerFree(Owner)
+#else
+	#define BS_GPU_MEMORY_ALLOC(Category, Owner, ...)
+	#define BS_GPU_MEMORY_FREE(Owner)
+#endif
+
+	/** @} */
+}
@@ -0,0 +1,234 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Profiling/BsHitchDetector.h"
+#include "Profiling/BsProfilerCPU.h"
+#include "Profiling/BsProfilingManager.h"
+#include "Resources/BsResources.h"
+#include "Resources/BsResource.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsTime.h"
+#include "Debug/BsDebug.h"
+#include "Math/BsMath.h"
+#include "ThirdParty/json.hpp"
+
+namespace bs
+{
+	constexpr UINT32 HitchDetector::MAX_CAPTURED_FRAMES;
+	constexpr UINT32 HitchDetector::MEDIAN_FRAME_COUNT;
+	constexpr UINT32 HitchDetector::MAX_RESOURCE_LOADS;
+
+	HitchDetector::HitchDetector()
+	{
+		mResourceLoadedConn = gResources().onResourceLoaded.connect(
+			std::bind(&HitchDetector::onResourceLoaded, this, std::placeholders::_1));
+	}
+
+	HitchDetector::~HitchDetector()
+	{
+		mResourceLoadedConn.disconnect();
+	}
+
+	void HitchDetector::setEnabled(bool enabled)
+	{
+		if (enabled == isEnabled())
+			return;
+
+		mEnabled.store(enabled, std::memory_order_relaxed);
+		gProfilerCPU().setTimelineEnabled(enabled);
+
+		// Frames recorded before the detector was disabled are no longer contiguous with the new ones
+		mNumFrames = 0;
+		mLastFrameEnd = 0;
+		mLastCaptureFrame = 0;
+
+		Lock lock(mResourceLoadsMutex);
+		mResourceLoads.clear();
+	}
+
+	void HitchDetector::setNumCapturedFrames(UINT32 count)
+	{
+		mNumCapturedFrames = Math::clamp(count, 1U, MAX_CAPTURED_FRAMES);
+	}
+
+	void HitchDetector::_update()
+	{
+		if (!isEnabled())
+			return;
+
+		UINT64 frameEnd = gTime().getTimePrecise();
+		UINT64 timelineTime = gProfilerCPU().getTimelineTime();
+		UINT64 numAllocs = MemoryCounter::getNumAllocs();
+		UINT64 numFrees = MemoryCounter::getNumFrees();
+
+		// Nothing to measure the first frame against
+		if (mLastFrameEnd == 0)
+		{
+			mLastFrameEnd = frameEnd;
+			mLastTimelineTime = timelineTime;
+			mLastAllocs = numAllocs;
+			mLastFrees = numFrees;
+			return;
+		}
+
+		FrameInfo& frame = mFrames[mNumFrames % MAX_CAPTURED_FRAMES];
+		frame.frameIdx = gTime().getFrameIdx();
+		frame.frameTimeMs = (frameEnd - mLastFrameEnd) / 1000.0f;
+		frame.timelineStart = mLastTimelineTime;
+		frame.numAllocs = numAllocs - mLastAllocs;
+		frame.numFrees = numFrees - mLastFrees;
+		frame.syncStats = CoreObjectManager::instance().getSyncStats();
+
+#if BS_PROFILING_ENABLED
+		frame.memoryReport = gProfiler().getReport(ProfiledThread::Sim).memoryReport;
+#endif
+
+		bool isHitch = frame.frameTimeMs > mThreshold;
+
+		// Median is only reliable once the full window of frames was recorded
+		float medianFrameTime = 0.0f;
+		if (mNumFrames >= MEDIAN_FRAME_COUNT)
+		{
+			medianFrameTime = getMedianFrameTime();
+
+			if (mMedianMultiplier > 0.0f && frame.frameTimeMs > medianFrameTime * mMedianMultiplier)
+				isHitch = true;
+		}
+
+		mFrameTimes[mNumFrames % MEDIAN_FRAME_COUNT] = frame.frameTimeMs;
+		mNumFrames++;
+
+		mLastFrameEnd = frameEnd;
+		mLastTimelineTime = timelineTime;
+		mLastAllocs = numAllocs;
+		mLastFrees = numFrees;
+
+		// Wait until enough frames were recorded, and don't capture frames belonging to the previous capture again
+		if (isHitch && mNumFrames >= mNumCapturedFrames && (mNumFrames - mLastCaptureFrame) >= mNumCapturedFrames)
+			capture(medianFrameTime);
+	}
+
+	void HitchDetector::onResourceLoaded(const HResource& resource)
+	{
+		if (!isEnabled())
+			return;
+
+		ResourceLoadInfo loadInfo;
+		loadInfo.frameIdx = gTime().getFrameIdx();
+		loadInfo.name = resource.isLoaded(false) ? resource->getName() : StringUtil::BLANK;
+		loadInfo.uuid = resource.getUUID();
+
+		Lock lock(mResourceLoadsMutex);
+		mResourceLoads.push_back(loadInfo);
+
+		if (mResourceLoads.size() > MAX_RESOURCE_LOADS)
+			mResourceLoads.pop_front();
+	}
+
+	float HitchDetector::getMedianFrameTime() const
+	{
+		float sortedTimes[MEDIAN_FRAME_COUNT];
+		memcpy(sortedTimes, mFrameTimes, sizeof(mFrameTimes));
+
+		std::nth_element(sortedTimes, sortedTimes + MEDIAN_FRAME_COUNT / 2, sortedTimes + MEDIAN_FRAME_COUNT);
+		return sortedTimes[MEDIAN_FRAME_COUNT / 2];
+	}
+
+	void HitchDetector::capture(float medianFrameTimeMs)
+	{
+		UINT32 numFrames = (UINT32)std::min((UINT64)mNumCapturedFrames, mNumFrames);
+		UINT64 firstFrame = mNumFrames - numFrames;
+
+		const FrameInfo& hitchFrame = mFrames[(mNumFrames - 1) % MAX_CAPTURED_FRAMES];
+		const FrameInfo& oldestFrame = mFrames[firstFrame % MAX_CAPTURED_FRAMES];
+
+		nlohmann::json frames = nlohmann::json::array();
+		for (UINT64 i = firstFrame; i < mNumFrames; i++)
+		{
+			const FrameInfo& frame = mFrames[i % MAX_CAPTURED_FRAMES];
+
+			nlohmann::json memory = nlohmann::json::object();
+			for (UINT32 j = 0; j < (UINT32)MemoryCategory::Count; j++)
+			{
+				const MemoryCategoryReport& category = frame.memoryReport.categories[j];
+
+				memory[MemAllocProfiler::getCategoryName((MemoryCategory)j)] = {
+					{ "liveBytes", category.liveBytes }, { "bytesAllocated", category.bytesAllocated },
+					{ "bytesFreed", category.bytesFreed }, { "numAllocs", category.numAllocs },
+					{ "numFrees", category.numFrees }
+				};
+			}
+
+			frames.push_back({
+				{ "frame", frame.frameIdx },
+				{ "frameTimeMs", frame.frameTimeMs },
+				{ "simThreadAllocs", frame.numAllocs },
+				{ "simThreadFrees", frame.numFrees },
+				{ "coreObjectSync", {
+					{ "syncedObjects", frame.syncStats.numSyncedObjects },
+					{ "batchedObjects", frame.syncStats.numBatchedObjects },
+					{ "batches", frame.syncStats.numBatches },
+					{ "bytes", frame.syncStats.numBytes }
+				}},
+				{ "memory", memory }
+			});
+		}
+
+		nlohmann::json resourceLoads = nlohmann::json::array();
+		{
+			Lock lock(mResourceLoadsMutex);
+			for (auto& entry : mResourceLoads)
+			{
+				if (entry.frameIdx < oldestFrame.frameIdx)
+					continue;
+
+				resourceLoads.push_back({
+					{ "frame", entry.frameIdx }, { "name", entry.name.c_str() }, { "uuid", entry.uuid.toString().c_str() }
+				});
+			}
+		}
+
+		String baseName = "Hitch_" + toString(hitchFrame.frameIdx);
+		Path infoPath = mOutputFolder + Path(baseName + ".json");
+		Path timelinePath = mOutputFolder + Path(baseName + "_Timeline.json");
+
+		nlohmann::json info = {
+			{ "frame", hitchFrame.frameIdx },
+			{ "frameTimeMs", hitchFrame.frameTimeMs },
+			{ "medianFrameTimeMs", medianFrameTimeMs },
+			{ "thresholdMs", mThreshold },
+			{ "timeline", timelinePath.getFilename().c_str() },
+			{ "frames", frames },
+			{ "resourceLoads", resourceLoads }
+		};
+
+		if (!FileSystem::exists(mOutputFolder))
+			FileSystem::createDir(mOutputFolder);
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(infoPath);
+		if (stream == nullptr)
+		{
+			LOGERR("Failed to save hitch information to: " + infoPath.toString());
+			return;
+		}
+
+		std::string infoString = info.dump(4);
+		stream->write(infoString.data(), infoString.size());
+		stream->close();
+
+		gProfilerCPU().exportTimeline(timelinePath, oldestFrame.timelineStart);
+
+		mLastCaptureFrame = mNumFrames;
+		mNumCaptures++;
+
+		LOGWRN("Frame " + toString(hitchFrame.frameIdx) + " took " + toString(hitchFrame.frameTimeMs) + "ms. Saved " +
+			"hitch information to: " + infoPath.toString());
+
+		onHitchCaptured(infoPath);
+	}
+
+	HitchDetector& gHitchDetector()
+	{
+		return HitchDetector::instance();
+	}
+}
@@ -0,0 +1,153 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Utility/BsEvent.h"
+#include "CoreThread/BsCoreObjectManager.h"
+#include "FileSystem/BsPath.h"
+
+namespace bs
+{
+	/** @addtogroup Profiling
+	 *  @{
+	 */
+
+	/**
+	 * Detects frames that take considerably longer than usual, and saves information about the frames leading up to them
+	 * so they can be analyzed later. A frame is considered a hitch if it takes longer than a fixed threshold, or longer
+	 * than a multiple of the median time of the recent frames.
+	 *
+	 * For each hitch two files are written to the output folder:
+	 *  - Hitch_<frame>.json containing per-frame times, CoreObject sync counts, sim thread allocation counts and memory
+	 *    category statistics, as well as the resources loaded during the captured frames.
+	 *  - Hitch_<frame>_Timeline.json containing the ProfilerCPU timeline of the captured frames, in the Chrome trace
+	 *    event format.
+	 *
+	 * The detector is disabled by default, and is cheap enough to leave enabled in testing builds. Enabling or disabling
+	 * it also enables or disables the ProfilerCPU timeline capture.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT HitchDetector : public Module<HitchDetector>
+	{
+	public:
+		/** Maximum number of frames that can be captured for a single hitch. */
+		static constexpr UINT32 MAX_CAPTURED_FRAMES = 64;
+
+		HitchDetector();
+		~HitchDetector();
+
+		/** Enables or disables hitch detection. */
+		void setEnabled(bool enabled);
+
+		/** Checks is hitch detection enabled. */
+		bool isEnabled() const { return mEnabled.load(std::memory_order_relaxed); }
+
+		/** Sets the frame time in milliseconds above which a frame is always considered a hitch. Defaults to 50ms. */
+		void setThreshold(float thresholdMs) { mThreshold = thresholdMs; }
+
+		/** @copydoc setThreshold */
+		float getThreshold() const { return mThreshold; }
+
+		/**
+		 * Sets the multiple of the median time of the recent frames above which a frame is considered a hitch, even if it
+		 * is below the threshold set by setThreshold(). Zero disables the check. Defaults to 3.
+		 */
+		void setMedianMultiplier(float multiplier) { mMedianMultiplier = multiplier; }
+
+		/** @copydoc setMedianMultiplier */
+		float getMedianMultiplier() const { return mMedianMultiplier; }
+
+		/**
+		 * Sets the number of frames that are captured when a hitch is detected, including the hitch frame itself. In
+		 * range [1, MAX_CAPTURED_FRAMES]. Defaults to 10.
+		 */
+		void setNumCapturedFrames(UINT32 count);
+
+		/** @copydoc setNumCapturedFrames */
+		UINT32 getNumCapturedFrames() const { return mNumCapturedFrames; }
+
+		/** Sets the folder hitch captures are written to. Defaults to "Hitches" in the working directory. */
+		void setOutputFolder(const Path& folder) { mOutputFolder = folder; }
+
+		/** @copydoc setOutputFolder */
+		const Path& getOutputFolder() const { return mOutputFolder; }
+
+		/** Returns the number of hitches captured since the detector was started. */
+		UINT32 getNumCaptures() const { return mNumCaptures; }
+
+		/** Triggered after a hitch has been captured. Receives the path to the file containing the frame information. */
+		Event<void(const Path&)> onHitchCaptured;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Records information about the frame that just finished. To be called once per frame, after profiler update. */
+		void _update();
+
+		/** @} */
+	private:
+		/** Information about a single recorded frame. */
+		struct FrameInfo
+		{
+			UINT64 frameIdx = 0;
+			float frameTimeMs = 0.0f;
+			UINT64 timelineStart = 0;
+			UINT64 numAllocs = 0;
+			UINT64 numFrees = 0;
+			CoreObjectSyncStats syncStats;
+			MemoryProfilerReport memoryReport;
+		};
+
+		/** Information about a resource that finished loading. */
+		struct ResourceLoadInfo
+		{
+			UINT64 frameIdx;
+			String name;
+			UUID uuid;
+		};
+
+		/** Triggered when a resource finishes loading. */
+		void onResourceLoaded(const HResource& resource);
+
+		/** Returns the median frame time of the recent frames, not including the last frame. */
+		float getMedianFrameTime() const;
+
+		/** Saves the information about the recently recorded frames to the output folder. */
+		void capture(float medianFrameTimeMs);
+
+		/** Number of frames the rolling median is calculated from. */
+		static constexpr UINT32 MEDIAN_FRAME_COUNT = 64;
+
+		/** Maximum number of resource load events kept. */
+		static constexpr UINT32 MAX_RESOURCE_LOADS = 256;
+
+		std::atomic<bool> mEnabled{false};
+		float mThreshold = 50.0f;
+		float mMedianMultiplier = 3.0f;
+		UINT32 mNumCapturedFrames = 10;
+		Path mOutputFolder = "Hitches";
+		UINT32 mNumCaptures = 0;
+
+		FrameInfo mFrames[MAX_CAPTURED_FRAMES];
+		float mFrameTimes[MEDIAN_FRAME_COUNT];
+		UINT64 mNumFrames = 0;
+		UINT64 mLastFrameEnd = 0;
+		UINT64 mLastTimelineTime = 0;
+		UINT64 mLastAllocs = 0;
+		UINT64 mLastFrees = 0;
+		UINT64 mLastCaptureFrame = 0;
+
+		Deque<ResourceLoadInfo> mResourceLoads;
+		Mutex mResourceLoadsMutex;
+		HEvent mResourceLoadedConn;
+	};
+
+	/** Provides easy access to HitchDetector. */
+	BS_CORE_EXPORT HitchDetector& gHitchDetector();
+
+	/** @} */
+}
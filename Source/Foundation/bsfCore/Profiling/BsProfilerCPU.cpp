@@ -1,8 +1,12 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Profiling/BsProfilerCPU.h"
+#include "Profiling/BsProfilerGPU.h"
 #include "Debug/BsDebug.h"
 #include "Platform/BsPlatform.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "ThirdParty/json.hpp"
 #include <chrono>
 
 #if BS_COMPILER == BS_COMPILER_MSVC
@@ -158,6 +162,57 @@ namespace bs
 		samples.erase(samples.end() - 1);
 	}
 
+	ProfilerCPU::TimelineBuffer::~TimelineBuffer()
+	{
+		TimelineEvent* buffer = events.load();
+		if(buffer != nullptr)
+			bs_deleteN<TimelineEvent, ProfilerAlloc>(buffer, TIMELINE_CAPACITY);
+	}
+
+	void ProfilerCPU::TimelineBuffer::record(const char* name, UINT64 timeUs, bool begin)
+	{
+		// Allocated on first use, so threads don't pay for the buffer unless the timeline is captured
+		TimelineEvent* buffer = events.load(std::memory_order_relaxed);
+		if(buffer == nullptr)
+		{
+			buffer = bs_newN<TimelineEvent, ProfilerAlloc>(TIMELINE_CAPACITY);
+			events.store(buffer, std::memory_order_release);
+		}
+
+		UINT64 idx = writeIdx.load(std::memory_order_relaxed);
+		TimelineEvent& event = buffer[idx & (TIMELINE_CAPACITY - 1)];
+
+		strncpy(event.name, name, TIMELINE_MAX_NAME_LENGTH - 1);
+		event.name[TIMELINE_MAX_NAME_LENGTH - 1] = '\0';
+		event.timeUs = timeUs;
+		event.begin = begin;
+
+		writeIdx.store(idx + 1, std::memory_order_release);
+	}
+
+	void ProfilerCPU::TimelineBuffer::read(ProfilerVector<TimelineEvent>& output) const
+	{
+		const TimelineEvent* buffer = events.load(std::memory_order_acquire);
+		if(buffer == nullptr)
+			return;
+
+		UINT64 end = writeIdx.load(std::memory_order_acquire);
+		UINT64 begin = end > TIMELINE_CAPACITY ? end - TIMELINE_CAPACITY : 0;
+
+		size_t outputStart = output.size();
+		for(UINT64 i = begin; i < end; i++)
+			output.push_back(buffer[i & (TIMELINE_CAPACITY - 1)]);
+
+		// The owning thread may have overwritten the oldest events while they were being copied, discard those
+		UINT64 newEnd = writeIdx.load(std::memory_order_acquire);
+		UINT64 firstValid = newEnd > TIMELINE_CAPACITY ? newEnd - TIMELINE_CAPACITY : 0;
+		if(firstValid > begin)
+		{
+			UINT64 numInvalid = std::min(firstValid - begin, end - begin);
+			output.erase(output.begin() + outputStart, output.begin() + outputStart + (size_t)numInvalid);
+		}
+	}
+
 	BS_THREADLOCAL ProfilerCPU::ThreadInfo* ProfilerCPU::ThreadInfo::activeThread = nullptr;
 
 	ProfilerCPU::ThreadInfo::ThreadInfo()
@@ -235,10 +290,11 @@ namespace bs
 		frameAlloc.clear(); // Note: This never actually frees memory
 	}
 
-	ProfilerCPU::ProfiledBlock* ProfilerCPU::ThreadInfo::getBlock(const char* name)
+	ProfilerCPU::ProfiledBlock* ProfilerCPU::ThreadInfo::getBlock(const char* name, const StringID& id)
 	{
 		ProfiledBlock* block = frameAlloc.construct<ProfiledBlock>(&frameAlloc);
 		block->name = (char*)frameAlloc.alloc(((UINT32)strlen(name) + 1) * sizeof(char));
+		block->id = id;
 		strcpy(block->name, name);
 
 		return block;
@@ -264,11 +320,19 @@ namespace bs
 		children.clear();
 	}
 
-	ProfilerCPU::ProfiledBlock* ProfilerCPU::ProfiledBlock::findChild(const char* name) const
+	bool ProfilerCPU::ProfiledBlock::hasName(const char* name, const StringID& id) const
+	{
+		if(!id.empty() && !this->id.empty())
+			return this->id == id;
+
+		return strcmp(this->name, name) == 0;
+	}
+
+	ProfilerCPU::ProfiledBlock* ProfilerCPU::ProfiledBlock::findChild(const char* name, const StringID& id) const
 	{
 		for(auto& child : children)
 		{
-			if(strcmp(child->name, name) == 0)
+			if(child->hasName(name, id))
 				return child;
 		}
 
@@ -277,7 +341,7 @@ namespace bs
 
 	ProfilerCPU::ProfilerCPU()
 		: mBasicTimerOverhead(0.0), mPreciseTimerOverhead(0), mBasicSamplingOverheadMs(0.0), mPreciseSamplingOverheadMs(0.0)
-		, mBasicSamplingOverheadCycles(0), mPreciseSamplingOverheadCycles(0)
+		, mBasicSamplingOverheadCycles(0), mPreciseSamplingOverheadCycles(0), mTimelineStart(steady_clock::now())
 	{
 		// TODO - We only estimate overhead on program start. It might be better to estimate it each time beginThread is called,
 		// and keep separate values per thread.
@@ -309,6 +373,18 @@ namespace bs
 			}
 		}
 
+		if(isTimelineEnabled())
+		{
+			// Name is read when exporting the timeline, from other threads
+			if(thread->name != name)
+			{
+				Lock lock(mThreadSync);
+				thread->name = name;
+			}
+
+			thread->timeline.record(name, getTimelineTime(), true);
+		}
+
 		thread->begin(name);
 	}
 
@@ -316,93 +392,73 @@ namespace bs
 	{
 		// I don't do a nullcheck where on purpose, so endSample can be called ASAP
 		ThreadInfo::activeThread->end();
+
+		if(isTimelineEnabled())
+			ThreadInfo::activeThread->timeline.record(ThreadInfo::activeThread->name.c_str(), getTimelineTime(), false);
 	}
 
 	void ProfilerCPU::beginSample(const char* name)
 	{
-		ThreadInfo* thread = ThreadInfo::activeThread;
-		if(thread == nullptr || !thread->isActive)
-		{
-			beginThread("Unknown");
-			thread = ThreadInfo::activeThread;
-		}
-
-		ProfiledBlock* parent = thread->activeBlock.block;
-		ProfiledBlock* block = nullptr;
-		
-		if(parent != nullptr)
-			block = parent->findChild(name);
-
-		if(block == nullptr)
-		{
-			block = thread->getBlock(name);
-
-			if(parent != nullptr)
-				parent->children.push_back(block);
-			else
-				thread->rootBlock->children.push_back(block);
-		}
-
-		thread->activeBlock = ActiveBlock(ActiveSamplingType::Basic, block);
-		thread->activeBlocks->push(thread->activeBlock);
+		beginSampleInternal(name, StringID::NONE, ActiveSamplingType::Basic);
+	}
 
-		block->basic.beginSample();
+	void ProfilerCPU::beginSample(const StringID& name)
+	{
+		beginSampleInternal(name.cstr(), name, ActiveSamplingType::Basic);
 	}
 
 	void ProfilerCPU::endSample(const char* name)
 	{
-		ThreadInfo* thread = ThreadInfo::activeThread;
-		ProfiledBlock* block = thread->activeBlock.block;
-
-#if BS_DEBUG_MODE
-		if(block == nullptr)
-		{
-			LOGWRN("Mismatched CPUProfiler::endSample. No beginSample was called.");
-			return;
-		}
+		endSampleInternal(name, StringID::NONE, ActiveSamplingType::Basic);
+	}
 
-		if(thread->activeBlock.type == ActiveSamplingType::Precise)
-		{
-			LOGWRN("Mismatched CPUProfiler::endSample. Was expecting Profiler::endSamplePrecise.");
-			return;
-		}
+	void ProfilerCPU::endSample(const StringID& name)
+	{
+		endSampleInternal(name.cstr(), name, ActiveSamplingType::Basic);
+	}
 
-		if(strcmp(block->name, name) != 0)
-		{
-			LOGWRN("Mismatched CPUProfiler::endSample. Was expecting \"" + String(block->name) + 
-				"\" but got \"" + String(name) + "\". Sampling data will not be valid.");
-			return;
-		}
-#endif
+	void ProfilerCPU::beginSamplePrecise(const char* name)
+	{
+		beginSampleInternal(name, StringID::NONE, ActiveSamplingType::Precise);
+	}
 
-		block->basic.endSample();
+	void ProfilerCPU::beginSamplePrecise(const StringID& name)
+	{
+		beginSampleInternal(name.cstr(), name, ActiveSamplingType::Precise);
+	}
 
-		thread->activeBlocks->pop();
+	void ProfilerCPU::endSamplePrecise(const char* name)
+	{
+		endSampleInternal(name, StringID::NONE, ActiveSamplingType::Precise);
+	}
 
-		if (!thread->activeBlocks->empty())
-			thread->activeBlock = thread->activeBlocks->top();
-		else
-			thread->activeBlock = ActiveBlock();
+	void ProfilerCPU::endSamplePrecise(const StringID& name)
+	{
+		endSampleInternal(name.cstr(), name, ActiveSamplingType::Precise);
 	}
 
-	void ProfilerCPU::beginSamplePrecise(const char* name)
+	void ProfilerCPU::beginSampleInternal(const char* name, const StringID& id, ActiveSamplingType type)
 	{
-		// Note: There is a (small) possibility a context switch will happen during this measurement in which case result will be skewed. 
-		// Increasing thread priority might help. This is generally only a problem with code that executes a long time (10-15+ ms - depending on OS quant length)
-		
+		// Note: For precise samples there is a (small) possibility a context switch will happen during this measurement
+		// in which case result will be skewed. Increasing thread priority might help. This is generally only a problem
+		// with code that executes a long time (10-15+ ms - depending on OS quant length)
+
 		ThreadInfo* thread = ThreadInfo::activeThread;
 		if(thread == nullptr || !thread->isActive)
+		{
 			beginThread("Unknown");
+			thread = ThreadInfo::activeThread;
+		}
 
 		ProfiledBlock* parent = thread->activeBlock.block;
 		ProfiledBlock* block = nullptr;
 		
 		if(parent != nullptr)
-			block = parent->findChild(name);
+			block = parent->findChild(name, id);
 
 		if(block == nullptr)
 		{
-			block = thread->getBlock(name);
+			block = thread->getBlock(name, id);
 
 			if(parent != nullptr)
 				parent->children.push_back(block);
@@ -410,39 +466,56 @@ namespace bs
 				thread->rootBlock->children.push_back(block);
 		}
 
-		thread->activeBlock = ActiveBlock(ActiveSamplingType::Precise, block);
+		thread->activeBlock = ActiveBlock(type, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
-		block->precise.beginSample();
+		if(isTimelineEnabled())
+			thread->timeline.record(name, getTimelineTime(), true);
+
+		if(type == ActiveSamplingType::Basic)
+			block->basic.beginSample();
+		else
+			block->precise.beginSample();
 	}
 
-	void ProfilerCPU::endSamplePrecise(const char* name)
+	void ProfilerCPU::endSampleInternal(const char* name, const StringID& id, ActiveSamplingType type)
 	{
 		ThreadInfo* thread = ThreadInfo::activeThread;
 		ProfiledBlock* block = thread->activeBlock.block;
 
 #if BS_DEBUG_MODE
+		const bool precise = type == ActiveSamplingType::Precise;
+		const String endMethod = precise ? "ProfilerCPU::endSamplePrecise" : "ProfilerCPU::endSample";
+
 		if(block == nullptr)
 		{
-			LOGWRN("Mismatched Profiler::endSamplePrecise. No beginSamplePrecise was called.");
+			LOGWRN("Mismatched " + endMethod + ". No " + (precise ? "beginSamplePrecise" : "beginSample") +
+				" was called.");
 			return;
 		}
 
-		if(thread->activeBlock.type == ActiveSamplingType::Basic)
+		if(thread->activeBlock.type != type)
 		{
-			LOGWRN("Mismatched CPUProfiler::endSamplePrecise. Was expecting Profiler::endSample.");
+			LOGWRN("Mismatched " + endMethod + ". Was expecting " +
+				(precise ? "ProfilerCPU::endSample." : "ProfilerCPU::endSamplePrecise."));
 			return;
 		}
 
-		if (strcmp(block->name, name) != 0)
+		if(!block->hasName(name, id))
 		{
-			LOGWRN("Mismatched Profiler::endSamplePrecise. Was expecting \"" + String(block->name) + 
+			LOGWRN("Mismatched " + endMethod + ". Was expecting \"" + String(block->name) +
 				"\" but got \"" + String(name) + "\". Sampling data will not be valid.");
 			return;
 		}
 #endif
 
-		block->precise.endSample();
+		if(type == ActiveSamplingType::Basic)
+			block->basic.endSample();
+		else
+			block->precise.endSample();
+
+		if(isTimelineEnabled())
+			thread->timeline.record(name, getTimelineTime(), false);
 
 		thread->activeBlocks->pop();
 
@@ -760,6 +833,121 @@ namespace bs
 		return report;
 	}
 
+	UINT64 ProfilerCPU::getTimelineTime() const
+	{
+		return (UINT64)duration_cast<microseconds>(steady_clock::now() - mTimelineStart).count();
+	}
+
+	void ProfilerCPU::_addGPUTimelineSample(const GPUProfileSample& sample, UINT64 startUs)
+	{
+		if(!isTimelineEnabled())
+			return;
+
+		Lock lock(mGPUTimelineSync);
+
+		GPUTimelineSample timelineSample = { sample.name.c_str(), startUs, (UINT64)(sample.timeMs * 1000.0f),
+			sample.numDrawCalls, sample.numVertices, sample.numPrimitives, sample.numDrawnSamples };
+
+		if(mGPUTimeline.size() < TIMELINE_CAPACITY)
+			mGPUTimeline.push_back(timelineSample);
+		else
+		{
+			mGPUTimeline[mGPUTimelineStart] = timelineSample;
+			mGPUTimelineStart = (mGPUTimelineStart + 1) % TIMELINE_CAPACITY;
+		}
+	}
+
+	void ProfilerCPU::exportTimeline(const Path& path, UINT64 startTime) const
+	{
+		nlohmann::json traceEvents = nlohmann::json::array();
+
+		{
+			Lock lock(mThreadSync);
+
+			ProfilerVector<TimelineEvent> events;
+			for(UINT32 i = 0; i < (UINT32)mActiveThreads.size(); i++)
+			{
+				const ThreadInfo* thread = mActiveThreads[i];
+
+				events.clear();
+				thread->timeline.read(events);
+
+				if(events.empty())
+					continue;
+
+				traceEvents.push_back({
+					{ "name", "thread_name" }, { "ph", "M" }, { "pid", 0 }, { "tid", i },
+					{ "args", { { "name", thread->name.c_str() } } }
+				});
+
+				// Oldest events might have been overwritten or filtered out, leaving end events whose begin event is
+				// missing
+				UINT32 depth = 0;
+				for(auto& event : events)
+				{
+					if(event.timeUs < startTime)
+						continue;
+
+					if(event.begin)
+						depth++;
+					else if(depth > 0)
+						depth--;
+					else
+						continue;
+
+					traceEvents.push_back({
+						{ "name", (const char*)event.name }, { "ph", event.begin ? "B" : "E" }, { "ts", event.timeUs },
+						{ "pid", 0 }, { "tid", i }
+					});
+				}
+			}
+		}
+
+		{
+			Lock lock(mGPUTimelineSync);
+
+			if(!mGPUTimeline.empty())
+			{
+				// GPU samples are displayed on a separate track, following all the thread tracks
+				UINT32 gpuTrackId = (UINT32)mActiveThreads.size();
+
+				traceEvents.push_back({
+					{ "name", "thread_name" }, { "ph", "M" }, { "pid", 0 }, { "tid", gpuTrackId },
+					{ "args", { { "name", "GPU" } } }
+				});
+
+				for(auto& sample : mGPUTimeline)
+				{
+					if(sample.startUs < startTime)
+						continue;
+
+					nlohmann::json args = {
+						{ "drawCalls", sample.numDrawCalls }, { "vertices", sample.numVertices },
+						{ "primitives", sample.numPrimitives }, { "drawnSamples", sample.numDrawnSamples }
+					};
+
+					traceEvents.push_back({
+						{ "name", sample.name.c_str() }, { "ph", "X" }, { "ts", sample.startUs },
+						{ "dur", sample.durationUs }, { "pid", 0 }, { "tid", gpuTrackId }, { "args", args }
+					});
+				}
+			}
+		}
+
+		nlohmann::json trace = { { "traceEvents", traceEvents }, { "displayTimeUnit", "ms" } };
+		std::string traceString = trace.dump();
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if(stream == nullptr)
+		{
+			LOGERR("Failed to export the profiler timeline to: " + path.toString());
+			return;
+		}
+
+		stream->write(traceString.data(), traceString.size());
+		stream->close();
+	}
+
 	void ProfilerCPU::estimateTimerOverhead()
 	{
 		// Get an idea of how long timer calls and RDTSC takes
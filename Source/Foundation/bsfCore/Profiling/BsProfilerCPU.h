@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
+#include "String/BsStringID.h"
 
 namespace bs
 {
@@ -12,6 +13,7 @@ namespace bs
 	 */
 
 	class CPUProfilerReport;
+	struct GPUProfileSample;
 
 	/**
 	 * Provides various performance measuring methods.
@@ -20,6 +22,12 @@ namespace bs
 	 */
 	class BS_CORE_EXPORT ProfilerCPU : public Module<ProfilerCPU>
 	{
+		/** Maximum number of events each thread keeps on its timeline. Must be a power of two. */
+		static constexpr UINT32 TIMELINE_CAPACITY = 16384;
+
+		/** Maximum length of a sample name stored on the timeline. Longer names are truncated. */
+		static constexpr UINT32 TIMELINE_MAX_NAME_LENGTH = 48;
+
 		/**	Timer class responsible for tracking elapsed time. */
 		class Timer
 		{
@@ -166,10 +174,17 @@ namespace bs
 			ProfiledBlock(FrameAlloc* alloc);
 			~ProfiledBlock();
 
+			/**
+			 * Checks if the block has the specified name. If both the block and @p id have an interned name, only the
+			 * identifiers are compared.
+			 */
+			bool hasName(const char* name, const StringID& id) const;
+
 			/**	Attempts to find a child block with the specified name. Returns null if not found. */
-			ProfiledBlock* findChild(const char* name) const;
+			ProfiledBlock* findChild(const char* name, const StringID& id) const;
 
 			char* name;
+			StringID id; /**< Interned name of the block, if the block was created from a StringID. */
 			
 			ProfileData basic;
 			PreciseProfileData precise;
@@ -199,6 +214,46 @@ namespace bs
 			ProfiledBlock* block;
 		};
 
+		/** A single sample begin or end event recorded on a thread's timeline. */
+		struct TimelineEvent
+		{
+			char name[TIMELINE_MAX_NAME_LENGTH];
+			UINT64 timeUs;
+			bool begin;
+		};
+
+		/**
+		 * Fixed size ring buffer of timeline events recorded by a single thread. Only the owning thread writes to the
+		 * buffer, while other threads may read it at the same time without locking. Once full the oldest events are
+		 * overwritten.
+		 */
+		struct TimelineBuffer
+		{
+			TimelineBuffer() = default;
+			~TimelineBuffer();
+
+			/** Appends a new event to the buffer. Must only be called by the thread owning the buffer. */
+			void record(const char* name, UINT64 timeUs, bool begin);
+
+			/** Appends all events currently in the buffer to @p output, from oldest to newest. Thread safe. */
+			void read(ProfilerVector<TimelineEvent>& output) const;
+
+			std::atomic<TimelineEvent*> events{nullptr};
+			std::atomic<UINT64> writeIdx{0};
+		};
+
+		/** GPU sample placed on the timeline. */
+		struct GPUTimelineSample
+		{
+			ProfilerString name;
+			UINT64 startUs;
+			UINT64 durationUs;
+			UINT32 numDrawCalls;
+			UINT32 numVertices;
+			UINT32 numPrimitives;
+			UINT32 numDrawnSamples;
+		};
+
 		/** Contains data about an active profiling thread. */
 		struct ThreadInfo
 		{
@@ -221,8 +276,8 @@ namespace bs
 			 */
 			void reset();
 
-			/**	Gets the primary profiling block used by the thread. */
-			ProfiledBlock* getBlock(const char* name);
+			/**	Creates a new profiling block with the specified name and optional interned name. */
+			ProfiledBlock* getBlock(const char* name, const StringID& id = StringID::NONE);
 			
 			/** Deletes the provided block. */
 			void releaseBlock(ProfiledBlock* block);
@@ -235,6 +290,9 @@ namespace bs
 			FrameAlloc frameAlloc;
 			ActiveBlock activeBlock;
 			Stack<ActiveBlock, StdFrameAlloc<ActiveBlock>>* activeBlocks;
+
+			ProfilerString name;
+			TimelineBuffer timeline;
 		};
 
 	public:
@@ -270,6 +328,18 @@ namespace bs
 		 */
 		void endSample(const char* name);
 
+		/**
+		 * @copydoc beginSample(const char*)
+		 *
+		 * @note
+		 * Interned names are compared by identifier, making the sample lookup faster than for raw strings. Prefer this
+		 * overload for samples taken every frame, with the name stored in a static variable or created using BS_SID.
+		 */
+		void beginSample(const StringID& name);
+
+		/** @copydoc endSample(const char*) */
+		void endSample(const StringID& name);
+
 		/**
 		 * Begins precise sample measurement. Must be followed by endSamplePrecise(). 
 		 *
@@ -293,6 +363,12 @@ namespace bs
 		 */
 		void endSamplePrecise(const char* name);
 
+		/** @copydoc beginSamplePrecise(const char*) */
+		void beginSamplePrecise(const StringID& name);
+
+		/** @copydoc endSamplePrecise(const char*) */
+		void endSamplePrecise(const StringID& name);
+
 		/** Clears all sampling data, and ends any unfinished sampling blocks. */
 		void reset();
 
@@ -304,7 +380,47 @@ namespace bs
 		 */
 		CPUProfilerReport generateReport();
 
+		/**
+		 * Enables or disables timeline capture. When enabled the start and end time of every sample is recorded, per
+		 * thread, allowing the timeline to be exported using exportTimeline(). Each thread keeps only its most recent
+		 * events, older events being overwritten. Disabled by default.
+		 */
+		void setTimelineEnabled(bool enabled) { mTimelineEnabled.store(enabled, std::memory_order_relaxed); }
+
+		/** Checks is timeline capture enabled. See setTimelineEnabled(). */
+		bool isTimelineEnabled() const { return mTimelineEnabled.load(std::memory_order_relaxed); }
+
+		/**
+		 * Writes all events recorded on the timeline into a file in the Chrome trace event format. The file can be
+		 * viewed in chrome://tracing or Perfetto, or converted for Tracy using its Chrome trace importer.
+		 *
+		 * @param[in]	path		Path to the file to write the timeline to.
+		 * @param[in]	startTime	Events recorded before this time, as returned by getTimelineTime(), are not exported.
+		 */
+		void exportTimeline(const Path& path, UINT64 startTime = 0) const;
+
+		/** Returns the current time on the clock used by the timeline, in microseconds. Thread safe. */
+		UINT64 getTimelineTime() const;
+
+		/**
+		 * Adds a GPU sample to the timeline, displayed on its own track along with its draw statistics. The sample is
+		 * ignored if timeline capture is disabled.
+		 *
+		 * @param[in]	sample		Resolved GPU sample, providing the name, duration and statistics.
+		 * @param[in]	startUs		Time at which the sample started, as returned by getTimelineTime().
+		 */
+		void _addGPUTimelineSample(const GPUProfileSample& sample, UINT64 startUs);
+
 	private:
+		/**
+		 * Begins a sample of the specified type. If @p id is not empty it must be the interned version of @p name, and
+		 * it will be used for finding the existing sample block.
+		 */
+		void beginSampleInternal(const char* name, const StringID& id, ActiveSamplingType type);
+
+		/** Ends a sample started with beginSampleInternal(). */
+		void endSampleInternal(const char* name, const StringID& id, ActiveSamplingType type);
+
 		/**
 		 * Calculates overhead that the timing and sampling methods themselves introduce so we might get more accurate 
 		 * measurements when creating reports.
@@ -321,7 +437,13 @@ namespace bs
 		UINT64 mPreciseSamplingOverheadCycles;
 
 		ProfilerVector<ThreadInfo*> mActiveThreads;
-		Mutex mThreadSync;
+		mutable Mutex mThreadSync;
+
+		std::atomic<bool> mTimelineEnabled{false};
+		std::chrono::steady_clock::time_point mTimelineStart;
+		ProfilerVector<GPUTimelineSample> mGPUTimeline;
+		UINT32 mGPUTimelineStart = 0;
+		mutable Mutex mGPUTimelineSync;
 	};
 
 	/** Profiling entry containing information about a single CPU profiling block containing timing information. */
@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Profiling/BsProfilerGPU.h"
 #include "Profiling/BsRenderStats.h"
+#include "Profiling/BsProfilerCPU.h"
 #include "RenderAPI/BsTimerQuery.h"
 #include "RenderAPI/BsOcclusionQuery.h"
 #include "Error/BsException.h"
@@ -116,6 +117,8 @@ namespace bs
 				GPUProfilerReport report = resolveFrame(frame);
 				mUnresolvedFrames.pop();
 
+				mLastFrameTime.store(report.frameSample.timeMs, std::memory_order_relaxed);
+
 				{
 					Lock lock(mMutex);
 					mReadyReports[(mReportHeadPos + mReportCount) % MAX_QUEUE_ELEMENTS] = report;
@@ -166,6 +169,7 @@ namespace bs
 		reportSample.numGpuParamBinds = (UINT32)(sample.endStats.numGpuParamBinds - sample.startStats.numGpuParamBinds);
 		reportSample.numVertexBufferBinds = (UINT32)(sample.endStats.numVertexBufferBinds - sample.startStats.numVertexBufferBinds);
 		reportSample.numIndexBufferBinds = (UINT32)(sample.endStats.numIndexBufferBinds - sample.startStats.numIndexBufferBinds);
+		reportSample.numRedundantBindsSkipped = (UINT32)(sample.endStats.numRedundantBindsSkipped - sample.startStats.numRedundantBindsSkipped);
 
 		reportSample.numResourceWrites = (UINT32)(sample.endStats.numResourceWrites - sample.startStats.numResourceWrites);
 		reportSample.numResourceReads = (UINT32)(sample.endStats.numResourceReads - sample.startStats.numResourceReads);
@@ -173,6 +177,10 @@ namespace bs
 		reportSample.numObjectsCreated = (UINT32)(sample.endStats.numObjectsCreated - sample.startStats.numObjectsCreated);
 		reportSample.numObjectsDestroyed = (UINT32)(sample.endStats.numObjectsDestroyed - sample.startStats.numObjectsDestroyed);
 
+		// GPU timestamps aren't available, so the sample is placed on the timeline at the time it was issued
+		if(ProfilerCPU::isStarted())
+			gProfilerCPU()._addGPUTimelineSample(reportSample, sample.startTime);
+
 		mFreeTimerQueries.push(sample.activeTimeQuery);
 		mFreeOcclusionQueries.push(sample.activeOcclusionQuery);
 	}
@@ -180,6 +188,9 @@ namespace bs
 	void ProfilerGPU::beginSampleInternal(ActiveSample& sample)
 	{
 		sample.startStats = RenderStats::instance().getData();
+
+		if(ProfilerCPU::isStarted())
+			sample.startTime = gProfilerCPU().getTimelineTime();
 		sample.activeTimeQuery = getTimerQuery();
 		sample.activeTimeQuery->begin();
 
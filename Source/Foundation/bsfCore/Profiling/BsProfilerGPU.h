@@ -32,6 +32,7 @@ namespace bs
 		UINT32 numGpuParamBinds; /**< How many times were GPU parameters bound. */
 		UINT32 numVertexBufferBinds; /**< How many times was a vertex buffer bound. */
 		UINT32 numIndexBufferBinds; /**< How many times was an index buffer bound. */
+		UINT32 numRedundantBindsSkipped; /**< How many binds were skipped because the object was already bound. */
 
 		UINT32 numResourceWrites; /**< How many times were GPU resources written to. */
 		UINT32 numResourceReads; /**< How many times were GPU resources read from. */
@@ -62,6 +63,7 @@ namespace bs
 			RenderStatsData endStats;
 			SPtr<ct::TimerQuery> activeTimeQuery;
 			SPtr<ct::OcclusionQuery> activeOcclusionQuery;
+			UINT64 startTime = 0;
 		};
 
 		struct ActiveFrame
@@ -126,6 +128,14 @@ namespace bs
 		 */
 		GPUProfilerReport getNextReport();
 
+		/**
+		 * Returns the GPU time of the most recently resolved frame, in milliseconds. Unlike getNextReport() this doesn't
+		 * consume any reports. Returns 0 if no frame has been resolved yet.
+		 *
+		 * @note	Thread safe.
+		 */
+		float getLastFrameTime() const { return mLastFrameTime.load(std::memory_order_relaxed); }
+
 	public: 
 		// ***** INTERNAL ******
 		/** @name Internal
@@ -172,6 +182,7 @@ namespace bs
 		static const UINT32 MAX_QUEUE_ELEMENTS;
 		UINT32 mReportHeadPos;
 		UINT32 mReportCount;
+		std::atomic<float> mLastFrameTime { 0.0f };
 
 		mutable Stack<SPtr<ct::TimerQuery>> mFreeTimerQueries;
 		mutable Stack<SPtr<ct::OcclusionQuery>> mFreeOcclusionQueries;
@@ -28,6 +28,9 @@ namespace bs
 	{
 #if BS_PROFILING_ENABLED
 		mSavedSimReports[mNextSimReportIdx].cpuReport = gProfilerCPU().generateReport();
+		mSavedSimReports[mNextSimReportIdx].memoryReport = MemAllocProfiler::generateReport();
+		mSavedSimReports[mNextSimReportIdx].gpuMemoryReport = GpuMemoryProfiler::generateReport();
+		mSavedSimReports[mNextSimReportIdx].lockReport = LockProfiler::generateReport();
 
 		gProfilerCPU().reset();
 
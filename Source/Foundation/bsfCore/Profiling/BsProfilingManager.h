@@ -5,6 +5,8 @@
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
 #include "Profiling/BsProfilerCPU.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
+#include "Threading/BsLockProfiler.h"
 
 namespace bs
 {
@@ -16,6 +18,9 @@ namespace bs
 	struct ProfilerReport
 	{
 		CPUProfilerReport cpuReport;
+		MemoryProfilerReport memoryReport; /**< Only populated for the sim thread, as memory categories are global. */
+		GpuMemoryReport gpuMemoryReport; /**< Only populated for the sim thread, as GPU memory categories are global. */
+		LockProfilerReport lockReport; /**< Only populated for the sim thread, as lock statistics are global. */
 	};
 
 	/**	Type of thread used by the profiler. */
@@ -26,7 +31,8 @@ namespace bs
 	};
 
 	/**
-	 * Tracks CPU profiling information with each frame for sim and core threads.
+	 * Tracks CPU profiling information with each frame for sim and core threads, as well as per-frame memory usage of
+	 * all memory categories.
 	 *
 	 * @note	Sim thread only unless specified otherwise.
 	 */
@@ -0,0 +1,47 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Profiling/BsRenderStats.h"
+
+namespace bs
+{
+	// Threadlocal data can't be exported, so it is only accessed through non-inline methods
+	static BS_THREADLOCAL RenderStatsData* sThreadData = nullptr;
+
+	RenderStatsData& RenderStatsData::operator+=(const RenderStatsData& other)
+	{
+		numDrawCalls += other.numDrawCalls;
+		numComputeCalls += other.numComputeCalls;
+		numRenderTargetChanges += other.numRenderTargetChanges;
+		numPresents += other.numPresents;
+		numClears += other.numClears;
+		numVertices += other.numVertices;
+		numPrimitives += other.numPrimitives;
+		numPipelineStateChanges += other.numPipelineStateChanges;
+		numGpuParamBinds += other.numGpuParamBinds;
+		numVertexBufferBinds += other.numVertexBufferBinds;
+		numIndexBufferBinds += other.numIndexBufferBinds;
+		numPipelineBarriers += other.numPipelineBarriers;
+		numRedundantBindsSkipped += other.numRedundantBindsSkipped;
+		numResourceWrites += other.numResourceWrites;
+		numResourceReads += other.numResourceReads;
+		numObjectsCreated += other.numObjectsCreated;
+		numObjectsDestroyed += other.numObjectsDestroyed;
+
+		return *this;
+	}
+
+	void RenderStats::setThreadData(RenderStatsData* data)
+	{
+		if (data != nullptr && sThreadData == nullptr)
+			mNumRedirectedThreads.fetch_add(1, std::memory_order_relaxed);
+		else if (data == nullptr && sThreadData != nullptr)
+			mNumRedirectedThreads.fetch_sub(1, std::memory_order_relaxed);
+
+		sThreadData = data;
+	}
+
+	RenderStatsData& RenderStats::getThreadTarget()
+	{
+		return sThreadData != nullptr ? *sThreadData : mData;
+	}
+}
@@ -29,9 +29,13 @@ namespace bs
 		RenderStatsData()
 		: numDrawCalls(0), numComputeCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0)
 		, numVertices(0), numPrimitives(0), numPipelineStateChanges(0), numGpuParamBinds(0), numVertexBufferBinds(0)
-		, numIndexBufferBinds(0)
+		, numIndexBufferBinds(0), numPipelineBarriers(0), numRedundantBindsSkipped(0), numResourceWrites(0)
+		, numResourceReads(0), numObjectsCreated(0), numObjectsDestroyed(0)
 		{ }
 
+		/** Adds the statistics from @p other to this object. */
+		RenderStatsData& operator+=(const RenderStatsData& other);
+
 		UINT64 numDrawCalls;
 		UINT64 numComputeCalls;
 		UINT64 numRenderTargetChanges;
@@ -47,6 +51,9 @@ namespace bs
 		UINT64 numVertexBufferBinds; 
 		UINT64 numIndexBufferBinds;
 
+		UINT64 numPipelineBarriers;
+		UINT64 numRedundantBindsSkipped;
+
 		UINT64 numResourceWrites;
 		UINT64 numResourceReads;
 
@@ -57,46 +64,58 @@ namespace bs
 	/**
 	 * Tracks various render system statistics.
 	 *
-	 * @note	Core thread only.
+	 * @note	Core thread only, unless the calling thread's statistics are redirected through setThreadData().
 	 */
 	class BS_CORE_EXPORT RenderStats : public Module<RenderStats>
 	{
 	public:
 		/** Increments draw call counter indicating how many times were render system API Draw methods called. */
-		void incNumDrawCalls() { mData.numDrawCalls++; }
+		void incNumDrawCalls() { getTarget().numDrawCalls++; }
 
 		/** Increments compute call counter indicating how many times were compute shaders dispatched. */
-		void incNumComputeCalls() { mData.numComputeCalls++; }
+		void incNumComputeCalls() { getTarget().numComputeCalls++; }
 
 		/** Increments render target change counter indicating how many times did the active render target change. */
-		void incNumRenderTargetChanges() { mData.numRenderTargetChanges++; }
+		void incNumRenderTargetChanges() { getTarget().numRenderTargetChanges++; }
 
 		/** Increments render target present counter indicating how many times did the buffer swap happen. */
-		void incNumPresents() { mData.numPresents++; }
+		void incNumPresents() { getTarget().numPresents++; }
 
 		/** 
 		 * Increments render target clear counter indicating how many times did the target the cleared, entirely or 
 		 * partially. 
 		 */
-		void incNumClears() { mData.numClears++; }
+		void incNumClears() { getTarget().numClears++; }
 
 		/** Increments vertex draw counter indicating how many vertices were sent to the pipeline. */
-		void addNumVertices(UINT32 count) { mData.numVertices += count; }
+		void addNumVertices(UINT32 count) { getTarget().numVertices += count; }
 
 		/** Increments primitive draw counter indicating how many primitives were sent to the pipeline. */
-		void addNumPrimitives(UINT32 count) { mData.numPrimitives += count; }
+		void addNumPrimitives(UINT32 count) { getTarget().numPrimitives += count; }
 
 		/** Increments pipeline state change counter indicating how many times was a pipeline state bound. */
-		void incNumPipelineStateChanges() { mData.numPipelineStateChanges++; }
+		void incNumPipelineStateChanges() { getTarget().numPipelineStateChanges++; }
 
 		/** Increments GPU parameter change counter indicating how many times were GPU parameters bound to the pipeline. */
-		void incNumGpuParamBinds() { mData.numGpuParamBinds++; }
+		void incNumGpuParamBinds() { getTarget().numGpuParamBinds++; }
 
 		/** Increments vertex buffer change counter indicating how many times was a vertex buffer bound to the pipeline. */
-		void incNumVertexBufferBinds() { mData.numVertexBufferBinds++; }
+		void incNumVertexBufferBinds() { getTarget().numVertexBufferBinds++; }
 
 		/** Increments index buffer change counter indicating how many times was a index buffer bound to the pipeline. */
-		void incNumIndexBufferBinds() { mData.numIndexBufferBinds++; }
+		void incNumIndexBufferBinds() { getTarget().numIndexBufferBinds++; }
+
+		/** 
+		 * Increments pipeline barrier counter indicating how many pipeline barriers (each potentially containing multiple
+		 * memory barriers and layout transitions) were issued by the render API.
+		 */
+		void addNumPipelineBarriers(UINT32 count) { getTarget().numPipelineBarriers += count; }
+
+		/**
+		 * Increments skipped bind counter indicating how many render API binding calls were avoided, either because the
+		 * object was already bound or because multiple bindings were merged into a single call.
+		 */
+		void addNumRedundantBindsSkipped(UINT32 count) { getTarget().numRedundantBindsSkipped += count; }
 
 		/**
 		 * Increments created GPU resource counter. 
@@ -113,7 +132,7 @@ namespace bs
 			// TODO - I should also track number of active GPU objects using this method, instead
 			// of just keeping track of how many were created and destroyed during the frame.
 
-			mData.numObjectsCreated++;
+			getTarget().numObjectsCreated++;
 		}
 
 		/**
@@ -121,21 +140,21 @@ namespace bs
 		 *
 		 * @param[in]	category	Category of the resource.
 		 */
-		void incResDestroyed(UINT32 category) { mData.numObjectsDestroyed++; }
+		void incResDestroyed(UINT32 category) { getTarget().numObjectsDestroyed++; }
 
 		/**
 		 * Increments GPU resource read counter. 
 		 *
 		 * @param[in]	category	Category of the resource.
 		 */
-		void incResRead(UINT32 category) { mData.numResourceReads++; }
+		void incResRead(UINT32 category) { getTarget().numResourceReads++; }
 
 		/**
 		 * Increments GPU resource write counter. 
 		 *
 		 * @param[in]	category	Category of the resource.
 		 */
-		void incResWrite(UINT32 category) { mData.numResourceWrites++; }
+		void incResWrite(UINT32 category) { getTarget().numResourceWrites++; }
 
 		/**
 		 * Returns an object containing various rendering statistics.
@@ -145,11 +164,31 @@ namespace bs
 		 */
 		RenderStatsData& getData() { return mData; }
 
+		/**
+		 * Redirects all statistics reported by the calling thread into @p data, until called again with null. Allows
+		 * worker threads to issue render API calls, as the statistics themselves are not thread safe. Once the
+		 * workers are done the redirected statistics should be added back on the core thread through merge().
+		 */
+		void setThreadData(RenderStatsData* data);
+
+		/** Adds statistics previously collected through setThreadData() to the global statistics. Core thread only. */
+		void merge(const RenderStatsData& data) { mData += data; }
+
 	private:
+		/** Returns the statistics the calling thread should report to. */
+		RenderStatsData& getTarget()
+		{
+			return mNumRedirectedThreads.load(std::memory_order_relaxed) > 0 ? getThreadTarget() : mData;
+		}
+
+		/** Slow path of getTarget(), used while any thread's statistics are redirected. */
+		RenderStatsData& getThreadTarget();
+
 		RenderStatsData mData;
+		std::atomic<UINT32> mNumRedirectedThreads{0};
 	};
 
-#if BS_PROFILING_ENABLED
+#if BS_PROFILING_ENABLED || BS_TELEMETRY_ENABLED
 	#define BS_INC_RENDER_STAT_CAT(Stat, Category) RenderStats::instance().inc##Stat((UINT32)Category)
 	#define BS_INC_RENDER_STAT(Stat) RenderStats::instance().inc##Stat()
 	#define BS_ADD_RENDER_STAT(Stat, Count) RenderStats::instance().add##Stat(Count)
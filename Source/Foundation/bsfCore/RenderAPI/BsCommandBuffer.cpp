@@ -2,6 +2,10 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "RenderAPI/BsCommandBuffer.h"
 #include "Managers/BsCommandBufferManager.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "RenderAPI/BsGpuParamDesc.h"
+#include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
 {
@@ -64,6 +68,126 @@ namespace bs { namespace ct
 		return globalQueueIdx;
 	}
 
+	bool BoundStateTracker::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState)
+	{
+		if (mGraphicsPipeline == pipelineState && pipelineState != nullptr)
+		{
+			BS_ADD_RENDER_STAT(NumRedundantBindsSkipped, 1);
+			return false;
+		}
+
+		mGraphicsPipeline = pipelineState;
+		mComputePipeline = nullptr;
+
+		// Some backends bind parameters to the active GPU programs, so they need to be bound again after a pipeline change
+		mGpuParams = nullptr;
+		return true;
+	}
+
+	bool BoundStateTracker::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState)
+	{
+		if (mComputePipeline == pipelineState && pipelineState != nullptr)
+		{
+			BS_ADD_RENDER_STAT(NumRedundantBindsSkipped, 1);
+			return false;
+		}
+
+		mComputePipeline = pipelineState;
+		mGraphicsPipeline = nullptr;
+		mGpuParams = nullptr;
+		return true;
+	}
+
+	bool BoundStateTracker::setGpuParams(const SPtr<GpuParams>& gpuParams)
+	{
+		if (mGpuParams == gpuParams && gpuParams != nullptr && mGpuParamsVersion == gpuParams->getVersion())
+		{
+			// Binding flushes modified parameter blocks, so it cannot be skipped if any of them are dirty
+			bool anyDirty = false;
+			for (UINT32 i = 0; i < GPT_COUNT && !anyDirty; i++)
+			{
+				SPtr<GpuParamDesc> paramDesc = gpuParams->getParamDesc((GpuProgramType)i);
+				if (paramDesc == nullptr)
+					continue;
+
+				for (auto& entry : paramDesc->paramBlocks)
+				{
+					SPtr<GpuParamBlockBuffer> buffer = gpuParams->getParamBlockBuffer(entry.second.set, entry.second.slot);
+					if (buffer != nullptr && buffer->isDirty())
+					{
+						anyDirty = true;
+						break;
+					}
+				}
+			}
+
+			if (!anyDirty)
+			{
+				BS_ADD_RENDER_STAT(NumRedundantBindsSkipped, 1);
+				return false;
+			}
+		}
+
+		mGpuParams = gpuParams;
+		mGpuParamsVersion = gpuParams != nullptr ? gpuParams->getVersion() : 0;
+		return true;
+	}
+
+	bool BoundStateTracker::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers)
+	{
+		if (index + numBuffers > BS_MAX_BOUND_VERTEX_BUFFERS)
+			return true;
+
+		bool allBound = numBuffers > 0;
+		for (UINT32 i = 0; i < numBuffers; i++)
+		{
+			if (mVertexBuffers[index + i] != buffers[i] || buffers[i] == nullptr)
+			{
+				allBound = false;
+				break;
+			}
+		}
+
+		if (allBound)
+		{
+			BS_ADD_RENDER_STAT(NumRedundantBindsSkipped, 1);
+			return false;
+		}
+
+		for (UINT32 i = 0; i < numBuffers; i++)
+			mVertexBuffers[index + i] = buffers[i];
+
+		return true;
+	}
+
+	bool BoundStateTracker::setIndexBuffer(const SPtr<IndexBuffer>& buffer)
+	{
+		if (mIndexBuffer == buffer && buffer != nullptr)
+		{
+			BS_ADD_RENDER_STAT(NumRedundantBindsSkipped, 1);
+			return false;
+		}
+
+		mIndexBuffer = buffer;
+		return true;
+	}
+
+	void BoundStateTracker::notifyRenderTargetChanged()
+	{
+		mGpuParams = nullptr;
+	}
+
+	void BoundStateTracker::reset()
+	{
+		mGraphicsPipeline = nullptr;
+		mComputePipeline = nullptr;
+		mGpuParams = nullptr;
+		mIndexBuffer = nullptr;
+
+		for (auto& entry : mVertexBuffers)
+			entry = nullptr;
+	}
+
 	CommandBuffer::CommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary)
 		:mType(type), mDeviceIdx(deviceIdx), mQueueIdx(queueIdx), mIsSecondary(secondary)
 	{
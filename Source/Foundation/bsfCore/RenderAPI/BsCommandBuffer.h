@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsCorePrerequisites.h"
+#include "RenderAPI/BsRenderAPICapabilities.h"
 
 namespace bs { namespace ct
 {
@@ -36,6 +37,51 @@ namespace bs { namespace ct
 		UINT32 mMask = 0;
 	};
 
+	/**
+	 * Keeps track of objects bound through the RenderAPI, in the order the bind calls are recorded, so binds of objects
+	 * that are already bound can be skipped. Each skipped bind is reported through the NumRedundantBindsSkipped render
+	 * stat. The render API backend must call reset() whenever the underlying state can no longer be assumed to match,
+	 * e.g. when the command buffer is submitted or when the backend binds its own objects internally.
+	 */
+	class BS_CORE_EXPORT BoundStateTracker
+	{
+	public:
+		/** Records the bind of a graphics pipeline. Returns false if the pipeline is already bound. */
+		bool setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState);
+
+		/** Records the bind of a compute pipeline. Returns false if the pipeline is already bound. */
+		bool setComputePipeline(const SPtr<ComputePipelineState>& pipelineState);
+
+		/** 
+		 * Records the bind of GPU parameters. Returns false if the same parameters are already bound, and none of the
+		 * objects they reference or their parameter block contents changed since.
+		 */
+		bool setGpuParams(const SPtr<GpuParams>& gpuParams);
+
+		/** Records the bind of a range of vertex buffers. Returns false if all the buffers are already bound. */
+		bool setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers);
+
+		/** Records the bind of an index buffer. Returns false if the buffer is already bound. */
+		bool setIndexBuffer(const SPtr<IndexBuffer>& buffer);
+
+		/** 
+		 * Notifies the tracker that the render target changed. Backends might need to unbind resources bound as shader
+		 * inputs, so GPU parameters are always bound again.
+		 */
+		void notifyRenderTargetChanged();
+
+		/** Forgets about all bound objects, making sure the next bind of each type is always executed. */
+		void reset();
+
+	private:
+		SPtr<GraphicsPipelineState> mGraphicsPipeline;
+		SPtr<ComputePipelineState> mComputePipeline;
+		SPtr<GpuParams> mGpuParams;
+		UINT32 mGpuParamsVersion = 0;
+		SPtr<VertexBuffer> mVertexBuffers[BS_MAX_BOUND_VERTEX_BUFFERS];
+		SPtr<IndexBuffer> mIndexBuffer;
+	};
+
 	/** 
 	 * Contains a list of render API commands that can be queued for execution on the GPU. User is allowed to populate the
 	 * command buffer from any thread, ensuring render API command generation can be multi-threaded. Command buffers
@@ -79,6 +125,14 @@ namespace bs { namespace ct
 		/** Returns the device index this buffer will execute on. */
 		UINT32 getDeviceIdx() const { return mDeviceIdx; }
 
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns the tracker of objects bound on this command buffer, used for skipping redundant binds. */
+		BoundStateTracker& _getBoundState() { return mBoundState; }
+
+		/** @} */
 	protected:
 		CommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary);
 
@@ -86,6 +140,7 @@ namespace bs { namespace ct
 		UINT32 mDeviceIdx;
 		UINT32 mQueueIdx;
 		bool mIsSecondary;
+		BoundStateTracker mBoundState;
 	};
 
 	/** @} */
@@ -4,6 +4,9 @@
 #include "Error/BsException.h"
 #include "RenderAPI/BsRenderAPI.h"
 #include "Managers/BsHardwareBufferManager.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
+#include "Managers/BsGpuReadbackManager.h"
+#include "CoreThread/BsCoreThread.h"
 
 namespace bs
 {
@@ -36,6 +39,18 @@ namespace bs
 		return std::static_pointer_cast<ct::GpuBuffer>(mCoreSpecific);
 	}
 
+	AsyncOp GpuBuffer::readDataAsync(UINT32 offset, UINT32 length, const SPtr<MemoryDataStream>& dest)
+	{
+		AsyncOp op = ct::GpuReadbackManager::instance().createAsyncOp();
+		SPtr<ct::GpuBuffer> core = getCore();
+		gCoreThread().queueCommand([core, offset, length, dest, op]()
+		{
+			ct::GpuReadbackManager::instance().readBuffer(core, offset, length, dest, op);
+		});
+
+		return op;
+	}
+
 	SPtr<ct::CoreObject> GpuBuffer::createCore() const
 	{
 		return ct::HardwareBufferManager::instance().createGpuBufferInternal(mProperties.mDesc);
@@ -107,6 +122,17 @@ namespace bs
 	{
 		// Make sure that derived classes call clearBufferViews
 		// I can't call it here since it needs a virtual method call
+
+		BS_GPU_MEMORY_FREE(this);
+	}
+
+	void GpuBuffer::initialize()
+	{
+		// Buffers sharing memory with a vertex buffer don't allocate any memory of their own
+		if (mSourceVertexBuffer == nullptr)
+			BS_GPU_MEMORY_ALLOC(GpuMemoryCategory::Buffer, this, mSize);
+
+		CoreObject::initialize();
 	}
 
 	SPtr<GpuBuffer> GpuBuffer::create(const GPU_BUFFER_DESC& desc, GpuDeviceFlags deviceMask)
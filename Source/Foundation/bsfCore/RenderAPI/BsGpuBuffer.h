@@ -110,6 +110,23 @@ namespace bs
 		/** Retrieves a core implementation of a GPU buffer usable only from the core thread. */
 		SPtr<ct::GpuBuffer> getCore() const;
 
+		/**
+		 * Reads a range of the buffer's contents as written by the GPU. The data is copied on the GPU and read a few
+		 * frames later once the copy is done, so neither the sim nor the core thread wait on the GPU. Useful for
+		 * reading back the results of compute programs.
+		 *
+		 * @param[in]	offset	Offset into the buffer to start reading from, in bytes.
+		 * @param[in]	length	Number of bytes to read.
+		 * @param[out]	dest	Stream of at least @p length bytes the data will be written to. Must not be accessed
+		 *						until the operation completes.
+		 * @return				Async operation object you can use to track operation completion.
+		 *
+		 * @note 
+		 * This is an @ref asyncMethod "asynchronous method". Poll AsyncOp::hasCompleted() instead of blocking on the
+		 * returned operation, since the operation only completes once further frames are rendered.
+		 */
+		AsyncOp readDataAsync(UINT32 offset, UINT32 length, const SPtr<MemoryDataStream>& dest);
+
 		/** Returns the size of a single element in the buffer, of the provided format, in bytes. */
 		static UINT32 getFormatSize(GpuBufferFormat format);
 
@@ -145,6 +162,9 @@ namespace bs
 	public:
 		virtual ~GpuBuffer();
 
+		/** @copydoc CoreObject::initialize */
+		void initialize() override;
+
 		/** Returns properties describing the buffer. */
 		const GpuBufferProperties& getProperties() const { return mProperties; }
 
@@ -155,6 +175,9 @@ namespace bs
 		GpuBuffer(const GPU_BUFFER_DESC& desc, UINT32 deviceMask);
 
 		GpuBufferProperties mProperties;
+
+		/** Vertex buffer whose memory this buffer shares, if any. See VertexBuffer::getLoadStore(). */
+		SPtr<VertexBuffer> mSourceVertexBuffer;
 	};
 
 	/** @} */
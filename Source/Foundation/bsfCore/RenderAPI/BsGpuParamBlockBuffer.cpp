@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "RenderAPI/BsGpuParamBlockBuffer.h"
 #include "Managers/BsHardwareBufferManager.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
 
 namespace bs
 {
@@ -33,7 +34,7 @@ namespace bs
 #endif
 
 		memcpy(mCachedData + offset, data, size);
-		markCoreDirty();
+		markRangeDirty(offset, size);
 	}
 
 	void GpuParamBlockBuffer::read(UINT32 offset, void* data, UINT32 size)
@@ -62,7 +63,7 @@ namespace bs
 #endif
 
 		memset(mCachedData + offset, 0, size);
-		markCoreDirty();
+		markRangeDirty(offset, size);
 	}
 
 	SPtr<ct::GpuParamBlockBuffer> GpuParamBlockBuffer::getCore() const
@@ -75,12 +76,43 @@ namespace bs
 		return ct::HardwareBufferManager::instance().createGpuParamBlockBufferInternal(mSize, mUsage);
 	}
 
+	void GpuParamBlockBuffer::markRangeDirty(UINT32 offset, UINT32 size)
+	{
+		if (size == 0)
+			return;
+
+		if (mDirtyStart < mDirtyEnd)
+		{
+			mDirtyStart = std::min(mDirtyStart, offset);
+			mDirtyEnd = std::max(mDirtyEnd, offset + size);
+		}
+		else
+		{
+			mDirtyStart = offset;
+			mDirtyEnd = offset + size;
+		}
+
+		markCoreDirty();
+	}
+
 	CoreSyncData GpuParamBlockBuffer::syncToCore(FrameAlloc* allocator)
 	{
-		UINT8* buffer = allocator->alloc(mSize);
-		read(0, buffer, mSize);
+		// Only transfer the range that was modified since the last sync
+		UINT32 dirtySize = mDirtyStart < mDirtyEnd ? mDirtyEnd - mDirtyStart : 0;
+		UINT32 syncSize = sizeof(UINT32) * 2 + dirtySize;
+
+		UINT8* buffer = allocator->alloc(syncSize);
+		char* dataPtr = (char*)buffer;
+		dataPtr = rttiWriteElem(mDirtyStart, dataPtr);
+		dataPtr = rttiWriteElem(dirtySize, dataPtr);
+
+		if (dirtySize > 0)
+			read(mDirtyStart, dataPtr, dirtySize);
 
-		return CoreSyncData(buffer, mSize);
+		mDirtyStart = 0;
+		mDirtyEnd = 0;
+
+		return CoreSyncData(buffer, syncSize);
 	}
 
 	SPtr<GpuParamBlockBuffer> GpuParamBlockBuffer::create(UINT32 size, GpuParamBlockUsage usage)
@@ -104,6 +136,15 @@ namespace bs
 	{
 		if (mCachedData != nullptr)
 			bs_free(mCachedData);
+
+		BS_GPU_MEMORY_FREE(this);
+	}
+
+	void GpuParamBlockBuffer::initialize()
+	{
+		BS_GPU_MEMORY_ALLOC(GpuMemoryCategory::ParamBuffer, this, mSize);
+
+		CoreObject::initialize();
 	}
 
 	void GpuParamBlockBuffer::write(UINT32 offset, const void* data, UINT32 size)
@@ -161,9 +202,17 @@ namespace bs
 
 	void GpuParamBlockBuffer::syncToCore(const CoreSyncData& data)
 	{
-		assert(mSize == data.getBufferSize());
+		char* dataPtr = (char*)data.getBuffer();
+
+		UINT32 offset = 0;
+		UINT32 size = 0;
+		dataPtr = rttiReadElem(offset, dataPtr);
+		dataPtr = rttiReadElem(size, dataPtr);
+
+		assert(data.getBufferSize() == sizeof(UINT32) * 2 + size);
 
-		write(0, data.getBuffer(), data.getBufferSize());
+		if (size > 0)
+			write(offset, dataPtr, size);
 	}
 
 	SPtr<GpuParamBlockBuffer> GpuParamBlockBuffer::create(UINT32 size, GpuParamBlockUsage usage,
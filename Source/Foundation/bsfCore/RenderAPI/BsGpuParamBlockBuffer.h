@@ -65,9 +65,16 @@ namespace bs
 		/** @copydoc CoreObject::syncToCore */
 		CoreSyncData syncToCore(FrameAlloc* allocator) override;
 
+		/** Extends the range of the buffer that needs to be synced with the core thread. */
+		void markRangeDirty(UINT32 offset, UINT32 size);
+
 		GpuParamBlockUsage mUsage;
 		UINT32 mSize;
 		UINT8* mCachedData;
+
+		// Range of bytes modified since the last sync with the core thread. Empty if start is not smaller than end.
+		UINT32 mDirtyStart = 0;
+		UINT32 mDirtyEnd = 0;
 	};
 
 	/** @} */
@@ -89,6 +96,9 @@ namespace bs
 		GpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask);
 		virtual ~GpuParamBlockBuffer();
 
+		/** @copydoc CoreObject::initialize */
+		void initialize() override;
+
 		/** 
 		 * Writes all of the specified data to the buffer. Data size must be the same size as the buffer. 
 		 *
@@ -130,6 +140,9 @@ namespace bs
 		/**	Returns the size of the buffer in bytes. */
 		UINT32 getSize() const { return mSize; }
 
+		/** Checks if the buffer contains cached data that wasn't yet flushed to the GPU. */
+		bool isDirty() const { return mGPUBufferDirty; }
+
 		/** @copydoc HardwareBufferManager::createGpuParamBlockBuffer */
 		static SPtr<GpuParamBlockBuffer> create(UINT32 size, GpuParamBlockUsage usage = GPBU_DYNAMIC,
 			GpuDeviceFlags deviceMask = GDF_DEFAULT);
@@ -820,6 +820,8 @@ namespace bs
 			mSamplerStates[i] = samplers[i];
 			samplers[i].~SPtr<SamplerState>();
 		}
+
+		mVersion++;
 	}
 
 	SPtr<GpuParams> GpuParams::create(const SPtr<GraphicsPipelineState>& pipelineState, GpuDeviceFlags deviceMask)
@@ -369,6 +369,15 @@ namespace bs
 		static SPtr<GpuParams> create(const SPtr<GpuPipelineParamInfo>& paramInfo,
 										  GpuDeviceFlags deviceMask = GDF_DEFAULT);
 
+		/** 
+		 * Returns a counter that is incremented whenever any of the objects referenced by the parameters change. Allows
+		 * the caller to detect if already bound parameters need to be bound again.
+		 */
+		UINT32 getVersion() const { return mVersion; }
+
+		/** @copydoc GpuParamsBase::_markCoreDirty */
+		void _markCoreDirty() override { mVersion++; }
+
 	protected:
 		friend class bs::GpuParams;
 		friend class HardwareBufferManager;
@@ -380,6 +389,8 @@ namespace bs
 
 		/** @copydoc CoreObject::syncToCore */
 		void syncToCore(const CoreSyncData& data) override;
+
+		UINT32 mVersion = 0;
 	};
 
 	/** @} */
@@ -28,7 +28,7 @@ namespace bs
 
 	GpuProgram::GpuProgram(const GPU_PROGRAM_DESC& desc)
 		: mNeedsAdjacencyInfo(desc.requiresAdjacency), mLanguage(desc.language), mType(desc.type)
-		, mEntryPoint(desc.entryPoint), mSource(desc.source)
+		, mEntryPoint(desc.entryPoint), mSource(desc.source), mSpecializationConstants(desc.specializationConstants)
 	{
 
 	}
@@ -62,6 +62,7 @@ namespace bs
 		desc.type = mType;
 		desc.requiresAdjacency = mNeedsAdjacencyInfo;
 		desc.bytecode = mBytecode;
+		desc.specializationConstants = mSpecializationConstants;
 
 		return ct::GpuProgramManager::instance().createInternal(desc);
 	}
@@ -88,7 +89,7 @@ namespace bs
 	{
 	GpuProgram::GpuProgram(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
 		: mNeedsAdjacencyInfo(desc.requiresAdjacency), mType(desc.type), mEntryPoint(desc.entryPoint), mSource(desc.source)
-		, mBytecode(desc.bytecode)
+		, mSpecializationConstants(desc.specializationConstants), mBytecode(desc.bytecode)
 	{
 		mParametersDesc = bs_shared_ptr_new<GpuParamDesc>();
 	}
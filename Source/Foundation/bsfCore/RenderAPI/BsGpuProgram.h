@@ -16,6 +16,15 @@ namespace bs
 
 	struct GpuProgramBytecode;
 
+	/** Value of a single specialization constant of a GPU program. */
+	struct GpuProgramSpecializationConstant
+	{
+		UINT32 id = 0; /**< Identifier of the constant, as assigned in the program source. */
+		INT32 value = 0; /**< Value to specialize the constant with. */
+	};
+
+	BS_ALLOW_MEMCPY_SERIALIZATION(GpuProgramSpecializationConstant)
+
 	/** Descriptor structure used for initialization of a GpuProgram. */
 	struct GPU_PROGRAM_DESC
 	{
@@ -30,6 +39,14 @@ namespace bs
 		 * when supported by the render backend. Call ct::GpuProgram::compileBytecode to generate it.
 		 */
 		SPtr<GpuProgramBytecode> bytecode;
+
+		/**
+		 * Values to assign to specialization constants declared in the program, applied when the program is bound to a
+		 * pipeline. This allows a single compiled program to be shared between multiple variations. Ignored by render
+		 * backends that don't support specialization constants, in which case the values need to be baked into the
+		 * source instead.
+		 */
+		Vector<GpuProgramSpecializationConstant> specializationConstants;
 	};
 
 	/**
@@ -95,6 +112,7 @@ namespace bs
 		GpuProgramType mType;
 		String mEntryPoint;
 		String mSource;
+		Vector<GpuProgramSpecializationConstant> mSpecializationConstants;
 
 		SPtr<GpuProgramBytecode> mBytecode;
 
@@ -192,6 +210,12 @@ namespace bs
 		/** Returns the compiled bytecode of this program. */
 		SPtr<GpuProgramBytecode> getBytecode() const { return mBytecode; }
 
+		/** @copydoc GPU_PROGRAM_DESC::specializationConstants */
+		const Vector<GpuProgramSpecializationConstant>& getSpecializationConstants() const
+		{
+			return mSpecializationConstants;
+		}
+
 		/** 
 		 * @copydoc bs::GpuProgram::create(const GPU_PROGRAM_DESC&)
 		 * @param[in]	deviceMask		Mask that determines on which GPU devices should the object be created on.
@@ -220,6 +244,7 @@ namespace bs
 		GpuProgramType mType;
 		String mEntryPoint;
 		String mSource;
+		Vector<GpuProgramSpecializationConstant> mSpecializationConstants;
 
 		SPtr<GpuProgramBytecode> mBytecode;
 	};
@@ -3,6 +3,7 @@
 #include "RenderAPI/BsIndexBuffer.h"
 #include "Managers/BsHardwareBufferManager.h"
 #include "RenderAPI/BsRenderAPI.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
 
 namespace bs 
 {
@@ -54,6 +55,18 @@ namespace bs
 		:HardwareBuffer(calcIndexSize(desc.indexType) * desc.numIndices), mProperties(desc.indexType, desc.numIndices)
 	{ }
 
+	IndexBuffer::~IndexBuffer()
+	{
+		BS_GPU_MEMORY_FREE(this);
+	}
+
+	void IndexBuffer::initialize()
+	{
+		BS_GPU_MEMORY_ALLOC(GpuMemoryCategory::Mesh, this, mSize);
+
+		CoreObject::initialize();
+	}
+
 	SPtr<IndexBuffer> IndexBuffer::create(const INDEX_BUFFER_DESC& desc, GpuDeviceFlags deviceMask)
 	{
 		return HardwareBufferManager::instance().createIndexBuffer(desc, deviceMask);
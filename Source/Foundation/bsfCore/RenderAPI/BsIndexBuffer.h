@@ -88,7 +88,10 @@ namespace bs
 	{
 	public:
 		IndexBuffer(const INDEX_BUFFER_DESC& desc, GpuDeviceFlags deviceMask = GDF_DEFAULT);
-		virtual ~IndexBuffer() { }
+		virtual ~IndexBuffer();
+
+		/** @copydoc CoreObject::initialize */
+		void initialize() override;
 
 		/**	Returns information about the index buffer. */
 		const IndexBufferProperties& getProperties() const { return mProperties; }
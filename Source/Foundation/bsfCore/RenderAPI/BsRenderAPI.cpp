@@ -146,6 +146,8 @@ namespace bs
 
 	namespace ct
 	{
+	const char* RenderAPI::BINDLESS_TEXTURES_PARAM_NAME = "gBindlessTextures";
+
 	RenderAPI::RenderAPI()
 		: mCurrentCapabilities(nullptr), mNumDevices(0)
 	{
@@ -205,6 +207,20 @@ namespace bs
 		return mCurrentCapabilities[deviceIdx];
 	}
 
+	GpuMemoryStats RenderAPI::getGpuMemoryStats(UINT32 deviceIdx) const
+	{
+		GpuMemoryStats stats;
+		for(UINT32 i = 0; i < (UINT32)GpuMemoryCategory::Count; i++)
+			stats.categoryBytes[i] = GpuMemoryProfiler::getLiveBytes((GpuMemoryCategory)i);
+
+		return stats;
+	}
+
+	UINT32 RenderAPI::getBindlessTextureIndex(const SPtr<Texture>& texture, UINT32 deviceIdx)
+	{
+		return (UINT32)-1;
+	}
+
 	UINT32 RenderAPI::vertexCountToPrimCount(DrawOperationType type, UINT32 elementCount)
 	{
 		UINT32 primCount = 0;
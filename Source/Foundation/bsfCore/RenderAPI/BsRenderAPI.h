@@ -5,6 +5,7 @@
 #include "RenderAPI/BsSamplerState.h"
 #include "CoreThread/BsCommandQueue.h"
 #include "RenderAPI/BsRenderAPICapabilities.h"
+#include "RenderAPI/BsCommandBuffer.h"
 #include "RenderAPI/BsRenderTarget.h"
 #include "RenderAPI/BsRenderTexture.h"
 #include "RenderAPI/BsRenderWindow.h"
@@ -13,6 +14,7 @@
 #include "Math/BsPlane.h"
 #include "Utility/BsModule.h"
 #include "Utility/BsEvent.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
 
 namespace bs
 {
@@ -209,6 +211,12 @@ namespace bs
 		 * If set, the render API support rendering to multiple layers of a render texture at once (via a geometry shader).
 		 */
 		RenderTargetLayers		= 1 << 10,
+		/**
+		 * If set, the GPU is a tile-based renderer (common on mobile devices). Such GPUs are usually limited by memory
+		 * bandwidth, so render targets should use small formats, and textures only needed during a single render pass
+		 * should be created with TU_TRANSIENT.
+		 */
+		TileBasedGPU			= 1 << 11,
 	};
 
 	typedef Flags<RenderAPIFeatureFlag> RenderAPIFeatures;
@@ -259,6 +267,31 @@ namespace bs
 	 *  @{
 	 */
 
+	/** 
+	 * Arguments of a single non-indexed draw, as read from an indirect argument buffer by RenderAPI::drawIndirect(). 
+	 * Layout matches the one expected natively by all render APIs.
+	 */
+	struct DrawIndirectArgs
+	{
+		UINT32 vertexCount;
+		UINT32 instanceCount;
+		UINT32 firstVertex;
+		UINT32 firstInstance;
+	};
+
+	/** 
+	 * Arguments of a single indexed draw, as read from an indirect argument buffer by RenderAPI::drawIndexedIndirect()
+	 * and RenderAPI::multiDrawIndexedIndirect(). Layout matches the one expected natively by all render APIs.
+	 */
+	struct DrawIndexedIndirectArgs
+	{
+		UINT32 indexCount;
+		UINT32 instanceCount;
+		UINT32 firstIndex;
+		INT32 vertexOffset;
+		UINT32 firstInstance;
+	};
+
 	/**
 	 * Provides low-level API access to rendering commands (internally wrapping DirectX/OpenGL/Vulkan or similar). 
 	 * 
@@ -352,6 +385,17 @@ namespace bs
 		 */
 		virtual void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
 
+		/**
+		 * Sets the rate at which fragment programs of subsequent draw calls are invoked. Lower rates shade a block of
+		 * pixels with a single invocation. Ignored unless the render API supports RSC_VARIABLE_RATE_SHADING.
+		 *
+		 * @param[in]	rate			Size of the pixel block shaded by a single invocation.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
+		 *								Buffer must support graphics operations.
+		 */
+		virtual void setShadingRate(ShadingRate rate, const SPtr<CommandBuffer>& commandBuffer = nullptr) { }
+
 		/**
 		 * Sets the provided vertex buffers starting at the specified source index.	Set buffer to nullptr to clear the 
 		 * buffer at the specified index.
@@ -432,6 +476,60 @@ namespace bs
 		virtual void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, 
 			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
 
+		/**
+		 * Draw an object based on currently bound GPU programs, vertex declaration and vertex buffers, with the draw
+		 * arguments read from a GPU buffer. This allows the arguments to be generated on the GPU (e.g. by a culling
+		 * compute shader) without a round-trip to the CPU.
+		 *
+		 * @param[in]	argsBuffer		Buffer of GBT_INDIRECTARGUMENT type containing a DrawIndirectArgs structure.
+		 * @param[in]	offset			Offset into the buffer at which the arguments start, in bytes. Must be a multiple
+		 *								of 4.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
+		 *								Buffer must support graphics operations.
+		 */
+		virtual void drawIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+
+		/**
+		 * Draw an object based on currently bound GPU programs, vertex declaration, vertex and index buffers, with the
+		 * draw arguments read from a GPU buffer.
+		 *
+		 * @param[in]	argsBuffer		Buffer of GBT_INDIRECTARGUMENT type containing a DrawIndexedIndirectArgs structure.
+		 * @param[in]	offset			Offset into the buffer at which the arguments start, in bytes. Must be a multiple
+		 *								of 4.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
+		 *								Buffer must support graphics operations.
+		 */
+		virtual void drawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+
+		/**
+		 * Performs multiple indexed draws using the currently bound GPU programs, vertex declaration, vertex and index
+		 * buffers, with the arguments of each draw read from a GPU buffer. The draws are issued using a single call if
+		 * the render API supports it (see RSC_MULTI_DRAW_INDIRECT), or as separate indirect draws otherwise.
+		 *
+		 * @param[in]	argsBuffer		Buffer of GBT_INDIRECTARGUMENT type containing tightly packed 
+		 *								DrawIndexedIndirectArgs structures.
+		 * @param[in]	offset			Offset into the buffer at which the arguments of the first draw start, in bytes.
+		 *								Must be a multiple of 4.
+		 * @param[in]	drawCount		Number of draws to perform. If @p countBuffer is provided this is the maximum
+		 *								number of draws.
+		 * @param[in]	countBuffer		Optional buffer of GBT_INDIRECTARGUMENT type containing the actual number of draws
+		 *								to perform, as a single UINT32. Only used if the render API supports it (see
+		 *								RSC_DRAW_INDIRECT_COUNT), otherwise all @p drawCount draws are performed, in
+		 *								which case arguments of unused draws should have zero instance count.
+		 * @param[in]	countOffset		Offset into @p countBuffer at which the draw count is stored, in bytes. Must be a
+		 *								multiple of 4.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
+		 *								Buffer must support graphics operations.
+		 */
+		virtual void multiDrawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, UINT32 drawCount,
+			const SPtr<GpuBuffer>& countBuffer = nullptr, UINT32 countOffset = 0, 
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+
 		/** 
 		 * Executes the currently bound compute shader. 
 		 *
@@ -554,6 +652,36 @@ namespace bs
 		 */
 		const VideoModeInfo& getVideoModeInfo() const { return *mVideoModeInfo; }
 
+		/**
+		 * Returns the amount of GPU memory used by the resources of each GpuMemoryCategory, as well as the usage of the
+		 * individual memory heaps of the device, if the render API exposes them. Category sizes are only tracked when
+		 * profiling or telemetry is enabled.
+		 *
+		 * @param[in]	deviceIdx	Index of the device to retrieve the heap usage for.
+		 *
+		 * @note	Thread safe.
+		 */
+		virtual GpuMemoryStats getGpuMemoryStats(UINT32 deviceIdx = 0) const;
+
+		/**
+		 * Returns the index of the texture in the global bindless texture array, registering the texture on first use.
+		 * Shaders can sample the texture by indexing the texture array parameter named BINDLESS_TEXTURES_PARAM_NAME,
+		 * which allows materials to store texture indices in their parameter blocks instead of binding the textures
+		 * individually. The texture remains registered until it is destroyed.
+		 *
+		 * @param[in]	texture		Texture to register. Texture will be accessible for sampling only.
+		 * @param[in]	deviceIdx	Index of the device whose texture array to register the texture with.
+		 * @return					Index of the texture in the array, or -1 if bindless textures are not supported (see
+		 *							RSC_BINDLESS_TEXTURES) or the array is full.
+		 */
+		virtual UINT32 getBindlessTextureIndex(const SPtr<Texture>& texture, UINT32 deviceIdx = 0);
+
+		/** 
+		 * Name of the texture array parameter through which GPU programs access bindless textures. The array must be the
+		 * only parameter in its descriptor set.
+		 */
+		static const char* BINDLESS_TEXTURES_PARAM_NAME;
+
 		/************************************************************************/
 		/* 								UTILITY METHODS                    		*/
 		/************************************************************************/
@@ -619,6 +747,18 @@ namespace bs
 		/** Converts the number of vertices to number of primitives based on the specified draw operation. */
 		UINT32 vertexCountToPrimCount(DrawOperationType type, UINT32 elementCount);
 
+		/** 
+		 * Returns the tracker of bound objects for the provided command buffer, or for the immediate context if no
+		 * command buffer is provided. Backends use it for skipping redundant binds.
+		 */
+		BoundStateTracker& getBoundState(const SPtr<CommandBuffer>& commandBuffer)
+		{
+			if (commandBuffer != nullptr)
+				return commandBuffer->_getBoundState();
+
+			return mImmediateBoundState;
+		}
+
 		/************************************************************************/
 		/* 								INTERNAL DATA					       	*/
 		/************************************************************************/
@@ -630,6 +770,7 @@ namespace bs
 		RenderAPICapabilities* mCurrentCapabilities;
 		UINT32 mNumDevices;
 		SPtr<VideoModeInfo> mVideoModeInfo;
+		BoundStateTracker mImmediateBoundState;
 	};
 
 	/** @} */
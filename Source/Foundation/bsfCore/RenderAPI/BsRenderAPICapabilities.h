@@ -38,6 +38,11 @@ namespace bs
 		RSC_GEOMETRY_PROGRAM			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 3), /**< Supports hardware geometry programs. */
 		RSC_TESSELLATION_PROGRAM		= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 4), /**< Supports hardware tessellation programs. */
 		RSC_COMPUTE_PROGRAM				= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 5), /**< Supports hardware compute programs. */
+		RSC_BINDLESS_TEXTURES			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 6), /**< Supports indexing into a global array of textures from shaders. */
+		RSC_DRAW_INDIRECT				= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 7), /**< Supports draw calls with arguments sourced from a GPU buffer. */
+		RSC_MULTI_DRAW_INDIRECT			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 8), /**< Supports issuing multiple indirect draws with a single call. */
+		RSC_DRAW_INDIRECT_COUNT			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 9), /**< Supports sourcing the number of indirect draws from a GPU buffer. */
+		RSC_VARIABLE_RATE_SHADING		= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 10), /**< Supports shading multiple pixels with a single fragment program invocation. */
 	};
 
 	/** Holds data about render system driver version. */
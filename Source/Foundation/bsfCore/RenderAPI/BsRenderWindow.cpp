@@ -21,6 +21,8 @@ namespace bs
 		isFullScreen = desc.fullscreen;
 		isHidden = desc.hidden;
 		isModal = desc.modal;
+		presentMode = desc.presentMode;
+		maxFrameLatency = desc.maxFrameLatency;
 		isWindow = true;
 		requiresTextureFlipping = false;
 	}
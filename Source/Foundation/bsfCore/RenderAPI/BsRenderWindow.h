@@ -44,6 +44,24 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Determines how rendered frames are queued for display. */
+	enum class PresentMode
+	{
+		/** Mode is chosen by the render API depending on whether vsync is enabled. */
+		Default,
+		/** Frames are displayed as soon as they are presented, which can cause tearing. Lowest latency. */
+		Immediate,
+		/** 
+		 * Frames are displayed on vertical blank, with newer frames replacing any frame still waiting to be displayed. 
+		 * No tearing and low latency, but frames that never end up being displayed still get rendered.
+		 */
+		Mailbox,
+		/** Frames are queued and displayed in order, on vertical blank. No tearing, but highest latency. */
+		Fifo,
+		/** Same as Fifo, except that frames that miss the vertical blank are displayed immediately, which can tear. */
+		FifoRelaxed
+	};
+
 	/** Structure that is used for initializing a render window. */
 	struct BS_CORE_EXPORT RENDER_WINDOW_DESC
 	{
@@ -51,7 +69,8 @@ namespace bs
 		: fullscreen(false), vsync(false), vsyncInterval(1), hidden(false), depthBuffer(true)
 		, multisampleCount(0), multisampleHint(""), gamma(false), left(-1), top(-1), title("")
 		, showTitleBar(true), showBorder(true), allowResize(true), toolWindow (false), modal(false)
-		, hideUntilSwap(false)
+		, hideUntilSwap(false), presentMode(PresentMode::Default), swapChainImageCount(0), maxFrameLatency(0)
+		, flipModel(false)
 		{ }
 
 		VideoMode videoMode; /**< Output monitor, frame buffer resize and refresh rate. */
@@ -73,6 +92,29 @@ namespace bs
 		bool modal; /**< When a modal window is open all other windows will be locked until modal window is closed. */
 		bool hideUntilSwap; /**< Window will be created as hidden and only be shown when the first framebuffer swap happens. */
 
+		/** 
+		 * Determines how are rendered frames queued for display. If the render API doesn't support the requested mode
+		 * the closest supported one is used instead.
+		 */
+		PresentMode presentMode;
+
+		/** Number of images in the window's swap chain. Zero lets the render API choose. */
+		UINT32 swapChainImageCount;
+
+		/** 
+		 * Maximum number of presented frames that may be queued for display. Once reached, presenting a new frame
+		 * blocks until an earlier frame is displayed, reducing input latency at the cost of less buffering. Zero uses
+		 * the render API default.
+		 */
+		UINT32 maxFrameLatency;
+
+		/** 
+		 * Uses flip model presentation instead of copying the back buffer to the window, which is faster and required
+		 * for waiting on frame latency. Only relevant for DirectX, as other render APIs always present this way. 
+		 * Ignored if the window is multisampled.
+		 */
+		bool flipModel;
+
 		NameValuePairList platformSpecific; /**< Platform-specific creation options. */
 	};
 
@@ -103,6 +145,12 @@ namespace bs
 
 		/**	True if the window is maximized. */
 		bool isMaximized = false;
+
+		/** Determines how are rendered frames queued for display. See RENDER_WINDOW_DESC::presentMode. */
+		PresentMode presentMode = PresentMode::Default;
+
+		/** Maximum number of presented frames queued for display. See RENDER_WINDOW_DESC::maxFrameLatency. */
+		UINT32 maxFrameLatency = 0;
 	};
 
 	/**
@@ -124,7 +124,7 @@ namespace bs
 
 	SamplerState::~SamplerState()
 	{
-		RenderStateManager::instance().notifySamplerStateDestroyed(mProperties.mData);
+		RenderStateManager::instance().notifySamplerStateDestroyed(mProperties.mData, mProperties.getHash());
 	}
 
 	void SamplerState::initialize()
@@ -1,7 +1,9 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsGpuBuffer.h"
 #include "Managers/BsHardwareBufferManager.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
 
 namespace bs 
 {
@@ -11,6 +13,7 @@ namespace bs
 
 	VertexBuffer::VertexBuffer(const VERTEX_BUFFER_DESC& desc)
 		: mProperties(desc.numVerts, desc.vertexSize), mUsage(desc.usage), mStreamOut(desc.streamOut)
+		, mSupportsLoadStore(desc.supportsLoadStore)
     {
 
     }
@@ -22,6 +25,7 @@ namespace bs
 		desc.numVerts = mProperties.mNumVertices;
 		desc.usage = mUsage;
 		desc.streamOut = mStreamOut;
+		desc.supportsLoadStore = mSupportsLoadStore;
 
 		return ct::HardwareBufferManager::instance().createVertexBufferInternal(desc);
 	}
@@ -40,8 +44,43 @@ namespace bs
 	{
 	VertexBuffer::VertexBuffer(const VERTEX_BUFFER_DESC& desc, GpuDeviceFlags deviceMask)
 		:HardwareBuffer(desc.vertexSize * desc.numVerts), mProperties(desc.numVerts, desc.vertexSize)
+		, mSupportsLoadStore(desc.supportsLoadStore)
 	{ }
 
+	VertexBuffer::~VertexBuffer()
+	{
+		BS_GPU_MEMORY_FREE(this);
+	}
+
+	void VertexBuffer::initialize()
+	{
+		BS_GPU_MEMORY_ALLOC(GpuMemoryCategory::Mesh, this, mSize);
+
+		CoreObject::initialize();
+	}
+
+	SPtr<GpuBuffer> VertexBuffer::getLoadStore()
+	{
+		if (!mSupportsLoadStore)
+			return nullptr;
+
+		SPtr<GpuBuffer> buffer = mLoadStore.lock();
+		if (buffer == nullptr)
+		{
+			GPU_BUFFER_DESC desc;
+			desc.type = GBT_STANDARD;
+			desc.format = BF_32X1U;
+			desc.elementCount = getSize() / sizeof(UINT32);
+			desc.elementSize = 0;
+			desc.randomGpuWrite = true;
+
+			buffer = createLoadStore(desc);
+			mLoadStore = buffer;
+		}
+
+		return buffer;
+	}
+
 	SPtr<VertexBuffer> VertexBuffer::create(const VERTEX_BUFFER_DESC& desc, GpuDeviceFlags deviceMask)
 	{
 		return HardwareBufferManager::instance().createVertexBuffer(desc, deviceMask);
@@ -8,6 +8,8 @@
 
 namespace bs 
 {
+	struct GPU_BUFFER_DESC;
+
 	/** @addtogroup RenderAPI
 	 *  @{
 	 */
@@ -19,6 +21,12 @@ namespace bs
 		UINT32 numVerts; /**< Number of vertices the buffer can hold. */
 		GpuBufferUsage usage = GBU_STATIC; /**< Usage that tells the hardware how will be buffer be used. */
 		bool streamOut = false; /**< If true the buffer will be usable for streaming out data from the GPU. */
+
+		/** 
+		 * If true GPU programs will be able to read and write the buffer contents, through the buffer returned by
+		 * ct::VertexBuffer::getLoadStore(). Requires a render API that supports compute programs.
+		 */
+		bool supportsLoadStore = false;
 	};
 
 	/** Contains information about a vertex buffer buffer. */
@@ -69,6 +77,7 @@ namespace bs
 		VertexBufferProperties mProperties;
 		GpuBufferUsage mUsage;
 		bool mStreamOut;
+		bool mSupportsLoadStore;
 	};
 
 	/** @} */
@@ -84,16 +93,35 @@ namespace bs
 	{
 	public:
 		VertexBuffer(const VERTEX_BUFFER_DESC& desc, GpuDeviceFlags deviceMask = GDF_DEFAULT);
-		virtual ~VertexBuffer() { }
+		virtual ~VertexBuffer();
+
+		/** @copydoc CoreObject::initialize */
+		void initialize() override;
 
 		/**	Returns information about the vertex buffer. */
 		const VertexBufferProperties& getProperties() const { return mProperties; }
 
+		/**
+		 * Returns a GPU buffer sharing memory with this vertex buffer, allowing GPU programs to read and write the vertex
+		 * data. The returned buffer is a standard buffer with one BF_32X1U element per four bytes of vertex data, and
+		 * keeps this vertex buffer alive for as long as it is referenced. Returns null if the buffer wasn't created with
+		 * VERTEX_BUFFER_DESC::supportsLoadStore enabled.
+		 */
+		SPtr<GpuBuffer> getLoadStore();
+
 		/** @copydoc HardwareBufferManager::createVertexBuffer */
 		static SPtr<VertexBuffer> create(const VERTEX_BUFFER_DESC& desc, GpuDeviceFlags deviceMask = GDF_DEFAULT);
 
 	protected:
+		/** 
+		 * Creates a GPU buffer with the provided properties that shares memory with this vertex buffer. Called by
+		 * getLoadStore(). Render APIs that support load-store vertex buffers must override this method.
+		 */
+		virtual SPtr<GpuBuffer> createLoadStore(const GPU_BUFFER_DESC& desc) { return nullptr; }
+
 		VertexBufferProperties mProperties;
+		bool mSupportsLoadStore;
+		std::weak_ptr<GpuBuffer> mLoadStore;
 	};
 
 	/** @} */
@@ -26,6 +26,21 @@ namespace bs { namespace ct
 		 */
 		virtual void filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch) const = 0;
 
+		/**
+		 * Performs a single step of the filtering done by filterCubemapForSpecular(const SPtr<Texture>&, 
+		 * const SPtr<Texture>&), allowing the filtering to be spread over multiple frames. The first step prepares the
+		 * scratch cubemap from mip level 0 of the source, and every following step filters a single mip level.
+		 * 
+		 * @param[in, out]	cubemap		Cubemap to filter. Its mip level 0 will be read, filtered and written into
+		 *								other mip levels.
+		 * @param[in]		scratch		Temporary cubemap texture to use for the filtering process. Must match the size of
+		 *								the source cubemap, and must be kept intact between the steps.
+		 * @param[in]		step		Index of the step to perform, starting at zero.
+		 * @return						True if this was the last step required for filtering the cubemap.
+		 */
+		virtual bool filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch, 
+			UINT32 step) const = 0;
+
 		/**
 		 * Performs filtering on the cubemap, populating the output cubemap with values that can be used for evaluating
 		 * irradiance for use in diffuse lighting. Uses order-5 SH (25 coefficients) and outputs the values in the form of
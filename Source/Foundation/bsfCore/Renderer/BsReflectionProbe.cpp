@@ -90,6 +90,7 @@ namespace bs
 		cubemapDesc.usage = TU_STATIC | TU_RENDERTARGET;
 
 		mFilteredTexture = Texture::_createPtr(cubemapDesc);
+		SPtr<Texture> scratchTexture = Texture::_createPtr(cubemapDesc);
 
 		auto renderComplete = [this]()
 		{
@@ -98,47 +99,55 @@ namespace bs
 
 		SPtr<ct::ReflectionProbe> coreProbe = getCore();
 		SPtr<ct::Texture> coreTexture = mFilteredTexture->getCore();
+		SPtr<ct::Texture> coreScratch = scratchTexture->getCore();
 
-		if (mCustomTexture == nullptr)
+		SPtr<ct::Texture> coreCustomTex;
+		if (mCustomTexture != nullptr)
+			coreCustomTex = mCustomTexture->getCore();
+
+		// Capture (or copy of the custom texture) and filtering are split into steps, so the renderer can spread them
+		// over multiple frames. The probe keeps using its previous texture until all the steps are done.
+		//  - Scene capture: one step per cubemap face
+		//  - Custom texture: a single step to scale it into the filtered texture
+		//  - Filtering: steps as required by IBLUtility
+		UINT32 numCaptureSteps = coreCustomTex == nullptr ? 6 : 1;
+		auto updateReflProbe = 
+			[coreCustomTex, coreTexture, coreScratch, coreProbe, numCaptureSteps, step = 0U]() mutable
 		{
-			auto renderReflProbe = [coreTexture, coreProbe]()
+			UINT32 curStep = step++;
+			if (curStep < numCaptureSteps)
 			{
-				float radius = coreProbe->mType == ReflectionProbeType::Sphere ? coreProbe->mRadius : 
-					coreProbe->mExtents.length();
-
-				ct::CaptureSettings settings;
-				settings.encodeDepth = true;
-				settings.depthEncodeNear = radius;
-				settings.depthEncodeFar = radius + 1; // + 1 arbitrary, make it a customizable value?
-
-				ct::gRenderer()->captureSceneCubeMap(coreTexture, coreProbe->getTransform().getPosition(), settings);
-				ct::gIBLUtility().filterCubemapForSpecular(coreTexture, nullptr);
+				if (coreCustomTex == nullptr)
+				{
+					float radius = coreProbe->mType == ReflectionProbeType::Sphere ? coreProbe->mRadius :
+						coreProbe->mExtents.length();
 
-				coreProbe->mFilteredTexture = coreTexture;
-				ct::gRenderer()->notifyReflectionProbeUpdated(coreProbe.get(), true);
+					ct::CaptureSettings settings;
+					settings.encodeDepth = true;
+					settings.depthEncodeNear = radius;
+					settings.depthEncodeFar = radius + 1; // + 1 arbitrary, make it a customizable value?
+					settings.face = (INT32)curStep;
 
-				return true;
-			};
+					ct::gRenderer()->captureSceneCubeMap(coreTexture, coreProbe->getTransform().getPosition(), 
+						settings);
+				}
+				else
+					ct::gIBLUtility().scaleCubemap(coreCustomTex, 0, coreTexture, 0);
 
-			mRendererTask = ct::RendererTask::create("ReflProbeRender", renderReflProbe);
-		}
-		else
-		{
-			SPtr<ct::Texture> coreCustomTex = mCustomTexture->getCore();
-			auto filterReflProbe = [coreCustomTex, coreTexture, coreProbe]()
-			{
-				ct::gIBLUtility().scaleCubemap(coreCustomTex, 0, coreTexture, 0);
-				ct::gIBLUtility().filterCubemapForSpecular(coreTexture, nullptr);
+				return false;
+			}
 
-				coreProbe->mFilteredTexture = coreTexture;
-				ct::gRenderer()->notifyReflectionProbeUpdated(coreProbe.get(), true);
+			if (!ct::gIBLUtility().filterCubemapForSpecular(coreTexture, coreScratch, curStep - numCaptureSteps))
+				return false;
 
-				return true;
-			};
+			coreProbe->mFilteredTexture = coreTexture;
+			ct::gRenderer()->notifyReflectionProbeUpdated(coreProbe.get(), true);
 
-			mRendererTask = ct::RendererTask::create("ReflProbeRender", filterReflProbe);
-		}
+			return true;
+		};
 
+		mRendererTask = ct::RendererTask::createTimeSliced("ReflProbeRender", updateReflProbe, 
+			mTransform.getPosition());
 		mRendererTask->onComplete.connect(renderComplete);
 		ct::gRenderer()->addTask(mRendererTask);
 	}
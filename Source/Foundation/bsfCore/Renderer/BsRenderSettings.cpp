@@ -85,6 +85,16 @@ namespace bs
 		return ShadowSettings::getRTTIStatic();
 	}
 
+	RTTITypeBase* DynamicResolutionSettings::getRTTIStatic()
+	{
+		return DynamicResolutionSettingsRTTI::instance();
+	}
+
+	RTTITypeBase* DynamicResolutionSettings::getRTTI() const
+	{
+		return DynamicResolutionSettings::getRTTIStatic();
+	}
+
 	RTTITypeBase* RenderSettings::getRTTIStatic()
 	{
 		return RenderSettingsRTTI::instance();
@@ -103,11 +113,13 @@ namespace bs
 		bufferSize += rttiGetElemSize(exposureScale);
 		bufferSize += rttiGetElemSize(gamma);
 		bufferSize += rttiGetElemSize(enableFXAA);
+		bufferSize += rttiGetElemSize(enableTemporalAA);
 		bufferSize += rttiGetElemSize(enableHDR);
 		bufferSize += rttiGetElemSize(enableLighting);
 		bufferSize += rttiGetElemSize(enableShadows);
 		bufferSize += rttiGetElemSize(enableIndirectLighting);
 		bufferSize += rttiGetElemSize(overlayOnly);
+		bufferSize += rttiGetElemSize(reducedRateShading);
 
 		bufferSize += rttiGetElemSize(autoExposure.histogramLog2Min);
 		bufferSize += rttiGetElemSize(autoExposure.histogramLog2Max);
@@ -161,6 +173,12 @@ namespace bs
 		bufferSize += rttiGetElemSize(shadowSettings.cascadeDistributionExponent);
 		bufferSize += rttiGetElemSize(shadowSettings.shadowFilteringQuality);
 
+		bufferSize += rttiGetElemSize(dynamicResolution.enabled);
+		bufferSize += rttiGetElemSize(dynamicResolution.targetFrameTime);
+		bufferSize += rttiGetElemSize(dynamicResolution.minScale);
+		bufferSize += rttiGetElemSize(dynamicResolution.maxScale);
+		bufferSize += rttiGetElemSize(dynamicResolution.sharpness);
+
 		if (buffer == nullptr)
 		{
 			size = bufferSize;
@@ -179,11 +197,13 @@ namespace bs
 		writeDst = rttiWriteElem(exposureScale, writeDst);
 		writeDst = rttiWriteElem(gamma, writeDst);
 		writeDst = rttiWriteElem(enableFXAA, writeDst);
+		writeDst = rttiWriteElem(enableTemporalAA, writeDst);
 		writeDst = rttiWriteElem(enableHDR, writeDst);
 		writeDst = rttiWriteElem(enableLighting, writeDst);
 		writeDst = rttiWriteElem(enableShadows, writeDst);
 		writeDst = rttiWriteElem(enableIndirectLighting, writeDst);
 		writeDst = rttiWriteElem(overlayOnly, writeDst);
+		writeDst = rttiWriteElem(reducedRateShading, writeDst);
 
 		writeDst = rttiWriteElem(autoExposure.histogramLog2Min, writeDst);
 		writeDst = rttiWriteElem(autoExposure.histogramLog2Max, writeDst);
@@ -236,6 +256,12 @@ namespace bs
 		writeDst = rttiWriteElem(shadowSettings.numCascades, writeDst);
 		writeDst = rttiWriteElem(shadowSettings.cascadeDistributionExponent, writeDst);
 		writeDst = rttiWriteElem(shadowSettings.shadowFilteringQuality, writeDst);
+
+		writeDst = rttiWriteElem(dynamicResolution.enabled, writeDst);
+		writeDst = rttiWriteElem(dynamicResolution.targetFrameTime, writeDst);
+		writeDst = rttiWriteElem(dynamicResolution.minScale, writeDst);
+		writeDst = rttiWriteElem(dynamicResolution.maxScale, writeDst);
+		writeDst = rttiWriteElem(dynamicResolution.sharpness, writeDst);
 	}
 
 	void RenderSettings::_setSyncData(UINT8* buffer, UINT32 size)
@@ -247,11 +273,13 @@ namespace bs
 		readSource = rttiReadElem(exposureScale, readSource);
 		readSource = rttiReadElem(gamma, readSource);
 		readSource = rttiReadElem(enableFXAA, readSource);
+		readSource = rttiReadElem(enableTemporalAA, readSource);
 		readSource = rttiReadElem(enableHDR, readSource);
 		readSource = rttiReadElem(enableLighting, readSource);
 		readSource = rttiReadElem(enableShadows, readSource);
 		readSource = rttiReadElem(enableIndirectLighting, readSource);
 		readSource = rttiReadElem(overlayOnly, readSource);
+		readSource = rttiReadElem(reducedRateShading, readSource);
 
 		readSource = rttiReadElem(autoExposure.histogramLog2Min, readSource);
 		readSource = rttiReadElem(autoExposure.histogramLog2Max, readSource);
@@ -304,5 +332,11 @@ namespace bs
 		readSource = rttiReadElem(shadowSettings.numCascades, readSource);
 		readSource = rttiReadElem(shadowSettings.cascadeDistributionExponent, readSource);
 		readSource = rttiReadElem(shadowSettings.shadowFilteringQuality, readSource);
+
+		readSource = rttiReadElem(dynamicResolution.enabled, readSource);
+		readSource = rttiReadElem(dynamicResolution.targetFrameTime, readSource);
+		readSource = rttiReadElem(dynamicResolution.minScale, readSource);
+		readSource = rttiReadElem(dynamicResolution.maxScale, readSource);
+		readSource = rttiReadElem(dynamicResolution.sharpness, readSource);
 	}
 }
\ No newline at end of file
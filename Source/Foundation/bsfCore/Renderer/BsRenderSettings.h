@@ -12,6 +12,23 @@ namespace bs
 	 *  @{
 	 */
 
+	/** 
+	 * Determines how are expensive, low-frequency screen space effects (ambient occlusion and screen space reflections)
+	 * shaded at a reduced rate.
+	 */
+	enum class BS_SCRIPT_EXPORT(m:Rendering) ReducedRateShadingMode
+	{
+		/** Effects are shaded once for every pixel. */
+		Off,
+		/** 
+		 * Effects are rendered at full resolution, but a single fragment program invocation shades a 2x2 block of
+		 * pixels. Requires hardware support for variable rate shading, falls back to HalfResolution if unsupported.
+		 */
+		VariableRate,
+		/** Effects are rendered at half resolution, and upsampled to full resolution using a depth-aware filter. */
+		HalfResolution
+	};
+
 	/** Settings that control automatic exposure (eye adaptation) post-process. */
 	struct BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Rendering) AutoExposureSettings : public IReflectable
 	{
@@ -448,6 +465,54 @@ namespace bs
 		RTTITypeBase* getRTTI() const override;
 	};
 	
+	/** 
+	 * Settings that control dynamic resolution scaling. When enabled the renderer measures the GPU time spent on each
+	 * frame and scales the resolution at which the scene is rendered, attempting to keep the frame time within the
+	 * provided budget. The scaled image is upscaled to the native resolution before overlays (like GUI) are rendered.
+	 */
+	struct BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Rendering) DynamicResolutionSettings : public IReflectable
+	{
+		BS_SCRIPT_EXPORT()
+		DynamicResolutionSettings() = default;
+
+		/** Enables or disables dynamic resolution scaling. */
+		BS_SCRIPT_EXPORT()
+		bool enabled = false;
+
+		/** 
+		 * GPU frame time the renderer will attempt to stay within, in milliseconds. Resolution will be lowered when the
+		 * frame time is above the budget, and increased when there is enough headroom.
+		 */
+		BS_SCRIPT_EXPORT()
+		float targetFrameTime = 16.6f;
+
+		/** 
+		 * Smallest scale the scene resolution is allowed to be reduced to, relative to the native resolution of the view.
+		 * Applies to both dimensions. In range (0, 1].
+		 */
+		BS_SCRIPT_EXPORT()
+		float minScale = 0.5f;
+
+		/** Largest scale of the scene resolution, relative to the native resolution of the view. In range (0, 1]. */
+		BS_SCRIPT_EXPORT()
+		float maxScale = 1.0f;
+
+		/** 
+		 * Strength of the sharpening filter applied when upscaling, compensating for the blur introduced by rendering at
+		 * a lower resolution. In range [0, 1].
+		 */
+		BS_SCRIPT_EXPORT()
+		float sharpness = 0.5f;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class DynamicResolutionSettingsRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
 	/** Settings that control rendering for a specific camera (view). */
 	struct BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Rendering) RenderSettings : public IReflectable
 	{
@@ -518,10 +583,26 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		ScreenSpaceReflectionsSettings screenSpaceReflections;
 
+		/** 
+		 * Determines if ambient occlusion and screen space reflections are shaded at a reduced rate, trading a small
+		 * amount of quality for a significant performance improvement at high resolutions.
+		 */
+		BS_SCRIPT_EXPORT()
+		ReducedRateShadingMode reducedRateShading = ReducedRateShadingMode::Off;
+
 		/** Enables the fast approximate anti-aliasing effect. */
 		BS_SCRIPT_EXPORT()
 		bool enableFXAA = true;
 
+		/**
+		 * Enables temporal anti-aliasing. The scene is rendered with a different sub-pixel offset every frame, and the
+		 * results are accumulated over multiple frames by reprojecting the previous output using camera and per-object
+		 * motion. When the scene is rendered at a reduced resolution (see DynamicResolutionSettings) the accumulated image
+		 * is produced at the native resolution. Replaces FXAA when enabled.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool enableTemporalAA = false;
+
 		/**
 		 * Log2 value to scale the eye adaptation by (for example 2^0 = 1). Smaller values yield darker image, while larger
 		 * yield brighter image. Allows you to customize exposure manually, applied on top of eye adaptation exposure (if
@@ -573,6 +654,10 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		bool overlayOnly = false;
 
+		/** Parameters used for customizing dynamic resolution scaling. */
+		BS_SCRIPT_EXPORT()
+		DynamicResolutionSettings dynamicResolution;
+
 		/** @name Internal
 		 *  @{
 		 */
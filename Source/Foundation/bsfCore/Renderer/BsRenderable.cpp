@@ -12,9 +12,63 @@
 #include "RenderAPI/BsGpuBuffer.h"
 #include "Animation/BsAnimationManager.h"
 #include "Scene/BsSceneManager.h"
+#include "CoreThread/BsCoreObjectBatchSync.h"
 
 namespace bs
 {
+	/** Syncs Renderable%s that only had their transform modified since the last sync, all in a single batch. */
+	class RenderableTransformSync : public CoreObjectBatchSync
+	{
+		struct TransformData
+		{
+			Vector3 position;
+			Quaternion rotation;
+			Vector3 scale;
+			Matrix4 tfrmMatrix;
+			Matrix4 tfrmMatrixNoScale;
+		};
+
+	public:
+		UINT32 getElementSize() const override { return sizeof(TransformData); }
+
+		void write(CoreObject* const* objects, UINT32 count, UINT8* data) override
+		{
+			TransformData* entries = (TransformData*)data;
+			for (UINT32 i = 0; i < count; i++)
+			{
+				const Renderable* renderable = static_cast<const Renderable*>(objects[i]);
+
+				TransformData& entry = entries[i];
+				entry.position = renderable->mTransform.getPosition();
+				entry.rotation = renderable->mTransform.getRotation();
+				entry.scale = renderable->mTransform.getScale();
+				entry.tfrmMatrix = renderable->mTfrmMatrix;
+				entry.tfrmMatrixNoScale = renderable->mTfrmMatrixNoScale;
+			}
+		}
+
+		void read(const SPtr<ct::CoreObject>* objects, UINT32 count, const UINT8* data) override
+		{
+			const TransformData* entries = (const TransformData*)data;
+			for (UINT32 i = 0; i < count; i++)
+			{
+				ct::Renderable* renderable = static_cast<ct::Renderable*>(objects[i].get());
+
+				const TransformData& entry = entries[i];
+				renderable->mTransform.setPosition(entry.position);
+				renderable->mTransform.setRotation(entry.rotation);
+				renderable->mTransform.setScale(entry.scale);
+				renderable->mTfrmMatrix = entry.tfrmMatrix;
+				renderable->mTfrmMatrixNoScale = entry.tfrmMatrixNoScale;
+
+				if (renderable->mActive)
+					ct::gRenderer()->notifyRenderableUpdated(renderable);
+			}
+		}
+	};
+
+	static RenderableTransformSync gRenderableTransformSync;
+
 	template<class T>
 	bool isMeshValid(const T& mesh) { return false; }
 
@@ -347,6 +401,15 @@ namespace bs
 		return CoreSyncData(data, size);
 	}
 
+	CoreObjectBatchSync* Renderable::getBatchSync() const
+	{
+		// Only transform updates are batched, everything else requires the full sync path
+		if (getCoreDirtyFlags() == (UINT32)ActorDirtyFlag::Transform)
+			return &gRenderableTransformSync;
+
+		return nullptr;
+	}
+
 	void Renderable::getCoreDependencies(Vector<CoreObject*>& dependencies)
 	{
 		if (mMesh.isLoaded())
@@ -532,7 +595,7 @@ namespace bs
 		mMorphShapeVersion = 0;
 	}
 
-	void Renderable::updateAnimationBuffers(const EvaluatedAnimationData& animData)
+	void Renderable::updateAnimationBuffers(const EvaluatedAnimationData& animData, bool updateMorphShapes)
 	{
 		if (mAnimationId == (UINT64)-1)
 			return;
@@ -564,17 +627,37 @@ namespace bs
 			mBoneMatrixBuffer->unlock();
 		}
 
-		if (mAnimType == RenderableAnimType::Morph || mAnimType == RenderableAnimType::SkinnedMorph)
+		if (updateMorphShapes && (mAnimType == RenderableAnimType::Morph || 
+			mAnimType == RenderableAnimType::SkinnedMorph))
 		{
-			if (mMorphShapeVersion != animInfo->morphShapeInfo.version)
+			const EvaluatedAnimationData::MorphShapeInfo& morphShapeInfo = animInfo->morphShapeInfo;
+			if (mMorphShapeVersion != morphShapeInfo.version)
 			{
-				SPtr<MeshData> meshData = animInfo->morphShapeInfo.meshData;
+				SPtr<MeshData> meshData = morphShapeInfo.meshData;
+				if (meshData != nullptr)
+				{
+					UINT32 bufferSize = meshData->getSize();
+					UINT8* data = meshData->getData();
 
-				UINT32 bufferSize = meshData->getSize();
-				UINT8* data = meshData->getData();
+					mMorphShapeBuffer->writeData(0, bufferSize, data, BWT_DISCARD);
+				}
+				else
+				{
+					// Animation system expects the renderer to blend the shapes, but it's not doing so for this object
+					SPtr<MorphShapes> morphShapes = mMesh->getMorphShapes();
+					if (morphShapeInfo.shapeWeights.size() == morphShapes->getNumShapes())
+					{
+						const VertexBufferProperties& props = mMorphShapeBuffer->getProperties();
+						UINT32 vertexSize = props.getVertexSize();
+						UINT32 bufferSize = vertexSize * props.getNumVertices();
+
+						UINT8* dest = (UINT8*)mMorphShapeBuffer->lock(0, bufferSize, GBL_WRITE_ONLY_DISCARD);
+						morphShapes->blend(morphShapeInfo.shapeWeights.data(), dest, vertexSize);
+						mMorphShapeBuffer->unlock();
+					}
+				}
 
-				mMorphShapeBuffer->writeData(0, bufferSize, data, BWT_DISCARD);
-				mMorphShapeVersion = animInfo->morphShapeInfo.version;
+				mMorphShapeVersion = morphShapeInfo.version;
 			}
 		}
 	}
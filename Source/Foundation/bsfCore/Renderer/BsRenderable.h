@@ -13,6 +13,7 @@
 namespace bs
 {
 	struct EvaluatedAnimationData;
+	class RenderableTransformSync;
 
 	/** @addtogroup Implementation
 	 *  @{
@@ -196,6 +197,9 @@ namespace bs
 		/** @copydoc CoreObject::syncToCore */
 		CoreSyncData syncToCore(FrameAlloc* allocator) override;
 
+		/** @copydoc CoreObject::getBatchSync */
+		CoreObjectBatchSync* getBatchSync() const override;
+
 		/** @copydoc CoreObject::getCoreDependencies */
 		void getCoreDependencies(Vector<CoreObject*>& dependencies) override;
 
@@ -213,6 +217,8 @@ namespace bs
 
 		SPtr<Animation> mAnimation;
 
+		friend class RenderableTransformSync;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -248,8 +254,13 @@ namespace bs
 		/** 
 		 * Updates internal animation buffers from the contents of the provided animation data object. Does nothing if
 		 * renderable is not affected by animation.
+		 *
+		 * @param[in]	animData			Evaluated animation data for the current frame.
+		 * @param[in]	updateMorphShapes	If true the morph shape buffer is updated as well. If the animation data
+		 *									only contains morph shape weights, the shapes are blended on the CPU. Renderers
+		 *									that blend morph shapes on their own can set this to false.
 		 */
-		void updateAnimationBuffers(const EvaluatedAnimationData& animData);
+		void updateAnimationBuffers(const EvaluatedAnimationData& animData, bool updateMorphShapes = true);
 
 		/** Returns the GPU buffer containing element's bone matrices, if it has any. */
 		const SPtr<GpuBuffer>& getBoneMatrixBuffer() const { return mBoneMatrixBuffer; }
@@ -262,6 +273,7 @@ namespace bs
 
 	protected:
 		friend class bs::Renderable;
+		friend class bs::RenderableTransformSync;
 
 		Renderable();
 
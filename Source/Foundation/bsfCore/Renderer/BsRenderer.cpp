@@ -93,13 +93,28 @@ namespace bs { namespace ct
 				if (entry->isCanceled() || entry->isComplete())
 					continue;
 
-				entry->mState.store(1);
+				// Time-sliced tasks are scheduled by the renderer, unless everything needs to complete right away
+				if (entry->isTimeSliced() && !forceAll)
+				{
+					mTimeSlicedTasks.push_back(entry);
+					continue;
+				}
 
-				bool complete = entry->mTaskWorker();
-				if (!complete)
+				if (!executeTaskStep(*entry))
 					mRemainingTasks.push_back(entry);
-				else
-					entry->mState.store(2);
+			}
+
+			if (!mTimeSlicedTasks.empty())
+			{
+				processTimeSlicedTasks(mTimeSlicedTasks);
+
+				for (auto& entry : mTimeSlicedTasks)
+				{
+					if (!entry->isCanceled() && !entry->isComplete())
+						mRemainingTasks.push_back(entry);
+				}
+
+				mTimeSlicedTasks.clear();
 			}
 
 			mRunningTasks.clear();
@@ -120,17 +135,30 @@ namespace bs { namespace ct
 		bool complete = task.isCanceled() || task.isComplete();
 		while (!complete)
 		{
-			task.mState.store(1);
-
-			complete = task.mTaskWorker();
-			if (complete)
-				task.mState.store(2);
+			complete = executeTaskStep(task);
 
 			if (!forceAll)
 				break;
 		}
 	}
 
+	void Renderer::processTimeSlicedTasks(const Vector<SPtr<RendererTask>>& tasks)
+	{
+		for (auto& entry : tasks)
+			executeTaskStep(*entry);
+	}
+
+	bool Renderer::executeTaskStep(RendererTask& task)
+	{
+		task.mState.store(1);
+
+		bool complete = task.mTaskWorker();
+		if (complete)
+			task.mState.store(2);
+
+		return complete;
+	}
+
 	SPtr<Renderer> gRenderer()
 	{
 		return std::static_pointer_cast<Renderer>(RendererManager::instance().getActive());
@@ -145,6 +173,16 @@ namespace bs { namespace ct
 		return bs_shared_ptr_new<RendererTask>(PrivatelyConstruct(), std::move(name), std::move(taskWorker));
 	}
 
+	SPtr<RendererTask> RendererTask::createTimeSliced(String name, std::function<bool()> taskWorker, 
+		const Vector3& location)
+	{
+		SPtr<RendererTask> task = create(std::move(name), std::move(taskWorker));
+		task->mTimeSliced = true;
+		task->mLocation = location;
+
+		return task;
+	}
+
 	bool RendererTask::isComplete() const
 	{
 		return mState.load() == 2;
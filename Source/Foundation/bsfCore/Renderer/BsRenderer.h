@@ -6,6 +6,7 @@
 #include "String/BsStringID.h"
 #include "Renderer/BsRendererMeshData.h"
 #include "Material/BsShaderVariation.h"
+#include "Math/BsVector3.h"
 
 namespace bs 
 { 
@@ -30,7 +31,7 @@ namespace bs
 	static const ShaderVariation& getVertexInputVariation()
 	{
 		static ShaderVariation variation = ShaderVariation(
-		Vector<ShaderVariation::Param>{
+		SmallVector<ShaderVariation::Param, 4>{
 			ShaderVariation::Param("SKINNED", skinned),
 			ShaderVariation::Param("MORPH", morph),
 		});
@@ -38,15 +39,30 @@ namespace bs
 		return variation;
 	}
 
+	/** Returns a specific base pass shader variation, used by surface shaders rendered through the deferred pipeline. */
+	template<bool skinned, bool morph, bool instanced>
+	static const ShaderVariation& getBasePassVariation()
+	{
+		static ShaderVariation variation = ShaderVariation(
+		SmallVector<ShaderVariation::Param, 4>{
+			ShaderVariation::Param("SKINNED", skinned),
+			ShaderVariation::Param("MORPH", morph),
+			ShaderVariation::Param("INSTANCED", instanced),
+		});
+
+		return variation;
+	}
+
 	/** Returns a specific forward rendering shader variation. */
-	template<bool skinned, bool morph, bool clustered>
+	template<bool skinned, bool morph, bool clustered, bool instanced>
 	static const ShaderVariation& getForwardRenderingVariation()
 	{
 		static ShaderVariation variation = ShaderVariation(
-		Vector<ShaderVariation::Param>{
+		SmallVector<ShaderVariation::Param, 4>{
 			ShaderVariation::Param("SKINNED", skinned),
 			ShaderVariation::Param("MORPH", morph),
 			ShaderVariation::Param("CLUSTERED", clustered),
+			ShaderVariation::Param("INSTANCED", instanced),
 		});
 
 		return variation;
@@ -86,6 +102,12 @@ namespace bs
 		 * Depth will be linearly interpolated between @p depthEncodeNear and this value.
 		 */
 		float depthEncodeFar = 0.0f;
+
+		/** 
+		 * Index of the cubemap face to capture, in the range [0, 5]. Allows the capture to be spread over multiple frames
+		 * by capturing a single face at a time. If negative all six faces are captured.
+		 */
+		INT32 face = -1;
 	};
 
 	/** 
@@ -383,6 +405,24 @@ namespace bs
 		 */
 		void processTask(RendererTask& task, bool forceAll);
 
+		/**
+		 * Executes time-sliced tasks queued for this frame. Called by processTasks() with all time-sliced tasks that
+		 * haven't completed yet, unless all tasks are being forced to complete. Default implementation executes a single
+		 * step of every task. Renderers can override this to limit the amount of time-sliced work done each frame, in
+		 * which case they should call executeTaskStep() on each task they choose to run.
+		 *
+		 * @note	Core thread.
+		 */
+		virtual void processTimeSlicedTasks(const Vector<SPtr<RendererTask>>& tasks);
+
+		/** 
+		 * Executes a single step of the provided task by calling its worker once. Returns true if the task has
+		 * completed.
+		 *
+		 * @note	Core thread.
+		 */
+		static bool executeTaskStep(RendererTask& task);
+
 		/** Callback to trigger when comparing the order in which renderer extensions are called. */
 		static bool compareCallback(const RendererExtension* a, const RendererExtension* b);
 
@@ -393,6 +433,7 @@ namespace bs
 		Vector<SPtr<RendererTask>> mRemainingUnresolvedTasks; // Sim thread
 		Vector<SPtr<RendererTask>> mRunningTasks; // Core thread
 		Vector<SPtr<RendererTask>> mRemainingTasks; // Core thread
+		Vector<SPtr<RendererTask>> mTimeSlicedTasks; // Core thread
 		Mutex mTaskMutex;
 	};
 
@@ -422,12 +463,32 @@ namespace bs
 		 */
 		static SPtr<RendererTask> create(String name, std::function<bool()> taskWorker);
 
+		/**
+		 * Creates a new time-sliced task. The worker of a time-sliced task should perform a single small unit of work
+		 * each time it is called, allowing the renderer to spread the task over multiple frames according to its time
+		 * budget, and to prioritize tasks closer to the viewer. Task should be provided to Renderer in order for it to
+		 * start.
+		 *
+		 * @param[in]	name		Name you can use to more easily identify the task.
+		 * @param[in]	taskWorker	Worker method that performs a single step of the task. Should return false if there's
+		 *							more work to be done, or true if the task has completed.
+		 * @param[in]	location	Location in world space that the results of the task are relevant for.
+		 */
+		static SPtr<RendererTask> createTimeSliced(String name, std::function<bool()> taskWorker, 
+			const Vector3& location);
+
 		/** Returns true if the task has completed. */
 		bool isComplete() const;
 
 		/**	Returns true if the task has been canceled. */
 		bool isCanceled() const;
 
+		/** Returns true if the task was created through createTimeSliced(). */
+		bool isTimeSliced() const { return mTimeSliced; }
+
+		/** Returns the world space location of a time-sliced task. */
+		const Vector3& getLocation() const { return mLocation; }
+
 		/** Blocks the current thread until the task has completed. */
 		void wait();
 
@@ -447,6 +508,8 @@ namespace bs
 		String mName;
 		std::function<bool()> mTaskWorker;
 		std::atomic<UINT32> mState{0}; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
+		bool mTimeSliced = false;
+		Vector3 mLocation = Vector3::ZERO;
 	};
 
 	/** @} */
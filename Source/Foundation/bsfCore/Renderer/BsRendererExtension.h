@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsCorePrerequisites.h"
+#include "Math/BsVector4.h"
 
 namespace bs
 {
@@ -46,6 +47,31 @@ namespace bs
 		Overlay
 	};
 
+	/** 
+	 * Additional information about the view being rendered, provided to RendererExtension::renderView(). Which of the
+	 * fields are populated depends on the active renderer and the RenderLocation.
+	 */
+	struct RendererViewContext
+	{
+		/** Target the renderer has bound for rendering the view, or null if not available. */
+		SPtr<ct::RenderTarget> target;
+
+		/** Depth buffer containing the view's opaque scene geometry, or null if not available. */
+		SPtr<ct::Texture> sceneDepth;
+
+		/** 
+		 * Maps from normalized device coordinates to UV coordinates of the area in @p sceneDepth the view was rendered
+		 * to. Multiply NDC xy coordinates with the xy components and add the zw components to get the UV.
+		 */
+		Vector4 ndcToUV = Vector4(0.5f, -0.5f, 0.5f, 0.5f);
+
+		/**
+		 * Buffer containing the per-view parameters the renderer uses for rendering the view, matching the layout of
+		 * the PerCamera block in the PerCameraData shader mixin. Null if not available.
+		 */
+		SPtr<ct::GpuParamBlockBuffer> perViewBuffer;
+	};
+
 	/** 
 	 * Interface that can be implemented in order to provide custom rendering code to the renderer. 
 	 * See Renderer::addPlugin().
@@ -87,6 +113,13 @@ namespace bs
 		 */
 		virtual void render(const ct::Camera& camera) = 0;
 
+		/** 
+		 * Called instead of render() by renderers that are able to provide additional information about the view being
+		 * rendered. By default this forwards the call to render(). Extensions that need access to the view's render
+		 * target or scene depth should override this method instead.
+		 */
+		virtual void renderView(const ct::Camera& camera, const RendererViewContext& context) { render(camera); }
+
 		/** 
 		 * Determines when will the render() method execute, compared to other plugins using the same RenderLocation. 
 		 * Higher number means the extension will execute before extensions with lower numbers. Priorities only matter for 
@@ -15,15 +15,7 @@ namespace bs
 	{ }
 
 	Skybox::Skybox()
-	{
-		// This shouldn't normally happen, as filtered textures are generated when a radiance texture is assigned, but
-		// we check for it anyway (something could have gone wrong).
-		if(mTexture.isLoaded())
-		{
-			if (mFilteredRadiance == nullptr || mIrradiance == nullptr)
-				filterTexture();
-		}
-	}
+	{ }
 
 	Skybox::~Skybox()
 	{
@@ -104,6 +96,58 @@ namespace bs
 		_markCoreDirty((ActorDirtyFlag)SkyboxDirtyFlag::Texture);
 	}
 
+	void Skybox::setTexture(const HTexture& texture, const SPtr<Texture>& filteredRadiance, 
+		const SPtr<Texture>& irradiance)
+	{
+		if(filteredRadiance == nullptr || irradiance == nullptr)
+		{
+			setTexture(texture);
+			return;
+		}
+
+		// Any filtering in progress would overwrite the provided textures
+		if (mRendererTask != nullptr)
+		{
+			mRendererTask->cancel();
+			mRendererTask = nullptr;
+		}
+
+		mTexture = texture;
+		mFilteredRadiance = filteredRadiance;
+		mIrradiance = irradiance;
+
+		_markCoreDirty((ActorDirtyFlag)SkyboxDirtyFlag::Texture);
+	}
+
+	SPtr<Texture> Skybox::getFilteredRadiance() const
+	{
+		if (mRendererTask != nullptr)
+			mRendererTask->wait();
+
+		return mFilteredRadiance;
+	}
+
+	SPtr<Texture> Skybox::getIrradiance() const
+	{
+		if (mRendererTask != nullptr)
+			mRendererTask->wait();
+
+		return mIrradiance;
+	}
+
+	void Skybox::initialize()
+	{
+		CoreObject::initialize();
+
+		// Filtered textures are normally restored along with the rest of the skybox when it is deserialized, in which 
+		// case no filtering is needed. Otherwise generate them now (e.g. if saved before filtering was available).
+		if(mTexture.isLoaded())
+		{
+			if (mFilteredRadiance == nullptr || mIrradiance == nullptr)
+				filterTexture();
+		}
+	}
+
 	SPtr<ct::Skybox> Skybox::getCore() const
 	{
 		return std::static_pointer_cast<ct::Skybox>(mCoreSpecific);
@@ -152,7 +196,7 @@ namespace bs
 		UINT32 size = 0;
 		size += getActorSyncDataSize();
 		size += rttiGetElemSize(mBrightness);
-		size += sizeof(SPtr<ct::Texture>);
+		size += sizeof(SPtr<ct::Texture>) * 3;
 		size += rttiGetElemSize(getCoreDirtyFlags());
 
 		UINT8* buffer = allocator->alloc(size);
@@ -170,6 +214,18 @@ namespace bs
 
 		dataPtr += sizeof(SPtr<ct::Texture>);
 
+		// Filtered textures generated by the renderer are assigned on the core thread once the filtering completes, so
+		// only textures that are already available (e.g. provided by the user) are sent
+		SPtr<ct::Texture>* filteredRadiance = new (dataPtr) SPtr<ct::Texture>();
+		SPtr<ct::Texture>* irradiance = new (dataPtr + sizeof(SPtr<ct::Texture>)) SPtr<ct::Texture>();
+		if (mRendererTask == nullptr && mFilteredRadiance != nullptr && mIrradiance != nullptr)
+		{
+			*filteredRadiance = mFilteredRadiance->getCore();
+			*irradiance = mIrradiance->getCore();
+		}
+
+		dataPtr += sizeof(SPtr<ct::Texture>) * 2;
+
 		return CoreSyncData(buffer, size);
 	}
 
@@ -225,6 +281,19 @@ namespace bs
 			texture->~SPtr<Texture>();
 			dataPtr += sizeof(SPtr<Texture>);
 
+			SPtr<Texture>* filteredRadiance = (SPtr<Texture>*)dataPtr;
+			SPtr<Texture>* irradiance = (SPtr<Texture>*)(dataPtr + sizeof(SPtr<Texture>));
+
+			if(*filteredRadiance != nullptr && *irradiance != nullptr)
+			{
+				mFilteredRadiance = *filteredRadiance;
+				mIrradiance = *irradiance;
+			}
+
+			filteredRadiance->~SPtr<Texture>();
+			irradiance->~SPtr<Texture>();
+			dataPtr += sizeof(SPtr<Texture>) * 2;
+
 			if (oldIsActive != mActive)
 			{
 				if (mActive)
@@ -67,10 +67,36 @@ namespace bs
 
 		/** @copydoc setTexture */
 		HTexture getTexture() const { return mTexture; }
+
+		/**
+		 * Assigns the environment map along with its pre-filtered radiance and irradiance, as generated by an earlier
+		 * skybox using the same environment map (see getFilteredRadiance() and getIrradiance()). This allows the
+		 * filtering to be baked offline for skies that don't change, instead of being performed on the GPU every time
+		 * the skybox is created. If either of the filtered textures is null, the environment map is filtered as with
+		 * setTexture(const HTexture&).
+		 */
+		void setTexture(const HTexture& texture, const SPtr<Texture>& filteredRadiance, 
+			const SPtr<Texture>& irradiance);
+
+		/**
+		 * Returns the filtered version of the environment map, used for reflections. If filtering is still in progress,
+		 * blocks until it completes. Returns null if no environment map is assigned.
+		 */
+		SPtr<Texture> getFilteredRadiance() const;
+
+		/**
+		 * Returns the irradiance generated from the environment map, projected from its spherical harmonic
+		 * coefficients. If filtering is still in progress, blocks until it completes. Returns null if no environment
+		 * map is assigned.
+		 */
+		SPtr<Texture> getIrradiance() const;
 		
 		/**	Retrieves an implementation of the skybox usable only from the core thread. */
 		SPtr<ct::Skybox> getCore() const;
 
+		/** @copydoc CoreObject::initialize */
+		void initialize() override;
+
 		/** Creates a new skybox. */
 		static SPtr<Skybox> create();
 
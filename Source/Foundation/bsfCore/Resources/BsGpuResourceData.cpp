@@ -4,6 +4,7 @@
 #include "Private/RTTI/BsGpuResourceDataRTTI.h"
 #include "CoreThread/BsCoreThread.h"
 #include "Error/BsException.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
@@ -18,6 +19,7 @@ namespace bs
 		mData = copy.mData;
 		mLocked = copy.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
+		mMappedSource = copy.mMappedSource;
 	}
 
 	GpuResourceData::~GpuResourceData()
@@ -30,6 +32,7 @@ namespace bs
 		mData = rhs.mData;
 		mLocked = rhs.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
+		mMappedSource = rhs.mMappedSource;
 
 		return *this;
 	}
@@ -64,13 +67,13 @@ namespace bs
 
 		freeInternalBuffer();
 
-		mData = (UINT8*)bs_alloc(size);
+		mData = (UINT8*)bs_alloc<ResourcesAlloc>(size);
 		mOwnsData = true;
 	}
 
 	void GpuResourceData::freeInternalBuffer()
 	{
-		if(mData == nullptr || !mOwnsData)
+		if(mData == nullptr || (!mOwnsData && mMappedSource == nullptr))
 			return;
 
 #if !BS_FORCE_SINGLETHREADED_RENDERING
@@ -81,8 +84,11 @@ namespace bs
 		}
 #endif
 
-		bs_free(mData);
+		if (mOwnsData)
+			bs_free<ResourcesAlloc>(mData);
+
 		mData = nullptr;
+		mMappedSource = nullptr;
 	}
 
 	void GpuResourceData::setExternalBuffer(UINT8* data)
@@ -101,6 +107,24 @@ namespace bs
 		mOwnsData = false;
 	}
 
+	void GpuResourceData::_setDataFromStream(const SPtr<DataStream>& stream, UINT32 size)
+	{
+		if (!stream->isMemoryMapped() || stream->tell() + size > stream->size())
+		{
+			allocateInternalBuffer(size);
+			stream->read(mData, size);
+
+			return;
+		}
+
+		// Reference the mapped memory directly, avoiding the copy
+		MemoryDataStream* memStream = static_cast<MemoryDataStream*>(stream.get());
+		setExternalBuffer(memStream->getCurrentPtr());
+		stream->skip(size);
+
+		mMappedSource = stream;
+	}
+
 	void GpuResourceData::_lock() const
 	{
 		mLocked = true;
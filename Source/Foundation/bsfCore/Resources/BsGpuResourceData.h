@@ -66,6 +66,13 @@ namespace bs
 		 */
 		void setExternalBuffer(UINT8* data);
 
+		/**
+		 * Fills the internal buffer with @p size bytes read from the current position of @p stream. If the stream is
+		 * memory mapped from a file no copy is made, and the internal data pointer references the mapped memory instead.
+		 * In that case the stream is kept alive until the buffer is freed or replaced.
+		 */
+		void _setDataFromStream(const SPtr<DataStream>& stream, UINT32 size);
+
 		/** Checks if the internal buffer is locked due to some other thread using it. */
 		bool isLocked() const { return mLocked; }
 
@@ -86,6 +93,7 @@ namespace bs
 		UINT8* mData;
 		bool mOwnsData;
 		mutable bool mLocked;
+		SPtr<DataStream> mMappedSource;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -0,0 +1,275 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Resources/BsResourceArchive.h"
+#include "Resources/BsResourceManifest.h"
+#include "Resources/BsSavedResourceData.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Serialization/BsFileSerializer.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	/** Header written at the start of every archive file. */
+	struct ResourceArchiveHeader
+	{
+		UINT32 magic;
+		UINT32 version;
+		UINT32 numEntries;
+		UINT32 numDependencies;
+	};
+
+	const UINT32 ResourceArchive::MAGIC = 0x4B505342; // "BSPK"
+	const UINT32 ResourceArchive::VERSION = 1;
+	const UINT32 ResourceArchive::ALIGNMENT = 4096;
+
+	ResourceArchive::ResourceArchive(const ConstructPrivately& dummy)
+	{ }
+
+	bool ResourceArchive::contains(const UUID& uuid) const
+	{
+		return mEntries.find(uuid) != mEntries.end();
+	}
+
+	SPtr<SavedResourceData> ResourceArchive::getResourceData(const UUID& uuid) const
+	{
+		auto iterFind = mEntries.find(uuid);
+		if (iterFind == mEntries.end())
+			return nullptr;
+
+		const Entry& entry = iterFind->second;
+
+		Vector<UUID> dependencies(entry.numDependencies);
+		for (UINT32 i = 0; i < entry.numDependencies; i++)
+			dependencies[i] = mDependencies[entry.firstDependency + i];
+
+		bool allowAsync = (entry.flags & FLAG_ALLOW_ASYNC) != 0;
+		return bs_shared_ptr_new<SavedResourceData>(dependencies, allowAsync, entry.compressionMethod);
+	}
+
+	SPtr<DataStream> ResourceArchive::openResource(const UUID& uuid) const
+	{
+		auto iterFind = mEntries.find(uuid);
+		if (iterFind == mEntries.end())
+			return nullptr;
+
+		const Entry& entry = iterFind->second;
+		if (mIsMapped)
+		{
+			SPtr<MappedFileDataStream> mappedStream = std::static_pointer_cast<MappedFileDataStream>(mStream);
+			return bs_shared_ptr_new<MappedFileDataStream>(mappedStream, (size_t)entry.offset, (size_t)entry.size);
+		}
+
+		// Archive couldn't be mapped, read the resource into memory instead
+		SPtr<MemoryDataStream> memStream = bs_shared_ptr_new<MemoryDataStream>((size_t)entry.size);
+
+		Lock lock(mStreamMutex);
+		mStream->seek((size_t)entry.offset);
+		if (mStream->read(memStream->getPtr(), (size_t)entry.size) != entry.size)
+		{
+			LOGERR("Unable to read resource \"" + uuid.toString() + "\" from archive \"" + mPath.toString() + "\".");
+			return nullptr;
+		}
+
+		return memStream;
+	}
+
+	SPtr<ResourceArchive> ResourceArchive::open(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+		{
+			LOGWRN("Cannot open resource archive. Specified file: " + path.toString() + " doesn't exist.");
+			return nullptr;
+		}
+
+		SPtr<DataStream> stream = FileSystem::openFileMapped(path);
+		if (stream == nullptr)
+			return nullptr;
+
+		ResourceArchiveHeader header;
+		if (stream->read(&header, sizeof(header)) != sizeof(header) || header.magic != MAGIC ||
+			header.version != VERSION)
+		{
+			LOGERR("Unable to open resource archive \"" + path.toString() + "\". Invalid file format.");
+			return nullptr;
+		}
+
+		SPtr<ResourceArchive> archive = bs_shared_ptr_new<ResourceArchive>(ConstructPrivately());
+		archive->mPath = path;
+		archive->mStream = stream;
+		archive->mIsMapped = stream->isMemoryMapped();
+
+		const size_t fileSize = stream->size();
+		for (UINT32 i = 0; i < header.numEntries; i++)
+		{
+			UUID uuid;
+			Entry entry;
+
+			if (stream->read(&uuid, sizeof(uuid)) != sizeof(uuid) || stream->read(&entry, sizeof(entry)) != sizeof(entry) ||
+				(entry.offset + entry.size) > fileSize ||
+				(entry.firstDependency + entry.numDependencies) > header.numDependencies)
+			{
+				LOGERR("Unable to open resource archive \"" + path.toString() + "\". Index is corrupt.");
+				return nullptr;
+			}
+
+			archive->mEntries[uuid] = entry;
+		}
+
+		archive->mDependencies.resize(header.numDependencies);
+		if (header.numDependencies > 0)
+		{
+			size_t dependencyBytes = header.numDependencies * sizeof(UUID);
+			if (stream->read(archive->mDependencies.data(), dependencyBytes) != dependencyBytes)
+			{
+				LOGERR("Unable to open resource archive \"" + path.toString() + "\". Index is corrupt.");
+				return nullptr;
+			}
+		}
+
+		return archive;
+	}
+
+	bool ResourceArchive::pack(const Path& path, const Vector<std::pair<UUID, Path>>& resources)
+	{
+		Vector<UUID> uuids;
+		Vector<Entry> entries;
+		Vector<Path> files;
+		Vector<UUID> dependencies;
+
+		for (auto& resource : resources)
+		{
+			const Path& filePath = resource.second;
+			if (!FileSystem::isFile(filePath))
+			{
+				LOGWRN("Skipping resource \"" + resource.first.toString() + "\" while packing archive. File: " +
+					filePath.toString() + " doesn't exist.");
+				continue;
+			}
+
+			FileDecoder fs(filePath);
+			SPtr<SavedResourceData> savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+			if (savedResourceData == nullptr)
+			{
+				LOGWRN("Skipping resource \"" + resource.first.toString() + "\" while packing archive. File: " +
+					filePath.toString() + " isn't a valid resource.");
+				continue;
+			}
+
+			const Vector<UUID>& resDependencies = savedResourceData->getDependencies();
+
+			Entry entry;
+			entry.offset = 0;
+			entry.size = FileSystem::getFileSize(filePath);
+			entry.flags = savedResourceData->allowAsyncLoading() ? FLAG_ALLOW_ASYNC : 0;
+			entry.compressionMethod = savedResourceData->getCompressionMethod();
+			entry.firstDependency = (UINT32)dependencies.size();
+			entry.numDependencies = (UINT32)resDependencies.size();
+
+			dependencies.insert(dependencies.end(), resDependencies.begin(), resDependencies.end());
+
+			uuids.push_back(resource.first);
+			entries.push_back(entry);
+			files.push_back(filePath);
+		}
+
+		auto align = [](UINT64 offset) { return (offset + ALIGNMENT - 1) & ~(UINT64)(ALIGNMENT - 1); };
+
+		ResourceArchiveHeader header;
+		header.magic = MAGIC;
+		header.version = VERSION;
+		header.numEntries = (UINT32)entries.size();
+		header.numDependencies = (UINT32)dependencies.size();
+
+		// Index is followed by resource data, each resource aligned so it can be referenced directly once mapped
+		UINT64 offset = sizeof(header) + entries.size() * (sizeof(UUID) + sizeof(Entry)) +
+			dependencies.size() * sizeof(UUID);
+
+		for (auto& entry : entries)
+		{
+			offset = align(offset);
+			entry.offset = offset;
+			offset += entry.size;
+		}
+
+		SPtr<DataStream> output = FileSystem::createAndOpenFile(path);
+		if (output == nullptr)
+		{
+			LOGERR("Unable to create resource archive \"" + path.toString() + "\".");
+			return false;
+		}
+
+		output->write(&header, sizeof(header));
+		for (UINT32 i = 0; i < (UINT32)entries.size(); i++)
+		{
+			output->write(&uuids[i], sizeof(uuids[i]));
+			output->write(&entries[i], sizeof(entries[i]));
+		}
+
+		if (!dependencies.empty())
+			output->write(dependencies.data(), dependencies.size() * sizeof(UUID));
+
+		static const UINT32 COPY_BUFFER_SIZE = 64 * 1024;
+		UINT8* buffer = (UINT8*)bs_alloc(COPY_BUFFER_SIZE);
+		bs_zero_out(buffer, COPY_BUFFER_SIZE);
+
+		bool success = true;
+		UINT64 writtenBytes = output->tell();
+		for (UINT32 i = 0; i < (UINT32)entries.size(); i++)
+		{
+			// Pad up to the aligned resource offset (buffer is zeroed at this point)
+			UINT64 padding = entries[i].offset - writtenBytes;
+			output->write(buffer, (size_t)padding);
+			writtenBytes += padding;
+
+			Lock fileLock = FileScheduler::getLock(files[i]);
+			SPtr<DataStream> input = FileSystem::openFile(files[i], true);
+
+			UINT64 remaining = entries[i].size;
+			while (input != nullptr && remaining > 0)
+			{
+				size_t numBytes = (size_t)std::min(remaining, (UINT64)COPY_BUFFER_SIZE);
+				if (input->read(buffer, numBytes) != numBytes)
+					break;
+
+				output->write(buffer, numBytes);
+				remaining -= numBytes;
+			}
+
+			bs_zero_out(buffer, COPY_BUFFER_SIZE);
+			writtenBytes += entries[i].size;
+
+			if (remaining > 0)
+			{
+				LOGERR("Unable to read resource file \"" + files[i].toString() + "\" while packing archive \"" +
+					path.toString() + "\".");
+				success = false;
+				break;
+			}
+		}
+
+		bs_free(buffer);
+		output->close();
+
+		if (!success)
+			FileSystem::remove(path);
+
+		return success;
+	}
+
+	bool ResourceArchive::pack(const Path& path, const SPtr<ResourceManifest>& manifest, const Path& relativePath)
+	{
+		Vector<std::pair<UUID, Path>> resources;
+		resources.reserve(manifest->mUUIDToFilePath.size());
+
+		for (auto& entry : manifest->mUUIDToFilePath)
+		{
+			if (relativePath.isEmpty())
+				resources.push_back(std::make_pair(entry.first, entry.second));
+			else
+				resources.push_back(std::make_pair(entry.first, entry.second.getAbsolute(relativePath)));
+		}
+
+		return pack(path, resources);
+	}
+}
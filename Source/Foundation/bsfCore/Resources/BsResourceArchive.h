@@ -0,0 +1,109 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsUUID.h"
+
+namespace bs
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Single file containing a number of saved resources, along with an index mapping resource UUIDs to their location
+	 * within the file.
+	 *
+	 * Resources are stored in exactly the same format as when saved to individual files, aligned so each can be mapped
+	 * and referenced directly from memory. The index also holds each resource's dependencies, allowing the resource
+	 * system to resolve a load without decoding anything from the archive itself. Once registered with
+	 * Resources::registerResourceArchive() any resource in the archive can be loaded by UUID, the same as resources
+	 * registered in a ResourceManifest.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT ResourceArchive
+	{
+		struct ConstructPrivately {};
+
+		/** Information about a single resource stored in the archive. */
+		struct Entry
+		{
+			UINT64 offset;
+			UINT64 size;
+			UINT32 flags;
+			UINT32 compressionMethod;
+			UINT32 firstDependency;
+			UINT32 numDependencies;
+		};
+
+	public:
+		explicit ResourceArchive(const ConstructPrivately& dummy);
+
+		/** Returns the path to the file the archive was opened from. */
+		const Path& getPath() const { return mPath; }
+
+		/** Returns the number of resources stored in the archive. */
+		UINT32 getNumResources() const { return (UINT32)mEntries.size(); }
+
+		/**	Checks does the archive contain a resource with the provided UUID. */
+		bool contains(const UUID& uuid) const;
+
+		/**
+		 * Returns meta-data about the resource with the specified UUID (dependencies, compression). Returns null if the
+		 * resource is not in the archive.
+		 */
+		SPtr<SavedResourceData> getResourceData(const UUID& uuid) const;
+
+		/**
+		 * Opens a stream containing the saved resource with the specified UUID. Contents of the stream match the contents
+		 * of a resource file as saved by Resources::save(). Returns null if the resource is not in the archive. When the
+		 * archive is memory mapped the returned stream references the mapped memory directly.
+		 */
+		SPtr<DataStream> openResource(const UUID& uuid) const;
+
+		/**
+		 * Opens a previously packed archive. Returns null if the file doesn't exist or isn't a valid archive.
+		 *
+		 * @param[in]	path	Absolute path to the archive file.
+		 */
+		static SPtr<ResourceArchive> open(const Path& path);
+
+		/**
+		 * Packs a set of saved resource files into a single archive.
+		 *
+		 * @param[in]	path		Absolute path of the archive file to create. Any existing file will be overwritten.
+		 * @param[in]	resources	List of resource UUIDs and the paths to the files the resources were saved to.
+		 * @return					True if the archive was successfully written.
+		 */
+		static bool pack(const Path& path, const Vector<std::pair<UUID, Path>>& resources);
+
+		/**
+		 * Packs all resources registered in the provided manifest into a single archive.
+		 *
+		 * @param[in]	path			Absolute path of the archive file to create. Any existing file will be overwritten.
+		 * @param[in]	manifest		Manifest containing the resources to pack.
+		 * @param[in]	relativePath	If the manifest contains relative paths, the path they are relative to.
+		 * @return						True if the archive was successfully written.
+		 */
+		static bool pack(const Path& path, const SPtr<ResourceManifest>& manifest, const Path& relativePath = Path::BLANK);
+
+	private:
+		static const UINT32 MAGIC;
+		static const UINT32 VERSION;
+		static const UINT32 ALIGNMENT;
+
+		static const UINT32 FLAG_ALLOW_ASYNC = 1 << 0;
+
+		Path mPath;
+		UnorderedMap<UUID, Entry> mEntries;
+		Vector<UUID> mDependencies;
+
+		SPtr<DataStream> mStream;
+		bool mIsMapped = false;
+		mutable Mutex mStreamMutex;
+	};
+
+	/** @} */
+}
@@ -24,7 +24,10 @@ namespace bs
 
 	bool ResourceHandleBase::isLoaded(bool checkDependencies) const
 	{
-		bool isLoaded = (mData != nullptr && mData->mIsCreated && mData->mPtr != nullptr);
+		if (mData == nullptr || !mData->mIsCreated.load(std::memory_order_acquire))
+			return false;
+
+		bool isLoaded = mData->mPtr != nullptr;
 
 		if (checkDependencies && isLoaded)
 			isLoaded = mData->mPtr->areDependenciesLoaded();
@@ -37,10 +40,10 @@ namespace bs
 		if(mData == nullptr)
 			return;
 
-		if (!mData->mIsCreated)
+		if (!mData->mIsCreated.load(std::memory_order_acquire))
 		{
 			Lock lock(mResourceCreatedMutex);
-			while (!mData->mIsCreated)
+			while (!mData->mIsCreated.load(std::memory_order_acquire))
 			{
 				mResourceCreatedCondition.wait(lock);
 			}
@@ -74,7 +77,7 @@ namespace bs
 	void ResourceHandleBase::destroy()
 	{
 		if(mData->mPtr)
-			gResources().destroy(*this);
+			gResources().onLastReferenceLost(*this);
 	}
 
 	void ResourceHandleBase::setHandleData(const SPtr<Resource>& ptr, const UUID& uuid)
@@ -85,11 +88,11 @@ namespace bs
 		{
 			mData->mUUID = uuid;
 
-			if(!mData->mIsCreated)
+			if(!mData->mIsCreated.load(std::memory_order_relaxed))
 			{
 				Lock lock(mResourceCreatedMutex);
 				{
-					mData->mIsCreated = true;
+					mData->mIsCreated.store(true, std::memory_order_release);
 				}
 
 				mResourceCreatedCondition.notify_all();
@@ -99,10 +102,12 @@ namespace bs
 
 	void ResourceHandleBase::clearHandleData()
 	{
-		mData->mPtr = nullptr;
+		{
+			Lock lock(mResourceCreatedMutex);
+			mData->mIsCreated.store(false, std::memory_order_release);
+		}
 
-		Lock lock(mResourceCreatedMutex);
-		mData->mIsCreated = false;
+		mData->mPtr = nullptr;
 	}
 
 	void ResourceHandleBase::addInternalRef()
@@ -16,7 +16,12 @@ namespace bs
 	{
 		SPtr<Resource> mPtr;
 		UUID mUUID;
-		bool mIsCreated = false;
+
+		/** 
+		 * Set once mPtr is assigned, and cleared before it is reset. Can be checked without locking, and mPtr can be
+		 * safely accessed once the flag is seen as set.
+		 */
+		std::atomic<bool> mIsCreated{false};
 		std::atomic<std::uint32_t> mRefCount{0};
 	};
 
@@ -89,6 +89,7 @@ namespace bs
 		static SPtr<ResourceManifest> createEmpty();
 
 	public:
+		friend class ResourceArchive;
 		friend class ResourceManifestRTTI;
 		static RTTITypeBase* getRTTIStatic();
 		virtual RTTITypeBase* getRTTI() const override;
@@ -3,6 +3,7 @@
 #include "Resources/BsResources.h"
 #include "Resources/BsResource.h"
 #include "Resources/BsResourceManifest.h"
+#include "Resources/BsResourceArchive.h"
 #include "Error/BsException.h"
 #include "Serialization/BsFileSerializer.h"
 #include "FileSystem/BsFileSystem.h"
@@ -16,9 +17,80 @@
 #include "Utility/BsCompression.h"
 #include "FileSystem/BsDataStream.h"
 #include "Serialization/BsBinarySerializer.h"
+#include "Utility/BsTimer.h"
+#include "Math/BsMath.h"
+#include "Serialization/BsBinaryDiff.h"
+#include "Serialization/BsSerializedObject.h"
+#include "Reflection/BsRTTIType.h"
+#include "CoreThread/BsCoreObject.h"
 
 namespace bs
 {
+	/** Values of SavedResourceData::getCompressionMethod(). */
+	enum ResourceCompressionMethod
+	{
+		COMPRESSION_NONE = 0,
+		/** Single snappy stream. No longer written, but still supported when loading. */
+		COMPRESSION_SNAPPY = 1,
+		/** Independently compressed snappy chunks, see Compression::compressChunked(). */
+		COMPRESSION_SNAPPY_CHUNKED = 2
+	};
+
+	/**
+	 * Written after each set of changes appended to a resource file by Resources::saveIncremental(). Changes are stored
+	 * as a serialized diff immediately preceding the trailer, and are applied in the order they were appended.
+	 */
+	struct ResourceDeltaTrailer
+	{
+		UINT64 baseSize; /**< Size of the full resource data at the start of the file. */
+		UINT32 size; /**< Size of the serialized diff preceding the trailer. */
+		UINT32 magic;
+	};
+
+	static const UINT32 RESOURCE_DELTA_MAGIC = 0x4C445342; // "BSDL"
+
+	/**
+	 * Finds changes appended to the end of a resource file by Resources::saveIncremental(). Outputs the offset and size of
+	 * each serialized diff, in the order they need to be applied. Returns false if the appended data is corrupt.
+	 */
+	static bool findResourceDeltas(const SPtr<DataStream>& stream, Vector<std::pair<size_t, UINT32>>& deltas)
+	{
+		const size_t start = stream->tell();
+		size_t end = stream->size();
+		UINT64 baseSize = 0;
+
+		bool valid = true;
+		while (end - start >= sizeof(ResourceDeltaTrailer))
+		{
+			ResourceDeltaTrailer trailer;
+			stream->seek(end - sizeof(trailer));
+			if (stream->read(&trailer, sizeof(trailer)) != sizeof(trailer) || trailer.magic != RESOURCE_DELTA_MAGIC)
+				break;
+
+			if ((end - start - sizeof(trailer)) < trailer.size || (!deltas.empty() && trailer.baseSize != baseSize))
+			{
+				valid = false;
+				break;
+			}
+
+			baseSize = trailer.baseSize;
+			end -= sizeof(trailer) + trailer.size;
+			deltas.push_back(std::make_pair(end, trailer.size));
+		}
+
+		// All changes must lead back to the end of the full resource data
+		if (!deltas.empty() && (end - start) != baseSize)
+			valid = false;
+
+		if (!valid)
+			deltas.clear();
+
+		std::reverse(deltas.begin(), deltas.end());
+		stream->seek(start);
+
+		return valid;
+	}
+
 	Resources::Resources()
 	{
 		mDefaultResourceManifest = ResourceManifest::create("Default");
@@ -27,6 +99,19 @@ namespace bs
 
 	Resources::~Resources()
 	{
+		// Wait for any files being re-written by saveIncremental()
+		{
+			Lock lock(mIncrementalSaveMutex);
+			for (auto& entry : mIncrementalSaveStates)
+			{
+				if (entry.second->compactTask != nullptr)
+					entry.second->compactTask->wait();
+			}
+
+			mIncrementalSaveStates.clear();
+		}
+
+		stopIOThreads();
 		unloadAll();
 	}
 
@@ -45,7 +130,7 @@ namespace bs
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
-		return loadInternal(uuid, filePath, true, loadFlags);
+		return loadInternal(uuid, filePath, nullptr, true, loadFlags);
 	}
 
 	HResource Resources::load(const WeakResourceHandle<Resource>& handle, ResourceLoadFlags loadFlags)
@@ -57,7 +142,7 @@ namespace bs
 		return loadFromUUID(uuid, false, loadFlags);
 	}
 
-	HResource Resources::loadAsync(const Path& filePath, ResourceLoadFlags loadFlags)
+	HResource Resources::loadAsync(const Path& filePath, ResourceLoadFlags loadFlags, TaskPriority priority)
 	{
 		if (!FileSystem::isFile(filePath))
 		{
@@ -72,10 +157,10 @@ namespace bs
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
-		return loadInternal(uuid, filePath, false, loadFlags);
+		return loadInternal(uuid, filePath, nullptr, false, loadFlags, priority);
 	}
 
-	HResource Resources::loadFromUUID(const UUID& uuid, bool async, ResourceLoadFlags loadFlags)
+	HResource Resources::loadFromUUID(const UUID& uuid, bool async, ResourceLoadFlags loadFlags, TaskPriority priority)
 	{
 		Path filePath;
 
@@ -87,12 +172,28 @@ namespace bs
 				break;
 		}
 
-		return loadInternal(uuid, filePath, !async, loadFlags);
+		// Fall back to packed archives if the resource isn't available as a standalone file
+		SPtr<ResourceArchive> archive;
+		if (filePath.isEmpty())
+		{
+			for (auto iter = mResourceArchives.rbegin(); iter != mResourceArchives.rend(); ++iter)
+			{
+				if ((*iter)->contains(uuid))
+				{
+					archive = *iter;
+					break;
+				}
+			}
+		}
+
+		return loadInternal(uuid, filePath, archive, !async, loadFlags, priority);
 	}
 
-	HResource Resources::loadInternal(const UUID& uuid, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags)
+	HResource Resources::loadInternal(const UUID& uuid, const Path& filePath, const SPtr<ResourceArchive>& archive,
+		bool synchronous, ResourceLoadFlags loadFlags, TaskPriority priority)
 	{
 		HResource outputResource;
+		HResource cachedResource;
 
 		// Retrieve/create resource handle, and register with the system
 		bool loadInProgress = false;
@@ -103,8 +204,8 @@ namespace bs
 			bool alreadyLoading = false;
 
 			// Check if the resource is being loaded on a worker thread
-			Lock inProgressLock(mInProgressResourcesMutex);
-			Lock loadedLock(mLoadedResourceMutex);
+			ProfiledLock inProgressLock(mInProgressResourcesMutex);
+			ProfiledLock loadedLock(mLoadedResourceMutex);
 
 			auto iterFind2 = mInProgressResources.find(uuid);
 			if (iterFind2 != mInProgressResources.end())
@@ -137,25 +238,19 @@ namespace bs
 					outputResource.addInternalRef();
 				}
 
+				// Resource is referenced again, no need to keep it cached
+				cachedResource = removeFromCache(uuid);
+
 				alreadyLoading = true;
 			}
 
 			// Not loaded and not in progress, register a new handle or find a pre-registered one
 			if(!alreadyLoading)
-			{
-				auto iterFind = mHandles.find(uuid);
-				if (iterFind != mHandles.end())
-					outputResource = iterFind->second.lock();
-				else
-				{
-					outputResource = HResource(uuid);
-					mHandles[uuid] = outputResource.getWeak();
-				}
-			}
+				outputResource = _getResourceHandle(uuid);
 
 			// If we have nowhere to load from, warn and complete load if a file path was provided, otherwise pass through
 			// as we might just want to complete a previously queued load 
-			if (filePath.isEmpty())
+			if (filePath.isEmpty() && archive == nullptr)
 			{
 				if (!alreadyLoading)
 				{
@@ -163,7 +258,7 @@ namespace bs
 					loadFailed = true;
 				}
 			}
-			else if (!FileSystem::isFile(filePath))
+			else if (!filePath.isEmpty() && !FileSystem::isFile(filePath))
 			{
 				LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 				loadFailed = true;
@@ -171,9 +266,11 @@ namespace bs
 
 			if(!loadFailed)
 			{
-				// Load dependency data if a file path is provided
+				// Load dependency data if a file path or an archive is provided
 				SPtr<SavedResourceData> savedResourceData;
-				if (!filePath.isEmpty())
+				if (archive != nullptr)
+					savedResourceData = archive->getResourceData(uuid);
+				else if (!filePath.isEmpty())
 				{
 					FileDecoder fs(filePath);
 					savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
@@ -273,7 +370,7 @@ namespace bs
 					}
 				}
 
-				initiateLoad = !alreadyLoading && !filePath.isEmpty();
+				initiateLoad = !alreadyLoading && (!filePath.isEmpty() || archive != nullptr);
 
 				if(savedResourceData != nullptr)
 					synchronous = synchronous & savedResourceData->allowAsyncLoading();
@@ -298,17 +395,18 @@ namespace bs
 			// Synchronous or the resource doesn't support async, read the file immediately
 			if (synchronous)
 			{
-				loadCallback(filePath, outputResource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
+				loadCallback(filePath, archive, outputResource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
 			}
-			else // Asynchronous, read the file on a worker thread
+			else // Asynchronous, read the file on an I/O thread and deserialize it on a worker thread
 			{
-				String fileName = filePath.getFilename();
-				String taskName = "Resource load: " + fileName;
-
-				bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
-				SPtr<Task> task = Task::create(taskName, 
-					std::bind(&Resources::loadCallback, this, filePath, outputResource, keepSourceData));
-				TaskScheduler::instance().addTask(task);
+				ResourceReadRequest request;
+				request.resource = outputResource;
+				request.filePath = filePath;
+				request.archive = archive;
+				request.keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
+				request.priority = priority;
+
+				queueRead(request);
 			}
 		}
 		else
@@ -334,12 +432,12 @@ namespace bs
 			{
 				// Note the resource is still guaranteed to be in the in-progress map because it can't be removed until
 				// its dependency count is reduced to zero.
-				Lock inProgressLock(mInProgressResourcesMutex);
+				ProfiledLock inProgressLock(mInProgressResourcesMutex);
 				mInProgressResources[uuid]->dependencies = dependencies;
 			}
 
 			for (UINT32 i = 0; i < numDependencies; i++)
-				dependencies[i] = loadFromUUID(dependenciesToLoad[i], !synchronous, depLoadFlags);
+				dependencies[i] = loadFromUUID(dependenciesToLoad[i], !synchronous, depLoadFlags, priority);
 		}
 
 		return outputResource;
@@ -349,10 +447,43 @@ namespace bs
 	{
 		Lock fileLock = FileScheduler::getLock(filePath);
 
-		SPtr<DataStream> stream = FileSystem::openFile(filePath, true);
+		// Map the file so data blocks (e.g. pixel or vertex data) can reference it directly instead of being copied. Not
+		// done when the source data is kept around, as the mapping would then outlive the load and keep the file in use.
+		SPtr<DataStream> stream;
+		if (loadWithSaveData)
+			stream = FileSystem::openFile(filePath, true);
+		else
+			stream = FileSystem::openFileMapped(filePath);
+
+		if (stream == nullptr)
+			return nullptr;
+
+		SPtr<Resource> resource = deserialize(stream, loadWithSaveData);
+		if (resource == nullptr)
+			LOGERR("Unable to load resource at path \"" + filePath.toString() + "\"");
+
+		return resource;
+	}
+
+	SPtr<Resource> Resources::loadFromArchiveAndDeserialize(const SPtr<ResourceArchive>& archive, const UUID& uuid,
+		bool loadWithSaveData)
+	{
+		SPtr<DataStream> stream = archive->openResource(uuid);
 		if (stream == nullptr)
 			return nullptr;
 
+		SPtr<Resource> resource = deserialize(stream, loadWithSaveData);
+		if (resource == nullptr)
+		{
+			LOGERR("Unable to load resource \"" + uuid.toString() + "\" from archive \"" + 
+				archive->getPath().toString() + "\"");
+		}
+
+		return resource;
+	}
+
+	SPtr<Resource> Resources::deserialize(SPtr<DataStream> stream, bool loadWithSaveData)
+	{
 		if (stream->size() > std::numeric_limits<UINT32>::max())
 		{
 			BS_EXCEPT(InternalErrorException,
@@ -363,6 +494,12 @@ namespace bs
 		if(loadWithSaveData)
 			params["keepSourceData"] = 1;
 
+		// Find any changes appended by saveIncremental(), to be applied once the full resource data is decoded
+		const SPtr<DataStream> sourceStream = stream;
+		Vector<std::pair<size_t, UINT32>> deltas;
+		if (!findResourceDeltas(sourceStream, deltas))
+			LOGWRN("Ignoring changes appended to a resource file since they are corrupt.");
+
 		// Read meta-data
 		SPtr<SavedResourceData> metaData;
 		{
@@ -384,22 +521,54 @@ namespace bs
 				UINT32 objectSize = 0;
 				stream->read(&objectSize, sizeof(objectSize));
 
-				if (metaData->getCompressionMethod() != 0)
+				switch (metaData->getCompressionMethod())
+				{
+				case COMPRESSION_SNAPPY:
 					stream = Compression::decompress(stream);
+					break;
+				case COMPRESSION_SNAPPY_CHUNKED:
+					stream = Compression::decompressChunked(stream);
+					break;
+				default:
+					break;
+				}
+
+				if (stream == nullptr)
+					return nullptr;
+
+				// Core objects that are part of the resource (e.g. renderables in a prefab) all get initialized by a
+				// single core thread command
+				CoreObject::_beginInitializeBatch();
 
 				BinarySerializer bs;
 				loadedData = std::static_pointer_cast<SavedResourceData>(bs.decode(stream, objectSize, params));
+
+				CoreObject::_endInitializeBatch();
+
+				if (loadedData != nullptr && !loadedData->isDerivedFrom(Resource::getRTTIStatic()))
+					BS_EXCEPT(InternalErrorException, "Loaded class doesn't derive from Resource.");
+
+				// Used as an estimate of the memory used by the resource
+				if (loadedData != nullptr)
+					static_cast<Resource*>(loadedData.get())->mSize = objectSize;
 			}
 		}
 
-		if (loadedData == nullptr)
+		// Apply appended changes
+		if (loadedData != nullptr && !deltas.empty())
 		{
-			LOGERR("Unable to load resource at path \"" + filePath.toString() + "\"");
-		}
-		else
-		{
-			if (!loadedData->isDerivedFrom(Resource::getRTTIStatic()))
-				BS_EXCEPT(InternalErrorException, "Loaded class doesn't derive from Resource.");
+			IDiff& diffHandler = loadedData->getRTTI()->getDiffHandler();
+			for (auto& delta : deltas)
+			{
+				sourceStream->seek(delta.first);
+
+				BinarySerializer bs;
+				SPtr<SerializedObject> diff = std::static_pointer_cast<SerializedObject>(
+					bs.decode(sourceStream, delta.second, params));
+
+				if (diff != nullptr)
+					diffHandler.applyDiff(loadedData, diff);
+			}
 		}
 
 		SPtr<Resource> resource = std::static_pointer_cast<Resource>(loadedData);
@@ -414,7 +583,7 @@ namespace bs
 			bool loadInProgress = false;
 
 			{
-				Lock inProgressLock(mInProgressResourcesMutex);
+				ProfiledLock inProgressLock(mInProgressResourcesMutex);
 				auto iterFind2 = mInProgressResources.find(uuid);
 				if (iterFind2 != mInProgressResources.end())
 					loadInProgress = true;
@@ -429,7 +598,7 @@ namespace bs
 
 			bool lostLastRef = false;
 			{
-				Lock loadedLock(mLoadedResourceMutex);
+				ProfiledLock loadedLock(mLoadedResourceMutex);
 				auto iterFind = mLoadedResources.find(uuid);
 				if (iterFind != mLoadedResources.end())
 				{
@@ -445,7 +614,7 @@ namespace bs
 			}
 
 			if(lostLastRef)
-				destroy(resource);
+				onLastReferenceLost(resource);
 		}
 	}
 
@@ -454,7 +623,7 @@ namespace bs
 		Vector<HResource> resourcesToUnload;
 
 		{
-			Lock lock(mLoadedResourceMutex);
+			ProfiledLock lock(mLoadedResourceMutex);
 			for(auto iter = mLoadedResources.begin(); iter != mLoadedResources.end(); ++iter)
 			{
 				const LoadedResourceData& resData = iter->second;
@@ -474,15 +643,19 @@ namespace bs
 		{
 			release(*iter);
 		}
+
+		// Released resources might have ended up in the cache
+		resourcesToUnload.clear();
+		clearCache();
 	}
 
 	void Resources::unloadAll()
 	{
 		// Unload and invalidate all resources
-		UnorderedMap<UUID, LoadedResourceData> loadedResourcesCopy;
+		FlatHashMap<UUID, LoadedResourceData> loadedResourcesCopy;
 		
 		{
-			Lock lock(mLoadedResourceMutex);
+			ProfiledLock lock(mLoadedResourceMutex);
 			loadedResourcesCopy = mLoadedResources;
 		}
 
@@ -503,7 +676,7 @@ namespace bs
 		{
 			bool loadInProgress = false;
 			{
-				Lock lock(mInProgressResourcesMutex);
+				ProfiledLock lock(mInProgressResourcesMutex);
 				auto iterFind2 = mInProgressResources.find(uuid);
 				if (iterFind2 != mInProgressResources.end())
 					loadInProgress = true;
@@ -523,7 +696,7 @@ namespace bs
 		resource.mData->mPtr->destroy();
 
 		{
-			Lock lock(mLoadedResourceMutex);
+			ProfiledLock lock(mLoadedResourceMutex);
 			auto iterFind = mLoadedResources.find(uuid);
 			if (iterFind != mLoadedResources.end())
 			{
@@ -542,19 +715,330 @@ namespace bs
 			}
 		}
 
+		clearIncrementalSaveState(uuid);
+
 		resource.clearHandleData();
+		removeFromCache(uuid);
+	}
+
+	void Resources::onLastReferenceLost(ResourceHandleBase& resource)
+	{
+		const UINT64 cacheBudget = mCacheBudget.load(std::memory_order_relaxed);
+
+		// Only resources that were loaded from disk are cached, others can't be loaded again
+		if (cacheBudget == 0 || !resource.isLoaded(false) || resource.mData->mPtr->mSize == 0 ||
+			resource.mData->mPtr->mSize > cacheBudget)
+		{
+			destroy(resource);
+			return;
+		}
+
+		const UUID& uuid = resource.getUUID();
+		{
+			ProfiledLock loadedLock(mLoadedResourceMutex);
+			auto iterFind = mLoadedResources.find(uuid);
+			if (iterFind != mLoadedResources.end())
+			{
+				Lock cacheLock(mCacheMutex);
+				if (mCacheLookup.find(uuid) == mCacheLookup.end())
+				{
+					CachedResource entry;
+					entry.resource = iterFind->second.resource.lock();
+					entry.size = resource.mData->mPtr->mSize;
+
+					mCacheLookup[uuid] = mCache.insert(mCache.end(), entry);
+					mCacheSize += entry.size;
+				}
+
+				return;
+			}
+		}
+
+		destroy(resource);
+	}
+
+	HResource Resources::removeFromCache(const UUID& uuid)
+	{
+		Lock lock(mCacheMutex);
+
+		auto iterFind = mCacheLookup.find(uuid);
+		if (iterFind == mCacheLookup.end())
+			return HResource();
+
+		HResource output = iterFind->second->resource;
+		mCacheSize -= iterFind->second->size;
+
+		mCache.erase(iterFind->second);
+		mCacheLookup.erase(iterFind);
+
+		return output;
+	}
+
+	bool Resources::evictOldestCached()
+	{
+		HResource resource;
+		{
+			Lock lock(mCacheMutex);
+			if (mCache.empty())
+				return false;
+
+			CachedResource& entry = mCache.front();
+			resource = entry.resource;
+			mCacheSize -= entry.size;
+
+			mCacheLookup.erase(resource.getUUID());
+			mCache.pop_front();
+		}
+
+		// If referenced through some other handle in the meantime, just drop the cache's reference
+		if (resource.getHandleData()->mRefCount.load(std::memory_order_relaxed) == 1)
+			destroy(resource);
+
+		return true;
+	}
+
+	void Resources::setCacheBudget(UINT64 bytes)
+	{
+		mCacheBudget.store(bytes, std::memory_order_relaxed);
+
+		if (bytes == 0)
+			clearCache();
+	}
+
+	UINT64 Resources::getCacheSize() const
+	{
+		Lock lock(mCacheMutex);
+		return mCacheSize;
+	}
+
+	void Resources::clearCache()
+	{
+		// Unloading a resource can release its dependencies into the cache, so keep going until it's empty
+		while (evictOldestCached())
+		{ }
+	}
+
+	void Resources::_updateCache()
+	{
+		Timer timer;
+		while (getCacheSize() > mCacheBudget.load(std::memory_order_relaxed))
+		{
+			if (!evictOldestCached() || timer.getMicroseconds() >= mCacheEvictionTime)
+				break;
+		}
+	}
+
+	UnorderedMap<UINT32, ResourceMemoryStats> Resources::getMemoryUsage() const
+	{
+		UnorderedMap<UINT32, ResourceMemoryStats> output;
+
+		ProfiledLock loadedLock(mLoadedResourceMutex);
+		for (auto& entry : mLoadedResources)
+		{
+			const SPtr<Resource>& resource = entry.second.resource.mData->mPtr;
+			if (resource == nullptr)
+				continue;
+
+			ResourceMemoryStats& stats = output[resource->getRTTI()->getRTTIId()];
+			stats.numLoaded++;
+			stats.loadedBytes += resource->mSize;
+		}
+
+		Lock cacheLock(mCacheMutex);
+		for (auto& entry : mCache)
+		{
+			const SPtr<Resource>& resource = entry.resource.getHandleData()->mPtr;
+			if (resource == nullptr)
+				continue;
+
+			ResourceMemoryStats& stats = output[resource->getRTTI()->getRTTIId()];
+			stats.numCached++;
+			stats.cachedBytes += entry.size;
+		}
+
+		return output;
 	}
 
 	void Resources::save(const HResource& resource, const Path& filePath, bool overwrite, bool compress)
+	{
+		if (!prepareForSave(resource, filePath))
+			return;
+
+		bool fileExists = FileSystem::isFile(filePath);
+		if(fileExists && !overwrite)
+		{
+			LOGERR("Another file exists at the specified location. Not saving.");
+			return;
+		}
+
+		// A full save discards any changes appended by saveIncremental()
+		clearIncrementalSaveState(resource.getUUID());
+
+		mDefaultResourceManifest->registerResource(resource.getUUID(), filePath);
+
+		SPtr<SavedResourceData> resourceData = createSavedResourceData(resource, compress);
+
+		MemorySerializer ms;
+		UINT32 numBytes = 0;
+		UINT8* bytes = ms.encode(resource.get(), numBytes);
+
+		writeResourceFile(filePath, resourceData, bytes, numBytes);
+	}
+
+	void Resources::save(const HResource& resource, bool compress)
+	{
+		if (resource == nullptr)
+			return;
+
+		Path path;
+		if (getFilePathFromUUID(resource.getUUID(), path))
+			save(resource, path, true, compress);
+	}
+
+	void Resources::saveIncremental(const HResource& resource, const Path& filePath, bool compress)
+	{
+		if (!prepareForSave(resource, filePath))
+			return;
+
+		const UUID& uuid = resource.getUUID();
+		mDefaultResourceManifest->registerResource(uuid, filePath);
+
+		SPtr<SavedResourceData> resourceData = createSavedResourceData(resource, compress);
+
+		BinarySerializer bs;
+		SPtr<SerializedObject> serializedObject = bs._encodeToIntermediate(resource.get());
+
+		SPtr<IncrementalSaveState> state;
+		{
+			Lock lock(mIncrementalSaveMutex);
+			auto iterFind = mIncrementalSaveStates.find(uuid);
+			if (iterFind != mIncrementalSaveStates.end())
+				state = iterFind->second;
+		}
+
+		if (state != nullptr && state->compactTask != nullptr)
+		{
+			state->compactTask->wait();
+			state->compactTask = nullptr;
+		}
+
+		// Changes can only be appended if the file still contains exactly what we last wrote, and the meta-data at the
+		// start of the file is still valid
+		bool canAppend = state != nullptr && state->filePath == filePath && 
+			state->metaData->getDependencies() == resourceData->getDependencies() &&
+			state->metaData->allowAsyncLoading() == resourceData->allowAsyncLoading() &&
+			state->metaData->getCompressionMethod() == resourceData->getCompressionMethod() &&
+			FileSystem::isFile(filePath) && FileSystem::getFileSize(filePath) == state->fileSize;
+
+		MemorySerializer ms;
+		if (!canAppend)
+		{
+			UINT32 numBytes = 0;
+			UINT8* bytes = ms.encode(resource.get(), numBytes);
+
+			UINT64 fileSize = writeResourceFile(filePath, resourceData, bytes, numBytes);
+
+			Lock lock(mIncrementalSaveMutex);
+			if (fileSize == 0)
+			{
+				mIncrementalSaveStates.erase(uuid);
+				return;
+			}
+
+			state = bs_shared_ptr_new<IncrementalSaveState>();
+			state->filePath = filePath;
+			state->metaData = resourceData;
+			state->savedObject = serializedObject;
+			state->baseSize = fileSize;
+			state->fileSize = fileSize;
+
+			mIncrementalSaveStates[uuid] = state;
+			return;
+		}
+
+		SPtr<SerializedObject> diff = resource->getRTTI()->getDiffHandler().generateDiff(state->savedObject, 
+			serializedObject);
+
+		if (diff == nullptr) // Nothing changed
+			return;
+
+		UINT32 numBytes = 0;
+		UINT8* bytes = ms.encode(diff.get(), numBytes);
+
+		ResourceDeltaTrailer trailer;
+		trailer.baseSize = state->baseSize;
+		trailer.size = numBytes;
+		trailer.magic = RESOURCE_DELTA_MAGIC;
+
+		{
+			Lock fileLock = FileScheduler::getLock(filePath);
+
+			std::ofstream stream;
+			stream.open(filePath.toPlatformString().c_str(), std::ios::out | std::ios::binary | std::ios::app);
+			if (stream.fail())
+			{
+				LOGWRN("Failed to save file: \"" + filePath.toString() + "\". Error: " + strerror(errno) + ".");
+				bs_free(bytes);
+				return;
+			}
+
+			stream.write((char*)bytes, numBytes);
+			stream.write((char*)&trailer, sizeof(trailer));
+			stream.close();
+		}
+
+		bs_free(bytes);
+
+		state->savedObject = serializedObject;
+		state->fileSize += numBytes + sizeof(trailer);
+		state->numDeltas++;
+
+		// Once appended changes grow too large re-write the file in full, so loads don't need to apply a long list of
+		// changes. Encoding must happen now since the resource might get modified afterwards, but the (potentially
+		// compressed) write is done on a worker.
+		UINT64 deltaSize = state->fileSize - state->baseSize;
+		if (state->numDeltas >= MAX_RESOURCE_DELTAS || deltaSize * 100 > state->baseSize * MAX_RESOURCE_DELTA_PERCENT)
+		{
+			UINT32 objectSize = 0;
+			UINT8* objectData = ms.encode(resource.get(), objectSize);
+
+			state->compactTask = Task::create("ResourceCompact", [this, state, resourceData, objectData, objectSize]()
+			{
+				UINT64 fileSize = writeResourceFile(state->filePath, resourceData, objectData, objectSize);
+
+				// On failure the existing file and its appended changes remain valid
+				if (fileSize != 0)
+				{
+					state->baseSize = fileSize;
+					state->fileSize = fileSize;
+					state->numDeltas = 0;
+				}
+			}, TaskPriority::Low);
+
+			TaskScheduler::instance().addTask(state->compactTask);
+		}
+	}
+
+	void Resources::saveIncremental(const HResource& resource, bool compress)
 	{
 		if (resource == nullptr)
 			return;
 
+		Path path;
+		if (getFilePathFromUUID(resource.getUUID(), path))
+			saveIncremental(resource, path, compress);
+	}
+
+	bool Resources::prepareForSave(const HResource& resource, const Path& filePath)
+	{
+		if (resource == nullptr)
+			return false;
+
 		if (!resource.isLoaded(false))
 		{
 			bool loadInProgress = false;
 			{
-				Lock lock(mInProgressResourcesMutex);
+				ProfiledLock lock(mInProgressResourcesMutex);
 				auto iterFind2 = mInProgressResources.find(resource.getUUID());
 				if (iterFind2 != mInProgressResources.end())
 					loadInProgress = true;
@@ -563,14 +1047,7 @@ namespace bs
 			if (loadInProgress) // If it's still loading wait until that finishes
 				resource.blockUntilLoaded();
 			else
-				return; // Nothing to save
-		}
-
-		bool fileExists = FileSystem::isFile(filePath);
-		if(fileExists && !overwrite)
-		{
-			LOGERR("Another file exists at the specified location. Not saving.");
-			return;
+				return false; // Nothing to save
 		}
 
 		if (!resource->mKeepSourceData)
@@ -579,16 +1056,26 @@ namespace bs
 				"not be available for saving. File path: " + filePath.toString());
 		}
 
-		mDefaultResourceManifest->registerResource(resource.getUUID(), filePath);
+		return true;
+	}
 
+	SPtr<SavedResourceData> Resources::createSavedResourceData(const HResource& resource, bool compress)
+	{
 		Vector<ResourceDependency> dependencyList = Utility::findResourceDependencies(*resource.get());
 		Vector<UUID> dependencyUUIDs(dependencyList.size());
 		for (UINT32 i = 0; i < (UINT32)dependencyList.size(); i++)
 			dependencyUUIDs[i] = dependencyList[i].resource.getUUID();
 
-		UINT32 compressionMethod = (compress && resource->isCompressible()) ? 1 : 0;
-		SPtr<SavedResourceData> resourceData = bs_shared_ptr_new<SavedResourceData>(dependencyUUIDs, 
-			resource->allowAsyncLoading(), compressionMethod);
+		UINT32 compressionMethod = (compress && resource->isCompressible()) ? COMPRESSION_SNAPPY_CHUNKED : COMPRESSION_NONE;
+		return bs_shared_ptr_new<SavedResourceData>(dependencyUUIDs, resource->allowAsyncLoading(), compressionMethod);
+	}
+
+	UINT64 Resources::writeResourceFile(const Path& filePath, const SPtr<SavedResourceData>& metaData, UINT8* objectData,
+		UINT32 objectSize)
+	{
+		SPtr<MemoryDataStream> objStream = bs_shared_ptr_new<MemoryDataStream>(objectData, objectSize);
+
+		bool fileExists = FileSystem::isFile(filePath);
 
 		Path parentDir = filePath.getDirectory();
 		if (!FileSystem::exists(parentDir))
@@ -609,7 +1096,7 @@ namespace bs
 				if(safetyCounter > 10)
 				{
 					LOGERR("Internal error. Unable to save resource due to not being able to find a unique filename.");
-					return;
+					return 0;
 				}
 
 				savePath.setFilename(UUIDGenerator::generateRandom().toString());
@@ -625,55 +1112,77 @@ namespace bs
 		std::ofstream stream;
 		stream.open(savePath.toPlatformString().c_str(), std::ios::out | std::ios::binary);
 		if (stream.fail())
+		{
 			LOGWRN("Failed to save file: \"" + filePath.toString() + "\". Error: " + strerror(errno) + ".");
-	
+			return 0;
+		}
+
+		UINT64 bytesWritten = 0;
+
 		// Write meta-data
 		{
 			MemorySerializer ms;
 			UINT32 numBytes = 0;
-			UINT8* bytes = ms.encode(resourceData.get(), numBytes);
+			UINT8* bytes = ms.encode(metaData.get(), numBytes);
 			
 			stream.write((char*)&numBytes, sizeof(numBytes));
 			stream.write((char*)bytes, numBytes);
+			bytesWritten += sizeof(numBytes) + numBytes;
 			
 			bs_free(bytes);
 		}
 
 		// Write object data
 		{
-			MemorySerializer ms;
-			UINT32 numBytes = 0;
-			UINT8* bytes = ms.encode(resource.get(), numBytes);
-
-			SPtr<MemoryDataStream> objStream = bs_shared_ptr_new<MemoryDataStream>(bytes, numBytes);
-			if (compressionMethod != 0)
+			if (metaData->getCompressionMethod() != COMPRESSION_NONE)
 			{
 				SPtr<DataStream> srcStream = std::static_pointer_cast<DataStream>(objStream);
-				objStream = Compression::compress(srcStream);
+				objStream = Compression::compressChunked(srcStream);
 			}
 
-			stream.write((char*)&numBytes, sizeof(numBytes));
+			stream.write((char*)&objectSize, sizeof(objectSize));
 			stream.write((char*)objStream->getPtr(), objStream->size());
+			bytesWritten += sizeof(objectSize) + objStream->size();
 		}
 
 		stream.close();
+		bool failed = stream.fail();
 		stream.clear();
 
+		if (failed)
+		{
+			LOGWRN("Failed to save file: \"" + filePath.toString() + "\". Error: " + strerror(errno) + ".");
+
+			if (fileExists)
+				FileSystem::remove(savePath);
+
+			return 0;
+		}
+
 		if (fileExists)
 		{
 			FileSystem::remove(filePath);
 			FileSystem::move(savePath, filePath);
 		}
+
+		return bytesWritten;
 	}
 
-	void Resources::save(const HResource& resource, bool compress)
+	void Resources::clearIncrementalSaveState(const UUID& uuid)
 	{
-		if (resource == nullptr)
-			return;
+		SPtr<IncrementalSaveState> state;
+		{
+			Lock lock(mIncrementalSaveMutex);
+			auto iterFind = mIncrementalSaveStates.find(uuid);
+			if (iterFind == mIncrementalSaveStates.end())
+				return;
 
-		Path path;
-		if (getFilePathFromUUID(resource.getUUID(), path))
-			save(resource, path, true, compress);
+			state = iterFind->second;
+			mIncrementalSaveStates.erase(iterFind);
+		}
+
+		if (state->compactTask != nullptr)
+			state->compactTask->wait();
 	}
 
 	void Resources::update(HResource& handle, const SPtr<Resource>& resource)
@@ -682,7 +1191,7 @@ namespace bs
 		handle.setHandleData(resource, uuid);
 
 		{
-			Lock lock(mLoadedResourceMutex);
+			ProfiledLock lock(mLoadedResourceMutex);
 			auto iterFind = mLoadedResources.find(uuid);
 			if (iterFind == mLoadedResources.end())
 			{
@@ -737,11 +1246,25 @@ namespace bs
 		return nullptr;
 	}
 
+	void Resources::registerResourceArchive(const SPtr<ResourceArchive>& archive)
+	{
+		auto findIter = std::find(mResourceArchives.begin(), mResourceArchives.end(), archive);
+		if (findIter == mResourceArchives.end())
+			mResourceArchives.push_back(archive);
+	}
+
+	void Resources::unregisterResourceArchive(const SPtr<ResourceArchive>& archive)
+	{
+		auto findIter = std::find(mResourceArchives.begin(), mResourceArchives.end(), archive);
+		if (findIter != mResourceArchives.end())
+			mResourceArchives.erase(findIter);
+	}
+
 	bool Resources::isLoaded(const UUID& uuid, bool checkInProgress)
 	{
 		if (checkInProgress)
 		{
-			Lock inProgressLock(mInProgressResourcesMutex);
+			ProfiledLock inProgressLock(mInProgressResourcesMutex);
 			auto iterFind2 = mInProgressResources.find(uuid);
 			if (iterFind2 != mInProgressResources.end())
 			{
@@ -750,7 +1273,7 @@ namespace bs
 		}
 
 		{
-			Lock loadedLock(mLoadedResourceMutex);
+			ProfiledLock loadedLock(mLoadedResourceMutex);
 			auto iterFind = mLoadedResources.find(uuid);
 			if (iterFind != mLoadedResources.end())
 			{
@@ -772,11 +1295,14 @@ namespace bs
 		HResource newHandle(obj, UUID);
 
 		{
-			Lock lock(mLoadedResourceMutex);
+			ProfiledLock lock(mLoadedResourceMutex);
 
 			LoadedResourceData& resData = mLoadedResources[UUID];
 			resData.resource = newHandle.getWeak();
-			mHandles[UUID] = newHandle.getWeak();
+
+			// Note: Registered while the loaded resource lock is held, so that load() can't see the resource as not
+			// loaded while the handle is already registered
+			registerHandle(UUID, newHandle);
 		}
 
 		return newHandle;
@@ -784,20 +1310,28 @@ namespace bs
 
 	HResource Resources::_getResourceHandle(const UUID& uuid)
 	{
-		Lock lock(mLoadedResourceMutex);
-		auto iterFind3 = mHandles.find(uuid);
-		if (iterFind3 != mHandles.end()) // Not loaded, but handle does exist
-		{
-			return iterFind3->second.lock();
-		}
+		HandleShard& shard = getHandleShard(uuid);
+		Lock lock(shard.mutex);
+
+		auto iterFind = shard.handles.find(uuid);
+		if (iterFind != shard.handles.end()) // Not loaded, but handle does exist
+			return iterFind->second.lock();
 
 		// Create new handle
 		HResource handle(uuid);
-		mHandles[uuid] = handle.getWeak();
+		shard.handles[uuid] = handle.getWeak();
 
 		return handle;
 	}
 
+	void Resources::registerHandle(const UUID& uuid, const HResource& handle)
+	{
+		HandleShard& shard = getHandleShard(uuid);
+		Lock lock(shard.mutex);
+
+		shard.handles[uuid] = handle.getWeak();
+	}
+
 	bool Resources::getFilePathFromUUID(const UUID& uuid, Path& filePath) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
@@ -832,7 +1366,7 @@ namespace bs
 		bool finishLoad = true;
 		Vector<ResourceLoadData*> dependantLoads;
 		{
-			Lock inProgresslock(mInProgressResourcesMutex);
+			ProfiledLock inProgresslock(mInProgressResourcesMutex);
 
 			auto iterFind = mInProgressResources.find(uuid);
 			if (iterFind != mInProgressResources.end())
@@ -857,7 +1391,7 @@ namespace bs
 				// by its dependencies.
 				if (myLoadData != nullptr && myLoadData->loadedData != nullptr)
 				{
-					Lock loadedLock(mLoadedResourceMutex);
+					ProfiledLock loadedLock(mLoadedResourceMutex);
 
 					mLoadedResources[uuid] = myLoadData->resData;
 					resource.setHandleData(myLoadData->loadedData, uuid);
@@ -886,12 +1420,22 @@ namespace bs
 		}
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData)
+	void Resources::loadCallback(const Path& filePath, const SPtr<ResourceArchive>& archive, HResource& resource,
+		bool loadWithSaveData)
 	{
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData);
+		SPtr<Resource> rawResource;
+		if (archive != nullptr)
+			rawResource = loadFromArchiveAndDeserialize(archive, resource.getUUID(), loadWithSaveData);
+		else
+			rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData);
 
+		finishLoad(resource, rawResource);
+	}
+
+	void Resources::finishLoad(HResource& resource, const SPtr<Resource>& rawResource)
+	{
 		{
-			Lock lock(mInProgressResourcesMutex);
+			ProfiledLock lock(mInProgressResourcesMutex);
 
 			// Check if all my dependencies are loaded
 			ResourceLoadData* myLoadData = mInProgressResources[resource.getUUID()];
@@ -902,6 +1446,174 @@ namespace bs
 		loadComplete(resource);
 	}
 
+	void Resources::queueRead(const ResourceReadRequest& request)
+	{
+		{
+			Lock lock(mIOMutex);
+
+			if (mIOThreads.empty())
+			{
+				for (UINT32 i = 0; i < NUM_IO_THREADS; i++)
+					mIOThreads.push_back(ThreadPool::instance().run("ResourceIO", std::bind(&Resources::runIOThread, this)));
+			}
+
+			INT32 idx = (INT32)request.priority - (INT32)TaskPriority::VeryLow;
+			idx = Math::clamp(idx, 0, (INT32)NUM_PRIORITIES - 1);
+
+			mReadQueues[idx].push_back(request);
+			mNumQueuedReads++;
+		}
+
+		mIOSignal.notify_one();
+	}
+
+	void Resources::runIOThread()
+	{
+		while (true)
+		{
+			ResourceReadRequest request;
+			{
+				Lock lock(mIOMutex);
+
+				// Stall while too many loads are waiting to be deserialized, so reads can't get arbitrarily far ahead
+				mIOSignal.wait(lock, [this]()
+				{
+					return (mNumQueuedReads > 0 && mNumBufferedLoads < MAX_BUFFERED_LOADS) || 
+						(mIOShutdown && mNumQueuedReads == 0);
+				});
+
+				if (mNumQueuedReads == 0)
+					break;
+
+				for (INT32 i = NUM_PRIORITIES - 1; i >= 0; i--)
+				{
+					if (!mReadQueues[i].empty())
+					{
+						request = mReadQueues[i].front();
+						mReadQueues[i].pop_front();
+						break;
+					}
+				}
+
+				mNumQueuedReads--;
+				mNumBufferedLoads++;
+			}
+
+			SPtr<DataStream> stream = readResourceData(request);
+
+			String name = request.archive != nullptr ? request.resource.getUUID().toString() : 
+				request.filePath.getFilename();
+
+			SPtr<Task> task = Task::create("Resource load: " + name, 
+				std::bind(&Resources::deserializeCallback, this, request, stream), request.priority);
+			TaskScheduler::instance().addTask(task);
+		}
+	}
+
+	SPtr<DataStream> Resources::readResourceData(const ResourceReadRequest& request)
+	{
+		Timer timer;
+
+		SPtr<DataStream> stream;
+		if (request.archive != nullptr)
+			stream = request.archive->openResource(request.resource.getUUID());
+		else
+		{
+			Lock fileLock = FileScheduler::getLock(request.filePath);
+
+			// See loadFromDiskAndDeserialize() for why source data is never mapped
+			if (request.keepSourceData)
+				stream = FileSystem::openFile(request.filePath, true);
+			else
+				stream = FileSystem::openFileMapped(request.filePath);
+
+			// Read the entire file so the worker doesn't have to touch the disk
+			if (stream != nullptr && !stream->isMemoryMapped())
+				stream = bs_shared_ptr_new<MemoryDataStream>(stream);
+		}
+
+		if (stream != nullptr && stream->isMemoryMapped())
+		{
+			// Touch every page of the mapping so it gets faulted in on this thread rather than during deserialization
+			const UINT8* data = std::static_pointer_cast<MemoryDataStream>(stream)->getPtr();
+			const size_t size = stream->size();
+
+			volatile UINT8 sink = 0;
+			for (size_t i = 0; i < size; i += 4096)
+				sink ^= data[i];
+		}
+
+		if (stream != nullptr)
+			mBytesRead += stream->size();
+
+		mReadTimeUs += timer.getMicroseconds();
+		return stream;
+	}
+
+	void Resources::deserializeCallback(const ResourceReadRequest& request, const SPtr<DataStream>& stream)
+	{
+		Timer timer;
+
+		SPtr<Resource> rawResource;
+		if (stream != nullptr)
+			rawResource = deserialize(stream, request.keepSourceData);
+
+		if (rawResource == nullptr)
+		{
+			if (request.archive != nullptr)
+			{
+				LOGERR("Unable to load resource \"" + request.resource.getUUID().toString() + "\" from archive \"" +
+					request.archive->getPath().toString() + "\"");
+			}
+			else
+				LOGERR("Unable to load resource at path \"" + request.filePath.toString() + "\"");
+		}
+
+		mDeserializeTimeUs += timer.getMicroseconds();
+
+		{
+			Lock lock(mIOMutex);
+			mNumBufferedLoads--;
+		}
+
+		mIOSignal.notify_all();
+
+		HResource resource = request.resource;
+		finishLoad(resource, rawResource);
+
+		mNumLoaded++;
+	}
+
+	void Resources::stopIOThreads()
+	{
+		{
+			Lock lock(mIOMutex);
+			mIOShutdown = true;
+		}
+
+		mIOSignal.notify_all();
+
+		for (auto& thread : mIOThreads)
+			thread.blockUntilComplete();
+
+		mIOThreads.clear();
+	}
+
+	ResourceLoadStats Resources::getLoadStats() const
+	{
+		ResourceLoadStats stats;
+		stats.numLoaded = mNumLoaded.load();
+		stats.bytesRead = mBytesRead.load();
+		stats.readTimeUs = mReadTimeUs.load();
+		stats.deserializeTimeUs = mDeserializeTimeUs.load();
+
+		Lock lock(mIOMutex);
+		stats.numQueuedReads = mNumQueuedReads;
+		stats.numBufferedLoads = mNumBufferedLoads;
+
+		return stats;
+	}
+
 	BS_CORE_EXPORT Resources& gResources()
 	{
 		return Resources::instance();
@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -39,6 +40,44 @@ namespace bs
 	typedef Flags<ResourceLoadFlag> ResourceLoadFlags;
 	BS_FLAGS_OPERATORS(ResourceLoadFlag);
 
+	/** Statistics about resources loaded asynchronously. */
+	struct ResourceLoadStats
+	{
+		/** Number of asynchronous loads that have completed. */
+		UINT64 numLoaded = 0;
+
+		/** Total number of bytes read by the I/O threads. */
+		UINT64 bytesRead = 0;
+
+		/** Total time the I/O threads spent reading resource data, in microseconds. */
+		UINT64 readTimeUs = 0;
+
+		/** Total time the worker threads spent deserializing resources, in microseconds. */
+		UINT64 deserializeTimeUs = 0;
+
+		/** Number of loads currently waiting for an I/O thread. */
+		UINT32 numQueuedReads = 0;
+
+		/** Number of loads whose data has been read and is waiting to be, or is being, deserialized. */
+		UINT32 numBufferedLoads = 0;
+	};
+
+	/** Memory used by resources of a single type. Sizes are estimated from the size of the serialized resource data. */
+	struct ResourceMemoryStats
+	{
+		/** Number of loaded resources, including the ones in the resource cache. */
+		UINT32 numLoaded = 0;
+
+		/** Estimated number of bytes used by loaded resources, including the ones in the resource cache. */
+		UINT64 loadedBytes = 0;
+
+		/** Number of unreferenced resources kept in the resource cache. */
+		UINT32 numCached = 0;
+
+		/** Estimated number of bytes used by unreferenced resources kept in the resource cache. */
+		UINT64 cachedBytes = 0;
+	};
+
 	/**
 	 * Manager for dealing with all engine resources. It allows you to save new resources and load existing ones.
 	 *
@@ -61,6 +100,16 @@ namespace bs
 			UINT32 numInternalRefs;
 		};
 
+		/** Asynchronous load waiting to be read by one of the I/O threads. */
+		struct ResourceReadRequest
+		{
+			HResource resource;
+			Path filePath;
+			SPtr<ResourceArchive> archive;
+			bool keepSourceData = false;
+			TaskPriority priority = TaskPriority::Normal;
+		};
+
 		/** Information about a resource that's currently being loaded. */
 		struct ResourceLoadData
 		{
@@ -75,6 +124,25 @@ namespace bs
 			bool notifyImmediately;
 		};
 
+		/** Unreferenced resource kept loaded by the resource cache. */
+		struct CachedResource
+		{
+			HResource resource;
+			UINT32 size;
+		};
+
+		/** Keeps track of the last state of a resource written by saveIncremental(). */
+		struct IncrementalSaveState
+		{
+			Path filePath;
+			SPtr<SavedResourceData> metaData;
+			SPtr<SerializedObject> savedObject; /**< Intermediate form of the resource as of the last save. */
+			UINT64 baseSize = 0; /**< Size of the full copy of the resource, before any appended changes. */
+			UINT64 fileSize = 0; /**< Total size of the file, including any appended changes. */
+			UINT32 numDeltas = 0;
+			SPtr<Task> compactTask; /**< Task re-writing the file in full, if one was started. */
+		};
+
 	public:
 		Resources();
 		~Resources();
@@ -117,18 +185,25 @@ namespace bs
 		 * done. Use ResourceHandle<T>::isLoaded to check if resource has been loaded, or 
 		 * ResourceHandle<T>::blockUntilLoaded to wait until load completes.
 		 *
+		 * Loading happens in two stages: resource data is first read by one of a small set of dedicated I/O threads,
+		 * after which it is deserialized on a TaskScheduler worker. Loads with higher priority are read and deserialized
+		 * first. Dependencies are loaded with the same priority as the resource referencing them.
+		 *
 		 * @param[in]	filePath	Full pathname of the file.
 		 * @param[in]	loadFlags	Flags used to control the load process.
+		 * @param[in]	priority	Priority of the load relative to other asynchronous loads.
 		 *			
 		 * @see		load(const Path&, ResourceLoadFlags)
 		 */
-		HResource loadAsync(const Path& filePath, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default);
+		HResource loadAsync(const Path& filePath, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default,
+			TaskPriority priority = TaskPriority::Normal);
 
 		/** @copydoc loadAsync */
 		template <class T>
-		ResourceHandle<T> loadAsync(const Path& filePath, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default)
+		ResourceHandle<T> loadAsync(const Path& filePath, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default,
+			TaskPriority priority = TaskPriority::Normal)
 		{
-			return static_resource_cast<T>(loadAsync(filePath, loadFlags));
+			return static_resource_cast<T>(loadAsync(filePath, loadFlags, priority));
 		}
 
 		/**
@@ -138,14 +213,17 @@ namespace bs
 		 * @param[in]	async		If true resource will be loaded asynchronously. Handle to non-loaded resource will be
 		 *							returned immediately while loading will continue in the background.		
 		 * @param[in]	loadFlags	Flags used to control the load process.
+		 * @param[in]	priority	Priority of the load relative to other asynchronous loads. Ignored for synchronous loads.
 		 *													
 		 * @see		load(const Path&, bool)
 		 */
-		HResource loadFromUUID(const UUID& uuid, bool async = false, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default);
+		HResource loadFromUUID(const UUID& uuid, bool async = false, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default,
+			TaskPriority priority = TaskPriority::Normal);
 
 		/**
 		 * Releases an internal reference to the resource held by the resources system. This allows the resource to be 
-		 * unloaded when it goes out of scope, if the resource was loaded with @p keepInternalReference parameter.
+		 * unloaded when it goes out of scope, if the resource was loaded with @p keepInternalReference parameter. If
+		 * the resource cache is enabled the resource is moved to the cache instead of being unloaded immediately.
 		 *
 		 * Alternatively you can also skip manually calling release() and call unloadAllUnused() which will unload all 
 		 * resources that do not have any external references, but you lose the fine grained control of what will be 
@@ -156,7 +234,8 @@ namespace bs
 		void release(ResourceHandleBase& resource);
 
 		/**
-		 * Finds all resources that aren't being referenced outside of the resources system and unloads them.
+		 * Finds all resources that aren't being referenced outside of the resources system and unloads them. Also
+		 * unloads all resources in the resource cache.
 		 * 			
 		 * @see		release(ResourceHandleBase&)
 		 */
@@ -165,6 +244,37 @@ namespace bs
 		/** Forces unload of all resources, whether they are being used or not. */
 		void unloadAll();
 
+		/**
+		 * Sets the maximum amount of memory, in bytes, that can be used by the resource cache. When the last reference
+		 * to a resource loaded from disk (or from an archive) is lost, the resource is kept loaded in the cache instead
+		 * of being unloaded, so that loading it again doesn't need to read it from disk. Once the cache grows over the
+		 * budget the least recently used resources are unloaded, see _updateCache(). Memory used by a resource is
+		 * estimated from the size of its serialized data. Zero disables the cache, which is the default.
+		 */
+		void setCacheBudget(UINT64 bytes);
+
+		/** Returns the budget set by setCacheBudget(). */
+		UINT64 getCacheBudget() const { return mCacheBudget.load(std::memory_order_relaxed); }
+
+		/**
+		 * Sets the maximum amount of time, in microseconds, spent unloading resources from the resource cache on a
+		 * single _updateCache() call. At least one resource is unloaded per call regardless of the limit, if the cache
+		 * is over budget. Default is 1000.
+		 */
+		void setCacheEvictionTime(UINT64 us) { mCacheEvictionTime = us; }
+
+		/** Returns the time limit set by setCacheEvictionTime(). */
+		UINT64 getCacheEvictionTime() const { return mCacheEvictionTime; }
+
+		/** Returns the estimated number of bytes used by resources currently in the resource cache. */
+		UINT64 getCacheSize() const;
+
+		/** Unloads all resources in the resource cache that aren't referenced. */
+		void clearCache();
+
+		/** Returns the estimated memory used by loaded resources, grouped by their RTTI type ID. */
+		UnorderedMap<UINT32, ResourceMemoryStats> getMemoryUsage() const;
+
 		/**
 		 * Saves the resource at the specified location.
 		 *
@@ -201,6 +311,36 @@ namespace bs
 		 */
 		void save(const HResource& resource, bool compress = false);
 
+		/**
+		 * Saves the resource at the specified location, writing only the changes made since the last incremental save
+		 * where possible. Useful for large resources that are saved repeatedly with small modifications (e.g. in an
+		 * editor).
+		 *
+		 * The first incremental save of a resource writes a full copy and keeps an in-memory snapshot of the saved state.
+		 * Subsequent saves diff the resource against that snapshot and append only the difference to the end of the file.
+		 * Appended changes are applied automatically when the resource is loaded. Once the appended changes grow too
+		 * large relative to the full copy the file is re-written in full on a worker thread.
+		 *
+		 * A full save is performed instead of appending if the file was modified since the last incremental save, if the
+		 * resource's dependencies or compression changed, or if the resource was never saved incrementally.
+		 *
+		 * @param[in]	resource 	Handle to the resource.
+		 * @param[in]	filePath 	Full pathname of the file to save as. Any existing file will be overwritten.
+		 * @param[in]	compress	Should the full copy of the resource be compressed before saving. Appended changes
+		 *							are never compressed.
+		 *
+		 * @note	Same restrictions as for save(const HResource&, const Path&, bool, bool) apply.
+		 */
+		void saveIncremental(const HResource& resource, const Path& filePath, bool compress = false);
+
+		/**
+		 * Saves an existing resource to its previous location, writing only the changes made since the last incremental
+		 * save where possible.
+		 *
+		 * @see		saveIncremental(const HResource&, const Path&, bool)
+		 */
+		void saveIncremental(const HResource& resource, bool compress = false);
+
 		/**
 		 * Updates an existing resource handle with a new resource. Caller must ensure that new resource type matches the 
 		 * original resource type.
@@ -251,6 +391,21 @@ namespace bs
 		 */
 		SPtr<ResourceManifest> getResourceManifest(const String& name) const;
 
+		/** Returns statistics about asynchronous loads performed since the resources module was started. */
+		ResourceLoadStats getLoadStats() const;
+
+		/**
+		 * Registers a resource archive whose resources can be loaded by UUID, the same as resources registered in a
+		 * resource manifest. Manifests are searched first, after which archives are searched in reverse registration
+		 * order.
+		 *
+		 * @see		ResourceArchive
+		 */
+		void registerResourceArchive(const SPtr<ResourceArchive>& archive);
+
+		/**	Unregisters a resource archive previously registered with registerResourceArchive(). */
+		void unregisterResourceArchive(const SPtr<ResourceArchive>& archive);
+
 		/** Attempts to retrieve file path from the provided UUID. Returns true if successful, false otherwise. */
 		bool getFilePathFromUUID(const UUID& uuid, Path& filePath) const;
 
@@ -299,9 +454,18 @@ namespace bs
 		 */
 		HResource _createResourceHandle(const SPtr<Resource>& obj, const UUID& UUID);
 
-		/** Returns an existing handle for the specified UUID if one exists, or creates a new one. */
+		/** 
+		 * Returns an existing handle for the specified UUID if one exists, or creates a new one. Only locks the part of
+		 * the handle registry the UUID belongs to, so it doesn't contend with loads or with lookups of other UUIDs.
+		 */
 		HResource _getResourceHandle(const UUID& uuid);
 
+		/**
+		 * Unloads the least recently used resources from the resource cache until the cache is within its budget, or
+		 * the time limit set by setCacheEvictionTime() is reached. Called once per frame.
+		 */
+		void _updateCache();
+
 		/** @} */
 	private:
 		friend class ResourceHandleBase;
@@ -309,34 +473,166 @@ namespace bs
 		/**
 		 * Starts resource loading or returns an already loaded resource. Both UUID and filePath must match the	same 
 		 * resource, although you may provide an empty path in which case the resource will be retrieved from memory if its
-		 * currently loaded.
+		 * currently loaded. If an archive is provided the resource is read from the archive and the file path is ignored.
 		 */
-		HResource loadInternal(const UUID& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags);
+		HResource loadInternal(const UUID& UUID, const Path& filePath, const SPtr<ResourceArchive>& archive,
+			bool synchronous, ResourceLoadFlags loadFlags, TaskPriority priority = TaskPriority::Normal);
 
 		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
 		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData);
 
+		/** Reads and deserializes a resource stored in an archive. Called from various worker threads. */
+		SPtr<Resource> loadFromArchiveAndDeserialize(const SPtr<ResourceArchive>& archive, const UUID& uuid,
+			bool loadWithSaveData);
+
+		/** Deserializes a resource from a stream containing data in the format written by save(). */
+		SPtr<Resource> deserialize(SPtr<DataStream> stream, bool loadWithSaveData);
+
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource);
 
 		/**	Callback triggered when the task manager is ready to process the loading task. */
-		void loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData);
+		void loadCallback(const Path& filePath, const SPtr<ResourceArchive>& archive, HResource& resource,
+			bool loadWithSaveData);
+
+		/** Registers the deserialized resource with its in-progress load and notifies anything waiting on it. */
+		void finishLoad(HResource& resource, const SPtr<Resource>& rawResource);
+
+		/** Queues an asynchronous load for reading on one of the I/O threads. Starts the threads if needed. */
+		void queueRead(const ResourceReadRequest& request);
+
+		/** Main loop of an I/O thread. Reads queued resources and hands them off to TaskScheduler for deserialization. */
+		void runIOThread();
+
+		/** Reads the data for a queued load. Called on the I/O threads. */
+		SPtr<DataStream> readResourceData(const ResourceReadRequest& request);
+
+		/** Deserializes data read by an I/O thread and completes the load. Called on TaskScheduler workers. */
+		void deserializeCallback(const ResourceReadRequest& request, const SPtr<DataStream>& stream);
+
+		/** Stops the I/O threads once all queued reads have been processed. */
+		void stopIOThreads();
 
 		/**	Destroys a resource, freeing its memory. */
 		void destroy(ResourceHandleBase& resource);
 
+		/** 
+		 * Called when the last reference to a resource is lost. Moves the resource to the resource cache if possible,
+		 * or destroys it otherwise.
+		 */
+		void onLastReferenceLost(ResourceHandleBase& resource);
+
+		/** 
+		 * Removes a resource from the resource cache. Returns the handle held by the cache, or an empty handle if the
+		 * resource isn't cached. The returned handle should be released outside of any locks.
+		 */
+		HResource removeFromCache(const UUID& uuid);
+
+		/** 
+		 * Unloads the least recently used resource from the resource cache, unless it was referenced again through
+		 * some other handle. Returns false if the cache is empty.
+		 */
+		bool evictOldestCached();
+
+		/**
+		 * Waits until the resource is loaded if a load is in progress. Returns false if the resource isn't loaded and
+		 * there is nothing to save.
+		 */
+		bool prepareForSave(const HResource& resource, const Path& filePath);
+
+		/** Creates the meta-data written at the start of the file when saving the provided resource. */
+		SPtr<SavedResourceData> createSavedResourceData(const HResource& resource, bool compress);
+
+		/**
+		 * Writes a full resource file in the format expected by deserialize(), replacing any existing file only once the
+		 * write succeeds. Takes ownership of @p objectData. Returns the number of bytes written, or 0 on failure. Can be
+		 * called from any thread.
+		 */
+		UINT64 writeResourceFile(const Path& filePath, const SPtr<SavedResourceData>& metaData, UINT8* objectData,
+			UINT32 objectSize);
+
+		/** Forgets any state kept by saveIncremental() for the resource, waiting on any in-progress compaction first. */
+		void clearIncrementalSaveState(const UUID& uuid);
+
+		/** Part of the registry of all resource handles, guarded by its own mutex. */
+		struct HandleShard
+		{
+			Mutex mutex;
+			FlatHashMap<UUID, WeakResourceHandle<Resource>> handles;
+		};
+
+		/** Returns the part of the handle registry responsible for the provided UUID. */
+		HandleShard& getHandleShard(const UUID& uuid)
+		{
+			return mHandleShards[std::hash<UUID>()(uuid) % NUM_HANDLE_SHARDS];
+		}
+
+		/** Registers the handle under the provided UUID, replacing any existing handle. */
+		void registerHandle(const UUID& uuid, const HResource& handle);
+
 	private:
+		/** 
+		 * Number of independently locked parts the handle registry is split into, so that threads looking up different
+		 * handles rarely wait on each other.
+		 */
+		static constexpr UINT32 NUM_HANDLE_SHARDS = 16;
+
+		/** Number of dedicated threads reading resource data for asynchronous loads. */
+		static constexpr UINT32 NUM_IO_THREADS = 2;
+
+		/**
+		 * Maximum number of loads whose data has been read but not yet deserialized. I/O threads stall once reached,
+		 * limiting the amount of memory held by loads in flight.
+		 */
+		static constexpr UINT32 MAX_BUFFERED_LOADS = 16;
+
+		/** Number of different TaskPriority values. */
+		static constexpr UINT32 NUM_PRIORITIES = 5;
+
+		/** Maximum number of changes appended by saveIncremental() before the file is re-written in full. */
+		static constexpr UINT32 MAX_RESOURCE_DELTAS = 32;
+
+		/**
+		 * Maximum size of the changes appended by saveIncremental(), as a percentage of the full copy's size, before the
+		 * file is re-written in full.
+		 */
+		static constexpr UINT32 MAX_RESOURCE_DELTA_PERCENT = 50;
+
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
+		Vector<SPtr<ResourceArchive>> mResourceArchives;
 
-		Mutex mInProgressResourcesMutex;
-		Mutex mLoadedResourceMutex;
+		ProfiledMutex mInProgressResourcesMutex{"Resources in progress"};
+		mutable ProfiledMutex mLoadedResourceMutex{"Resources loaded"};
 		RecursiveMutex mDestroyMutex;
 
-		UnorderedMap<UUID, WeakResourceHandle<Resource>> mHandles;
-		UnorderedMap<UUID, LoadedResourceData> mLoadedResources;
+		HandleShard mHandleShards[NUM_HANDLE_SHARDS];
+		FlatHashMap<UUID, LoadedResourceData> mLoadedResources;
 		UnorderedMap<UUID, ResourceLoadData*> mInProgressResources; // Resources that are being asynchronously loaded
 		UnorderedMap<UUID, Vector<ResourceLoadData*>> mDependantLoads; // Allows dependency to be notified when a dependant is loaded
+
+		Vector<HThread> mIOThreads;
+		Deque<ResourceReadRequest> mReadQueues[NUM_PRIORITIES];
+		UINT32 mNumQueuedReads = 0;
+		UINT32 mNumBufferedLoads = 0;
+		bool mIOShutdown = false;
+		mutable Mutex mIOMutex;
+		Signal mIOSignal;
+
+		UnorderedMap<UUID, SPtr<IncrementalSaveState>> mIncrementalSaveStates;
+		Mutex mIncrementalSaveMutex;
+
+		std::atomic<UINT64> mNumLoaded{0};
+		std::atomic<UINT64> mBytesRead{0};
+		std::atomic<UINT64> mReadTimeUs{0};
+		std::atomic<UINT64> mDeserializeTimeUs{0};
+
+		List<CachedResource> mCache; // Least recently used first
+		UnorderedMap<UUID, List<CachedResource>::iterator> mCacheLookup;
+		UINT64 mCacheSize = 0;
+		std::atomic<UINT64> mCacheBudget{0};
+		UINT64 mCacheEvictionTime = 1000;
+		mutable Mutex mCacheMutex;
 	};
 
 	/** Provides easier access to Resources manager. */
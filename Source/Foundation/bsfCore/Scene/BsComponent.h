@@ -20,12 +20,42 @@ namespace bs
 		 * Note that this flag must be specified on component creation, in its constructor and any later changes
 		 * to the flag will be ignored.
 		 */
-		AlwaysRun = 1 
+		AlwaysRun = 1,
+
+		/**
+		 * Calls update() on the component together with all other components of the same type that have this flag set.
+		 * Such components are updated after the ones without the flag, in sequence by type, which results in more cache
+		 * friendly iteration. Off by default. Must be specified on component creation, in its constructor.
+		 */
+		BatchUpdate = 1 << 1,
+
+		/**
+		 * Same as BatchUpdate, except that update() and fixedUpdate() may additionally be called on multiple components
+		 * of the same type in parallel, from worker threads. Only set this flag if the methods only access the state of
+		 * the component's own scene object (and its components), and don't create, destroy or re-parent any scene
+		 * objects or components. Components without the flag are always updated on the sim thread. Off by default.
+		 * Must be specified on component creation, in its constructor.
+		 */
+		ParallelUpdate = 1 << 2
 	};
 
 	typedef Flags<ComponentFlag> ComponentFlags;
 	BS_FLAGS_OPERATORS(ComponentFlag)
 
+	/** 
+	 * Determines the order in which update() and fixedUpdate() are called on components. All components in a phase are
+	 * updated before any components of the next phase.
+	 */
+	enum class ComponentUpdatePhase
+	{
+		/** Updated before all other components. */
+		Early,
+		/** Updated after Early and before Late components. Default phase. */
+		Default,
+		/** Updated after all other components, e.g. for logic that depends on the results of other components. */
+		Late
+	};
+
 	/** 
 	 * Components represent primary logic elements in the scene. They are attached to scene objects. 
 	 *
@@ -158,6 +188,15 @@ namespace bs
 		/** Checks if the component has a certain flag enabled. */
 		bool hasFlag(ComponentFlag flag) const { return mFlags.isSet(flag); }
 
+		/** 
+		 * Sets the phase in which the component is updated. Should be set in the component's constructor, changes are
+		 * ignored until the component is stopped and started again.
+		 */
+		void setUpdatePhase(ComponentUpdatePhase phase) { mUpdatePhase = phase; }
+
+		/** Returns the phase in which the component is updated. */
+		ComponentUpdatePhase getUpdatePhase() const { return mUpdatePhase; }
+
 		/** Sets an index that uniquely identifies a component with the SceneManager. */
 		void setSceneManagerId(UINT32 id) { mSceneManagerId = id; }
 
@@ -181,7 +220,10 @@ namespace bs
 		HComponent mThisHandle;
 		TransformChangedFlags mNotifyFlags;
 		ComponentFlags mFlags;
+		ComponentUpdatePhase mUpdatePhase = ComponentUpdatePhase::Default;
 		UINT32 mSceneManagerId;
+		UINT32 mUpdateBatchIdx = (UINT32)-1;
+		UINT32 mUpdateBatchEntryIdx = (UINT32)-1;
 
 	private:
 		HSceneObject mParent;
@@ -2,11 +2,32 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Scene/BsGameObjectManager.h"
 #include "Scene/BsGameObject.h"
+#include "CoreThread/BsCoreObject.h"
 
 namespace bs
 {
+	/** Flags that control how are game object handles deserialized on the current thread. */
+	static BS_THREADLOCAL UINT32 sDeserializationMode = GODM_UseNewIds | GODM_BreakExternal;
+
+	struct GameObjectManager::DeserializationContext
+	{
+		/** True if the session runs outside of the sim thread. */
+		bool detached = false;
+
+		FlatHashMap<UINT64, UINT64> idMapping;
+		FlatHashMap<UINT64, SPtr<GameObjectHandleData>> unresolvedHandleData;
+		Vector<UnresolvedHandle> unresolvedHandles;
+		Vector<std::function<void()>> endCallbacks;
+
+		/** Objects created by a detached session, mapped by their new IDs. Registered once the session ends. */
+		FlatHashMap<UINT64, GameObjectHandleBase> stagedObjects;
+
+		/** Handles of a detached session pointing outside of the deserialized set, along with their resolve flags. */
+		Vector<std::pair<UnresolvedHandle, UINT32>> externalHandles;
+	};
+
 	GameObjectManager::GameObjectManager()
-		:mNextAvailableID(1), mIsDeserializationActive(false), mGODeserializationMode(GODM_UseNewIds | GODM_BreakExternal)
+		:mNextAvailableID(1), mSimThreadId(BS_THREAD_CURRENT_ID)
 	{
 
 	}
@@ -14,34 +35,49 @@ namespace bs
 	GameObjectManager::~GameObjectManager()
 	{
 		destroyQueuedObjects();
+		releasePendingObjects((UINT32)mPendingRelease.size());
 	}
 
 	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const
 	{
-		auto iterFind = mObjects.find(id);
-
-		if (iterFind != mObjects.end())
-			return iterFind->second;
+		GameObjectHandleBase object;
+		if (findObject(getActiveContext(), id, object))
+			return object;
 
 		return nullptr;
 	}
 
 	bool GameObjectManager::tryGetObject(UINT64 id, GameObjectHandleBase& object) const
 	{
-		auto iterFind = mObjects.find(id);
+		return findObject(getActiveContext(), id, object);
+	}
+
+	bool GameObjectManager::objectExists(UINT64 id) const
+	{
+		GameObjectHandleBase object;
+		return findObject(getActiveContext(), id, object);
+	}
 
-		if (iterFind != mObjects.end())
+	bool GameObjectManager::findObject(const DeserializationContext* context, UINT64 id, 
+		GameObjectHandleBase& object) const
+	{
+		// Registered objects can only be accessed from the sim thread, so detached sessions only see their own objects
+		if (context != nullptr && context->detached)
 		{
+			auto iterFind = context->stagedObjects.find(id);
+			if (iterFind == context->stagedObjects.end())
+				return false;
+
 			object = iterFind->second;
 			return true;
 		}
 
-		return false;
-	}
+		auto iterFind = mObjects.find(id);
+		if (iterFind == mObjects.end())
+			return false;
 
-	bool GameObjectManager::objectExists(UINT64 id) const
-	{
-		return mObjects.find(id) != mObjects.end();
+		object = iterFind->second;
+		return true;
 	}
 
 	void GameObjectManager::remapId(UINT64 oldId, UINT64 newId)
@@ -49,8 +85,9 @@ namespace bs
 		if (oldId == newId)
 			return;
 
-		mObjects[newId] = mObjects[oldId];
+		GameObjectHandleBase handle = mObjects[oldId];
 		mObjects.erase(oldId);
+		mObjects[newId] = handle;
 	}
 
 	void GameObjectManager::queueForDestroy(const GameObjectHandleBase& object)
@@ -64,51 +101,87 @@ namespace bs
 
 	void GameObjectManager::destroyQueuedObjects()
 	{
+		if (mQueuedForDestroy.empty() && mPendingRelease.empty())
+			return;
+
+		// Any core objects released by the destroyed objects are released on the core thread all at once
+		CoreObject::_beginDestroyBatch();
+
+		// Note: Objects can be destroyed by their parents before their own entry is reached
 		for (auto& objPair : mQueuedForDestroy)
-			objPair.second->destroyInternal(objPair.second, true);
+		{
+			if (!objPair.second.isDestroyed())
+				objPair.second->destroyInternal(objPair.second, true);
+		}
 
 		mQueuedForDestroy.clear();
+
+		if (mReleaseBudget > 0)
+			releasePendingObjects(mReleaseBudget);
+
+		CoreObject::_endDestroyBatch();
+	}
+
+	void GameObjectManager::releaseObject(GameObjectHandleBase& object)
+	{
+		if (mReleaseBudget > 0 && object.mData->mPtr != nullptr && object.mData->mPtr->object != nullptr)
+			mPendingRelease.push_back(object.mData->mPtr->object);
+
+		object.destroy();
+	}
+
+	void GameObjectManager::releasePendingObjects(UINT32 count)
+	{
+		count = std::min(count, (UINT32)mPendingRelease.size());
+		if (count == 0)
+			return;
+
+		CoreObject::_beginDestroyBatch();
+
+		// Objects queued first are released first
+		for (UINT32 i = 0; i < count; i++)
+			mPendingRelease[i] = nullptr;
+
+		mPendingRelease.erase(mPendingRelease.begin(), mPendingRelease.begin() + count);
+
+		CoreObject::_endDestroyBatch();
 	}
 
 	GameObjectHandleBase GameObjectManager::registerObject(const SPtr<GameObject>& object, UINT64 originalId)
 	{
-		object->initialize(object, mNextAvailableID);
+		const UINT64 id = mNextAvailableID++;
+		object->initialize(object, id);
 
 		// If deserialization is active we must ensure all handles pointing to the same object share GameObjectHandleData,
 		// so check if any handles referencing this object have been created. See ::registerUnresolvedHandle for
 		// further explanation.
-		if (mIsDeserializationActive)
+		DeserializationContext* context = getActiveContext();
+		if (context != nullptr)
 		{
 			assert(originalId != 0 && "You must provide an original ID when registering a deserialized game object.");
 
-			auto iterFind = mUnresolvedHandleData.find(originalId);
-			if (iterFind != mUnresolvedHandleData.end())
+			GameObjectHandleBase handle;
+
+			auto iterFind = context->unresolvedHandleData.find(originalId);
+			if (iterFind != context->unresolvedHandleData.end())
 			{
-				GameObjectHandleBase handle;
 				handle.mData = iterFind->second;
 				handle._setHandleData(object);
-
-				mObjects[mNextAvailableID] = handle;
-				mIdMapping[originalId] = mNextAvailableID;
-				mNextAvailableID++;
-
-				return handle;
 			}
 			else
-			{
-				GameObjectHandleBase handle(object);
+				handle = GameObjectHandleBase(object);
 
-				mObjects[mNextAvailableID] = handle;
-				mIdMapping[originalId] = mNextAvailableID;
-				mNextAvailableID++;
+			if (context->detached)
+				context->stagedObjects[id] = handle;
+			else
+				mObjects[id] = handle;
 
-				return handle;
-			}
+			context->idMapping[originalId] = id;
+			return handle;
 		}
 
 		GameObjectHandleBase handle(object);
-		mObjects[mNextAvailableID] = handle;
-		mNextAvailableID++;
+		mObjects[id] = handle;
 
 		return handle;
 	}
@@ -118,46 +191,129 @@ namespace bs
 		mObjects.erase(object->getInstanceId());
 
 		onDestroyed(object);
-		object.destroy();
+		releaseObject(object);
+	}
+
+	void GameObjectManager::unregisterObjects(GameObjectHandleBase* objects, UINT32 count)
+	{
+		for (UINT32 i = 0; i < count; i++)
+			mObjects.erase(objects[i]->getInstanceId());
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			onDestroyed(objects[i]);
+			releaseObject(objects[i]);
+		}
+	}
+
+	void GameObjectManager::finalizeStagedObjects(bool all)
+	{
+		Lock lock(mStagedMutex);
+
+		if (mStagedObjects.empty() && mStagedHandles.empty())
+			return;
+
+		UINT32 count = (UINT32)mStagedObjects.size();
+		if (!all && mFinalizeBudget > 0)
+			count = std::min(count, mFinalizeBudget);
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			// Note: Objects can be destroyed before they get registered
+			GameObjectHandleBase& handle = mStagedObjects[i];
+			if (!handle.isDestroyed())
+				mObjects[handle->getInstanceId()] = handle;
+		}
+
+		mStagedObjects.erase(mStagedObjects.begin(), mStagedObjects.begin() + count);
+
+		// External handles might point to objects staged by another session, so wait until all of them are registered
+		if (!mStagedObjects.empty())
+			return;
+
+		for (auto& entry : mStagedHandles)
+		{
+			UnresolvedHandle& data = entry.first;
+
+			auto iterFind = mObjects.find(data.originalInstanceId);
+			if (iterFind != mObjects.end())
+				data.handle._resolve(iterFind->second);
+			else
+			{
+				if ((entry.second & GODM_KeepMissing) == 0)
+					data.handle._resolve(nullptr);
+			}
+		}
+
+		mStagedHandles.clear();
+	}
+
+	GameObjectManager::DeserializationContext*& GameObjectManager::getActiveContext()
+	{
+		static BS_THREADLOCAL DeserializationContext* context = nullptr;
+		return context;
 	}
 
 	void GameObjectManager::startDeserialization()
 	{
-		assert(!mIsDeserializationActive);
+		DeserializationContext*& context = getActiveContext();
+		assert(context == nullptr);
 
-		mIsDeserializationActive = true;
+		context = bs_new<DeserializationContext>();
+		context->detached = BS_THREAD_CURRENT_ID != mSimThreadId;
 	}
 
 	void GameObjectManager::endDeserialization()
 	{
-		assert(mIsDeserializationActive);
+		DeserializationContext*& context = getActiveContext();
+		assert(context != nullptr);
 
-		for (auto& unresolvedHandle : mUnresolvedHandles)
-			resolveDeserializedHandle(unresolvedHandle, mGODeserializationMode);
+		for (auto& unresolvedHandle : context->unresolvedHandles)
+			resolveDeserializedHandle(unresolvedHandle, sDeserializationMode);
 
-		for (auto iter = mEndCallbacks.rbegin(); iter != mEndCallbacks.rend(); ++iter)
+		for (auto iter = context->endCallbacks.rbegin(); iter != context->endCallbacks.rend(); ++iter)
 		{
 			(*iter)();
 		}
 
-		mIsDeserializationActive = false;
-		mActiveDeserializedObject = nullptr;
-		mIdMapping.clear();
-		mUnresolvedHandles.clear();
-		mEndCallbacks.clear();
-		mUnresolvedHandleData.clear();
+		// Objects deserialized outside of the sim thread get registered on the next finalizeStagedObjects() call
+		if (context->detached && (!context->stagedObjects.empty() || !context->externalHandles.empty()))
+		{
+			Lock lock(mStagedMutex);
+
+			for (auto& entry : context->stagedObjects)
+				mStagedObjects.push_back(entry.second);
+
+			for (auto& entry : context->externalHandles)
+				mStagedHandles.push_back(entry);
+		}
+
+		bs_delete(context);
+		context = nullptr;
+	}
+
+	bool GameObjectManager::isGameObjectDeserializationActive() const
+	{
+		return getActiveContext() != nullptr;
+	}
+
+	bool GameObjectManager::isGameObjectDeserializationDetached() const
+	{
+		DeserializationContext* context = getActiveContext();
+		return context != nullptr && context->detached;
 	}
 
 	void GameObjectManager::resolveDeserializedHandle(UnresolvedHandle& data, UINT32 flags)
 	{
-		assert(mIsDeserializationActive);
+		DeserializationContext* context = getActiveContext();
+		assert(context != nullptr);
 
 		UINT64 instanceId = data.originalInstanceId;
 
 		bool isInternalReference = false;
 
-		auto findIter = mIdMapping.find(instanceId);
-		if (findIter != mIdMapping.end())
+		auto findIter = context->idMapping.find(instanceId);
+		if (findIter != context->idMapping.end())
 		{
 			if ((flags & GODM_UseNewIds) != 0)
 				instanceId = findIter->second;
@@ -167,10 +323,16 @@ namespace bs
 
 		if (isInternalReference || (!isInternalReference && (flags & GODM_RestoreExternal) != 0))
 		{
-			auto findIterObj = mObjects.find(instanceId);
+			// External objects can only be looked up on the sim thread, so these get resolved when finalized
+			if (!isInternalReference && context->detached)
+			{
+				context->externalHandles.push_back(std::make_pair(data, flags));
+				return;
+			}
 
-			if (findIterObj != mObjects.end())
-				data.handle._resolve(findIterObj->second);
+			GameObjectHandleBase object;
+			if (findObject(context, instanceId, object))
+				data.handle._resolve(object);
 			else
 			{
 				if ((flags & GODM_KeepMissing) == 0)
@@ -186,8 +348,10 @@ namespace bs
 
 	void GameObjectManager::registerUnresolvedHandle(UINT64 originalId, GameObjectHandleBase& object)
 	{
+		DeserializationContext* context = getActiveContext();
+
 #if BS_DEBUG_MODE
-		if (!mIsDeserializationActive)
+		if (context == nullptr)
 		{
 			BS_EXCEPT(InvalidStateException, "Unresolved handle queue only be modified while deserialization is active.");
 		}
@@ -202,13 +366,13 @@ namespace bs
 		bool foundHandleData = false;
 
 		// Search object that are currently being deserialized
-		auto iterFind = mIdMapping.find(originalId);
-		if (iterFind != mIdMapping.end())
+		auto iterFind = context->idMapping.find(originalId);
+		if (iterFind != context->idMapping.end())
 		{
-			auto iterFind2 = mObjects.find(iterFind->second);
-			if (iterFind2 != mObjects.end())
+			GameObjectHandleBase existing;
+			if (findObject(context, iterFind->second, existing))
 			{
-				object.mData = iterFind2->second.mData;
+				object.mData = existing.mData;
 				foundHandleData = true;
 			}
 		}
@@ -216,8 +380,8 @@ namespace bs
 		// Search previously deserialized handles
 		if (!foundHandleData)
 		{
-			auto iterFind = mUnresolvedHandleData.find(originalId);
-			if (iterFind != mUnresolvedHandleData.end())
+			auto iterFind = context->unresolvedHandleData.find(originalId);
+			if (iterFind != context->unresolvedHandleData.end())
 			{
 				object.mData = iterFind->second;
 				foundHandleData = true;
@@ -226,32 +390,39 @@ namespace bs
 
 		// If still not found, this is the first such handle so register its handle data
 		if (!foundHandleData)
-			mUnresolvedHandleData[originalId] = object.mData;
+			context->unresolvedHandleData[originalId] = object.mData;
 
-		mUnresolvedHandles.push_back({ originalId, object });
+		context->unresolvedHandles.push_back({ originalId, object });
 	}
 
 	void GameObjectManager::registerOnDeserializationEndCallback(std::function<void()> callback)
 	{
+		DeserializationContext* context = getActiveContext();
+
 #if BS_DEBUG_MODE
-		if (!mIsDeserializationActive)
+		if (context == nullptr)
 		{
 			BS_EXCEPT(InvalidStateException, "Callback queue only be modified while deserialization is active.");
 		}
 #endif
 
-		mEndCallbacks.push_back(callback);
+		context->endCallbacks.push_back(callback);
 	}
 
 	void GameObjectManager::setDeserializationMode(UINT32 gameObjectDeserializationMode)
 	{
 #if BS_DEBUG_MODE
-		if (mIsDeserializationActive)
+		if (getActiveContext() != nullptr)
 		{
 			BS_EXCEPT(InvalidStateException, "Deserialization modes can not be modified when deserialization is not active.");
 		}
 #endif
 
-		mGODeserializationMode = gameObjectDeserializationMode;
+		sDeserializationMode = gameObjectDeserializationMode;
+	}
+
+	UINT32 GameObjectManager::getDeserializationFlags() const
+	{
+		return sDeserializationMode;
 	}
 }
\ No newline at end of file
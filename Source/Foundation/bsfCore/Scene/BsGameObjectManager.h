@@ -32,7 +32,9 @@ namespace bs
 	/**
 	 * Tracks GameObject creation and destructions. Also resolves GameObject references from GameObject handles.
 	 *
-	 * @note	Sim thread only.
+	 * @note	Sim thread only, except for GameObject deserialization which may also run on worker threads. Objects
+	 *			deserialized on a worker thread are staged and only become visible through getObject() once they are
+	 *			registered by finalizeStagedObjects().
 	 */
 	class BS_CORE_EXPORT GameObjectManager : public Module<GameObjectManager>
 	{
@@ -63,6 +65,9 @@ namespace bs
 		 */
 		void unregisterObject(GameObjectHandleBase& object);
 
+		/** Unregisters a set of GameObjects at once. Equivalent to calling unregisterObject() for each object. */
+		void unregisterObjects(GameObjectHandleBase* objects, UINT32 count);
+
 		/**
 		 * Attempts to find a GameObject handle based on the GameObject instance ID. Returns empty handle if ID cannot be 
 		 * found.
@@ -88,9 +93,42 @@ namespace bs
 		/**	Queues the object to be destroyed at the end of a GameObject update cycle. */
 		void queueForDestroy(const GameObjectHandleBase& object);
 
-		/**	Destroys any GameObjects that were queued for destruction. */
+		/**
+		 * Destroys any GameObjects that were queued for destruction. Also releases the memory of previously destroyed
+		 * objects, within the limits of the release budget. See setReleaseBudget().
+		 */
 		void destroyQueuedObjects();
 
+		/**
+		 * Sets the maximum number of destroyed GameObjects whose memory is released on a single destroyQueuedObjects()
+		 * call, which is made once per frame. Destroyed objects are unregistered and their handles invalidated 
+		 * immediately, but the objects themselves are kept alive until their memory is released. This spreads out the
+		 * cost of destroying large hierarchies over multiple frames. Zero means the memory is released as soon as the
+		 * objects are destroyed, which is the default.
+		 */
+		void setReleaseBudget(UINT32 budget) { mReleaseBudget = budget; }
+
+		/** Returns the budget set by setReleaseBudget(). */
+		UINT32 getReleaseBudget() const { return mReleaseBudget; }
+
+		/**
+		 * Registers GameObjects that were deserialized on a worker thread, making them available through getObject(),
+		 * and resolves any of their handles pointing to objects outside of the deserialized set. Called once per frame.
+		 *
+		 * @param[in]	all		If true all staged objects are registered, otherwise at most as many as set by
+		 *						setFinalizeBudget().
+		 */
+		void finalizeStagedObjects(bool all = false);
+
+		/**
+		 * Sets the maximum number of GameObjects deserialized on worker threads that are registered on a single 
+		 * finalizeStagedObjects() call. Zero means all staged objects are registered at once, which is the default.
+		 */
+		void setFinalizeBudget(UINT32 budget) { mFinalizeBudget = budget; }
+
+		/** Returns the budget set by setFinalizeBudget(). */
+		UINT32 getFinalizeBudget() const { return mFinalizeBudget; }
+
 		/**	Triggered when a game object is being destroyed. */
 		Event<void(const HGameObject&)> onDestroyed;
 
@@ -103,6 +141,9 @@ namespace bs
 		//    - We can't just resolve them as we go because during deserialization not all objects
 		//      have necessarily been created.
 		//  - 2. Maps serialized IDs to actual in-engine IDs. 
+		// Deserialization state is kept per thread. When deserializing on a thread other than the sim thread, the
+		// session is detached: new objects are staged instead of registered, and are only registered once the sim
+		// thread calls finalizeStagedObjects().
 
 		/** Needs to be called whenever GameObject deserialization starts. Must be followed by endDeserialization() call. */
 		void startDeserialization();
@@ -110,8 +151,14 @@ namespace bs
 		/** Needs to be called whenever GameObject deserialization ends. Must be preceded by startDeserialization() call. */
 		void endDeserialization();
 
-		/**	Returns true if GameObject deserialization is currently in progress. */
-		bool isGameObjectDeserializationActive() const { return mIsDeserializationActive; }
+		/**	Returns true if GameObject deserialization is currently in progress on the calling thread. */
+		bool isGameObjectDeserializationActive() const;
+
+		/** 
+		 * Returns true if GameObject deserialization is currently in progress on the calling thread, and the calling
+		 * thread is not the sim thread. Objects deserialized in such a session must not notify other systems.
+		 */
+		bool isGameObjectDeserializationDetached() const;
 
 		/**	Queues the specified handle and resolves it when deserialization ends. */
 		void registerUnresolvedHandle(UINT64 originalId, GameObjectHandleBase& object);
@@ -120,7 +167,7 @@ namespace bs
 		void registerOnDeserializationEndCallback(std::function<void()> callback);
 
 		/**
-		 * Changes the deserialization mode for any following GameObject handle.
+		 * Changes the deserialization mode for any following GameObject handle deserialized on the calling thread.
 		 *
 		 * @param[in]	gameObjectDeserializationMode	Mode that controls how are GameObjects handles resolved when being
 		 *												deserialized.
@@ -134,20 +181,39 @@ namespace bs
 		void resolveDeserializedHandle(UnresolvedHandle& data, UINT32 flags);
 
 		/**	Gets the currently active flags that control how are game object handles deserialized. */
-		UINT32 getDeserializationFlags() const { return mGODeserializationMode; }
+		UINT32 getDeserializationFlags() const;
 
 	private:
-		UINT64 mNextAvailableID; // 0 is not a valid ID
-		Map<UINT64, GameObjectHandleBase> mObjects;
+		/** State of a single startDeserialization()/endDeserialization() session. */
+		struct DeserializationContext;
+
+		/** Returns the deserialization session active on the calling thread, or null if none. */
+		static DeserializationContext*& getActiveContext();
+
+		/** 
+		 * Finds an object registered with the manager, or staged by the provided detached deserialization session. 
+		 * Returns true if the object is found.
+		 */
+		bool findObject(const DeserializationContext* context, UINT64 id, GameObjectHandleBase& object) const;
+
+		/** Invalidates the handle of a destroyed object and releases the object, or queues it for release. */
+		void releaseObject(GameObjectHandleBase& object);
+
+		/** Releases up to @p count objects queued for release. */
+		void releasePendingObjects(UINT32 count);
+
+		std::atomic<UINT64> mNextAvailableID; // 0 is not a valid ID
+		FlatHashMap<UINT64, GameObjectHandleBase> mObjects;
 		Map<UINT64, GameObjectHandleBase> mQueuedForDestroy;
+		ThreadId mSimThreadId;
+
+		Mutex mStagedMutex;
+		Vector<GameObjectHandleBase> mStagedObjects;
+		Vector<std::pair<UnresolvedHandle, UINT32>> mStagedHandles;
+		UINT32 mFinalizeBudget = 0;
 
-		GameObject* mActiveDeserializedObject;
-		bool mIsDeserializationActive;
-		Map<UINT64, UINT64> mIdMapping;
-		Map<UINT64, SPtr<GameObjectHandleData>> mUnresolvedHandleData;
-		Vector<UnresolvedHandle> mUnresolvedHandles;
-		Vector<std::function<void()>> mEndCallbacks;
-		UINT32 mGODeserializationMode;
+		UINT32 mReleaseBudget = 0;
+		Vector<SPtr<GameObject>> mPendingRelease;
 	};
 
 	/** @} */
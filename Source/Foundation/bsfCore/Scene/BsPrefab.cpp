@@ -6,6 +6,7 @@
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsPrefabUtility.h"
 #include "BsCoreApplication.h"
+#include "CoreThread/BsCoreObject.h"
 
 namespace bs
 {
@@ -143,8 +144,13 @@ namespace bs
 		}
 #endif
 
+		// Initialize core objects of all the instantiated components with a single core thread command
+		CoreObject::_beginInitializeBatch();
+
 		HSceneObject clone = _clone();
 		clone->_instantiate();
+
+		CoreObject::_endInitializeBatch();
 		
 		return clone;
 	}
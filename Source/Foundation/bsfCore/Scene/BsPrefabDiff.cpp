@@ -53,6 +53,24 @@ namespace bs
 		return output;
 	}
 
+	SPtr<PrefabDiff> PrefabDiff::createRevert(const HSceneObject& prefab, const HSceneObject& instance)
+	{
+		if (prefab->mPrefabLinkUUID != instance->mPrefabLinkUUID)
+			return nullptr;
+
+		// Same as create(), except the roles of the hierarchies are swapped when generating the diff. The prefab is
+		// still the one being renamed, so that any handles recorded in the diff point to the instance objects.
+		Vector<RenamedGameObject> renamedObjects;
+		renameInstanceIds(prefab, instance, renamedObjects);
+
+		SPtr<PrefabDiff> output = bs_shared_ptr_new<PrefabDiff>();
+		output->mRoot = generateDiff(instance, prefab);
+
+		restoreInstanceIds(renamedObjects);
+
+		return output;
+	}
+
 	void PrefabDiff::apply(const HSceneObject& object)
 	{
 		if (mRoot == nullptr)
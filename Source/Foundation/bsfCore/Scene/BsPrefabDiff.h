@@ -93,6 +93,14 @@ namespace bs
 		 */
 		static SPtr<PrefabDiff> create(const HSceneObject& prefab, const HSceneObject& instance);
 
+		/**
+		 * Creates a new prefab diff that, when applied to the provided instanced scene object hierarchy, reverts all
+		 * the instance specific changes and restores it to the state of the prefab scene object hierarchy. Game object
+		 * handles in the diff reference objects of the instance, so the diff is only meant to be applied to the
+		 * instance it was created for.
+		 */
+		static SPtr<PrefabDiff> createRevert(const HSceneObject& prefab, const HSceneObject& instance);
+
 		/**
 		 * Applies the internal prefab diff to the provided object. The object should have similar hierarchy as the prefab
 		 * the diff was created for, otherwise the results are undefined.
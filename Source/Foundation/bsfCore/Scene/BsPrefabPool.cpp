@@ -0,0 +1,130 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Scene/BsPrefabPool.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabDiff.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsSceneManager.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	PrefabPool::PrefabPool(const HPrefab& prefab, UINT32 initialSize)
+		:mPrefab(prefab)
+	{
+		prewarm(initialSize);
+	}
+
+	PrefabPool::~PrefabPool()
+	{
+		clear();
+	}
+
+	void PrefabPool::prewarm(UINT32 count)
+	{
+		mAvailable.reserve(count);
+		while ((UINT32)mAvailable.size() < count)
+		{
+			HSceneObject instance = createInstance();
+			if (instance == nullptr)
+				break;
+
+			mAvailable.push_back(instance);
+		}
+	}
+
+	HSceneObject PrefabPool::spawn()
+	{
+		HSceneObject instance;
+		while (!mAvailable.empty())
+		{
+			HSceneObject pooled = mAvailable.back();
+			mAvailable.pop_back();
+
+			// Pooled instances can get destroyed externally, for example when the scene is cleared
+			if (!pooled.isDestroyed(true))
+			{
+				instance = pooled;
+				break;
+			}
+		}
+
+		if (instance == nullptr)
+		{
+			instance = createInstance();
+			if (instance == nullptr)
+				return instance;
+		}
+
+		instance->setActive(true);
+		return instance;
+	}
+
+	HSceneObject PrefabPool::spawn(const Vector3& position, const Quaternion& rotation)
+	{
+		HSceneObject instance = spawn();
+		if (instance != nullptr)
+			instance->setWorldPositionAndRotation(position, rotation);
+
+		return instance;
+	}
+
+	void PrefabPool::despawn(const HSceneObject& instance)
+	{
+		if (instance.isDestroyed(true))
+			return;
+
+		if (!mPrefab.isLoaded(false) || instance->_getPrefabLinkUUID() != mPrefab.getUUID())
+		{
+			LOGWRN("Trying to return a scene object to a pool of a prefab it wasn't instantiated from.");
+			return;
+		}
+
+		if (!instance->getActive(true))
+		{
+			auto iterFind = std::find(mAvailable.begin(), mAvailable.end(), instance);
+			if (iterFind != mAvailable.end())
+				return;
+		}
+
+		// Revert while still active, so that the diff doesn't pick up the deactivation
+		SPtr<PrefabDiff> revertDiff = PrefabDiff::createRevert(mPrefab->_getRoot(), instance);
+		if (revertDiff != nullptr)
+			revertDiff->apply(instance);
+
+		if (SceneManager::isStarted())
+			instance->setParent(gSceneManager().getRootNode(), false);
+
+		instance->setActive(false);
+		mAvailable.push_back(instance);
+	}
+
+	void PrefabPool::clear()
+	{
+		for (auto& instance : mAvailable)
+		{
+			if (!instance.isDestroyed(true))
+				instance->destroy();
+		}
+
+		mAvailable.clear();
+	}
+
+	HSceneObject PrefabPool::createInstance()
+	{
+		mPrefab.blockUntilLoaded();
+		if (!mPrefab.isLoaded(false))
+			return HSceneObject();
+
+		HSceneObject instance = mPrefab->_clone();
+		if (instance == nullptr)
+			return instance;
+
+		// Deactivate the hierarchy before instantiating it, so its components get initialized but never enabled
+		instance->mActiveSelf = false;
+		instance->setActiveHierarchy(false, false);
+		instance->_instantiate();
+
+		return instance;
+	}
+}
@@ -0,0 +1,77 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Scene/BsGameObject.h"
+#include "Math/BsVector3.h"
+#include "Math/BsQuaternion.h"
+
+namespace bs
+{
+	/** @addtogroup Scene
+	 *  @{
+	 */
+
+	/**
+	 * Keeps a set of inactive, already instantiated copies of a prefab that can be handed out instead of instantiating
+	 * the prefab every time. This avoids the cost of creating the scene objects and components, registering them with
+	 * the game object manager and creating the core objects of their components whenever a prefab instance is needed.
+	 *
+	 * Instances are returned to the pool with despawn(), which reverts any changes made to them since they were spawned.
+	 * Pooled instances are regular scene objects and must only be accessed from the main thread.
+	 */
+	class BS_CORE_EXPORT PrefabPool
+	{
+	public:
+		/**
+		 * Creates a new pool for the provided prefab.
+		 *
+		 * @param[in]	prefab			Prefab to create the instances from. 
+		 * @param[in]	initialSize		Number of instances to create immediately. If the prefab is still being loaded this 
+		 *								will block until the load completes.
+		 */
+		PrefabPool(const HPrefab& prefab, UINT32 initialSize = 0);
+		~PrefabPool();
+
+		/**
+		 * Creates new inactive instances until at least @p count instances are available in the pool. Can be called 
+		 * with small counts over multiple frames to spread out the cost of creating the instances. Blocks if the prefab
+		 * is still being loaded.
+		 */
+		void prewarm(UINT32 count);
+
+		/**
+		 * Activates an instance from the pool and returns it. A new instance is created if no instances are available.
+		 * The instance is parented to the scene root and starts out in the same state as the prefab.
+		 */
+		HSceneObject spawn();
+
+		/** Same as spawn(), but also moves the instance to the provided position and orientation. */
+		HSceneObject spawn(const Vector3& position, const Quaternion& rotation);
+
+		/**
+		 * Deactivates an instance previously returned by spawn() and returns it to the pool. Any changes made to the
+		 * instance, including added or removed components and children, are reverted to the state of the prefab.
+		 */
+		void despawn(const HSceneObject& instance);
+
+		/** Destroys all instances currently available in the pool. Spawned instances are not affected. */
+		void clear();
+
+		/** Returns the number of instances available in the pool. */
+		UINT32 getNumAvailable() const { return (UINT32)mAvailable.size(); }
+
+		/** Returns the prefab the pool creates the instances from. */
+		const HPrefab& getPrefab() const { return mPrefab; }
+
+	private:
+		/** Creates a new instantiated but inactive copy of the prefab. */
+		HSceneObject createInstance();
+
+		HPrefab mPrefab;
+		Vector<HSceneObject> mAvailable;
+	};
+
+	/** @} */
+}
@@ -11,6 +11,7 @@
 #include "RenderAPI/BsRenderTarget.h"
 #include "Renderer/BsLightProbeVolume.h"
 #include "Scene/BsSceneActor.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -21,6 +22,9 @@ namespace bs
 		UninitializedList = 2
 	};
 
+	/** Minimum number of components updated by a single task, for components with the ComponentFlag::ParallelUpdate flag. */
+	static constexpr UINT32 PARALLEL_UPDATE_GRAIN_SIZE = 64;
+
 	SceneManager::SceneManager()
 	{
 		mRootNode = SceneObject::createInternal("SceneRoot");
@@ -87,12 +91,39 @@ namespace bs
 
 	void SceneManager::_bindActor(const SPtr<SceneActor>& actor, const HSceneObject& so)
 	{
+		auto iterFind = mBoundActors.find(actor.get());
+		if (iterFind != mBoundActors.end())
+			_unbindActor(actor);
+
 		mBoundActors[actor.get()] = BoundActorData(actor, so);
+
+		BoundSceneObjectData& soData = mBoundSceneObjects[so.get()];
+		soData.actors.push_back(actor.get());
+
+		// Make sure the actor receives the current state of the scene object
+		_notifySceneObjectDirty(so.get());
 	}
 
 	void SceneManager::_unbindActor(const SPtr<SceneActor>& actor)
 	{
-		mBoundActors.erase(actor.get());
+		auto iterFind = mBoundActors.find(actor.get());
+		if (iterFind == mBoundActors.end())
+			return;
+
+		auto iterFindSO = mBoundSceneObjects.find(iterFind->second.soPtr);
+		if (iterFindSO != mBoundSceneObjects.end())
+		{
+			auto& actors = iterFindSO->second.actors;
+			auto iterFindActor = std::find(actors.begin(), actors.end(), actor.get());
+			if (iterFindActor != actors.end())
+				actors.erase(iterFindActor);
+
+			// Note: The entry might still be referenced by the dirty list, which is fine as missing entries are ignored
+			if (actors.empty())
+				mBoundSceneObjects.erase(iterFindSO);
+		}
+
+		mBoundActors.erase(iterFind);
 	}
 
 	HSceneObject SceneManager::_getActorSO(const SPtr<SceneActor>& actor) const
@@ -151,8 +182,42 @@ namespace bs
 
 	void SceneManager::_updateCoreObjectTransforms()
 	{
-		for (auto& entry : mBoundActors)
-			entry.second.actor->_updateState(*entry.second.so);
+		// Only objects modified since the last update are visited. World transforms are cached by scene objects, so a
+		// parent's transform is only calculated once no matter how many of its children are dirty. Using an index, as
+		// updating the actors could potentially queue more objects.
+		for (size_t i = 0; i < mDirtySceneObjects.size(); i++)
+		{
+			const SceneObject* so = mDirtySceneObjects[i];
+
+			auto iterFind = mBoundSceneObjects.find(so);
+			if (iterFind == mBoundSceneObjects.end())
+				continue;
+
+			BoundSceneObjectData& soData = iterFind->second;
+			if (!soData.isDirty)
+				continue;
+
+			soData.isDirty = false;
+
+			for (auto& actor : soData.actors)
+				actor->_updateState(*so);
+		}
+
+		mDirtySceneObjects.clear();
+	}
+
+	void SceneManager::_notifySceneObjectDirty(const SceneObject* so)
+	{
+		auto iterFind = mBoundSceneObjects.find(so);
+		if (iterFind == mBoundSceneObjects.end())
+			return;
+
+		BoundSceneObjectData& soData = iterFind->second;
+		if (soData.isDirty)
+			return;
+
+		soData.isDirty = true;
+		mDirtySceneObjects.push_back(so);
 	}
 
 	SPtr<Camera> SceneManager::getMainCamera() const
@@ -232,10 +297,7 @@ namespace bs
 					{
 						entry->onEnabled();
 
-						UINT32 idx = (UINT32)mActiveComponents.size();
-						mActiveComponents.push_back(entry);
-
-						entry->setSceneManagerId(encodeComponentId(idx, ActiveList));
+						addToActiveList(entry);
 					}
 					else
 					{
@@ -263,10 +325,7 @@ namespace bs
 				removeFromInactiveList(component);
 				i--; // Keep the same index next iteration to process the component we just swapped
 
-				UINT32 activeIdx = (UINT32)mActiveComponents.size();
-				mActiveComponents.push_back(component);
-
-				component->setSceneManagerId(encodeComponentId(activeIdx, ActiveList));
+				addToActiveList(component);
 			}
 		}
 		// Stop updates on all active components
@@ -321,10 +380,7 @@ namespace bs
 			{
 				component->onEnabled();
 
-				UINT32 idx = (UINT32)mActiveComponents.size();
-				mActiveComponents.push_back(component);
-
-				component->setSceneManagerId(encodeComponentId(idx, ActiveList));
+				addToActiveList(component);
 			}
 			else
 			{
@@ -354,10 +410,7 @@ namespace bs
 
 			removeFromInactiveList(component);
 
-			UINT32 activeIdx = (UINT32)mActiveComponents.size();
-			mActiveComponents.push_back(component);
-
-			component->setSceneManagerId(encodeComponentId(activeIdx, ActiveList));
+			addToActiveList(component);
 		}
 	}
 
@@ -410,6 +463,28 @@ namespace bs
 		component->onDestroyed();
 	}
 
+	void SceneManager::addToActiveList(const HComponent& component)
+	{
+		UINT32 idx = (UINT32)mActiveComponents.size();
+		mActiveComponents.push_back(component);
+
+		component->setSceneManagerId(encodeComponentId(idx, ActiveList));
+
+		// Find or create the update batch for the component
+		UINT32 rttiId = 0;
+		bool parallel = component->hasFlag(ComponentFlag::ParallelUpdate);
+		if (parallel || component->hasFlag(ComponentFlag::BatchUpdate))
+			rttiId = component->getRTTI()->getRTTIId();
+
+		UINT32 batchIdx = findOrCreateUpdateBatch(rttiId, component->getUpdatePhase(), parallel);
+
+		Vector<Component*>& batchComponents = mUpdateBatches[batchIdx].components;
+		component->mUpdateBatchIdx = batchIdx;
+		component->mUpdateBatchEntryIdx = (UINT32)batchComponents.size();
+
+		batchComponents.push_back(component.get());
+	}
+
 	void SceneManager::removeFromActiveList(const HComponent& component)
 	{
 		UINT32 listType;
@@ -428,6 +503,77 @@ namespace bs
 		}
 
 		mActiveComponents.erase(mActiveComponents.end() - 1);
+
+		// Remove from the update batch
+		Vector<Component*>& batchComponents = mUpdateBatches[component->mUpdateBatchIdx].components;
+		UINT32 entryIdx = component->mUpdateBatchEntryIdx;
+
+		assert(batchComponents[entryIdx] == component.get());
+
+		Component* lastComponent = batchComponents.back();
+		if (lastComponent != component.get())
+		{
+			batchComponents[entryIdx] = lastComponent;
+			lastComponent->mUpdateBatchEntryIdx = entryIdx;
+		}
+
+		batchComponents.erase(batchComponents.end() - 1);
+
+		component->mUpdateBatchIdx = (UINT32)-1;
+		component->mUpdateBatchEntryIdx = (UINT32)-1;
+	}
+
+	UINT32 SceneManager::findOrCreateUpdateBatch(UINT32 rttiId, ComponentUpdatePhase phase, bool parallel)
+	{
+		Vector<UINT32>& phaseBatches = mPhaseUpdateBatches[(UINT32)phase];
+
+		// Non-batched components of a phase are always updated first
+		if (phaseBatches.empty())
+		{
+			UINT32 batchIdx = (UINT32)mUpdateBatches.size();
+			mUpdateBatchLookup[(UINT64)phase << 1] = batchIdx;
+			phaseBatches.push_back(batchIdx);
+
+			mUpdateBatches.push_back(ComponentUpdateBatch());
+			mUpdateBatches.back().phase = phase;
+		}
+
+		UINT64 key = ((UINT64)rttiId << 32) | ((UINT64)phase << 1) | (parallel ? 1 : 0);
+
+		auto iterFind = mUpdateBatchLookup.find(key);
+		if (iterFind != mUpdateBatchLookup.end())
+			return iterFind->second;
+
+		UINT32 batchIdx = (UINT32)mUpdateBatches.size();
+		mUpdateBatchLookup[key] = batchIdx;
+		phaseBatches.push_back(batchIdx);
+
+		mUpdateBatches.push_back(ComponentUpdateBatch());
+		mUpdateBatches.back().rttiId = rttiId;
+		mUpdateBatches.back().phase = phase;
+		mUpdateBatches.back().parallel = parallel;
+
+		return batchIdx;
+	}
+
+	void SceneManager::updateBatch(UINT32 batchIdx, void (Component::*method)())
+	{
+		if (mUpdateBatches[batchIdx].parallel)
+		{
+			const Vector<Component*>& components = mUpdateBatches[batchIdx].components;
+			TaskScheduler::instance().parallelFor(0, (UINT32)components.size(), PARALLEL_UPDATE_GRAIN_SIZE,
+				[&components, method](UINT32 begin, UINT32 end)
+			{
+				for (UINT32 i = begin; i < end; i++)
+					(components[i]->*method)();
+			});
+		}
+		else
+		{
+			// Note: Using indices as components can be added or removed during the update
+			for (UINT32 i = 0; i < (UINT32)mUpdateBatches[batchIdx].components.size(); i++)
+				(mUpdateBatches[batchIdx].components[i]->*method)();
+		}
 	}
 
 	void SceneManager::removeFromInactiveList(const HComponent& component)
@@ -490,19 +636,30 @@ namespace bs
 
 	void SceneManager::_update()
 	{
-		// Note: Eventually perform updates based on component types and/or on component priority. Right now we just
-		// iterate in an undefined order, but it wouldn't be hard to change it.
+		// Make objects deserialized on worker threads (e.g. asynchronously loaded prefabs) available to the scene
+		GameObjectManager::instance().finalizeStagedObjects();
 
-		for (auto& entry : mActiveComponents)
-			entry->update();
+		// Note: Components within a batch are updated in an undefined order. Phases are updated in order, and within a
+		// phase non-batched components are always in the first batch, while the rest follow in the order their types
+		// were first encountered.
+		
+		// Note: Using indices as components can be added or removed during the update
+		for (UINT32 phase = 0; phase < NUM_UPDATE_PHASES; phase++)
+		{
+			for (UINT32 i = 0; i < (UINT32)mPhaseUpdateBatches[phase].size(); i++)
+				updateBatch(mPhaseUpdateBatches[phase][i], &Component::update);
+		}
 
 		GameObjectManager::instance().destroyQueuedObjects();
 	}
 
 	void SceneManager::_fixedUpdate()
 	{
-		for (auto& entry : mActiveComponents)
-			entry->fixedUpdate();
+		for (UINT32 phase = 0; phase < NUM_UPDATE_PHASES; phase++)
+		{
+			for (UINT32 i = 0; i < (UINT32)mPhaseUpdateBatches[phase].size(); i++)
+				updateBatch(mPhaseUpdateBatches[phase][i], &Component::fixedUpdate);
+		}
 	}
 
 	void SceneManager::registerNewSO(const HSceneObject& node)
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
 #include "Scene/BsGameObject.h"
+#include "Scene/BsComponent.h"
 
 namespace bs
 {
@@ -20,11 +21,42 @@ namespace bs
 		BoundActorData() { }
 
 		BoundActorData(const SPtr<SceneActor>& actor, const HSceneObject& so)
-			:actor(actor), so(so)
+			:actor(actor), so(so), soPtr(so.get())
 		{ }
 
 		SPtr<SceneActor> actor;
 		HSceneObject so;
+
+		/** Raw pointer to the scene object, usable even after the handle has been destroyed. */
+		const SceneObject* soPtr = nullptr;
+	};
+
+	/** Information about all scene actors bound to a single scene object. */
+	struct BoundSceneObjectData
+	{
+		SmallVector<SceneActor*, 2> actors;
+
+		/** True if the scene object is queued for updating the state of its actors. */
+		bool isDirty = false;
+	};
+
+	/** 
+	 * Contiguous list of active components that are updated together. Contains either all components of a single type
+	 * and update phase that have the ComponentFlag::BatchUpdate or ComponentFlag::ParallelUpdate flag, or all the 
+	 * components of an update phase without them.
+	 */
+	struct ComponentUpdateBatch
+	{
+		/** RTTI type ID of the components in the batch, or zero for the batch of non-batched components. */
+		UINT32 rttiId = 0;
+
+		/** Phase in which the components in the batch are updated. */
+		ComponentUpdatePhase phase = ComponentUpdatePhase::Default;
+
+		/** True if update() can be called on the components in parallel. */
+		bool parallel = false;
+
+		Vector<Component*> components;
 	};
 
 	/** Possible states components can be in. Controls which component callbacks are triggered. */
@@ -94,8 +126,9 @@ namespace bs
 		void setMainRenderTarget(const SPtr<RenderTarget>& rt);
 
 		/** 
-		 * Binds a scene actor with a scene object. Every frame the scene object's transform will be monitored for
-		 * changes and those changes will be automatically transfered to the actor. 
+		 * Binds a scene actor with a scene object. Whenever the scene object's transform, active state or mobility
+		 * changes, the change will be automatically transfered to the actor on the next call to
+		 * _updateCoreObjectTransforms().
 		 */
 		void _bindActor(const SPtr<SceneActor>& actor, const HSceneObject& so);
 
@@ -120,9 +153,18 @@ namespace bs
 		/** Called at fixed time internals. Calls the fixed update method on all active components. */
 		void _fixedUpdate();
 
-		/** Updates dirty transforms on any core objects that may be tied with scene objects. */
+		/** 
+		 * Updates dirty transforms on any core objects that may be tied with scene objects. Only actors bound to scene
+		 * objects that were modified since the last call are updated.
+		 */
 		void _updateCoreObjectTransforms();
 
+		/** 
+		 * Notifies the manager that the transform, active state or mobility of a scene object has changed, and that any
+		 * actors bound to it need to be updated. 
+		 */
+		void _notifySceneObjectDirty(const SceneObject* so);
+
 		/** Notifies the manager that a new component has just been created. The manager triggers necessary callbacks. */
 		void _notifyComponentCreated(const HComponent& component, bool parentActive);
 
@@ -160,9 +202,21 @@ namespace bs
 		/**	Callback that is triggered when the main render target size is changed. */
 		void onMainRenderTargetResized();
 
-		/** Removes a component from the active component list. */
+		/** Adds a component to the active component list, as well as the relevant update batch. */
+		void addToActiveList(const HComponent& component);
+
+		/** Removes a component from the active component list, as well as its update batch. */
 		void removeFromActiveList(const HComponent& component);
 
+		/** Returns the index of the update batch for the provided key, creating the batch if it doesn't exist. */
+		UINT32 findOrCreateUpdateBatch(UINT32 rttiId, ComponentUpdatePhase phase, bool parallel);
+
+		/** 
+		 * Calls the provided method (update() or fixedUpdate()) on all components in the update batch, in parallel if
+		 * the batch allows it.
+		 */
+		void updateBatch(UINT32 batchIdx, void (Component::*method)());
+
 		/** Removes a component from the inactive component list. */
 		void removeFromInactiveList(const HComponent& component);
 
@@ -185,6 +239,8 @@ namespace bs
 		HSceneObject mRootNode;
 
 		UnorderedMap<SceneActor*, BoundActorData> mBoundActors;
+		UnorderedMap<const SceneObject*, BoundSceneObjectData> mBoundSceneObjects;
+		Vector<const SceneObject*> mDirtySceneObjects;
 		UnorderedMap<Camera*, SPtr<Camera>> mCameras;
 		Vector<SPtr<Camera>> mMainCameras;
 
@@ -192,6 +248,12 @@ namespace bs
 		Vector<HComponent> mInactiveComponents;
 		Vector<HComponent> mUninitializedComponents;
 
+		static constexpr UINT32 NUM_UPDATE_PHASES = 3;
+
+		Vector<ComponentUpdateBatch> mUpdateBatches;
+		UnorderedMap<UINT64, UINT32> mUpdateBatchLookup;
+		Vector<UINT32> mPhaseUpdateBatches[NUM_UPDATE_PHASES]; // Indices into mUpdateBatches, in update order
+
 		SPtr<RenderTarget> mMainRT;
 		HEvent mMainRTResizedConn;
 
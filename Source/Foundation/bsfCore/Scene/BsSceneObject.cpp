@@ -6,8 +6,9 @@
 #include "Error/BsException.h"
 #include "Debug/BsDebug.h"
 #include "Private/RTTI/BsSceneObjectRTTI.h"
-#include "Serialization/BsMemorySerializer.h"
+#include "Serialization/BsBinaryCloner.h"
 #include "Scene/BsGameObjectManager.h"
+#include "CoreThread/BsCoreObject.h"
 #include "Scene/BsPrefabUtility.h"
 #include "Math/BsMatrix3.h"
 #include "BsCoreApplication.h"
@@ -79,26 +80,45 @@ namespace bs
 	{
 		if (immediate)
 		{
-			for (auto iter = mChildren.begin(); iter != mChildren.end(); ++iter)
-				(*iter)->destroyInternal(*iter, true);
+			// Gather the entire hierarchy first, so all the scene objects can be unregistered at once and deep
+			// hierarchies don't recurse. Children are always gathered after their parents.
+			Vector<GameObjectHandleBase> hierarchy;
+			hierarchy.push_back(handle);
 
-			mChildren.clear();
+			for (UINT32 i = 0; i < (UINT32)hierarchy.size(); i++)
+			{
+				SceneObject* so = static_cast<SceneObject*>(hierarchy[i].get());
+				for (auto& child : so->mChildren)
+					hierarchy.push_back(child);
+			}
+
+			// Any core objects released by the components are released on the core thread all at once
+			CoreObject::_beginDestroyBatch();
 
-			// It's important to remove the elements from the array as soon as they're destroyed, as OnDestroy callbacks
-			// for components might query the SO's components, and we want to only return live ones 
-			while (!mComponents.empty())
+			// Destroy children before their parents
+			for (auto iter = hierarchy.rbegin(); iter != hierarchy.rend(); ++iter)
 			{
-				HComponent component = mComponents.back();
-				component->_setIsDestroyed();
+				SceneObject* so = static_cast<SceneObject*>(iter->get());
+				so->mChildren.clear();
 
-				if (isInstantiated())
-					gSceneManager()._notifyComponentDestroyed(component);
+				// It's important to remove the elements from the array as soon as they're destroyed, as OnDestroy
+				// callbacks for components might query the SO's components, and we want to only return live ones 
+				while (!so->mComponents.empty())
+				{
+					HComponent component = so->mComponents.back();
+					component->_setIsDestroyed();
+
+					if (so->isInstantiated())
+						gSceneManager()._notifyComponentDestroyed(component);
 
-				component->destroyInternal(component, true);
-				mComponents.erase(mComponents.end() - 1);
+					component->destroyInternal(component, true);
+					so->mComponents.erase(so->mComponents.end() - 1);
+				}
 			}
 
-			GameObjectManager::instance().unregisterObject(handle);
+			GameObjectManager::instance().unregisterObjects(hierarchy.data(), (UINT32)hierarchy.size());
+
+			CoreObject::_endDestroyBatch();
 		}
 		else
 			GameObjectManager::instance().queueForDestroy(handle);
@@ -285,6 +305,27 @@ namespace bs
 		notifyTransformChanged(TCF_Transform);
 	}
 
+	void SceneObject::setWorldPositionAndRotation(const Vector3& position, const Quaternion& rotation)
+	{
+		if (mMobility != ObjectMobility::Movable)
+			return;
+
+		if (mParent != nullptr)
+		{
+			const Transform& parentTfrm = mParent->getTransform();
+
+			mLocalTfrm.setWorldPosition(position, parentTfrm);
+			mLocalTfrm.setWorldRotation(rotation, parentTfrm);
+		}
+		else
+		{
+			mLocalTfrm.setPosition(position);
+			mLocalTfrm.setRotation(rotation);
+		}
+
+		notifyTransformChanged(TCF_Transform);
+	}
+
 	void SceneObject::setWorldScale(const Vector3& scale)
 	{
 		if (mMobility != ObjectMobility::Movable)
@@ -425,6 +466,12 @@ namespace bs
 
 	void SceneObject::notifyTransformChanged(TransformChangedFlags flags) const
 	{
+		// Objects deserialized outside of the sim thread aren't part of the scene yet, so they don't notify anyone
+		const bool notify = !GameObjectManager::instance().isGameObjectDeserializationDetached();
+
+		if (notify && SceneManager::isStarted())
+			gSceneManager()._notifySceneObjectDirty(this);
+
 		// If object is immovable, don't send transform changed events nor mark the transform dirty
 		TransformChangedFlags componentFlags = flags;
 		if (mMobility != ObjectMobility::Movable)
@@ -436,7 +483,7 @@ namespace bs
 		}
 
 		// Only send component flags if we haven't removed them all
-		if (componentFlags != 0)
+		if (notify && componentFlags != 0)
 		{
 			for (auto& entry : mComponents)
 			{
@@ -680,6 +727,9 @@ namespace bs
 		{
 			mActiveHierarchy = activeHierarchy;
 
+			if (SceneManager::isStarted() && !GameObjectManager::instance().isGameObjectDeserializationDetached())
+				gSceneManager()._notifySceneObjectDirty(this);
+
 			if (triggerEvents)
 			{
 				if (activeHierarchy)
@@ -732,14 +782,8 @@ namespace bs
 		else
 			_unsetFlags(SOF_DontInstantiate);
 
-		UINT32 bufferSize = 0;
-
-		MemorySerializer serializer;
-		UINT8* buffer = serializer.encode(this, bufferSize, (void*(*)(size_t))&bs_alloc);
-
 		GameObjectManager::instance().setDeserializationMode(GODM_UseNewIds | GODM_RestoreExternal);
-		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(serializer.decode(buffer, bufferSize));
-		bs_free(buffer);
+		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(BinaryCloner::clone(this));
 
 		if(isInstantiated)
 			_unsetFlags(SOF_DontInstantiate);
@@ -51,6 +51,7 @@ namespace bs
 		friend class Prefab;
 		friend class PrefabDiff;
 		friend class PrefabUtility;
+		friend class PrefabPool;
 	public:
 		~SceneObject();
 
@@ -213,6 +214,12 @@ namespace bs
 		/**	Sets the world rotation of the object. */
 		void setWorldRotation(const Quaternion& rotation);
 
+		/**
+		 * Sets both the world position and rotation of the object. Faster than calling setWorldPosition() and
+		 * setWorldRotation() separately, as the transform change is only propagated once.
+		 */
+		void setWorldPositionAndRotation(const Vector3& position, const Quaternion& rotation);
+
 		/**	Sets the local scale of the object. */
 		void setScale(const Vector3& scale);
 
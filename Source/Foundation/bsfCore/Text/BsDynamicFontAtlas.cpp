@@ -0,0 +1,223 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Text/BsDynamicFontAtlas.h"
+#include "Text/BsFont.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
+#include "Image/BsPixelUtil.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	/** Returns a list of all currently existing dynamic atlases. Must be accessed while holding sAtlasesMutex. */
+	static Vector<DynamicFontAtlas*>& getAtlases()
+	{
+		static Vector<DynamicFontAtlas*> atlases;
+		return atlases;
+	}
+
+	static Mutex sAtlasesMutex;
+
+	DynamicFontAtlas::DynamicFontAtlas(FontBitmap& bitmap, const SPtr<FontRasterizer>& rasterizer, UINT32 pageSize,
+		UINT32 maxPages)
+		: mBitmap(bitmap), mRasterizer(rasterizer), mPageSize(pageSize), mMaxPages(maxPages)
+		, mRendered(bs_shared_ptr_new<RenderedGlyphs>())
+	{
+		Lock lock(sAtlasesMutex);
+		getAtlases().push_back(this);
+	}
+
+	DynamicFontAtlas::~DynamicFontAtlas()
+	{
+		Lock lock(sAtlasesMutex);
+
+		Vector<DynamicFontAtlas*>& atlases = getAtlases();
+		auto iterFind = std::find(atlases.begin(), atlases.end(), this);
+		if (iterFind != atlases.end())
+			atlases.erase(iterFind);
+	}
+
+	void DynamicFontAtlas::request(UINT32 charId)
+	{
+		if (!mRequested.insert(charId).second)
+			return;
+
+		mQueued.push_back(charId);
+	}
+
+	bool DynamicFontAtlas::update()
+	{
+		if (!mQueued.empty())
+		{
+			// Render all characters requested since the last update in a single task. Rendered characters get picked up
+			// by one of the following updates.
+			SPtr<FontRasterizer> rasterizer = mRasterizer;
+			SPtr<RenderedGlyphs> rendered = mRendered;
+			UINT32 size = mBitmap.size;
+
+			Vector<UINT32> charIds;
+			std::swap(charIds, mQueued);
+
+			SPtr<Task> task = Task::create("RasterizeGlyphs", [rasterizer, rendered, size, charIds]()
+			{
+				for (auto& charId : charIds)
+				{
+					RasterizedGlyph glyph;
+					if (!rasterizer->rasterize(charId, size, glyph))
+						continue;
+
+					Lock lock(rendered->mutex);
+					rendered->glyphs.push_back(std::move(glyph));
+				}
+			});
+
+			TaskScheduler::instance().addTask(task);
+		}
+
+		Vector<RasterizedGlyph> glyphs;
+		{
+			Lock lock(mRendered->mutex);
+			std::swap(glyphs, mRendered->glyphs);
+		}
+
+		if (glyphs.empty())
+			return false;
+
+		// Larger characters first, for better packing
+		std::sort(glyphs.begin(), glyphs.end(), [](const RasterizedGlyph& a, const RasterizedGlyph& b)
+		{
+			return a.desc.width * a.desc.height > b.desc.width * b.desc.height;
+		});
+
+		bool anyAdded = false;
+		for (auto& glyph : glyphs)
+			anyAdded |= addGlyph(glyph);
+
+		for (auto& page : mPages)
+		{
+			if (!page.dirty)
+				continue;
+
+			// Upload a copy, so the page can keep being modified while the core thread is reading the data
+			SPtr<PixelData> pixels = page.pixels;
+			const TextureProperties& texProps = page.texture->getProperties();
+
+			SPtr<PixelData> upload = texProps.allocBuffer(0, 0);
+			if (texProps.getFormat() != pixels->getFormat())
+				PixelUtil::bulkPixelConversion(*pixels, *upload);
+			else
+				memcpy(upload->getData(), pixels->getData(), pixels->getSize());
+
+			page.texture->writeData(upload);
+			page.dirty = false;
+		}
+
+		return anyAdded;
+	}
+
+	bool DynamicFontAtlas::addGlyph(const RasterizedGlyph& glyph)
+	{
+		CharDesc desc = glyph.desc;
+		desc.uvX = 0.0f;
+		desc.uvY = 0.0f;
+		desc.uvWidth = 0.0f;
+		desc.uvHeight = 0.0f;
+
+		// Characters without any visible pixels (e.g. whitespace) don't need space in the atlas
+		if (desc.width == 0 || desc.height == 0)
+		{
+			desc.page = 0;
+			mBitmap.characters[desc.charId] = desc;
+
+			return true;
+		}
+
+		UINT32 x = 0;
+		UINT32 y = 0;
+		Page* page = nullptr;
+
+		for (auto& entry : mPages)
+		{
+			if (entry.layout.addElement(desc.width + PADDING, desc.height + PADDING, x, y))
+			{
+				page = &entry;
+				break;
+			}
+		}
+
+		if (page == nullptr && (UINT32)mPages.size() < mMaxPages)
+		{
+			mPages.push_back(Page(mPageSize));
+			Page& newPage = mPages.back();
+
+			newPage.pixels = bs_shared_ptr_new<PixelData>(mPageSize, mPageSize, 1, PF_RG8);
+			newPage.pixels->allocateInternalBuffer();
+			memset(newPage.pixels->getData(), 0, newPage.pixels->getSize());
+
+			TEXTURE_DESC texDesc;
+			texDesc.width = mPageSize;
+			texDesc.height = mPageSize;
+			texDesc.format = PF_RG8;
+			texDesc.usage = TU_DYNAMIC;
+
+			newPage.texture = Texture::create(texDesc);
+			newPage.texture->setName(u8"DynamicFontPage" + toString((UINT32)mBitmap.texturePages.size()));
+
+			newPage.textureIdx = (UINT32)mBitmap.texturePages.size();
+			mBitmap.texturePages.push_back(newPage.texture);
+
+			if (newPage.layout.addElement(desc.width + PADDING, desc.height + PADDING, x, y))
+				page = &newPage;
+		}
+
+		if (page == nullptr)
+		{
+			if (!mLoggedFull)
+			{
+				LOGWRN("Dynamic font atlas is full. Characters that don't fit will be displayed using the missing glyph.");
+				mLoggedFull = true;
+			}
+
+			return false;
+		}
+
+		// Copy the character bitmap. Same value is written to both channels, to match the imported font pages.
+		UINT8* pixelBuffer = page->pixels->getData();
+		for (UINT32 row = 0; row < desc.height; row++)
+		{
+			const UINT8* src = glyph.coverage.data() + row * desc.width;
+			UINT8* dst = pixelBuffer + ((y + row) * mPageSize + x) * 2;
+
+			for (UINT32 column = 0; column < desc.width; column++)
+			{
+				dst[column * 2 + 0] = src[column];
+				dst[column * 2 + 1] = src[column];
+			}
+		}
+
+		page->dirty = true;
+
+		float invPageSize = 1.0f / mPageSize;
+
+		desc.page = page->textureIdx;
+		desc.uvX = x * invPageSize;
+		desc.uvY = y * invPageSize;
+		desc.uvWidth = desc.width * invPageSize;
+		desc.uvHeight = desc.height * invPageSize;
+
+		mBitmap.characters[desc.charId] = desc;
+		return true;
+	}
+
+	bool DynamicFontAtlas::_updateAll()
+	{
+		Lock lock(sAtlasesMutex);
+
+		bool anyAdded = false;
+		for (auto& atlas : getAtlases())
+			anyAdded |= atlas->update();
+
+		return anyAdded;
+	}
+}
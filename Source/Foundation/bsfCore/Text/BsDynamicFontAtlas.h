@@ -0,0 +1,125 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Text/BsFontDesc.h"
+#include "Image/BsTextureAtlasLayout.h"
+
+namespace bs
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Bitmap and metrics of a single character, as rendered by a FontRasterizer. */
+	struct RasterizedGlyph
+	{
+		/** Metrics of the character. Texture page and coordinates are ignored. */
+		CharDesc desc;
+
+		/** Coverage of each pixel of the character, one byte per pixel. Contains desc.width * desc.height entries. */
+		Vector<UINT8> coverage;
+	};
+
+	/** Interface for objects that can render characters of a font on demand. Implemented by font importers. */
+	class BS_CORE_EXPORT FontRasterizer
+	{
+	public:
+		virtual ~FontRasterizer() = default;
+
+		/**
+		 * Renders the specified character. Can be called from any thread.
+		 *
+		 * @param[in]	charId	Unicode key of the character to render.
+		 * @param[in]	size	Font size to render the character at, in points.
+		 * @param[out]	output	Rendered character.
+		 * @return				True if the character was rendered, false if the font doesn't contain the character.
+		 */
+		virtual bool rasterize(UINT32 charId, UINT32 size, RasterizedGlyph& output) = 0;
+	};
+
+	/**
+	 * Adds characters to a font bitmap at runtime, as they are first used. Characters missing from the bitmap are
+	 * rendered by a FontRasterizer on a worker thread and packed into additional texture pages of the bitmap. Until a
+	 * character is ready the bitmap's missing glyph is used in its place.
+	 */
+	class BS_CORE_EXPORT DynamicFontAtlas
+	{
+		/** A texture page containing rendered characters. */
+		struct Page
+		{
+			Page(UINT32 size)
+				:layout(size, size, size, size)
+			{ }
+
+			TextureAtlasLayout layout;
+			SPtr<PixelData> pixels;
+			HTexture texture;
+			UINT32 textureIdx = 0;
+			bool dirty = false;
+		};
+
+		/** Data shared between the atlas and the worker threads rendering its characters. */
+		struct RenderedGlyphs
+		{
+			Mutex mutex;
+			Vector<RasterizedGlyph> glyphs;
+		};
+
+	public:
+		/**
+		 * Creates a new dynamic atlas.
+		 *
+		 * @param[in]	bitmap		Font bitmap to add the characters to. Must outlive the atlas.
+		 * @param[in]	rasterizer	Rasterizer used for rendering the characters.
+		 * @param[in]	pageSize	Width and height of a single texture page, in pixels.
+		 * @param[in]	maxPages	Maximum number of texture pages to create. Once all pages are full characters that
+		 *							don't fit are displayed using the missing glyph.
+		 */
+		DynamicFontAtlas(FontBitmap& bitmap, const SPtr<FontRasterizer>& rasterizer, UINT32 pageSize = 512,
+			UINT32 maxPages = 8);
+		~DynamicFontAtlas();
+
+		/**
+		 * Queues the specified character for rendering, unless it has already been requested. Should be called when
+		 * the character is missing from the bitmap. Must be called from the simulation thread.
+		 */
+		void request(UINT32 charId);
+
+		/**
+		 * Starts rendering any queued characters, and adds characters whose rendering finished to the font bitmap. Must
+		 * be called from the simulation thread.
+		 *
+		 * @return	True if any characters were added to the bitmap.
+		 */
+		bool update();
+
+		/**
+		 * Calls update() on all existing dynamic atlases. Text generated before new characters were added should be
+		 * re-generated in order to display those characters.
+		 *
+		 * @return	True if any characters were added to any of the font bitmaps.
+		 */
+		static bool _updateAll();
+
+	private:
+		/** Copies the character into one of the texture pages, and registers it with the font bitmap. */
+		bool addGlyph(const RasterizedGlyph& glyph);
+
+		static const UINT32 PADDING = 1;
+
+		FontBitmap& mBitmap;
+		SPtr<FontRasterizer> mRasterizer;
+		UINT32 mPageSize;
+		UINT32 mMaxPages;
+
+		UnorderedSet<UINT32> mRequested;
+		Vector<UINT32> mQueued;
+		Vector<Page> mPages;
+		SPtr<RenderedGlyphs> mRendered;
+		bool mLoggedFull = false;
+	};
+
+	/** @} */
+}
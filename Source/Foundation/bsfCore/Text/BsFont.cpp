@@ -3,6 +3,7 @@
 #include "Text/BsFont.h"
 #include "Private/RTTI/BsFontRTTI.h"
 #include "Resources/BsResources.h"
+#include "Text/BsDynamicFontAtlas.h"
 
 namespace bs
 {
@@ -14,6 +15,9 @@ namespace bs
 			return characters.at(charId);
 		}
 
+		if (dynamicAtlas != nullptr)
+			dynamicAtlas->request(charId);
+
 		return missingGlyph;
 	}
 
@@ -47,13 +51,32 @@ namespace bs
 		auto iterFind = mFontDataPerSize.find(size);
 
 		if(iterFind == mFontDataPerSize.end())
-			return nullptr;
+		{
+			if (mFontDataPerSize.empty() || !mFontDataPerSize.begin()->second->distanceField)
+				return nullptr;
+
+			// Distance field bitmaps can be used at any size, by scaling their metrics. Scaled version needs to be 
+			// re-created if characters were added to the source since it was created.
+			const FontBitmap& source = *mFontDataPerSize.begin()->second;
+			ScaledBitmap& scaled = mScaledFontData[size];
+
+			if (scaled.bitmap == nullptr || scaled.numSourceCharacters != (UINT32)source.characters.size())
+			{
+				scaled.bitmap = createScaledBitmap(source, size);
+				scaled.numSourceCharacters = (UINT32)source.characters.size();
+			}
+
+			return scaled.bitmap;
+		}
 
 		return iterFind->second;
 	}
 
 	INT32 Font::getClosestSize(UINT32 size) const
 	{
+		if (!mFontDataPerSize.empty() && mFontDataPerSize.begin()->second->distanceField)
+			return size;
+
 		UINT32 minDiff = std::numeric_limits<UINT32>::max();
 		UINT32 bestSize = size;
 
@@ -132,6 +155,59 @@ namespace bs
 		return newFont;
 	}
 
+	SPtr<FontBitmap> Font::createScaledBitmap(const FontBitmap& source, UINT32 size)
+	{
+		float scale = size / (float)source.size;
+
+		auto scaleDesc = [scale](const CharDesc& desc)
+		{
+			CharDesc output = desc;
+			output.width = (UINT32)Math::roundToInt(desc.width * scale);
+			output.height = (UINT32)Math::roundToInt(desc.height * scale);
+			output.xOffset = Math::roundToInt(desc.xOffset * scale);
+			output.yOffset = Math::roundToInt(desc.yOffset * scale);
+			output.xAdvance = Math::roundToInt(desc.xAdvance * scale);
+			output.yAdvance = Math::roundToInt(desc.yAdvance * scale);
+
+			for (auto& kerningPair : output.kerningPairs)
+				kerningPair.amount = Math::roundToInt(kerningPair.amount * scale);
+
+			return output;
+		};
+
+		SPtr<FontBitmap> output = bs_shared_ptr_new<FontBitmap>();
+		output->size = size;
+		output->baselineOffset = Math::roundToInt(source.baselineOffset * scale);
+		output->lineHeight = (UINT32)Math::roundToInt(source.lineHeight * scale);
+		output->spaceWidth = (UINT32)Math::roundToInt(source.spaceWidth * scale);
+		output->missingGlyph = scaleDesc(source.missingGlyph);
+		output->texturePages = source.texturePages;
+		output->distanceField = true;
+
+		// Characters missing from the scaled bitmap are requested from the source bitmap's atlas, if any
+		output->dynamicAtlas = source.dynamicAtlas;
+
+		for (auto& entry : source.characters)
+			output->characters[entry.first] = scaleDesc(entry.second);
+
+		return output;
+	}
+
+	void Font::_setRasterizer(const SPtr<FontRasterizer>& rasterizer)
+	{
+		for (auto& fontDataEntry : mFontDataPerSize)
+		{
+			SPtr<FontBitmap>& fontData = fontDataEntry.second;
+
+			if (rasterizer != nullptr)
+				fontData->dynamicAtlas = bs_shared_ptr_new<DynamicFontAtlas>(*fontData, rasterizer);
+			else
+				fontData->dynamicAtlas = nullptr;
+		}
+
+		mScaledFontData.clear();
+	}
+
 	RTTITypeBase* Font::getRTTIStatic()
 	{
 		return FontRTTI::instance();
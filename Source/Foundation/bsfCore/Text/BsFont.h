@@ -46,6 +46,18 @@ namespace bs
 		/** All characters in the font referenced by character ID. */
 		Map<UINT32, CharDesc> characters;
 
+		/**
+		 * If true the textures contain signed distance fields of the characters instead of their coverage. Such bitmaps
+		 * can be scaled to any font size and require a distance field aware material to render.
+		 */
+		bool distanceField = false;
+
+		/**
+		 * Optional atlas that renders characters missing from the bitmap on demand. Not serialized, assigned through
+		 * Font::_setRasterizer().
+		 */
+		SPtr<DynamicFontAtlas> dynamicAtlas;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -57,7 +69,8 @@ namespace bs
 
 	/**
 	 * Font resource containing data about textual characters and how to render text. Contains one or multiple font 
-	 * bitmaps, each for a specific size.
+	 * bitmaps, each for a specific size. Alternatively contains a single distance field bitmap that can be used for
+	 * rendering text of any size.
 	 */
 	class BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:GUI_Engine) Font : public Resource
 	{
@@ -65,7 +78,7 @@ namespace bs
 		virtual ~Font();
 
 		/**
-		 * Returns font bitmap for a specific font size.
+		 * Returns font bitmap for a specific font size. Distance field fonts return a bitmap for any size.
 		 *
 		 * @param[in]	size	Size of the bitmap in points.
 		 * @return				Bitmap object if it exists, false otherwise.
@@ -74,7 +87,8 @@ namespace bs
 		SPtr<FontBitmap> getBitmap(UINT32 size) const;
 
 		/**	
-		 * Finds the available font bitmap size closest to the provided size. 
+		 * Finds the available font bitmap size closest to the provided size. Distance field fonts always return the
+		 * provided size.
 		 * 
 		 * @param[in]	size	Size of the bitmap in points.
 		 * @return				Nearest available bitmap size.
@@ -105,6 +119,12 @@ namespace bs
 		/** Creates a Font without initializing it. */
 		static SPtr<Font> _createEmpty();
 
+		/**
+		 * Assigns a rasterizer that will be used for rendering characters missing from the font bitmaps on demand, as
+		 * they are first used. Provide null to stop rendering new characters.
+		 */
+		void _setRasterizer(const SPtr<FontRasterizer>& rasterizer);
+
 		/** @} */
 
 	protected:
@@ -119,7 +139,18 @@ namespace bs
 		void getCoreDependencies(Vector<CoreObject*>& dependencies) override;
 
 	private:
+		/** Font bitmap created by scaling a distance field bitmap to a different size. */
+		struct ScaledBitmap
+		{
+			SPtr<FontBitmap> bitmap;
+			UINT32 numSourceCharacters = 0;
+		};
+
+		/** Creates a version of the distance field bitmap with all metrics scaled to the provided size. */
+		static SPtr<FontBitmap> createScaledBitmap(const FontBitmap& source, UINT32 size);
+
 		Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
+		mutable Map<UINT32, ScaledBitmap> mScaledFontData;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
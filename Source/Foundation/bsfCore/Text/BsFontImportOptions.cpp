@@ -6,7 +6,7 @@
 namespace bs
 {
 	FontImportOptions::FontImportOptions()
-		:mDPI(96), mRenderMode(FontRenderMode::HintedSmooth), mBold(false), mItalic(false)
+		:mDPI(96), mRenderMode(FontRenderMode::HintedSmooth), mBold(false), mItalic(false), mDynamic(false)
 	{
 		mFontSizes.push_back(10);
 		mCharIndexRanges.push_back(std::make_pair(33, 166)); // Most used ASCII characters
@@ -18,7 +18,8 @@ namespace bs
 		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
 		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
 		HintedSmooth, /*< Render antialiased fonts with hinting. */
-		HintedRaster /*< Render non-antialiased fonts with hinting. */
+		HintedRaster, /*< Render non-antialiased fonts with hinting. */
+		DistanceField /*< Render signed distance fields, allowing the same textures to be used for all font sizes. */
 	};
 
 	/**	Import options that allow you to control how is a font imported. */
@@ -27,7 +28,10 @@ namespace bs
 	public:
 		FontImportOptions();
 
-		/**	Sets font sizes that are to be imported. Sizes are in points. */
+		/**
+		 * Sets font sizes that are to be imported. Sizes are in points. When rendering distance fields only the largest
+		 * size is imported, and is used for rendering all sizes.
+		 */
 		void setFontSizes(const Vector<UINT32>& fontSizes) { mFontSizes = fontSizes; }
 
 		/**	Adds an index range of characters to import.  */
@@ -48,6 +52,15 @@ namespace bs
 		/**	Sets whether the italic font style should be used when rendering. */
 		void setItalic(bool italic) { mItalic = italic; }
 
+		/**
+		 * Determines should characters outside of the imported ranges be rendered on demand at runtime, when they are
+		 * first used. Useful for fonts with very large character sets (e.g. CJK), where importing all characters up
+		 * front would be too slow and require too much texture memory. The font file is kept in memory for as long as the
+		 * imported font exists, and characters can only be rendered on demand for fonts imported in the running
+		 * application.
+		 */
+		void setDynamic(bool dynamic) { mDynamic = dynamic; }
+
 		/**	Gets the sizes that are to be imported. Ranges are defined as unicode numbers. */
 		Vector<UINT32> getFontSizes() const { return mFontSizes; }
 
@@ -66,6 +79,9 @@ namespace bs
 		/**	Sets whether the italic font style should be used when rendering. */
 		bool getItalic() const { return mItalic; }
 
+		/** Checks should characters outside of the imported ranges be rendered on demand. See setDynamic(). */
+		bool getDynamic() const { return mDynamic; }
+
 		/** Creates a new import options object that allows you to customize how are fonts imported. */
 		static SPtr<FontImportOptions> create();
 
@@ -76,6 +92,7 @@ namespace bs
 		FontRenderMode mRenderMode;
 		bool mBold;
 		bool mItalic;
+		bool mDynamic;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -135,6 +135,18 @@ namespace bs
 		DOT_TRIANGLE_FAN	BS_SCRIPT_EXPORT(n:TriangleFan)		= 6
 	};
 
+	/** 
+	 * Size of the pixel block that a single fragment program invocation is shaded for, when variable rate shading is
+	 * supported (see RSC_VARIABLE_RATE_SHADING). 
+	 */
+	enum ShadingRate
+	{
+		SR_1X1, /**< Each pixel is shaded separately. */
+		SR_1X2, /**< A single invocation shades a block one pixel wide and two pixels tall. */
+		SR_2X1, /**< A single invocation shades a block two pixels wide and one pixel tall. */
+		SR_2X2 /**< A single invocation shades a 2x2 block of pixels. */
+	};
+
 	/**	Type of mesh indices used, used for determining maximum number of vertices in a mesh. */
 	enum BS_SCRIPT_EXPORT(m:Rendering) IndexType
 	{
@@ -3,6 +3,7 @@
 #include "2D/BsImageSprite.h"
 #include "2D/BsSpriteTexture.h"
 #include "2D/BsSpriteManager.h"
+#include "2D/BsSpriteAtlas.h"
 #include "Image/BsTexture.h"
 
 namespace bs
@@ -45,13 +46,13 @@ namespace bs
 				UINT32 oldVertexCount = renderElem.numQuads * 4;
 				UINT32 oldIndexCount = renderElem.numQuads * 6;
 
-				if(renderElem.vertices != nullptr) bs_deleteN(renderElem.vertices, oldVertexCount);
-				if(renderElem.uvs != nullptr) bs_deleteN(renderElem.uvs, oldVertexCount);
-				if(renderElem.indexes != nullptr) bs_deleteN(renderElem.indexes, oldIndexCount);
+				if(renderElem.vertices != nullptr) bs_deleteN<Vector2, GUIAlloc>(renderElem.vertices, oldVertexCount);
+				if(renderElem.uvs != nullptr) bs_deleteN<Vector2, GUIAlloc>(renderElem.uvs, oldVertexCount);
+				if(renderElem.indexes != nullptr) bs_deleteN<UINT32, GUIAlloc>(renderElem.indexes, oldIndexCount);
 
-				renderElem.vertices = bs_newN<Vector2>(newNumQuads * 4);
-				renderElem.uvs = bs_newN<Vector2>(newNumQuads * 4);
-				renderElem.indexes = bs_newN<UINT32>(newNumQuads * 6);
+				renderElem.vertices = bs_newN<Vector2, GUIAlloc>(newNumQuads * 4);
+				renderElem.uvs = bs_newN<Vector2, GUIAlloc>(newNumQuads * 4);
+				renderElem.indexes = bs_newN<UINT32, GUIAlloc>(newNumQuads * 6);
 				renderElem.numQuads = newNumQuads;
 			}
 
@@ -238,6 +239,36 @@ namespace bs
 			renderElem.uvs[3] = desc.texture->transformUV(Vector2(uvOffset.x + uvScale.x, uvOffset.y + uvScale.y));
 		}
 
+		// Render from the shared atlas if possible, so the sprite can be batched with sprites using other textures. Not
+		// possible if the sprite tiles the texture, as the UVs would wrap into other atlas entries.
+		SpriteAtlas* atlas = SpriteManager::instance().getAtlas();
+		if(atlas != nullptr)
+		{
+			UINT32 numVertices = numQuads * 4;
+
+			bool uvsInRange = true;
+			for(UINT32 i = 0; i < numVertices; i++)
+			{
+				const Vector2& uv = renderElem.uvs[i];
+				if(uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f)
+				{
+					uvsInRange = false;
+					break;
+				}
+			}
+
+			HTexture atlasTexture;
+			Vector2 atlasUVOffset;
+			Vector2 atlasUVScale;
+			if(uvsInRange && atlas->find(desc.texture->getTexture(), atlasTexture, atlasUVOffset, atlasUVScale))
+			{
+				renderElem.matInfo.texture = atlasTexture;
+
+				for(UINT32 i = 0; i < numVertices; i++)
+					renderElem.uvs[i] = atlasUVOffset + renderElem.uvs[i] * atlasUVScale;
+			}
+		}
+
 		updateBounds();
 	}
 
@@ -250,19 +281,19 @@ namespace bs
 
 			if (renderElem.vertices != nullptr)
 			{
-				bs_deleteN(renderElem.vertices, vertexCount);
+				bs_deleteN<Vector2, GUIAlloc>(renderElem.vertices, vertexCount);
 				renderElem.vertices = nullptr;
 			}
 
 			if (renderElem.uvs != nullptr)
 			{
-				bs_deleteN(renderElem.uvs, vertexCount);
+				bs_deleteN<Vector2, GUIAlloc>(renderElem.uvs, vertexCount);
 				renderElem.uvs = nullptr;
 			}
 
 			if (renderElem.indexes != nullptr)
 			{
-				bs_deleteN(renderElem.indexes, indexCount);
+				bs_deleteN<UINT32, GUIAlloc>(renderElem.indexes, indexCount);
 				renderElem.indexes = nullptr;
 			}
 		}
@@ -326,7 +326,7 @@ namespace bs
 	void Sprite::clipTrianglesToRect(UINT8* vertices, UINT8* uv, UINT32 numTris, UINT32 vertStride, const Rect2I& clipRect, 
 		const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback)
 	{
-		Vector<Plane> clipPlanes =
+		const Plane clipPlanes[] =
 		{
 			Plane(Vector3(1.0f, 0.0f, 0.0f), (float)clipRect.x),
 			Plane(Vector3(-1.0f, 0.0f, 0.0f), (float)-(clipRect.x + (INT32)clipRect.width)),
@@ -334,6 +334,6 @@ namespace bs
 			Plane(Vector3(0.0f, -1.0f, 0.0f), (float)-(clipRect.y + (INT32)clipRect.height))
 		};
 
-		MeshUtility::clip2D(vertices, uv, numTris, vertStride, clipPlanes, writeCallback);
+		MeshUtility::clip2D(vertices, uv, numTris, vertStride, clipPlanes, 4, writeCallback);
 	}
 }
\ No newline at end of file
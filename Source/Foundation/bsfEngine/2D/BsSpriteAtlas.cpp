@@ -0,0 +1,135 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "2D/BsSpriteAtlas.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelUtil.h"
+#include "Image/BsColor.h"
+#include "CoreThread/BsCoreThread.h"
+
+namespace bs
+{
+	const UINT32 SpriteAtlas::PADDING = 1;
+
+	SpriteAtlas::SpriteAtlas(UINT32 pageSize, UINT32 maxTextureSize, UINT32 maxPages)
+		:mPageSize(pageSize), mMaxTextureSize(maxTextureSize), mMaxPages(maxPages)
+	{ }
+
+	bool SpriteAtlas::find(const HTexture& texture, HTexture& atlasTexture, Vector2& uvOffset, Vector2& uvScale)
+	{
+		// Textures that are still loading might be supported once they load, so don't remember them
+		if (!texture.isLoaded(false))
+			return false;
+
+		UINT64 textureId = texture->getInternalID();
+		auto iterFind = mEntries.find(textureId);
+		if (iterFind == mEntries.end())
+		{
+			Entry& entry = mEntries[textureId];
+			if (!isSupported(*texture))
+				return false;
+
+			const TextureProperties& props = texture->getProperties();
+			UINT32 width = props.getWidth();
+			UINT32 height = props.getHeight();
+
+			UINT32 x = 0;
+			UINT32 y = 0;
+			UINT32 pageIdx = (UINT32)-1;
+			for (UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+			{
+				Page& page = mPages[i];
+				if (page.format != props.getFormat() || page.hwGamma != props.isHardwareGammaEnabled())
+					continue;
+
+				if (page.layout.addElement(width + PADDING * 2, height + PADDING * 2, x, y))
+				{
+					pageIdx = i;
+					break;
+				}
+			}
+
+			if (pageIdx == (UINT32)-1)
+			{
+				if (mPages.size() >= mMaxPages)
+					return false;
+
+				pageIdx = (UINT32)mPages.size();
+				mPages.push_back(Page(mPageSize));
+
+				Page& page = mPages.back();
+				page.format = props.getFormat();
+				page.hwGamma = props.isHardwareGammaEnabled();
+
+				TEXTURE_DESC pageDesc;
+				pageDesc.width = mPageSize;
+				pageDesc.height = mPageSize;
+				pageDesc.format = page.format;
+				pageDesc.hwGamma = page.hwGamma;
+
+				page.texture = Texture::create(pageDesc);
+
+				// Clear the page so the padding around the entries is transparent
+				SPtr<ct::Texture> pageCore = page.texture->getCore();
+				gCoreThread().queueCommand([pageCore]()
+				{
+					pageCore->clear(Color::ZERO);
+				});
+
+				// Always fits, since the texture size is limited to less than the page size
+				page.layout.addElement(width + PADDING * 2, height + PADDING * 2, x, y);
+			}
+
+			TEXTURE_COPY_DESC copyDesc;
+			copyDesc.dstPosition = Vector3I((INT32)(x + PADDING), (INT32)(y + PADDING), 0);
+
+			SPtr<ct::Texture> srcCore = texture->getCore();
+			SPtr<ct::Texture> dstCore = mPages[pageIdx].texture->getCore();
+			gCoreThread().queueCommand([srcCore, dstCore, copyDesc]()
+			{
+				srcCore->copy(dstCore, copyDesc);
+			});
+
+			float invPageSize = 1.0f / (float)mPageSize;
+
+			entry.pageIdx = pageIdx;
+			entry.uvOffset = Vector2((x + PADDING) * invPageSize, (y + PADDING) * invPageSize);
+			entry.uvScale = Vector2(width * invPageSize, height * invPageSize);
+
+			iterFind = mEntries.find(textureId);
+		}
+
+		const Entry& entry = iterFind->second;
+		if (entry.pageIdx == (UINT32)-1)
+			return false;
+
+		atlasTexture = mPages[entry.pageIdx].texture;
+		uvOffset = entry.uvOffset;
+		uvScale = entry.uvScale;
+
+		return true;
+	}
+
+	void SpriteAtlas::clear()
+	{
+		mPages.clear();
+		mEntries.clear();
+	}
+
+	bool SpriteAtlas::isSupported(const Texture& texture) const
+	{
+		const TextureProperties& props = texture.getProperties();
+
+		if (props.getTextureType() != TEX_TYPE_2D || props.getNumArraySlices() > 1 || props.getNumSamples() > 1)
+			return false;
+
+		UINT32 maxSize = std::min(mMaxTextureSize, mPageSize - PADDING * 2);
+		if (props.getWidth() > maxSize || props.getHeight() > maxSize)
+			return false;
+
+		if ((props.getUsage() & (TU_STREAMED | TU_RENDERTARGET | TU_DEPTHSTENCIL | TU_LOADSTORE)) != 0)
+			return false;
+
+		PixelFormat format = props.getFormat();
+		return !PixelUtil::isCompressed(format) && !PixelUtil::isDepth(format);
+	}
+}
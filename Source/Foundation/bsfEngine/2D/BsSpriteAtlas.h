@@ -0,0 +1,92 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Image/BsTextureAtlasLayout.h"
+#include "Image/BsPixelData.h"
+#include "Math/BsVector2.h"
+
+namespace bs
+{
+	/** @addtogroup 2D-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Packs small textures used by sprites into shared atlas textures at runtime. Sprites rendering from the atlas instead
+	 * of their original texture can be batched together even if their original textures differ.
+	 *
+	 * Only the top mip level of the source texture is copied into the atlas, and only uncompressed, non-streamed 2D
+	 * textures up to a certain size are accepted. Each entry is surrounded by a transparent border to avoid neighbouring
+	 * entries bleeding into each other when filtering.
+	 */
+	class BS_EXPORT SpriteAtlas
+	{
+		/** Information about a single texture placed in the atlas. */
+		struct Entry
+		{
+			UINT32 pageIdx = (UINT32)-1;
+			Vector2 uvOffset;
+			Vector2 uvScale;
+		};
+
+		/** A single atlas texture containing one or multiple packed textures. */
+		struct Page
+		{
+			Page(UINT32 size)
+				:layout(size, size, size, size)
+			{ }
+
+			HTexture texture;
+			TextureAtlasLayout layout;
+			PixelFormat format = PF_UNKNOWN;
+			bool hwGamma = false;
+		};
+
+	public:
+		/**
+		 * Creates a new sprite atlas.
+		 *
+		 * @param[in]	pageSize			Width and height of a single atlas texture, in pixels.
+		 * @param[in]	maxTextureSize		Maximum width or height of a texture that will be packed into the atlas, in
+		 *									pixels. Larger textures are always rendered on their own.
+		 * @param[in]	maxPages			Maximum number of atlas textures to create.
+		 */
+		SpriteAtlas(UINT32 pageSize = 1024, UINT32 maxTextureSize = 256, UINT32 maxPages = 8);
+
+		/**
+		 * Attempts to find the provided texture in the atlas, adding it to the atlas if it isn't already present.
+		 *
+		 * @param[in]	texture			Texture to look up.
+		 * @param[out]	atlasTexture	Atlas texture containing the texture.
+		 * @param[out]	uvOffset		Offset to apply to UV coordinates referencing the original texture, after they have
+		 *								been scaled by @p uvScale, in order to reference the same area in the atlas texture.
+		 * @param[out]	uvScale			Scale to apply to UV coordinates referencing the original texture.
+		 * @return						True if the texture is in the atlas, false if it cannot be packed and the original
+		 *								texture must be used instead.
+		 */
+		bool find(const HTexture& texture, HTexture& atlasTexture, Vector2& uvOffset, Vector2& uvScale);
+
+		/** 
+		 * Releases all atlas textures. Sprites referencing the atlas textures will keep them alive until they are updated
+		 * next.
+		 */
+		void clear();
+
+	private:
+		/** Checks if the provided texture can be packed into the atlas. */
+		bool isSupported(const Texture& texture) const;
+
+		static const UINT32 PADDING;
+
+		UINT32 mPageSize;
+		UINT32 mMaxTextureSize;
+		UINT32 mMaxPages;
+
+		Vector<Page> mPages;
+		UnorderedMap<UINT64, Entry> mEntries;
+	};
+
+	/** @} */
+}
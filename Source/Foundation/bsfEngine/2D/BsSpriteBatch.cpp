@@ -0,0 +1,269 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "2D/BsSpriteBatch.h"
+#include "2D/BsSpriteMaterial.h"
+#include "2D/BsSpriteTexture.h"
+#include "GUI/BsGUIManager.h"
+#include "Resources/BsBuiltinResources.h"
+#include "Mesh/BsMeshHeap.h"
+#include "Mesh/BsMeshData.h"
+#include "Mesh/BsTransientMesh.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "RenderAPI/BsViewport.h"
+#include "Managers/BsRenderStateManager.h"
+#include "Renderer/BsCamera.h"
+#include "CoreThread/BsCoreThread.h"
+
+namespace bs
+{
+	/** Number of vertices the mesh heap is initially created with. It grows as needed. */
+	static constexpr UINT32 INITIAL_HEAP_VERTICES = 4096;
+
+	SpriteBatch::SpriteBatch(const SPtr<Camera>& camera)
+		:mCamera(camera)
+	{
+		mVertexDesc = bs_shared_ptr_new<VertexDataDesc>();
+		mVertexDesc->addVertElem(VET_FLOAT2, VES_POSITION);
+		mVertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		mMeshHeap = MeshHeap::create(INITIAL_HEAP_VERTICES, INITIAL_HEAP_VERTICES / 4 * 6, mVertexDesc);
+		mRenderer = RendererExtension::create<ct::SpriteBatchRenderer>(nullptr);
+	}
+
+	SpriteBatch::~SpriteBatch()
+	{
+		if (mMesh != nullptr)
+			mMeshHeap->dealloc(mMesh);
+	}
+
+	void SpriteBatch::drawImage(const IMAGE_SPRITE_DESC& desc, const Vector2I& position, INT32 layer)
+	{
+		mImageSprite.update(desc, 0);
+		addSprite(mImageSprite, position, layer);
+	}
+
+	void SpriteBatch::drawText(const TEXT_SPRITE_DESC& desc, const Vector2I& position, INT32 layer)
+	{
+		mTextSprite.update(desc, 0);
+		addSprite(mTextSprite, position, layer);
+	}
+
+	void SpriteBatch::drawRect(const Rect2I& area, const Color& color, INT32 layer)
+	{
+		IMAGE_SPRITE_DESC desc;
+		desc.width = area.width;
+		desc.height = area.height;
+		desc.texture = BuiltinResources::instance().getWhiteSpriteTexture().getInternalPtr();
+		desc.color = color;
+		desc.transparent = color.a < 1.0f;
+
+		drawImage(desc, Vector2I(area.x, area.y), layer);
+	}
+
+	void SpriteBatch::addSprite(const Sprite& sprite, const Vector2I& position, INT32 layer)
+	{
+		UINT32 numRenderElements = sprite.getNumRenderElements();
+		for (UINT32 i = 0; i < numRenderElements; i++)
+		{
+			UINT32 numQuads = sprite.getNumQuads(i);
+			if (numQuads == 0)
+				continue;
+
+			Submission submission;
+			submission.layer = layer;
+			submission.sequence = (UINT32)mSubmissions.size();
+			submission.material = sprite.getMaterial(i);
+			submission.matInfo = sprite.getMaterialInfo(i);
+			submission.mergeHash = submission.material->getMergeHash(submission.matInfo);
+			submission.vertexOffset = (UINT32)mPositions.size();
+			submission.numVertices = numQuads * 4;
+			submission.indexOffset = (UINT32)mIndices.size();
+			submission.numIndices = numQuads * 6;
+
+			UINT32 numVertices = submission.vertexOffset + submission.numVertices;
+			UINT32 numIndices = submission.indexOffset + submission.numIndices;
+
+			mPositions.resize(numVertices);
+			mUVs.resize(numVertices);
+			mIndices.resize(numIndices);
+
+			sprite.fillBuffer((UINT8*)mPositions.data(), (UINT8*)mUVs.data(), mIndices.data(), submission.vertexOffset,
+				submission.indexOffset, numVertices, numIndices, sizeof(Vector2), sizeof(UINT32), i, position,
+				Rect2I(), false);
+
+			mSubmissions.push_back(submission);
+		}
+	}
+
+	void SpriteBatch::flush()
+	{
+		// Group submissions using the same material together, while keeping the layer order
+		std::sort(mSubmissions.begin(), mSubmissions.end(), [](const Submission& a, const Submission& b)
+		{
+			if (a.layer != b.layer)
+				return a.layer < b.layer;
+
+			if (a.mergeHash != b.mergeHash)
+				return a.mergeHash < b.mergeHash;
+
+			return a.sequence < b.sequence;
+		});
+
+		SPtr<TransientMesh> oldMesh = mMesh;
+		mMesh = nullptr;
+
+		Vector<ct::SpriteBatchRenderer::Batch> batches;
+		if (!mSubmissions.empty())
+		{
+			SPtr<MeshData> meshData = MeshData::create((UINT32)mPositions.size(), (UINT32)mIndices.size(), mVertexDesc);
+
+			UINT32 vertexStride = mVertexDesc->getVertexStride();
+			UINT8* positions = meshData->getElementData(VES_POSITION);
+			UINT8* uvs = meshData->getElementData(VES_TEXCOORD);
+			UINT32* indices = meshData->getIndices32();
+
+			UINT32 vertexOffset = 0;
+			UINT32 indexOffset = 0;
+			SpriteMaterialInfo batchMatInfo;
+
+			for (size_t i = 0; i < mSubmissions.size(); i++)
+			{
+				const Submission& submission = mSubmissions[i];
+
+				for (UINT32 j = 0; j < submission.numVertices; j++)
+				{
+					memcpy(positions, &mPositions[submission.vertexOffset + j], sizeof(Vector2));
+					memcpy(uvs, &mUVs[submission.vertexOffset + j], sizeof(Vector2));
+
+					positions += vertexStride;
+					uvs += vertexStride;
+				}
+
+				for (UINT32 j = 0; j < submission.numIndices; j++)
+					indices[indexOffset + j] = mIndices[submission.indexOffset + j] + vertexOffset;
+
+				bool newBatch = i == 0 || submission.mergeHash != mSubmissions[i - 1].mergeHash ||
+					submission.material != mSubmissions[i - 1].material;
+
+				if (newBatch)
+				{
+					batches.push_back(ct::SpriteBatchRenderer::Batch());
+					ct::SpriteBatchRenderer::Batch& batch = batches.back();
+
+					batch.material = submission.material;
+					batch.subMesh.indexOffset = indexOffset;
+					batch.subMesh.indexCount = 0;
+					batch.subMesh.drawOp = DOT_TRIANGLE_LIST;
+
+					batchMatInfo = submission.matInfo.clone();
+				}
+				else
+					submission.material->merge(batchMatInfo, submission.matInfo);
+
+				ct::SpriteBatchRenderer::Batch& batch = batches.back();
+				batch.subMesh.indexCount += submission.numIndices;
+				batch.tint = batchMatInfo.tint;
+				batch.additionalData = batchMatInfo.additionalData;
+
+				if (batchMatInfo.texture.isLoaded())
+					batch.texture = batchMatInfo.texture->getCore();
+				else
+					batch.texture = nullptr;
+
+				vertexOffset += submission.numVertices;
+				indexOffset += submission.numIndices;
+			}
+
+			mMesh = mMeshHeap->alloc(meshData, DOT_TRIANGLE_LIST);
+		}
+
+		// The old mesh can be released right away, its memory won't be re-used until the GPU is done with it
+		if (oldMesh != nullptr)
+			mMeshHeap->dealloc(oldMesh);
+
+		SPtr<ct::Camera> camera = mCamera != nullptr ? mCamera->getCore() : nullptr;
+		SPtr<ct::MeshBase> mesh = mMesh != nullptr ? mMesh->getCore() : nullptr;
+
+		gCoreThread().queueCommand(std::bind(&ct::SpriteBatchRenderer::updateData, mRenderer.get(), camera, mesh,
+			batches));
+
+		mNumBatches = (UINT32)batches.size();
+
+		mSubmissions.clear();
+		mPositions.clear();
+		mUVs.clear();
+		mIndices.clear();
+	}
+
+	namespace ct
+	{
+	SpriteBatchRenderer::SpriteBatchRenderer()
+		:RendererExtension(RenderLocation::Overlay, 20)
+	{ }
+
+	void SpriteBatchRenderer::initialize(const Any& data)
+	{
+		SAMPLER_STATE_DESC ssDesc;
+		ssDesc.magFilter = FO_POINT;
+		ssDesc.minFilter = FO_POINT;
+		ssDesc.mipFilter = FO_POINT;
+
+		mSamplerState = RenderStateManager::instance().createSamplerState(ssDesc);
+	}
+
+	bool SpriteBatchRenderer::check(const Camera& camera)
+	{
+		return &camera == mCamera.get() && !mBatches.empty();
+	}
+
+	void SpriteBatchRenderer::render(const Camera& camera)
+	{
+		float invViewportWidth = 1.0f / (camera.getViewport()->getPixelArea().width * 0.5f);
+		float invViewportHeight = 1.0f / (camera.getViewport()->getPixelArea().height * 0.5f);
+		float viewflipYFlip = bs::RenderAPI::getAPIInfo().isFlagSet(RenderAPIFeatureFlag::NDCYAxisDown) ? -1.0f : 1.0f;
+
+		for (UINT32 i = 0; i < (UINT32)mBatches.size(); i++)
+		{
+			SPtr<GpuParamBlockBuffer> buffer = mParamBlocks[i];
+
+			gGUISpriteParamBlockDef.gInvViewportWidth.set(buffer, invViewportWidth);
+			gGUISpriteParamBlockDef.gInvViewportHeight.set(buffer, invViewportHeight);
+			gGUISpriteParamBlockDef.gViewportYFlip.set(buffer, viewflipYFlip);
+
+			buffer->flushToGPU();
+		}
+
+		for (UINT32 i = 0; i < (UINT32)mBatches.size(); i++)
+		{
+			const Batch& batch = mBatches[i];
+			batch.material->render(mMesh, batch.subMesh, batch.texture, mSamplerState, mParamBlocks[i],
+				batch.additionalData);
+		}
+	}
+
+	void SpriteBatchRenderer::updateData(const SPtr<Camera>& camera, const SPtr<MeshBase>& mesh,
+		const Vector<Batch>& batches)
+	{
+		mCamera = camera;
+		mMesh = mesh;
+		mBatches = batches;
+
+		UINT32 numBuffers = (UINT32)mBatches.size();
+		UINT32 numAllocatedBuffers = (UINT32)mParamBlocks.size();
+		if (numBuffers > numAllocatedBuffers)
+		{
+			mParamBlocks.resize(numBuffers);
+
+			for (UINT32 i = numAllocatedBuffers; i < numBuffers; i++)
+				mParamBlocks[i] = gGUISpriteParamBlockDef.createBuffer();
+		}
+
+		for (UINT32 i = 0; i < numBuffers; i++)
+		{
+			gGUISpriteParamBlockDef.gTint.set(mParamBlocks[i], mBatches[i].tint);
+			gGUISpriteParamBlockDef.gWorldTransform.set(mParamBlocks[i], Matrix4::IDENTITY);
+		}
+	}
+	}
+}
@@ -0,0 +1,167 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "2D/BsImageSprite.h"
+#include "2D/BsTextSprite.h"
+#include "Renderer/BsRendererExtension.h"
+#include "RenderAPI/BsSubMesh.h"
+
+namespace bs
+{
+	namespace ct { class SpriteBatchRenderer; }
+
+	/** @addtogroup 2D
+	 *  @{
+	 */
+
+	/**
+	 * Renders large amounts of sprites, text and shapes as an overlay on top of a camera, without going through the GUI
+	 * system. Meant for in-game HUDs, icons and nameplates whose contents change every frame.
+	 *
+	 * Sprites are submitted each frame using the draw methods, after which flush() must be called to display them. On
+	 * flush all submissions are sorted by their layer and material, and rendered with as few draw calls as possible.
+	 * Contents of the last flush() keep being displayed until the next call to flush().
+	 *
+	 * @note	Sim thread only. Rendered before the GUI, so any GUI displayed on the same camera appears on top.
+	 */
+	class BS_EXPORT SpriteBatch
+	{
+		/** A single sprite render element submitted for rendering. */
+		struct Submission
+		{
+			INT32 layer;
+			UINT32 sequence;
+			SpriteMaterial* material;
+			UINT64 mergeHash;
+			SpriteMaterialInfo matInfo;
+			UINT32 vertexOffset;
+			UINT32 numVertices;
+			UINT32 indexOffset;
+			UINT32 numIndices;
+		};
+
+	public:
+		/**
+		 * Creates a new sprite batch.
+		 *
+		 * @param[in]	camera	Camera whose viewport to render the sprites on. Sprite positions are specified in pixels,
+		 *						relative to the top left corner of the viewport.
+		 */
+		SpriteBatch(const SPtr<Camera>& camera);
+		~SpriteBatch();
+
+		/**
+		 * Submits an image sprite for rendering.
+		 *
+		 * @param[in]	desc		Describes the image to render.
+		 * @param[in]	position	Position of the sprite in pixels, relative to the viewport.
+		 * @param[in]	layer		Determines the order of rendering. Sprites in higher layers are displayed on top of
+		 *							sprites in lower layers. Order of sprites within the same layer is not defined, as
+		 *							they are re-ordered to minimize the number of draw calls.
+		 */
+		void drawImage(const IMAGE_SPRITE_DESC& desc, const Vector2I& position, INT32 layer = 0);
+
+		/**
+		 * Submits a text sprite for rendering.
+		 *
+		 * @param[in]	desc		Describes the text to render.
+		 * @param[in]	position	Position of the sprite in pixels, relative to the viewport.
+		 * @param[in]	layer		Determines the order of rendering. See drawImage().
+		 */
+		void drawText(const TEXT_SPRITE_DESC& desc, const Vector2I& position, INT32 layer = 0);
+
+		/**
+		 * Submits a solid colored rectangle for rendering.
+		 *
+		 * @param[in]	area		Area of the rectangle in pixels, relative to the viewport.
+		 * @param[in]	color		Color of the rectangle.
+		 * @param[in]	layer		Determines the order of rendering. See drawImage().
+		 */
+		void drawRect(const Rect2I& area, const Color& color, INT32 layer = 0);
+
+		/**
+		 * Generates the geometry of all sprites submitted since the last call to flush() and sends it for rendering.
+		 * Should be called once per frame, after all sprites for the frame have been submitted.
+		 */
+		void flush();
+
+		/** Returns the number of draw calls the last call to flush() produced. */
+		UINT32 getNumBatches() const { return mNumBatches; }
+
+	private:
+		/** Appends the geometry of all render elements of the provided sprite to the list of submissions. */
+		void addSprite(const Sprite& sprite, const Vector2I& position, INT32 layer);
+
+		SPtr<Camera> mCamera;
+		SPtr<ct::SpriteBatchRenderer> mRenderer;
+		SPtr<VertexDataDesc> mVertexDesc;
+		SPtr<MeshHeap> mMeshHeap;
+		SPtr<TransientMesh> mMesh;
+
+		ImageSprite mImageSprite;
+		TextSprite mTextSprite;
+
+		Vector<Submission> mSubmissions;
+		Vector<Vector2> mPositions;
+		Vector<Vector2> mUVs;
+		Vector<UINT32> mIndices;
+		UINT32 mNumBatches = 0;
+	};
+
+	/** @} */
+
+	namespace ct
+	{
+	/** @addtogroup 2D-Internal
+	 *  @{
+	 */
+
+	/** Handles rendering of a SpriteBatch on the core thread. */
+	class BS_EXPORT SpriteBatchRenderer : public RendererExtension
+	{
+		friend class bs::SpriteBatch;
+
+		/** A group of sprites that can be rendered using a single draw call. */
+		struct Batch
+		{
+			SubMesh subMesh;
+			SPtr<Texture> texture;
+			SpriteMaterial* material;
+			Color tint;
+			SPtr<SpriteMaterialExtraInfo> additionalData;
+		};
+
+	public:
+		SpriteBatchRenderer();
+
+		/**	@copydoc RendererExtension::initialize */
+		void initialize(const Any& data) override;
+
+		/**	@copydoc RendererExtension::check */
+		bool check(const Camera& camera) override;
+
+		/**	@copydoc RendererExtension::render */
+		void render(const Camera& camera) override;
+
+	private:
+		/**
+		 * Updates the internal data that determines what will be rendered on the next render() call.
+		 *
+		 * @param[in]	camera	Camera to render the sprites on.
+		 * @param[in]	mesh	Mesh containing the geometry of all batches. Can be null if there is nothing to render.
+		 * @param[in]	batches	Portions of the mesh to render, in order.
+		 */
+		void updateData(const SPtr<Camera>& camera, const SPtr<MeshBase>& mesh, const Vector<Batch>& batches);
+
+		SPtr<Camera> mCamera;
+		SPtr<MeshBase> mMesh;
+		Vector<Batch> mBatches;
+		Vector<SPtr<GpuParamBlockBuffer>> mParamBlocks;
+		SPtr<SamplerState> mSamplerState;
+	};
+
+	/** @} */
+	}
+}
@@ -2,6 +2,8 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "2D/BsSpriteManager.h"
 #include "2D/BsSpriteMaterials.h"
+#include "2D/BsSpriteAtlas.h"
+#include "2D/BsTextSpriteCache.h"
 
 namespace bs
 {
@@ -11,17 +13,40 @@ namespace bs
 		SpriteMaterial* imageOpaqueMat = registerMaterial<SpriteImageOpaqueMaterial>();
 		SpriteMaterial* textMat = registerMaterial<SpriteTextMaterial>();
 		SpriteMaterial* lineMat = registerMaterial<SpriteLineMaterial>();
+		SpriteMaterial* textDistanceFieldMat = registerMaterial<SpriteTextDistanceFieldMaterial>();
 
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::ImageTransparent] = imageTransparentMat->getId();
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::ImageOpaque] = imageOpaqueMat->getId();
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Text] = textMat->getId();
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Line] = lineMat->getId();
+		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::TextDistanceField] = textDistanceFieldMat->getId();
+
+		mTextCache = bs_new<TextSpriteCache>();
 	}
 
 	SpriteManager::~SpriteManager()
 	{
 		for(auto& entry : mMaterials)
 			bs_delete(entry.second);
+
+		if (mAtlas != nullptr)
+			bs_delete(mAtlas);
+
+		bs_delete(mTextCache);
+	}
+
+	void SpriteManager::setAtlasEnabled(bool enabled)
+	{
+		if (enabled == (mAtlas != nullptr))
+			return;
+
+		if (enabled)
+			mAtlas = bs_new<SpriteAtlas>();
+		else
+		{
+			bs_delete(mAtlas);
+			mAtlas = nullptr;
+		}
 	}
 
 	SpriteMaterial* SpriteManager::getMaterial(UINT32 id) const
@@ -21,6 +21,7 @@ namespace bs
 			ImageTransparent,
 			ImageOpaque,
 			Text,
+			TextDistanceField,
 			Line,
 			Count // Keep at end
 		};
@@ -41,6 +42,10 @@ namespace bs
 		SpriteMaterial* getTextMaterial() const
 			{ return getMaterial(builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Text]); }
 
+		/** Returns the material used for rendering text sprites using distance field fonts. */
+		SpriteMaterial* getTextDistanceFieldMaterial() const
+			{ return getMaterial(builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::TextDistanceField]); }
+
 		/** Returns the material used for rendering antialiased lines. */
 		SpriteMaterial* getLineMaterial() const
 			{ return getMaterial(builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Line]); }
@@ -72,8 +77,23 @@ namespace bs
 			mMaterials[id] = newMaterial;
 			return newMaterial;
 		}
+
+		/**
+		 * Determines should image sprites render from shared runtime atlas textures instead of their own textures, where
+		 * possible. This allows sprites using different textures to be rendered in the same batch. Only affects sprites
+		 * updated after the change. Disabled by default.
+		 */
+		void setAtlasEnabled(bool enabled);
+
+		/** Returns the atlas image sprites should render from, or null if atlasing is disabled. */
+		SpriteAtlas* getAtlas() const { return mAtlas; }
+
+		/** Returns the cache holding the geometry of recently generated text sprites. */
+		TextSpriteCache& getTextCache() const { return *mTextCache; }
 	private:
 		UnorderedMap<UINT32, SpriteMaterial*> mMaterials;
+		SpriteAtlas* mAtlas = nullptr;
+		TextSpriteCache* mTextCache = nullptr;
 		UINT32 builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Count];
 	};
 
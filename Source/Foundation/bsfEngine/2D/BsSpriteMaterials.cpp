@@ -4,6 +4,7 @@
 #include "Resources/BsBuiltinResources.h"
 #include "RenderAPI/BsGpuBuffer.h"
 #include "Material/BsMaterial.h"
+#include "Managers/BsRenderStateManager.h"
 
 namespace bs
 {
@@ -22,4 +23,26 @@ namespace bs
 	SpriteLineMaterial::SpriteLineMaterial()
 		: SpriteMaterial(3, BuiltinResources::instance().createSpriteLineMaterial())
 	{ }
+
+	SpriteTextDistanceFieldMaterial::SpriteTextDistanceFieldMaterial()
+		: SpriteMaterial(4, BuiltinResources::instance().createSpriteTextDistanceFieldMaterial())
+	{ }
+
+	void SpriteTextDistanceFieldMaterial::render(const SPtr<ct::MeshBase>& mesh, const SubMesh& subMesh,
+		const SPtr<ct::Texture>& texture, const SPtr<ct::SamplerState>& sampler,
+		const SPtr<ct::GpuParamBlockBuffer>& paramBuffer, const SPtr<SpriteMaterialExtraInfo>& additionalData) const
+	{
+		// Distance fields need to be interpolated in order to produce smooth edges when scaled
+		if (mLinearSampler == nullptr)
+		{
+			SAMPLER_STATE_DESC ssDesc;
+			ssDesc.magFilter = FO_LINEAR;
+			ssDesc.minFilter = FO_LINEAR;
+			ssDesc.mipFilter = FO_POINT;
+
+			mLinearSampler = ct::RenderStateManager::instance().createSamplerState(ssDesc);
+		}
+
+		SpriteMaterial::render(mesh, subMesh, texture, mLinearSampler, paramBuffer, additionalData);
+	}
 }
\ No newline at end of file
@@ -32,6 +32,24 @@ namespace bs
 		SpriteTextMaterial();
 	};
 
+	/**
+	 * Sprite material used for rendering text using distance field fonts. Always samples the font texture using
+	 * bilinear filtering, regardless of the sampler provided for rendering.
+	 */
+	class BS_EXPORT SpriteTextDistanceFieldMaterial : public SpriteMaterial
+	{
+	public:
+		SpriteTextDistanceFieldMaterial();
+
+		/** @copydoc SpriteMaterial::render */
+		void render(const SPtr<ct::MeshBase>& mesh, const SubMesh& subMesh, const SPtr<ct::Texture>& texture,
+			const SPtr<ct::SamplerState>& sampler, const SPtr<ct::GpuParamBlockBuffer>& paramBuffer,
+			const SPtr<SpriteMaterialExtraInfo>& additionalData) const override;
+
+	private:
+		mutable SPtr<ct::SamplerState> mLinearSampler; // Core thread only
+	};
+
 	/** Sprite material used for antialiased lines. */
 	class BS_EXPORT SpriteLineMaterial : public SpriteMaterial
 	{
@@ -4,7 +4,7 @@
 #include "Text/BsTextData.h"
 #include "Math/BsVector2.h"
 #include "2D/BsSpriteManager.h"
-#include "String/BsUnicode.h"
+#include "2D/BsTextSpriteCache.h"
 
 namespace bs
 {
@@ -20,63 +20,51 @@ namespace bs
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
 	{
-		bs_frame_mark();
-		{
-			const U32String utf32text = UTF8::toUTF32(desc.text);
-			TextData<FrameAlloc> textData(utf32text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap, 
-				desc.wordBreak);
+		const TextSpriteGeometry& geometry = SpriteManager::instance().getTextCache().get(desc);
+		UINT32 numPages = (UINT32)geometry.pages.size();
 
-			UINT32 numPages = textData.getNumPages();
+		// Free all previous memory
+		for (auto& cachedElem : mCachedRenderElements)
+		{
+			if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
+			if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
+			if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
+		}
 
-			// Free all previous memory
-			for (auto& cachedElem : mCachedRenderElements)
-			{
-				if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
-				if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
-				if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
-			}
+		mAlloc.clear();
 
-			mAlloc.clear();
+		// Resize cached mesh array to needed size
+		if (mCachedRenderElements.size() != numPages)
+			mCachedRenderElements.resize(numPages);
 
-			// Resize cached mesh array to needed size
-			if (mCachedRenderElements.size() != numPages)
-				mCachedRenderElements.resize(numPages);
+		// Copy the mesh from the cached geometry
+		for (UINT32 i = 0; i < numPages; i++)
+		{
+			const TextSpriteGeometry::Page& page = geometry.pages[i];
+			SpriteRenderElement& cachedElem = mCachedRenderElements[i];
 
-			// Actually generate a mesh
-			UINT32 texPage = 0;
-			for (auto& cachedElem : mCachedRenderElements)
-			{
-				UINT32 newNumQuads = textData.getNumQuadsForPage(texPage);
+			UINT32 newNumQuads = page.numQuads;
 
-				cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
-				cachedElem.numQuads = newNumQuads;
+			cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+			cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+			cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
+			cachedElem.numQuads = newNumQuads;
 
-				const HTexture& tex = textData.getTextureForPage(texPage);
+			memcpy(cachedElem.vertices, page.vertices.data(), sizeof(Vector2) * newNumQuads * 4);
+			memcpy(cachedElem.uvs, page.uvs.data(), sizeof(Vector2) * newNumQuads * 4);
+			memcpy(cachedElem.indexes, page.indices.data(), sizeof(UINT32) * newNumQuads * 6);
 
-				SpriteMaterialInfo& matInfo = cachedElem.matInfo;
-				matInfo.groupId = groupId;
-				matInfo.texture = tex;
-				matInfo.tint = desc.color;
+			SpriteMaterialInfo& matInfo = cachedElem.matInfo;
+			matInfo.groupId = groupId;
+			matInfo.texture = page.texture;
+			matInfo.tint = desc.color;
 
+			if (geometry.distanceField)
+				cachedElem.material = SpriteManager::instance().getTextDistanceFieldMaterial();
+			else
 				cachedElem.material = SpriteManager::instance().getTextMaterial();
-
-				texPage++;
-			}
-
-			// Calc alignment and anchor offsets and set final line positions
-			for (UINT32 j = 0; j < numPages; j++)
-			{
-				SpriteRenderElement& renderElem = mCachedRenderElements[j];
-
-				genTextQuads(j, textData, desc.width, desc.height, desc.horzAlign, desc.vertAlign, desc.anchor,
-					renderElem.vertices, renderElem.uvs, renderElem.indexes, renderElem.numQuads);
-			}
 		}
 
-		bs_frame_clear();
-
 		updateBounds();
 	}
 
@@ -0,0 +1,117 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "2D/BsTextSpriteCache.h"
+#include "Text/BsTextData.h"
+#include "Text/BsFont.h"
+#include "String/BsUnicode.h"
+
+namespace bs
+{
+	TextSpriteCache::Key::Key(const TEXT_SPRITE_DESC& desc)
+		: text(desc.text), font(desc.font.getUUID()), fontSize(desc.fontSize), width(desc.width), height(desc.height)
+		, anchor(desc.anchor), horzAlign(desc.horzAlign), vertAlign(desc.vertAlign), wordWrap(desc.wordWrap)
+		, wordBreak(desc.wordBreak)
+	{ }
+
+	bool TextSpriteCache::Key::operator==(const Key& rhs) const
+	{
+		return text == rhs.text && font == rhs.font && fontSize == rhs.fontSize && width == rhs.width &&
+			height == rhs.height && anchor == rhs.anchor && horzAlign == rhs.horzAlign && vertAlign == rhs.vertAlign &&
+			wordWrap == rhs.wordWrap && wordBreak == rhs.wordBreak;
+	}
+
+	size_t TextSpriteCache::KeyHash::operator()(const Key& key) const
+	{
+		size_t hash = 0;
+		bs::hash_combine(hash, key.text);
+		bs::hash_combine(hash, key.font);
+		bs::hash_combine(hash, key.fontSize);
+		bs::hash_combine(hash, key.width);
+		bs::hash_combine(hash, key.height);
+		bs::hash_combine(hash, (UINT32)key.anchor);
+		bs::hash_combine(hash, (UINT32)key.horzAlign);
+		bs::hash_combine(hash, (UINT32)key.vertAlign);
+		bs::hash_combine(hash, key.wordWrap);
+		bs::hash_combine(hash, key.wordBreak);
+
+		return hash;
+	}
+
+	TextSpriteCache::TextSpriteCache(UINT32 maxEntries, UINT32 maxTextLength)
+		:mMaxEntries(maxEntries), mMaxTextLength(maxTextLength)
+	{ }
+
+	const TextSpriteGeometry& TextSpriteCache::get(const TEXT_SPRITE_DESC& desc)
+	{
+		// Geometry generated before the font finishes loading is empty, so it must not be cached
+		if (desc.text.size() > mMaxTextLength || !desc.font.isLoaded() || mMaxEntries == 0)
+		{
+			generate(desc, mUncachedGeometry);
+			return mUncachedGeometry;
+		}
+
+		Key key(desc);
+		auto iterFind = mLookup.find(key);
+		if (iterFind != mLookup.end())
+		{
+			// Move to front, marking it as most recently used
+			mEntries.splice(mEntries.begin(), mEntries, iterFind->second);
+			return iterFind->second->geometry;
+		}
+
+		if (mEntries.size() >= mMaxEntries)
+		{
+			mLookup.erase(mEntries.back().key);
+			mEntries.pop_back();
+		}
+
+		mEntries.emplace_front(key);
+		mLookup[key] = mEntries.begin();
+
+		TextSpriteGeometry& geometry = mEntries.front().geometry;
+		generate(desc, geometry);
+
+		return geometry;
+	}
+
+	void TextSpriteCache::clear()
+	{
+		mLookup.clear();
+		mEntries.clear();
+	}
+
+	void TextSpriteCache::generate(const TEXT_SPRITE_DESC& desc, TextSpriteGeometry& output)
+	{
+		bs_frame_mark();
+		{
+			const U32String utf32text = UTF8::toUTF32(desc.text);
+			TextData<FrameAlloc> textData(utf32text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap,
+				desc.wordBreak);
+
+			UINT32 numPages = textData.getNumPages();
+			output.pages.resize(numPages);
+
+			output.distanceField = false;
+			if (desc.font.isLoaded())
+			{
+				SPtr<FontBitmap> fontData = desc.font->getBitmap(desc.font->getClosestSize(desc.fontSize));
+				output.distanceField = fontData != nullptr && fontData->distanceField;
+			}
+
+			for (UINT32 i = 0; i < numPages; i++)
+			{
+				TextSpriteGeometry::Page& page = output.pages[i];
+
+				page.texture = textData.getTextureForPage(i);
+				page.numQuads = textData.getNumQuadsForPage(i);
+				page.vertices.resize(page.numQuads * 4);
+				page.uvs.resize(page.numQuads * 4);
+				page.indices.resize(page.numQuads * 6);
+
+				TextSprite::genTextQuads(i, textData, desc.width, desc.height, desc.horzAlign, desc.vertAlign,
+					desc.anchor, page.vertices.data(), page.uvs.data(), page.indices.data(), page.numQuads);
+			}
+		}
+		bs_frame_clear();
+	}
+}
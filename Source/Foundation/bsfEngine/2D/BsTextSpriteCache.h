@@ -0,0 +1,109 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "2D/BsTextSprite.h"
+
+namespace bs
+{
+	/** @addtogroup 2D-Internal
+	 *  @{
+	 */
+
+	/** Geometry of a text sprite, split per font texture page. */
+	struct TextSpriteGeometry
+	{
+		/** Quads referencing a single font texture page. */
+		struct Page
+		{
+			HTexture texture;
+			Vector<Vector2> vertices;
+			Vector<Vector2> uvs;
+			Vector<UINT32> indices;
+			UINT32 numQuads = 0;
+		};
+
+		Vector<Page> pages;
+
+		/** True if the font textures contain distance fields, requiring a distance field material to render. */
+		bool distanceField = false;
+	};
+
+	/**
+	 * Keeps the geometry of recently generated text sprites, so that text with the same contents and layout properties
+	 * doesn't need to go through line breaking and glyph placement again. This is common for labels that switch between
+	 * a small set of values, like counters or toggling button text. The least recently used entries are evicted when
+	 * the cache is full.
+	 */
+	class BS_EXPORT TextSpriteCache
+	{
+		/** Properties of a text sprite that determine its geometry. */
+		struct Key
+		{
+			Key(const TEXT_SPRITE_DESC& desc);
+
+			bool operator==(const Key& rhs) const;
+
+			String text;
+			UUID font;
+			UINT32 fontSize;
+			UINT32 width;
+			UINT32 height;
+			SpriteAnchor anchor;
+			TextHorzAlign horzAlign;
+			TextVertAlign vertAlign;
+			bool wordWrap;
+			bool wordBreak;
+		};
+
+		/** Calculates a hash value for a key. */
+		struct KeyHash
+		{
+			size_t operator()(const Key& key) const;
+		};
+
+		/** A single cached text sprite. */
+		struct Entry
+		{
+			Entry(const Key& key)
+				:key(key)
+			{ }
+
+			Key key;
+			TextSpriteGeometry geometry;
+		};
+
+	public:
+		/**
+		 * Creates a new text sprite cache.
+		 *
+		 * @param[in]	maxEntries		Maximum number of text sprites to keep the geometry for.
+		 * @param[in]	maxTextLength	Text longer than this many characters is never cached, as it is unlikely to be
+		 *								repeated (e.g. text being edited in an input box).
+		 */
+		TextSpriteCache(UINT32 maxEntries = 256, UINT32 maxTextLength = 256);
+
+		/**
+		 * Returns the geometry for a text sprite with the provided properties, generating it if it isn't already cached.
+		 * The returned reference remains valid only until the next call to get() or clear().
+		 */
+		const TextSpriteGeometry& get(const TEXT_SPRITE_DESC& desc);
+
+		/** Removes all entries from the cache. */
+		void clear();
+
+	private:
+		/** Performs layout of the provided text and generates the resulting quads. */
+		static void generate(const TEXT_SPRITE_DESC& desc, TextSpriteGeometry& output);
+
+		UINT32 mMaxEntries;
+		UINT32 mMaxTextLength;
+
+		List<Entry> mEntries;
+		UnorderedMap<Key, List<Entry>::iterator, KeyHash> mLookup;
+		TextSpriteGeometry mUncachedGeometry;
+	};
+
+	/** @} */
+}
@@ -6,6 +6,8 @@
 #include "Resources/BsBuiltinResources.h"
 #include "Script/BsScriptManager.h"
 #include "Profiling/BsProfilingManager.h"
+#include "Profiling/BsFrameTelemetry.h"
+#include "Utility/BsTime.h"
 #include "Input/BsVirtualInput.h"
 #include "Scene/BsSceneManager.h"
 #include "Scene/BsSceneObject.h"
@@ -19,6 +21,8 @@
 #include "Renderer/BsRendererManager.h"
 #include "Renderer/BsRendererMaterialManager.h"
 #include "Debug/BsDebugDraw.h"
+#include "Particles/BsParticleSystemManager.h"
+#include "Terrain/BsTerrainManager.h"
 #include "Platform/BsPlatform.h"
 #include "Resources/BsEngineShaderIncludeHandler.h"
 #include "Resources/BsResources.h"
@@ -62,11 +66,18 @@ namespace bs
 		ShortcutManager::startUp();
 
 		Cursor::startUp();
-		Cursor::instance().setCursor(CursorType::Arrow);
-		Platform::setIcon(BuiltinResources::instance().getFrameworkIcon());
+
+		// Cursor and icon changes require an OS window
+		if (!isHeadless())
+		{
+			Cursor::instance().setCursor(CursorType::Arrow);
+			Platform::setIcon(BuiltinResources::instance().getFrameworkIcon());
+		}
 
 		SceneManager::instance().setMainRenderTarget(getPrimaryWindow());
 		DebugDraw::startUp();
+		ParticleSystemManager::startUp();
+		TerrainManager::startUp();
 
 		ScriptManager::startUp();
 
@@ -87,6 +98,8 @@ namespace bs
 		ShortcutManager::shutDown();
 
 		ScriptManager::shutDown();
+		TerrainManager::shutDown();
+		ParticleSystemManager::shutDown();
 		DebugDraw::shutDown();
 
 		if (mStartUpDesc.scripting)
@@ -106,8 +119,12 @@ namespace bs
 	{
 		CoreApplication::postUpdate();
 
+		UINT64 guiStartTime = gTime().getTimePrecise();
 		PROFILE_CALL(GUIManager::instance().update(), "GUI");
+		gFrameTelemetry()._addSimTime(TelemetryMetric::GUITime, gTime().getTimePrecise() - guiStartTime);
 		DebugDraw::instance()._update();
+		ParticleSystemManager::instance()._update();
+		TerrainManager::instance()._update();
 	}
 
 	void Application::loadScriptSystem()
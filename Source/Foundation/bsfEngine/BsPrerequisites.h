@@ -29,10 +29,18 @@
  *	User input (mouse, keyboard, gamepad, etc.).
  */
 
+/** @defgroup Particles Particles
+ *  GPU simulated particle systems and the emitters they are spawned by.
+ */
+
 /** @defgroup Platform-Engine Platform
  *  %Platform specific functionality.
  */
 
+/** @defgroup Terrain Terrain
+ *  Height field based terrain rendering.
+ */
+
 /** @defgroup Resources-Engine Resources
   *	Builtin engine resource types and a manager for such resources.
   */
@@ -67,6 +75,14 @@
   *	Graphical user interface, including elements, styles, events and GUI manager.
   */
 
+/** @defgroup Particles-Internal Particles
+  *	Simulation and rendering of particle systems on the GPU.
+  */
+
+/** @defgroup Terrain-Internal Terrain
+  *	Level of detail selection and rendering of terrain on the GPU.
+  */
+
 /** @defgroup Renderer-Engine-Internal Renderer
   *	Abstract interface and helper functionality for rendering scene objects and other geometry.
   */
@@ -146,6 +162,7 @@ namespace bs
 	class GUIScrollBarVert;
 	class GUIScrollBarHorz;
 	class GUIScrollArea;
+	class GUIVirtualScrollArea;
 	class GUISkin;
 	class GUIRenderTexture;
 	struct GUIElementStyle;
@@ -196,14 +213,29 @@ namespace bs
 	class SpriteTexture;
 	class SpriteMaterial;
 	struct SpriteMaterialInfo;
+	class SpriteAtlas;
+	class TextSpriteCache;
+	class SpriteBatch;
+
+	// Particles
+	class ParticleEmitter;
+	class CParticleSystem;
+	class ParticleSystemManager;
+
+	// Terrain
+	class CTerrain;
+	class TerrainManager;
 
 	typedef GameObjectHandle<CGUIWidget> HGUIWidget;
 	typedef GameObjectHandle<CProfilerOverlay> HProfilerOverlay;
+	typedef GameObjectHandle<CParticleSystem> HParticleSystem;
+	typedef GameObjectHandle<CTerrain> HTerrain;
 
 	typedef ResourceHandle<SpriteTexture> HSpriteTexture;
 	typedef ResourceHandle<PlainText> HPlainText;
 	typedef ResourceHandle<ScriptCode> HScriptCode;
 	typedef ResourceHandle<GUISkin> HGUISkin;
+	typedef ResourceHandle<ParticleEmitter> HParticleEmitter;
 
 	/**	RTTI types. */
 	enum TypeID_Banshee
@@ -229,6 +261,9 @@ namespace bs
 		//TID_ColorGradingSettings = 30019,
 		//TID_DepthOfFieldSettings = 30020,
 		//TID_AmbientOcclusionSettings = 30021,
-		//TID_ScreenSpaceReflectionsSettings = 30022
+		//TID_ScreenSpaceReflectionsSettings = 30022,
+		TID_ParticleEmitter = 30025,
+		TID_CParticleSystem = 30026,
+		TID_CTerrain = 30027
 	};
 }
\ No newline at end of file
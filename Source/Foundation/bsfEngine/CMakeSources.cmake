@@ -39,6 +39,7 @@ set(BS_ENGINE_SRC_GUI
 	"bsfEngine/GUI/BsGUIScrollBarVert.cpp"
 	"bsfEngine/GUI/BsGUIScrollBarHorz.cpp"
 	"bsfEngine/GUI/BsGUIScrollArea.cpp"
+	"bsfEngine/GUI/BsGUIVirtualScrollArea.cpp"
 	"bsfEngine/GUI/BsGUIScrollBar.cpp"
 	"bsfEngine/GUI/BsGUIToggleGroup.cpp"
 	"bsfEngine/GUI/BsDragAndDropManager.cpp"
@@ -101,6 +102,9 @@ set(BS_ENGINE_SRC_2D
 	"bsfEngine/2D/BsSpriteMaterial.cpp"
 	"bsfEngine/2D/BsSpriteMaterials.cpp"
 	"bsfEngine/2D/BsSpriteManager.cpp"
+	"bsfEngine/2D/BsSpriteAtlas.cpp"
+	"bsfEngine/2D/BsTextSpriteCache.cpp"
+	"bsfEngine/2D/BsSpriteBatch.cpp"
 )
 
 set(BS_ENGINE_SRC_UTILITY
@@ -127,6 +131,9 @@ set(BS_ENGINE_INC_2D
 	"bsfEngine/2D/BsSpriteMaterial.h"
 	"bsfEngine/2D/BsSpriteMaterials.h"
 	"bsfEngine/2D/BsSpriteManager.h"
+	"bsfEngine/2D/BsSpriteAtlas.h"
+	"bsfEngine/2D/BsTextSpriteCache.h"
+	"bsfEngine/2D/BsSpriteBatch.h"
 )
 
 set(BS_ENGINE_INC_RTTI
@@ -140,6 +147,9 @@ set(BS_ENGINE_INC_RTTI
 	"bsfEngine/Private/RTTI/BsCGUIWidgetRTTI.h"
 	"bsfEngine/Private/RTTI/BsGameSettingsRTTI.h"
 	"bsfEngine/Private/RTTI/BsResourceMappingRTTI.h"
+	"bsfEngine/Private/RTTI/BsParticleEmitterRTTI.h"
+	"bsfEngine/Private/RTTI/BsCParticleSystemRTTI.h"
+	"bsfEngine/Private/RTTI/BsCTerrainRTTI.h"
 )
 
 set(BS_ENGINE_INC_NOFILTER
@@ -173,6 +183,32 @@ set(BS_ENGINE_INC_UTILITY
 	"bsfEngine/Utility/BsShapeMeshes3D.h"
 )
 
+set(BS_ENGINE_INC_PARTICLES
+	"bsfEngine/Particles/BsParticleEmitter.h"
+	"bsfEngine/Particles/BsCParticleSystem.h"
+	"bsfEngine/Particles/BsParticleSystemManager.h"
+	"bsfEngine/Particles/BsParticleRenderer.h"
+)
+
+set(BS_ENGINE_SRC_PARTICLES
+	"bsfEngine/Particles/BsParticleEmitter.cpp"
+	"bsfEngine/Particles/BsCParticleSystem.cpp"
+	"bsfEngine/Particles/BsParticleSystemManager.cpp"
+	"bsfEngine/Particles/BsParticleRenderer.cpp"
+)
+
+set(BS_ENGINE_INC_TERRAIN
+	"bsfEngine/Terrain/BsCTerrain.h"
+	"bsfEngine/Terrain/BsTerrainManager.h"
+	"bsfEngine/Terrain/BsTerrainRenderer.h"
+)
+
+set(BS_ENGINE_SRC_TERRAIN
+	"bsfEngine/Terrain/BsCTerrain.cpp"
+	"bsfEngine/Terrain/BsTerrainManager.cpp"
+	"bsfEngine/Terrain/BsTerrainRenderer.cpp"
+)
+
 set(BS_ENGINE_INC_DEBUG
 	"bsfEngine/Debug/BsDebugDraw.h"
 )
@@ -214,6 +250,7 @@ set(BS_ENGINE_INC_GUI
 	"bsfEngine/GUI/BsGUIScrollBarVert.h"
 	"bsfEngine/GUI/BsGUIScrollBarHorz.h"
 	"bsfEngine/GUI/BsGUIScrollArea.h"
+	"bsfEngine/GUI/BsGUIVirtualScrollArea.h"
 	"bsfEngine/GUI/BsGUIScrollBar.h"
 	"bsfEngine/GUI/BsGUIToggleGroup.h"
 	"bsfEngine/GUI/BsDragAndDropManager.h"
@@ -273,6 +310,8 @@ source_group("Utility" FILES ${BS_ENGINE_INC_UTILITY} ${BS_ENGINE_SRC_UTILITY})
 source_group("GUI" FILES ${BS_ENGINE_INC_GUI} ${BS_ENGINE_SRC_GUI})
 source_group("Debug" FILES ${BS_ENGINE_INC_DEBUG} ${BS_ENGINE_SRC_DEBUG})
 source_group("Localization" FILES ${BS_ENGINE_INC_LOCALIZATION} ${BS_ENGINE_SRC_LOCALIZATION})
+source_group("Particles" FILES ${BS_ENGINE_INC_PARTICLES} ${BS_ENGINE_SRC_PARTICLES})
+source_group("Terrain" FILES ${BS_ENGINE_INC_TERRAIN} ${BS_ENGINE_SRC_TERRAIN})
 
 set(BS_ENGINE_SRC
 	${BS_ENGINE_SRC_RESOURCES}
@@ -299,4 +338,8 @@ set(BS_ENGINE_SRC
 	${BS_ENGINE_SRC_DEBUG}
 	${BS_ENGINE_INC_LOCALIZATION}
 	${BS_ENGINE_SRC_LOCALIZATION}
+	${BS_ENGINE_INC_PARTICLES}
+	${BS_ENGINE_SRC_PARTICLES}
+	${BS_ENGINE_INC_TERRAIN}
+	${BS_ENGINE_SRC_TERRAIN}
 )
\ No newline at end of file
@@ -16,6 +16,12 @@
 #include "Renderer/BsRendererExtension.h"
 #include "Resources/BsBuiltinResources.h"
 #include "Renderer/BsCamera.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsVertexDeclaration.h"
+#include "Math/BsAABox.h"
+#include "Math/BsSphere.h"
+#include "Utility/BsBitwise.h"
 
 using namespace std::placeholders;
 
@@ -25,7 +31,13 @@ namespace bs
 		: mDrawHelper(nullptr)
 	{
 		mDrawHelper = bs_new<DrawHelper>();
-		mRenderer = RendererExtension::create<ct::DebugDrawRenderer>(nullptr);
+		createShapeMeshes();
+
+		Vector<SPtr<ct::Mesh>> coreShapeMeshes;
+		for (auto& entry : mShapeMeshes)
+			coreShapeMeshes.push_back(entry->getCore());
+
+		mRenderer = RendererExtension::create<ct::DebugDrawRenderer>(coreShapeMeshes);
 	}
 
 	DebugDraw::~DebugDraw()
@@ -35,78 +47,201 @@ namespace bs
 
 	void DebugDraw::setColor(const Color& color)
 	{
+		mColor = color;
 		mDrawHelper->setColor(color);
 	}
 
 	void DebugDraw::setTransform(const Matrix4& transform)
 	{
+		mTransform = transform;
 		mDrawHelper->setTransform(transform);
 	}
 
 	void DebugDraw::drawCube(const Vector3& position, const Vector3& extents)
 	{
-		mDrawHelper->cube(position, extents);
+		addInstance(InstancedShape::Cube, Matrix4::TRS(position, Quaternion::IDENTITY, extents));
 	}
 
 	void DebugDraw::drawSphere(const Vector3& position, float radius)
 	{
-		mDrawHelper->sphere(position, radius);
+		addInstance(InstancedShape::Sphere, Matrix4::TRS(position, Quaternion::IDENTITY, Vector3::ONE * radius));
 	}
 
 	void DebugDraw::drawCone(const Vector3& base, const Vector3& normal, float height, float radius, const Vector2& scale)
 	{
-		mDrawHelper->cone(base, normal, height, radius, scale);
+		Matrix4 localTransform = getArcTransform(base, normal, radius, height) * 
+			Matrix4::scaling(Vector3(scale.x, 1.0f, scale.y));
+
+		addInstance(InstancedShape::Cone, localTransform);
 	}
 
 	void DebugDraw::drawDisc(const Vector3& position, const Vector3& normal, float radius)
 	{
-		mDrawHelper->disc(position, normal, radius);
+		addInstance(InstancedShape::Disc, getArcTransform(position, normal, radius, 1.0f));
 	}
 
 	void DebugDraw::drawWireCube(const Vector3& position, const Vector3& extents)
 	{
-		mDrawHelper->wireCube(position, extents);
+		addInstance(InstancedShape::WireCube, Matrix4::TRS(position, Quaternion::IDENTITY, extents));
 	}
 
 	void DebugDraw::drawWireSphere(const Vector3& position, float radius)
 	{
-		mDrawHelper->wireSphere(position, radius);
+		addInstance(InstancedShape::WireSphere, Matrix4::TRS(position, Quaternion::IDENTITY, Vector3::ONE * radius));
 	}
 
 	void DebugDraw::drawWireCone(const Vector3& base, const Vector3& normal, float height, float radius, const Vector2& scale)
 	{
-		mDrawHelper->wireCone(base, normal, height, radius, scale);
+		Matrix4 localTransform = getArcTransform(base, normal, radius, height) *
+			Matrix4::scaling(Vector3(scale.x, 1.0f, scale.y));
+
+		addInstance(InstancedShape::WireCone, localTransform);
 	}
 
 	void DebugDraw::drawLine(const Vector3& start, const Vector3& end)
 	{
-		mDrawHelper->line(start, end);
+		RGBA color = mColor.getAsRGBA();
+
+		mLineVertices.push_back({ mTransform.multiplyAffine(start), color });
+		mLineVertices.push_back({ mTransform.multiplyAffine(end), color });
+		mDirty = true;
 	}
 
 	void DebugDraw::drawLineList(const Vector<Vector3>& linePoints)
 	{
-		mDrawHelper->lineList(linePoints);
+		RGBA color = mColor.getAsRGBA();
+		UINT32 numPoints = (UINT32)linePoints.size() & ~1U;
+
+		for (UINT32 i = 0; i < numPoints; i++)
+			mLineVertices.push_back({ mTransform.multiplyAffine(linePoints[i]), color });
+
+		mDirty = true;
 	}
 
 	void DebugDraw::drawWireDisc(const Vector3& position, const Vector3& normal, float radius)
 	{
-		mDrawHelper->wireDisc(position, normal, radius);
+		addInstance(InstancedShape::WireDisc, getArcTransform(position, normal, radius, 1.0f));
 	}
 
 	void DebugDraw::drawWireArc(const Vector3& position, const Vector3& normal, float radius, 
 		Degree startAngle, Degree amountAngle)
 	{
 		mDrawHelper->wireArc(position, normal, radius, startAngle, amountAngle);
+		mDirty = true;
 	}
 
 	void DebugDraw::drawWireMesh(const SPtr<MeshData>& meshData)
 	{
 		mDrawHelper->wireMesh(meshData);
+		mDirty = true;
 	}
 
 	void DebugDraw::drawFrustum(const Vector3& position, float aspect, Degree FOV, float near, float far)
 	{
 		mDrawHelper->frustum(position, aspect, FOV, near, far);
+		mDirty = true;
+	}
+
+	void DebugDraw::addInstance(InstancedShape shape, const Matrix4& localTransform)
+	{
+		Matrix4 transform = mTransform * localTransform;
+
+		InstanceData instance;
+		for (UINT32 i = 0; i < 3; i++)
+			instance.transform[i] = Vector4(transform[i][0], transform[i][1], transform[i][2], transform[i][3]);
+
+		instance.color = Vector4(mColor.r, mColor.g, mColor.b, mColor.a);
+
+		mInstances[(UINT32)shape].push_back(instance);
+		mDirty = true;
+	}
+
+	Matrix4 DebugDraw::getArcTransform(const Vector3& center, const Vector3& normal, float radius, float height)
+	{
+		// Unit meshes are generated facing the Y axis, matching the orientation ShapeMeshes3D uses for arcs
+		Quaternion rotation = Quaternion::getRotationFromTo(Vector3::UNIT_Y, normal);
+		return Matrix4::TRS(center, rotation, Vector3(radius, height, radius));
+	}
+
+	void DebugDraw::createShapeMeshes()
+	{
+		SPtr<VertexDataDesc> solidVertexDesc = bs_shared_ptr_new<VertexDataDesc>();
+		solidVertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		solidVertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		solidVertexDesc->addVertElem(VET_COLOR, VES_COLOR);
+
+		SPtr<VertexDataDesc> lineVertexDesc = bs_shared_ptr_new<VertexDataDesc>();
+		lineVertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		lineVertexDesc->addVertElem(VET_COLOR, VES_COLOR);
+
+		// Same quality as used by default by DrawHelper
+		const UINT32 SPHERE_QUALITY = 1;
+		const UINT32 ARC_QUALITY = 10;
+
+		const AABox unitBox(-Vector3::ONE, Vector3::ONE);
+		const Sphere unitSphere(Vector3::ZERO, 1.0f);
+
+		for (UINT32 i = 0; i < (UINT32)InstancedShape::Count; i++)
+		{
+			InstancedShape shape = (InstancedShape)i;
+			bool isSolid = shape < InstancedShape::WireCube;
+
+			UINT32 numVertices = 0;
+			UINT32 numIndices = 0;
+			switch (shape)
+			{
+			case InstancedShape::Cube: ShapeMeshes3D::getNumElementsAABox(numVertices, numIndices); break;
+			case InstancedShape::Sphere:
+				ShapeMeshes3D::getNumElementsSphere(SPHERE_QUALITY, numVertices, numIndices); 
+				break;
+			case InstancedShape::Cone: ShapeMeshes3D::getNumElementsCone(ARC_QUALITY, numVertices, numIndices); break;
+			case InstancedShape::Disc: ShapeMeshes3D::getNumElementsDisc(ARC_QUALITY, numVertices, numIndices); break;
+			case InstancedShape::WireCube: ShapeMeshes3D::getNumElementsWireAABox(numVertices, numIndices); break;
+			case InstancedShape::WireSphere:
+				ShapeMeshes3D::getNumElementsWireSphere(ARC_QUALITY, numVertices, numIndices); 
+				break;
+			case InstancedShape::WireCone:
+				ShapeMeshes3D::getNumElementsWireCone(ARC_QUALITY, numVertices, numIndices); 
+				break;
+			case InstancedShape::WireDisc:
+				ShapeMeshes3D::getNumElementsWireDisc(ARC_QUALITY, numVertices, numIndices); 
+				break;
+			default: break;
+			}
+
+			SPtr<MeshData> meshData = MeshData::create(numVertices, numIndices, 
+				isSolid ? solidVertexDesc : lineVertexDesc);
+
+			switch (shape)
+			{
+			case InstancedShape::Cube: ShapeMeshes3D::solidAABox(unitBox, meshData, 0, 0); break;
+			case InstancedShape::Sphere: ShapeMeshes3D::solidSphere(unitSphere, meshData, 0, 0, SPHERE_QUALITY); break;
+			case InstancedShape::Cone:
+				ShapeMeshes3D::solidCone(Vector3::ZERO, Vector3::UNIT_Y, 1.0f, 1.0f, Vector2::ONE, meshData, 0, 0, 
+					ARC_QUALITY);
+				break;
+			case InstancedShape::Disc:
+				ShapeMeshes3D::solidDisc(Vector3::ZERO, 1.0f, Vector3::UNIT_Y, meshData, 0, 0, ARC_QUALITY); 
+				break;
+			case InstancedShape::WireCube: ShapeMeshes3D::wireAABox(unitBox, meshData, 0, 0); break;
+			case InstancedShape::WireSphere: ShapeMeshes3D::wireSphere(unitSphere, meshData, 0, 0, ARC_QUALITY); break;
+			case InstancedShape::WireCone:
+				ShapeMeshes3D::wireCone(Vector3::ZERO, Vector3::UNIT_Y, 1.0f, 1.0f, Vector2::ONE, meshData, 0, 0, 
+					ARC_QUALITY);
+				break;
+			case InstancedShape::WireDisc:
+				ShapeMeshes3D::wireDisc(Vector3::ZERO, 1.0f, Vector3::UNIT_Y, meshData, 0, 0, ARC_QUALITY); 
+				break;
+			default: break;
+			}
+
+			// Color is provided per-instance, and multiplied with the vertex color
+			auto colorIter = meshData->getDWORDDataIter(VES_COLOR);
+			for (UINT32 j = 0; j < numVertices; j++)
+				colorIter.addValue(Color::White.getAsRGBA());
+
+			mShapeMeshes[i] = Mesh::_createPtr(meshData, MU_STATIC, isSolid ? DOT_TRIANGLE_LIST : DOT_LINE_LIST);
+		}
 	}
 
 	Vector<DebugDraw::MeshRenderData> DebugDraw::createMeshProxyData(const Vector<DrawHelper::ShapeMeshData>& meshData)
@@ -128,17 +263,37 @@ namespace bs
 	void DebugDraw::clear()
 	{
 		mDrawHelper->clear();
+
+		for (auto& entry : mInstances)
+			entry.clear();
+
+		mLineVertices.clear();
+		mDirty = true;
 	}
 
 	void DebugDraw::_update()
 	{
+		// Nothing to do if the drawn shapes didn't change, the renderer keeps drawing the last provided data
+		if (!mDirty)
+			return;
+
 		mActiveMeshes.clear();
 		mActiveMeshes = mDrawHelper->buildMeshes(DrawHelper::SortType::None, Vector3::ZERO);
 
-		Vector<MeshRenderData> proxyData = createMeshProxyData(mActiveMeshes);
+		RenderData renderData;
+		renderData.meshes = createMeshProxyData(mActiveMeshes);
+		renderData.lineVertices = mLineVertices;
+
+		for (UINT32 i = 0; i < (UINT32)InstancedShape::Count; i++)
+		{
+			renderData.instances.insert(renderData.instances.end(), mInstances[i].begin(), mInstances[i].end());
+			renderData.numInstances[i] = (UINT32)mInstances[i].size();
+		}
 
 		ct::DebugDrawRenderer* renderer = mRenderer.get();
-		gCoreThread().queueCommand(std::bind(&ct::DebugDrawRenderer::updateData, renderer, proxyData));
+		gCoreThread().queueCommand(std::bind(&ct::DebugDrawRenderer::updateData, renderer, std::move(renderData)));
+
+		mDirty = false;
 	}
 
 	namespace ct
@@ -159,15 +314,49 @@ namespace bs
 		gRendererUtility().draw(mesh, subMesh);
 	}
 
-	DebugDrawMat* DebugDrawMat::getVariation(DebugDrawMaterial mat)
+	void DebugDrawMat::execute(const SPtr<GpuParamBlockBuffer>& params, const SPtr<Mesh>& mesh, const SubMesh& subMesh,
+		const SPtr<GpuBuffer>& instanceData, UINT32 numInstances)
+	{
+		mParams->setParamBlockBuffer("Params", params);
+		mParams->setBuffer(GPT_VERTEX_PROGRAM, "gInstanceData", instanceData);
+
+		bind();
+		gRendererUtility().draw(mesh, subMesh, numInstances);
+	}
+
+	void DebugDrawMat::execute(const SPtr<GpuParamBlockBuffer>& params, const SPtr<VertexBuffer>& vertices,
+		const SPtr<VertexDeclaration>& vertexDecl, UINT32 vertexOffset, UINT32 numVertices)
+	{
+		mParams->setParamBlockBuffer("Params", params);
+
+		bind();
+
+		RenderAPI& rapi = RenderAPI::instance();
+		SPtr<VertexBuffer> buffers[] = { vertices };
+
+		rapi.setVertexDeclaration(vertexDecl);
+		rapi.setVertexBuffers(0, buffers, 1);
+		rapi.setDrawOperation(DOT_LINE_LIST);
+		rapi.draw(vertexOffset, numVertices);
+	}
+
+	DebugDrawMat* DebugDrawMat::getVariation(DebugDrawMaterial mat, bool instanced)
 	{
 		if (mat == DebugDrawMaterial::Solid)
-			return get(getVariation<true, false, false>());
+		{
+			if (instanced)
+				return get(getVariation<true, false, false, true>());
+
+			return get(getVariation<true, false, false, false>());
+		}
 		
 		if (mat == DebugDrawMaterial::Wire)
-			return get(getVariation<false, false, true>());
+			return get(getVariation<false, false, true, false>());
+
+		if (instanced)
+			return get(getVariation<false, true, false, true>());
 
-		return get(getVariation<false, true, false>());
+		return get(getVariation<false, true, false, false>());
 	}
 
 	DebugDrawRenderer::DebugDrawRenderer()
@@ -180,11 +369,92 @@ namespace bs
 		THROW_IF_NOT_CORE_THREAD;
 
 		mParamBuffer = gDebugDrawParamsDef.createBuffer();
+
+		const auto& shapeMeshes = any_cast_ref<Vector<SPtr<Mesh>>>(data);
+		for (UINT32 i = 0; i < (UINT32)shapeMeshes.size(); i++)
+			mShapeMeshes[i] = shapeMeshes[i];
+
+		SPtr<VertexDataDesc> lineVertexDesc = bs_shared_ptr_new<VertexDataDesc>();
+		lineVertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		lineVertexDesc->addVertElem(VET_COLOR, VES_COLOR);
+
+		mLineVertexDecl = VertexDeclaration::create(lineVertexDesc);
 	}
 
-	void DebugDrawRenderer::updateData(const Vector<DebugDraw::MeshRenderData>& meshes)
+	void DebugDrawRenderer::updateData(const DebugDraw::RenderData& data)
 	{
-		mMeshes = meshes;
+		mMeshes = data.meshes;
+
+		UINT32 instanceOffset = 0;
+		for (UINT32 i = 0; i < (UINT32)DebugDraw::InstancedShape::Count; i++)
+		{
+			UINT32 numInstances = data.numInstances[i];
+			mNumInstances[i] = numInstances;
+
+			if (numInstances == 0)
+				continue;
+
+			// Each instance is stored as four float4 elements
+			const UINT32 elementsPerInstance = sizeof(DebugDraw::InstanceData) / sizeof(Vector4);
+			UINT32 numElements = numInstances * elementsPerInstance;
+
+			SPtr<GpuBuffer>& buffer = mInstanceBuffers[i];
+			if (buffer == nullptr || buffer->getProperties().getElementCount() < numElements)
+			{
+				GPU_BUFFER_DESC desc;
+				desc.type = GBT_STANDARD;
+				desc.format = BF_32X4F;
+				desc.elementCount = Bitwise::nextPow2(numElements);
+				desc.usage = GBU_DYNAMIC;
+
+				buffer = GpuBuffer::create(desc);
+			}
+
+			buffer->writeData(0, numInstances * sizeof(DebugDraw::InstanceData), &data.instances[instanceOffset],
+				BWT_DISCARD);
+
+			instanceOffset += numInstances;
+		}
+
+		writeLineVertices(data.lineVertices);
+	}
+
+	void DebugDrawRenderer::writeLineVertices(const Vector<DebugDraw::LineVertex>& lineVertices)
+	{
+		mNumLineVertices = (UINT32)lineVertices.size();
+		if (mNumLineVertices == 0)
+			return;
+
+		const UINT32 vertexSize = sizeof(DebugDraw::LineVertex);
+		if (mLineBuffer == nullptr || mLineBuffer->getProperties().getNumVertices() < mNumLineVertices)
+		{
+			UINT32 capacity = INITIAL_LINE_VERTICES;
+			if (mLineBuffer != nullptr)
+				capacity = mLineBuffer->getProperties().getNumVertices();
+
+			while (capacity < mNumLineVertices)
+				capacity *= 2;
+
+			VERTEX_BUFFER_DESC desc;
+			desc.vertexSize = vertexSize;
+			desc.numVerts = capacity;
+			desc.usage = GBU_DYNAMIC;
+
+			mLineBuffer = VertexBuffer::create(desc);
+			mLineBufferOffset = 0;
+		}
+
+		// Append after the previously written vertices, without overwriting them as the GPU might still be reading
+		// them. Only once the end of the buffer is reached discard its contents and start from the beginning.
+		BufferWriteType writeType = BTW_NO_OVERWRITE;
+		if ((mLineBufferOffset + mNumLineVertices) > mLineBuffer->getProperties().getNumVertices())
+		{
+			mLineBufferOffset = 0;
+			writeType = BWT_DISCARD;
+		}
+
+		mLineBuffer->writeData(mLineBufferOffset * vertexSize, mNumLineVertices * vertexSize, lineVertices.data(),
+			writeType);
 	}
 
 	bool DebugDrawRenderer::check(const Camera& camera)
@@ -210,6 +480,26 @@ namespace bs
 			DebugDrawMat* mat = DebugDrawMat::getVariation(entry.type);
 			mat->execute(mParamBuffer, entry.mesh, entry.subMesh);
 		}
+
+		for (UINT32 i = 0; i < (UINT32)DebugDraw::InstancedShape::Count; i++)
+		{
+			if (mNumInstances[i] == 0)
+				continue;
+
+			bool isSolid = (DebugDraw::InstancedShape)i < DebugDraw::InstancedShape::WireCube;
+			DebugDrawMat* mat = DebugDrawMat::getVariation(isSolid ? DebugDrawMaterial::Solid : DebugDrawMaterial::Line,
+				true);
+
+			const SPtr<Mesh>& mesh = mShapeMeshes[i];
+			const SubMesh& subMesh = mesh->getProperties().getSubMesh(0);
+			mat->execute(mParamBuffer, mesh, subMesh, mInstanceBuffers[i], mNumInstances[i]);
+		}
+
+		if (mNumLineVertices > 0)
+		{
+			DebugDrawMat* mat = DebugDrawMat::getVariation(DebugDrawMaterial::Line);
+			mat->execute(mParamBuffer, mLineBuffer, mLineVertexDecl, mLineBufferOffset, mNumLineVertices);
+		}
 	}
 	}
 }
@@ -23,7 +23,14 @@ namespace bs
 		Solid, Wire, Line
 	};
 
-	/** Provides an easy access to draw basic 2D and 3D shapes, primarily meant for debugging purposes. */
+	/**
+	 * Provides an easy access to draw basic 2D and 3D shapes, primarily meant for debugging purposes.
+	 *
+	 * Cubes, spheres, cones and discs are rendered by instancing a single pre-built unit mesh per shape type, and lines
+	 * are written directly into a persistent vertex buffer, so neither requires new geometry to be generated. Other
+	 * shapes are converted into meshes through DrawHelper. All data is only sent to the renderer when the set of drawn
+	 * shapes changes.
+	 */
 	class BS_EXPORT DebugDraw : public Module<DebugDraw>
 	{
 	public:
@@ -149,6 +156,26 @@ namespace bs
 	private:
 		friend class ct::DebugDrawRenderer;
 
+		/** Shapes rendered by instancing a unit mesh. */
+		enum class InstancedShape
+		{
+			Cube, Sphere, Cone, Disc, WireCube, WireSphere, WireCone, WireDisc, Count
+		};
+
+		/** Per-instance data of an instanced shape, in the layout expected by the shader. */
+		struct InstanceData
+		{
+			Vector4 transform[3]; /**< First three rows of the affine world transform. */
+			Vector4 color;
+		};
+
+		/** Vertex of a line written into the line buffer. */
+		struct LineVertex
+		{
+			Vector3 position;
+			UINT32 color;
+		};
+
 		/** Data about a mesh rendered by the draw manager. */
 		struct MeshRenderData
 		{
@@ -161,12 +188,38 @@ namespace bs
 			DebugDrawMaterial type;
 		};
 
+		/** Everything drawn by DebugDraw, as sent to the renderer. */
+		struct RenderData
+		{
+			Vector<MeshRenderData> meshes;
+			Vector<InstanceData> instances; /**< Instances of all shapes, ordered by InstancedShape. */
+			UINT32 numInstances[(UINT32)InstancedShape::Count] = { };
+			Vector<LineVertex> lineVertices;
+		};
+
 		/** Converts mesh data from DrawHelper into mesh data usable by the debug draw renderer. */
 		Vector<MeshRenderData> createMeshProxyData(const Vector<DrawHelper::ShapeMeshData>& meshData);
 
+		/** Records an instance of a unit shape mesh, transformed by @p localTransform and the current transform. */
+		void addInstance(InstancedShape shape, const Matrix4& localTransform);
+
+		/** Returns a transform mapping a unit cone or disc, facing the Y axis, to the provided orientation and size. */
+		static Matrix4 getArcTransform(const Vector3& center, const Vector3& normal, float radius, float height);
+
+		/** Creates a mesh for each of the instanced shapes, with unit size and white vertex color. */
+		void createShapeMeshes();
+
 		DrawHelper* mDrawHelper;
 		Vector<DrawHelper::ShapeMeshData> mActiveMeshes;
 
+		Color mColor = Color::White;
+		Matrix4 mTransform = Matrix4::IDENTITY;
+		Vector<InstanceData> mInstances[(UINT32)InstancedShape::Count];
+		Vector<LineVertex> mLineVertices;
+		bool mDirty = false;
+
+		SPtr<Mesh> mShapeMeshes[(UINT32)InstancedShape::Count];
+
 		SPtr<ct::DebugDrawRenderer> mRenderer;
 	};
 
@@ -191,14 +244,15 @@ namespace bs
 		RMAT_DEF("DebugDraw.bsl");
 
 		/** Helper method used for initializing variations of this material. */
-		template<bool solid, bool line, bool wire>
+		template<bool solid, bool line, bool wire, bool instanced>
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("SOLID", solid),
 				ShaderVariation::Param("LINE", line),
-				ShaderVariation::Param("WIRE", wire)
+				ShaderVariation::Param("WIRE", wire),
+				ShaderVariation::Param("INSTANCED", instanced)
 			});
 
 			return variation;
@@ -209,8 +263,20 @@ namespace bs
 		/** Executes the material using the provided parameters. */
 		void execute(const SPtr<GpuParamBlockBuffer>& params, const SPtr<Mesh>& mesh, const SubMesh& subMesh);
 
+		/** 
+		 * Executes the material, drawing multiple instances of the mesh. Per-instance data is read from 
+		 * @p instanceData, which must contain a DebugDraw::InstanceData entry per instance. Only valid for instanced 
+		 * variations.
+		 */
+		void execute(const SPtr<GpuParamBlockBuffer>& params, const SPtr<Mesh>& mesh, const SubMesh& subMesh,
+			const SPtr<GpuBuffer>& instanceData, UINT32 numInstances);
+
+		/** Executes the material, drawing a range of DebugDraw::LineVertex vertices as a line list. */
+		void execute(const SPtr<GpuParamBlockBuffer>& params, const SPtr<VertexBuffer>& vertices,
+			const SPtr<VertexDeclaration>& vertexDecl, UINT32 vertexOffset, UINT32 numVertices);
+
 		/** Returns the material variation matching the provided parameters. */
-		static DebugDrawMat* getVariation(DebugDrawMaterial drawMat);
+		static DebugDrawMat* getVariation(DebugDrawMaterial drawMat, bool instanced = false);
 	};
 
 	/** Performs rendering of meshes provided by DebugDraw. */
@@ -234,13 +300,26 @@ namespace bs
 		/**
 		 * Updates the internal data that is used for rendering. Normally you would call this after updating the meshes
 		 * on the sim thread.
-		 *
-		 * @param[in]	meshes			Meshes to render.
 		 */
-		void updateData(const Vector<DebugDraw::MeshRenderData>& meshes);
+		void updateData(const DebugDraw::RenderData& data);
+
+		/** Writes the line vertices into the line ring buffer, growing it if needed. */
+		void writeLineVertices(const Vector<DebugDraw::LineVertex>& lineVertices);
+
+		/** Number of vertices the line buffer can hold when first created. */
+		static constexpr UINT32 INITIAL_LINE_VERTICES = 4096;
 
 		Vector<DebugDraw::MeshRenderData> mMeshes;
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
+
+		SPtr<Mesh> mShapeMeshes[(UINT32)DebugDraw::InstancedShape::Count];
+		SPtr<GpuBuffer> mInstanceBuffers[(UINT32)DebugDraw::InstancedShape::Count];
+		UINT32 mNumInstances[(UINT32)DebugDraw::InstancedShape::Count] = { };
+
+		SPtr<VertexBuffer> mLineBuffer;
+		SPtr<VertexDeclaration> mLineVertexDecl;
+		UINT32 mLineBufferOffset = 0;
+		UINT32 mNumLineVertices = 0;
 	};
 
 	/** @} */
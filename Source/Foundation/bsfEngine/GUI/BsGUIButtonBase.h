@@ -23,16 +23,16 @@ namespace bs
 		void setContent(const GUIContent& content);
 
 		/**	Triggered when button is clicked. */
-		Event<void()> onClick;
+		EventST<void()> onClick;
 
 		/**	Triggered when pointer hovers over the button. */
-		Event<void()> onHover;
+		EventST<void()> onHover;
 
 		/**	Triggered when pointer that was previously hovering leaves the button. */
-		Event<void()> onOut;
+		EventST<void()> onOut;
 
 		/**	Triggered when button is clicked twice in rapid succession. */
-		Event<void()> onDoubleClick;
+		EventST<void()> onDoubleClick;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
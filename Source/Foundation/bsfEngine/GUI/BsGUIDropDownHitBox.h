@@ -49,10 +49,10 @@ namespace bs
 		void setBounds(const Vector<Rect2I>& bounds);
 
 		/** Triggered when hit box loses focus (for example user clicks outside of its bounds). */
-		Event<void()> onFocusLost;
+		EventST<void()> onFocusLost;
 
 		/** Triggered when hit box gains focus (for example user clicks inside of its bounds). */
-		Event<void()> onFocusGained;
+		EventST<void()> onFocusGained;
 
 	private:
 		GUIDropDownHitBox(bool captureMouseOver, bool captureMousePresses, const GUIDimensions& dimensions);
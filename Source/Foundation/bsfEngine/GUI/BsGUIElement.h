@@ -113,7 +113,7 @@ namespace bs
 		static void destroy(GUIElement* element);
 
 		/**	Triggered when the element loses or gains focus. */
-		Event<void(bool)> onFocusChanged;
+		EventST<void(bool)> onFocusChanged;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
@@ -175,6 +175,16 @@ namespace bs
 
 	void GUIElementBase::_markLayoutAsDirty() 
 	{ 
+		// Invalidate cached sizes of this element and all of its parents, as their sizes might depend on this element.
+		// Stop at the first element that's already invalidated, as its parents will have been invalidated along with it.
+		// Done even for hidden elements, so the sizes are up to date once they are shown.
+		GUIElementBase* sizeParent = this;
+		while (sizeParent != nullptr && !sizeParent->_isSizeDirty())
+		{
+			sizeParent->mFlags |= GUIElem_SizeDirty;
+			sizeParent = sizeParent->mParentElement;
+		}
+
 		if(!_isVisible())
 			return;
 
@@ -367,7 +377,7 @@ namespace bs
 
 	void GUIElementBase::_updateLayout(const GUILayoutData& data)
 	{
-		_updateOptimalLayoutSizes(); // We calculate optimal sizes of all layouts as a pre-processing step, as they are requested often during update
+		_updateLayoutSizes(); // We calculate optimal sizes of all layouts as a pre-processing step, as they are requested often during update
 		_updateLayoutInternal(data);
 	}
 
@@ -375,10 +385,22 @@ namespace bs
 	{
 		for(auto& child : mChildren)
 		{
-			child->_updateOptimalLayoutSizes();
+			child->_updateLayoutSizes();
 		}
 	}
 
+	void GUIElementBase::_updateLayoutSizes()
+	{
+		if (!_isSizeDirty())
+			return;
+
+		_updateOptimalLayoutSizes();
+
+		// Evaluated while still dirty, so the range gets calculated instead of returned from the cache
+		mCachedSizeRange = _getLayoutSizeRange();
+		mFlags &= ~GUIElem_SizeDirty;
+	}
+
 	void GUIElementBase::_updateLayoutInternal(const GUILayoutData& data)
 	{
 		for(auto& child : mChildren)
@@ -395,6 +417,9 @@ namespace bs
 
 	LayoutSizeRange GUIElementBase::_getLayoutSizeRange() const
 	{
+		if (!_isSizeDirty())
+			return mCachedSizeRange;
+
 		return _calculateLayoutSizeRange();
 	}
 
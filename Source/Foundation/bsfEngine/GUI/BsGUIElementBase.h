@@ -39,7 +39,8 @@ namespace bs
 			GUIElem_HiddenSelf = 0x08,
 			GUIElem_InactiveSelf = 0x10,
 			GUIElem_Disabled = 0x20,
-			GUIElem_DisabledSelf = 0x40
+			GUIElem_DisabledSelf = 0x40,
+			GUIElem_SizeDirty = 0x80
 		};
 
 	public:
@@ -147,6 +148,12 @@ namespace bs
 		/** Calculates optimal sizes of all child elements, as determined by their style and layout options. */
 		virtual void _updateOptimalLayoutSizes();
 
+		/**
+		 * Updates optimal sizes of this element and its children, but only if the element or any of its children had their
+		 * layout marked as dirty since the last update. Otherwise the previously calculated sizes are kept.
+		 */
+		void _updateLayoutSizes();
+
 		/** @copydoc _updateLayout */
 		virtual void _updateLayoutInternal(const GUILayoutData& data);
 
@@ -285,6 +292,12 @@ namespace bs
 		/**	Returns true if elements contents have changed since last update. */
 		bool _isDirty() const { return (mFlags & GUIElem_Dirty) != 0; }
 
+		/** 
+		 * Returns true if the optimal size of the element, or of any of its children, might have changed since the last
+		 * call to _updateLayoutSizes().
+		 */
+		bool _isSizeDirty() const { return (mFlags & GUIElem_SizeDirty) != 0; }
+
 		/**	Marks the element contents to be up to date (meaning it's processed by the GUI system). */
 		void _markAsClean();
 
@@ -327,7 +340,8 @@ namespace bs
 		GUIElementBase* mParentElement = nullptr;
 
 		Vector<GUIElementBase*> mChildren;	
-		UINT8 mFlags = GUIElem_Dirty;
+		UINT8 mFlags = GUIElem_Dirty | GUIElem_SizeDirty;
+		LayoutSizeRange mCachedSizeRange;
 
 		GUIDimensions mDimensions;
 		GUILayoutData mLayoutData;
@@ -79,10 +79,10 @@ namespace bs
 		void setFilter(std::function<bool(const String&)> filter) { mFilter = filter; }
 
 		/**	Triggered whenever input text has changed. */
-		Event<void(const String&)> onValueChanged;
+		EventST<void(const String&)> onValueChanged;
 
 		/**	Triggered when the user hits the Enter key with the input box in focus. */
-		Event<void()> onConfirm;
+		EventST<void()> onConfirm;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
@@ -14,7 +14,7 @@ namespace bs
 	Vector2I GUILayoutUtility::calcActualSize(UINT32 width, UINT32 height, GUILayout* layout, bool updateOptimalSizes)
 	{
 		if (updateOptimalSizes)
-			layout->_updateOptimalLayoutSizes();
+			layout->_updateLayoutSizes();
 
 		return calcActualSizeInternal(width, height, layout);
 	}
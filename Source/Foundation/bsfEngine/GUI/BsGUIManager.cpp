@@ -37,6 +37,11 @@
 #include "RenderAPI/BsSamplerState.h"
 #include "Managers/BsRenderStateManager.h"
 #include "Resources/BsBuiltinResources.h"
+#include "Text/BsDynamicFontAtlas.h"
+#include "2D/BsSpriteManager.h"
+#include "2D/BsTextSpriteCache.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Localization/BsStringTableManager.h"
 
 using namespace std::placeholders;
 
@@ -53,6 +58,8 @@ namespace bs
 
 		GUIElement* element;
 		UINT32 renderElement;
+		UINT64 mergeHash = 0;
+		Rect2I bounds;
 	};
 
 	struct GUIMaterialGroup
@@ -68,6 +75,9 @@ namespace bs
 		Vector<GUIGroupElement> elements;
 	};
 
+	/** Minimum number of GUI elements whose geometry is filled by a single task. */
+	static constexpr UINT32 FILL_GRAIN_SIZE = 32;
+
 	const UINT32 GUIManager::DRAG_DISTANCE = 3;
 	const float GUIManager::TOOLTIP_HOVER_TIME = 1.0f;
 
@@ -251,6 +261,27 @@ namespace bs
 			}
 		}
 
+		// Characters rendered on demand by dynamic fonts are only displayed by text generated after they were added, so
+		// regenerate all text when new characters become available
+		bool fontsChanged = DynamicFontAtlas::_updateAll();
+		if (fontsChanged)
+			SpriteManager::instance().getTextCache().clear();
+
+		// Localized strings are looked up again when the language changes, so update all text in a single pass instead
+		// of notifying every element individually
+		UINT32 languageVersion = StringTableManager::instance()._getLanguageVersion();
+		bool languageChanged = languageVersion != mLanguageVersion;
+		mLanguageVersion = languageVersion;
+
+		if (fontsChanged || languageChanged)
+		{
+			for (auto& widgetInfo : mWidgets)
+			{
+				for (auto& element : widgetInfo.widget->getElements())
+					element->_markContentAsDirty();
+			}
+		}
+
 		// Update layouts
 		gProfilerCPU().beginSample("UpdateLayout");
 		for(auto& widgetInfo : mWidgets)
@@ -449,291 +480,516 @@ namespace bs
 		{ }
 	}
 
+	UINT32 GUIManager::getNumBatches() const
+	{
+		UINT32 numBatches = 0;
+		for(auto& entry : mCachedGUIData)
+			numBatches += (UINT32)entry.second.cachedMeshes.size();
+
+		return numBatches;
+	}
+
 	void GUIManager::updateMeshes()
 	{
 		for(auto& cachedMeshData : mCachedGUIData)
 		{
 			GUIRenderData& renderData = cachedMeshData.second;
 
-			// Check if anything is dirty. If nothing is we can skip the update
-			bool isDirty = renderData.isDirty;
-			renderData.isDirty = false;
-
-			for(auto& widget : renderData.widgets)
+			bs_frame_mark();
 			{
-				if (widget->isDirty(true))
+				// Check if anything is dirty. If nothing is we can skip the update. If only contents of some elements
+				// changed we can attempt to update just their part of the meshes.
+				bool isDirty = renderData.isDirty;
+				bool needsRebuild = renderData.isDirty;
+				renderData.isDirty = false;
+
+				FrameVector<GUIElement*> dirtyElements;
+				for(auto& widget : renderData.widgets)
+				{
+					if (widget->_isMeshDirty())
+						needsRebuild = true;
+					else if (!needsRebuild)
+					{
+						const Set<GUIElement*>& dirtyContents = widget->_getDirtyContents();
+						dirtyElements.insert(dirtyElements.end(), dirtyContents.begin(), dirtyContents.end());
+					}
+
+					if (widget->isDirty(true))
+					{
+						isDirty = true;
+					}
+				}
+
+				if(isDirty)
 				{
-					isDirty = true;
+					mCoreDirty = true;
+
+					if (needsRebuild || !patchMeshes(renderData, dirtyElements))
+						rebuildMeshes(renderData);
 				}
 			}
+			bs_frame_clear();
+		}
 
-			if(!isDirty)
-				continue;
+		fillMeshes();
+	}
 
-			mCoreDirty = true;
+	void GUIManager::rebuildMeshes(GUIRenderData& renderData)
+	{
+		// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
+		auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
+		{
+			UINT32 aDepth = a.element->_getRenderElementDepth(a.renderElement);
+			UINT32 bDepth = b.element->_getRenderElementDepth(b.renderElement);
 
-			bs_frame_mark();
+			// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
+			// requires all elements to be unique
+			return (aDepth > bDepth) || 
+				(aDepth == bDepth && a.element > b.element) || 
+				(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement); 
+		};
+
+		FrameSet<GUIGroupElement, decltype(elemComp)> allElements(elemComp);
+
+		for (auto& widget : renderData.widgets)
+		{
+			const Vector<GUIElement*>& elements = widget->getElements();
+
+			for (auto& element : elements)
 			{
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
+				if (!element->_isVisible())
+					continue;
+
+				UINT32 numRenderElems = element->_getNumRenderElements();
+				for (UINT32 i = 0; i < numRenderElems; i++)
 				{
-					UINT32 aDepth = a.element->_getRenderElementDepth(a.renderElement);
-					UINT32 bDepth = b.element->_getRenderElementDepth(b.renderElement);
+					allElements.insert(GUIGroupElement(element, i));
+				}
+			}
+		}
 
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-					return (aDepth > bDepth) || 
-						(aDepth == bDepth && a.element > b.element) || 
-						(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement); 
-				};
+		// Group the elements in such a way so that we end up with a smallest amount of
+		// meshes, without breaking back to front rendering order
+		FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
+		for (auto& elem : allElements)
+		{
+			GUIElement* guiElem = elem.element;
+			UINT32 renderElemIdx = elem.renderElement;
+			UINT32 elemDepth = guiElem->_getRenderElementDepth(renderElemIdx);
 
-				FrameSet<GUIGroupElement, std::function<bool(const GUIGroupElement&, const GUIGroupElement&)>> allElements(elemComp);
+			Rect2I tfrmedBounds = guiElem->_getClippedBounds();
+			tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
 
-				for (auto& widget : renderData.widgets)
-				{
-					const Vector<GUIElement*>& elements = widget->getElements();
+			SpriteMaterial* spriteMaterial = nullptr;
+			const SpriteMaterialInfo& matInfo = guiElem->_getMaterial(renderElemIdx, &spriteMaterial);
+			assert(spriteMaterial != nullptr);
+
+			UINT64 hash = spriteMaterial->getMergeHash(matInfo);
+			FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
+
+			GUIGroupElement groupElem(guiElem, renderElemIdx);
+			groupElem.mergeHash = hash;
+			groupElem.bounds = tfrmedBounds;
+			
+			// Try to find a group this material will fit in:
+			//  - Group that has a depth value same or one below elements depth will always be a match
+			//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
+			//    overlap the current elements bounds.
+			GUIMaterialGroup* foundGroup = nullptr;
 
-					for (auto& element : elements)
+			for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+			{
+				// If we separate meshes by widget, ignore any groups with widget parents other than mine
+				if (mSeparateMeshesByWidget)
+				{
+					if (groupIter->elements.size() > 0)
 					{
-						if (!element->_isVisible())
+						GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
+						if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
 							continue;
-
-						UINT32 numRenderElems = element->_getNumRenderElements();
-						for (UINT32 i = 0; i < numRenderElems; i++)
-						{
-							allElements.insert(GUIGroupElement(element, i));
-						}
 					}
 				}
 
-				// Group the elements in such a way so that we end up with a smallest amount of
-				// meshes, without breaking back to front rendering order
-				FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
-				for (auto& elem : allElements)
+				GUIMaterialGroup& group = *groupIter;
+
+				if (group.depth == elemDepth)
 				{
-					GUIElement* guiElem = elem.element;
-					UINT32 renderElemIdx = elem.renderElement;
-					UINT32 elemDepth = guiElem->_getRenderElementDepth(renderElemIdx);
+					foundGroup = &group;
+					break;
+				}
+				else
+				{
+					UINT32 startDepth = elemDepth;
+					UINT32 endDepth = group.depth;
 
-					Rect2I tfrmedBounds = guiElem->_getClippedBounds();
-					tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
+					Rect2I potentialGroupBounds = group.bounds;
+					potentialGroupBounds.encapsulate(tfrmedBounds);
 
-					SpriteMaterial* spriteMaterial = nullptr;
-					const SpriteMaterialInfo& matInfo = guiElem->_getMaterial(renderElemIdx, &spriteMaterial);
-					assert(spriteMaterial != nullptr);
-
-					UINT64 hash = spriteMaterial->getMergeHash(matInfo);
-					FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
-					
-					// Try to find a group this material will fit in:
-					//  - Group that has a depth value same or one below elements depth will always be a match
-					//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
-					//    overlap the current elements bounds.
-					GUIMaterialGroup* foundGroup = nullptr;
-
-					for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+					bool foundOverlap = false;
+					for (auto& material : materialGroups)
 					{
-						// If we separate meshes by widget, ignore any groups with widget parents other than mine
-						if (mSeparateMeshesByWidget)
+						for (auto& matGroup : material.second)
 						{
-							if (groupIter->elements.size() > 0)
-							{
-								GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
-								if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
-									continue;
-							}
-						}
-
-						GUIMaterialGroup& group = *groupIter;
+							if (&matGroup == &group)
+								continue;
 
-						if (group.depth == elemDepth)
-						{
-							foundGroup = &group;
-							break;
-						}
-						else
-						{
-							UINT32 startDepth = elemDepth;
-							UINT32 endDepth = group.depth;
-
-							Rect2I potentialGroupBounds = group.bounds;
-							potentialGroupBounds.encapsulate(tfrmedBounds);
-
-							bool foundOverlap = false;
-							for (auto& material : materialGroups)
+							if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
+								|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
 							{
-								for (auto& matGroup : material.second)
+								if (matGroup.bounds.overlaps(potentialGroupBounds))
 								{
-									if (&matGroup == &group)
-										continue;
-
-									if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
-										|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
-									{
-										if (matGroup.bounds.overlaps(potentialGroupBounds))
-										{
-											foundOverlap = true;
-											break;
-										}
-									}
+									foundOverlap = true;
+									break;
 								}
 							}
-
-							if (!foundOverlap)
-							{
-								foundGroup = &group;
-								break;
-							}
 						}
 					}
 
-					if (foundGroup == nullptr)
-					{
-						groupsPerMaterial.push_back(GUIMaterialGroup());
-						foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
-
-						foundGroup->depth = elemDepth;
-						foundGroup->minDepth = elemDepth;
-						foundGroup->bounds = tfrmedBounds;
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->matInfo = matInfo.clone();
-						foundGroup->material = spriteMaterial;
-
-						guiElem->_getMeshInfo(renderElemIdx, foundGroup->numVertices, foundGroup->numIndices, foundGroup->meshType);
-					}
-					else
+					if (!foundOverlap)
 					{
-						foundGroup->bounds.encapsulate(tfrmedBounds);
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
-						
-						UINT32 numVertices;
-						UINT32 numIndices;
-						GUIMeshType meshType;
-						guiElem->_getMeshInfo(renderElemIdx, numVertices, numIndices, meshType);
-						assert(meshType == foundGroup->meshType); // It's expected that GUI element doesn't use same material for different mesh types so this should always be true
-
-						foundGroup->numVertices += numVertices;
-						foundGroup->numIndices += numIndices;
-
-						spriteMaterial->merge(foundGroup->matInfo, matInfo);
+						foundGroup = &group;
+						break;
 					}
 				}
+			}
 
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
-				{
-					return (a->depth > b->depth) || (a->depth == b->depth && a > b);
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-				};
+			if (foundGroup == nullptr)
+			{
+				groupsPerMaterial.push_back(GUIMaterialGroup());
+				foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
 
-				UINT32 numMeshes = 0;
-				UINT32 numIndices[2] = { 0, 0 };
-				UINT32 numVertices[2] = { 0, 0 };
+				foundGroup->depth = elemDepth;
+				foundGroup->minDepth = elemDepth;
+				foundGroup->bounds = tfrmedBounds;
+				foundGroup->elements.push_back(groupElem);
+				foundGroup->matInfo = matInfo.clone();
+				foundGroup->material = spriteMaterial;
 
-				FrameSet<GUIMaterialGroup*, std::function<bool(GUIMaterialGroup*, GUIMaterialGroup*)>> sortedGroups(groupComp);
-				for(auto& material : materialGroups)
-				{
-					for(auto& group : material.second)
-					{
-						sortedGroups.insert(&group);
+				guiElem->_getMeshInfo(renderElemIdx, foundGroup->numVertices, foundGroup->numIndices, foundGroup->meshType);
+			}
+			else
+			{
+				foundGroup->bounds.encapsulate(tfrmedBounds);
+				foundGroup->elements.push_back(groupElem);
+				foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
+				
+				UINT32 numVertices;
+				UINT32 numIndices;
+				GUIMeshType meshType;
+				guiElem->_getMeshInfo(renderElemIdx, numVertices, numIndices, meshType);
+				assert(meshType == foundGroup->meshType); // It's expected that GUI element doesn't use same material for different mesh types so this should always be true
+
+				foundGroup->numVertices += numVertices;
+				foundGroup->numIndices += numIndices;
+
+				spriteMaterial->merge(foundGroup->matInfo, matInfo);
+			}
+		}
 
-						UINT32 typeIdx = (UINT32)group.meshType;
-						numIndices[typeIdx] += group.numIndices;
-						numVertices[typeIdx] += group.numVertices;
+		// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
+		auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
+		{
+			return (a->depth > b->depth) || (a->depth == b->depth && a > b);
+			// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
+			// requires all elements to be unique
+		};
 
-						numMeshes++;
-					}
-				}
+		UINT32 numMeshes = 0;
+		UINT32 numIndices[2] = { 0, 0 };
+		UINT32 numVertices[2] = { 0, 0 };
+
+		FrameSet<GUIMaterialGroup*, decltype(groupComp)> sortedGroups(groupComp);
+		for(auto& material : materialGroups)
+		{
+			for(auto& group : material.second)
+			{
+				sortedGroups.insert(&group);
+
+				UINT32 typeIdx = (UINT32)group.meshType;
+				numIndices[typeIdx] += group.numIndices;
+				numVertices[typeIdx] += group.numVertices;
+
+				numMeshes++;
+			}
+		}
+
+		renderData.triangleMesh = nullptr;
+		renderData.lineMesh = nullptr;
+
+		renderData.cachedMeshes.resize(numMeshes);
+		renderData.elementInfos.clear();
+
+		SPtr<MeshData> meshData[2];
+		SPtr<VertexDataDesc> vertexDesc[2] = { mTriangleVertexDesc, mLineVertexDesc };
+
+		UINT8* vertices[2] = { nullptr, nullptr };
+		UINT32* indices[2] = { nullptr, nullptr };
+
+		for(UINT32 i = 0; i < 2; i++)
+		{
+			if(numVertices[i] > 0 && numIndices[i] > 0)
+			{
+				meshData[i] = MeshData::create(numVertices[i], numIndices[i], vertexDesc[i]);
+
+				vertices[i] = meshData[i]->getElementData(VES_POSITION);
+				indices[i] = meshData[i]->getIndices32();
+			}
+		}
+
+		// Fill buffers for each group and update their meshes
+		UINT32 meshIdx = 0;
+		UINT32 vertexOffset[2] = { 0, 0 };
+		UINT32 indexOffset[2] = { 0, 0 };
+
+		for(auto& group : sortedGroups)
+		{
+			GUIWidget* widget;
+
+			if (group->elements.size() == 0)
+				widget = nullptr;
+			else
+			{
+				GUIElement* elem = group->elements.begin()->element;
+				widget = elem->_getParentWidget();
+			}
+
+			GUIMeshData& guiMeshData = renderData.cachedMeshes[meshIdx];
+			guiMeshData.matInfo = group->matInfo;
+			guiMeshData.material = group->material;
+			guiMeshData.widget = widget;
+			guiMeshData.isLine = group->meshType == GUIMeshType::Line;
 
-				renderData.triangleMesh = nullptr;
-				renderData.lineMesh = nullptr;
+			UINT32 typeIdx = (UINT32)group->meshType;
+			guiMeshData.indexOffset = indexOffset[typeIdx];
 
-				renderData.cachedMeshes.resize(numMeshes);
+			UINT32 groupNumIndices = 0;
+			for(auto& matElement : group->elements)
+			{
+				UINT32 elemNumVertices;
+				UINT32 elemNumIndices;
+				GUIMeshType meshType;
+				matElement.element->_getMeshInfo(matElement.renderElement, elemNumVertices, elemNumIndices, meshType);
+
+				// Offsets are known up front, so the geometry itself can be filled later, in parallel
+				GUIFillJob fillJob;
+				fillJob.element = matElement.element;
+				fillJob.renderElement = matElement.renderElement;
+				fillJob.vertices = vertices[typeIdx];
+				fillJob.indices = indices[typeIdx];
+				fillJob.vertexOffset = vertexOffset[typeIdx];
+				fillJob.indexOffset = indexOffset[typeIdx];
+				fillJob.numIndices = elemNumIndices;
+				fillJob.maxNumVertices = numVertices[typeIdx];
+				fillJob.maxNumIndices = numIndices[typeIdx];
+
+				mFillJobs.push_back(fillJob);
+
+				// Remember where the element ended up, so its geometry can later be updated in place
+				SmallVector<GUIRenderElementInfo, 2>& elemInfos = renderData.elementInfos[matElement.element];
+				if (elemInfos.size() <= matElement.renderElement)
+					elemInfos.resize(matElement.renderElement + 1);
+
+				GUIRenderElementInfo& elemInfo = elemInfos[matElement.renderElement];
+				elemInfo.meshIdx = meshIdx;
+				elemInfo.vertexOffset = vertexOffset[typeIdx];
+				elemInfo.indexOffset = indexOffset[typeIdx];
+				elemInfo.numVertices = elemNumVertices;
+				elemInfo.numIndices = elemNumIndices;
+				elemInfo.meshType = meshType;
+				elemInfo.depth = matElement.element->_getRenderElementDepth(matElement.renderElement);
+				elemInfo.mergeHash = matElement.mergeHash;
+				elemInfo.bounds = matElement.bounds;
+				elemInfo.isFirstInGroup = &matElement == &group->elements[0];
+
+				indexOffset[typeIdx] += elemNumIndices;
+				vertexOffset[typeIdx] += elemNumVertices;
+
+				groupNumIndices += elemNumIndices;
+			}
+
+			guiMeshData.indexCount = groupNumIndices;
+
+			meshIdx++;
+		}
+
+		renderData.meshData[0] = meshData[0];
+		renderData.meshData[1] = meshData[1];
 
-				SPtr<MeshData> meshData[2];
-				SPtr<VertexDataDesc> vertexDesc[2] = { mTriangleVertexDesc, mLineVertexDesc };
+		mRebuiltRenderData.push_back(&renderData);
+	}
+
+	void GUIManager::fillMeshes()
+	{
+		// Render elements of the same element are always filled on the same thread, as elements are allowed to lazily
+		// update their internal geometry when filling
+		std::sort(mFillJobs.begin(), mFillJobs.end(), [](const GUIFillJob& a, const GUIFillJob& b)
+		{
+			return a.element < b.element;
+		});
 
-				UINT8* vertices[2] = { nullptr, nullptr };
-				UINT32* indices[2] = { nullptr, nullptr };
+		mFillJobRanges.clear();
+		for(UINT32 i = 0; i < (UINT32)mFillJobs.size(); i++)
+		{
+			if(i == 0 || mFillJobs[i].element != mFillJobs[i - 1].element)
+				mFillJobRanges.push_back(std::make_pair(i, i));
 
-				for(UINT32 i = 0; i < 2; i++)
+			mFillJobRanges.back().second = i + 1;
+		}
+
+		auto fillRanges = [this](UINT32 begin, UINT32 end)
+		{
+			for(UINT32 i = begin; i < end; i++)
+			{
+				for(UINT32 j = mFillJobRanges[i].first; j < mFillJobRanges[i].second; j++)
 				{
-					if(numVertices[i] > 0 && numIndices[i] > 0)
-					{
-						meshData[i] = MeshData::create(numVertices[i], numIndices[i], vertexDesc[i]);
+					const GUIFillJob& job = mFillJobs[j];
+					job.element->_fillBuffer(job.vertices, job.indices, job.vertexOffset, job.indexOffset,
+						job.maxNumVertices, job.maxNumIndices, job.renderElement);
 
-						vertices[i] = meshData[i]->getElementData(VES_POSITION);
-						indices[i] = meshData[i]->getIndices32();
-					}
+					UINT32 indexEnd = job.indexOffset + job.numIndices;
+					for(UINT32 k = job.indexOffset; k < indexEnd; k++)
+						job.indices[k] += job.vertexOffset;
 				}
+			}
+		};
 
-				// Fill buffers for each group and update their meshes
-				UINT32 meshIdx = 0;
-				UINT32 vertexOffset[2] = { 0, 0 };
-				UINT32 indexOffset[2] = { 0, 0 };
+		TaskScheduler::instance().parallelFor(0, (UINT32)mFillJobRanges.size(), FILL_GRAIN_SIZE, fillRanges);
 
-				for(auto& group : sortedGroups)
-				{
-					GUIWidget* widget;
+		for(auto& renderData : mRebuiltRenderData)
+		{
+			if(renderData->meshData[0])
+				renderData->triangleMesh = Mesh::_createPtr(renderData->meshData[0], MU_STATIC, DOT_TRIANGLE_LIST);
 
-					if (group->elements.size() == 0)
-						widget = nullptr;
-					else
-					{
-						GUIElement* elem = group->elements.begin()->element;
-						widget = elem->_getParentWidget();
-					}
+			if(renderData->meshData[1])
+				renderData->lineMesh = Mesh::_createPtr(renderData->meshData[1], MU_STATIC, DOT_LINE_LIST);
+		}
 
-					GUIMeshData& guiMeshData = renderData.cachedMeshes[meshIdx];
-					guiMeshData.matInfo = group->matInfo;
-					guiMeshData.material = group->material;
-					guiMeshData.widget = widget;
-					guiMeshData.isLine = group->meshType == GUIMeshType::Line;
+		mFillJobs.clear();
+		mRebuiltRenderData.clear();
+	}
 
-					UINT32 typeIdx = (UINT32)group->meshType;
-					guiMeshData.indexOffset = indexOffset[typeIdx];
+	bool GUIManager::patchMeshes(GUIRenderData& renderData, const FrameVector<GUIElement*>& dirtyElements)
+	{
+		// Make sure none of the elements changed in a way that would require them to be regrouped
+		for(auto& element : dirtyElements)
+		{
+			auto iterFind = renderData.elementInfos.find(element);
+			if (iterFind == renderData.elementInfos.end())
+			{
+				// Element wasn't part of the meshes. This is fine only if it still doesn't have anything to render.
+				if (element->_isVisible() && element->_getNumRenderElements() > 0)
+					return false;
 
-					UINT32 groupNumIndices = 0;
-					for(auto& matElement : group->elements)
-					{
-						matElement.element->_fillBuffer(
-							vertices[typeIdx], indices[typeIdx], 
-							vertexOffset[typeIdx], indexOffset[typeIdx], 
-							numVertices[typeIdx], numIndices[typeIdx], matElement.renderElement);
+				continue;
+			}
 
-						UINT32 elemNumVertices;
-						UINT32 elemNumIndices;
-						GUIMeshType meshType;
-						matElement.element->_getMeshInfo(matElement.renderElement, elemNumVertices, elemNumIndices, meshType);
+			if (!element->_isVisible())
+				return false;
 
-						UINT32 indexStart = indexOffset[typeIdx];
-						UINT32 indexEnd = indexStart + elemNumIndices;
+			const SmallVector<GUIRenderElementInfo, 2>& elemInfos = iterFind->second;
+			UINT32 numRenderElems = element->_getNumRenderElements();
+			if (numRenderElems != (UINT32)elemInfos.size())
+				return false;
 
-						for(UINT32 i = indexStart; i < indexEnd; i++)
-							indices[typeIdx][i] += vertexOffset[typeIdx];
+			Rect2I tfrmedBounds = element->_getClippedBounds();
+			tfrmedBounds.transform(element->_getParentWidget()->getWorldTfrm());
 
-						indexOffset[typeIdx] += elemNumIndices;
-						vertexOffset[typeIdx] += elemNumVertices;
+			for(UINT32 i = 0; i < numRenderElems; i++)
+			{
+				const GUIRenderElementInfo& elemInfo = elemInfos[i];
 
-						groupNumIndices += elemNumIndices;
-					}
+				UINT32 numVertices;
+				UINT32 numIndices;
+				GUIMeshType meshType;
+				element->_getMeshInfo(i, numVertices, numIndices, meshType);
 
-					guiMeshData.indexCount = groupNumIndices;
+				if (numVertices != elemInfo.numVertices || numIndices != elemInfo.numIndices || 
+					meshType != elemInfo.meshType)
+					return false;
 
-					meshIdx++;
-				}
+				if (element->_getRenderElementDepth(i) != elemInfo.depth || tfrmedBounds != elemInfo.bounds)
+					return false;
 
-				if(meshData[0])
-					renderData.triangleMesh = Mesh::_createPtr(meshData[0], MU_STATIC, DOT_TRIANGLE_LIST);
+				SpriteMaterial* spriteMaterial = nullptr;
+				const SpriteMaterialInfo& matInfo = element->_getMaterial(i, &spriteMaterial);
+				if (spriteMaterial->getMergeHash(matInfo) != elemInfo.mergeHash)
+					return false;
+			}
+		}
+
+		// The existing mesh data might still be in use by the core thread, so make a copy of it and refill the dirty
+		// elements in the copy
+		SPtr<MeshData> meshData[2];
+		bool isTypeDirty[2] = { false, false };
+
+		for(auto& element : dirtyElements)
+		{
+			auto iterFind = renderData.elementInfos.find(element);
+			if (iterFind == renderData.elementInfos.end())
+				continue;
+
+			for(auto& elemInfo : iterFind->second)
+				isTypeDirty[(UINT32)elemInfo.meshType] = true;
+		}
+
+		for(UINT32 i = 0; i < 2; i++)
+		{
+			if (!isTypeDirty[i])
+				continue;
 
-				if(meshData[1])
-					renderData.lineMesh = Mesh::_createPtr(meshData[1], MU_STATIC, DOT_LINE_LIST);
+			const SPtr<MeshData>& srcData = renderData.meshData[i];
+			meshData[i] = MeshData::create(srcData->getNumVertices(), srcData->getNumIndices(), 
+				srcData->getVertexDesc());
+
+			memcpy(meshData[i]->getData(), srcData->getData(), srcData->getSize());
+		}
+
+		for(auto& element : dirtyElements)
+		{
+			auto iterFind = renderData.elementInfos.find(element);
+			if (iterFind == renderData.elementInfos.end())
+				continue;
+
+			const SmallVector<GUIRenderElementInfo, 2>& elemInfos = iterFind->second;
+			for(UINT32 i = 0; i < (UINT32)elemInfos.size(); i++)
+			{
+				const GUIRenderElementInfo& elemInfo = elemInfos[i];
+				UINT32 typeIdx = (UINT32)elemInfo.meshType;
+
+				UINT8* vertices = meshData[typeIdx]->getElementData(VES_POSITION);
+				UINT32* indices = meshData[typeIdx]->getIndices32();
+
+				element->_fillBuffer(vertices, indices, elemInfo.vertexOffset, elemInfo.indexOffset, 
+					meshData[typeIdx]->getNumVertices(), meshData[typeIdx]->getNumIndices(), i);
+
+				UINT32 indexEnd = elemInfo.indexOffset + elemInfo.numIndices;
+				for(UINT32 j = elemInfo.indexOffset; j < indexEnd; j++)
+					indices[j] += elemInfo.vertexOffset;
+
+				// Group material info is cloned from its first element, so keep it in sync with the element
+				if (elemInfo.isFirstInGroup)
+				{
+					SpriteMaterial* spriteMaterial = nullptr;
+					const SpriteMaterialInfo& matInfo = element->_getMaterial(i, &spriteMaterial);
+
+					renderData.cachedMeshes[elemInfo.meshIdx].matInfo = matInfo.clone();
+				}
 			}
+		}
 
-			bs_frame_clear();			
+		if(meshData[0])
+		{
+			renderData.meshData[0] = meshData[0];
+			renderData.triangleMesh = Mesh::_createPtr(meshData[0], MU_STATIC, DOT_TRIANGLE_LIST);
 		}
+
+		if(meshData[1])
+		{
+			renderData.meshData[1] = meshData[1];
+			renderData.lineMesh = Mesh::_createPtr(meshData[1], MU_STATIC, DOT_LINE_LIST);
+		}
+
+		return true;
 	}
 
 	void GUIManager::updateCaretTexture()
@@ -1335,13 +1591,14 @@ namespace bs
 				if(widgetWindows[widgetIdx] == windowUnderPointer 
 					&& widget->inBounds(windowToBridgedCoords(widget->getTarget()->getTarget(), windowPos)))
 				{
-					const Vector<GUIElement*>& elements = widget->getElements();
 					Vector2I localPos = getWidgetRelativePos(widget, pointerScreenPos);
 
+					mElementsNearPointer.clear();
+					widget->_getElementsNear(localPos, mElementsNearPointer);
+
 					// Elements with lowest depth (most to the front) get handled first
-					for(auto iter = elements.begin(); iter != elements.end(); ++iter)
+					for(auto& element : mElementsNearPointer)
 					{
-						GUIElement* element = *iter;
 
 						if(element->_isVisible() && element->_isInBounds(localPos))
 						{
@@ -12,6 +12,7 @@
 #include "Utility/BsModule.h"
 #include "Image/BsColor.h"
 #include "Math/BsMatrix4.h"
+#include "Math/BsRect2I.h"
 #include "Utility/BsEvent.h"
 #include "Material/BsMaterialParam.h"
 #include "Renderer/BsParamBlocks.h"
@@ -60,6 +61,35 @@ namespace bs
 			bool isLine;
 		};
 
+		/** Location of a single GUI element render element within the cached GUI mesh data. */
+		struct GUIRenderElementInfo
+		{
+			UINT32 meshIdx;
+			UINT32 vertexOffset;
+			UINT32 indexOffset;
+			UINT32 numVertices;
+			UINT32 numIndices;
+			GUIMeshType meshType;
+			UINT32 depth;
+			UINT64 mergeHash;
+			Rect2I bounds;
+			bool isFirstInGroup;
+		};
+
+		/** Geometry of a single GUI element render element that is waiting to be written into mesh data. */
+		struct GUIFillJob
+		{
+			GUIElement* element;
+			UINT32 renderElement;
+			UINT8* vertices;
+			UINT32* indices;
+			UINT32 vertexOffset;
+			UINT32 indexOffset;
+			UINT32 numIndices;
+			UINT32 maxNumVertices;
+			UINT32 maxNumIndices;
+		};
+
 		/**	GUI render data for a single viewport. */
 		struct GUIRenderData
 		{
@@ -72,6 +102,15 @@ namespace bs
 			Vector<GUIMeshData> cachedMeshes;
 			Vector<GUIWidget*> widgets;
 			bool isDirty;
+
+			/**
+			 * Vertex and index data the meshes above were created from, kept so that elements whose contents changed can
+			 * be patched in without rebuilding the rest of the meshes. Never modified once a mesh is created from it.
+			 */
+			SPtr<MeshData> meshData[2];
+
+			/** Location of every render element of every visible element within the mesh data above. */
+			FlatHashMap<GUIElement*, SmallVector<GUIRenderElementInfo, 2>> elementInfos;
 		};
 
 		/**	Render data for a single GUI group used for notifying the core GUI renderer. */
@@ -172,6 +211,12 @@ namespace bs
 		/**	Changes the text selection highlight color used in input boxes and similar controls. */
 		void setTextSelectionColor(const Color& color) { mTextSelectionColor = color; updateTextSelectionTexture(); }
 
+		/** 
+		 * Returns the number of batches (separate draw calls) the GUI is currently rendered with, across all render
+		 * targets. 
+		 */
+		UINT32 getNumBatches() const;
+
 		/**	Returns the default caret texture used for rendering the input caret sprite. */
 		const HSpriteTexture& getCaretTexture() const { return mCaretTexture; }
 
@@ -234,6 +279,27 @@ namespace bs
 		/**	Recreates all dirty GUI meshes and makes them ready for rendering. */
 		void updateMeshes();
 
+		/**
+		 * Regroups all elements of the provided render data and allocates data for all of its meshes. Geometry of the
+		 * elements is queued for filling and the meshes are created by fillMeshes().
+		 */
+		void rebuildMeshes(GUIRenderData& renderData);
+
+		/**
+		 * Fills the geometry of all elements queued by rebuildMeshes(), in parallel, and creates the meshes of the
+		 * render data that was rebuilt.
+		 */
+		void fillMeshes();
+
+		/**
+		 * Refills the geometry of the provided elements in the existing meshes of the render data, without regrouping or
+		 * refilling any other elements. Only possible if none of the elements changed in a way that would affect their
+		 * grouping (number of vertices or indices, material, depth or bounds).
+		 *
+		 * @return	True if the meshes were updated, false if the elements changed too much and a full rebuild is needed.
+		 */
+		bool patchMeshes(GUIRenderData& renderData, const FrameVector<GUIElement*>& dirtyElements);
+
 		/**	Recreates the input caret texture. */
 		void updateCaretTexture();
 
@@ -358,10 +424,15 @@ namespace bs
 		static const UINT32 MESH_HEAP_INITIAL_NUM_INDICES;
 
 		Vector<WidgetInfo> mWidgets;
-		UnorderedMap<const Viewport*, GUIRenderData> mCachedGUIData;
+		FlatHashMap<const Viewport*, GUIRenderData> mCachedGUIData;
+
+		Vector<GUIFillJob> mFillJobs;
+		Vector<std::pair<UINT32, UINT32>> mFillJobRanges;
+		Vector<GUIRenderData*> mRebuiltRenderData;
 
 		SPtr<ct::GUIRenderer> mRenderer;
 		bool mCoreDirty;
+		UINT32 mLanguageVersion = 0;
 
 		SPtr<VertexDataDesc> mTriangleVertexDesc;
 		SPtr<VertexDataDesc> mLineVertexDesc;
@@ -371,6 +442,7 @@ namespace bs
 		// Element and widget pointer is currently over
 		Vector<ElementInfoUnderPointer> mElementsUnderPointer;
 		Vector<ElementInfoUnderPointer> mNewElementsUnderPointer;
+		Vector<GUIElement*> mElementsNearPointer;
 
 		// Element and widget that's being clicked on
 		GUIMouseButton mActiveMouseButton;
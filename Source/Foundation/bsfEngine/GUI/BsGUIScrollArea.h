@@ -159,9 +159,13 @@ namespace bs
 
 		/** @copydoc GUIElementContainer::_getOptimalSize */
 		Vector2I _getOptimalSize() const override;
-	private:
+
+		/** @copydoc	GUIElementContainer::_updateLayoutInternal */
+		void _updateLayoutInternal(const GUILayoutData& data) override;
+
 		GUIScrollArea(ScrollBarType vertBarType, ScrollBarType horzBarType, 
 			const String& scrollBarStyle, const String& scrollAreaStyle, const GUIDimensions& dimensions);
+	private:
 
 		/** @copydoc GUIElementContainer::mouseEvent */
 		bool _mouseEvent(const GUIMouseEvent& ev) override;
@@ -180,9 +184,6 @@ namespace bs
 		 */
 		void horzScrollUpdate(float pct);
 
-		/** @copydoc	GUIElementContainer::_updateLayoutInternal */
-		void _updateLayoutInternal(const GUILayoutData& data) override;
-
 		/** @copydoc	GUIElementContainer::_getElementAreas */
 		void _getElementAreas(const Rect2I& layoutArea, Rect2I* elementAreas, UINT32 numElements, 
 			const Vector<LayoutSizeRange>& sizeRanges, const LayoutSizeRange& mySizeRange) const override;
@@ -50,7 +50,7 @@ namespace bs
 		 * Triggered whenever the scrollbar handle is moved or resized. Values provided are the handle position and size 
 		 * in percent (ranging [0, 1]).
 		 */
-		Event<void(float posPct, float sizePct)> onScrollOrResize;
+		EventST<void(float posPct, float sizePct)> onScrollOrResize;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
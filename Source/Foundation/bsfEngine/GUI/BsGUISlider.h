@@ -69,7 +69,7 @@ namespace bs
 		void setTint(const Color& color) override;
 
 		/** Triggered when the user changes the value of the slider. */
-		Event<void(float percent)> onChanged;
+		EventST<void(float percent)> onChanged;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
@@ -100,7 +100,7 @@ namespace bs
 		void moveOneStep(bool forward);
 
 		/** Triggered when the user drags the handle. */
-		Event<void(float pos, float size)> onHandleMovedOrResized;
+		EventST<void(float pos, float size)> onHandleMovedOrResized;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
@@ -132,7 +132,7 @@ namespace bs
 		bool isToggled() const { return mIsToggled; }
 
 		/**	Triggered whenever the button is toggled on or off. */
-		Event<void(bool)> onToggled;
+		EventST<void(bool)> onToggled;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
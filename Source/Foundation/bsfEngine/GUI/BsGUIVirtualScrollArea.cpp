@@ -0,0 +1,161 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "GUI/BsGUIVirtualScrollArea.h"
+#include "GUI/BsGUILayout.h"
+#include "GUI/BsGUISpace.h"
+#include "GUI/BsGUIDimensions.h"
+#include "Math/BsMath.h"
+
+namespace bs
+{
+	GUIVirtualScrollArea::GUIVirtualScrollArea(UINT32 itemHeight, const CreateItemFunc& createItem, 
+		const UpdateItemFunc& updateItem, const String& scrollBarStyle, const String& scrollAreaStyle, 
+		const GUIDimensions& dimensions)
+		: GUIScrollArea(ScrollBarType::ShowIfDoesntFit, ScrollBarType::NeverShow, scrollBarStyle, scrollAreaStyle, 
+			dimensions)
+		, mItemHeight(std::max(1U, itemHeight)), mCreateItem(createItem), mUpdateItem(updateItem)
+	{
+		mTopSpace = getLayout().addNewElement<GUIFixedSpace>(0);
+		mBottomSpace = getLayout().addNewElement<GUIFixedSpace>(0);
+	}
+
+	void GUIVirtualScrollArea::setNumItems(UINT32 numItems)
+	{
+		if (mNumItems == numItems)
+			return;
+
+		mNumItems = numItems;
+
+		// Keep the currently visible items, clipped to the new item count. This ensures the content has the correct size
+		// before the next layout update, which will then determine the actual visible range.
+		UINT32 firstItem = std::min(mFirstItem, mNumItems);
+		UINT32 numActiveItems = std::min(mNumActiveItems, mNumItems - firstItem);
+
+		updateVisibleItems(firstItem, numActiveItems);
+		_markLayoutAsDirty();
+	}
+
+	void GUIVirtualScrollArea::setNumMarginItems(UINT32 numItems)
+	{
+		mNumMarginItems = numItems;
+		_markLayoutAsDirty();
+	}
+
+	void GUIVirtualScrollArea::refresh()
+	{
+		for (UINT32 i = 0; i < mNumActiveItems; i++)
+			mUpdateItem(mItemElements[i], mFirstItem + i);
+	}
+
+	void GUIVirtualScrollArea::scrollToItem(UINT32 idx)
+	{
+		INT32 visibleHeight = (INT32)getContentBounds().height;
+		INT32 scrollableHeight = (INT32)(mNumItems * mItemHeight) - visibleHeight;
+
+		if (scrollableHeight <= 0)
+			return;
+
+		float pct = (idx * mItemHeight) / (float)scrollableHeight;
+		scrollToVertical(Math::clamp01(pct));
+	}
+
+	void GUIVirtualScrollArea::_updateLayoutInternal(const GUILayoutData& data)
+	{
+		// Determine which items are visible, using the position of the scroll bar. The scroll area calculates the actual
+		// offset during its own layout update, but this is close enough since we keep a margin of extra items anyway.
+		UINT32 visibleHeight = data.area.height;
+		UINT32 contentHeight = mNumItems * mItemHeight;
+		UINT32 scrollableHeight = contentHeight > visibleHeight ? contentHeight - visibleHeight : 0;
+		UINT32 scrollOffset = (UINT32)(scrollableHeight * Math::clamp01(getVerticalScroll()));
+
+		UINT32 firstVisibleItem = scrollOffset / mItemHeight;
+		UINT32 numVisibleItems = Math::divideAndRoundUp(visibleHeight, mItemHeight) + 1;
+
+		UINT32 firstItem = firstVisibleItem > mNumMarginItems ? firstVisibleItem - mNumMarginItems : 0;
+		UINT32 lastItem = std::min(mNumItems, firstVisibleItem + numVisibleItems + mNumMarginItems);
+		UINT32 numActiveItems = lastItem > firstItem ? lastItem - firstItem : 0;
+
+		// Content layout changed, so its sizes need to be recalculated before it can be laid out
+		if (updateVisibleItems(firstItem, numActiveItems))
+			_updateLayoutSizes();
+
+		GUIScrollArea::_updateLayoutInternal(data);
+	}
+
+	bool GUIVirtualScrollArea::updateVisibleItems(UINT32 firstItem, UINT32 numVisibleItems)
+	{
+		bool changed = false;
+
+		// Create new elements if we don't have enough
+		while ((UINT32)mItemElements.size() < numVisibleItems)
+		{
+			GUIElementBase* element = mCreateItem();
+			element->setHeight(mItemHeight);
+
+			// Items are placed between the top and bottom spaces
+			getLayout().insertElement(1 + (UINT32)mItemElements.size(), element);
+
+			mItemElements.push_back(element);
+			mItemIndices.push_back((UINT32)-1);
+			changed = true;
+		}
+
+		// Assign items to elements, hiding the elements that aren't needed. Elements that keep displaying the same item
+		// are not updated.
+		for (UINT32 i = 0; i < (UINT32)mItemElements.size(); i++)
+		{
+			GUIElementBase* element = mItemElements[i];
+
+			if (i < numVisibleItems)
+			{
+				UINT32 itemIdx = firstItem + i;
+				if (mItemIndices[i] == itemIdx)
+					continue;
+
+				if (mItemIndices[i] == (UINT32)-1)
+					element->setActive(true);
+
+				mUpdateItem(element, itemIdx);
+				mItemIndices[i] = itemIdx;
+				changed = true;
+			}
+			else if (mItemIndices[i] != (UINT32)-1)
+			{
+				element->setActive(false);
+				mItemIndices[i] = (UINT32)-1;
+				changed = true;
+			}
+		}
+
+		mFirstItem = firstItem;
+		mNumActiveItems = numVisibleItems;
+
+		// Spaces stand in for the items that don't have elements, so the content has the size of the entire list
+		UINT32 topSize = firstItem * mItemHeight;
+		UINT32 bottomSize = (mNumItems - firstItem - numVisibleItems) * mItemHeight;
+
+		if (mTopSpace->getSize() != topSize || mBottomSpace->getSize() != bottomSize)
+		{
+			mTopSpace->setSize(topSize);
+			mBottomSpace->setSize(bottomSize);
+			changed = true;
+		}
+
+		return changed;
+	}
+
+	GUIVirtualScrollArea* GUIVirtualScrollArea::create(UINT32 itemHeight, const CreateItemFunc& createItem,
+		const UpdateItemFunc& updateItem, const String& scrollBarStyle, const String& scrollAreaStyle)
+	{
+		return new (bs_alloc<GUIVirtualScrollArea>()) GUIVirtualScrollArea(itemHeight, createItem, updateItem, 
+			scrollBarStyle, getStyleName<GUIScrollArea>(scrollAreaStyle), GUIDimensions::create());
+	}
+
+	GUIVirtualScrollArea* GUIVirtualScrollArea::create(UINT32 itemHeight, const CreateItemFunc& createItem,
+		const UpdateItemFunc& updateItem, const GUIOptions& options, const String& scrollBarStyle, 
+		const String& scrollAreaStyle)
+	{
+		return new (bs_alloc<GUIVirtualScrollArea>()) GUIVirtualScrollArea(itemHeight, createItem, updateItem, 
+			scrollBarStyle, getStyleName<GUIScrollArea>(scrollAreaStyle), GUIDimensions::create(options));
+	}
+}
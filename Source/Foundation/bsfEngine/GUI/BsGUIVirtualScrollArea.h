@@ -0,0 +1,114 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "GUI/BsGUIScrollArea.h"
+
+namespace bs
+{
+	/** @addtogroup GUI
+	 *  @{
+	 */
+
+	/**
+	 * Scroll area displaying a vertical list of items of equal height, that creates GUI elements only for the items
+	 * currently visible in the scroll area (plus a small margin). Elements are provided by the user through callbacks and
+	 * recycled as the area is scrolled, allowing lists with a very large number of items to be displayed without paying
+	 * the layout and rendering cost for every item.
+	 */
+	class BS_EXPORT GUIVirtualScrollArea : public GUIScrollArea
+	{
+	public:
+		/** 
+		 * Callback triggered when the scroll area needs a new element to display an item with. The returned element will
+		 * be owned by the scroll area and re-used to display different items as the area is scrolled. 
+		 */
+		typedef std::function<GUIElementBase*()> CreateItemFunc;
+
+		/** Callback triggered when an element created by CreateItemFunc needs to display the item at the provided index. */
+		typedef std::function<void(GUIElementBase*, UINT32)> UpdateItemFunc;
+
+		/**
+		 * Creates a new virtual scroll area.
+		 *
+		 * @param[in]	itemHeight		Height of a single item, in pixels. Elements returned by @p createItem will be
+		 *								forced to this height.
+		 * @param[in]	createItem		Callback that creates a new element for displaying items.
+		 * @param[in]	updateItem		Callback that updates an element to display a specific item.
+		 * @param[in]	scrollBarStyle	Style used by the scroll bars.
+		 * @param[in]	scrollAreaStyle	Style used by the scroll content area.
+		 */
+		static GUIVirtualScrollArea* create(UINT32 itemHeight, const CreateItemFunc& createItem,
+			const UpdateItemFunc& updateItem, const String& scrollBarStyle = StringUtil::BLANK,
+			const String& scrollAreaStyle = StringUtil::BLANK);
+
+		/**
+		 * Creates a new virtual scroll area.
+		 *
+		 * @param[in]	itemHeight		Height of a single item, in pixels. Elements returned by @p createItem will be
+		 *								forced to this height.
+		 * @param[in]	createItem		Callback that creates a new element for displaying items.
+		 * @param[in]	updateItem		Callback that updates an element to display a specific item.
+		 * @param[in]	options			Options that allow you to control how is the element positioned and sized. This will
+		 *								override any similar options set by style.
+		 * @param[in]	scrollBarStyle	Style used by the scroll bars.
+		 * @param[in]	scrollAreaStyle	Style used by the scroll content area.
+		 */
+		static GUIVirtualScrollArea* create(UINT32 itemHeight, const CreateItemFunc& createItem,
+			const UpdateItemFunc& updateItem, const GUIOptions& options, 
+			const String& scrollBarStyle = StringUtil::BLANK, const String& scrollAreaStyle = StringUtil::BLANK);
+
+		/** Determines the total number of items in the list. */
+		void setNumItems(UINT32 numItems);
+
+		/** @copydoc setNumItems */
+		UINT32 getNumItems() const { return mNumItems; }
+
+		/** 
+		 * Determines the number of additional items to keep around above and below the visible items, so that small
+		 * scroll amounts don't require elements to be updated. 
+		 */
+		void setNumMarginItems(UINT32 numItems);
+
+		/** @copydoc setNumMarginItems */
+		UINT32 getNumMarginItems() const { return mNumMarginItems; }
+
+		/** Triggers the update callback for all currently displayed items, in case the underlying data changed. */
+		void refresh();
+
+		/** Scrolls the area so the item with the provided index is visible at the top of the area, if possible. */
+		void scrollToItem(UINT32 idx);
+
+	protected:
+		GUIVirtualScrollArea(UINT32 itemHeight, const CreateItemFunc& createItem, const UpdateItemFunc& updateItem,
+			const String& scrollBarStyle, const String& scrollAreaStyle, const GUIDimensions& dimensions);
+
+		/** @copydoc GUIScrollArea::_updateLayoutInternal */
+		void _updateLayoutInternal(const GUILayoutData& data) override;
+
+		/** 
+		 * Makes sure elements are assigned to all items within the provided range, and adjusts the spaces that stand in
+		 * for the items outside of the range.
+		 *
+		 * @return	True if any elements of the content layout changed.
+		 */
+		bool updateVisibleItems(UINT32 firstItem, UINT32 numVisibleItems);
+
+		UINT32 mItemHeight;
+		UINT32 mNumItems = 0;
+		UINT32 mNumMarginItems = 2;
+		CreateItemFunc mCreateItem;
+		UpdateItemFunc mUpdateItem;
+
+		GUIFixedSpace* mTopSpace = nullptr;
+		GUIFixedSpace* mBottomSpace = nullptr;
+
+		Vector<GUIElementBase*> mItemElements;
+		Vector<UINT32> mItemIndices;
+		UINT32 mFirstItem = 0;
+		UINT32 mNumActiveItems = 0;
+	};
+
+	/** @} */
+}
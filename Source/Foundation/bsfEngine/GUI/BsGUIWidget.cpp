@@ -14,6 +14,12 @@
 
 namespace bs
 {
+	/** Minimum size of a single cell of the grid used for looking up elements by position, in pixels. */
+	static const UINT32 HIT_GRID_MIN_CELL_SIZE = 64;
+
+	/** Maximum number of cells along each axis of the grid used for looking up elements by position. */
+	static const UINT32 HIT_GRID_MAX_CELLS_PER_AXIS = 32;
+
 	GUIWidget::GUIWidget(const SPtr<Camera>& camera)
 		: mCamera(camera), mPanel(nullptr), mDepth(128), mIsActive(true), mPosition(BsZero), mRotation(BsIdentity)
 		, mScale(Vector3::ONE), mTransform(BsIdentity), mCachedRTId(0), mWidgetIsDirty(false)
@@ -83,6 +89,7 @@ namespace bs
 
 		mElements.clear();
 		mDirtyContents.clear();
+		mHitGridDirty = true;
 	}
 
 	void GUIWidget::setDepth(UINT8 depth)
@@ -210,7 +217,7 @@ namespace bs
 			GUIPanel* panel = static_cast<GUIPanel*>(updateParent);
 
 			GUIElementBase* dirtyElement = elem;
-			dirtyElement->_updateOptimalLayoutSizes();
+			dirtyElement->_updateLayoutSizes();
 
 			LayoutSizeRange elementSizeRange = panel->_getElementSizeRange(dirtyElement);
 			Rect2I elementArea = panel->_getElementArea(panel->_getLayoutData().area, dirtyElement, elementSizeRange);
@@ -226,6 +233,8 @@ namespace bs
 			GUILayoutData childLayoutData = updateParent->_getLayoutData();
 			updateParent->_updateLayout(childLayoutData);
 		}
+
+		mHitGridDirty = true;
 		
 		// Mark dirty contents
 		bs_frame_mark();
@@ -259,6 +268,7 @@ namespace bs
 		{
 			mElements.push_back(static_cast<GUIElement*>(elem));
 			mWidgetIsDirty = true;
+			mHitGridDirty = true;
 		}
 	}
 
@@ -272,6 +282,7 @@ namespace bs
 		{
 			mElements.erase(iterFind);
 			mWidgetIsDirty = true;
+			mHitGridDirty = true;
 		}
 
 		if (elem->_getType() == GUIElementBase::Type::Element)
@@ -385,6 +396,110 @@ namespace bs
 			Rect2I elemBounds = elem->_getClippedBounds();
 			mBounds.encapsulate(elemBounds);
 		}
+
+		mHitGridDirty = true;
+	}
+
+	void GUIWidget::_getElementsNear(const Vector2I& position, Vector<GUIElement*>& output) const
+	{
+		if (mHitGridDirty)
+			updateHitGrid();
+
+		INT32 x = position.x - mHitGridArea.x;
+		INT32 y = position.y - mHitGridArea.y;
+		if (x < 0 || y < 0)
+			return;
+
+		UINT32 cellX = (UINT32)x / mHitGridCellWidth;
+		UINT32 cellY = (UINT32)y / mHitGridCellHeight;
+		if (cellX >= mHitGridNumCellsX || cellY >= mHitGridNumCellsY)
+			return;
+
+		UINT32 cellIdx = cellY * mHitGridNumCellsX + cellX;
+		for (UINT32 i = mHitGridOffsets[cellIdx]; i < mHitGridOffsets[cellIdx + 1]; i++)
+			output.push_back(mHitGridElements[i]);
+	}
+
+	void GUIWidget::updateHitGrid() const
+	{
+		mHitGridDirty = false;
+		mHitGridNumCellsX = 0;
+		mHitGridNumCellsY = 0;
+		mHitGridOffsets.clear();
+		mHitGridElements.clear();
+
+		// Elements with empty bounds can never be under the pointer, so they're not included in the grid
+		bool hasArea = false;
+		for (auto& elem : mElements)
+		{
+			const Rect2I& elemBounds = elem->_getClippedBounds();
+			if (elemBounds.width == 0 || elemBounds.height == 0)
+				continue;
+
+			if (!hasArea)
+			{
+				mHitGridArea = elemBounds;
+				hasArea = true;
+			}
+			else
+				mHitGridArea.encapsulate(elemBounds);
+		}
+
+		if (!hasArea)
+			return;
+
+		mHitGridCellWidth = std::max(HIT_GRID_MIN_CELL_SIZE,
+			Math::divideAndRoundUp(mHitGridArea.width, HIT_GRID_MAX_CELLS_PER_AXIS));
+		mHitGridCellHeight = std::max(HIT_GRID_MIN_CELL_SIZE,
+			Math::divideAndRoundUp(mHitGridArea.height, HIT_GRID_MAX_CELLS_PER_AXIS));
+
+		mHitGridNumCellsX = Math::divideAndRoundUp(mHitGridArea.width, mHitGridCellWidth);
+		mHitGridNumCellsY = Math::divideAndRoundUp(mHitGridArea.height, mHitGridCellHeight);
+
+		auto forEachOverlappingCell = [this](const Rect2I& bounds, const std::function<void(UINT32)>& func)
+		{
+			UINT32 minX = (UINT32)(bounds.x - mHitGridArea.x) / mHitGridCellWidth;
+			UINT32 minY = (UINT32)(bounds.y - mHitGridArea.y) / mHitGridCellHeight;
+			UINT32 maxX = (UINT32)(bounds.x + (INT32)bounds.width - 1 - mHitGridArea.x) / mHitGridCellWidth;
+			UINT32 maxY = (UINT32)(bounds.y + (INT32)bounds.height - 1 - mHitGridArea.y) / mHitGridCellHeight;
+
+			for (UINT32 y = minY; y <= maxY; y++)
+			{
+				for (UINT32 x = minX; x <= maxX; x++)
+					func(y * mHitGridNumCellsX + x);
+			}
+		};
+
+		// Count the elements in each cell, then turn the counts into offsets into the element array
+		UINT32 numCells = mHitGridNumCellsX * mHitGridNumCellsY;
+		mHitGridOffsets.resize(numCells + 1, 0);
+
+		for (auto& elem : mElements)
+		{
+			const Rect2I& elemBounds = elem->_getClippedBounds();
+			if (elemBounds.width == 0 || elemBounds.height == 0)
+				continue;
+
+			forEachOverlappingCell(elemBounds, [this](UINT32 cellIdx) { mHitGridOffsets[cellIdx + 1]++; });
+		}
+
+		for (UINT32 i = 0; i < numCells; i++)
+			mHitGridOffsets[i + 1] += mHitGridOffsets[i];
+
+		mHitGridElements.resize(mHitGridOffsets[numCells]);
+
+		Vector<UINT32> writeIdx(mHitGridOffsets.begin(), mHitGridOffsets.end() - 1);
+		for (auto& elem : mElements)
+		{
+			const Rect2I& elemBounds = elem->_getClippedBounds();
+			if (elemBounds.width == 0 || elemBounds.height == 0)
+				continue;
+
+			forEachOverlappingCell(elemBounds, [this, &writeIdx, elem](UINT32 cellIdx)
+			{
+				mHitGridElements[writeIdx[cellIdx]++] = elem;
+			});
+		}
 	}
 
 	void GUIWidget::ownerTargetResized()
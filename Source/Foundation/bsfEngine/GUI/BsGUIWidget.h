@@ -97,10 +97,10 @@ namespace bs
 		static SPtr<GUIWidget> create(const HCamera& camera);
 
 		/**	Triggered when the widget's viewport size changes. */
-		Event<void()> onOwnerTargetResized;
+		EventST<void()> onOwnerTargetResized;
 
 		/**	Triggered when the parent window gained or lost focus. */
-		Event<void()> onOwnerWindowFocusChanged;
+		EventST<void()> onOwnerWindowFocusChanged;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
@@ -128,11 +128,31 @@ namespace bs
 		void _markMeshDirty(GUIElementBase* elem);
 
 		/**
-		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt (this implies the entire
-		 * widget mesh will be rebuilt as well).
+		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt. If the element's mesh
+		 * layout remains the same only its part of the widget mesh will be updated, otherwise the entire widget mesh will
+		 * be rebuilt.
 		 */
 		void _markContentDirty(GUIElementBase* elem);
 
+		/**
+		 * Returns true if the widget structure or transform changed since the last call to isDirty(), requiring a
+		 * complete rebuild of the widget mesh.
+		 */
+		bool _isMeshDirty() const { return mWidgetIsDirty; }
+
+		/** Returns elements whose contents changed since the last call to isDirty(). */
+		const Set<GUIElement*>& _getDirtyContents() const { return mDirtyContents; }
+
+		/**
+		 * Appends all elements whose clipped bounds might contain the provided position to the output array. Elements are
+		 * output in the same order as in getElements(). This is only a coarse test, the caller is still expected to check
+		 * the returned elements for visibility and exact bounds.
+		 *
+		 * @param[in]	position	Position relative to the widget.
+		 * @param[out]	output		Array to append the elements to.
+		 */
+		void _getElementsNear(const Vector2I& position, Vector<GUIElement*>& output) const;
+
 		/**	Updates the layout of all child elements, repositioning and resizing them as needed. */
 		void _updateLayout();
 
@@ -185,6 +205,12 @@ namespace bs
 		/**	Updates the size of the primary GUI panel based on the viewport. */
 		void updateRootPanel();
 
+		/**
+		 * Rebuilds the grid used for accelerating element lookup by position. Each grid cell references all elements
+		 * whose clipped bounds overlap the cell.
+		 */
+		void updateHitGrid() const;
+
 		SPtr<Camera> mCamera;
 		Vector<GUIElement*> mElements;
 		GUIPanel* mPanel;
@@ -205,6 +231,15 @@ namespace bs
 		mutable bool mWidgetIsDirty;
 		mutable Rect2I mBounds;
 
+		mutable Rect2I mHitGridArea;
+		mutable UINT32 mHitGridNumCellsX = 0;
+		mutable UINT32 mHitGridNumCellsY = 0;
+		mutable UINT32 mHitGridCellWidth = 1;
+		mutable UINT32 mHitGridCellHeight = 1;
+		mutable Vector<UINT32> mHitGridOffsets;
+		mutable Vector<GUIElement*> mHitGridElements;
+		mutable bool mHitGridDirty = true;
+
 		HGUISkin mSkin;
 	};
 
@@ -10,10 +10,13 @@
 #include "GUI/BsGUIElement.h"
 #include "GUI/BsGUILabel.h"
 #include "GUI/BsGUISpace.h"
+#include "GUI/BsGUIManager.h"
 #include "RenderAPI/BsViewport.h"
 #include "Utility/BsTime.h"
 #include "Resources/BsBuiltinResources.h"
 #include "Profiling/BsProfilingManager.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "CoreThread/BsCoreThread.h"
 #include "RenderAPI/BsRenderTarget.h"
 #include "Private/RTTI/BsProfilerOverlayRTTI.h"
 #include "Renderer/BsCamera.h"
@@ -254,7 +257,7 @@ namespace bs
 			rows.resize(curIdx);
 		}
 
-		void addData(const String& name, float timeMs)
+		void addData(const GPUProfileSample& sample)
 		{
 			if (curIdx >= rows.size())
 			{
@@ -263,21 +266,37 @@ namespace bs
 				ProfilerOverlayInternal::GPUSampleRow& newRow = rows.back();
 
 				newRow.disabled = false;
-				newRow.name = HEString(u8"{1}");
+				newRow.name = HEString(u8"{0}");
 				newRow.time = HEString(u8"{0}");
+				newRow.drawCalls = HEString(u8"{0}");
+				newRow.vertices = HEString(u8"{0}");
+				newRow.primitives = HEString(u8"{0}");
+				newRow.samples = HEString(u8"{0}");
 
 				newRow.layout = layout.insertNewElement<GUILayoutX>(layout.getNumChildren());
 
-				newRow.guiName = newRow.layout->addNewElement<GUILabel>(newRow.name, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiName = newRow.layout->addNewElement<GUILabel>(newRow.name, GUIOptions(GUIOption::fixedWidth(150)));
 				newRow.guiTime = newRow.layout->addNewElement<GUILabel>(newRow.time, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiDrawCalls = newRow.layout->addNewElement<GUILabel>(newRow.drawCalls, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiVertices = newRow.layout->addNewElement<GUILabel>(newRow.vertices, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiPrimitives = newRow.layout->addNewElement<GUILabel>(newRow.primitives, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiSamples = newRow.layout->addNewElement<GUILabel>(newRow.samples, GUIOptions(GUIOption::fixedWidth(100)));
 			}
 
 			ProfilerOverlayInternal::GPUSampleRow& row = rows[curIdx];
-			row.name.setParameter(0, name);
-			row.time.setParameter(0, toString(timeMs));
+			row.name.setParameter(0, sample.name);
+			row.time.setParameter(0, toString(sample.timeMs));
+			row.drawCalls.setParameter(0, toString(sample.numDrawCalls));
+			row.vertices.setParameter(0, toString(sample.numVertices));
+			row.primitives.setParameter(0, toString(sample.numPrimitives));
+			row.samples.setParameter(0, toString(sample.numDrawnSamples));
 
 			row.guiName->setContent(row.name);
 			row.guiTime->setContent(row.time);
+			row.guiDrawCalls->setContent(row.drawCalls);
+			row.guiVertices->setContent(row.vertices);
+			row.guiPrimitives->setContent(row.primitives);
+			row.guiSamples->setContent(row.samples);
 
 			if (row.disabled)
 			{
@@ -290,6 +309,7 @@ namespace bs
 	};
 
 	const UINT32 ProfilerOverlayInternal::MAX_DEPTH = 4;
+	const UINT32 ProfilerOverlayInternal::MAX_LOCK_ROWS = 10;
 
 	CProfilerOverlay::CProfilerOverlay()
 	{
@@ -365,6 +385,9 @@ namespace bs
 		if(mWidgetSO)
 			mWidgetSO->destroy();
 
+		mGpuHeapRows.clear();
+		mLockRows.clear();
+
 		mWidgetSO = SceneObject::create("ProfilerOverlay", SOF_Internal | SOF_Persistent | SOF_DontSave);
 		mWidget = mWidgetSO->addComponent<CGUIWidget>(camera);
 		mWidget->setDepth(127);
@@ -451,8 +474,16 @@ namespace bs
 
 		HString gpuSamplesNameStr(u8"__ProfOvGPUSampName", u8"Name");
 		HString gpuSamplesTimeStr(u8"__ProfOvGPUSampTime", u8"Time");
-		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesNameStr, GUIOptions(GUIOption::fixedWidth(100))));
+		HString gpuSamplesDrawCallsStr(u8"__ProfOvGPUSampDrawCalls", u8"Draw calls");
+		HString gpuSamplesVerticesStr(u8"__ProfOvGPUSampVertices", u8"Vertices");
+		HString gpuSamplesPrimitivesStr(u8"__ProfOvGPUSampPrimitives", u8"Primitives");
+		HString gpuSamplesSamplesStr(u8"__ProfOvGPUSampSamples", u8"Samples drawn");
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesNameStr, GUIOptions(GUIOption::fixedWidth(150))));
 		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesTimeStr, GUIOptions(GUIOption::fixedWidth(100))));
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesDrawCallsStr, GUIOptions(GUIOption::fixedWidth(100))));
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesVerticesStr, GUIOptions(GUIOption::fixedWidth(100))));
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesPrimitivesStr, GUIOptions(GUIOption::fixedWidth(100))));
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesSamplesStr, GUIOptions(GUIOption::fixedWidth(100))));
 
 		mGPUFrameNumStr = HEString(u8"__ProfOvFrame", u8"Frame #{0}");
 		mGPUTimeStr = HEString(u8"__ProfOvTime", u8"Time: {0}ms");
@@ -472,6 +503,13 @@ namespace bs
 		mGPUParamBindsStr = HEString(u8"__ProfOvGpuParamBinds", u8"GPU parameter binds: {0}");
 		mGPUVertexBufferBindsStr = HEString(u8"__ProfOvVBBinds", u8"VB binds: {0}");
 		mGPUIndexBufferBindsStr = HEString(u8"__ProfOvIBBinds", u8"IB binds: {0}");
+		mGPURedundantBindsStr = HEString(u8"__ProfOvRedundantBinds", u8"Redundant binds skipped: {0}");
+		mGUIBatchesStr = HEString(u8"__ProfOvGUIBatches", u8"GUI batches: {0}");
+		mCoreCommandsStr = HEString(u8"__ProfOvCoreCommands", u8"Core thread commands: {0}");
+		mCoreQueueDepthStr = HEString(u8"__ProfOvCoreQueueDepth", u8"Max. queue depth: {0}");
+		mCorePlaybackTimeStr = HEString(u8"__ProfOvCorePlayback", u8"Command playback: {0}ms");
+		mCoreBlockingCallsStr = HEString(u8"__ProfOvCoreBlocking", u8"Blocking calls: {0} ({1}ms)");
+		mCoreSlowestCommandStr = HEString(u8"__ProfOvCoreSlowest", u8"Slowest command: {0}ms ({1}:{2})");
 
 		mGPUFrameNumLbl = GUILabel::create(mGPUFrameNumStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUTimeLbl = GUILabel::create(mGPUTimeStr, GUIOptions(GUIOption::fixedWidth(200)));
@@ -491,6 +529,13 @@ namespace bs
 		mGPUParamBindsLbl = GUILabel::create(mGPUParamBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUVertexBufferBindsLbl = GUILabel::create(mGPUVertexBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUIndexBufferBindsLbl = GUILabel::create(mGPUIndexBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mGPURedundantBindsLbl = GUILabel::create(mGPURedundantBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mGUIBatchesLbl = GUILabel::create(mGUIBatchesStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mCoreCommandsLbl = GUILabel::create(mCoreCommandsStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mCoreQueueDepthLbl = GUILabel::create(mCoreQueueDepthStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mCorePlaybackTimeLbl = GUILabel::create(mCorePlaybackTimeStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mCoreBlockingCallsLbl = GUILabel::create(mCoreBlockingCallsStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mCoreSlowestCommandLbl = GUILabel::create(mCoreSlowestCommandStr, GUIOptions(GUIOption::fixedWidth(200)));
 
 		mGPULayoutFrameContentsLeft->addElement(mGPUFrameNumLbl);
 		mGPULayoutFrameContentsLeft->addElement(mGPUTimeLbl);
@@ -511,42 +556,116 @@ namespace bs
 		mGPULayoutFrameContentsRight->addElement(mGPUParamBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUVertexBufferBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUIndexBufferBindsLbl);
+		mGPULayoutFrameContentsRight->addElement(mGPURedundantBindsLbl);
+		mGPULayoutFrameContentsRight->addElement(mGUIBatchesLbl);
+		mGPULayoutFrameContentsRight->addElement(mCoreCommandsLbl);
+		mGPULayoutFrameContentsRight->addElement(mCoreQueueDepthLbl);
+		mGPULayoutFrameContentsRight->addElement(mCorePlaybackTimeLbl);
+		mGPULayoutFrameContentsRight->addElement(mCoreBlockingCallsLbl);
+		mGPULayoutFrameContentsRight->addElement(mCoreSlowestCommandLbl);
 		mGPULayoutFrameContentsRight->addNewElement<GUIFlexibleSpace>();
 
+		// Set up memory area
+		mMemoryLayout = mWidget->getPanel()->addNewElement<GUILayoutY>();
+
+		GUILayout* memoryTitleRow = mMemoryLayout->addNewElement<GUILayoutX>();
+		memoryTitleRow->addElement(GUILabel::create(HEString(u8"Category"), GUIOptions(GUIOption::fixedWidth(100))));
+		memoryTitleRow->addElement(GUILabel::create(HEString(u8"Live"), GUIOptions(GUIOption::fixedWidth(80))));
+		memoryTitleRow->addElement(GUILabel::create(HEString(u8"Peak"), GUIOptions(GUIOption::fixedWidth(80))));
+		memoryTitleRow->addElement(GUILabel::create(HEString(u8"Budget"), GUIOptions(GUIOption::fixedWidth(80))));
+		memoryTitleRow->addElement(GUILabel::create(HEString(u8"Alloc. / frame"), GUIOptions(GUIOption::fixedWidth(80))));
+		memoryTitleRow->addElement(GUILabel::create(HEString(u8"Freed / frame"), GUIOptions(GUIOption::fixedWidth(80))));
+		memoryTitleRow->addElement(GUILabel::create(HEString(u8"# allocs"), GUIOptions(GUIOption::fixedWidth(50))));
+		memoryTitleRow->addElement(GUILabel::create(HEString(u8"# frees"), GUIOptions(GUIOption::fixedWidth(50))));
+
+		for(UINT32 i = 0; i < (UINT32)MemoryCategory::Count; i++)
+			createMemoryRow(mMemoryRows[i], MemAllocProfiler::getCategoryName((MemoryCategory)i));
+
+		mMemoryLayout->addNewElement<GUIFixedSpace>(10);
+
+		GUILayout* gpuMemoryTitleRow = mMemoryLayout->addNewElement<GUILayoutX>();
+		gpuMemoryTitleRow->addElement(GUILabel::create(HEString(u8"GPU category"), GUIOptions(GUIOption::fixedWidth(100))));
+		gpuMemoryTitleRow->addElement(GUILabel::create(HEString(u8"Live"), GUIOptions(GUIOption::fixedWidth(80))));
+		gpuMemoryTitleRow->addElement(GUILabel::create(HEString(u8"Peak"), GUIOptions(GUIOption::fixedWidth(80))));
+		gpuMemoryTitleRow->addElement(GUILabel::create(HEString(u8"Budget"), GUIOptions(GUIOption::fixedWidth(80))));
+		gpuMemoryTitleRow->addElement(GUILabel::create(HEString(u8"Alloc. / frame"), GUIOptions(GUIOption::fixedWidth(80))));
+		gpuMemoryTitleRow->addElement(GUILabel::create(HEString(u8"Freed / frame"), GUIOptions(GUIOption::fixedWidth(80))));
+		gpuMemoryTitleRow->addElement(GUILabel::create(HEString(u8"# allocs"), GUIOptions(GUIOption::fixedWidth(50))));
+		gpuMemoryTitleRow->addElement(GUILabel::create(HEString(u8"# frees"), GUIOptions(GUIOption::fixedWidth(50))));
+
+		for(UINT32 i = 0; i < (UINT32)GpuMemoryCategory::Count; i++)
+			createMemoryRow(mGpuMemoryRows[i], GpuMemoryProfiler::getCategoryName((GpuMemoryCategory)i));
+
+		mMemoryLayout->addNewElement<GUIFixedSpace>(10);
+
+		GUILayout* gpuHeapTitleRow = mMemoryLayout->addNewElement<GUILayoutX>();
+		gpuHeapTitleRow->addElement(GUILabel::create(HEString(u8"GPU heap"), GUIOptions(GUIOption::fixedWidth(100))));
+		gpuHeapTitleRow->addElement(GUILabel::create(HEString(u8"Used"), GUIOptions(GUIOption::fixedWidth(80))));
+		gpuHeapTitleRow->addElement(GUILabel::create(HEString(u8"Size"), GUIOptions(GUIOption::fixedWidth(80))));
+		gpuHeapTitleRow->addElement(GUILabel::create(HEString(u8"# allocs"), GUIOptions(GUIOption::fixedWidth(50))));
+
+		// Heap rows are added on first update, as the number of heaps is only known once queried from the render API
+		mGpuHeapLayout = mMemoryLayout->addNewElement<GUILayoutY>();
+
+		mMemoryLayout->addNewElement<GUIFlexibleSpace>();
+
+		// Set up lock area
+		mLockLayout = mWidget->getPanel()->addNewElement<GUILayoutY>();
+
+		GUILayout* lockTitleRow = mLockLayout->addNewElement<GUILayoutX>();
+		lockTitleRow->addElement(GUILabel::create(HEString(u8"Lock"), GUIOptions(GUIOption::fixedWidth(200))));
+		lockTitleRow->addElement(GUILabel::create(HEString(u8"# acquired"), GUIOptions(GUIOption::fixedWidth(80))));
+		lockTitleRow->addElement(GUILabel::create(HEString(u8"# contended"), GUIOptions(GUIOption::fixedWidth(80))));
+		lockTitleRow->addElement(GUILabel::create(HEString(u8"Wait time"), GUIOptions(GUIOption::fixedWidth(80))));
+		lockTitleRow->addElement(GUILabel::create(HEString(u8"Max. wait"), GUIOptions(GUIOption::fixedWidth(80))));
+
+		mLockRows.resize(MAX_LOCK_ROWS);
+		for(auto& row : mLockRows)
+		{
+			row.acquisitions = HEString(u8"{0}");
+			row.contentions = HEString(u8"{0}");
+			row.waitTime = HEString(u8"{0} us");
+			row.maxWaitTime = HEString(u8"{0} us");
+
+			row.layout = mLockLayout->addNewElement<GUILayoutX>();
+			row.guiName = row.layout->addNewElement<GUILabel>(HEString(u8""), GUIOptions(GUIOption::fixedWidth(200)));
+			row.guiAcquisitions = row.layout->addNewElement<GUILabel>(row.acquisitions,
+				GUIOptions(GUIOption::fixedWidth(80)));
+			row.guiContentions = row.layout->addNewElement<GUILabel>(row.contentions,
+				GUIOptions(GUIOption::fixedWidth(80)));
+			row.guiWaitTime = row.layout->addNewElement<GUILabel>(row.waitTime, GUIOptions(GUIOption::fixedWidth(80)));
+			row.guiMaxWaitTime = row.layout->addNewElement<GUILabel>(row.maxWaitTime,
+				GUIOptions(GUIOption::fixedWidth(80)));
+		}
+
+		mLockLayout->addNewElement<GUIFlexibleSpace>();
+
 		updateCPUSampleAreaSizes();
 		updateGPUSampleAreaSizes();
+		updateMemoryAreaSizes();
+		updateLockAreaSizes();
 
 		if (!mIsShown)
 			hide();
 		else
-		{
-			if (mType == ProfilerOverlayType::CPUSamples)
-				show(ProfilerOverlayType::CPUSamples);
-			else
-				show(ProfilerOverlayType::GPUSamples);
-		}
+			show(mType);
 	}
 
 	void ProfilerOverlayInternal::show(ProfilerOverlayType type)
 	{
-		if (type == ProfilerOverlayType::CPUSamples)
-		{
-			mBasicLayoutLabels->setVisible(true);
-			mPreciseLayoutLabels->setVisible(true);
-			mBasicLayoutContents->setVisible(true);
-			mPreciseLayoutContents->setVisible(true);
-			mGPULayoutFrameContents->setVisible(false);
-			mGPULayoutSamples->setVisible(false);
-		}
-		else
-		{
-			mGPULayoutFrameContents->setVisible(true);
-			mGPULayoutSamples->setVisible(true);
-			mBasicLayoutLabels->setVisible(false);
-			mPreciseLayoutLabels->setVisible(false);
-			mBasicLayoutContents->setVisible(false);
-			mPreciseLayoutContents->setVisible(false);
-		}
+		const bool showCPU = type == ProfilerOverlayType::CPUSamples;
+		const bool showGPU = type == ProfilerOverlayType::GPUSamples;
+		const bool showMemory = type == ProfilerOverlayType::Memory;
+		const bool showLocks = type == ProfilerOverlayType::Locks;
+
+		mBasicLayoutLabels->setVisible(showCPU);
+		mPreciseLayoutLabels->setVisible(showCPU);
+		mBasicLayoutContents->setVisible(showCPU);
+		mPreciseLayoutContents->setVisible(showCPU);
+		mGPULayoutFrameContents->setVisible(showGPU);
+		mGPULayoutSamples->setVisible(showGPU);
+		mMemoryLayout->setVisible(showMemory);
+		mLockLayout->setVisible(showLocks);
 
 		mType = type;
 		mIsShown = true;
@@ -560,6 +679,8 @@ namespace bs
 		mPreciseLayoutContents->setVisible(false);
 		mGPULayoutFrameContents->setVisible(false);
 		mGPULayoutSamples->setVisible(false);
+		mMemoryLayout->setVisible(false);
+		mLockLayout->setVisible(false);
 		mIsShown = false;
 	}
 
@@ -569,6 +690,8 @@ namespace bs
 		const ProfilerReport& latestCoreReport = ProfilingManager::instance().getReport(ProfiledThread::Core);
 
 		updateCPUSampleContents(latestSimReport, latestCoreReport);
+		updateMemoryContents(latestSimReport.memoryReport, latestSimReport.gpuMemoryReport);
+		updateLockContents(latestSimReport.lockReport);
 
 		while (ProfilerGPU::instance().getNumAvailableReports() > 1)
 			ProfilerGPU::instance().getNextReport(); // Drop any extra reports, we only want the latest
@@ -583,6 +706,8 @@ namespace bs
 	{
 		updateCPUSampleAreaSizes();
 		updateGPUSampleAreaSizes();
+		updateMemoryAreaSizes();
+		updateLockAreaSizes();
 	}
 
 	void ProfilerOverlayInternal::updateCPUSampleAreaSizes()
@@ -633,6 +758,30 @@ namespace bs
 		mGPULayoutSamples->setHeight(samplesHeight);
 	}
 
+	void ProfilerOverlayInternal::updateMemoryAreaSizes()
+	{
+		static const INT32 PADDING = 10;
+
+		UINT32 width = (UINT32)std::max(0, (INT32)mTarget->getPixelArea().width - PADDING * 2);
+		UINT32 height = (UINT32)std::max(0, (INT32)(mTarget->getPixelArea().height - PADDING * 2));
+
+		mMemoryLayout->setPosition(PADDING, PADDING);
+		mMemoryLayout->setWidth(width);
+		mMemoryLayout->setHeight(height);
+	}
+
+	void ProfilerOverlayInternal::updateLockAreaSizes()
+	{
+		static const INT32 PADDING = 10;
+
+		UINT32 width = (UINT32)std::max(0, (INT32)mTarget->getPixelArea().width - PADDING * 2);
+		UINT32 height = (UINT32)std::max(0, (INT32)(mTarget->getPixelArea().height - PADDING * 2));
+
+		mLockLayout->setPosition(PADDING, PADDING);
+		mLockLayout->setWidth(width);
+		mLockLayout->setHeight(height);
+	}
+
 	void ProfilerOverlayInternal::updateCPUSampleContents(const ProfilerReport& simReport, const ProfilerReport& coreReport)
 	{
 		static const UINT32 NUM_ROOT_ENTRIES = 2;
@@ -744,6 +893,26 @@ namespace bs
 		mGPUParamBindsStr.setParameter(0, toString(gpuReport.frameSample.numGpuParamBinds));
 		mGPUVertexBufferBindsStr.setParameter(0, toString(gpuReport.frameSample.numVertexBufferBinds));
 		mGPUIndexBufferBindsStr.setParameter(0, toString(gpuReport.frameSample.numIndexBufferBinds));
+		mGPURedundantBindsStr.setParameter(0, toString(gpuReport.frameSample.numRedundantBindsSkipped));
+		mGUIBatchesStr.setParameter(0, toString(GUIManager::instance().getNumBatches()));
+
+		// Core thread statistics cover the last full sim thread frame
+		const CoreThreadFrameStats& coreThreadStats = gCoreThread().getFrameStats();
+
+		UINT32 numCoreCommands = coreThreadStats.numInternalCommands;
+		for (auto& entry : coreThreadStats.threadQueues)
+			numCoreCommands += entry.numCommands;
+
+		const CommandTiming& slowestCommand = coreThreadStats.slowestCommands[0];
+
+		mCoreCommandsStr.setParameter(0, toString(numCoreCommands));
+		mCoreQueueDepthStr.setParameter(0, toString(coreThreadStats.maxQueueDepth));
+		mCorePlaybackTimeStr.setParameter(0, toString(coreThreadStats.playbackTimeMs));
+		mCoreBlockingCallsStr.setParameter(0, toString(coreThreadStats.numBlockingCalls));
+		mCoreBlockingCallsStr.setParameter(1, toString(coreThreadStats.blockedTimeMs));
+		mCoreSlowestCommandStr.setParameter(0, toString(slowestCommand.timeMs));
+		mCoreSlowestCommandStr.setParameter(1, toString((INT32)slowestCommand.queueIdx));
+		mCoreSlowestCommandStr.setParameter(2, toString((INT32)slowestCommand.commandIdx));
 
 		mGPUFrameNumLbl->setContent(mGPUFrameNumStr);
 		mGPUTimeLbl->setContent(mGPUTimeStr);
@@ -763,11 +932,129 @@ namespace bs
 		mGPUParamBindsLbl->setContent(mGPUParamBindsStr);
 		mGPUVertexBufferBindsLbl->setContent(mGPUVertexBufferBindsStr);
 		mGPUIndexBufferBindsLbl->setContent(mGPUIndexBufferBindsStr);
+		mGPURedundantBindsLbl->setContent(mGPURedundantBindsStr);
+		mGUIBatchesLbl->setContent(mGUIBatchesStr);
+		mCoreCommandsLbl->setContent(mCoreCommandsStr);
+		mCoreQueueDepthLbl->setContent(mCoreQueueDepthStr);
+		mCorePlaybackTimeLbl->setContent(mCorePlaybackTimeStr);
+		mCoreBlockingCallsLbl->setContent(mCoreBlockingCallsStr);
+		mCoreSlowestCommandLbl->setContent(mCoreSlowestCommandStr);
 
 		GPUSampleRowFiller sampleRowFiller(mGPUSampleRows, *mGPULayoutSampleContents, *mWidget->_getInternal());
 		for (auto& sample : gpuReport.samples)
 		{
-			sampleRowFiller.addData(sample.name, sample.timeMs);
+			sampleRowFiller.addData(sample);
 		}
 	}
+
+	void ProfilerOverlayInternal::updateMemoryContents(const MemoryProfilerReport& memoryReport,
+		const GpuMemoryReport& gpuMemoryReport)
+	{
+		for(UINT32 i = 0; i < (UINT32)MemoryCategory::Count; i++)
+			updateMemoryRow(mMemoryRows[i], memoryReport.categories[i]);
+
+		for(UINT32 i = 0; i < (UINT32)GpuMemoryCategory::Count; i++)
+			updateMemoryRow(mGpuMemoryRows[i], gpuMemoryReport.categories[i]);
+
+		const GpuMemoryStats gpuMemoryStats = ct::RenderAPI::instance().getGpuMemoryStats();
+		for(UINT32 i = 0; i < (UINT32)gpuMemoryStats.heaps.size(); i++)
+		{
+			const GpuMemoryHeapStats& heap = gpuMemoryStats.heaps[i];
+
+			if(i >= (UINT32)mGpuHeapRows.size())
+			{
+				mGpuHeapRows.push_back(GpuHeapRow());
+				GpuHeapRow& newRow = mGpuHeapRows.back();
+
+				newRow.used = HEString(u8"{0} KB");
+				newRow.size = HEString(u8"{0} KB");
+				newRow.numAllocs = HEString(u8"{0}");
+
+				String name = "Heap " + toString(i) + (heap.deviceLocal ? " (device)" : " (system)");
+
+				newRow.layout = mGpuHeapLayout->addNewElement<GUILayoutX>();
+				newRow.guiName = newRow.layout->addNewElement<GUILabel>(HEString(name),
+					GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiUsed = newRow.layout->addNewElement<GUILabel>(newRow.used, GUIOptions(GUIOption::fixedWidth(80)));
+				newRow.guiSize = newRow.layout->addNewElement<GUILabel>(newRow.size, GUIOptions(GUIOption::fixedWidth(80)));
+				newRow.guiNumAllocs = newRow.layout->addNewElement<GUILabel>(newRow.numAllocs,
+					GUIOptions(GUIOption::fixedWidth(50)));
+			}
+
+			GpuHeapRow& row = mGpuHeapRows[i];
+			row.used.setParameter(0, toString(heap.usedBytes / 1024));
+			row.size.setParameter(0, toString(heap.size / 1024));
+			row.numAllocs.setParameter(0, toString(heap.numAllocations));
+
+			row.guiUsed->setContent(row.used);
+			row.guiSize->setContent(row.size);
+			row.guiNumAllocs->setContent(row.numAllocs);
+		}
+	}
+
+	void ProfilerOverlayInternal::updateLockContents(const LockProfilerReport& lockReport)
+	{
+		for(UINT32 i = 0; i < (UINT32)mLockRows.size(); i++)
+		{
+			LockRow& row = mLockRows[i];
+			if(i >= (UINT32)lockReport.locks.size())
+			{
+				row.layout->setVisible(false);
+				continue;
+			}
+
+			const LockContentionReport& entry = lockReport.locks[i];
+			row.acquisitions.setParameter(0, toString(entry.numAcquisitions));
+			row.contentions.setParameter(0, toString(entry.numContentions));
+			row.waitTime.setParameter(0, toString(entry.waitTimeUs));
+			row.maxWaitTime.setParameter(0, toString(entry.maxWaitTimeUs));
+
+			row.guiName->setContent(GUIContent(HEString(entry.name)));
+			row.guiAcquisitions->setContent(row.acquisitions);
+			row.guiContentions->setContent(row.contentions);
+			row.guiWaitTime->setContent(row.waitTime);
+			row.guiMaxWaitTime->setContent(row.maxWaitTime);
+			row.layout->setVisible(true);
+		}
+	}
+
+	void ProfilerOverlayInternal::createMemoryRow(MemoryRow& row, const char* name)
+	{
+		row.live = HEString(u8"{0} KB");
+		row.peak = HEString(u8"{0} KB");
+		row.budget = HEString(u8"{0} KB");
+		row.allocated = HEString(u8"{0} KB");
+		row.freed = HEString(u8"{0} KB");
+		row.numAllocs = HEString(u8"{0}");
+		row.numFrees = HEString(u8"{0}");
+
+		row.layout = mMemoryLayout->addNewElement<GUILayoutX>();
+		row.guiName = row.layout->addNewElement<GUILabel>(HEString(name), GUIOptions(GUIOption::fixedWidth(100)));
+		row.guiLive = row.layout->addNewElement<GUILabel>(row.live, GUIOptions(GUIOption::fixedWidth(80)));
+		row.guiPeak = row.layout->addNewElement<GUILabel>(row.peak, GUIOptions(GUIOption::fixedWidth(80)));
+		row.guiBudget = row.layout->addNewElement<GUILabel>(row.budget, GUIOptions(GUIOption::fixedWidth(80)));
+		row.guiAllocated = row.layout->addNewElement<GUILabel>(row.allocated, GUIOptions(GUIOption::fixedWidth(80)));
+		row.guiFreed = row.layout->addNewElement<GUILabel>(row.freed, GUIOptions(GUIOption::fixedWidth(80)));
+		row.guiNumAllocs = row.layout->addNewElement<GUILabel>(row.numAllocs, GUIOptions(GUIOption::fixedWidth(50)));
+		row.guiNumFrees = row.layout->addNewElement<GUILabel>(row.numFrees, GUIOptions(GUIOption::fixedWidth(50)));
+	}
+
+	void ProfilerOverlayInternal::updateMemoryRow(MemoryRow& row, const MemoryCategoryReport& entry)
+	{
+		row.live.setParameter(0, toString(entry.liveBytes / 1024));
+		row.peak.setParameter(0, toString(entry.peakBytes / 1024));
+		row.budget.setParameter(0, toString(entry.budgetBytes / 1024));
+		row.allocated.setParameter(0, toString(entry.bytesAllocated / 1024));
+		row.freed.setParameter(0, toString(entry.bytesFreed / 1024));
+		row.numAllocs.setParameter(0, toString(entry.numAllocs));
+		row.numFrees.setParameter(0, toString(entry.numFrees));
+
+		row.guiLive->setContent(row.live);
+		row.guiPeak->setContent(row.peak);
+		row.guiBudget->setContent(row.budget);
+		row.guiAllocated->setContent(row.allocated);
+		row.guiFreed->setContent(row.freed);
+		row.guiNumAllocs->setContent(row.numAllocs);
+		row.guiNumFrees->setContent(row.numFrees);
+	}
 }
\ No newline at end of file
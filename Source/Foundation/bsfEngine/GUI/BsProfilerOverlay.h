@@ -5,6 +5,8 @@
 #include "BsPrerequisites.h"
 #include "Scene/BsComponent.h"
 #include "Profiling/BsProfilerGPU.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
+#include "Threading/BsLockProfiler.h"
 #include "Utility/BsModule.h"
 #include "Utility/BsEvent.h"
 
@@ -20,7 +22,9 @@ namespace bs
 	enum class ProfilerOverlayType
 	{
 		CPUSamples,
-		GPUSamples
+		GPUSamples,
+		Memory,
+		Locks
 	};
 
 	/**
@@ -132,13 +136,76 @@ namespace bs
 
 			GUILabel* guiName;
 			GUILabel* guiTime;
+			GUILabel* guiDrawCalls;
+			GUILabel* guiVertices;
+			GUILabel* guiPrimitives;
+			GUILabel* guiSamples;
 
 			HString name;
 			HString time;
+			HString drawCalls;
+			HString vertices;
+			HString primitives;
+			HString samples;
 
 			bool disabled;
 		};
 
+		/**	Holds data about GUI elements in a single row of memory category statistics. */
+		struct MemoryRow
+		{
+			GUILayout* layout;
+
+			GUILabel* guiName;
+			GUILabel* guiLive;
+			GUILabel* guiPeak;
+			GUILabel* guiBudget;
+			GUILabel* guiAllocated;
+			GUILabel* guiFreed;
+			GUILabel* guiNumAllocs;
+			GUILabel* guiNumFrees;
+
+			HString live;
+			HString peak;
+			HString budget;
+			HString allocated;
+			HString freed;
+			HString numAllocs;
+			HString numFrees;
+		};
+
+		/**	Holds data about GUI elements in a single row of GPU memory heap statistics. */
+		struct GpuHeapRow
+		{
+			GUILayout* layout;
+
+			GUILabel* guiName;
+			GUILabel* guiUsed;
+			GUILabel* guiSize;
+			GUILabel* guiNumAllocs;
+
+			HString used;
+			HString size;
+			HString numAllocs;
+		};
+
+		/**	Holds data about GUI elements in a single row of lock contention statistics. */
+		struct LockRow
+		{
+			GUILayout* layout;
+
+			GUILabel* guiName;
+			GUILabel* guiAcquisitions;
+			GUILabel* guiContentions;
+			GUILabel* guiWaitTime;
+			GUILabel* guiMaxWaitTime;
+
+			HString acquisitions;
+			HString contentions;
+			HString waitTime;
+			HString maxWaitTime;
+		};
+
 	public:
 		/**	Constructs a new overlay attached to the specified parent and displayed on the provided camera. */
 		ProfilerOverlayInternal(const SPtr<Camera>& target);
@@ -165,6 +232,12 @@ namespace bs
 		/** Updates sizes of GUI areas used for displaying GPU sample data. To be called after viewport change or resize. */
 		void updateGPUSampleAreaSizes();
 
+		/** Updates sizes of GUI areas used for displaying memory data. To be called after viewport change or resize. */
+		void updateMemoryAreaSizes();
+
+		/** Updates sizes of GUI areas used for displaying lock data. To be called after viewport change or resize. */
+		void updateLockAreaSizes();
+
 		/**
 		 * Updates CPU GUI elements from the data in the provided profiler reports. To be called whenever a new report is 
 		 * received.
@@ -177,7 +250,26 @@ namespace bs
 		 */
 		void updateGPUSampleContents(const GPUProfilerReport& gpuReport);
 
+		/**
+		 * Updates memory GUI elements from the data in the provided profiler reports, and from the GPU memory heap
+		 * statistics reported by the render API. To be called whenever a new report is received.
+		 */
+		void updateMemoryContents(const MemoryProfilerReport& memoryReport, const GpuMemoryReport& gpuMemoryReport);
+
+		/**
+		 * Updates lock GUI elements from the data in the provided profiler report, displaying the most contended locks.
+		 * To be called whenever a new report is received.
+		 */
+		void updateLockContents(const LockProfilerReport& lockReport);
+
+		/** Creates GUI elements for a new memory category row and appends them to the memory area. */
+		void createMemoryRow(MemoryRow& row, const char* name);
+
+		/** Updates the GUI elements of a memory category row from the provided statistics. */
+		void updateMemoryRow(MemoryRow& row, const MemoryCategoryReport& entry);
+
 		static const UINT32 MAX_DEPTH;
+		static const UINT32 MAX_LOCK_ROWS;
 
 		ProfilerOverlayType mType;
 		SPtr<Viewport> mTarget;
@@ -234,6 +326,13 @@ namespace bs
 		GUILabel* mGPUParamBindsLbl;
 		GUILabel* mGPUVertexBufferBindsLbl;
 		GUILabel* mGPUIndexBufferBindsLbl;
+		GUILabel* mGPURedundantBindsLbl;
+		GUILabel* mGUIBatchesLbl;
+		GUILabel* mCoreCommandsLbl;
+		GUILabel* mCoreQueueDepthLbl;
+		GUILabel* mCorePlaybackTimeLbl;
+		GUILabel* mCoreBlockingCallsLbl;
+		GUILabel* mCoreSlowestCommandLbl;
 
 		HString mGPUFrameNumStr;
 		HString mGPUTimeStr;
@@ -253,6 +352,22 @@ namespace bs
 		HString mGPUParamBindsStr;
 		HString mGPUVertexBufferBindsStr;
 		HString mGPUIndexBufferBindsStr;
+		HString mGPURedundantBindsStr;
+		HString mGUIBatchesStr;
+		HString mCoreCommandsStr;
+		HString mCoreQueueDepthStr;
+		HString mCorePlaybackTimeStr;
+		HString mCoreBlockingCallsStr;
+		HString mCoreSlowestCommandStr;
+
+		GUILayout* mMemoryLayout = nullptr;
+		MemoryRow mMemoryRows[(UINT32)MemoryCategory::Count];
+		MemoryRow mGpuMemoryRows[(UINT32)GpuMemoryCategory::Count];
+		GUILayout* mGpuHeapLayout = nullptr;
+		Vector<GpuHeapRow> mGpuHeapRows;
+
+		GUILayout* mLockLayout = nullptr;
+		Vector<LockRow> mLockRows;
 
 		Vector<BasicRow> mBasicRows;
 		Vector<PreciseRow> mPreciseRows;
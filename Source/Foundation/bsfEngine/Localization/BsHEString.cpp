@@ -19,6 +19,12 @@ namespace bs
 		
 	}
 
+	HEString::HEString(LocalizedStringID id)
+		: mInternal(id, ENGINE_STRING_TABLE_ID)
+	{
+
+	}
+
 	HEString::HEString()
 		: mInternal(ENGINE_STRING_TABLE_ID)
 	{
@@ -35,6 +35,13 @@ namespace bs
 		 */
 		HEString(const String& identifier, const String& defaultString);
 
+		/**
+		 * Creates a new localized string referencing a string in the compiled engine string table.
+		 *
+		 * @param[in]	id				Hashed identifier of the string, usually created through BS_LOCALIZED_ID.
+		 */
+		explicit HEString(LocalizedStringID id);
+
 		/**	Creates a new empty localized string in the engine string table. */
 		HEString();
 
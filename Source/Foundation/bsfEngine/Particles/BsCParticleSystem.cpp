@@ -0,0 +1,47 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Particles/BsCParticleSystem.h"
+#include "Particles/BsParticleSystemManager.h"
+#include "Private/RTTI/BsCParticleSystemRTTI.h"
+
+namespace bs
+{
+	CParticleSystem::CParticleSystem()
+	{
+		setName("ParticleSystem");
+	}
+
+	CParticleSystem::CParticleSystem(const HSceneObject& parent)
+		: Component(parent)
+	{
+		setName("ParticleSystem");
+	}
+
+	void CParticleSystem::setEmitter(const HParticleEmitter& emitter)
+	{
+		mEmitter = emitter;
+
+		// Particles spawned by the previous emitter no longer make sense
+		mClearRequested = true;
+	}
+
+	void CParticleSystem::onEnabled()
+	{
+		ParticleSystemManager::instance()._registerSystem(this);
+	}
+
+	void CParticleSystem::onDisabled()
+	{
+		ParticleSystemManager::instance()._unregisterSystem(this);
+	}
+
+	RTTITypeBase* CParticleSystem::getRTTIStatic()
+	{
+		return CParticleSystemRTTI::instance();
+	}
+
+	RTTITypeBase* CParticleSystem::getRTTI() const
+	{
+		return CParticleSystem::getRTTIStatic();
+	}
+}
@@ -0,0 +1,99 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Scene/BsComponent.h"
+#include "Particles/BsParticleEmitter.h"
+
+namespace bs
+{
+	/** @addtogroup Particles
+	 *  @{
+	 */
+
+	/** 
+	 * Spawns, simulates and renders particles as described by a ParticleEmitter, positioned and oriented by the parent
+	 * scene object. All particle data lives on the GPU, and is simulated and rendered through ParticleSystemManager.
+	 */
+	class BS_EXPORT CParticleSystem : public Component
+	{
+	public:
+		CParticleSystem(const HSceneObject& parent);
+		virtual ~CParticleSystem() = default;
+
+		/** Determines the emitter describing how are the particles spawned, simulated and rendered. */
+		void setEmitter(const HParticleEmitter& emitter);
+
+		/** @copydoc setEmitter */
+		const HParticleEmitter& getEmitter() const { return mEmitter; }
+
+		/** 
+		 * Determines if the system spawns new particles. Particles that are already alive continue being simulated
+		 * until their lifetime expires.
+		 */
+		void setEmitting(bool emitting) { mEmitting = emitting; }
+
+		/** @copydoc setEmitting */
+		bool getEmitting() const { return mEmitting; }
+
+		/** 
+		 * Determines the layer bitfield that controls whether the system is considered visible in a specific camera.
+		 * Layer must match camera layer in order for the camera to render the particles.
+		 */
+		void setLayer(UINT64 layer) { mLayer = layer; }
+
+		/** @copydoc setLayer */
+		UINT64 getLayer() const { return mLayer; }
+
+		/** Removes all currently alive particles. */
+		void clear() { mClearRequested = true; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns an identifier uniquely identifying this system while it is registered with the manager. */
+		UINT32 _getId() const { return mId; }
+
+		/** Assigns an identifier uniquely identifying this system while it is registered with the manager. */
+		void _setId(UINT32 id) { mId = id; }
+
+		/** Returns true if the alive particles should be removed, and resets the request. */
+		bool _consumeClearRequest() { bool value = mClearRequested; mClearRequested = false; return value; }
+
+		/** @} */
+	protected:
+		HParticleEmitter mEmitter;
+		bool mEmitting = true;
+		UINT64 mLayer = 1;
+
+		UINT32 mId = 0;
+		bool mClearRequested = false;
+
+		/************************************************************************/
+		/* 						COMPONENT OVERRIDES                      		*/
+		/************************************************************************/
+	protected:
+		friend class SceneObject;
+
+		/** @copydoc Component::onEnabled */
+		void onEnabled() override;
+
+		/** @copydoc Component::onDisabled */
+		void onDisabled() override;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class CParticleSystemRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+
+	protected:
+		CParticleSystem(); // Serialization only
+	};
+
+	/** @} */
+}
@@ -0,0 +1,51 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Particles/BsParticleEmitter.h"
+#include "Resources/BsResources.h"
+#include "Image/BsTexture.h"
+#include "Private/RTTI/BsParticleEmitterRTTI.h"
+
+namespace bs
+{
+	ParticleEmitter::ParticleEmitter(const PARTICLE_EMITTER_DESC& desc, const HTexture& texture)
+		:Resource(false), mDesc(desc), mTexture(texture)
+	{ }
+
+	void ParticleEmitter::setTexture(const HTexture& texture)
+	{
+		mTexture = texture;
+
+		markDependenciesDirty();
+	}
+
+	void ParticleEmitter::getResourceDependencies(FrameVector<HResource>& dependencies) const
+	{
+		if (mTexture != nullptr)
+			dependencies.push_back(mTexture);
+	}
+
+	HParticleEmitter ParticleEmitter::create(const PARTICLE_EMITTER_DESC& desc, const HTexture& texture)
+	{
+		return static_resource_cast<ParticleEmitter>(gResources()._createResourceHandle(_createPtr(desc, texture)));
+	}
+
+	SPtr<ParticleEmitter> ParticleEmitter::_createPtr(const PARTICLE_EMITTER_DESC& desc, const HTexture& texture)
+	{
+		SPtr<ParticleEmitter> emitterPtr = bs_core_ptr<ParticleEmitter>(
+			new (bs_alloc<ParticleEmitter>()) ParticleEmitter(desc, texture));
+		emitterPtr->_setThisPtr(emitterPtr);
+		emitterPtr->initialize();
+
+		return emitterPtr;
+	}
+
+	RTTITypeBase* ParticleEmitter::getRTTIStatic()
+	{
+		return ParticleEmitterRTTI::instance();
+	}
+
+	RTTITypeBase* ParticleEmitter::getRTTI() const
+	{
+		return ParticleEmitter::getRTTIStatic();
+	}
+}
@@ -0,0 +1,129 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Resources/BsResource.h"
+#include "Math/BsVector2.h"
+#include "Math/BsVector3.h"
+#include "Math/BsDegree.h"
+#include "Image/BsColor.h"
+
+namespace bs
+{
+	/** @addtogroup Particles
+	 *  @{
+	 */
+
+	/** 
+	 * Determines how are particles of a ParticleEmitter spawned and simulated. Values provided as a Vector2 represent a
+	 * range, with x being the minimum and y the maximum. A value within the range is randomly chosen for each particle.
+	 */
+	struct PARTICLE_EMITTER_DESC
+	{
+		/** 
+		 * Maximum number of particles that can be alive at once. Once the limit is reached new particles replace the
+		 * oldest ones. Should be at least the emission rate multiplied by the maximum lifetime.
+		 */
+		UINT32 maxParticles = 10000;
+
+		/** Number of particles spawned per second. */
+		float emissionRate = 1000.0f;
+
+		/** Range of time a particle stays alive for, in seconds. */
+		Vector2 lifetime = Vector2(1.0f, 2.0f);
+
+		/** Range of the initial speed of a particle, in meters per second. */
+		Vector2 speed = Vector2(1.0f, 2.0f);
+
+		/** Range of the width and height of a particle, in meters. */
+		Vector2 size = Vector2(0.05f, 0.1f);
+
+		/** Angle of the cone around the emitter's local Y axis in which particles are emitted in. */
+		Degree coneAngle = Degree(30.0f);
+
+		/** Radius of the sphere around the emitter's origin in which particles are spawned in. */
+		float shapeRadius = 0.0f;
+
+		/** Color of a particle when it is spawned. */
+		Color startColor = Color::White;
+
+		/** Color of a particle at the end of its lifetime. Color is linearly interpolated over the lifetime. */
+		Color endColor = Color(1.0f, 1.0f, 1.0f, 0.0f);
+
+		/** Acceleration applied to all particles, in world space. */
+		Vector3 gravity = Vector3(0.0f, -9.81f, 0.0f);
+
+		/** Determines how quickly do particles lose their velocity. Zero means velocity is never lost. */
+		float drag = 0.0f;
+
+		/** If true particles will collide with opaque scene geometry visible in the scene depth buffer. */
+		bool collide = false;
+
+		/** 
+		 * Portion of the velocity along the surface normal a particle retains after a collision, in [0, 1] range. Only 
+		 * relevant if collision is enabled.
+		 */
+		float bounce = 0.5f;
+
+		/** 
+		 * If true particles will be sorted back to front relative to the camera before they are rendered. Required for
+		 * correct blending, but adds a GPU cost proportional to the particle count.
+		 */
+		bool sort = false;
+	};
+
+	/** 
+	 * Resource describing how are particles of a particle system spawned, simulated and rendered. Any number of
+	 * particle systems can share a single emitter.
+	 */
+	class BS_EXPORT ParticleEmitter : public Resource
+	{
+	public:
+		/** Returns the properties determining how are particles spawned and simulated. */
+		const PARTICLE_EMITTER_DESC& getDesc() const { return mDesc; }
+
+		/** Changes the properties determining how are particles spawned and simulated. */
+		void setDesc(const PARTICLE_EMITTER_DESC& desc) { mDesc = desc; }
+
+		/** Returns the texture applied to each particle. */
+		const HTexture& getTexture() const { return mTexture; }
+
+		/** Changes the texture applied to each particle. If not set particles are rendered as colored quads. */
+		void setTexture(const HTexture& texture);
+
+		/** Creates a new particle emitter resource using the provided properties. */
+		static HParticleEmitter create(const PARTICLE_EMITTER_DESC& desc, const HTexture& texture = HTexture());
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Creates a new particle emitter resource using the provided properties.
+		 *
+		 * @note	Internal method. Use create() for normal use.
+		 */
+		static SPtr<ParticleEmitter> _createPtr(const PARTICLE_EMITTER_DESC& desc, const HTexture& texture);
+
+		/** @} */
+	private:
+		ParticleEmitter(const PARTICLE_EMITTER_DESC& desc, const HTexture& texture);
+
+		/** @copydoc Resource::getResourceDependencies */
+		void getResourceDependencies(FrameVector<HResource>& dependencies) const override;
+
+		PARTICLE_EMITTER_DESC mDesc;
+		HTexture mTexture;
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class ParticleEmitterRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/** @} */
+}
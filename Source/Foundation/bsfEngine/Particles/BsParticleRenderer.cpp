@@ -0,0 +1,474 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Particles/BsParticleRenderer.h"
+#include "Renderer/BsCamera.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "RenderAPI/BsVertexDeclaration.h"
+#include "RenderAPI/BsRenderTarget.h"
+#include "Material/BsGpuParamsSet.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Image/BsTexture.h"
+#include "Math/BsConvexVolume.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs { namespace ct
+{
+	static const UINT32 THREADGROUP_SIZE = 64;
+
+	/** Size of a single particle in the particle buffer. Must match the Particle structure in the particle shaders. */
+	static const UINT32 PARTICLE_SIZE = 48;
+
+	ParticleSimulateParamsDef gParticleSimulateParamsDef;
+	ParticleSortParamsDef gParticleSortParamsDef;
+	ParticleDrawParamsDef gParticleDrawParamsDef;
+
+	ParticleSimulateMat::ParticleSimulateMat()
+	{
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gParticles", mParticlesParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gAliveIndices", mAliveIndicesParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gCounter", mCounterParam);
+		mParams->getTextureParam(GPT_COMPUTE_PROGRAM, "gDepthTex", mDepthParam);
+	}
+
+	void ParticleSimulateMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("THREADGROUP_SIZE", THREADGROUP_SIZE);
+	}
+
+	void ParticleSimulateMat::execute(const SPtr<GpuParamBlockBuffer>& params, UINT32 numParticles,
+		const SPtr<GpuBuffer>& particles, const SPtr<GpuBuffer>& aliveIndices, const SPtr<GpuBuffer>& counter,
+		const SPtr<Texture>& depth)
+	{
+		mParams->setParamBlockBuffer("Params", params);
+		mParticlesParam.set(particles);
+		mAliveIndicesParam.set(aliveIndices);
+		mCounterParam.set(counter);
+		mDepthParam.set(depth);
+
+		UINT32 numGroups = Math::divideAndRoundUp(numParticles, THREADGROUP_SIZE);
+
+		bind();
+		RenderAPI::instance().dispatchCompute(numGroups);
+	}
+
+	ParticleIndirectArgsMat::ParticleIndirectArgsMat()
+	{
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gCounter", mCounterParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDrawArgs", mDrawArgsParam);
+	}
+
+	void ParticleIndirectArgsMat::execute(const SPtr<GpuBuffer>& counter, const SPtr<GpuBuffer>& drawArgs)
+	{
+		mCounterParam.set(counter);
+		mDrawArgsParam.set(drawArgs);
+
+		bind();
+		RenderAPI::instance().dispatchCompute(1);
+	}
+
+	ParticleSortMat::ParticleSortMat()
+	{
+		// Do nothing
+	}
+
+	void ParticleSortMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("THREADGROUP_SIZE", THREADGROUP_SIZE);
+	}
+
+	void ParticleSortMat::execute(const SPtr<GpuParamBlockBuffer>& params, UINT32 numEntries,
+		const SPtr<GpuBuffer>& particles, const SPtr<GpuBuffer>& aliveIndices, const SPtr<GpuBuffer>& drawArgs,
+		const SPtr<GpuBuffer>& sortEntries)
+	{
+		mParams->setParamBlockBuffer("Params", params);
+		mParams->setBuffer(GPT_COMPUTE_PROGRAM, "gParticles", particles);
+		mParams->setBuffer(GPT_COMPUTE_PROGRAM, "gAliveIndices", aliveIndices);
+		mParams->setBuffer(GPT_COMPUTE_PROGRAM, "gDrawArgs", drawArgs);
+		mParams->setBuffer(GPT_COMPUTE_PROGRAM, "gSortEntries", sortEntries);
+
+		UINT32 numGroups = Math::divideAndRoundUp(numEntries, THREADGROUP_SIZE);
+
+		bind();
+		RenderAPI::instance().dispatchCompute(numGroups);
+	}
+
+	void ParticleSortMat::execute(const SPtr<GpuParamBlockBuffer>& params, UINT32 numEntries,
+		const SPtr<GpuBuffer>& sortEntries)
+	{
+		mParams->setParamBlockBuffer("Params", params);
+		mParams->setBuffer(GPT_COMPUTE_PROGRAM, "gSortEntries", sortEntries);
+
+		// Each thread handles a single pair of entries
+		UINT32 numGroups = Math::divideAndRoundUp(numEntries / 2, THREADGROUP_SIZE);
+
+		bind();
+		RenderAPI::instance().dispatchCompute(numGroups);
+	}
+
+	ParticleSortMat* ParticleSortMat::getVariation(bool init)
+	{
+		if (init)
+			return get(getVariation<true>());
+
+		return get(getVariation<false>());
+	}
+
+	ParticleDrawMat::ParticleDrawMat()
+	{
+		mParams->getBufferParam(GPT_VERTEX_PROGRAM, "gParticles", mParticlesParam);
+		mParams->getBufferParam(GPT_VERTEX_PROGRAM, "gSortEntries", mSortEntriesParam);
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gTexture", mTextureParam);
+	}
+
+	void ParticleDrawMat::execute(const SPtr<GpuParamBlockBuffer>& params, const SPtr<GpuBuffer>& particles,
+		const SPtr<GpuBuffer>& sortEntries, const SPtr<Texture>& texture, const SPtr<VertexBuffer>& vertices,
+		const SPtr<VertexDeclaration>& vertexDecl, const SPtr<GpuBuffer>& drawArgs)
+	{
+		mParams->setParamBlockBuffer("Params", params);
+		mParticlesParam.set(particles);
+		mSortEntriesParam.set(sortEntries);
+		mTextureParam.set(texture);
+
+		bind();
+
+		RenderAPI& rapi = RenderAPI::instance();
+		SPtr<VertexBuffer> buffers[] = { vertices };
+
+		rapi.setVertexDeclaration(vertexDecl);
+		rapi.setVertexBuffers(0, buffers, 1);
+		rapi.setDrawOperation(DOT_TRIANGLE_LIST);
+		rapi.drawIndirect(drawArgs);
+	}
+
+	ParticleRenderer::ParticleRenderer()
+		:RendererExtension(RenderLocation::PostLightPass, 0)
+	{
+	}
+
+	void ParticleRenderer::initialize(const Any& data)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		SPtr<VertexDataDesc> quadVertexDesc = bs_shared_ptr_new<VertexDataDesc>();
+		quadVertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		mQuadVertexDecl = VertexDeclaration::create(quadVertexDesc);
+
+		// Corners of a unit quad centered at origin, as two triangles
+		Vector2 corners[] =
+		{
+			Vector2(-0.5f, -0.5f), Vector2(0.5f, -0.5f), Vector2(0.5f, 0.5f),
+			Vector2(-0.5f, -0.5f), Vector2(0.5f, 0.5f), Vector2(-0.5f, 0.5f)
+		};
+
+		VERTEX_BUFFER_DESC desc;
+		desc.vertexSize = sizeof(Vector2);
+		desc.numVerts = (UINT32)bs_size(corners);
+		desc.usage = GBU_STATIC;
+
+		mQuadVertices = VertexBuffer::create(desc);
+		mQuadVertices->writeData(0, sizeof(corners), corners, BWT_DISCARD);
+	}
+
+	void ParticleRenderer::updateData(const ParticleRenderData& data)
+	{
+		// Remove systems that are no longer active, along with their particles
+		UnorderedSet<UINT32> activeIds;
+		for (auto& entry : data.systems)
+			activeIds.insert(entry.id);
+
+		for (auto iter = mSystems.begin(); iter != mSystems.end();)
+		{
+			if (activeIds.find(iter->first) == activeIds.end())
+				iter = mSystems.erase(iter);
+			else
+				++iter;
+		}
+
+		float timeDelta = data.timeDelta;
+		for (auto& entry : data.systems)
+		{
+			const PARTICLE_EMITTER_DESC& desc = entry.desc;
+			if (desc.maxParticles == 0)
+			{
+				mSystems.erase(entry.id);
+				continue;
+			}
+
+			SystemState& state = mSystems[entry.id];
+			bool recreate = state.particles == nullptr || state.data.desc.maxParticles != desc.maxParticles;
+
+			state.data = entry;
+
+			if (recreate)
+				createBuffers(state);
+
+			if (entry.clear)
+			{
+				state.pendingClear = true;
+				state.pendingEmit = 0;
+				state.emitRemainder = 0.0f;
+			}
+
+			// Emission is tracked on the CPU so the GPU only needs to know which range of the particle ring to spawn
+			if (entry.emitting)
+			{
+				float numToEmit = state.emitRemainder + desc.emissionRate * timeDelta;
+				UINT32 numEmitted = (UINT32)std::max(numToEmit, 0.0f);
+
+				state.emitRemainder = numToEmit - (float)numEmitted;
+				state.pendingEmit = std::min(state.pendingEmit + numEmitted, desc.maxParticles);
+			}
+
+			state.pendingTimeDelta = std::min(state.pendingTimeDelta + timeDelta, MAX_TIME_DELTA);
+
+			// Conservative bounds containing all the particles the emitter could have spawned during their lifetime
+			const Matrix4& tfrm = entry.worldTfrm;
+			float scale = std::max(std::max(tfrm.getColumn(0).length(), tfrm.getColumn(1).length()),
+				tfrm.getColumn(2).length());
+
+			float lifetime = std::max(desc.lifetime.x, desc.lifetime.y);
+			float speed = std::max(Math::abs(desc.speed.x), Math::abs(desc.speed.y));
+			float size = std::max(desc.size.x, desc.size.y);
+
+			float reach = desc.shapeRadius * scale + speed * lifetime +
+				0.5f * desc.gravity.length() * lifetime * lifetime + size;
+
+			Vector3 center = tfrm.getTranslation();
+			Vector3 extents(reach, reach, reach);
+			state.bounds = AABox(center - extents, center + extents);
+		}
+
+		mSimulationPending = !mSystems.empty();
+	}
+
+	void ParticleRenderer::createBuffers(SystemState& state)
+	{
+		UINT32 numParticles = state.data.desc.maxParticles;
+
+		GPU_BUFFER_DESC particlesDesc;
+		particlesDesc.type = GBT_STRUCTURED;
+		particlesDesc.format = BF_UNKNOWN;
+		particlesDesc.elementSize = PARTICLE_SIZE;
+		particlesDesc.elementCount = numParticles;
+		particlesDesc.randomGpuWrite = true;
+
+		state.particles = GpuBuffer::create(particlesDesc);
+
+		GPU_BUFFER_DESC indicesDesc;
+		indicesDesc.type = GBT_STANDARD;
+		indicesDesc.format = BF_32X1U;
+		indicesDesc.elementSize = 0;
+		indicesDesc.elementCount = numParticles;
+		indicesDesc.randomGpuWrite = true;
+
+		state.aliveIndices = GpuBuffer::create(indicesDesc);
+
+		indicesDesc.elementCount = 1;
+		state.counter = GpuBuffer::create(indicesDesc);
+
+		indicesDesc.elementCount = sizeof(DrawIndirectArgs) / sizeof(UINT32);
+		state.drawArgsScratch = GpuBuffer::create(indicesDesc);
+
+		GPU_BUFFER_DESC drawArgsDesc;
+		drawArgsDesc.type = GBT_INDIRECTARGUMENT;
+		drawArgsDesc.format = BF_UNKNOWN;
+		drawArgsDesc.elementSize = sizeof(DrawIndirectArgs);
+		drawArgsDesc.elementCount = 1;
+
+		state.drawArgs = GpuBuffer::create(drawArgsDesc);
+
+		// Bitonic sort requires a power of two number of entries
+		UINT32 numSortEntries = Bitwise::nextPow2(numParticles);
+
+		GPU_BUFFER_DESC sortEntriesDesc;
+		sortEntriesDesc.type = GBT_STANDARD;
+		sortEntriesDesc.format = BF_32X2U;
+		sortEntriesDesc.elementSize = 0;
+		sortEntriesDesc.elementCount = numSortEntries;
+		sortEntriesDesc.randomGpuWrite = true;
+
+		state.sortEntries = GpuBuffer::create(sortEntriesDesc);
+
+		UINT32 zero = 0;
+		state.counter->writeData(0, sizeof(zero), &zero, BWT_DISCARD);
+
+		state.simulateParams = gParticleSimulateParamsDef.createBuffer();
+		state.sortInitParams = gParticleSortParamsDef.createBuffer();
+		state.drawParams = gParticleDrawParamsDef.createBuffer();
+
+		// Parameters of the individual sort steps never change, so they're only written once
+		state.sortStepParams.clear();
+		for (UINT32 blockSize = 2; blockSize <= numSortEntries; blockSize *= 2)
+		{
+			for (UINT32 distance = blockSize / 2; distance > 0; distance /= 2)
+			{
+				SPtr<GpuParamBlockBuffer> stepParams = gParticleSortParamsDef.createBuffer();
+				gParticleSortParamsDef.gNumEntries.set(stepParams, (INT32)numSortEntries);
+				gParticleSortParamsDef.gBlockSize.set(stepParams, (INT32)blockSize);
+				gParticleSortParamsDef.gCompareDistance.set(stepParams, (INT32)distance);
+
+				state.sortStepParams.push_back(stepParams);
+			}
+		}
+
+		state.emitRemainder = 0.0f;
+		state.emitOffset = 0;
+		state.pendingEmit = 0;
+		state.pendingClear = true;
+	}
+
+	bool ParticleRenderer::check(const Camera& camera)
+	{
+		return !mSystems.empty();
+	}
+
+	void ParticleRenderer::render(const Camera& camera)
+	{
+		renderView(camera, RendererViewContext());
+	}
+
+	void ParticleRenderer::renderView(const Camera& camera, const RendererViewContext& context)
+	{
+		if (mSimulationPending)
+		{
+			simulate(camera, context);
+			mSimulationPending = false;
+		}
+
+		const Transform& viewTfrm = camera.getTransform();
+		Matrix4 viewProj = camera.getProjectionMatrixRS() * camera.getViewMatrix();
+
+		ConvexVolume worldFrustum = camera.getWorldFrustum();
+		UINT64 cameraLayers = camera.getLayers();
+
+		ParticleDrawMat* drawMat = ParticleDrawMat::get();
+		for (auto& entry : mSystems)
+		{
+			SystemState& state = entry.second;
+			const ParticleSystemRenderData& data = state.data;
+
+			if ((data.layer & cameraLayers) == 0 || !worldFrustum.intersects(state.bounds))
+				continue;
+
+			sort(state, camera);
+
+			gParticleDrawParamsDef.gMatViewProj.set(state.drawParams, viewProj);
+			gParticleDrawParamsDef.gCameraRight.set(state.drawParams, viewTfrm.getRight());
+			gParticleDrawParamsDef.gCameraUp.set(state.drawParams, viewTfrm.getUp());
+			gParticleDrawParamsDef.gStartColor.set(state.drawParams, data.desc.startColor);
+			gParticleDrawParamsDef.gEndColor.set(state.drawParams, data.desc.endColor);
+
+			SPtr<Texture> texture = data.texture != nullptr ? data.texture : Texture::WHITE;
+			drawMat->execute(state.drawParams, state.particles, state.sortEntries, texture, mQuadVertices,
+				mQuadVertexDecl, state.drawArgs);
+		}
+	}
+
+	void ParticleRenderer::simulate(const Camera& camera, const RendererViewContext& context)
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+		const RenderAPIInfo& rapiInfo = rapi.getAPIInfo();
+
+		const Transform& viewTfrm = camera.getTransform();
+		Matrix4 viewProj = camera.getProjectionMatrixRS() * camera.getViewMatrix();
+		Matrix4 invViewProj = viewProj.inverse();
+
+		float minDepth = rapiInfo.getMinimumDepthInputValue();
+		float maxDepth = rapiInfo.getMaximumDepthInputValue();
+		Vector2 deviceZToNDCZ(maxDepth - minDepth, minDepth);
+
+		SPtr<Texture> depth = Texture::WHITE;
+		Vector2I depthSize(1, 1);
+
+		// Collision is only possible if the renderer provided the scene depth. The depth buffer is bound for rendering
+		// at this point, so it needs to be unbound before it can be read.
+		bool canCollide = context.sceneDepth != nullptr && context.target != nullptr;
+		if (canCollide)
+		{
+			depth = context.sceneDepth;
+
+			const TextureProperties& depthProps = depth->getProperties();
+			depthSize = Vector2I(depthProps.getWidth(), depthProps.getHeight());
+
+			rapi.setRenderTarget(nullptr);
+		}
+
+		ParticleSimulateMat* simulateMat = ParticleSimulateMat::get();
+		ParticleIndirectArgsMat* indirectArgsMat = ParticleIndirectArgsMat::get();
+		for (auto& entry : mSystems)
+		{
+			SystemState& state = entry.second;
+			const PARTICLE_EMITTER_DESC& desc = state.data.desc;
+			const SPtr<GpuParamBlockBuffer>& params = state.simulateParams;
+
+			gParticleSimulateParamsDef.gEmitterTfrm.set(params, state.data.worldTfrm);
+			gParticleSimulateParamsDef.gMatViewProj.set(params, viewProj);
+			gParticleSimulateParamsDef.gMatInvViewProj.set(params, invViewProj);
+			gParticleSimulateParamsDef.gNDCToUV.set(params, context.ndcToUV);
+			gParticleSimulateParamsDef.gViewOrigin.set(params, viewTfrm.getPosition());
+			gParticleSimulateParamsDef.gViewDir.set(params, viewTfrm.getForward());
+			gParticleSimulateParamsDef.gGravity.set(params, desc.gravity);
+			gParticleSimulateParamsDef.gLifetime.set(params, desc.lifetime);
+			gParticleSimulateParamsDef.gSpeed.set(params, desc.speed);
+			gParticleSimulateParamsDef.gSize.set(params, desc.size);
+			gParticleSimulateParamsDef.gDeviceZToNDCZ.set(params, deviceZToNDCZ);
+			gParticleSimulateParamsDef.gDepthSize.set(params, depthSize);
+			gParticleSimulateParamsDef.gCosConeAngle.set(params, Math::cos(Radian(desc.coneAngle)));
+			gParticleSimulateParamsDef.gShapeRadius.set(params, desc.shapeRadius);
+			gParticleSimulateParamsDef.gDrag.set(params, desc.drag);
+			gParticleSimulateParamsDef.gBounce.set(params, desc.bounce);
+			gParticleSimulateParamsDef.gTimeDelta.set(params, state.pendingTimeDelta);
+			gParticleSimulateParamsDef.gNumParticles.set(params, (INT32)desc.maxParticles);
+			gParticleSimulateParamsDef.gEmitStart.set(params, (INT32)state.emitOffset);
+			gParticleSimulateParamsDef.gEmitCount.set(params, (INT32)state.pendingEmit);
+			gParticleSimulateParamsDef.gSeed.set(params, (INT32)mSeed);
+			gParticleSimulateParamsDef.gClear.set(params, state.pendingClear ? 1 : 0);
+			gParticleSimulateParamsDef.gCollide.set(params, (canCollide && desc.collide) ? 1 : 0);
+
+			simulateMat->execute(params, desc.maxParticles, state.particles, state.aliveIndices, state.counter, depth);
+			indirectArgsMat->execute(state.counter, state.drawArgsScratch);
+
+			// Indirect argument buffers can't be written to from a compute program on all render APIs
+			state.drawArgs->copyData(*state.drawArgsScratch, 0, 0, sizeof(DrawIndirectArgs));
+
+			state.emitOffset = (state.emitOffset + state.pendingEmit) % desc.maxParticles;
+			state.pendingEmit = 0;
+			state.pendingTimeDelta = 0.0f;
+			state.pendingClear = false;
+		}
+
+		mSeed++;
+
+		if (canCollide)
+			rapi.setRenderTarget(context.target, 0, RT_ALL);
+	}
+
+	void ParticleRenderer::sort(SystemState& state, const Camera& camera)
+	{
+		const Transform& viewTfrm = camera.getTransform();
+		const PARTICLE_EMITTER_DESC& desc = state.data.desc;
+		UINT32 numSortEntries = state.sortEntries->getProperties().getElementCount();
+
+		// Entries are always initialized as they determine which particles are drawn, but only sorted if requested
+		gParticleSortParamsDef.gViewOrigin.set(state.sortInitParams, viewTfrm.getPosition());
+		gParticleSortParamsDef.gViewDir.set(state.sortInitParams, viewTfrm.getForward());
+		gParticleSortParamsDef.gNumEntries.set(state.sortInitParams, (INT32)numSortEntries);
+		gParticleSortParamsDef.gSortKeys.set(state.sortInitParams, desc.sort ? 1 : 0);
+
+		ParticleSortMat* initMat = ParticleSortMat::getVariation(true);
+		initMat->execute(state.sortInitParams, numSortEntries, state.particles, state.aliveIndices,
+			state.drawArgsScratch, state.sortEntries);
+
+		if (!desc.sort)
+			return;
+
+		ParticleSortMat* stepMat = ParticleSortMat::getVariation(false);
+		for (auto& stepParams : state.sortStepParams)
+			stepMat->execute(stepParams, numSortEntries, state.sortEntries);
+	}
+}}
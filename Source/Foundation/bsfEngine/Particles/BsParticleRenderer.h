@@ -0,0 +1,318 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Particles/BsParticleEmitter.h"
+#include "Renderer/BsParamBlocks.h"
+#include "Renderer/BsRendererExtension.h"
+#include "Renderer/BsRendererMaterial.h"
+#include "Math/BsAABox.h"
+#include "Math/BsMatrix4.h"
+
+namespace bs
+{
+	/** @addtogroup Particles-Internal
+	 *  @{
+	 */
+
+	/** Information about a single particle system, sent from the sim thread to the renderer every frame. */
+	struct ParticleSystemRenderData
+	{
+		/** Identifier of the system, unique among all registered systems. */
+		UINT32 id = 0;
+
+		/** Properties of the emitter used by the system. */
+		PARTICLE_EMITTER_DESC desc;
+
+		/** Texture applied to each particle, or null if none. */
+		SPtr<ct::Texture> texture;
+
+		/** Transform of the emitter, in world space. */
+		Matrix4 worldTfrm = Matrix4::IDENTITY;
+
+		/** Layer bitfield determining in which cameras are the particles visible. */
+		UINT64 layer = 1;
+
+		/** True if the system spawns new particles. */
+		bool emitting = true;
+
+		/** True if all currently alive particles should be removed. */
+		bool clear = false;
+	};
+
+	/** Information about all active particle systems, sent from the sim thread to the renderer every frame. */
+	struct ParticleRenderData
+	{
+		Vector<ParticleSystemRenderData> systems;
+		float timeDelta = 0.0f;
+	};
+
+	/** @} */
+
+	namespace ct
+	{
+	/** @addtogroup Particles-Internal
+	 *  @{
+	 */
+
+	BS_PARAM_BLOCK_BEGIN(ParticleSimulateParamsDef)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gEmitterTfrm)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatViewProj)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatInvViewProj)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gNDCToUV)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gViewOrigin)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gViewDir)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gGravity)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gLifetime)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gSpeed)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gSize)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gDeviceZToNDCZ)
+		BS_PARAM_BLOCK_ENTRY(Vector2I, gDepthSize)
+		BS_PARAM_BLOCK_ENTRY(float, gCosConeAngle)
+		BS_PARAM_BLOCK_ENTRY(float, gShapeRadius)
+		BS_PARAM_BLOCK_ENTRY(float, gDrag)
+		BS_PARAM_BLOCK_ENTRY(float, gBounce)
+		BS_PARAM_BLOCK_ENTRY(float, gTimeDelta)
+		BS_PARAM_BLOCK_ENTRY(INT32, gNumParticles)
+		BS_PARAM_BLOCK_ENTRY(INT32, gEmitStart)
+		BS_PARAM_BLOCK_ENTRY(INT32, gEmitCount)
+		BS_PARAM_BLOCK_ENTRY(INT32, gSeed)
+		BS_PARAM_BLOCK_ENTRY(INT32, gClear)
+		BS_PARAM_BLOCK_ENTRY(INT32, gCollide)
+	BS_PARAM_BLOCK_END
+
+	extern ParticleSimulateParamsDef gParticleSimulateParamsDef;
+
+	BS_PARAM_BLOCK_BEGIN(ParticleSortParamsDef)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gViewOrigin)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gViewDir)
+		BS_PARAM_BLOCK_ENTRY(INT32, gNumEntries)
+		BS_PARAM_BLOCK_ENTRY(INT32, gSortKeys)
+		BS_PARAM_BLOCK_ENTRY(INT32, gBlockSize)
+		BS_PARAM_BLOCK_ENTRY(INT32, gCompareDistance)
+	BS_PARAM_BLOCK_END
+
+	extern ParticleSortParamsDef gParticleSortParamsDef;
+
+	BS_PARAM_BLOCK_BEGIN(ParticleDrawParamsDef)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatViewProj)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gCameraRight)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gCameraUp)
+		BS_PARAM_BLOCK_ENTRY(Color, gStartColor)
+		BS_PARAM_BLOCK_ENTRY(Color, gEndColor)
+	BS_PARAM_BLOCK_END
+
+	extern ParticleDrawParamsDef gParticleDrawParamsDef;
+
+	/**
+	 * Spawns new particles, integrates the alive ones and optionally collides them against the scene depth buffer.
+	 * Indices of particles that are alive after the update are appended to the alive index buffer.
+	 */
+	class ParticleSimulateMat : public RendererMaterial<ParticleSimulateMat>
+	{
+		RMAT_DEF_CUSTOMIZED("ParticleSimulate.bsl");
+
+	public:
+		ParticleSimulateMat();
+
+		/**
+		 * Executes the material, updating all particles of a system.
+		 *
+		 * @param[in]	params			Buffer created from gParticleSimulateParamsDef.
+		 * @param[in]	numParticles	Maximum number of particles in the system.
+		 * @param[in]	particles		Structured buffer holding the particle state.
+		 * @param[in]	aliveIndices	Buffer to receive indices of particles alive after the update.
+		 * @param[in]	counter			Buffer holding the number of entries written to @p aliveIndices.
+		 * @param[in]	depth			Scene depth buffer to collide against. Must be non-null even if collision is
+		 *								disabled.
+		 */
+		void execute(const SPtr<GpuParamBlockBuffer>& params, UINT32 numParticles, const SPtr<GpuBuffer>& particles,
+			const SPtr<GpuBuffer>& aliveIndices, const SPtr<GpuBuffer>& counter, const SPtr<Texture>& depth);
+
+	private:
+		GpuParamBuffer mParticlesParam;
+		GpuParamBuffer mAliveIndicesParam;
+		GpuParamBuffer mCounterParam;
+		GpuParamTexture mDepthParam;
+	};
+
+	/**
+	 * Writes the number of alive particles, as counted during simulation, into draw arguments for an indirect draw, and
+	 * resets the counter for the next simulation step.
+	 */
+	class ParticleIndirectArgsMat : public RendererMaterial<ParticleIndirectArgsMat>
+	{
+		RMAT_DEF("ParticleIndirectArgs.bsl");
+
+	public:
+		ParticleIndirectArgsMat();
+
+		/**
+		 * Executes the material.
+		 *
+		 * @param[in]	counter		Buffer holding the number of alive particles.
+		 * @param[in]	drawArgs	Buffer of four 32-bit unsigned integers to receive a DrawIndirectArgs structure.
+		 */
+		void execute(const SPtr<GpuBuffer>& counter, const SPtr<GpuBuffer>& drawArgs);
+
+	private:
+		GpuParamBuffer mCounterParam;
+		GpuParamBuffer mDrawArgsParam;
+	};
+
+	/**
+	 * Builds and sorts a list of (key, particle index) entries determining the order in which particles are drawn. The
+	 * list is sorted using a bitonic sort, requiring the number of entries to be a power of two.
+	 */
+	class ParticleSortMat : public RendererMaterial<ParticleSortMat>
+	{
+		RMAT_DEF_CUSTOMIZED("ParticleSort.bsl");
+
+		/** Helper method used for initializing variations of this material. */
+		template<bool init>
+		static const ShaderVariation& getVariation()
+		{
+			static ShaderVariation variation = ShaderVariation(
+			SmallVector<ShaderVariation::Param, 4>{
+				ShaderVariation::Param("INIT", init)
+			});
+
+			return variation;
+		}
+	public:
+		ParticleSortMat();
+
+		/**
+		 * Fills out the sort entries for all alive particles, and pads the rest of the list with entries that always
+		 * sort last. Only valid for the initialization variation.
+		 *
+		 * @param[in]	params			Buffer created from gParticleSortParamsDef.
+		 * @param[in]	numEntries		Number of entries in @p sortEntries. Must be a power of two.
+		 * @param[in]	particles		Structured buffer holding the particle state.
+		 * @param[in]	aliveIndices	Indices of alive particles, as output by ParticleSimulateMat.
+		 * @param[in]	drawArgs		Draw arguments holding the number of alive particles, as output by
+		 *								ParticleIndirectArgsMat.
+		 * @param[in]	sortEntries		Buffer to receive the sort entries.
+		 */
+		void execute(const SPtr<GpuParamBlockBuffer>& params, UINT32 numEntries, const SPtr<GpuBuffer>& particles,
+			const SPtr<GpuBuffer>& aliveIndices, const SPtr<GpuBuffer>& drawArgs, const SPtr<GpuBuffer>& sortEntries);
+
+		/**
+		 * Performs a single step of the bitonic sort. Only valid for the non-initialization variation.
+		 *
+		 * @param[in]	params			Buffer created from gParticleSortParamsDef, with the block size and compare
+		 *								distance of the step.
+		 * @param[in]	numEntries		Number of entries in @p sortEntries. Must be a power of two.
+		 * @param[in]	sortEntries		Entries to sort.
+		 */
+		void execute(const SPtr<GpuParamBlockBuffer>& params, UINT32 numEntries, const SPtr<GpuBuffer>& sortEntries);
+
+		/** Returns the material variation matching the provided parameters. */
+		static ParticleSortMat* getVariation(bool init);
+	};
+
+	/** Renders particles as camera facing quads, in the order determined by the sort entries. */
+	class ParticleDrawMat : public RendererMaterial<ParticleDrawMat>
+	{
+		RMAT_DEF("ParticleDraw.bsl");
+
+	public:
+		ParticleDrawMat();
+
+		/**
+		 * Executes the material.
+		 *
+		 * @param[in]	params			Buffer created from gParticleDrawParamsDef.
+		 * @param[in]	particles		Structured buffer holding the particle state.
+		 * @param[in]	sortEntries		Entries determining which particle to draw for each instance.
+		 * @param[in]	texture			Texture to apply to each particle.
+		 * @param[in]	vertices		Vertices of a single quad.
+		 * @param[in]	vertexDecl		Vertex declaration of @p vertices.
+		 * @param[in]	drawArgs		Buffer of GBT_INDIRECTARGUMENT type containing the DrawIndirectArgs.
+		 */
+		void execute(const SPtr<GpuParamBlockBuffer>& params, const SPtr<GpuBuffer>& particles,
+			const SPtr<GpuBuffer>& sortEntries, const SPtr<Texture>& texture, const SPtr<VertexBuffer>& vertices,
+			const SPtr<VertexDeclaration>& vertexDecl, const SPtr<GpuBuffer>& drawArgs);
+
+	private:
+		GpuParamBuffer mParticlesParam;
+		GpuParamBuffer mSortEntriesParam;
+		GpuParamTexture mTextureParam;
+	};
+
+	/**
+	 * Simulates and renders particle systems provided by ParticleSystemManager. Particle state never leaves the GPU.
+	 * Systems are simulated once per frame, during the first view rendered after receiving new data from the sim
+	 * thread. They are then culled, sorted and drawn for every view individually.
+	 */
+	class ParticleRenderer : public RendererExtension
+	{
+		friend class bs::ParticleSystemManager;
+
+	public:
+		ParticleRenderer();
+
+	private:
+		/** GPU resources and emission state of a single particle system. */
+		struct SystemState
+		{
+			ParticleSystemRenderData data;
+			AABox bounds;
+
+			SPtr<GpuBuffer> particles;
+			SPtr<GpuBuffer> aliveIndices;
+			SPtr<GpuBuffer> counter;
+			SPtr<GpuBuffer> drawArgsScratch;
+			SPtr<GpuBuffer> drawArgs;
+			SPtr<GpuBuffer> sortEntries;
+
+			SPtr<GpuParamBlockBuffer> simulateParams;
+			SPtr<GpuParamBlockBuffer> sortInitParams;
+			SPtr<GpuParamBlockBuffer> drawParams;
+			Vector<SPtr<GpuParamBlockBuffer>> sortStepParams;
+
+			float emitRemainder = 0.0f;
+			UINT32 emitOffset = 0;
+			UINT32 pendingEmit = 0;
+			float pendingTimeDelta = 0.0f;
+			bool pendingClear = true;
+		};
+
+		/**	@copydoc RendererExtension::initialize */
+		void initialize(const Any& data) override;
+
+		/**	@copydoc RendererExtension::check */
+		bool check(const Camera& camera) override;
+
+		/**	@copydoc RendererExtension::render */
+		void render(const Camera& camera) override;
+
+		/**	@copydoc RendererExtension::renderView */
+		void renderView(const Camera& camera, const RendererViewContext& context) override;
+
+		/** Updates the set of particle systems to render and advances their emission. */
+		void updateData(const ParticleRenderData& data);
+
+		/** Creates the GPU buffers of a system, discarding any particles it had. */
+		void createBuffers(SystemState& state);
+
+		/** Runs the simulation step for all systems, using the provided view for collision. */
+		void simulate(const Camera& camera, const RendererViewContext& context);
+
+		/** Sorts the particles of a system for the provided view. */
+		void sort(SystemState& state, const Camera& camera);
+
+		/** Longest time step a single simulation update will advance the particles by, in seconds. */
+		static constexpr float MAX_TIME_DELTA = 0.1f;
+
+		UnorderedMap<UINT32, SystemState> mSystems;
+		SPtr<VertexBuffer> mQuadVertices;
+		SPtr<VertexDeclaration> mQuadVertexDecl;
+		UINT32 mSeed = 0;
+		bool mSimulationPending = false;
+	};
+
+	/** @} */
+	}
+}
@@ -0,0 +1,70 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Particles/BsParticleSystemManager.h"
+#include "Particles/BsCParticleSystem.h"
+#include "Particles/BsParticleRenderer.h"
+#include "Scene/BsSceneObject.h"
+#include "Image/BsTexture.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Utility/BsTime.h"
+
+namespace bs
+{
+	ParticleSystemManager::ParticleSystemManager()
+	{
+		mRenderer = RendererExtension::create<ct::ParticleRenderer>(nullptr);
+	}
+
+	void ParticleSystemManager::_registerSystem(CParticleSystem* system)
+	{
+		system->_setId(mNextId++);
+		mSystems.push_back(system);
+	}
+
+	void ParticleSystemManager::_unregisterSystem(CParticleSystem* system)
+	{
+		auto iterFind = std::find(mSystems.begin(), mSystems.end(), system);
+		if (iterFind != mSystems.end())
+		{
+			std::swap(*iterFind, mSystems.back());
+			mSystems.pop_back();
+		}
+	}
+
+	void ParticleSystemManager::_update()
+	{
+		// The renderer keeps rendering the last set of systems, so there's no need to keep re-sending an empty set
+		if (mSystems.empty() && mSentEmpty)
+			return;
+
+		ParticleRenderData renderData;
+		renderData.timeDelta = gTime().getFrameDelta();
+		renderData.systems.reserve(mSystems.size());
+
+		for (auto& system : mSystems)
+		{
+			const HParticleEmitter& emitter = system->getEmitter();
+			if (!emitter.isLoaded())
+				continue;
+
+			ParticleSystemRenderData systemData;
+			systemData.id = system->_getId();
+			systemData.desc = emitter->getDesc();
+			systemData.worldTfrm = system->SO()->getWorldMatrix();
+			systemData.layer = system->getLayer();
+			systemData.emitting = system->getEmitting();
+			systemData.clear = system->_consumeClearRequest();
+
+			const HTexture& texture = emitter->getTexture();
+			if (texture.isLoaded())
+				systemData.texture = texture->getCore();
+
+			renderData.systems.push_back(std::move(systemData));
+		}
+
+		mSentEmpty = renderData.systems.empty();
+
+		ct::ParticleRenderer* renderer = mRenderer.get();
+		gCoreThread().queueCommand(std::bind(&ct::ParticleRenderer::updateData, renderer, std::move(renderData)));
+	}
+}
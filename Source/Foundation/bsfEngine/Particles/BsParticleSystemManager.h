@@ -0,0 +1,44 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	namespace ct { class ParticleRenderer; }
+
+	/** @addtogroup Particles-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of all active particle systems and forwards their state to the renderer once per frame. Only a small
+	 * amount of data per system is sent, while all particle state is kept and updated on the GPU, making the CPU cost
+	 * independent of the particle count.
+	 */
+	class BS_EXPORT ParticleSystemManager : public Module<ParticleSystemManager>
+	{
+	public:
+		ParticleSystemManager();
+
+		/** Registers a new particle system to be simulated and rendered. */
+		void _registerSystem(CParticleSystem* system);
+
+		/** Unregisters a particle system, removing all of its particles. */
+		void _unregisterSystem(CParticleSystem* system);
+
+		/** Sends the state of all registered particle systems to the renderer. Should be called once per frame. */
+		void _update();
+
+	private:
+		Vector<CParticleSystem*> mSystems;
+		UINT32 mNextId = 1;
+		bool mSentEmpty = true;
+
+		SPtr<ct::ParticleRenderer> mRenderer;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,46 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "Particles/BsCParticleSystem.h"
+#include "Private/RTTI/BsGameObjectRTTI.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Engine
+	 *  @{
+	 */
+
+	class BS_EXPORT CParticleSystemRTTI : public RTTIType<CParticleSystem, Component, CParticleSystemRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_REFL(mEmitter, 0)
+			BS_RTTI_MEMBER_PLAIN(mEmitting, 1)
+			BS_RTTI_MEMBER_PLAIN(mLayer, 2)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "CParticleSystem";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_CParticleSystem;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return GameObjectRTTI::createGameObject<CParticleSystem>();
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
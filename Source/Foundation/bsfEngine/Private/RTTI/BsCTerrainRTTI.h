@@ -0,0 +1,49 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "Terrain/BsCTerrain.h"
+#include "Private/RTTI/BsGameObjectRTTI.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Engine
+	 *  @{
+	 */
+
+	class BS_EXPORT CTerrainRTTI : public RTTIType<CTerrain, Component, CTerrainRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_REFL(mHeightField, 0)
+			BS_RTTI_MEMBER_REFL(mSplatMap, 1)
+			BS_RTTI_MEMBER_REFL_ARRAY(mLayerTextures, 2)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mLayerTiling, 3)
+			BS_RTTI_MEMBER_PLAIN(mLodDistance, 4)
+			BS_RTTI_MEMBER_PLAIN(mLayer, 5)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "CTerrain";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_CTerrain;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return GameObjectRTTI::createGameObject<CTerrain>();
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
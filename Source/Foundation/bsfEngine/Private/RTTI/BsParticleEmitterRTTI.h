@@ -0,0 +1,57 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "Particles/BsParticleEmitter.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Engine
+	 *  @{
+	 */
+
+	class BS_EXPORT ParticleEmitterRTTI : public RTTIType<ParticleEmitter, Resource, ParticleEmitterRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN_NAMED(maxParticles, mDesc.maxParticles, 0)
+			BS_RTTI_MEMBER_PLAIN_NAMED(emissionRate, mDesc.emissionRate, 1)
+			BS_RTTI_MEMBER_PLAIN_NAMED(lifetime, mDesc.lifetime, 2)
+			BS_RTTI_MEMBER_PLAIN_NAMED(speed, mDesc.speed, 3)
+			BS_RTTI_MEMBER_PLAIN_NAMED(size, mDesc.size, 4)
+			BS_RTTI_MEMBER_PLAIN_NAMED(coneAngle, mDesc.coneAngle, 5)
+			BS_RTTI_MEMBER_PLAIN_NAMED(shapeRadius, mDesc.shapeRadius, 6)
+			BS_RTTI_MEMBER_PLAIN_NAMED(startColor, mDesc.startColor, 7)
+			BS_RTTI_MEMBER_PLAIN_NAMED(endColor, mDesc.endColor, 8)
+			BS_RTTI_MEMBER_PLAIN_NAMED(gravity, mDesc.gravity, 9)
+			BS_RTTI_MEMBER_PLAIN_NAMED(drag, mDesc.drag, 10)
+			BS_RTTI_MEMBER_PLAIN_NAMED(collide, mDesc.collide, 11)
+			BS_RTTI_MEMBER_PLAIN_NAMED(bounce, mDesc.bounce, 12)
+			BS_RTTI_MEMBER_PLAIN_NAMED(sort, mDesc.sort, 13)
+			BS_RTTI_MEMBER_REFL(mTexture, 14)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "ParticleEmitter";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_ParticleEmitter;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return ParticleEmitter::_createPtr(PARTICLE_EMITTER_DESC(), HTexture());
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
@@ -7,10 +7,78 @@
 #include "Material/BsMaterial.h"
 #include "Renderer/BsRenderableElement.h"
 
-using namespace std::placeholders;
-
 namespace bs { namespace ct
 {
+	/** Number of bits sorted by a single pass of the radix sort. */
+	static constexpr UINT32 RADIX_BITS = 8;
+
+	/** Number of buckets used by a single pass of the radix sort. */
+	static constexpr UINT32 RADIX_BUCKETS = 1 << RADIX_BITS;
+
+	/** Number of passes required to sort a 64-bit key. */
+	static constexpr UINT32 RADIX_PASSES = 64 / RADIX_BITS;
+
+	/** Converts a float into an unsigned integer, so that comparing the integers yields the same order as the floats. */
+	static UINT32 floatToSortableBits(float value)
+	{
+		UINT32 bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		// Negative values have all their bits flipped, positive values only the sign bit
+		UINT32 mask = (UINT32)(-(INT32)(bits >> 31)) | 0x80000000;
+		return bits ^ mask;
+	}
+
+	/**
+	 * Sorts the provided keys in ascending order using a LSD radix sort, and re-orders the values in the same way. The
+	 * sort is stable. @p keys and @p values contain the sorted data on return, while @p keysTmp and @p valuesTmp must
+	 * be scratch buffers of the same size.
+	 */
+	static void radixSort(UINT64*& keys, UINT32*& values, UINT64*& keysTmp, UINT32*& valuesTmp, UINT32 count)
+	{
+		// Generate histograms for all passes at once
+		UINT32 histograms[RADIX_PASSES][RADIX_BUCKETS];
+		bs_zero_out(histograms);
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			UINT64 key = keys[i];
+			for (UINT32 j = 0; j < RADIX_PASSES; j++)
+				histograms[j][(key >> (j * RADIX_BITS)) & (RADIX_BUCKETS - 1)]++;
+		}
+
+		for (UINT32 i = 0; i < RADIX_PASSES; i++)
+		{
+			UINT32* histogram = histograms[i];
+			const UINT32 shift = i * RADIX_BITS;
+
+			// All keys share the same digit, nothing to do for this pass
+			if (histogram[(keys[0] >> shift) & (RADIX_BUCKETS - 1)] == count)
+				continue;
+
+			// Convert counts into offsets
+			UINT32 offset = 0;
+			for (UINT32 j = 0; j < RADIX_BUCKETS; j++)
+			{
+				UINT32 bucketCount = histogram[j];
+				histogram[j] = offset;
+				offset += bucketCount;
+			}
+
+			for (UINT32 j = 0; j < count; j++)
+			{
+				UINT32 bucket = (keys[j] >> shift) & (RADIX_BUCKETS - 1);
+				UINT32 dstIdx = histogram[bucket]++;
+
+				keysTmp[dstIdx] = keys[j];
+				valuesTmp[dstIdx] = values[j];
+			}
+
+			std::swap(keys, keysTmp);
+			std::swap(values, valuesTmp);
+		}
+	}
+
 	RenderQueue::RenderQueue(StateReduction mode)
 		:mStateReductionMode(mode)
 	{
@@ -20,8 +88,8 @@ namespace bs { namespace ct
 	void RenderQueue::clear()
 	{
 		mSortableElements.clear();
-		mSortableElementIdx.clear();
 		mElements.clear();
+		mPriorities.clear();
 
 		mSortedRenderElements.clear();
 	}
@@ -31,11 +99,13 @@ namespace bs { namespace ct
 		SPtr<Material> material = element->material;
 		SPtr<Shader> shader = material->getShader();
 
+		UINT32 elementIdx = (UINT32)mElements.size();
 		mElements.push_back(element);
-		
-		UINT32 queuePriority = shader->getQueuePriority();
+
+		INT32 queuePriority = shader->getQueuePriority();
 		QueueSortType sortType = shader->getQueueSortType();
 		UINT32 shaderId = shader->getId();
+		UINT32 materialGroupId = material->getGroupId();
 		bool separablePasses = shader->getAllowSeparablePasses();
 
 		switch (sortType)
@@ -50,162 +120,164 @@ namespace bs { namespace ct
 			break;
 		}
 
+		// Only a few different priorities are normally used, so a linear search suffices
+		if (mPriorities.empty() || mPriorities.back() != queuePriority)
+		{
+			auto iterFind = std::find(mPriorities.begin(), mPriorities.end(), queuePriority);
+			if (iterFind == mPriorities.end())
+				mPriorities.push_back(queuePriority);
+		}
+
+		// Meshes are only used for grouping, so any value that is likely to differ between meshes will do
+		UINT32 meshId = (UINT32)(((UINT64)(size_t)element->mesh.get()) >> 4);
+
 		UINT32 numPasses = material->getNumPasses();
 		if (!separablePasses)
 			numPasses = std::min(1U, numPasses);
 
 		for (UINT32 i = 0; i < numPasses; i++)
 		{
-			UINT32 idx = (UINT32)mSortableElementIdx.size();
-			mSortableElementIdx.push_back(idx);
-
 			mSortableElements.push_back(SortableElement());
 			SortableElement& sortableElem = mSortableElements.back();
 
-			sortableElem.seqIdx = idx;
+			sortableElem.elementIdx = elementIdx;
 			sortableElem.priority = queuePriority;
 			sortableElem.shaderId = shaderId;
+			sortableElem.materialGroupId = materialGroupId;
+			sortableElem.meshId = meshId;
 			sortableElem.passIdx = i;
+			sortableElem.separablePasses = separablePasses;
 			sortableElem.distFromCamera = distFromCamera;
 		}
 	}
 
 	void RenderQueue::sort()
 	{
-		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
-
-		switch (mStateReductionMode)
-		{
-		case StateReduction::None:
-			sortMethod = &elementSorterNoGroup;
-			break;
-		case StateReduction::Material:
-			sortMethod = &elementSorterPreferGroup;
-			break;
-		case StateReduction::Distance:
-			sortMethod = &elementSorterPreferSort;
-			break;
-		}
+		const UINT32 numElements = (UINT32)mSortableElements.size();
+		if (numElements == 0)
+			return;
 
-		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
-		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
+		// Higher priorities map to lower ranks and are rendered first
+		std::sort(mPriorities.begin(), mPriorities.end(), std::greater<INT32>());
 
-		UINT32 prevShaderId = (UINT32)-1;
-		UINT32 prevPassIdx = (UINT32)-1;
-		RenderableElement* renderElem = nullptr;
-		INT32 currentElementIdx = -1;
-		UINT32 numPassesInCurrentElement = 0;
-		bool separablePasses = true;
-		for (UINT32 i = 0; i < (UINT32)mSortableElementIdx.size(); i++)
+		bs_frame_mark();
 		{
-			UINT32 idx = mSortableElementIdx[i];
-
-			while (numPassesInCurrentElement == 0)
+			UINT64* keys = (UINT64*)bs_frame_alloc(numElements * sizeof(UINT64));
+			UINT64* keysTmp = (UINT64*)bs_frame_alloc(numElements * sizeof(UINT64));
+			UINT32* indices = (UINT32*)bs_frame_alloc(numElements * sizeof(UINT32));
+			UINT32* indicesTmp = (UINT32*)bs_frame_alloc(numElements * sizeof(UINT32));
+
+			INT32 prevPriority = mPriorities[0];
+			UINT32 prevPriorityRank = 0;
+			for (UINT32 i = 0; i < numElements; i++)
 			{
-				currentElementIdx++;
-				renderElem = mElements[currentElementIdx];
-				numPassesInCurrentElement = renderElem->material->getNumPasses();
-				separablePasses = renderElem->material->getShader()->getAllowSeparablePasses();
-			}
-
-			const SortableElement& elem = mSortableElements[idx];
-			if (separablePasses)
-			{
-				mSortedRenderElements.push_back(RenderQueueElement());
-
-				RenderQueueElement& sortedElem = mSortedRenderElements.back();
-				sortedElem.renderElem = renderElem;
-				sortedElem.passIdx = elem.passIdx;
+				const SortableElement& elem = mSortableElements[i];
 
-				if (prevShaderId != elem.shaderId || prevPassIdx != elem.passIdx)
+				if (elem.priority != prevPriority)
 				{
-					sortedElem.applyPass = true;
-					prevShaderId = elem.shaderId;
-					prevPassIdx = elem.passIdx;
+					auto iterFind = std::lower_bound(mPriorities.begin(), mPriorities.end(), elem.priority,
+						std::greater<INT32>());
+
+					prevPriority = elem.priority;
+					prevPriorityRank = (UINT32)(iterFind - mPriorities.begin());
 				}
-				else
-					sortedElem.applyPass = false;
 
-				numPassesInCurrentElement--;
+				keys[i] = encodeSortKey(elem, prevPriorityRank);
+				indices[i] = i;
 			}
-			else
+
+			radixSort(keys, indices, keysTmp, indicesTmp, numElements);
+
+			mSortedRenderElements.reserve(mSortedRenderElements.size() + numElements);
+
+			UINT32 prevShaderId = (UINT32)-1;
+			UINT32 prevPassIdx = (UINT32)-1;
+			for (UINT32 i = 0; i < numElements; i++)
 			{
-				for (UINT32 j = 0; j < numPassesInCurrentElement; j++)
+				const SortableElement& elem = mSortableElements[indices[i]];
+				RenderableElement* renderElem = mElements[elem.elementIdx];
+
+				if (elem.separablePasses)
 				{
 					mSortedRenderElements.push_back(RenderQueueElement());
 
 					RenderQueueElement& sortedElem = mSortedRenderElements.back();
 					sortedElem.renderElem = renderElem;
-					sortedElem.passIdx = j;
-					sortedElem.applyPass = true;
-
-					prevShaderId = elem.shaderId;
-					prevPassIdx = j;
+					sortedElem.passIdx = elem.passIdx;
+
+					if (prevShaderId != elem.shaderId || prevPassIdx != elem.passIdx)
+					{
+						sortedElem.applyPass = true;
+						prevShaderId = elem.shaderId;
+						prevPassIdx = elem.passIdx;
+					}
+					else
+						sortedElem.applyPass = false;
 				}
+				else
+				{
+					UINT32 numPasses = renderElem->material->getNumPasses();
+					for (UINT32 j = 0; j < numPasses; j++)
+					{
+						mSortedRenderElements.push_back(RenderQueueElement());
+
+						RenderQueueElement& sortedElem = mSortedRenderElements.back();
+						sortedElem.renderElem = renderElem;
+						sortedElem.passIdx = j;
+						sortedElem.applyPass = true;
+
+						prevShaderId = elem.shaderId;
+						prevPassIdx = j;
+					}
+				}
+			}
 
-				numPassesInCurrentElement = 0;
-			}			
+			// Note: Sorting might have swapped the buffers, but all of them still need to be freed
+			bs_frame_free(indicesTmp);
+			bs_frame_free(indices);
+			bs_frame_free(keysTmp);
+			bs_frame_free(keys);
 		}
+		bs_frame_clear();
 	}
 
-	bool RenderQueue::elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
+	UINT64 RenderQueue::encodeSortKey(const SortableElement& element, UINT32 priorityRank) const
 	{
-		const SortableElement& a = lookup[aIdx];
-		const SortableElement& b = lookup[bIdx];
-
-		UINT8 isHigher = (a.priority > b.priority) << 2 |
-			(a.distFromCamera < b.distFromCamera) << 1 |
-			(a.seqIdx < b.seqIdx);
+		// Values are truncated to fit their bit range in the key. This only affects grouping and the ordering of elements
+		// that are very close in depth, never the priority order (unless there are more than 255 different priorities).
+		const UINT64 priority = std::min(priorityRank, 0xFFU);
+		const UINT64 depth = floatToSortableBits(element.distFromCamera) >> 8;
+		const UINT64 shader = element.shaderId & 0xFFFF;
+		const UINT64 pass = std::min(element.passIdx, 0xFU);
 
-		UINT8 isLower = (a.priority < b.priority) << 2 |
-			(a.distFromCamera > b.distFromCamera) << 1 |
-			(a.seqIdx > b.seqIdx);
-
-		return isHigher > isLower;
-	}
+		switch (mStateReductionMode)
+		{
+		default:
+		case StateReduction::None:
+			// [priority:8][depth:24][unused:32]
+			return (priority << 56) | (depth << 32);
+		case StateReduction::Material:
+		{
+			// Elements with the same material parameters are grouped so they can share parameter buffers
+			// [priority:8][shader:16][pass:4][group:8][mesh:8][depth:20]
+			const UINT64 group = element.materialGroupId & 0xFF;
+			const UINT64 mesh = element.meshId & 0xFF;
 
-	bool RenderQueue::elementSorterPreferGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
-	{
-		const SortableElement& a = lookup[aIdx];
-		const SortableElement& b = lookup[bIdx];
-		
-		UINT8 isHigher = (a.priority > b.priority) << 4 |
-			(a.shaderId < b.shaderId) << 3 |
-			(a.passIdx < b.passIdx) << 2 |
-			(a.distFromCamera < b.distFromCamera) << 1 |
-			(a.seqIdx < b.seqIdx);
-
-		UINT8 isLower = (a.priority < b.priority) << 4 |
-			(a.shaderId > b.shaderId) << 3 |
-			(a.passIdx > b.passIdx) << 2 |
-			(a.distFromCamera > b.distFromCamera) << 1 |
-			(a.seqIdx > b.seqIdx);
-
-		return isHigher > isLower;
-	}
+			return (priority << 56) | (shader << 40) | (pass << 36) | (group << 28) | (mesh << 20) | (depth >> 4);
+		}
+		case StateReduction::Distance:
+		{
+			// [priority:8][depth:24][shader:16][pass:4][group:6][mesh:6]
+			const UINT64 group = element.materialGroupId & 0x3F;
+			const UINT64 mesh = element.meshId & 0x3F;
 
-	bool RenderQueue::elementSorterPreferSort(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
-	{
-		const SortableElement& a = lookup[aIdx];
-		const SortableElement& b = lookup[bIdx];
-
-		UINT8 isHigher = (a.priority > b.priority) << 4 | 
-			(a.distFromCamera < b.distFromCamera) << 3 | 
-			(a.shaderId < b.shaderId) << 2 | 
-			(a.passIdx < b.passIdx) << 1 | 
-			(a.seqIdx < b.seqIdx);
-
-		UINT8 isLower = (a.priority < b.priority) << 4 |
-			(a.distFromCamera > b.distFromCamera) << 3 |
-			(a.shaderId > b.shaderId) << 2 |
-			(a.passIdx > b.passIdx) << 1 |
-			(a.seqIdx > b.seqIdx);
-
-		return isHigher > isLower;
+			return (priority << 56) | (depth << 32) | (shader << 16) | (pass << 12) | (group << 6) | mesh;
+		}
+		}
 	}
 
 	const Vector<RenderQueueElement>& RenderQueue::getSortedElements() const
 	{
 		return mSortedRenderElements;
 	}
-}}
\ No newline at end of file
+}}
@@ -41,14 +41,20 @@ namespace bs { namespace ct
 	 */
 	class BS_EXPORT RenderQueue
 	{
-		/**	Data used for renderable element sorting. Represents a single pass for a single mesh. */
+		/**	
+		 * Data used for renderable element sorting. Represents a single pass for a single mesh, or all passes of the mesh
+		 * if the shader doesn't allow separable passes. 
+		 */
 		struct SortableElement
 		{
-			UINT32 seqIdx;
+			UINT32 elementIdx;
 			INT32 priority;
 			float distFromCamera;
 			UINT32 shaderId;
+			UINT32 materialGroupId;
+			UINT32 meshId;
 			UINT32 passIdx;
+			bool separablePasses;
 		};
 
 	public:
@@ -66,7 +72,11 @@ namespace bs { namespace ct
 		/**	Clears all render operations from the queue. */
 		void clear();
 		
-		/**	Sorts all the render operations using user-defined rules. */
+		/**	
+		 * Sorts all the render operations using user-defined rules. Sort keys for all the elements are packed into 64-bit
+		 * values and sorted using a radix sort, so the sort time is linear in the number of elements. Elements with
+		 * equal keys retain the order they were added in.
+		 */
 		virtual void sort();
 
 		/** Returns a list of sorted render elements. Caller must ensure sort() is called before this method. */
@@ -79,18 +89,20 @@ namespace bs { namespace ct
 		void setStateReduction(StateReduction mode) { mStateReductionMode = mode; }
 
 	protected:
-		/**	Callback used for sorting elements with no material grouping. */
-		static bool elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
-
-		/**	Callback used for sorting elements with preferred material grouping. */
-		static bool elementSorterPreferGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
-
-		/**	Callback used for sorting elements with material grouping after sorting. */
-		static bool elementSorterPreferSort(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
+		/** 
+		 * Encodes the sort key of an element into a 64-bit value, so that sorting the values in ascending order yields
+		 * the rendering order required by the current state reduction mode.
+		 *
+		 * @param[in]	element			Element to encode the key for.
+		 * @param[in]	priorityRank	Rank of the element's priority among all priorities in the queue, with lower rank
+		 *								meaning higher priority.
+		 * @return						Encoded sort key.
+		 */
+		UINT64 encodeSortKey(const SortableElement& element, UINT32 priorityRank) const;
 
 		Vector<SortableElement> mSortableElements;
-		Vector<UINT32> mSortableElementIdx;
 		Vector<RenderableElement*> mElements;
+		Vector<INT32> mPriorities;
 
 		Vector<RenderQueueElement> mSortedRenderElements;
 		StateReduction mStateReductionMode;
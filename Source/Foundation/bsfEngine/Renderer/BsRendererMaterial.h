@@ -172,20 +172,23 @@ namespace bs { namespace ct
 		/** 
 		 * Binds the materials and its parameters to the pipeline. This material will be used for rendering any subsequent
 		 * draw calls, or executing dispatch calls.
+		 *
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *								is executed on the main command buffer.
 		 */
-		void bind() const
+		void bind(const SPtr<CommandBuffer>& commandBuffer = nullptr) const
 		{
 			RenderAPI& rapi = RenderAPI::instance();
 
 			if(mGfxPipeline)
 			{
-				rapi.setGraphicsPipeline(mGfxPipeline);
-				rapi.setStencilRef(mStencilRef);
+				rapi.setGraphicsPipeline(mGfxPipeline, commandBuffer);
+				rapi.setStencilRef(mStencilRef, commandBuffer);
 			}
 			else
-				rapi.setComputePipeline(mComputePipeline);
+				rapi.setComputePipeline(mComputePipeline, commandBuffer);
 
-			rapi.setGpuParams(mParams);
+			rapi.setGpuParams(mParams, commandBuffer);
 		}
 
 	protected:
@@ -14,10 +14,17 @@ namespace bs
 
 		// Note: Ideally I want to avoid loading all materials, and instead just load those that are used. 
 		Vector<RendererMaterialData>& materials = getMaterials();
-		Vector<SPtr<ct::Shader>> shaders;
+
+		// Start all loads before waiting on any, so the shaders are read and deserialized in parallel
+		Vector<HShader> shaderHandles;
+		shaderHandles.reserve(materials.size());
 		for (auto& material : materials)
+			shaderHandles.push_back(br.getShader(material.shaderPath, true));
+
+		Vector<SPtr<ct::Shader>> shaders;
+		for (auto& shader : shaderHandles)
 		{
-			HShader shader = br.getShader(material.shaderPath);
+			shader.blockUntilLoaded();
 			if (shader.isLoaded())
 				shaders.push_back(shader->getCore());
 			else
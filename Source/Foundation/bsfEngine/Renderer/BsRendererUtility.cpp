@@ -148,13 +148,14 @@ namespace bs { namespace ct
 	RendererUtility::~RendererUtility()
 	{ }
 
-	void RendererUtility::setPass(const SPtr<Material>& material, UINT32 passIdx, UINT32 techniqueIdx)
+	void RendererUtility::setPass(const SPtr<Material>& material, UINT32 passIdx, UINT32 techniqueIdx,
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		RenderAPI& rapi = RenderAPI::instance();
 
 		SPtr<Pass> pass = material->getPass(passIdx, techniqueIdx);
-		rapi.setGraphicsPipeline(pass->getGraphicsPipelineState());
-		rapi.setStencilRef(pass->getStencilRefValue());
+		rapi.setGraphicsPipeline(pass->getGraphicsPipelineState(), commandBuffer);
+		rapi.setStencilRef(pass->getStencilRefValue(), commandBuffer);
 	}
 
 	void RendererUtility::setComputePass(const SPtr<Material>& material, UINT32 passIdx)
@@ -165,27 +166,30 @@ namespace bs { namespace ct
 		rapi.setComputePipeline(pass->getComputePipelineState());
 	}
 
-	void RendererUtility::setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx)
+	void RendererUtility::setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx,
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		SPtr<GpuParams> gpuParams = params->getGpuParams(passIdx);
 		if (gpuParams == nullptr)
 			return;
 
 		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setGpuParams(gpuParams);
+		rapi.setGpuParams(gpuParams, commandBuffer);
 	}
 
-	void RendererUtility::draw(const SPtr<MeshBase>& mesh, UINT32 numInstances)
+	void RendererUtility::draw(const SPtr<MeshBase>& mesh, UINT32 numInstances, 
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
-		draw(mesh, mesh->getProperties().getSubMesh(0), numInstances);
+		draw(mesh, mesh->getProperties().getSubMesh(0), numInstances, commandBuffer);
 	}
 
-	void RendererUtility::draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances)
+	void RendererUtility::draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances,
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		RenderAPI& rapi = RenderAPI::instance();
 		SPtr<VertexData> vertexData = mesh->getVertexData();
 
-		rapi.setVertexDeclaration(mesh->getVertexData()->vertexDeclaration);
+		rapi.setVertexDeclaration(mesh->getVertexData()->vertexDeclaration, commandBuffer);
 
 		auto& vertexBuffers = vertexData->getBuffers();
 		if (vertexBuffers.size() > 0)
@@ -208,29 +212,67 @@ namespace bs { namespace ct
 				buffers[iter->first - startSlot] = iter->second;
 			}
 
-			rapi.setVertexBuffers(startSlot, buffers, endSlot - startSlot + 1);
+			rapi.setVertexBuffers(startSlot, buffers, endSlot - startSlot + 1, commandBuffer);
 		}
 
 		SPtr<IndexBuffer> indexBuffer = mesh->getIndexBuffer();
-		rapi.setIndexBuffer(indexBuffer);
+		rapi.setIndexBuffer(indexBuffer, commandBuffer);
 
-		rapi.setDrawOperation(subMesh.drawOp);
+		rapi.setDrawOperation(subMesh.drawOp, commandBuffer);
 
 		UINT32 indexCount = subMesh.indexCount;
 		rapi.drawIndexed(subMesh.indexOffset + mesh->getIndexOffset(), indexCount, mesh->getVertexOffset(), 
-			vertexData->vertexCount, numInstances);
+			vertexData->vertexCount, numInstances, commandBuffer);
+
+		mesh->_notifyUsedOnGPU();
+	}
+
+	void RendererUtility::drawIndirect(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, 
+		const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+		SPtr<VertexData> vertexData = mesh->getVertexData();
+
+		rapi.setVertexDeclaration(vertexData->vertexDeclaration, commandBuffer);
+
+		auto& vertexBuffers = vertexData->getBuffers();
+		if (vertexBuffers.size() > 0)
+		{
+			SPtr<VertexBuffer> buffers[BS_MAX_BOUND_VERTEX_BUFFERS];
+
+			UINT32 endSlot = 0;
+			UINT32 startSlot = BS_MAX_BOUND_VERTEX_BUFFERS;
+			for (auto iter = vertexBuffers.begin(); iter != vertexBuffers.end(); ++iter)
+			{
+				if (iter->first >= BS_MAX_BOUND_VERTEX_BUFFERS)
+					BS_EXCEPT(InvalidParametersException, "Buffer index out of range");
+
+				startSlot = std::min(iter->first, startSlot);
+				endSlot = std::max(iter->first, endSlot);
+			}
+
+			for (auto iter = vertexBuffers.begin(); iter != vertexBuffers.end(); ++iter)
+				buffers[iter->first - startSlot] = iter->second;
+
+			rapi.setVertexBuffers(startSlot, buffers, endSlot - startSlot + 1, commandBuffer);
+		}
+
+		rapi.setIndexBuffer(mesh->getIndexBuffer(), commandBuffer);
+		rapi.setDrawOperation(subMesh.drawOp, commandBuffer);
+		rapi.drawIndexedIndirect(argsBuffer, offset, commandBuffer);
 
 		mesh->_notifyUsedOnGPU();
 	}
 
 	void RendererUtility::drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, 
-		const SPtr<VertexBuffer>& morphVertices, const SPtr<VertexDeclaration>& morphVertexDeclaration)
+		const SPtr<VertexBuffer>& morphVertices, const SPtr<VertexDeclaration>& morphVertexDeclaration, 
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		// Bind buffers and draw
 		RenderAPI& rapi = RenderAPI::instance();
 
 		SPtr<VertexData> vertexData = mesh->getVertexData();
-		rapi.setVertexDeclaration(morphVertexDeclaration);
+		rapi.setVertexDeclaration(morphVertexDeclaration, commandBuffer);
 
 		auto& meshBuffers = vertexData->getBuffers();
 		SPtr<VertexBuffer> allBuffers[BS_MAX_BOUND_VERTEX_BUFFERS];
@@ -253,16 +295,39 @@ namespace bs { namespace ct
 			allBuffers[iter->first - startSlot] = iter->second;
 
 		allBuffers[1] = morphVertices;
-		rapi.setVertexBuffers(startSlot, allBuffers, endSlot - startSlot + 1);
+		rapi.setVertexBuffers(startSlot, allBuffers, endSlot - startSlot + 1, commandBuffer);
+
+		SPtr<IndexBuffer> indexBuffer = mesh->getIndexBuffer();
+		rapi.setIndexBuffer(indexBuffer, commandBuffer);
+
+		rapi.setDrawOperation(subMesh.drawOp, commandBuffer);
+
+		UINT32 indexCount = subMesh.indexCount;
+		rapi.drawIndexed(subMesh.indexOffset + mesh->getIndexOffset(), indexCount, mesh->getVertexOffset(),
+			vertexData->vertexCount, 1, commandBuffer);
+
+		mesh->_notifyUsedOnGPU();
+	}
+
+	void RendererUtility::drawSkinned(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, 
+		const SPtr<VertexBuffer>& skinnedVertices, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+		SPtr<VertexData> vertexData = mesh->getVertexData();
+
+		rapi.setVertexDeclaration(vertexData->vertexDeclaration, commandBuffer);
+
+		SPtr<VertexBuffer> buffers[] = { skinnedVertices };
+		rapi.setVertexBuffers(0, buffers, 1, commandBuffer);
 
 		SPtr<IndexBuffer> indexBuffer = mesh->getIndexBuffer();
-		rapi.setIndexBuffer(indexBuffer);
+		rapi.setIndexBuffer(indexBuffer, commandBuffer);
 
-		rapi.setDrawOperation(subMesh.drawOp);
+		rapi.setDrawOperation(subMesh.drawOp, commandBuffer);
 
 		UINT32 indexCount = subMesh.indexCount;
 		rapi.drawIndexed(subMesh.indexOffset + mesh->getIndexOffset(), indexCount, mesh->getVertexOffset(),
-			vertexData->vertexCount, 1);
+			vertexData->vertexCount, 1, commandBuffer);
 
 		mesh->_notifyUsedOnGPU();
 	}
@@ -26,7 +26,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("MSAA_COUNT", msaa),
 				ShaderVariation::Param("COLOR", color),
 			});
@@ -91,10 +91,11 @@ namespace bs { namespace ct
 		 * @param[in]	material		Material containing the pass.
 		 * @param[in]	passIdx			Index of the pass in the material.
 		 * @param[in]	techniqueIdx	Index of the technique the pass belongs to, if the material has multiple techniques.
-		 *
-		 * @note	Core thread.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *							is executed on the main command buffer.
 		 */
-		void setPass(const SPtr<Material>& material, UINT32 passIdx = 0, UINT32 techniqueIdx = 0);
+		void setPass(const SPtr<Material>& material, UINT32 passIdx = 0, UINT32 techniqueIdx = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Activates the specified material pass for compute. Any further dispatch calls will be executed using this pass.
@@ -109,22 +110,24 @@ namespace bs { namespace ct
 		/**
 		 * Sets parameters (textures, samplers, buffers) for the currently active pass.
 		 *
-		 * @param[in]	params		Object containing the parameters.
-		 * @param[in]	passIdx		Pass for which to set the parameters.
-		 *					
-		 * @note	Core thread.
+		 * @param[in]	params			Object containing the parameters.
+		 * @param[in]	passIdx			Pass for which to set the parameters.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *							is executed on the main command buffer.
 		 */
-		void setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx = 0);
+		void setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draws the specified mesh.
 		 *
 		 * @param[in]	mesh			Mesh to draw.
 		 * @param[in]	numInstances	Number of times to draw the mesh using instanced rendering.
-		 *
-		 * @note	Core thread.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *							is executed on the main command buffer.
 		 */
-		void draw(const SPtr<MeshBase>& mesh, UINT32 numInstances = 1);
+		void draw(const SPtr<MeshBase>& mesh, UINT32 numInstances = 1, 
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draws the specified mesh.
@@ -132,10 +135,26 @@ namespace bs { namespace ct
 		 * @param[in]	mesh			Mesh to draw.
 		 * @param[in]	subMesh			Portion of the mesh to draw.
 		 * @param[in]	numInstances	Number of times to draw the mesh using instanced rendering.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *							is executed on the main command buffer.
+		 */
+		void draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/**
+		 * Draws the specified mesh using an indexed draw call whose arguments are read from a GPU buffer. The mesh's
+		 * vertex and index buffers are bound, but the index range, vertex offset and instance count are taken from the
+		 * buffer, allowing them to be generated on the GPU. Requires the RSC_DRAW_INDIRECT capability.
 		 *
-		 * @note	Core thread.
+		 * @param[in]	mesh			Mesh whose buffers to bind.
+		 * @param[in]	subMesh			Portion of the mesh to draw. Only used for determining the draw operation.
+		 * @param[in]	argsBuffer		Buffer of GBT_INDIRECTARGUMENT type containing DrawIndexedIndirectArgs.
+		 * @param[in]	offset			Offset into @p argsBuffer at which the arguments start, in bytes.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *							is executed on the main command buffer.
 		 */
-		void draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1);
+		void drawIndirect(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, const SPtr<GpuBuffer>& argsBuffer,
+			UINT32 offset = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draws the specified mesh with an additional vertex buffer containing morph shape vertices.
@@ -146,11 +165,26 @@ namespace bs { namespace ct
 		 *										Expected to contain the same number of vertices as the source mesh.
 		 * @param[in]	morphVertexDeclaration	Vertex declaration describing vertices of the provided mesh and the vertices
 		 *										provided in the morph vertex buffer.
-		 *
-		 * @note	Core thread.
+		 * @param[in]	commandBuffer			Optional command buffer to queue the operation on. If not provided
+		 *										operation is executed on the main command buffer.
 		 */
 		void drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, const SPtr<VertexBuffer>& morphVertices, 
-			const SPtr<VertexDeclaration>& morphVertexDeclaration);
+			const SPtr<VertexDeclaration>& morphVertexDeclaration, const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/**
+		 * Draws the specified mesh using vertices that were already transformed by a skinning pass, instead of the
+		 * mesh's own vertices.
+		 *
+		 * @param[in]	mesh				Mesh to draw. Must have a single vertex stream.
+		 * @param[in]	subMesh				Portion of the mesh to draw.
+		 * @param[in]	skinnedVertices		Buffer containing the skinned vertices. Will be bound to stream 0 using the
+		 *									mesh's vertex declaration. Expected to contain the same number of vertices
+		 *									as the source mesh.
+		 * @param[in]	commandBuffer		Optional command buffer to queue the operation on. If not provided
+		 *									operation is executed on the main command buffer.
+		 */
+		void drawSkinned(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, const SPtr<VertexBuffer>& skinnedVertices,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Blits contents of the provided texture into the currently bound render target. If the provided texture contains
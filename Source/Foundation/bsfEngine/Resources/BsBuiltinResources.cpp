@@ -81,6 +81,7 @@ namespace bs
 	/************************************************************************/
 
 	const String BuiltinResources::ShaderSpriteTextFile = u8"SpriteText.bsl";
+	const String BuiltinResources::ShaderSpriteTextDistanceFieldFile = u8"SpriteTextDistanceField.bsl";
 	const String BuiltinResources::ShaderSpriteImageAlphaFile = u8"SpriteImageAlpha.bsl";
 	const String BuiltinResources::ShaderSpriteImageNoAlphaFile = u8"SpriteImageNoAlpha.bsl";
 	const String BuiltinResources::ShaderSpriteLineFile = u8"SpriteLine.bsl";
@@ -215,13 +216,34 @@ namespace bs
 			}
 		}
 
-		// Load basic resources
-		mShaderSpriteText = getShader(ShaderSpriteTextFile);
-		mShaderSpriteImage = getShader(ShaderSpriteImageAlphaFile);
-		mShaderSpriteNonAlphaImage = getShader(ShaderSpriteImageNoAlphaFile);
-		mShaderSpriteLine = getShader(ShaderSpriteLineFile);
-		mShaderDiffuse = getShader(ShaderDiffuseFile);
-		mShaderTransparent = getShader(ShaderTransparentFile);
+		// Start loading all resources at once so they are read and deserialized in parallel, and only wait on them
+		// once they're needed
+		mShaderSpriteText = getShader(ShaderSpriteTextFile, true);
+		mShaderSpriteTextDistanceField = getShader(ShaderSpriteTextDistanceFieldFile, true);
+		mShaderSpriteImage = getShader(ShaderSpriteImageAlphaFile, true);
+		mShaderSpriteNonAlphaImage = getShader(ShaderSpriteImageNoAlphaFile, true);
+		mShaderSpriteLine = getShader(ShaderSpriteLineFile, true);
+		mShaderDiffuse = getShader(ShaderDiffuseFile, true);
+		mShaderTransparent = getShader(ShaderTransparentFile, true);
+
+		mFont = gResources().loadAsync<Font>(mBuiltinDataFolder + (DefaultFontFilename + u8".asset"));
+		mSkin = gResources().loadAsync<GUISkin>(mBuiltinDataFolder + (GUISkinFile + u8".asset"));
+
+		HTexture cursorArrowTex = getCursorTexture(CursorArrowTex, true);
+		HTexture cursorArrowDragTex = getCursorTexture(CursorArrowDragTex, true);
+		HTexture cursorArrowLeftRightTex = getCursorTexture(CursorArrowLeftRightTex, true);
+		HTexture cursorIBeamTex = getCursorTexture(CursorIBeamTex, true);
+		HTexture cursorDenyTex = getCursorTexture(CursorDenyTex, true);
+		HTexture cursorWaitTex = getCursorTexture(CursorWaitTex, true);
+		HTexture cursorSizeNESWTex = getCursorTexture(CursorSizeNESWTex, true);
+		HTexture cursorSizeNSTex = getCursorTexture(CursorSizeNSTex, true);
+		HTexture cursorSizeNWSETex = getCursorTexture(CursorSizeNWSETex, true);
+		HTexture cursorSizeWETex = getCursorTexture(CursorSizeWETex, true);
+
+		Path iconPath = mBuiltinDataFolder + ICON_FOLDER;
+		iconPath.append(String(IconTextureName) + u8".asset");
+
+		HTexture iconTex = gResources().loadAsync<Texture>(iconPath);
 
 		SPtr<PixelData> dummyPixelData = PixelData::create(2, 2, 1, PF_RGBA8);
 
@@ -235,24 +257,17 @@ namespace bs
 		mWhiteSpriteTexture = getSkinTexture(WhiteTex);
 		mDummySpriteTexture = SpriteTexture::create(mDummyTexture);
 
-		mFont = gResources().load<Font>(mBuiltinDataFolder + (DefaultFontFilename + u8".asset"));
-		mSkin = gResources().load<GUISkin>(mBuiltinDataFolder + (GUISkinFile + u8".asset"));
 		mEmptySkin = GUISkin::create();
 
 		/************************************************************************/
 		/* 								CURSOR		                     		*/
 		/************************************************************************/
 
-		HTexture cursorArrowTex = getCursorTexture(CursorArrowTex);
-		HTexture cursorArrowDragTex = getCursorTexture(CursorArrowDragTex);
-		HTexture cursorArrowLeftRightTex = getCursorTexture(CursorArrowLeftRightTex);
-		HTexture cursorIBeamTex = getCursorTexture(CursorIBeamTex);
-		HTexture cursorDenyTex = getCursorTexture(CursorDenyTex);
-		HTexture cursorWaitTex = getCursorTexture(CursorWaitTex);
-		HTexture cursorSizeNESWTex = getCursorTexture(CursorSizeNESWTex);
-		HTexture cursorSizeNSTex = getCursorTexture(CursorSizeNSTex);
-		HTexture cursorSizeNWSETex = getCursorTexture(CursorSizeNWSETex);
-		HTexture cursorSizeWETex = getCursorTexture(CursorSizeWETex);
+		for (auto& cursorTex : { cursorArrowTex, cursorArrowDragTex, cursorArrowLeftRightTex, cursorIBeamTex,
+			cursorDenyTex, cursorWaitTex, cursorSizeNESWTex, cursorSizeNSTex, cursorSizeNWSETex, cursorSizeWETex })
+		{
+			cursorTex.blockUntilLoaded();
+		}
 
 		mCursorArrow = cursorArrowTex->getProperties().allocBuffer(0, 0);
 		cursorArrowTex->readData(mCursorArrow);
@@ -288,14 +303,21 @@ namespace bs
 		/* 								ICON		                     		*/
 		/************************************************************************/
 
-		Path iconPath = mBuiltinDataFolder + ICON_FOLDER;
-		iconPath.append(String(IconTextureName) + u8".asset");
-
-		HTexture iconTex = gResources().load<Texture>(iconPath);
+		iconTex.blockUntilLoaded();
 
 		mFrameworkIcon = iconTex->getProperties().allocBuffer(0, 0);
 		iconTex->readData(mFrameworkIcon);
 
+		// Users expect the remaining resources to be usable as soon as the module starts
+		for (auto& shader : { mShaderSpriteText, mShaderSpriteTextDistanceField, mShaderSpriteImage,
+			mShaderSpriteNonAlphaImage, mShaderSpriteLine, mShaderDiffuse, mShaderTransparent })
+		{
+			shader.blockUntilLoaded();
+		}
+
+		mFont.blockUntilLoaded();
+		mSkin.blockUntilLoaded();
+
 		gCoreThread().submit(true);
 	}
 
@@ -486,7 +508,8 @@ namespace bs
 				mResourceManifest,
 				BuiltinResourcesHelper::AssetType::Normal,
 				&shaderDependenciesJSON,
-				true);
+				true,
+				rawShaderIncludeFolder);
 		}
 
 		// Import GUI sprites
@@ -708,20 +731,26 @@ namespace bs
 		return gResources().load<SpriteTexture>(texturePath);
 	}
 
-	HShader BuiltinResources::getShader(const Path& path) const
+	HShader BuiltinResources::getShader(const Path& path, bool async) const
 	{
 		Path programPath = mEngineShaderFolder;
 		programPath.append(path);
 		programPath.setExtension(programPath.getExtension() + ".asset");
 
+		if (async)
+			return gResources().loadAsync<Shader>(programPath);
+
 		return gResources().load<Shader>(programPath);
 	}
 
-	HTexture BuiltinResources::getCursorTexture(const String& name) const
+	HTexture BuiltinResources::getCursorTexture(const String& name, bool async) const
 	{
 		Path cursorPath = mEngineCursorFolder;
 		cursorPath.append(name + u8".asset");
 
+		if (async)
+			return gResources().loadAsync<Texture>(cursorPath);
+
 		return gResources().load<Texture>(cursorPath);
 	}
 
@@ -872,6 +901,11 @@ namespace bs
 		return Material::create(mShaderSpriteText);
 	}
 
+	HMaterial BuiltinResources::createSpriteTextDistanceFieldMaterial() const
+	{
+		return Material::create(mShaderSpriteTextDistanceField);
+	}
+
 	HMaterial BuiltinResources::createSpriteImageMaterial() const
 	{
 		return Material::create(mShaderSpriteImage);
@@ -99,6 +99,9 @@ namespace bs
 		/**	Creates a material used for textual sprite rendering (for example text in GUI). */
 		HMaterial createSpriteTextMaterial() const;
 
+		/**	Creates a material used for textual sprite rendering using distance field fonts. */
+		HMaterial createSpriteTextDistanceFieldMaterial() const;
+
 		/**	Creates a material used for image sprite rendering (for example images in GUI). */
 		HMaterial createSpriteImageMaterial() const;
 
@@ -115,8 +118,11 @@ namespace bs
 		 * Loads a shader at the specified path.
 		 * 
 		 * @param[in]	path	Path relative to the default shader folder with no file extension.
+		 * @param[in]	async	If true the shader is loaded asynchronously, and the returned handle must be waited on
+		 *						(see ResourceHandle::blockUntilLoaded) before use. Starting many loads this way before
+		 *						waiting on any allows them to be read and deserialized in parallel.
 		 */
-		HShader getShader(const Path& path) const;
+		HShader getShader(const Path& path, bool async = false) const;
 
 		/** Returns the default font used by the engine. */
 		HFont getDefaultFont() const { return mFont; }
@@ -157,8 +163,8 @@ namespace bs
 		/**	Loads a GUI skin texture with the specified filename. */
 		HSpriteTexture getSkinTexture(const String& name) const;
 
-		/**	Loads a cursor texture with the specified filename. */
-		HTexture getCursorTexture(const String& name) const;
+		/**	Loads a cursor texture with the specified filename. See getShader() for the meaning of @p async. */
+		HTexture getCursorTexture(const String& name, bool async = false) const;
 
 		HGUISkin mEmptySkin;
 		HGUISkin mSkin;
@@ -182,6 +188,7 @@ namespace bs
 		HTexture mDummyTexture;
 
 		HShader mShaderSpriteText;
+		HShader mShaderSpriteTextDistanceField;
 		HShader mShaderSpriteImage;
 		HShader mShaderSpriteNonAlphaImage;
 		HShader mShaderSpriteLine;
@@ -240,6 +247,7 @@ namespace bs
 		static const Vector2I CursorSizeWEHotspot;
 
 		static const String ShaderSpriteTextFile;
+		static const String ShaderSpriteTextDistanceFieldFile;
 		static const String ShaderSpriteImageAlphaFile;
 		static const String ShaderSpriteImageNoAlphaFile;
 		static const String ShaderSpriteLineFile;
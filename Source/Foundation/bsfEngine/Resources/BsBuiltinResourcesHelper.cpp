@@ -20,14 +20,28 @@
 #include "Material/BsShader.h"
 #include "Material/BsPass.h"
 #include "RenderAPI/BsGpuProgram.h"
+#include "Utility/BsUtil.h"
 
 using json = nlohmann::json;
 
 namespace bs
 {
+	/** Returns a hash of the contents of the file at the specified path, or an empty string if it cannot be read. */
+	static String hashFileContents(const Path& path)
+	{
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		if (stream == nullptr)
+			return StringUtil::BLANK;
+
+		String contents = stream->getAsString();
+		stream->close();
+
+		return md5(contents);
+	}
+
 	void BuiltinResourcesHelper::importAssets(const nlohmann::json& entries, const Vector<bool>& importFlags, 
 		const Path& inputFolder, const Path& outputFolder, const SPtr<ResourceManifest>& manifest, AssetType mode,
-		nlohmann::json* dependencies, bool compress)
+		nlohmann::json* dependencies, bool compress, const Path& dependencyFolder)
 	{
 		if (!FileSystem::exists(inputFolder))
 			return;
@@ -194,6 +208,13 @@ namespace bs
 										{ "Path", includePath.toString().c_str() }
 									};
 
+									if (!dependencyFolder.isEmpty())
+									{
+										String hash = hashFileContents(dependencyFolder + includePath);
+										if (!hash.empty())
+											newDependencyEntry["Hash"] = hash.c_str();
+									}
+
 									dependencyEntries.push_back(newDependencyEntry);
 								}
 							}
@@ -339,6 +360,31 @@ namespace bs
 	Vector<bool> BuiltinResourcesHelper::generateImportFlags(const nlohmann::json& entries, const Path& inputFolder,
 		time_t lastUpdateTime, bool forceImport, const nlohmann::json* dependencies, const Path& dependencyFolder)
 	{
+		// Dependencies are usually shared by many entries, so hash the contents of each one only once
+		UnorderedMap<Path, String> dependencyHashes;
+		auto isDependencyModified = [&](const nlohmann::json& dependency)
+		{
+			std::string dependencyName = dependency["Path"];
+			Path dependencyPath = dependencyFolder + Path(dependencyName.c_str());
+
+			time_t lastModifiedDep = FileSystem::getLastModifiedTime(dependencyPath);
+			if (lastModifiedDep <= lastUpdateTime)
+				return false;
+
+			// Saving a file updates its timestamp even if the contents didn't change, in which case there is no need to
+			// reimport the dependent entries
+			auto iterFindHash = dependency.find("Hash");
+			if (iterFindHash == dependency.end())
+				return true;
+
+			auto iterFind = dependencyHashes.find(dependencyPath);
+			if (iterFind == dependencyHashes.end())
+				iterFind = dependencyHashes.insert(std::make_pair(dependencyPath, hashFileContents(dependencyPath))).first;
+
+			std::string recordedHash = *iterFindHash;
+			return iterFind->second != recordedHash.c_str();
+		};
+
 		Vector<bool> output(entries.size());
 		UINT32 idx = 0;
 		for (auto& entry : entries)
@@ -363,11 +409,7 @@ namespace bs
 					{
 						for(auto& dependency : *iterFind)
 						{
-							std::string dependencyName = dependency["Path"];
-							Path dependencyPath = dependencyFolder + Path(dependencyName.c_str());
-
-							time_t lastModifiedDep = FileSystem::getLastModifiedTime(dependencyPath);
-							if(lastModifiedDep > lastUpdateTime)
+							if(isDependencyModified(dependency))
 							{
 								anyDepModified = true;
 								break;
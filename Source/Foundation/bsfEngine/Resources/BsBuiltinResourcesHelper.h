@@ -44,10 +44,12 @@ namespace bs
 		 * @param[in]	mode			Mode that controls how are files imported.
 		 * @param[in]	dependencies	Optional map that be updated with any dependencies the imported assets depend on.
 		 * @param[in]	compress		True if the imported asset should be compressed when saved to the disk.
+		 * @param[in]	dependencyFolder	Folder in which dependency files reside. If provided, a hash of the dependency
+		 *									contents is recorded along with each entry in @p dependencies.
 		 */
 		static void importAssets(const nlohmann::json& entries, const Vector<bool>& importFlags, const Path& inputFolder, 
 			const Path& outputFolder, const SPtr<ResourceManifest>& manifest, AssetType mode = AssetType::Normal,
-			nlohmann::json* dependencies = nullptr, bool compress = false);
+			nlohmann::json* dependencies = nullptr, bool compress = false, const Path& dependencyFolder = Path::BLANK);
 
 		/**
 		 * Imports a font from the specified file. Imported font assets are saved in the output folder. All saved resources
@@ -67,7 +69,8 @@ namespace bs
 		 * @param[in]	forceImport			If true, all entries will be marked for import.
 		 * @param[in]	dependencies		Optional map of entries that map each entry in the @p entries array, to a list
 		 *									of dependencies. The dependencies will then also be checked for modifications
-		 *									and if modified the entry will be marked for reimport.
+		 *									and if modified the entry will be marked for reimport. Dependencies that have
+		 *									a recorded hash are only considered modified if their contents changed.
 		 * @param[in]	dependencyFolder	Folder in which dependeny files reside. Only relevant if @p dependencies is
 		 *									provided.
 		 * @return							An array of the same size as the @p entries array, containing value true if
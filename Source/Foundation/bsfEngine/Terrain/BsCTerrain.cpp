@@ -0,0 +1,114 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Terrain/BsCTerrain.h"
+#include "Terrain/BsTerrainManager.h"
+#include "Physics/BsHeightField.h"
+#include "Image/BsTexture.h"
+#include "Private/RTTI/BsCTerrainRTTI.h"
+
+namespace bs
+{
+	CTerrain::CTerrain()
+		: mLayerTextures(NUM_LAYERS), mLayerTiling(NUM_LAYERS, 1.0f)
+	{
+		setName("Terrain");
+
+		mNotifyFlags = TCF_Transform;
+	}
+
+	CTerrain::CTerrain(const HSceneObject& parent)
+		: Component(parent), mLayerTextures(NUM_LAYERS), mLayerTiling(NUM_LAYERS, 1.0f)
+	{
+		setName("Terrain");
+
+		mNotifyFlags = TCF_Transform;
+	}
+
+	void CTerrain::setHeightField(const HHeightField& heightField)
+	{
+		mHeightField = heightField;
+		mCoreDirty = true;
+		mHeightsDirty = true;
+	}
+
+	void CTerrain::setSplatMap(const HTexture& splatMap)
+	{
+		mSplatMap = splatMap;
+		mCoreDirty = true;
+	}
+
+	void CTerrain::setLayerTexture(UINT32 idx, const HTexture& texture)
+	{
+		if (idx >= NUM_LAYERS)
+			return;
+
+		mLayerTextures[idx] = texture;
+		mCoreDirty = true;
+	}
+
+	HTexture CTerrain::getLayerTexture(UINT32 idx) const
+	{
+		if (idx >= NUM_LAYERS)
+			return HTexture();
+
+		return mLayerTextures[idx];
+	}
+
+	void CTerrain::setLayerTiling(UINT32 idx, float tiling)
+	{
+		if (idx >= NUM_LAYERS)
+			return;
+
+		mLayerTiling[idx] = tiling;
+		mCoreDirty = true;
+	}
+
+	float CTerrain::getLayerTiling(UINT32 idx) const
+	{
+		if (idx >= NUM_LAYERS)
+			return 1.0f;
+
+		return mLayerTiling[idx];
+	}
+
+	void CTerrain::setLodDistance(float distance)
+	{
+		mLodDistance = std::max(distance, 0.0f);
+		mCoreDirty = true;
+	}
+
+	void CTerrain::setLayer(UINT64 layer)
+	{
+		mLayer = layer;
+		mCoreDirty = true;
+	}
+
+	void CTerrain::onEnabled()
+	{
+		// Renderer discards the terrain's resources when it is disabled, so everything needs to be sent again
+		mCoreDirty = true;
+		mHeightsDirty = true;
+
+		TerrainManager::instance()._registerTerrain(this);
+	}
+
+	void CTerrain::onDisabled()
+	{
+		TerrainManager::instance()._unregisterTerrain(this);
+	}
+
+	void CTerrain::onTransformChanged(TransformChangedFlags flags)
+	{
+		mCoreDirty = true;
+	}
+
+	RTTITypeBase* CTerrain::getRTTIStatic()
+	{
+		return CTerrainRTTI::instance();
+	}
+
+	RTTITypeBase* CTerrain::getRTTI() const
+	{
+		return CTerrain::getRTTIStatic();
+	}
+}
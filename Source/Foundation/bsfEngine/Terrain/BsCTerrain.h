@@ -0,0 +1,144 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Scene/BsComponent.h"
+
+namespace bs
+{
+	/** @addtogroup Terrain
+	 *  @{
+	 */
+
+	/**
+	 * Renders a terrain described by a HeightField, positioned, oriented and sized by the parent scene object. In local
+	 * space the terrain spans [0, 1] range on all axes, so the scale of the scene object determines its width, height
+	 * and length. Detail is reduced with distance from the camera using a quadtree whose nodes are selected on the GPU.
+	 *
+	 * The surface is textured by blending between four layers, using the weights stored in the four channels of the
+	 * splat map. Add a CHeightFieldCollider using the same height field to make the terrain collidable.
+	 */
+	class BS_EXPORT CTerrain : public Component
+	{
+	public:
+		/** Number of texture layers that can be blended together on the terrain surface. */
+		static constexpr UINT32 NUM_LAYERS = 4;
+
+		CTerrain(const HSceneObject& parent);
+		virtual ~CTerrain() = default;
+
+		/** Determines the height field describing the shape of the terrain. */
+		void setHeightField(const HHeightField& heightField);
+
+		/** @copydoc setHeightField */
+		const HHeightField& getHeightField() const { return mHeightField; }
+
+		/**
+		 * Determines the texture whose red, green, blue and alpha channels contain the weights of the first, second,
+		 * third and fourth layer respectively. Weights are normalized so they sum up to one. If not set, only the first
+		 * layer is visible.
+		 */
+		void setSplatMap(const HTexture& splatMap);
+
+		/** @copydoc setSplatMap */
+		const HTexture& getSplatMap() const { return mSplatMap; }
+
+		/** Determines the albedo texture of the layer at the specified index, in range [0, NUM_LAYERS). */
+		void setLayerTexture(UINT32 idx, const HTexture& texture);
+
+		/** @copydoc setLayerTexture */
+		HTexture getLayerTexture(UINT32 idx) const;
+
+		/**
+		 * Determines how many times the texture of the layer at the specified index repeats over the terrain. Index is
+		 * in range [0, NUM_LAYERS).
+		 */
+		void setLayerTiling(UINT32 idx, float tiling);
+
+		/** @copydoc setLayerTiling */
+		float getLayerTiling(UINT32 idx) const;
+
+		/**
+		 * Determines the distance from the camera, in world units, at which the terrain switches from the highest
+		 * detail to the next lower level of detail. Each further level doubles the distance. Too small values are
+		 * raised so that neighboring parts of the terrain never differ by more than one level.
+		 */
+		void setLodDistance(float distance);
+
+		/** @copydoc setLodDistance */
+		float getLodDistance() const { return mLodDistance; }
+
+		/**
+		 * Determines the layer bitfield that controls whether the terrain is considered visible in a specific camera.
+		 * Layer must match camera layer in order for the camera to render the terrain.
+		 */
+		void setLayer(UINT64 layer);
+
+		/** @copydoc setLayer */
+		UINT64 getLayer() const { return mLayer; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns an identifier uniquely identifying this terrain while it is registered with the manager. */
+		UINT32 _getId() const { return mId; }
+
+		/** Assigns an identifier uniquely identifying this terrain while it is registered with the manager. */
+		void _setId(UINT32 id) { mId = id; }
+
+		/** Returns true if any of the properties changed since the last call to _markCoreClean(). */
+		bool _isCoreDirty() const { return mCoreDirty; }
+
+		/** Returns true if the height field changed since the last call to _markCoreClean(). */
+		bool _areHeightsDirty() const { return mHeightsDirty; }
+
+		/** Marks the terrain as synced with the renderer. */
+		void _markCoreClean() { mCoreDirty = false; mHeightsDirty = false; }
+
+		/** Marks the terrain as requiring a sync with the renderer. Height field is only synced if it changed. */
+		void _markCoreDirty() { mCoreDirty = true; }
+
+		/** @} */
+	protected:
+		HHeightField mHeightField;
+		HTexture mSplatMap;
+		Vector<HTexture> mLayerTextures;
+		Vector<float> mLayerTiling;
+		float mLodDistance = 20.0f;
+		UINT64 mLayer = 1;
+
+		UINT32 mId = 0;
+		bool mCoreDirty = true;
+		bool mHeightsDirty = true;
+
+		/************************************************************************/
+		/* 						COMPONENT OVERRIDES                      		*/
+		/************************************************************************/
+	protected:
+		friend class SceneObject;
+
+		/** @copydoc Component::onEnabled */
+		void onEnabled() override;
+
+		/** @copydoc Component::onDisabled */
+		void onDisabled() override;
+
+		/** @copydoc Component::onTransformChanged */
+		void onTransformChanged(TransformChangedFlags flags) override;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class CTerrainRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+
+	protected:
+		CTerrain(); // Serialization only
+	};
+
+	/** @} */
+}
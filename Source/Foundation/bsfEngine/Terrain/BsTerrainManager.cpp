@@ -0,0 +1,115 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Terrain/BsTerrainManager.h"
+#include "Terrain/BsCTerrain.h"
+#include "Terrain/BsTerrainRenderer.h"
+#include "Physics/BsHeightField.h"
+#include "Scene/BsSceneObject.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
+#include "CoreThread/BsCoreThread.h"
+
+namespace bs
+{
+	TerrainManager::TerrainManager()
+	{
+		mRenderer = RendererExtension::create<ct::TerrainRenderer>(nullptr);
+	}
+
+	void TerrainManager::_registerTerrain(CTerrain* terrain)
+	{
+		terrain->_setId(mNextId++);
+		mTerrains.push_back(terrain);
+		mDirty = true;
+	}
+
+	void TerrainManager::_unregisterTerrain(CTerrain* terrain)
+	{
+		auto iterFind = std::find(mTerrains.begin(), mTerrains.end(), terrain);
+		if (iterFind != mTerrains.end())
+		{
+			std::swap(*iterFind, mTerrains.back());
+			mTerrains.pop_back();
+			mDirty = true;
+		}
+	}
+
+	void TerrainManager::_update()
+	{
+		for (auto& terrain : mTerrains)
+			mDirty |= terrain->_isCoreDirty();
+
+		if (!mDirty)
+			return;
+
+		TerrainRenderDataSet renderData;
+		renderData.terrains.reserve(mTerrains.size());
+
+		bool allLoaded = true;
+		for (auto& terrain : mTerrains)
+		{
+			const HHeightField& heightField = terrain->getHeightField();
+			if (!heightField.isLoaded())
+			{
+				// Keep the terrain dirty so it gets sent once its height field finishes loading
+				allLoaded &= heightField == nullptr;
+				continue;
+			}
+
+			TerrainRenderData terrainData;
+			terrainData.id = terrain->_getId();
+			terrainData.worldTfrm = terrain->SO()->getWorldMatrix();
+			terrainData.layer = terrain->getLayer();
+			terrainData.lodDistance = terrain->getLodDistance();
+
+			if (terrain->_areHeightsDirty())
+			{
+				UINT32 numRows = heightField->getNumRows();
+				UINT32 numColumns = heightField->getNumColumns();
+
+				SPtr<PixelData> heights = PixelData::create(numColumns, numRows, 1, PF_R32F);
+				UINT32 rowPitch = heights->getRowPitch();
+				float* dst = (float*)heights->getData();
+
+				const Vector<float>& src = heightField->getHeights();
+				for (UINT32 row = 0; row < numRows; row++)
+					memcpy(dst + row * rowPitch, &src[row * numColumns], numColumns * sizeof(float));
+
+				terrainData.heights = heights;
+			}
+
+			bool texturesLoaded = true;
+			const HTexture& splatMap = terrain->getSplatMap();
+			if (splatMap.isLoaded())
+				terrainData.splatMap = splatMap->getCore();
+			else
+				texturesLoaded &= splatMap == nullptr;
+
+			for (UINT32 i = 0; i < CTerrain::NUM_LAYERS; i++)
+			{
+				HTexture layerTexture = terrain->getLayerTexture(i);
+				if (layerTexture.isLoaded())
+					terrainData.layerTextures[i] = layerTexture->getCore();
+				else
+					texturesLoaded &= layerTexture == nullptr;
+
+				terrainData.layerTiling[i] = terrain->getLayerTiling(i);
+			}
+
+			renderData.terrains.push_back(std::move(terrainData));
+
+			// Heights were sent, but textures that are still loading need to be sent again later
+			terrain->_markCoreClean();
+			if (!texturesLoaded)
+			{
+				terrain->_markCoreDirty();
+				allLoaded = false;
+			}
+		}
+
+		mDirty = !allLoaded;
+
+		ct::TerrainRenderer* renderer = mRenderer.get();
+		gCoreThread().queueCommand(std::bind(&ct::TerrainRenderer::updateData, renderer, std::move(renderData)));
+	}
+}
@@ -0,0 +1,44 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	namespace ct { class TerrainRenderer; }
+
+	/** @addtogroup Terrain-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of all active terrains and forwards their state to the renderer. Data is only sent when a terrain
+	 * changes, and the height samples only when the height field itself changes, as the renderer keeps the GPU
+	 * resources built from them.
+	 */
+	class BS_EXPORT TerrainManager : public Module<TerrainManager>
+	{
+	public:
+		TerrainManager();
+
+		/** Registers a new terrain to be rendered. */
+		void _registerTerrain(CTerrain* terrain);
+
+		/** Unregisters a terrain, removing it from the renderer. */
+		void _unregisterTerrain(CTerrain* terrain);
+
+		/** Sends the state of all registered terrains to the renderer, if any of them changed. */
+		void _update();
+
+	private:
+		Vector<CTerrain*> mTerrains;
+		UINT32 mNextId = 1;
+		bool mDirty = false;
+
+		SPtr<ct::TerrainRenderer> mRenderer;
+	};
+
+	/** @} */
+}
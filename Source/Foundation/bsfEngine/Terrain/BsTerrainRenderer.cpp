@@ -0,0 +1,427 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Terrain/BsTerrainRenderer.h"
+#include "Renderer/BsCamera.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsIndexBuffer.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "RenderAPI/BsVertexDeclaration.h"
+#include "Material/BsGpuParamsSet.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
+#include "Math/BsAABox.h"
+#include "Math/BsConvexVolume.h"
+
+namespace bs { namespace ct
+{
+	static const UINT32 THREADGROUP_SIZE = 64;
+	static const UINT32 PATCH_INDEX_COUNT = TerrainRenderer::PATCH_SIZE * TerrainRenderer::PATCH_SIZE * 6;
+
+	TerrainSelectParamsDef gTerrainSelectParamsDef;
+	TerrainDrawParamsDef gTerrainDrawParamsDef;
+
+	TerrainSelectMat::TerrainSelectMat()
+	{
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gNodeHeights", mNodeHeightsParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gInstances", mInstancesParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gCounter", mCounterParam);
+	}
+
+	void TerrainSelectMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("THREADGROUP_SIZE", THREADGROUP_SIZE);
+	}
+
+	void TerrainSelectMat::execute(const SPtr<GpuParamBlockBuffer>& params, UINT32 numNodes,
+		const SPtr<GpuBuffer>& nodeHeights, const SPtr<GpuBuffer>& instances, const SPtr<GpuBuffer>& counter)
+	{
+		mParams->setParamBlockBuffer("Params", params);
+		mNodeHeightsParam.set(nodeHeights);
+		mInstancesParam.set(instances);
+		mCounterParam.set(counter);
+
+		UINT32 numGroups = Math::divideAndRoundUp(numNodes, THREADGROUP_SIZE);
+
+		bind();
+		RenderAPI::instance().dispatchCompute(numGroups);
+	}
+
+	TerrainIndirectArgsMat::TerrainIndirectArgsMat()
+	{
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gCounter", mCounterParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDrawArgs", mDrawArgsParam);
+	}
+
+	void TerrainIndirectArgsMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("PATCH_INDEX_COUNT", PATCH_INDEX_COUNT);
+	}
+
+	void TerrainIndirectArgsMat::execute(const SPtr<GpuBuffer>& counter, const SPtr<GpuBuffer>& drawArgs)
+	{
+		mCounterParam.set(counter);
+		mDrawArgsParam.set(drawArgs);
+
+		bind();
+		RenderAPI::instance().dispatchCompute(1);
+	}
+
+	TerrainDrawMat::TerrainDrawMat()
+	{
+		mParams->getBufferParam(GPT_VERTEX_PROGRAM, "gInstances", mInstancesParam);
+		mParams->getTextureParam(GPT_VERTEX_PROGRAM, "gHeightmap", mHeightmapParam);
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gHeightmap", mHeightmapFragParam);
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gSplatMap", mSplatMapParam);
+
+		for (UINT32 i = 0; i < 4; i++)
+			mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gLayer" + toString(i), mLayerParams[i]);
+	}
+
+	void TerrainDrawMat::execute(const SPtr<GpuParamBlockBuffer>& params, const SPtr<GpuParamBlockBuffer>& perView,
+		const SPtr<GpuBuffer>& instances, const SPtr<Texture>& heightmap, const SPtr<Texture>& splatMap,
+		const SPtr<Texture> (&layers)[4], const SPtr<VertexBuffer>& vertices, const SPtr<IndexBuffer>& indices,
+		const SPtr<VertexDeclaration>& vertexDecl, const SPtr<GpuBuffer>& drawArgs)
+	{
+		mParams->setParamBlockBuffer("Params", params);
+		mParams->setParamBlockBuffer("PerCamera", perView);
+		mInstancesParam.set(instances);
+		mHeightmapParam.set(heightmap);
+		mHeightmapFragParam.set(heightmap);
+		mSplatMapParam.set(splatMap);
+
+		for (UINT32 i = 0; i < 4; i++)
+			mLayerParams[i].set(layers[i]);
+
+		bind();
+
+		RenderAPI& rapi = RenderAPI::instance();
+		SPtr<VertexBuffer> buffers[] = { vertices };
+
+		rapi.setVertexDeclaration(vertexDecl);
+		rapi.setVertexBuffers(0, buffers, 1);
+		rapi.setIndexBuffer(indices);
+		rapi.setDrawOperation(DOT_TRIANGLE_LIST);
+		rapi.drawIndexedIndirect(drawArgs);
+	}
+
+	TerrainRenderer::TerrainRenderer()
+		:RendererExtension(RenderLocation::PreBasePass, 0)
+	{
+	}
+
+	void TerrainRenderer::initialize(const Any& data)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		SPtr<VertexDataDesc> patchVertexDesc = bs_shared_ptr_new<VertexDataDesc>();
+		patchVertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		mPatchVertexDecl = VertexDeclaration::create(patchVertexDesc);
+
+		// Grid of vertices in [0, PATCH_SIZE] range, positioned and displaced in the vertex program
+		static constexpr UINT32 NUM_VERTICES_PER_SIDE = PATCH_SIZE + 1;
+
+		Vector<Vector2> vertices;
+		vertices.reserve(NUM_VERTICES_PER_SIDE * NUM_VERTICES_PER_SIDE);
+
+		for (UINT32 z = 0; z < NUM_VERTICES_PER_SIDE; z++)
+		{
+			for (UINT32 x = 0; x < NUM_VERTICES_PER_SIDE; x++)
+				vertices.push_back(Vector2((float)x, (float)z));
+		}
+
+		VERTEX_BUFFER_DESC vertexDesc;
+		vertexDesc.vertexSize = sizeof(Vector2);
+		vertexDesc.numVerts = (UINT32)vertices.size();
+		vertexDesc.usage = GBU_STATIC;
+
+		mPatchVertices = VertexBuffer::create(vertexDesc);
+		mPatchVertices->writeData(0, (UINT32)(vertices.size() * sizeof(Vector2)), vertices.data(), BWT_DISCARD);
+
+		// Two clockwise triangles per quad, when looking down on the terrain
+		Vector<UINT16> indices;
+		indices.reserve(PATCH_INDEX_COUNT);
+
+		for (UINT32 z = 0; z < PATCH_SIZE; z++)
+		{
+			for (UINT32 x = 0; x < PATCH_SIZE; x++)
+			{
+				UINT16 i00 = (UINT16)(z * NUM_VERTICES_PER_SIDE + x);
+				UINT16 i10 = i00 + 1;
+				UINT16 i01 = (UINT16)(i00 + NUM_VERTICES_PER_SIDE);
+				UINT16 i11 = i01 + 1;
+
+				indices.push_back(i00);
+				indices.push_back(i10);
+				indices.push_back(i01);
+
+				indices.push_back(i10);
+				indices.push_back(i11);
+				indices.push_back(i01);
+			}
+		}
+
+		INDEX_BUFFER_DESC indexDesc;
+		indexDesc.indexType = IT_16BIT;
+		indexDesc.numIndices = (UINT32)indices.size();
+		indexDesc.usage = GBU_STATIC;
+
+		mPatchIndices = IndexBuffer::create(indexDesc);
+		mPatchIndices->writeData(0, (UINT32)(indices.size() * sizeof(UINT16)), indices.data(), BWT_DISCARD);
+	}
+
+	void TerrainRenderer::updateData(const TerrainRenderDataSet& data)
+	{
+		// Remove terrains that are no longer active, along with their GPU resources
+		UnorderedSet<UINT32> activeIds;
+		for (auto& entry : data.terrains)
+			activeIds.insert(entry.id);
+
+		for (auto iter = mTerrains.begin(); iter != mTerrains.end();)
+		{
+			if (activeIds.find(iter->first) == activeIds.end())
+				iter = mTerrains.erase(iter);
+			else
+				++iter;
+		}
+
+		for (auto& entry : data.terrains)
+		{
+			TerrainState& state = mTerrains[entry.id];
+			state.data = entry;
+
+			if (entry.heights != nullptr)
+			{
+				createResources(state, entry.heights);
+
+				// No longer needed once uploaded
+				state.data.heights = nullptr;
+			}
+
+			if (state.heightmap == nullptr)
+				mTerrains.erase(entry.id);
+		}
+	}
+
+	void TerrainRenderer::createResources(TerrainState& state, const SPtr<PixelData>& heights)
+	{
+		UINT32 numColumns = heights->getWidth();
+		UINT32 numRows = heights->getHeight();
+		UINT32 rowPitch = heights->getRowPitch();
+		const float* samples = (const float*)heights->getData();
+
+		state.heightmap = Texture::create(heights, TU_STATIC);
+		state.heightmapSize = Vector2((float)numColumns, (float)numRows);
+
+		// Add levels until the leaf nodes have roughly the same resolution as the height map
+		UINT32 numQuads = std::max(numColumns, numRows) - 1;
+
+		state.numLevels = 1;
+		while (state.numLevels < MAX_LEVELS && (PATCH_SIZE << (state.numLevels - 1)) < numQuads)
+			state.numLevels++;
+
+		state.numNodes = ((1 << (2 * state.numLevels)) - 1) / 3;
+
+		// Minimum and maximum height of every node, stored level by level, used for calculating node bounds
+		Vector<Vector2> nodeHeights(state.numNodes);
+
+		const auto getLevelOffset = [](UINT32 level) { return ((1 << (2 * level)) - 1) / 3; };
+
+		UINT32 leafLevel = state.numLevels - 1;
+		UINT32 numLeavesPerSide = 1 << leafLevel;
+		UINT32 leafOffset = getLevelOffset(leafLevel);
+
+		for (UINT32 y = 0; y < numLeavesPerSide; y++)
+		{
+			UINT32 row0 = (y * (numRows - 1)) / numLeavesPerSide;
+			UINT32 row1 = Math::divideAndRoundUp((y + 1) * (numRows - 1), numLeavesPerSide);
+
+			for (UINT32 x = 0; x < numLeavesPerSide; x++)
+			{
+				UINT32 column0 = (x * (numColumns - 1)) / numLeavesPerSide;
+				UINT32 column1 = Math::divideAndRoundUp((x + 1) * (numColumns - 1), numLeavesPerSide);
+
+				Vector2 minMax(std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+				for (UINT32 row = row0; row <= row1; row++)
+				{
+					for (UINT32 column = column0; column <= column1; column++)
+					{
+						float height = samples[row * rowPitch + column];
+
+						minMax.x = std::min(minMax.x, height);
+						minMax.y = std::max(minMax.y, height);
+					}
+				}
+
+				nodeHeights[leafOffset + y * numLeavesPerSide + x] = minMax;
+			}
+		}
+
+		for (INT32 level = (INT32)leafLevel - 1; level >= 0; level--)
+		{
+			UINT32 numPerSide = 1 << level;
+			UINT32 offset = getLevelOffset(level);
+			UINT32 childOffset = getLevelOffset(level + 1);
+
+			for (UINT32 y = 0; y < numPerSide; y++)
+			{
+				for (UINT32 x = 0; x < numPerSide; x++)
+				{
+					Vector2 minMax(std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+					for (UINT32 i = 0; i < 4; i++)
+					{
+						UINT32 childX = x * 2 + (i % 2);
+						UINT32 childY = y * 2 + (i / 2);
+
+						const Vector2& child = nodeHeights[childOffset + childY * numPerSide * 2 + childX];
+						minMax.x = std::min(minMax.x, child.x);
+						minMax.y = std::max(minMax.y, child.y);
+					}
+
+					nodeHeights[offset + y * numPerSide + x] = minMax;
+				}
+			}
+		}
+
+		GPU_BUFFER_DESC nodeHeightsDesc;
+		nodeHeightsDesc.type = GBT_STANDARD;
+		nodeHeightsDesc.format = BF_32X2F;
+		nodeHeightsDesc.elementSize = 0;
+		nodeHeightsDesc.elementCount = state.numNodes;
+		nodeHeightsDesc.usage = GBU_STATIC;
+
+		state.nodeHeights = GpuBuffer::create(nodeHeightsDesc);
+		state.nodeHeights->writeData(0, state.numNodes * sizeof(Vector2), nodeHeights.data(), BWT_DISCARD);
+
+		// Never more nodes can be selected than there are nodes in the tree
+		GPU_BUFFER_DESC instancesDesc;
+		instancesDesc.type = GBT_STANDARD;
+		instancesDesc.format = BF_32X4F;
+		instancesDesc.elementSize = 0;
+		instancesDesc.elementCount = state.numNodes;
+		instancesDesc.randomGpuWrite = true;
+
+		state.instances = GpuBuffer::create(instancesDesc);
+
+		GPU_BUFFER_DESC counterDesc;
+		counterDesc.type = GBT_STANDARD;
+		counterDesc.format = BF_32X1U;
+		counterDesc.elementSize = 0;
+		counterDesc.elementCount = 1;
+		counterDesc.randomGpuWrite = true;
+
+		state.counter = GpuBuffer::create(counterDesc);
+
+		counterDesc.elementCount = sizeof(DrawIndexedIndirectArgs) / sizeof(UINT32);
+		state.drawArgsScratch = GpuBuffer::create(counterDesc);
+
+		GPU_BUFFER_DESC drawArgsDesc;
+		drawArgsDesc.type = GBT_INDIRECTARGUMENT;
+		drawArgsDesc.format = BF_UNKNOWN;
+		drawArgsDesc.elementSize = sizeof(DrawIndexedIndirectArgs);
+		drawArgsDesc.elementCount = 1;
+
+		state.drawArgs = GpuBuffer::create(drawArgsDesc);
+
+		UINT32 zero = 0;
+		state.counter->writeData(0, sizeof(zero), &zero, BWT_DISCARD);
+
+		state.selectParams = gTerrainSelectParamsDef.createBuffer();
+		state.drawParams = gTerrainDrawParamsDef.createBuffer();
+	}
+
+	bool TerrainRenderer::check(const Camera& camera)
+	{
+		return !mTerrains.empty();
+	}
+
+	void TerrainRenderer::render(const Camera& camera)
+	{
+		renderView(camera, RendererViewContext());
+	}
+
+	void TerrainRenderer::renderView(const Camera& camera, const RendererViewContext& context)
+	{
+		// Terrain is drawn using the renderer's per-view parameters, and can't be rendered without them
+		if (context.perViewBuffer == nullptr)
+			return;
+
+		Vector3 viewOrigin = camera.getTransform().getPosition();
+		ConvexVolume worldFrustum = camera.getWorldFrustum();
+		UINT64 cameraLayers = camera.getLayers();
+
+		// Planes missing from the volume are replaced with ones that never cull anything
+		Vector4 frustumPlanes[6];
+		const Vector<Plane>& planes = worldFrustum.getPlanes();
+		for (UINT32 i = 0; i < 6; i++)
+		{
+			if (i < (UINT32)planes.size())
+				frustumPlanes[i] = Vector4(planes[i].normal.x, planes[i].normal.y, planes[i].normal.z, planes[i].d);
+			else
+				frustumPlanes[i] = Vector4(0.0f, 0.0f, 0.0f, -1.0f);
+		}
+
+		TerrainSelectMat* selectMat = TerrainSelectMat::get();
+		TerrainIndirectArgsMat* indirectArgsMat = TerrainIndirectArgsMat::get();
+		TerrainDrawMat* drawMat = TerrainDrawMat::get();
+
+		for (auto& entry : mTerrains)
+		{
+			TerrainState& state = entry.second;
+			const TerrainRenderData& data = state.data;
+
+			if ((data.layer & cameraLayers) == 0)
+				continue;
+
+			AABox bounds(Vector3::ZERO, Vector3::ONE);
+			bounds.transformAffine(data.worldTfrm);
+
+			if (!worldFrustum.intersects(bounds))
+				continue;
+
+			// Ranges of neighboring levels must be at least a node diagonal apart, otherwise nodes more than one level
+			// apart could end up adjacent to each other, causing cracks
+			const Matrix4& tfrm = data.worldTfrm;
+			float terrainSize = std::max(tfrm.getColumn(0).length(), tfrm.getColumn(2).length());
+			float leafSize = terrainSize / (float)(1 << (state.numLevels - 1));
+			float lodDistance = std::max(data.lodDistance, leafSize * 3.0f);
+
+			const SPtr<GpuParamBlockBuffer>& selectParams = state.selectParams;
+			gTerrainSelectParamsDef.gMatWorld.set(selectParams, tfrm);
+			gTerrainSelectParamsDef.gViewOrigin.set(selectParams, viewOrigin);
+			gTerrainSelectParamsDef.gLodDistance.set(selectParams, lodDistance);
+			gTerrainSelectParamsDef.gNumLevels.set(selectParams, (INT32)state.numLevels);
+			gTerrainSelectParamsDef.gNumNodes.set(selectParams, (INT32)state.numNodes);
+
+			for (UINT32 i = 0; i < 6; i++)
+				gTerrainSelectParamsDef.gFrustumPlanes.set(selectParams, frustumPlanes[i], i);
+
+			selectMat->execute(selectParams, state.numNodes, state.nodeHeights, state.instances, state.counter);
+			indirectArgsMat->execute(state.counter, state.drawArgsScratch);
+
+			// Indirect argument buffers can't be written to from a compute program on all render APIs
+			state.drawArgs->copyData(*state.drawArgsScratch, 0, 0, sizeof(DrawIndexedIndirectArgs));
+
+			const SPtr<GpuParamBlockBuffer>& drawParams = state.drawParams;
+			gTerrainDrawParamsDef.gMatWorld.set(drawParams, tfrm);
+			gTerrainDrawParamsDef.gLayerTiling.set(drawParams, data.layerTiling);
+			gTerrainDrawParamsDef.gHeightmapSize.set(drawParams, state.heightmapSize);
+			gTerrainDrawParamsDef.gLodDistance.set(drawParams, lodDistance);
+			gTerrainDrawParamsDef.gPatchSize.set(drawParams, (INT32)PATCH_SIZE);
+
+			// Without a splat map only the first layer is visible
+			SPtr<Texture> splatMap = data.splatMap != nullptr ? data.splatMap : Texture::BLACK;
+
+			SPtr<Texture> layers[4];
+			for (UINT32 i = 0; i < 4; i++)
+				layers[i] = data.layerTextures[i] != nullptr ? data.layerTextures[i] : Texture::WHITE;
+
+			drawMat->execute(drawParams, context.perViewBuffer, state.instances, state.heightmap, splatMap, layers,
+				mPatchVertices, mPatchIndices, mPatchVertexDecl, state.drawArgs);
+		}
+	}
+}}
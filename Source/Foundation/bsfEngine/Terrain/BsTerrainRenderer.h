@@ -0,0 +1,243 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Renderer/BsParamBlocks.h"
+#include "Renderer/BsRendererExtension.h"
+#include "Renderer/BsRendererMaterial.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsVector4.h"
+
+namespace bs
+{
+	/** @addtogroup Terrain-Internal
+	 *  @{
+	 */
+
+	/** Information about a single terrain, sent from the sim thread to the renderer whenever it changes. */
+	struct TerrainRenderData
+	{
+		/** Identifier of the terrain, unique among all registered terrains. */
+		UINT32 id = 0;
+
+		/**
+		 * Height samples of the terrain, in PF_R32F format. Null if the heights didn't change since the last update, in
+		 * which case the renderer keeps using the previous ones.
+		 */
+		SPtr<PixelData> heights;
+
+		/** Texture containing weights of the four layers in its four channels, or null if not set. */
+		SPtr<ct::Texture> splatMap;
+
+		/** Albedo textures of the four layers. Layers without a texture are null. */
+		SPtr<ct::Texture> layerTextures[4];
+
+		/** Number of times each of the four layer textures repeats over the terrain. */
+		Vector4 layerTiling = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+		/** Transform of the terrain, from its [0, 1] local space to world space. */
+		Matrix4 worldTfrm = Matrix4::IDENTITY;
+
+		/** Layer bitfield determining in which cameras is the terrain visible. */
+		UINT64 layer = 1;
+
+		/** Distance at which the finest LOD level transitions to the next one. */
+		float lodDistance = 0.0f;
+	};
+
+	/** Information about all active terrains, sent from the sim thread to the renderer whenever any of them change. */
+	struct TerrainRenderDataSet
+	{
+		Vector<TerrainRenderData> terrains;
+	};
+
+	/** @} */
+
+	namespace ct
+	{
+	/** @addtogroup Terrain-Internal
+	 *  @{
+	 */
+
+	BS_PARAM_BLOCK_BEGIN(TerrainSelectParamsDef)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatWorld)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(Vector4, gFrustumPlanes, 6)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gViewOrigin)
+		BS_PARAM_BLOCK_ENTRY(float, gLodDistance)
+		BS_PARAM_BLOCK_ENTRY(INT32, gNumLevels)
+		BS_PARAM_BLOCK_ENTRY(INT32, gNumNodes)
+	BS_PARAM_BLOCK_END
+
+	extern TerrainSelectParamsDef gTerrainSelectParamsDef;
+
+	BS_PARAM_BLOCK_BEGIN(TerrainDrawParamsDef)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatWorld)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gLayerTiling)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gHeightmapSize)
+		BS_PARAM_BLOCK_ENTRY(float, gLodDistance)
+		BS_PARAM_BLOCK_ENTRY(INT32, gPatchSize)
+	BS_PARAM_BLOCK_END
+
+	extern TerrainDrawParamsDef gTerrainDrawParamsDef;
+
+	/**
+	 * Selects which nodes of the terrain quadtree to draw for a view, and appends them to the instance buffer. Each
+	 * thread evaluates a single node independently, so the selection requires no traversal on the CPU or GPU.
+	 */
+	class TerrainSelectMat : public RendererMaterial<TerrainSelectMat>
+	{
+		RMAT_DEF_CUSTOMIZED("TerrainSelect.bsl");
+
+	public:
+		TerrainSelectMat();
+
+		/**
+		 * Executes the material.
+		 *
+		 * @param[in]	params			Buffer created from gTerrainSelectParamsDef.
+		 * @param[in]	numNodes		Total number of nodes in the quadtree.
+		 * @param[in]	nodeHeights		Buffer containing the minimum and maximum height of each node.
+		 * @param[in]	instances		Buffer to receive the selected nodes.
+		 * @param[in]	counter			Buffer holding the number of entries written to @p instances.
+		 */
+		void execute(const SPtr<GpuParamBlockBuffer>& params, UINT32 numNodes, const SPtr<GpuBuffer>& nodeHeights,
+			const SPtr<GpuBuffer>& instances, const SPtr<GpuBuffer>& counter);
+
+	private:
+		GpuParamBuffer mNodeHeightsParam;
+		GpuParamBuffer mInstancesParam;
+		GpuParamBuffer mCounterParam;
+	};
+
+	/**
+	 * Writes the number of selected terrain nodes into draw arguments for an indexed indirect draw, and resets the
+	 * counter for the next selection.
+	 */
+	class TerrainIndirectArgsMat : public RendererMaterial<TerrainIndirectArgsMat>
+	{
+		RMAT_DEF_CUSTOMIZED("TerrainIndirectArgs.bsl");
+
+	public:
+		TerrainIndirectArgsMat();
+
+		/**
+		 * Executes the material.
+		 *
+		 * @param[in]	counter		Buffer holding the number of selected nodes.
+		 * @param[in]	drawArgs	Buffer of five 32-bit unsigned integers to receive the DrawIndexedIndirectArgs.
+		 */
+		void execute(const SPtr<GpuBuffer>& counter, const SPtr<GpuBuffer>& drawArgs);
+
+	private:
+		GpuParamBuffer mCounterParam;
+		GpuParamBuffer mDrawArgsParam;
+	};
+
+	/**
+	 * Draws the selected terrain nodes into the GBuffer, as instances of a single grid patch displaced by the height
+	 * map. Vertices morph towards the next coarser LOD level as they approach its range, avoiding cracks and popping.
+	 */
+	class TerrainDrawMat : public RendererMaterial<TerrainDrawMat>
+	{
+		RMAT_DEF("TerrainDraw.bsl");
+
+	public:
+		TerrainDrawMat();
+
+		/**
+		 * Executes the material.
+		 *
+		 * @param[in]	params			Buffer created from gTerrainDrawParamsDef.
+		 * @param[in]	perView			Buffer containing the per-view parameters of the view being rendered.
+		 * @param[in]	instances		Selected nodes to draw, one per instance.
+		 * @param[in]	heightmap		Texture containing the terrain heights.
+		 * @param[in]	splatMap		Texture containing weights of the four layers.
+		 * @param[in]	layers			Albedo textures of the four layers.
+		 * @param[in]	vertices		Vertices of a single grid patch.
+		 * @param[in]	indices			Indices of a single grid patch.
+		 * @param[in]	vertexDecl		Vertex declaration of @p vertices.
+		 * @param[in]	drawArgs		Buffer of GBT_INDIRECTARGUMENT type containing the DrawIndexedIndirectArgs.
+		 */
+		void execute(const SPtr<GpuParamBlockBuffer>& params, const SPtr<GpuParamBlockBuffer>& perView,
+			const SPtr<GpuBuffer>& instances, const SPtr<Texture>& heightmap, const SPtr<Texture>& splatMap,
+			const SPtr<Texture> (&layers)[4], const SPtr<VertexBuffer>& vertices, const SPtr<IndexBuffer>& indices,
+			const SPtr<VertexDeclaration>& vertexDecl, const SPtr<GpuBuffer>& drawArgs);
+
+	private:
+		GpuParamBuffer mInstancesParam;
+		GpuParamTexture mHeightmapParam;
+		GpuParamTexture mHeightmapFragParam;
+		GpuParamTexture mSplatMapParam;
+		GpuParamTexture mLayerParams[4];
+	};
+
+	/**
+	 * Renders terrains provided by TerrainManager into the GBuffer, before the rest of the opaque geometry. Each
+	 * terrain is represented by a quadtree whose nodes are selected for rendering on the GPU, once per view, and drawn
+	 * with a single indirect draw call.
+	 */
+	class TerrainRenderer : public RendererExtension
+	{
+		friend class bs::TerrainManager;
+
+	public:
+		TerrainRenderer();
+
+		/** Number of quads along each side of the grid patch drawn for every selected node. */
+		static constexpr UINT32 PATCH_SIZE = 16;
+
+		/** Maximum depth of the quadtree, limiting the number of nodes evaluated during selection. */
+		static constexpr UINT32 MAX_LEVELS = 9;
+
+	private:
+		/** GPU resources of a single terrain. */
+		struct TerrainState
+		{
+			TerrainRenderData data;
+
+			SPtr<Texture> heightmap;
+			Vector2 heightmapSize;
+			UINT32 numLevels = 0;
+			UINT32 numNodes = 0;
+
+			SPtr<GpuBuffer> nodeHeights;
+			SPtr<GpuBuffer> instances;
+			SPtr<GpuBuffer> counter;
+			SPtr<GpuBuffer> drawArgsScratch;
+			SPtr<GpuBuffer> drawArgs;
+
+			SPtr<GpuParamBlockBuffer> selectParams;
+			SPtr<GpuParamBlockBuffer> drawParams;
+		};
+
+		/**	@copydoc RendererExtension::initialize */
+		void initialize(const Any& data) override;
+
+		/**	@copydoc RendererExtension::check */
+		bool check(const Camera& camera) override;
+
+		/**	@copydoc RendererExtension::render */
+		void render(const Camera& camera) override;
+
+		/**	@copydoc RendererExtension::renderView */
+		void renderView(const Camera& camera, const RendererViewContext& context) override;
+
+		/** Updates the set of terrains to render. */
+		void updateData(const TerrainRenderDataSet& data);
+
+		/**
+		 * Creates the height map texture and the quadtree of a terrain from the provided height samples, along with the
+		 * buffers used for selecting and drawing its nodes.
+		 */
+		void createResources(TerrainState& state, const SPtr<PixelData>& heights);
+
+		SPtr<VertexBuffer> mPatchVertices;
+		SPtr<IndexBuffer> mPatchIndices;
+		SPtr<VertexDeclaration> mPatchVertexDecl;
+		UnorderedMap<UINT32, TerrainState> mTerrains;
+	};
+
+	/** @} */
+	}
+}
@@ -0,0 +1,136 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	static constexpr UINT32 NUM_CATEGORIES = (UINT32)MemoryCategory::Count;
+
+	/** Running totals for a single memory category. Plain atomics so they are usable during static initialization. */
+	struct MemoryCategoryCounters
+	{
+		std::atomic<UINT64> liveBytes;
+		std::atomic<UINT64> peakBytes;
+		std::atomic<UINT64> totalBytesAllocated;
+		std::atomic<UINT64> totalBytesFreed;
+		std::atomic<UINT64> numAllocs;
+		std::atomic<UINT64> numFrees;
+		std::atomic<UINT64> budgetBytes;
+	};
+
+	/** Counter values at the time of the last generated report, used for calculating per-frame churn. */
+	struct MemoryCategorySnapshot
+	{
+		UINT64 totalBytesAllocated = 0;
+		UINT64 totalBytesFreed = 0;
+		UINT64 numAllocs = 0;
+		UINT64 numFrees = 0;
+		bool overBudget = false;
+	};
+
+	static MemoryCategoryCounters gMemoryCounters[NUM_CATEGORIES];
+	static MemoryCategorySnapshot gMemorySnapshots[NUM_CATEGORIES];
+	static SpinLock gMemoryReportLock;
+
+	const char* MemAllocProfiler::getCategoryName(MemoryCategory category)
+	{
+		switch(category)
+		{
+		case MemoryCategory::General: return "General";
+		case MemoryCategory::Renderer: return "Renderer";
+		case MemoryCategory::GUI: return "GUI";
+		case MemoryCategory::Animation: return "Animation";
+		case MemoryCategory::Resources: return "Resources";
+		case MemoryCategory::Physics: return "Physics";
+		default: return "Unknown";
+		}
+	}
+
+	UINT64 MemAllocProfiler::getLiveBytes(MemoryCategory category)
+	{
+		return gMemoryCounters[(UINT32)category].liveBytes.load(std::memory_order_relaxed);
+	}
+
+	UINT64 MemAllocProfiler::getPeakBytes(MemoryCategory category)
+	{
+		return gMemoryCounters[(UINT32)category].peakBytes.load(std::memory_order_relaxed);
+	}
+
+	void MemAllocProfiler::setBudget(MemoryCategory category, UINT64 bytes)
+	{
+		gMemoryCounters[(UINT32)category].budgetBytes.store(bytes, std::memory_order_relaxed);
+	}
+
+	UINT64 MemAllocProfiler::getBudget(MemoryCategory category)
+	{
+		return gMemoryCounters[(UINT32)category].budgetBytes.load(std::memory_order_relaxed);
+	}
+
+	MemoryProfilerReport MemAllocProfiler::generateReport()
+	{
+		MemoryProfilerReport report;
+
+		ScopedSpinLock lock(gMemoryReportLock);
+		for(UINT32 i = 0; i < NUM_CATEGORIES; i++)
+		{
+			const MemoryCategoryCounters& counters = gMemoryCounters[i];
+			MemoryCategorySnapshot& snapshot = gMemorySnapshots[i];
+			MemoryCategoryReport& entry = report.categories[i];
+
+			const UINT64 totalBytesAllocated = counters.totalBytesAllocated.load(std::memory_order_relaxed);
+			const UINT64 totalBytesFreed = counters.totalBytesFreed.load(std::memory_order_relaxed);
+			const UINT64 numAllocs = counters.numAllocs.load(std::memory_order_relaxed);
+			const UINT64 numFrees = counters.numFrees.load(std::memory_order_relaxed);
+
+			entry.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+			entry.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+			entry.budgetBytes = counters.budgetBytes.load(std::memory_order_relaxed);
+			entry.bytesAllocated = totalBytesAllocated - snapshot.totalBytesAllocated;
+			entry.bytesFreed = totalBytesFreed - snapshot.totalBytesFreed;
+			entry.numAllocs = numAllocs - snapshot.numAllocs;
+			entry.numFrees = numFrees - snapshot.numFrees;
+
+			snapshot.totalBytesAllocated = totalBytesAllocated;
+			snapshot.totalBytesFreed = totalBytesFreed;
+			snapshot.numAllocs = numAllocs;
+			snapshot.numFrees = numFrees;
+
+			const bool overBudget = entry.budgetBytes > 0 && entry.liveBytes > entry.budgetBytes;
+			if(overBudget && !snapshot.overBudget)
+			{
+				LOGWRN("Memory category \"" + String(getCategoryName((MemoryCategory)i)) + "\" exceeded its budget. " +
+					"Using " + toString(entry.liveBytes) + " bytes, budget is " + toString(entry.budgetBytes) + " bytes.");
+			}
+
+			snapshot.overBudget = overBudget;
+		}
+
+		return report;
+	}
+
+	void MemAllocProfiler::_registerAlloc(MemoryCategory category, size_t bytes)
+	{
+		MemoryCategoryCounters& counters = gMemoryCounters[(UINT32)category];
+
+		const UINT64 liveBytes = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+		counters.totalBytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+		counters.numAllocs.fetch_add(1, std::memory_order_relaxed);
+
+		UINT64 peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+		while(liveBytes > peakBytes)
+		{
+			if(counters.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+				break;
+		}
+	}
+
+	void MemAllocProfiler::_registerFree(MemoryCategory category, size_t bytes)
+	{
+		MemoryCategoryCounters& counters = gMemoryCounters[(UINT32)category];
+
+		counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+		counters.totalBytesFreed.fetch_add(bytes, std::memory_order_relaxed);
+		counters.numFrees.fetch_add(1, std::memory_order_relaxed);
+	}
+}
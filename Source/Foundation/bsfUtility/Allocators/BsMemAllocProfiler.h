@@ -13,7 +13,7 @@ namespace bs
 	 */
 
 	/**
-	 * Specialized allocator for profiler so we can avoid tracking internal profiler memory allocations which would skew 
+	 * Specialized allocator for profiler so we can avoid tracking internal profiler memory allocations which would skew
 	 * profiler results.
 	 */
 	class ProfilerAlloc
@@ -39,4 +39,228 @@ namespace bs
 
 	/** @} */
 	/** @} */
-}
\ No newline at end of file
+
+	/** @addtogroup Memory
+	 *  @{
+	 */
+
+	/** Subsystems that memory allocations can be attributed to, using TaggedAlloc. */
+	enum class MemoryCategory
+	{
+		General,
+		Renderer,
+		GUI,
+		Animation,
+		Resources,
+		Physics,
+		Count // Keep last
+	};
+
+	/**
+	 * Allocator category that attributes all allocations to the specified memory category. Behaves the same as GenAlloc,
+	 * except that the allocated memory is tracked by MemAllocProfiler. Use with the allocator versions of memory
+	 * functions (e.g. bs_new<T, TaggedAlloc<MemoryCategory::GUI>>()) or StdAlloc for containers. Memory must be freed
+	 * using the same allocator category it was allocated with.
+	 */
+	template<MemoryCategory Category>
+	class TaggedAlloc
+	{ };
+
+	using RendererAlloc = TaggedAlloc<MemoryCategory::Renderer>;
+	using GUIAlloc = TaggedAlloc<MemoryCategory::GUI>;
+	using AnimationAlloc = TaggedAlloc<MemoryCategory::Animation>;
+	using ResourcesAlloc = TaggedAlloc<MemoryCategory::Resources>;
+	using PhysicsAlloc = TaggedAlloc<MemoryCategory::Physics>;
+
+	/** Memory statistics for a single memory category, over a single frame. */
+	struct MemoryCategoryReport
+	{
+		UINT64 liveBytes = 0; /**< Number of bytes allocated at the end of the frame. */
+		UINT64 peakBytes = 0; /**< Highest number of bytes allocated at any point since start-up. */
+		UINT64 budgetBytes = 0; /**< Budget assigned to the category, or 0 if none. */
+		UINT64 bytesAllocated = 0; /**< Number of bytes allocated during the frame. */
+		UINT64 bytesFreed = 0; /**< Number of bytes freed during the frame. */
+		UINT64 numAllocs = 0; /**< Number of allocations made during the frame. */
+		UINT64 numFrees = 0; /**< Number of frees made during the frame. */
+	};
+
+	/** Memory statistics for all memory categories, over a single frame. */
+	struct MemoryProfilerReport
+	{
+		MemoryCategoryReport categories[(UINT32)MemoryCategory::Count];
+	};
+
+	/**
+	 * Tracks memory allocated through TaggedAlloc, keeping live and peak byte counts per memory category, and optionally
+	 * enforcing per-category memory budgets.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT MemAllocProfiler
+	{
+	public:
+		/** Returns a human readable name of the memory category. */
+		static const char* getCategoryName(MemoryCategory category);
+
+		/** Returns the number of bytes currently allocated in the specified category. */
+		static UINT64 getLiveBytes(MemoryCategory category);
+
+		/** Returns the highest number of bytes that were allocated in the specified category at any point. */
+		static UINT64 getPeakBytes(MemoryCategory category);
+
+		/**
+		 * Assigns a memory budget to the specified category. A warning is logged during report generation whenever the
+		 * number of live bytes in the category first exceeds the budget. Set to 0 to disable the budget.
+		 */
+		static void setBudget(MemoryCategory category, UINT64 bytes);
+
+		/** Returns the budget previously assigned with setBudget(). */
+		static UINT64 getBudget(MemoryCategory category);
+
+		/**
+		 * Generates a report containing the current memory statistics, as well as the amount of memory churn (allocations
+		 * and frees) since the last call. Logs a warning for any categories that went over budget since the last call.
+		 * Normally called once per frame by the profiling manager.
+		 */
+		static MemoryProfilerReport generateReport();
+
+		/** Registers a new allocation of @p bytes in the specified category. */
+		static void _registerAlloc(MemoryCategory category, size_t bytes);
+
+		/** Registers that an allocation of @p bytes in the specified category has been freed. */
+		static void _registerFree(MemoryCategory category, size_t bytes);
+	};
+
+	/** @} */
+
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Memory-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Memory allocator that attributes its allocations to a specific memory category. Allocations are forwarded to the
+	 * general allocator with a small header in front, used for tracking the allocation size.
+	 */
+	template<MemoryCategory Category>
+	class MemoryAllocator<TaggedAlloc<Category>> : public MemoryAllocatorBase
+	{
+		/** Size of the header stored in front of every allocation. Keeps user memory 16 byte aligned. */
+		static constexpr size_t HEADER_SIZE = 16;
+
+		/** Header stored in front of every tracked allocation. */
+		struct Header
+		{
+			size_t size;
+			size_t offset; /**< Offset from the start of the underlying allocation to the user memory. */
+		};
+
+		static_assert(sizeof(Header) <= HEADER_SIZE, "Allocation header doesn't fit in the reserved space.");
+
+	public:
+		/** @copydoc MemoryAllocator::allocate */
+		static void* allocate(size_t bytes)
+		{
+#if BS_PROFILING_ENABLED
+			UINT8* data = (UINT8*)MemoryAllocator<GenAlloc>::allocate(bytes + HEADER_SIZE);
+			return writeHeader(data, bytes, HEADER_SIZE);
+#else
+			return MemoryAllocator<GenAlloc>::allocate(bytes);
+#endif
+		}
+
+		/** @copydoc MemoryAllocator::allocateAligned */
+		static void* allocateAligned(size_t bytes, size_t alignment)
+		{
+#if BS_PROFILING_ENABLED
+			// Offset by a multiple of the alignment so the user memory remains aligned
+			const size_t offset = alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+
+			UINT8* data = (UINT8*)MemoryAllocator<GenAlloc>::allocateAligned(bytes + offset, alignment);
+			return writeHeader(data, bytes, offset);
+#else
+			return MemoryAllocator<GenAlloc>::allocateAligned(bytes, alignment);
+#endif
+		}
+
+		/** @copydoc MemoryAllocator::allocateAligned16 */
+		static void* allocateAligned16(size_t bytes)
+		{
+#if BS_PROFILING_ENABLED
+			UINT8* data = (UINT8*)MemoryAllocator<GenAlloc>::allocateAligned16(bytes + HEADER_SIZE);
+			return writeHeader(data, bytes, HEADER_SIZE);
+#else
+			return MemoryAllocator<GenAlloc>::allocateAligned16(bytes);
+#endif
+		}
+
+		/** @copydoc MemoryAllocator::free */
+		static void free(void* ptr)
+		{
+#if BS_PROFILING_ENABLED
+			MemoryAllocator<GenAlloc>::free(readHeader(ptr));
+#else
+			MemoryAllocator<GenAlloc>::free(ptr);
+#endif
+		}
+
+		/** @copydoc MemoryAllocator::freeAligned */
+		static void freeAligned(void* ptr)
+		{
+#if BS_PROFILING_ENABLED
+			MemoryAllocator<GenAlloc>::freeAligned(readHeader(ptr));
+#else
+			MemoryAllocator<GenAlloc>::freeAligned(ptr);
+#endif
+		}
+
+		/** @copydoc MemoryAllocator::freeAligned16 */
+		static void freeAligned16(void* ptr)
+		{
+#if BS_PROFILING_ENABLED
+			MemoryAllocator<GenAlloc>::freeAligned16(readHeader(ptr));
+#else
+			MemoryAllocator<GenAlloc>::freeAligned16(ptr);
+#endif
+		}
+
+	private:
+		/**
+		 * Writes the allocation header in front of the user memory and registers the allocation. Returns the user memory,
+		 * located @p offset bytes after @p data.
+		 */
+		static void* writeHeader(UINT8* data, size_t bytes, size_t offset)
+		{
+			if(data == nullptr)
+				return nullptr;
+
+			UINT8* userData = data + offset;
+
+			Header* header = (Header*)(userData - HEADER_SIZE);
+			header->size = bytes;
+			header->offset = offset;
+
+			MemAllocProfiler::_registerAlloc(Category, bytes);
+			return userData;
+		}
+
+		/** Reads the allocation header in front of the user memory, registers the free and returns the original pointer. */
+		static void* readHeader(void* ptr)
+		{
+			if(ptr == nullptr)
+				return nullptr;
+
+			UINT8* userData = (UINT8*)ptr;
+			const Header* header = (const Header*)(userData - HEADER_SIZE);
+
+			MemAllocProfiler::_registerFree(Category, header->size);
+			return userData - header->offset;
+		}
+	};
+
+	/** @} */
+	/** @} */
+}
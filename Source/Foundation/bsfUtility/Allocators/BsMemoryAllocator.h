@@ -13,6 +13,8 @@
 #  include <malloc.h>
 #endif
 
+#include "Allocators/BsSizeClassAlloc.h"
+
 namespace bs
 {
 	class MemoryAllocatorBase;
@@ -213,6 +215,78 @@ namespace bs
 	class GenAlloc
 	{ };
 
+#if BS_POOLED_GENERAL_ALLOCATOR
+	/**
+	 * General allocator specialization that serves unaligned allocations through SizeClassAlloc, avoiding a trip to
+	 * the OS allocator for the majority of small, short lived allocations (e.g. container storage, shared pointer control
+	 * blocks).
+	 */
+	template<>
+	class MemoryAllocator<GenAlloc> : public MemoryAllocatorBase
+	{
+	public:
+		/** @copydoc MemoryAllocator::allocate */
+		static void* allocate(size_t bytes)
+		{
+#if BS_PROFILING_ENABLED
+			incAllocCount();
+#endif
+
+			return SizeClassAlloc::allocate(bytes);
+		}
+
+		/** @copydoc MemoryAllocator::allocateAligned */
+		static void* allocateAligned(size_t bytes, size_t alignment)
+		{
+#if BS_PROFILING_ENABLED
+			incAllocCount();
+#endif
+
+			return platformAlignedAlloc(bytes, alignment);
+		}
+
+		/** @copydoc MemoryAllocator::allocateAligned16 */
+		static void* allocateAligned16(size_t bytes)
+		{
+#if BS_PROFILING_ENABLED
+			incAllocCount();
+#endif
+
+			return platformAlignedAlloc16(bytes);
+		}
+
+		/** @copydoc MemoryAllocator::free */
+		static void free(void* ptr)
+		{
+#if BS_PROFILING_ENABLED
+			incFreeCount();
+#endif
+
+			SizeClassAlloc::free(ptr);
+		}
+
+		/** @copydoc MemoryAllocator::freeAligned */
+		static void freeAligned(void* ptr)
+		{
+#if BS_PROFILING_ENABLED
+			incFreeCount();
+#endif
+
+			platformAlignedFree(ptr);
+		}
+
+		/** @copydoc MemoryAllocator::freeAligned16 */
+		static void freeAligned16(void* ptr)
+		{
+#if BS_PROFILING_ENABLED
+			incFreeCount();
+#endif
+
+			platformAlignedFree16(ptr);
+		}
+	};
+#endif
+
 	/** @} */
 	/** @} */
 
@@ -260,6 +334,20 @@ namespace bs
 		MemoryAllocator<Alloc>::free(ptr);
 	}
 
+	/** Allocates the specified number of bytes aligned to a 16 bytes boundary. */
+	template<class Alloc>
+	inline void* bs_alloc_aligned16(size_t count)
+	{
+		return MemoryAllocator<Alloc>::allocateAligned16(count);
+	}
+
+	/** Frees memory previously allocated with bs_alloc_aligned16(). */
+	template<class Alloc>
+	inline void bs_free_aligned16(void* ptr)
+	{
+		MemoryAllocator<Alloc>::freeAligned16(ptr);
+	}
+
 	/** Destructs and frees the specified object. */
 	template<class T, class Alloc = GenAlloc>
 	inline void bs_delete(T* ptr)
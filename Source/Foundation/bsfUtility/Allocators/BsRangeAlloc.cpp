@@ -0,0 +1,262 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Allocators/BsRangeAlloc.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs
+{
+	RangeAlloc::RangeAlloc()
+	{
+		for (UINT32 i = 0; i < FIRST_LEVEL_COUNT; i++)
+		{
+			mSecondLevelBitmaps[i] = 0;
+
+			for (UINT32 j = 0; j < SECOND_LEVEL_COUNT; j++)
+				mFreeHeads[i][j] = INVALID;
+		}
+	}
+
+	UINT32 RangeAlloc::alloc(UINT32 size)
+	{
+		// Empty ranges still need a unique handle
+		size = std::max(size, 1U);
+
+		UINT32 block = findFreeBlock(size);
+		if (block == INVALID)
+			return INVALID;
+
+		removeFree(block);
+
+		if (mBlocks[block].size > size)
+		{
+			// Split off the remainder. Note that creating a block can invalidate references to existing blocks.
+			UINT32 remainder = createBlock();
+			Block& curBlock = mBlocks[block];
+			Block& remainderBlock = mBlocks[remainder];
+
+			remainderBlock.start = curBlock.start + size;
+			remainderBlock.size = curBlock.size - size;
+			remainderBlock.prevPhysical = block;
+			remainderBlock.nextPhysical = curBlock.nextPhysical;
+
+			if (curBlock.nextPhysical != INVALID)
+				mBlocks[curBlock.nextPhysical].prevPhysical = remainder;
+			else
+				mLastBlock = remainder;
+
+			curBlock.nextPhysical = remainder;
+			curBlock.size = size;
+
+			insertFree(remainder);
+		}
+
+		return block;
+	}
+
+	void RangeAlloc::free(UINT32 range)
+	{
+		UINT32 block = range;
+
+		// Merge with the next block
+		UINT32 next = mBlocks[block].nextPhysical;
+		if (next != INVALID && mBlocks[next].free)
+		{
+			removeFree(next);
+
+			Block& curBlock = mBlocks[block];
+			Block& nextBlock = mBlocks[next];
+
+			curBlock.size += nextBlock.size;
+			curBlock.nextPhysical = nextBlock.nextPhysical;
+
+			if (nextBlock.nextPhysical != INVALID)
+				mBlocks[nextBlock.nextPhysical].prevPhysical = block;
+			else
+				mLastBlock = block;
+
+			destroyBlock(next);
+		}
+
+		// Merge with the previous block
+		UINT32 prev = mBlocks[block].prevPhysical;
+		if (prev != INVALID && mBlocks[prev].free)
+		{
+			removeFree(prev);
+
+			Block& curBlock = mBlocks[block];
+			Block& prevBlock = mBlocks[prev];
+
+			prevBlock.size += curBlock.size;
+			prevBlock.nextPhysical = curBlock.nextPhysical;
+
+			if (curBlock.nextPhysical != INVALID)
+				mBlocks[curBlock.nextPhysical].prevPhysical = prev;
+			else
+				mLastBlock = prev;
+
+			destroyBlock(block);
+			block = prev;
+		}
+
+		insertFree(block);
+	}
+
+	void RangeAlloc::grow(UINT32 size)
+	{
+		if (size <= mSize)
+			return;
+
+		UINT32 extraSize = size - mSize;
+		if (mLastBlock != INVALID && mBlocks[mLastBlock].free)
+		{
+			removeFree(mLastBlock);
+			mBlocks[mLastBlock].size += extraSize;
+			insertFree(mLastBlock);
+		}
+		else
+		{
+			UINT32 block = createBlock();
+			Block& newBlock = mBlocks[block];
+
+			newBlock.start = mSize;
+			newBlock.size = extraSize;
+			newBlock.prevPhysical = mLastBlock;
+
+			if (mLastBlock != INVALID)
+				mBlocks[mLastBlock].nextPhysical = block;
+
+			mLastBlock = block;
+			insertFree(block);
+		}
+
+		mSize = size;
+	}
+
+	void RangeAlloc::getBin(UINT32 size, UINT32& firstLevel, UINT32& secondLevel)
+	{
+		// Small sizes map linearly to the bins of the first level, larger sizes get logarithmically sized first level 
+		// bins, each split into linearly sized second level bins
+		if (size < SECOND_LEVEL_COUNT)
+		{
+			firstLevel = 0;
+			secondLevel = size;
+		}
+		else
+		{
+			UINT32 msb = Bitwise::mostSignificantBitSet(size);
+
+			firstLevel = msb - SECOND_LEVEL_BITS + 1;
+			secondLevel = (size >> (msb - SECOND_LEVEL_BITS)) & (SECOND_LEVEL_COUNT - 1);
+		}
+	}
+
+	UINT32 RangeAlloc::findFreeBlock(UINT32 size) const
+	{
+		// Round the size up to the next bin, so any block in the found bin is guaranteed to fit
+		UINT32 searchSize = size;
+		if (size >= SECOND_LEVEL_COUNT)
+			searchSize += (1U << (Bitwise::mostSignificantBitSet(size) - SECOND_LEVEL_BITS)) - 1;
+
+		UINT32 firstLevel, secondLevel;
+		getBin(searchSize, firstLevel, secondLevel);
+
+		UINT32 secondLevelMap = mSecondLevelBitmaps[firstLevel] & (~0U << secondLevel);
+		if (secondLevelMap == 0)
+		{
+			UINT32 firstLevelMap = 0;
+			if ((firstLevel + 1) < FIRST_LEVEL_COUNT)
+				firstLevelMap = mFirstLevelBitmap & (~0U << (firstLevel + 1));
+
+			if (firstLevelMap != 0)
+			{
+				firstLevel = Bitwise::leastSignificantBitSet(firstLevelMap);
+				secondLevelMap = mSecondLevelBitmaps[firstLevel];
+			}
+		}
+
+		if (secondLevelMap != 0)
+			return mFreeHeads[firstLevel][Bitwise::leastSignificantBitSet(secondLevelMap)];
+
+		// Rounding up skips blocks in the size's own bin that might still fit, check those before giving up
+		getBin(size, firstLevel, secondLevel);
+		for (UINT32 block = mFreeHeads[firstLevel][secondLevel]; block != INVALID; block = mBlocks[block].nextFree)
+		{
+			if (mBlocks[block].size >= size)
+				return block;
+		}
+
+		return INVALID;
+	}
+
+	void RangeAlloc::insertFree(UINT32 block)
+	{
+		Block& freeBlock = mBlocks[block];
+
+		UINT32 firstLevel, secondLevel;
+		getBin(freeBlock.size, firstLevel, secondLevel);
+
+		UINT32& head = mFreeHeads[firstLevel][secondLevel];
+		freeBlock.prevFree = INVALID;
+		freeBlock.nextFree = head;
+		freeBlock.free = true;
+
+		if (head != INVALID)
+			mBlocks[head].prevFree = block;
+
+		head = block;
+		mSecondLevelBitmaps[firstLevel] |= 1U << secondLevel;
+		mFirstLevelBitmap |= 1U << firstLevel;
+	}
+
+	void RangeAlloc::removeFree(UINT32 block)
+	{
+		Block& freeBlock = mBlocks[block];
+
+		UINT32 firstLevel, secondLevel;
+		getBin(freeBlock.size, firstLevel, secondLevel);
+
+		if (freeBlock.prevFree != INVALID)
+			mBlocks[freeBlock.prevFree].nextFree = freeBlock.nextFree;
+
+		if (freeBlock.nextFree != INVALID)
+			mBlocks[freeBlock.nextFree].prevFree = freeBlock.prevFree;
+
+		UINT32& head = mFreeHeads[firstLevel][secondLevel];
+		if (head == block)
+		{
+			head = freeBlock.nextFree;
+
+			if (head == INVALID)
+			{
+				mSecondLevelBitmaps[firstLevel] &= ~(1U << secondLevel);
+
+				if (mSecondLevelBitmaps[firstLevel] == 0)
+					mFirstLevelBitmap &= ~(1U << firstLevel);
+			}
+		}
+
+		freeBlock.prevFree = INVALID;
+		freeBlock.nextFree = INVALID;
+		freeBlock.free = false;
+	}
+
+	UINT32 RangeAlloc::createBlock()
+	{
+		if (!mUnusedBlocks.empty())
+		{
+			UINT32 block = mUnusedBlocks.back();
+			mUnusedBlocks.pop_back();
+
+			mBlocks[block] = Block();
+			return block;
+		}
+
+		mBlocks.push_back(Block());
+		return (UINT32)(mBlocks.size() - 1);
+	}
+
+	void RangeAlloc::destroyBlock(UINT32 block)
+	{
+		mUnusedBlocks.push_back(block);
+	}
+}
@@ -0,0 +1,94 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Memory-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Allocates ranges of elements from a linear space. Free ranges are kept in free lists binned by size 
+	 * (two-level, TLSF-style) with bitmaps marking the non-empty bins, so both allocation and deallocation run in
+	 * constant time. Freed ranges are merged with their free neighbors.
+	 *
+	 * The allocator only does the bookkeeping, it doesn't own any memory itself. Offsets returned by getStart() are
+	 * meant to index into some external storage, like a GPU buffer.
+	 */
+	class BS_UTILITY_EXPORT RangeAlloc
+	{
+	public:
+		RangeAlloc();
+
+		/** Allocates a range of @p size elements. Returns a handle to the range, or INVALID if there's no room. */
+		UINT32 alloc(UINT32 size);
+
+		/** Frees a range previously returned by alloc(). */
+		void free(UINT32 range);
+
+		/** Extends the space ranges are allocated from to @p size elements. Existing ranges keep their offsets. */
+		void grow(UINT32 size);
+
+		/** Returns the offset of the first element in the range. */
+		UINT32 getStart(UINT32 range) const { return mBlocks[range].start; }
+
+		/** Returns the total number of elements ranges are allocated from. */
+		UINT32 getSize() const { return mSize; }
+
+		static constexpr UINT32 INVALID = (UINT32)-1;
+
+	private:
+		/** Continuous range of elements, either allocated or free. */
+		struct Block
+		{
+			UINT32 start = 0;
+			UINT32 size = 0;
+			UINT32 prevPhysical = INVALID;
+			UINT32 nextPhysical = INVALID;
+			UINT32 prevFree = INVALID;
+			UINT32 nextFree = INVALID;
+			bool free = false;
+		};
+
+		/** Calculates the first and second level bin indices for a block of the provided size. */
+		static void getBin(UINT32 size, UINT32& firstLevel, UINT32& secondLevel);
+
+		/** Finds a free block large enough to hold @p size elements. */
+		UINT32 findFreeBlock(UINT32 size) const;
+
+		/** Adds the block to the free list of its bin. */
+		void insertFree(UINT32 block);
+
+		/** Removes the block from the free list of its bin. */
+		void removeFree(UINT32 block);
+
+		/** Returns a new block descriptor, reusing a previously destroyed one if available. */
+		UINT32 createBlock();
+
+		/** Releases a block descriptor so it can be reused. */
+		void destroyBlock(UINT32 block);
+
+		static constexpr UINT32 SECOND_LEVEL_BITS = 3;
+		static constexpr UINT32 SECOND_LEVEL_COUNT = 1 << SECOND_LEVEL_BITS;
+		static constexpr UINT32 FIRST_LEVEL_COUNT = 32;
+
+		Vector<Block> mBlocks;
+		Vector<UINT32> mUnusedBlocks;
+		UINT32 mLastBlock = INVALID;
+		UINT32 mSize = 0;
+
+		UINT32 mFirstLevelBitmap = 0;
+		UINT32 mSecondLevelBitmaps[FIRST_LEVEL_COUNT];
+		UINT32 mFreeHeads[FIRST_LEVEL_COUNT][SECOND_LEVEL_COUNT];
+	};
+
+	/** @} */
+	/** @} */
+}
@@ -0,0 +1,338 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Allocators/BsSizeClassAlloc.h"
+
+namespace bs
+{
+	/** Size of the header stored in front of every allocation. Large enough to keep user memory 16 byte aligned. */
+	static constexpr UINT32 HEADER_SIZE = 16;
+
+	/** Size class index written in the header of allocations served directly by malloc. */
+	static constexpr UINT32 LARGE_CLASS = 0xFFFFFFFF;
+
+	/** Size of a single chunk of memory requested from the OS, out of which blocks of a single size class are carved. */
+	static constexpr UINT32 SPAN_SIZE = 64 * 1024;
+
+	/** Maximum number of bytes a thread will keep in its local cache, per size class. */
+	static constexpr UINT32 MAX_THREAD_CACHE_BYTES = 32 * 1024;
+
+	/** Sizes of all blocks, including the header. */
+	static constexpr UINT32 BLOCK_SIZES[] =
+	{
+		32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256,
+		320, 384, 448, 512,
+		640, 768, 896, 1024
+	};
+
+	static constexpr UINT32 NUM_SIZE_CLASSES = sizeof(BLOCK_SIZES) / sizeof(BLOCK_SIZES[0]);
+	static constexpr UINT32 MAX_BLOCK_SIZE = BLOCK_SIZES[NUM_SIZE_CLASSES - 1];
+
+	/** Maps a block size (including the header) to the index of the smallest size class that can hold it. */
+	static UINT32 getSizeClass(size_t size)
+	{
+		if(size <= 128)
+			return size <= 32 ? 0 : (UINT32)((size - 1) / 16) - 1;
+		else if(size <= 256)
+			return 7 + (UINT32)((size - 129) / 32);
+		else if(size <= 512)
+			return 11 + (UINT32)((size - 257) / 64);
+
+		return 15 + (UINT32)((size - 513) / 128);
+	}
+
+	/** Returns the maximum number of blocks of the specified size class that can be kept in a thread-local cache. */
+	static UINT32 getMaxCachedBlocks(UINT32 sizeClass)
+	{
+		return std::max(8U, MAX_THREAD_CACHE_BYTES / BLOCK_SIZES[sizeClass]);
+	}
+
+	/** Header stored in front of every allocation. */
+	struct BlockHeader
+	{
+		UINT32 sizeClass;
+		UINT32 padding;
+		UINT64 size; /**< Only valid for large allocations. */
+	};
+
+	static_assert(sizeof(BlockHeader) <= HEADER_SIZE, "Block header doesn't fit in the reserved space.");
+
+	/** Free block of memory, linked in a free list. Overlaps the block header. */
+	struct FreeBlock
+	{
+		FreeBlock* next;
+	};
+
+	/** Free list and unused span memory for a single size class, shared between all threads. */
+	struct CentralFreeList
+	{
+		SpinLock lock;
+		FreeBlock* head = nullptr;
+		UINT32 count = 0;
+
+		UINT8* spanCurrent = nullptr;
+		UINT8* spanEnd = nullptr;
+	};
+
+	/** State shared between all threads. */
+	struct CentralCache
+	{
+		CentralFreeList freeLists[NUM_SIZE_CLASSES];
+
+		std::atomic<UINT64> reservedBytes{0};
+		std::atomic<UINT64> largeBytes{0};
+		std::atomic<UINT64> numFetches{0};
+		std::atomic<UINT64> numReleases{0};
+	};
+
+	/**
+	 * Returns the central cache. Constructed on first use, as allocations can happen during static initialization, and
+	 * intentionally never destroyed, as they can also happen during static destruction.
+	 */
+	static CentralCache& getCentralCache()
+	{
+		static typename std::aligned_storage<sizeof(CentralCache), alignof(CentralCache)>::type storage;
+		static CentralCache* cache = new (&storage) CentralCache();
+
+		return *cache;
+	}
+
+	/** Per-thread list of free blocks of a single size class. */
+	struct ThreadFreeList
+	{
+		FreeBlock* head;
+		UINT32 count;
+	};
+
+	/**
+	 * Per-thread cache of free blocks. Plain data so it can be accessed with no thread-local initialization overhead. Its
+	 * contents are returned to the central cache by ThreadCacheReleaser when the thread exits.
+	 */
+	struct ThreadCache
+	{
+		ThreadFreeList freeLists[NUM_SIZE_CLASSES];
+		bool released;
+	};
+
+	static BS_THREADLOCAL ThreadCache gThreadCache;
+
+	/**
+	 * Moves up to @p count blocks of the specified size class from the central free list, carving new blocks from spans
+	 * if the list runs out. Returns the number of blocks fetched, and the first block of their linked list in @p first.
+	 */
+	static UINT32 fetchFromCentral(UINT32 sizeClass, UINT32 count, FreeBlock*& first)
+	{
+		CentralCache& central = getCentralCache();
+		CentralFreeList& freeList = central.freeLists[sizeClass];
+		const UINT32 blockSize = BLOCK_SIZES[sizeClass];
+
+		central.numFetches.fetch_add(1, std::memory_order_relaxed);
+
+		ScopedSpinLock lock(freeList.lock);
+
+		UINT32 numFetched = 0;
+		FreeBlock* head = nullptr;
+		while(numFetched < count && freeList.head)
+		{
+			FreeBlock* block = freeList.head;
+			freeList.head = block->next;
+
+			block->next = head;
+			head = block;
+			numFetched++;
+		}
+
+		freeList.count -= numFetched;
+
+		while(numFetched < count)
+		{
+			if((UINT32)(freeList.spanEnd - freeList.spanCurrent) < blockSize)
+			{
+				UINT8* span = (UINT8*)::malloc(SPAN_SIZE);
+				if(span == nullptr)
+					break;
+
+				freeList.spanCurrent = span;
+				freeList.spanEnd = span + SPAN_SIZE;
+
+				central.reservedBytes.fetch_add(SPAN_SIZE, std::memory_order_relaxed);
+			}
+
+			FreeBlock* block = (FreeBlock*)freeList.spanCurrent;
+			freeList.spanCurrent += blockSize;
+
+			block->next = head;
+			head = block;
+			numFetched++;
+		}
+
+		first = head;
+		return numFetched;
+	}
+
+	/** Moves a linked list of @p count blocks of the specified size class to the central free list. */
+	static void releaseToCentral(UINT32 sizeClass, FreeBlock* first, FreeBlock* last, UINT32 count)
+	{
+		CentralCache& central = getCentralCache();
+		CentralFreeList& freeList = central.freeLists[sizeClass];
+
+		central.numReleases.fetch_add(1, std::memory_order_relaxed);
+
+		ScopedSpinLock lock(freeList.lock);
+		last->next = freeList.head;
+		freeList.head = first;
+		freeList.count += count;
+	}
+
+	/** Returns all blocks in the current thread's cache to the central cache when the thread exits. */
+	struct ThreadCacheReleaser
+	{
+		/** Ensures the releaser is constructed for the current thread. */
+		void activate() { }
+
+		~ThreadCacheReleaser()
+		{
+			for(UINT32 i = 0; i < NUM_SIZE_CLASSES; i++)
+			{
+				ThreadFreeList& freeList = gThreadCache.freeLists[i];
+				if(freeList.head == nullptr)
+					continue;
+
+				FreeBlock* last = freeList.head;
+				while(last->next)
+					last = last->next;
+
+				releaseToCentral(i, freeList.head, last, freeList.count);
+
+				freeList.head = nullptr;
+				freeList.count = 0;
+			}
+
+			// Any allocations from now on (e.g. from other thread-local destructors) go directly to the central cache
+			gThreadCache.released = true;
+		}
+	};
+
+	static thread_local ThreadCacheReleaser gThreadCacheReleaser;
+
+	void* SizeClassAlloc::allocate(size_t bytes)
+	{
+		const size_t totalSize = bytes + HEADER_SIZE;
+		if(totalSize > MAX_BLOCK_SIZE)
+		{
+			BlockHeader* header = (BlockHeader*)::malloc(totalSize);
+			if(header == nullptr)
+				return nullptr;
+
+			header->sizeClass = LARGE_CLASS;
+			header->size = bytes;
+
+			getCentralCache().largeBytes.fetch_add(bytes, std::memory_order_relaxed);
+			return (UINT8*)header + HEADER_SIZE;
+		}
+
+		const UINT32 sizeClass = getSizeClass(totalSize);
+		ThreadFreeList& freeList = gThreadCache.freeLists[sizeClass];
+
+		FreeBlock* block = freeList.head;
+		if(block)
+		{
+			freeList.head = block->next;
+			freeList.count--;
+		}
+		else
+		{
+			if(gThreadCache.released)
+			{
+				if(fetchFromCentral(sizeClass, 1, block) == 0)
+					return nullptr;
+			}
+			else
+			{
+				gThreadCacheReleaser.activate();
+
+				// Fetch a batch, keeping all but the first block in the local cache
+				UINT32 numFetched = fetchFromCentral(sizeClass, getMaxCachedBlocks(sizeClass) / 2, block);
+				if(numFetched == 0)
+					return nullptr;
+
+				freeList.head = block->next;
+				freeList.count = numFetched - 1;
+			}
+		}
+
+		BlockHeader* header = (BlockHeader*)block;
+		header->sizeClass = sizeClass;
+
+		return (UINT8*)header + HEADER_SIZE;
+	}
+
+	void SizeClassAlloc::free(void* ptr)
+	{
+		if(ptr == nullptr)
+			return;
+
+		BlockHeader* header = (BlockHeader*)((UINT8*)ptr - HEADER_SIZE);
+		const UINT32 sizeClass = header->sizeClass;
+
+		if(sizeClass == LARGE_CLASS)
+		{
+			getCentralCache().largeBytes.fetch_sub(header->size, std::memory_order_relaxed);
+			::free(header);
+			return;
+		}
+
+		assert(sizeClass < NUM_SIZE_CLASSES);
+
+		FreeBlock* block = (FreeBlock*)header;
+		if(gThreadCache.released)
+		{
+			releaseToCentral(sizeClass, block, block, 1);
+			return;
+		}
+
+		ThreadFreeList& freeList = gThreadCache.freeLists[sizeClass];
+		block->next = freeList.head;
+		freeList.head = block;
+		freeList.count++;
+
+		// Cache grew too large, return half of it to the central cache
+		const UINT32 maxCachedBlocks = getMaxCachedBlocks(sizeClass);
+		if(freeList.count > maxCachedBlocks)
+		{
+			const UINT32 numToRelease = maxCachedBlocks / 2;
+
+			FreeBlock* first = freeList.head;
+			FreeBlock* last = first;
+			for(UINT32 i = 1; i < numToRelease; i++)
+				last = last->next;
+
+			freeList.head = last->next;
+			freeList.count -= numToRelease;
+
+			releaseToCentral(sizeClass, first, last, numToRelease);
+		}
+	}
+
+	SizeClassAllocStats SizeClassAlloc::getStats()
+	{
+		CentralCache& central = getCentralCache();
+
+		SizeClassAllocStats stats;
+		stats.reservedBytes = central.reservedBytes.load(std::memory_order_relaxed);
+		stats.largeBytes = central.largeBytes.load(std::memory_order_relaxed);
+		stats.numCentralFetches = central.numFetches.load(std::memory_order_relaxed);
+		stats.numCentralReleases = central.numReleases.load(std::memory_order_relaxed);
+
+		for(UINT32 i = 0; i < NUM_SIZE_CLASSES; i++)
+		{
+			CentralFreeList& freeList = central.freeLists[i];
+
+			ScopedSpinLock lock(freeList.lock);
+			stats.centralFreeBytes += (UINT64)freeList.count * BLOCK_SIZES[i];
+		}
+
+		return stats;
+	}
+}
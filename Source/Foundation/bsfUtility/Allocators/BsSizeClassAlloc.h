@@ -0,0 +1,66 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bs
+{
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Memory-Internal
+	 *  @{
+	 */
+
+	/** Statistics reported by SizeClassAlloc. Values are a snapshot and may be out of date if other threads allocate. */
+	struct SizeClassAllocStats
+	{
+		/** Number of bytes reserved from the OS for serving small allocations. */
+		uint64_t reservedBytes = 0;
+
+		/** Number of bytes in free blocks stored in the central free lists, available for use by any thread. */
+		uint64_t centralFreeBytes = 0;
+
+		/** Number of bytes used by allocations too large for any size class, served directly by the OS. */
+		uint64_t largeBytes = 0;
+
+		/** Number of times a thread had to refill its local cache from the central free lists. */
+		uint64_t numCentralFetches = 0;
+
+		/** Number of times a thread returned blocks from its local cache to the central free lists. */
+		uint64_t numCentralReleases = 0;
+	};
+
+	/**
+	 * General purpose allocator that serves small allocations from a set of fixed size classes. Each thread keeps a local
+	 * cache of free blocks per size class so the majority of allocations and frees require no synchronization. When a
+	 * local cache runs empty (or grows too large) blocks are moved in batches from (or to) a central free list shared by
+	 * all threads. Allocations too large for any size class are forwarded to malloc.
+	 *
+	 * Memory used for small allocations is never returned to the OS, but is instead kept for reuse by later allocations.
+	 *
+	 * @note
+	 * Used as the backend for MemoryAllocator<GenAlloc> when the framework is built with BS_POOLED_GENERAL_ALLOCATOR
+	 * enabled, in which case any memory allocated with bs_alloc() must be freed with bs_free() and vice versa.
+	 * @note
+	 * Thread safe. Memory may be freed on a different thread than the one it was allocated on.
+	 */
+	class BS_UTILITY_EXPORT SizeClassAlloc
+	{
+	public:
+		/** Allocates @p bytes bytes. Returned memory is aligned to a 16 byte boundary. */
+		static void* allocate(size_t bytes);
+
+		/** Frees memory previously allocated with allocate(). */
+		static void free(void* ptr);
+
+		/** Returns statistics about the memory managed by the allocator. */
+		static SizeClassAllocStats getStats();
+	};
+
+	/** @} */
+	/** @} */
+}
@@ -4,6 +4,9 @@ set(BS_UTILITY_INC_THREADING
 	"bsfUtility/Threading/BsSpinLock.h"
 	"bsfUtility/Threading/BsThreadPool.h"
 	"bsfUtility/Threading/BsTaskScheduler.h"
+	"bsfUtility/Threading/BsWorkStealingQueue.h"
+	"bsfUtility/Threading/BsLockFreeQueue.h"
+	"bsfUtility/Threading/BsLockProfiler.h"
 )
 
 set(BS_UTILITY_SRC_THIRDPARTY
@@ -48,12 +51,14 @@ set(BS_UTILITY_SRC_UTILITY
 	"bsfUtility/Utility/BsCompression.cpp"
 	"bsfUtility/Utility/BsTriangulation.cpp"
 	"bsfUtility/Utility/BsUUID.cpp"
+	"bsfUtility/Utility/BsStaticBVH.cpp"
 )
 
 set(BS_UTILITY_INC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.h"
 	"bsfUtility/Debug/BsDebug.h"
 	"bsfUtility/Debug/BsLog.h"
+	"bsfUtility/Debug/BsSamplingProfiler.h"
 )
 
 set(BS_UTILITY_INC_FILESYSTEM
@@ -72,6 +77,7 @@ set(BS_UTILITY_SRC_THREADING
 	"bsfUtility/Threading/BsAsyncOp.cpp"
 	"bsfUtility/Threading/BsTaskScheduler.cpp"
 	"bsfUtility/Threading/BsThreadPool.cpp"
+	"bsfUtility/Threading/BsLockProfiler.cpp"
 )
 
 set(BS_UTILITY_INC_UTILITY
@@ -80,6 +86,7 @@ set(BS_UTILITY_INC_UTILITY
 	"bsfUtility/Utility/BsDynLib.h"
 	"bsfUtility/Utility/BsDynLibManager.h"
 	"bsfUtility/Utility/BsEvent.h"
+	"bsfUtility/Utility/BsDelegate.h"
 	"bsfUtility/Utility/BsMessageHandler.h"
 	"bsfUtility/Utility/BsMessageHandlerFwd.h"
 	"bsfUtility/Utility/BsModule.h"
@@ -92,8 +99,11 @@ set(BS_UTILITY_INC_UTILITY
 	"bsfUtility/Utility/BsCompression.h"
 	"bsfUtility/Utility/BsTriangulation.h"
 	"bsfUtility/Utility/BsNonCopyable.h"
+	"bsfUtility/Utility/BsSmallVector.h"
+	"bsfUtility/Utility/BsFlatHashMap.h"
 	"bsfUtility/Utility/BsUUID.h"
 	"bsfUtility/Utility/BsOctree.h"
+	"bsfUtility/Utility/BsStaticBVH.h"
 	"bsfUtility/Utility/BsDataBlob.h"
 )
 
@@ -101,6 +111,9 @@ set(BS_UTILITY_SRC_ALLOCATORS
 	"bsfUtility/Allocators/BsFrameAlloc.cpp"
 	"bsfUtility/Allocators/BsStackAlloc.cpp"
 	"bsfUtility/Allocators/BsMemoryAllocator.cpp"
+	"bsfUtility/Allocators/BsSizeClassAlloc.cpp"
+	"bsfUtility/Allocators/BsRangeAlloc.cpp"
+	"bsfUtility/Allocators/BsMemAllocProfiler.cpp"
 )
 
 set(BS_UTILITY_SRC_REFLECTION
@@ -113,6 +126,7 @@ set(BS_UTILITY_SRC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.cpp"
 	"bsfUtility/Debug/BsLog.cpp"
 	"bsfUtility/Debug/BsDebug.cpp"
+	"bsfUtility/Debug/BsSamplingProfiler.cpp"
 )
 
 set(BS_UTILITY_INC_RTTI
@@ -129,6 +143,8 @@ set(BS_UTILITY_INC_ALLOCATORS
 	"bsfUtility/Allocators/BsGroupAlloc.h"
 	"bsfUtility/Allocators/BsFreeAlloc.h"
 	"bsfUtility/Allocators/BsPoolAlloc.h"
+	"bsfUtility/Allocators/BsSizeClassAlloc.h"
+	"bsfUtility/Allocators/BsRangeAlloc.h"
 )
 
 set(BS_UTILITY_INC_THIRDPARTY
@@ -166,18 +182,23 @@ set(BS_UTILITY_SRC_MATH
 	"bsfUtility/Math/BsLineSegment3.cpp"
 	"bsfUtility/Math/BsCapsule.cpp"
 	"bsfUtility/Math/BsLine2.cpp"
+	"bsfUtility/Math/BsBoundsArray.cpp"
 )
 
 set(BS_UTILITY_INC_TESTING
 	"bsfUtility/Testing/BsTestSuite.h"
 	"bsfUtility/Testing/BsTestOutput.h"
 	"bsfUtility/Testing/BsConsoleTestOutput.h"
+	"bsfUtility/Testing/BsBenchmarkSuite.h"
+	"bsfUtility/Testing/BsBenchmarkOutput.h"
 )
 
 set(BS_UTILITY_SRC_TESTING
 	"bsfUtility/Testing/BsTestSuite.cpp"
 	"bsfUtility/Testing/BsTestOutput.cpp"
 	"bsfUtility/Testing/BsConsoleTestOutput.cpp"
+	"bsfUtility/Testing/BsBenchmarkSuite.cpp"
+	"bsfUtility/Testing/BsBenchmarkOutput.cpp"
 )
 
 set(BS_UTILITY_SRC_SERIALIZATION
@@ -217,6 +238,7 @@ set(BS_UTILITY_INC_MATH
 	"bsfUtility/Math/BsMatrixNxM.h"
 	"bsfUtility/Math/BsLine2.h"
 	"bsfUtility/Math/BsSIMD.h"
+	"bsfUtility/Math/BsBoundsArray.h"
 )
 
 set(BS_UTILITY_SRC_ERROR
@@ -256,6 +278,7 @@ set(BS_UTILITY_INC_WIN32
 set(BS_UTILITY_SRC_WIN32
 	"bsfUtility/Private/Win32/BsWin32FileSystem.cpp"
 	"bsfUtility/Private/Win32/BsWin32CrashHandler.cpp"
+	"bsfUtility/Private/Win32/BsWin32SamplingProfiler.cpp"
 	"bsfUtility/Private/Win32/BsWin32PlatformUtility.cpp"
 	"bsfUtility/Private/Win32/BsWin32Window.cpp"
 )
@@ -263,6 +286,7 @@ set(BS_UTILITY_SRC_WIN32
 set(BS_UTILITY_SRC_UNIX
 	"bsfUtility/Private/Unix/BsUnixFileSystem.cpp"
 	"bsfUtility/Private/Unix/BsUnixCrashHandler.cpp"
+	"bsfUtility/Private/Unix/BsUnixSamplingProfiler.cpp"
 )
 
 set(BS_UTILITY_SRC_LINUX
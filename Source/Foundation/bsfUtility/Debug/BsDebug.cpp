@@ -28,30 +28,167 @@ void logToIDEConsole(const bs::String& message)
 
 namespace bs
 {
+	/** Hash and channel of the last message logged on this thread, and the number of times it was repeated. */
+	static BS_THREADLOCAL size_t sLastMessageHash = 0;
+	static BS_THREADLOCAL UINT32 sLastMessageChannel = 0;
+	static BS_THREADLOCAL UINT32 sNumRepeats = 0;
+
+	Debug::~Debug()
+	{
+		stopAsyncOutput();
+	}
+
 	void Debug::logDebug(const String& msg)
 	{
-		mLog.logMsg(msg, (UINT32)DebugChannel::Debug);
-		logToIDEConsole(msg);
+		logInternal(msg, (UINT32)DebugChannel::Debug);
 	}
 
 	void Debug::logWarning(const String& msg)
 	{
-		mLog.logMsg(msg, (UINT32)DebugChannel::Warning);
-		logToIDEConsole(msg);
+		logInternal(msg, (UINT32)DebugChannel::Warning);
 	}
 
 	void Debug::logError(const String& msg)
 	{
-		mLog.logMsg(msg, (UINT32)DebugChannel::Error);
-		logToIDEConsole(msg);
+		logInternal(msg, (UINT32)DebugChannel::Error);
 	}
 
 	void Debug::log(const String& msg, UINT32 channel)
 	{
+		logInternal(msg, channel);
+	}
+
+	void Debug::logInternal(const String& msg, UINT32 channel)
+	{
+		size_t hash = 0;
+		hash_combine(hash, msg);
+		hash_combine(hash, channel);
+
+		UINT32 maxRepeats = mMaxRepeatedMessages.load(std::memory_order_relaxed);
+		if (hash == sLastMessageHash)
+		{
+			sNumRepeats++;
+			if (maxRepeats != 0 && sNumRepeats >= maxRepeats)
+				return;
+		}
+		else
+		{
+			if (maxRepeats != 0 && sNumRepeats >= maxRepeats)
+			{
+				String note = "Previous message repeated " + toString(sNumRepeats - maxRepeats + 1) + " more times.";
+				mLog.logMsg(note, sLastMessageChannel);
+				output(note);
+			}
+
+			sLastMessageHash = hash;
+			sLastMessageChannel = channel;
+			sNumRepeats = 0;
+		}
+
 		mLog.logMsg(msg, channel);
+		output(msg);
+	}
+
+	void Debug::output(const String& msg)
+	{
+		if (mAsyncOutput.load(std::memory_order_acquire))
+		{
+			// Registered as a producer before checking the flag again, so stopAsyncOutput() either sees this thread
+			// and waits for it before the final flush, or this thread sees async output as stopped
+			mNumActiveProducers.fetch_add(1, std::memory_order_seq_cst);
+
+			bool queued = false;
+			if (mAsyncOutput.load(std::memory_order_seq_cst))
+				queued = mOutputQueue.push(String(msg));
+
+			mNumActiveProducers.fetch_sub(1, std::memory_order_release);
+
+			if (queued)
+			{
+				mOutputSignal.notify_one();
+				return;
+			}
+
+			// Either async output was just stopped, or the output thread is falling behind. Print the message right
+			// away instead of waiting.
+		}
+
 		logToIDEConsole(msg);
 	}
 
+	void Debug::startAsyncOutput(const Path& logFile)
+	{
+		Lock lock(mOutputMutex);
+		if (mAsyncOutput.load(std::memory_order_relaxed))
+			return;
+
+		if (!logFile.isEmpty())
+			mOutputFile = FileSystem::createAndOpenFile(logFile);
+
+		mStopOutput = false;
+		mOutputThread = Thread(std::bind(&Debug::outputThreadMain, this));
+		mAsyncOutput.store(true, std::memory_order_release);
+	}
+
+	void Debug::stopAsyncOutput()
+	{
+		{
+			Lock lock(mOutputMutex);
+			if (!mAsyncOutput.load(std::memory_order_relaxed))
+				return;
+
+			mAsyncOutput.store(false, std::memory_order_seq_cst);
+			mStopOutput = true;
+		}
+
+		mOutputSignal.notify_one();
+		mOutputThread.join();
+
+		// Wait for producers that saw async output as enabled to finish pushing their messages. Any producer that
+		// starts after this sees async output as stopped and prints its message directly.
+		while (mNumActiveProducers.load(std::memory_order_seq_cst) > 0)
+			std::this_thread::yield();
+
+		// Print anything queued after the output thread's last flush
+		flushOutput();
+
+		if (mOutputFile != nullptr)
+		{
+			mOutputFile->close();
+			mOutputFile = nullptr;
+		}
+	}
+
+	void Debug::outputThreadMain()
+	{
+		while (true)
+		{
+			flushOutput();
+
+			Lock lock(mOutputMutex);
+			if (mStopOutput)
+				break;
+
+			// Wake up periodically since producers notify without holding the mutex, and a notification could be missed
+			mOutputSignal.wait_for(lock, std::chrono::milliseconds(10));
+		}
+	}
+
+	void Debug::flushOutput()
+	{
+		String msg;
+		while (mOutputQueue.pop(msg))
+		{
+			logToIDEConsole(msg);
+
+			if (mOutputFile != nullptr)
+			{
+				mOutputFile->write(msg.data(), msg.size());
+				mOutputFile->write("\n", 1);
+			}
+		}
+	}
+
 	void Debug::writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath, 
 		bool overwrite) const
 	{
@@ -22,12 +22,17 @@ namespace bs
 	/**
 	 * Utility class providing various debug functionality.
 	 *
+	 * Logged messages are stored in the Log and printed to the console. By default printing happens on the logging
+	 * thread, which can be moved to a background thread with startAsyncOutput(). Messages repeated many times in a row
+	 * on the same thread are only logged a limited number of times (see setMaxRepeatedMessages()).
+	 *
 	 * @note	Thread safe.
 	 */
 	class BS_UTILITY_EXPORT Debug
 	{
 	public:
 		Debug() = default;
+		~Debug();
 
 		/** Adds a log entry in the "Debug" channel. */
 		void logDebug(const String& msg);
@@ -44,6 +49,25 @@ namespace bs
 		/** Retrieves the Log used by the Debug instance. */
 		Log& getLog() { return mLog; }
 
+		/**
+		 * Starts a background thread that prints logged messages to the console, and optionally writes them to a file.
+		 * Logging threads only queue the messages and don't wait on the output. Messages that haven't been printed yet
+		 * are lost if the application crashes, but remain in the Log.
+		 *
+		 * @param[in]	logFile		Optional path to a file to write the messages to. Existing file is overwritten.
+		 */
+		void startAsyncOutput(const Path& logFile = Path::BLANK);
+
+		/** Prints all queued messages and stops the thread started by startAsyncOutput(). */
+		void stopAsyncOutput();
+
+		/**
+		 * Sets the maximum number of times the same message can be logged in a row from a single thread. Further
+		 * repeats are dropped, and their count is reported once a different message is logged. Zero means no limit.
+		 * Default is 10.
+		 */
+		void setMaxRepeatedMessages(UINT32 count) { mMaxRepeatedMessages = count; }
+
 		/** Converts raw pixels into a BMP image and saves it as a file */
 		void writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath, 
 			bool overwrite = true) const;
@@ -83,8 +107,30 @@ namespace bs
 
 		/** @} */
 	private:
+		/** Adds the message to the log and prints it, unless it is a dropped repeat of the previous message. */
+		void logInternal(const String& msg, UINT32 channel);
+
+		/** Prints the message to the console, or queues it for the output thread. */
+		void output(const String& msg);
+
+		/** Entry point of the output thread. */
+		void outputThreadMain();
+
+		/** Prints and writes all queued messages. Output thread only, or after the output thread has been joined. */
+		void flushOutput();
+
 		UINT64 mLogHash = 0;
 		Log mLog;
+		std::atomic<UINT32> mMaxRepeatedMessages{10};
+
+		LockFreeQueue<String> mOutputQueue;
+		std::atomic<bool> mAsyncOutput{false};
+		std::atomic<UINT32> mNumActiveProducers{0};
+		bool mStopOutput = false;
+		Thread mOutputThread;
+		SPtr<DataStream> mOutputFile;
+		Mutex mOutputMutex;
+		Signal mOutputSignal;
 	};
 
 	/** A simpler way of accessing the Debug module. */
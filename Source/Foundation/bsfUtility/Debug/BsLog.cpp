@@ -12,14 +12,50 @@ namespace bs
 
 	void Log::logMsg(const String& message, UINT32 channel)
 	{
+		LogEntry entry(message, channel);
+		if (mPendingEntries.push(std::move(entry)))
+			return;
+
+		// Queue is full, empty it while holding the lock. The entry is left untouched by the failed push.
 		RecursiveLock lock(mMutex);
+		flushPending();
+
+		mUnreadEntries.push(std::move(entry));
+		trimEntries();
+	}
+
+	void Log::setMaxEntries(UINT32 count)
+	{
+		RecursiveLock lock(mMutex);
+
+		mMaxEntries = count;
+		trimEntries();
+	}
+
+	void Log::flushPending() const
+	{
+		while (mPendingEntries.popWith([this](LogEntry&& entry) { mUnreadEntries.push(std::move(entry)); }))
+		{ }
 
-		mUnreadEntries.push(LogEntry(message, channel));
+		trimEntries();
+	}
+
+	void Log::trimEntries() const
+	{
+		if (mMaxEntries == 0)
+			return;
+
+		while (mEntries.size() > mMaxEntries)
+			mEntries.pop_front();
+
+		while (mUnreadEntries.size() > mMaxEntries)
+			mUnreadEntries.pop();
 	}
 
 	void Log::clear()
 	{
 		RecursiveLock lock(mMutex);
+		flushPending();
 
 		mEntries.clear();
 
@@ -32,8 +68,9 @@ namespace bs
 	void Log::clear(UINT32 channel)
 	{
 		RecursiveLock lock(mMutex);
+		flushPending();
 
-		Vector<LogEntry> newEntries;
+		Deque<LogEntry> newEntries;
 		for(auto& entry : mEntries)
 		{
 			if (entry.getChannel() == channel)
@@ -63,6 +100,7 @@ namespace bs
 	bool Log::getUnreadEntry(LogEntry& entry)
 	{
 		RecursiveLock lock(mMutex);
+		flushPending();
 
 		if (mUnreadEntries.empty())
 			return false;
@@ -70,6 +108,7 @@ namespace bs
 		entry = mUnreadEntries.front();
 		mUnreadEntries.pop();
 		mEntries.push_back(entry);
+		trimEntries();
 		mHash++;
 
 		return true;
@@ -77,6 +116,8 @@ namespace bs
 
 	bool Log::getLastEntry(LogEntry& entry)
 	{
+		RecursiveLock lock(mMutex);
+
 		if (mEntries.size() == 0)
 			return false;
 
@@ -88,7 +129,7 @@ namespace bs
 	{
 		RecursiveLock lock(mMutex);
 
-		return mEntries;
+		return Vector<LogEntry>(mEntries.begin(), mEntries.end());
 	}
 
 	Vector<LogEntry> Log::getAllEntries() const
@@ -96,6 +137,7 @@ namespace bs
 		Vector<LogEntry> entries;
 		{
 			RecursiveLock lock(mMutex);
+			flushPending();
 
 			for (auto& entry : mEntries)
 				entries.push_back(entry);
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Threading/BsLockFreeQueue.h"
 
 namespace bs
 {
@@ -33,6 +34,10 @@ namespace bs
 	/**
 	 * Used for logging messages. Can categorize messages according to channels, save the log to a file
 	 * and send out callbacks when a new message is added.
+	 *
+	 * New messages are added to a lock-free queue, so threads logging at the same time don't wait on each other. They
+	 * are moved to the main entry lists by the next call that reads the log. Only a limited number of most recent
+	 * entries are kept (see setMaxEntries()).
 	 * 			
 	 * @note	Thread safe.
 	 */
@@ -43,13 +48,22 @@ namespace bs
 		~Log();
 
 		/**
-		 * Logs a new message. 
+		 * Logs a new message. Doesn't lock unless too many messages were logged since the log was last read.
 		 *
 		 * @param[in]	message	The message describing the log entry.
 		 * @param[in]	channel Channel in which to store the log entry.
 		 */
 		void logMsg(const String& message, UINT32 channel);
 
+		/**
+		 * Sets the maximum number of entries kept by the log, separately for read and unread entries. Oldest entries
+		 * are removed first. Zero means no limit. Default is 16384.
+		 */
+		void setMaxEntries(UINT32 count);
+
+		/** Returns the limit set by setMaxEntries(). */
+		UINT32 getMaxEntries() const { return mMaxEntries; }
+
 		/** Removes all log entries. */
 		void clear();
 
@@ -87,9 +101,17 @@ namespace bs
 		/** Returns all log entries, including those marked as unread. */
 		Vector<LogEntry> getAllEntries() const;
 
-		Vector<LogEntry> mEntries;
-		Queue<LogEntry> mUnreadEntries;
+		/** Moves messages from the lock-free queue to the unread entries. Caller must hold the mutex. */
+		void flushPending() const;
+
+		/** Removes the oldest entries from the entry lists until they fit the limit. Caller must hold the mutex. */
+		void trimEntries() const;
+
+		mutable Deque<LogEntry> mEntries;
+		mutable Queue<LogEntry> mUnreadEntries;
+		mutable LockFreeQueue<LogEntry> mPendingEntries;
 		UINT64 mHash = 0;
+		UINT32 mMaxEntries = 16384;
 		mutable RecursiveMutex mMutex;
 	};
 
@@ -0,0 +1,210 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Debug/BsSamplingProfiler.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	constexpr UINT32 SamplingProfiler::MAX_STACK_DEPTH;
+
+	/** Information about a thread registered for sampling. */
+	struct SampledThread
+	{
+		ThreadId id;
+		String name;
+		UINT64 handle;
+	};
+
+	/** Returns a list of all threads registered for sampling. */
+	static Vector<SampledThread>& getSampledThreads()
+	{
+		static Vector<SampledThread> threads;
+		return threads;
+	}
+
+	/** Returns the mutex protecting the list returned by getSampledThreads(). */
+	static Mutex& getSampledThreadsMutex()
+	{
+		static Mutex mutex;
+		return mutex;
+	}
+
+	SamplingProfiler::SamplingProfiler()
+	{
+		initPlatform();
+	}
+
+	SamplingProfiler::~SamplingProfiler()
+	{
+		stop();
+	}
+
+	void SamplingProfiler::start(UINT32 intervalUs)
+	{
+		if (isRunning())
+			return;
+
+		mIntervalUs = std::max(intervalUs, 1U);
+		mRunning.store(true, std::memory_order_relaxed);
+		mThread = Thread(std::bind(&SamplingProfiler::run, this));
+	}
+
+	void SamplingProfiler::stop()
+	{
+		if (!isRunning())
+			return;
+
+		{
+			Lock lock(mThreadMutex);
+			mRunning.store(false, std::memory_order_relaxed);
+		}
+
+		mStopCondition.notify_one();
+		mThread.join();
+	}
+
+	void SamplingProfiler::clear()
+	{
+		Lock lock(mStacksMutex);
+		mStacks.clear();
+		mNumSamples = 0;
+	}
+
+	UINT64 SamplingProfiler::getNumSamples() const
+	{
+		Lock lock(mStacksMutex);
+		return mNumSamples;
+	}
+
+	void SamplingProfiler::run()
+	{
+		Lock lock(mThreadMutex);
+		while (isRunning())
+		{
+			lock.unlock();
+			sampleThreads();
+			lock.lock();
+
+			mStopCondition.wait_for(lock, std::chrono::microseconds(mIntervalUs), [this]() { return !isRunning(); });
+		}
+	}
+
+	void SamplingProfiler::sampleThreads()
+	{
+		void* frames[MAX_STACK_DEPTH];
+
+		// Holding the lock ensures sampled threads cannot unregister and exit while their stack is being captured
+		Lock threadsLock(getSampledThreadsMutex());
+		for (auto& thread : getSampledThreads())
+		{
+			UINT32 numFrames = captureStack(thread.handle, frames, MAX_STACK_DEPTH);
+			if (numFrames == 0)
+				continue;
+
+			// The sampled thread is running again, so it is safe to allocate from here on
+			Lock stacksLock(mStacksMutex);
+
+			auto iterFind = std::find(mThreadNames.begin(), mThreadNames.end(), thread.name);
+			UINT64 nameIdx = (UINT64)(iterFind - mThreadNames.begin());
+			if (iterFind == mThreadNames.end())
+				mThreadNames.push_back(thread.name);
+
+			Vector<UINT64> stack(numFrames + 1);
+			stack[0] = nameIdx;
+
+			for (UINT32 i = 0; i < numFrames; i++)
+				stack[i + 1] = (UINT64)(uintptr_t)frames[i];
+
+			mStacks[stack]++;
+			mNumSamples++;
+		}
+	}
+
+	bool SamplingProfiler::exportFlameGraph(const Path& path) const
+	{
+		Map<Vector<UINT64>, UINT64> stacks;
+		Vector<String> threadNames;
+		{
+			Lock lock(mStacksMutex);
+			stacks = mStacks;
+			threadNames = mThreadNames;
+		}
+
+		UnorderedMap<UINT64, String> symbolNames;
+		StringStream output;
+		for (auto& entry : stacks)
+		{
+			const Vector<UINT64>& stack = entry.first;
+			output << threadNames[(size_t)stack[0]];
+
+			// Stored innermost first, but the collapsed format expects the outermost function first
+			for (size_t i = stack.size() - 1; i > 0; i--)
+			{
+				// All but the innermost entry are return addresses, which can point past the end of the calling function
+				UINT64 address = i > 1 ? stack[i] - 1 : stack[i];
+
+				auto iterFind = symbolNames.find(address);
+				if (iterFind == symbolNames.end())
+				{
+					String name = getSymbolName((void*)(uintptr_t)address);
+
+					// Semicolons separate the stack entries, and can appear in demangled names of template arguments
+					std::replace(name.begin(), name.end(), ';', ':');
+					iterFind = symbolNames.insert(std::make_pair(address, name)).first;
+				}
+
+				output << ";" << iterFind->second;
+			}
+
+			output << " " << entry.second << "\n";
+		}
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if (stream == nullptr)
+		{
+			LOGERR("Failed to save the sampling profiler output to: " + path.toString());
+			return false;
+		}
+
+		String outputString = output.str();
+		stream->write(outputString.data(), outputString.size());
+		stream->close();
+
+		return true;
+	}
+
+	void SamplingProfiler::registerThread(const String& name)
+	{
+		SampledThread thread;
+		thread.id = BS_THREAD_CURRENT_ID;
+		thread.name = name;
+		thread.handle = getCurrentThreadHandle();
+
+		Lock lock(getSampledThreadsMutex());
+		getSampledThreads().push_back(thread);
+	}
+
+	void SamplingProfiler::unregisterThread()
+	{
+		ThreadId id = BS_THREAD_CURRENT_ID;
+
+		Lock lock(getSampledThreadsMutex());
+
+		Vector<SampledThread>& threads = getSampledThreads();
+		auto iterFind = std::find_if(threads.begin(), threads.end(),
+			[id](const SampledThread& entry) { return entry.id == id; });
+
+		if (iterFind == threads.end())
+			return;
+
+		releaseThreadHandle(iterFind->handle);
+		threads.erase(iterFind);
+	}
+
+	SamplingProfiler& gSamplingProfiler()
+	{
+		return SamplingProfiler::instance();
+	}
+}
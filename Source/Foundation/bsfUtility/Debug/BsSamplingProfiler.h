@@ -0,0 +1,116 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Debug
+	 *  @{
+	 */
+
+	/**
+	 * Statistical profiler that periodically interrupts registered threads and records their call stacks. Unlike
+	 * ProfilerCPU it requires no instrumentation and doesn't distort the timings of tight loops, at the cost of only
+	 * providing approximate results, proportional to the time spent in each function.
+	 *
+	 * Threads must register themselves using registerThread() in order to be sampled. The sim, core and TaskScheduler
+	 * worker threads are registered automatically. Sampling is disabled until start() is called.
+	 *
+	 * Recorded stacks are kept as raw addresses and are only resolved to function names when exported.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT SamplingProfiler : public Module<SamplingProfiler>
+	{
+	public:
+		/** Maximum number of call stack entries recorded per sample. Deeper stacks are truncated. */
+		static constexpr UINT32 MAX_STACK_DEPTH = 64;
+
+		SamplingProfiler();
+		~SamplingProfiler();
+
+		/**
+		 * Starts sampling all registered threads, on a separate background thread.
+		 *
+		 * @param[in]	intervalUs	Time between two samples of the same thread, in microseconds.
+		 */
+		void start(UINT32 intervalUs = 1000);
+
+		/** Stops sampling. Already recorded samples are kept until clear() is called. */
+		void stop();
+
+		/** Checks is the profiler currently sampling. */
+		bool isRunning() const { return mRunning.load(std::memory_order_relaxed); }
+
+		/** Removes all recorded samples. */
+		void clear();
+
+		/** Returns the total number of samples recorded, over all threads. */
+		UINT64 getNumSamples() const;
+
+		/**
+		 * Resolves recorded call stacks to function names and saves them in the collapsed stack format, with one line per
+		 * unique call stack, consisting of the thread name and the functions from outermost to innermost separated by
+		 * semicolons, followed by the number of times the stack was sampled. The output can be turned into a flame graph
+		 * using flamegraph.pl, or opened directly in tools such as speedscope.
+		 *
+		 * @return	True if the file was written successfully.
+		 */
+		bool exportFlameGraph(const Path& path) const;
+
+		/**
+		 * Registers the calling thread for sampling, using the provided name to identify it in the output. A thread must
+		 * call unregisterThread() before it exits.
+		 */
+		static void registerThread(const String& name);
+
+		/** Unregisters a thread previously registered with registerThread(). Must be called from the same thread. */
+		static void unregisterThread();
+
+	private:
+		/** Loop executing on the sampling thread. */
+		void run();
+
+		/** Captures a single sample of all registered threads. */
+		void sampleThreads();
+
+		/** Performs platform specific initialization required for sampling threads. */
+		static void initPlatform();
+
+		/** Returns a platform specific handle that can be used for sampling the calling thread. */
+		static UINT64 getCurrentThreadHandle();
+
+		/** Releases a handle returned by getCurrentThreadHandle(). */
+		static void releaseThreadHandle(UINT64 handle);
+
+		/**
+		 * Interrupts the thread with the provided handle and records its call stack, innermost function first. Returns
+		 * the number of recorded entries, or 0 if the stack couldn't be captured. Must not allocate memory or acquire any
+		 * locks the sampled thread could be holding.
+		 */
+		static UINT32 captureStack(UINT64 handle, void** frames, UINT32 maxFrames);
+
+		/** Returns a human readable name of the function at the provided address. */
+		static String getSymbolName(void* address);
+
+		std::atomic<bool> mRunning{false};
+		UINT32 mIntervalUs = 1000;
+		Thread mThread;
+		Mutex mThreadMutex;
+		Signal mStopCondition;
+
+		/** Sampled stacks, each starting with the index of the thread name, followed by addresses from innermost out. */
+		Map<Vector<UINT64>, UINT64> mStacks;
+		Vector<String> mThreadNames;
+		UINT64 mNumSamples = 0;
+		mutable Mutex mStacksMutex;
+	};
+
+	/** Provides easy access to the SamplingProfiler. */
+	BS_UTILITY_EXPORT SamplingProfiler& gSamplingProfiler();
+
+	/** @} */
+}
@@ -418,4 +418,49 @@ namespace bs
 			}
 		}
 	}
+
+	MappedFileDataStream::MappedFileDataStream(const SPtr<MappedFileDataStream>& source, size_t offset, size_t size)
+		:MemoryDataStream(nullptr, 0, false), mPath(source->mPath), mSource(source)
+	{
+		mAccess = READ;
+
+		assert(offset + size <= source->mSize);
+
+		if (source->mData != nullptr)
+		{
+			mData = mPos = source->mData + offset;
+			mSize = size;
+			mEnd = mData + mSize;
+		}
+	}
+
+	MappedFileDataStream::~MappedFileDataStream()
+	{
+		// Base class destructor would only call its own version of close()
+		close();
+	}
+
+	void AsyncFileStream::wait()
+	{
+		Lock lock(mMutex);
+		while (mNumPendingReads > 0)
+			mSignal.wait(lock);
+	}
+
+	UINT32 AsyncFileStream::getNumPendingReads() const
+	{
+		Lock lock(mMutex);
+		return mNumPendingReads;
+	}
+
+	void AsyncFileStream::notifyReadCompleted(const ReadCallback& callback, size_t bytesRead)
+	{
+		// Trigger the callback before decrementing, so wait() also guarantees all callbacks have finished
+		if (callback)
+			callback(bytesRead);
+
+		Lock lock(mMutex);
+		mNumPendingReads--;
+		mSignal.notify_all();
+	}
 }
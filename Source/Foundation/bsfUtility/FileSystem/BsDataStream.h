@@ -50,6 +50,13 @@ namespace bs
 		virtual bool isWriteable() const { return (mAccess & WRITE) != 0; }
 		virtual bool isFile() const = 0;
 
+		/**
+		 * Returns true if the stream contents are a file mapped into memory. Such streams are always MemoryDataStream%s,
+		 * and their memory remains valid for as long as the stream is referenced, allowing it to be used in-place instead
+		 * of being copied.
+		 */
+		virtual bool isMemoryMapped() const { return false; }
+
 		/** Reads data from the buffer and copies it to the specified value. */
 		template<typename T> DataStream& operator>>(T& val);
 
@@ -282,6 +289,113 @@ namespace bs
 		bool mFreeOnClose;	
 	};
 
+	/**
+	 * Data stream providing read access to a file mapped into memory. Reads are served directly from the mapped memory
+	 * and the memory can also be accessed through getPtr(), avoiding any copies. The mapping is copy-on-write, meaning
+	 * the memory may be modified without affecting the file.
+	 */
+	class BS_UTILITY_EXPORT MappedFileDataStream : public MemoryDataStream
+	{
+	public:
+		/**
+		 * Maps the file at the provided path into memory. If the file cannot be mapped the stream is left empty and
+		 * getPtr() returns null.
+		 *
+		 * @param[in]	filePath	Path of the file to map.
+		 */
+		MappedFileDataStream(const Path& filePath);
+
+		/**
+		 * Creates a stream providing access to a portion of an already mapped file. The source mapping is kept alive for
+		 * as long as the new stream exists.
+		 *
+		 * @param[in]	source		Stream whose mapping to reference.
+		 * @param[in]	offset		Offset in bytes from the start of the source stream's data.
+		 * @param[in]	size		Size of the referenced portion in bytes.
+		 */
+		MappedFileDataStream(const SPtr<MappedFileDataStream>& source, size_t offset, size_t size);
+		~MappedFileDataStream();
+
+		/** @copydoc DataStream::isMemoryMapped */
+		bool isMemoryMapped() const override { return mData != nullptr; }
+
+		/** @copydoc DataStream::close */
+		void close() override;
+
+		/** Returns the path of the file mapped by the stream. */
+		const Path& getPath() const { return mPath; }
+
+	protected:
+		Path mPath;
+		SPtr<MappedFileDataStream> mSource;
+	};
+
+	/**
+	 * Provides asynchronous read access to a file. Reads are queued with the operating system (io_uring on Linux,
+	 * overlapped I/O on Windows) and complete without occupying the calling thread, allowing many reads to be in flight
+	 * at once. On platforms without such support, or if it is unavailable at runtime, reads are performed on the thread
+	 * pool if it is started, or synchronously otherwise.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT AsyncFileStream : INonCopyable
+	{
+	public:
+		/** Callback triggered when a read completes, receiving the number of bytes read. Zero on failure. */
+		typedef std::function<void(size_t)> ReadCallback;
+
+		/**
+		 * Opens the file at the provided path for reading. If the file cannot be opened isOpen() returns false and all
+		 * reads fail.
+		 *
+		 * @param[in]	filePath	Path of the file to open.
+		 */
+		AsyncFileStream(const Path& filePath);
+
+		/** Waits for any pending reads to complete and closes the file. */
+		~AsyncFileStream();
+
+		/**
+		 * Queues a read of @p size bytes starting at @p offset into @p buffer. The buffer must remain valid until the
+		 * callback is triggered.
+		 *
+		 * @param[in]	offset		Offset in bytes from the start of the file to start reading at.
+		 * @param[in]	size		Number of bytes to read.
+		 * @param[in]	buffer		Buffer to read the data into, at least @p size bytes large.
+		 * @param[in]	callback	Callback to trigger when the read completes. Triggered from an internal I/O thread
+		 *							(or the calling thread if the read completes synchronously), and therefore should
+		 *							return quickly and not block.
+		 */
+		void readAsync(size_t offset, size_t size, void* buffer, const ReadCallback& callback);
+
+		/** Blocks until all queued reads complete. */
+		void wait();
+
+		/** Returns the number of reads queued but not yet completed. */
+		UINT32 getNumPendingReads() const;
+
+		/** Checks was the file successfully opened. */
+		bool isOpen() const { return mHandle != (UINT64)-1; }
+
+		/** Returns the size of the file in bytes. */
+		size_t size() const { return mSize; }
+
+		/** Returns the path of the file read by the stream. */
+		const Path& getPath() const { return mPath; }
+
+	private:
+		/** Called by the platform backend when a queued read completes. */
+		void notifyReadCompleted(const ReadCallback& callback, size_t bytesRead);
+
+		Path mPath;
+		size_t mSize = 0;
+		UINT64 mHandle = (UINT64)-1;
+
+		UINT32 mNumPendingReads = 0;
+		mutable Mutex mMutex;
+		Signal mSignal;
+	};
+
 	/** @} */
 }
 
@@ -22,6 +22,15 @@ namespace bs
 		 */
 		static SPtr<DataStream> openFile(const Path& fullPath, bool readOnly = true);
 
+		/**
+		 * Opens a file for reading by mapping it into memory. Returned stream can be read from directly without copying
+		 * the data through an intermediate buffer (see MappedFileDataStream). Falls back to a normal read-only file stream
+		 * if the file cannot be mapped.
+		 *
+		 * @param[in]	fullPath	Full path to a file.
+		 */
+		static SPtr<DataStream> openFileMapped(const Path& fullPath);
+
 		/**
 		 * Opens a file and returns a data stream capable of reading and writing to that file. If file doesn't exist new
 		 * one will be created.
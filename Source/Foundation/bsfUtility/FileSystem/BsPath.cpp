@@ -7,6 +7,24 @@
 
 namespace bs
 {
+	/** Converts an ASCII character to lowercase. Other characters are returned as is. */
+	static char toLowerASCII(char value)
+	{
+		return (value >= 'A' && value <= 'Z') ? (char)(value - 'A' + 'a') : value;
+	}
+
+	/** Checks if the string contains only ASCII characters. */
+	static bool isASCII(const String& value)
+	{
+		for (auto& entry : value)
+		{
+			if ((entry & 0x80) != 0)
+				return false;
+		}
+
+		return true;
+	}
+
 	const Path Path::BLANK = Path();
 
 	Path::Path(const String& pathStr, PathType type)
@@ -16,7 +34,7 @@ namespace bs
 
 	Path::Path(const char* pathStr, PathType type)
 	{
-		assign(pathStr);
+		assign(pathStr, type);
 	}
 
 	Path::Path(const Path& other)
@@ -24,12 +42,28 @@ namespace bs
 		assign(other);
 	}
 
+	Path::Path(Path&& other)
+	{
+		swap(other);
+	}
+
 	Path& Path::operator= (const Path& path)
 	{
 		assign(path);
 		return *this;
 	}
 
+	Path& Path::operator= (Path&& path)
+	{
+		if (this != &path)
+		{
+			clear();
+			swap(path);
+		}
+
+		return *this;
+	}
+
 	Path& Path::operator= (const String& pathStr)
 	{
 		assign(pathStr);
@@ -49,6 +83,7 @@ namespace bs
 		std::swap(mDevice, path.mDevice);
 		std::swap(mNode, path.mNode);
 		std::swap(mIsAbsolute, path.mIsAbsolute);
+		std::swap(mHash, path.mHash);
 	}
 
 	void Path::assign(const Path& path)
@@ -58,6 +93,7 @@ namespace bs
 		mDevice = path.mDevice;
 		mNode = path.mNode;
 		mIsAbsolute = path.mIsAbsolute;
+		mHash = path.mHash;
 	}
 
 	void Path::assign(const String& pathStr, PathType type)
@@ -147,12 +183,15 @@ namespace bs
 	{
 		Path copy = *this;
 		copy.mFilename.clear();
+		copy.mHash = 0;
 
 		return copy;
 	}
 
 	Path& Path::makeParent()
 	{
+		mHash = 0;
+
 		if (mFilename.empty())
 		{
 			if (mDirectories.empty())
@@ -199,6 +238,7 @@ namespace bs
 		if (!base.includes(*this))
 			return *this;
 
+		mHash = 0;
 		mDirectories.erase(mDirectories.begin(), mDirectories.begin() + base.mDirectories.size());
 
 		// Sometimes a directory name can be interpreted as a file and we're okay with that. Check for that
@@ -263,6 +303,10 @@ namespace bs
 		if (mIsAbsolute != other.mIsAbsolute)
 			return false;
 
+		// Equal paths always have equal hashes, so if both are already known this avoids comparing the elements
+		if (mHash != 0 && other.mHash != 0 && mHash != other.mHash)
+			return false;
+
 		if (mIsAbsolute)
 		{
 			if (!comparePathElem(mDevice, other.mDevice))
@@ -328,6 +372,8 @@ namespace bs
 
 	Path& Path::append(const Path& path)
 	{
+		mHash = 0;
+
 		if (!mFilename.empty())
 			pushDirectory(mFilename);
 
@@ -342,15 +388,13 @@ namespace bs
 	void Path::setBasename(const String& basename)
 	{
 		mFilename = basename + getExtension();
+		mHash = 0;
 	}
 
 	void Path::setExtension(const String& extension)
 	{
-		StringStream stream;
-		stream << getFilename(false);
-		stream << extension;
-
-		mFilename = stream.str();
+		mFilename = getFilename(false) + extension;
+		mHash = 0;
 	}
 
 	String Path::getFilename(bool extension) const
@@ -404,6 +448,32 @@ namespace bs
 		mFilename.clear();
 		mNode.clear();
 		mIsAbsolute = false;
+		mHash = 0;
+	}
+
+	size_t Path::getHash() const
+	{
+		if (mHash != 0)
+			return mHash;
+
+		// Must be consistent with equals(): device is only compared for absolute paths, and a filename is equivalent
+		// to a directory with the same name
+		size_t hash = 0;
+		bs::hash_combine(hash, mIsAbsolute);
+
+		if (mIsAbsolute)
+			hashPathElem(hash, mDevice);
+
+		hashPathElem(hash, mNode);
+
+		for (auto& dir : mDirectories)
+			hashPathElem(hash, dir);
+
+		if (!mFilename.empty())
+			hashPathElem(hash, mFilename);
+
+		mHash = hash;
+		return hash;
 	}
 
 	void Path::throwInvalidPathException(const String& path) const
@@ -413,63 +483,77 @@ namespace bs
 
 	String Path::buildWindows() const
 	{
-		StringStream result;
+		String result;
+		result.reserve(getMaxStringLength());
+
 		if (!mNode.empty())
 		{
-			result << "\\\\";
-			result << mNode;
-			result << "\\";
+			result += "\\\\";
+			result += mNode;
+			result += "\\";
 		}
 		else if (!mDevice.empty())
 		{
-			result << mDevice;
-			result << ":\\";
+			result += mDevice;
+			result += ":\\";
 		}
 		else if (mIsAbsolute)
 		{
-			result << "\\";
+			result += "\\";
 		}
 
 		for (auto& dir : mDirectories)
 		{
-			result << dir;
-			result << "\\";
+			result += dir;
+			result += "\\";
 		}
 
-		result << mFilename;
-		return result.str();
+		result += mFilename;
+		return result;
 	}
 
 	String Path::buildUnix() const
 	{
-		StringStream result;
+		String result;
+		result.reserve(getMaxStringLength());
+
 		auto dirIter = mDirectories.begin();
 
 		if (!mDevice.empty())
 		{
-			result << "/";
-			result << mDevice;
-			result << ":/";
+			result += "/";
+			result += mDevice;
+			result += ":/";
 		}
 		else if (mIsAbsolute)
 		{
 			if (dirIter != mDirectories.end() && *dirIter == "~")
 			{
-				result << "~";
+				result += "~";
 				dirIter++;
 			}
 
-			result << "/";
+			result += "/";
 		}
 
 		for (; dirIter != mDirectories.end(); ++dirIter)
 		{
-			result << *dirIter;
-			result << "/";
+			result += *dirIter;
+			result += "/";
 		}
 
-		result << mFilename;
-		return result.str();
+		result += mFilename;
+		return result;
+	}
+
+	UINT32 Path::getMaxStringLength() const
+	{
+		// Node, device and root add at most three separators
+		size_t length = mNode.size() + mDevice.size() + mFilename.size() + 3;
+		for (auto& dir : mDirectories)
+			length += dir.size() + 1;
+
+		return (UINT32)length;
 	}
 
 	Path Path::operator+ (const Path& rhs) const
@@ -484,11 +568,52 @@ namespace bs
 
 	bool Path::comparePathElem(const String& left, const String& right)
 	{
-		// Note: Might be more efficient to perform toLower character by character, and return as soon as comparison
-		// fails. Instead of this way where we're allocating two temporary strings with dynamic memory. Although that
-		// approach is problematic as well because UTF8 case conversion requires external library calls which might not
-		// support single character conversion, so it might end up being less efficient.
-		return UTF8::toLower(left) == UTF8::toLower(right);
+		// Compare ASCII characters directly, and only fall back to full UTF8 case conversion (which allocates two
+		// temporary strings) when non-ASCII characters differ
+		const size_t length = std::min(left.size(), right.size());
+		for (size_t i = 0; i < length; i++)
+		{
+			const char leftChar = left[i];
+			const char rightChar = right[i];
+
+			if (leftChar == rightChar)
+				continue;
+
+			if ((leftChar & 0x80) != 0 || (rightChar & 0x80) != 0)
+				return UTF8::toLower(left) == UTF8::toLower(right);
+
+			if (toLowerASCII(leftChar) != toLowerASCII(rightChar))
+				return false;
+		}
+
+		if (left.size() == right.size())
+			return true;
+
+		// Case conversion can change the length of non-ASCII characters
+		if (!isASCII(left) || !isASCII(right))
+			return UTF8::toLower(left) == UTF8::toLower(right);
+
+		return false;
+	}
+
+	void Path::hashPathElem(size_t& hash, const String& elem)
+	{
+		// Hash the lowercase version of the element, so elements considered equal by comparePathElem() hash the same
+		if (isASCII(elem))
+		{
+			for (auto& entry : elem)
+				bs::hash_combine(hash, toLowerASCII(entry));
+
+			bs::hash_combine(hash, elem.size());
+		}
+		else
+		{
+			const String lower = UTF8::toLower(elem);
+			for (auto& entry : lower)
+				bs::hash_combine(hash, entry);
+
+			bs::hash_combine(hash, lower.size());
+		}
 	}
 
 	Path Path::combine(const Path& left, const Path& right)
@@ -510,6 +635,8 @@ namespace bs
 
 	void Path::pushDirectory(const String& dir)
 	{
+		mHash = 0;
+
 		if (!dir.empty() && dir != ".")
 		{
 			if (dir == "..")
@@ -55,6 +55,7 @@ namespace bs
 		 */
 		Path(const char* pathStr, PathType type = PathType::Default);
 		Path(const Path& other);
+		Path(Path&& other);
 
 		/**
 		 * Assigns a path by parsing the provided path string. Path will be parsed according to the rules of the platform
@@ -69,6 +70,7 @@ namespace bs
 		Path& operator= (const char* pathStr);
 
 		Path& operator= (const Path& path);
+		Path& operator= (Path&& path);
 
 		/**
 		 * Compares two paths and returns true if they match. Comparison is case insensitive and paths will be compared
@@ -202,7 +204,7 @@ namespace bs
 		bool equals(const Path& other) const;
 
 		/** Change or set the filename in the path. */
-		void setFilename(const String& filename) { mFilename = filename; }
+		void setFilename(const String& filename) { mFilename = filename; mHash = 0; }
 
 		/**
 		 * Change or set the base name in the path. Base name changes the filename by changing its base to the provided
@@ -251,6 +253,13 @@ namespace bs
 		/** Returns true if no path has been set. */
 		bool isEmpty() const { return mDirectories.empty() && mFilename.empty() && mDevice.empty() && mNode.empty(); }
 
+		/**
+		 * Returns a hash of the path. Paths that are equal according to equals() have the same hash. The hash is
+		 * calculated on first use and cached until the path is modified, so repeated hash lookups and comparisons of
+		 * the same path are cheap.
+		 */
+		size_t getHash() const;
+
 		/** Concatenates two paths. */
 		Path operator+ (const Path& rhs) const;
 
@@ -286,7 +295,6 @@ namespace bs
 			clear();
 
 			UINT32 idx = 0;
-			BasicStringStream<T> tempStream;
 
 			if (idx < numChars)
 			{
@@ -304,12 +312,11 @@ namespace bs
 				{
 					idx++;
 
-					tempStream.str(BasicString<T>());
-					tempStream.clear();
+					const UINT32 start = idx;
 					while (idx < numChars && pathStr[idx] != '\\' && pathStr[idx] != '/')
-						tempStream << pathStr[idx++];
+						idx++;
 
-					setNode(tempStream.str());
+					setNode(BasicString<T>(pathStr + start, idx - start));
 
 					if (idx < numChars)
 						idx++;
@@ -340,18 +347,15 @@ namespace bs
 
 				while (idx < numChars)
 				{
-					tempStream.str(BasicString<T>());
-					tempStream.clear();
+					const UINT32 start = idx;
 					while (idx < numChars && pathStr[idx] != '\\' && pathStr[idx] != '/')
-					{
-						tempStream << pathStr[idx];
 						idx++;
-					}
 
+					BasicString<T> element(pathStr + start, idx - start);
 					if (idx < numChars)
-						pushDirectory(tempStream.str());
+						pushDirectory(element);
 					else
-						setFilename(tempStream.str());
+						setFilename(element);
 
 					idx++;
 				}
@@ -365,7 +369,6 @@ namespace bs
 			clear();
 
 			UINT32 idx = 0;
-			BasicStringStream<T> tempStream;
 
 			if (idx < numChars)
 			{
@@ -388,37 +391,27 @@ namespace bs
 
 				while (idx < numChars)
 				{
-					tempStream.str(BasicString<T>());
-					tempStream.clear();
+					const UINT32 start = idx;
 					while (idx < numChars && pathStr[idx] != '/')
-					{
-						tempStream << pathStr[idx];
 						idx++;
-					}
 
+					BasicString<T> element(pathStr + start, idx - start);
 					if (idx < numChars)
 					{
-						if (mDirectories.empty())
+						if (mDirectories.empty() && !element.empty() && *(element.rbegin()) == ':')
 						{
-							BasicString<T> deviceStr = tempStream.str();
-							if (!deviceStr.empty() && *(deviceStr.rbegin()) == ':')
-							{
-								setDevice(deviceStr.substr(0, deviceStr.length() - 1));
-								mIsAbsolute = true;
-							}
-							else
-							{
-								pushDirectory(deviceStr);
-							}
+							element.pop_back();
+							setDevice(element);
+							mIsAbsolute = true;
 						}
 						else
 						{
-							pushDirectory(tempStream.str());
+							pushDirectory(element);
 						}
 					}
 					else
 					{
-						setFilename(tempStream.str());
+						setFilename(element);
 					}
 
 					idx++;
@@ -426,8 +419,8 @@ namespace bs
 			}
 		}
 
-		void setNode(const String& node) { mNode = node; }
-		void setDevice(const String& device) { mDevice = device; }
+		void setNode(const String& node) { mNode = node; mHash = 0; }
+		void setDevice(const String& device) { mDevice = device; mHash = 0; }
 
 		/** Build a Windows path string from internal path data. */
 		String buildWindows() const;
@@ -435,20 +428,26 @@ namespace bs
 		/** Build a Unix path string from internal path data. */
 		String buildUnix() const;
 
+		/** Returns the maximum length of a string built from the internal path data, for any path type. */
+		UINT32 getMaxStringLength() const;
+
 		/** Add new directory to the end of the path. */
 		void pushDirectory(const String& dir);
 
 		/** Helper method that throws invalid path exception. */
 		void throwInvalidPathException(const String& path) const;
+
+		/** Combines a hash of a path element with @p hash, in a way consistent with comparePathElem(). */
+		static void hashPathElem(size_t& hash, const String& elem);
 	private:
 		friend struct RTTIPlainType<Path>; // For serialization
-		friend struct ::std::hash<bs::Path>;
 
 		Vector<String> mDirectories;
 		String mDevice;
 		String mFilename;
 		String mNode;
 		bool mIsAbsolute = false;
+		mutable size_t mHash = 0; // Cached result of getHash(), 0 if not calculated
 	};
 
 	/** @cond SPECIALIZATIONS */
@@ -486,6 +485,7 @@ namespace bs
 			memory = rttiReadElem(data.mFilename, memory);
 			memory = rttiReadElem(data.mIsAbsolute, memory);
 			rttiReadElem(data.mDirectories, memory);
+			data.mHash = 0;
 
 			return size;
 		}
@@ -520,15 +520,7 @@ namespace std
 	{
 		size_t operator()(const bs::Path& path) const
 		{
-			size_t hash = 0;
-			bs::hash_combine(hash, path.mFilename);
-			bs::hash_combine(hash, path.mDevice);
-			bs::hash_combine(hash, path.mNode);
-
-			for (auto& dir : path.mDirectories)
-				bs::hash_combine(hash, dir);
-
-			return hash;
+			return path.getHash();
 		}
 	};
 }
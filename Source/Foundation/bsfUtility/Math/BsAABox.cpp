@@ -5,6 +5,7 @@
 #include "Math/BsPlane.h"
 #include "Math/BsSphere.h"
 #include "Math/BsMath.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
@@ -108,50 +109,14 @@ namespace bs
 
 	void AABox::transform(const Matrix4& matrix)
 	{
-		// Getting the old values so that we can use the existing merge method.
-		Vector3 oldMin = mMinimum;
-		Vector3 oldMax = mMaximum;
-
-		Vector3 currentCorner;
-		// We sequentially compute the corners in the following order :
-		// 0, 6, 5, 1, 2, 4, 7, 3
-		// This sequence allows us to only change one member at a time to get at all corners.
-
-		// For each one, we transform it using the matrix
-		// Which gives the resulting point and merge the resulting point.
-
-		// First corner
-		// min min min
-		currentCorner = oldMin;
-		merge(matrix.multiplyAffine(currentCorner));
-
-		// min,min,max
-		currentCorner.z = oldMax.z;
-		merge(matrix.multiplyAffine(currentCorner));
-
-		// min max max
-		currentCorner.y = oldMax.y;
-		merge(matrix.multiplyAffine(currentCorner));
-
-		// min max min
-		currentCorner.z = oldMin.z;
-		merge(matrix.multiplyAffine(currentCorner));
-
-		// max max min
-		currentCorner.x = oldMax.x;
-		merge(matrix.multiplyAffine(currentCorner));
-
-		// max max max
-		currentCorner.z = oldMax.z;
-		merge(matrix.multiplyAffine(currentCorner));
-
-		// max min max
-		currentCorner.y = oldMin.y;
-		merge(matrix.multiplyAffine(currentCorner));
-
-		// max min min
-		currentCorner.z = oldMin.z;
-		merge(matrix.multiplyAffine(currentCorner));
+		Vector3 corners[8];
+		for(UINT32 i = 0; i < 8; i++)
+			corners[i] = getCorner((Corner)i);
+
+		simd::transformAffinePoints(matrix, corners, corners, 8);
+
+		for(UINT32 i = 0; i < 8; i++)
+			merge(corners[i]);
 	}
 
 	void AABox::transformAffine(const Matrix4& m)
@@ -0,0 +1,291 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Math/BsBoundsArray.h"
+#include "Math/BsRay.h"
+#include "Math/BsMath.h"
+#include "Math/BsSIMD.h"
+
+namespace bs
+{
+	static_assert(BoundsArray::SIMD_WIDTH == 4, "Intersection kernels expect four bounds per SIMD operation.");
+	static_assert(BoundsArray::BITS_PER_WORD % BoundsArray::SIMD_WIDTH == 0,
+		"Bounds processed together must fit in a single mask word.");
+
+	BoundsArray::~BoundsArray()
+	{
+		if(mData != nullptr)
+			bs_free_aligned16(mData);
+	}
+
+	void BoundsArray::add(const Bounds& bounds)
+	{
+		reserveOne();
+		set(mCount++, bounds);
+	}
+
+	void BoundsArray::add(const Sphere& bounds)
+	{
+		reserveOne();
+		set(mCount++, bounds);
+	}
+
+	void BoundsArray::set(UINT32 idx, const Bounds& bounds)
+	{
+		set(idx, bounds.getSphere());
+
+		const AABox& box = bounds.getBox();
+		Vector3 center = box.getCenter();
+		Vector3 extents = box.getHalfSize();
+
+		getComponent(BoxCenterX)[idx] = center.x;
+		getComponent(BoxCenterY)[idx] = center.y;
+		getComponent(BoxCenterZ)[idx] = center.z;
+		getComponent(BoxExtentX)[idx] = Math::abs(extents.x);
+		getComponent(BoxExtentY)[idx] = Math::abs(extents.y);
+		getComponent(BoxExtentZ)[idx] = Math::abs(extents.z);
+	}
+
+	void BoundsArray::set(UINT32 idx, const Sphere& bounds)
+	{
+		const Vector3& center = bounds.getCenter();
+
+		getComponent(SphereCenterX)[idx] = center.x;
+		getComponent(SphereCenterY)[idx] = center.y;
+		getComponent(SphereCenterZ)[idx] = center.z;
+		getComponent(SphereRadius)[idx] = bounds.getRadius();
+	}
+
+	void BoundsArray::swap(UINT32 a, UINT32 b)
+	{
+		for(UINT32 i = 0; i < ComponentCount; i++)
+		{
+			float* data = getComponent((Component)i);
+			std::swap(data[a], data[b]);
+		}
+	}
+
+	void BoundsArray::removeLast()
+	{
+		assert(mCount > 0);
+		mCount--;
+	}
+
+	void BoundsArray::reserveOne()
+	{
+		if(mCount < mCapacity)
+			return;
+
+		UINT32 newCapacity = std::max(mCapacity * 2, SIMD_WIDTH * 16);
+		float* newData = (float*)bs_alloc_aligned16(newCapacity * ComponentCount * sizeof(float));
+
+		// Padding entries are tested along with the valid ones, so make sure they never contain garbage
+		memset(newData, 0, newCapacity * ComponentCount * sizeof(float));
+
+		if(mData != nullptr)
+		{
+			for(UINT32 i = 0; i < ComponentCount; i++)
+				memcpy(newData + i * newCapacity, mData + i * mCapacity, mCount * sizeof(float));
+
+			bs_free_aligned16(mData);
+		}
+
+		mData = newData;
+		mCapacity = newCapacity;
+	}
+
+	void BoundsArray::findIntersecting(const ConvexVolume& volume, bool testBoxes, UINT32* output, UINT32 begin,
+		UINT32 end) const
+	{
+		assert(begin % BITS_PER_WORD == 0);
+
+		const float* sphereX = getComponent(SphereCenterX);
+		const float* sphereY = getComponent(SphereCenterY);
+		const float* sphereZ = getComponent(SphereCenterZ);
+		const float* sphereRadius = getComponent(SphereRadius);
+
+		const float* boxX = getComponent(BoxCenterX);
+		const float* boxY = getComponent(BoxCenterY);
+		const float* boxZ = getComponent(BoxCenterZ);
+		const float* extentX = getComponent(BoxExtentX);
+		const float* extentY = getComponent(BoxExtentY);
+		const float* extentZ = getComponent(BoxExtentZ);
+
+		const Vector<Plane>& planes = volume.getPlanes();
+		const UINT32 numBounds = std::min(mCount, end);
+		const UINT32 numPlanes = (UINT32)planes.size();
+		const simd::uint32x4 laneBits = simd::make_uint(1, 2, 4, 8);
+
+		for(UINT32 i = begin; i < numBounds; i += SIMD_WIDTH)
+		{
+			simd::float32x4 centerX = simd::load<simd::float32x4>(sphereX + i);
+			simd::float32x4 centerY = simd::load<simd::float32x4>(sphereY + i);
+			simd::float32x4 centerZ = simd::load<simd::float32x4>(sphereZ + i);
+			simd::float32x4 negRadius = simd::neg(simd::load<simd::float32x4>(sphereRadius + i));
+
+			// Sphere is outside the volume if it is fully behind any of the planes
+			simd::uint32x4 outside = simd::make_zero();
+			for(UINT32 j = 0; j < numPlanes; j++)
+			{
+				const Plane& plane = planes[j];
+
+				simd::float32x4 dist = simd::sub(simd::add(simd::add(
+					simd::mul(centerX, simd::splat<simd::float32x4>(plane.normal.x)),
+					simd::mul(centerY, simd::splat<simd::float32x4>(plane.normal.y))),
+					simd::mul(centerZ, simd::splat<simd::float32x4>(plane.normal.z))),
+					simd::splat<simd::float32x4>(plane.d));
+
+				outside = simd::bit_or(outside, simd::bit_cast<simd::uint32x4>(simd::cmp_lt(dist, negRadius)));
+			}
+
+			UINT32 bits = simd::reduce_or(simd::bit_andnot(laneBits, outside));
+			if(bits == 0)
+				continue;
+
+			// More precise with the box
+			if(testBoxes)
+			{
+				centerX = simd::load<simd::float32x4>(boxX + i);
+				centerY = simd::load<simd::float32x4>(boxY + i);
+				centerZ = simd::load<simd::float32x4>(boxZ + i);
+
+				simd::float32x4 boxExtentX = simd::load<simd::float32x4>(extentX + i);
+				simd::float32x4 boxExtentY = simd::load<simd::float32x4>(extentY + i);
+				simd::float32x4 boxExtentZ = simd::load<simd::float32x4>(extentZ + i);
+
+				for(UINT32 j = 0; j < numPlanes; j++)
+				{
+					const Plane& plane = planes[j];
+
+					simd::float32x4 dist = simd::sub(simd::add(simd::add(
+						simd::mul(centerX, simd::splat<simd::float32x4>(plane.normal.x)),
+						simd::mul(centerY, simd::splat<simd::float32x4>(plane.normal.y))),
+						simd::mul(centerZ, simd::splat<simd::float32x4>(plane.normal.z))),
+						simd::splat<simd::float32x4>(plane.d));
+
+					simd::float32x4 effectiveRadius = simd::add(simd::add(
+						simd::mul(boxExtentX, simd::splat<simd::float32x4>(Math::abs(plane.normal.x))),
+						simd::mul(boxExtentY, simd::splat<simd::float32x4>(Math::abs(plane.normal.y)))),
+						simd::mul(boxExtentZ, simd::splat<simd::float32x4>(Math::abs(plane.normal.z))));
+
+					simd::float32x4 negEffectiveRadius = simd::neg(effectiveRadius);
+					outside = simd::bit_or(outside, 
+						simd::bit_cast<simd::uint32x4>(simd::cmp_lt(dist, negEffectiveRadius)));
+				}
+
+				bits = simd::reduce_or(simd::bit_andnot(laneBits, outside));
+			}
+
+			writeMask(bits, i, numBounds, output);
+		}
+	}
+
+	void BoundsArray::findIntersecting(const AABox& box, UINT32* output, UINT32 begin, UINT32 end) const
+	{
+		assert(begin % BITS_PER_WORD == 0);
+
+		const float* boxX = getComponent(BoxCenterX);
+		const float* boxY = getComponent(BoxCenterY);
+		const float* boxZ = getComponent(BoxCenterZ);
+		const float* extentX = getComponent(BoxExtentX);
+		const float* extentY = getComponent(BoxExtentY);
+		const float* extentZ = getComponent(BoxExtentZ);
+
+		const Vector3 center = box.getCenter();
+		const Vector3 extents = box.getHalfSize();
+
+		const simd::float32x4 otherX = simd::splat<simd::float32x4>(center.x);
+		const simd::float32x4 otherY = simd::splat<simd::float32x4>(center.y);
+		const simd::float32x4 otherZ = simd::splat<simd::float32x4>(center.z);
+		const simd::float32x4 otherExtentX = simd::splat<simd::float32x4>(Math::abs(extents.x));
+		const simd::float32x4 otherExtentY = simd::splat<simd::float32x4>(Math::abs(extents.y));
+		const simd::float32x4 otherExtentZ = simd::splat<simd::float32x4>(Math::abs(extents.z));
+
+		const UINT32 numBounds = std::min(mCount, end);
+		const simd::uint32x4 laneBits = simd::make_uint(1, 2, 4, 8);
+
+		for(UINT32 i = begin; i < numBounds; i += SIMD_WIDTH)
+		{
+			// Boxes are disjoint if on any axis the distance between their centers exceeds the sum of their extents
+			simd::float32x4 diffX = simd::abs(simd::sub(simd::load<simd::float32x4>(boxX + i), otherX));
+			simd::float32x4 diffY = simd::abs(simd::sub(simd::load<simd::float32x4>(boxY + i), otherY));
+			simd::float32x4 diffZ = simd::abs(simd::sub(simd::load<simd::float32x4>(boxZ + i), otherZ));
+
+			simd::float32x4 sumX = simd::add(simd::load<simd::float32x4>(extentX + i), otherExtentX);
+			simd::float32x4 sumY = simd::add(simd::load<simd::float32x4>(extentY + i), otherExtentY);
+			simd::float32x4 sumZ = simd::add(simd::load<simd::float32x4>(extentZ + i), otherExtentZ);
+
+			simd::uint32x4 outside = simd::bit_cast<simd::uint32x4>(simd::cmp_gt(diffX, sumX));
+			outside = simd::bit_or(outside, simd::bit_cast<simd::uint32x4>(simd::cmp_gt(diffY, sumY)));
+			outside = simd::bit_or(outside, simd::bit_cast<simd::uint32x4>(simd::cmp_gt(diffZ, sumZ)));
+
+			UINT32 bits = simd::reduce_or(simd::bit_andnot(laneBits, outside));
+			writeMask(bits, i, numBounds, output);
+		}
+	}
+
+	void BoundsArray::findIntersecting(const Ray& ray, UINT32* output, UINT32 begin, UINT32 end) const
+	{
+		assert(begin % BITS_PER_WORD == 0);
+
+		const float* boxX = getComponent(BoxCenterX);
+		const float* boxY = getComponent(BoxCenterY);
+		const float* boxZ = getComponent(BoxCenterZ);
+		const float* extentX = getComponent(BoxExtentX);
+		const float* extentY = getComponent(BoxExtentY);
+		const float* extentZ = getComponent(BoxExtentZ);
+
+		const Vector3& origin = ray.getOrigin();
+		const Vector3& direction = ray.getDirection();
+
+		// Use a very large value instead of infinity for axes the ray is parallel to, so that the slab distances of
+		// origins on the slab boundary don't evaluate to NaN
+		auto inverse = [](float value)
+		{
+			static constexpr float LARGE_VALUE = 1e30f;
+
+			if(value == 0.0f)
+				return LARGE_VALUE;
+
+			return Math::clamp(1.0f / value, -LARGE_VALUE, LARGE_VALUE);
+		};
+
+		const simd::float32x4 originX = simd::splat<simd::float32x4>(origin.x);
+		const simd::float32x4 originY = simd::splat<simd::float32x4>(origin.y);
+		const simd::float32x4 originZ = simd::splat<simd::float32x4>(origin.z);
+		const simd::float32x4 invDirX = simd::splat<simd::float32x4>(inverse(direction.x));
+		const simd::float32x4 invDirY = simd::splat<simd::float32x4>(inverse(direction.y));
+		const simd::float32x4 invDirZ = simd::splat<simd::float32x4>(inverse(direction.z));
+
+		const UINT32 numBounds = std::min(mCount, end);
+		const simd::uint32x4 laneBits = simd::make_uint(1, 2, 4, 8);
+
+		for(UINT32 i = begin; i < numBounds; i += SIMD_WIDTH)
+		{
+			simd::float32x4 nearT = simd::make_zero();
+			simd::float32x4 farT = simd::splat<simd::float32x4>(std::numeric_limits<float>::max());
+
+			// Slab test, the ray hits the box if the intervals in which it is within each slab overlap
+			auto clipSlab = [&nearT, &farT](const float* centers, const float* extents, UINT32 idx,
+				const simd::float32x4& rayOrigin, const simd::float32x4& rayInvDir)
+			{
+				simd::float32x4 center = simd::load<simd::float32x4>(centers + idx);
+				simd::float32x4 extent = simd::load<simd::float32x4>(extents + idx);
+
+				simd::float32x4 t0 = simd::mul(simd::sub(simd::sub(center, extent), rayOrigin), rayInvDir);
+				simd::float32x4 t1 = simd::mul(simd::sub(simd::add(center, extent), rayOrigin), rayInvDir);
+
+				nearT = simd::max(nearT, simd::min(t0, t1));
+				farT = simd::min(farT, simd::max(t0, t1));
+			};
+
+			clipSlab(boxX, extentX, i, originX, invDirX);
+			clipSlab(boxY, extentY, i, originY, invDirY);
+			clipSlab(boxZ, extentZ, i, originZ, invDirZ);
+
+			simd::uint32x4 outside = simd::bit_cast<simd::uint32x4>(simd::cmp_gt(nearT, farT));
+
+			UINT32 bits = simd::reduce_or(simd::bit_andnot(laneBits, outside));
+			writeMask(bits, i, numBounds, output);
+		}
+	}
+}
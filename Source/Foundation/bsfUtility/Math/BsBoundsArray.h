@@ -0,0 +1,141 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Math/BsBounds.h"
+#include "Math/BsConvexVolume.h"
+
+namespace bs
+{
+	/** @addtogroup Math
+	 *  @{
+	 */
+
+	/**
+	 * Bounds of a set of objects, stored as a structure of arrays so that many objects can be tested at once using SIMD
+	 * operations. Each object has a bounding sphere, and optionally a bounding box used for more precise tests. Each
+	 * component is stored in its own 16-byte aligned array, padded to a multiple of SIMD_WIDTH elements.
+	 *
+	 * Intersection queries write their results into a bitmask with one bit per object. Object with index i maps to bit
+	 * (i % 32) of word (i / 32), and the queries only ever set bits, leaving bits of non-intersecting objects as is.
+	 */
+	class BS_UTILITY_EXPORT BoundsArray
+	{
+	public:
+		/** Number of objects processed by a single SIMD operation. */
+		static constexpr UINT32 SIMD_WIDTH = 4;
+
+		/** Number of objects whose intersection results are stored in a single word of the output mask. */
+		static constexpr UINT32 BITS_PER_WORD = 32;
+
+		/** Components of the bounds, each stored in a separate array. */
+		enum Component
+		{
+			SphereCenterX, SphereCenterY, SphereCenterZ, SphereRadius,
+			BoxCenterX, BoxCenterY, BoxCenterZ, BoxExtentX, BoxExtentY, BoxExtentZ,
+			ComponentCount
+		};
+
+		BoundsArray() = default;
+		~BoundsArray();
+
+		BoundsArray(const BoundsArray&) = delete;
+		BoundsArray& operator=(const BoundsArray&) = delete;
+
+		/** Appends a new object with both a bounding sphere and a bounding box. */
+		void add(const Bounds& bounds);
+
+		/** Appends a new object with only a bounding sphere. */
+		void add(const Sphere& bounds);
+
+		/** Updates bounds of the object at the specified index. */
+		void set(UINT32 idx, const Bounds& bounds);
+
+		/** Updates bounds of the object at the specified index. Only the bounding sphere is updated. */
+		void set(UINT32 idx, const Sphere& bounds);
+
+		/** Swaps bounds of the two objects at the specified indices. */
+		void swap(UINT32 a, UINT32 b);
+
+		/** Removes the last object in the array. */
+		void removeLast();
+
+		/** Returns the number of objects in the array. */
+		UINT32 size() const { return mCount; }
+
+		/** Returns the number of words required for a mask holding the results of a query on all objects. */
+		UINT32 getMaskWordCount() const { return (mCount + BITS_PER_WORD - 1) / BITS_PER_WORD; }
+
+		/** 
+		 * Returns the array storing the specified component. Array has at least size() elements, rounded up to
+		 * SIMD_WIDTH.
+		 */
+		const float* getComponent(Component component) const { return mData + component * mCapacity; }
+
+		/**
+		 * Tests all the bounds against the provided volume, SIMD_WIDTH bounds at a time, and sets the mask bits for
+		 * all bounds that intersect it.
+		 *
+		 * @param[in]	volume		Volume to test the bounds against.
+		 * @param[in]	testBoxes	If true, bounding boxes are tested for any bounding spheres that intersect the
+		 *							volume. Otherwise only bounding spheres are tested.
+		 * @param[out]	output		Mask to write the results to, at least getMaskWordCount() words large.
+		 * @param[in]	begin		Index of the first object to test. Must be a multiple of BITS_PER_WORD so that
+		 *							different ranges never write to the same mask word, allowing them to be tested in
+		 *							parallel.
+		 * @param[in]	end			One past the index of the last object to test. Clamped to the number of objects.
+		 */
+		void findIntersecting(const ConvexVolume& volume, bool testBoxes, UINT32* output, UINT32 begin = 0,
+			UINT32 end = (UINT32)-1) const;
+
+		/**
+		 * Tests all the bounding boxes against the provided box and sets the mask bits for all boxes that overlap it.
+		 * Only objects added with a bounding box are expected to be tested.
+		 *
+		 * @param[in]	box			Box to test the bounds against.
+		 * @param[out]	output		Mask to write the results to, at least getMaskWordCount() words large.
+		 * @param[in]	begin		Index of the first object to test. Must be a multiple of BITS_PER_WORD.
+		 * @param[in]	end			One past the index of the last object to test. Clamped to the number of objects.
+		 */
+		void findIntersecting(const AABox& box, UINT32* output, UINT32 begin = 0, UINT32 end = (UINT32)-1) const;
+
+		/**
+		 * Tests all the bounding boxes against the provided ray and sets the mask bits for all boxes the ray hits. Only
+		 * intersections in front of the ray origin are considered, same as Ray::intersects(const AABox&). Only objects
+		 * added with a bounding box are expected to be tested.
+		 *
+		 * @param[in]	ray			Ray to test the bounds against.
+		 * @param[out]	output		Mask to write the results to, at least getMaskWordCount() words large.
+		 * @param[in]	begin		Index of the first object to test. Must be a multiple of BITS_PER_WORD.
+		 * @param[in]	end			One past the index of the last object to test. Clamped to the number of objects.
+		 */
+		void findIntersecting(const Ray& ray, UINT32* output, UINT32 begin = 0, UINT32 end = (UINT32)-1) const;
+
+	private:
+		/** Returns the array storing the specified component. */
+		float* getComponent(Component component) { return mData + component * mCapacity; }
+
+		/** Makes sure there is enough room for one more object, growing the arrays if needed. */
+		void reserveOne();
+
+		/**
+		 * Writes @p bits, the results of testing SIMD_WIDTH objects starting at @p idx, into the output mask. Results
+		 * for padding entries at or past @p count are discarded.
+		 */
+		static void writeMask(UINT32 bits, UINT32 idx, UINT32 count, UINT32* output)
+		{
+			const UINT32 numValid = count - idx;
+			if(numValid < SIMD_WIDTH)
+				bits &= (1U << numValid) - 1;
+
+			output[idx / BITS_PER_WORD] |= bits << (idx % BITS_PER_WORD);
+		}
+
+		float* mData = nullptr;
+		UINT32 mCount = 0;
+		UINT32 mCapacity = 0;
+	};
+
+	/** @} */
+}
@@ -6,8 +6,18 @@
 #include "Math/BsVector4.h"
 #include "Math/BsAABox.h"
 #include "Math/BsSphere.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsQuaternion.h"
 
+// Instruction set is selected at build time, from the flags the compiler was invoked with. Architectures not listed
+// here fall back to simdpp's scalar emulation of the vector operations.
+#if defined(__AVX2__)
+#define SIMDPP_ARCH_X86_AVX2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SIMDPP_ARCH_ARM_NEON_FLT_SP
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
 #define SIMDPP_ARCH_X86_SSE4_1
+#endif
 
 #if BS_COMPILER == BS_COMPILER_MSVC
 #pragma warning(disable: 4244)
@@ -83,6 +93,387 @@ namespace bs
 			}
 		};
 
+		/** 
+		 * Multiplies two 4x4 matrices using vector instructions, equivalent to @p lhs * @p rhs. @p output is allowed to
+		 * reference either of the inputs.
+		 */
+		inline void multiplyMatrix(const Matrix4& lhs, const Matrix4& rhs, Matrix4& output)
+		{
+			float32x4 rhsRows[4];
+			for(UINT32 i = 0; i < 4; i++)
+				rhsRows[i] = load_u<float32x4>(&rhs[i]);
+
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				float32x4 row = load_u<float32x4>(&lhs[i]);
+
+				float32x4 result = mul(splat<0>(row), rhsRows[0]);
+				result = add(result, mul(splat<1>(row), rhsRows[1]));
+				result = add(result, mul(splat<2>(row), rhsRows[2]));
+				result = add(result, mul(splat<3>(row), rhsRows[3]));
+
+				store_u(&output[i], result);
+			}
+		}
+
+		/** 
+		 * Multiplies two affine 4x4 matrices using vector instructions, equivalent to @p lhs * @p rhs. @p output is
+		 * allowed to reference either of the inputs.
+		 */
+		inline void multiplyAffine(const Matrix4& lhs, const Matrix4& rhs, Matrix4& output)
+		{
+			const float32x4 lastRow = make_float(0.0f, 0.0f, 0.0f, 1.0f);
+
+			float32x4 rhsRows[3];
+			for(UINT32 i = 0; i < 3; i++)
+				rhsRows[i] = load_u<float32x4>(&rhs[i]);
+
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				float32x4 row = load_u<float32x4>(&lhs[i]);
+
+				// Last row of the rhs matrix is (0, 0, 0, 1), so it only contributes the lhs translation
+				float32x4 result = mul(splat<0>(row), rhsRows[0]);
+				result = add(result, mul(splat<1>(row), rhsRows[1]));
+				result = add(result, mul(splat<2>(row), rhsRows[2]));
+				result = add(result, mul(splat<3>(row), lastRow));
+
+				store_u(&output[i], result);
+			}
+
+			store_u(&output[3], lastRow);
+		}
+
+		/** 
+		 * Multiplies @p count pairs of affine matrices, equivalent to calling multiplyAffine() for each element of the
+		 * arrays. @p output is allowed to reference either of the input arrays.
+		 */
+		inline void multiplyAffineArray(const Matrix4* lhs, const Matrix4* rhs, Matrix4* output, UINT32 count)
+		{
+			for(UINT32 i = 0; i < count; i++)
+				multiplyAffine(lhs[i], rhs[i], output[i]);
+		}
+
+		/** 
+		 * Calculates the inverse of a 4x4 matrix using vector instructions. Equivalent to Matrix4::inverse(). @p output
+		 * is allowed to reference the input.
+		 */
+		inline void invertMatrix(const Matrix4& input, Matrix4& output)
+		{
+			float32x4 r0 = load_u<float32x4>(&input[0]);
+			float32x4 r1 = load_u<float32x4>(&input[1]);
+			float32x4 r2 = load_u<float32x4>(&input[2]);
+			float32x4 r3 = load_u<float32x4>(&input[3]);
+
+			// Split the matrix into four 2x2 sub-matrices (each stored as a vector in row-major order):
+			// | A B |
+			// | C D |
+			float32x4 a = shuffle2<0, 1, 0, 1>(r0, r1);
+			float32x4 b = shuffle2<2, 3, 2, 3>(r0, r1);
+			float32x4 c = shuffle2<0, 1, 0, 1>(r2, r3);
+			float32x4 d = shuffle2<2, 3, 2, 3>(r2, r3);
+
+			// Determinants of A, B, C and D
+			float32x4 detSub = sub(
+				mul(shuffle2<0, 2, 0, 2>(r0, r2), shuffle2<1, 3, 1, 3>(r1, r3)),
+				mul(shuffle2<1, 3, 1, 3>(r0, r2), shuffle2<0, 2, 0, 2>(r1, r3)));
+
+			float32x4 detA = splat<0>(detSub);
+			float32x4 detB = splat<1>(detSub);
+			float32x4 detC = splat<2>(detSub);
+			float32x4 detD = splat<3>(detSub);
+
+			// 2x2 matrix products, where adj() is the adjugate of a 2x2 matrix
+			// X * Y
+			auto mat2Mul = [](const float32x4& x, const float32x4& y) -> float32x4
+			{
+				return add(mul(x, permute4<0, 3, 0, 3>(y)), mul(permute4<1, 0, 3, 2>(x), permute4<2, 1, 2, 1>(y)));
+			};
+
+			// adj(X) * Y
+			auto mat2AdjMul = [](const float32x4& x, const float32x4& y) -> float32x4
+			{
+				return sub(mul(permute4<3, 3, 0, 0>(x), y), mul(permute4<1, 1, 2, 2>(x), permute4<2, 3, 0, 1>(y)));
+			};
+
+			// X * adj(Y)
+			auto mat2MulAdj = [](const float32x4& x, const float32x4& y) -> float32x4
+			{
+				return sub(mul(x, permute4<3, 0, 3, 0>(y)), mul(permute4<1, 0, 3, 2>(x), permute4<2, 1, 2, 1>(y)));
+			};
+
+			float32x4 dc = mat2AdjMul(d, c);
+			float32x4 ab = mat2AdjMul(a, b);
+
+			// Blocks of the adjugate matrix, still requiring a sign flip and a transpose
+			float32x4 x = sub(mul(detD, a), mat2Mul(b, dc));
+			float32x4 w = sub(mul(detA, d), mat2Mul(c, ab));
+			float32x4 y = sub(mul(detB, c), mat2MulAdj(d, ab));
+			float32x4 z = sub(mul(detC, b), mat2MulAdj(a, dc));
+
+			// det(M) = det(A) * det(D) + det(B) * det(C) - trace(adj(A) * B * adj(D) * C)
+			float trace = reduce_add(mul(ab, permute4<0, 2, 1, 3>(dc)));
+			float det = extract<0>(detSub) * extract<3>(detSub) + extract<1>(detSub) * extract<2>(detSub) - trace;
+
+			const float32x4 sign = make_float(1.0f, -1.0f, -1.0f, 1.0f);
+			float32x4 invDet = mul(sign, float32x4(make_float(1.0f / det)));
+			x = mul(x, invDet);
+			y = mul(y, invDet);
+			z = mul(z, invDet);
+			w = mul(w, invDet);
+
+			store_u(&output[0], shuffle2<3, 1, 3, 1>(x, y));
+			store_u(&output[1], shuffle2<2, 0, 2, 0>(x, y));
+			store_u(&output[2], shuffle2<3, 1, 3, 1>(z, w));
+			store_u(&output[3], shuffle2<2, 0, 2, 0>(z, w));
+		}
+
+		/** 
+		 * Calculates the inverse of an affine 4x4 matrix using vector instructions. Equivalent to 
+		 * Matrix4::inverseAffine(). @p output is allowed to reference the input.
+		 */
+		inline void invertAffine(const Matrix4& input, Matrix4& output)
+		{
+			float32x4 r0 = load_u<float32x4>(&input[0]);
+			float32x4 r1 = load_u<float32x4>(&input[1]);
+			float32x4 r2 = load_u<float32x4>(&input[2]);
+			const float32x4 lastRow = make_float(0.0f, 0.0f, 0.0f, 1.0f);
+
+			// Columns of the inverse 3x3 matrix are cross products of its rows. The W component of each cross product
+			// ends up as zero.
+			auto cross = [](const float32x4& u, const float32x4& v) -> float32x4
+			{
+				return sub(
+					mul(permute4<1, 2, 0, 3>(u), permute4<2, 0, 1, 3>(v)),
+					mul(permute4<2, 0, 1, 3>(u), permute4<1, 2, 0, 3>(v)));
+			};
+
+			float32x4 c0 = cross(r1, r2);
+			float32x4 c1 = cross(r2, r0);
+			float32x4 c2 = cross(r0, r1);
+
+			float32x4 det = mul(r0, c0);
+			float32x4 invDet = make_float(1.0f / (extract<0>(det) + extract<1>(det) + extract<2>(det)));
+
+			c0 = mul(c0, invDet);
+			c1 = mul(c1, invDet);
+			c2 = mul(c2, invDet);
+
+			// Translation of the inverse is the negated original translation, multiplied by the inverse 3x3 matrix
+			float32x4 t = mul(c0, permute4<3, 3, 3, 3>(r0));
+			t = add(t, mul(c1, permute4<3, 3, 3, 3>(r1)));
+			t = add(t, mul(c2, permute4<3, 3, 3, 3>(r2)));
+			t = neg(t);
+
+			transpose4(c0, c1, c2, t);
+
+			store_u(&output[0], c0);
+			store_u(&output[1], c1);
+			store_u(&output[2], c2);
+			store_u(&output[3], lastRow);
+		}
+
+		/** 
+		 * Multiplies two quaternions using vector instructions, equivalent to @p lhs * @p rhs. @p output is allowed to
+		 * reference either of the inputs.
+		 */
+		inline void multiplyQuaternion(const Quaternion& lhs, const Quaternion& rhs, Quaternion& output)
+		{
+			const float32x4 sign = make_float(1.0f, 1.0f, 1.0f, -1.0f);
+
+			// Components are stored in (x, y, z, w) order
+			float32x4 l = load_u<float32x4>(&lhs.x);
+			float32x4 r = load_u<float32x4>(&rhs.x);
+
+			float32x4 result = mul(splat<3>(l), r);
+			result = add(result, mul(mul(permute4<0, 1, 2, 0>(l), sign), permute4<3, 3, 3, 0>(r)));
+			result = add(result, mul(mul(permute4<1, 2, 0, 1>(l), sign), permute4<2, 0, 1, 1>(r)));
+			result = sub(result, mul(permute4<2, 0, 1, 2>(l), permute4<1, 2, 0, 2>(r)));
+
+			store_u(&output.x, result);
+		}
+
+		/** 
+		 * Transforms an array of points by an affine matrix, four at a time. Equivalent to calling 
+		 * Matrix4::multiplyAffine() for each point. @p output is allowed to reference @p input.
+		 */
+		inline void transformAffinePoints(const Matrix4& matrix, const Vector3* input, Vector3* output, UINT32 count)
+		{
+			float32x4 m[3][4];
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				for(UINT32 j = 0; j < 4; j++)
+					m[i][j] = make_float(matrix[i][j]);
+			}
+
+			UINT32 numGroups = count / 4;
+			for(UINT32 i = 0; i < numGroups; i++)
+			{
+				// Four points packed as (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+				const float* src = &input[i * 4].x;
+				float32x4 v0 = load_u<float32x4>(src);
+				float32x4 v1 = load_u<float32x4>(src + 4);
+				float32x4 v2 = load_u<float32x4>(src + 8);
+
+				// De-interleave so each vector holds a single component of all four points
+				float32x4 t0 = shuffle2<1, 1, 0, 0>(v0, v1);
+				float32x4 t1 = shuffle2<3, 3, 2, 2>(v1, v2);
+				float32x4 t2 = shuffle2<2, 2, 1, 1>(v0, v1);
+
+				float32x4 x = shuffle2<0, 3, 0, 2>(v0, shuffle2<2, 2, 1, 1>(v1, v2));
+				float32x4 y = shuffle2<0, 2, 0, 2>(t0, t1);
+				float32x4 z = shuffle2<0, 2, 0, 3>(t2, v2);
+
+				float32x4 out[3];
+				for(UINT32 j = 0; j < 3; j++)
+				{
+					out[j] = add(mul(m[j][0], x), mul(m[j][1], y));
+					out[j] = add(out[j], add(mul(m[j][2], z), m[j][3]));
+				}
+
+				// Interleave back into the packed layout
+				x = out[0];
+				y = out[1];
+				z = out[2];
+
+				float* dst = &output[i * 4].x;
+				store_u(dst, shuffle2<0, 2, 0, 2>(shuffle2<0, 0, 0, 0>(x, y), shuffle2<0, 0, 1, 1>(z, x)));
+				store_u(dst + 4, shuffle2<0, 2, 0, 2>(shuffle2<1, 1, 1, 1>(y, z), shuffle2<2, 2, 2, 2>(x, y)));
+				store_u(dst + 8, shuffle2<0, 2, 0, 2>(shuffle2<2, 2, 3, 3>(z, x), shuffle2<3, 3, 3, 3>(y, z)));
+			}
+
+			for(UINT32 i = numGroups * 4; i < count; i++)
+				output[i] = matrix.multiplyAffine(input[i]);
+		}
+
+		/**
+		 * Translation, rotation and scale of a set of objects, stored as a structure of arrays. Each component of the
+		 * transforms is stored in its own 16-byte aligned array, allowing four transforms to be processed with a single
+		 * set of vector instructions. Does not own the memory it references.
+		 */
+		struct TransformArrays
+		{
+			/** Number of component arrays. */
+			static constexpr UINT32 NUM_ARRAYS = 10;
+
+			/** 
+			 * Initializes the arrays using the provided memory. 
+			 *
+			 * @param[in]	memory	Memory to store the arrays in, at least getMemorySize() bytes large. Doesn't need to
+			 *						be aligned.
+			 * @param[in]	count	Number of transforms to store.
+			 */
+			TransformArrays(UINT8* memory, UINT32 count)
+				:count(count)
+			{
+				UINT32 paddedCount = getPaddedCount(count);
+				float* data = (float*)(((uintptr_t)memory + 15) & ~(uintptr_t)15);
+
+				for(UINT32 i = 0; i < NUM_ARRAYS; i++)
+					arrays[i] = data + i * paddedCount;
+
+				// Keep padding entries valid, so they can be processed along with the rest
+				for(UINT32 i = count; i < paddedCount; i++)
+					set(i, Vector3::ZERO, Quaternion::IDENTITY, Vector3::ONE);
+			}
+
+			/** Assigns a transform at the specified index. */
+			void set(UINT32 idx, const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+			{
+				arrays[0][idx] = position.x;
+				arrays[1][idx] = position.y;
+				arrays[2][idx] = position.z;
+				arrays[3][idx] = rotation.x;
+				arrays[4][idx] = rotation.y;
+				arrays[5][idx] = rotation.z;
+				arrays[6][idx] = rotation.w;
+				arrays[7][idx] = scale.x;
+				arrays[8][idx] = scale.y;
+				arrays[9][idx] = scale.z;
+			}
+
+			/** 
+			 * Converts all the transforms into matrices, four at a time. Each output matrix is equal to the one returned
+			 * by Matrix4::TRS() for the same transform. Rotations are expected to be normalized.
+			 *
+			 * @param[out]	output	Array of count matrices to receive the results.
+			 * @param[in]	skip	Optional array of count entries. Entries set to true will have their output matrices
+			 *						left unchanged.
+			 */
+			void toMatrices(Matrix4* output, const bool* skip = nullptr) const
+			{
+				const float32x4 one = make_float(1.0f);
+				const float32x4 lastRow = make_float(0.0f, 0.0f, 0.0f, 1.0f);
+
+				for(UINT32 i = 0; i < count; i += 4)
+				{
+					float32x4 px = load<float32x4>(arrays[0] + i);
+					float32x4 py = load<float32x4>(arrays[1] + i);
+					float32x4 pz = load<float32x4>(arrays[2] + i);
+					float32x4 qx = load<float32x4>(arrays[3] + i);
+					float32x4 qy = load<float32x4>(arrays[4] + i);
+					float32x4 qz = load<float32x4>(arrays[5] + i);
+					float32x4 qw = load<float32x4>(arrays[6] + i);
+					float32x4 sx = load<float32x4>(arrays[7] + i);
+					float32x4 sy = load<float32x4>(arrays[8] + i);
+					float32x4 sz = load<float32x4>(arrays[9] + i);
+
+					// Same as Quaternion::toRotationMatrix()
+					float32x4 tx = add(qx, qx);
+					float32x4 ty = add(qy, qy);
+					float32x4 tz = add(qz, qz);
+					float32x4 twx = mul(tx, qw);
+					float32x4 twy = mul(ty, qw);
+					float32x4 twz = mul(tz, qw);
+					float32x4 txx = mul(tx, qx);
+					float32x4 txy = mul(ty, qx);
+					float32x4 txz = mul(tz, qx);
+					float32x4 tyy = mul(ty, qy);
+					float32x4 tyz = mul(tz, qy);
+					float32x4 tzz = mul(tz, qz);
+
+					// Each vector holds a single matrix entry of four transforms
+					float32x4 row0[4] = {
+						mul(sx, sub(one, add(tyy, tzz))), mul(sy, sub(txy, twz)), mul(sz, add(txz, twy)), px };
+					float32x4 row1[4] = {
+						mul(sx, add(txy, twz)), mul(sy, sub(one, add(txx, tzz))), mul(sz, sub(tyz, twx)), py };
+					float32x4 row2[4] = {
+						mul(sx, sub(txz, twy)), mul(sy, add(tyz, twx)), mul(sz, sub(one, add(txx, tyy))), pz };
+
+					// Transpose so each vector holds a matrix row of a single transform
+					transpose4(row0[0], row0[1], row0[2], row0[3]);
+					transpose4(row1[0], row1[1], row1[2], row1[3]);
+					transpose4(row2[0], row2[1], row2[2], row2[3]);
+
+					UINT32 numInGroup = std::min(4U, count - i);
+					for(UINT32 j = 0; j < numInGroup; j++)
+					{
+						if(skip != nullptr && skip[i + j])
+							continue;
+
+						Matrix4& matrix = output[i + j];
+						store_u(&matrix[0], row0[j]);
+						store_u(&matrix[1], row1[j]);
+						store_u(&matrix[2], row2[j]);
+						store_u(&matrix[3], lastRow);
+					}
+				}
+			}
+
+			/** Returns the number of bytes required for storing the arrays of @p count transforms. */
+			static UINT32 getMemorySize(UINT32 count)
+			{
+				return getPaddedCount(count) * NUM_ARRAYS * sizeof(float) + 15;
+			}
+
+			float* arrays[NUM_ARRAYS];
+			UINT32 count;
+
+		private:
+			/** Returns the number of entries in each array, rounded up so the arrays can be processed four at a time. */
+			static UINT32 getPaddedCount(UINT32 count) { return (count + 3) & ~3U; }
+		};
+
 		/** @} */
 	}
 }
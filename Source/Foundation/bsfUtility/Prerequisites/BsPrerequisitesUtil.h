@@ -139,6 +139,9 @@
 
 #define BS_PROFILING_ENABLED 1
 
+// Keeps render statistics counters active for FrameTelemetry, even if profiling is disabled
+#define BS_TELEMETRY_ENABLED 1
+
 // Config from the build system
 #include "BsFrameworkConfig.h"
 
@@ -279,5 +282,7 @@
 #include "Utility/BsEvent.h"
 #include "Utility/BsPlatformUtility.h"
 #include "Utility/BsNonCopyable.h"
+#include "Utility/BsSmallVector.h"
+#include "Utility/BsFlatHashMap.h"
 #include "FileSystem/BsPath.h"
 #include "Error/BsCrashHandler.h"
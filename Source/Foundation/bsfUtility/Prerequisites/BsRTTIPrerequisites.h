@@ -46,6 +46,7 @@ namespace bs
 
 		enum { id = 0 /**< Unique id for the serializable type. */ };
 		enum { hasDynamicSize = 0 /**< 0 (Object has static size less than 255 bytes, for example int) or 1 (Dynamic size with no size restriction, for example string) */ };
+		enum { allowMemcpy = 1 /**< 1 if the serialized form of the object is identical to its in-memory representation. Types that don't specify this are assumed to require toMemory()/fromMemory(). */ };
 
 		/** Serializes the provided object into the provided pre-allocated memory buffer. */
 		static void toMemory(const T& data, char* memory)
@@ -155,6 +156,23 @@ namespace bs
 		return memory + elemSize;
 	}
 
+	/**
+	 * Checks can values of the specified type be serialized by directly copying their memory, without going through
+	 * RTTIPlainType<T>::toMemory() and RTTIPlainType<T>::fromMemory(). This is true for plain-old-data types and types
+	 * registered through BS_ALLOW_MEMCPY_SERIALIZATION.
+	 */
+	template<class T, class Enable = void>
+	struct RTTIPlainTypeAllowsMemcpy : std::false_type
+	{ };
+
+	/** @cond SPECIALIZATIONS */
+
+	template<class T>
+	struct RTTIPlainTypeAllowsMemcpy<T, typename std::enable_if<RTTIPlainType<T>::allowMemcpy != 0>::type> : std::true_type
+	{ };
+
+	/** @endcond */
+
 	/**
 	 * Notify the RTTI system that the specified type may be serialized just by using a memcpy.
 	 *
@@ -166,7 +184,7 @@ namespace bs
 	static_assert (std::is_trivially_copyable<type>()==true,			\
 						#type " is not trivially copyable");			\
 	template<> struct RTTIPlainType<type>								\
-	{	enum { id=0 }; enum { hasDynamicSize = 0 };						\
+	{	enum { id=0 }; enum { hasDynamicSize = 0 }; enum { allowMemcpy = 1 };	\
 		static void toMemory(const type& data, char* memory)			\
 		{ memcpy(memory, &data, sizeof(type)); }						\
 		static UINT32 fromMemory(type& data, char* memory)				\
@@ -0,0 +1,427 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/Benchmarks/BsUtilityBenchmarkSuite.h"
+#include "Utility/BsOctree.h"
+#include "Utility/BsCompression.h"
+#include "Allocators/BsPoolAlloc.h"
+#include "FileSystem/BsDataStream.h"
+#include "Serialization/BsBinarySerializer.h"
+#include "Reflection/BsRTTIType.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Math/BsVector3.h"
+#include "Math/BsQuaternion.h"
+#include "Math/BsSIMD.h"
+
+namespace bs
+{
+	/** Number of elements inserted into the octree by the insert benchmark. */
+	static constexpr UINT32 NUM_OCTREE_ELEMENTS = 10000;
+
+	/** Number of queries performed by the octree query benchmark. */
+	static constexpr UINT32 NUM_OCTREE_QUERIES = 1000;
+
+	/** Number of allocations performed by the allocator benchmarks. */
+	static constexpr UINT32 NUM_ALLOCATIONS = 1000;
+
+	/** Number of elements in the arrays of the serialization benchmark object. */
+	static constexpr UINT32 NUM_SERIALIZED_ELEMENTS = 1000;
+
+	/** Size of the data compressed by the compression benchmarks, in bytes. */
+	static constexpr UINT32 COMPRESSION_DATA_SIZE = 1024 * 1024;
+
+	/** Number of matrices operated on by the matrix benchmarks. */
+	static constexpr UINT32 NUM_MATRICES = 1000;
+
+	/** Number of bones in the hierarchy evaluated by the bone hierarchy benchmarks. */
+	static constexpr UINT32 NUM_BONES = 150;
+
+	/** Number of tasks queued by the task scheduler benchmark. */
+	static constexpr UINT32 NUM_TASKS = 256;
+
+	/** Number of indices processed by the parallel for benchmark. */
+	static constexpr UINT32 NUM_PARALLEL_FOR_INDICES = 1024 * 1024;
+
+	/** Returns a random value in range [0, 1]. */
+	static float randomUNorm()
+	{
+		return rand() / (float)RAND_MAX;
+	}
+
+	/** Options for an octree containing indices into BenchmarkOctree::bounds. */
+	struct BenchmarkOctreeOptions
+	{
+		enum { LoosePadding = 16 };
+		enum { MinElementsPerNode = 8 };
+		enum { MaxElementsPerNode = 16 };
+		enum { MaxDepth = 12};
+
+		static simd::AABox getBounds(UINT32 elem, void* context);
+		static void setElementId(UINT32 elem, const OctreeElementId& id, void* context);
+	};
+
+	/** Octree populated with random elements, along with the data of its elements. */
+	struct BenchmarkOctree
+	{
+		typedef Octree<UINT32, BenchmarkOctreeOptions> OctreeType;
+
+		Vector<AABox> bounds;
+		Vector<OctreeElementId> ids;
+		SPtr<OctreeType> octree;
+	};
+
+	simd::AABox BenchmarkOctreeOptions::getBounds(UINT32 elem, void* context)
+	{
+		BenchmarkOctree* data = (BenchmarkOctree*)context;
+		return simd::AABox(data->bounds[elem]);
+	}
+
+	void BenchmarkOctreeOptions::setElementId(UINT32 elem, const OctreeElementId& id, void* context)
+	{
+		BenchmarkOctree* data = (BenchmarkOctree*)context;
+		data->ids[elem] = id;
+	}
+
+	class BenchmarkSerializableRTTI;
+
+	/** Object with a mix of primitive and array fields, used for the serialization benchmarks. */
+	struct BenchmarkSerializable : IReflectable
+	{
+		UINT32 integer = 0;
+		String string;
+		Vector<Vector3> vectors;
+		Vector<String> strings;
+
+		friend class BenchmarkSerializableRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class BenchmarkSerializableRTTI : public RTTIType<BenchmarkSerializable, IReflectable, BenchmarkSerializableRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(integer, 0)
+			BS_RTTI_MEMBER_PLAIN(string, 1)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(vectors, 2)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(strings, 3)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "BenchmarkSerializable";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return 10001;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<BenchmarkSerializable>();
+		}
+	};
+
+	RTTITypeBase* BenchmarkSerializable::getRTTIStatic()
+	{
+		return BenchmarkSerializableRTTI::instance();
+	}
+
+	RTTITypeBase* BenchmarkSerializable::getRTTI() const
+	{
+		return getRTTIStatic();
+	}
+
+	UtilityBenchmarkSuite::UtilityBenchmarkSuite()
+	{
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchOctreeInsert, NUM_OCTREE_ELEMENTS);
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchOctreeQuery, NUM_OCTREE_QUERIES);
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchFrameAlloc, NUM_ALLOCATIONS);
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchPoolAlloc, NUM_ALLOCATIONS);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchBinarySerializerEncode);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchBinarySerializerDecode);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchCompress);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchDecompress);
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchMatrix4Multiply, NUM_MATRICES);
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchMatrix4Inverse, NUM_MATRICES);
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchBoneHierarchyScalar, NUM_BONES);
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchBoneHierarchySIMD, NUM_BONES);
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchTaskSchedulerTasks, NUM_TASKS);
+		BS_ADD_BENCHMARK_OPS(UtilityBenchmarkSuite::benchTaskSchedulerParallelFor, NUM_PARALLEL_FOR_INDICES);
+	}
+
+	void UtilityBenchmarkSuite::startUp()
+	{
+		srand(0);
+
+		// Octree with elements of various sizes spread over the entire octree, and queries about the size of a
+		// typical frustum cell
+		mOctree = bs_shared_ptr_new<BenchmarkOctree>();
+		mOctree->bounds.resize(NUM_OCTREE_ELEMENTS);
+		mOctree->ids.resize(NUM_OCTREE_ELEMENTS);
+		for (UINT32 i = 0; i < NUM_OCTREE_ELEMENTS; i++)
+		{
+			Vector3 position(randomUNorm() * 1500.0f - 750.0f, randomUNorm() * 1500.0f - 750.0f,
+				randomUNorm() * 1500.0f - 750.0f);
+
+			Vector3 extents = Vector3::ONE * (0.1f + randomUNorm() * randomUNorm() * 50.0f);
+			mOctree->bounds[i] = AABox(position - extents, position + extents);
+		}
+
+		mInsertOctree = bs_shared_ptr_new<BenchmarkOctree>();
+		mInsertOctree->bounds = mOctree->bounds;
+		mInsertOctree->ids.resize(NUM_OCTREE_ELEMENTS);
+
+		mOctree->octree = bs_shared_ptr_new<BenchmarkOctree::OctreeType>(Vector3::ZERO, 800.0f, mOctree.get());
+		for (UINT32 i = 0; i < NUM_OCTREE_ELEMENTS; i++)
+			mOctree->octree->addElement(i);
+
+		mOctreeQueries.resize(NUM_OCTREE_QUERIES);
+		for (UINT32 i = 0; i < NUM_OCTREE_QUERIES; i++)
+		{
+			Vector3 position(randomUNorm() * 1500.0f - 750.0f, randomUNorm() * 1500.0f - 750.0f,
+				randomUNorm() * 1500.0f - 750.0f);
+
+			mOctreeQueries[i] = AABox(position - Vector3::ONE * 50.0f, position + Vector3::ONE * 50.0f);
+		}
+
+		// Affine matrices, similar to ones used for scene object transforms
+		mMatrices.resize(NUM_MATRICES);
+		for (UINT32 i = 0; i < NUM_MATRICES; i++)
+		{
+			Quaternion rotation(Degree(randomUNorm() * 360.0f), Degree(randomUNorm() * 360.0f),
+				Degree(randomUNorm() * 360.0f));
+			rotation.normalize();
+
+			mMatrices[i] = Matrix4::TRS(Vector3(randomUNorm(), randomUNorm(), randomUNorm()), rotation,
+				Vector3(0.5f + randomUNorm(), 0.5f + randomUNorm(), 0.5f + randomUNorm()));
+		}
+
+		// Skeleton with bones stored in parent-sorted order, as Skeleton::getPose() expects
+		mBoneParents.resize(NUM_BONES);
+		mBonePositions.resize(NUM_BONES);
+		mBoneRotations.resize(NUM_BONES);
+		mBoneScales.resize(NUM_BONES);
+		mInvBindPoses.resize(NUM_BONES);
+		mBonePose.resize(NUM_BONES);
+		mBoneTransformsData.resize(simd::TransformArrays::getMemorySize(NUM_BONES));
+		for (UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			mBoneParents[i] = i == 0 ? (UINT32)-1 : rand() % i;
+			mBonePositions[i] = Vector3(randomUNorm(), randomUNorm(), randomUNorm());
+			mBoneRotations[i] = Quaternion(Degree(randomUNorm() * 360.0f), Degree(randomUNorm() * 360.0f),
+				Degree(randomUNorm() * 360.0f));
+			mBoneRotations[i].normalize();
+			mBoneScales[i] = Vector3(0.5f + randomUNorm(), 0.5f + randomUNorm(), 0.5f + randomUNorm());
+			mInvBindPoses[i] = Matrix4::TRS(mBonePositions[i], mBoneRotations[i], Vector3::ONE).inverseAffine();
+		}
+
+		mSerializable = bs_shared_ptr_new<BenchmarkSerializable>();
+		mSerializable->integer = 42;
+		mSerializable->string = "BenchmarkSerializable";
+		for (UINT32 i = 0; i < NUM_SERIALIZED_ELEMENTS; i++)
+		{
+			mSerializable->vectors.push_back(Vector3((float)i, (float)i * 2.0f, (float)i * 3.0f));
+			mSerializable->strings.push_back("String" + toString(i));
+		}
+
+		UINT32 bytesWritten = 0;
+		mEncoded.resize(1024 * 1024);
+
+		BinarySerializer serializer;
+		serializer.encode(mSerializable.get(), mEncoded.data(), (UINT32)mEncoded.size(), &bytesWritten,
+			[](UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize) -> UINT8* { return nullptr; });
+		mEncoded.resize(bytesWritten);
+
+		// Partially repetitive data, compressing similar to typical mesh and texture data
+		mUncompressed = bs_shared_ptr_new<MemoryDataStream>(COMPRESSION_DATA_SIZE);
+		UINT8* uncompressedData = mUncompressed->getPtr();
+		for (UINT32 i = 0; i < COMPRESSION_DATA_SIZE; i++)
+			uncompressedData[i] = (UINT8)((i / 7) ^ (i % 13) ^ (rand() % 4));
+
+		SPtr<DataStream> input = mUncompressed;
+		mCompressed = Compression::compress(input);
+	}
+
+	void UtilityBenchmarkSuite::shutDown()
+	{
+		mOctree = nullptr;
+		mInsertOctree = nullptr;
+		mSerializable = nullptr;
+		mUncompressed = nullptr;
+		mCompressed = nullptr;
+	}
+
+	void UtilityBenchmarkSuite::benchOctreeInsert()
+	{
+		// Uses separate element data so the element IDs of the octree used for queries don't get overwritten
+		BenchmarkOctree::OctreeType octree(Vector3::ZERO, 800.0f, mInsertOctree.get());
+		for (UINT32 i = 0; i < NUM_OCTREE_ELEMENTS; i++)
+			octree.addElement(i);
+	}
+
+	void UtilityBenchmarkSuite::benchOctreeQuery()
+	{
+		UINT32 numFound = 0;
+		for (auto& query : mOctreeQueries)
+		{
+			BenchmarkOctree::OctreeType::BoxIntersectIterator iter(*mOctree->octree, query);
+			while (iter.moveNext())
+				numFound++;
+		}
+
+		doNotOptimize(numFound);
+	}
+
+	void UtilityBenchmarkSuite::benchFrameAlloc()
+	{
+		bs_frame_mark();
+		for (UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+		{
+			UINT8* data = bs_frame_alloc(16 + (i % 16) * 16);
+			doNotOptimize(data);
+		}
+		bs_frame_clear();
+	}
+
+	void UtilityBenchmarkSuite::benchPoolAlloc()
+	{
+		static PoolAlloc<64> pool;
+		static void* allocations[NUM_ALLOCATIONS];
+
+		for (UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+			allocations[i] = pool.alloc();
+
+		for (UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+			pool.free(allocations[i]);
+	}
+
+	void UtilityBenchmarkSuite::benchBinarySerializerEncode()
+	{
+		static Vector<UINT8> buffer(1024 * 1024);
+		UINT32 bytesWritten = 0;
+
+		BinarySerializer serializer;
+		serializer.encode(mSerializable.get(), buffer.data(), (UINT32)buffer.size(), &bytesWritten,
+			[](UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize) -> UINT8* { return nullptr; });
+
+		doNotOptimize(bytesWritten);
+	}
+
+	void UtilityBenchmarkSuite::benchBinarySerializerDecode()
+	{
+		SPtr<DataStream> stream = bs_shared_ptr_new<MemoryDataStream>(mEncoded.data(), mEncoded.size(), false);
+
+		BinarySerializer serializer;
+		SPtr<IReflectable> decoded = serializer.decode(stream, (UINT32)mEncoded.size());
+
+		doNotOptimize(decoded);
+	}
+
+	void UtilityBenchmarkSuite::benchCompress()
+	{
+		mUncompressed->seek(0);
+
+		SPtr<DataStream> input = mUncompressed;
+		SPtr<MemoryDataStream> output = Compression::compress(input);
+
+		doNotOptimize(output);
+	}
+
+	void UtilityBenchmarkSuite::benchDecompress()
+	{
+		mCompressed->seek(0);
+
+		SPtr<DataStream> input = mCompressed;
+		SPtr<MemoryDataStream> output = Compression::decompress(input);
+
+		doNotOptimize(output);
+	}
+
+	void UtilityBenchmarkSuite::benchMatrix4Multiply()
+	{
+		Matrix4 result = Matrix4::IDENTITY;
+		for (auto& matrix : mMatrices)
+			result = result * matrix;
+
+		doNotOptimize(result);
+	}
+
+	void UtilityBenchmarkSuite::benchMatrix4Inverse()
+	{
+		Matrix4 result = Matrix4::ZERO;
+		for (auto& matrix : mMatrices)
+			result = result + matrix.inverse();
+
+		doNotOptimize(result);
+	}
+
+	void UtilityBenchmarkSuite::benchBoneHierarchyScalar()
+	{
+		for (UINT32 i = 0; i < NUM_BONES; i++)
+			mBonePose[i] = Matrix4::TRS(mBonePositions[i], mBoneRotations[i], mBoneScales[i]);
+
+		for (UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			if (mBoneParents[i] != (UINT32)-1)
+				mBonePose[i] = mBonePose[mBoneParents[i]] * mBonePose[i];
+		}
+
+		for (UINT32 i = 0; i < NUM_BONES; i++)
+			mBonePose[i] = mBonePose[i] * mInvBindPoses[i];
+
+		doNotOptimize(mBonePose[NUM_BONES - 1]);
+	}
+
+	void UtilityBenchmarkSuite::benchBoneHierarchySIMD()
+	{
+		simd::TransformArrays transforms(mBoneTransformsData.data(), NUM_BONES);
+		for (UINT32 i = 0; i < NUM_BONES; i++)
+			transforms.set(i, mBonePositions[i], mBoneRotations[i], mBoneScales[i]);
+
+		transforms.toMatrices(mBonePose.data());
+
+		for (UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			if (mBoneParents[i] != (UINT32)-1)
+				simd::multiplyMatrix(mBonePose[mBoneParents[i]], mBonePose[i], mBonePose[i]);
+		}
+
+		for (UINT32 i = 0; i < NUM_BONES; i++)
+			simd::multiplyMatrix(mBonePose[i], mInvBindPoses[i], mBonePose[i]);
+
+		doNotOptimize(mBonePose[NUM_BONES - 1]);
+	}
+
+	void UtilityBenchmarkSuite::benchTaskSchedulerTasks()
+	{
+		std::atomic<UINT32> counter{0};
+
+		Vector<SPtr<Task>> tasks(NUM_TASKS);
+		for (UINT32 i = 0; i < NUM_TASKS; i++)
+		{
+			tasks[i] = Task::create("Benchmark", [&counter]() { counter++; });
+			TaskScheduler::instance().addTask(tasks[i]);
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+
+		doNotOptimize(counter);
+	}
+
+	void UtilityBenchmarkSuite::benchTaskSchedulerParallelFor()
+	{
+		static Vector<float> values(NUM_PARALLEL_FOR_INDICES, 1.0f);
+
+		TaskScheduler::instance().parallelFor(0, NUM_PARALLEL_FOR_INDICES, 4096, [](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+				values[i] = values[i] * 0.5f + 0.5f;
+		});
+
+		doNotOptimize(values[0]);
+	}
+}
@@ -0,0 +1,54 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Testing/BsBenchmarkSuite.h"
+#include "Math/BsAABox.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsQuaternion.h"
+
+namespace bs
+{
+	struct BenchmarkOctree;
+	struct BenchmarkSerializable;
+
+	class UtilityBenchmarkSuite : public BenchmarkSuite
+	{
+	public:
+		UtilityBenchmarkSuite();
+		void startUp() override;
+		void shutDown() override;
+
+	private:
+		void benchOctreeInsert();
+		void benchOctreeQuery();
+		void benchFrameAlloc();
+		void benchPoolAlloc();
+		void benchBinarySerializerEncode();
+		void benchBinarySerializerDecode();
+		void benchCompress();
+		void benchDecompress();
+		void benchMatrix4Multiply();
+		void benchMatrix4Inverse();
+		void benchBoneHierarchyScalar();
+		void benchBoneHierarchySIMD();
+		void benchTaskSchedulerTasks();
+		void benchTaskSchedulerParallelFor();
+
+		SPtr<BenchmarkOctree> mOctree;
+		SPtr<BenchmarkOctree> mInsertOctree;
+		Vector<AABox> mOctreeQueries;
+		Vector<Matrix4> mMatrices;
+		Vector<UINT32> mBoneParents;
+		Vector<Vector3> mBonePositions;
+		Vector<Quaternion> mBoneRotations;
+		Vector<Vector3> mBoneScales;
+		Vector<Matrix4> mInvBindPoses;
+		Vector<Matrix4> mBonePose;
+		Vector<UINT8> mBoneTransformsData;
+		SPtr<BenchmarkSerializable> mSerializable;
+		Vector<UINT8> mEncoded;
+		SPtr<MemoryDataStream> mUncompressed;
+		SPtr<MemoryDataStream> mCompressed;
+	};
+}
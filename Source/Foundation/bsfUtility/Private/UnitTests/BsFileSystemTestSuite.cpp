@@ -5,7 +5,9 @@
 #include "Debug/BsDebug.h"
 #include "Error/BsException.h"
 #include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 
+#include <atomic>
 #include <algorithm>
 #include <fstream>
 
@@ -84,6 +86,10 @@ namespace bs
 		BS_ADD_TEST(FileSystemTestSuite::testGetChildren);
 		BS_ADD_TEST(FileSystemTestSuite::testGetLastModifiedTime);
 		BS_ADD_TEST(FileSystemTestSuite::testGetTempDirectoryPath);
+		BS_ADD_TEST(FileSystemTestSuite::testOpenFileMapped);
+		BS_ADD_TEST(FileSystemTestSuite::testOpenFileMapped_empty);
+		BS_ADD_TEST(FileSystemTestSuite::testAsyncFileStream);
+		BS_ADD_TEST(FileSystemTestSuite::testAsyncFileStream_missing);
 	}
 
 	void FileSystemTestSuite::testExists_yes_file()
@@ -299,4 +305,76 @@ namespace bs
 		/* No judging. */
 		BS_TEST_ASSERT(!path.toString().empty());
 	}
+
+	void FileSystemTestSuite::testOpenFileMapped()
+	{
+		Path path = mTestDirectory + "mapped-file";
+		createFile(path, "0123456789");
+
+		SPtr<DataStream> stream = FileSystem::openFileMapped(path);
+		BS_TEST_ASSERT(stream != nullptr);
+		BS_TEST_ASSERT(stream->isMemoryMapped());
+		BS_TEST_ASSERT(stream->size() == 10);
+
+		char buffer[4] = { 0 };
+		stream->seek(3);
+		BS_TEST_ASSERT(stream->read(buffer, 3) == 3);
+		BS_TEST_ASSERT(String(buffer) == "345");
+
+		// Writes to the mapped memory must not reach the file
+		MemoryDataStream* memStream = static_cast<MemoryDataStream*>(stream.get());
+		memStream->getPtr()[0] = 'X';
+		stream->close();
+
+		BS_TEST_ASSERT(readFile(path) == "0123456789");
+	}
+
+	void FileSystemTestSuite::testOpenFileMapped_empty()
+	{
+		Path path = mTestDirectory + "mapped-file-empty";
+		createEmptyFile(path);
+
+		SPtr<DataStream> stream = FileSystem::openFileMapped(path);
+		BS_TEST_ASSERT(stream != nullptr);
+		BS_TEST_ASSERT(!stream->isMemoryMapped());
+		BS_TEST_ASSERT(stream->size() == 0);
+	}
+
+	void FileSystemTestSuite::testAsyncFileStream()
+	{
+		Path path = mTestDirectory + "async-file";
+		createFile(path, "0123456789");
+
+		AsyncFileStream stream(path);
+		BS_TEST_ASSERT(stream.isOpen());
+		BS_TEST_ASSERT(stream.size() == 10);
+
+		char buffers[3][4] = { { 0 } };
+		std::atomic<UINT32> totalRead(0);
+		auto callback = [&totalRead](size_t bytesRead) { totalRead += (UINT32)bytesRead; };
+
+		stream.readAsync(0, 3, buffers[0], callback);
+		stream.readAsync(5, 3, buffers[1], callback);
+
+		// Reads past the end of the file are truncated
+		stream.readAsync(8, 3, buffers[2], callback);
+		stream.wait();
+
+		BS_TEST_ASSERT(stream.getNumPendingReads() == 0);
+		BS_TEST_ASSERT(totalRead == 8);
+		BS_TEST_ASSERT(String(buffers[0]) == "012");
+		BS_TEST_ASSERT(String(buffers[1]) == "567");
+		BS_TEST_ASSERT(String(buffers[2]) == "89");
+	}
+
+	void FileSystemTestSuite::testAsyncFileStream_missing()
+	{
+		AsyncFileStream stream(mTestDirectory + "async-file-missing");
+		BS_TEST_ASSERT(!stream.isOpen());
+
+		char buffer[4];
+		bool called = false;
+		stream.readAsync(0, 4, buffer, [&called](size_t bytesRead) { called = bytesRead == 0; });
+		BS_TEST_ASSERT(called);
+	}
 }
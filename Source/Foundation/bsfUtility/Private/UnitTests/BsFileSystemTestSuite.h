@@ -35,6 +35,10 @@ namespace bs
 		void testGetChildren();
 		void testGetLastModifiedTime();
 		void testGetTempDirectoryPath();
+		void testOpenFileMapped();
+		void testOpenFileMapped_empty();
+		void testAsyncFileStream();
+		void testAsyncFileStream_missing();
 
 		Path mTestDirectory;
 	};
@@ -7,10 +7,13 @@ using namespace bs;
 
 int main()
 {
+	MemStack::beginThread();
+
 	SPtr<TestSuite> tests = UtilityTestSuite::create<UtilityTestSuite>();
 
 	ConsoleTestOutput testOutput;
 	tests->run(testOutput);
 
+	MemStack::endThread();
 	return 0;
 }
\ No newline at end of file
@@ -3,6 +3,22 @@
 #include "Private/UnitTests/BsUtilityTestSuite.h"
 #include "Private/UnitTests/BsFileSystemTestSuite.h"
 #include "Utility/BsOctree.h"
+#include "Utility/BsCompression.h"
+#include "FileSystem/BsDataStream.h"
+#include "Serialization/BsBinarySerializer.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "Serialization/BsSerializedObject.h"
+#include "Serialization/BsBinaryCloner.h"
+#include "Reflection/BsRTTIType.h"
+#include "Math/BsVector3.h"
+#include "Math/BsSIMD.h"
+#include "Math/BsBoundsArray.h"
+#include "Math/BsRay.h"
+#include "String/BsStringID.h"
+#include "Utility/BsUUID.h"
+#include "Utility/BsStaticBVH.h"
+#include "Allocators/BsRangeAlloc.h"
+#include "Debug/BsLog.h"
 
 namespace bs
 {
@@ -38,6 +54,60 @@ namespace bs
 	};
 
 	typedef Octree<UINT32, DebugOctreeOptions> DebugOctree;
+
+	class DebugMemberFieldsRTTI;
+
+	/** Type whose RTTI references member variables directly, used for testing member plain fields. */
+	struct DebugMemberFields : IReflectable
+	{
+		UINT32 integer = 0;
+		String string;
+		Vector<Vector3> vectors;
+		Vector<String> strings;
+
+		friend class DebugMemberFieldsRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class DebugMemberFieldsRTTI : public RTTIType<DebugMemberFields, IReflectable, DebugMemberFieldsRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(integer, 0)
+			BS_RTTI_MEMBER_PLAIN(string, 1)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(vectors, 2)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(strings, 3)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "DebugMemberFields";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return 10000;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<DebugMemberFields>();
+		}
+	};
+
+	RTTITypeBase* DebugMemberFields::getRTTIStatic()
+	{
+		return DebugMemberFieldsRTTI::instance();
+	}
+
+	RTTITypeBase* DebugMemberFields::getRTTI() const
+	{
+		return getRTTIStatic();
+	}
+
 	void UtilityTestSuite::startUp()
 	{
 		SPtr<TestSuite> fileSystemTests = create<FileSystemTestSuite>();
@@ -51,6 +121,19 @@ namespace bs
 	UtilityTestSuite::UtilityTestSuite()
 	{
 		BS_ADD_TEST(UtilityTestSuite::testOctree);
+		BS_ADD_TEST(UtilityTestSuite::testChunkedCompression);
+		BS_ADD_TEST(UtilityTestSuite::testDirectDeserialization);
+		BS_ADD_TEST(UtilityTestSuite::testPlainMemberFields);
+		BS_ADD_TEST(UtilityTestSuite::testSIMDBoneHierarchy);
+		BS_ADD_TEST(UtilityTestSuite::testSIMDMatrixOperations);
+		BS_ADD_TEST(UtilityTestSuite::testBoundsArray);
+		BS_ADD_TEST(UtilityTestSuite::testStringID);
+		BS_ADD_TEST(UtilityTestSuite::testPathHash);
+		BS_ADD_TEST(UtilityTestSuite::testUUID);
+		BS_ADD_TEST(UtilityTestSuite::testStaticBVH);
+		BS_ADD_TEST(UtilityTestSuite::testBinaryCloner);
+		BS_ADD_TEST(UtilityTestSuite::testRangeAlloc);
+		BS_ADD_TEST(UtilityTestSuite::testLog);
 	}
 
 	void UtilityTestSuite::testOctree()
@@ -139,8 +222,694 @@ namespace bs
 			elemIdx++;
 		}
 
+		// Query using a convex volume, and ensure the same elements are found as when testing them manually
+		Vector<Plane> volumePlanes =
+		{
+			Plane(Vector3::UNIT_X, -300.0f), Plane(-Vector3::UNIT_X, -200.0f),
+			Plane(Vector3::UNIT_Y, -250.0f), Plane(-Vector3::UNIT_Y, -250.0f),
+			Plane(Vector3::normalize(Vector3(1.0f, 0.0f, 1.0f)), -100.0f), Plane(-Vector3::UNIT_Z, -400.0f)
+		};
+
+		ConvexVolume queryVolume(volumePlanes);
+		DebugOctree::VolumeIntersectIterator volumeIter(octree, queryVolume);
+
+		Vector<bool> foundElements(octreeData.elements.size(), false);
+		while(volumeIter.moveNext())
+		{
+			UINT32 element = volumeIter.getElement();
+			BS_TEST_ASSERT(!foundElements[element]);
+
+			foundElements[element] = true;
+		}
+
+		for(UINT32 i = 0; i < (UINT32)octreeData.elements.size(); i++)
+			BS_TEST_ASSERT(foundElements[i] == queryVolume.intersects(octreeData.elements[i].box));
+
 		// Ensure nothing goes wrong during element removal
 		for(auto& entry : octreeData.elements)
 			octree.removeElement(entry.octreeId);
 	}
+
+	void UtilityTestSuite::testChunkedCompression()
+	{
+		// Partially repetitive data, spanning a number of chunks with the last one being partial
+		const UINT32 chunkSize = 1024;
+		const UINT32 dataSize = chunkSize * 9 + 123;
+
+		SPtr<MemoryDataStream> source = bs_shared_ptr_new<MemoryDataStream>(dataSize);
+		UINT8* sourceData = source->getPtr();
+		for(UINT32 i = 0; i < dataSize; i++)
+			sourceData[i] = (UINT8)((i / 7) ^ (i % 13));
+
+		SPtr<DataStream> input = source;
+		SPtr<DataStream> compressed = Compression::compressChunked(input, chunkSize);
+		BS_TEST_ASSERT(compressed != nullptr);
+
+		SPtr<MemoryDataStream> decompressed = Compression::decompressChunked(compressed);
+		BS_TEST_ASSERT(decompressed != nullptr);
+		BS_TEST_ASSERT(decompressed->size() == dataSize);
+		BS_TEST_ASSERT(memcmp(decompressed->getPtr(), sourceData, dataSize) == 0);
+
+		// Range crossing a chunk boundary
+		compressed->seek(0);
+
+		const size_t rangeOffset = chunkSize * 3 - 100;
+		const size_t rangeSize = chunkSize + 200;
+		SPtr<MemoryDataStream> range = Compression::decompressChunkedRange(compressed, rangeOffset, rangeSize);
+		BS_TEST_ASSERT(range != nullptr);
+		BS_TEST_ASSERT(range->size() == rangeSize);
+		BS_TEST_ASSERT(memcmp(range->getPtr(), sourceData + rangeOffset, rangeSize) == 0);
+
+		// Range including the partial last chunk
+		compressed->seek(0);
+
+		range = Compression::decompressChunkedRange(compressed, dataSize - 50, 50);
+		BS_TEST_ASSERT(range != nullptr);
+		BS_TEST_ASSERT(memcmp(range->getPtr(), sourceData + dataSize - 50, 50) == 0);
+	}
+
+	void UtilityTestSuite::testDirectDeserialization()
+	{
+		auto createField = [](UINT32 value)
+		{
+			SPtr<SerializedField> field = bs_shared_ptr_new<SerializedField>();
+			field->value = (UINT8*)bs_alloc(sizeof(value));
+			field->size = sizeof(value);
+			field->ownsMemory = true;
+			memcpy(field->value, &value, sizeof(value));
+
+			return field;
+		};
+
+		// Object graph exercising plain, array, reflectable pointer, embedded reflectable and data block fields, as
+		// well as an object referenced from multiple places
+		SPtr<SerializedObject> shared = bs_shared_ptr_new<SerializedObject>();
+		shared->subObjects.resize(1);
+		shared->subObjects[0].typeId = 5;
+		shared->subObjects[0].entries[0].fieldId = 0;
+		shared->subObjects[0].entries[0].serialized = createField(123);
+
+		SPtr<SerializedArray> array = bs_shared_ptr_new<SerializedArray>();
+		array->numElements = 4;
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			array->entries[i].index = i;
+			array->entries[i].serialized = i == 1 ? (SPtr<SerializedInstance>)shared : createField(i * 10);
+		}
+
+		SPtr<SerializedObject> root = bs_shared_ptr_new<SerializedObject>();
+		root->subObjects.resize(2);
+		root->subObjects[0].typeId = 1;
+		root->subObjects[0].entries[0].fieldId = 0;
+		root->subObjects[0].entries[0].serialized = createField(7);
+		root->subObjects[0].entries[1].fieldId = 1;
+		root->subObjects[0].entries[1].serialized = array;
+		root->subObjects[1].typeId = 2;
+		root->subObjects[1].entries[3].fieldId = 3;
+		root->subObjects[1].entries[3].serialized = shared;
+
+		MemorySerializer ms;
+		UINT32 size = 0;
+		UINT8* encoded = ms.encode(root.get(), size);
+		BS_TEST_ASSERT(encoded != nullptr);
+
+		// Decodes directly from memory
+		SPtr<SerializedObject> direct = std::static_pointer_cast<SerializedObject>(ms.decode(encoded, size));
+		BS_TEST_ASSERT(direct != nullptr);
+
+		// Decodes through the intermediate representation
+		BinarySerializer bs;
+		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(encoded, size, false);
+		SPtr<SerializedObject> intermediate = bs._decodeToIntermediate(stream, size);
+		SPtr<SerializedObject> indirect = std::static_pointer_cast<SerializedObject>(
+			bs._decodeFromIntermediate(intermediate));
+		BS_TEST_ASSERT(indirect != nullptr);
+
+		BS_TEST_ASSERT(direct->subObjects.size() == 2);
+		BS_TEST_ASSERT(direct->subObjects[1].typeId == 2);
+
+		SPtr<SerializedArray> directArray = std::static_pointer_cast<SerializedArray>(
+			direct->subObjects[0].entries[1].serialized);
+		BS_TEST_ASSERT(directArray->numElements == 4);
+		BS_TEST_ASSERT(directArray->entries.size() == 3);
+
+		SPtr<SerializedField> directField = std::static_pointer_cast<SerializedField>(
+			directArray->entries[2].serialized);
+		BS_TEST_ASSERT(directField->size == sizeof(UINT32) && *(UINT32*)directField->value == 20);
+
+		// References to the same object must resolve to the same instance
+		BS_TEST_ASSERT(directArray->entries[1].serialized == direct->subObjects[1].entries[3].serialized);
+
+		// Both paths must produce identical objects (compared structurally, as entry maps are unordered)
+		std::function<bool(const SPtr<SerializedInstance>&, const SPtr<SerializedInstance>&)> isEqual =
+			[&isEqual](const SPtr<SerializedInstance>& a, const SPtr<SerializedInstance>& b)
+		{
+			if(a == nullptr || b == nullptr)
+				return a == b;
+
+			if(a->getTypeId() != b->getTypeId())
+				return false;
+
+			UINT32 typeId = a->getTypeId();
+			if(typeId == TID_SerializedObject)
+			{
+				auto objA = std::static_pointer_cast<SerializedObject>(a);
+				auto objB = std::static_pointer_cast<SerializedObject>(b);
+				if(objA->subObjects.size() != objB->subObjects.size())
+					return false;
+
+				for(UINT32 i = 0; i < (UINT32)objA->subObjects.size(); i++)
+				{
+					const SerializedSubObject& subA = objA->subObjects[i];
+					const SerializedSubObject& subB = objB->subObjects[i];
+					if(subA.typeId != subB.typeId || subA.entries.size() != subB.entries.size())
+						return false;
+
+					for(auto& entry : subA.entries)
+					{
+						auto iterFind = subB.entries.find(entry.first);
+						if(iterFind == subB.entries.end() || !isEqual(entry.second.serialized, iterFind->second.serialized))
+							return false;
+					}
+				}
+			}
+			else if(typeId == TID_SerializedArray)
+			{
+				auto arrayA = std::static_pointer_cast<SerializedArray>(a);
+				auto arrayB = std::static_pointer_cast<SerializedArray>(b);
+				if(arrayA->numElements != arrayB->numElements || arrayA->entries.size() != arrayB->entries.size())
+					return false;
+
+				for(auto& entry : arrayA->entries)
+				{
+					auto iterFind = arrayB->entries.find(entry.first);
+					if(iterFind == arrayB->entries.end() || !isEqual(entry.second.serialized, iterFind->second.serialized))
+						return false;
+				}
+			}
+			else if(typeId == TID_SerializedField)
+			{
+				auto fieldA = std::static_pointer_cast<SerializedField>(a);
+				auto fieldB = std::static_pointer_cast<SerializedField>(b);
+				if(fieldA->size != fieldB->size || memcmp(fieldA->value, fieldB->value, fieldA->size) != 0)
+					return false;
+			}
+
+			return true;
+		};
+
+		BS_TEST_ASSERT(isEqual(direct, indirect));
+		BS_TEST_ASSERT(isEqual(direct, root));
+
+		bs_free(encoded);
+	}
+
+	void UtilityTestSuite::testPlainMemberFields()
+	{
+		DebugMemberFields source;
+		source.integer = 42;
+		source.string = "member";
+		for(UINT32 i = 0; i < 100; i++)
+			source.vectors.push_back(Vector3((float)i, (float)i * 2.0f, (float)i * 3.0f));
+
+		source.strings = { "a", "bb", "ccc" };
+
+		MemorySerializer ms;
+		UINT32 size = 0;
+		UINT8* encoded = ms.encode(&source, size);
+		BS_TEST_ASSERT(encoded != nullptr);
+
+		auto checkDecoded = [this, &source](const SPtr<DebugMemberFields>& decoded)
+		{
+			BS_TEST_ASSERT(decoded != nullptr);
+			BS_TEST_ASSERT(decoded->integer == source.integer);
+			BS_TEST_ASSERT(decoded->string == source.string);
+			BS_TEST_ASSERT(decoded->vectors == source.vectors);
+			BS_TEST_ASSERT(decoded->strings == source.strings);
+		};
+
+		// Decodes directly from memory
+		checkDecoded(std::static_pointer_cast<DebugMemberFields>(ms.decode(encoded, size)));
+
+		// Decodes through the intermediate representation
+		BinarySerializer bs;
+		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(encoded, size, false);
+		SPtr<SerializedObject> intermediate = bs._decodeToIntermediate(stream, size);
+		checkDecoded(std::static_pointer_cast<DebugMemberFields>(bs._decodeFromIntermediate(intermediate)));
+
+		bs_free(encoded);
+	}
+
+	void UtilityTestSuite::testSIMDBoneHierarchy()
+	{
+		// Evaluates bone hierarchies the same way Skeleton::getPose() does, using both the scalar and the SIMD path, and
+		// makes sure the results match
+		static constexpr UINT32 BONE_COUNTS[] = { 1, 50, 150 };
+
+		auto randomUNorm = []() { return rand() / (float)RAND_MAX; };
+
+		for(auto numBones : BONE_COUNTS)
+		{
+			Vector<UINT32> parents(numBones);
+			Vector<Vector3> positions(numBones);
+			Vector<Quaternion> rotations(numBones);
+			Vector<Vector3> scales(numBones);
+			Vector<Matrix4> invBindPoses(numBones);
+
+			// Bones are stored in parent-sorted order
+			for(UINT32 i = 0; i < numBones; i++)
+			{
+				parents[i] = i == 0 ? (UINT32)-1 : rand() % i;
+				positions[i] = Vector3(randomUNorm(), randomUNorm(), randomUNorm());
+				rotations[i] = Quaternion(Degree(randomUNorm() * 360.0f), Degree(randomUNorm() * 360.0f), 
+					Degree(randomUNorm() * 360.0f));
+				rotations[i].normalize();
+				scales[i] = Vector3(0.5f + randomUNorm(), 0.5f + randomUNorm(), 0.5f + randomUNorm());
+				invBindPoses[i] = Matrix4::TRS(positions[i], rotations[i], Vector3::ONE).inverseAffine();
+			}
+
+			Vector<Matrix4> scalarPose(numBones);
+			for(UINT32 i = 0; i < numBones; i++)
+				scalarPose[i] = Matrix4::TRS(positions[i], rotations[i], scales[i]);
+
+			for(UINT32 i = 0; i < numBones; i++)
+			{
+				if(parents[i] != (UINT32)-1)
+					scalarPose[i] = scalarPose[parents[i]] * scalarPose[i];
+			}
+
+			for(UINT32 i = 0; i < numBones; i++)
+				scalarPose[i] = scalarPose[i] * invBindPoses[i];
+
+			Vector<Matrix4> simdPose(numBones);
+			Vector<UINT8> transformsData(simd::TransformArrays::getMemorySize(numBones));
+
+			simd::TransformArrays transforms(transformsData.data(), numBones);
+			for(UINT32 i = 0; i < numBones; i++)
+				transforms.set(i, positions[i], rotations[i], scales[i]);
+
+			transforms.toMatrices(simdPose.data());
+
+			for(UINT32 i = 0; i < numBones; i++)
+			{
+				if(parents[i] != (UINT32)-1)
+					simd::multiplyMatrix(simdPose[parents[i]], simdPose[i], simdPose[i]);
+			}
+
+			for(UINT32 i = 0; i < numBones; i++)
+				simd::multiplyMatrix(simdPose[i], invBindPoses[i], simdPose[i]);
+
+			for(UINT32 i = 0; i < numBones; i++)
+			{
+				for(UINT32 j = 0; j < 4; j++)
+				{
+					for(UINT32 k = 0; k < 4; k++)
+						BS_TEST_ASSERT(Math::approxEquals(scalarPose[i][j][k], simdPose[i][j][k], 0.001f));
+				}
+			}
+		}
+	}
+
+	void UtilityTestSuite::testSIMDMatrixOperations()
+	{
+		// Compares the SIMD matrix, quaternion and point operations against their scalar equivalents
+		auto randomSNorm = []() { return rand() / (float)RAND_MAX * 2.0f - 1.0f; };
+		auto matrixEquals = [](const Matrix4& a, const Matrix4& b)
+		{
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				for(UINT32 j = 0; j < 4; j++)
+				{
+					if(!Math::approxEquals(a[i][j], b[i][j], 0.001f))
+						return false;
+				}
+			}
+
+			return true;
+		};
+
+		for(UINT32 i = 0; i < 100; i++)
+		{
+			Quaternion rotation(Degree(randomSNorm() * 180.0f), Degree(randomSNorm() * 180.0f), 
+				Degree(randomSNorm() * 180.0f));
+			Vector3 position(randomSNorm(), randomSNorm(), randomSNorm());
+			Vector3 scale(1.5f + randomSNorm(), 1.5f + randomSNorm(), 1.5f + randomSNorm());
+
+			Matrix4 tfrm = Matrix4::TRS(position, rotation, scale);
+			Matrix4 invTfrm = Matrix4::inverseTRS(position, rotation, scale);
+
+			BS_TEST_ASSERT(matrixEquals(tfrm.inverse(), invTfrm));
+			BS_TEST_ASSERT(matrixEquals(tfrm.inverseAffine(), invTfrm));
+
+			Matrix4 projection = Matrix4::projectionPerspective(Degree(30.0f + randomSNorm() * 20.0f), 1.5f, 0.1f, 
+				100.0f) * tfrm;
+			BS_TEST_ASSERT(matrixEquals(projection * projection.inverse(), Matrix4::IDENTITY));
+
+			Matrix4 product;
+			simd::multiplyAffineArray(&tfrm, &invTfrm, &product, 1);
+			BS_TEST_ASSERT(matrixEquals(product, Matrix4::IDENTITY));
+
+			Quaternion otherRotation(Degree(randomSNorm() * 180.0f), Degree(randomSNorm() * 180.0f), 
+				Degree(randomSNorm() * 180.0f));
+			Quaternion scalarRotation = rotation * otherRotation;
+			Quaternion simdRotation;
+			simd::multiplyQuaternion(rotation, otherRotation, simdRotation);
+
+			for(UINT32 j = 0; j < 4; j++)
+				BS_TEST_ASSERT(Math::approxEquals(scalarRotation[j], simdRotation[j], 0.001f));
+
+			// Not a multiple of four, so the remainder path is exercised as well
+			Vector3 points[7];
+			for(auto& point : points)
+				point = Vector3(randomSNorm(), randomSNorm(), randomSNorm());
+
+			Vector3 transformed[7];
+			simd::transformAffinePoints(tfrm, points, transformed, 7);
+
+			for(UINT32 j = 0; j < 7; j++)
+				BS_TEST_ASSERT(Math::approxEquals(tfrm.multiplyAffine(points[j]), transformed[j], 0.001f));
+		}
+	}
+
+	void UtilityTestSuite::testBoundsArray()
+	{
+		// Compares the batched intersection queries against the intersection tests on individual bounds
+		static constexpr UINT32 NUM_BOUNDS = 103;
+
+		auto randomSNorm = []() { return rand() / (float)RAND_MAX * 2.0f - 1.0f; };
+		auto isSet = [](const Vector<UINT32>& mask, UINT32 idx) { return (mask[idx / 32] & (1U << (idx % 32))) != 0; };
+
+		Vector<Bounds> bounds(NUM_BOUNDS);
+		BoundsArray boundsArray;
+		for(UINT32 i = 0; i < NUM_BOUNDS; i++)
+		{
+			Vector3 center(randomSNorm() * 8.0f, randomSNorm() * 8.0f, randomSNorm() * 8.0f);
+			Vector3 extents(1.0f + randomSNorm() * 0.5f, 1.0f + randomSNorm() * 0.5f, 1.0f + randomSNorm() * 0.5f);
+
+			AABox box(center - extents, center + extents);
+			bounds[i] = Bounds(box, Sphere(center, extents.length()));
+			boundsArray.add(bounds[i]);
+		}
+
+		BS_TEST_ASSERT(boundsArray.size() == NUM_BOUNDS);
+
+		Matrix4 proj = Matrix4::projectionPerspective(Degree(60.0f), 1.0f, 0.1f, 30.0f);
+		ConvexVolume frustum(proj);
+
+		Vector<UINT32> sphereMask(boundsArray.getMaskWordCount(), 0);
+		Vector<UINT32> boxMask(boundsArray.getMaskWordCount(), 0);
+		boundsArray.findIntersecting(frustum, false, sphereMask.data());
+		boundsArray.findIntersecting(frustum, true, boxMask.data());
+
+		AABox queryBox(Vector3(-5.0f, -5.0f, -5.0f), Vector3(5.0f, 5.0f, 5.0f));
+		Vector<UINT32> overlapMask(boundsArray.getMaskWordCount(), 0);
+		boundsArray.findIntersecting(queryBox, overlapMask.data());
+
+		Ray ray(Vector3(-10.0f, 0.5f, 0.0f), Vector3(1.0f, 0.1f, 0.2f));
+		Vector<UINT32> rayMask(boundsArray.getMaskWordCount(), 0);
+		boundsArray.findIntersecting(ray, rayMask.data());
+
+		for(UINT32 i = 0; i < NUM_BOUNDS; i++)
+		{
+			const AABox& box = bounds[i].getBox();
+			const Sphere& sphere = bounds[i].getSphere();
+
+			BS_TEST_ASSERT(isSet(sphereMask, i) == frustum.intersects(sphere));
+			BS_TEST_ASSERT(isSet(boxMask, i) == (frustum.intersects(sphere) && frustum.intersects(box)));
+			BS_TEST_ASSERT(isSet(overlapMask, i) == queryBox.intersects(box));
+			BS_TEST_ASSERT(isSet(rayMask, i) == ray.intersects(box).first);
+		}
+
+		// Bits past the last object must never be set
+		BS_TEST_ASSERT((boxMask.back() >> (NUM_BOUNDS % 32)) == 0);
+
+		// Removing objects keeps the rest of the array intact
+		boundsArray.swap(0, NUM_BOUNDS - 1);
+		boundsArray.removeLast();
+
+		const BoundsArray& constBoundsArray = boundsArray;
+		const float* radii = constBoundsArray.getComponent(BoundsArray::SphereRadius);
+
+		BS_TEST_ASSERT(boundsArray.size() == NUM_BOUNDS - 1);
+		BS_TEST_ASSERT(radii[0] == bounds[NUM_BOUNDS - 1].getSphere().getRadius());
+	}
+
+	void UtilityTestSuite::testStringID()
+	{
+		// Hash of a literal must be evaluated at compile time, and match the hash calculated at runtime
+		static_assert(StringID::hash("") == 0, "");
+		static_assert(StringID::hash("a") == 'a', "");
+
+		StringID runtimeId(String("TestStringID"));
+		StringID literalId = BS_SID("TestStringID");
+		StringID otherId = BS_SID("TestStringID2");
+
+		BS_TEST_ASSERT(literalId == runtimeId);
+		BS_TEST_ASSERT(literalId != otherId);
+		BS_TEST_ASSERT(strcmp(literalId.cstr(), "TestStringID") == 0);
+		BS_TEST_ASSERT(StringID("TestStringID2") == otherId);
+
+		UnorderedMap<StringID, UINT32> lookup;
+		lookup[runtimeId] = 1;
+		lookup[otherId] = 2;
+
+		BS_TEST_ASSERT(lookup[BS_SID("TestStringID")] == 1);
+		BS_TEST_ASSERT(lookup.find(StringID("TestStringID3")) == lookup.end());
+	}
+
+	void UtilityTestSuite::testPathHash()
+	{
+		// Equal paths must hash the same, including paths that only differ in case or in a trailing separator
+		Path windowsPath("C:\\Foo\\Bar\\file.TXT", Path::PathType::Windows);
+		Path windowsPathLower("c:/foo/bar/File.txt", Path::PathType::Windows);
+		BS_TEST_ASSERT(windowsPath == windowsPathLower);
+		BS_TEST_ASSERT(windowsPath.getHash() == windowsPathLower.getHash());
+
+		Path filePath("/a/b/c", Path::PathType::Unix);
+		Path dirPath("/a/b/c/", Path::PathType::Unix);
+		BS_TEST_ASSERT(filePath == dirPath);
+		BS_TEST_ASSERT(filePath.getHash() == dirPath.getHash());
+
+		Path otherPath("/a/b/cd", Path::PathType::Unix);
+		BS_TEST_ASSERT(filePath != otherPath);
+
+		// Cached hash must be updated when the path changes
+		Path modifiedPath = filePath;
+		modifiedPath.setExtension(".txt");
+		BS_TEST_ASSERT(modifiedPath != filePath);
+		BS_TEST_ASSERT(modifiedPath.getHash() == Path("/a/b/c.txt", Path::PathType::Unix).getHash());
+
+		UnorderedMap<Path, UINT32> lookup;
+		for (UINT32 i = 0; i < 100; i++)
+			lookup[Path("/Resources/Dir" + toString(i) + "/Asset.asset", Path::PathType::Unix)] = i;
+
+		auto iterFind = lookup.find(Path("/resources/dir42/asset.ASSET", Path::PathType::Unix));
+		BS_TEST_ASSERT(iterFind != lookup.end() && iterFind->second == 42);
+	}
+
+	void UtilityTestSuite::testUUID()
+	{
+		UUID uuid(0x12345678, 0x9ABCDEF0, 0x0FEDCBA9, 0x87654321);
+		BS_TEST_ASSERT(uuid.toString() == "12345678-9abc-def0-0fed-cba987654321");
+		BS_TEST_ASSERT(UUID("12345678-9ABC-DEF0-0FED-CBA987654321") == uuid);
+
+		UnorderedSet<UUID> generated;
+		for (UINT32 i = 0; i < 1000; i++)
+		{
+			UUID randomUUID = UUIDGenerator::generateRandom();
+			String uuidStr = randomUUID.toString();
+
+			// Version 4, RFC 4122 variant
+			BS_TEST_ASSERT(uuidStr[14] == '4');
+			BS_TEST_ASSERT(uuidStr[19] == '8' || uuidStr[19] == '9' || uuidStr[19] == 'a' || uuidStr[19] == 'b');
+			BS_TEST_ASSERT(UUID(uuidStr) == randomUUID);
+			BS_TEST_ASSERT(generated.insert(randomUUID).second);
+		}
+	}
+
+	void UtilityTestSuite::testStaticBVH()
+	{
+		static constexpr UINT32 NUM_BOUNDS = 1000;
+
+		Vector<AABox> bounds(NUM_BOUNDS);
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+		{
+			Vector3 center((float)(i % 10) * 10.0f, (float)((i / 10) % 10) * 10.0f, (float)(i / 100) * 10.0f);
+			Vector3 extents(1.0f + (i % 3), 1.0f + (i % 5), 1.0f + (i % 7));
+
+			bounds[i] = AABox(center - extents, center + extents);
+		}
+
+		StaticBVH bvh;
+		bvh.build(bounds.data(), NUM_BOUNDS);
+		BS_TEST_ASSERT(bvh.size() == NUM_BOUNDS);
+
+		// Results must match testing every element individually
+		Vector<UINT32> mask(bvh.getMaskWordCount());
+		Vector<UINT32> expectedMask(bvh.getMaskWordCount());
+
+		AABox queryBox(Vector3(15.0f, 15.0f, 15.0f), Vector3(42.0f, 38.0f, 61.0f));
+		bvh.findIntersecting(queryBox, mask.data());
+
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+		{
+			if (bounds[i].intersects(queryBox))
+				expectedMask[i / 32] |= 1U << (i % 32);
+		}
+
+		BS_TEST_ASSERT(mask == expectedMask);
+
+		std::fill(mask.begin(), mask.end(), 0);
+		std::fill(expectedMask.begin(), expectedMask.end(), 0);
+
+		Ray ray(Vector3(-10.0f, 21.0f, 19.0f), Vector3::normalize(Vector3(1.0f, 0.1f, 0.2f)));
+		bvh.findIntersecting(ray, mask.data());
+
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+		{
+			if (ray.intersects(bounds[i]).first)
+				expectedMask[i / 32] |= 1U << (i % 32);
+		}
+
+		BS_TEST_ASSERT(mask == expectedMask);
+	}
+
+	void UtilityTestSuite::testBinaryCloner()
+	{
+		DebugMemberFields source;
+		source.integer = 42;
+		source.string = "member";
+		for(UINT32 i = 0; i < 100; i++)
+			source.vectors.push_back(Vector3((float)i, (float)i * 2.0f, (float)i * 3.0f));
+
+		source.strings = { "a", "bb", "ccc" };
+
+		SPtr<DebugMemberFields> clonedFields = std::static_pointer_cast<DebugMemberFields>(
+			BinaryCloner::clone(&source));
+		BS_TEST_ASSERT(clonedFields != nullptr);
+		BS_TEST_ASSERT(clonedFields->integer == source.integer);
+		BS_TEST_ASSERT(clonedFields->string == source.string);
+		BS_TEST_ASSERT(clonedFields->vectors == source.vectors);
+		BS_TEST_ASSERT(clonedFields->strings == source.strings);
+
+		// Object graph with an object referenced from multiple places
+		auto createField = [](UINT32 value)
+		{
+			SPtr<SerializedField> field = bs_shared_ptr_new<SerializedField>();
+			field->value = (UINT8*)bs_alloc(sizeof(value));
+			field->size = sizeof(value);
+			field->ownsMemory = true;
+			memcpy(field->value, &value, sizeof(value));
+
+			return field;
+		};
+
+		SPtr<SerializedObject> shared = bs_shared_ptr_new<SerializedObject>();
+		shared->subObjects.resize(1);
+		shared->subObjects[0].typeId = 5;
+		shared->subObjects[0].entries[0].fieldId = 0;
+		shared->subObjects[0].entries[0].serialized = createField(123);
+
+		SPtr<SerializedArray> array = bs_shared_ptr_new<SerializedArray>();
+		array->numElements = 2;
+		array->entries[0].index = 0;
+		array->entries[0].serialized = shared;
+		array->entries[1].index = 1;
+		array->entries[1].serialized = createField(10);
+
+		SPtr<SerializedObject> root = bs_shared_ptr_new<SerializedObject>();
+		root->subObjects.resize(2);
+		root->subObjects[0].typeId = 1;
+		root->subObjects[0].entries[0].fieldId = 0;
+		root->subObjects[0].entries[0].serialized = array;
+		root->subObjects[1].typeId = 2;
+		root->subObjects[1].entries[3].fieldId = 3;
+		root->subObjects[1].entries[3].serialized = shared;
+
+		auto getShared = [](const SPtr<SerializedObject>& object)
+		{
+			SPtr<SerializedArray> objectArray = std::static_pointer_cast<SerializedArray>(
+				object->subObjects[0].entries[0].serialized);
+
+			return objectArray->entries[0].serialized;
+		};
+
+		// Deep clones copy referenced objects, but only once per object
+		SPtr<SerializedObject> deep = std::static_pointer_cast<SerializedObject>(BinaryCloner::clone(root.get()));
+		BS_TEST_ASSERT(deep != nullptr && deep != root);
+		BS_TEST_ASSERT(deep->subObjects.size() == 2 && deep->subObjects[1].typeId == 2);
+		BS_TEST_ASSERT(getShared(deep) != shared);
+		BS_TEST_ASSERT(getShared(deep) == deep->subObjects[1].entries[3].serialized);
+
+		SPtr<SerializedObject> deepShared = std::static_pointer_cast<SerializedObject>(getShared(deep));
+		SPtr<SerializedField> deepField = std::static_pointer_cast<SerializedField>(
+			deepShared->subObjects[0].entries[0].serialized);
+		BS_TEST_ASSERT(deepField->size == sizeof(UINT32) && *(UINT32*)deepField->value == 123);
+
+		// Shallow clones keep referencing the original objects
+		SPtr<SerializedObject> shallow = std::static_pointer_cast<SerializedObject>(
+			BinaryCloner::clone(root.get(), true));
+		BS_TEST_ASSERT(shallow != nullptr && shallow != root);
+		BS_TEST_ASSERT(shallow->subObjects[0].entries[0].serialized == array);
+		BS_TEST_ASSERT(shallow->subObjects[1].entries[3].serialized == shared);
+	}
+
+	void UtilityTestSuite::testRangeAlloc()
+	{
+		RangeAlloc alloc;
+		BS_TEST_ASSERT(alloc.alloc(1) == RangeAlloc::INVALID);
+
+		alloc.grow(100);
+		UINT32 a = alloc.alloc(30);
+		UINT32 b = alloc.alloc(30);
+		UINT32 c = alloc.alloc(30);
+		BS_TEST_ASSERT(a != RangeAlloc::INVALID && b != RangeAlloc::INVALID && c != RangeAlloc::INVALID);
+		BS_TEST_ASSERT(alloc.getStart(a) == 0 && alloc.getStart(b) == 30 && alloc.getStart(c) == 60);
+		BS_TEST_ASSERT(alloc.alloc(20) == RangeAlloc::INVALID);
+
+		// Freed neighbors merge into a single range
+		alloc.free(a);
+		alloc.free(b);
+		UINT32 d = alloc.alloc(60);
+		BS_TEST_ASSERT(d != RangeAlloc::INVALID && alloc.getStart(d) == 0);
+
+		// Growing keeps existing ranges in place and extends the trailing free space
+		alloc.grow(200);
+		BS_TEST_ASSERT(alloc.getSize() == 200);
+		BS_TEST_ASSERT(alloc.getStart(c) == 60 && alloc.getStart(d) == 0);
+
+		UINT32 e = alloc.alloc(110);
+		BS_TEST_ASSERT(e != RangeAlloc::INVALID && alloc.getStart(e) == 90);
+	}
+
+	void UtilityTestSuite::testLog()
+	{
+		Log log;
+		log.setMaxEntries(4);
+
+		// Log more messages than the lock-free queue holds, so some go through the locked path
+		for (UINT32 i = 0; i < 2000; i++)
+			log.logMsg(toString(i), i % 2);
+
+		LogEntry entry;
+		Vector<String> messages;
+		while (log.getUnreadEntry(entry))
+			messages.push_back(entry.getMessage());
+
+		// Only the most recent entries are kept, in order
+		BS_TEST_ASSERT(messages.size() == 4);
+		BS_TEST_ASSERT(messages.size() == 4 && messages[0] == "1996" && messages[3] == "1999");
+		BS_TEST_ASSERT(log.getEntries().size() == 4);
+
+		log.logMsg("a", 0);
+		log.logMsg("b", 1);
+		log.clear(1);
+
+		BS_TEST_ASSERT(log.getEntries().size() == 2);
+		BS_TEST_ASSERT(log.getUnreadEntry(entry) && entry.getMessage() == "a");
+		BS_TEST_ASSERT(!log.getUnreadEntry(entry));
+
+		log.clear();
+		BS_TEST_ASSERT(log.getEntries().empty());
+	}
 }
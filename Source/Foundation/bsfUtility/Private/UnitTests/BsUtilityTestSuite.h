@@ -15,5 +15,18 @@ namespace bs
 
 	private:
 		void testOctree();
+		void testChunkedCompression();
+		void testDirectDeserialization();
+		void testPlainMemberFields();
+		void testSIMDBoneHierarchy();
+		void testSIMDMatrixOperations();
+		void testBoundsArray();
+		void testStringID();
+		void testPathHash();
+		void testUUID();
+		void testStaticBVH();
+		void testBinaryCloner();
+		void testRangeAlloc();
+		void testLog();
 	};
 }
@@ -5,9 +5,12 @@
 #include "Error/BsException.h"
 #include "FileSystem/BsDataStream.h"
 #include "Debug/BsDebug.h"
+#include "Threading/BsThreadPool.h"
 
 #include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -18,6 +21,17 @@
 #include <cstdlib>
 #include <fstream>
 
+#if BS_PLATFORM == BS_PLATFORM_LINUX && defined(__has_include)
+#	if __has_include(<linux/io_uring.h>)
+#		include <linux/io_uring.h>
+#		include <sys/syscall.h>
+#		include <sys/uio.h>
+#		if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#			define BS_IO_URING_SUPPORTED 1
+#		endif
+#	endif
+#endif
+
 #define HANDLE_PATH_ERROR(path__, errno__) \
 	LOGERR(String(__FUNCTION__) + ": " + (path__) + ": " + (strerror(errno__)));
 
@@ -145,6 +159,15 @@ namespace bs
 		return bs_shared_ptr_new<FileDataStream>(path, accessMode, true);
 	}
 
+	SPtr<DataStream> FileSystem::openFileMapped(const Path& path)
+	{
+		SPtr<MappedFileDataStream> stream = bs_shared_ptr_new<MappedFileDataStream>(path);
+		if (stream->getPtr() == nullptr)
+			return openFile(path, true);
+
+		return stream;
+	}
+
 	SPtr<DataStream> FileSystem::createAndOpenFile(const Path& path)
 	{
 		return bs_shared_ptr_new<FileDataStream>(path, DataStream::AccessMode::WRITE, true);
@@ -349,4 +372,364 @@ namespace bs
 
 		return Path(String(directoryName) + "/");
 	}
+
+	MappedFileDataStream::MappedFileDataStream(const Path& filePath)
+		:MemoryDataStream(nullptr, 0, false), mPath(filePath)
+	{
+		mAccess = READ;
+
+		String pathString = filePath.toString();
+		int fd = open(pathString.c_str(), O_RDONLY);
+		if (fd == -1)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			return;
+		}
+
+		struct stat st_buf;
+		if (fstat(fd, &st_buf) != 0)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			::close(fd);
+			return;
+		}
+
+		// Empty files cannot be mapped
+		size_t size = (size_t)st_buf.st_size;
+		if (size > 0)
+		{
+			// Private mapping makes the pages copy-on-write, so writes never reach the file
+			void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+			if (memory != MAP_FAILED)
+			{
+				mData = mPos = (UINT8*)memory;
+				mSize = size;
+				mEnd = mData + mSize;
+			}
+			else
+				HANDLE_PATH_ERROR(pathString, errno);
+		}
+
+		// Mapping stays valid after the descriptor is closed
+		::close(fd);
+	}
+
+	void MappedFileDataStream::close()
+	{
+		if (mData != nullptr)
+		{
+			// Streams referencing another stream's mapping only need to release the reference
+			if (mSource == nullptr)
+				munmap(mData, mSize);
+
+			mData = mPos = mEnd = nullptr;
+			mSize = 0;
+		}
+
+		mSource = nullptr;
+	}
+
+#if BS_IO_URING_SUPPORTED
+	/** Read queued on the io_uring instance. */
+	struct IOUringRead
+	{
+		iovec buffer;
+		std::function<void(size_t)> onComplete;
+	};
+
+	/**
+	 * Wrapper around an io_uring instance shared by all asynchronous file streams. Reads are submitted from any thread
+	 * while a dedicated thread waits for and processes their completions.
+	 */
+	class IOUring
+	{
+	public:
+		IOUring()
+		{
+			io_uring_params params;
+			memset(&params, 0, sizeof(params));
+
+			mFd = (int)syscall(__NR_io_uring_setup, QUEUE_SIZE, &params);
+			if (mFd < 0)
+			{
+				// Kernel too old, or io_uring disabled. Caller falls back to a different backend.
+				LOGWRN("io_uring unavailable, falling back to blocking asynchronous file reads: " +
+					String(strerror(errno)));
+				return;
+			}
+
+			mSQRingSize = params.sq_off.array + params.sq_entries * sizeof(UINT32);
+			mCQRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+			mSQEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+			mSQRing = mmap(nullptr, mSQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mFd,
+				IORING_OFF_SQ_RING);
+			mCQRing = mmap(nullptr, mCQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mFd,
+				IORING_OFF_CQ_RING);
+			void* sqEntries = mmap(nullptr, mSQEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mFd,
+				IORING_OFF_SQES);
+
+			if (mSQRing == MAP_FAILED || mCQRing == MAP_FAILED || sqEntries == MAP_FAILED)
+			{
+				LOGERR("Failed to map the io_uring queues: " + String(strerror(errno)));
+
+				if (mSQRing != MAP_FAILED) munmap(mSQRing, mSQRingSize);
+				if (mCQRing != MAP_FAILED) munmap(mCQRing, mCQRingSize);
+				if (sqEntries != MAP_FAILED) munmap(sqEntries, mSQEntriesSize);
+
+				::close(mFd);
+				mFd = -1;
+				return;
+			}
+
+			UINT8* sqRing = (UINT8*)mSQRing;
+			mSQTail = (UINT32*)(sqRing + params.sq_off.tail);
+			mSQMask = *(UINT32*)(sqRing + params.sq_off.ring_mask);
+			mSQArray = (UINT32*)(sqRing + params.sq_off.array);
+			mSQEntries = (io_uring_sqe*)sqEntries;
+			mMaxInFlight = params.sq_entries;
+
+			UINT8* cqRing = (UINT8*)mCQRing;
+			mCQHead = (UINT32*)(cqRing + params.cq_off.head);
+			mCQTail = (UINT32*)(cqRing + params.cq_off.tail);
+			mCQMask = *(UINT32*)(cqRing + params.cq_off.ring_mask);
+			mCQEntries = (io_uring_cqe*)(cqRing + params.cq_off.cqes);
+
+			mThread = Thread(std::bind(&IOUring::processCompletions, this));
+		}
+
+		~IOUring()
+		{
+			if (mFd < 0)
+				return;
+
+			// Completion of a no-op without a read signals the completion thread to exit
+			submit(-1, 0, nullptr);
+			mThread.join();
+
+			munmap(mSQRing, mSQRingSize);
+			munmap(mCQRing, mCQRingSize);
+			munmap(mSQEntries, mSQEntriesSize);
+			::close(mFd);
+		}
+
+		/** Checks was the io_uring instance successfully created. */
+		bool isValid() const { return mFd >= 0; }
+
+		/**
+		 * Submits a read from the provided file. If @p read is null a no-op is submitted instead. Blocks if the maximum
+		 * number of reads are already in flight.
+		 */
+		void submit(int fd, size_t offset, IOUringRead* read)
+		{
+			Lock lock(mMutex);
+			while (mNumInFlight >= mMaxInFlight)
+				mSignal.wait(lock);
+
+			// Submissions are serialized by the mutex, so the tail can only be modified by this thread
+			UINT32 tail = *mSQTail;
+			UINT32 idx = tail & mSQMask;
+
+			io_uring_sqe& entry = mSQEntries[idx];
+			memset(&entry, 0, sizeof(entry));
+			if (read != nullptr)
+			{
+				entry.opcode = IORING_OP_READV;
+				entry.fd = fd;
+				entry.off = (UINT64)offset;
+				entry.addr = (UINT64)(uintptr_t)&read->buffer;
+				entry.len = 1;
+			}
+			else
+				entry.opcode = IORING_OP_NOP;
+
+			entry.user_data = (UINT64)(uintptr_t)read;
+
+			mSQArray[idx] = idx;
+			__atomic_store_n(mSQTail, tail + 1, __ATOMIC_RELEASE);
+
+			mNumInFlight++;
+			mNumUnsubmitted++;
+
+			// Entries the kernel didn't consume remain queued and are submitted with the next call
+			int numSubmitted;
+			do
+			{
+				numSubmitted = (int)syscall(__NR_io_uring_enter, mFd, mNumUnsubmitted, 0, 0, nullptr, 0);
+			} while (numSubmitted < 0 && errno == EINTR);
+
+			if (numSubmitted > 0)
+				mNumUnsubmitted -= (UINT32)numSubmitted;
+		}
+
+	private:
+		/** Waits for completions and triggers their callbacks, until the exit no-op completes. */
+		void processCompletions()
+		{
+			bool exit = false;
+			while (!exit)
+			{
+				int result = (int)syscall(__NR_io_uring_enter, mFd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+				if (result < 0 && errno != EINTR)
+				{
+					LOGERR("Failed waiting on io_uring completions: " + String(strerror(errno)));
+					break;
+				}
+
+				UINT32 head = *mCQHead;
+				UINT32 tail = __atomic_load_n(mCQTail, __ATOMIC_ACQUIRE);
+
+				UINT32 numCompleted = 0;
+				for (; head != tail; head++)
+				{
+					const io_uring_cqe& entry = mCQEntries[head & mCQMask];
+					IOUringRead* read = (IOUringRead*)(uintptr_t)entry.user_data;
+
+					if (read != nullptr)
+					{
+						read->onComplete(entry.res > 0 ? (size_t)entry.res : 0);
+						bs_delete(read);
+					}
+					else
+						exit = true;
+
+					numCompleted++;
+				}
+
+				__atomic_store_n(mCQHead, head, __ATOMIC_RELEASE);
+
+				Lock lock(mMutex);
+				mNumInFlight -= numCompleted;
+				mSignal.notify_all();
+			}
+		}
+
+		static constexpr UINT32 QUEUE_SIZE = 256;
+
+		int mFd = -1;
+
+		void* mSQRing = MAP_FAILED;
+		void* mCQRing = MAP_FAILED;
+		size_t mSQRingSize = 0;
+		size_t mCQRingSize = 0;
+		size_t mSQEntriesSize = 0;
+
+		UINT32* mSQTail = nullptr;
+		UINT32* mSQArray = nullptr;
+		UINT32 mSQMask = 0;
+		io_uring_sqe* mSQEntries = nullptr;
+
+		UINT32* mCQHead = nullptr;
+		UINT32* mCQTail = nullptr;
+		UINT32 mCQMask = 0;
+		io_uring_cqe* mCQEntries = nullptr;
+
+		UINT32 mMaxInFlight = 0;
+		UINT32 mNumInFlight = 0;
+		UINT32 mNumUnsubmitted = 0;
+		Mutex mMutex;
+		Signal mSignal;
+		Thread mThread;
+	};
+
+	/** Returns the io_uring instance shared by all asynchronous file streams, creating it on first use. */
+	IOUring& unix_getIOUring()
+	{
+		static IOUring ring;
+		return ring;
+	}
+#endif
+
+	/** Reads from the file using blocking reads, on the thread pool if available, otherwise on the calling thread. */
+	void unix_readBlocking(int fd, size_t offset, size_t size, void* buffer, const std::function<void(size_t)>& onComplete)
+	{
+		auto doRead = [fd, offset, size, buffer, onComplete]()
+		{
+			size_t totalRead = 0;
+			while (totalRead < size)
+			{
+				ssize_t numRead = pread(fd, (UINT8*)buffer + totalRead, size - totalRead, (off_t)(offset + totalRead));
+				if (numRead < 0 && errno == EINTR)
+					continue;
+
+				if (numRead <= 0)
+					break;
+
+				totalRead += (size_t)numRead;
+			}
+
+			onComplete(totalRead);
+		};
+
+		if (ThreadPool::isStarted())
+			ThreadPool::instance().run("AsyncFileRead", doRead);
+		else
+			doRead();
+	}
+
+	AsyncFileStream::AsyncFileStream(const Path& filePath)
+		:mPath(filePath)
+	{
+		String pathString = filePath.toString();
+		int fd = open(pathString.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd == -1)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			return;
+		}
+
+		struct stat st_buf;
+		if (fstat(fd, &st_buf) != 0)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			::close(fd);
+			return;
+		}
+
+		mSize = (size_t)st_buf.st_size;
+		mHandle = (UINT64)fd;
+	}
+
+	AsyncFileStream::~AsyncFileStream()
+	{
+		wait();
+
+		if (isOpen())
+			::close((int)mHandle);
+	}
+
+	void AsyncFileStream::readAsync(size_t offset, size_t size, void* buffer, const ReadCallback& callback)
+	{
+		if (!isOpen())
+		{
+			if (callback)
+				callback(0);
+
+			return;
+		}
+
+		{
+			Lock lock(mMutex);
+			mNumPendingReads++;
+		}
+
+		auto onComplete = [this, callback](size_t bytesRead) { notifyReadCompleted(callback, bytesRead); };
+		int fd = (int)mHandle;
+
+#if BS_IO_URING_SUPPORTED
+		IOUring& ring = unix_getIOUring();
+		if (ring.isValid())
+		{
+			IOUringRead* read = bs_new<IOUringRead>();
+			read->buffer.iov_base = buffer;
+			read->buffer.iov_len = size;
+			read->onComplete = onComplete;
+
+			ring.submit(fd, offset, read);
+			return;
+		}
+#endif
+
+		unix_readBlocking(fd, offset, size, buffer, onComplete);
+	}
 }
@@ -0,0 +1,140 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Debug/BsSamplingProfiler.h"
+
+#include <cxxabi.h>
+#include <execinfo.h>
+#include <dlfcn.h>
+#include <csignal>
+#include <cerrno>
+#include <pthread.h>
+
+namespace bs
+{
+	/** States of a single sample exchanged between the sampling thread and the signal handler of the sampled thread. */
+	enum UnixSampleState : INT32
+	{
+		UnixSample_Idle,
+		UnixSample_Requested,
+		UnixSample_Writing,
+		UnixSample_Done
+	};
+
+	/** Number of entries at the top of the captured stack belonging to the signal handler and the signal trampoline. */
+	static constexpr INT32 NUM_HANDLER_FRAMES = 2;
+
+	/** Time to wait for the sampled thread to handle the signal before giving up on the sample. */
+	static constexpr UINT32 SAMPLE_TIMEOUT_US = 10000;
+
+	static std::atomic<INT32> gSampleState{UnixSample_Idle};
+	static std::atomic<UINT64> gSampleTarget{0};
+	static void* gSampleFrames[SamplingProfiler::MAX_STACK_DEPTH + NUM_HANDLER_FRAMES];
+	static INT32 gNumSampleFrames = 0;
+
+	/** Records the call stack of the thread receiving the signal, if a sample was requested. */
+	void samplingSignalHandler(int signal, siginfo_t* info, void* context)
+	{
+		// Ignore signals arriving after the sampling thread already gave up on the sample, which could otherwise be
+		// attributed to the next sampled thread
+		if((UINT64)(uintptr_t)pthread_self() != gSampleTarget.load(std::memory_order_acquire))
+			return;
+
+		INT32 expected = UnixSample_Requested;
+		if(!gSampleState.compare_exchange_strong(expected, UnixSample_Writing, std::memory_order_acquire))
+			return;
+
+		int savedErrno = errno;
+		gNumSampleFrames = backtrace(gSampleFrames, SamplingProfiler::MAX_STACK_DEPTH + NUM_HANDLER_FRAMES);
+		errno = savedErrno;
+
+		gSampleState.store(UnixSample_Done, std::memory_order_release);
+	}
+
+	void SamplingProfiler::initPlatform()
+	{
+		static bool initialized = false;
+		if(initialized)
+			return;
+
+		// The first call to backtrace() loads the unwinder library, which isn't safe to do from a signal handler
+		void* dummy[1];
+		backtrace(dummy, 1);
+
+		struct sigaction action;
+		memset(&action, 0, sizeof(action));
+		sigemptyset(&action.sa_mask);
+		action.sa_sigaction = &samplingSignalHandler;
+		action.sa_flags = SA_SIGINFO | SA_RESTART;
+
+		sigaction(SIGPROF, &action, nullptr);
+		initialized = true;
+	}
+
+	UINT64 SamplingProfiler::getCurrentThreadHandle()
+	{
+		return (UINT64)(uintptr_t)pthread_self();
+	}
+
+	void SamplingProfiler::releaseThreadHandle(UINT64 handle)
+	{
+		// Nothing to release
+	}
+
+	UINT32 SamplingProfiler::captureStack(UINT64 handle, void** frames, UINT32 maxFrames)
+	{
+		gSampleTarget.store(handle, std::memory_order_release);
+		gSampleState.store(UnixSample_Requested, std::memory_order_release);
+
+		if(pthread_kill((pthread_t)(uintptr_t)handle, SIGPROF) != 0)
+		{
+			gSampleState.store(UnixSample_Idle, std::memory_order_relaxed);
+			return 0;
+		}
+
+		auto startTime = std::chrono::steady_clock::now();
+		while(gSampleState.load(std::memory_order_acquire) != UnixSample_Done)
+		{
+			auto elapsed = std::chrono::steady_clock::now() - startTime;
+			if(elapsed > std::chrono::microseconds(SAMPLE_TIMEOUT_US))
+			{
+				// If the handler hasn't started yet, cancel the request. Otherwise it is mid-write, so wait for it.
+				INT32 expected = UnixSample_Requested;
+				if(gSampleState.compare_exchange_strong(expected, UnixSample_Idle, std::memory_order_acquire))
+					return 0;
+			}
+
+			std::this_thread::yield();
+		}
+
+		UINT32 numFrames = 0;
+		for(INT32 i = NUM_HANDLER_FRAMES; i < gNumSampleFrames && numFrames < maxFrames; i++)
+			frames[numFrames++] = gSampleFrames[i];
+
+		gSampleState.store(UnixSample_Idle, std::memory_order_relaxed);
+		return numFrames;
+	}
+
+	String SamplingProfiler::getSymbolName(void* address)
+	{
+		Dl_info info;
+		if(!dladdr(address, &info))
+			return "0x" + toString((UINT64)(uintptr_t)address, 0, ' ', std::ios::hex);
+
+		if(info.dli_sname)
+		{
+			int status = -1;
+			char* demangledName = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+
+			String output = status == 0 ? String(demangledName) : String(info.dli_sname);
+			free(demangledName);
+
+			return output;
+		}
+
+		// No symbol available, output the module and the offset within it instead
+		String moduleName = info.dli_fname ? Path(info.dli_fname).getFilename() : "?";
+		UINT64 offset = (UINT64)((uintptr_t)address - (uintptr_t)info.dli_fbase);
+
+		return moduleName + "+0x" + toString(offset, 0, ' ', std::ios::hex);
+	}
+}
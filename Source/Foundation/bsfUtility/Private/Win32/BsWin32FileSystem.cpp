@@ -288,6 +288,24 @@ namespace bs
 		return bs_shared_ptr_new<FileDataStream>(fullPath, accessMode, true);
 	}
 
+	SPtr<DataStream> FileSystem::openFileMapped(const Path& fullPath)
+	{
+		WString pathWString = UTF8::toWide(fullPath.toString());
+		const wchar_t* pathString = pathWString.c_str();
+
+		if (!win32_pathExists(pathString) || !win32_isFile(pathString))
+		{
+			LOGWRN("Attempting to open a file that doesn't exist: " + fullPath.toString());
+			return nullptr;
+		}
+
+		SPtr<MappedFileDataStream> stream = bs_shared_ptr_new<MappedFileDataStream>(fullPath);
+		if (stream->getPtr() == nullptr)
+			return openFile(fullPath, true);
+
+		return stream;
+	}
+
 	SPtr<DataStream> FileSystem::createAndOpenFile(const Path& fullPath)
 	{
 		return bs_shared_ptr_new<FileDataStream>(fullPath, DataStream::AccessMode::WRITE, true);
@@ -474,4 +492,212 @@ namespace bs
 		const String utf8dir = UTF8::fromWide(win32_getTempDirectory());
 		return Path(utf8dir);
 	}
+
+	MappedFileDataStream::MappedFileDataStream(const Path& filePath)
+		:MemoryDataStream(nullptr, 0, false), mPath(filePath)
+	{
+		mAccess = READ;
+
+		WString pathString = UTF8::toWide(filePath.toString());
+		HANDLE file = CreateFileW(pathString.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			win32_handleError(GetLastError(), pathString);
+			return;
+		}
+
+		LARGE_INTEGER fileSize;
+		fileSize.QuadPart = 0;
+		if (!GetFileSizeEx(file, &fileSize))
+			win32_handleError(GetLastError(), pathString);
+
+		// Empty files cannot be mapped
+		if (fileSize.QuadPart > 0)
+		{
+			// Copy-on-write protection, so writes to the mapped memory never reach the file
+			HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+			if (mapping != nullptr)
+			{
+				void* memory = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+				if (memory != nullptr)
+				{
+					mData = mPos = (UINT8*)memory;
+					mSize = (size_t)fileSize.QuadPart;
+					mEnd = mData + mSize;
+				}
+				else
+					win32_handleError(GetLastError(), pathString);
+
+				// The view keeps the mapping object alive
+				CloseHandle(mapping);
+			}
+			else
+				win32_handleError(GetLastError(), pathString);
+		}
+
+		CloseHandle(file);
+	}
+
+	void MappedFileDataStream::close()
+	{
+		if (mData != nullptr)
+		{
+			// Streams referencing another stream's mapping only need to release the reference
+			if (mSource == nullptr)
+				UnmapViewOfFile(mData);
+
+			mData = mPos = mEnd = nullptr;
+			mSize = 0;
+		}
+
+		mSource = nullptr;
+	}
+
+	/** Read queued on the I/O completion port. */
+	struct Win32AsyncRead
+	{
+		OVERLAPPED overlapped;
+		std::function<void(size_t)> onComplete;
+	};
+
+	/**
+	 * I/O completion port shared by all asynchronous file streams. Files are associated with the port when opened, and
+	 * a dedicated thread waits for and processes the completions of their overlapped reads.
+	 */
+	class Win32IOCompletionPort
+	{
+	public:
+		Win32IOCompletionPort()
+		{
+			mPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+			if (mPort == nullptr)
+			{
+				LOGERR("Failed to create an I/O completion port. Error code: " + toString((UINT32)GetLastError()));
+				return;
+			}
+
+			mThread = Thread(std::bind(&Win32IOCompletionPort::processCompletions, this));
+		}
+
+		~Win32IOCompletionPort()
+		{
+			if (mPort == nullptr)
+				return;
+
+			// Packet without an overlapped structure signals the completion thread to exit
+			PostQueuedCompletionStatus(mPort, 0, 0, nullptr);
+			mThread.join();
+
+			CloseHandle(mPort);
+		}
+
+		/** Associates a file opened for overlapped I/O with the port. Returns false on failure. */
+		bool associate(HANDLE file)
+		{
+			if (mPort == nullptr)
+				return false;
+
+			return CreateIoCompletionPort(file, mPort, 0, 0) != nullptr;
+		}
+
+	private:
+		/** Waits for completions and triggers their callbacks, until the exit packet is received. */
+		void processCompletions()
+		{
+			while (true)
+			{
+				DWORD numRead = 0;
+				ULONG_PTR key = 0;
+				OVERLAPPED* overlapped = nullptr;
+
+				BOOL success = GetQueuedCompletionStatus(mPort, &numRead, &key, &overlapped, INFINITE);
+				if (overlapped == nullptr)
+					break;
+
+				Win32AsyncRead* read = CONTAINING_RECORD(overlapped, Win32AsyncRead, overlapped);
+				read->onComplete(success ? (size_t)numRead : 0);
+				bs_delete(read);
+			}
+		}
+
+		HANDLE mPort = nullptr;
+		Thread mThread;
+	};
+
+	/** Returns the completion port shared by all asynchronous file streams, creating it on first use. */
+	Win32IOCompletionPort& win32_getIOCompletionPort()
+	{
+		static Win32IOCompletionPort port;
+		return port;
+	}
+
+	AsyncFileStream::AsyncFileStream(const Path& filePath)
+		:mPath(filePath)
+	{
+		WString pathString = UTF8::toWide(filePath.toString());
+		HANDLE file = CreateFileW(pathString.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			win32_handleError(GetLastError(), pathString);
+			return;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || !win32_getIOCompletionPort().associate(file))
+		{
+			win32_handleError(GetLastError(), pathString);
+			CloseHandle(file);
+			return;
+		}
+
+		mSize = (size_t)fileSize.QuadPart;
+		mHandle = (UINT64)(uintptr_t)file;
+	}
+
+	AsyncFileStream::~AsyncFileStream()
+	{
+		wait();
+
+		if (isOpen())
+			CloseHandle((HANDLE)(uintptr_t)mHandle);
+	}
+
+	void AsyncFileStream::readAsync(size_t offset, size_t size, void* buffer, const ReadCallback& callback)
+	{
+		if (!isOpen())
+		{
+			if (callback)
+				callback(0);
+
+			return;
+		}
+
+		{
+			Lock lock(mMutex);
+			mNumPendingReads++;
+		}
+
+		Win32AsyncRead* read = bs_new<Win32AsyncRead>();
+		memset(&read->overlapped, 0, sizeof(read->overlapped));
+		read->overlapped.Offset = (DWORD)((UINT64)offset & 0xFFFFFFFF);
+		read->overlapped.OffsetHigh = (DWORD)((UINT64)offset >> 32);
+		read->onComplete = [this, callback](size_t bytesRead) { notifyReadCompleted(callback, bytesRead); };
+
+		// A completion packet is queued even if the read finishes immediately, unless it fails outright
+		assert(size <= std::numeric_limits<DWORD>::max());
+		if (!ReadFile((HANDLE)(uintptr_t)mHandle, buffer, (DWORD)size, nullptr, &read->overlapped))
+		{
+			if (GetLastError() != ERROR_IO_PENDING)
+			{
+				std::function<void(size_t)> onComplete = std::move(read->onComplete);
+				bs_delete(read);
+
+				onComplete(0);
+			}
+		}
+	}
 }
@@ -0,0 +1,102 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Debug/BsSamplingProfiler.h"
+#include "windows.h"
+
+// Disable warning in VS2015 that's not under my control
+#pragma warning(disable : 4091)
+#include "DbgHelp.h"
+#pragma warning(default : 4091)
+
+namespace bs
+{
+	void SamplingProfiler::initPlatform()
+	{
+		// Nothing to initialize, symbols are loaded on first export
+	}
+
+	UINT64 SamplingProfiler::getCurrentThreadHandle()
+	{
+		HANDLE thread = OpenThread(THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT | THREAD_QUERY_INFORMATION, false,
+			GetCurrentThreadId());
+
+		return (UINT64)(UINT_PTR)thread;
+	}
+
+	void SamplingProfiler::releaseThreadHandle(UINT64 handle)
+	{
+		if (handle != 0)
+			CloseHandle((HANDLE)(UINT_PTR)handle);
+	}
+
+	UINT32 SamplingProfiler::captureStack(UINT64 handle, void** frames, UINT32 maxFrames)
+	{
+		HANDLE thread = (HANDLE)(UINT_PTR)handle;
+		if (thread == nullptr || SuspendThread(thread) == (DWORD)-1)
+			return 0;
+
+		// Note: The thread might be suspended while holding the heap lock, so nothing below may allocate memory. This is
+		// also why the stack is unwound manually instead of using StackWalk64.
+		CONTEXT context;
+		memset(&context, 0, sizeof(context));
+		context.ContextFlags = CONTEXT_FULL;
+
+		UINT32 numFrames = 0;
+		if (GetThreadContext(thread, &context))
+		{
+#if BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64
+			while (numFrames < maxFrames && context.Rip != 0)
+			{
+				frames[numFrames++] = (void*)context.Rip;
+
+				DWORD64 imageBase;
+				PRUNTIME_FUNCTION function = RtlLookupFunctionEntry(context.Rip, &imageBase, nullptr);
+				if (function == nullptr)
+				{
+					// Leaf function, the return address is at the top of the stack
+					context.Rip = *(DWORD64*)context.Rsp;
+					context.Rsp += sizeof(DWORD64);
+				}
+				else
+				{
+					void* handlerData;
+					DWORD64 establisherFrame;
+					RtlVirtualUnwind(UNW_FLAG_NHANDLER, imageBase, context.Rip, function, &context, &handlerData,
+						&establisherFrame, nullptr);
+				}
+			}
+#else
+			// Unwinding 32-bit code requires frame pointers which aren't guaranteed, only record the current function
+			frames[numFrames++] = (void*)context.Eip;
+#endif
+		}
+
+		ResumeThread(thread);
+		return numFrames;
+	}
+
+	String SamplingProfiler::getSymbolName(void* address)
+	{
+		static bool symbolsLoaded = false;
+		if (!symbolsLoaded)
+		{
+			SymSetOptions(SymGetOptions() | SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS | SYMOPT_FAIL_CRITICAL_ERRORS);
+
+			// Might have already been initialized by the crash handler, in which case this fails but symbols are available
+			SymInitialize(GetCurrentProcess(), nullptr, true);
+			symbolsLoaded = true;
+		}
+
+		UINT8 buffer[sizeof(SYMBOL_INFO) + BS_MAX_STACKTRACE_NAME_BYTES];
+		SYMBOL_INFO* symbol = (SYMBOL_INFO*)buffer;
+		memset(symbol, 0, sizeof(SYMBOL_INFO));
+		symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+		symbol->MaxNameLen = BS_MAX_STACKTRACE_NAME_BYTES;
+
+		DWORD64 displacement;
+		if (SymFromAddr(GetCurrentProcess(), (DWORD64)address, &displacement, symbol))
+			return String(symbol->Name);
+
+		return "0x" + toString((UINT64)(UINT_PTR)address, 0, ' ', std::ios::hex);
+	}
+}
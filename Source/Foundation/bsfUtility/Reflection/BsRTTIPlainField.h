@@ -94,6 +94,17 @@ namespace bs
 		 * location and contains the proper type.
 		 */
 		virtual void arrayElemFromBuffer(void* object, int index, void* buffer) = 0;
+
+		/**
+		 * Returns a pointer to the field's value within the provided object, if the value is serialized by copying its
+		 * memory as-is. For array fields this points to the first element, with the remaining elements following it 
+		 * contiguously. Returns null if the value must be accessed through toBuffer()/fromBuffer() (or their array
+		 * equivalents) instead, or if the array is empty.
+		 */
+		virtual void* getDirectMemory(void* object)
+		{
+			return nullptr;
+		}
 	};
 
 	/** Represents a plain class field containing a specific type. */
@@ -289,6 +300,186 @@ namespace bs
 		}
 	};
 
+	/**
+	 * Plain class field that references a member variable of the object directly, instead of going through getter and
+	 * setter methods. If the type of the member can be serialized using a memcpy (see RTTIPlainTypeAllowsMemcpy), its
+	 * memory is exposed through getDirectMemory().
+	 */
+	template <class DataType, class ObjectType>
+	struct RTTIPlainMemberField : public RTTIPlainField<DataType, ObjectType>
+	{
+		/**
+		 * Initializes a plain field referencing a single member variable.
+		 *
+		 * @param[in]	name		Name of the field.
+		 * @param[in]	uniqueId	Unique identifier for this field. Although name is also a unique identifier we want a 
+		 *							small data type that can be used for efficiently serializing data to disk and similar. 
+		 *							It is primarily used for compatibility between different versions of serialized data.
+		 * @param[in]	member		Member variable the field references.
+		 * @param[in]	flags		Various flags you can use to specialize how outside systems handle this field. See "RTTIFieldFlag".
+		 */
+		void initMember(const String& name, UINT16 uniqueId, DataType ObjectType::* member, UINT64 flags)
+		{
+			mMember = member;
+
+			// Generic accessors, used by systems that access field values by type (e.g. RTTIField::getValue)
+			std::function<DataType&(ObjectType*)> getter = [member](ObjectType* obj) -> DataType& { return obj->*member; };
+			std::function<void(ObjectType*, DataType&)> setter = 
+				[member](ObjectType* obj, DataType& val) { obj->*member = val; };
+
+			this->initSingle(name, uniqueId, getter, setter, flags);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::getDynamicSize */
+		UINT32 getDynamicSize(void* object) override
+		{
+			this->checkIsArray(false);
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			return RTTIPlainType<DataType>::getDynamicSize(castObject->*mMember);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::toBuffer */
+		void toBuffer(void* object, void* buffer) override
+		{
+			this->checkIsArray(false);
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			RTTIPlainType<DataType>::toMemory(castObject->*mMember, (char*)buffer);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::fromBuffer */
+		void fromBuffer(void* object, void* buffer) override
+		{
+			this->checkIsArray(false);
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+
+			// Deserialize into a new value, as types like containers append to existing contents
+			DataType value;
+			RTTIPlainType<DataType>::fromMemory(value, (char*)buffer);
+
+			castObject->*mMember = std::move(value);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::getDirectMemory */
+		void* getDirectMemory(void* object) override
+		{
+			if (!RTTIPlainTypeAllowsMemcpy<DataType>::value)
+				return nullptr;
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			return &(castObject->*mMember);
+		}
+
+	private:
+		DataType ObjectType::* mMember = nullptr;
+	};
+
+	/**
+	 * Plain class field that references a member container of the object directly, instead of going through getter and
+	 * setter methods. The container must provide size(), resize(), data() and an index operator. If its element type can
+	 * be serialized using a memcpy (see RTTIPlainTypeAllowsMemcpy), the element memory is exposed through
+	 * getDirectMemory() so the entire array can be copied at once.
+	 */
+	template <class DataType, class ObjectType, class ContainerType>
+	struct RTTIPlainMemberArrayField : public RTTIPlainField<DataType, ObjectType>
+	{
+		/**
+		 * Initializes a plain field referencing a member container.
+		 *
+		 * @param[in]	name		Name of the field.
+		 * @param[in]	uniqueId	Unique identifier for this field. Although name is also a unique identifier we want a 
+		 *							small data type that can be used for efficiently serializing data to disk and similar. 
+		 *							It is primarily used for compatibility between different versions of serialized data.
+		 * @param[in]	member		Member container the field references.
+		 * @param[in]	flags		Various flags you can use to specialize how outside systems handle this field. See "RTTIFieldFlag".
+		 */
+		void initMember(const String& name, UINT16 uniqueId, ContainerType ObjectType::* member, UINT64 flags)
+		{
+			mMember = member;
+
+			// Generic accessors, used by systems that access field values by type (e.g. RTTIField::getArrayValue)
+			std::function<DataType&(ObjectType*, UINT32)> getter = 
+				[member](ObjectType* obj, UINT32 idx) -> DataType& { return (obj->*member)[idx]; };
+			std::function<UINT32(ObjectType*)> getSize = 
+				[member](ObjectType* obj) { return (UINT32)(obj->*member).size(); };
+			std::function<void(ObjectType*, UINT32, DataType&)> setter = 
+				[member](ObjectType* obj, UINT32 idx, DataType& val) { (obj->*member)[idx] = val; };
+			std::function<void(ObjectType*, UINT32)> setSize = 
+				[member](ObjectType* obj, UINT32 size) { (obj->*member).resize(size); };
+
+			this->initArray(name, uniqueId, getter, getSize, setter, setSize, flags);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::getArrayElemDynamicSize */
+		UINT32 getArrayElemDynamicSize(void* object, int index) override
+		{
+			this->checkIsArray(true);
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			return RTTIPlainType<DataType>::getDynamicSize((castObject->*mMember)[index]);
+		}
+
+		/** @copydoc RTTIPlainField::getArraySize */
+		UINT32 getArraySize(void* object) override
+		{
+			this->checkIsArray(true);
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			return (UINT32)(castObject->*mMember).size();
+		}
+
+		/** @copydoc RTTIPlainField::setArraySize */
+		void setArraySize(void* object, UINT32 size) override
+		{
+			this->checkIsArray(true);
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			(castObject->*mMember).resize(size);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::arrayElemToBuffer */
+		void arrayElemToBuffer(void* object, int index, void* buffer) override
+		{
+			this->checkIsArray(true);
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			RTTIPlainType<DataType>::toMemory((castObject->*mMember)[index], (char*)buffer);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::arrayElemFromBuffer */
+		void arrayElemFromBuffer(void* object, int index, void* buffer) override
+		{
+			this->checkIsArray(true);
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+
+			// Deserialize into a new value, as types like containers append to existing contents
+			DataType value;
+			RTTIPlainType<DataType>::fromMemory(value, (char*)buffer);
+
+			(castObject->*mMember)[index] = std::move(value);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::getDirectMemory */
+		void* getDirectMemory(void* object) override
+		{
+			if (!RTTIPlainTypeAllowsMemcpy<DataType>::value)
+				return nullptr;
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			ContainerType& container = castObject->*mMember;
+			if (container.size() == 0)
+				return nullptr;
+
+			return container.data();
+		}
+
+	private:
+		ContainerType ObjectType::* mMember = nullptr;
+	};
+
 	/** @} */
 	/** @} */
 }
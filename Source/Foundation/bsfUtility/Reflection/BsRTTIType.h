@@ -34,17 +34,17 @@ namespace bs
 	  /**
 	   * Registers a new member field in the RTTI type. The field references the @p name member in the owner class.
 	   * The type of the member must be a valid plain type. Each field must specify a unique ID for @p id.
+	   *
+	   * The member is referenced directly rather than through generated getter/setter methods, allowing types that
+	   * support it to be serialized with a memcpy (see RTTIType::addPlainMemberField).
 	   */
 #define BS_RTTI_MEMBER_PLAIN(name, id)															\
 	META_Entry_##name;																			\
 																								\
-	decltype(OwnerType::name)& get##name(OwnerType* obj) { return obj->name; }					\
-	void set##name(OwnerType* obj, decltype(OwnerType::name)& val) { obj->name = val; }			\
-																								\
 	struct META_NextEntry_##name{};																\
 	void META_InitPrevEntry(META_NextEntry_##name typeId)										\
 	{																							\
-		addPlainField(#name, id, &MyType::get##name, &MyType::set##name);						\
+		addPlainMemberField(#name, id, &OwnerType::name);										\
 		META_InitPrevEntry(META_Entry_##name());												\
 	}																							\
 																								\
@@ -69,19 +69,17 @@ namespace bs
 /**
  * Registers a new member field in the RTTI type. The field references the @p name member in the owner class.
  * The type of the member must be an array of valid plain types. Each field must specify a unique ID for @p id.
+ *
+ * The member is referenced directly rather than through generated getter/setter methods, allowing arrays of types that
+ * support it to be serialized with a single memcpy (see RTTIType::addPlainMemberArrayField).
  */
 #define BS_RTTI_MEMBER_PLAIN_ARRAY(name, id)													\
 	META_Entry_##name;																			\
 																								\
-	std::common_type<decltype(OwnerType::name)>::type::value_type& get##name(OwnerType* obj, UINT32 idx) { return obj->name[idx]; }					\
-	void set##name(OwnerType* obj, UINT32 idx, std::common_type<decltype(OwnerType::name)>::type::value_type& val) { obj->name[idx] = val; }		\
-	UINT32 getSize##name(OwnerType* obj) { return (UINT32)obj->name.size(); }																		\
-	void setSize##name(OwnerType* obj, UINT32 val) { obj->name.resize(val); }																		\
-																								\
 	struct META_NextEntry_##name{};																\
 	void META_InitPrevEntry(META_NextEntry_##name typeId)										\
 	{																							\
-		addPlainArrayField(#name, id, &MyType::get##name, &MyType::getSize##name, &MyType::set##name, &MyType::setSize##name);						\
+		addPlainMemberArrayField(#name, id, &OwnerType::name);									\
 		META_InitPrevEntry(META_Entry_##name());												\
 	}																							\
 																								\
@@ -350,6 +348,13 @@ namespace bs
 		 */
 		virtual void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) {}
 
+		/**
+		 * Determines if objects of this type can be cloned by BinaryCloner by copying their field values directly into
+		 * a new object. Types that return false are instead cloned by serializing them into a buffer and deserializing
+		 * the result, which is slower but doesn't interleave the serialization and deserialization callbacks.
+		 */
+		virtual bool allowDirectClone() const { return true; }
+
 		/**
 		 * Returns a handler that determines how are "diffs" generated and applied when it comes to objects of this RTTI 
 		 * type. A "diff" is a list of differences between two objects that may be saved, viewed or applied to another 
@@ -1120,6 +1125,67 @@ namespace bs
 				std::function<void(ObjectType*, const SPtr<DataStream>&, UINT32)>(std::bind(setter, static_cast<InterfaceType*>(this), _1, _2, _3)), flags);
 		}	
 
+		/************************************************************************/
+		/* 		FIELDS REFERENCING MEMBER VARIABLES DIRECTLY					*/
+		/************************************************************************/
+
+		/**
+		 * Registers a new plain field referencing a member variable of the owner type. Unlike fields using getter/setter
+		 * methods the value is accessed without any indirection, and if the type allows it (see 
+		 * RTTIPlainTypeAllowsMemcpy) the serializer copies it directly to/from the object's memory.
+		 *
+		 * @param[in]	name		Name of the field.
+		 * @param[in]	uniqueId	Unique identifier for this field. Although name is also a unique identifier we want a 
+		 *							small data type that can be used for efficiently serializing data to disk and similar. 
+		 *							It is primarily used for compatibility between different versions of serialized data.
+		 * @param[in]	member		Member variable of the owner type (or one of its base classes).
+		 * @param[in]	flags		Various flags you can use to specialize how systems handle this field. See RTTIFieldFlag.
+		 */
+		template<class MemberOwnerType, class DataType>
+		void addPlainMemberField(const String& name, UINT32 uniqueId, DataType MemberOwnerType::* member, UINT64 flags = 0)
+		{
+			static_assert((std::is_base_of<MemberOwnerType, Type>::value), 
+				"Member must belong to the owner type or one of its base classes.");
+
+			static_assert(!(std::is_base_of<bs::IReflectable, DataType>::value), 
+				"Data type derives from IReflectable but it is being added as a plain field.");
+
+			RTTIPlainMemberField<DataType, Type>* newField = bs_new<RTTIPlainMemberField<DataType, Type>>();
+			newField->initMember(name, uniqueId, static_cast<DataType Type::*>(member), flags);
+			addNewField(newField);
+		}
+
+		/**
+		 * Registers a new plain array field referencing a member container of the owner type. Unlike fields using 
+		 * getter/setter methods the elements are accessed without any indirection, and if the element type allows it (see 
+		 * RTTIPlainTypeAllowsMemcpy) the serializer copies the entire array directly to/from the container's memory.
+		 *
+		 * @param[in]	name		Name of the field.
+		 * @param[in]	uniqueId	Unique identifier for this field. Although name is also a unique identifier we want a 
+		 *							small data type that can be used for efficiently serializing data to disk and similar. 
+		 *							It is primarily used for compatibility between different versions of serialized data.
+		 * @param[in]	member		Member container of the owner type (or one of its base classes). Must store its 
+		 *							elements contiguously.
+		 * @param[in]	flags		Various flags you can use to specialize how systems handle this field. See RTTIFieldFlag.
+		 */
+		template<class MemberOwnerType, class ContainerType>
+		void addPlainMemberArrayField(const String& name, UINT32 uniqueId, ContainerType MemberOwnerType::* member, 
+			UINT64 flags = 0)
+		{
+			typedef typename ContainerType::value_type DataType;
+
+			static_assert((std::is_base_of<MemberOwnerType, Type>::value), 
+				"Member must belong to the owner type or one of its base classes.");
+
+			static_assert(!(std::is_base_of<bs::IReflectable, DataType>::value), 
+				"Data type derives from IReflectable but it is being added as a plain field.");
+
+			RTTIPlainMemberArrayField<DataType, Type, ContainerType>* newField = 
+				bs_new<RTTIPlainMemberArrayField<DataType, Type, ContainerType>>();
+			newField->initMember(name, uniqueId, static_cast<ContainerType Type::*>(member), flags);
+			addNewField(newField);
+		}
+
 	private:
 		template<class ObjectType, class DataType>
 		void addPlainField(const String& name, UINT32 uniqueId, Any getter, Any setter, UINT64 flags)
@@ -9,14 +9,87 @@
 #include "Reflection/BsRTTIReflectablePtrField.h"
 #include "Reflection/BsRTTIManagedDataBlockField.h"
 #include "Serialization/BsMemorySerializer.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsSmallVector.h"
 
 namespace bs
 {
+	/** Keeps track of objects cloned during a single BinaryCloner::clone() call. */
+	struct BinaryCloner::DirectCloneState
+	{
+		/** Information about a single object referenced through a pointer field. */
+		struct Entry
+		{
+			/** Original object, referenced so that objects returned by value from getters stay alive. */
+			SPtr<IReflectable> source;
+			SPtr<IReflectable> clone;
+			bool isCloned = false;
+			bool cloneInProgress = false;
+		};
+
+		UnorderedMap<IReflectable*, Entry> objects;
+		bool shallow = false;
+
+		static const UnorderedMap<String, UINT64> EMPTY_PARAMS;
+	};
+
+	const UnorderedMap<String, UINT64> BinaryCloner::DirectCloneState::EMPTY_PARAMS;
+
 	SPtr<IReflectable> BinaryCloner::clone(IReflectable* object, bool shallow)
 	{
 		if (object == nullptr)
 			return nullptr;
 
+		if (!object->getRTTI()->allowDirectClone())
+			return cloneSerialized(object, shallow);
+
+		DirectCloneState state;
+		state.shallow = shallow;
+
+		SPtr<IReflectable> clonedObj = object->getRTTI()->newRTTIObject();
+
+		// Register the root so that objects referencing it back resolve to the clone
+		DirectCloneState::Entry& rootEntry = state.objects[object];
+		rootEntry.clone = clonedObj;
+		rootEntry.cloneInProgress = true;
+
+		copyFields(object, clonedObj.get(), state);
+
+		rootEntry.cloneInProgress = false;
+		rootEntry.isCloned = true;
+
+		// Objects only referenced through weak references have been created but not filled in yet. Filling them in can
+		// reference new objects, so keep going until no such objects remain.
+		Vector<std::pair<IReflectable*, DirectCloneState::Entry*>> pendingObjects;
+		while (true)
+		{
+			pendingObjects.clear();
+			for (auto& entry : state.objects)
+			{
+				if (!entry.second.isCloned)
+					pendingObjects.push_back(std::make_pair(entry.first, &entry.second));
+			}
+
+			if (pendingObjects.empty())
+				break;
+
+			for (auto& entry : pendingObjects)
+			{
+				if (entry.second->isCloned)
+					continue;
+
+				entry.second->cloneInProgress = true;
+				copyFields(entry.first, entry.second->clone.get(), state);
+				entry.second->cloneInProgress = false;
+				entry.second->isCloned = true;
+			}
+		}
+
+		return clonedObj;
+	}
+
+	SPtr<IReflectable> BinaryCloner::cloneSerialized(IReflectable* object, bool shallow)
+	{
 		ObjectReferenceData referenceData;
 		if (shallow)
 			gatherReferences(object, referenceData);
@@ -35,6 +108,248 @@ namespace bs
 		return clonedObj;
 	}
 
+	SPtr<IReflectable> BinaryCloner::cloneObject(IReflectable* object, DirectCloneState& state)
+	{
+		RTTITypeBase* rtti = object->getRTTI();
+		if (!rtti->allowDirectClone())
+			return cloneSerialized(object, state.shallow);
+
+		SPtr<IReflectable> clonedObj = rtti->newRTTIObject();
+		copyFields(object, clonedObj.get(), state);
+
+		return clonedObj;
+	}
+
+	SPtr<IReflectable> BinaryCloner::clonePointer(const SPtr<IReflectable>& object, bool weakRef, 
+		DirectCloneState& state)
+	{
+		if (object == nullptr)
+			return nullptr;
+
+		auto iterFind = state.objects.find(object.get());
+		if (iterFind != state.objects.end())
+		{
+			DirectCloneState::Entry& entry = iterFind->second;
+
+			// Objects that are still being cloned are referenced circularly, in which case the reference gets a
+			// partially initialized object, same as during deserialization
+			if (!weakRef && !entry.isCloned && !entry.cloneInProgress)
+			{
+				entry.cloneInProgress = true;
+				copyFields(object.get(), entry.clone.get(), state);
+				entry.cloneInProgress = false;
+				entry.isCloned = true;
+			}
+
+			return entry.clone;
+		}
+
+		RTTITypeBase* rtti = object->getRTTI();
+		if (!rtti->allowDirectClone())
+		{
+			DirectCloneState::Entry& entry = state.objects[object.get()];
+			entry.source = object;
+			entry.clone = cloneSerialized(object.get(), state.shallow);
+			entry.isCloned = true;
+
+			return entry.clone;
+		}
+
+		SPtr<IReflectable> clonedObj = rtti->newRTTIObject();
+
+		DirectCloneState::Entry& entry = state.objects[object.get()];
+		entry.source = object;
+		entry.clone = clonedObj;
+
+		// Weakly referenced objects are filled in once the root object is done
+		if (!weakRef)
+		{
+			entry.cloneInProgress = true;
+			copyFields(object.get(), clonedObj.get(), state);
+			entry.cloneInProgress = false;
+			entry.isCloned = true;
+		}
+
+		return clonedObj;
+	}
+
+	void BinaryCloner::copyFields(IReflectable* source, IReflectable* destination, DirectCloneState& state)
+	{
+		const UnorderedMap<String, UINT64>& params = DirectCloneState::EMPTY_PARAMS;
+
+		SmallVector<RTTITypeBase*, 4> rttiTypes;
+		RTTITypeBase* rtti = source->getRTTI();
+		while (rtti != nullptr)
+		{
+			rttiTypes.push_back(rtti);
+			rtti = rtti->getBaseClass();
+		}
+
+		// Base class fields are assigned first, and the deserialization of all classes ends once all of them are
+		// assigned, same as when deserializing
+		for (auto iter = rttiTypes.rbegin(); iter != rttiTypes.rend(); ++iter)
+		{
+			rtti = *iter;
+			rtti->onSerializationStarted(source, params);
+			rtti->onDeserializationStarted(destination, params);
+
+			UINT32 numFields = rtti->getNumFields();
+			for (UINT32 i = 0; i < numFields; i++)
+			{
+				RTTIField* genericField = rtti->getField(i);
+				switch (genericField->mType)
+				{
+				case SerializableFT_Plain:
+				{
+					RTTIPlainFieldBase* field = static_cast<RTTIPlainFieldBase*>(genericField);
+
+					if (field->isArray())
+					{
+						UINT32 numElements = field->getArraySize(source);
+						field->setArraySize(destination, numElements);
+
+						if (numElements == 0)
+							break;
+
+						UINT8* srcMemory = nullptr;
+						UINT8* dstMemory = nullptr;
+						if (!field->hasDynamicSize())
+						{
+							srcMemory = (UINT8*)field->getDirectMemory(source);
+							dstMemory = (UINT8*)field->getDirectMemory(destination);
+						}
+
+						UINT32 typeSize = field->getTypeSize();
+						if (srcMemory != nullptr && dstMemory != nullptr)
+						{
+							memcpy(dstMemory, srcMemory, typeSize * numElements);
+							break;
+						}
+
+						for (UINT32 j = 0; j < numElements; j++)
+						{
+							if (srcMemory != nullptr)
+							{
+								field->arrayElemFromBuffer(destination, j, srcMemory + j * typeSize);
+								continue;
+							}
+
+							if (field->hasDynamicSize())
+								typeSize = field->getArrayElemDynamicSize(source, j);
+
+							UINT8* tempBuffer = (UINT8*)bs_stack_alloc(typeSize);
+							field->arrayElemToBuffer(source, j, tempBuffer);
+							field->arrayElemFromBuffer(destination, j, tempBuffer);
+							bs_stack_free(tempBuffer);
+						}
+					}
+					else
+					{
+						UINT32 typeSize = 0;
+						UINT8* srcMemory = nullptr;
+						UINT8* dstMemory = nullptr;
+						if (field->hasDynamicSize())
+							typeSize = field->getDynamicSize(source);
+						else
+						{
+							typeSize = field->getTypeSize();
+							srcMemory = (UINT8*)field->getDirectMemory(source);
+							dstMemory = (UINT8*)field->getDirectMemory(destination);
+						}
+
+						if (srcMemory != nullptr && dstMemory != nullptr)
+							memcpy(dstMemory, srcMemory, typeSize);
+						else if (srcMemory != nullptr)
+							field->fromBuffer(destination, srcMemory);
+						else
+						{
+							UINT8* tempBuffer = (UINT8*)bs_stack_alloc(typeSize);
+							field->toBuffer(source, tempBuffer);
+							field->fromBuffer(destination, tempBuffer);
+							bs_stack_free(tempBuffer);
+						}
+					}
+
+					break;
+				}
+				case SerializableFT_Reflectable:
+				{
+					RTTIReflectableFieldBase* field = static_cast<RTTIReflectableFieldBase*>(genericField);
+
+					if (field->isArray())
+					{
+						UINT32 numElements = field->getArraySize(source);
+						field->setArraySize(destination, numElements);
+
+						for (UINT32 j = 0; j < numElements; j++)
+						{
+							SPtr<IReflectable> clonedObj = cloneObject(&field->getArrayValue(source, j), state);
+							field->setArrayValue(destination, j, *clonedObj);
+						}
+					}
+					else
+					{
+						SPtr<IReflectable> clonedObj = cloneObject(&field->getValue(source), state);
+						field->setValue(destination, *clonedObj);
+					}
+
+					break;
+				}
+				case SerializableFT_ReflectablePtr:
+				{
+					RTTIReflectablePtrFieldBase* field = static_cast<RTTIReflectablePtrFieldBase*>(genericField);
+					bool weakRef = (field->getFlags() & RTTI_Flag_WeakRef) != 0;
+
+					if (field->isArray())
+					{
+						UINT32 numElements = field->getArraySize(source);
+						field->setArraySize(destination, numElements);
+
+						for (UINT32 j = 0; j < numElements; j++)
+						{
+							SPtr<IReflectable> childObj = field->getArrayValue(source, j);
+							if (!state.shallow)
+								childObj = clonePointer(childObj, weakRef, state);
+
+							field->setArrayValue(destination, j, childObj);
+						}
+					}
+					else
+					{
+						SPtr<IReflectable> childObj = field->getValue(source);
+						if (!state.shallow)
+							childObj = clonePointer(childObj, weakRef, state);
+
+						field->setValue(destination, childObj);
+					}
+
+					break;
+				}
+				case SerializableFT_DataBlock:
+				{
+					RTTIManagedDataBlockFieldBase* field = static_cast<RTTIManagedDataBlockFieldBase*>(genericField);
+
+					UINT32 dataBlockSize = 0;
+					SPtr<DataStream> blockStream = field->getValue(source, dataBlockSize);
+
+					SPtr<MemoryDataStream> clonedStream = bs_shared_ptr_new<MemoryDataStream>(dataBlockSize);
+					blockStream->read(clonedStream->getPtr(), dataBlockSize);
+
+					field->setValue(destination, clonedStream, dataBlockSize);
+					break;
+				}
+				default:
+					break;
+				}
+			}
+
+			rtti->onSerializationEnded(source, params);
+		}
+
+		for (auto iter = rttiTypes.rbegin(); iter != rttiTypes.rend(); ++iter)
+			(*iter)->onDeserializationEnded(destination, params);
+	}
+
 	void BinaryCloner::gatherReferences(IReflectable* object, ObjectReferenceData& referenceData)
 	{
 		static const UnorderedMap<String, UINT64> dummyParams;
@@ -18,6 +18,12 @@ namespace bs
 		/**
 		 * Returns a copy of the provided object with identical data.
 		 *
+		 * Objects are cloned by walking their RTTI fields and copying the field values directly into newly created
+		 * objects, without an intermediate buffer. The original objects receive the same serialization callbacks, and
+		 * the clones the same deserialization callbacks, as when serializing and deserializing the object.
+		 * Objects whose RTTI types don't allow direct cloning (see RTTITypeBase::allowDirectClone) are serialized and
+		 * deserialized instead.
+		 *
 		 * @param[in]	object		Object to clone.
 		 * @param[in]	shallow		If false then all referenced objects will be cloned as well, otherwise the references 
 		 *							to the original objects will be kept.
@@ -26,6 +32,22 @@ namespace bs
 
 	private:
 		struct ObjectReferenceData;
+		struct DirectCloneState;
+
+		/** Clones the object by serializing it into a buffer and deserializing the result. */
+		static SPtr<IReflectable> cloneSerialized(IReflectable* object, bool shallow);
+
+		/** Creates a new object of the same type as @p object and copies all of its fields into the new object. */
+		static SPtr<IReflectable> cloneObject(IReflectable* object, DirectCloneState& state);
+
+		/**
+		 * Returns the clone of an object referenced through a pointer field, creating it if the object wasn't
+		 * referenced before. Unless the reference is weak, the returned clone will also have its fields copied.
+		 */
+		static SPtr<IReflectable> clonePointer(const SPtr<IReflectable>& object, bool weakRef, DirectCloneState& state);
+
+		/** Copies values of all fields of @p source into @p destination, which must be of the same type. */
+		static void copyFields(IReflectable* source, IReflectable* destination, DirectCloneState& state);
 
 		/** Identifier representing a single field or an array entry in an object. */
 		struct FieldId
@@ -124,6 +124,13 @@ namespace bs
 		if (dataLength == 0)
 			return nullptr;
 
+		if (!data->isFile())
+		{
+			SPtr<IReflectable> output;
+			if (decodeDirect(data, dataLength, output))
+				return output;
+		}
+
 		SPtr<SerializedObject> intermediateObject = _decodeToIntermediate(data, dataLength);
 		if (intermediateObject == nullptr)
 			return nullptr;
@@ -284,6 +291,25 @@ namespace bs
 						{
 							RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
+							// Elements that can be copied as-is are written all at once
+							UINT8* directMemory = nullptr;
+							if(!curField->hasDynamicSize() && arrayNumElems > 0)
+								directMemory = (UINT8*)curField->getDirectMemory(object);
+
+							if(directMemory != nullptr)
+							{
+								buffer = dataBlockToBuffer(directMemory, curField->getTypeSize() * arrayNumElems, buffer, 
+									bufferLength, bytesWritten, flushBufferCallback);
+
+								if (buffer == nullptr || bufferLength == 0)
+								{
+									si->onSerializationEnded(object, mParams);
+									return nullptr;
+								}
+
+								break;
+							}
+
 							for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
 							{
 								UINT32 typeSize = 0;
@@ -359,12 +385,27 @@ namespace bs
 							RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
 							UINT32 typeSize = 0;
+							UINT8* directMemory = nullptr;
 							if(curField->hasDynamicSize())
 								typeSize = curField->getDynamicSize(object);
 							else
+							{
 								typeSize = curField->getTypeSize();
+								directMemory = (UINT8*)curField->getDirectMemory(object);
+							}
 
-							if ((*bytesWritten + typeSize) > bufferLength)
+							if (directMemory != nullptr)
+							{
+								buffer = dataBlockToBuffer(directMemory, typeSize, buffer, bufferLength, bytesWritten, 
+									flushBufferCallback);
+
+								if (buffer == nullptr || bufferLength == 0)
+								{
+									si->onSerializationEnded(object, mParams);
+									return nullptr;
+								}
+							}
+							else if ((*bytesWritten + typeSize) > bufferLength)
 							{
 								UINT8* tempBuffer = (UINT8*)bs_stack_alloc(typeSize);
 								curField->toBuffer(object, tempBuffer);
@@ -1110,6 +1151,476 @@ namespace bs
 		}
 	}
 
+	bool BinarySerializer::decodeDirect(const SPtr<DataStream>& data, UINT32 dataLength, SPtr<IReflectable>& output)
+	{
+		if (data->isFile())
+			return false;
+
+		SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(data);
+		if (memStream->getPtr() == nullptr || (memStream->size() - memStream->tell()) < dataLength)
+			return false;
+
+		mDirectStream = data;
+		mDirectData = memStream->getCurrentPtr();
+		mDirectDataStart = (UINT32)memStream->tell();
+		mDirectDataLength = dataLength;
+		mDirectObjects.clear();
+		mDirectObjectIds.clear();
+
+		auto cleanUp = [this]()
+		{
+			mDirectObjects.clear();
+			mDirectObjectIds.clear();
+			mDirectStream = nullptr;
+			mDirectData = nullptr;
+		};
+
+		// Find all top-level objects and make sure they match the current RTTI types. Nothing is created until the entire
+		// data set is known to be compatible, so the intermediate path can take over if it isn't.
+		UINT32 pos = 0;
+		while (pos < dataLength)
+		{
+			UINT32 objectStart = pos;
+			if (!scanDirectEntry(pos, false, nullptr))
+			{
+				cleanUp();
+				return false;
+			}
+
+			ObjectMetaData objectMetaData;
+			memcpy(&objectMetaData, mDirectData + objectStart, sizeof(ObjectMetaData));
+
+			UINT32 objectId = 0;
+			UINT32 objectTypeId = 0;
+			bool objectIsBaseClass = false;
+			decodeObjectMetaData(objectMetaData, objectId, objectTypeId, objectIsBaseClass);
+
+			if (objectId > 0)
+			{
+				// Objects split over multiple entries are only handled by the intermediate path
+				if (mDirectObjectIds.find(objectId) != mDirectObjectIds.end())
+				{
+					cleanUp();
+					return false;
+				}
+
+				mDirectObjectIds[objectId] = (UINT32)mDirectObjects.size();
+			}
+
+			mDirectObjects.push_back(DirectObject(objectStart, objectTypeId));
+		}
+
+		DirectObject& root = mDirectObjects[0];
+		root.object = IReflectable::_getRTTIfromTypeId(root.typeId)->newRTTIObject();
+
+		root.decodeInProgress = true;
+		decodeDirectEntry(root.object, root.offset, false);
+		root.decodeInProgress = false;
+		root.isDecoded = true;
+
+		// Go through the remaining objects (should be only ones with weak refs)
+		for (auto& entry : mDirectObjects)
+		{
+			if (entry.object == nullptr || entry.isDecoded)
+				continue;
+
+			entry.decodeInProgress = true;
+			decodeDirectEntry(entry.object, entry.offset, false);
+			entry.decodeInProgress = false;
+			entry.isDecoded = true;
+		}
+
+		output = root.object;
+
+		// Data blocks might have moved the stream, make sure it ends up after the decoded data
+		data->seek(mDirectDataStart + dataLength);
+
+		cleanUp();
+		return true;
+	}
+
+	bool BinarySerializer::scanDirectEntry(UINT32& pos, bool embedded, Vector<DirectSubObject>* subObjects)
+	{
+		auto canRead = [this](UINT32 pos, UINT64 size)
+		{
+			return (UINT64)pos + size <= (UINT64)mDirectDataLength;
+		};
+
+		if (!canRead(pos, sizeof(ObjectMetaData)))
+			return false;
+
+		ObjectMetaData objectMetaData;
+		memcpy(&objectMetaData, mDirectData + pos, sizeof(ObjectMetaData));
+
+		if (!isObjectMetaData(objectMetaData.objectMeta))
+			return false;
+
+		UINT32 objectId = 0;
+		UINT32 objectTypeId = 0;
+		bool objectIsBaseClass = false;
+		decodeObjectMetaData(objectMetaData, objectId, objectTypeId, objectIsBaseClass);
+
+		RTTITypeBase* rtti = IReflectable::_getRTTIfromTypeId(objectTypeId);
+		if (objectIsBaseClass || rtti == nullptr)
+			return false;
+
+		pos += sizeof(ObjectMetaData);
+
+		DirectSubObject subObject = { rtti, pos, pos };
+		UINT32 nextFieldIdx = 0;
+
+		while (pos < mDirectDataLength)
+		{
+			if (!canRead(pos, META_SIZE))
+				return false;
+
+			UINT32 metaData = 0;
+			memcpy(&metaData, mDirectData + pos, META_SIZE);
+
+			if (isObjectMetaData(metaData)) // We've reached a new object or a base class of the current one
+			{
+				if (!canRead(pos, sizeof(ObjectMetaData)))
+					return false;
+
+				ObjectMetaData objMetaData;
+				memcpy(&objMetaData, mDirectData + pos, sizeof(ObjectMetaData));
+
+				UINT32 objId = 0;
+				UINT32 objTypeId = 0;
+				bool objIsBaseClass = false;
+				decodeObjectMetaData(objMetaData, objId, objTypeId, objIsBaseClass);
+
+				// Found new object, we're done. Embedded objects are expected to end with a terminator instead.
+				if (!objIsBaseClass)
+				{
+					if (embedded)
+						return false;
+
+					break;
+				}
+
+				// Saved and current base classes must match
+				rtti = rtti->getBaseClass();
+				if (rtti == nullptr || rtti->getRTTIId() != objTypeId)
+					return false;
+
+				subObject.fieldsEnd = pos;
+				if (subObjects != nullptr)
+					subObjects->push_back(subObject);
+
+				pos += sizeof(ObjectMetaData);
+
+				subObject = { rtti, pos, pos };
+				nextFieldIdx = 0;
+				continue;
+			}
+
+			bool isArray;
+			SerializableFieldType fieldType;
+			UINT16 fieldId;
+			UINT8 fieldSize;
+			bool hasDynamicSize;
+			bool terminator;
+			decodeFieldMetaData(metaData, fieldId, fieldSize, isArray, fieldType, hasDynamicSize, terminator);
+
+			if (terminator)
+			{
+				if (!embedded)
+					return false;
+
+				subObject.fieldsEnd = pos;
+				if (subObjects != nullptr)
+					subObjects->push_back(subObject);
+
+				pos += META_SIZE;
+				return true;
+			}
+
+			pos += META_SIZE;
+
+			// Fields must be stored in the same order as the current RTTI type lists them, and with the same layout
+			RTTIField* curGenericField = nullptr;
+			UINT32 numFields = rtti->getNumFields();
+			while (nextFieldIdx < numFields)
+			{
+				RTTIField* field = rtti->getField(nextFieldIdx++);
+				if (field->mUniqueId == fieldId)
+				{
+					curGenericField = field;
+					break;
+				}
+			}
+
+			if (curGenericField == nullptr || curGenericField->mIsVectorType != isArray || 
+				curGenericField->mType != fieldType || curGenericField->hasDynamicSize() != hasDynamicSize ||
+				(!hasDynamicSize && curGenericField->getTypeSize() != fieldSize))
+			{
+				return false;
+			}
+
+			UINT32 arrayNumElems = 1;
+			if (isArray)
+			{
+				if (!canRead(pos, NUM_ELEM_FIELD_SIZE))
+					return false;
+
+				memcpy(&arrayNumElems, mDirectData + pos, NUM_ELEM_FIELD_SIZE);
+				pos += NUM_ELEM_FIELD_SIZE;
+			}
+
+			switch (fieldType)
+			{
+			case SerializableFT_ReflectablePtr:
+			{
+				UINT64 size = (UINT64)arrayNumElems * COMPLEX_TYPE_FIELD_SIZE;
+				if (!canRead(pos, size))
+					return false;
+
+				pos += (UINT32)size;
+				break;
+			}
+			case SerializableFT_Reflectable:
+			{
+				for (UINT32 i = 0; i < arrayNumElems; i++)
+				{
+					if (!scanDirectEntry(pos, true, nullptr))
+						return false;
+				}
+
+				break;
+			}
+			case SerializableFT_Plain:
+			{
+				for (UINT32 i = 0; i < arrayNumElems; i++)
+				{
+					UINT32 typeSize = fieldSize;
+					if (hasDynamicSize)
+					{
+						if (!canRead(pos, sizeof(UINT32)))
+							return false;
+
+						memcpy(&typeSize, mDirectData + pos, sizeof(UINT32));
+					}
+
+					if (typeSize == 0 || !canRead(pos, typeSize))
+						return false;
+
+					pos += typeSize;
+				}
+
+				break;
+			}
+			case SerializableFT_DataBlock:
+			{
+				if (isArray || !canRead(pos, DATA_BLOCK_TYPE_FIELD_SIZE))
+					return false;
+
+				UINT32 dataBlockSize = 0;
+				memcpy(&dataBlockSize, mDirectData + pos, DATA_BLOCK_TYPE_FIELD_SIZE);
+				pos += DATA_BLOCK_TYPE_FIELD_SIZE;
+
+				if (!canRead(pos, dataBlockSize))
+					return false;
+
+				pos += dataBlockSize;
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+
+		if (embedded)
+			return false;
+
+		subObject.fieldsEnd = pos;
+		if (subObjects != nullptr)
+			subObjects->push_back(subObject);
+
+		return true;
+	}
+
+	UINT32 BinarySerializer::decodeDirectEntry(const SPtr<IReflectable>& object, UINT32 pos, bool embedded)
+	{
+		Vector<DirectSubObject> subObjects;
+		scanDirectEntry(pos, embedded, &subObjects);
+
+		// Classes are stored starting with the most derived one, but like in the intermediate path the base class fields
+		// are assigned first
+		for (auto iter = subObjects.rbegin(); iter != subObjects.rend(); ++iter)
+		{
+			RTTITypeBase* rtti = iter->rtti;
+			rtti->onDeserializationStarted(object.get(), mParams);
+
+			UINT32 fieldPos = iter->fieldsStart;
+			while (fieldPos < iter->fieldsEnd)
+			{
+				UINT32 metaData = 0;
+				memcpy(&metaData, mDirectData + fieldPos, META_SIZE);
+				fieldPos += META_SIZE;
+
+				bool isArray;
+				SerializableFieldType fieldType;
+				UINT16 fieldId;
+				UINT8 fieldSize;
+				bool hasDynamicSize;
+				bool terminator;
+				decodeFieldMetaData(metaData, fieldId, fieldSize, isArray, fieldType, hasDynamicSize, terminator);
+
+				RTTIField* curGenericField = rtti->findField(fieldId);
+
+				UINT32 arrayNumElems = 1;
+				if (isArray)
+				{
+					memcpy(&arrayNumElems, mDirectData + fieldPos, NUM_ELEM_FIELD_SIZE);
+					fieldPos += NUM_ELEM_FIELD_SIZE;
+
+					curGenericField->setArraySize(object.get(), arrayNumElems);
+				}
+
+				switch (fieldType)
+				{
+				case SerializableFT_ReflectablePtr:
+				{
+					RTTIReflectablePtrFieldBase* curField = static_cast<RTTIReflectablePtrFieldBase*>(curGenericField);
+					bool weakRef = (curField->getFlags() & RTTI_Flag_WeakRef) != 0;
+
+					for (UINT32 i = 0; i < arrayNumElems; i++)
+					{
+						UINT32 childObjectId = 0;
+						memcpy(&childObjectId, mDirectData + fieldPos, COMPLEX_TYPE_FIELD_SIZE);
+						fieldPos += COMPLEX_TYPE_FIELD_SIZE;
+
+						SPtr<IReflectable> childObject = resolveDirectObject(childObjectId, weakRef);
+						if (isArray)
+							curField->setArrayValue(object.get(), i, childObject);
+						else
+							curField->setValue(object.get(), childObject);
+					}
+
+					break;
+				}
+				case SerializableFT_Reflectable:
+				{
+					RTTIReflectableFieldBase* curField = static_cast<RTTIReflectableFieldBase*>(curGenericField);
+
+					for (UINT32 i = 0; i < arrayNumElems; i++)
+					{
+						ObjectMetaData childMetaData;
+						memcpy(&childMetaData, mDirectData + fieldPos, sizeof(ObjectMetaData));
+
+						UINT32 childId = 0;
+						UINT32 childTypeId = 0;
+						bool childIsBaseClass = false;
+						decodeObjectMetaData(childMetaData, childId, childTypeId, childIsBaseClass);
+
+						SPtr<IReflectable> childObject = IReflectable::_getRTTIfromTypeId(childTypeId)->newRTTIObject();
+						fieldPos = decodeDirectEntry(childObject, fieldPos, true);
+
+						if (isArray)
+							curField->setArrayValue(object.get(), i, *childObject);
+						else
+							curField->setValue(object.get(), *childObject);
+					}
+
+					break;
+				}
+				case SerializableFT_Plain:
+				{
+					RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
+
+					// Values that can be copied as-is are read all at once (array size has already been set above)
+					void* directMemory = nullptr;
+					if (!hasDynamicSize && arrayNumElems > 0)
+						directMemory = curField->getDirectMemory(object.get());
+
+					if (directMemory != nullptr)
+					{
+						UINT32 totalSize = fieldSize * arrayNumElems;
+						memcpy(directMemory, mDirectData + fieldPos, totalSize);
+
+						fieldPos += totalSize;
+						break;
+					}
+
+					for (UINT32 i = 0; i < arrayNumElems; i++)
+					{
+						UINT32 typeSize = fieldSize;
+						if (hasDynamicSize)
+							memcpy(&typeSize, mDirectData + fieldPos, sizeof(UINT32));
+
+						UINT8* fieldData = const_cast<UINT8*>(mDirectData) + fieldPos;
+						if (isArray)
+							curField->arrayElemFromBuffer(object.get(), i, fieldData);
+						else
+							curField->fromBuffer(object.get(), fieldData);
+
+						fieldPos += typeSize;
+					}
+
+					break;
+				}
+				case SerializableFT_DataBlock:
+				{
+					RTTIManagedDataBlockFieldBase* curField = static_cast<RTTIManagedDataBlockFieldBase*>(curGenericField);
+
+					UINT32 dataBlockSize = 0;
+					memcpy(&dataBlockSize, mDirectData + fieldPos, DATA_BLOCK_TYPE_FIELD_SIZE);
+					fieldPos += DATA_BLOCK_TYPE_FIELD_SIZE;
+
+					mDirectStream->seek(mDirectDataStart + fieldPos);
+					curField->setValue(object.get(), mDirectStream, dataBlockSize);
+
+					fieldPos += dataBlockSize;
+					break;
+				}
+				default:
+					break;
+				}
+			}
+		}
+
+		for (auto iter = subObjects.rbegin(); iter != subObjects.rend(); ++iter)
+			iter->rtti->onDeserializationEnded(object.get(), mParams);
+
+		return pos;
+	}
+
+	SPtr<IReflectable> BinarySerializer::resolveDirectObject(UINT32 objectId, bool weakRef)
+	{
+		if (objectId == 0)
+			return nullptr;
+
+		auto iterFind = mDirectObjectIds.find(objectId);
+		if (iterFind == mDirectObjectIds.end())
+			return nullptr;
+
+		DirectObject& entry = mDirectObjects[iterFind->second];
+		if (entry.object == nullptr)
+			entry.object = IReflectable::_getRTTIfromTypeId(entry.typeId)->newRTTIObject();
+
+		if (!weakRef && !entry.isDecoded)
+		{
+			if (entry.decodeInProgress)
+			{
+				LOGWRN("Detected a circular reference when decoding. Referenced object's fields " \
+					"will be resolved in an undefined order (i.e. one of the objects will not " \
+					"be fully deserialized when assigned to its field). Use RTTI_Flag_WeakRef to " \
+					"get rid of this warning and tell the system which of the objects is allowed " \
+					"to be deserialized after it is assigned to its field.");
+			}
+			else
+			{
+				entry.decodeInProgress = true;
+				decodeDirectEntry(entry.object, entry.offset, false);
+				entry.decodeInProgress = false;
+				entry.isDecoded = true;
+			}
+		}
+
+		return entry.object;
+	}
+
 	UINT32 BinarySerializer::encodeFieldMetaData(UINT16 id, UINT8 size, bool array, 
 		SerializableFieldType type, bool hasDynamicSize, bool terminator)
 	{
@@ -69,6 +69,10 @@ namespace bs
 		/**
 		 * Decodes an object from binary data.
 		 *
+		 * If the data is in memory and every encoded type matches its current RTTI layout, objects are decoded directly 
+		 * from the source memory. Otherwise the data is first decoded into an intermediate representation 
+		 * (see _decodeToIntermediate()), which is able to handle added, removed or changed fields.
+		 *
 		 * @param[in]	data  		Binary data to decode.
 		 * @param[in]	dataLength	Length of the data in bytes.
 		 * @param[in]	params		Optional parameters to be passed to the serialization callbacks on the objects being
@@ -140,6 +144,28 @@ namespace bs
 			bool decodeInProgress; // Used for error reporting circular references
 		};
 
+		/** Location of a top-level object in the data being decoded directly. */
+		struct DirectObject
+		{
+			DirectObject(UINT32 offset, UINT32 typeId)
+				:offset(offset), typeId(typeId)
+			{ }
+
+			UINT32 offset;
+			UINT32 typeId;
+			SPtr<IReflectable> object;
+			bool isDecoded = false;
+			bool decodeInProgress = false; // Used for error reporting circular references
+		};
+
+		/** Range of fields belonging to a single class in an object's hierarchy, when decoding directly. */
+		struct DirectSubObject
+		{
+			RTTITypeBase* rtti;
+			UINT32 fieldsStart;
+			UINT32 fieldsEnd;
+		};
+
 		/** Encodes a single IReflectable object. */
 		UINT8* encodeEntry(IReflectable* object, UINT32 objectId, UINT8* buffer, UINT32& bufferLength, UINT32* bytesWritten,
 			std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback, bool shallow);
@@ -151,6 +177,28 @@ namespace bs
 		bool decodeEntry(const SPtr<DataStream>& data, UINT32 dataLength, UINT32& bytesRead, SPtr<SerializedObject>& output, 
 			bool copyData, bool streamDataBlock);
 
+		/**
+		 * Attempts to decode an object directly from the memory of the provided stream, without building an intermediate
+		 * representation. Returns false without modifying any objects if the data doesn't match the current RTTI layout,
+		 * in which case the intermediate path needs to be used instead.
+		 */
+		bool decodeDirect(const SPtr<DataStream>& data, UINT32 dataLength, SPtr<IReflectable>& output);
+
+		/**
+		 * Parses an object starting at @p pos and advances @p pos past it. Returns false if the object doesn't exactly
+		 * match its current RTTI type. Optionally outputs the field range of each class in the object's hierarchy.
+		 */
+		bool scanDirectEntry(UINT32& pos, bool embedded, Vector<DirectSubObject>* subObjects);
+
+		/**
+		 * Decodes the object at @p pos directly into @p object and returns the position following it. Data must have been
+		 * validated by scanDirectEntry().
+		 */
+		UINT32 decodeDirectEntry(const SPtr<IReflectable>& object, UINT32 pos, bool embedded);
+
+		/** Returns the object with the specified ID, decoding it first if required, when decoding directly. */
+		SPtr<IReflectable> resolveDirectObject(UINT32 objectId, bool weakRef);
+
 		/**	Helper method for encoding a complex object and copying its data to a buffer. */
 		UINT8* complexTypeToBuffer(IReflectable* object, UINT8* buffer, UINT32& bufferLength, UINT32* bytesWritten,
 			std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback, bool shallow);
@@ -201,6 +249,13 @@ namespace bs
 		UnorderedMap<SPtr<SerializedObject>, ObjectToDecode> mObjectMap;
 		UnorderedMap<UINT32, SPtr<SerializedObject>> mInterimObjectMap;
 
+		SPtr<DataStream> mDirectStream;
+		const UINT8* mDirectData = nullptr;
+		UINT32 mDirectDataStart = 0;
+		UINT32 mDirectDataLength = 0;
+		Vector<DirectObject> mDirectObjects;
+		UnorderedMap<UINT32, UINT32> mDirectObjectIds;
+
 		UnorderedMap<String, UINT64> mParams;
 
 		static constexpr const int META_SIZE = 4; // Meta field size
@@ -31,9 +31,16 @@ namespace bs
 	template<class T>
 	void StringID::construct(T const& name)
 	{
-		assert(StringIDUtil<T>::size(name) <= STRING_SIZE);
+		construct(name, calcHash(name));
+	}
+
+	template<class T>
+	void StringID::construct(T const& name, UINT32 hash)
+	{
+		// Leave room for the null terminator
+		assert(StringIDUtil<T>::size(name) < STRING_SIZE);
 
-		UINT32 hash = calcHash(name) & (sizeof(mStringHashTable) / sizeof(mStringHashTable[0]) - 1);
+		hash &= (sizeof(mStringHashTable) / sizeof(mStringHashTable[0]) - 1);
 		InternalData* existingEntry = mStringHashTable[hash];
 		
 		while (existingEntry != nullptr)
@@ -135,6 +142,7 @@ namespace bs
 
 	template BS_UTILITY_EXPORT void StringID::construct(const char* const&);
 	template BS_UTILITY_EXPORT void StringID::construct(String const&);
+	template BS_UTILITY_EXPORT void StringID::construct(const char* const&, UINT32);
 	
 	template BS_UTILITY_EXPORT UINT32 StringID::calcHash(const char* const&);
 	template BS_UTILITY_EXPORT UINT32 StringID::calcHash(String const&);
@@ -71,6 +71,15 @@ namespace bs
 			construct((const char*)name);
 		}
 
+		/**
+		 * Constructs a string identifier using a hash pre-calculated by hash(). Use BS_SID to construct identifiers
+		 * from string literals with the hash calculated at compile time.
+		 */
+		StringID(const char* name, UINT32 hash)
+		{
+			construct(name, hash);
+		}
+
 		/**	Compare to string ids for equality. Uses fast integer comparison. */
 		bool operator== (const StringID& rhs) const
 		{
@@ -101,6 +110,19 @@ namespace bs
 		/** Returns the unique identifier of the string. */
 		UINT32 id() const { return mData ? mData->id : -1; }
 
+		/**
+		 * Calculates the hash used for looking up the provided null-terminated string in the global string table. Can
+		 * be evaluated at compile time.
+		 */
+		static constexpr UINT32 hash(const char* name)
+		{
+			UINT32 value = 0;
+			while (*name != '\0')
+				value = value * 101 + (UINT32)*name++;
+
+			return value;
+		}
+
 		static const StringID NONE;
 
 	private:
@@ -108,6 +130,10 @@ namespace bs
 		template<class T>
 		void construct(T const& name);
 
+		/** @copydoc construct(T const&) */
+		template<class T>
+		void construct(T const& name, UINT32 hash);
+
 		/**	Calculates a hash value for the provided null-terminated string. */
 		template<class T>
 		UINT32 calcHash(T const& input);
@@ -196,6 +222,19 @@ namespace bs
 	/** @} */
 }
 
+/** @addtogroup String
+ *  @{
+ */
+
+/**
+ * Constructs a StringID from a string literal. The string hash is calculated at compile time, so only the table lookup
+ * is performed at runtime. For names used in hot code paths prefer storing the resulting StringID in a static variable,
+ * which avoids the lookup entirely.
+ */
+#define BS_SID(name) bs::StringID(name, std::integral_constant<bs::UINT32, bs::StringID::hash(name)>::value)
+
+/** @} */
+
 /** @cond STDLIB */
 /** @addtogroup String
  *  @{
@@ -0,0 +1,62 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Testing/BsBenchmarkOutput.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "ThirdParty/json.hpp"
+
+#include <cstdio>
+
+namespace bs
+{
+	void ConsoleBenchmarkOutput::outputResult(const BenchmarkResult& result)
+	{
+		printf("%-60s median %12.1f ns  mean %12.1f ns  stddev %10.1f ns  min %12.1f ns  allocs/op %.2f\n",
+			result.name.c_str(), result.median, result.mean, result.stdDev, result.min, result.allocsPerOp);
+	}
+
+	JSONBenchmarkOutput::JSONBenchmarkOutput(const Path& path, BenchmarkOutput* forward)
+		:mPath(path), mForward(forward)
+	{ }
+
+	JSONBenchmarkOutput::~JSONBenchmarkOutput()
+	{
+		nlohmann::json benchmarks = nlohmann::json::array();
+		for (auto& result : mResults)
+		{
+			benchmarks.push_back({
+				{ "name", result.name.c_str() },
+				{ "operations", result.numOperations },
+				{ "repetitions", result.numRepetitions },
+				{ "minNs", result.min },
+				{ "maxNs", result.max },
+				{ "meanNs", result.mean },
+				{ "medianNs", result.median },
+				{ "stdDevNs", result.stdDev },
+				{ "allocsPerOp", result.allocsPerOp },
+				{ "freesPerOp", result.freesPerOp }
+			});
+		}
+
+		nlohmann::json root = { { "benchmarks", benchmarks } };
+		std::string jsonString = root.dump(4);
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(mPath);
+		if (stream == nullptr)
+		{
+			printf("Unable to write benchmark results to: %s\n", mPath.toString().c_str());
+			return;
+		}
+
+		stream->write(jsonString.data(), jsonString.size());
+		stream->close();
+	}
+
+	void JSONBenchmarkOutput::outputResult(const BenchmarkResult& result)
+	{
+		mResults.push_back(result);
+
+		if (mForward != nullptr)
+			mForward->outputResult(result);
+	}
+}
@@ -0,0 +1,61 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Testing/BsBenchmarkSuite.h"
+#include "FileSystem/BsPath.h"
+
+namespace bs
+{
+	/** @addtogroup Testing
+	 *  @{
+	 */
+
+	/** Abstract interface used for outputting benchmark results. */
+	class BS_UTILITY_EXPORT BenchmarkOutput
+	{
+	public:
+		virtual ~BenchmarkOutput() {}
+
+		/** Triggered when a benchmark finishes running. */
+		virtual void outputResult(const BenchmarkResult& result) = 0;
+	};
+
+	/** Outputs benchmark results to stdout, one line per benchmark. */
+	class BS_UTILITY_EXPORT ConsoleBenchmarkOutput : public BenchmarkOutput
+	{
+	public:
+		/** @copydoc BenchmarkOutput::outputResult */
+		void outputResult(const BenchmarkResult& result) final override;
+	};
+
+	/**
+	 * Collects benchmark results and saves them as a JSON file, so they can be compared between runs by external tools.
+	 * Optionally forwards the results to another output as they are received.
+	 */
+	class BS_UTILITY_EXPORT JSONBenchmarkOutput : public BenchmarkOutput
+	{
+	public:
+		/**
+		 * Creates a new JSON output.
+		 *
+		 * @param[in]	path	Path to the file to write the results to.
+		 * @param[in]	forward	Optional output to forward the results to.
+		 */
+		JSONBenchmarkOutput(const Path& path, BenchmarkOutput* forward = nullptr);
+
+		/** Saves all the results received so far to the output file. */
+		~JSONBenchmarkOutput();
+
+		/** @copydoc BenchmarkOutput::outputResult */
+		void outputResult(const BenchmarkResult& result) final override;
+
+	private:
+		Path mPath;
+		BenchmarkOutput* mForward;
+		Vector<BenchmarkResult> mResults;
+	};
+
+	/** @} */
+}
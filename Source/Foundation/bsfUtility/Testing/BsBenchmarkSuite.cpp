@@ -0,0 +1,91 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Testing/BsBenchmarkSuite.h"
+#include "Testing/BsBenchmarkOutput.h"
+
+#include <chrono>
+
+namespace bs
+{
+	BenchmarkSuite::BenchmarkEntry::BenchmarkEntry(Func benchmark, const String& name, UINT32 numOperations)
+		:benchmark(benchmark), name(name), numOperations(std::max(numOperations, 1U))
+	{ }
+
+	void BenchmarkSuite::run(BenchmarkOutput& output)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		startUp();
+
+		Vector<double> times(mRepetitionCount);
+		for (auto& entry : mBenchmarks)
+		{
+			for (UINT32 i = 0; i < mWarmupCount; i++)
+				(this->*(entry.benchmark))();
+
+			UINT64 numAllocs = 0;
+			UINT64 numFrees = 0;
+			for (UINT32 i = 0; i < mRepetitionCount; i++)
+			{
+				UINT64 allocsStart = MemoryCounter::getNumAllocs();
+				UINT64 freesStart = MemoryCounter::getNumFrees();
+				Clock::time_point start = Clock::now();
+
+				(this->*(entry.benchmark))();
+
+				Clock::time_point end = Clock::now();
+				numAllocs += MemoryCounter::getNumAllocs() - allocsStart;
+				numFrees += MemoryCounter::getNumFrees() - freesStart;
+
+				times[i] = std::chrono::duration<double, std::nano>(end - start).count() / entry.numOperations;
+			}
+
+			std::sort(times.begin(), times.end());
+
+			double sum = 0.0;
+			for (auto& time : times)
+				sum += time;
+
+			BenchmarkResult result;
+			result.name = entry.name;
+			result.numOperations = entry.numOperations;
+			result.numRepetitions = mRepetitionCount;
+			result.min = times.front();
+			result.max = times.back();
+			result.mean = sum / mRepetitionCount;
+
+			UINT32 middle = mRepetitionCount / 2;
+			if (mRepetitionCount % 2 == 0)
+				result.median = (times[middle - 1] + times[middle]) * 0.5;
+			else
+				result.median = times[middle];
+
+			double variance = 0.0;
+			for (auto& time : times)
+				variance += (time - result.mean) * (time - result.mean);
+
+			result.stdDev = std::sqrt(variance / mRepetitionCount);
+
+			double numOperations = (double)mRepetitionCount * entry.numOperations;
+			result.allocsPerOp = numAllocs / numOperations;
+			result.freesPerOp = numFrees / numOperations;
+
+			output.outputResult(result);
+		}
+
+		for (auto& suite : mSuites)
+			suite->run(output);
+
+		shutDown();
+	}
+
+	void BenchmarkSuite::add(const SPtr<BenchmarkSuite>& suite)
+	{
+		mSuites.push_back(suite);
+	}
+
+	void BenchmarkSuite::addBenchmark(Func benchmark, const String& name, UINT32 numOperations)
+	{
+		mBenchmarks.push_back(BenchmarkEntry(benchmark, name, numOperations));
+	}
+}
@@ -0,0 +1,144 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+#if BS_COMPILER == BS_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+namespace bs
+{
+	class BenchmarkOutput;
+
+	/** @addtogroup Testing
+	 *  @{
+	 */
+
+	/** Results of a single benchmark. All times are in nanoseconds per operation. */
+	struct BenchmarkResult
+	{
+		String name; /**< Name of the benchmark. */
+		UINT32 numOperations = 0; /**< Number of operations performed by a single benchmark call. */
+		UINT32 numRepetitions = 0; /**< Number of timed benchmark calls the statistics were calculated from. */
+
+		double min = 0.0; /**< Time of the fastest repetition. */
+		double max = 0.0; /**< Time of the slowest repetition. */
+		double mean = 0.0; /**< Average time over all repetitions. */
+		double median = 0.0; /**< Median time over all repetitions. */
+		double stdDev = 0.0; /**< Standard deviation of the repetition times. */
+
+		/**
+		 * Number of memory allocations per operation, as reported by MemoryCounter. Only allocations made through the
+		 * framework allocators on the benchmark thread are counted, and only if profiling is enabled.
+		 */
+		double allocsPerOp = 0.0;
+
+		/** Number of memory frees per operation. See allocsPerOp. */
+		double freesPerOp = 0.0;
+	};
+
+	/**
+	 * Primary class for micro-benchmarks. Override and register benchmarks in the constructor, then run them using the
+	 * desired method of output.
+	 *
+	 * Each benchmark is first called a number of times without measuring in order to warm up caches, allocators and
+	 * branch predictors, after which each of the timed repetitions is measured separately. Benchmarks doing very little
+	 * work should perform the operation multiple times per call and report the count when registering, so that timer
+	 * overhead doesn't dominate the results.
+	 */
+	class BS_UTILITY_EXPORT BenchmarkSuite
+	{
+	public:
+		typedef void(BenchmarkSuite::*Func)();
+
+	private:
+		/** Contains data about a single benchmark. */
+		struct BenchmarkEntry
+		{
+			BenchmarkEntry(Func benchmark, const String& name, UINT32 numOperations);
+
+			Func benchmark;
+			String name;
+			UINT32 numOperations;
+		};
+
+	public:
+		virtual ~BenchmarkSuite() = default;
+
+		/** Runs all the benchmarks in the suite (and sub-suites). Results are reported to the provided output class. */
+		void run(BenchmarkOutput& output);
+
+		/** Adds a new child suite to this suite. This method allows you to group suites and execute them all at once. */
+		void add(const SPtr<BenchmarkSuite>& suite);
+
+		/**	Creates a new suite of a particular type. */
+		template <class T>
+		static SPtr<BenchmarkSuite> create()
+		{
+			static_assert((std::is_base_of<BenchmarkSuite, T>::value),
+				"Invalid benchmark suite type. It needs to derive from bs::BenchmarkSuite.");
+
+			return std::static_pointer_cast<BenchmarkSuite>(bs_shared_ptr_new<T>());
+		}
+
+	protected:
+		BenchmarkSuite() = default;
+
+		/** Called right before any benchmarks are ran. */
+		virtual void startUp() {}
+
+		/**	Called after all benchmarks and child suite's benchmarks are ran. */
+		virtual void shutDown() {}
+
+		/**
+		 * Registers a new benchmark.
+		 *
+		 * @param[in]	benchmark		Function to call in order to execute the benchmark.
+		 * @param[in]	name			Name of the benchmark used when reporting the results.
+		 * @param[in]	numOperations	Number of operations a single call to @p benchmark performs. Reported times are
+		 *								divided by this value.
+		 */
+		void addBenchmark(Func benchmark, const String& name, UINT32 numOperations);
+
+		/** Sets the number of calls made to each benchmark before measuring starts. */
+		void setWarmupCount(UINT32 count) { mWarmupCount = count; }
+
+		/** Sets the number of measured calls made to each benchmark. */
+		void setRepetitionCount(UINT32 count) { mRepetitionCount = std::max(count, 1U); }
+
+		/**
+		 * Ensures the compiler doesn't optimize away the calculation of the provided value, for benchmarks whose results
+		 * are otherwise unused.
+		 */
+		template<class T>
+		static void doNotOptimize(const T& value)
+		{
+#if BS_COMPILER == BS_COMPILER_MSVC
+			// Reading through a volatile pointer forces the value to be materialized in memory, and the barrier keeps
+			// the compiler from moving the read out of the measured region
+			const volatile char* data = reinterpret_cast<const volatile char*>(&value);
+			(void)*data;
+			_ReadWriteBarrier();
+#else
+			// Empty assembly that claims to read the value's address and clobber memory, so the value must be computed
+			// and stored before this point
+			asm volatile("" : : "g"(&value) : "memory");
+#endif
+		}
+
+		Vector<BenchmarkEntry> mBenchmarks;
+		Vector<SPtr<BenchmarkSuite>> mSuites;
+		UINT32 mWarmupCount = 3;
+		UINT32 mRepetitionCount = 20;
+	};
+
+/** Registers a new benchmark within an implementation of BenchmarkSuite. */
+#define BS_ADD_BENCHMARK(func) addBenchmark(static_cast<Func>(&func), #func, 1);
+
+/** Registers a new benchmark that performs @p numOps operations per call within an implementation of BenchmarkSuite. */
+#define BS_ADD_BENCHMARK_OPS(func, numOps) addBenchmark(static_cast<Func>(&func), #func, numOps);
+
+	/** @} */
+}
@@ -0,0 +1,149 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Threading-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Fixed capacity lock-free queue that supports multiple producers and multiple consumers. Elements are stored inline
+	 * in a ring buffer allocated on construction, so pushing and popping elements never allocates memory.
+	 *
+	 * @tparam	T			Type of the stored element. Must be move constructible.
+	 * @tparam	Capacity	Maximum number of elements the queue can hold. Must be a power of two.
+	 *
+	 * @note	Thread safe.
+	 */
+	template<class T, UINT32 Capacity = 1024>
+	class LockFreeQueue
+	{
+		static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+		static constexpr UINT32 MASK = Capacity - 1;
+
+		/** Single slot in the ring buffer. Sequence determines if the slot is ready to be written to, or read from. */
+		struct Cell
+		{
+			std::atomic<UINT32> sequence;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type data;
+		};
+
+	public:
+		LockFreeQueue()
+		{
+			mCells = bs_newN<Cell>(Capacity);
+
+			for(UINT32 i = 0; i < Capacity; i++)
+				mCells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		~LockFreeQueue()
+		{
+			UINT32 end = mEnqueuePos.load(std::memory_order_relaxed);
+			for(UINT32 pos = mDequeuePos.load(std::memory_order_relaxed); pos != end; pos++)
+				reinterpret_cast<T*>(&mCells[pos & MASK].data)->~T();
+
+			bs_deleteN(mCells, Capacity);
+		}
+
+		LockFreeQueue(const LockFreeQueue&) = delete;
+		LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+		/** Moves a new element to the end of the queue. Returns false if the queue is full. */
+		bool push(T&& value)
+		{
+			Cell* cell;
+			UINT32 pos = mEnqueuePos.load(std::memory_order_relaxed);
+			while(true)
+			{
+				cell = &mCells[pos & MASK];
+
+				UINT32 sequence = cell->sequence.load(std::memory_order_acquire);
+				INT32 diff = (INT32)(sequence - pos);
+
+				if(diff == 0)
+				{
+					if(mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if(diff < 0)
+					return false; // Full
+				else
+					pos = mEnqueuePos.load(std::memory_order_relaxed);
+			}
+
+			new (&cell->data) T(std::move(value));
+			cell->sequence.store(pos + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		/** Removes an element from the start of the queue and moves it to @p value. Returns false if the queue is empty. */
+		bool pop(T& value)
+		{
+			return popWith([&value](T&& element) { value = std::move(element); });
+		}
+
+		/** 
+		 * Removes an element from the start of the queue and passes it to the provided callback. Useful when the element
+		 * should be moved directly to its destination, or when T is not default constructible. Returns false if the queue
+		 * is empty.
+		 */
+		template<class Func>
+		bool popWith(Func func)
+		{
+			Cell* cell;
+			UINT32 pos = mDequeuePos.load(std::memory_order_relaxed);
+			while(true)
+			{
+				cell = &mCells[pos & MASK];
+
+				UINT32 sequence = cell->sequence.load(std::memory_order_acquire);
+				INT32 diff = (INT32)(sequence - (pos + 1));
+
+				if(diff == 0)
+				{
+					if(mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if(diff < 0)
+					return false; // Empty
+				else
+					pos = mDequeuePos.load(std::memory_order_relaxed);
+			}
+
+			T* storedValue = reinterpret_cast<T*>(&cell->data);
+			func(std::move(*storedValue));
+			storedValue->~T();
+
+			cell->sequence.store(pos + Capacity, std::memory_order_release);
+			return true;
+		}
+
+		/** Returns true if the queue has no elements. Result may be out of date if other threads use the queue. */
+		bool isEmpty() const
+		{
+			UINT32 pos = mDequeuePos.load(std::memory_order_relaxed);
+			UINT32 sequence = mCells[pos & MASK].sequence.load(std::memory_order_acquire);
+
+			return (INT32)(sequence - (pos + 1)) < 0;
+		}
+
+	private:
+		Cell* mCells;
+		std::atomic<UINT32> mEnqueuePos{0};
+		char mPadding[64 - sizeof(std::atomic<UINT32>)]; // Keep producer and consumer positions on separate cache lines
+		std::atomic<UINT32> mDequeuePos{0};
+	};
+
+	/** @} */
+	/** @} */
+}
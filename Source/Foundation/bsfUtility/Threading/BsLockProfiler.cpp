@@ -0,0 +1,91 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Threading/BsLockProfiler.h"
+
+namespace bs
+{
+	/** Returns a list of counters for all named locks. List is used as counters must never move once created. */
+	static List<LockCounters>& getLockCounters()
+	{
+		static List<LockCounters> counters;
+		return counters;
+	}
+
+	/** Returns the mutex protecting the list returned by getLockCounters(). */
+	static Mutex& getLockCountersMutex()
+	{
+		static Mutex mutex;
+		return mutex;
+	}
+
+	LockProfilerReport LockProfiler::generateReport()
+	{
+		LockProfilerReport report;
+
+		Lock lock(getLockCountersMutex());
+		for(auto& counters : getLockCounters())
+		{
+			const UINT64 numAcquisitions = counters.numAcquisitions.load(std::memory_order_relaxed);
+			const UINT64 numContentions = counters.numContentions.load(std::memory_order_relaxed);
+			const UINT64 waitTimeNs = counters.waitTimeNs.load(std::memory_order_relaxed);
+			const UINT64 maxWaitTimeNs = counters.maxWaitTimeNs.exchange(0, std::memory_order_relaxed);
+
+			if(numAcquisitions != counters.lastNumAcquisitions)
+			{
+				LockContentionReport entry;
+				entry.name = counters.name;
+				entry.numAcquisitions = numAcquisitions - counters.lastNumAcquisitions;
+				entry.numContentions = numContentions - counters.lastNumContentions;
+				entry.waitTimeUs = (waitTimeNs - counters.lastWaitTimeNs) / 1000;
+				entry.maxWaitTimeUs = maxWaitTimeNs / 1000;
+
+				report.locks.push_back(entry);
+			}
+
+			counters.lastNumAcquisitions = numAcquisitions;
+			counters.lastNumContentions = numContentions;
+			counters.lastWaitTimeNs = waitTimeNs;
+		}
+
+		std::sort(report.locks.begin(), report.locks.end(),
+			[](const LockContentionReport& a, const LockContentionReport& b)
+		{
+			if(a.waitTimeUs != b.waitTimeUs)
+				return a.waitTimeUs > b.waitTimeUs;
+
+			return a.numContentions > b.numContentions;
+		});
+
+		return report;
+	}
+
+	LockCounters* LockProfiler::_registerLock(const char* name)
+	{
+		Lock lock(getLockCountersMutex());
+
+		List<LockCounters>& counters = getLockCounters();
+		for(auto& entry : counters)
+		{
+			if(strcmp(entry.name, name) == 0)
+				return &entry;
+		}
+
+		counters.emplace_back();
+		counters.back().name = name;
+
+		return &counters.back();
+	}
+
+	void LockProfiler::_registerContention(LockCounters* counters, UINT64 waitTimeNs)
+	{
+		counters->numContentions.fetch_add(1, std::memory_order_relaxed);
+		counters->waitTimeNs.fetch_add(waitTimeNs, std::memory_order_relaxed);
+
+		UINT64 maxWaitTimeNs = counters->maxWaitTimeNs.load(std::memory_order_relaxed);
+		while(waitTimeNs > maxWaitTimeNs)
+		{
+			if(counters->maxWaitTimeNs.compare_exchange_weak(maxWaitTimeNs, waitTimeNs, std::memory_order_relaxed))
+				break;
+		}
+	}
+}
@@ -0,0 +1,174 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
+	/** Contention statistics for a single named lock, over a single frame. */
+	struct LockContentionReport
+	{
+		String name;
+		UINT64 numAcquisitions = 0; /**< Number of times the lock was acquired during the frame. */
+		UINT64 numContentions = 0; /**< Number of acquisitions that had to wait for another thread to release the lock. */
+		UINT64 waitTimeUs = 0; /**< Total time spent waiting for the lock during the frame, over all threads. */
+		UINT64 maxWaitTimeUs = 0; /**< Longest single wait for the lock during the frame. */
+	};
+
+	/** Contention statistics for all named locks acquired during a single frame. */
+	struct LockProfilerReport
+	{
+		/** Locks acquired during the frame, sorted by the total wait time, most contended first. */
+		Vector<LockContentionReport> locks;
+	};
+
+	/** @} */
+
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Threading-Internal
+	 *  @{
+	 */
+
+	/** Running totals for a single named lock, shared by all lock instances using the same name. */
+	struct LockCounters
+	{
+		const char* name = nullptr;
+		std::atomic<UINT64> numAcquisitions{0};
+		std::atomic<UINT64> numContentions{0};
+		std::atomic<UINT64> waitTimeNs{0};
+		std::atomic<UINT64> maxWaitTimeNs{0};
+
+		// Values at the time of the last generated report. Only accessed during report generation.
+		UINT64 lastNumAcquisitions = 0;
+		UINT64 lastNumContentions = 0;
+		UINT64 lastWaitTimeNs = 0;
+	};
+
+	/** @} */
+	/** @} */
+
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of acquisition counts and wait times of locks wrapped in TProfiledMutex, per lock name.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT LockProfiler
+	{
+	public:
+		/**
+		 * Generates a report containing the contention statistics of all named locks since the last call. Normally
+		 * called once per frame by the profiling manager.
+		 */
+		static LockProfilerReport generateReport();
+
+		/**
+		 * Returns the counters for the lock with the specified name, creating them on first use. Returned counters remain
+		 * valid for the lifetime of the application. @p name must remain valid for the lifetime of the application.
+		 */
+		static LockCounters* _registerLock(const char* name);
+
+		/** Registers that an acquisition of the lock with the provided counters had to wait for @p waitTimeNs. */
+		static void _registerContention(LockCounters* counters, UINT64 waitTimeNs);
+	};
+
+	/**
+	 * Wraps a lockable type (Mutex, RecursiveMutex or SpinLock) and records the number of acquisitions and the time
+	 * spent waiting on it in LockProfiler, under the provided name. All locks constructed with the same name are reported
+	 * together. Uncontended acquisitions only pay for an extra atomic increment. When profiling is disabled this behaves
+	 * exactly like the wrapped type.
+	 *
+	 * Use ProfiledLock, ProfiledRecursiveLock or ScopedProfiledSpinLock to lock the wrapped types. Note that
+	 * std::condition_variable (Signal) only accepts a Lock, so mutexes that are waited on cannot be profiled.
+	 */
+	template<class T>
+	class TProfiledMutex
+	{
+	public:
+		/** @param[in]	name	Name to report the lock under. Must be a string literal, or otherwise outlive the lock. */
+		explicit TProfiledMutex(const char* name)
+#if BS_PROFILING_ENABLED
+			:mCounters(LockProfiler::_registerLock(name))
+#endif
+		{ }
+
+		TProfiledMutex(const TProfiledMutex&) = delete;
+		TProfiledMutex& operator=(const TProfiledMutex&) = delete;
+
+		/** Acquires the lock, blocking until it becomes available. */
+		void lock()
+		{
+#if BS_PROFILING_ENABLED
+			if(!mLockable.try_lock())
+			{
+				const auto start = std::chrono::steady_clock::now();
+				mLockable.lock();
+				const auto elapsed = std::chrono::steady_clock::now() - start;
+
+				LockProfiler::_registerContention(mCounters,
+					(UINT64)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+			}
+
+			mCounters->numAcquisitions.fetch_add(1, std::memory_order_relaxed);
+#else
+			mLockable.lock();
+#endif
+		}
+
+		/** Attempts to acquire the lock without blocking. Returns true if the lock was acquired. */
+		bool try_lock()
+		{
+			if(!mLockable.try_lock())
+				return false;
+
+#if BS_PROFILING_ENABLED
+			mCounters->numAcquisitions.fetch_add(1, std::memory_order_relaxed);
+#endif
+			return true;
+		}
+
+		/** Releases the lock. */
+		void unlock()
+		{
+			mLockable.unlock();
+		}
+
+	private:
+		T mLockable;
+
+#if BS_PROFILING_ENABLED
+		LockCounters* mCounters;
+#endif
+	};
+
+	/** Mutex that reports its contention to the LockProfiler. */
+	using ProfiledMutex = TProfiledMutex<Mutex>;
+
+	/** RecursiveMutex that reports its contention to the LockProfiler. */
+	using ProfiledRecursiveMutex = TProfiledMutex<RecursiveMutex>;
+
+	/** SpinLock that reports its contention to the LockProfiler. */
+	using ProfiledSpinLock = TProfiledMutex<SpinLock>;
+
+	/** Equivalent of Lock, for ProfiledMutex. */
+	using ProfiledLock = std::unique_lock<ProfiledMutex>;
+
+	/** Equivalent of RecursiveLock, for ProfiledRecursiveMutex. */
+	using ProfiledRecursiveLock = std::unique_lock<ProfiledRecursiveMutex>;
+
+	/** Equivalent of ScopedSpinLock, for ProfiledSpinLock. */
+	using ScopedProfiledSpinLock = std::lock_guard<ProfiledSpinLock>;
+
+	/** @} */
+}
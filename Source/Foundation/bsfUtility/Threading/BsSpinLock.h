@@ -32,6 +32,12 @@ namespace bs
 			{ }
 		}
 
+		/** Attempts to lock the spin lock without waiting. Returns true if the lock was acquired. */
+		bool try_lock()
+		{
+			return !mLock.test_and_set(std::memory_order_acquire);
+		}
+
 		/**	Release the lock and allow other threads to acquire the lock. */
 		void unlock()
 		{
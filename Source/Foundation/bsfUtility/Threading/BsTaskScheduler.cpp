@@ -2,14 +2,20 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Threading/BsTaskScheduler.h"
 #include "Threading/BsThreadPool.h"
+#include "Math/BsMath.h"
+#include "Debug/BsSamplingProfiler.h"
 
 namespace bs
 {
+	/** Worker the current thread belongs to, if the thread is a work stealing TaskScheduler worker. */
+	static BS_THREADLOCAL TaskWorker* sCurrentWorker = nullptr;
+
 	Task::Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker,
 		TaskPriority priority, SPtr<Task> dependency)
-		: mName(name), mPriority(priority), mTaskWorker(std::move(taskWorker)), mTaskDependency(std::move(dependency))
+		: mName(name), mPriority(priority), mTaskWorker(std::move(taskWorker))
 	{
-
+		if(dependency != nullptr)
+			mTaskDependencies.push_back(std::move(dependency));
 	}
 
 	SPtr<Task> Task::create(const String& name, std::function<void()> taskWorker, TaskPriority priority, 
@@ -39,16 +45,77 @@ namespace bs
 		mState = 3;
 	}
 
-	TaskScheduler::TaskScheduler()
-		:mTaskQueue(&TaskScheduler::taskCompare)
+	void Task::addDependency(SPtr<Task> dependency)
+	{
+		assert(mParent == nullptr && "Dependencies must be added before the task is queued.");
+
+		if(dependency != nullptr)
+			mTaskDependencies.push_back(std::move(dependency));
+	}
+
+	TaskScheduler::TaskScheduler(TaskSchedulerMode mode, UINT32 numWorkers)
+		:mMode(mode), mTaskQueue(&TaskScheduler::taskCompare)
 	{
-		mMaxActiveTasks = BS_THREAD_HARDWARE_CONCURRENCY;
+		mMaxActiveTasks = numWorkers != 0 ? numWorkers : BS_THREAD_HARDWARE_CONCURRENCY;
+
+		if(mMode == TaskSchedulerMode::WorkStealing)
+		{
+			numWorkers = std::max(1U, mMaxActiveTasks.load());
+			for(UINT32 i = 0; i < numWorkers; i++)
+			{
+				TaskWorker* worker = bs_new<TaskWorker>();
+				worker->owner = this;
+				worker->index = i;
+
+				mWorkers.push_back(worker);
+			}
 
-		mTaskSchedulerThread = ThreadPool::instance().run("TaskScheduler", std::bind(&TaskScheduler::runMain, this));
+			// Start the threads only once all workers exist, as they will access each other's queues
+			for(auto& worker : mWorkers)
+				worker->thread = ThreadPool::instance().run("TaskWorker", std::bind(&TaskScheduler::runWorker, this, worker));
+		}
+		else
+			mTaskSchedulerThread = ThreadPool::instance().run("TaskScheduler", std::bind(&TaskScheduler::runMain, this));
 	}
 
 	TaskScheduler::~TaskScheduler()
 	{
+		if(mMode == TaskSchedulerMode::WorkStealing)
+		{
+			// Execute any remaining tasks on this thread, then shut down the workers. Repeat after the workers exit in case
+			// the tasks they were running queued new ones.
+			for(UINT32 i = 0; i < 2; i++)
+			{
+				while(mNumQueuedTasks.load() > 0)
+				{
+					Task* task = findTask(nullptr);
+					if(task)
+						executeTask(task);
+					else
+						std::this_thread::yield();
+				}
+
+				if(i == 0)
+				{
+					{
+						Lock lock(mReadyMutex);
+						mShutdown = true;
+					}
+
+					mTaskReadyCond.notify_all();
+
+					for(auto& worker : mWorkers)
+						worker->thread.blockUntilComplete();
+				}
+			}
+
+			for(auto& worker : mWorkers)
+				bs_delete(worker);
+
+			mWorkers.clear();
+			return;
+		}
+
 		// Wait until all tasks complete
 		{
 			Lock activeTaskLock(mReadyMutex);
@@ -77,6 +144,40 @@ namespace bs
 
 	void TaskScheduler::addTask(SPtr<Task> task)
 	{
+		if(mMode == TaskSchedulerMode::WorkStealing)
+		{
+			assert(task->mState != 1 && "Task is already executing, it cannot be executed again until it finishes.");
+
+			task->mParent = this;
+			task->mState.store(0); // Reset state in case the task is getting re-queued
+
+			Task* rawTask = task.get();
+			rawTask->mSelfReference = std::move(task);
+
+			// Register as a continuation of each unfinished dependency, so the last one to complete queues this task. The
+			// extra count ensures the task doesn't get queued before all dependencies have been registered.
+			rawTask->mNumPendingDependencies = (UINT32)rawTask->mTaskDependencies.size() + 1;
+			for(auto& dependency : rawTask->mTaskDependencies)
+			{
+				{
+					ScopedSpinLock lock(dependency->mContinuationLock);
+
+					if(!dependency->isComplete())
+					{
+						dependency->mContinuations.push_back(rawTask);
+						continue;
+					}
+				}
+
+				rawTask->mNumPendingDependencies--;
+			}
+
+			if(rawTask->mNumPendingDependencies.fetch_sub(1) == 1)
+				enqueueTask(rawTask);
+
+			return;
+		}
+
 		Lock lock(mReadyMutex);
 
 		assert(task->mState != 1 && "Task is already executing, it cannot be executed again until it finishes.");
@@ -98,8 +199,11 @@ namespace bs
 
 		mMaxActiveTasks++;
 
-		// A spot freed up, queue new tasks on main scheduler thread if they exist
-		mTaskReadyCond.notify_one();
+		// A spot freed up, queue new tasks on main scheduler thread if they exist (or wake up a parked worker)
+		if(mMode == TaskSchedulerMode::WorkStealing)
+			mTaskReadyCond.notify_all();
+		else
+			mTaskReadyCond.notify_one();
 	}
 
 	void TaskScheduler::removeWorker()
@@ -137,7 +241,17 @@ namespace bs
 					continue;
 				}
 
-				if(curTask->mTaskDependency != nullptr && !curTask->mTaskDependency->isComplete())
+				bool dependenciesComplete = true;
+				for(auto& dependency : curTask->mTaskDependencies)
+				{
+					if(!dependency->isComplete())
+					{
+						dependenciesComplete = false;
+						break;
+					}
+				}
+
+				if(!dependenciesComplete)
 				{
 					++iter;
 					continue;
@@ -186,6 +300,12 @@ namespace bs
 		if(task->isCanceled())
 			return;
 
+		if(mMode == TaskSchedulerMode::WorkStealing)
+		{
+			helpUntilComplete(task);
+			return;
+		}
+
 		{
 			Lock lock(mCompleteMutex);
 
@@ -198,6 +318,53 @@ namespace bs
 		}
 	}
 
+	void TaskScheduler::parallelFor(UINT32 begin, UINT32 end, UINT32 grainSize, 
+		const std::function<void(UINT32, UINT32)>& func, TaskPriority priority)
+	{
+		if(end <= begin)
+			return;
+
+		grainSize = std::max(1U, grainSize);
+
+		UINT32 numChunks = Math::divideAndRoundUp(end - begin, grainSize);
+		if(numChunks == 1)
+		{
+			func(begin, end);
+			return;
+		}
+
+		std::atomic<UINT32> nextChunk{0};
+		auto runChunks = [&]()
+		{
+			while(true)
+			{
+				UINT32 chunk = nextChunk.fetch_add(1);
+				if(chunk >= numChunks)
+					break;
+
+				UINT32 chunkBegin = begin + chunk * grainSize;
+				UINT32 chunkEnd = std::min(end, chunkBegin + grainSize);
+
+				func(chunkBegin, chunkEnd);
+			}
+		};
+
+		// The calling thread is a worker as well, so queue one less task
+		UINT32 numTasks = std::min(numChunks, std::max(1U, mMaxActiveTasks.load())) - 1;
+
+		Vector<SPtr<Task>> tasks(numTasks);
+		for(UINT32 i = 0; i < numTasks; i++)
+		{
+			tasks[i] = Task::create("ParallelFor", runChunks, priority);
+			addTask(tasks[i]);
+		}
+
+		runChunks();
+
+		for(auto& task : tasks)
+			task->wait();
+	}
+
 	bool TaskScheduler::taskCompare(const SPtr<Task>& lhs, const SPtr<Task>& rhs)
 	{
 		// If one tasks priority is higher, that one goes first
@@ -207,4 +374,184 @@ namespace bs
 		// Otherwise we go by smaller id, as that task was queued earlier than the other
 		return lhs->mTaskId < rhs->mTaskId;
 	}
+
+	UINT32 TaskScheduler::getPriorityIdx(TaskPriority priority)
+	{
+		INT32 idx = (INT32)priority - (INT32)TaskPriority::VeryLow;
+		return (UINT32)Math::clamp(idx, 0, (INT32)TaskWorker::NUM_PRIORITIES - 1);
+	}
+
+	void TaskScheduler::runWorker(TaskWorker* worker)
+	{
+		sCurrentWorker = worker;
+		SamplingProfiler::registerThread("TaskWorker " + toString(worker->index));
+
+		while(!mShutdown)
+		{
+			// Workers over the active limit stay parked, but their queues can still be stolen from
+			if(worker->index < mMaxActiveTasks)
+			{
+				Task* task = findTask(worker);
+				if(task)
+				{
+					executeTask(task);
+					continue;
+				}
+			}
+
+			// Nothing to do, sleep until new tasks get queued. The sleeping counter must be incremented before checking 
+			// the queued task count, so enqueueTask() is guaranteed to see it if it missed our check.
+			mNumSleepingWorkers++;
+			{
+				Lock lock(mReadyMutex);
+
+				while(!mShutdown && (mNumQueuedTasks.load() <= 0 || worker->index >= mMaxActiveTasks))
+					mTaskReadyCond.wait(lock);
+			}
+			mNumSleepingWorkers--;
+		}
+
+		SamplingProfiler::unregisterThread();
+		sCurrentWorker = nullptr;
+	}
+
+	void TaskScheduler::enqueueTask(Task* task)
+	{
+		UINT32 priorityIdx = getPriorityIdx(task->mPriority);
+
+		// Tasks queued from worker threads go to their local queue. If not on a worker, or the local queue is full, 
+		// fall back to the global queue.
+		TaskWorker* worker = sCurrentWorker;
+		if(worker == nullptr || worker->owner != this || !worker->queues[priorityIdx].push(task))
+		{
+			ScopedProfiledSpinLock lock(mGlobalQueueLock);
+			mGlobalQueues[priorityIdx].push_back(task);
+		}
+
+		mNumQueuedTasks++;
+
+		if(mNumSleepingWorkers.load() > 0)
+		{
+			Lock lock(mReadyMutex);
+			mTaskReadyCond.notify_one();
+		}
+
+		// Threads blocked in wait() will pick up queued tasks themselves
+		if(mNumWaiters.load() > 0)
+		{
+			Lock lock(mCompleteMutex);
+			mTaskCompleteCond.notify_all();
+		}
+	}
+
+	Task* TaskScheduler::findTask(TaskWorker* worker)
+	{
+		if(mNumQueuedTasks.load() <= 0)
+			return nullptr;
+
+		UINT32 numWorkers = (UINT32)mWorkers.size();
+		for(INT32 i = TaskWorker::NUM_PRIORITIES - 1; i >= 0; i--)
+		{
+			Task* task = nullptr;
+			if(worker)
+				task = worker->queues[i].pop();
+
+			if(!task)
+			{
+				ScopedProfiledSpinLock lock(mGlobalQueueLock);
+				if(!mGlobalQueues[i].empty())
+				{
+					task = mGlobalQueues[i].front();
+					mGlobalQueues[i].pop_front();
+				}
+			}
+
+			if(!task)
+			{
+				// Start with the next worker in line so that thieves spread out over different victims
+				UINT32 start = worker ? worker->index + 1 : 0;
+				for(UINT32 j = 0; j < numWorkers && !task; j++)
+				{
+					TaskWorker* victim = mWorkers[(start + j) % numWorkers];
+					if(victim != worker)
+						task = victim->queues[i].steal();
+				}
+			}
+
+			if(task)
+			{
+				mNumQueuedTasks--;
+				return task;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void TaskScheduler::executeTask(Task* rawTask)
+	{
+		// Take over the reference held by the queue
+		SPtr<Task> task = std::move(rawTask->mSelfReference);
+
+		if(!task->isCanceled())
+		{
+			task->mState.store(1);
+			task->mTaskWorker();
+		}
+
+		Vector<Task*> continuations;
+		{
+			ScopedSpinLock lock(task->mContinuationLock);
+
+			if(!task->isCanceled())
+				task->mState.store(2);
+
+			std::swap(continuations, task->mContinuations);
+		}
+
+		// Canceled tasks never complete, so the tasks that depend on them get canceled as well. They are still queued so
+		// they can release their references and propagate the cancellation further.
+		bool canceled = task->isCanceled();
+		for(auto& continuation : continuations)
+		{
+			if(canceled)
+				continuation->cancel();
+
+			if(continuation->mNumPendingDependencies.fetch_sub(1) == 1)
+				enqueueTask(continuation);
+		}
+
+		if(mNumWaiters.load() > 0)
+		{
+			Lock lock(mCompleteMutex);
+			mTaskCompleteCond.notify_all();
+		}
+	}
+
+	void TaskScheduler::helpUntilComplete(const Task* task)
+	{
+		TaskWorker* worker = sCurrentWorker;
+		if(worker != nullptr && worker->owner != this)
+			worker = nullptr;
+
+		while(!task->isComplete() && !task->isCanceled())
+		{
+			Task* otherTask = findTask(worker);
+			if(otherTask)
+			{
+				executeTask(otherTask);
+				continue;
+			}
+
+			// Nothing to execute, sleep until some task completes or a new one is queued
+			mNumWaiters++;
+			{
+				Lock lock(mCompleteMutex);
+
+				while(!task->isComplete() && !task->isCanceled() && mNumQueuedTasks.load() <= 0)
+					mTaskCompleteCond.wait(lock);
+			}
+			mNumWaiters--;
+		}
+	}
 }
@@ -5,6 +5,8 @@
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Utility/BsModule.h"
 #include "Threading/BsThreadPool.h"
+#include "Threading/BsWorkStealingQueue.h"
+#include "Threading/BsLockProfiler.h"
 
 namespace bs
 {
@@ -23,6 +25,23 @@ namespace bs
 		VeryHigh = 102
 	};
 
+	/** Determines how does the TaskScheduler distribute tasks between worker threads. */
+	enum class TaskSchedulerMode
+	{
+		/** 
+		 * All tasks are placed in a single global queue, from which a dispatcher thread hands them out to threads from
+		 * the ThreadPool. Tasks on the same priority are guaranteed to start in the order they were queued.
+		 */
+		GlobalQueue,
+		/**
+		 * Each worker thread is persistent and owns a lock-free queue. Tasks queued from a worker thread are placed in its
+		 * own queue, while idle workers steal tasks from other queues. Tasks with higher priority still start before 
+		 * lower priority ones, but the order within the same priority is not guaranteed. Preferred for large numbers of
+		 * small tasks.
+		 */
+		WorkStealing
+	};
+
 	/**
 	 * Represents a single task that may be queued in the TaskScheduler.
 	 *
@@ -48,6 +67,25 @@ namespace bs
 		static SPtr<Task> create(const String& name, std::function<void()> taskWorker, 
 			TaskPriority priority = TaskPriority::Normal, SPtr<Task> dependency = nullptr);
 
+		/**
+		 * Creates a new task, allocating it (along with its reference count) using the provided allocator. Useful for
+		 * systems that create large numbers of short lived tasks and want to allocate them from a pool.
+		 *
+		 * @param[in]	alloc		Allocator compatible with std::allocate_shared.
+		 * @param[in]	name		Name you can use to more easily identify the task.
+		 * @param[in]	taskWorker	Worker method that does all of the work in the task.
+		 * @param[in]	priority  	(optional) Higher priority means the tasks will be executed sooner.
+		 * @param[in]	dependency	(optional) Task dependency if one exists. If provided the task will
+		 * 							not be executed until its dependency is complete.
+		 */
+		template<class Alloc>
+		static SPtr<Task> create(const Alloc& alloc, const String& name, std::function<void()> taskWorker,
+			TaskPriority priority = TaskPriority::Normal, SPtr<Task> dependency = nullptr)
+		{
+			return std::allocate_shared<Task>(alloc, PrivatelyConstruct(), name, std::move(taskWorker), priority,
+				std::move(dependency));
+		}
+
 		/** Returns true if the task has completed. */
 		bool isComplete() const;
 
@@ -57,13 +95,21 @@ namespace bs
 		/**
 		 * Blocks the current thread until the task has completed.
 		 *
-		 * @note	While waiting adds a new worker thread, so that the blocking threads core can be utilized.
+		 * @note	
+		 * While waiting adds a new worker thread, so that the blocking threads core can be utilized. If the scheduler is
+		 * running in TaskSchedulerMode::WorkStealing mode, the waiting thread executes queued tasks itself instead.
 		 */
 		void wait();
 
 		/** Cancels the task and removes it from the TaskSchedulers queue. */
 		void cancel();
 
+		/**
+		 * Adds a task that must complete before this task can start. Tasks may have any number of dependencies, forming
+		 * a task graph. Must be called before the task is queued in the TaskScheduler.
+		 */
+		void addDependency(SPtr<Task> dependency);
+
 	private:
 		friend class TaskScheduler;
 
@@ -71,12 +117,46 @@ namespace bs
 		TaskPriority mPriority;
 		UINT32 mTaskId = 0;
 		std::function<void()> mTaskWorker;
-		SPtr<Task> mTaskDependency;
+		Vector<SPtr<Task>> mTaskDependencies;
 		std::atomic<UINT32> mState{0}; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
 
 		TaskScheduler* mParent = nullptr;
+
+		// Only used in TaskSchedulerMode::WorkStealing mode
+		SPtr<Task> mSelfReference; /**< Keeps the task alive while it is referenced from the lock-free queues. */
+		Vector<Task*> mContinuations; /**< Tasks waiting on this task to complete before they can be queued. */
+		SpinLock mContinuationLock;
+		std::atomic<UINT32> mNumPendingDependencies{0};
+	};
+
+	/** @} */
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Threading-Internal
+	 *  @{
+	 */
+
+	/** Persistent worker thread and its local task queues, used in TaskSchedulerMode::WorkStealing mode. */
+	struct TaskWorker
+	{
+		/** Number of different TaskPriority values. */
+		static constexpr UINT32 NUM_PRIORITIES = 5;
+
+		TaskScheduler* owner = nullptr;
+		UINT32 index = 0;
+		HThread thread;
+		WorkStealingQueue<Task> queues[NUM_PRIORITIES];
 	};
 
+	/** @} */
+	/** @} */
+
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
 	/**
 	 * Represents a task scheduler running on multiple threads. You may queue tasks on it from any thread and they will be
 	 * executed in user specified order on any available thread.
@@ -84,17 +164,29 @@ namespace bs
 	 * @note
 	 * Thread safe.
 	 * @note
-	 * This type of task scheduler uses a global queue and is best used for coarse granularity of tasks. (Number of tasks
-	 * in the order of hundreds. Higher number of tasks might require different queuing and locking mechanism, potentially
-	 * at the cost of flexibility.)
+	 * By default the task scheduler uses a global queue and is best used for coarse granularity of tasks. (Number of tasks
+	 * in the order of hundreds.) For higher number of tasks use TaskSchedulerMode::WorkStealing, at the cost of losing
+	 * strict ordering of tasks with the same priority.
 	 * @note
-	 * By default the task scheduler will create as many threads as there are physical CPU cores. You may add or remove
-	 * threads using addWorker()/removeWorker() methods.
+	 * By default the task scheduler will create as many threads as there are logical CPU processors. You may add or
+	 * remove threads using addWorker()/removeWorker() methods.
+	 * @note
+	 * Worker threads are started with the ThreadPool configuration registered for the "TaskWorker" name, and tasks in
+	 * TaskSchedulerMode::GlobalQueue mode with the configuration registered for their task name (see
+	 * ThreadPool::setThreadConfig()).
 	 */
 	class BS_UTILITY_EXPORT TaskScheduler : public Module<TaskScheduler>
 	{
 	public:
-		TaskScheduler();
+		/**
+		 * Constructs a new task scheduler.
+		 *
+		 * @param[in]	mode		Determines how are the tasks distributed among worker threads.
+		 * @param[in]	numWorkers	Number of worker threads to create. If zero, one worker is created per logical
+		 *							processor. Pass ThreadPool::getNumPhysicalCores() to avoid running multiple
+		 *							workers on the same physical core when SMT is enabled.
+		 */
+		TaskScheduler(TaskSchedulerMode mode = TaskSchedulerMode::GlobalQueue, UINT32 numWorkers = 0);
 		~TaskScheduler();
 
 		/** Queues a new task. */
@@ -106,8 +198,30 @@ namespace bs
 		/**	Removes a worker thread (as soon as its current task is finished). */
 		void removeWorker();
 
+		/**
+		 * Splits the range [@p begin, @p end) into chunks and executes them in parallel, blocking until all of them
+		 * complete. The calling thread participates in executing the chunks. 
+		 *
+		 * @param[in]	begin		First index in the range.
+		 * @param[in]	end			One past the last index in the range.
+		 * @param[in]	grainSize	Minimum number of indices in a single chunk. Larger values reduce scheduling overhead,
+		 *							while smaller values improve load balancing.
+		 * @param[in]	func		Function to execute for each chunk. Receives the start and one past the end index of
+		 *							the chunk. Must be safe to call from multiple threads at once.
+		 * @param[in]	priority	Priority of the tasks executing the chunks.
+		 *
+		 * @note	
+		 * At most one task per worker thread is queued, and the tasks pull chunks from a shared counter until the range
+		 * is exhausted, so the cores are never oversubscribed regardless of the range size.
+		 */
+		void parallelFor(UINT32 begin, UINT32 end, UINT32 grainSize, const std::function<void(UINT32, UINT32)>& func,
+			TaskPriority priority = TaskPriority::Normal);
+
 		/** Returns the maximum available worker threads (maximum number of tasks that can be executed simultaneously). */
 		UINT32 getNumWorkers() const { return mMaxActiveTasks; }
+
+		/** Returns the mode the scheduler uses for distributing tasks between worker threads. */
+		TaskSchedulerMode getMode() const { return mMode; }
 	protected:
 		friend class Task;
 
@@ -123,18 +237,51 @@ namespace bs
 		/**	Method used for sorting tasks. */
 		static bool taskCompare(const SPtr<Task>& lhs, const SPtr<Task>& rhs);
 
+		/** Maps task priority to a queue index in range [0, TaskWorker::NUM_PRIORITIES), with higher priorities having higher indices. */
+		static UINT32 getPriorityIdx(TaskPriority priority);
+
+		/** Main loop of a persistent worker thread in work stealing mode. */
+		void runWorker(TaskWorker* worker);
+
+		/** 
+		 * Places a task whose dependencies have completed in a queue, from which it can be picked up by any worker. Task 
+		 * must have its self-reference assigned. Work stealing mode only. 
+		 */
+		void enqueueTask(Task* task);
+
+		/** 
+		 * Attempts to find a queued task, in order of priority. Checks the local queue of the provided worker first (if
+		 * any), then the global queue, and finally attempts to steal from other workers. Work stealing mode only.
+		 */
+		Task* findTask(TaskWorker* worker);
+
+		/** Executes a task found through findTask() and queues any tasks that depend on it. Work stealing mode only. */
+		void executeTask(Task* task);
+
+		/** Executes queued tasks on the calling thread, until the provided task completes. Work stealing mode only. */
+		void helpUntilComplete(const Task* task);
+
+		TaskSchedulerMode mMode;
 		HThread mTaskSchedulerThread;
 		Set<SPtr<Task>, std::function<bool(const SPtr<Task>&, const SPtr<Task>&)>> mTaskQueue;
 		Vector<SPtr<Task>> mActiveTasks;
-		UINT32 mMaxActiveTasks = 0;
+		std::atomic<UINT32> mMaxActiveTasks{0};
 		UINT32 mNextTaskId = 0;
-		bool mShutdown = false;
+		std::atomic<bool> mShutdown{false};
 		bool mCheckTasks = false;
 
 		Mutex mReadyMutex;
 		Mutex mCompleteMutex;
 		Signal mTaskReadyCond;
 		Signal mTaskCompleteCond;
+
+		// Work stealing mode only
+		Vector<TaskWorker*> mWorkers;
+		Deque<Task*> mGlobalQueues[TaskWorker::NUM_PRIORITIES];
+		ProfiledSpinLock mGlobalQueueLock{"TaskScheduler global queue"};
+		std::atomic<INT32> mNumQueuedTasks{0};
+		std::atomic<UINT32> mNumSleepingWorkers{0};
+		std::atomic<UINT32> mNumWaiters{0};
 	};
 
 	/** @} */
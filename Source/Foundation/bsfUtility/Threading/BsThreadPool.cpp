@@ -12,6 +12,13 @@
 #pragma warning(disable: 4509)
 #endif // BS_COMPILER == BS_COMPILER_MSVC
 
+#elif BS_PLATFORM == BS_PLATFORM_LINUX
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <fstream>
 #endif // BS_PLATFORM == BS_PLATFORM_WIN32
 
 namespace bs
@@ -59,12 +66,13 @@ namespace bs
 			mStartedCond.wait(lock);
 	}
 
-	void PooledThread::start(std::function<void()> workerMethod, UINT32 id)
+	void PooledThread::start(std::function<void()> workerMethod, UINT32 id, const ThreadConfig& config)
 	{
 		{
 			Lock lock(mMutex);
 
 			mWorkerMethod = workerMethod;
+			mConfig = config;
 			mIdle = false;
 			mIdleTime = std::time(nullptr);
 			mThreadReady = true;
@@ -88,6 +96,7 @@ namespace bs
 		while(true)
 		{
 			std::function<void()> worker = nullptr;
+			ThreadConfig config;
 
 			{
 				{
@@ -97,6 +106,7 @@ namespace bs
 						mReadyCond.wait(lock);
 
 					worker = mWorkerMethod;
+					config = mConfig;
 				}
 
 				if (worker == nullptr)
@@ -106,6 +116,13 @@ namespace bs
 				}
 			}
 
+			// Threads are reused between roles, so only touch the OS scheduler when the configuration changes
+			if (config != mAppliedConfig)
+			{
+				ThreadPool::applyThreadConfig(config);
+				mAppliedConfig = config;
+			}
+
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 			__try
 			{
@@ -193,13 +210,152 @@ namespace bs
 	}
 
 	HThread ThreadPool::run(const String& name, std::function<void()> workerMethod)
+	{
+		return run(name, std::move(workerMethod), getThreadConfig(name));
+	}
+
+	HThread ThreadPool::run(const String& name, std::function<void()> workerMethod, const ThreadConfig& config)
 	{
 		PooledThread* thread = getThread(name);
-		thread->start(workerMethod, mUniqueId++);
+		thread->start(workerMethod, mUniqueId++, config);
 
 		return HThread(this, thread->getId());
 	}
 
+	void ThreadPool::setThreadConfig(const String& name, const ThreadConfig& config)
+	{
+		Lock lock(mMutex);
+		mConfigs[name] = config;
+	}
+
+	void ThreadPool::setDefaultThreadConfig(const ThreadConfig& config)
+	{
+		Lock lock(mMutex);
+		mDefaultConfig = config;
+	}
+
+	ThreadConfig ThreadPool::getThreadConfig(const String& name) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mConfigs.find(name);
+		if (iterFind != mConfigs.end())
+			return iterFind->second;
+
+		return mDefaultConfig;
+	}
+
+	void ThreadPool::applyThreadConfig(const ThreadConfig& config)
+	{
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+		int priority;
+		switch (config.priority)
+		{
+		case ThreadPriority::Low: priority = THREAD_PRIORITY_BELOW_NORMAL; break;
+		default:
+		case ThreadPriority::Normal: priority = THREAD_PRIORITY_NORMAL; break;
+		case ThreadPriority::High: priority = THREAD_PRIORITY_ABOVE_NORMAL; break;
+		case ThreadPriority::Highest: priority = THREAD_PRIORITY_HIGHEST; break;
+		}
+
+		HANDLE thread = GetCurrentThread();
+		SetThreadPriority(thread, priority);
+
+		DWORD_PTR processMask = 0;
+		DWORD_PTR systemMask = 0;
+		GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask);
+
+		DWORD_PTR threadMask = (DWORD_PTR)config.affinityMask & processMask;
+		SetThreadAffinityMask(thread, threadMask != 0 ? threadMask : processMask);
+#elif BS_PLATFORM == BS_PLATFORM_LINUX
+		// Regular (SCHED_OTHER) threads ignore scheduling priorities, but respect per-thread nice values
+		int niceValue;
+		switch (config.priority)
+		{
+		case ThreadPriority::Low: niceValue = 5; break;
+		default:
+		case ThreadPriority::Normal: niceValue = 0; break;
+		case ThreadPriority::High: niceValue = -5; break;
+		case ThreadPriority::Highest: niceValue = -10; break;
+		}
+
+		setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), niceValue);
+
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+
+		for (UINT32 i = 0; i < CPU_SETSIZE; i++)
+		{
+			if (config.affinityMask == 0 || (i < 64 && (config.affinityMask & (1ULL << i)) != 0))
+				CPU_SET(i, &cpuSet);
+		}
+
+		pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+#endif
+	}
+
+	Vector<UINT64> ThreadPool::getPhysicalCoreMasks()
+	{
+		Vector<UINT64> output;
+
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+		DWORD size = 0;
+		GetLogicalProcessorInformation(nullptr, &size);
+
+		Vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> entries(size / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+		if (!entries.empty() && GetLogicalProcessorInformation(entries.data(), &size))
+		{
+			for (auto& entry : entries)
+			{
+				if (entry.Relationship == RelationProcessorCore && entry.ProcessorMask != 0)
+					output.push_back((UINT64)entry.ProcessorMask);
+			}
+		}
+#elif BS_PLATFORM == BS_PLATFORM_LINUX
+		// Logical processors sharing the same package and core ID belong to the same physical core
+		UnorderedMap<UINT64, UINT32> coreLookup;
+		UINT32 numProcessors = std::min(64U, (UINT32)BS_THREAD_HARDWARE_CONCURRENCY);
+		for (UINT32 i = 0; i < numProcessors; i++)
+		{
+			String topologyFolder = "/sys/devices/system/cpu/cpu" + toString(i) + "/topology/";
+
+			std::ifstream packageFile((topologyFolder + "physical_package_id").c_str());
+			std::ifstream coreFile((topologyFolder + "core_id").c_str());
+
+			UINT32 packageId, coreId;
+			if (!(packageFile >> packageId) || !(coreFile >> coreId))
+			{
+				output.clear();
+				break;
+			}
+
+			UINT64 key = ((UINT64)packageId << 32) | coreId;
+			auto iterFind = coreLookup.find(key);
+			if (iterFind == coreLookup.end())
+			{
+				coreLookup[key] = (UINT32)output.size();
+				output.push_back(1ULL << i);
+			}
+			else
+				output[iterFind->second] |= 1ULL << i;
+		}
+#endif
+
+		if (output.empty())
+		{
+			UINT32 numProcessors = std::max(1U, std::min(64U, (UINT32)BS_THREAD_HARDWARE_CONCURRENCY));
+			for (UINT32 i = 0; i < numProcessors; i++)
+				output.push_back(1ULL << i);
+		}
+
+		return output;
+	}
+
+	UINT32 ThreadPool::getNumPhysicalCores()
+	{
+		return (UINT32)getPhysicalCoreMasks().size();
+	}
+
 	void ThreadPool::stopAll()
 	{
 		Lock lock(mMutex);
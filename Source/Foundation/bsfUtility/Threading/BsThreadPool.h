@@ -13,6 +13,34 @@ namespace bs
 
 	class ThreadPool;
 
+	/** Scheduling priority of a thread, relative to other threads in the process. */
+	enum class ThreadPriority
+	{
+		Low, /**< Runs only when higher priority threads are idle, e.g. for background work. */
+		Normal, /**< Default priority of new threads. */
+		High, /**< For threads that need to keep up with the frame, like the core thread. */
+		Highest /**< For latency sensitive threads, like audio streaming. */
+	};
+
+	/** Determines how is a thread scheduled by the OS. */
+	struct ThreadConfig
+	{
+		ThreadPriority priority = ThreadPriority::Normal;
+
+		/**
+		 * Mask of logical processors the thread is allowed to run on, where each bit represents a single processor.
+		 * Zero allows the thread to run on any processor. Only the first 64 logical processors can be referenced.
+		 */
+		UINT64 affinityMask = 0;
+
+		bool operator==(const ThreadConfig& rhs) const
+		{
+			return priority == rhs.priority && affinityMask == rhs.affinityMask;
+		}
+
+		bool operator!=(const ThreadConfig& rhs) const { return !(*this == rhs); }
+	};
+
 	/** Handle to a thread managed by ThreadPool. */
 	class BS_UTILITY_EXPORT HThread
 	{
@@ -57,7 +85,7 @@ namespace bs
 		 * Caller must ensure worker method is not null and that the thread is currently idle, otherwise undefined behavior
 		 * will occur.
 		 */
-		void start(std::function<void()> workerMethod, UINT32 id);
+		void start(std::function<void()> workerMethod, UINT32 id, const ThreadConfig& config = ThreadConfig());
 
 		/**
 		 * Attempts to join the currently running thread and destroys it. Caller must ensure that any worker method 
@@ -94,6 +122,8 @@ namespace bs
 
 	protected:
 		std::function<void()> mWorkerMethod;
+		ThreadConfig mConfig;
+		ThreadConfig mAppliedConfig;
 		String mName;
 		UINT32 mId = 0;
 		bool mIdle = true;
@@ -160,7 +190,8 @@ namespace bs
 		virtual ~ThreadPool();
 
 		/**
-		 * Find an unused thread (or creates a new one) and runs the specified worker method on it.
+		 * Find an unused thread (or creates a new one) and runs the specified worker method on it. The thread is
+		 * scheduled according to the configuration registered for @p name, see setThreadConfig().
 		 *
 		 * @param[in]	name			A name you may use for more easily identifying the thread.
 		 * @param[in]	workerMethod	The worker method to be called by the thread.
@@ -168,6 +199,29 @@ namespace bs
 		 */
 		HThread run(const String& name, std::function<void()> workerMethod);
 
+		/**
+		 * Find an unused thread (or creates a new one) and runs the specified worker method on it, using the provided
+		 * scheduling configuration for the duration of the worker method.
+		 *
+		 * @param[in]	name			A name you may use for more easily identifying the thread.
+		 * @param[in]	workerMethod	The worker method to be called by the thread.
+		 * @param[in]	config			Priority and affinity to run the worker method with.
+		 * @return						A thread handle you may use for monitoring the thread execution.
+		 */
+		HThread run(const String& name, std::function<void()> workerMethod, const ThreadConfig& config);
+
+		/**
+		 * Registers a scheduling configuration for all threads started with the specified name (role), such as "Core"
+		 * or "TaskWorker". Only applies to worker methods started after this call.
+		 */
+		void setThreadConfig(const String& name, const ThreadConfig& config);
+
+		/** Sets the configuration used by threads whose name has no configuration registered. */
+		void setDefaultThreadConfig(const ThreadConfig& config);
+
+		/** Returns the configuration threads with the specified name are started with. */
+		ThreadConfig getThreadConfig(const String& name) const;
+
 		/**
 		 * Stops all threads and destroys them. Caller must ensure each threads worker method returns otherwise this will 
 		 * never return.
@@ -186,6 +240,22 @@ namespace bs
 		/**	Returns the total number of created threads in the pool	(both running and unused). */
 		UINT32 getNumAllocated() const;
 
+		/**
+		 * Applies the provided priority and affinity to the calling thread. Priorities the process isn't allowed to use
+		 * (e.g. raising priority on Linux without the required privileges) are silently ignored.
+		 */
+		static void applyThreadConfig(const ThreadConfig& config);
+
+		/**
+		 * Returns affinity masks of logical processors belonging to each physical core. With simultaneous
+		 * multithreading (SMT) enabled, each mask will contain more than one processor. Falls back to one mask per
+		 * logical processor if the CPU topology cannot be determined.
+		 */
+		static Vector<UINT64> getPhysicalCoreMasks();
+
+		/** Returns the number of physical CPU cores, ignoring any additional logical processors added by SMT. */
+		static UINT32 getNumPhysicalCores();
+
 	protected:
 		friend class HThread;
 
@@ -211,6 +281,9 @@ namespace bs
 		UINT32 mIdleTimeout;
 		UINT32 mAge = 0;
 
+		ThreadConfig mDefaultConfig;
+		UnorderedMap<String, ThreadConfig> mConfigs;
+
 		std::atomic_uint mUniqueId;
 		mutable Mutex mMutex;
 	};
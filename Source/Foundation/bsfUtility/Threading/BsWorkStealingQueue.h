@@ -0,0 +1,115 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Threading-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Fixed capacity lock-free double-ended queue (Chase-Lev). A single owner thread pushes and pops elements from the
+	 * bottom of the queue (LIFO), while any other thread may steal elements from the top of the queue (FIFO).
+	 *
+	 * @tparam	T			Type of the element pointed to by the stored pointers.
+	 * @tparam	Capacity	Maximum number of elements the queue can hold. Must be a power of two.
+	 *
+	 * @note	push() and pop() must only be called from the owner thread. steal() is thread safe.
+	 */
+	template<class T, INT64 Capacity = 512>
+	class WorkStealingQueue
+	{
+		static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+		static constexpr INT64 MASK = Capacity - 1;
+
+	public:
+		WorkStealingQueue()
+		{
+			for(auto& entry : mEntries)
+				entry.store(nullptr, std::memory_order_relaxed);
+		}
+
+		/** Pushes a new element on the bottom of the queue. Returns false if the queue is full. Owner thread only. */
+		bool push(T* value)
+		{
+			INT64 bottom = mBottom.load(std::memory_order_relaxed);
+			INT64 top = mTop.load(std::memory_order_acquire);
+
+			if((bottom - top) >= Capacity)
+				return false;
+
+			mEntries[bottom & MASK].store(value, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		/** Removes an element from the bottom of the queue. Returns null if the queue is empty. Owner thread only. */
+		T* pop()
+		{
+			INT64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			INT64 top = mTop.load(std::memory_order_relaxed);
+			if(top > bottom)
+			{
+				// Empty
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T* value = mEntries[bottom & MASK].load(std::memory_order_relaxed);
+			if(top == bottom)
+			{
+				// Last element, race against any thieves
+				if(!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					value = nullptr;
+
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return value;
+		}
+
+		/** Removes an element from the top of the queue. Returns null if the queue is empty or the steal was contested. */
+		T* steal()
+		{
+			INT64 top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			INT64 bottom = mBottom.load(std::memory_order_acquire);
+
+			if(top >= bottom)
+				return nullptr;
+
+			T* value = mEntries[top & MASK].load(std::memory_order_relaxed);
+			if(!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+
+			return value;
+		}
+
+		/** Returns true if the queue has no elements. Result is only approximate if called from a non-owner thread. */
+		bool isEmpty() const
+		{
+			return mBottom.load(std::memory_order_relaxed) <= mTop.load(std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic<INT64> mTop{0};
+		char mPadding[64 - sizeof(std::atomic<INT64>)]; // Keep top and bottom on separate cache lines
+		std::atomic<INT64> mBottom{0};
+		std::atomic<T*> mEntries[Capacity];
+	};
+
+	/** @} */
+	/** @} */
+}
@@ -74,6 +74,19 @@ namespace bs
 			return result - 1;
 		}
 
+		/** Returns the least significant bit set in a value. Value must not be zero. */
+		static UINT32 leastSignificantBitSet(UINT32 value)
+		{
+			// De Bruijn sequence lookup, isolating the lowest set bit first
+			static const UINT8 DE_BRUIJN_TABLE[32] =
+			{
+				0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+				31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+			};
+
+			return DE_BRUIJN_TABLE[((value & (~value + 1)) * 0x077CB531U) >> 27];
+		}
+
 		/** Returns the power-of-two number greater or equal to the provided value. */
 		static UINT32 nextPow2(UINT32 n)
 		{
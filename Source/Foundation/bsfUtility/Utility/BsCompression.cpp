@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Utility/BsCompression.h"
 #include "FileSystem/BsDataStream.h"
+#include "Threading/BsTaskScheduler.h"
 
 // Third party
 #include "snappy.h"
@@ -166,6 +167,132 @@ namespace bs
 		Vector<BufferPiece> mBufferPieces;
 	};
 
+	/** Header at the start of data compressed with Compression::compressChunked(). */
+	struct ChunkedCompressionHeader
+	{
+		UINT32 magic;
+		UINT32 chunkSize;
+		UINT64 uncompressedSize;
+		UINT32 numChunks;
+		UINT32 reserved;
+	};
+
+	static constexpr UINT32 CHUNKED_COMPRESSION_MAGIC = 0x43435342; // "BSCC"
+
+	/** Chunk information parsed from data compressed with Compression::compressChunked(). */
+	struct ChunkTable
+	{
+		ChunkedCompressionHeader header;
+		Vector<UINT64> offsets; /**< Offset of each chunk relative to chunkData, followed by the end offset. */
+		const UINT8* chunkData = nullptr;
+
+		/** Returns the size of the chunk with the specified index, in uncompressed form. */
+		size_t getUncompressedSize(UINT32 idx) const
+		{
+			UINT64 start = (UINT64)idx * header.chunkSize;
+			return (size_t)std::min((UINT64)header.chunkSize, header.uncompressedSize - start);
+		}
+	};
+
+	/**
+	 * Returns a pointer to the remaining contents of the stream, and advances the stream to its end. File streams are
+	 * read into @p storage, while for memory streams the memory is referenced directly.
+	 */
+	static const UINT8* getContiguousData(SPtr<DataStream>& input, size_t& size, SPtr<MemoryDataStream>& storage)
+	{
+		size = input->size() - input->tell();
+
+		if (!input->isFile())
+		{
+			SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(input);
+			const UINT8* data = memStream->getCurrentPtr();
+
+			input->skip(size);
+			return data;
+		}
+
+		storage = bs_shared_ptr_new<MemoryDataStream>(size);
+		size = input->read(storage->getPtr(), size);
+
+		return storage->getPtr();
+	}
+
+	/** Executes the provided function for each index in [0, count), in parallel if the TaskScheduler is running. */
+	static void forEachChunk(UINT32 count, const std::function<void(UINT32)>& func)
+	{
+		auto runRange = [&func](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+				func(i);
+		};
+
+		if (TaskScheduler::isStarted())
+			TaskScheduler::instance().parallelFor(0, count, 1, runRange);
+		else
+			runRange(0, count);
+	}
+
+	/** Parses and validates the header and chunk table of data compressed with Compression::compressChunked(). */
+	static bool readChunkTable(const UINT8* data, size_t size, ChunkTable& table)
+	{
+		ChunkedCompressionHeader& header = table.header;
+		if (size < sizeof(header))
+			return false;
+
+		memcpy(&header, data, sizeof(header));
+		if (header.magic != CHUNKED_COMPRESSION_MAGIC || header.chunkSize == 0)
+			return false;
+
+		UINT64 expectedNumChunks = (header.uncompressedSize + header.chunkSize - 1) / header.chunkSize;
+		if (header.numChunks != expectedNumChunks)
+			return false;
+
+		size_t tableSize = (header.numChunks + 1) * sizeof(UINT64);
+		if (size - sizeof(header) < tableSize)
+			return false;
+
+		// Copied since the table isn't guaranteed to be aligned
+		table.offsets.resize(header.numChunks + 1);
+		memcpy(table.offsets.data(), data + sizeof(header), tableSize);
+
+		table.chunkData = data + sizeof(header) + tableSize;
+
+		UINT64 chunkDataSize = size - sizeof(header) - tableSize;
+		for (UINT32 i = 0; i < header.numChunks; i++)
+		{
+			if (table.offsets[i] > table.offsets[i + 1])
+				return false;
+		}
+
+		return table.offsets[0] == 0 && table.offsets[header.numChunks] <= chunkDataSize;
+	}
+
+	/**
+	 * Decompresses chunks in range [@p first, @p last) into the provided buffer, which must be large enough to hold
+	 * their uncompressed contents. Returns false if any of the chunks is corrupt.
+	 */
+	static bool decompressChunks(const ChunkTable& table, UINT32 first, UINT32 last, UINT8* output)
+	{
+		std::atomic<bool> failed{false};
+		forEachChunk(last - first, [&](UINT32 i)
+		{
+			UINT32 idx = first + i;
+
+			const char* src = (const char*)table.chunkData + table.offsets[idx];
+			size_t srcSize = (size_t)(table.offsets[idx + 1] - table.offsets[idx]);
+			char* dst = (char*)output + (size_t)i * table.header.chunkSize;
+
+			size_t uncompressedSize = 0;
+			if (!snappy::GetUncompressedLength(src, srcSize, &uncompressedSize) ||
+				uncompressedSize != table.getUncompressedSize(idx) || !snappy::RawUncompress(src, srcSize, dst))
+			{
+				failed = true;
+			}
+		});
+
+		return !failed;
+	}
+
 	SPtr<MemoryDataStream> Compression::compress(SPtr<DataStream>& input)
 	{
 		DataStreamSource src(input);
@@ -191,4 +318,123 @@ namespace bs
 
 		return dst.GetOutput();
 	}
+
+	SPtr<MemoryDataStream> Compression::compressChunked(SPtr<DataStream>& input, UINT32 chunkSize)
+	{
+		chunkSize = std::max(1U, chunkSize);
+
+		SPtr<MemoryDataStream> inputStorage;
+		size_t inputSize = 0;
+		const UINT8* inputData = getContiguousData(input, inputSize, inputStorage);
+
+		ChunkedCompressionHeader header;
+		header.magic = CHUNKED_COMPRESSION_MAGIC;
+		header.chunkSize = chunkSize;
+		header.uncompressedSize = inputSize;
+		header.numChunks = (UINT32)((inputSize + chunkSize - 1) / chunkSize);
+		header.reserved = 0;
+
+		// Compress each chunk into its own slot of a scratch buffer, then pack them together once sizes are known
+		size_t maxCompressedChunkSize = snappy::MaxCompressedLength(chunkSize);
+		UINT8* scratch = (UINT8*)bs_alloc(std::max((size_t)1, maxCompressedChunkSize * header.numChunks));
+
+		Vector<size_t> compressedSizes(header.numChunks);
+		forEachChunk(header.numChunks, [&](UINT32 i)
+		{
+			size_t offset = (size_t)i * chunkSize;
+			size_t size = std::min((size_t)chunkSize, inputSize - offset);
+
+			snappy::RawCompress((const char*)inputData + offset, size, (char*)scratch + i * maxCompressedChunkSize,
+				&compressedSizes[i]);
+		});
+
+		Vector<UINT64> offsets(header.numChunks + 1);
+		offsets[0] = 0;
+		for (UINT32 i = 0; i < header.numChunks; i++)
+			offsets[i + 1] = offsets[i] + compressedSizes[i];
+
+		size_t tableSize = offsets.size() * sizeof(UINT64);
+		size_t totalSize = sizeof(header) + tableSize + (size_t)offsets.back();
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>(totalSize);
+		output->write(&header, sizeof(header));
+		output->write(offsets.data(), tableSize);
+
+		for (UINT32 i = 0; i < header.numChunks; i++)
+			output->write(scratch + i * maxCompressedChunkSize, compressedSizes[i]);
+
+		bs_free(scratch);
+
+		output->seek(0);
+		return output;
+	}
+
+	SPtr<MemoryDataStream> Compression::decompressChunked(SPtr<DataStream>& input)
+	{
+		SPtr<MemoryDataStream> inputStorage;
+		size_t inputSize = 0;
+		const UINT8* inputData = getContiguousData(input, inputSize, inputStorage);
+
+		ChunkTable table;
+		if (!readChunkTable(inputData, inputSize, table))
+		{
+			LOGERR("Decompression failed, corrupt data.");
+			return nullptr;
+		}
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>((size_t)table.header.uncompressedSize);
+		if (!decompressChunks(table, 0, table.header.numChunks, output->getPtr()))
+		{
+			LOGERR("Decompression failed, corrupt data.");
+			return nullptr;
+		}
+
+		return output;
+	}
+
+	SPtr<MemoryDataStream> Compression::decompressChunkedRange(SPtr<DataStream>& input, size_t offset, size_t size)
+	{
+		SPtr<MemoryDataStream> inputStorage;
+		size_t inputSize = 0;
+		const UINT8* inputData = getContiguousData(input, inputSize, inputStorage);
+
+		ChunkTable table;
+		if (!readChunkTable(inputData, inputSize, table))
+		{
+			LOGERR("Decompression failed, corrupt data.");
+			return nullptr;
+		}
+
+		if ((UINT64)offset + size > table.header.uncompressedSize)
+		{
+			LOGERR("Decompression failed, requested range is out of bounds.");
+			return nullptr;
+		}
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>(size);
+		if (size == 0)
+			return output;
+
+		const UINT32 chunkSize = table.header.chunkSize;
+		UINT32 firstChunk = (UINT32)(offset / chunkSize);
+		UINT32 lastChunk = (UINT32)((offset + size + chunkSize - 1) / chunkSize);
+
+		size_t firstChunkOffset = (size_t)firstChunk * chunkSize;
+		size_t chunksSize = (size_t)std::min((UINT64)lastChunk * chunkSize, table.header.uncompressedSize) - 
+			firstChunkOffset;
+
+		UINT8* chunks = (UINT8*)bs_alloc(chunksSize);
+		if (!decompressChunks(table, firstChunk, lastChunk, chunks))
+		{
+			bs_free(chunks);
+
+			LOGERR("Decompression failed, corrupt data.");
+			return nullptr;
+		}
+
+		memcpy(output->getPtr(), chunks + (offset - firstChunkOffset), size);
+		bs_free(chunks);
+
+		return output;
+	}
 }
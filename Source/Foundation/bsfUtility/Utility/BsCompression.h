@@ -19,6 +19,37 @@ namespace bs
 
 		/** Decompresses the data from the provided data stream and outputs the new stream with decompressed data. */
 		static SPtr<MemoryDataStream> decompress(SPtr<DataStream>& input);
+
+		/**
+		 * Compresses the data from the provided data stream into a chunked container. Data is split into fixed size
+		 * chunks which are compressed independently, allowing them to be compressed and decompressed in parallel, as well
+		 * as decompressed individually. Chunks are compressed on TaskScheduler workers if the scheduler is running.
+		 *
+		 * @param[in]	input		Stream containing the data to compress. Data is read from the current position.
+		 * @param[in]	chunkSize	Size of a single chunk of uncompressed data, in bytes.
+		 * @return					Stream containing the chunked container.
+		 */
+		static SPtr<MemoryDataStream> compressChunked(SPtr<DataStream>& input, UINT32 chunkSize = DEFAULT_CHUNK_SIZE);
+
+		/**
+		 * Decompresses data previously compressed with compressChunked(). Chunks are decompressed on TaskScheduler
+		 * workers if the scheduler is running. Returns null if the data is corrupt.
+		 */
+		static SPtr<MemoryDataStream> decompressChunked(SPtr<DataStream>& input);
+
+		/**
+		 * Decompresses a range of data previously compressed with compressChunked(). Only the chunks overlapping the
+		 * range are decompressed. Returns null if the data is corrupt or the range is out of bounds.
+		 *
+		 * @param[in]	input		Stream containing the chunked container, positioned at its start.
+		 * @param[in]	offset		Offset into the uncompressed data at which the range starts, in bytes.
+		 * @param[in]	size		Size of the range, in bytes.
+		 * @return					Stream containing the uncompressed data in the requested range.
+		 */
+		static SPtr<MemoryDataStream> decompressChunkedRange(SPtr<DataStream>& input, size_t offset, size_t size);
+
+		/** Default size of uncompressed data in a single chunk used by compressChunked(). */
+		static constexpr UINT32 DEFAULT_CHUNK_SIZE = 256 * 1024;
 	};
 
 	/** @} */
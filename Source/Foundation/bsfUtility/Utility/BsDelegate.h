@@ -0,0 +1,235 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/** @copydoc Delegate<RetType(Args...)> */
+	template <typename Signature>
+	class Delegate;
+
+	/**
+	 * Type-erased callable, similar to std::function. Callables up to INLINE_SIZE bytes large are stored inline without
+	 * allocating any memory. This includes member functions bound to an object instance, lambdas with a few captures
+	 * and results of std::bind for member functions. Larger callables fall back to the general purpose allocator.
+	 */
+	template <class RetType, class... Args>
+	class Delegate<RetType(Args...)>
+	{
+	public:
+		/** Maximum size of a callable that can be stored without allocating memory. */
+		static constexpr UINT32 INLINE_SIZE = sizeof(void*) * 4;
+
+		Delegate() = default;
+		Delegate(std::nullptr_t) { }
+
+		/** Creates a delegate that calls @p method on @p instance. */
+		template<class Class>
+		Delegate(Class* instance, RetType (Class::*method)(Args...))
+			:Delegate([instance, method](Args... args) { return (instance->*method)(std::forward<Args>(args)...); })
+		{ }
+
+		/** @copydoc Delegate(Class*, RetType (Class::*)(Args...)) */
+		template<class Class>
+		Delegate(const Class* instance, RetType (Class::*method)(Args...) const)
+			:Delegate([instance, method](Args... args) { return (instance->*method)(std::forward<Args>(args)...); })
+		{ }
+
+		/** Creates a delegate from any callable object accepting the delegate arguments. */
+		template<class Func, class = typename std::enable_if<
+			!std::is_same<typename std::decay<Func>::type, Delegate>::value>::type>
+		Delegate(Func&& func)
+		{
+			typedef typename std::decay<Func>::type FuncType;
+
+			if (isNull(func))
+				return;
+
+			constexpr bool storeInline = sizeof(FuncType) <= INLINE_SIZE &&
+				alignof(FuncType) <= alignof(std::max_align_t) &&
+				std::is_nothrow_move_constructible<FuncType>::value;
+
+			init<FuncType>(std::forward<Func>(func), std::integral_constant<bool, storeInline>());
+		}
+
+		Delegate(const Delegate& other)
+		{
+			copy(other);
+		}
+
+		Delegate(Delegate&& other) noexcept
+		{
+			move(other);
+		}
+
+		~Delegate()
+		{
+			reset();
+		}
+
+		Delegate& operator=(const Delegate& other)
+		{
+			if (this != &other)
+			{
+				reset();
+				copy(other);
+			}
+
+			return *this;
+		}
+
+		Delegate& operator=(Delegate&& other) noexcept
+		{
+			if (this != &other)
+			{
+				reset();
+				move(other);
+			}
+
+			return *this;
+		}
+
+		/** Calls the stored callable. Delegate must not be empty. */
+		RetType operator()(Args... args) const
+		{
+			assert(mInvoke != nullptr);
+			return mInvoke((void*)mStorage, std::forward<Args>(args)...);
+		}
+
+		/** Checks does the delegate contain a callable. */
+		explicit operator bool() const { return mInvoke != nullptr; }
+
+		/** Destroys the stored callable, if any, leaving the delegate empty. */
+		void reset()
+		{
+			if (mManage != nullptr)
+				mManage(Operation::Destroy, mStorage, nullptr);
+
+			mInvoke = nullptr;
+			mManage = nullptr;
+		}
+
+	private:
+		/** Operations performed by a manager function on the stored callable. */
+		enum class Operation { Copy, Move, Destroy };
+
+		typedef RetType(*InvokeFunc)(void*, Args...);
+		typedef void(*ManageFunc)(Operation, void*, void*);
+
+		/** Stores a callable in the inline storage. */
+		template<class FuncType, class Func>
+		void init(Func&& func, std::true_type)
+		{
+			new (mStorage) FuncType(std::forward<Func>(func));
+
+			mInvoke = [](void* storage, Args... args) -> RetType
+			{
+				return (*(FuncType*)storage)(std::forward<Args>(args)...);
+			};
+
+			// Trivial callables, like member functions bound to an instance, are copied along with the storage
+			if (!std::is_trivially_copyable<FuncType>::value)
+			{
+				mManage = [](Operation op, void* dst, void* src)
+				{
+					switch (op)
+					{
+					case Operation::Copy:
+						new (dst) FuncType(*(const FuncType*)src);
+						break;
+					case Operation::Move:
+						new (dst) FuncType(std::move(*(FuncType*)src));
+						((FuncType*)src)->~FuncType();
+						break;
+					case Operation::Destroy:
+						((FuncType*)dst)->~FuncType();
+						break;
+					}
+				};
+			}
+		}
+
+		/** Stores a callable that doesn't fit in the inline storage in dynamically allocated memory. */
+		template<class FuncType, class Func>
+		void init(Func&& func, std::false_type)
+		{
+			*(FuncType**)mStorage = bs_new<FuncType>(std::forward<Func>(func));
+
+			mInvoke = [](void* storage, Args... args) -> RetType
+			{
+				return (**(FuncType**)storage)(std::forward<Args>(args)...);
+			};
+
+			mManage = [](Operation op, void* dst, void* src)
+			{
+				switch (op)
+				{
+				case Operation::Copy:
+					*(FuncType**)dst = bs_new<FuncType>(**(const FuncType**)src);
+					break;
+				case Operation::Move:
+					*(FuncType**)dst = *(FuncType**)src;
+					break;
+				case Operation::Destroy:
+					bs_delete(*(FuncType**)dst);
+					break;
+				}
+			};
+		}
+
+		/** Copies the callable from @p other. This delegate must be empty. */
+		void copy(const Delegate& other)
+		{
+			if (other.mInvoke == nullptr)
+				return;
+
+			if (other.mManage != nullptr)
+				other.mManage(Operation::Copy, mStorage, (void*)other.mStorage);
+			else
+				memcpy(mStorage, other.mStorage, sizeof(mStorage));
+
+			mInvoke = other.mInvoke;
+			mManage = other.mManage;
+		}
+
+		/** Moves the callable from @p other, leaving it empty. This delegate must be empty. */
+		void move(Delegate& other)
+		{
+			if (other.mInvoke == nullptr)
+				return;
+
+			if (other.mManage != nullptr)
+				other.mManage(Operation::Move, mStorage, other.mStorage);
+			else
+				memcpy(mStorage, other.mStorage, sizeof(mStorage));
+
+			mInvoke = other.mInvoke;
+			mManage = other.mManage;
+
+			other.mInvoke = nullptr;
+			other.mManage = nullptr;
+		}
+
+		/** Checks is the provided callable a null pointer or an empty function object. */
+		template<class Func>
+		static bool isNull(const Func&) { return false; }
+
+		template<class FuncRet, class... FuncArgs>
+		static bool isNull(FuncRet (*func)(FuncArgs...)) { return func == nullptr; }
+
+		template<class FuncRet, class... FuncArgs>
+		static bool isNull(const std::function<FuncRet(FuncArgs...)>& func) { return !func; }
+
+		alignas(std::max_align_t) UINT8 mStorage[INLINE_SIZE];
+		InvokeFunc mInvoke = nullptr;
+		ManageFunc mManage = nullptr;
+	};
+
+	/** @} */
+}
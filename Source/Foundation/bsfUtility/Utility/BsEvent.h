@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Utility/BsDelegate.h"
 
 namespace bs
 {
@@ -36,8 +37,27 @@ namespace bs
 		UINT32 handleLinks = 0;
 	};
 
+	/** Interface through which event handles release the connections they reference. */
+	struct BaseEventInternalData
+	{
+		virtual ~BaseEventInternalData() = default;
+
+		/**
+		 * Disconnects the connection with the specified data, ensuring the event doesn't call its callback again.
+		 *
+		 * @note	Only call this once.
+		 */
+		virtual void disconnect(BaseConnectionData* conn) = 0;
+
+		/**
+		 * Called when the event handle no longer keeps a reference to the connection data. This means we might be able
+		 * to free (and reuse) its memory if the event is done with it too.
+		 */
+		virtual void freeHandle(BaseConnectionData* conn) = 0;
+	};
+
 	/** Internal data for an Event, storing all connections. */
-	struct EventInternalData
+	struct EventInternalData : BaseEventInternalData
 	{
 		EventInternalData() = default;
 
@@ -86,12 +106,8 @@ namespace bs
 				mConnections = conn;
 		}
 
-		/**
-		 * Disconnects the connection with the specified data, ensuring the event doesn't call its callback again.
-		 *
-		 * @note	Only call this once.
-		 */
-		void disconnect(BaseConnectionData* conn)
+		/** @copydoc BaseEventInternalData::disconnect */
+		void disconnect(BaseConnectionData* conn) override
 		{
 			RecursiveLock lock(mMutex);
 
@@ -123,11 +139,8 @@ namespace bs
 			mLastConnection = nullptr;
 		}
 
-		/**
-		 * Called when the event handle no longer keeps a reference to the connection data. This means we might be able to 
-		 * free (and reuse) its memory if the event is done with it too.
-		 */
-		void freeHandle(BaseConnectionData* conn)
+		/** @copydoc BaseEventInternalData::freeHandle */
+		void freeHandle(BaseConnectionData* conn) override
 		{
 			RecursiveLock lock(mMutex);
 
@@ -185,7 +198,7 @@ namespace bs
 	public:
 		HEvent() = default;
 
-		explicit HEvent(SPtr<EventInternalData> eventData, BaseConnectionData* connection)
+		explicit HEvent(SPtr<BaseEventInternalData> eventData, BaseConnectionData* connection)
 			:mConnection(connection), mEventData(std::move(eventData))
 		{
 			connection->handleLinks++;
@@ -242,7 +255,7 @@ namespace bs
 
 	private:
 		BaseConnectionData* mConnection = nullptr;
-		SPtr<EventInternalData> mEventData;
+		SPtr<BaseEventInternalData> mEventData;
 	};	
 
 	/** @} */
@@ -397,6 +410,235 @@ namespace bs
 		SPtr<EventInternalData> mInternalData;
 	};
 
+	/**
+	 * Single-threaded version of TEvent, for events that are only ever connected to and triggered from a single thread
+	 * (normally the simulation thread). Callbacks are stored contiguously as delegates, so triggering the event doesn't
+	 * lock a mutex or walk a linked list, and connecting member functions or lambdas with few captures doesn't allocate
+	 * memory. Connections are returned as normal event handles.
+	 *
+	 * @note	Callback method return value is ignored.
+	 */
+	template <class RetType, class... Args>
+	class TEventST
+	{
+		/** Callback along with the connection it belongs to. Connection is null if the callback was disconnected. */
+		struct Slot
+		{
+			Delegate<RetType(Args...)> func;
+			BaseConnectionData* connection;
+		};
+
+		/** Callbacks and connection data shared between the event and its handles. */
+		struct InternalData : BaseEventInternalData
+		{
+			~InternalData()
+			{
+				assert(mTriggerDepth == 0);
+
+				for (auto& slot : mSlots)
+					releaseConnection(slot.connection);
+
+				for (auto& slot : mNewSlots)
+					releaseConnection(slot.connection);
+
+				for (auto& conn : mFreeConnections)
+					bs_delete(conn);
+			}
+
+			/** @copydoc BaseEventInternalData::disconnect */
+			void disconnect(BaseConnectionData* conn) override
+			{
+				if (conn->isActive)
+					deactivate(conn);
+
+				conn->handleLinks--;
+
+				if (conn->handleLinks == 0)
+					mFreeConnections.push_back(conn);
+			}
+
+			/** @copydoc BaseEventInternalData::freeHandle */
+			void freeHandle(BaseConnectionData* conn) override
+			{
+				conn->handleLinks--;
+
+				if (conn->handleLinks == 0 && !conn->isActive)
+					mFreeConnections.push_back(conn);
+			}
+
+			/** Returns connection data for a new connection, re-using previously released data if possible. */
+			BaseConnectionData* allocateConnection()
+			{
+				if (mFreeConnections.empty())
+					return bs_new<BaseConnectionData>();
+
+				BaseConnectionData* conn = mFreeConnections.back();
+				mFreeConnections.pop_back();
+
+				conn->isActive = true;
+				return conn;
+			}
+
+			/** Marks the connection as inactive and removes its callback from the event. */
+			void deactivate(BaseConnectionData* conn)
+			{
+				conn->isActive = false;
+
+				for (auto& slot : mSlots)
+				{
+					if (slot.connection == conn)
+						slot.connection = nullptr;
+				}
+
+				for (auto& slot : mNewSlots)
+				{
+					if (slot.connection == conn)
+						slot.connection = nullptr;
+				}
+
+				mHasInactiveSlots = true;
+				mNumActiveSlots--;
+				removeInactiveSlots();
+			}
+
+			/** Disconnects all connections in the event. */
+			void clear()
+			{
+				auto clearSlots = [this](Vector<Slot>& slots)
+				{
+					for (auto& slot : slots)
+					{
+						if (slot.connection == nullptr)
+							continue;
+
+						slot.connection->isActive = false;
+						if (slot.connection->handleLinks == 0)
+							mFreeConnections.push_back(slot.connection);
+
+						slot.connection = nullptr;
+					}
+				};
+
+				clearSlots(mSlots);
+				clearSlots(mNewSlots);
+
+				mHasInactiveSlots = true;
+				mNumActiveSlots = 0;
+				removeInactiveSlots();
+			}
+
+			/**
+			 * Removes callbacks of disconnected slots and adds callbacks connected while the event was triggering. Only
+			 * performed once the event is done triggering, as callbacks might be executing otherwise.
+			 */
+			void removeInactiveSlots()
+			{
+				if (mTriggerDepth > 0)
+					return;
+
+				if (mHasInactiveSlots)
+				{
+					auto isInactive = [](const Slot& slot) { return slot.connection == nullptr; };
+
+					mSlots.erase(std::remove_if(mSlots.begin(), mSlots.end(), isInactive), mSlots.end());
+					mNewSlots.erase(std::remove_if(mNewSlots.begin(), mNewSlots.end(), isInactive), mNewSlots.end());
+
+					mHasInactiveSlots = false;
+				}
+
+				if (!mNewSlots.empty())
+				{
+					for (auto& slot : mNewSlots)
+						mSlots.push_back(std::move(slot));
+
+					mNewSlots.clear();
+				}
+			}
+
+			/** Frees the connection data of an active connection that is no longer referenced by any handles. */
+			static void releaseConnection(BaseConnectionData* conn)
+			{
+				if (conn == nullptr)
+					return;
+
+				conn->isActive = false;
+				bs_delete(conn);
+			}
+
+			Vector<Slot> mSlots;
+			Vector<Slot> mNewSlots;
+			Vector<BaseConnectionData*> mFreeConnections;
+			UINT32 mNumActiveSlots = 0;
+			UINT32 mTriggerDepth = 0;
+			bool mHasInactiveSlots = false;
+		};
+
+	public:
+		TEventST()
+			:mInternalData(bs_shared_ptr_new<InternalData>())
+		{ }
+
+		~TEventST()
+		{
+			clear();
+		}
+
+		/** Register a new callback that will get notified once the event is triggered. */
+		HEvent connect(Delegate<RetType(Args...)> func)
+		{
+			BaseConnectionData* conn = mInternalData->allocateConnection();
+
+			// If currently triggering, delay adding the callback so the array being iterated over doesn't change
+			Vector<Slot>& slots = mInternalData->mTriggerDepth > 0 ? mInternalData->mNewSlots : mInternalData->mSlots;
+			slots.push_back({ std::move(func), conn });
+
+			mInternalData->mNumActiveSlots++;
+			return HEvent(mInternalData, conn);
+		}
+
+		/** Trigger the event, notifying all register callback methods. */
+		void operator() (Args... args)
+		{
+			if (mInternalData->mSlots.empty())
+				return;
+
+			// Increase ref count to ensure this event data isn't destroyed if one of the callbacks
+			// deletes the event itself.
+			SPtr<InternalData> internalData = mInternalData;
+			internalData->mTriggerDepth++;
+
+			// Slots are never added or removed while triggering, only marked as disconnected
+			Vector<Slot>& slots = internalData->mSlots;
+			for (UINT32 i = 0; i < (UINT32)slots.size(); i++)
+			{
+				if (slots[i].connection != nullptr)
+					slots[i].func(args...);
+			}
+
+			internalData->mTriggerDepth--;
+			internalData->removeInactiveSlots();
+		}
+
+		/** Clear all callbacks from the event. */
+		void clear()
+		{
+			mInternalData->clear();
+		}
+
+		/**
+		 * Check if event has any callbacks registered.
+		 *
+		 * @note	It is safe to trigger an event even if no callbacks are registered.
+		 */
+		bool empty() const
+		{
+			return mInternalData->mNumActiveSlots == 0;
+		}
+
+	private:
+		SPtr<InternalData> mInternalData;
+	};
+
 	/** @} */
 	/** @} */
 
@@ -418,5 +660,14 @@ namespace bs
 	class Event<RetType(Args...) > : public TEvent <RetType, Args...>
 	{ };
 
+	/** @copydoc TEventST */
+	template <typename Signature>
+	class EventST;
+
+	/** @copydoc TEventST */
+	template <class RetType, class... Args>
+	class EventST<RetType(Args...) > : public TEventST <RetType, Args...>
+	{ };
+
 	/** @} */
 }
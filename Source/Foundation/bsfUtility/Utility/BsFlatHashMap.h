@@ -0,0 +1,647 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+namespace bs
+{
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup General-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Hash table using open addressing with linear probing, storing all entries in a single contiguous array. Each slot
+	 * has an accompanying control byte that is either empty, deleted, or contains 7 bits of the entry's hash, so most
+	 * non-matching slots are skipped without touching the entries themselves. Removed entries are marked as deleted
+	 * (tombstones) and get reclaimed on the next insert or rehash.
+	 *
+	 * Iterators and references to entries are invalidated by insertion (if it causes the table to grow), but not by
+	 * removal of other entries.
+	 *
+	 * @tparam	Key			Type of the key used for looking up entries.
+	 * @tparam	Entry		Type of the entries stored in the table.
+	 * @tparam	KeyOf		Functor that extracts a key from an entry.
+	 * @tparam	Hasher		Functor that calculates a hash of the key.
+	 * @tparam	KeyEqual	Functor that compares two keys for equality.
+	 */
+	template<class Key, class Entry, class KeyOf, class Hasher, class KeyEqual>
+	class TFlatHashTable
+	{
+		static constexpr UINT8 CTRL_EMPTY = 0x80;
+		static constexpr UINT8 CTRL_DELETED = 0xFE;
+		static constexpr UINT32 MIN_CAPACITY = 8;
+
+		/** Iterator over all entries in the table, in storage order. */
+		template<bool Const>
+		class TIterator
+		{
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef Entry value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef typename std::conditional<Const, const Entry*, Entry*>::type pointer;
+			typedef typename std::conditional<Const, const Entry&, Entry&>::type reference;
+
+			typedef typename std::conditional<Const, const TFlatHashTable*, TFlatHashTable*>::type TablePtr;
+
+			TIterator() = default;
+
+			TIterator(TablePtr table, UINT32 index)
+				:mTable(table), mIndex(index)
+			{ }
+
+			/** Allows a non-const iterator to be converted to a const one. */
+			template<bool OtherConst, class = typename std::enable_if<Const && !OtherConst>::type>
+			TIterator(const TIterator<OtherConst>& other)
+				:mTable(other.mTable), mIndex(other.mIndex)
+			{ }
+
+			reference operator*() const { return mTable->mSlots[mIndex]; }
+			pointer operator->() const { return &mTable->mSlots[mIndex]; }
+
+			TIterator& operator++()
+			{
+				mIndex = mTable->findNextFull(mIndex + 1);
+				return *this;
+			}
+
+			TIterator operator++(int)
+			{
+				TIterator copy = *this;
+				++(*this);
+
+				return copy;
+			}
+
+			bool operator== (const TIterator& rhs) const { return mIndex == rhs.mIndex; }
+			bool operator!= (const TIterator& rhs) const { return mIndex != rhs.mIndex; }
+
+		private:
+			template<bool> friend class TIterator;
+			friend class TFlatHashTable;
+
+			TablePtr mTable = nullptr;
+			UINT32 mIndex = 0;
+		};
+
+	public:
+		typedef Key key_type;
+		typedef Entry value_type;
+		typedef UINT32 size_type;
+		typedef Hasher hasher;
+		typedef KeyEqual key_equal;
+		typedef TIterator<false> iterator;
+		typedef TIterator<true> const_iterator;
+
+		TFlatHashTable() = default;
+
+		TFlatHashTable(const TFlatHashTable& other)
+			:mHasher(other.mHasher), mKeyEqual(other.mKeyEqual)
+		{
+			copyFrom(other);
+		}
+
+		TFlatHashTable(TFlatHashTable&& other)
+			:mHasher(std::move(other.mHasher)), mKeyEqual(std::move(other.mKeyEqual))
+		{
+			steal(other);
+		}
+
+		TFlatHashTable(std::initializer_list<Entry> list)
+		{
+			reserve((UINT32)list.size());
+
+			for (auto& entry : list)
+				insert(entry);
+		}
+
+		~TFlatHashTable()
+		{
+			destroy();
+		}
+
+		TFlatHashTable& operator= (const TFlatHashTable& other)
+		{
+			if (this == &other)
+				return *this;
+
+			destroy();
+
+			mHasher = other.mHasher;
+			mKeyEqual = other.mKeyEqual;
+			copyFrom(other);
+
+			return *this;
+		}
+
+		TFlatHashTable& operator= (TFlatHashTable&& other)
+		{
+			if (this == &other)
+				return *this;
+
+			destroy();
+
+			mHasher = std::move(other.mHasher);
+			mKeyEqual = std::move(other.mKeyEqual);
+			steal(other);
+
+			return *this;
+		}
+
+		iterator begin() { return iterator(this, findNextFull(0)); }
+		iterator end() { return iterator(this, mCapacity); }
+
+		const_iterator begin() const { return const_iterator(this, findNextFull(0)); }
+		const_iterator end() const { return const_iterator(this, mCapacity); }
+
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+
+		/** Returns true if the table contains no entries. */
+		bool empty() const { return mSize == 0; }
+
+		/** Returns the number of entries in the table. */
+		UINT32 size() const { return mSize; }
+
+		/** Returns an iterator to the entry with the provided key, or end() if one doesn't exist. */
+		iterator find(const Key& key)
+		{
+			return iterator(this, findIndex(key));
+		}
+
+		/** @copydoc find(const Key&) */
+		const_iterator find(const Key& key) const
+		{
+			return const_iterator(this, findIndex(key));
+		}
+
+		/** Returns the number of entries with the provided key (either 0 or 1). */
+		UINT32 count(const Key& key) const
+		{
+			return findIndex(key) != mCapacity ? 1 : 0;
+		}
+
+		/**
+		 * Inserts a new entry in the table, unless an entry with the same key already exists. Returns an iterator to
+		 * the entry with the key, and a boolean that is true if the insertion took place.
+		 */
+		std::pair<iterator, bool> insert(const Entry& entry)
+		{
+			return insertEntry(KeyOf()(entry), entry);
+		}
+
+		/** @copydoc insert(const Entry&) */
+		std::pair<iterator, bool> insert(Entry&& entry)
+		{
+			const Key& key = KeyOf()(entry);
+			return insertEntry(key, std::move(entry));
+		}
+
+		/** Inserts all entries in the range [@p first, @p last). */
+		template<class InputIt>
+		void insert(InputIt first, InputIt last)
+		{
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		/** Constructs a new entry from the provided arguments and inserts it, unless the key already exists. */
+		template<class... Args>
+		std::pair<iterator, bool> emplace(Args&&... args)
+		{
+			Entry entry(std::forward<Args>(args)...);
+			return insert(std::move(entry));
+		}
+
+		/** Removes the entry pointed to by @p where. Returns an iterator to the entry following the removed one. */
+		iterator erase(const_iterator where)
+		{
+			eraseIndex(where.mIndex);
+			return iterator(this, findNextFull(where.mIndex + 1));
+		}
+
+		/** @copydoc erase(const_iterator) */
+		iterator erase(iterator where)
+		{
+			return erase(const_iterator(where));
+		}
+
+		/** Removes the entry with the provided key. Returns the number of removed entries (either 0 or 1). */
+		UINT32 erase(const Key& key)
+		{
+			const UINT32 index = findIndex(key);
+			if (index == mCapacity)
+				return 0;
+
+			eraseIndex(index);
+			return 1;
+		}
+
+		/** Removes all entries from the table. Keeps the allocated storage. */
+		void clear()
+		{
+			for (UINT32 i = 0; i < mCapacity; i++)
+			{
+				if (isFull(mCtrl[i]))
+					mSlots[i].~Entry();
+			}
+
+			if (mCapacity > 0)
+				memset(mCtrl, CTRL_EMPTY, mCapacity);
+
+			mSize = 0;
+			mNumDeleted = 0;
+		}
+
+		/** Ensures the table can hold at least @p count entries without needing to grow. */
+		void reserve(UINT32 count)
+		{
+			const UINT32 capacity = getCapacityFor(count);
+			if (capacity > mCapacity)
+				rehash(capacity);
+		}
+
+		/** Exchanges the contents of this table with another. */
+		void swap(TFlatHashTable& other)
+		{
+			std::swap(mSlots, other.mSlots);
+			std::swap(mCtrl, other.mCtrl);
+			std::swap(mCapacity, other.mCapacity);
+			std::swap(mSize, other.mSize);
+			std::swap(mNumDeleted, other.mNumDeleted);
+			std::swap(mHasher, other.mHasher);
+			std::swap(mKeyEqual, other.mKeyEqual);
+		}
+
+	protected:
+		/** Returns true if the control byte belongs to a slot containing an entry. */
+		static bool isFull(UINT8 ctrl) { return (ctrl & 0x80) == 0; }
+
+		/** Scrambles the user provided hash so keys with poorly distributed hashes (e.g. pointers) don't cluster. */
+		static UINT64 mixHash(size_t hash)
+		{
+			const UINT64 mixed = (UINT64)hash * 0x9E3779B97F4A7C15ULL;
+			return mixed ^ (mixed >> 32);
+		}
+
+		/** Returns the smallest power of two capacity that keeps the load factor below 7/8 for @p count entries. */
+		static UINT32 getCapacityFor(UINT32 count)
+		{
+			if (count == 0)
+				return 0;
+
+			UINT32 capacity = MIN_CAPACITY;
+			while (count * 8 >= capacity * 7)
+				capacity *= 2;
+
+			return capacity;
+		}
+
+		/** Returns the index of the first slot at or after @p index containing an entry, or capacity if none. */
+		UINT32 findNextFull(UINT32 index) const
+		{
+			while (index < mCapacity && !isFull(mCtrl[index]))
+				index++;
+
+			return index;
+		}
+
+		/** Returns the index of the slot containing the entry with the provided key, or capacity if there is none. */
+		UINT32 findIndex(const Key& key) const
+		{
+			if (mSize == 0)
+				return mCapacity;
+
+			const UINT64 hash = mixHash(mHasher(key));
+			const UINT8 h2 = (UINT8)(hash & 0x7F);
+			const UINT32 mask = mCapacity - 1;
+
+			UINT32 index = (UINT32)(hash >> 7) & mask;
+			while (true)
+			{
+				const UINT8 ctrl = mCtrl[index];
+				if (ctrl == h2 && mKeyEqual(KeyOf()(mSlots[index]), key))
+					return index;
+
+				if (ctrl == CTRL_EMPTY)
+					return mCapacity;
+
+				index = (index + 1) & mask;
+			}
+		}
+
+		/**
+		 * Looks up the key and returns the index of its slot. If the key doesn't exist, returns the slot the key should
+		 * be inserted in, growing the table if required, and sets @p found to false.
+		 */
+		UINT32 findOrPrepareInsert(const Key& key, bool& found)
+		{
+			const UINT64 hash = mixHash(mHasher(key));
+			const UINT8 h2 = (UINT8)(hash & 0x7F);
+
+			if (mCapacity > 0)
+			{
+				const UINT32 mask = mCapacity - 1;
+				UINT32 index = (UINT32)(hash >> 7) & mask;
+				UINT32 firstDeleted = mCapacity;
+
+				while (true)
+				{
+					const UINT8 ctrl = mCtrl[index];
+					if (ctrl == h2 && mKeyEqual(KeyOf()(mSlots[index]), key))
+					{
+						found = true;
+						return index;
+					}
+
+					if (ctrl == CTRL_DELETED && firstDeleted == mCapacity)
+						firstDeleted = index;
+					else if (ctrl == CTRL_EMPTY)
+						break;
+
+					index = (index + 1) & mask;
+				}
+
+				found = false;
+
+				// Re-using a tombstone doesn't change the load of the table
+				if (firstDeleted != mCapacity)
+				{
+					mNumDeleted--;
+					mCtrl[firstDeleted] = h2;
+
+					return firstDeleted;
+				}
+
+				if ((mSize + mNumDeleted + 1) * 8 < mCapacity * 7)
+				{
+					mCtrl[index] = h2;
+					return index;
+				}
+			}
+
+			found = false;
+
+			// Rehash in place if most of the load comes from tombstones, grow otherwise
+			if (mSize * 2 < mCapacity)
+				rehash(mCapacity);
+			else
+				rehash(std::max((UINT32)MIN_CAPACITY, mCapacity * 2));
+
+			const UINT32 index = findEmpty(hash);
+			mCtrl[index] = h2;
+
+			return index;
+		}
+
+		/** Returns the first empty slot in the probe sequence of the provided hash. Table must have no tombstones. */
+		UINT32 findEmpty(UINT64 hash) const
+		{
+			const UINT32 mask = mCapacity - 1;
+
+			UINT32 index = (UINT32)(hash >> 7) & mask;
+			while (mCtrl[index] != CTRL_EMPTY)
+				index = (index + 1) & mask;
+
+			return index;
+		}
+
+		/** Inserts the entry if its key doesn't already exist. */
+		template<class EntryArg>
+		std::pair<iterator, bool> insertEntry(const Key& key, EntryArg&& entry)
+		{
+			bool found;
+			const UINT32 index = findOrPrepareInsert(key, found);
+			if (found)
+				return std::make_pair(iterator(this, index), false);
+
+			new (&mSlots[index]) Entry(std::forward<EntryArg>(entry));
+			mSize++;
+
+			return std::make_pair(iterator(this, index), true);
+		}
+
+		/** Destroys the entry in the provided slot and marks the slot as free. */
+		void eraseIndex(UINT32 index)
+		{
+			mSlots[index].~Entry();
+			mSize--;
+
+			// If the next slot is empty no probe sequence can continue past this slot, so it doesn't need a tombstone
+			if (mCtrl[(index + 1) & (mCapacity - 1)] == CTRL_EMPTY)
+				mCtrl[index] = CTRL_EMPTY;
+			else
+			{
+				mCtrl[index] = CTRL_DELETED;
+				mNumDeleted++;
+			}
+		}
+
+		/** Allocates storage for the provided number of slots, and marks all of them as empty. */
+		void allocate(UINT32 capacity)
+		{
+			UINT8* data = (UINT8*)bs_alloc(capacity * sizeof(Entry) + capacity);
+
+			mSlots = (Entry*)data;
+			mCtrl = data + capacity * sizeof(Entry);
+			mCapacity = capacity;
+
+			memset(mCtrl, CTRL_EMPTY, capacity);
+		}
+
+		/** Re-inserts all entries into a table of the provided capacity, removing any tombstones. */
+		void rehash(UINT32 capacity)
+		{
+			Entry* oldSlots = mSlots;
+			UINT8* oldCtrl = mCtrl;
+			const UINT32 oldCapacity = mCapacity;
+
+			allocate(capacity);
+			mNumDeleted = 0;
+
+			for (UINT32 i = 0; i < oldCapacity; i++)
+			{
+				if (!isFull(oldCtrl[i]))
+					continue;
+
+				const UINT64 hash = mixHash(mHasher(KeyOf()(oldSlots[i])));
+				const UINT32 index = findEmpty(hash);
+
+				mCtrl[index] = (UINT8)(hash & 0x7F);
+				new (&mSlots[index]) Entry(std::move(oldSlots[i]));
+				oldSlots[i].~Entry();
+			}
+
+			if (oldSlots != nullptr)
+				bs_free(oldSlots);
+		}
+
+		/** Copies all entries from another table into slots at the same positions. This table must be empty. */
+		void copyFrom(const TFlatHashTable& other)
+		{
+			if (other.mSize == 0)
+				return;
+
+			allocate(other.mCapacity);
+			memcpy(mCtrl, other.mCtrl, mCapacity);
+
+			for (UINT32 i = 0; i < mCapacity; i++)
+			{
+				if (isFull(mCtrl[i]))
+					new (&mSlots[i]) Entry(other.mSlots[i]);
+			}
+
+			mSize = other.mSize;
+			mNumDeleted = other.mNumDeleted;
+		}
+
+		/** Takes over the storage of another table, leaving it empty. This table must be empty. */
+		void steal(TFlatHashTable& other)
+		{
+			mSlots = other.mSlots;
+			mCtrl = other.mCtrl;
+			mCapacity = other.mCapacity;
+			mSize = other.mSize;
+			mNumDeleted = other.mNumDeleted;
+
+			other.mSlots = nullptr;
+			other.mCtrl = nullptr;
+			other.mCapacity = 0;
+			other.mSize = 0;
+			other.mNumDeleted = 0;
+		}
+
+		/** Destroys all entries and frees the storage. */
+		void destroy()
+		{
+			clear();
+
+			if (mSlots != nullptr)
+				bs_free(mSlots);
+
+			mSlots = nullptr;
+			mCtrl = nullptr;
+			mCapacity = 0;
+		}
+
+		Entry* mSlots = nullptr;
+		UINT8* mCtrl = nullptr;
+		UINT32 mCapacity = 0;
+		UINT32 mSize = 0;
+		UINT32 mNumDeleted = 0;
+
+		Hasher mHasher;
+		KeyEqual mKeyEqual;
+	};
+
+	/** Extracts the key from a key-value pair stored in a FlatHashMap. */
+	struct FlatHashMapKeyOf
+	{
+		template<class Key, class Value>
+		const Key& operator()(const std::pair<Key, Value>& entry) const { return entry.first; }
+	};
+
+	/** Extracts the key from an entry stored in a FlatHashSet (which is the entry itself). */
+	struct FlatHashSetKeyOf
+	{
+		template<class Key>
+		const Key& operator()(const Key& entry) const { return entry; }
+	};
+
+	/** @} */
+	/** @} */
+
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/**
+	 * An associative container containing an unordered set of key-value pairs. Unlike UnorderedMap all entries are
+	 * stored in a single contiguous array, so it performs no per-entry allocations and lookups don't chase pointers.
+	 *
+	 * Key-value pairs are stored as std::pair<Key, Value>. Keys must not be modified through iterators. Inserting new
+	 * entries may invalidate iterators and references to existing entries, while removing entries does not.
+	 */
+	template<class Key, class Value, class Hasher = HashType<Key>, class KeyEqual = std::equal_to<Key>>
+	class FlatHashMap : public TFlatHashTable<Key, std::pair<Key, Value>, FlatHashMapKeyOf, Hasher, KeyEqual>
+	{
+		typedef TFlatHashTable<Key, std::pair<Key, Value>, FlatHashMapKeyOf, Hasher, KeyEqual> Base;
+
+	public:
+		typedef Value mapped_type;
+
+		using Base::Base;
+		using Base::insert;
+
+		/** Returns the value with the provided key. Inserts a default constructed value if one doesn't exist. */
+		Value& operator[] (const Key& key)
+		{
+			return try_emplace(key).first->second;
+		}
+
+		/** @copydoc operator[](const Key&) */
+		Value& operator[] (Key&& key)
+		{
+			return try_emplace(std::move(key)).first->second;
+		}
+
+		/**
+		 * Inserts a new value constructed from @p args, unless the key already exists, in which case no value is
+		 * constructed. Returns an iterator to the entry with the key, and a boolean that is true if the insertion
+		 * took place.
+		 */
+		template<class KeyArg, class... Args>
+		std::pair<typename Base::iterator, bool> try_emplace(KeyArg&& key, Args&&... args)
+		{
+			bool found;
+			const UINT32 index = this->findOrPrepareInsert(key, found);
+			if (found)
+				return std::make_pair(typename Base::iterator(this, index), false);
+
+			new (&this->mSlots[index]) std::pair<Key, Value>(std::piecewise_construct,
+				std::forward_as_tuple(std::forward<KeyArg>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+			this->mSize++;
+
+			return std::make_pair(typename Base::iterator(this, index), true);
+		}
+
+		/** Returns the value with the provided key. The key must exist. */
+		Value& at(const Key& key)
+		{
+			auto iterFind = this->find(key);
+			assert(iterFind != this->end());
+
+			return iterFind->second;
+		}
+
+		/** @copydoc at(const Key&) */
+		const Value& at(const Key& key) const
+		{
+			auto iterFind = this->find(key);
+			assert(iterFind != this->end());
+
+			return iterFind->second;
+		}
+	};
+
+	/**
+	 * An associative container containing an unordered set of elements. Unlike UnorderedSet all elements are stored in
+	 * a single contiguous array, so it performs no per-element allocations and lookups don't chase pointers.
+	 *
+	 * Elements must not be modified through iterators in a way that changes their hash or equality. Inserting new
+	 * elements may invalidate iterators and references to existing elements, while removing elements does not.
+	 */
+	template<class Key, class Hasher = HashType<Key>, class KeyEqual = std::equal_to<Key>>
+	class FlatHashSet : public TFlatHashTable<Key, Key, FlatHashSetKeyOf, Hasher, KeyEqual>
+	{
+		typedef TFlatHashTable<Key, Key, FlatHashSetKeyOf, Hasher, KeyEqual> Base;
+
+	public:
+		using Base::Base;
+	};
+
+	/** @} */
+}
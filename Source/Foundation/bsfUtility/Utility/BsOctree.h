@@ -6,6 +6,7 @@
 #include "Math/BsMath.h"
 #include "Math/BsVector4I.h"
 #include "Math/BsSIMD.h"
+#include "Math/BsConvexVolume.h"
 #include "Allocators/BsPoolAlloc.h"
 
 namespace bs
@@ -245,12 +246,14 @@ namespace bs
 				auto childOffset = simd::load_splat<simd::float32x4>(&mChildOffset);
 
 				auto negativeCenter = simd::sub(nodeCenter, childOffset);
-				auto negativeDiff = simd::sub(queryCenter, negativeCenter);
-
 				auto positiveCenter = simd::add(nodeCenter, childOffset);
-				auto positiveDiff = simd::sub(positiveCenter, queryCenter);
 
-				auto diff = simd::min(negativeDiff, positiveDiff);
+				// Find node closest to the query center. The query must be fully contained within that node on both
+				// sides, otherwise elements straddling the outer node boundary could end up outside of their node.
+				simd::mask_float32x4 positiveMask = simd::cmp_gt(queryCenter, nodeCenter);
+				simd::float32x4 childCenter = simd::blend(positiveCenter, negativeCenter, positiveMask);
+
+				simd::float32x4 diff = simd::abs(simd::sub(queryCenter, childCenter));
 
 				auto queryExtents = simd::load<simd::float32x4>(&bounds.extents);
 				auto childExtent = simd::load_splat<simd::float32x4>(&mChildExtent);
@@ -263,9 +266,7 @@ namespace bs
 					auto ones = simd::make_uint<simd::uint32x4>(1, 1, 1, 1);
 					auto zeroes = simd::make_uint<simd::uint32x4>(0, 0, 0, 0);
 
-					// Find node closest to the query center
-					mask = simd::cmp_gt(queryCenter, nodeCenter);
-					auto result = simd::blend(ones, zeroes, mask);
+					auto result = simd::blend(ones, zeroes, positiveMask);
 
 					Vector4I scalarResult;
 					simd::store(&scalarResult, result);
@@ -556,6 +557,148 @@ namespace bs
 			simd::AABox mBounds;
 		};
 
+		/**
+		 * Iterator that iterates over all elements intersecting the specified convex volume (e.g. a view frustum). Nodes
+		 * fully inside the volume have all of their elements (and the elements of their child nodes) returned without
+		 * any further testing, while nodes only partially intersecting the volume have their elements and child nodes
+		 * tested individually.
+		 */
+		class VolumeIntersectIterator
+		{
+		public:
+			/**
+			 * Constructs an iterator that iterates over all elements in the specified tree that intersect the specified
+			 * volume. The volume must remain valid for as long as the iterator is in use.
+			 */
+			VolumeIntersectIterator(const Octree& tree, const ConvexVolume& volume)
+				:mPlanes(volume.getPlanes()), mStackAlloc(), mNodeStack(&mStackAlloc)
+			{
+				// Elements in the root node aren't guaranteed to lie within its bounds, so it's never treated as inside
+				mNodeStack.push_back(StackEntry(HNode(&tree.mRoot, tree.mRootBounds), false));
+			}
+
+			/** 
+			 * Returns the contents of the current element. moveNext() must be called at least once and it must return true
+			 * prior to attempting to access this data.
+			 */
+			const ElemType& getElement() const
+			{
+				return mElemIter.getCurrentElem();
+			}
+
+			/** 
+			 * Returns true if the current element belongs to a node fully inside the volume, in which case its bounds 
+			 * were not tested individually. moveNext() must be called at least once and it must return true prior to
+			 * attempting to access this data.
+			 */
+			bool isFullyInside() const { return mInside; }
+
+			/** 
+			 * Moves to the next intersecting element. Iterator starts at a position before the first element, therefore
+			 * this method must be called at least once before attempting to access the current element data. If the method
+			 * returns false it means iterator end has been reached and attempting to access data will result in an error.
+			 */
+			bool moveNext()
+			{
+				while(true)
+				{
+					// First check elements of the current node (if any)
+					while (mElemIter.moveNext())
+					{
+						if (mInside || classify(mElemIter.getCurrentBounds()) != Containment::Outside)
+							return true;
+					}
+
+					// No more elements in this node, move to the next one
+					if(mNodeStack.empty())
+						return false; // No more nodes to check
+
+					StackEntry entry = mNodeStack.back();
+					mNodeStack.erase(mNodeStack.end() - 1);
+
+					const Node* node = entry.node.getNode();
+					mElemIter = ElementIterator(node);
+					mInside = entry.inside;
+
+					// Add all child nodes that aren't fully outside the volume to the iterator
+					for(UINT32 i = 0; i < 8; i++)
+					{
+						if(!node->hasChild(i))
+							continue;
+
+						NodeBounds childBounds = entry.node.getBounds().getChild(i);
+
+						bool inside = mInside;
+						if(!inside)
+						{
+							Containment containment = classify(childBounds.getBounds());
+							if(containment == Containment::Outside)
+								continue;
+
+							inside = containment == Containment::Inside;
+						}
+
+						mNodeStack.push_back(StackEntry(HNode(node->getChild(i), childBounds), inside));
+					}
+				}
+
+				return false;
+			}
+
+		private:
+			/** Possible results of testing bounds against the volume. */
+			enum class Containment
+			{
+				Outside,
+				Intersecting,
+				Inside
+			};
+
+			/** Node waiting to be iterated over. */
+			struct StackEntry
+			{
+				StackEntry() = default;
+
+				StackEntry(const HNode& node, bool inside)
+					:node(node), inside(inside)
+				{ }
+
+				HNode node;
+				bool inside = false;
+			};
+
+			/** Determines if the provided bounds are outside, intersecting or fully inside the volume. */
+			Containment classify(const simd::AABox& bounds) const
+			{
+				Containment output = Containment::Inside;
+				for (auto& plane : mPlanes)
+				{
+					float dist = bounds.center.x * plane.normal.x + bounds.center.y * plane.normal.y +
+						bounds.center.z * plane.normal.z - plane.d;
+
+					float effectiveRadius = bounds.extents.x * Math::abs(plane.normal.x);
+					effectiveRadius += bounds.extents.y * Math::abs(plane.normal.y);
+					effectiveRadius += bounds.extents.z * Math::abs(plane.normal.z);
+
+					if (dist < -effectiveRadius)
+						return Containment::Outside;
+
+					if (dist < effectiveRadius)
+						output = Containment::Intersecting;
+				}
+
+				return output;
+			}
+
+			const Vector<Plane>& mPlanes;
+			ElementIterator mElemIter;
+			bool mInside = false;
+
+			// Stack entries contain SIMD types, so the static storage must respect their alignment
+			alignas(StackEntry) StaticAlloc<Options::MaxDepth * 8 * sizeof(StackEntry), FreeAlloc> mStackAlloc;
+			StaticVector<StackEntry, Options::MaxDepth * 8> mNodeStack;
+		};
+
 		/** 
 		 * Constructs an octree with the specified bounds. 
 		 * 
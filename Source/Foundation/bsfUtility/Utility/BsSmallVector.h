@@ -0,0 +1,433 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+namespace bs
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/**
+	 * Dynamically sized container that statically allocates enough room for @p N elements of type @p Type. If the
+	 * element count exceeds the statically allocated buffer size the vector falls back to general purpose dynamic
+	 * allocator. Provides a subset of the std::vector interface so it can be used as a drop-in replacement for small
+	 * containers on performance sensitive paths.
+	 *
+	 * Types that are trivially copyable are relocated with a plain memory copy when the vector grows or is moved.
+	 */
+	template <class Type, UINT32 N>
+	class SmallVector final
+	{
+		static_assert(N > 0, "SmallVector requires at least one element of static storage.");
+
+	public:
+		typedef Type value_type;
+		typedef Type* pointer;
+		typedef const Type* const_pointer;
+		typedef Type& reference;
+		typedef const Type& const_reference;
+		typedef Type* iterator;
+		typedef const Type* const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef UINT32 size_type;
+		typedef std::ptrdiff_t difference_type;
+
+		SmallVector() = default;
+
+		SmallVector(const SmallVector& other)
+		{
+			append(other.begin(), other.end());
+		}
+
+		SmallVector(SmallVector&& other)
+		{
+			steal(other);
+		}
+
+		explicit SmallVector(UINT32 size, const Type& value = Type())
+		{
+			reserve(size);
+
+			for (UINT32 i = 0; i < size; i++)
+				new (&mElements[i]) Type(value);
+
+			mSize = size;
+		}
+
+		SmallVector(std::initializer_list<Type> list)
+		{
+			append(list.begin(), list.end());
+		}
+
+		~SmallVector()
+		{
+			clear();
+			freeBuffer();
+		}
+
+		SmallVector& operator=(const SmallVector& other)
+		{
+			if (this == &other)
+				return *this;
+
+			clear();
+			append(other.begin(), other.end());
+
+			return *this;
+		}
+
+		SmallVector& operator=(SmallVector&& other)
+		{
+			if (this == &other)
+				return *this;
+
+			clear();
+			freeBuffer();
+			steal(other);
+
+			return *this;
+		}
+
+		SmallVector& operator=(std::initializer_list<Type> list)
+		{
+			clear();
+			append(list.begin(), list.end());
+
+			return *this;
+		}
+
+		bool operator== (const SmallVector& other) const
+		{
+			if (mSize != other.mSize)
+				return false;
+
+			return std::equal(begin(), end(), other.begin());
+		}
+
+		bool operator!= (const SmallVector& other) const
+		{
+			return !(*this == other);
+		}
+
+		Type& operator[] (UINT32 index)
+		{
+			assert(index < mSize && "Array index out-of-range.");
+			return mElements[index];
+		}
+
+		const Type& operator[] (UINT32 index) const
+		{
+			assert(index < mSize && "Array index out-of-range.");
+			return mElements[index];
+		}
+
+		/** Returns true if the vector contains no elements. */
+		bool empty() const { return mSize == 0; }
+
+		/** Returns the number of elements in the vector. */
+		UINT32 size() const { return mSize; }
+
+		/** Returns the number of elements the vector can hold before it needs to allocate more storage. */
+		UINT32 capacity() const { return mCapacity; }
+
+		/** Returns a pointer to the first element in the vector. */
+		Type* data() { return mElements; }
+
+		/** @copydoc data() */
+		const Type* data() const { return mElements; }
+
+		iterator begin() { return mElements; }
+		iterator end() { return mElements + mSize; }
+
+		const_iterator begin() const { return mElements; }
+		const_iterator end() const { return mElements + mSize; }
+
+		const_iterator cbegin() const { return mElements; }
+		const_iterator cend() const { return mElements + mSize; }
+
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+		/** Returns the first element in the vector. Vector must not be empty. */
+		Type& front()
+		{
+			assert(!empty());
+			return mElements[0];
+		}
+
+		/** @copydoc front() */
+		const Type& front() const
+		{
+			assert(!empty());
+			return mElements[0];
+		}
+
+		/** Returns the last element in the vector. Vector must not be empty. */
+		Type& back()
+		{
+			assert(!empty());
+			return mElements[mSize - 1];
+		}
+
+		/** @copydoc back() */
+		const Type& back() const
+		{
+			assert(!empty());
+			return mElements[mSize - 1];
+		}
+
+		/** Adds a new element to the end of the vector. */
+		void push_back(const Type& element)
+		{
+			emplace_back(element);
+		}
+
+		/** @copydoc push_back(const Type&) */
+		void push_back(Type&& element)
+		{
+			emplace_back(std::move(element));
+		}
+
+		/** Constructs a new element in-place at the end of the vector, using the provided constructor arguments. */
+		template<class ...Args>
+		Type& emplace_back(Args&&... args)
+		{
+			if (mSize == mCapacity)
+			{
+				// Construct the new element before moving the old ones, as the arguments might reference them
+				const UINT32 newCapacity = std::max(mCapacity * 2, mSize + 1);
+				Type* newElements = (Type*)bs_alloc(newCapacity * sizeof(Type));
+
+				new (&newElements[mSize]) Type(std::forward<Args>(args)...);
+				relocate(mElements, newElements, mSize);
+				freeBuffer();
+
+				mElements = newElements;
+				mCapacity = newCapacity;
+			}
+			else
+				new (&mElements[mSize]) Type(std::forward<Args>(args)...);
+
+			return mElements[mSize++];
+		}
+
+		/** Removes the last element from the vector. Vector must not be empty. */
+		void pop_back()
+		{
+			assert(!empty());
+
+			mSize--;
+			mElements[mSize].~Type();
+		}
+
+		/** Inserts a new element before the element pointed to by @p where. Returns an iterator to the new element. */
+		iterator insert(const_iterator where, const Type& element)
+		{
+			const UINT32 index = (UINT32)(where - begin());
+			emplace_back(element);
+
+			std::rotate(begin() + index, end() - 1, end());
+			return begin() + index;
+		}
+
+		/** @copydoc insert(const_iterator, const Type&) */
+		iterator insert(const_iterator where, Type&& element)
+		{
+			const UINT32 index = (UINT32)(where - begin());
+			emplace_back(std::move(element));
+
+			std::rotate(begin() + index, end() - 1, end());
+			return begin() + index;
+		}
+
+		/**
+		 * Inserts elements in range [@p first, @p last) before the element pointed to by @p where. Returns an iterator
+		 * to the first inserted element. The range must not reference elements of this vector.
+		 */
+		template<class InputIt>
+		iterator insert(const_iterator where, InputIt first, InputIt last)
+		{
+			const UINT32 index = (UINT32)(where - begin());
+			const UINT32 oldSize = mSize;
+
+			append(first, last);
+
+			std::rotate(begin() + index, begin() + oldSize, end());
+			return begin() + index;
+		}
+
+		/** Removes the element pointed to by @p where. Returns an iterator to the element following the removed one. */
+		iterator erase(const_iterator where)
+		{
+			iterator dest = begin() + (where - begin());
+			std::move(dest + 1, end(), dest);
+			pop_back();
+
+			return dest;
+		}
+
+		/**
+		 * Removes the elements in range [@p first, @p last). Returns an iterator to the element following the last
+		 * removed element.
+		 */
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			iterator dest = begin() + (first - begin());
+			if (first == last)
+				return dest;
+
+			iterator newEnd = std::move(begin() + (last - begin()), end(), dest);
+			for (iterator iter = newEnd; iter != end(); ++iter)
+				iter->~Type();
+
+			mSize = (UINT32)(newEnd - begin());
+			return dest;
+		}
+
+		/**
+		 * Changes the number of elements in the vector. New elements are default constructed, while elements past the
+		 * new size are destroyed.
+		 */
+		void resize(UINT32 size)
+		{
+			if (size > mSize)
+			{
+				reserve(size);
+
+				for (UINT32 i = mSize; i < size; i++)
+					new (&mElements[i]) Type();
+			}
+			else
+			{
+				for (UINT32 i = size; i < mSize; i++)
+					mElements[i].~Type();
+			}
+
+			mSize = size;
+		}
+
+		/** Changes the number of elements in the vector. New elements are copy constructed from @p value. */
+		void resize(UINT32 size, const Type& value)
+		{
+			if (size > mSize)
+			{
+				reserve(size);
+
+				for (UINT32 i = mSize; i < size; i++)
+					new (&mElements[i]) Type(value);
+			}
+			else
+			{
+				for (UINT32 i = size; i < mSize; i++)
+					mElements[i].~Type();
+			}
+
+			mSize = size;
+		}
+
+		/**
+		 * Ensures the vector has enough storage to hold at least @p capacity elements without further allocations.
+		 * Never reduces the capacity.
+		 */
+		void reserve(UINT32 capacity)
+		{
+			if (capacity <= mCapacity)
+				return;
+
+			Type* newElements = (Type*)bs_alloc(capacity * sizeof(Type));
+			relocate(mElements, newElements, mSize);
+			freeBuffer();
+
+			mElements = newElements;
+			mCapacity = capacity;
+		}
+
+		/** Destroys all elements in the vector. Keeps any allocated storage. */
+		void clear()
+		{
+			for (UINT32 i = 0; i < mSize; i++)
+				mElements[i].~Type();
+
+			mSize = 0;
+		}
+
+	private:
+		/** Returns true if the vector is currently using its internal (static) storage. */
+		bool isStatic() const { return mElements == (const Type*)mStorage; }
+
+		/** Frees the dynamic buffer, if any, and reverts to the internal storage. Elements must be destroyed. */
+		void freeBuffer()
+		{
+			if (!isStatic())
+			{
+				bs_free(mElements);
+
+				mElements = (Type*)mStorage;
+				mCapacity = N;
+			}
+		}
+
+		/** Copy constructs all elements in range [@p first, @p last) at the end of the vector. */
+		template<class InputIt>
+		void append(InputIt first, InputIt last)
+		{
+			const UINT32 count = (UINT32)std::distance(first, last);
+			reserve(mSize + count);
+
+			for (; first != last; ++first)
+				new (&mElements[mSize++]) Type(*first);
+		}
+
+		/** Takes over the contents of @p other, leaving it empty. This vector must be empty and static. */
+		void steal(SmallVector& other)
+		{
+			if (other.isStatic())
+			{
+				relocate(other.mElements, mElements, other.mSize);
+				mSize = other.mSize;
+			}
+			else
+			{
+				mElements = other.mElements;
+				mSize = other.mSize;
+				mCapacity = other.mCapacity;
+
+				other.mElements = (Type*)other.mStorage;
+				other.mCapacity = N;
+			}
+
+			other.mSize = 0;
+		}
+
+		/** Moves @p count elements from @p src into uninitialized memory at @p dst and destroys the source elements. */
+		static void relocate(Type* src, Type* dst, UINT32 count)
+		{
+			if (std::is_trivially_copyable<Type>::value)
+			{
+				if (count > 0)
+					memcpy((void*)dst, (void*)src, count * sizeof(Type));
+			}
+			else
+			{
+				for (UINT32 i = 0; i < count; i++)
+				{
+					new (&dst[i]) Type(std::move(src[i]));
+					src[i].~Type();
+				}
+			}
+		}
+
+		typename std::aligned_storage<sizeof(Type), alignof(Type)>::type mStorage[N];
+		Type* mElements = (Type*)mStorage;
+
+		UINT32 mSize = 0;
+		UINT32 mCapacity = N;
+	};
+
+	/** @} */
+}
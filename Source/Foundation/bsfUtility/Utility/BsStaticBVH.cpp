@@ -0,0 +1,353 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsStaticBVH.h"
+#include "Math/BsRay.h"
+#include "Math/BsMath.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs
+{
+	/** Minimum number of elements for which the tree is built in parallel. */
+	static constexpr UINT32 PARALLEL_BUILD_THRESHOLD = 4096;
+
+	/** Number of nodes on the same level processed by a single task when building the tree in parallel. */
+	static constexpr UINT32 PARALLEL_BUILD_GRAIN_SIZE = 16;
+
+	/**
+	 * Maximum depth of the tree. Nodes are split at the median so the depth is logarithmic in the element count, and
+	 * this is large enough for any count that fits in an UINT32.
+	 */
+	static constexpr UINT32 MAX_TREE_DEPTH = 64;
+
+	/** Range of elements that belong to a node that is being built. */
+	struct BuildRange
+	{
+		UINT32 first;
+		UINT32 count;
+	};
+
+	/** Returns the center of the element along the provided axis, scaled by two. */
+	static float getCenter2(const StaticBVH::Element& element, UINT32 axis)
+	{
+		return element.min[axis] + element.max[axis];
+	}
+
+	void StaticBVH::build(const AABox* bounds, UINT32 count)
+	{
+		clear();
+
+		if (count == 0)
+			return;
+
+		mElements.resize(count);
+		for (UINT32 i = 0; i < count; i++)
+		{
+			Element& element = mElements[i];
+			element.min = Vector3::min(bounds[i].getMin(), bounds[i].getMax());
+			element.max = Vector3::max(bounds[i].getMin(), bounds[i].getMax());
+			element.index = i;
+			element.padding = 0;
+		}
+
+		// Build the tree one level at a time, so that the nodes end up in breadth-first order and all the nodes of a
+		// level, whose elements never overlap, can be split in parallel
+		Vector<BuildRange> levelRanges = { { 0, count } };
+		Vector<BuildRange> nextLevelRanges;
+
+		auto splitNodes = [this, &levelRanges](UINT32 levelStart, UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+			{
+				const BuildRange& range = levelRanges[i];
+				Node& node = mNodes[levelStart + i];
+
+				const Element* elements = mElements.data() + range.first;
+				Vector3 centerMin = (elements[0].min + elements[0].max) * 0.5f;
+				Vector3 centerMax = centerMin;
+
+				node.min = elements[0].min;
+				node.max = elements[0].max;
+
+				for (UINT32 j = 1; j < range.count; j++)
+				{
+					const Element& element = elements[j];
+					Vector3 center = (element.min + element.max) * 0.5f;
+
+					node.min.floor(element.min);
+					node.max.ceil(element.max);
+					centerMin.floor(center);
+					centerMax.ceil(center);
+				}
+
+				if (range.count <= MAX_LEAF_SIZE)
+				{
+					node.start = range.first;
+					node.count = range.count;
+					continue;
+				}
+
+				Vector3 centerSize = centerMax - centerMin;
+				UINT32 axis = 0;
+				if (centerSize.y > centerSize[axis])
+					axis = 1;
+
+				if (centerSize.z > centerSize[axis])
+					axis = 2;
+
+				Element* first = mElements.data() + range.first;
+				Element* middle = first + range.count / 2;
+				std::nth_element(first, middle, first + range.count, [axis](const Element& a, const Element& b)
+				{
+					return getCenter2(a, axis) < getCenter2(b, axis);
+				});
+
+				// Children are assigned their location once the whole level is split
+				node.start = 0;
+				node.count = 0;
+			}
+		};
+
+		const bool parallel = TaskScheduler::isStarted() && count >= PARALLEL_BUILD_THRESHOLD;
+
+		UINT32 levelStart = 0;
+		while (!levelRanges.empty())
+		{
+			const UINT32 numLevelNodes = (UINT32)levelRanges.size();
+			mNodes.resize(levelStart + numLevelNodes);
+
+			if (parallel && numLevelNodes > PARALLEL_BUILD_GRAIN_SIZE)
+			{
+				TaskScheduler::instance().parallelFor(0, numLevelNodes, PARALLEL_BUILD_GRAIN_SIZE,
+					[&splitNodes, levelStart](UINT32 begin, UINT32 end) { splitNodes(levelStart, begin, end); });
+			}
+			else
+				splitNodes(levelStart, 0, numLevelNodes);
+
+			const UINT32 nextLevelStart = levelStart + numLevelNodes;
+
+			nextLevelRanges.clear();
+			for (UINT32 i = 0; i < numLevelNodes; i++)
+			{
+				Node& node = mNodes[levelStart + i];
+				if (node.isLeaf())
+					continue;
+
+				const BuildRange& range = levelRanges[i];
+				const UINT32 leftCount = range.count / 2;
+
+				node.start = nextLevelStart + (UINT32)nextLevelRanges.size();
+				nextLevelRanges.push_back({ range.first, leftCount });
+				nextLevelRanges.push_back({ range.first + leftCount, range.count - leftCount });
+			}
+
+			std::swap(levelRanges, nextLevelRanges);
+			levelStart = nextLevelStart;
+		}
+	}
+
+	void StaticBVH::clear()
+	{
+		mNodes.clear();
+		mElements.clear();
+	}
+
+	void StaticBVH::addAll(const Node& node, UINT32* output) const
+	{
+		UINT32 stack[MAX_TREE_DEPTH];
+		UINT32 stackSize = 0;
+
+		const Node* current = &node;
+		while (true)
+		{
+			if (current->isLeaf())
+			{
+				for (UINT32 i = 0; i < current->count; i++)
+				{
+					const UINT32 index = mElements[current->start + i].index;
+					output[index / BITS_PER_WORD] |= 1U << (index % BITS_PER_WORD);
+				}
+
+				if (stackSize == 0)
+					break;
+
+				current = &mNodes[stack[--stackSize]];
+			}
+			else
+			{
+				stack[stackSize++] = current->start + 1;
+				current = &mNodes[current->start];
+			}
+		}
+	}
+
+	void StaticBVH::findIntersecting(const ConvexVolume& volume, UINT32* output) const
+	{
+		if (mNodes.empty())
+			return;
+
+		enum class Overlap { Outside, Intersects, Inside };
+
+		const Vector<Plane>& planes = volume.getPlanes();
+		auto testBox = [&planes](const Vector3& min, const Vector3& max)
+		{
+			const Vector3 center = (min + max) * 0.5f;
+			const Vector3 extents = (max - min) * 0.5f;
+
+			Overlap overlap = Overlap::Inside;
+			for (auto& plane : planes)
+			{
+				float dist = center.dot(plane.normal) - plane.d;
+				float effectiveRadius = extents.x * Math::abs(plane.normal.x) + extents.y * Math::abs(plane.normal.y) +
+					extents.z * Math::abs(plane.normal.z);
+
+				if (dist < -effectiveRadius)
+					return Overlap::Outside;
+
+				if (dist < effectiveRadius)
+					overlap = Overlap::Intersects;
+			}
+
+			return overlap;
+		};
+
+		UINT32 stack[MAX_TREE_DEPTH];
+		UINT32 stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0)
+		{
+			const Node& node = mNodes[stack[--stackSize]];
+
+			Overlap overlap = testBox(node.min, node.max);
+			if (overlap == Overlap::Outside)
+				continue;
+
+			if (overlap == Overlap::Inside)
+			{
+				addAll(node, output);
+				continue;
+			}
+
+			if (!node.isLeaf())
+			{
+				stack[stackSize++] = node.start + 1;
+				stack[stackSize++] = node.start;
+				continue;
+			}
+
+			for (UINT32 i = 0; i < node.count; i++)
+			{
+				const Element& element = mElements[node.start + i];
+				if (testBox(element.min, element.max) != Overlap::Outside)
+					output[element.index / BITS_PER_WORD] |= 1U << (element.index % BITS_PER_WORD);
+			}
+		}
+	}
+
+	void StaticBVH::findIntersecting(const AABox& box, UINT32* output) const
+	{
+		if (mNodes.empty())
+			return;
+
+		const Vector3 boxMin = Vector3::min(box.getMin(), box.getMax());
+		const Vector3 boxMax = Vector3::max(box.getMin(), box.getMax());
+
+		auto overlaps = [&boxMin, &boxMax](const Vector3& min, const Vector3& max)
+		{
+			return min.x <= boxMax.x && max.x >= boxMin.x &&
+				min.y <= boxMax.y && max.y >= boxMin.y &&
+				min.z <= boxMax.z && max.z >= boxMin.z;
+		};
+
+		UINT32 stack[MAX_TREE_DEPTH];
+		UINT32 stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0)
+		{
+			const Node& node = mNodes[stack[--stackSize]];
+			if (!overlaps(node.min, node.max))
+				continue;
+
+			if (!node.isLeaf())
+			{
+				stack[stackSize++] = node.start + 1;
+				stack[stackSize++] = node.start;
+				continue;
+			}
+
+			for (UINT32 i = 0; i < node.count; i++)
+			{
+				const Element& element = mElements[node.start + i];
+				if (overlaps(element.min, element.max))
+					output[element.index / BITS_PER_WORD] |= 1U << (element.index % BITS_PER_WORD);
+			}
+		}
+	}
+
+	void StaticBVH::findIntersecting(const Ray& ray, UINT32* output) const
+	{
+		if (mNodes.empty())
+			return;
+
+		const Vector3& origin = ray.getOrigin();
+		const Vector3& direction = ray.getDirection();
+
+		// Use a very large value instead of infinity for axes the ray is parallel to, so that the slab distances of
+		// origins on the slab boundary don't evaluate to NaN
+		auto inverse = [](float value)
+		{
+			static constexpr float LARGE_VALUE = 1e30f;
+
+			if (value == 0.0f)
+				return LARGE_VALUE;
+
+			return Math::clamp(1.0f / value, -LARGE_VALUE, LARGE_VALUE);
+		};
+
+		const Vector3 invDirection(inverse(direction.x), inverse(direction.y), inverse(direction.z));
+
+		// Slab test, the ray hits the box if the intervals in which it is within each slab overlap
+		auto hits = [&origin, &invDirection](const Vector3& min, const Vector3& max)
+		{
+			float nearT = 0.0f;
+			float farT = std::numeric_limits<float>::max();
+
+			for (UINT32 i = 0; i < 3; i++)
+			{
+				float t0 = (min[i] - origin[i]) * invDirection[i];
+				float t1 = (max[i] - origin[i]) * invDirection[i];
+
+				nearT = std::max(nearT, std::min(t0, t1));
+				farT = std::min(farT, std::max(t0, t1));
+			}
+
+			return nearT <= farT;
+		};
+
+		UINT32 stack[MAX_TREE_DEPTH];
+		UINT32 stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0)
+		{
+			const Node& node = mNodes[stack[--stackSize]];
+			if (!hits(node.min, node.max))
+				continue;
+
+			if (!node.isLeaf())
+			{
+				stack[stackSize++] = node.start + 1;
+				stack[stackSize++] = node.start;
+				continue;
+			}
+
+			for (UINT32 i = 0; i < node.count; i++)
+			{
+				const Element& element = mElements[node.start + i];
+				if (hits(element.min, element.max))
+					output[element.index / BITS_PER_WORD] |= 1U << (element.index % BITS_PER_WORD);
+			}
+		}
+	}
+}
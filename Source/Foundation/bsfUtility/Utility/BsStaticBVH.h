@@ -0,0 +1,117 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Math/BsVector3.h"
+#include "Math/BsAABox.h"
+#include "Math/BsConvexVolume.h"
+
+namespace bs
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/**
+	 * Bounding volume hierarchy built once from a fixed set of bounds, meant for read-mostly data such as static level
+	 * geometry or probes. Unlike Octree it doesn't support adding or removing elements, but both the nodes and the
+	 * elements are stored in contiguous arrays: nodes in breadth-first order with siblings next to each other, and
+	 * elements in the order their leaves are laid out.
+	 *
+	 * Queries write their results into a bitmask with one bit per element, using the same layout as BoundsArray.
+	 * Element with index i (its index in the array the tree was built from) maps to bit (i % 32) of word (i / 32), and
+	 * queries only ever set bits.
+	 */
+	class BS_UTILITY_EXPORT StaticBVH
+	{
+	public:
+		/** Maximum number of elements stored in a single leaf node. */
+		static constexpr UINT32 MAX_LEAF_SIZE = 4;
+
+		/** Number of elements whose intersection results are stored in a single word of the output mask. */
+		static constexpr UINT32 BITS_PER_WORD = 32;
+
+		/** Node of the tree. */
+		struct Node
+		{
+			Vector3 min;
+			/** Index of the first child node for interior nodes, or of the first element for leaf nodes. */
+			UINT32 start;
+			Vector3 max;
+			/** Number of elements in a leaf node, or zero for interior nodes, which always have two children. */
+			UINT32 count;
+
+			bool isLeaf() const { return count > 0; }
+		};
+
+		/** Element stored in a leaf of the tree. */
+		struct Element
+		{
+			Vector3 min;
+			/** Index of the element in the array the tree was built from. */
+			UINT32 index;
+			Vector3 max;
+			UINT32 padding;
+		};
+
+		StaticBVH() = default;
+
+		/**
+		 * Builds the tree from the provided set of bounds, replacing any existing contents. Nodes are split at the
+		 * median of the element centers along the longest axis. When the TaskScheduler is running, all the nodes on the
+		 * same level of the tree are split in parallel.
+		 */
+		void build(const AABox* bounds, UINT32 count);
+
+		/** Removes all elements from the tree. */
+		void clear();
+
+		/** Returns the number of elements in the tree. */
+		UINT32 size() const { return (UINT32)mElements.size(); }
+
+		/** Returns the number of words required for a mask holding the results of a query on all elements. */
+		UINT32 getMaskWordCount() const { return (size() + BITS_PER_WORD - 1) / BITS_PER_WORD; }
+
+		/** Returns all the nodes of the tree in breadth-first order, starting with the root. */
+		const Vector<Node>& getNodes() const { return mNodes; }
+
+		/** Returns all the elements of the tree, in the order they are referenced by the leaf nodes. */
+		const Vector<Element>& getElements() const { return mElements; }
+
+		/**
+		 * Sets the mask bits for all elements whose bounds intersect the provided volume. Elements of nodes fully
+		 * inside the volume are reported without being tested individually.
+		 *
+		 * @param[in]	volume		Volume to test the bounds against.
+		 * @param[out]	output		Mask to write the results to, at least getMaskWordCount() words large.
+		 */
+		void findIntersecting(const ConvexVolume& volume, UINT32* output) const;
+
+		/**
+		 * Sets the mask bits for all elements whose bounds overlap the provided box.
+		 *
+		 * @param[in]	box			Box to test the bounds against.
+		 * @param[out]	output		Mask to write the results to, at least getMaskWordCount() words large.
+		 */
+		void findIntersecting(const AABox& box, UINT32* output) const;
+
+		/**
+		 * Sets the mask bits for all elements whose bounds are hit by the provided ray. Only intersections in front of
+		 * the ray origin are considered, same as Ray::intersects(const AABox&).
+		 *
+		 * @param[in]	ray			Ray to test the bounds against.
+		 * @param[out]	output		Mask to write the results to, at least getMaskWordCount() words large.
+		 */
+		void findIntersecting(const Ray& ray, UINT32* output) const;
+
+	private:
+		/** Sets the mask bits for all elements of the provided node and its descendants. */
+		void addAll(const Node& node, UINT32* output) const;
+
+		Vector<Node> mNodes;
+		Vector<Element> mElements;
+	};
+
+	/** @} */
+}
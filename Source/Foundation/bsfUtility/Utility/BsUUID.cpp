@@ -43,129 +43,104 @@ namespace bs
 		if (uuid.size() < 36)
 			return;
 
-		UINT32 idx = 0;
-
-		// First group: 8 digits
-		for(INT32 i = 7; i >= 0; --i)
+		// Digits map to the data words in order, most significant nibble first, with dashes in between the groups
+		UINT32 digitIdx = 0;
+		for (UINT32 i = 0; i < 36; i++)
 		{
-			char charVal = uuid[idx++];
-			UINT8 hexVal = LITERAL_TO_HEX[(int)charVal];
-
-			mData[0] |= hexVal << (i * 4);
-		}
+			if (i == 8 || i == 13 || i == 18 || i == 23)
+				continue;
 
-		idx++;
-		
-		// Second group: 4 digits
-		for(INT32 i = 7; i >= 4; --i)
-		{
-			char charVal = uuid[idx++];
-			UINT8 hexVal = LITERAL_TO_HEX[(int)charVal];
+			UINT8 hexVal = LITERAL_TO_HEX[(UINT8)uuid[i]];
+			mData[digitIdx / 8] |= hexVal << ((7 - (digitIdx % 8)) * 4);
 
-			mData[1] |= hexVal << (i * 4);
+			digitIdx++;
 		}
+	}
 
-		idx++;
-
-		// Third group: 4 digits
-		for(INT32 i = 3; i >= 0; --i)
-		{
-			char charVal = uuid[idx++];
-			UINT8 hexVal = LITERAL_TO_HEX[(int)charVal];
-
-			mData[1] |= hexVal << (i * 4);
-		}
+	String UUID::toString() const
+	{
+		String output(36, '-');
+		toString(&output[0]);
 
-		idx++;
+		return output;
+	}
 
-		// Fourth group: 4 digits
-		for(INT32 i = 7; i >= 4; --i)
+	void UUID::toString(char* output) const
+	{
+		UINT32 idx = 0;
+		for (UINT32 i = 0; i < 4; i++)
 		{
-			char charVal = uuid[idx++];
-			UINT8 hexVal = LITERAL_TO_HEX[(int)charVal];
-
-			mData[2] |= hexVal << (i * 4);
+			for (INT32 j = 3; j >= 0; --j)
+			{
+				if (idx == 8 || idx == 13 || idx == 18 || idx == 23)
+					output[idx++] = '-';
+
+				UINT32 byteVal = (mData[i] >> (j * 8)) & 0xFF;
+				output[idx++] = HEX_TO_LITERAL[byteVal >> 4];
+				output[idx++] = HEX_TO_LITERAL[byteVal & 0xF];
+			}
 		}
+	}
 
-		idx++;
-
-		// Fifth group: 12 digits
-		for(INT32 i = 3; i >= 0; --i)
-		{
-			char charVal = uuid[idx++];
-			UINT8 hexVal = LITERAL_TO_HEX[(int)charVal];
+	/** State of the xoshiro256** generator used for generating UUIDs on the current thread. */
+	static BS_THREADLOCAL UINT64 sGeneratorState[4];
+	static BS_THREADLOCAL bool sGeneratorSeeded = false;
 
-			mData[2] |= hexVal << (i * 4);
-		}
-
-		for(INT32 i = 7; i >= 0; --i)
-		{
-			char charVal = uuid[idx++];
-			UINT8 hexVal = LITERAL_TO_HEX[(int)charVal];
+	/** Returns the next value from the splitmix64 sequence, used for expanding the seed into the generator state. */
+	static UINT64 splitMix64(UINT64& state)
+	{
+		UINT64 value = (state += 0x9E3779B97F4A7C15ULL);
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
 
-			mData[3] |= hexVal << (i * 4);
-		}
+		return value ^ (value >> 31);
 	}
 
-	String UUID::toString() const
+	/** Returns the next value from the thread's xoshiro256** generator. */
+	static UINT64 nextRandom64()
 	{
-		UINT8 output[36];
-		UINT32 idx = 0;
+		UINT64* s = sGeneratorState;
 
-		// First group: 8 digits
-		for(INT32 i = 7; i >= 0; --i)
-		{
-			UINT32 hexVal = (mData[0] >> (i * 4)) & 0xF;
-			output[idx++] = HEX_TO_LITERAL[hexVal];
-		}
+		auto rotl = [](UINT64 x, INT32 k) { return (x << k) | (x >> (64 - k)); };
+		const UINT64 result = rotl(s[1] * 5, 7) * 9;
+		const UINT64 t = s[1] << 17;
 
-		output[idx++] = '-';
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = rotl(s[3], 45);
 
-		// Second group: 4 digits
-		for(INT32 i = 7; i >= 4; --i)
-		{
-			UINT32 hexVal = (mData[1] >> (i * 4)) & 0xF;
-			output[idx++] = HEX_TO_LITERAL[hexVal];
-		}
-
-		output[idx++] = '-';
+		return result;
+	}
 
-		// Third group: 4 digits
-		for(INT32 i = 3; i >= 0; --i)
+	UUID UUIDGenerator::generateRandom()
+	{
+		if (!sGeneratorSeeded)
 		{
-			UINT32 hexVal = (mData[1] >> (i * 4)) & 0xF;
-			output[idx++] = HEX_TO_LITERAL[hexVal];
-		}
+			// Seed from the platform generator so different threads and processes produce different sequences
+			const UUID seeds[2] = { PlatformUtility::generateUUID(), PlatformUtility::generateUUID() };
+			for (UINT32 i = 0; i < 4; i++)
+			{
+				const UINT32* seedData = seeds[i / 2].mData + (i % 2) * 2;
+				UINT64 seedValue = ((UINT64)seedData[0] << 32) | seedData[1];
 
-		output[idx++] = '-';
+				sGeneratorState[i] = splitMix64(seedValue);
+			}
 
-		// Fourth group: 4 digits
-		for(INT32 i = 7; i >= 4; --i)
-		{
-			UINT32 hexVal = (mData[2] >> (i * 4)) & 0xF;
-			output[idx++] = HEX_TO_LITERAL[hexVal];
+			sGeneratorSeeded = true;
 		}
 
-		output[idx++] = '-';
+		const UINT64 low = nextRandom64();
+		const UINT64 high = nextRandom64();
 
-		// Fifth group: 12 digits
-		for(INT32 i = 3; i >= 0; --i)
-		{
-			UINT32 hexVal = (mData[2] >> (i * 4)) & 0xF;
-			output[idx++] = HEX_TO_LITERAL[hexVal];
-		}
+		UINT32 data[4] = { (UINT32)(low >> 32), (UINT32)low, (UINT32)(high >> 32), (UINT32)high };
 
-		for(INT32 i = 7; i >= 0; --i)
-		{
-			UINT32 hexVal = (mData[3] >> (i * 4)) & 0xF;
-			output[idx++] = HEX_TO_LITERAL[hexVal];
-		}
-
-		return String((const char*)output, 36);
-	}
+		// Version 4 in the high nibble of the third group, RFC 4122 variant in the high bits of the fourth group
+		data[1] = (data[1] & 0xFFFF0FFF) | 0x00004000;
+		data[2] = (data[2] & 0x3FFFFFFF) | 0x80000000;
 
-	UUID UUIDGenerator::generateRandom()
-	{
-		return PlatformUtility::generateUUID();
+		return UUID(data[0], data[1], data[2], data[3]);
 	}
 }
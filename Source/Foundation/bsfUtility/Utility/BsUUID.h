@@ -63,9 +63,16 @@ namespace bs
 		/** Converts the UUID into its string representation. */
 		String toString() const;
 
+		/**
+		 * Writes the string representation of the UUID into the provided buffer, without allocating any memory. Buffer
+		 * must have room for at least 36 characters. No null terminator is written.
+		 */
+		void toString(char* output) const;
+
 		static UUID EMPTY;
 	private:
 		friend struct std::hash<UUID>;
+		friend class UUIDGenerator;
 
 		UINT32 mData[4] = {0, 0, 0, 0};
 	};
@@ -80,7 +87,11 @@ namespace bs
 	class BS_UTILITY_EXPORT UUIDGenerator
 	{
 	public:
-		/**	Generate a new random universally unique identifier. */
+		/**
+		 * Generate a new random (version 4) universally unique identifier. Identifiers are generated using a
+		 * per-thread pseudo-random generator, seeded from the platform UUID generator when first used on a thread,
+		 * making this method cheap enough for creating many objects at once.
+		 */
 		static UUID generateRandom();
 	};
 
@@ -100,13 +111,15 @@ struct hash<bs::UUID>
 {
 	size_t operator()(const bs::UUID& value) const
 	{
-		size_t hash = 0;
-		bs::hash_combine(hash, value.mData[0]);
-		bs::hash_combine(hash, value.mData[1]);
-		bs::hash_combine(hash, value.mData[2]);
-		bs::hash_combine(hash, value.mData[3]);
+		// Random UUIDs are already well distributed, so it is enough to fold the two halves together. Multiplication
+		// ensures UUIDs with structured values still use all the bits of the hash.
+		const bs::UINT64 low = ((bs::UINT64)value.mData[0] << 32) | value.mData[1];
+		const bs::UINT64 high = ((bs::UINT64)value.mData[2] << 32) | value.mData[3];
+
+		bs::UINT64 hash = (low ^ high) * 0x9E3779B97F4A7C15ULL;
+		hash ^= hash >> 32;
 
-		return hash;
+		return (size_t)hash;
 	}
 };
 }
@@ -1,6 +1,7 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsD3D11CommandBuffer.h"
+#include "BsD3D11Device.h"
 
 namespace bs { namespace ct
 {
@@ -9,11 +10,40 @@ namespace bs { namespace ct
 	{
 		if (deviceIdx != 0)
 			BS_EXCEPT(InvalidParametersException, "Only a single device supported on DX11.");
+
+		D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+		if (rapi->supportsCommandLists())
+		{
+			ID3D11Device* device = rapi->getPrimaryDevice().getD3D11Device();
+			if (SUCCEEDED(device->CreateDeferredContext(0, &mDeferredContext)))
+				mDeferredState.context = mDeferredContext;
+			else
+				mDeferredContext = nullptr;
+		}
+	}
+
+	D3D11CommandBuffer::~D3D11CommandBuffer()
+	{
+		if (mDeferredContext != nullptr)
+		{
+			clear();
+			mDeferredContext->Release();
+		}
 	}
 
 	void D3D11CommandBuffer::queueCommand(const std::function<void()> command)
 	{
-		mCommands.push_back(command);
+		if (mDeferredContext == nullptr)
+		{
+			mCommands.push_back(command);
+			return;
+		}
+
+		D3D11ContextState* prevState = D3D11RenderAPI::_setActiveState(&mDeferredState);
+		command();
+		D3D11RenderAPI::_setActiveState(prevState);
+
+		mHasRecordedCommands = true;
 	}
 
 	void D3D11CommandBuffer::appendSecondary(const SPtr<D3D11CommandBuffer>& secondaryBuffer)
@@ -32,8 +62,28 @@ namespace bs { namespace ct
 		}
 #endif
 
-		for (auto& entry : secondaryBuffer->mCommands)
-			mCommands.push_back(entry);
+		if (secondaryBuffer->mDeferredContext == nullptr)
+		{
+			for (auto& entry : secondaryBuffer->mCommands)
+				queueCommand(entry);
+
+			return;
+		}
+
+		ID3D11CommandList* commandList = secondaryBuffer->finishCommandList();
+		if (commandList == nullptr)
+			return;
+
+		auto execute = [commandList]()
+		{
+			D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+
+			// Restore the context state after the list executes, as the secondary buffer starts from default state
+			rapi->getActiveContext()->ExecuteCommandList(commandList, TRUE);
+			commandList->Release();
+		};
+
+		queueCommand(execute);
 	}
 
 	void D3D11CommandBuffer::executeCommands()
@@ -46,12 +96,46 @@ namespace bs { namespace ct
 		}
 #endif
 
-		for (auto& entry : mCommands)
-			entry();
+		if (mDeferredContext == nullptr)
+		{
+			for (auto& entry : mCommands)
+				entry();
+
+			return;
+		}
+
+		D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+		ID3D11CommandList* commandList = finishCommandList();
+		if (commandList == nullptr)
+			return;
+
+		rapi->getPrimaryDevice().getImmediateContext()->ExecuteCommandList(commandList, TRUE);
+		commandList->Release();
 	}
 
 	void D3D11CommandBuffer::clear()
 	{
 		mCommands.clear();
+
+		// Discard anything recorded since the list was last finished
+		if (mDeferredContext != nullptr && mHasRecordedCommands)
+		{
+			ID3D11CommandList* commandList = finishCommandList();
+			SAFE_RELEASE(commandList);
+		}
+	}
+
+	ID3D11CommandList* D3D11CommandBuffer::finishCommandList()
+	{
+		ID3D11CommandList* commandList = nullptr;
+		if (FAILED(mDeferredContext->FinishCommandList(FALSE, &commandList)))
+			LOGERR("Failed to finish a D3D11 command list.");
+
+		// Finishing the list resets the deferred context to default state
+		mDeferredState = D3D11ContextState();
+		mDeferredState.context = mDeferredContext;
+		mHasRecordedCommands = false;
+
+		return commandList;
 	}
-}}
\ No newline at end of file
+}}
@@ -13,13 +13,21 @@ namespace bs { namespace ct
 	 */
 
 	/**
-	 * Command buffer implementation for DirectX 11, which doesn't support multi-threaded command generation. Instead all
-	 * commands are stored in an internal buffer, and then sent to the actual render API when the buffer is executed.
+	 * Command buffer implementation for DirectX 11. If the driver supports command lists (see
+	 * D3D11RenderAPI::supportsCommandLists()) commands are recorded on a deferred context as they are queued, which
+	 * allows multiple buffers to be recorded in parallel from different threads. The recorded command list is then
+	 * executed on the immediate context when the buffer is submitted. Otherwise all commands are stored in an internal
+	 * buffer, and then sent to the immediate context when the buffer is executed.
 	 */
 	class D3D11CommandBuffer : public CommandBuffer
 	{
 	public:
-		/** Registers a new command in the command buffer. */
+		~D3D11CommandBuffer();
+
+		/**
+		 * Registers a new command in the command buffer. If the buffer records on a deferred context the command is
+		 * executed immediately, on the calling thread.
+		 */
 		void queueCommand(const std::function<void()> command);
 
 		/** Appends all commands from the secondary buffer into this command buffer. */
@@ -37,8 +45,15 @@ namespace bs { namespace ct
 
 		D3D11CommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary);
 
+		/** Closes the deferred context's command list and returns it. Caller must release the list. */
+		ID3D11CommandList* finishCommandList();
+
 		Vector<std::function<void()>> mCommands;
 
+		ID3D11DeviceContext* mDeferredContext = nullptr;
+		D3D11ContextState mDeferredState;
+		bool mHasRecordedCommands = false;
+
 		DrawOperationType mActiveDrawOp;
 	};
 
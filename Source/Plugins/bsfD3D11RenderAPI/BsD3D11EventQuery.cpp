@@ -46,7 +46,10 @@ namespace bs { namespace ct
 	{
 		auto execute = [&]()
 		{
-			mContext->End(mQuery);
+			D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+			ID3D11DeviceContext* context = rapi->getActiveContext();
+
+			context->End(mQuery);
 			setActive(true);
 		};
 
@@ -22,9 +22,19 @@ namespace bs { namespace ct
 		assert((deviceMask == GDF_DEFAULT || deviceMask == GDF_PRIMARY) && "Multiple GPUs not supported natively on DirectX 11.");
 	}
 
+	D3D11GpuBuffer::D3D11GpuBuffer(const GPU_BUFFER_DESC& desc, D3D11HardwareBuffer* buffer, 
+		const SPtr<VertexBuffer>& source)
+		: GpuBuffer(desc, GDF_DEFAULT), mBuffer(buffer)
+	{
+		mSourceVertexBuffer = source;
+	}
+
 	D3D11GpuBuffer::~D3D11GpuBuffer()
 	{ 
-		bs_delete(mBuffer);
+		// Memory of buffers created from vertex buffers is owned by the vertex buffer
+		if (mSourceVertexBuffer == nullptr)
+			bs_delete(mBuffer);
+
 		clearBufferViews();
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuBuffer);
 	}
@@ -51,8 +61,12 @@ namespace bs { namespace ct
 			BS_EXCEPT(InvalidParametersException, "Unsupported buffer type " + toString(props.getType()));
 		}
 
-		mBuffer = bs_new<D3D11HardwareBuffer>(bufferType, props.getUsage(), props.getElementCount(), props.getElementSize(),
-			d3d11rs->getPrimaryDevice(), false, false, props.getRandomGpuWrite(), props.getUseCounter());
+		if (mBuffer == nullptr)
+		{
+			mBuffer = bs_new<D3D11HardwareBuffer>(bufferType, props.getUsage(), props.getElementCount(), 
+				props.getElementSize(), d3d11rs->getPrimaryDevice(), false, false, props.getRandomGpuWrite(), 
+				props.getUseCounter());
+		}
 
 		SPtr<D3D11GpuBuffer> thisPtr = std::static_pointer_cast<D3D11GpuBuffer>(getThisPtr());
 		UINT32 usage = GVU_DEFAULT;
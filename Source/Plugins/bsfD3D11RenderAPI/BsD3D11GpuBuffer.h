@@ -71,9 +71,13 @@ namespace bs { namespace ct
 
 	protected:
 		friend class D3D11HardwareBufferManager;
+		friend class D3D11VertexBuffer;
 
 		D3D11GpuBuffer(const GPU_BUFFER_DESC& desc, GpuDeviceFlags deviceMask);
 
+		/** Creates a buffer that shares the memory of a vertex buffer. See VertexBuffer::getLoadStore(). */
+		D3D11GpuBuffer(const GPU_BUFFER_DESC& desc, D3D11HardwareBuffer* buffer, const SPtr<VertexBuffer>& source);
+
 		/**	Destroys all buffer views regardless if their reference count is zero or not. */
 		void clearBufferViews();
 
@@ -227,4 +227,14 @@ namespace bs { namespace ct
 		SAFE_RELEASE(microcode);
 		return bytecode;
 	}
+	String D3D11HLSLProgramFactory::getCompilerVersion() const
+	{
+		String version = "D3DCompiler_" + toString(D3D_COMPILER_VERSION);
+
+#if defined(BS_DEBUG_MODE)
+		version += "_debug";
+#endif
+
+		return version;
+	}
 }}
@@ -3,6 +3,7 @@
 #include "BsD3D11HardwareBuffer.h"
 #include "BsD3D11Mappings.h"
 #include "BsD3D11Device.h"
+#include "BsD3D11RenderAPI.h"
 #include "Error/BsException.h"
 #include "Debug/BsDebug.h"
 #include "BsD3D11CommandBuffer.h"
@@ -16,7 +17,7 @@ namespace bs { namespace ct
 		, mElementSize(elementSize), mUsage(usage), mRandomGpuWrite(randomGpuWrite), mUseCounter(useCounter)
 	{
 		assert((!streamOut || btype == BT_VERTEX) && "Stream out flag is only supported on vertex buffers.");
-		assert(!randomGpuWrite || (btype & BT_GROUP_GENERIC) != 0 && "randomGpuWrite flag can only be enabled with standard, append/consume, indirect argument, structured or raw buffers.");
+		assert(!randomGpuWrite || (btype & BT_GROUP_GENERIC) != 0 || btype == BT_VERTEX && "randomGpuWrite flag can only be enabled with vertex, standard, append/consume, indirect argument, structured or raw buffers.");
 		assert(btype != BT_APPENDCONSUME || randomGpuWrite && "Append/Consume buffer must be created with randomGpuWrite enabled.");
 		assert(!useCounter || btype == BT_STRUCTURED && "Counter can only be used with a structured buffer.");
 		assert(!useCounter || randomGpuWrite && "Counter can only be used with buffers that have randomGpuWrite enabled.");
@@ -41,6 +42,10 @@ namespace bs { namespace ct
 
 			switch (btype)
 			{
+			case BT_VERTEX:
+				// Accessed from GPU programs through typed views, in addition to being bound as a vertex buffer
+				mDesc.BindFlags |= D3D11_BIND_VERTEX_BUFFER;
+				break;
 			case BT_STRUCTURED:
 			case BT_APPENDCONSUME:
 				mDesc.StructureByteStride = elementSize;
@@ -235,11 +240,14 @@ namespace bs { namespace ct
 	{
 		auto executeRef = [this](HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length)
 		{
+			D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+			ID3D11DeviceContext* context = rapi->getActiveContext();
+
 			// If we're copying same-size buffers in their entirety
 			if (srcOffset == 0 && dstOffset == 0 &&
 				length == mSize && mSize == srcBuffer.getSize())
 			{
-				mDevice.getImmediateContext()->CopyResource(mD3DBuffer, 
+				context->CopyResource(mD3DBuffer, 
 					static_cast<D3D11HardwareBuffer&>(srcBuffer).getD3DBuffer());
 				if (mDevice.hasError())
 				{
@@ -258,7 +266,7 @@ namespace bs { namespace ct
 				srcBox.front = 0;
 				srcBox.back = 1;
 
-				mDevice.getImmediateContext()->CopySubresourceRegion(mD3DBuffer, 0, (UINT)dstOffset, 0, 0,
+				context->CopySubresourceRegion(mD3DBuffer, 0, (UINT)dstOffset, 0, 0,
 					static_cast<D3D11HardwareBuffer&>(srcBuffer).getD3DBuffer(), 0, &srcBox);
 				if (mDevice.hasError())
 				{
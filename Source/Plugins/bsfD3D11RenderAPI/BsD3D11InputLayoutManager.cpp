@@ -57,6 +57,9 @@ namespace bs { namespace ct
 	ID3D11InputLayout* D3D11InputLayoutManager::retrieveInputLayout(const SPtr<VertexDeclaration>& vertexShaderDecl, 
 		const SPtr<VertexDeclaration>& vertexBufferDecl, D3D11GpuProgram& vertexProgram)
 	{
+		// Command buffers recorded on deferred contexts can request layouts from multiple threads
+		Lock lock(mMutex);
+
 		VertexDeclarationKey pair;
 		pair.vertxDeclId = vertexBufferDecl->getId();
 		pair.vertexProgramId = vertexProgram.getProgramId();
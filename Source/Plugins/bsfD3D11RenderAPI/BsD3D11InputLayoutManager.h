@@ -75,10 +75,11 @@ namespace bs { namespace ct
 		static const int DECLARATION_BUFFER_SIZE = 1024;
 		static const int NUM_ELEMENTS_TO_PRUNE = 64;
 
-		UnorderedMap<VertexDeclarationKey, InputLayoutEntry*, HashFunc, EqualFunc> mInputLayoutMap;
+		FlatHashMap<VertexDeclarationKey, InputLayoutEntry*, HashFunc, EqualFunc> mInputLayoutMap;
 
 		bool mWarningShown;
 		UINT32 mLastUsedCounter;
+		Mutex mMutex;
 	};
 
 	/** @} */
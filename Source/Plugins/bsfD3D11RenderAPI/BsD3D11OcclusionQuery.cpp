@@ -42,7 +42,10 @@ namespace bs { namespace ct
 	{
 		auto execute = [&]()
 		{
-			mContext->Begin(mQuery);
+			D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+			ID3D11DeviceContext* context = rapi->getActiveContext();
+
+			context->Begin(mQuery);
 
 			mNumSamples = 0;
 			mQueryEndCalled = false;
@@ -63,7 +66,10 @@ namespace bs { namespace ct
 	{
 		auto execute = [&]()
 		{
-			mContext->End(mQuery);
+			D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+			ID3D11DeviceContext* context = rapi->getActiveContext();
+
+			context->End(mQuery);
 
 			mQueryEndCalled = true;
 			mFinalized = false;
@@ -35,10 +35,12 @@
 
 namespace bs { namespace ct
 {
+	/** State of the deferred context the calling thread is recording to, if any. */
+	static BS_THREADLOCAL D3D11ContextState* sActiveState = nullptr;
+
 	D3D11RenderAPI::D3D11RenderAPI()
 		: mDXGIFactory(nullptr), mDevice(nullptr), mDriverList(nullptr), mActiveD3DDriver(nullptr)
-		, mFeatureLevel(D3D_FEATURE_LEVEL_11_0), mHLSLFactory(nullptr), mIAManager(nullptr), mPSUAVsBound(false)
-		, mCSUAVsBound(false), mStencilRef(0), mActiveDrawOp(DOT_TRIANGLE_LIST), mViewportNorm(0.0f, 0.0f, 1.0f, 1.0f)
+		, mFeatureLevel(D3D_FEATURE_LEVEL_11_0), mHLSLFactory(nullptr), mIAManager(nullptr)
 	{ }
 
 	D3D11RenderAPI::~D3D11RenderAPI()
@@ -99,6 +101,13 @@ namespace bs { namespace ct
 			BS_EXCEPT(RenderingAPIException, "Failed to create Direct3D11 object. D3D11CreateDeviceN returned this error code: " + toString(hr));
 
 		mDevice = bs_new<D3D11Device>(device);
+		mImmediateState.context = mDevice->getImmediateContext();
+
+		// Deferred contexts are always available, but are only worth using for parallel recording if the driver
+		// natively supports command lists, instead of emulating them in the runtime
+		D3D11_FEATURE_DATA_THREADING threadingSupport;
+		hr = device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threadingSupport, sizeof(threadingSupport));
+		mCommandListsSupported = SUCCEEDED(hr) && threadingSupport.DriverCommandLists;
 		
 		CommandBufferManager::startUp<D3D11CommandBufferManager>();
 
@@ -170,10 +179,8 @@ namespace bs { namespace ct
 			mHLSLFactory = nullptr;
 		}
 
-		mActiveVertexDeclaration = nullptr;
-		mActiveVertexShader = nullptr;
+		mImmediateState = D3D11ContextState();
 		mActiveRenderTarget = nullptr;
-		mActiveDepthStencilState = nullptr;
 
 		RenderStateManager::shutDown();
 		RenderWindowManager::shutDown();
@@ -206,9 +213,12 @@ namespace bs { namespace ct
 	void D3D11RenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getBoundState(commandBuffer).setGraphicsPipeline(pipelineState))
+			return;
+
 		auto executeRef = [&](const SPtr<GraphicsPipelineState>& pipelineState)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
 			D3D11BlendState* d3d11BlendState;
 			D3D11RasterizerState* d3d11RasterizerState;
@@ -222,9 +232,11 @@ namespace bs { namespace ct
 			{
 				d3d11BlendState = static_cast<D3D11BlendState*>(pipelineState->getBlendState().get());
 				d3d11RasterizerState = static_cast<D3D11RasterizerState*>(pipelineState->getRasterizerState().get());
-				mActiveDepthStencilState = std::static_pointer_cast<D3D11DepthStencilState>(pipelineState->getDepthStencilState());
+				state.activeDepthStencilState =
+					std::static_pointer_cast<D3D11DepthStencilState>(pipelineState->getDepthStencilState());
 
-				mActiveVertexShader = std::static_pointer_cast<D3D11GpuVertexProgram>(pipelineState->getVertexProgram());
+				state.activeVertexShader =
+					std::static_pointer_cast<D3D11GpuVertexProgram>(pipelineState->getVertexProgram());
 				d3d11FragmentProgram = static_cast<D3D11GpuFragmentProgram*>(pipelineState->getFragmentProgram().get());
 				d3d11GeometryProgram = static_cast<D3D11GpuGeometryProgram*>(pipelineState->getGeometryProgram().get());
 				d3d11DomainProgram = static_cast<D3D11GpuDomainProgram*>(pipelineState->getDomainProgram().get());
@@ -236,30 +248,34 @@ namespace bs { namespace ct
 				if (d3d11RasterizerState == nullptr)
 					d3d11RasterizerState = static_cast<D3D11RasterizerState*>(RasterizerState::getDefault().get());
 
-				if (mActiveDepthStencilState == nullptr)
-					mActiveDepthStencilState = std::static_pointer_cast<D3D11DepthStencilState>(DepthStencilState::getDefault());
+				if (state.activeDepthStencilState == nullptr)
+				{
+					state.activeDepthStencilState =
+						std::static_pointer_cast<D3D11DepthStencilState>(DepthStencilState::getDefault());
+				}
 			}
 			else
 			{
 				d3d11BlendState = static_cast<D3D11BlendState*>(BlendState::getDefault().get());
 				d3d11RasterizerState = static_cast<D3D11RasterizerState*>(RasterizerState::getDefault().get());
-				mActiveDepthStencilState = std::static_pointer_cast<D3D11DepthStencilState>(DepthStencilState::getDefault());
+				state.activeDepthStencilState =
+					std::static_pointer_cast<D3D11DepthStencilState>(DepthStencilState::getDefault());
 
-				mActiveVertexShader = nullptr;
+				state.activeVertexShader = nullptr;
 				d3d11FragmentProgram = nullptr;
 				d3d11GeometryProgram = nullptr;
 				d3d11DomainProgram = nullptr;
 				d3d11HullProgram = nullptr;
 			}
 
-			ID3D11DeviceContext* d3d11Context = mDevice->getImmediateContext();
+			ID3D11DeviceContext* d3d11Context = state.context;
 			d3d11Context->OMSetBlendState(d3d11BlendState->getInternal(), nullptr, 0xFFFFFFFF);
 			d3d11Context->RSSetState(d3d11RasterizerState->getInternal());
-			d3d11Context->OMSetDepthStencilState(mActiveDepthStencilState->getInternal(), mStencilRef);
+			d3d11Context->OMSetDepthStencilState(state.activeDepthStencilState->getInternal(), state.stencilRef);
 
-			if (mActiveVertexShader != nullptr)
+			if (state.activeVertexShader != nullptr)
 			{
-				D3D11GpuVertexProgram* vertexProgram = static_cast<D3D11GpuVertexProgram*>(mActiveVertexShader.get());
+				auto vertexProgram = static_cast<D3D11GpuVertexProgram*>(state.activeVertexShader.get());
 				d3d11Context->VSSetShader(vertexProgram->getVertexShader(), nullptr, 0);
 			}
 			else
@@ -303,9 +319,12 @@ namespace bs { namespace ct
 	void D3D11RenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getBoundState(commandBuffer).setComputePipeline(pipelineState))
+			return;
+
 		auto executeRef = [&](const SPtr<ComputePipelineState>& pipelineState)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
 			SPtr<GpuProgram> program;
 			if (pipelineState != nullptr)
@@ -314,10 +333,10 @@ namespace bs { namespace ct
 			if (program != nullptr && program->getType() == GPT_COMPUTE_PROGRAM)
 			{
 				D3D11GpuComputeProgram *d3d11ComputeProgram = static_cast<D3D11GpuComputeProgram*>(program.get());
-				mDevice->getImmediateContext()->CSSetShader(d3d11ComputeProgram->getComputeShader(), nullptr, 0);
+				state.context->CSSetShader(d3d11ComputeProgram->getComputeShader(), nullptr, 0);
 			}
 			else
-				mDevice->getImmediateContext()->CSSetShader(nullptr, nullptr, 0);
+				state.context->CSSetShader(nullptr, nullptr, 0);
 		};
 
 		if (commandBuffer == nullptr)
@@ -335,33 +354,36 @@ namespace bs { namespace ct
 
 	void D3D11RenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getBoundState(commandBuffer).setGpuParams(gpuParams))
+			return;
+
 		auto executeRef = [&](const SPtr<GpuParams>& gpuParams)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			ID3D11DeviceContext* context = mDevice->getImmediateContext();
+			ID3D11DeviceContext* context = state.context;
 
 			// Clear any previously bound UAVs (otherwise shaders attempting to read resources viewed by those views will
 			// be unable to)
-			if (mPSUAVsBound || mCSUAVsBound)
+			if (state.psUAVsBound || state.csUAVsBound)
 			{
 				ID3D11UnorderedAccessView* emptyUAVs[D3D11_PS_CS_UAV_REGISTER_COUNT];
 				bs_zero_out(emptyUAVs);
 
-				if(mPSUAVsBound)
+				if(state.psUAVsBound)
 				{
 					context->OMSetRenderTargetsAndUnorderedAccessViews(
 						D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL, nullptr, nullptr, 0, 
 						D3D11_PS_CS_UAV_REGISTER_COUNT, emptyUAVs, nullptr);
 
-					mPSUAVsBound = false;
+					state.psUAVsBound = false;
 				}
 
-				if(mCSUAVsBound)
+				if(state.csUAVsBound)
 				{
 					context->CSSetUnorderedAccessViews(0, D3D11_PS_CS_UAV_REGISTER_COUNT, emptyUAVs, nullptr);
 
-					mCSUAVsBound = false;
+					state.csUAVsBound = false;
 				}
 			}
 
@@ -526,7 +548,7 @@ namespace bs { namespace ct
 				{
 					context->OMSetRenderTargetsAndUnorderedAccessViews(
 						D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL, nullptr, nullptr, 0, numUAVs, uavs.data(), nullptr);
-					mPSUAVsBound = true;
+					state.psUAVsBound = true;
 				}
 
 				if (numConstBuffers > 0)
@@ -589,7 +611,7 @@ namespace bs { namespace ct
 				if (numUAVs > 0)
 				{
 					context->CSSetUnorderedAccessViews(0, numUAVs, uavs.data(), nullptr);
-					mCSUAVsBound = true;
+					state.csUAVsBound = true;
 				}
 
 				if (numConstBuffers > 0)
@@ -622,10 +644,10 @@ namespace bs { namespace ct
 	{
 		auto executeRef = [&](const Rect2& vp)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			mViewportNorm = vp;
-			applyViewport();
+			state.viewportNorm = vp;
+			applyViewport(state);
 		};
 
 		if (commandBuffer == nullptr)
@@ -642,9 +664,12 @@ namespace bs { namespace ct
 	void D3D11RenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers, 
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getBoundState(commandBuffer).setVertexBuffers(index, buffers, numBuffers))
+			return;
+
 		auto executeRef = [&](UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
 			UINT32 maxBoundVertexBuffers = mCurrentCapabilities[0].getMaxBoundVertexBuffers();
 			if (index < 0 || (index + numBuffers) >= maxBoundVertexBuffers)
@@ -668,7 +693,7 @@ namespace bs { namespace ct
 				offsets[i] = 0;
 			}
 
-			mDevice->getImmediateContext()->IASetVertexBuffers(index, numBuffers, dx11buffers, strides, offsets);
+			state.context->IASetVertexBuffers(index, numBuffers, dx11buffers, strides, offsets);
 		};
 
 		if (commandBuffer == nullptr)
@@ -686,9 +711,12 @@ namespace bs { namespace ct
 
 	void D3D11RenderAPI::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getBoundState(commandBuffer).setIndexBuffer(buffer))
+			return;
+
 		auto executeRef = [&](const SPtr<IndexBuffer>& buffer)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
 			SPtr<D3D11IndexBuffer> indexBuffer = std::static_pointer_cast<D3D11IndexBuffer>(buffer);
 
@@ -700,7 +728,7 @@ namespace bs { namespace ct
 			else
 				BS_EXCEPT(InternalErrorException, "Unsupported index format: " + toString(indexBuffer->getProperties().getType()));
 
-			mDevice->getImmediateContext()->IASetIndexBuffer(indexBuffer->getD3DIndexBuffer(), indexFormat, 0);
+			state.context->IASetIndexBuffer(indexBuffer->getD3DIndexBuffer(), indexFormat, 0);
 		};
 
 		if (commandBuffer == nullptr)
@@ -721,9 +749,9 @@ namespace bs { namespace ct
 	{
 		auto executeRef = [&](const SPtr<VertexDeclaration>& vertexDeclaration)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			mActiveVertexDeclaration = vertexDeclaration;
+			state.activeVertexDeclaration = vertexDeclaration;
 		};
 
 		if (commandBuffer == nullptr)
@@ -741,10 +769,10 @@ namespace bs { namespace ct
 	{
 		auto executeRef = [&](DrawOperationType op)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			mDevice->getImmediateContext()->IASetPrimitiveTopology(D3D11Mappings::getPrimitiveType(op));
-			mActiveDrawOp = op;
+			state.context->IASetPrimitiveTopology(D3D11Mappings::getPrimitiveType(op));
+			state.activeDrawOp = op;
 		};
 
 		if (commandBuffer == nullptr)
@@ -765,14 +793,14 @@ namespace bs { namespace ct
 	{
 		auto executeRef = [&](UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			applyInputLayout();
+			applyInputLayout(state);
 
 			if (instanceCount <= 1)
-				mDevice->getImmediateContext()->Draw(vertexCount, vertexOffset);
+				state.context->Draw(vertexCount, vertexOffset);
 			else
-				mDevice->getImmediateContext()->DrawInstanced(vertexCount, instanceCount, vertexOffset, 0);
+				state.context->DrawInstanced(vertexCount, instanceCount, vertexOffset, 0);
 
 #if BS_DEBUG_MODE
 			if (mDevice->hasError())
@@ -784,7 +812,7 @@ namespace bs { namespace ct
 		if (commandBuffer == nullptr)
 		{
 			executeRef(vertexOffset, vertexCount, instanceCount);
-			primCount = vertexCountToPrimCount(mActiveDrawOp, vertexCount);
+			primCount = vertexCountToPrimCount(getActiveState().activeDrawOp, vertexCount);
 		}
 		else
 		{
@@ -807,14 +835,14 @@ namespace bs { namespace ct
 		auto executeRef = [&](UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
 			UINT32 instanceCount)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			applyInputLayout();
+			applyInputLayout(state);
 
 			if (instanceCount <= 1)
-				mDevice->getImmediateContext()->DrawIndexed(indexCount, startIndex, vertexOffset);
+				state.context->DrawIndexed(indexCount, startIndex, vertexOffset);
 			else
-				mDevice->getImmediateContext()->DrawIndexedInstanced(indexCount, instanceCount, startIndex, vertexOffset, 0);
+				state.context->DrawIndexedInstanced(indexCount, instanceCount, startIndex, vertexOffset, 0);
 
 #if BS_DEBUG_MODE
 			if (mDevice->hasError())
@@ -826,7 +854,7 @@ namespace bs { namespace ct
 		if (commandBuffer == nullptr)
 		{
 			executeRef(startIndex, indexCount, vertexOffset, vertexCount, instanceCount);
-			primCount = vertexCountToPrimCount(mActiveDrawOp, indexCount);
+			primCount = vertexCountToPrimCount(getActiveState().activeDrawOp, indexCount);
 		}
 		else
 		{
@@ -843,14 +871,90 @@ namespace bs { namespace ct
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
+	void D3D11RenderAPI::drawIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, 
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		auto executeRef = [&](const SPtr<GpuBuffer>& argsBuffer, UINT32 offset)
+		{
+			D3D11ContextState& state = getActiveState();
+
+			applyInputLayout(state);
+
+			D3D11GpuBuffer* d3d11Buffer = static_cast<D3D11GpuBuffer*>(argsBuffer.get());
+			state.context->DrawInstancedIndirect(d3d11Buffer->getDX11Buffer(), offset);
+
+#if BS_DEBUG_MODE
+			if (mDevice->hasError())
+				LOGWRN(mDevice->getErrorDescription());
+#endif
+		};
+
+		if (commandBuffer == nullptr)
+			executeRef(argsBuffer, offset);
+		else
+		{
+			auto execute = [=]() { executeRef(argsBuffer, offset); };
+
+			SPtr<D3D11CommandBuffer> cb = std::static_pointer_cast<D3D11CommandBuffer>(commandBuffer);
+			cb->queueCommand(execute);
+		}
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+	}
+
+	void D3D11RenderAPI::drawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, 
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		multiDrawIndexedIndirect(argsBuffer, offset, 1, nullptr, 0, commandBuffer);
+	}
+
+	void D3D11RenderAPI::multiDrawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, UINT32 drawCount,
+		const SPtr<GpuBuffer>& countBuffer, UINT32 countOffset, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		// Note: D3D11 has no native multi-draw or draw count support, so each draw is issued separately and the count
+		// buffer is ignored
+		auto executeRef = [&](const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, UINT32 drawCount)
+		{
+			D3D11ContextState& state = getActiveState();
+
+			applyInputLayout(state);
+
+			D3D11GpuBuffer* d3d11Buffer = static_cast<D3D11GpuBuffer*>(argsBuffer.get());
+			ID3D11Buffer* dx11Buffer = d3d11Buffer->getDX11Buffer();
+
+			for (UINT32 i = 0; i < drawCount; i++)
+			{
+				UINT32 drawOffset = offset + i * sizeof(DrawIndexedIndirectArgs);
+				state.context->DrawIndexedInstancedIndirect(dx11Buffer, drawOffset);
+			}
+
+#if BS_DEBUG_MODE
+			if (mDevice->hasError())
+				LOGWRN(mDevice->getErrorDescription());
+#endif
+		};
+
+		if (commandBuffer == nullptr)
+			executeRef(argsBuffer, offset, drawCount);
+		else
+		{
+			auto execute = [=]() { executeRef(argsBuffer, offset, drawCount); };
+
+			SPtr<D3D11CommandBuffer> cb = std::static_pointer_cast<D3D11CommandBuffer>(commandBuffer);
+			cb->queueCommand(execute);
+		}
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+	}
+
 	void D3D11RenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ, 
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			mDevice->getImmediateContext()->Dispatch(numGroupsX, numGroupsY, numGroupsZ);
+			state.context->Dispatch(numGroupsX, numGroupsY, numGroupsZ);
 
 #if BS_DEBUG_MODE
 			if (mDevice->hasError())
@@ -876,14 +980,14 @@ namespace bs { namespace ct
 	{
 		auto executeRef = [&](UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			mScissorRect.left = static_cast<LONG>(left);
-			mScissorRect.top = static_cast<LONG>(top);
-			mScissorRect.bottom = static_cast<LONG>(bottom);
-			mScissorRect.right = static_cast<LONG>(right);
+			state.scissorRect.left = static_cast<LONG>(left);
+			state.scissorRect.top = static_cast<LONG>(top);
+			state.scissorRect.bottom = static_cast<LONG>(bottom);
+			state.scissorRect.right = static_cast<LONG>(right);
 
-			mDevice->getImmediateContext()->RSSetScissorRects(1, &mScissorRect);
+			state.context->RSSetScissorRects(1, &state.scissorRect);
 		};
 
 		if (commandBuffer == nullptr)
@@ -901,14 +1005,14 @@ namespace bs { namespace ct
 	{
 		auto executeRef = [&](UINT32 value)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			mStencilRef = value;
+			state.stencilRef = value;
 
-			if(mActiveDepthStencilState != nullptr)
-				mDevice->getImmediateContext()->OMSetDepthStencilState(mActiveDepthStencilState->getInternal(), mStencilRef);
+			if(state.activeDepthStencilState != nullptr)
+				state.context->OMSetDepthStencilState(state.activeDepthStencilState->getInternal(), state.stencilRef);
 			else
-				mDevice->getImmediateContext()->OMSetDepthStencilState(nullptr, mStencilRef);
+				state.context->OMSetDepthStencilState(nullptr, state.stencilRef);
 		};
 
 		if (commandBuffer == nullptr)
@@ -925,16 +1029,20 @@ namespace bs { namespace ct
 	void D3D11RenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask, 
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		// Partial clears render a quad using internal shaders and buffers
+		getBoundState(commandBuffer).reset();
+
 		auto executeRef = [&](UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			if (mActiveRenderTarget == nullptr)
+			if (state.activeRenderTarget == nullptr)
 				return;
 
-			const RenderTargetProperties& rtProps = mActiveRenderTarget->getProperties();
+			const RenderTargetProperties& rtProps = state.activeRenderTarget->getProperties();
 
-			Rect2I clearArea((int)mViewport.TopLeftX, (int)mViewport.TopLeftY, (int)mViewport.Width, (int)mViewport.Height);
+			const D3D11_VIEWPORT& viewport = state.viewport;
+			Rect2I clearArea((int)viewport.TopLeftX, (int)viewport.TopLeftY, (int)viewport.Width, (int)viewport.Height);
 
 			bool clearEntireTarget = clearArea.width == 0 || clearArea.height == 0;
 			clearEntireTarget |= (clearArea.x == 0 && clearArea.y == 0 && clearArea.width == rtProps.width && 
@@ -966,9 +1074,9 @@ namespace bs { namespace ct
 	{
 		auto executeRef = [&](UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			if (mActiveRenderTarget == nullptr)
+			if (state.activeRenderTarget == nullptr)
 				return;
 
 			// Clear render surfaces
@@ -979,7 +1087,7 @@ namespace bs { namespace ct
 				ID3D11RenderTargetView** views = bs_newN<ID3D11RenderTargetView*>(maxRenderTargets);
 				memset(views, 0, sizeof(ID3D11RenderTargetView*) * maxRenderTargets);
 
-				mActiveRenderTarget->getCustomAttribute("RTV", views);
+				state.activeRenderTarget->getCustomAttribute("RTV", views);
 				if (!views[0])
 				{
 					bs_deleteN(views, maxRenderTargets);
@@ -995,7 +1103,7 @@ namespace bs { namespace ct
 				for (UINT32 i = 0; i < maxRenderTargets; i++)
 				{
 					if (views[i] != nullptr && ((1 << i) & targetMask) != 0)
-						mDevice->getImmediateContext()->ClearRenderTargetView(views[i], clearColor);
+						state.context->ClearRenderTargetView(views[i], clearColor);
 				}
 
 				bs_deleteN(views, maxRenderTargets);
@@ -1005,7 +1113,7 @@ namespace bs { namespace ct
 			if ((buffers & FBT_DEPTH) != 0 || (buffers & FBT_STENCIL) != 0)
 			{
 				ID3D11DepthStencilView* depthStencilView = nullptr;
-				mActiveRenderTarget->getCustomAttribute("DSV", &depthStencilView);
+				state.activeRenderTarget->getCustomAttribute("DSV", &depthStencilView);
 
 				D3D11_CLEAR_FLAG clearFlag;
 
@@ -1017,7 +1125,7 @@ namespace bs { namespace ct
 					clearFlag = D3D11_CLEAR_DEPTH;
 
 				if (depthStencilView != nullptr)
-					mDevice->getImmediateContext()->ClearDepthStencilView(depthStencilView, clearFlag, depth, (UINT8)stencil);
+					state.context->ClearDepthStencilView(depthStencilView, clearFlag, depth, (UINT8)stencil);
 			}
 		};
 
@@ -1037,11 +1145,13 @@ namespace bs { namespace ct
 	void D3D11RenderAPI::setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags, 
 		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		getBoundState(commandBuffer).notifyRenderTargetChanged();
+
 		auto executeRef = [&](const SPtr<RenderTarget>& target, UINT32 readOnlyFlags)
 		{
-			THROW_IF_NOT_CORE_THREAD;
+			D3D11ContextState& state = getActiveState();
 
-			mActiveRenderTarget = target;
+			state.activeRenderTarget = target;
 
 			UINT32 maxRenderTargets = mCurrentCapabilities[0].getNumMultiRenderTargets();
 			ID3D11RenderTargetView** views = bs_newN<ID3D11RenderTargetView*>(maxRenderTargets);
@@ -1070,12 +1180,12 @@ namespace bs { namespace ct
 			}
 
 			// Bind render targets
-			mDevice->getImmediateContext()->OMSetRenderTargets(maxRenderTargets, views, depthStencilView);
+			state.context->OMSetRenderTargets(maxRenderTargets, views, depthStencilView);
 			if (mDevice->hasError())
 				BS_EXCEPT(RenderingAPIException, "Failed to setRenderTarget : " + mDevice->getErrorDescription());
 
 			bs_deleteN(views, maxRenderTargets);
-			applyViewport();
+			applyViewport(state);
 		};
 
 		if (commandBuffer == nullptr)
@@ -1105,6 +1215,9 @@ namespace bs { namespace ct
 		SPtr<D3D11CommandBuffer> secondaryCb = std::static_pointer_cast<D3D11CommandBuffer>(secondary);
 
 		cb->appendSecondary(secondaryCb);
+
+		// Secondary buffer's commands leave the state in an unknown configuration
+		cb->_getBoundState().reset();
 	}
 
 	void D3D11RenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
@@ -1115,31 +1228,53 @@ namespace bs { namespace ct
 
 		cb->executeCommands();
 		cb->clear();
+
+		// All command buffers execute on the immediate context, so its state is no longer known
+		cb->_getBoundState().reset();
+		mImmediateBoundState.reset();
 	}
 
-	void D3D11RenderAPI::applyViewport()
+	D3D11ContextState* D3D11RenderAPI::_setActiveState(D3D11ContextState* state)
 	{
-		if (mActiveRenderTarget == nullptr)
+		D3D11ContextState* previous = sActiveState;
+		sActiveState = state;
+
+		return previous;
+	}
+
+	D3D11ContextState& D3D11RenderAPI::getActiveState()
+	{
+		if (sActiveState != nullptr)
+			return *sActiveState;
+
+		// The immediate context may only be used from the core thread
+		THROW_IF_NOT_CORE_THREAD;
+		return mImmediateState;
+	}
+
+	void D3D11RenderAPI::applyViewport(D3D11ContextState& state)
+	{
+		if (state.activeRenderTarget == nullptr)
 			return;
 
-		const RenderTargetProperties& rtProps = mActiveRenderTarget->getProperties();
+		const RenderTargetProperties& rtProps = state.activeRenderTarget->getProperties();
 
 		// Set viewport dimensions
-		mViewport.TopLeftX = (FLOAT)(rtProps.width * mViewportNorm.x);
-		mViewport.TopLeftY = (FLOAT)(rtProps.height * mViewportNorm.y);
-		mViewport.Width = (FLOAT)(rtProps.width * mViewportNorm.width);
-		mViewport.Height = (FLOAT)(rtProps.height * mViewportNorm.height);
+		state.viewport.TopLeftX = (FLOAT)(rtProps.width * state.viewportNorm.x);
+		state.viewport.TopLeftY = (FLOAT)(rtProps.height * state.viewportNorm.y);
+		state.viewport.Width = (FLOAT)(rtProps.width * state.viewportNorm.width);
+		state.viewport.Height = (FLOAT)(rtProps.height * state.viewportNorm.height);
 
 		if (rtProps.requiresTextureFlipping)
 		{
 			// Convert "top-left" to "bottom-left"
-			mViewport.TopLeftY = rtProps.height - mViewport.Height - mViewport.TopLeftY;
+			state.viewport.TopLeftY = rtProps.height - state.viewport.Height - state.viewport.TopLeftY;
 		}
 
-		mViewport.MinDepth = 0.0f;
-		mViewport.MaxDepth = 1.0f;
+		state.viewport.MinDepth = 0.0f;
+		state.viewport.MaxDepth = 1.0f;
 
-		mDevice->getImmediateContext()->RSSetViewports(1, &mViewport);
+		state.context->RSSetViewports(1, &state.viewport);
 	}
 
 	void D3D11RenderAPI::initCapabilites(IDXGIAdapter* adapter, RenderAPICapabilities& caps) const
@@ -1192,6 +1327,7 @@ namespace bs { namespace ct
 		{
 			caps.setCapability(RSC_TESSELLATION_PROGRAM);
 			caps.setCapability(RSC_COMPUTE_PROGRAM);
+			caps.setCapability(RSC_DRAW_INDIRECT);
 
 			caps.setNumTextureUnits(GPT_HULL_PROGRAM, D3D11_COMMONSHADER_INPUT_RESOURCE_REGISTER_COUNT);
 			caps.setNumTextureUnits(GPT_DOMAIN_PROGRAM, D3D11_COMMONSHADER_INPUT_RESOURCE_REGISTER_COUNT);
@@ -1363,6 +1499,9 @@ namespace bs { namespace ct
 			RenderAPIFeatureFlag::ByteCodeCaching |
 			RenderAPIFeatureFlag::RenderTargetLayers;
 
+		if (mCommandListsSupported)
+			featureFlags |= RenderAPIFeatureFlag::MultiThreadedCB;
+
 		static RenderAPIInfo info(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, featureFlags);
 
 		return info;
@@ -1451,22 +1590,23 @@ namespace bs { namespace ct
 	/* 								PRIVATE		                     		*/
 	/************************************************************************/
 
-	void D3D11RenderAPI::applyInputLayout()
+	void D3D11RenderAPI::applyInputLayout(D3D11ContextState& state)
 	{
-		if(mActiveVertexDeclaration == nullptr)
+		if(state.activeVertexDeclaration == nullptr)
 		{
 			LOGWRN("Cannot apply input layout without a vertex declaration. Set vertex declaration before calling this method.");
 			return;
 		}
 
-		if(mActiveVertexShader == nullptr)
+		if(state.activeVertexShader == nullptr)
 		{
 			LOGWRN("Cannot apply input layout without a vertex shader. Set vertex shader before calling this method.");
 			return;
 		}
 
-		ID3D11InputLayout* ia = mIAManager->retrieveInputLayout(mActiveVertexShader->getInputDeclaration(), mActiveVertexDeclaration, *mActiveVertexShader);
+		ID3D11InputLayout* ia = mIAManager->retrieveInputLayout(state.activeVertexShader->getInputDeclaration(),
+			state.activeVertexDeclaration, *state.activeVertexShader);
 
-		mDevice->getImmediateContext()->IASetInputLayout(ia);
+		state.context->IASetInputLayout(ia);
 	}
 }}
\ No newline at end of file
@@ -11,6 +11,30 @@ namespace bs { namespace ct
 	 *  @{
 	 */
 
+	/**
+	 * State tracked for a device context commands are being issued to. Each deferred context used for recording a
+	 * command buffer has its own state, separate from the state of the immediate context.
+	 */
+	struct D3D11ContextState
+	{
+		ID3D11DeviceContext* context = nullptr;
+
+		bool psUAVsBound = false;
+		bool csUAVsBound = false;
+
+		UINT32 stencilRef = 0;
+		Rect2 viewportNorm = Rect2(0.0f, 0.0f, 1.0f, 1.0f);
+		D3D11_VIEWPORT viewport;
+		D3D11_RECT scissorRect;
+
+		SPtr<VertexDeclaration> activeVertexDeclaration;
+		SPtr<D3D11GpuProgram> activeVertexShader;
+		SPtr<D3D11DepthStencilState> activeDepthStencilState;
+		SPtr<RenderTarget> activeRenderTarget;
+
+		DrawOperationType activeDrawOp = DOT_TRIANGLE_LIST;
+	};
+
 	/** Implementation of a render system using DirectX 11. Provides abstracted access to various low level DX11 methods. */
 	class D3D11RenderAPI : public RenderAPI
 	{
@@ -79,6 +103,19 @@ namespace bs { namespace ct
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, 
 			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
 
+		/** @copydoc RenderAPI::drawIndirect */
+		void drawIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::drawIndexedIndirect */
+		void drawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::multiDrawIndexedIndirect */
+		void multiDrawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, UINT32 drawCount,
+			const SPtr<GpuBuffer>& countBuffer = nullptr, UINT32 countOffset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
 		/** @copydoc RenderAPI::dispatchCompute */
 		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1,
 			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
@@ -123,6 +160,26 @@ namespace bs { namespace ct
 		/**	Returns information describing all available drivers. */
 		D3D11DriverList* getDriverList() const { return mDriverList; }
 
+		/**
+		 * Checks if the driver natively supports command lists. If it does, command buffers are recorded on deferred
+		 * contexts and can be recorded from multiple threads in parallel.
+		 */
+		bool supportsCommandLists() const { return mCommandListsSupported; }
+
+		/**
+		 * Returns the device context that commands issued from the calling thread should be recorded to. This is the
+		 * deferred context of the command buffer being recorded on the thread, if any, or the immediate context
+		 * otherwise.
+		 */
+		ID3D11DeviceContext* getActiveContext() { return getActiveState().context; }
+
+		/**
+		 * Makes all commands issued from the calling thread execute on the context described by the provided state,
+		 * instead of the immediate context. Provide null to switch back to the immediate context. Returns the
+		 * previously set state.
+		 */
+		static D3D11ContextState* _setActiveState(D3D11ContextState* state);
+
 	protected:
 		friend class D3D11RenderAPIFactory;
 
@@ -140,13 +197,19 @@ namespace bs { namespace ct
 		 *
 		 * Applies the input layout to the pipeline.
 		 */
-		void applyInputLayout();
+		void applyInputLayout(D3D11ContextState& state);
 
 		/**
 		 * Recalculates actual viewport dimensions based on currently set viewport normalized dimensions and render target
 		 * and applies them for further rendering.
 		 */
-		void applyViewport();
+		void applyViewport(D3D11ContextState& state);
+
+		/**
+		 * Returns the state of the context commands issued from the calling thread are executed on. See
+		 * getActiveContext().
+		 */
+		D3D11ContextState& getActiveState();
 
 		/** Creates and populates a set of render system capabilities describing which functionality is available. */
 		void initCapabilites(IDXGIAdapter* adapter, RenderAPICapabilities& caps) const;
@@ -163,19 +226,8 @@ namespace bs { namespace ct
 		D3D11HLSLProgramFactory* mHLSLFactory;
 		D3D11InputLayoutManager* mIAManager;
 
-		bool mPSUAVsBound;
-		bool mCSUAVsBound;
-
-		UINT32 mStencilRef;
-		Rect2 mViewportNorm;
-		D3D11_VIEWPORT mViewport;
-		D3D11_RECT mScissorRect;
-
-		SPtr<VertexDeclaration> mActiveVertexDeclaration;
-		SPtr<D3D11GpuProgram> mActiveVertexShader;
-		SPtr<D3D11DepthStencilState> mActiveDepthStencilState;
-
-		DrawOperationType mActiveDrawOp;
+		D3D11ContextState mImmediateState;
+		bool mCommandListsSupported = false;
 	};
 
 	/** @} */
@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsD3D11RenderUtility.h"
 #include "BsD3D11Device.h"
+#include "BsD3D11RenderAPI.h"
 #include "Math/BsVector3.h"
 #include "Image/BsColor.h"
 #include "Math/BsRect2I.h"
@@ -36,32 +37,36 @@ namespace bs { namespace ct
 
 	void D3D11RenderUtility::drawClearQuad(UINT32 clearBuffers, const Color& color, float depth, UINT16 stencil)
 	{
+		// Draw on the deferred context of the command buffer being recorded on this thread, if any
+		D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+		ID3D11DeviceContext* context = rapi->getActiveContext();
+
 		// Set states
 		if((clearBuffers & FBT_COLOR) != 0)
 		{
 			D3D11BlendState* d3d11BlendState = static_cast<D3D11BlendState*>(const_cast<BlendState*>(mClearQuadBlendStateYesC.get()));
-			mDevice->getImmediateContext()->OMSetBlendState(d3d11BlendState->getInternal(), nullptr, 0xFFFFFFFF);
+			context->OMSetBlendState(d3d11BlendState->getInternal(), nullptr, 0xFFFFFFFF);
 		}
 		else
 		{
 			D3D11BlendState* d3d11BlendState = static_cast<D3D11BlendState*>(const_cast<BlendState*>(mClearQuadBlendStateNoC.get()));
-			mDevice->getImmediateContext()->OMSetBlendState(d3d11BlendState->getInternal(), nullptr, 0xFFFFFFFF);
+			context->OMSetBlendState(d3d11BlendState->getInternal(), nullptr, 0xFFFFFFFF);
 		}
 
 		D3D11RasterizerState* d3d11RasterizerState = static_cast<D3D11RasterizerState*>(const_cast<RasterizerState*>(mClearQuadRasterizerState.get()));
-		mDevice->getImmediateContext()->RSSetState(d3d11RasterizerState->getInternal());
+		context->RSSetState(d3d11RasterizerState->getInternal());
 
 		if((clearBuffers & FBT_DEPTH) != 0)
 		{
 			if((clearBuffers & FBT_STENCIL) != 0)
 			{
 				D3D11DepthStencilState* d3d11DepthStencilState = static_cast<D3D11DepthStencilState*>(const_cast<DepthStencilState*>(mClearQuadDSStateYesD_YesS.get()));
-				mDevice->getImmediateContext()->OMSetDepthStencilState(d3d11DepthStencilState->getInternal(), stencil);
+				context->OMSetDepthStencilState(d3d11DepthStencilState->getInternal(), stencil);
 			}
 			else
 			{
 				D3D11DepthStencilState* d3d11DepthStencilState = static_cast<D3D11DepthStencilState*>(const_cast<DepthStencilState*>(mClearQuadDSStateYesD_NoS.get()));
-				mDevice->getImmediateContext()->OMSetDepthStencilState(d3d11DepthStencilState->getInternal(), stencil);
+				context->OMSetDepthStencilState(d3d11DepthStencilState->getInternal(), stencil);
 			}
 		}
 		else
@@ -69,12 +74,12 @@ namespace bs { namespace ct
 			if((clearBuffers & FBT_STENCIL) != 0)
 			{
 				D3D11DepthStencilState* d3d11DepthStencilState = static_cast<D3D11DepthStencilState*>(const_cast<DepthStencilState*>(mClearQuadDSStateNoD_YesS.get()));
-				mDevice->getImmediateContext()->OMSetDepthStencilState(d3d11DepthStencilState->getInternal(), stencil);
+				context->OMSetDepthStencilState(d3d11DepthStencilState->getInternal(), stencil);
 			}
 			else
 			{
 				D3D11DepthStencilState* d3d11DepthStencilState = static_cast<D3D11DepthStencilState*>(const_cast<DepthStencilState*>(mClearQuadDSStateNoD_NoS.get()));
-				mDevice->getImmediateContext()->OMSetDepthStencilState(d3d11DepthStencilState->getInternal(), stencil);
+				context->OMSetDepthStencilState(d3d11DepthStencilState->getInternal(), stencil);
 			}
 		}
 
@@ -90,10 +95,10 @@ namespace bs { namespace ct
 		vertexData[2].col = color.getAsRGBA();
 		vertexData[3].col = color.getAsRGBA();
 
-		mDevice->getImmediateContext()->UpdateSubresource(mClearQuadVB, 0, nullptr, vertexData, 0, sizeof(ClearVertex) * 4);
+		context->UpdateSubresource(mClearQuadVB, 0, nullptr, vertexData, 0, sizeof(ClearVertex) * 4);
 
-		mDevice->getImmediateContext()->VSSetShader(mClearQuadVS, nullptr, 0);
-		mDevice->getImmediateContext()->PSSetShader(mClearQuadPS, nullptr, 0);
+		context->VSSetShader(mClearQuadVS, nullptr, 0);
+		context->PSSetShader(mClearQuadPS, nullptr, 0);
 
 		ID3D11Buffer* buffers[1];
 		buffers[0] = mClearQuadVB;
@@ -101,12 +106,12 @@ namespace bs { namespace ct
 		UINT32 strides[1] = { sizeof(ClearVertex) };
 		UINT32 offsets[1] = { 0 };
 
-		mDevice->getImmediateContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		mDevice->getImmediateContext()->IASetIndexBuffer(mClearQuadIB, DXGI_FORMAT_R16_UINT, 0);
-		mDevice->getImmediateContext()->IASetVertexBuffers(0, 1, buffers, strides, offsets);
-		mDevice->getImmediateContext()->IASetInputLayout(mClearQuadIL);
+		context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		context->IASetIndexBuffer(mClearQuadIB, DXGI_FORMAT_R16_UINT, 0);
+		context->IASetVertexBuffers(0, 1, buffers, strides, offsets);
+		context->IASetInputLayout(mClearQuadIL);
 
-		mDevice->getImmediateContext()->DrawIndexed(6, 0, 0);
+		context->DrawIndexed(6, 0, 0);
 	}
 
 	void D3D11RenderUtility::initClearQuadResources()
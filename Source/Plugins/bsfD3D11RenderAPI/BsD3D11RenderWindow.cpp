@@ -17,6 +17,7 @@
 #include "Managers/BsRenderWindowManager.h"
 #include "Math/BsMath.h"
 #include "Private/Win32/BsWin32Window.h"
+#include <dxgi1_5.h>
 
 namespace bs
 {
@@ -103,6 +104,9 @@ namespace bs
 		if (props.isFullScreen)
 			mSwapChain->SetFullscreenState(false, nullptr);
 
+		if (mFrameLatencyWaitable != nullptr)
+			CloseHandle(mFrameLatencyWaitable);
+
 		SAFE_RELEASE(mSwapChain);
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_SwapChain);
 
@@ -232,10 +236,35 @@ namespace bs
 
 		if(mDevice.getD3D11Device() != nullptr)
 		{
-			HRESULT hr = mSwapChain->Present(getProperties().vsync ? getProperties().vsyncInterval : 0, 0);
+			const RenderWindowProperties& props = getProperties();
+
+			UINT32 syncInterval = props.vsync ? props.vsyncInterval : 0;
+			switch (mDesc.presentMode)
+			{
+			case PresentMode::Immediate:
+				syncInterval = 0;
+				break;
+			case PresentMode::Mailbox: // Not supported by DXGI, closest is waiting for vertical blank
+			case PresentMode::Fifo:
+			case PresentMode::FifoRelaxed:
+				syncInterval = std::max(props.vsyncInterval, 1U);
+				break;
+			default:
+				break;
+			}
+
+			UINT presentFlags = 0;
+			if (syncInterval == 0 && mAllowTearing && !props.isFullScreen)
+				presentFlags |= DXGI_PRESENT_ALLOW_TEARING;
+
+			HRESULT hr = mSwapChain->Present(syncInterval, presentFlags);
 
 			if( FAILED(hr) )
 				BS_EXCEPT(RenderingAPIException, "Error Presenting surfaces");
+
+			// Limit the number of frames queued for display, if requested
+			if (mFrameLatencyWaitable != nullptr)
+				WaitForSingleObjectEx(mFrameLatencyWaitable, 1000, TRUE);
 		}
 	}
 
@@ -682,7 +711,7 @@ namespace bs
 		mSwapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH ;
 
 		mSwapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-		mSwapChainDesc.BufferCount = 1;
+		mSwapChainDesc.BufferCount = mDesc.swapChainImageCount > 0 ? mDesc.swapChainImageCount : 1;
 		mSwapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_DISCARD ;
 
 		mSwapChainDesc.Windowed	= true;
@@ -691,12 +720,50 @@ namespace bs
 		rs->determineMultisampleSettings(props.multisampleCount, format, &mMultisampleType);
 		mSwapChainDesc.SampleDesc.Count = mMultisampleType.Count;
 		mSwapChainDesc.SampleDesc.Quality = mMultisampleType.Quality;
+
+		// Flip model swap chains can't be multisampled
+		bool flipModel = mDesc.flipModel && mMultisampleType.Count <= 1;
+		if (flipModel)
+		{
+			mSwapChainDesc.BufferCount = std::max(mSwapChainDesc.BufferCount, 2U);
+			mSwapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+
+			if (mDesc.maxFrameLatency > 0)
+				mSwapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
+			// Presenting without vsync in windowed mode requires tearing support with flip model
+			IDXGIFactory5* factory5 = nullptr;
+			if (SUCCEEDED(mDXGIFactory->QueryInterface(__uuidof(IDXGIFactory5), (void**)&factory5)))
+			{
+				BOOL allowTearing = FALSE;
+				HRESULT hr = factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allowTearing, 
+					sizeof(allowTearing));
+
+				if (SUCCEEDED(hr) && allowTearing)
+				{
+					mSwapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+					mAllowTearing = true;
+				}
+
+				SAFE_RELEASE(factory5);
+			}
+		}
 		
 		HRESULT hr;
 
 		// Create swap chain			
 		hr = mDXGIFactory->CreateSwapChain(pDXGIDevice, &mSwapChainDesc, &mSwapChain);
 
+		if (FAILED(hr) && flipModel)
+		{
+			// FLIP_DISCARD requires Windows 10, fall back to FLIP_SEQUENTIAL
+			mSwapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
+			mSwapChainDesc.Flags &= ~DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+			mAllowTearing = false;
+
+			hr = mDXGIFactory->CreateSwapChain(pDXGIDevice, &mSwapChainDesc, &mSwapChain);
+		}
+
 		if (FAILED(hr))
 		{
 			// Try a second time, may fail the first time due to back buffer count,
@@ -704,10 +771,42 @@ namespace bs
 			hr = mDXGIFactory->CreateSwapChain(pDXGIDevice, &mSwapChainDesc, &mSwapChain);
 		}
 
-		SAFE_RELEASE(pDXGIDevice);
-
 		if (FAILED(hr))
+		{
+			SAFE_RELEASE(pDXGIDevice);
 			BS_EXCEPT(RenderingAPIException, "Unable to create swap chain. Error code: " + toString(hr));
+		}
+
+		mSwapChainFlags = mSwapChainDesc.Flags & ~DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
+
+		// Limit the number of queued frames. With a waitable swap chain swapBuffers() also blocks until the frame
+		// latency drops below the limit, instead of blocking in the next Present() call.
+		if (mSwapChainDesc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT)
+		{
+			IDXGISwapChain2* swapChain2 = nullptr;
+			if (SUCCEEDED(mSwapChain->QueryInterface(__uuidof(IDXGISwapChain2), (void**)&swapChain2)))
+			{
+				swapChain2->SetMaximumFrameLatency(mDesc.maxFrameLatency);
+				mFrameLatencyWaitable = swapChain2->GetFrameLatencyWaitableObject();
+
+				SAFE_RELEASE(swapChain2);
+			}
+
+			// Wait before the first frame, as after each present
+			if (mFrameLatencyWaitable != nullptr)
+				WaitForSingleObjectEx(mFrameLatencyWaitable, 1000, TRUE);
+		}
+		else if (mDesc.maxFrameLatency > 0)
+		{
+			IDXGIDevice1* pDXGIDevice1 = nullptr;
+			if (SUCCEEDED(pDXGIDevice->QueryInterface(__uuidof(IDXGIDevice1), (void**)&pDXGIDevice1)))
+			{
+				pDXGIDevice1->SetMaximumFrameLatency(mDesc.maxFrameLatency);
+				SAFE_RELEASE(pDXGIDevice1);
+			}
+		}
+
+		SAFE_RELEASE(pDXGIDevice);
 
 		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_SwapChain);
 	}
@@ -770,7 +869,10 @@ namespace bs
 	{
 		destroySizeDependedD3DResources();
 
-		UINT Flags = mProperties.isFullScreen ? DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH : 0;
+		UINT Flags = mSwapChainFlags;
+		if (mProperties.isFullScreen)
+			Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
+
 		HRESULT hr = mSwapChain->ResizeBuffers(mSwapChainDesc.BufferCount, width, height, mSwapChainDesc.BufferDesc.Format, Flags);
 
 		if(hr != S_OK)
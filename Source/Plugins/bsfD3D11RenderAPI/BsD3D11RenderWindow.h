@@ -176,6 +176,9 @@ namespace bs {
 
 		IDXGISwapChain*	mSwapChain;
 		DXGI_SWAP_CHAIN_DESC mSwapChainDesc;
+		UINT32 mSwapChainFlags = 0; // Flags that must be preserved when resizing the swap chain
+		HANDLE mFrameLatencyWaitable = nullptr;
+		bool mAllowTearing = false;
 		Win32Window* mWindow;
 
 		RenderWindowProperties mProperties;
@@ -73,6 +73,7 @@ namespace bs { namespace ct
 
 			D3D11RenderAPI* rs = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
 			D3D11Device& device = rs->getPrimaryDevice();
+			ID3D11DeviceContext* context = rs->getActiveContext();
 
 			bool srcHasMultisample = mProperties.getNumSamples() > 1;
 			bool destHasMultisample = target->getProperties().getNumSamples() > 1;
@@ -84,7 +85,7 @@ namespace bs { namespace ct
 			if (srcHasMultisample && !destHasMultisample) // Resolving from MS to non-MS texture
 			{
 				if(copyEntireSurface)
-					device.getImmediateContext()->ResolveSubresource(other->getDX11Resource(), destResIdx, mTex, srcResIdx, mDXGIFormat);
+					context->ResolveSubresource(other->getDX11Resource(), destResIdx, mTex, srcResIdx, mDXGIFormat);
 				else
 				{
 					// Need to first resolve to a temporary texture, then copy
@@ -95,7 +96,7 @@ namespace bs { namespace ct
 					tempDesc.hwGamma = mProperties.isHardwareGammaEnabled();
 
 					SPtr<D3D11Texture> temporary = std::static_pointer_cast<D3D11Texture>(Texture::create(tempDesc));
-					device.getImmediateContext()->ResolveSubresource(temporary->getDX11Resource(), 0, mTex, srcResIdx, mDXGIFormat);
+					context->ResolveSubresource(temporary->getDX11Resource(), 0, mTex, srcResIdx, mDXGIFormat);
 
 					TEXTURE_COPY_DESC tempCopyDesc;
 					tempCopyDesc.dstMip = desc.dstMip;
@@ -119,7 +120,7 @@ namespace bs { namespace ct
 				if(!copyEntireSurface)
 					srcRegionPtr = &srcRegion;
 
-				device.getImmediateContext()->CopySubresourceRegion(
+				context->CopySubresourceRegion(
 					other->getDX11Resource(),
 					destResIdx,
 					(UINT32)desc.dstPosition.x,
@@ -64,8 +64,11 @@ namespace bs { namespace ct
 	{
 		auto execute = [&]()
 		{
-			mContext->Begin(mDisjointQuery);
-			mContext->End(mBeginQuery);
+			D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+			ID3D11DeviceContext* context = rapi->getActiveContext();
+
+			context->Begin(mDisjointQuery);
+			context->End(mBeginQuery);
 
 			mQueryEndCalled = false;
 
@@ -85,8 +88,11 @@ namespace bs { namespace ct
 	{
 		auto execute = [&]()
 		{
-			mContext->End(mEndQuery);
-			mContext->End(mDisjointQuery);
+			D3D11RenderAPI* rapi = static_cast<D3D11RenderAPI*>(RenderAPI::instancePtr());
+			ID3D11DeviceContext* context = rapi->getActiveContext();
+
+			context->End(mEndQuery);
+			context->End(mDisjointQuery);
 
 			mQueryEndCalled = true;
 			mFinalized = false;
@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsD3D11VertexBuffer.h"
 #include "BsD3D11Device.h"
+#include "BsD3D11GpuBuffer.h"
 #include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
@@ -66,9 +67,21 @@ namespace bs { namespace ct
 	void D3D11VertexBuffer::initialize()
 	{
 		mBuffer = bs_new<D3D11HardwareBuffer>(D3D11HardwareBuffer::BT_VERTEX, 
-											  mUsage, 1, mSize, std::ref(mDevice), false, mStreamOut);
+											  mUsage, 1, mSize, std::ref(mDevice), false, mStreamOut, mSupportsLoadStore);
 
 		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_VertexBuffer);
 		VertexBuffer::initialize();
 	}
-}}
\ No newline at end of file
+
+	SPtr<GpuBuffer> D3D11VertexBuffer::createLoadStore(const GPU_BUFFER_DESC& desc)
+	{
+		SPtr<VertexBuffer> thisPtr = std::static_pointer_cast<VertexBuffer>(getThisPtr());
+		D3D11GpuBuffer* buffer = new (bs_alloc<D3D11GpuBuffer>()) D3D11GpuBuffer(desc, mBuffer, thisPtr);
+
+		SPtr<D3D11GpuBuffer> bufferPtr = bs_shared_ptr<D3D11GpuBuffer>(buffer);
+		bufferPtr->_setThisPtr(bufferPtr);
+		bufferPtr->initialize();
+
+		return bufferPtr;
+	}
+}}
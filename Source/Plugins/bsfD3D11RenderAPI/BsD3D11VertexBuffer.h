@@ -44,6 +44,9 @@ namespace bs { namespace ct
 		/** @copydoc VertexBuffer::initialize */
 		void initialize() override;
 
+		/** @copydoc VertexBuffer::createLoadStore */
+		SPtr<GpuBuffer> createLoadStore(const GPU_BUFFER_DESC& desc) override;
+
 		D3D11HardwareBuffer* mBuffer;
 		D3D11Device& mDevice;
 		bool mStreamOut;
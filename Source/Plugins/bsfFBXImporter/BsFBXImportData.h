@@ -100,6 +100,9 @@ namespace bs
 		TAnimationCurve<Vector3> translation;
 		TAnimationCurve<Quaternion> rotation;
 		TAnimationCurve<Vector3> scale;
+
+		/** Rotation in euler angles as read from the FBX. Converted into @p rotation once all curves are imported. */
+		TAnimationCurve<Vector3> eulerRotation;
 	};
 
 	/**	Animation curve required to animate a blend shape. */
@@ -23,9 +23,28 @@
 #include "Animation/BsMorphShapes.h"
 #include "Physics/BsPhysics.h"
 #include "FileSystem/BsFileSystem.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
+	/**
+	 * Executes @p func for every index in range [0, @p count). If the task scheduler is running the calls are distributed
+	 * over worker threads, and the method blocks until they all finish. Otherwise they are executed sequentially.
+	 */
+	static void runJobs(UINT32 count, const std::function<void(UINT32)>& func)
+	{
+		auto runRange = [&func](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+				func(i);
+		};
+
+		if (TaskScheduler::isStarted() && count > 1)
+			TaskScheduler::instance().parallelFor(0, count, 1, runRange);
+		else
+			runRange(0, count);
+	}
+
 	Matrix4 FBXToNativeType(const FbxAMatrix& value)
 	{
 		Matrix4 native;
@@ -127,6 +146,7 @@ namespace bs
 			desc.usage |= MU_CPUCACHED;
 
 		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		generateLODs(mesh, rendererMeshData->getData(), desc, *meshImportOptions);
 
 		const String fileName = filePath.getFilename(false);
 		mesh->setName(fileName);
@@ -149,6 +169,7 @@ namespace bs
 			desc.usage |= MU_CPUCACHED;
 
 		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		generateLODs(mesh, rendererMeshData->getData(), desc, *meshImportOptions);
 
 		const String fileName = filePath.getFilename(false);
 		mesh->setName(fileName);
@@ -179,7 +200,14 @@ namespace bs
 			Vector<ImportedAnimationEvents> events = meshImportOptions->getAnimationEvents();
 			for(auto& entry : animationClips)
 			{
-				SPtr<AnimationClip> clip = AnimationClip::_createPtr(entry.curves, entry.isAdditive, entry.sampleRate, 
+				SPtr<AnimationCurves> curves = entry.curves;
+				if(meshImportOptions->getAnimationCompression())
+				{
+					curves = AnimationUtility::compressCurves(*curves, entry.sampleRate, 
+						meshImportOptions->getAnimationCompressionTolerance());
+				}
+
+				SPtr<AnimationClip> clip = AnimationClip::_createPtr(curves, entry.isAdditive, entry.sampleRate, 
 					entry.rootMotion);
 				
 				for(auto& eventsEntry : events)
@@ -198,6 +226,43 @@ namespace bs
 		return output;
 	}
 
+	void FBXImporter::generateLODs(const SPtr<Mesh>& mesh, const SPtr<MeshData>& meshData, const MESH_DESC& desc,
+		const MeshImportOptions& importOptions)
+	{
+		UINT32 numLODs = importOptions.getNumLODs();
+		if (numLODs == 0)
+			return;
+
+		// Morph shapes reference the vertices of the full detail mesh
+		if (desc.morphShapes != nullptr)
+		{
+			LOGWRN("Levels of detail cannot be generated for meshes with morph shapes.");
+			return;
+		}
+
+		float vertexRatio = Math::clamp(importOptions.getLODVertexRatio(), 0.01f, 1.0f);
+
+		Vector<MeshLOD> lods;
+		UINT32 prevNumVertices = meshData->getNumVertices();
+		for (UINT32 i = 1; i <= numLODs; i++)
+		{
+			// Simplify from the source mesh every time, so errors don't accumulate between levels
+			float ratio = Math::pow(vertexRatio, (float)i);
+
+			MESH_DESC lodDesc = desc;
+			SPtr<MeshData> lodData = MeshUtility::simplify(*meshData, desc.subMeshes, ratio, lodDesc.subMeshes);
+
+			// Stop once the mesh can't be simplified any further
+			if (lodData == nullptr || lodData->getNumVertices() >= prevNumVertices)
+				break;
+
+			prevNumVertices = lodData->getNumVertices();
+			lods.push_back(MeshLOD(Mesh::_createPtr(lodData, lodDesc), ratio));
+		}
+
+		mesh->setLODs(lods);
+	}
+
 	SPtr<RendererMeshData> FBXImporter::importMeshData(const Path& filePath, SPtr<const ImportOptions> importOptions, 
 		Vector<SubMesh>& subMeshes, Vector<FBXAnimationClipData>& animation, SPtr<Skeleton>& skeleton, 
 		SPtr<MorphShapes>& morphShapes)
@@ -231,7 +296,10 @@ namespace bs
 			importSkin(importedScene, fbxImportOptions);
 
 		if (fbxImportOptions.importAnimation)
+		{
 			importAnimations(fbxScene, fbxImportOptions, importedScene);
+			processAnimationCurves(importedScene, fbxImportOptions);
+		}
 
 		splitMeshVertices(importedScene);
 		generateMissingTangentSpace(importedScene, fbxImportOptions);
@@ -248,7 +316,24 @@ namespace bs
 			convertAnimations(importedScene.clips, splits, skeleton, meshImportOptions->getImportRootMotion(), animation);
 		}
 
-		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices, optimize for vertex cache
+		if (rendererMeshData != nullptr)
+		{
+			MeshOptimizationFlags optimizationFlags;
+			if (meshImportOptions->getOptimizeVertexCache())
+				optimizationFlags |= MeshOptimizationFlag::VertexCache;
+
+			if (meshImportOptions->getOptimizeOverdraw())
+				optimizationFlags |= MeshOptimizationFlag::Overdraw;
+
+			// Morph shapes reference vertices by index, so vertex order must be preserved
+			if (meshImportOptions->getOptimizeVertexFetch() && morphShapes == nullptr)
+				optimizationFlags |= MeshOptimizationFlag::VertexFetch;
+
+			if (optimizationFlags)
+				MeshUtility::optimize(*rendererMeshData->getData(), subMeshes, optimizationFlags);
+		}
+
+		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices
 
 		shutDownSdk();
 
@@ -659,24 +744,56 @@ namespace bs
 
 	void FBXImporter::splitMeshVertices(FBXImportScene& scene)
 	{
-		Vector<FBXImportMesh*> splitMeshes;
+		Vector<FBXImportMesh*> splitMeshes(scene.meshes.size());
 
-		for (auto& mesh : scene.meshes)
+		runJobs((UINT32)scene.meshes.size(), [&scene, &splitMeshes](UINT32 idx)
 		{
+			FBXImportMesh* mesh = scene.meshes[idx];
+
 			FBXImportMesh* splitMesh = bs_new<FBXImportMesh>();
 			splitMesh->fbxMesh = mesh->fbxMesh;
 			splitMesh->referencedBy = mesh->referencedBy;
 			splitMesh->bones = mesh->bones;
 
 			FBXUtility::splitVertices(*mesh, *splitMesh);
-			splitMeshes.push_back(splitMesh);
+			splitMeshes[idx] = splitMesh;
+		});
 
+		for (auto& mesh : scene.meshes)
 			bs_delete(mesh);
-		}
 
 		scene.meshes = splitMeshes;
 	}
 
+	void FBXImporter::processAnimationCurves(FBXImportScene& scene, const FBXImportOptions& options)
+	{
+		Vector<FBXBoneAnimation*> boneAnimations;
+		for (auto& clip : scene.clips)
+		{
+			for (auto& boneAnim : clip.boneAnimations)
+				boneAnimations.push_back(&boneAnim);
+		}
+
+		runJobs((UINT32)boneAnimations.size(), [this, &scene, &options, &boneAnimations](UINT32 idx)
+		{
+			FBXBoneAnimation& boneAnim = *boneAnimations[idx];
+
+			SPtr<TAnimationCurve<Vector3>> eulerAnimation = 
+				bs_shared_ptr_new<TAnimationCurve<Vector3>>(std::move(boneAnim.eulerRotation));
+			boneAnim.eulerRotation = TAnimationCurve<Vector3>();
+
+			if(options.reduceKeyframes)
+			{
+				boneAnim.translation = reduceKeyframes(boneAnim.translation);
+				boneAnim.scale = reduceKeyframes(boneAnim.scale);
+				*eulerAnimation = reduceKeyframes(*eulerAnimation);
+			}
+
+			boneAnim.translation = AnimationUtility::scaleCurve(boneAnim.translation, scene.scaleFactor);
+			boneAnim.rotation = *AnimationUtility::eulerToQuaternionCurve(eulerAnimation);
+		});
+	}
+
 	void FBXImporter::convertAnimations(const Vector<FBXAnimationClip>& clips, const Vector<AnimationSplitInfo>& splits,
 		const SPtr<Skeleton>& skeleton, bool importRootMotion, Vector<FBXAnimationClipData>& output)
 	{
@@ -862,14 +979,26 @@ namespace bs
 	SPtr<RendererMeshData> FBXImporter::generateMeshData(const FBXImportScene& scene, const FBXImportOptions& options, 
 		Vector<SubMesh>& outputSubMeshes)
 	{
-		Vector<SPtr<MeshData>> allMeshData;
-		Vector<Vector<SubMesh>> allSubMeshes;
-		Vector<BONE_DESC> allBones;
-		UnorderedMap<FBXImportNode*, UINT32> boneMap;
+		UINT32 numMeshes = (UINT32)scene.meshes.size();
+
+		// Bone indices of each mesh are offset by the number of bones in all the meshes before it
+		Vector<UINT32> boneIndexOffsets(numMeshes);
 		UINT32 boneIndexOffset = 0;
+		for (UINT32 i = 0; i < numMeshes; i++)
+		{
+			boneIndexOffsets[i] = boneIndexOffset;
+			boneIndexOffset += (UINT32)scene.meshes[i]->bones.size();
+		}
 
-		for (auto& mesh : scene.meshes)
+		// Each mesh is converted independently, and the results are combined in order afterwards
+		Vector<Vector<SPtr<MeshData>>> meshDataPerMesh(numMeshes);
+		Vector<Vector<SubMesh>> subMeshesPerMesh(numMeshes);
+
+		runJobs(numMeshes, [&scene, &boneIndexOffsets, &meshDataPerMesh, &subMeshesPerMesh](UINT32 meshIdx)
 		{
+			const FBXImportMesh* mesh = scene.meshes[meshIdx];
+			UINT32 boneIndexOffset = boneIndexOffsets[meshIdx];
+
 			Vector<Vector<UINT32>> indicesPerMaterial;
 			for (UINT32 i = 0; i < (UINT32)mesh->indices.size(); i++)
 			{
@@ -880,7 +1009,7 @@ namespace bs
 			}
 
 			UINT32* orderedIndices = (UINT32*)bs_alloc((UINT32)mesh->indices.size() * sizeof(UINT32));
-			Vector<SubMesh> subMeshes;
+			Vector<SubMesh>& subMeshes = subMeshesPerMesh[meshIdx];
 			UINT32 currentIndex = 0;
 
 			for (auto& subMeshIndices : indicesPerMaterial)
@@ -945,7 +1074,7 @@ namespace bs
 					meshData->setIndices(orderedIndices, numIndices * sizeof(UINT32));
 				else
 				{
-					UINT32* flippedIndices = bs_stack_alloc<UINT32>(numIndices);
+					UINT32* flippedIndices = bs_allocN<UINT32>(numIndices);
 
 					for (UINT32 i = 0; i < numIndices; i += 3)
 					{
@@ -955,30 +1084,30 @@ namespace bs
 					}
 
 					meshData->setIndices(flippedIndices, numIndices * sizeof(UINT32));
-					bs_stack_free(flippedIndices);
+					bs_free(flippedIndices);
 				}
 
 				// Copy & transform positions
 				UINT32 positionsSize = sizeof(Vector3) * (UINT32)numVertices;
-				Vector3* transformedPositions = (Vector3*)bs_stack_alloc(positionsSize);
+				Vector3* transformedPositions = (Vector3*)bs_alloc(positionsSize);
 
 				for (UINT32 i = 0; i < (UINT32)numVertices; i++)
 					transformedPositions[i] = worldTransform.multiplyAffine((Vector3)mesh->positions[i]);
 
 				meshData->setPositions(transformedPositions, positionsSize);
-				bs_stack_free(transformedPositions);
+				bs_free(transformedPositions);
 
 				// Copy & transform normals
 				if (hasNormals)
 				{
 					UINT32 normalsSize = sizeof(Vector3) * (UINT32)numVertices;
-					Vector3* transformedNormals = (Vector3*)bs_stack_alloc(normalsSize);
+					Vector3* transformedNormals = (Vector3*)bs_alloc(normalsSize);
 
 					// Copy, convert & transform tangents & bitangents
 					if (hasTangents)
 					{
 						UINT32 tangentsSize = sizeof(Vector4) * (UINT32)numVertices;
-						Vector4* transformedTangents = (Vector4*)bs_stack_alloc(tangentsSize);
+						Vector4* transformedTangents = (Vector4*)bs_alloc(tangentsSize);
 
 						for (UINT32 i = 0; i < (UINT32)numVertices; i++)
 						{
@@ -999,7 +1128,7 @@ namespace bs
 						}
 
 						meshData->setTangents(transformedTangents, tangentsSize);
-						bs_stack_free(transformedTangents);
+						bs_free(transformedTangents);
 					}
 					else // Just normals
 					{
@@ -1008,7 +1137,7 @@ namespace bs
 					}
 
 					meshData->setNormals(transformedNormals, normalsSize);
-					bs_stack_free(transformedNormals);
+					bs_free(transformedNormals);
 				}
 
 				// Copy colors
@@ -1024,7 +1153,7 @@ namespace bs
 					if (uvLayer.size() == numVertices)
 					{
 						UINT32 size = sizeof(Vector2) * (UINT32)numVertices;
-						Vector2* transformedUV = (Vector2*)bs_stack_alloc(size);
+						Vector2* transformedUV = (Vector2*)bs_alloc(size);
 
 						UINT32 i = 0;
 						for (auto& uv : uvLayer)
@@ -1040,7 +1169,7 @@ namespace bs
 						else if (writeUVIDx == 1)
 							meshData->setUV1(transformedUV, size);
 
-						bs_stack_free(transformedUV);
+						bs_free(transformedUV);
 
 						writeUVIDx++;
 					}
@@ -1050,7 +1179,7 @@ namespace bs
 				if(hasBoneInfluences)
 				{
 					UINT32 bufferSize = sizeof(BoneWeight) * (UINT32)numVertices;
-					BoneWeight* weights = (BoneWeight*)bs_stack_alloc(bufferSize);
+					BoneWeight* weights = (BoneWeight*)bs_alloc(bufferSize);
 					for(UINT32 i = 0; i < (UINT32)numVertices; i++)
 					{
 						weights[i].index0 = mesh->boneInfluences[i].indices[0] + boneIndexOffset;
@@ -1065,17 +1194,24 @@ namespace bs
 					}
 
 					meshData->setBoneWeights(weights, bufferSize);
-					bs_stack_free(weights);
+					bs_free(weights);
 				}
 
-				allMeshData.push_back(meshData->getData());
-				allSubMeshes.push_back(subMeshes);
+				meshDataPerMesh[meshIdx].push_back(meshData->getData());
 			}
 
 			bs_free(orderedIndices);
+		});
 
-			UINT32 numBones = (UINT32)mesh->bones.size();
-			boneIndexOffset += numBones;
+		Vector<SPtr<MeshData>> allMeshData;
+		Vector<Vector<SubMesh>> allSubMeshes;
+		for (UINT32 i = 0; i < numMeshes; i++)
+		{
+			for (auto& meshData : meshDataPerMesh[i])
+			{
+				allMeshData.push_back(meshData);
+				allSubMeshes.push_back(subMeshesPerMesh[i]);
+			}
 		}
 
 		if (allMeshData.size() > 1)
@@ -1672,8 +1808,10 @@ namespace bs
 
 	void FBXImporter::generateMissingTangentSpace(FBXImportScene& scene, const FBXImportOptions& options)
 	{
-		for (auto& mesh : scene.meshes)
+		runJobs((UINT32)scene.meshes.size(), [&scene, &options](UINT32 meshIdx)
 		{
+			FBXImportMesh* mesh = scene.meshes[meshIdx];
+
 			UINT32 numVertices = (UINT32)mesh->positions.size();
 			UINT32 numIndices = (UINT32)mesh->indices.size();
 
@@ -1714,7 +1852,7 @@ namespace bs
 					}
 				}
 			}
-		}
+		});
 	}
 
 	void FBXImporter::importAnimations(FbxScene* scene, FBXImportOptions& importOptions, FBXImportScene& importScene)
@@ -1847,13 +1985,13 @@ namespace bs
 				boneAnim.scale = TAnimationCurve<Vector3>(keyframes);
 			}
 
-			SPtr<TAnimationCurve<Vector3>> eulerAnimation = bs_shared_ptr_new<TAnimationCurve<Vector3>>();
 			if (hasCurveValues(rotation))
 			{
 				float defaultValues[3];
 				memcpy(defaultValues, &defaultRotation, sizeof(defaultValues));
 
-				*eulerAnimation = importCurve<Vector3, 3>(rotation, defaultValues, importOptions, clip.start, clip.end);
+				boneAnim.eulerRotation = importCurve<Vector3, 3>(rotation, defaultValues, importOptions, clip.start, 
+					clip.end);
 			}
 			else
 			{
@@ -1862,18 +2000,10 @@ namespace bs
 				keyframes[0].inTangent = Vector3::ZERO;
 				keyframes[0].outTangent = Vector3::ZERO;
 
-				*eulerAnimation = TAnimationCurve<Vector3>(keyframes);
-			}
-
-			if(importOptions.reduceKeyframes)
-			{
-				boneAnim.translation = reduceKeyframes(boneAnim.translation);
-				boneAnim.scale = reduceKeyframes(boneAnim.scale);
-				*eulerAnimation = reduceKeyframes(*eulerAnimation);
+				boneAnim.eulerRotation = TAnimationCurve<Vector3>(keyframes);
 			}
 
-			boneAnim.translation = AnimationUtility::scaleCurve(boneAnim.translation, importScene.scaleFactor);
-			boneAnim.rotation = *AnimationUtility::eulerToQuaternionCurve(eulerAnimation);
+			// Keyframe reduction and conversion to quaternions is performed later, in parallel for all curves
 		}
 
 		if (importOptions.importBlendShapes)
@@ -17,6 +17,7 @@ namespace bs
 
 	struct AnimationSplitInfo;
 	class MorphShapes;
+	struct MESH_DESC;
 
 	/** Importer implementation that handles FBX/OBJ/DAE/3DS file import by using the FBX SDK. */
 	class FBXImporter : public SpecificImporter
@@ -56,6 +57,13 @@ namespace bs
 			Vector<SubMesh>& subMeshes, Vector<FBXAnimationClipData>& animationClips, SPtr<Skeleton>& skeleton, 
 			SPtr<MorphShapes>& morphShapes);
 
+		/**
+		 * Generates simplified versions of the provided mesh data, as requested by the import options, and assigns them to
+		 * the mesh as its levels of detail.
+		 */
+		void generateLODs(const SPtr<Mesh>& mesh, const SPtr<MeshData>& meshData, const MESH_DESC& desc,
+			const MeshImportOptions& importOptions);
+
 		/**
 		 * Loads the data from the file at the provided path into the provided FBX scene. Returns false if the file
 		 * couldn't be loaded.
@@ -107,6 +115,12 @@ namespace bs
 		TAnimationCurve<T> importCurve(FbxAnimCurve*(&fbxCurve)[C], float(&defaultValues)[C], 
 			FBXImportOptions& importOptions, float clipStart, float clipEnd);
 
+		/** 
+		 * Performs keyframe reduction, scaling and euler to quaternion conversion on all imported bone animation curves.
+		 * Curves are processed in parallel.
+		 */
+		void processAnimationCurves(FBXImportScene& scene, const FBXImportOptions& options);
+
 		/** Converts FBX animation clips into engine-ready animation curve format. */
 		void convertAnimations(const Vector<FBXAnimationClip>& clips, const Vector<AnimationSplitInfo>& splits, 
 			const SPtr<Skeleton>& skeleton, bool importRootMotion, Vector<FBXAnimationClipData>& output);
@@ -118,7 +132,7 @@ namespace bs
 		TAnimationCurve<Vector3> reduceKeyframes(TAnimationCurve<Vector3>& curve);
 
 		/**
-		 * Converts all the meshes from per-index attributes to per-vertex attributes.
+		 * Converts all the meshes from per-index attributes to per-vertex attributes. Meshes are processed in parallel.
 		 *
 		 * @note	
 		 * This method will replace all meshes in the scene with new ones, and delete old ones so be sure not to keep any
@@ -127,13 +141,17 @@ namespace bs
 		void splitMeshVertices(FBXImportScene& scene);
 
 		/**
-		 * Traverses over all meshes in the scene and generates normals, tangents and bitangents if they're missing.
+		 * Traverses over all meshes in the scene and generates normals, tangents and bitangents if they're missing. Meshes
+		 * are processed in parallel.
 		 *
 		 * @note	This assumes vertices have already been split and shouldn't be called on pre-split meshes.
 		 */
 		void generateMissingTangentSpace(FBXImportScene& scene, const FBXImportOptions& options);
 
-		/** Converts the mesh data from the imported FBX scene into mesh data that can be used for initializing a mesh. */
+		/** 
+		 * Converts the mesh data from the imported FBX scene into mesh data that can be used for initializing a mesh. Meshes
+		 * are converted in parallel, and combined in the order they appear in the scene.
+		 */
 		SPtr<RendererMeshData> generateMeshData(const FBXImportScene& scene, const FBXImportOptions& options, 
 			Vector<SubMesh>& outputSubMeshes);
 
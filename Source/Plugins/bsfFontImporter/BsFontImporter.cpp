@@ -7,16 +7,530 @@
 #include "Image/BsTextureAtlasLayout.h"
 #include "BsCoreApplication.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Text/BsDynamicFontAtlas.h"
+#include "Math/BsMath.h"
 
 #include <ft2build.h>
 #include <freetype/freetype.h>
 #include FT_FREETYPE_H
 #include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 
 using namespace std::placeholders;
 
 namespace bs
 {
+	/**
+	 * Copies the pixels of a FreeType bitmap into the destination buffer, writing the same 8-bit coverage value into
+	 * each of the @p bytesPerPixel bytes of a destination pixel. Returns false if the bitmap pixel format is not
+	 * supported.
+	 */
+	static bool copyGlyphBitmap(const FT_Bitmap& bitmap, UINT8* dstBuffer, UINT32 dstPitch, UINT32 bytesPerPixel)
+	{
+		UINT8* sourceBuffer = bitmap.buffer;
+
+		if(bitmap.pixel_mode == ft_pixel_mode_grays)
+		{
+			for(INT32 bitmapRow = 0; bitmapRow < (INT32)bitmap.rows; bitmapRow++)
+			{
+				for(INT32 bitmapColumn = 0; bitmapColumn < (INT32)bitmap.width; bitmapColumn++)
+				{
+					for(UINT32 i = 0; i < bytesPerPixel; i++)
+						dstBuffer[bitmapColumn * bytesPerPixel + i] = sourceBuffer[bitmapColumn];
+				}
+
+				dstBuffer += dstPitch;
+				sourceBuffer += bitmap.pitch;
+			}
+		}
+		else if(bitmap.pixel_mode == ft_pixel_mode_mono)
+		{
+			// 8 pixels are packed into a byte, so do some unpacking
+			for(INT32 bitmapRow = 0; bitmapRow < (INT32)bitmap.rows; bitmapRow++)
+			{
+				for(INT32 bitmapColumn = 0; bitmapColumn < (INT32)bitmap.width; bitmapColumn++)
+				{
+					UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
+					UINT8 dstValue = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
+
+					for(UINT32 i = 0; i < bytesPerPixel; i++)
+						dstBuffer[bitmapColumn * bytesPerPixel + i] = dstValue;
+				}
+
+				dstBuffer += dstPitch;
+				sourceBuffer += bitmap.pitch;
+			}
+		}
+		else
+			return false;
+
+		return true;
+	}
+
+	/** Resolution multiplier at which distance field characters are rendered, before being downsampled. */
+	static constexpr UINT32 DISTANCE_FIELD_SUPERSAMPLE = 4;
+
+	/** Maximum distance from the character edge encoded in a distance field, in output pixels. */
+	static constexpr UINT32 DISTANCE_FIELD_SPREAD = 4;
+
+	/**
+	 * Smallest size that distance field fonts are imported at. Smaller sizes lose too much detail when the distance
+	 * field is scaled up.
+	 */
+	static constexpr UINT32 DISTANCE_FIELD_MIN_SIZE = 32;
+
+	/** Divides two integers, rounding towards negative infinity. */
+	static INT32 floorDiv(INT32 a, INT32 b)
+	{
+		return a >= 0 ? a / b : -((-a + b - 1) / b);
+	}
+
+	/** Divides two integers, rounding towards positive infinity. */
+	static INT32 ceilDiv(INT32 a, INT32 b)
+	{
+		return -floorDiv(-a, b);
+	}
+
+	/**
+	 * Calculates the distance from each cell of a grid to the nearest feature cell, using the two pass 8-point
+	 * sequential Euclidean distance transform. Cells are marked as features by setting their offset to (0, 0), and all
+	 * other cells should be set to a large offset. On output each cell contains the offset to its nearest feature.
+	 */
+	static void computeDistanceTransform(Vector<std::pair<INT32, INT32>>& offsets, INT32 width, INT32 height)
+	{
+		auto compare = [&](INT32 x, INT32 y, INT32 dx, INT32 dy)
+		{
+			INT32 nx = x + dx;
+			INT32 ny = y + dy;
+			if (nx < 0 || ny < 0 || nx >= width || ny >= height)
+				return;
+
+			std::pair<INT32, INT32> other = offsets[ny * width + nx];
+			other.first += dx;
+			other.second += dy;
+
+			std::pair<INT32, INT32>& current = offsets[y * width + x];
+			INT32 currentDist = current.first * current.first + current.second * current.second;
+			INT32 otherDist = other.first * other.first + other.second * other.second;
+
+			if (otherDist < currentDist)
+				current = other;
+		};
+
+		for (INT32 y = 0; y < height; y++)
+		{
+			for (INT32 x = 0; x < width; x++)
+			{
+				compare(x, y, -1, 0);
+				compare(x, y, 0, -1);
+				compare(x, y, -1, -1);
+				compare(x, y, 1, -1);
+			}
+
+			for (INT32 x = width - 1; x >= 0; x--)
+				compare(x, y, 1, 0);
+		}
+
+		for (INT32 y = height - 1; y >= 0; y--)
+		{
+			for (INT32 x = width - 1; x >= 0; x--)
+			{
+				compare(x, y, 1, 0);
+				compare(x, y, 0, 1);
+				compare(x, y, -1, 1);
+				compare(x, y, 1, 1);
+			}
+
+			for (INT32 x = 0; x < width; x++)
+				compare(x, y, -1, 0);
+		}
+	}
+
+	/**
+	 * Calculates a signed distance to the character edge for each pixel of the provided coverage grid. Distances are
+	 * positive inside the character and negative outside of it, in pixels.
+	 */
+	static void computeSignedDistance(const Vector<UINT8>& coverage, INT32 width, INT32 height, Vector<float>& output)
+	{
+		static constexpr INT32 FAR_AWAY = 1 << 14;
+
+		UINT32 numPixels = (UINT32)(width * height);
+		Vector<std::pair<INT32, INT32>> toOutside(numPixels);
+		Vector<std::pair<INT32, INT32>> toInside(numPixels);
+
+		for (UINT32 i = 0; i < numPixels; i++)
+		{
+			bool inside = coverage[i] >= 128;
+
+			toOutside[i] = inside ? std::make_pair(FAR_AWAY, FAR_AWAY) : std::make_pair(0, 0);
+			toInside[i] = inside ? std::make_pair(0, 0) : std::make_pair(FAR_AWAY, FAR_AWAY);
+		}
+
+		computeDistanceTransform(toOutside, width, height);
+		computeDistanceTransform(toInside, width, height);
+
+		output.resize(numPixels);
+		for (UINT32 i = 0; i < numPixels; i++)
+		{
+			// Distances are measured between pixel centers, while the edge lies half way between two pixels
+			if (coverage[i] >= 128)
+			{
+				const std::pair<INT32, INT32>& offset = toOutside[i];
+				output[i] = std::sqrt((float)(offset.first * offset.first + offset.second * offset.second)) - 0.5f;
+			}
+			else
+			{
+				const std::pair<INT32, INT32>& offset = toInside[i];
+				output[i] = 0.5f - std::sqrt((float)(offset.first * offset.first + offset.second * offset.second));
+			}
+		}
+	}
+
+	/**
+	 * Renders a glyph as a signed distance field. The character size of the face must be set to the size the
+	 * distance field is being generated for, multiplied by DISTANCE_FIELD_SUPERSAMPLE. Character metrics in the output
+	 * are expressed at the non-multiplied size. Returns false if the glyph cannot be rendered.
+	 */
+	static bool renderDistanceFieldGlyph(FT_Face face, FT_UInt glyphIdx, FT_Int32 loadFlags, RasterizedGlyph& output)
+	{
+		static constexpr INT32 SS = (INT32)DISTANCE_FIELD_SUPERSAMPLE;
+		static constexpr INT32 SPREAD = (INT32)(DISTANCE_FIELD_SPREAD * DISTANCE_FIELD_SUPERSAMPLE);
+
+		if (FT_Load_Glyph(face, glyphIdx, loadFlags))
+			return false;
+
+		if (FT_Render_Glyph(face->glyph, FT_LOAD_TARGET_MODE(loadFlags)))
+			return false;
+
+		FT_GlyphSlot slot = face->glyph;
+		const FT_Bitmap& bitmap = slot->bitmap;
+		if(bitmap.buffer == nullptr && bitmap.rows > 0 && bitmap.width > 0)
+			return false;
+
+		CharDesc& charDesc = output.desc;
+		charDesc.page = 0;
+		charDesc.xAdvance = (INT32)(slot->advance.x / (64 * SS));
+		charDesc.yAdvance = (INT32)(slot->advance.y / (64 * SS));
+
+		// Characters without visible pixels (e.g. whitespace) don't need a distance field
+		if (bitmap.width == 0 || bitmap.rows == 0)
+		{
+			charDesc.width = 0;
+			charDesc.height = 0;
+			charDesc.xOffset = 0;
+			charDesc.yOffset = 0;
+			output.coverage.clear();
+
+			return true;
+		}
+
+		// Pad the bitmap by the spread so the distance falls off outside the character, and align its edges so that
+		// each output pixel covers exactly SS x SS rendered pixels
+		INT32 left = floorDiv(slot->bitmap_left - SPREAD, SS) * SS;
+		INT32 right = ceilDiv(slot->bitmap_left + (INT32)bitmap.width + SPREAD, SS) * SS;
+		INT32 top = ceilDiv(slot->bitmap_top + SPREAD, SS) * SS;
+		INT32 bottom = floorDiv(slot->bitmap_top - (INT32)bitmap.rows - SPREAD, SS) * SS;
+
+		INT32 gridWidth = right - left;
+		INT32 gridHeight = top - bottom;
+
+		Vector<UINT8> coverage(gridWidth * gridHeight, 0);
+		UINT8* dstBuffer = coverage.data() + (top - slot->bitmap_top) * gridWidth + (slot->bitmap_left - left);
+
+		if (!copyGlyphBitmap(bitmap, dstBuffer, gridWidth, 1))
+			return false;
+
+		Vector<float> distances;
+		computeSignedDistance(coverage, gridWidth, gridHeight, distances);
+
+		charDesc.width = (UINT32)(gridWidth / SS);
+		charDesc.height = (UINT32)(gridHeight / SS);
+		charDesc.xOffset = left / SS;
+		charDesc.yOffset = top / SS;
+
+		// Sample the distance at the center of each output pixel, which lies between the four central rendered pixels
+		output.coverage.resize(charDesc.width * charDesc.height);
+		for (UINT32 y = 0; y < charDesc.height; y++)
+		{
+			for (UINT32 x = 0; x < charDesc.width; x++)
+			{
+				INT32 gridX = (INT32)x * SS + SS / 2;
+				INT32 gridY = (INT32)y * SS + SS / 2;
+
+				float distance =
+					distances[(gridY - 1) * gridWidth + gridX - 1] + distances[(gridY - 1) * gridWidth + gridX] +
+					distances[gridY * gridWidth + gridX - 1] + distances[gridY * gridWidth + gridX];
+				distance *= 0.25f;
+
+				float value = Math::clamp01(0.5f + 0.5f * distance / SPREAD);
+				output.coverage[y * charDesc.width + x] = (UINT8)Math::roundToInt(value * 255.0f);
+			}
+		}
+
+		return true;
+	}
+
+	/** Creates a texture from the pixels of a single font page. */
+	static HTexture createFontPage(const SPtr<PixelData>& pixelData, UINT32 pageIdx)
+	{
+		TEXTURE_DESC texDesc;
+		texDesc.width = pixelData->getWidth();
+		texDesc.height = pixelData->getHeight();
+		texDesc.format = PF_RG8;
+
+		HTexture newTex = Texture::create(texDesc);
+
+		// It's possible the formats no longer match
+		if (newTex->getProperties().getFormat() != pixelData->getFormat())
+		{
+			SPtr<PixelData> temp = newTex->getProperties().allocBuffer(0, 0);
+			PixelUtil::bulkPixelConversion(*pixelData, *temp);
+
+			newTex->writeData(temp);
+		}
+		else
+		{
+			newTex->writeData(pixelData);
+		}
+
+		newTex->setName(u8"FontPage" + toString(pageIdx));
+		return newTex;
+	}
+
+	/**
+	 * Generates a font bitmap containing distance fields of all characters in the provided ranges, as well as the
+	 * missing glyph. Throws an exception if a character cannot be rendered.
+	 */
+	static SPtr<FontBitmap> importDistanceField(FT_Face face, const Vector<std::pair<UINT32, UINT32>>& charIndexRanges,
+		UINT32 size, UINT32 dpi, FT_Int32 loadFlags, UINT32 maxTextureSize)
+	{
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(size * DISTANCE_FIELD_SUPERSAMPLE * (1 << 6));
+		if (FT_Set_Char_Size(face, ftSize, 0, dpi, dpi))
+			BS_EXCEPT(InternalErrorException, "Could not set character size.");
+
+		SPtr<FontBitmap> fontData = bs_shared_ptr_new<FontBitmap>();
+		fontData->size = size;
+		fontData->distanceField = true;
+
+		// Render all characters, with the missing glyph always being the last one
+		Vector<RasterizedGlyph> glyphs;
+		INT32 baselineOffset = 0;
+		UINT32 lineHeight = 0;
+
+		auto renderGlyph = [&](FT_UInt glyphIdx, UINT32 charIdx)
+		{
+			glyphs.push_back(RasterizedGlyph());
+			RasterizedGlyph& glyph = glyphs.back();
+
+			if (!renderDistanceFieldGlyph(face, glyphIdx, loadFlags, glyph))
+				BS_EXCEPT(InternalErrorException, "Failed to render a character");
+
+			glyph.desc.charId = charIdx;
+
+			// Metrics of the character itself, excluding the distance field padding
+			FT_GlyphSlot slot = face->glyph;
+			baselineOffset = std::max(baselineOffset, (INT32)(slot->metrics.horiBearingY >> 6) /
+				(INT32)DISTANCE_FIELD_SUPERSAMPLE);
+			lineHeight = std::max(lineHeight, (UINT32)ceilDiv(slot->bitmap.rows, DISTANCE_FIELD_SUPERSAMPLE));
+		};
+
+		for(auto iter = charIndexRanges.begin(); iter != charIndexRanges.end(); ++iter)
+		{
+			for(UINT32 charIdx = iter->first; charIdx <= iter->second; charIdx++)
+				renderGlyph(FT_Get_Char_Index(face, (FT_ULong)charIdx), charIdx);
+		}
+
+		renderGlyph(0, 0);
+
+		// Create an optimal layout for character bitmaps. Characters are separated by a pixel, so they don't bleed into
+		// each other when filtered.
+		Vector<TextureAtlasUtility::Element> atlasElements(glyphs.size());
+		for(size_t i = 0; i < glyphs.size(); i++)
+		{
+			UINT32 width = glyphs[i].desc.width;
+			UINT32 height = glyphs[i].desc.height;
+
+			atlasElements[i].input.width = width > 0 ? width + 1 : 0;
+			atlasElements[i].input.height = height > 0 ? height + 1 : 0;
+		}
+
+		Vector<TextureAtlasUtility::Page> pages = TextureAtlasUtility::createAtlasLayout(atlasElements, 64, 64,
+			maxTextureSize, maxTextureSize, true);
+
+		Vector<SPtr<PixelData>> pixelData(pages.size());
+		for(size_t i = 0; i < pages.size(); i++)
+		{
+			pixelData[i] = bs_shared_ptr_new<PixelData>(pages[i].width, pages[i].height, 1, PF_RG8);
+			pixelData[i]->allocateInternalBuffer();
+			memset(pixelData[i]->getData(), 0, pixelData[i]->getSize());
+		}
+
+		for(size_t i = 0; i < atlasElements.size(); i++)
+		{
+			const TextureAtlasUtility::Element& element = atlasElements[i];
+			const RasterizedGlyph& glyph = glyphs[element.output.idx];
+
+			CharDesc charDesc = glyph.desc;
+			charDesc.page = element.output.page >= 0 ? (UINT32)element.output.page : 0;
+			charDesc.uvX = 0.0f;
+			charDesc.uvY = 0.0f;
+			charDesc.uvWidth = 0.0f;
+			charDesc.uvHeight = 0.0f;
+
+			if (charDesc.width > 0 && charDesc.height > 0)
+			{
+				const TextureAtlasUtility::Page& page = pages[charDesc.page];
+				UINT8* pixelBuffer = pixelData[charDesc.page]->getData();
+
+				// Same value is written to both channels, to match the other render modes
+				for (UINT32 row = 0; row < charDesc.height; row++)
+				{
+					const UINT8* src = glyph.coverage.data() + row * charDesc.width;
+					UINT8* dst = pixelBuffer + ((element.output.y + row) * page.width + element.output.x) * 2;
+
+					for (UINT32 column = 0; column < charDesc.width; column++)
+					{
+						dst[column * 2 + 0] = src[column];
+						dst[column * 2 + 1] = src[column];
+					}
+				}
+
+				float invTexWidth = 1.0f / page.width;
+				float invTexHeight = 1.0f / page.height;
+
+				charDesc.uvX = invTexWidth * element.output.x;
+				charDesc.uvY = invTexHeight * element.output.y;
+				charDesc.uvWidth = invTexWidth * charDesc.width;
+				charDesc.uvHeight = invTexHeight * charDesc.height;
+			}
+
+			bool isMissingGlyph = element.output.idx == (UINT32)(glyphs.size() - 1);
+			if(isMissingGlyph)
+			{
+				fontData->missingGlyph = charDesc;
+				continue;
+			}
+
+			// Load kerning, converted from the supersampled size
+			UINT32 charIdx = charDesc.charId;
+			FT_UInt glyphIdx = FT_Get_Char_Index(face, (FT_ULong)charIdx);
+			for(auto kerningIter = charIndexRanges.begin(); kerningIter != charIndexRanges.end(); ++kerningIter)
+			{
+				for(UINT32 kerningCharIdx = kerningIter->first; kerningCharIdx <= kerningIter->second; kerningCharIdx++)
+				{
+					if(kerningCharIdx == charIdx)
+						continue;
+
+					FT_Vector resultKerning;
+					FT_UInt kerningGlyphIdx = FT_Get_Char_Index(face, (FT_ULong)kerningCharIdx);
+					if(FT_Get_Kerning(face, glyphIdx, kerningGlyphIdx, FT_KERNING_DEFAULT, &resultKerning))
+					{
+						BS_EXCEPT(InternalErrorException, "Failed to get kerning information for character: " +
+							toString(charIdx));
+					}
+
+					INT32 kerningX = (INT32)(resultKerning.x / (64 * (INT32)DISTANCE_FIELD_SUPERSAMPLE));
+					if(kerningX == 0) // We don't store 0 kerning, this is assumed default
+						continue;
+
+					KerningPair pair;
+					pair.amount = kerningX;
+					pair.otherCharId = kerningCharIdx;
+
+					charDesc.kerningPairs.push_back(pair);
+				}
+			}
+
+			fontData->characters[charIdx] = charDesc;
+		}
+
+		for(size_t i = 0; i < pixelData.size(); i++)
+			fontData->texturePages.push_back(createFontPage(pixelData[i], (UINT32)i));
+
+		fontData->baselineOffset = baselineOffset;
+		fontData->lineHeight = lineHeight;
+
+		// Get space size
+		if(FT_Load_Char(face, 32, loadFlags))
+			BS_EXCEPT(InternalErrorException, "Failed to load a character");
+
+		fontData->spaceWidth = (UINT32)(face->glyph->advance.x / (64 * DISTANCE_FIELD_SUPERSAMPLE));
+
+		return fontData;
+	}
+
+	/** Renders font characters on demand using a FreeType face that is kept alive for the lifetime of the rasterizer. */
+	class FreeTypeFontRasterizer : public FontRasterizer
+	{
+	public:
+		FreeTypeFontRasterizer(FT_Library library, FT_Face face, Vector<UINT8> fileData, FT_Int32 loadFlags, UINT32 dpi,
+			bool distanceField)
+			: mLibrary(library), mFace(face), mFileData(std::move(fileData)), mLoadFlags(loadFlags), mDPI(dpi)
+			, mDistanceField(distanceField)
+		{ }
+
+		~FreeTypeFontRasterizer()
+		{
+			FT_Done_FreeType(mLibrary);
+		}
+
+		/** @copydoc FontRasterizer::rasterize */
+		bool rasterize(UINT32 charId, UINT32 size, RasterizedGlyph& output) override
+		{
+			// FreeType faces cannot be used from multiple threads at once
+			Lock lock(mMutex);
+
+			FT_UInt glyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)charId);
+			if (glyphIdx == 0)
+				return false;
+
+			if (mDistanceField)
+				size *= DISTANCE_FIELD_SUPERSAMPLE;
+
+			FT_F26Dot6 ftSize = (FT_F26Dot6)(size * (1 << 6));
+			if (FT_Set_Char_Size(mFace, ftSize, 0, mDPI, mDPI))
+				return false;
+
+			if (mDistanceField)
+			{
+				output.desc.charId = charId;
+				return renderDistanceFieldGlyph(mFace, glyphIdx, mLoadFlags, output);
+			}
+
+			if (FT_Load_Char(mFace, (FT_ULong)charId, mLoadFlags))
+				return false;
+
+			if (FT_Render_Glyph(mFace->glyph, FT_LOAD_TARGET_MODE(mLoadFlags)))
+				return false;
+
+			FT_GlyphSlot slot = mFace->glyph;
+			if(slot->bitmap.buffer == nullptr && slot->bitmap.rows > 0 && slot->bitmap.width > 0)
+				return false;
+
+			CharDesc& charDesc = output.desc;
+			charDesc.charId = charId;
+			charDesc.page = 0;
+			charDesc.width = slot->bitmap.width;
+			charDesc.height = slot->bitmap.rows;
+			charDesc.xOffset = slot->bitmap_left;
+			charDesc.yOffset = slot->bitmap_top;
+			charDesc.xAdvance = slot->advance.x >> 6;
+			charDesc.yAdvance = slot->advance.y >> 6;
+
+			output.coverage.resize(charDesc.width * charDesc.height);
+			return copyGlyphBitmap(slot->bitmap, output.coverage.data(), charDesc.width, 1);
+		}
+
+	private:
+		FT_Library mLibrary;
+		FT_Face mFace;
+		Vector<UINT8> mFileData;
+		FT_Int32 mLoadFlags;
+		UINT32 mDPI;
+		bool mDistanceField;
+		Mutex mMutex;
+	};
+
 	FontImporter::FontImporter()
 		:SpecificImporter() 
 	{
@@ -53,13 +567,23 @@ namespace bs
 		if (error)
 			BS_EXCEPT(InternalErrorException, "Error occurred during FreeType library initialization.");
 
-		FT_Face face;
-
+		// Font data is loaded in memory as FreeType keeps referencing it while the face exists, which can outlive the
+		// import when characters are rendered on demand
+		Vector<UINT8> fileData;
 		{
 			Lock fileLock = FileScheduler::getLock(filePath);
-			error = FT_New_Face(library, filePath.toString().c_str(), 0, &face);
+
+			SPtr<DataStream> stream = FileSystem::openFile(filePath);
+			if (stream != nullptr)
+			{
+				fileData.resize(stream->size());
+				stream->read(fileData.data(), fileData.size());
+			}
 		}
 
+		FT_Face face;
+		error = FT_New_Memory_Face(library, fileData.data(), (FT_Long)fileData.size(), 0, &face);
+
 		if (error == FT_Err_Unknown_File_Format)
 		{
 			BS_EXCEPT(InternalErrorException, "Failed to load font file: " + filePath.toString() + ". Unsupported file format.");
@@ -88,6 +612,9 @@ namespace bs
 		case FontRenderMode::HintedRaster:
 			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
 			break;
+		case FontRenderMode::DistanceField:
+			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
+			break;
 		default:
 			loadFlags = FT_LOAD_TARGET_NORMAL;
 			break;
@@ -95,8 +622,21 @@ namespace bs
 
 		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
 
+		bool distanceField = fontImportOptions->getRenderMode() == FontRenderMode::DistanceField;
+
 		Vector<SPtr<FontBitmap>> dataPerSize;
-		for(size_t i = 0; i < fontSizes.size(); i++)
+		if (distanceField)
+		{
+			// A single distance field is scaled to all requested sizes, so only import it at the largest one
+			UINT32 size = DISTANCE_FIELD_MIN_SIZE;
+			for (auto& fontSize : fontSizes)
+				size = std::max(size, fontSize);
+
+			dataPerSize.push_back(importDistanceField(face, charIndexRanges, size, dpi, loadFlags,
+				MAXIMUM_TEXTURE_SIZE));
+		}
+
+		for(size_t i = 0; i < fontSizes.size() && !distanceField; i++)
 		{
 			// Note: Disabled as its not working and I have bigger issues to handle than to figure this out atm
 			//FT_Matrix m;
@@ -226,42 +766,9 @@ namespace bs
 					if(slot->bitmap.buffer == nullptr && slot->bitmap.rows > 0 && slot->bitmap.width > 0)
 						BS_EXCEPT(InternalErrorException, "Failed to render glyph bitmap");
 
-					UINT8* sourceBuffer = slot->bitmap.buffer;
 					UINT8* dstBuffer = pixelBuffer + (curElement.output.y * pageIter->width * 2) + curElement.output.x * 2;
 
-					if(slot->bitmap.pixel_mode == ft_pixel_mode_grays)
-					{
-						for(INT32 bitmapRow = 0; bitmapRow < slot->bitmap.rows; bitmapRow++)
-						{
-							for(INT32 bitmapColumn = 0; bitmapColumn < slot->bitmap.width; bitmapColumn++)
-							{
-								dstBuffer[bitmapColumn * 2 + 0] = sourceBuffer[bitmapColumn];
-								dstBuffer[bitmapColumn * 2 + 1] = sourceBuffer[bitmapColumn];
-							}
-
-							dstBuffer += pageIter->width * 2;
-							sourceBuffer += slot->bitmap.pitch;
-						}
-					}
-					else if(slot->bitmap.pixel_mode == ft_pixel_mode_mono)
-					{
-						// 8 pixels are packed into a byte, so do some unpacking
-						for(INT32 bitmapRow = 0; bitmapRow < slot->bitmap.rows; bitmapRow++)
-						{
-							for(INT32 bitmapColumn = 0; bitmapColumn < slot->bitmap.width; bitmapColumn++)
-							{
-								UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
-								UINT8 dstValue = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
-
-								dstBuffer[bitmapColumn * 2 + 0] = dstValue;
-								dstBuffer[bitmapColumn * 2 + 1] = dstValue;
-							}
-
-							dstBuffer += pageIter->width * 2;
-							sourceBuffer += slot->bitmap.pitch;
-						}
-					}
-					else
+					if(!copyGlyphBitmap(slot->bitmap, dstBuffer, pageIter->width * 2, 2))
 						BS_EXCEPT(InternalErrorException, "Unsupported pixel mode for a FreeType bitmap.");
 
 					// Store character information
@@ -322,28 +829,7 @@ namespace bs
 					}
 				}
 
-				TEXTURE_DESC texDesc;
-				texDesc.width = pageIter->width;
-				texDesc.height = pageIter->height;
-				texDesc.format = PF_RG8;
-
-				HTexture newTex = Texture::create(texDesc);
-
-				// It's possible the formats no longer match
-				if (newTex->getProperties().getFormat() != pixelData->getFormat())
-				{
-					SPtr<PixelData> temp = newTex->getProperties().allocBuffer(0, 0);
-					PixelUtil::bulkPixelConversion(*pixelData, *temp);
-
-					newTex->writeData(temp);
-				}
-				else
-				{
-					newTex->writeData(pixelData);
-				}
-
-				newTex->setName(u8"FontPage" + toString((UINT32)fontData->texturePages.size()));
-
+				HTexture newTex = createFontPage(pixelData, (UINT32)fontData->texturePages.size());
 				fontData->texturePages.push_back(newTex);
 				pageIdx++;
 			}
@@ -365,7 +851,14 @@ namespace bs
 
 		SPtr<Font> newFont = Font::_createPtr(dataPerSize);
 
-		FT_Done_FreeType(library);
+		// Rasterizer takes ownership of the FreeType library and keeps using the face for rendering characters on demand
+		if (fontImportOptions->getDynamic())
+		{
+			newFont->_setRasterizer(bs_shared_ptr_new<FreeTypeFontRasterizer>(library, face, std::move(fileData),
+				loadFlags, dpi, distanceField));
+		}
+		else
+			FT_Done_FreeType(library);
 
 		const String fileName = filePath.getFilename(false);
 		newFont->setName(fileName);
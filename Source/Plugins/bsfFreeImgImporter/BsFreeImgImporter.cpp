@@ -16,6 +16,8 @@
 #include "FreeImage.h"
 #include "Utility/BsBitwise.h"
 #include "Renderer/BsRenderer.h"
+#include "Importer/BsImporter.h"
+#include "Threading/BsTaskScheduler.h"
 
 using namespace std::placeholders;
 
@@ -175,6 +177,9 @@ namespace bs
 		if (textureImportOptions->getCPUCached())
 			usage |= TU_CPUCACHED;
 
+		if (textureImportOptions->getStreamed() && numMips > 0)
+			usage |= TU_STREAMED;
+
 		bool sRGB = textureImportOptions->getSRGB();
 
 		TEXTURE_DESC texDesc;
@@ -188,29 +193,78 @@ namespace bs
 
 		SPtr<Texture> newTexture = Texture::_createPtr(texDesc);
 
+		// Faces are processed independently, first by generating the mip-maps of each face in parallel, after which every
+		// mip level of every face is converted (and potentially compressed) in parallel
+		const bool isParallel = TaskScheduler::isStarted();
+		auto runJobs = [isParallel](UINT32 count, const std::function<void(UINT32)>& func)
+		{
+			auto runRange = [&func](UINT32 begin, UINT32 end)
+			{
+				for (UINT32 i = begin; i < end; i++)
+					func(i);
+			};
+
+			if (isParallel)
+				TaskScheduler::instance().parallelFor(0, count, 1, runRange);
+			else
+				runRange(0, count);
+		};
+
+		const ImportProgressCallback onProgress = Importer::_getProgressCallback();
+
 		UINT32 numFaces = (UINT32)faceData.size();
-		for (UINT32 i = 0; i < numFaces; i++)
+		Vector<Vector<SPtr<PixelData>>> mipLevels(numFaces);
+
+		// One mip-map generation job per face, followed by one conversion job per mip level of every face
+		std::atomic<UINT32> numCompletedJobs{0};
+		UINT32 numJobs = numFaces * (numMips + 2);
+		auto reportProgress = [&onProgress, &numCompletedJobs, &numJobs]()
+		{
+			UINT32 numCompleted = ++numCompletedJobs;
+			if (onProgress)
+				onProgress(numCompleted / (float)numJobs);
+		};
+
+		runJobs(numFaces, [&](UINT32 face)
 		{
-			Vector<SPtr<PixelData>> mipLevels;
 			if (numMips > 0)
 			{
 				MipMapGenOptions mipOptions;
 				mipOptions.isSRGB = sRGB;
 
-				mipLevels = PixelUtil::genMipmaps(*faceData[i], mipOptions);
+				mipLevels[face] = PixelUtil::genMipmaps(*faceData[face], mipOptions);
 			}
 			else
-				mipLevels.push_back(faceData[i]);
+				mipLevels[face].push_back(faceData[face]);
 
-			for (UINT32 mip = 0; mip < (UINT32)mipLevels.size(); ++mip)
-			{
-				SPtr<PixelData> dst = newTexture->getProperties().allocBuffer(0, mip);
+			reportProgress();
+		});
 
-				PixelUtil::bulkPixelConversion(*mipLevels[mip], *dst);
-				newTexture->writeData(dst, i, mip);
-			}
+		Vector<std::pair<UINT32, UINT32>> faceMips;
+		for (UINT32 face = 0; face < numFaces; face++)
+		{
+			for (UINT32 mip = 0; mip < (UINT32)mipLevels[face].size(); ++mip)
+				faceMips.push_back(std::make_pair(face, mip));
 		}
 
+		numJobs = numFaces + (UINT32)faceMips.size();
+
+		Vector<SPtr<PixelData>> convertedMips(faceMips.size());
+		runJobs((UINT32)faceMips.size(), [&](UINT32 idx)
+		{
+			const UINT32 face = faceMips[idx].first;
+			const UINT32 mip = faceMips[idx].second;
+
+			SPtr<PixelData> dst = newTexture->getProperties().allocBuffer(0, mip);
+			PixelUtil::bulkPixelConversion(*mipLevels[face][mip], *dst);
+
+			convertedMips[idx] = dst;
+			reportProgress();
+		});
+
+		for (UINT32 i = 0; i < (UINT32)faceMips.size(); i++)
+			newTexture->writeData(convertedMips[i], faceMips[i].first, faceMips[i].second);
+
 		const String fileName = filePath.getFilename(false);
 		newTexture->setName(fileName);
 
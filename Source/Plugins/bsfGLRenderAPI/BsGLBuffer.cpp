@@ -3,6 +3,7 @@
 #include "BsGLBuffer.h"
 #include "BsGLHardwareBufferManager.h"
 #include "Error/BsException.h"
+#include "BsGLRenderAPI.h"
 
 namespace bs { namespace ct
 {
@@ -20,10 +21,31 @@ namespace bs { namespace ct
 
 	GLBuffer::~GLBuffer()
 	{
-		if (mBufferId != 0)
+		if (mIsStreaming)
+		{
+			for (auto& region : mRegions)
+			{
+				if (region.fence != nullptr)
+				{
+					glDeleteSync(region.fence);
+					BS_CHECK_GL_ERROR();
+				}
+
+				// Deleting the buffer also unmaps it
+				glDeleteBuffers(1, &region.bufferId);
+				BS_CHECK_GL_ERROR();
+
+				if (RenderAPI::isStarted())
+					static_cast<GLRenderAPI&>(RenderAPI::instance())._notifyBufferDestroyed(region.bufferId);
+			}
+		}
+		else if (mBufferId != 0)
 		{
 			glDeleteBuffers(1, &mBufferId);
 			BS_CHECK_GL_ERROR();
+
+			if (RenderAPI::isStarted())
+				static_cast<GLRenderAPI&>(RenderAPI::instance())._notifyBufferDestroyed(mBufferId);
 		}
 	}
 
@@ -33,6 +55,46 @@ namespace bs { namespace ct
 
 		mTarget = target;
 
+#if BS_OPENGL_4_4
+		// Only vertex and index buffers can stream, as other buffer types get referenced by their ID (e.g. texture buffers)
+		const bool isVertexOrIndex = target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER;
+		if ((usage & GBU_DYNAMIC) != 0 && isVertexOrIndex && size > 0)
+		{
+			GLRenderAPI& rapi = static_cast<GLRenderAPI&>(RenderAPI::instance());
+			mIsStreaming = rapi._isBufferStorageSupported();
+		}
+
+		if (mIsStreaming)
+		{
+			const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+			for (auto& region : mRegions)
+			{
+				glGenBuffers(1, &region.bufferId);
+				BS_CHECK_GL_ERROR();
+
+				if (!region.bufferId)
+					BS_EXCEPT(InternalErrorException, "Cannot create GL buffer");
+
+				glBindBuffer(target, region.bufferId);
+				BS_CHECK_GL_ERROR();
+
+				glBufferStorage(target, size, nullptr, flags);
+				BS_CHECK_GL_ERROR();
+
+				region.mappedData = (UINT8*)glMapBufferRange(target, 0, size, flags);
+				BS_CHECK_GL_ERROR();
+
+				if (region.mappedData == nullptr)
+					BS_EXCEPT(InternalErrorException, "Cannot map OpenGL buffer.");
+			}
+
+			mActiveRegion = 0;
+			mBufferId = mRegions[0].bufferId;
+			return;
+		}
+#endif
+
 		glGenBuffers(1, &mBufferId);
 		BS_CHECK_GL_ERROR();
 
@@ -53,6 +115,9 @@ namespace bs { namespace ct
 		if(mBufferId == 0)
 			return nullptr;
 
+		if (mIsStreaming)
+			return lockStreaming(offset, length, options);
+
 		GLenum access = 0;
 
 		glBindBuffer(mTarget, mBufferId);
@@ -92,7 +157,8 @@ namespace bs { namespace ct
 
 	void GLBuffer::unlock()
 	{
-		if(mBufferId == 0)
+		// Streaming buffers remain mapped for their entire lifetime, and their mappings are coherent
+		if(mBufferId == 0 || mIsStreaming)
 			return;
 
 		glBindBuffer(mTarget, mBufferId);
@@ -149,4 +215,64 @@ namespace bs { namespace ct
 		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, dstOffset, length);
 		BS_CHECK_GL_ERROR();
 	}
+
+	void* GLBuffer::lockStreaming(UINT32 offset, UINT32 length, GpuLockOptions options)
+	{
+		if (options == GBL_WRITE_ONLY_DISCARD)
+		{
+			// Retire the current region and move onto the next one. Only commands issued so far can reference the
+			// retired region, as any later ones will see the new buffer ID.
+			StreamingRegion& oldRegion = mRegions[mActiveRegion];
+			oldRegion.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			BS_CHECK_GL_ERROR();
+
+			mActiveRegion = (mActiveRegion + 1) % NUM_STREAMING_REGIONS;
+			mBufferId = mRegions[mActiveRegion].bufferId;
+
+			// Only blocks if the GPU is more than NUM_STREAMING_REGIONS - 1 discards behind
+			waitForRegion(mRegions[mActiveRegion]);
+		}
+		else if (options != GBL_WRITE_ONLY_NO_OVERWRITE)
+		{
+			// Caller expects to see (or overwrite) data the GPU might still be using, so synchronize with all commands
+			// issued so far
+			StreamingRegion& region = mRegions[mActiveRegion];
+			region.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			BS_CHECK_GL_ERROR();
+
+			waitForRegion(region);
+		}
+
+		return mRegions[mActiveRegion].mappedData + offset;
+	}
+
+	void GLBuffer::waitForRegion(StreamingRegion& region)
+	{
+		if (region.fence == nullptr)
+			return;
+
+		// Flush on the first wait so the fence is guaranteed to eventually signal
+		GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+		while (true)
+		{
+			const GLenum result = glClientWaitSync(region.fence, waitFlags, 1000000);
+			BS_CHECK_GL_ERROR();
+
+			if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+				break;
+
+			if (result == GL_WAIT_FAILED)
+			{
+				LOGERR("Failed waiting on an OpenGL fence.");
+				break;
+			}
+
+			waitFlags = 0;
+		}
+
+		glDeleteSync(region.fence);
+		BS_CHECK_GL_ERROR();
+
+		region.fence = nullptr;
+	}
 }}
\ No newline at end of file
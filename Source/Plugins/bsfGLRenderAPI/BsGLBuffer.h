@@ -12,7 +12,15 @@ namespace bs { namespace ct
 	 *  @{
 	 */
 
-	/** Wrapper around a generic OpenGL buffer. */
+	/**
+	 * Wrapper around a generic OpenGL buffer.
+	 *
+	 * Dynamic vertex and index buffers are created as streaming buffers when GL_ARB_buffer_storage is supported. Such
+	 * buffers are backed by a ring of persistently mapped buffer objects (regions), and each discard moves the buffer onto
+	 * the next region instead of orphaning its storage. A fence is inserted whenever a region is retired, and the region
+	 * is only written to again once the GPU is done with it. This means the internal OpenGL buffer ID of a streaming
+	 * buffer may change after every discarding lock.
+	 */
 	class GLBuffer
 	{
 	public:
@@ -77,11 +85,32 @@ namespace bs { namespace ct
 		/**	Returns internal OpenGL buffer ID. */
 		GLuint getGLBufferId() const { return mBufferId; }
 
+		/** Number of regions a streaming buffer cycles through. */
+		static const UINT32 NUM_STREAMING_REGIONS = 3;
+
 	private:
+		/** Single region of a streaming buffer. */
+		struct StreamingRegion
+		{
+			GLuint bufferId = 0;
+			UINT8* mappedData = nullptr;
+			GLsync fence = nullptr;
+		};
+
+		/** Maps the provided portion of a streaming buffer, waiting on or switching regions as required by @p options. */
+		void* lockStreaming(UINT32 offset, UINT32 length, GpuLockOptions options);
+
+		/** Blocks until the GPU is done with all commands issued before the region's fence was inserted. */
+		void waitForRegion(StreamingRegion& region);
+
 		GLenum mTarget;
 		GLuint mBufferId;
 
 		bool mZeroLocked;
+
+		bool mIsStreaming = false;
+		UINT32 mActiveRegion = 0;
+		StreamingRegion mRegions[NUM_STREAMING_REGIONS];
 	};
 
 	/** @} */
@@ -3,6 +3,7 @@
 #include "BsGLGpuParamBlockBuffer.h"
 #include "Profiling/BsRenderStats.h"
 #include "Error/BsException.h"
+#include "BsGLRenderAPI.h"
 
 namespace bs { namespace ct
 {
@@ -17,6 +18,9 @@ namespace bs { namespace ct
 		glDeleteBuffers(1, &mGLHandle);
 		BS_CHECK_GL_ERROR();
 
+		if (RenderAPI::isStarted())
+			static_cast<GLRenderAPI&>(RenderAPI::instance())._notifyBufferDestroyed(mGLHandle);
+
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuParamBuffer);
 	}
 
@@ -106,7 +106,8 @@ namespace bs { namespace ct
 	{
 		RenderStatObject_PipelineObject = 100,
 		RenderStatObject_FrameBufferObject,
-		RenderStatObject_VertexArrayObject
+		RenderStatObject_VertexArrayObject,
+		RenderStatObject_SamplerState
 	};
 
 	/** @} */
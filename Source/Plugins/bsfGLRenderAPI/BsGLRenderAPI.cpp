@@ -28,6 +28,8 @@
 #include "BsGLCommandBuffer.h"
 #include "BsGLCommandBufferManager.h"
 #include "BsGLTextureView.h"
+#include "BsGLSamplerState.h"
+#include "BsGLRenderStateManager.h"
 #include "GLSL/BsGLSLParamParser.h"
 
 namespace bs { namespace ct
@@ -108,9 +110,6 @@ namespace bs { namespace ct
 
 		mGLInitialised = false;
 
-		mMinFilter = FO_LINEAR;
-		mMipFilter = FO_POINT;
-
 		mProgramPipelineManager = bs_new<GLSLProgramPipelineManager>();
 	}
 
@@ -136,7 +135,7 @@ namespace bs { namespace ct
 		bs::RenderWindowManager::startUp<bs::GLRenderWindowManager>(this);
 		RenderWindowManager::startUp();
 
-		RenderStateManager::startUp();
+		RenderStateManager::startUp<GLRenderStateManager>();
 
 		QueryManager::startUp<GLQueryManager>();
 
@@ -258,6 +257,9 @@ namespace bs { namespace ct
 	void GLRenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getBoundState(commandBuffer).setGraphicsPipeline(pipelineState))
+			return;
+
 		auto executeRef = [&](const SPtr<GraphicsPipelineState>& pipelineState)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -376,6 +378,9 @@ namespace bs { namespace ct
 	void GLRenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getBoundState(commandBuffer).setComputePipeline(pipelineState))
+			return;
+
 		auto executeRef = [&](const SPtr<ComputePipelineState>& pipelineState)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -405,17 +410,19 @@ namespace bs { namespace ct
 
 	void GLRenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getBoundState(commandBuffer).setGpuParams(gpuParams))
+			return;
+
 		auto executeRef = [&](const SPtr<GpuParams>& gpuParams)
 		{
 			THROW_IF_NOT_CORE_THREAD;
 
-#if BS_OPENGL_4_2 || BS_OPENGLES_3_1
-			for (UINT32 i = 0; i < 8; i++)
-			{
-				glBindImageTexture(i, 0, 0, false, 0, GL_READ_WRITE, GL_R32F);
-				BS_CHECK_GL_ERROR();
-			}
-#endif
+			// Other parts of the backend bind textures to the active unit directly (e.g. when reading or writing texture
+			// data), so its cached binding cannot be trusted
+			if (mActiveTextureUnit < mNumTextureUnits)
+				mTextureBindings.invalidate(mActiveTextureUnit);
+			else if (mNumTextureUnits > 0)
+				mTextureBindings.invalidate(0);
 
 			bs_frame_mark();
 			{
@@ -477,10 +484,6 @@ namespace bs { namespace ct
 						const TextureSurface& surface = gpuParams->getTextureSurface(entry.second.set, binding);
 
 						UINT32 unit = getTexUnit(binding);
-						if (!activateGLTextureUnit(unit))
-							continue;
-
-						TextureInfo& texInfo = mTextureInfos[unit];
 
 						GLTexture* glTex = static_cast<GLTexture*>(texture.get());
 						GLenum newTextureType;
@@ -522,25 +525,12 @@ namespace bs { namespace ct
 							texId = 0;
 						}
 
-						if (texInfo.type != newTextureType)
-						{
-							glBindTexture(texInfo.type, 0);
-							BS_CHECK_GL_ERROR();
-						}
-
-						glBindTexture(newTextureType, texId);
-						BS_CHECK_GL_ERROR();
-
-						texInfo.type = newTextureType;
+						if (!bindTexture(unit, newTextureType, texId))
+							continue;
 
 						SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
-						if (activeProgram != nullptr)
-						{
-							GLuint glProgram = activeProgram->getGLHandle();
-
-							glProgramUniform1i(glProgram, binding, unit);
-							BS_CHECK_GL_ERROR();
-						}
+						if (activeProgram != nullptr && !activeProgram->setUniformUnit(binding, unit))
+							mNumBindsSkipped++;
 					}
 
 					for(auto& entry : paramDesc->samplers)
@@ -551,34 +541,11 @@ namespace bs { namespace ct
 						if (samplerState == nullptr)
 							samplerState = SamplerState::getDefault();
 
+						// Sampler objects are ignored by multisampled textures and buffers, so they can be bound regardless
+						// of the texture type
 						UINT32 unit = getTexUnit(binding);
-						if (!activateGLTextureUnit(unit))
-							continue;
-
-						// No sampler options for multisampled textures or buffers
-						bool supportsSampler = mTextureInfos[unit].type != GL_TEXTURE_2D_MULTISAMPLE &&
-							mTextureInfos[unit].type != GL_TEXTURE_2D_MULTISAMPLE_ARRAY &&
-							mTextureInfos[unit].type != GL_TEXTURE_BUFFER;
-
-						if (supportsSampler)
-						{
-							const SamplerProperties& stateProps = samplerState->getProperties();
-
-							setTextureFiltering(unit, FT_MIN, stateProps.getTextureFiltering(FT_MIN));
-							setTextureFiltering(unit, FT_MAG, stateProps.getTextureFiltering(FT_MAG));
-							setTextureFiltering(unit, FT_MIP, stateProps.getTextureFiltering(FT_MIP));
-
-							setTextureAnisotropy(unit, stateProps.getTextureAnisotropy());
-							setTextureCompareMode(unit, stateProps.getComparisonFunction());
-
-							setTextureMipmapBias(unit, stateProps.getTextureMipmapBias());
-							setTextureMipmapRange(unit, stateProps.getMinimumMip(), stateProps.getMaximumMip());
-
-							const UVWAddressingMode& uvw = stateProps.getTextureAddressingMode();
-							setTextureAddressingMode(unit, uvw);
-
-							setTextureBorderColor(unit, stateProps.getBorderColor());
-						}
+						GLSamplerState* glSamplerState = static_cast<GLSamplerState*>(samplerState.get());
+						bindSampler(unit, glSamplerState->getGLHandle());
 					}
 
 					for(auto& entry : paramDesc->buffers)
@@ -593,32 +560,17 @@ namespace bs { namespace ct
 						case GPOT_BYTE_BUFFER: // Texture buffer (read-only, unstructured)
 							{
 								UINT32 unit = getTexUnit(binding);
-								if (!activateGLTextureUnit(unit))
-									continue;
 
 								GLuint texId = 0;
 								if (glBuffer != nullptr)
 									texId = glBuffer->getGLTextureId();
 
-								if (mTextureInfos[unit].type != GL_TEXTURE_BUFFER)
-								{
-									glBindTexture(mTextureInfos[unit].type, 0);
-									BS_CHECK_GL_ERROR();
-								}
-
-								mTextureInfos[unit].type = GL_TEXTURE_BUFFER;
-
-								glBindTexture(GL_TEXTURE_BUFFER, texId);
-								BS_CHECK_GL_ERROR();
+								if (!bindTexture(unit, GL_TEXTURE_BUFFER, texId))
+									continue;
 
 								SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
-								if (activeProgram != nullptr)
-								{
-									GLuint glProgram = activeProgram->getGLHandle();
-
-									glProgramUniform1i(glProgram, binding, unit);
-									BS_CHECK_GL_ERROR();
-								}
+								if (activeProgram != nullptr && !activeProgram->setUniformUnit(binding, unit))
+									mNumBindsSkipped++;
 							}
 							break;
 #if BS_OPENGL_4_2 || BS_OPENGLES_3_1
@@ -634,17 +586,11 @@ namespace bs { namespace ct
 									format = glBuffer->getGLFormat();
 								}
 
-								glBindImageTexture(unit, texId, 0, false, 0, GL_READ_WRITE, format);
-								BS_CHECK_GL_ERROR();
+								bindImageTexture(unit, texId, 0, GL_FALSE, 0, format);
 
 								SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
-								if (activeProgram != nullptr)
-								{
-									GLuint glProgram = activeProgram->getGLHandle();
-
-									glProgramUniform1i(glProgram, binding, unit);
-									BS_CHECK_GL_ERROR();
-								}
+								if (activeProgram != nullptr && !activeProgram->setUniformUnit(binding, unit))
+									mNumBindsSkipped++;
 							}
 							break;
 #endif
@@ -657,17 +603,12 @@ namespace bs { namespace ct
 								if (glBuffer != nullptr)
 									bufferId = glBuffer->getGLBufferId();
 
-								glBindBufferBase(GL_SHADER_STORAGE_BUFFER, unit, bufferId);
-								BS_CHECK_GL_ERROR();
+								if (!bindBuffer(GL_SHADER_STORAGE_BUFFER, unit, bufferId))
+									continue;
 
 								SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
-								if (activeProgram != nullptr)
-								{
-									GLuint glProgram = activeProgram->getGLHandle();
-
-									glShaderStorageBlockBinding(glProgram, binding, unit);
-									BS_CHECK_GL_ERROR();
-								}
+								if (activeProgram != nullptr && !activeProgram->setStorageBlockBinding(binding, unit))
+									mNumBindsSkipped++;
 							}
 							break;
 #endif
@@ -717,17 +658,11 @@ namespace bs { namespace ct
 							face = surface.face;
 						}
 
-						glBindImageTexture(unit, texId, mipLevel, bindAllLayers, face, GL_READ_WRITE, format);
-						BS_CHECK_GL_ERROR();
+						bindImageTexture(unit, texId, mipLevel, bindAllLayers, face, format);
 
 						SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
-						if (activeProgram != nullptr)
-						{
-							GLuint glProgram = activeProgram->getGLHandle();
-
-							glProgramUniform1i(glProgram, binding, unit);
-							BS_CHECK_GL_ERROR();
-						}
+						if (activeProgram != nullptr && !activeProgram->setUniformUnit(binding, unit))
+							mNumBindsSkipped++;
 					}
 #endif
 
@@ -894,18 +829,36 @@ namespace bs { namespace ct
 							const GLGpuParamBlockBuffer* glParamBlockBuffer = static_cast<const GLGpuParamBlockBuffer*>(buffer.get());
 
 							UINT32 unit = getUniformUnit(binding - 1);
-							glUniformBlockBinding(glProgram, binding - 1, unit);
-							BS_CHECK_GL_ERROR();
+							if (!bindBuffer(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLHandle()))
+								continue;
 
-							glBindBufferBase(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLHandle());
-							BS_CHECK_GL_ERROR();
+							if (!activeProgram->setUniformBlockBinding(binding - 1, unit))
+								mNumBindsSkipped++;
 						}
 					}
 				}
+
+#if BS_OPENGL_4_2 || BS_OPENGLES_3_1
+				// Unbind any images left over from previous binds, so they aren't accidentally accessed
+				for (UINT32 i = imageUnitCount; i < mNumBoundImageUnits; i++)
+					bindImageTexture(i, 0, 0, GL_FALSE, 0, GL_R32F);
+
+				mNumBoundImageUnits = imageUnitCount;
+#endif
 			}
 			bs_frame_clear();
 
+			applyTextureBindings();
+			applyBufferBindings(GL_UNIFORM_BUFFER);
+
+#if BS_OPENGL_4_3 || BS_OPENGLES_3_1
+			applyBufferBindings(GL_SHADER_STORAGE_BUFFER);
+#endif
+
 			activateGLTextureUnit(0);
+
+			BS_ADD_RENDER_STAT(NumRedundantBindsSkipped, mNumBindsSkipped);
+			mNumBindsSkipped = 0;
 		};
 
 		if (commandBuffer == nullptr)
@@ -966,6 +919,9 @@ namespace bs { namespace ct
 	void GLRenderAPI::setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags, 
 		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		// Binding a render window might switch the active context, which unbinds the pipeline
+		getBoundState(commandBuffer).reset();
+
 		auto executeRef = [&](const SPtr<RenderTarget>& target, UINT32 readOnlyFlags)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -1042,6 +998,9 @@ namespace bs { namespace ct
 		}
 #endif
 
+		if (!getBoundState(commandBuffer).setVertexBuffers(index, buffers, numBuffers))
+			return;
+
 		auto executeRef = [&](UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -1110,6 +1069,9 @@ namespace bs { namespace ct
 
 	void GLRenderAPI::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getBoundState(commandBuffer).setIndexBuffer(buffer))
+			return;
+
 		auto executeRef = [&](const SPtr<IndexBuffer>& buffer)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -1250,6 +1212,115 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
 
+	void GLRenderAPI::drawIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, 
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		auto executeRef = [&](const SPtr<GpuBuffer>& argsBuffer, UINT32 offset)
+		{
+			THROW_IF_NOT_CORE_THREAD;
+
+			GLint primType = getGLDrawMode();
+			beginDraw();
+
+			GLGpuBuffer* glArgsBuffer = static_cast<GLGpuBuffer*>(argsBuffer.get());
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, glArgsBuffer->getGLBufferId());
+			BS_CHECK_GL_ERROR();
+
+			glDrawArraysIndirect(primType, (GLvoid*)(UINT64)offset);
+			BS_CHECK_GL_ERROR();
+
+			endDraw();
+		};
+
+		if (commandBuffer == nullptr)
+			executeRef(argsBuffer, offset);
+		else
+		{
+			auto execute = [=]() { executeRef(argsBuffer, offset); };
+
+			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
+			cb->queueCommand(execute);
+		}
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+	}
+
+	void GLRenderAPI::drawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, 
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		multiDrawIndexedIndirect(argsBuffer, offset, 1, nullptr, 0, commandBuffer);
+	}
+
+	void GLRenderAPI::multiDrawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, UINT32 drawCount,
+		const SPtr<GpuBuffer>& countBuffer, UINT32 countOffset, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		auto executeRef = [&](const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, UINT32 drawCount, 
+			const SPtr<GpuBuffer>& countBuffer, UINT32 countOffset)
+		{
+			THROW_IF_NOT_CORE_THREAD;
+
+			if (mBoundIndexBuffer == nullptr)
+			{
+				LOGWRN("Cannot draw indexed because index buffer is not set.");
+				return;
+			}
+
+			GLint primType = getGLDrawMode();
+			beginDraw();
+
+			SPtr<GLIndexBuffer> indexBuffer = std::static_pointer_cast<GLIndexBuffer>(mBoundIndexBuffer);
+			const IndexBufferProperties& ibProps = indexBuffer->getProperties();
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer->getGLBufferId());
+			BS_CHECK_GL_ERROR();
+
+			GLGpuBuffer* glArgsBuffer = static_cast<GLGpuBuffer*>(argsBuffer.get());
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, glArgsBuffer->getGLBufferId());
+			BS_CHECK_GL_ERROR();
+
+			GLenum indexType = (ibProps.getType() == IT_16BIT) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+#if BS_OPENGL_4_3
+			if (countBuffer != nullptr && mHasIndirectParameters)
+			{
+				GLGpuBuffer* glCountBuffer = static_cast<GLGpuBuffer*>(countBuffer.get());
+				glBindBuffer(GL_PARAMETER_BUFFER_ARB, glCountBuffer->getGLBufferId());
+				BS_CHECK_GL_ERROR();
+
+				glMultiDrawElementsIndirectCountARB(primType, indexType, (GLvoid*)(UINT64)offset, 
+					(GLintptr)countOffset, drawCount, 0);
+				BS_CHECK_GL_ERROR();
+			}
+			else
+			{
+				glMultiDrawElementsIndirect(primType, indexType, (GLvoid*)(UINT64)offset, drawCount, 0);
+				BS_CHECK_GL_ERROR();
+			}
+#else
+			for (UINT32 i = 0; i < drawCount; i++)
+			{
+				UINT32 drawOffset = offset + i * sizeof(DrawIndexedIndirectArgs);
+				glDrawElementsIndirect(primType, indexType, (GLvoid*)(UINT64)drawOffset);
+				BS_CHECK_GL_ERROR();
+			}
+#endif
+
+			endDraw();
+		};
+
+		if (commandBuffer == nullptr)
+			executeRef(argsBuffer, offset, drawCount, countBuffer, countOffset);
+		else
+		{
+			auto execute = [=]() { executeRef(argsBuffer, offset, drawCount, countBuffer, countOffset); };
+
+			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
+			cb->queueCommand(execute);
+		}
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_INC_RENDER_STAT(NumIndexBufferBinds);
+	}
+
 	void GLRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ, 
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
@@ -1385,6 +1456,9 @@ namespace bs { namespace ct
 		SPtr<GLCommandBuffer> secondaryCb = std::static_pointer_cast<GLCommandBuffer>(secondary);
 
 		cb->appendSecondary(secondaryCb);
+
+		// Secondary buffer's commands leave the state in an unknown configuration
+		cb->_getBoundState().reset();
 	}
 
 	void GLRenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
@@ -1395,6 +1469,10 @@ namespace bs { namespace ct
 
 		cb->executeCommands();
 		cb->clear();
+
+		// All command buffers execute on the same context, so its state is no longer known
+		cb->_getBoundState().reset();
+		mImmediateBoundState.reset();
 	}
 
 	void GLRenderAPI::clearArea(UINT32 buffers, const Color& color, float depth, UINT16 stencil, const Rect2I& clearRect, 
@@ -1568,40 +1646,6 @@ namespace bs { namespace ct
 	/* 								PRIVATE		                     		*/
 	/************************************************************************/
 
-	void GLRenderAPI::setTextureAddressingMode(UINT16 unit, const UVWAddressingMode& uvw)
-	{
-		glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_WRAP_S, getTextureAddressingMode(uvw.u));
-		BS_CHECK_GL_ERROR();
-
-		glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_WRAP_T, getTextureAddressingMode(uvw.v));
-		BS_CHECK_GL_ERROR();
-
-		glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_WRAP_R, getTextureAddressingMode(uvw.w));
-		BS_CHECK_GL_ERROR();
-	}
-
-	void GLRenderAPI::setTextureBorderColor(UINT16 unit, const Color& color)
-	{
-		GLfloat border[4] = { color.r, color.g, color.b, color.a };
-		glTexParameterfv(mTextureInfos[unit].type, GL_TEXTURE_BORDER_COLOR, border);
-		BS_CHECK_GL_ERROR();
-	}
-
-	void GLRenderAPI::setTextureMipmapBias(UINT16 unit, float bias)
-	{
-		glTexParameterf(mTextureInfos[unit].type, GL_TEXTURE_LOD_BIAS, bias);
-		BS_CHECK_GL_ERROR();
-	}
-
-	void GLRenderAPI::setTextureMipmapRange(UINT16 unit, float min, float max)
-	{
-		glTexParameterf(mTextureInfos[unit].type, GL_TEXTURE_MIN_LOD, min);
-		BS_CHECK_GL_ERROR();
-
-		glTexParameterf(mTextureInfos[unit].type, GL_TEXTURE_MAX_LOD, max);
-		BS_CHECK_GL_ERROR();
-	}
-
 	void GLRenderAPI::setSceneBlending(BlendFactor sourceFactor, BlendFactor destFactor, BlendOperation op)
 	{
 		GLint sourceBlend = getBlendMode(sourceFactor);
@@ -2005,103 +2049,328 @@ namespace bs { namespace ct
 		BS_CHECK_GL_ERROR();
 	}
 
-	void GLRenderAPI::setTextureFiltering(UINT16 unit, FilterType ftype, FilterOptions fo)
+	bool GLRenderAPI::activateGLTextureUnit(UINT16 unit)
 	{
-		switch(ftype)
+		if (mActiveTextureUnit != unit)
 		{
-		case FT_MIN:
-			mMinFilter = fo;
-			// Combine with existing mip filter
-			glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_MIN_FILTER, getCombinedMinMipFilter());
-			BS_CHECK_GL_ERROR();
-			break;
-		case FT_MAG:
-			switch (fo)
+			if (unit < getCapabilities(0).getNumCombinedTextureUnits())
 			{
-			case FO_ANISOTROPIC: // GL treats linear and aniso the same
-			case FO_LINEAR:
-				glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-				BS_CHECK_GL_ERROR();
-				break;
-			case FO_POINT:
-			case FO_NONE:
-				glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+				glActiveTexture(GL_TEXTURE0 + unit);
 				BS_CHECK_GL_ERROR();
-				break;
-			default:
-				break;
+
+				mActiveTextureUnit = unit;
+				return true;
+			}
+			else if (!unit)
+			{
+				// Always ok to use the first unit
+				return true;
+			}
+			else
+			{
+				LOGWRN("Provided texture unit index is higher than OpenGL supports. Provided: " + toString(unit) + 
+					". Supported range: 0 .. " + toString(getCapabilities(0).getNumCombinedTextureUnits() - 1));
+				return false;
 			}
-			break;
-		case FT_MIP:
-			mMipFilter = fo;
-			// Combine with existing min filter
-			glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_MIN_FILTER, getCombinedMinMipFilter());
-			BS_CHECK_GL_ERROR();
-			break;
+		}
+		else
+		{
+			return true;
 		}
 	}
 
-	void GLRenderAPI::setTextureAnisotropy(UINT16 unit, UINT32 maxAnisotropy)
+	bool GLRenderAPI::bindTexture(UINT32 unit, GLenum target, GLuint texId)
 	{
-		GLfloat maxSupportAnisotropy = 0;
-		glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxSupportAnisotropy);
-		BS_CHECK_GL_ERROR();
-
-		if (maxAnisotropy > maxSupportAnisotropy)
-			maxAnisotropy = maxSupportAnisotropy ? static_cast<UINT32>(maxSupportAnisotropy) : 1;
+		if (unit >= mNumTextureUnits)
+		{
+			LOGWRN("Provided texture unit index is higher than OpenGL supports. Provided: " + toString(unit) +
+				". Supported range: 0 .. " + toString(mNumTextureUnits - 1));
+			return false;
+		}
 
-		if(maxAnisotropy < 1)
-			maxAnisotropy = 1;
+		mPendingTextureTypes[unit] = target;
+		if (!mTextureBindings.set(unit, texId))
+			mNumBindsSkipped++;
 
-		glTexParameterf(mTextureInfos[unit].type, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)maxAnisotropy);
-		BS_CHECK_GL_ERROR();
+		return true;
 	}
 
-	void GLRenderAPI::setTextureCompareMode(UINT16 unit, CompareFunction compare)
+	bool GLRenderAPI::bindSampler(UINT32 unit, GLuint samplerId)
 	{
-		if (compare == CMPF_ALWAYS_PASS)
-		{
-			glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_COMPARE_MODE, GL_NONE);
-			BS_CHECK_GL_ERROR();
-		}
-		else
-		{
-			glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
-			BS_CHECK_GL_ERROR();
+		if (unit >= mNumTextureUnits)
+			return false;
 
-			glTexParameteri(mTextureInfos[unit].type, GL_TEXTURE_COMPARE_FUNC, convertCompareFunction(compare));
-			BS_CHECK_GL_ERROR();
-		}
+		if (!mSamplerBindings.set(unit, samplerId))
+			mNumBindsSkipped++;
+
+		return true;
 	}
 
-	bool GLRenderAPI::activateGLTextureUnit(UINT16 unit)
+	void GLRenderAPI::applyTextureBindings()
 	{
-		if (mActiveTextureUnit != unit)
+		if (mTextureBindings.isDirty())
 		{
-			if (unit < getCapabilities(0).getNumCombinedTextureUnits())
+			const UINT32 start = mTextureBindings.dirtyStart;
+			const UINT32 end = mTextureBindings.dirtyEnd;
+
+			UINT32 numChanged = 0;
+			for (UINT32 i = start; i < end; i++)
 			{
-				glActiveTexture(GL_TEXTURE0 + unit);
+				if (mTextureBindings.pending[i] == mTextureBindings.bound[i])
+					continue;
+
+				numChanged++;
+
+				if (!mHasMultiBind)
+				{
+					activateGLTextureUnit((UINT16)i);
+
+					TextureInfo& texInfo = mTextureInfos[i];
+					if (texInfo.type != mPendingTextureTypes[i])
+					{
+						glBindTexture(texInfo.type, 0);
+						BS_CHECK_GL_ERROR();
+					}
+
+					glBindTexture(mPendingTextureTypes[i], mTextureBindings.pending[i]);
+					BS_CHECK_GL_ERROR();
+				}
+
+				mTextureInfos[i].type = mPendingTextureTypes[i];
+			}
+
+#if BS_OPENGL_4_4
+			if (mHasMultiBind && numChanged > 0)
+			{
+				// Binds each texture to its own target, and unbinds all targets of units provided with a null texture
+				glBindTextures(start, end - start, &mTextureBindings.pending[start]);
 				BS_CHECK_GL_ERROR();
 
-				mActiveTextureUnit = unit;
-				return true;
+				mNumBindsSkipped += numChanged - 1;
 			}
-			else if (!unit)
+#endif
+
+			mTextureBindings.markApplied();
+		}
+
+		if (mSamplerBindings.isDirty())
+		{
+			const UINT32 start = mSamplerBindings.dirtyStart;
+			const UINT32 end = mSamplerBindings.dirtyEnd;
+
+			UINT32 numChanged = 0;
+			for (UINT32 i = start; i < end; i++)
 			{
-				// Always ok to use the first unit
-				return true;
+				if (mSamplerBindings.pending[i] == mSamplerBindings.bound[i])
+					continue;
+
+				numChanged++;
+
+				if (!mHasMultiBind)
+				{
+					glBindSampler(i, mSamplerBindings.pending[i]);
+					BS_CHECK_GL_ERROR();
+				}
 			}
-			else
+
+#if BS_OPENGL_4_4
+			if (mHasMultiBind && numChanged > 0)
 			{
-				LOGWRN("Provided texture unit index is higher than OpenGL supports. Provided: " + toString(unit) + 
-					". Supported range: 0 .. " + toString(getCapabilities(0).getNumCombinedTextureUnits() - 1));
-				return false;
+				glBindSamplers(start, end - start, &mSamplerBindings.pending[start]);
+				BS_CHECK_GL_ERROR();
+
+				mNumBindsSkipped += numChanged - 1;
+			}
+#endif
+
+			mSamplerBindings.markApplied();
+		}
+	}
+
+	bool GLRenderAPI::bindBuffer(GLenum target, UINT32 unit, GLuint bufferId)
+	{
+		BindingCache& cache = target == GL_UNIFORM_BUFFER ? mUniformBufferBindings : mStorageBufferBindings;
+		if (unit >= (UINT32)cache.pending.size())
+		{
+			LOGWRN("Provided buffer binding index is higher than OpenGL supports. Provided: " + toString(unit) +
+				". Supported range: 0 .. " + toString((INT32)cache.pending.size() - 1));
+			return false;
+		}
+
+		if (!cache.set(unit, bufferId))
+			mNumBindsSkipped++;
+
+		return true;
+	}
+
+	void GLRenderAPI::applyBufferBindings(GLenum target)
+	{
+		BindingCache& cache = target == GL_UNIFORM_BUFFER ? mUniformBufferBindings : mStorageBufferBindings;
+		if (!cache.isDirty())
+			return;
+
+		const UINT32 start = cache.dirtyStart;
+		const UINT32 end = cache.dirtyEnd;
+
+		UINT32 numChanged = 0;
+		for (UINT32 i = start; i < end; i++)
+		{
+			if (cache.pending[i] == cache.bound[i])
+				continue;
+
+			numChanged++;
+
+			if (!mHasMultiBind)
+			{
+				glBindBufferBase(target, i, cache.pending[i]);
+				BS_CHECK_GL_ERROR();
 			}
 		}
+
+#if BS_OPENGL_4_4
+		if (mHasMultiBind && numChanged > 0)
+		{
+			glBindBuffersBase(target, start, end - start, &cache.pending[start]);
+			BS_CHECK_GL_ERROR();
+
+			mNumBindsSkipped += numChanged - 1;
+		}
+#endif
+
+		cache.markApplied();
+	}
+
+	void GLRenderAPI::bindImageTexture(UINT32 unit, GLuint texId, GLint level, GLboolean layered, GLint layer,
+		GLenum format)
+	{
+#if BS_OPENGL_4_2 || BS_OPENGLES_3_1
+		if (unit >= (UINT32)mImageUnits.size())
+		{
+			LOGWRN("Provided image unit index is higher than OpenGL supports. Provided: " + toString(unit) +
+				". Supported range: 0 .. " + toString((INT32)mImageUnits.size() - 1));
+			return;
+		}
+
+		ImageUnitInfo& imageUnit = mImageUnits[unit];
+
+		// Level, layer and format don't matter when nothing is bound
+		const bool isSame = imageUnit.texId == texId && (texId == 0 || (imageUnit.level == level &&
+			imageUnit.layered == layered && imageUnit.layer == layer && imageUnit.format == format));
+
+		if (isSame)
+		{
+			mNumBindsSkipped++;
+			return;
+		}
+
+		glBindImageTexture(unit, texId, level, layered, layer, GL_READ_WRITE, format);
+		BS_CHECK_GL_ERROR();
+
+		imageUnit.texId = texId;
+		imageUnit.level = level;
+		imageUnit.layered = layered;
+		imageUnit.layer = layer;
+		imageUnit.format = format;
+#endif
+	}
+
+	void GLRenderAPI::_notifyTextureDestroyed(GLuint texId)
+	{
+		mTextureBindings.remove(texId);
+
+		for (auto& entry : mImageUnits)
+		{
+			if (entry.texId == texId)
+				entry.texId = 0;
+		}
+	}
+
+	void GLRenderAPI::_notifyBufferDestroyed(GLuint bufferId)
+	{
+		mUniformBufferBindings.remove(bufferId);
+		mStorageBufferBindings.remove(bufferId);
+	}
+
+	void GLRenderAPI::_notifySamplerDestroyed(GLuint samplerId)
+	{
+		mSamplerBindings.remove(samplerId);
+	}
+
+	void GLRenderAPI::invalidateBindingCaches()
+	{
+		for (UINT32 i = 0; i < (UINT32)mTextureBindings.bound.size(); i++)
+			mTextureBindings.invalidate(i);
+
+		for (UINT32 i = 0; i < (UINT32)mSamplerBindings.bound.size(); i++)
+			mSamplerBindings.invalidate(i);
+
+		for (UINT32 i = 0; i < (UINT32)mUniformBufferBindings.bound.size(); i++)
+			mUniformBufferBindings.invalidate(i);
+
+		for (UINT32 i = 0; i < (UINT32)mStorageBufferBindings.bound.size(); i++)
+			mStorageBufferBindings.invalidate(i);
+
+		for (auto& entry : mImageUnits)
+			entry.texId = (GLuint)-1;
+
+		mNumBoundImageUnits = (UINT32)mImageUnits.size();
+		mActiveTextureUnit = (UINT16)-1;
+	}
+
+	void GLRenderAPI::BindingCache::init(UINT32 count)
+	{
+		bound.assign(count, 0);
+		pending.assign(count, 0);
+		dirtyStart = 0;
+		dirtyEnd = 0;
+	}
+
+	bool GLRenderAPI::BindingCache::set(UINT32 idx, GLuint object)
+	{
+		pending[idx] = object;
+
+		if (bound[idx] == object)
+			return false;
+
+		if (isDirty())
+		{
+			dirtyStart = std::min(dirtyStart, idx);
+			dirtyEnd = std::max(dirtyEnd, idx + 1);
+		}
 		else
 		{
-			return true;
+			dirtyStart = idx;
+			dirtyEnd = idx + 1;
 		}
+
+		return true;
+	}
+
+	void GLRenderAPI::BindingCache::invalidate(UINT32 idx)
+	{
+		// No valid object uses this name, ensuring the next set() is seen as a change
+		bound[idx] = (GLuint)-1;
+	}
+
+	void GLRenderAPI::BindingCache::remove(GLuint object)
+	{
+		for (UINT32 i = 0; i < (UINT32)bound.size(); i++)
+		{
+			if (bound[i] == object)
+				bound[i] = 0;
+
+			if (pending[i] == object)
+				pending[i] = 0;
+		}
+	}
+
+	void GLRenderAPI::BindingCache::markApplied()
+	{
+		for (UINT32 i = dirtyStart; i < dirtyEnd; i++)
+			bound[i] = pending[i];
+
+		dirtyStart = 0;
+		dirtyEnd = 0;
 	}
 
 	void GLRenderAPI::beginDraw()
@@ -2156,15 +2425,6 @@ namespace bs { namespace ct
 		mDrawCallInProgress = false;
 	}
 
-	GLfloat GLRenderAPI::getCurrentAnisotropy(UINT16 unit)
-	{
-		GLfloat curAniso = 0;
-		glGetTexParameterfv(mTextureInfos[unit].type, GL_TEXTURE_MAX_ANISOTROPY_EXT, &curAniso);
-		BS_CHECK_GL_ERROR();
-
-		return curAniso ? curAniso : 1;
-	}
-
 	GLint GLRenderAPI::convertStencilOp(StencilOperation op) const
 	{
 		switch (op)
@@ -2215,54 +2475,6 @@ namespace bs { namespace ct
 		return GL_ALWAYS;
 	}
 
-	GLuint GLRenderAPI::getCombinedMinMipFilter() const
-	{
-		switch (mMinFilter)
-		{
-		case FO_ANISOTROPIC:
-		case FO_LINEAR:
-			switch (mMipFilter)
-			{
-			case FO_ANISOTROPIC:
-			case FO_LINEAR:
-				// Linear min, linear mip
-				return GL_LINEAR_MIPMAP_LINEAR;
-			case FO_POINT:
-				// Linear min, point mip
-				return GL_LINEAR_MIPMAP_NEAREST;
-			case FO_NONE:
-				// Linear min, no mip
-				return GL_LINEAR;
-			default:
-				break;
-			}
-			break;
-		case FO_POINT:
-		case FO_NONE:
-			switch (mMipFilter)
-			{
-			case FO_ANISOTROPIC:
-			case FO_LINEAR:
-				// Nearest min, linear mip
-				return GL_NEAREST_MIPMAP_LINEAR;
-			case FO_POINT:
-				// Nearest min, point mip
-				return GL_NEAREST_MIPMAP_NEAREST;
-			case FO_NONE:
-				// Nearest min, no mip
-				return GL_NEAREST;
-			default:
-				break;
-			}
-			break;
-		default:
-			break;
-		}
-
-		// Should never get here
-		return 0;
-	}
-
 	GLint GLRenderAPI::getBlendMode(BlendFactor blendMode) const
 	{
 		switch (blendMode)
@@ -2292,22 +2504,6 @@ namespace bs { namespace ct
 		return GL_ONE;
 	}
 
-	GLint GLRenderAPI::getTextureAddressingMode(TextureAddressingMode tam) const
-	{
-		switch (tam)
-		{
-		default:
-		case TAM_WRAP:
-			return GL_REPEAT;
-		case TAM_MIRROR:
-			return GL_MIRRORED_REPEAT;
-		case TAM_CLAMP:
-			return GL_CLAMP_TO_EDGE;
-		case TAM_BORDER:
-			return GL_CLAMP_TO_BORDER;
-		}
-	}
-
 	GLint GLRenderAPI::getGLDrawMode() const
 	{
 		GLint primType;
@@ -2394,6 +2590,47 @@ namespace bs { namespace ct
 
 		mNumTextureUnits = caps->getNumCombinedTextureUnits();
 		mTextureInfos = bs_newN<TextureInfo>(mNumTextureUnits);
+
+		mTextureBindings.init(mNumTextureUnits);
+		mSamplerBindings.init(mNumTextureUnits);
+		mPendingTextureTypes.resize(mNumTextureUnits, GL_TEXTURE_2D);
+
+		GLint maxUniformBufferBindings = 0;
+		glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &maxUniformBufferBindings);
+		BS_CHECK_GL_ERROR();
+
+		mUniformBufferBindings.init((UINT32)maxUniformBufferBindings);
+
+#if BS_OPENGL_4_2 || BS_OPENGLES_3_1
+		GLint maxImageUnits = 0;
+		glGetIntegerv(GL_MAX_IMAGE_UNITS, &maxImageUnits);
+		BS_CHECK_GL_ERROR();
+
+		mImageUnits.resize((UINT32)maxImageUnits);
+#endif
+
+#if BS_OPENGL_4_3 || BS_OPENGLES_3_1
+		GLint maxStorageBufferBindings = 0;
+		glGetIntegerv(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &maxStorageBufferBindings);
+		BS_CHECK_GL_ERROR();
+
+		mStorageBufferBindings.init((UINT32)maxStorageBufferBindings);
+#endif
+
+#if BS_OPENGL_4_3
+		mHasIndirectParameters = mGLSupport->checkExtension("GL_ARB_indirect_parameters");
+#endif
+
+#if BS_OPENGL_4_4
+		mHasMultiBind = mGLSupport->checkExtension("GL_ARB_multi_bind");
+		mHasBufferStorage = mGLSupport->checkExtension("GL_ARB_buffer_storage");
+#endif
+
+		if (mGLSupport->checkExtension("GL_EXT_texture_filter_anisotropic"))
+		{
+			glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &mMaxAnisotropy);
+			BS_CHECK_GL_ERROR();
+		}
 		
 		bs::TextureManager::startUp<bs::GLTextureManager>(std::ref(*mGLSupport));
 		TextureManager::startUp<GLTextureManager>(std::ref(*mGLSupport));
@@ -2420,6 +2657,9 @@ namespace bs { namespace ct
 
 		glStencilMask(mStencilWriteMask);
 		BS_CHECK_GL_ERROR();
+
+		// Bindings are per-context state
+		invalidateBindingCaches();
 	}
 
 	void GLRenderAPI::initCapabilities(RenderAPICapabilities& caps) const
@@ -2552,6 +2792,18 @@ namespace bs { namespace ct
 			caps.setNumGpuParamBlockBuffers(GPT_DOMAIN_PROGRAM, numUniformBlocks);
 		}
 
+		// Indirect draws are core since OpenGL 4.0 and OpenGL ES 3.1, and multi-draw since OpenGL 4.3
+#if BS_OPENGL_4_1 || BS_OPENGLES_3_1
+		caps.setCapability(RSC_DRAW_INDIRECT);
+#endif
+
+#if BS_OPENGL_4_3
+		caps.setCapability(RSC_MULTI_DRAW_INDIRECT);
+
+		if (mGLSupport->checkExtension("GL_ARB_indirect_parameters"))
+			caps.setCapability(RSC_DRAW_INDIRECT_COUNT);
+#endif
+
 		if (mGLSupport->checkExtension("GL_ARB_compute_shader")) 
 		{
 #if BS_OPENGL_4_3 || BS_OPENGLES_3_1
@@ -69,6 +69,19 @@ namespace bs { namespace ct
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount
 			, UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
 
+		/** @copydoc RenderAPI::drawIndirect() */
+		void drawIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::drawIndexedIndirect() */
+		void drawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::multiDrawIndexedIndirect() */
+		void multiDrawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, UINT32 drawCount,
+			const SPtr<GpuBuffer>& countBuffer = nullptr, UINT32 countOffset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
 		/** @copydoc RenderAPI::dispatchCompute() */
 		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1, 
 			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
@@ -116,7 +129,72 @@ namespace bs { namespace ct
 		/**	Returns a support object you may use for creating */
 		GLSupport* getGLSupport() const { return mGLSupport; }
 
+		/** Returns true if buffers can be created with immutable storage and persistently mapped (GL_ARB_buffer_storage). */
+		bool _isBufferStorageSupported() const { return mHasBufferStorage; }
+
+		/**
+		 * Returns the maximum anisotropy supported by samplers, or zero if anisotropic filtering is not supported
+		 * (GL_EXT_texture_filter_anisotropic).
+		 */
+		float _getMaxAnisotropy() const { return mMaxAnisotropy; }
+
+		/**
+		 * Notifies the render API that an OpenGL texture object is being deleted, so any cached bindings referencing it
+		 * are cleared. Required since OpenGL unbinds deleted objects and is free to re-use their names.
+		 */
+		void _notifyTextureDestroyed(GLuint texId);
+
+		/** Same as _notifyTextureDestroyed(), but for buffer objects. */
+		void _notifyBufferDestroyed(GLuint bufferId);
+
+		/** Same as _notifyTextureDestroyed(), but for sampler objects. */
+		void _notifySamplerDestroyed(GLuint samplerId);
+
 	protected:
+		/**
+		 * Shadow copy of the objects bound to a range of indexed OpenGL binding points (texture units, sampler units or
+		 * indexed buffer targets). New bindings are queued using set(), and only the binding points whose queued object
+		 * differs from the bound one are applied when the cache is flushed.
+		 */
+		struct BindingCache
+		{
+			/** Prepares the cache for @p count binding points, all assumed to have no object bound. */
+			void init(UINT32 count);
+
+			/**
+			 * Queues @p object to be bound at binding point @p idx. Returns false if the object is already bound, in
+			 * which case the bind call can be skipped.
+			 */
+			bool set(UINT32 idx, GLuint object);
+
+			/** Marks the object bound at the binding point as unknown, forcing it to be re-applied on the next flush. */
+			void invalidate(UINT32 idx);
+
+			/** Replaces all bound and queued references to @p object with a null object. */
+			void remove(GLuint object);
+
+			/** Returns true if any queued object differs from the bound one. */
+			bool isDirty() const { return dirtyStart < dirtyEnd; }
+
+			/** Marks all queued objects as bound and resets the dirty range. */
+			void markApplied();
+
+			Vector<GLuint> bound;
+			Vector<GLuint> pending;
+			UINT32 dirtyStart = 0;
+			UINT32 dirtyEnd = 0;
+		};
+
+		/** Information about an image bound to an image unit. */
+		struct ImageUnitInfo
+		{
+			GLuint texId = 0;
+			GLint level = 0;
+			GLboolean layered = GL_FALSE;
+			GLint layer = 0;
+			GLenum format = GL_R32F;
+		};
+
 		/** @copydoc RenderAPI::initialize */
 		void initialize() override;
 
@@ -147,12 +225,6 @@ namespace bs { namespace ct
 		/**	Converts Banshee blend mode to OpenGL blend mode. */
 		GLint getBlendMode(BlendFactor blendMode) const;
 
-		/**	Converts Banshee texture addressing mode to OpenGL texture addressing mode. */
-		GLint getTextureAddressingMode(TextureAddressingMode tam) const;
-
-		/** Gets a combined min/mip filter value usable by OpenGL from the currently set min and mip filters. */
-		GLuint getCombinedMinMipFilter() const;
-
 		/** Returns the OpenGL specific mode used for drawing, depending on the currently set draw operation. */
 		GLint getGLDrawMode() const;
 
@@ -169,52 +241,48 @@ namespace bs { namespace ct
 		void switchContext(const SPtr<GLContext>& context, const RenderWindow& window);
 
 		/************************************************************************/
-		/* 								Sampler states                     		*/
+		/* 								Resource bindings                  		*/
 		/************************************************************************/
 
 		/**
-		 * Sets the texture addressing mode for a texture unit. This determines how are UV address values outside of [0, 1]
-		 * range handled when sampling from texture.
+		 * Queues a texture to be bound to the specified texture unit. The binding is applied on the next call to
+		 * applyTextureBindings(). Returns false if the unit is outside of the supported range.
 		 */
-		void setTextureAddressingMode(UINT16 unit, const UVWAddressingMode& uvw);
+		bool bindTexture(UINT32 unit, GLenum target, GLuint texId);
 
 		/**
-		 * Sets the texture border color for a texture unit. Border color determines color returned by the texture sampler
-		 * when border addressing mode is used and texture address is outside of [0, 1] range.
+		 * Queues a sampler object to be bound to the specified texture unit. The binding is applied on the next call to
+		 * applyTextureBindings(). Returns false if the unit is outside of the supported range.
 		 */
-		void setTextureBorderColor(UINT16 unit, const Color& color);
+		bool bindSampler(UINT32 unit, GLuint samplerId);
 
 		/**
-		 * Sets the mipmap bias value for a given texture unit. Bias allows	you to adjust the mipmap selection calculation.
-		 * Negative values force a larger mipmap to be used, and positive values smaller. Units are in values of mip levels,
-		 * so -1 means use a mipmap one level higher than default.
+		 * Binds all textures and samplers queued since the last call, skipping the ones that are already bound. When
+		 * GL_ARB_multi_bind is supported all changed units are bound using a single call per resource type.
 		 */
-		void setTextureMipmapBias(UINT16 unit, float bias);
+		void applyTextureBindings();
 
 		/**
-		 * Sets a valid range for mipmaps (LOD) for a given texture unit. @p min limits the selection of the highest
-		 * resolution mipmap (lowest level), and @p max limits the selection of the lowest resolution mipmap (highest
-		 * level).
+		 * Queues a buffer to be bound to an indexed binding point of the specified target (uniform or shader storage
+		 * buffer). The binding is applied on the next call to applyBufferBindings(). Returns false if the binding point
+		 * is outside of the supported range.
 		 */
-		void setTextureMipmapRange(UINT16 unit, float min, float max);
+		bool bindBuffer(GLenum target, UINT32 unit, GLuint bufferId);
 
 		/**
-		 * Allows you to specify how is the texture bound to the specified texture unit filtered. Different filter types are
-		 * used for different situations like magnifying or minifying a texture.
+		 * Binds all buffers queued for the specified target since the last call, skipping the ones that are already
+		 * bound. When GL_ARB_multi_bind is supported all changed binding points are bound using a single call.
 		 */
-		void setTextureFiltering(UINT16 unit, FilterType ftype, FilterOptions filter);
+		void applyBufferBindings(GLenum target);
 
-		/**	Sets anisotropy value for the specified texture unit. */
-		void setTextureAnisotropy(UINT16 unit, UINT32 maxAnisotropy);
-		
-		/** 
-		 * Sets the compare mode to use when sampling the texture (anything but "always" implies the use of a shadow 
-		 * sampler. 
-		 */
-		void setTextureCompareMode(UINT16 unit, CompareFunction compare);
+		/** Binds a level or layer of a texture to an image unit, unless the same image is already bound. */
+		void bindImageTexture(UINT32 unit, GLuint texId, GLint level, GLboolean layered, GLint layer, GLenum format);
 
-		/**	Gets anisotropy value for the specified texture unit. */
-		GLfloat getCurrentAnisotropy(UINT16 unit);
+		/**
+		 * Marks all cached resource bindings as unknown, forcing them to be re-applied when next used. Must be called
+		 * whenever the bindings might have been modified externally, e.g. when the active context changes.
+		 */
+		void invalidateBindingCaches();
 
 		/************************************************************************/
 		/* 								Blend states                      		*/
@@ -375,13 +443,23 @@ namespace bs { namespace ct
 		CompareFunction mStencilCompareFront;
 		CompareFunction mStencilCompareBack;
 
-		// Last min & mip filtering options, so we can combine them
-		FilterOptions mMinFilter;
-		FilterOptions mMipFilter;
-
 		// Holds texture type settings for every stage
 		UINT32 mNumTextureUnits;
 		TextureInfo* mTextureInfos;
+
+		// Shadow copies of resource bindings, so redundant binds can be skipped
+		BindingCache mTextureBindings;
+		BindingCache mSamplerBindings;
+		BindingCache mUniformBufferBindings;
+		BindingCache mStorageBufferBindings;
+		Vector<GLenum> mPendingTextureTypes;
+		Vector<ImageUnitInfo> mImageUnits;
+		UINT32 mNumBoundImageUnits = 0;
+		UINT32 mNumBindsSkipped = 0;
+		bool mHasMultiBind = false;
+		bool mHasBufferStorage = false;
+		bool mHasIndirectParameters = false;
+		float mMaxAnisotropy = 0.0f;
 		bool mDepthWrite;
 		bool mColorWrite[4];
 
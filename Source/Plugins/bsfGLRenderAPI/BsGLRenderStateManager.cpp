@@ -0,0 +1,15 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsGLRenderStateManager.h"
+#include "BsGLSamplerState.h"
+
+namespace bs { namespace ct
+{
+	SPtr<SamplerState> GLRenderStateManager::createSamplerStateInternal(const SAMPLER_STATE_DESC& desc, GpuDeviceFlags deviceMask) const
+	{
+		SPtr<SamplerState> ret = bs_shared_ptr<GLSamplerState>(new (bs_alloc<GLSamplerState>()) GLSamplerState(desc, deviceMask));
+		ret->_setThisPtr(ret);
+
+		return ret;
+	}
+}}
@@ -0,0 +1,23 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsGLPrerequisites.h"
+#include "Managers/BsRenderStateManager.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup GL
+	 *  @{
+	 */
+
+	/**	Handles creation of OpenGL pipeline states. */
+	class GLRenderStateManager : public RenderStateManager
+	{
+	protected:
+		/** @copydoc RenderStateManager::createSamplerStateInternal */
+		SPtr<SamplerState> createSamplerStateInternal(const SAMPLER_STATE_DESC& desc, GpuDeviceFlags deviceMask) const override;
+	};
+
+	/** @} */
+}}
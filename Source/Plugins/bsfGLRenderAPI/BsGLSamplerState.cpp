@@ -0,0 +1,193 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsGLSamplerState.h"
+#include "Profiling/BsRenderStats.h"
+#include "BsGLRenderAPI.h"
+
+namespace bs { namespace ct
+{
+	/**	Converts engine texture addressing mode to OpenGL texture addressing mode. */
+	static GLint getGLAddressingMode(TextureAddressingMode tam)
+	{
+		switch (tam)
+		{
+		default:
+		case TAM_WRAP:
+			return GL_REPEAT;
+		case TAM_MIRROR:
+			return GL_MIRRORED_REPEAT;
+		case TAM_CLAMP:
+			return GL_CLAMP_TO_EDGE;
+		case TAM_BORDER:
+			return GL_CLAMP_TO_BORDER;
+		}
+	}
+
+	/** Converts engine min & mip filters into a single minification filter value usable by OpenGL. */
+	static GLint getGLCombinedMinMipFilter(FilterOptions minFilter, FilterOptions mipFilter)
+	{
+		switch (minFilter)
+		{
+		case FO_ANISOTROPIC:
+		case FO_LINEAR:
+			switch (mipFilter)
+			{
+			case FO_ANISOTROPIC:
+			case FO_LINEAR:
+				// Linear min, linear mip
+				return GL_LINEAR_MIPMAP_LINEAR;
+			case FO_POINT:
+				// Linear min, point mip
+				return GL_LINEAR_MIPMAP_NEAREST;
+			case FO_NONE:
+				// Linear min, no mip
+				return GL_LINEAR;
+			default:
+				break;
+			}
+			break;
+		case FO_POINT:
+		case FO_NONE:
+			switch (mipFilter)
+			{
+			case FO_ANISOTROPIC:
+			case FO_LINEAR:
+				// Nearest min, linear mip
+				return GL_NEAREST_MIPMAP_LINEAR;
+			case FO_POINT:
+				// Nearest min, point mip
+				return GL_NEAREST_MIPMAP_NEAREST;
+			case FO_NONE:
+				// Nearest min, no mip
+				return GL_NEAREST;
+			default:
+				break;
+			}
+			break;
+		default:
+			break;
+		}
+
+		// Should never get here
+		return 0;
+	}
+
+	/**	Converts the engine compare function into OpenGL representation. */
+	static GLint getGLCompareFunction(CompareFunction func)
+	{
+		switch (func)
+		{
+		case CMPF_ALWAYS_FAIL:
+			return GL_NEVER;
+		case CMPF_ALWAYS_PASS:
+			return GL_ALWAYS;
+		case CMPF_LESS:
+			return GL_LESS;
+		case CMPF_LESS_EQUAL:
+			return GL_LEQUAL;
+		case CMPF_EQUAL:
+			return GL_EQUAL;
+		case CMPF_NOT_EQUAL:
+			return GL_NOTEQUAL;
+		case CMPF_GREATER_EQUAL:
+			return GL_GEQUAL;
+		case CMPF_GREATER:
+			return GL_GREATER;
+		}
+
+		return GL_ALWAYS;
+	}
+
+	GLSamplerState::GLSamplerState(const SAMPLER_STATE_DESC& desc, GpuDeviceFlags deviceMask)
+		:SamplerState(desc, deviceMask), mGLHandle(0)
+	{ }
+
+	GLSamplerState::~GLSamplerState()
+	{
+		if(mGLHandle != 0)
+		{
+			glDeleteSamplers(1, &mGLHandle);
+			BS_CHECK_GL_ERROR();
+
+			if (RenderAPI::isStarted())
+				static_cast<GLRenderAPI&>(RenderAPI::instance())._notifySamplerDestroyed(mGLHandle);
+		}
+
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_SamplerState);
+	}
+
+	void GLSamplerState::createInternal()
+	{
+		glGenSamplers(1, &mGLHandle);
+		BS_CHECK_GL_ERROR();
+
+		const FilterOptions minFilter = mProperties.getTextureFiltering(FT_MIN);
+		const FilterOptions magFilter = mProperties.getTextureFiltering(FT_MAG);
+		const FilterOptions mipFilter = mProperties.getTextureFiltering(FT_MIP);
+
+		glSamplerParameteri(mGLHandle, GL_TEXTURE_MIN_FILTER, getGLCombinedMinMipFilter(minFilter, mipFilter));
+		BS_CHECK_GL_ERROR();
+
+		// GL treats linear and aniso the same
+		GLint glMagFilter = (magFilter == FO_POINT || magFilter == FO_NONE) ? GL_NEAREST : GL_LINEAR;
+		glSamplerParameteri(mGLHandle, GL_TEXTURE_MAG_FILTER, glMagFilter);
+		BS_CHECK_GL_ERROR();
+
+		const GLfloat maxSupportedAnisotropy = static_cast<GLRenderAPI&>(RenderAPI::instance())._getMaxAnisotropy();
+		if (maxSupportedAnisotropy > 0.0f)
+		{
+			GLfloat anisotropy = (GLfloat)mProperties.getTextureAnisotropy();
+			if (anisotropy > maxSupportedAnisotropy)
+				anisotropy = maxSupportedAnisotropy;
+
+			if (anisotropy < 1.0f)
+				anisotropy = 1.0f;
+
+			glSamplerParameterf(mGLHandle, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
+			BS_CHECK_GL_ERROR();
+		}
+
+		const CompareFunction compareFunc = mProperties.getComparisonFunction();
+		if (compareFunc == CMPF_ALWAYS_PASS)
+		{
+			glSamplerParameteri(mGLHandle, GL_TEXTURE_COMPARE_MODE, GL_NONE);
+			BS_CHECK_GL_ERROR();
+		}
+		else
+		{
+			glSamplerParameteri(mGLHandle, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+			BS_CHECK_GL_ERROR();
+
+			glSamplerParameteri(mGLHandle, GL_TEXTURE_COMPARE_FUNC, getGLCompareFunction(compareFunc));
+			BS_CHECK_GL_ERROR();
+		}
+
+		glSamplerParameterf(mGLHandle, GL_TEXTURE_LOD_BIAS, mProperties.getTextureMipmapBias());
+		BS_CHECK_GL_ERROR();
+
+		glSamplerParameterf(mGLHandle, GL_TEXTURE_MIN_LOD, mProperties.getMinimumMip());
+		BS_CHECK_GL_ERROR();
+
+		glSamplerParameterf(mGLHandle, GL_TEXTURE_MAX_LOD, mProperties.getMaximumMip());
+		BS_CHECK_GL_ERROR();
+
+		const UVWAddressingMode& uvw = mProperties.getTextureAddressingMode();
+		glSamplerParameteri(mGLHandle, GL_TEXTURE_WRAP_S, getGLAddressingMode(uvw.u));
+		BS_CHECK_GL_ERROR();
+
+		glSamplerParameteri(mGLHandle, GL_TEXTURE_WRAP_T, getGLAddressingMode(uvw.v));
+		BS_CHECK_GL_ERROR();
+
+		glSamplerParameteri(mGLHandle, GL_TEXTURE_WRAP_R, getGLAddressingMode(uvw.w));
+		BS_CHECK_GL_ERROR();
+
+		const Color& borderColor = mProperties.getBorderColor();
+		GLfloat border[4] = { borderColor.r, borderColor.g, borderColor.b, borderColor.a };
+		glSamplerParameterfv(mGLHandle, GL_TEXTURE_BORDER_COLOR, border);
+		BS_CHECK_GL_ERROR();
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_SamplerState);
+
+		SamplerState::createInternal();
+	}
+}}
@@ -0,0 +1,38 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsGLPrerequisites.h"
+#include "RenderAPI/BsSamplerState.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup GL
+	 *  @{
+	 */
+
+	/**
+	 * OpenGL implementation of a sampler state. Wraps an OpenGL sampler object, allowing all sampling options to be
+	 * applied to a texture unit with a single bind call.
+	 */
+	class GLSamplerState : public SamplerState
+	{
+	public:
+		~GLSamplerState();
+
+		/**	Returns internal OpenGL sampler object handle. */
+		GLuint getGLHandle() const { return mGLHandle; }
+
+	protected:
+		friend class GLRenderStateManager;
+
+		GLSamplerState(const SAMPLER_STATE_DESC& desc, GpuDeviceFlags deviceMask);
+
+		/** @copydoc SamplerState::createInternal */
+		void createInternal() override;
+
+		GLuint mGLHandle;
+	};
+
+	/** @} */
+}}
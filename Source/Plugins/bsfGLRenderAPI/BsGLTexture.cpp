@@ -12,6 +12,7 @@
 #include "BsGLTextureView.h"
 #include "Profiling/BsRenderStats.h"
 #include "BsGLCommandBuffer.h"
+#include "BsGLRenderAPI.h"
 
 namespace bs { namespace ct
 {
@@ -29,6 +30,9 @@ namespace bs { namespace ct
 		glDeleteTextures(1, &mTextureID);
 		BS_CHECK_GL_ERROR();
 
+		if (RenderAPI::isStarted())
+			static_cast<GLRenderAPI&>(RenderAPI::instance())._notifyTextureDestroyed(mTextureID);
+
 		clearBufferViews();
 
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Texture);
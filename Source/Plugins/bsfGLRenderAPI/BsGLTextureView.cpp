@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsGLTextureView.h"
 #include "BsGLTexture.h"
+#include "BsGLRenderAPI.h"
 
 namespace bs { namespace ct {
 	GLTextureView::GLTextureView(const GLTexture* texture, const TEXTURE_VIEW_DESC& desc)
@@ -89,6 +90,9 @@ namespace bs { namespace ct {
 		{
 			glDeleteTextures(1, &mViewID);
 			BS_CHECK_GL_ERROR();
+
+			if (RenderAPI::isStarted())
+				static_cast<GLRenderAPI&>(RenderAPI::instance())._notifyTextureDestroyed(mViewID);
 		}
 	}
 }}
\ No newline at end of file
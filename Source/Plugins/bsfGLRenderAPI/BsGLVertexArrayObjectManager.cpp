@@ -12,12 +12,13 @@
 namespace bs { namespace ct
 {
 	GLVertexArrayObject::GLVertexArrayObject()
-		:mHandle(0), mVertProgId(0), mAttachedBuffers(nullptr), mNumBuffers(0)
+		:mHandle(0), mVertProgId(0), mAttachedBuffers(nullptr), mAttachedBufferIds(nullptr), mNumBuffers(0)
 	{ }
 
 	GLVertexArrayObject::GLVertexArrayObject(GLuint handle, UINT64 vertexProgramId, 
-		GLVertexBuffer** attachedBuffers, UINT32 numBuffers)
-		:mHandle(handle), mVertProgId(vertexProgramId), mAttachedBuffers(attachedBuffers), mNumBuffers(numBuffers)
+		GLVertexBuffer** attachedBuffers, GLuint* attachedBufferIds, UINT32 numBuffers)
+		:mHandle(handle), mVertProgId(vertexProgramId), mAttachedBuffers(attachedBuffers)
+		, mAttachedBufferIds(attachedBufferIds), mNumBuffers(numBuffers)
 	{ }
 
 	::std::size_t GLVertexArrayObject::Hash::operator()(const GLVertexArrayObject &vao) const
@@ -26,7 +27,7 @@ namespace bs { namespace ct
 		hash_combine(seed, vao.mVertProgId);
 
 		for (UINT32 i = 0; i < vao.mNumBuffers; i++)
-			hash_combine(seed, vao.mAttachedBuffers[i]->getGLBufferId());
+			hash_combine(seed, vao.mAttachedBufferIds[i]);
 
 		return seed;
 	}
@@ -41,7 +42,7 @@ namespace bs { namespace ct
 
 		for (UINT32 i = 0; i < a.mNumBuffers; i++)
 		{
-			if (a.mAttachedBuffers[i]->getGLBufferId() != b.mAttachedBuffers[i]->getGLBufferId())
+			if (a.mAttachedBufferIds[i] != b.mAttachedBufferIds[i])
 				return false;
 		}
 
@@ -58,7 +59,7 @@ namespace bs { namespace ct
 
 		for (UINT32 i = 0; i < mNumBuffers; i++)
 		{
-			if (mAttachedBuffers[i]->getGLBufferId() != obj.mAttachedBuffers[i]->getGLBufferId())
+			if (mAttachedBufferIds[i] != obj.mAttachedBufferIds[i])
 				return false;
 		}
 
@@ -88,7 +89,10 @@ namespace bs { namespace ct
 		INT32* streamToSeqIdx = bs_stack_alloc<INT32>(numStreams);
 		GLVertexBuffer** usedBuffers = bs_stack_alloc<GLVertexBuffer*>((UINT32)boundBuffers.size());
 		
+		GLuint* usedBufferIds = bs_stack_alloc<GLuint>((UINT32)boundBuffers.size());
+		
 		memset(usedBuffers, 0, (UINT32)boundBuffers.size() * sizeof(GLVertexBuffer*));
+		memset(usedBufferIds, 0, (UINT32)boundBuffers.size() * sizeof(GLuint));
 
 		for (UINT32 i = 0; i < numStreams; i++)
 			streamToSeqIdx[i] = -1;
@@ -106,18 +110,22 @@ namespace bs { namespace ct
 			streamToSeqIdx[streamIdx] = (INT32)numUsedBuffers;
 
 			if (vertexBuffer != nullptr)
+			{
 				usedBuffers[numUsedBuffers] = static_cast<GLVertexBuffer*>(vertexBuffer.get()); 
+				usedBufferIds[numUsedBuffers] = usedBuffers[numUsedBuffers]->getGLBufferId();
+			}
 			else
 				usedBuffers[numUsedBuffers] = nullptr;
 
 			numUsedBuffers++;
 		}
 		
-		GLVertexArrayObject wantedVAO(0, vertexProgram->getGLHandle(), usedBuffers, numUsedBuffers);
+		GLVertexArrayObject wantedVAO(0, vertexProgram->getGLHandle(), usedBuffers, usedBufferIds, numUsedBuffers);
 
 		auto findIter = mVAObjects.find(wantedVAO);
 		if (findIter != mVAObjects.end())
 		{
+			bs_stack_free(usedBufferIds);
 			bs_stack_free(usedBuffers);
 			bs_stack_free(streamToSeqIdx);
 
@@ -204,6 +212,9 @@ namespace bs { namespace ct
 			BS_CHECK_GL_ERROR();
 		}
 
+		wantedVAO.mAttachedBufferIds = (GLuint*)bs_alloc(numUsedBuffers * sizeof(GLuint));
+		memcpy(wantedVAO.mAttachedBufferIds, usedBufferIds, numUsedBuffers * sizeof(GLuint));
+
 		wantedVAO.mAttachedBuffers = (GLVertexBuffer**)bs_alloc(numUsedBuffers * sizeof(GLVertexBuffer*));
 		for (UINT32 i = 0; i < numUsedBuffers; i++)
 		{
@@ -211,6 +222,7 @@ namespace bs { namespace ct
 			usedBuffers[i]->registerVAO(wantedVAO);
 		}
 
+		bs_stack_free(usedBufferIds);
 		bs_stack_free(usedBuffers);
 		bs_stack_free(streamToSeqIdx);
 
@@ -234,6 +246,7 @@ namespace bs { namespace ct
 		BS_CHECK_GL_ERROR();
 
 		bs_free(vao.mAttachedBuffers);
+		bs_free(vao.mAttachedBufferIds);
 
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_VertexArrayObject);
 	}
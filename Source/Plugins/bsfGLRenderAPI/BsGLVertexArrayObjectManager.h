@@ -43,11 +43,14 @@ namespace bs { namespace ct
 		friend class GLVertexArrayObjectManager;
 
 		GLVertexArrayObject();
-		GLVertexArrayObject(GLuint handle, UINT64 vertexProgramId, GLVertexBuffer** attachedBuffers, UINT32 numBuffers);
+		GLVertexArrayObject(GLuint handle, UINT64 vertexProgramId, GLVertexBuffer** attachedBuffers,
+			GLuint* attachedBufferIds, UINT32 numBuffers);
 
 		GLuint mHandle;
 		UINT64 mVertProgId;
 		GLVertexBuffer** mAttachedBuffers;
+		// IDs of the attached buffers at the time the VAO was created, as IDs of streaming buffers change on discard
+		GLuint* mAttachedBufferIds;
 		UINT32 mNumBuffers;
 	};
 
@@ -69,7 +72,7 @@ namespace bs { namespace ct
 		/**	Called when a vertex buffer containing the provided VAO is destroyed. */
 		void notifyBufferDestroyed(GLVertexArrayObject vao);
 	private:
-		typedef UnorderedSet<GLVertexArrayObject, GLVertexArrayObject::Hash, GLVertexArrayObject::Equal> VAOMap;
+		typedef FlatHashSet<GLVertexArrayObject, GLVertexArrayObject::Hash, GLVertexArrayObject::Equal> VAOMap;
 
 		VAOMap mVAObjects;
 	};
@@ -33,6 +33,8 @@ set(BS_GLRENDERAPI_INC_NOFILTER
 	"BsGLCommandBuffer.h"
 	"BsGLCommandBufferManager.h"
 	"BsGLTextureView.h"
+	"BsGLSamplerState.h"
+	"BsGLRenderStateManager.h"
 )
 
 set(BS_GLRENDERAPI_SRC_NOFILTER
@@ -62,6 +64,8 @@ set(BS_GLRENDERAPI_SRC_NOFILTER
 	"BsGLCommandBuffer.cpp"
 	"BsGLCommandBufferManager.cpp"
 	"BsGLTextureView.cpp"
+	"BsGLSamplerState.cpp"
+	"BsGLRenderStateManager.cpp"
 )
 
 set(BS_GLRENDERAPI_INC_GLSL
@@ -297,4 +297,58 @@ namespace bs { namespace ct
 			return true;
 		}
 	}
+
+	bool GLSLGpuProgram::setUniformUnit(GLint location, GLint unit)
+	{
+		if (!updateBindingCache(BindingType::Uniform, (UINT32)location, (UINT32)unit))
+			return false;
+
+		glProgramUniform1i(mGLHandle, location, unit);
+		BS_CHECK_GL_ERROR();
+
+		return true;
+	}
+
+	bool GLSLGpuProgram::setUniformBlockBinding(GLuint blockIdx, GLuint binding)
+	{
+		if (!updateBindingCache(BindingType::UniformBlock, blockIdx, binding))
+			return false;
+
+		glUniformBlockBinding(mGLHandle, blockIdx, binding);
+		BS_CHECK_GL_ERROR();
+
+		return true;
+	}
+
+#if BS_OPENGL_4_3 || BS_OPENGLES_3_1
+	bool GLSLGpuProgram::setStorageBlockBinding(GLuint blockIdx, GLuint binding)
+	{
+		if (!updateBindingCache(BindingType::StorageBlock, blockIdx, binding))
+			return false;
+
+		glShaderStorageBlockBinding(mGLHandle, blockIdx, binding);
+		BS_CHECK_GL_ERROR();
+
+		return true;
+	}
+#endif
+
+	bool GLSLGpuProgram::updateBindingCache(BindingType type, UINT32 slot, UINT32 value)
+	{
+		// Uniform locations and block indices are small, so the top bits are free to identify the binding type
+		const UINT32 key = ((UINT32)type << 28) | slot;
+
+		auto iterFind = mBindingCache.find(key);
+		if (iterFind != mBindingCache.end())
+		{
+			if (iterFind->second == value)
+				return false;
+
+			iterFind->second = value;
+		}
+		else
+			mBindingCache[key] = value;
+
+		return true;
+	}
 }}
\ No newline at end of file
@@ -26,6 +26,32 @@ namespace bs { namespace ct
 		/** Gets an unique index for this GPU program. Each created GPU program is assigned a unique index on creation. */
 		UINT32 getProgramID() const { return mProgramID; }
 
+		/**
+		 * Assigns a texture or image unit to the sampler or image uniform at @p location. Assigned units are remembered
+		 * by the program, and the GL call is skipped if the uniform already uses the provided unit.
+		 *
+		 * @return	True if the GL call was issued, false if it was skipped.
+		 */
+		bool setUniformUnit(GLint location, GLint unit);
+
+		/**
+		 * Assigns an uniform buffer binding point to the uniform block with index @p blockIdx. Skips the GL call if the
+		 * block already uses the provided binding point.
+		 *
+		 * @return	True if the GL call was issued, false if it was skipped.
+		 */
+		bool setUniformBlockBinding(GLuint blockIdx, GLuint binding);
+
+#if BS_OPENGL_4_3 || BS_OPENGLES_3_1
+		/**
+		 * Assigns a shader storage buffer binding point to the storage block with index @p blockIdx. Skips the GL call
+		 * if the block already uses the provided binding point.
+		 *
+		 * @return	True if the GL call was issued, false if it was skipped.
+		 */
+		bool setStorageBlockBinding(GLuint blockIdx, GLuint binding);
+#endif
+
 	private:
 		friend class GLSLProgramFactory;
 
@@ -34,9 +60,24 @@ namespace bs { namespace ct
 		/** @copydoc GpuProgram::initialize */
 		void initialize() override;
 
+		/** Types of program bindings whose assigned values are cached. */
+		enum class BindingType
+		{
+			Uniform,
+			UniformBlock,
+			StorageBlock
+		};
+
+		/**
+		 * Records the value assigned to a program binding. Returns false if the binding already had the same value
+		 * assigned, true otherwise.
+		 */
+		bool updateBindingCache(BindingType type, UINT32 slot, UINT32 value);
+
 	private:
 		UINT32 mProgramID;
 		GLuint mGLHandle;
+		UnorderedMap<UINT32, UINT32> mBindingCache;
 
 		static UINT32 sVertexShaderCount;
 		static UINT32 sFragmentShaderCount;
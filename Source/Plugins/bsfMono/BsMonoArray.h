@@ -63,6 +63,39 @@ namespace bs
 			return (T*)_getArrayAddr(mInternal, sizeof(T), idx);
 		}
 
+		/**
+		 * Copies a sequence of values into the array, starting at the specified index, using a single memory copy.
+		 * Only usable for blittable types, i.e. primitives and structs without any managed references, whose native
+		 * and managed layouts match.
+		 */
+		template<class T>
+		void setBlittable(UINT32 idx, const T* values, UINT32 count)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only blittable types can be copied directly.");
+#if BS_DEBUG_MODE
+			assert(sizeof(T) == elementSize());
+			assert((idx + count) <= size());
+#endif
+			if (count > 0)
+				memcpy(_getArrayAddr(mInternal, sizeof(T), idx), values, sizeof(T) * count);
+		}
+
+		/**
+		 * Copies a sequence of values from the array, starting at the specified index, using a single memory copy. Only
+		 * usable for blittable types. See setBlittable().
+		 */
+		template<class T>
+		void getBlittable(UINT32 idx, T* output, UINT32 count) const
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only blittable types can be copied directly.");
+#if BS_DEBUG_MODE
+			assert(sizeof(T) == elementSize());
+			assert((idx + count) <= size());
+#endif
+			if (count > 0)
+				memcpy(output, _getArrayAddr(mInternal, sizeof(T), idx), sizeof(T) * count);
+		}
+
 		/** 
 		 * Creates a new array of managed objects. 
 		 *
@@ -118,6 +151,75 @@ namespace bs
 		MonoArray* mInternal;
 	};
 
+	/**
+	 * Provides direct access to the elements of a managed array of blittable values (primitives or structs without any
+	 * managed references), so native code can read and write them without copying the data to a native container
+	 * first. The array is pinned for the lifetime of the view, meaning the garbage collector won't move it and the
+	 * returned pointers stay valid even if managed allocations happen in the meantime.
+	 */
+	template<class T>
+	class ScriptArrayView
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only arrays of blittable types can be viewed directly.");
+
+	public:
+		/** Pins the provided array and creates a view of its elements. Null array results in an empty view. */
+		ScriptArrayView(MonoArray* array)
+		{
+			if (array == nullptr)
+				return;
+
+			ScriptArray scriptArray(array);
+#if BS_DEBUG_MODE
+			assert(sizeof(T) == scriptArray.elementSize());
+#endif
+
+			mHandle = MonoUtil::newGCHandle((MonoObject*)array, true);
+			mSize = scriptArray.size();
+			mData = (T*)ScriptArray::_getArrayAddr(array, sizeof(T), 0);
+		}
+
+		ScriptArrayView(ScriptArrayView&& other)
+			:mHandle(other.mHandle), mData(other.mData), mSize(other.mSize)
+		{
+			other.mHandle = 0;
+			other.mData = nullptr;
+			other.mSize = 0;
+		}
+
+		ScriptArrayView(const ScriptArrayView&) = delete;
+		ScriptArrayView& operator=(const ScriptArrayView&) = delete;
+
+		~ScriptArrayView()
+		{
+			if (mHandle != 0)
+				MonoUtil::freeGCHandle(mHandle);
+		}
+
+		/** Returns a pointer to the first element of the array. */
+		T* data() const { return mData; }
+
+		/** Returns the number of elements in the array. */
+		UINT32 size() const { return mSize; }
+
+		/** Checks if the view contains no elements. */
+		bool empty() const { return mSize == 0; }
+
+		T& operator[](UINT32 idx) const
+		{
+			assert(idx < mSize);
+			return mData[idx];
+		}
+
+		T* begin() const { return mData; }
+		T* end() const { return mData + mSize; }
+
+	private:
+		UINT32 mHandle = 0;
+		T* mData = nullptr;
+		UINT32 mSize = 0;
+	};
+
 	/** @} */
 
 	/** @addtogroup Implementation
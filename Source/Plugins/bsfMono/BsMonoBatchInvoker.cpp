@@ -0,0 +1,75 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsMonoBatchInvoker.h"
+#include "BsMonoClass.h"
+#include "BsMonoUtil.h"
+#include "BsMonoArray.h"
+#include "Debug/BsDebug.h"
+#include <mono/metadata/object.h>
+
+namespace bs
+{
+	MonoBatchInvoker::MonoBatchInvoker(MonoClass& klass, const String& methodName, const String& dispatchMethodName)
+		:mClass(klass)
+	{
+		MonoMethod* method = klass.getMethod(methodName);
+		if (method == nullptr || method->isStatic())
+		{
+			LOGERR("Cannot find an instance method \"" + methodName + "\" with no parameters in class \"" +
+				klass.getFullName() + "\".");
+		}
+		else
+			mMethodThunk = MonoThunk<void(MonoObject*)>(method);
+
+		if (!dispatchMethodName.empty())
+		{
+			MonoMethod* dispatchMethod = klass.getMethod(dispatchMethodName, 2);
+			if (dispatchMethod != nullptr && dispatchMethod->isStatic())
+				mDispatchThunk = MonoThunk<void(MonoArray*, INT32)>(dispatchMethod);
+		}
+	}
+
+	MonoBatchInvoker::~MonoBatchInvoker()
+	{
+		if (mArrayHandle != 0)
+			MonoUtil::freeGCHandle(mArrayHandle);
+	}
+
+	void MonoBatchInvoker::invoke(MonoObject** instances, UINT32 count)
+	{
+		if (count == 0)
+			return;
+
+		if (!mDispatchThunk)
+		{
+			if (!mMethodThunk)
+				return;
+
+			for (UINT32 i = 0; i < count; i++)
+				mMethodThunk(instances[i]);
+
+			return;
+		}
+
+		if (count > mArrayCapacity)
+		{
+			if (mArrayHandle != 0)
+				MonoUtil::freeGCHandle(mArrayHandle);
+
+			mArrayCapacity = std::max(count, mArrayCapacity * 2);
+
+			ScriptArray array(mClass, mArrayCapacity);
+			mArrayHandle = MonoUtil::newGCHandle((MonoObject*)array.getInternal(), false);
+		}
+
+		MonoArray* array = (MonoArray*)MonoUtil::getObjectFromGCHandle(mArrayHandle);
+		for (UINT32 i = 0; i < count; i++)
+			mono_array_setref(array, i, instances[i]);
+
+		mDispatchThunk(array, (INT32)count);
+
+		// Don't keep the objects alive through the cached array
+		for (UINT32 i = 0; i < count; i++)
+			mono_array_setref(array, i, nullptr);
+	}
+}
@@ -0,0 +1,51 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsMonoPrerequisites.h"
+#include "BsMonoMethod.h"
+
+namespace bs
+{
+	/** @addtogroup Mono
+	 *  @{
+	 */
+
+	/**
+	 * Invokes a parameterless managed instance method (e.g. a per-frame update callback) on a set of objects of the
+	 * same class. If the class provides a static dispatch method with a (T[] instances, int count) signature, all
+	 * objects are passed to it in a single call, crossing the native/managed boundary once instead of once per object.
+	 * Otherwise the method is invoked on each object through its thunk.
+	 *
+	 * The array passed to the dispatch method is kept between calls and only reallocated when it needs to grow.
+	 */
+	class BS_MONO_EXPORT MonoBatchInvoker
+	{
+	public:
+		/**
+		 * @param[in]	klass				Class whose objects the method is invoked on.
+		 * @param[in]	methodName			Name of the parameterless instance method to invoke.
+		 * @param[in]	dispatchMethodName	Name of the static dispatch method. If empty or if the class has no such
+		 *									method, @p methodName is invoked on each object individually.
+		 */
+		MonoBatchInvoker(MonoClass& klass, const String& methodName,
+			const String& dispatchMethodName = StringUtil::BLANK);
+		~MonoBatchInvoker();
+
+		/** Invokes the method on all of the provided objects. All objects must be instances of the invoker's class. */
+		void invoke(MonoObject** instances, UINT32 count);
+
+		/** Returns true if the objects are passed to the dispatch method in a single call. */
+		bool isBatched() const { return (bool)mDispatchThunk; }
+
+	private:
+		MonoClass& mClass;
+		MonoThunk<void(MonoObject*)> mMethodThunk;
+		MonoThunk<void(MonoArray*, INT32)> mDispatchThunk;
+
+		UINT32 mArrayHandle = 0;
+		UINT32 mArrayCapacity = 0;
+	};
+
+	/** @} */
+}
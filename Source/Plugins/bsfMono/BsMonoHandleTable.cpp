@@ -0,0 +1,202 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsMonoHandleTable.h"
+#include "BsMonoClass.h"
+#include "BsMonoUtil.h"
+#include <mono/metadata/object.h>
+
+namespace bs
+{
+	MonoHandleTable::~MonoHandleTable()
+	{
+		clear();
+	}
+
+	MonoHandleTable::Entry& MonoHandleTable::getEntry(UINT32 id)
+	{
+		assert(id > 0 && id <= (UINT32)mEntries.size() && mEntries[id - 1].gcHandle != 0);
+		return mEntries[id - 1];
+	}
+
+	const MonoHandleTable::Entry& MonoHandleTable::getEntry(UINT32 id) const
+	{
+		assert(id > 0 && id <= (UINT32)mEntries.size() && mEntries[id - 1].gcHandle != 0);
+		return mEntries[id - 1];
+	}
+
+	UINT32 MonoHandleTable::addHandle(UINT32 gcHandle, bool strong)
+	{
+		UINT32 id;
+		if (mFirstFree != 0)
+		{
+			id = mFirstFree;
+			mFirstFree = mEntries[id - 1].nextFree;
+		}
+		else
+		{
+			mEntries.push_back(Entry());
+			id = (UINT32)mEntries.size();
+		}
+
+		Entry& entry = mEntries[id - 1];
+		entry.gcHandle = gcHandle;
+		entry.strong = strong;
+		entry.nextFree = 0;
+
+		mNumEntries++;
+		return id;
+	}
+
+	void MonoHandleTable::freeEntry(UINT32 id)
+	{
+		Entry& entry = mEntries[id - 1];
+		entry.gcHandle = 0;
+		entry.nextFree = mFirstFree;
+
+		mFirstFree = id;
+		mNumEntries--;
+	}
+
+	UINT32 MonoHandleTable::add(MonoObject* object, bool strong)
+	{
+		UINT32 gcHandle = strong ? MonoUtil::newGCHandle(object, false) : MonoUtil::newWeakGCHandle(object);
+		return addHandle(gcHandle, strong);
+	}
+
+	void MonoHandleTable::add(MonoObject** objects, UINT32 count, bool strong, UINT32* outIds)
+	{
+		// Make sure the entries are only reallocated once
+		UINT32 numFree = (UINT32)mEntries.size() - mNumEntries;
+		if (count > numFree)
+			mEntries.reserve(mEntries.size() + (count - numFree));
+
+		for (UINT32 i = 0; i < count; i++)
+			outIds[i] = add(objects[i], strong);
+	}
+
+	void MonoHandleTable::remove(UINT32 id)
+	{
+		Entry& entry = getEntry(id);
+		MonoUtil::freeGCHandle(entry.gcHandle);
+
+		freeEntry(id);
+	}
+
+	MonoObject* MonoHandleTable::get(UINT32 id) const
+	{
+		return MonoUtil::getObjectFromGCHandle(getEntry(id).gcHandle);
+	}
+
+	void MonoHandleTable::setStrong(UINT32 id, bool strong)
+	{
+		Entry& entry = getEntry(id);
+		if (entry.strong == strong)
+			return;
+
+		// Note: Handle type cannot be changed in place, so a new handle is created. If a weak handle's object was
+		// already collected the new handle will simply reference null.
+		MonoObject* object = MonoUtil::getObjectFromGCHandle(entry.gcHandle);
+		UINT32 gcHandle = strong ? MonoUtil::newGCHandle(object, false) : MonoUtil::newWeakGCHandle(object);
+
+		MonoUtil::freeGCHandle(entry.gcHandle);
+		entry.gcHandle = gcHandle;
+		entry.strong = strong;
+	}
+
+	bool MonoHandleTable::isStrong(UINT32 id) const
+	{
+		return getEntry(id).strong;
+	}
+
+	UINT32 MonoHandleTable::acquire(MonoClass& klass, bool strong)
+	{
+		auto iterFind = mPool.find(klass._getInternalClass());
+		if (iterFind == mPool.end() || iterFind->second.empty())
+			return add(klass.createInstance(false), strong);
+
+		// Pooled handles are strong, so they can be used directly
+		UINT32 gcHandle = iterFind->second.back();
+		iterFind->second.pop_back();
+
+		UINT32 id = addHandle(gcHandle, true);
+		if (!strong)
+			setStrong(id, false);
+
+		return id;
+	}
+
+	void MonoHandleTable::recycle(UINT32 id)
+	{
+		Entry& entry = getEntry(id);
+
+		MonoObject* object = MonoUtil::getObjectFromGCHandle(entry.gcHandle);
+		if (object == nullptr)
+		{
+			remove(id);
+			return;
+		}
+
+		Vector<UINT32>& pool = mPool[mono_object_get_class(object)];
+		if ((UINT32)pool.size() >= mMaxPooledObjects)
+		{
+			remove(id);
+			return;
+		}
+
+		UINT32 gcHandle = entry.gcHandle;
+		if (!entry.strong)
+		{
+			gcHandle = MonoUtil::newGCHandle(object, false);
+			MonoUtil::freeGCHandle(entry.gcHandle);
+		}
+
+		pool.push_back(gcHandle);
+		freeEntry(id);
+	}
+
+	void MonoHandleTable::prewarm(MonoClass& klass, UINT32 count)
+	{
+		Vector<UINT32>& pool = mPool[klass._getInternalClass()];
+
+		count = std::min(count, mMaxPooledObjects - std::min(mMaxPooledObjects, (UINT32)pool.size()));
+		pool.reserve(pool.size() + count);
+
+		for (UINT32 i = 0; i < count; i++)
+			pool.push_back(MonoUtil::newGCHandle(klass.createInstance(false), false));
+	}
+
+	void MonoHandleTable::setMaxPooledObjects(UINT32 count)
+	{
+		mMaxPooledObjects = count;
+
+		for (auto& entry : mPool)
+		{
+			Vector<UINT32>& pool = entry.second;
+			for (UINT32 i = count; i < (UINT32)pool.size(); i++)
+				MonoUtil::freeGCHandle(pool[i]);
+
+			if ((UINT32)pool.size() > count)
+				pool.resize(count);
+		}
+	}
+
+	void MonoHandleTable::clear()
+	{
+		for (auto& entry : mEntries)
+		{
+			if (entry.gcHandle != 0)
+				MonoUtil::freeGCHandle(entry.gcHandle);
+		}
+
+		for (auto& entry : mPool)
+		{
+			for (auto& gcHandle : entry.second)
+				MonoUtil::freeGCHandle(gcHandle);
+		}
+
+		mEntries.clear();
+		mPool.clear();
+		mFirstFree = 0;
+		mNumEntries = 0;
+	}
+}
@@ -0,0 +1,124 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsMonoPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Mono
+	 *  @{
+	 */
+
+	/**
+	 * Table of GC handles to managed objects, meant for managed wrappers of native objects. Each entry is referenced
+	 * by an ID instead of the GC handle itself, which allows entries to switch between strong and weak handles without
+	 * the owner having to track the change. Removed entries are reused by later additions.
+	 *
+	 * The table can also keep managed objects of native objects that were destroyed, and hand them out again through
+	 * acquire() for new native objects of the same type. This avoids allocating a new managed object, and creating and
+	 * freeing its GC handle, every time a native object is created and destroyed.
+	 *
+	 * All handles held by the table are invalidated when the script domain is unloaded, so the table must be cleared
+	 * before that happens (see MonoManager::onDomainUnload).
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_MONO_EXPORT MonoHandleTable
+	{
+	public:
+		MonoHandleTable() = default;
+		~MonoHandleTable();
+
+		/**
+		 * Adds a managed object to the table.
+		 *
+		 * @param[in]	object	Object to reference.
+		 * @param[in]	strong	If true the object is kept alive by the table, otherwise it can be collected by the GC
+		 *						in which case get() returns null.
+		 * @return				ID of the new entry. Never zero.
+		 */
+		UINT32 add(MonoObject* object, bool strong = true);
+
+		/** Adds multiple managed objects to the table at once and writes their IDs to @p outIds. See add(). */
+		void add(MonoObject** objects, UINT32 count, bool strong, UINT32* outIds);
+
+		/** Removes an entry from the table and releases its handle. */
+		void remove(UINT32 id);
+
+		/** Returns the object referenced by the entry, or null if the entry is weak and its object was collected. */
+		MonoObject* get(UINT32 id) const;
+
+		/**
+		 * Promotes the entry to a strong handle, keeping its object alive, or demotes it to a weak handle allowing the
+		 * object to be collected.
+		 */
+		void setStrong(UINT32 id, bool strong);
+
+		/** Checks whether the entry holds a strong handle. */
+		bool isStrong(UINT32 id) const;
+
+		/**
+		 * Adds an instance of the provided class to the table. The instance is taken from the objects previously passed
+		 * to recycle() if available, or created otherwise. Newly created instances are not constructed, and reused
+		 * instances retain their field values, so the caller is expected to initialize the object.
+		 *
+		 * @param[in]	klass	Class of the object to acquire.
+		 * @param[in]	strong	Determines the handle type of the entry. See add().
+		 * @return				ID of the new entry.
+		 */
+		UINT32 acquire(MonoClass& klass, bool strong = true);
+
+		/**
+		 * Removes the entry from the table, but keeps its object so a later acquire() call for the same class can
+		 * return it. If the pool for the class is full, or the object was already collected, this is the same as
+		 * remove(). Caller must ensure the object is no longer used by managed code.
+		 */
+		void recycle(UINT32 id);
+
+		/**
+		 * Creates instances of the provided class ahead of time so later acquire() calls can reuse them. Useful for
+		 * moving the allocations to load time.
+		 */
+		void prewarm(MonoClass& klass, UINT32 count);
+
+		/** Sets the maximum number of objects that are kept for reuse, per class. Default is 256. */
+		void setMaxPooledObjects(UINT32 count);
+
+		/** Returns the number of entries in the table. */
+		UINT32 getNumEntries() const { return mNumEntries; }
+
+		/** Releases all entries and all objects kept for reuse. */
+		void clear();
+
+	private:
+		/** Single entry in the table. */
+		struct Entry
+		{
+			UINT32 gcHandle = 0;
+			bool strong = false;
+			UINT32 nextFree = 0;
+		};
+
+		/** Returns the entry with the specified ID. */
+		Entry& getEntry(UINT32 id);
+
+		/** Returns the entry with the specified ID. */
+		const Entry& getEntry(UINT32 id) const;
+
+		/** Stores the GC handle in a free entry and returns its ID. */
+		UINT32 addHandle(UINT32 gcHandle, bool strong);
+
+		/** Marks the entry as free so it can be reused. */
+		void freeEntry(UINT32 id);
+
+		Vector<Entry> mEntries;
+		UINT32 mFirstFree = 0; // One-based index, zero if no free entries
+		UINT32 mNumEntries = 0;
+
+		UnorderedMap<::MonoClass*, Vector<UINT32>> mPool; // Strong GC handles of recycled objects
+		UINT32 mMaxPooledObjects = 256;
+	};
+
+	/** @} */
+}
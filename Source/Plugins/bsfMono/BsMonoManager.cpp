@@ -10,6 +10,8 @@
 #include "Error/BsException.h"
 #include "BsApplication.h"
 #include "BsEngineConfig.h"
+#include "Profiling/BsFrameTelemetry.h"
+#include "Utility/BsTime.h"
 
 #include "mono/jit/jit.h"
 #include <mono/metadata/assembly.h>
@@ -18,9 +20,19 @@
 #include <mono/metadata/mono-debug.h>
 #include <mono/utils/mono-logger.h>
 #include <mono/metadata/threads.h>
+#include <mono/metadata/profiler.h>
+
+/** Data shared between Mono profiler callbacks. */
+struct _MonoProfiler
+{
+	/** Time at which the world was stopped for the currently running garbage collection, in microseconds. */
+	std::atomic<bs::UINT64> gcPauseStart{0};
+};
 
 namespace bs
 {
+	static MonoProfiler sMonoProfiler;
+
 	const String MONO_LIB_DIR = "bin/Mono/lib/";
 	const String MONO_ETC_DIR = "bin/Mono/etc/";
 	const String MONO_COMPILER_DIR = "bin/Mono/compiler/";
@@ -81,6 +93,24 @@ namespace bs
 		}
 	}
 
+	/**
+	 * Reports the time between the world being stopped and restarted by the garbage collector to FrameTelemetry.
+	 *
+	 * @note	Newer Mono versions pass an additional parameter that isn't needed here. The callback is cast to the
+	 *			expected type when registered, which is safe as the caller cleans up the arguments.
+	 */
+	void monoGCEventCallback(MonoProfiler* profiler, MonoProfilerGCEvent event, uint32_t generation)
+	{
+		if (event == MONO_GC_EVENT_PRE_STOP_WORLD)
+			profiler->gcPauseStart.store(gTime().getTimePrecise(), std::memory_order_relaxed);
+		else if (event == MONO_GC_EVENT_POST_START_WORLD)
+		{
+			UINT64 pauseStart = profiler->gcPauseStart.exchange(0, std::memory_order_relaxed);
+			if (pauseStart != 0 && FrameTelemetry::isStarted())
+				gFrameTelemetry()._addScriptGCPause(gTime().getTimePrecise() - pauseStart);
+		}
+	}
+
 	void monoPrintCallback(const char* string, mono_bool isStdout)
 	{
 		LOGWRN(StringUtil::format("Mono error: {0}", string));
@@ -132,6 +162,9 @@ namespace bs
 
 		mono_config_parse(nullptr);
 
+		MonoProfilerHandle profilerHandle = mono_profiler_create(&sMonoProfiler);
+		mono_profiler_set_gc_event_callback(profilerHandle, (MonoProfilerGCEventCallback)&monoGCEventCallback);
+
 		mRootDomain = mono_jit_init_version("BansheeMono", MONO_VERSION_DATA[(int)MONO_VERSION].version.c_str());
 		if (mRootDomain == nullptr)
 			BS_EXCEPT(InternalErrorException, "Cannot initialize Mono runtime.");
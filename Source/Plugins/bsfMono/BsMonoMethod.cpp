@@ -12,7 +12,7 @@ namespace bs
 {
 	MonoMethod::MonoMethod(::MonoMethod* method)
 		:mMethod(method), mCachedReturnType(nullptr), mCachedParameters(nullptr), 
-		mCachedNumParameters(0), mIsStatic(false), mHasCachedSignature(false)
+		mCachedNumParameters(0), mIsStatic(false), mHasCachedSignature(false), mCachedThunk(nullptr)
 	{
 
 	}
@@ -45,7 +45,10 @@ namespace bs
 
 	void* MonoMethod::getThunk() const
 	{
-		return mono_method_get_unmanaged_thunk(mMethod);
+		if (mCachedThunk == nullptr)
+			mCachedThunk = mono_method_get_unmanaged_thunk(mMethod);
+
+		return mCachedThunk;
 	}
 
 	String MonoMethod::getName() const
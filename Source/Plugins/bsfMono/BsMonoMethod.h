@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsMonoPrerequisites.h"
+#include "BsMonoUtil.h"
 
 namespace bs
 {
@@ -45,6 +46,7 @@ namespace bs
 
 		/**
 		 * Gets a thunk for this method. A thunk is a C++ like function pointer that you can use for calling the method.
+		 * The thunk is created on first call and cached afterwards. See MonoThunk for a typed wrapper.
 		 *
 		 * @note	This is the fastest way of calling managed code.
 		 */
@@ -92,6 +94,78 @@ namespace bs
 		mutable UINT32 mCachedNumParameters;
 		mutable bool mIsStatic;
 		mutable bool mHasCachedSignature;
+		mutable void* mCachedThunk;
+	};
+
+	/**
+	 * Typed wrapper around the thunk of a managed method, allowing the method to be called like a native function
+	 * without boxing its parameters. Parameters of the provided signature must match the managed method, with value
+	 * types passed by value and reference types as MonoObject* (or MonoString*, MonoArray*). Instance methods
+	 * receive the instance as the first parameter. Managed exceptions are reported through
+	 * MonoUtil::throwIfException(), which is only called if an exception was actually thrown.
+	 *
+	 * @note	Thunks don't respect polymorphism and always call the exact method they were retrieved from.
+	 */
+	template<class T>
+	class MonoThunk;
+
+	template<class Ret, class... Args>
+	class MonoThunk<Ret(Args...)>
+	{
+	public:
+		typedef Ret(BS_THUNKCALL *ThunkType)(Args..., MonoException**);
+
+		MonoThunk() = default;
+		MonoThunk(const MonoMethod* method)
+			:mThunk(method != nullptr ? (ThunkType)method->getThunk() : nullptr)
+		{ }
+
+		/** Calls the managed method. */
+		Ret operator()(Args... args) const
+		{
+			MonoException* exception = nullptr;
+			Ret output = mThunk(args..., &exception);
+
+			if (exception != nullptr)
+				MonoUtil::throwIfException(exception);
+
+			return output;
+		}
+
+		/** Checks if the thunk refers to a method. */
+		explicit operator bool() const { return mThunk != nullptr; }
+
+	private:
+		ThunkType mThunk = nullptr;
+	};
+
+	/** @copydoc MonoThunk */
+	template<class... Args>
+	class MonoThunk<void(Args...)>
+	{
+	public:
+		typedef void(BS_THUNKCALL *ThunkType)(Args..., MonoException**);
+
+		MonoThunk() = default;
+		MonoThunk(const MonoMethod* method)
+			:mThunk(method != nullptr ? (ThunkType)method->getThunk() : nullptr)
+		{ }
+
+		/** @copydoc MonoThunk<Ret(Args...)>::operator() */
+		void operator()(Args... args) const
+		{
+			MonoException* exception = nullptr;
+			mThunk(args..., &exception);
+
+			if (exception != nullptr)
+				MonoUtil::throwIfException(exception);
+		}
+
+		/** @copydoc MonoThunk<Ret(Args...)>::operator bool */
+		explicit operator bool() const { return mThunk != nullptr; }
+
+	private:
+		ThunkType mThunk = nullptr;
 	};
 
 	/** @} */
@@ -51,6 +51,8 @@ namespace bs
 	class MonoMethod;
 	class MonoField;
 	class MonoProperty;
+	class MonoBatchInvoker;
+	class MonoHandleTable;
 
 	/** A list of all valid Mono primitive types. */
 	enum class MonoPrimitiveType
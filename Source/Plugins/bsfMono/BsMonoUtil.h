@@ -168,7 +168,8 @@ namespace bs
 			MonoException* exception = nullptr;
 			thunk(std::forward<Args>(args)..., &exception);
 
-			throwIfException(exception);
+			if (exception != nullptr)
+				throwIfException(exception);
 		}
 	};
 
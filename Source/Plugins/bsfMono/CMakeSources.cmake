@@ -9,6 +9,8 @@ set(BS_MONO_INC_NOFILTER
 	"BsMonoUtil.h"
 	"BsScriptMeta.h"
 	"BsMonoArray.h"
+	"BsMonoBatchInvoker.h"
+	"BsMonoHandleTable.h"
 )
 
 set(BS_MONO_SRC_NOFILTER
@@ -22,6 +24,8 @@ set(BS_MONO_SRC_NOFILTER
 	"BsScriptMeta.cpp"
 	"BsMonoUtil.cpp"
 	"BsMonoArray.cpp"
+	"BsMonoBatchInvoker.cpp"
+	"BsMonoHandleTable.cpp"
 )
 
 source_group("" FILES ${BS_MONO_INC_NOFILTER} ${BS_MONO_SRC_NOFILTER})
@@ -0,0 +1,124 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsNullManagers.h"
+#include "BsNullResources.h"
+#include "BsNullRenderWindow.h"
+#include "Image/BsPixelUtil.h"
+
+namespace bs
+{
+	PixelFormat NullTextureManager::getNativeFormat(TextureType ttype, PixelFormat format, int usage, bool hwGamma)
+	{
+		PixelUtil::checkFormat(format, ttype, usage);
+
+		return format;
+	}
+
+	SPtr<RenderTexture> NullTextureManager::createRenderTextureImpl(const RENDER_TEXTURE_DESC& desc)
+	{
+		NullRenderTexture* tex = new (bs_alloc<NullRenderTexture>()) NullRenderTexture(desc);
+
+		return bs_core_ptr<NullRenderTexture>(tex);
+	}
+
+	SPtr<RenderWindow> NullRenderWindowManager::createImpl(RENDER_WINDOW_DESC& desc, UINT32 windowId,
+		const SPtr<RenderWindow>& parentWindow)
+	{
+		NullRenderWindow* renderWindow = new (bs_alloc<NullRenderWindow>()) NullRenderWindow(desc, windowId);
+		return bs_core_ptr<NullRenderWindow>(renderWindow);
+	}
+
+	namespace ct
+	{
+	SPtr<Texture> NullTextureManager::createTextureInternal(const TEXTURE_DESC& desc,
+		const SPtr<PixelData>& initialData, GpuDeviceFlags deviceMask)
+	{
+		NullTexture* tex = new (bs_alloc<NullTexture>()) NullTexture(desc, initialData, deviceMask);
+
+		SPtr<NullTexture> texPtr = bs_shared_ptr<NullTexture>(tex);
+		texPtr->_setThisPtr(texPtr);
+
+		return texPtr;
+	}
+
+	SPtr<RenderTexture> NullTextureManager::createRenderTextureInternal(const RENDER_TEXTURE_DESC& desc,
+		UINT32 deviceIdx)
+	{
+		SPtr<NullRenderTexture> texPtr = bs_shared_ptr_new<NullRenderTexture>(desc, deviceIdx);
+		texPtr->_setThisPtr(texPtr);
+
+		return texPtr;
+	}
+
+	SPtr<VertexBuffer> NullHardwareBufferManager::createVertexBufferInternal(const VERTEX_BUFFER_DESC& desc,
+		GpuDeviceFlags deviceMask)
+	{
+		SPtr<NullVertexBuffer> ret = bs_shared_ptr_new<NullVertexBuffer>(desc, deviceMask);
+		ret->_setThisPtr(ret);
+
+		return ret;
+	}
+
+	SPtr<IndexBuffer> NullHardwareBufferManager::createIndexBufferInternal(const INDEX_BUFFER_DESC& desc,
+		GpuDeviceFlags deviceMask)
+	{
+		SPtr<NullIndexBuffer> ret = bs_shared_ptr_new<NullIndexBuffer>(desc, deviceMask);
+		ret->_setThisPtr(ret);
+
+		return ret;
+	}
+
+	SPtr<GpuParamBlockBuffer> NullHardwareBufferManager::createGpuParamBlockBufferInternal(UINT32 size,
+		GpuParamBlockUsage usage, GpuDeviceFlags deviceMask)
+	{
+		SPtr<NullGpuParamBlockBuffer> ret = bs_shared_ptr_new<NullGpuParamBlockBuffer>(size, usage, deviceMask);
+		ret->_setThisPtr(ret);
+
+		return ret;
+	}
+
+	SPtr<GpuBuffer> NullHardwareBufferManager::createGpuBufferInternal(const GPU_BUFFER_DESC& desc,
+		GpuDeviceFlags deviceMask)
+	{
+		SPtr<NullGpuBuffer> ret = bs_shared_ptr_new<NullGpuBuffer>(desc, deviceMask);
+		ret->_setThisPtr(ret);
+
+		return ret;
+	}
+
+	SPtr<CommandBuffer> NullCommandBufferManager::createInternal(GpuQueueType type, UINT32 deviceIdx,
+		UINT32 queueIdx, bool secondary)
+	{
+		CommandBuffer* buffer = new (bs_alloc<NullCommandBuffer>()) NullCommandBuffer(type, deviceIdx, queueIdx,
+			secondary);
+		return bs_shared_ptr(buffer);
+	}
+
+	SPtr<EventQuery> NullQueryManager::createEventQuery(UINT32 deviceIdx) const
+	{
+		SPtr<EventQuery> query = SPtr<NullEventQuery>(bs_new<NullEventQuery>(),
+			&QueryManager::deleteEventQuery, StdAlloc<NullEventQuery>());
+		mEventQueries.push_back(query.get());
+
+		return query;
+	}
+
+	SPtr<TimerQuery> NullQueryManager::createTimerQuery(UINT32 deviceIdx) const
+	{
+		SPtr<TimerQuery> query = SPtr<NullTimerQuery>(bs_new<NullTimerQuery>(),
+			&QueryManager::deleteTimerQuery, StdAlloc<NullTimerQuery>());
+		mTimerQueries.push_back(query.get());
+
+		return query;
+	}
+
+	SPtr<OcclusionQuery> NullQueryManager::createOcclusionQuery(bool binary, UINT32 deviceIdx) const
+	{
+		SPtr<OcclusionQuery> query = SPtr<NullOcclusionQuery>(bs_new<NullOcclusionQuery>(binary),
+			&QueryManager::deleteOcclusionQuery, StdAlloc<NullOcclusionQuery>());
+		mOcclusionQueries.push_back(query.get());
+
+		return query;
+	}
+	}
+}
@@ -0,0 +1,100 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "Managers/BsTextureManager.h"
+#include "Managers/BsRenderWindowManager.h"
+#include "Managers/BsHardwareBufferManager.h"
+#include "Managers/BsCommandBufferManager.h"
+#include "Managers/BsQueryManager.h"
+
+namespace bs
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**	Handles creation of null render textures. */
+	class NullTextureManager : public TextureManager
+	{
+	public:
+		/** @copydoc TextureManager::getNativeFormat */
+		PixelFormat getNativeFormat(TextureType ttype, PixelFormat format, int usage, bool hwGamma) override;
+
+	protected:
+		/** @copydoc TextureManager::createRenderTextureImpl */
+		SPtr<RenderTexture> createRenderTextureImpl(const RENDER_TEXTURE_DESC& desc) override;
+	};
+
+	/** Handles creation of windows without an OS window backing them. */
+	class NullRenderWindowManager : public RenderWindowManager
+	{
+	protected:
+		/** @copydoc RenderWindowManager::createImpl */
+		SPtr<RenderWindow> createImpl(RENDER_WINDOW_DESC& desc, UINT32 windowId,
+			const SPtr<RenderWindow>& parentWindow) override;
+	};
+
+	namespace ct
+	{
+	/**	Handles creation of null textures. */
+	class NullTextureManager : public TextureManager
+	{
+	protected:
+		/** @copydoc TextureManager::createTextureInternal */
+		SPtr<Texture> createTextureInternal(const TEXTURE_DESC& desc,
+			const SPtr<PixelData>& initialData = nullptr, GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+
+		/** @copydoc TextureManager::createRenderTextureInternal */
+		SPtr<RenderTexture> createRenderTextureInternal(const RENDER_TEXTURE_DESC& desc,
+			UINT32 deviceIdx = 0) override;
+	};
+
+	/**	Handles creation of null buffers. */
+	class NullHardwareBufferManager : public HardwareBufferManager
+	{
+	protected:
+		/** @copydoc HardwareBufferManager::createVertexBufferInternal */
+		SPtr<VertexBuffer> createVertexBufferInternal(const VERTEX_BUFFER_DESC& desc,
+			GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+
+		/** @copydoc HardwareBufferManager::createIndexBufferInternal */
+		SPtr<IndexBuffer> createIndexBufferInternal(const INDEX_BUFFER_DESC& desc,
+			GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+
+		/** @copydoc HardwareBufferManager::createGpuParamBlockBufferInternal */
+		SPtr<GpuParamBlockBuffer> createGpuParamBlockBufferInternal(UINT32 size,
+			GpuParamBlockUsage usage = GPBU_DYNAMIC, GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+
+		/** @copydoc HardwareBufferManager::createGpuBufferInternal */
+		SPtr<GpuBuffer> createGpuBufferInternal(const GPU_BUFFER_DESC& desc,
+			GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+	};
+
+	/** Handles creation of null command buffers. */
+	class NullCommandBufferManager : public CommandBufferManager
+	{
+	protected:
+		/** @copydoc CommandBufferManager::createInternal() */
+		SPtr<CommandBuffer> createInternal(GpuQueueType type, UINT32 deviceIdx = 0, UINT32 queueIdx = 0,
+			bool secondary = false) override;
+	};
+
+	/** Handles creation of null queries. */
+	class NullQueryManager : public QueryManager
+	{
+	public:
+		/** @copydoc QueryManager::createEventQuery */
+		SPtr<EventQuery> createEventQuery(UINT32 deviceIdx = 0) const override;
+
+		/** @copydoc QueryManager::createTimerQuery */
+		SPtr<TimerQuery> createTimerQuery(UINT32 deviceIdx = 0) const override;
+
+		/** @copydoc QueryManager::createOcclusionQuery */
+		SPtr<OcclusionQuery> createOcclusionQuery(bool binary, UINT32 deviceIdx = 0) const override;
+	};
+	}
+
+	/** @} */
+}
@@ -0,0 +1,32 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+/** @addtogroup Plugins
+ *  @{
+ */
+
+/** @defgroup NullRenderAPI bsfNullRenderAPI
+ *	Render API that doesn't talk to any GPU, used when running without a window (e.g. dedicated servers).
+ */
+
+/** @} */
+
+namespace bs
+{
+	class NullRenderWindow;
+	class NullRenderTexture;
+	class NullTextureManager;
+	class NullRenderWindowManager;
+
+	namespace ct
+	{
+	class NullRenderAPI;
+	class NullRenderWindow;
+	class NullRenderTexture;
+	class NullTexture;
+	class NullGpuProgramFactory;
+	}
+}
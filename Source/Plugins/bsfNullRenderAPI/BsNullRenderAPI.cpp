@@ -0,0 +1,142 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsNullRenderAPI.h"
+#include "BsNullManagers.h"
+#include "BsNullResources.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsGpuParamDesc.h"
+#include "RenderAPI/BsRenderAPICapabilities.h"
+#include "RenderAPI/BsVideoModeInfo.h"
+#include "Managers/BsRenderStateManager.h"
+#include "Managers/BsGpuProgramManager.h"
+#include "Math/BsMath.h"
+#include "CoreThread/BsCoreThread.h"
+
+namespace bs { namespace ct
+{
+	const StringID& NullRenderAPI::getName() const
+	{
+		static StringID strName("NullRenderAPI");
+		return strName;
+	}
+
+	void NullRenderAPI::initialize()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mVideoModeInfo = bs_shared_ptr_new<VideoModeInfo>();
+
+		mNumDevices = 1;
+		mCurrentCapabilities = bs_newN<RenderAPICapabilities>(mNumDevices);
+
+		RenderAPICapabilities& caps = mCurrentCapabilities[0];
+		caps.setRenderAPIName(getName());
+		caps.setDeviceName("Null");
+		caps.setVendor(GPU_UNKNOWN);
+		caps.addShaderProfile("hlsl");
+
+		CommandBufferManager::startUp<NullCommandBufferManager>();
+		bs::RenderWindowManager::startUp<bs::NullRenderWindowManager>();
+		RenderWindowManager::startUp();
+
+		RenderStateManager::startUp();
+		QueryManager::startUp<NullQueryManager>();
+
+		bs::HardwareBufferManager::startUp();
+		HardwareBufferManager::startUp<NullHardwareBufferManager>();
+
+		bs::TextureManager::startUp<bs::NullTextureManager>();
+		TextureManager::startUp<NullTextureManager>();
+
+		// Register the null programs under a language all built-in shaders provide, so materials have a technique
+		// to use
+		mProgramFactory = bs_new<NullGpuProgramFactory>();
+		GpuProgramManager::instance().addFactory("hlsl", mProgramFactory);
+
+		RenderAPI::initialize();
+	}
+
+	void NullRenderAPI::destroyCore()
+	{
+		RenderAPI::destroyCore();
+
+		if (mProgramFactory)
+		{
+			GpuProgramManager::instance().removeFactory("hlsl");
+
+			bs_delete(mProgramFactory);
+			mProgramFactory = nullptr;
+		}
+
+		TextureManager::shutDown();
+		bs::TextureManager::shutDown();
+		HardwareBufferManager::shutDown();
+		bs::HardwareBufferManager::shutDown();
+		QueryManager::shutDown();
+		RenderStateManager::shutDown();
+		RenderWindowManager::shutDown();
+		bs::RenderWindowManager::shutDown();
+		CommandBufferManager::shutDown();
+	}
+
+	void NullRenderAPI::setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		mActiveRenderTarget = target;
+	}
+
+	const RenderAPIInfo& NullRenderAPI::getAPIInfo() const
+	{
+		static RenderAPIInfo info(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, RenderAPIFeatures());
+
+		return info;
+	}
+
+	GpuParamBlockDesc NullRenderAPI::generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params)
+	{
+		// Lay out the block the same way as HLSL constant buffers, although no program ever reads from it
+		GpuParamBlockDesc block;
+		block.blockSize = 0;
+		block.isShareable = true;
+		block.name = name;
+		block.slot = 0;
+		block.set = 0;
+
+		for (auto& param : params)
+		{
+			const GpuParamDataTypeInfo& typeInfo = bs::GpuParams::PARAM_SIZES.lookup[param.type];
+
+			UINT32 size;
+			if (param.type == GPDT_STRUCT)
+				size = Math::divideAndRoundUp(param.elementSize, 16U) * 4;
+			else if (param.arraySize > 1)
+				size = Math::divideAndRoundUp(typeInfo.size, 16U) * 4;
+			else
+				size = typeInfo.baseTypeSize * (typeInfo.numRows * typeInfo.numColumns) / 4;
+
+			// Arrays and structs start on a four component vector boundary, other types only avoid crossing one
+			if (param.arraySize > 1 || param.type == GPDT_STRUCT)
+				block.blockSize = Math::divideAndRoundUp(block.blockSize, 4U) * 4;
+			else
+			{
+				UINT32 alignOffset = block.blockSize % 4;
+				if (alignOffset != 0 && size > (4 - alignOffset))
+					block.blockSize += 4 - alignOffset;
+			}
+
+			param.elementSize = size;
+			param.arrayElementStride = size;
+			param.cpuMemOffset = block.blockSize;
+			param.gpuMemOffset = 0;
+			param.paramBlockSlot = 0;
+			param.paramBlockSet = 0;
+
+			block.blockSize += size * std::max(param.arraySize, 1U);
+		}
+
+		// Block size must always be a multiple of four component vectors
+		block.blockSize = Math::divideAndRoundUp(block.blockSize, 4U) * 4;
+
+		return block;
+	}
+}}
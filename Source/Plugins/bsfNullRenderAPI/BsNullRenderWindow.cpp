@@ -0,0 +1,125 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsNullRenderWindow.h"
+#include "Managers/BsRenderWindowManager.h"
+#include "CoreThread/BsCoreThread.h"
+
+namespace bs
+{
+	NullRenderWindow::NullRenderWindow(const RENDER_WINDOW_DESC& desc, UINT32 windowId)
+		:RenderWindow(desc, windowId), mProperties(desc)
+	{ }
+
+	Vector2I NullRenderWindow::screenToWindowPos(const Vector2I& screenPos) const
+	{
+		return Vector2I(screenPos.x - mProperties.left, screenPos.y - mProperties.top);
+	}
+
+	Vector2I NullRenderWindow::windowToScreenPos(const Vector2I& windowPos) const
+	{
+		return Vector2I(windowPos.x + mProperties.left, windowPos.y + mProperties.top);
+	}
+
+	SPtr<ct::NullRenderWindow> NullRenderWindow::getCore() const
+	{
+		return std::static_pointer_cast<ct::NullRenderWindow>(mCoreSpecific);
+	}
+
+	void NullRenderWindow::syncProperties()
+	{
+		ScopedSpinLock lock(getCore()->mLock);
+		mProperties = getCore()->mSyncedProperties;
+	}
+
+	SPtr<ct::CoreObject> NullRenderWindow::createCore() const
+	{
+		RENDER_WINDOW_DESC desc = mDesc;
+		SPtr<ct::CoreObject> coreObj = bs_shared_ptr_new<ct::NullRenderWindow>(desc, mWindowId);
+		coreObj->_setThisPtr(coreObj);
+
+		return coreObj;
+	}
+
+	namespace ct
+	{
+	NullRenderWindow::NullRenderWindow(const RENDER_WINDOW_DESC& desc, UINT32 windowId)
+		: RenderWindow(desc, windowId), mProperties(desc), mSyncedProperties(desc)
+	{ }
+
+	void NullRenderWindow::initialize()
+	{
+		// There is no display to center on, or to go fullscreen on
+		RenderWindowProperties& props = mProperties;
+		props.left = std::max(mDesc.left, 0);
+		props.top = std::max(mDesc.top, 0);
+		props.isFullScreen = false;
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties = props;
+		}
+
+		bs::RenderWindowManager::instance().notifySyncDataDirty(this);
+		RenderWindow::initialize();
+	}
+
+	void NullRenderWindow::resize(UINT32 width, UINT32 height)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mProperties.width = width;
+		mProperties.height = height;
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties.width = width;
+			mSyncedProperties.height = height;
+		}
+
+		bs::RenderWindowManager::instance().notifySyncDataDirty(this);
+		bs::RenderWindowManager::instance().notifyMovedOrResized(this);
+	}
+
+	void NullRenderWindow::move(INT32 left, INT32 top)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mProperties.left = left;
+		mProperties.top = top;
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties.left = left;
+			mSyncedProperties.top = top;
+		}
+
+		bs::RenderWindowManager::instance().notifySyncDataDirty(this);
+		bs::RenderWindowManager::instance().notifyMovedOrResized(this);
+	}
+
+	void NullRenderWindow::setVSync(bool enabled, UINT32 interval)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if(!enabled)
+			interval = 0;
+
+		mProperties.vsync = enabled;
+		mProperties.vsyncInterval = interval;
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties.vsync = enabled;
+			mSyncedProperties.vsyncInterval = interval;
+		}
+
+		bs::RenderWindowManager::instance().notifySyncDataDirty(this);
+	}
+
+	void NullRenderWindow::syncProperties()
+	{
+		ScopedSpinLock lock(mLock);
+		mProperties = mSyncedProperties;
+	}
+	}
+}
@@ -0,0 +1,94 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "RenderAPI/BsRenderWindow.h"
+
+namespace bs
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**
+	 * Render window that has no OS window or surface backing it. Keeps track of the properties it was created with so
+	 * code querying window size or position keeps working.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class NullRenderWindow : public RenderWindow
+	{
+	public:
+		~NullRenderWindow() { }
+
+		/** @copydoc RenderWindow::screenToWindowPos */
+		Vector2I screenToWindowPos(const Vector2I& screenPos) const override;
+
+		/** @copydoc RenderWindow::windowToScreenPos */
+		Vector2I windowToScreenPos(const Vector2I& windowPos) const override;
+
+		/** @copydoc RenderWindow::getCore */
+		SPtr<ct::NullRenderWindow> getCore() const;
+
+	protected:
+		friend class NullRenderWindowManager;
+
+		NullRenderWindow(const RENDER_WINDOW_DESC& desc, UINT32 windowId);
+
+		/** @copydoc RenderWindow::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		/** @copydoc RenderWindow::syncProperties */
+		void syncProperties() override;
+
+		/** @copydoc RenderWindow::createCore */
+		SPtr<ct::CoreObject> createCore() const override;
+
+	private:
+		RenderWindowProperties mProperties;
+	};
+
+	namespace ct
+	{
+		/**
+		 * Render window that has no OS window or surface backing it.
+		 *
+		 * @note	Core thread only.
+		 */
+		class NullRenderWindow : public RenderWindow
+		{
+		public:
+			NullRenderWindow(const RENDER_WINDOW_DESC& desc, UINT32 windowId);
+
+			/** @copydoc RenderWindow::resize */
+			void resize(UINT32 width, UINT32 height) override;
+
+			/** @copydoc RenderWindow::move */
+			void move(INT32 left, INT32 top) override;
+
+			/** @copydoc RenderWindow::setVSync */
+			void setVSync(bool enabled, UINT32 interval = 1) override;
+
+		protected:
+			friend class bs::NullRenderWindow;
+
+			/** @copydoc CoreObject::initialize */
+			void initialize() override;
+
+			/** @copydoc RenderWindow::getProperties */
+			const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+			/** @copydoc RenderWindow::getSyncedProperties */
+			RenderWindowProperties& getSyncedProperties() override { return mSyncedProperties; }
+
+			/** @copydoc RenderWindow::syncProperties */
+			void syncProperties() override;
+
+			RenderWindowProperties mProperties;
+			RenderWindowProperties mSyncedProperties;
+		};
+	}
+
+	/** @} */
+}
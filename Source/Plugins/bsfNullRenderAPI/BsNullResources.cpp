@@ -0,0 +1,100 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsNullResources.h"
+#include "Image/BsPixelData.h"
+#include "Image/BsPixelUtil.h"
+#include "RenderAPI/BsGpuProgram.h"
+
+namespace bs
+{
+	NullRenderTexture::NullRenderTexture(const RENDER_TEXTURE_DESC& desc)
+		:RenderTexture(desc), mProperties(desc, false)
+	{ }
+
+	namespace ct
+	{
+	NullTexture::NullTexture(const TEXTURE_DESC& desc, const SPtr<PixelData>& initialData, GpuDeviceFlags deviceMask)
+		:Texture(desc, initialData, deviceMask)
+	{ }
+
+	NullTexture::~NullTexture()
+	{
+		if (mScratch != nullptr)
+			bs_free(mScratch);
+	}
+
+	PixelData NullTexture::lockImpl(GpuLockOptions options, UINT32 mipLevel, UINT32 face, UINT32 deviceIdx,
+		UINT32 queueIdx)
+	{
+		if (mScratch != nullptr)
+			BS_EXCEPT(InternalErrorException, "Trying to lock a buffer that's already locked.");
+
+		UINT32 mipWidth = std::max(1u, mProperties.getWidth() >> mipLevel);
+		UINT32 mipHeight = std::max(1u, mProperties.getHeight() >> mipLevel);
+		UINT32 mipDepth = std::max(1u, mProperties.getDepth() >> mipLevel);
+
+		PixelData lockedArea(mipWidth, mipHeight, mipDepth, mProperties.getFormat());
+
+		UINT32 size = lockedArea.getSize();
+		mScratch = (UINT8*)bs_alloc(size);
+		memset(mScratch, 0, size);
+
+		lockedArea.setExternalBuffer(mScratch);
+		return lockedArea;
+	}
+
+	void NullTexture::unlockImpl()
+	{
+		bs_free(mScratch);
+		mScratch = nullptr;
+	}
+
+	void NullTexture::readDataImpl(PixelData& dest, UINT32 mipLevel, UINT32 face, UINT32 deviceIdx, UINT32 queueIdx)
+	{
+		memset(dest.getData(), 0, dest.getSize());
+	}
+
+	NullRenderTexture::NullRenderTexture(const RENDER_TEXTURE_DESC& desc, UINT32 deviceIdx)
+		:RenderTexture(desc, deviceIdx), mProperties(desc, false)
+	{ }
+
+	/** GPU program without any code or parameters. */
+	class NullGpuProgram : public GpuProgram
+	{
+	public:
+		NullGpuProgram(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
+			:GpuProgram(desc, deviceMask)
+		{ }
+
+		void initialize() override
+		{
+			mIsCompiled = true;
+			GpuProgram::initialize();
+		}
+	};
+
+	SPtr<GpuProgram> NullGpuProgramFactory::create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
+	{
+		SPtr<NullGpuProgram> program = bs_shared_ptr_new<NullGpuProgram>(desc, deviceMask);
+		program->_setThisPtr(program);
+
+		return program;
+	}
+
+	SPtr<GpuProgram> NullGpuProgramFactory::create(GpuProgramType type, GpuDeviceFlags deviceMask)
+	{
+		GPU_PROGRAM_DESC desc;
+		desc.type = type;
+
+		return create(desc, deviceMask);
+	}
+
+	SPtr<GpuProgramBytecode> NullGpuProgramFactory::compileBytecode(const GPU_PROGRAM_DESC& desc)
+	{
+		SPtr<GpuProgramBytecode> bytecode = bs_shared_ptr_new<GpuProgramBytecode>();
+		bytecode->compilerId = "Null";
+
+		return bytecode;
+	}
+	}
+}
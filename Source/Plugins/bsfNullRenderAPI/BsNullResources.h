@@ -0,0 +1,252 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsIndexBuffer.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "RenderAPI/BsRenderTexture.h"
+#include "RenderAPI/BsCommandBuffer.h"
+#include "RenderAPI/BsEventQuery.h"
+#include "RenderAPI/BsTimerQuery.h"
+#include "RenderAPI/BsOcclusionQuery.h"
+#include "Managers/BsGpuProgramManager.h"
+#include "Image/BsTexture.h"
+
+namespace bs
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** Render texture that doesn't own any GPU surfaces. */
+	class NullRenderTexture : public RenderTexture
+	{
+	public:
+		virtual ~NullRenderTexture() { }
+
+	protected:
+		friend class NullTextureManager;
+
+		NullRenderTexture(const RENDER_TEXTURE_DESC& desc);
+
+		/** @copydoc RenderTexture::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		RenderTextureProperties mProperties;
+	};
+
+	/** @} */
+
+	namespace ct
+	{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**
+	 * Implements the hardware buffer interface for a buffer type without storing any of the buffer's contents. Writes
+	 * are discarded and reads return zeroes. Locking the buffer returns scratch memory that is released on unlock.
+	 */
+	template<class Base>
+	class TNullHardwareBuffer : public Base
+	{
+	public:
+		template<class... Args>
+		TNullHardwareBuffer(Args&&... args)
+			:Base(std::forward<Args>(args)...)
+		{ }
+
+		~TNullHardwareBuffer()
+		{
+			if (mScratch != nullptr)
+				bs_free(mScratch);
+		}
+
+		/** @copydoc HardwareBuffer::readData */
+		void readData(UINT32 offset, UINT32 length, void* dest, UINT32 deviceIdx = 0, UINT32 queueIdx = 0) override
+		{
+			memset(dest, 0, length);
+		}
+
+		/** @copydoc HardwareBuffer::writeData */
+		void writeData(UINT32 offset, UINT32 length, const void* source,
+			BufferWriteType writeFlags = BWT_NORMAL, UINT32 queueIdx = 0) override { }
+
+		/** @copydoc HardwareBuffer::copyData */
+		void copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length,
+			bool discardWholeBuffer = false, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+
+	protected:
+		/** @copydoc HardwareBuffer::map */
+		void* map(UINT32 offset, UINT32 length, GpuLockOptions options, UINT32 deviceIdx, UINT32 queueIdx) override
+		{
+			mScratch = (UINT8*)bs_alloc(length);
+			memset(mScratch, 0, length);
+
+			return mScratch;
+		}
+
+		/** @copydoc HardwareBuffer::unmap */
+		void unmap() override
+		{
+			bs_free(mScratch);
+			mScratch = nullptr;
+		}
+
+		UINT8* mScratch = nullptr;
+	};
+
+	/** Vertex buffer that doesn't allocate any GPU memory. */
+	using NullVertexBuffer = TNullHardwareBuffer<VertexBuffer>;
+
+	/** Index buffer that doesn't allocate any GPU memory. */
+	using NullIndexBuffer = TNullHardwareBuffer<IndexBuffer>;
+
+	/** Generic GPU buffer that doesn't allocate any GPU memory. */
+	class NullGpuBuffer : public TNullHardwareBuffer<GpuBuffer>
+	{
+	public:
+		NullGpuBuffer(const GPU_BUFFER_DESC& desc, GpuDeviceFlags deviceMask)
+			:TNullHardwareBuffer<GpuBuffer>(desc, deviceMask)
+		{ }
+	};
+
+	/** Parameter block buffer that keeps its contents on the CPU only. */
+	class NullGpuParamBlockBuffer : public GpuParamBlockBuffer
+	{
+	public:
+		NullGpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask)
+			:GpuParamBlockBuffer(size, usage, deviceMask)
+		{ }
+
+		/** @copydoc GpuParamBlockBuffer::writeToGPU */
+		void writeToGPU(const UINT8* data, UINT32 queueIdx = 0) override { }
+	};
+
+	/** Texture that doesn't allocate any GPU memory. Writes are discarded and reads return zeroes. */
+	class NullTexture : public Texture
+	{
+	public:
+		~NullTexture();
+
+	protected:
+		friend class NullTextureManager;
+
+		NullTexture(const TEXTURE_DESC& desc, const SPtr<PixelData>& initialData, GpuDeviceFlags deviceMask);
+
+		/** @copydoc Texture::lockImpl */
+		PixelData lockImpl(GpuLockOptions options, UINT32 mipLevel = 0, UINT32 face = 0, UINT32 deviceIdx = 0,
+			UINT32 queueIdx = 0) override;
+
+		/** @copydoc Texture::unlockImpl */
+		void unlockImpl() override;
+
+		/** @copydoc Texture::copyImpl */
+		void copyImpl(const SPtr<Texture>& target, const TEXTURE_COPY_DESC& desc,
+			const SPtr<CommandBuffer>& commandBuffer) override { }
+
+		/** @copydoc Texture::readDataImpl */
+		void readDataImpl(PixelData& dest, UINT32 mipLevel = 0, UINT32 face = 0, UINT32 deviceIdx = 0,
+			UINT32 queueIdx = 0) override;
+
+		/** @copydoc Texture::writeDataImpl */
+		void writeDataImpl(const PixelData& src, UINT32 mipLevel = 0, UINT32 face = 0,
+			bool discardWholeBuffer = false, UINT32 queueIdx = 0) override { }
+
+		UINT8* mScratch = nullptr;
+	};
+
+	/** Render texture that doesn't own any GPU surfaces. */
+	class NullRenderTexture : public RenderTexture
+	{
+	public:
+		NullRenderTexture(const RENDER_TEXTURE_DESC& desc, UINT32 deviceIdx);
+
+	protected:
+		/** @copydoc RenderTexture::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		RenderTextureProperties mProperties;
+	};
+
+	/** Command buffer that ignores all commands queued on it. */
+	class NullCommandBuffer : public CommandBuffer
+	{
+	public:
+		NullCommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary)
+			:CommandBuffer(type, deviceIdx, queueIdx, secondary)
+		{ }
+	};
+
+	/** Event query that is always immediately ready. */
+	class NullEventQuery : public EventQuery
+	{
+	public:
+		/** @copydoc EventQuery::begin */
+		void begin(const SPtr<CommandBuffer>& cb = nullptr) override { setActive(true); }
+
+		/** @copydoc EventQuery::isReady */
+		bool isReady() const override { return true; }
+	};
+
+	/** Timer query that is always immediately ready, and always reports zero elapsed time. */
+	class NullTimerQuery : public TimerQuery
+	{
+	public:
+		/** @copydoc TimerQuery::begin */
+		void begin(const SPtr<CommandBuffer>& cb = nullptr) override { setActive(true); }
+
+		/** @copydoc TimerQuery::end */
+		void end(const SPtr<CommandBuffer>& cb = nullptr) override { }
+
+		/** @copydoc TimerQuery::isReady */
+		bool isReady() const override { return true; }
+
+		/** @copydoc TimerQuery::getTimeMs */
+		float getTimeMs() override { return 0.0f; }
+	};
+
+	/** Occlusion query that is always immediately ready, and always reports no visible samples. */
+	class NullOcclusionQuery : public OcclusionQuery
+	{
+	public:
+		NullOcclusionQuery(bool binary)
+			:OcclusionQuery(binary)
+		{ }
+
+		/** @copydoc OcclusionQuery::begin */
+		void begin(const SPtr<CommandBuffer>& cb = nullptr) override { setActive(true); }
+
+		/** @copydoc OcclusionQuery::end */
+		void end(const SPtr<CommandBuffer>& cb = nullptr) override { }
+
+		/** @copydoc OcclusionQuery::isReady */
+		bool isReady() const override { return true; }
+
+		/** @copydoc OcclusionQuery::getNumSamples */
+		UINT32 getNumSamples() override { return 0; }
+	};
+
+	/**
+	 * Creates GPU programs that report themselves as compiled, but contain no code and no parameters. Allows materials
+	 * to find a supported technique without compiling any shader code.
+	 */
+	class NullGpuProgramFactory : public GpuProgramFactory
+	{
+	public:
+		/** @copydoc GpuProgramFactory::create(const GPU_PROGRAM_DESC&, GpuDeviceFlags) */
+		SPtr<GpuProgram> create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+
+		/** @copydoc GpuProgramFactory::create(GpuProgramType, GpuDeviceFlags) */
+		SPtr<GpuProgram> create(GpuProgramType type, GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+
+		/** @copydoc GpuProgramFactory::compileBytecode(const GPU_PROGRAM_DESC&) */
+		SPtr<GpuProgramBytecode> compileBytecode(const GPU_PROGRAM_DESC& desc) override;
+	};
+
+	/** @} */
+	}
+}
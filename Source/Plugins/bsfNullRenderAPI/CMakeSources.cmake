@@ -0,0 +1,24 @@
+set(BS_NULLRENDERAPI_INC_NOFILTER
+	"BsNullPrerequisites.h"
+	"BsNullRenderAPI.h"
+	"BsNullRenderAPIFactory.h"
+	"BsNullManagers.h"
+	"BsNullResources.h"
+	"BsNullRenderWindow.h"
+)
+
+set(BS_NULLRENDERAPI_SRC_NOFILTER
+	"BsNullPlugin.cpp"
+	"BsNullRenderAPI.cpp"
+	"BsNullRenderAPIFactory.cpp"
+	"BsNullManagers.cpp"
+	"BsNullResources.cpp"
+	"BsNullRenderWindow.cpp"
+)
+
+source_group("" FILES ${BS_NULLRENDERAPI_INC_NOFILTER} ${BS_NULLRENDERAPI_SRC_NOFILTER})
+
+set(BS_NULLRENDERAPI_SRC
+	${BS_NULLRENDERAPI_INC_NOFILTER}
+	${BS_NULLRENDERAPI_SRC_NOFILTER}
+)
\ No newline at end of file
@@ -0,0 +1,28 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsNullRenderer.h"
+
+namespace bs
+{
+	namespace ct
+	{
+	const StringID& NullRenderer::getName() const
+	{
+		static StringID name = "NullRenderer";
+		return name;
+	}
+	}
+
+	constexpr const char* NullRendererFactory::SystemName;
+
+	SPtr<ct::Renderer> NullRendererFactory::create()
+	{
+		return bs_shared_ptr_new<ct::NullRenderer>();
+	}
+
+	const String& NullRendererFactory::name() const
+	{
+		static String StrSystemName = SystemName;
+		return StrSystemName;
+	}
+}
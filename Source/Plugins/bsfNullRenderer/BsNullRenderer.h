@@ -0,0 +1,60 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Renderer/BsRenderer.h"
+#include "Renderer/BsRendererFactory.h"
+
+/** @addtogroup Plugins
+ *  @{
+ */
+
+/** @defgroup NullRenderer bsfNullRenderer
+ *	Renderer that doesn't render anything, used when running without a window (e.g. dedicated servers).
+ */
+
+/** @} */
+
+namespace bs
+{
+	/** @addtogroup NullRenderer
+	 *  @{
+	 */
+
+	namespace ct
+	{
+	/**
+	 * Renderer that ignores all scene objects and never renders anything. Render callbacks and renderer tasks are
+	 * still processed.
+	 */
+	class NullRenderer : public Renderer
+	{
+	public:
+		/** @copydoc Renderer::getName */
+		const StringID& getName() const override;
+
+		/** @copydoc Renderer::renderAll */
+		void renderAll(const EvaluatedAnimationData* animData) override { }
+
+		/** @copydoc Renderer::captureSceneCubeMap */
+		void captureSceneCubeMap(const SPtr<Texture>& cubemap, const Vector3& position,
+			const CaptureSettings& settings) override { }
+	};
+	}
+
+	/** Creates the null renderer. Used by the RendererManager. */
+	class NullRendererFactory : public RendererFactory
+	{
+	public:
+		static constexpr const char* SystemName = "bsfNullRenderer";
+
+		/** @copydoc RendererFactory::create */
+		SPtr<ct::Renderer> create() override;
+
+		/** @copydoc RendererFactory::name */
+		const String& name() const override;
+	};
+
+	/** @} */
+}
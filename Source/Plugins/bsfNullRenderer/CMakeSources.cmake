@@ -0,0 +1,15 @@
+set(BS_NULLRENDERER_INC_NOFILTER
+	"BsNullRenderer.h"
+)
+
+set(BS_NULLRENDERER_SRC_NOFILTER
+	"BsNullRenderer.cpp"
+	"BsNullRendererPlugin.cpp"
+)
+
+source_group("" FILES ${BS_NULLRENDERER_INC_NOFILTER} ${BS_NULLRENDERER_SRC_NOFILTER})
+
+set(BS_NULLRENDERER_SRC
+	${BS_NULLRENDERER_INC_NOFILTER}
+	${BS_NULLRENDERER_SRC_NOFILTER}
+)
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "Math/BsMath.h"
 #include "Threading/BsTaskScheduler.h"
 #include "Audio/BsAudioUtility.h"
+#include "Utility/BsTime.h"
 #include "AL/al.h"
 
 namespace bs
@@ -103,6 +104,8 @@ namespace bs
 
 	void OAAudio::_update()
 	{
+		updateVoices();
+
 		auto worker = [this]() { updateStreaming(); };
 
 		// If previous task still hasn't completed, just skip streaming this frame, queuing more tasks won't help
@@ -170,6 +173,10 @@ namespace bs
 	void OAAudio::_unregisterSource(OAAudioSource* source)
 	{
 		mSources.erase(source);
+
+		// The streaming task might still be decoding data for the source on a worker thread
+		if (mStreamingTask != nullptr && !mStreamingTask->isComplete())
+			mStreamingTask->wait();
 	}
 
 	void OAAudio::startStreaming(OAAudioSource* source)
@@ -188,6 +195,80 @@ namespace bs
 		mDestroyedSources.insert(source);
 	}
 
+	void OAAudio::setDecodedClipCacheBudget(UINT64 bytes)
+	{
+		Lock lock(mClipCacheMutex);
+
+		mClipCacheBudget = bytes;
+		trimClipCache();
+	}
+
+	UINT64 OAAudio::getDecodedClipCacheBudget() const
+	{
+		Lock lock(mClipCacheMutex);
+		return mClipCacheBudget;
+	}
+
+	SPtr<Vector<UINT8>> OAAudio::_getCachedSamples(const OAAudioClip* clip)
+	{
+		Lock lock(mClipCacheMutex);
+
+		auto iterFind = mClipCacheLookup.find(clip);
+		if (iterFind == mClipCacheLookup.end())
+			return nullptr;
+
+		// Move to front, as the most recently used entry
+		mClipCache.splice(mClipCache.begin(), mClipCache, iterFind->second);
+		return iterFind->second->second;
+	}
+
+	bool OAAudio::_addCachedSamples(const OAAudioClip* clip, const SPtr<Vector<UINT8>>& samples)
+	{
+		Lock lock(mClipCacheMutex);
+
+		if (samples->size() > mClipCacheBudget)
+			return false;
+
+		auto iterFind = mClipCacheLookup.find(clip);
+		if (iterFind != mClipCacheLookup.end())
+		{
+			mClipCacheSize -= iterFind->second->second->size();
+			mClipCache.erase(iterFind->second);
+		}
+
+		mClipCache.push_front(std::make_pair(clip, samples));
+		mClipCacheLookup[clip] = mClipCache.begin();
+		mClipCacheSize += samples->size();
+
+		trimClipCache();
+		return true;
+	}
+
+	void OAAudio::_removeCachedSamples(const OAAudioClip* clip)
+	{
+		Lock lock(mClipCacheMutex);
+
+		auto iterFind = mClipCacheLookup.find(clip);
+		if (iterFind == mClipCacheLookup.end())
+			return;
+
+		mClipCacheSize -= iterFind->second->second->size();
+		mClipCache.erase(iterFind->second);
+		mClipCacheLookup.erase(iterFind);
+	}
+
+	void OAAudio::trimClipCache()
+	{
+		while (mClipCacheSize > mClipCacheBudget && !mClipCache.empty())
+		{
+			const CachedClip& entry = mClipCache.back();
+
+			mClipCacheSize -= entry.second->size();
+			mClipCacheLookup.erase(entry.first);
+			mClipCache.pop_back();
+		}
+	}
+
 	ALCcontext* OAAudio::_getContext(const OAAudioListener* listener) const
 	{
 		if (mListeners.size() > 0)
@@ -288,6 +369,8 @@ namespace bs
 			mDestroyedSources.clear();
 		}
 
+		// Queue the data decoded during the previous update first, so sources close to running out don't wait on decoding
+		mDecodeQueue.clear();
 		for (auto& source : mStreamingSources)
 		{
 			// Check if the source got destroyed while streaming
@@ -300,7 +383,97 @@ namespace bs
 			}
 
 			source->stream();
+			mDecodeQueue.push_back(std::make_pair(source->getStreamDeadline(), source));
+		}
+
+		// Decode the sources that are closest to running out of data first. Workers pick up sources in order, so this 
+		// ensures the most urgent ones don't wait behind the others.
+		std::sort(mDecodeQueue.begin(), mDecodeQueue.end(),
+			[](const std::pair<float, OAAudioSource*>& a, const std::pair<float, OAAudioSource*>& b)
+		{
+			return a.first < b.first;
+		});
+
+		const UINT32 decodeAhead = mDecodeAhead;
+		auto decode = [this, decodeAhead](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+				mDecodeQueue[i].second->decodeAhead(decodeAhead);
+		};
+
+		const UINT32 numSources = (UINT32)mDecodeQueue.size();
+		if (numSources > 1)
+			TaskScheduler::instance().parallelFor(0, numSources, 1, decode, TaskPriority::VeryHigh);
+		else
+			decode(0, numSources);
+	}
+
+	void OAAudio::updateVoices()
+	{
+		// Nothing is audible while paused, and the virtual sources shouldn't advance
+		if (mIsPaused)
+			return;
+
+		const float frameDelta = gTime().getFrameDelta();
+
+		mVoiceCandidates.clear();
+		for (auto& source : mSources)
+		{
+			source->advanceVirtual(frameDelta);
+
+			// Paused sources keep their current state until resumed
+			if (source->getState() != AudioSourceState::Playing)
+				continue;
+
+			mVoiceCandidates.push_back({ source->getPriority(), getAudibility(source), source });
 		}
+
+		const UINT32 numCandidates = (UINT32)mVoiceCandidates.size();
+		const UINT32 numVoices = mMaxVoices > 0 ? std::min(mMaxVoices, numCandidates) : numCandidates;
+
+		// Only need to find the set of sources that get the voices, not their order
+		if (numVoices < numCandidates)
+		{
+			std::nth_element(mVoiceCandidates.begin(), mVoiceCandidates.begin() + numVoices, mVoiceCandidates.end(),
+				[](const VoiceCandidate& a, const VoiceCandidate& b)
+			{
+				if (a.priority != b.priority)
+					return a.priority > b.priority;
+
+				return a.audibility > b.audibility;
+			});
+		}
+
+		mNumVirtualVoices = numCandidates - numVoices;
+		for (UINT32 i = 0; i < numCandidates; i++)
+		{
+			OAAudioSource* source = mVoiceCandidates[i].source;
+
+			const bool isVirtual = i >= numVoices;
+			if (source->isVirtual() != isVirtual)
+				source->setVirtual(isVirtual);
+		}
+	}
+
+	float OAAudio::getAudibility(const OAAudioSource* source) const
+	{
+		const float volume = source->getVolume();
+		if (!source->is3D() || mListeners.empty())
+			return volume;
+
+		const Vector3 position = source->getTransform().getPosition();
+
+		float minDistanceSqrd = std::numeric_limits<float>::max();
+		for (auto& listener : mListeners)
+			minDistanceSqrd = std::min(minDistanceSqrd, position.squaredDistance(listener->getTransform().getPosition()));
+
+		// Matches the inverse distance clamped model used by OpenAL
+		const float distance = std::sqrt(minDistanceSqrd);
+		const float refDistance = source->getMinDistance();
+		if (distance <= refDistance)
+			return volume;
+
+		return volume * refDistance / (refDistance + source->getAttenuation() * (distance - refDistance));
 	}
 
 	ALenum OAAudio::_getOpenALBufferFormat(UINT32 numChannels, UINT32 bitDepth)
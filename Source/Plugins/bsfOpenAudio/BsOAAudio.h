@@ -46,6 +46,30 @@ namespace bs
 		/** @copydoc Audio::getAllDevices */
 		const Vector<AudioDevice>& getAllDevices() const override { return mAllDevices; };
 
+		/** @copydoc Audio::setMaxVoices */
+		void setMaxVoices(UINT32 count) override { mMaxVoices = count; }
+
+		/** @copydoc Audio::getMaxVoices */
+		UINT32 getMaxVoices() const override { return mMaxVoices; }
+
+		/** @copydoc Audio::getNumVirtualVoices */
+		UINT32 getNumVirtualVoices() const override { return mNumVirtualVoices; }
+
+		/** @copydoc Audio::setStreamingDecodeAhead */
+		void setStreamingDecodeAhead(UINT32 numBlocks) override { mDecodeAhead = std::max(numBlocks, 1U); }
+
+		/** @copydoc Audio::getStreamingDecodeAhead */
+		UINT32 getStreamingDecodeAhead() const override { return mDecodeAhead; }
+
+		/** @copydoc Audio::setDecodedClipCacheBudget */
+		void setDecodedClipCacheBudget(UINT64 bytes) override;
+
+		/** @copydoc Audio::getDecodedClipCacheBudget */
+		UINT64 getDecodedClipCacheBudget() const override;
+
+		/** @copydoc Audio::getNumStreamingUnderruns */
+		UINT64 getNumStreamingUnderruns() const override { return mNumUnderruns.load(std::memory_order_relaxed); }
+
 		/** @name Internal 
 		 *  @{
 		 */
@@ -83,6 +107,24 @@ namespace bs
 		 */
 		void _writeToOpenALBuffer(UINT32 bufferId, UINT8* samples, const AudioDataInfo& info);
 
+		/** 
+		 * Returns the decoded samples of the provided clip from the decoded clip cache, and marks them as most recently
+		 * used. Returns null if the clip isn't in the cache. Thread safe.
+		 */
+		SPtr<Vector<UINT8>> _getCachedSamples(const OAAudioClip* clip);
+
+		/** 
+		 * Adds decoded samples of the provided clip to the decoded clip cache, evicting the least recently used entries
+		 * as needed to stay within the budget. Returns false if the samples don't fit in the budget. Thread safe.
+		 */
+		bool _addCachedSamples(const OAAudioClip* clip, const SPtr<Vector<UINT8>>& samples);
+
+		/** Removes the decoded samples of the provided clip from the decoded clip cache, if present. Thread safe. */
+		void _removeCachedSamples(const OAAudioClip* clip);
+
+		/** Notifies the system that a streaming source ran out of data before new data could be queued. */
+		void _notifyStreamingUnderrun() { mNumUnderruns.fetch_add(1, std::memory_order_relaxed); }
+
 		/** @} */
 
 	private:
@@ -123,7 +165,10 @@ namespace bs
 		/** Delete all existing OpenAL contexts. */
 		void clearContexts();
 
-		/** Streams new data to audio sources that require it. */
+		/** 
+		 * Streams new data to audio sources that require it, and then decodes data ahead of playback for all streaming
+		 * sources in parallel.
+		 */
 		void updateStreaming();
 
 		/** Starts data streaming for the provided source. */
@@ -132,6 +177,18 @@ namespace bs
 		/** Stops data streaming for the provided source. */
 		void stopStreaming(OAAudioSource* source);
 
+		/** 
+		 * Advances the playback position of virtual sources, and ranks all playing sources by priority and audibility in
+		 * order to decide which sources are played as real voices, and which ones are virtual.
+		 */
+		void updateVoices();
+
+		/** Estimates how loud the source is at the nearest listener, accounting for its volume and distance attenuation. */
+		float getAudibility(const OAAudioSource* source) const;
+
+		/** Evicts least recently used entries from the decoded clip cache until it fits the budget. Caller must lock. */
+		void trimClipCache();
+
 		float mVolume = 1.0f;
 		bool mIsPaused = false;
 
@@ -150,6 +207,32 @@ namespace bs
 		UnorderedSet<OAAudioSource*> mDestroyedSources;
 		SPtr<Task> mStreamingTask;
 		mutable Mutex mMutex;
+
+		Vector<std::pair<float, OAAudioSource*>> mDecodeQueue;
+		UINT32 mDecodeAhead = 2;
+		std::atomic<UINT64> mNumUnderruns{0};
+
+		// Voice virtualization
+		/** Playing source considered for one of the available voices. */
+		struct VoiceCandidate
+		{
+			INT32 priority;
+			float audibility;
+			OAAudioSource* source;
+		};
+
+		Vector<VoiceCandidate> mVoiceCandidates;
+		UINT32 mMaxVoices = 128;
+		UINT32 mNumVirtualVoices = 0;
+
+		// Decoded clip cache
+		typedef std::pair<const OAAudioClip*, SPtr<Vector<UINT8>>> CachedClip;
+
+		List<CachedClip> mClipCache; // Most recently used first
+		UnorderedMap<const OAAudioClip*, List<CachedClip>::iterator> mClipCacheLookup;
+		UINT64 mClipCacheSize = 0;
+		UINT64 mClipCacheBudget = 8 * 1024 * 1024;
+		mutable Mutex mClipCacheMutex;
 	};
 
 	/** Provides easier access to OAAudio. */
@@ -15,6 +15,8 @@ namespace bs
 
 	OAAudioClip::~OAAudioClip()
 	{
+		gOAAudio()._removeCachedSamples(this);
+
 		if (mBufferId != (UINT32)-1)
 			alDeleteBuffers(1, &mBufferId);
 	}
@@ -140,8 +142,33 @@ namespace bs
 		{
 			if (mNeedsDecompression)
 			{
-				mVorbisReader.seek(offset);
-				mVorbisReader.read(samples, count);
+				UINT32 bytesPerSample = mDesc.bitDepth / 8;
+
+				// Clips loaded compressed are usually short and played often, so decode them whole once and keep the
+				// result in a cache, so that playing them again is only a copy
+				SPtr<Vector<UINT8>> decodedSamples = gOAAudio()._getCachedSamples(this);
+				if (decodedSamples == nullptr && mDesc.readMode == AudioReadMode::LoadCompressed)
+				{
+					UINT64 decodedSize = (UINT64)mNumSamples * bytesPerSample;
+					if (decodedSize <= gOAAudio().getDecodedClipCacheBudget())
+					{
+						decodedSamples = bs_shared_ptr_new<Vector<UINT8>>((size_t)decodedSize);
+
+						mVorbisReader.seek(0);
+						mVorbisReader.read(decodedSamples->data(), mNumSamples);
+
+						if (!gOAAudio()._addCachedSamples(this, decodedSamples))
+							decodedSamples = nullptr;
+					}
+				}
+
+				if (decodedSamples != nullptr)
+					memcpy(samples, decodedSamples->data() + offset * bytesPerSample, count * bytesPerSample);
+				else
+				{
+					mVorbisReader.seek(offset);
+					mVorbisReader.read(samples, count);
+				}
 			}
 			else
 			{
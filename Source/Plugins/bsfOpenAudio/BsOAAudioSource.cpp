@@ -161,6 +161,13 @@ namespace bs
 		if (mGloballyPaused)
 			return;
 
+		// Virtual sources get resumed by OAAudio once they're audible again
+		if (isVirtual())
+		{
+			mVirtualState = AudioSourceState::Playing;
+			return;
+		}
+
 		if(requiresStreaming())
 		{
 			Lock lock(mMutex);
@@ -192,6 +199,12 @@ namespace bs
 
 	void OAAudioSource::pause()
 	{
+		if (isVirtual())
+		{
+			mVirtualState = AudioSourceState::Paused;
+			return;
+		}
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -205,6 +218,9 @@ namespace bs
 
 	void OAAudioSource::stop()
 	{
+		mVirtualState = AudioSourceState::Stopped;
+		mVirtualTime = 0.0f;
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -234,6 +250,10 @@ namespace bs
 
 		mGloballyPaused = pause;
 
+		// Virtual sources aren't playing anything, and OAAudio doesn't advance them while globally paused
+		if (isVirtual())
+			return;
+
 		if (getState() == AudioSourceState::Playing)
 		{
 			if (pause)
@@ -260,6 +280,12 @@ namespace bs
 		if (!mAudioClip.isLoaded())
 			return;
 
+		if (isVirtual())
+		{
+			mVirtualTime = time;
+			return;
+		}
+
 		AudioSourceState state = getState();
 		stop();
 
@@ -301,6 +327,9 @@ namespace bs
 
 	float OAAudioSource::getTime() const
 	{
+		if (isVirtual())
+			return mVirtualTime;
+
 		Lock lock(mMutex);
 
 		auto& contexts = gOAAudio()._getContexts();
@@ -329,6 +358,9 @@ namespace bs
 
 	AudioSourceState OAAudioSource::getState() const
 	{
+		if (isVirtual())
+			return mVirtualState;
+
 		ALint state;
 		alGetSourcei(mSourceIDs[0], AL_SOURCE_STATE, &state);
 
@@ -442,6 +474,56 @@ namespace bs
 			pause();
 	}
 
+	void OAAudioSource::setVirtual(bool isVirtual)
+	{
+		if (isVirtual)
+		{
+			if (this->isVirtual())
+				return;
+
+			AudioSourceState state = getState();
+			float time = getTime();
+
+			stop();
+
+			mVirtualState = state;
+			mVirtualTime = time;
+		}
+		else
+		{
+			if (!this->isVirtual())
+				return;
+
+			AudioSourceState state = mVirtualState;
+			float time = mVirtualTime;
+
+			mVirtualState = AudioSourceState::Stopped;
+
+			setTime(time);
+			play();
+
+			if (state == AudioSourceState::Paused)
+				pause();
+		}
+	}
+
+	void OAAudioSource::advanceVirtual(float delta)
+	{
+		if (mVirtualState != AudioSourceState::Playing)
+			return;
+
+		mVirtualTime += delta * mPitch;
+
+		float length = mAudioClip.isLoaded() ? mAudioClip->getLength() : 0.0f;
+		if (mVirtualTime < length)
+			return;
+
+		if (mLoop && length > 0.0f)
+			mVirtualTime = std::fmod(mVirtualTime, length);
+		else
+			stop();
+	}
+
 	void OAAudioSource::startStreaming()
 	{
 		assert(!mIsStreaming);
@@ -450,6 +532,8 @@ namespace bs
 		gOAAudio().startStreaming(this);
 
 		memset(&mBusyBuffers, 0, sizeof(mBusyBuffers));
+		mNumBufferedSamples = 0;
+		mHasQueuedData = false;
 		mIsStreaming = true;
 	}
 
@@ -476,6 +560,12 @@ namespace bs
 		}
 
 		alDeleteBuffers(StreamBufferCount, mStreamBuffers);
+
+		// Keep the sample buffers around for reuse
+		for (auto& block : mDecodedBlocks)
+			mFreeBlockBuffers.push_back(std::move(block.samples));
+
+		mDecodedBlocks.clear();
 	}
 
 	void OAAudioSource::stream()
@@ -546,7 +636,10 @@ namespace bs
 				else
 				{
 					UINT32 bytesPerSample = bufferBits / 8;
-					mStreamProcessedPosition += bufferSize / bytesPerSample;
+					UINT32 numProcessedSamples = bufferSize / bytesPerSample;
+
+					mStreamProcessedPosition += numProcessedSamples;
+					mNumBufferedSamples -= std::min(mNumBufferedSamples, numProcessedSamples);
 				}
 
 				if (mStreamProcessedPosition == totalNumSamples) // Reached the end
@@ -562,6 +655,14 @@ namespace bs
 			}
 		}
 
+		// If all the buffers were played out before new ones could be queued, the source ran dry and OpenAL stopped it
+		bool underrun = mHasQueuedData;
+		for (UINT32 i = 0; i < StreamBufferCount; i++)
+		{
+			if (mBusyBuffers[i] != 0)
+				underrun = false;
+		}
+
 		for(UINT32 i = 0; i < StreamBufferCount; i++)
 		{
 			if (mBusyBuffers[i] != 0)
@@ -573,14 +674,54 @@ namespace bs
 					alSourceQueueBuffers(source, 1, &mStreamBuffers[i]);
 
 				mBusyBuffers[i] |= 1 << i;
+				mHasQueuedData = true;
 			}
 			else
 				break;
 		}
+
+		if (underrun)
+		{
+			gOAAudio()._notifyStreamingUnderrun();
+
+			// Resume playback now that new data is queued
+			for (UINT32 i = 0; i < numContexts; i++)
+			{
+				if (contexts.size() > 1)
+					alcMakeContextCurrent(contexts[i]);
+
+				alSourcePlay(mSourceIDs[i]);
+
+				// Non-3D clips only play on a single source, see play()
+				if (!is3D())
+					break;
+			}
+		}
 	}
 
 	bool OAAudioSource::fillBuffer(UINT32 buffer, AudioDataInfo& info, UINT32 maxNumSamples)
 	{
+		// Data is normally decoded ahead of time on a worker thread, but if it's late decode it here
+		if (mDecodedBlocks.empty())
+		{
+			if (!decodeBlock())
+				return false;
+		}
+
+		DecodedBlock& block = mDecodedBlocks.front();
+
+		info.numSamples = block.numSamples;
+		gOAAudio()._writeToOpenALBuffer(buffer, block.samples.data(), info);
+
+		mFreeBlockBuffers.push_back(std::move(block.samples));
+		mDecodedBlocks.pop_front();
+
+		return true;
+	}
+
+	bool OAAudioSource::decodeBlock()
+	{
+		UINT32 maxNumSamples = mAudioClip->getNumSamples();
 		UINT32 numRemainingSamples = maxNumSamples - mStreamQueuedPosition;
 		if (numRemainingSamples == 0) // Reached the end
 		{
@@ -594,22 +735,56 @@ namespace bs
 		}
 
 		// Read audio data
-		UINT32 numSamples = std::min(numRemainingSamples, info.sampleRate * info.numChannels); // 1 second of data
-		UINT32 sampleBufferSize = numSamples * (info.bitDepth / 8);
+		UINT32 samplesPerSecond = mAudioClip->getFrequency() * mAudioClip->getNumChannels();
+		UINT32 numSamples = std::min(numRemainingSamples, samplesPerSecond); // 1 second of data
+		UINT32 sampleBufferSize = numSamples * (mAudioClip->getBitDepth() / 8);
+
+		DecodedBlock block;
+		if (!mFreeBlockBuffers.empty())
+		{
+			block.samples = std::move(mFreeBlockBuffers.back());
+			mFreeBlockBuffers.pop_back();
+		}
 
-		UINT8* samples = (UINT8*)bs_stack_alloc(sampleBufferSize);
+		block.samples.resize(sampleBufferSize);
+		block.numSamples = numSamples;
 
 		OAAudioClip* audioClip = static_cast<OAAudioClip*>(mAudioClip.get());
 
-		audioClip->getSamples(samples, mStreamQueuedPosition, numSamples);
+		audioClip->getSamples(block.samples.data(), mStreamQueuedPosition, numSamples);
 		mStreamQueuedPosition += numSamples;
+		mNumBufferedSamples += numSamples;
+
+		mDecodedBlocks.push_back(std::move(block));
+		return true;
+	}
 
-		info.numSamples = numSamples;
-		gOAAudio()._writeToOpenALBuffer(buffer, samples, info);
+	void OAAudioSource::decodeAhead(UINT32 maxBlocks)
+	{
+		Lock lock(mMutex);
 
-		bs_stack_free(samples);
+		if (!mIsStreaming || !mAudioClip.isLoaded())
+			return;
 
-		return true;
+		while (mDecodedBlocks.size() < maxBlocks)
+		{
+			if (!decodeBlock())
+				break;
+		}
+	}
+
+	float OAAudioSource::getStreamDeadline() const
+	{
+		Lock lock(mMutex);
+
+		if (!mAudioClip.isLoaded())
+			return 0.0f;
+
+		UINT32 samplesPerSecond = mAudioClip->getFrequency() * mAudioClip->getNumChannels();
+		if (samplesPerSecond == 0)
+			return 0.0f;
+
+		return mNumBufferedSamples / (float)samplesPerSecond;
 	}
 
 	void OAAudioSource::applyClip()
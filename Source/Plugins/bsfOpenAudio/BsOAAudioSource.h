@@ -87,6 +87,18 @@ namespace bs
 		/** Pauses or resumes audio playback due to the global pause setting. */
 		void setGlobalPause(bool pause);
 
+		/** Checks is the source currently virtual. See Audio::setMaxVoices. */
+		bool isVirtual() const { return mVirtualState != AudioSourceState::Stopped; }
+
+		/** 
+		 * Turns a playing source into a virtual one, stopping its playback while remembering the playback position, or 
+		 * resumes playback of a virtual source from its current playback position.
+		 */
+		void setVirtual(bool isVirtual);
+
+		/** Advances the playback position of a playing virtual source by @p delta seconds. */
+		void advanceVirtual(float delta);
+
 		/** 
 		 * Returns true if the sound source is three dimensional (volume and pitch varies based on listener distance
 		 * and velocity). 
@@ -99,9 +111,30 @@ namespace bs
 		 */
 		bool requiresStreaming() const;
 
-		/** Fills the provided buffer with streaming data. */
+		/** 
+		 * Fills the provided buffer with streaming data. Uses data decoded ahead of time if available, or decodes it
+		 * immediately otherwise.
+		 */
 		bool fillBuffer(UINT32 buffer, AudioDataInfo& info, UINT32 maxNumSamples);
 
+		/** 
+		 * Decodes the next block of streaming data and appends it to the decoded block queue. Returns false if there is
+		 * no more data to decode. Caller must hold the mutex.
+		 */
+		bool decodeBlock();
+
+		/** 
+		 * Decodes blocks of streaming data ahead of playback, until there are @p maxBlocks decoded blocks waiting to be
+		 * queued. Safe to call from a worker thread.
+		 */
+		void decodeAhead(UINT32 maxBlocks);
+
+		/** 
+		 * Returns the amount of time in seconds until the source plays out all of its queued and decoded data. Used for
+		 * prioritizing decoding between sources.
+		 */
+		float getStreamDeadline() const;
+
 		/** Makes the current audio clip active. Should be called whenever the audio clip changes. */
 		void applyClip();
 
@@ -120,6 +153,21 @@ namespace bs
 		UINT32 mStreamQueuedPosition;
 		bool mIsStreaming;
 		mutable Mutex mMutex;
+
+		/** Block of streaming data that was decoded but not yet queued for playback. */
+		struct DecodedBlock
+		{
+			Vector<UINT8> samples;
+			UINT32 numSamples;
+		};
+
+		Deque<DecodedBlock> mDecodedBlocks;
+		Vector<Vector<UINT8>> mFreeBlockBuffers;
+		UINT32 mNumBufferedSamples = 0;
+		bool mHasQueuedData = false;
+
+		AudioSourceState mVirtualState = AudioSourceState::Stopped; // Stopped if the source isn't virtual
+		float mVirtualTime = 0.0f;
 	};
 
 	/** @} */
@@ -8,6 +8,7 @@ namespace bs
 {
 	class OAAudioListener;
 	class OAAudioSource;
+	class OAAudioClip;
 }
 
 /** @addtogroup Plugins
@@ -91,64 +91,14 @@ namespace bs
 			UINT32 numFramesToWrite = std::min(numFrames, WRITE_LENGTH);
 			float** buffer = vorbis_analysis_buffer(&mVorbisState, numFramesToWrite);
 
-			if (mBitDepth == 8)
-			{
-				for (UINT32 i = 0; i < numFramesToWrite; i++)
-				{
-					for (UINT32 j = 0; j < mNumChannels; j++)
-					{
-						INT8 sample = *(INT8*)samples;
-						float encodedSample = sample / 127.0f;
-						buffer[j][i] = encodedSample;
-
-						samples++;
-					}
-				}
-			}
-			else if (mBitDepth == 16)
-			{
-				for (UINT32 i = 0; i < numFramesToWrite; i++)
-				{
-					for (UINT32 j = 0; j < mNumChannels; j++)
-					{
-						INT16 sample = *(INT16*)samples;
-						float encodedSample = sample / 32767.0f;
-						buffer[j][i] = encodedSample;
-
-						samples += 2;
-					}
-				}
-			}
-			else if (mBitDepth == 24)
-			{
-				for (UINT32 i = 0; i < numFramesToWrite; i++)
-				{
-					for (UINT32 j = 0; j < mNumChannels; j++)
-					{
-						INT32 sample = AudioUtility::convert24To32Bits(samples);
-						float encodedSample = sample / 2147483647.0f;
-						buffer[j][i] = encodedSample;
-
-						samples += 3;
-					}
-				}
-			}
-			else if (mBitDepth == 32)
-			{
-				for (UINT32 i = 0; i < numFramesToWrite; i++)
-				{
-					for (UINT32 j = 0; j < mNumChannels; j++)
-					{
-						INT32 sample = *(INT32*)samples;
-						float encodedSample = sample / 2147483647.0f;
-						buffer[j][i] = encodedSample;
-
-						samples += 4;
-					}
-				}
-			}
-			else
-				assert(false);
+			UINT32 numSamplesToWrite = numFramesToWrite * mNumChannels;
+			float* floatSamples = (float*)bs_stack_alloc(numSamplesToWrite * sizeof(float));
+
+			AudioUtility::convertToFloat(samples, mBitDepth, floatSamples, numSamplesToWrite);
+			AudioUtility::deinterleave(floatSamples, buffer, mNumChannels, numFramesToWrite);
+
+			bs_stack_free(floatSamples);
+			samples += numSamplesToWrite * (mBitDepth / 8);
 
 			// Signal how many frames were written
 			vorbis_analysis_wrote(&mVorbisState, numFramesToWrite);
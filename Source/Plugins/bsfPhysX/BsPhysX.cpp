@@ -10,6 +10,7 @@
 #include "BsPhysXPlaneCollider.h"
 #include "BsPhysXCapsuleCollider.h"
 #include "BsPhysXMeshCollider.h"
+#include "BsPhysXHeightFieldCollider.h"
 #include "BsPhysXFixedJoint.h"
 #include "BsPhysXDistanceJoint.h"
 #include "BsPhysXHingeJoint.h"
@@ -21,6 +22,7 @@
 #include "Components/BsCCollider.h"
 #include "BsFPhysXCollider.h"
 #include "Utility/BsTime.h"
+#include "BsCoreApplication.h"
 #include "Math/BsVector3.h"
 #include "Math/BsAABox.h"
 #include "Math/BsCapsule.h"
@@ -35,14 +37,14 @@ namespace bs
 	public:
 		void* allocate(size_t size, const char*, const char*, int) override
 		{
-			void* ptr = bs_alloc_aligned16((UINT32)size);
+			void* ptr = bs_alloc_aligned16<PhysicsAlloc>((UINT32)size);
 			PX_ASSERT((reinterpret_cast<size_t>(ptr) & 15) == 0);
 			return ptr;
 		}
 
 		void deallocate(void* ptr) override
 		{
-			bs_free_aligned16(ptr);
+			bs_free_aligned16<PhysicsAlloc>(ptr);
 		}
 	};
 
@@ -284,20 +286,139 @@ namespace bs
 		}
 	};
 
+	/**
+	 * Free list of fixed size memory blocks, used for allocating the tasks submitted by PhysX. PhysX can submit hundreds
+	 * of small tasks per simulation step, so this avoids going through the general purpose allocator for each one.
+	 */
+	class PhysXTaskPool
+	{
+		/** Header of a block in the free list. */
+		struct Block
+		{
+			Block* next;
+		};
+
+	public:
+		/** Size of a single block. Fits a Task along with the reference count allocated together with it. */
+		static constexpr size_t BLOCK_SIZE = sizeof(Task) + 64;
+
+		~PhysXTaskPool()
+		{
+			while (mFreeList != nullptr)
+			{
+				Block* block = mFreeList;
+				mFreeList = block->next;
+
+				bs_free<PhysicsAlloc>(block);
+			}
+		}
+
+		/** Allocates a block of memory of the specified size. Reuses a previously freed block if possible. */
+		void* allocate(size_t bytes)
+		{
+			if (bytes > BLOCK_SIZE)
+				return bs_alloc<PhysicsAlloc>(bytes);
+
+			{
+				ScopedSpinLock lock(mLock);
+				if (mFreeList != nullptr)
+				{
+					Block* block = mFreeList;
+					mFreeList = block->next;
+
+					return block;
+				}
+			}
+
+			return bs_alloc<PhysicsAlloc>(BLOCK_SIZE);
+		}
+
+		/** Returns a block allocated with allocate() to the free list. */
+		void free(void* ptr, size_t bytes)
+		{
+			if (bytes > BLOCK_SIZE)
+			{
+				bs_free<PhysicsAlloc>(ptr);
+				return;
+			}
+
+			Block* block = (Block*)ptr;
+
+			ScopedSpinLock lock(mLock);
+			block->next = mFreeList;
+			mFreeList = block;
+		}
+
+	private:
+		Block* mFreeList = nullptr;
+		SpinLock mLock;
+	};
+
+	static PhysXTaskPool gPhysXTaskPool;
+
+	/** Allocator compatible with std::allocate_shared, that allocates from the PhysX task pool. */
+	template<class T>
+	class PhysXTaskAllocator
+	{
+	public:
+		using value_type = T;
+
+		PhysXTaskAllocator() = default;
+
+		template<class U>
+		PhysXTaskAllocator(const PhysXTaskAllocator<U>& other) { }
+
+		T* allocate(size_t count) { return (T*)gPhysXTaskPool.allocate(count * sizeof(T)); }
+		void deallocate(T* ptr, size_t count) { gPhysXTaskPool.free(ptr, count * sizeof(T)); }
+
+		template<class U>
+		bool operator==(const PhysXTaskAllocator<U>& other) const { return true; }
+
+		template<class U>
+		bool operator!=(const PhysXTaskAllocator<U>& other) const { return false; }
+	};
+
+	/** Running totals of tasks dispatched by PhysX, reset at the end of every simulation step. */
+	struct PhysXDispatchCounters
+	{
+		std::atomic<UINT32> numTasks{0};
+		std::atomic<UINT64> totalLatency{0};
+		std::atomic<UINT64> maxLatency{0};
+	};
+
+	static PhysXDispatchCounters gPhysXDispatchCounters;
+
 	class PhysXCPUDispatcher : public PxCpuDispatcher
 	{
 	public:
 		void submitTask(PxBaseTask& physxTask) override
 		{
-			// Note: Banshee's task scheduler is pretty low granularity. Consider a better task manager in case PhysX ends
-			// up submitting many tasks.
-			// - PhysX's task manager doesn't seem much lighter either. But perhaps I can at least create a task pool to 
-			//   avoid allocating them constantly.
+			PxBaseTask* taskPtr = &physxTask;
+			UINT64 submitTime = gTime().getTimePrecise();
 
-			auto runTask = [&]() { physxTask.run(); physxTask.release(); };
-			SPtr<Task> task = Task::create("PhysX", runTask);
+			// Note: Keep the captures small enough to fit in std::function's local storage, to avoid an allocation
+			auto runTask = [taskPtr, submitTime]()
+			{
+				UINT64 latency = gTime().getTimePrecise() - submitTime;
+				gPhysXDispatchCounters.numTasks.fetch_add(1, std::memory_order_relaxed);
+				gPhysXDispatchCounters.totalLatency.fetch_add(latency, std::memory_order_relaxed);
 
-			TaskScheduler::instance().addTask(task);
+				UINT64 maxLatency = gPhysXDispatchCounters.maxLatency.load(std::memory_order_relaxed);
+				while (latency > maxLatency)
+				{
+					if (gPhysXDispatchCounters.maxLatency.compare_exchange_weak(maxLatency, latency,
+						std::memory_order_relaxed))
+						break;
+				}
+
+				taskPtr->run();
+				taskPtr->release();
+			};
+
+			// Tasks submitted from within other PhysX tasks go directly to the local queue of the current worker, if the
+			// scheduler is running in TaskSchedulerMode::WorkStealing mode, which is preferred when using PhysX.
+			SPtr<Task> task = Task::create(PhysXTaskAllocator<Task>(), "PhysX", std::move(runTask));
+			TaskScheduler::instance().addTask(std::move(task));
 		}
 
 		PxU32 getWorkerCount() const override
@@ -452,6 +573,46 @@ namespace bs
 		}
 	};
 
+	/** Overlap query callback that writes the overlapping colliders into a fixed size, caller provided buffer. */
+	struct PhysXOverlapBatchCallback : PxOverlapCallback
+	{
+		static const int MAX_HITS = 32;
+		PxOverlapHit buffer[MAX_HITS];
+
+		Collider** output;
+		UINT32 capacity;
+		UINT32 count = 0;
+
+		PhysXOverlapBatchCallback(Collider** output, UINT32 capacity)
+			:PxOverlapCallback(buffer, MAX_HITS), output(output), capacity(capacity)
+		{ }
+
+		PxAgain processTouches(const PxOverlapHit* buffer, PxU32 nbHits) override
+		{
+			for (PxU32 i = 0; i < nbHits && count < capacity; i++)
+				output[count++] = (Collider*)buffer[i].shape->userData;
+
+			return count < capacity;
+		}
+	};
+
+	/** Converts the geometry of a batched query into PhysX geometry and its transform. */
+	PxGeometryHolder toPxGeometry(const PhysicsQueryGeometry& geometry, PxTransform& transform)
+	{
+		transform = toPxTransform(geometry.position, geometry.rotation);
+
+		switch(geometry.shape)
+		{
+		case PhysicsQueryShape::Box:
+			return PxBoxGeometry(toPxVector(geometry.halfExtents));
+		case PhysicsQueryShape::Capsule:
+			return PxCapsuleGeometry(geometry.radius, geometry.halfHeight);
+		default:
+		case PhysicsQueryShape::Sphere:
+			return PxSphereGeometry(geometry.radius);
+		}
+	}
+
 	static PhysXAllocator gPhysXAllocator;
 	static PhysXErrorCallback gPhysXErrorHandler;
 	static PhysXCPUDispatcher gPhysXCPUDispatcher;
@@ -460,6 +621,7 @@ namespace bs
 
 	static const UINT32 SIZE_16K = 1 << 14;
 	const UINT32 PhysX::SCRATCH_BUFFER_SIZE = SIZE_16K * 64; // 1MB by default
+	const UINT32 PhysX::BATCH_QUERY_GRAIN_SIZE = 32;
 
 	PhysX::PhysX(const PHYSICS_INIT_DESC& input)
 		:Physics(input)
@@ -471,6 +633,7 @@ namespace bs
 		mPhysics = PxCreateBasePhysics(PX_PHYSICS_VERSION, *mFoundation, mScale);
 
 		PxRegisterArticulations(*mPhysics);
+		PxRegisterHeightFields(*mPhysics);
 
 		if (input.initCooking)
 		{
@@ -503,10 +666,19 @@ namespace bs
 		mCharManager = PxCreateControllerManager(*mScene);
 
 		mDefaultMaterial = mPhysics->createMaterial(1.0f, 1.0f, 0.5f);
+
+		// Persistent, as with overlapped simulation the buffer is in use across frames
+		mScratchBuffer = (UINT8*)bs_alloc_aligned16<PhysicsAlloc>(SCRATCH_BUFFER_SIZE);
 	}
 
 	PhysX::~PhysX()
 	{
+		// Finish the step started by the last overlapped fixed update. Its results are no longer of interest.
+		if (mSimulationInProgress)
+			mScene->fetchResults(true);
+
+		bs_free_aligned16<PhysicsAlloc>(mScratchBuffer);
+
 		mCharManager->release();
 		mScene->release();
 
@@ -519,29 +691,58 @@ namespace bs
 
 	void PhysX::fixedUpdate(float step)
 	{
+		// Apply the results of the step started by the previous overlapped fixed update, if not already applied. Done
+		// even if paused or no longer overlapping, so the results aren't lost.
+		fetchResults();
+
 		if (mPaused)
+		{
+			// Otherwise the rigidbodies would keep moving back and forth between their last two transforms
+			clearInterpolatedTransforms();
 			return;
+		}
 
-		mUpdateInProgress = true;
+		updateLOD();
+
+		mScene->simulate(step, nullptr, mScratchBuffer, SCRATCH_BUFFER_SIZE);
+		mSimulationInProgress = true;
 
-		// Note: Consider delaying fetchResults one frame. This could improve performance because Physics update would be
-		//       able to run parallel to the simulation thread, but at a cost to input latency.
-		bs_frame_mark();
-		UINT8* scratchBuffer = bs_frame_alloc_aligned(SCRATCH_BUFFER_SIZE, 16);
+		// If overlapped, the simulation runs in parallel with the rest of the frame and its results are fetched during
+		// the next fixed update
+		if (!mFlags.isSet(PhysicsFlag::OverlappedSimulation))
+			fetchResults();
+	}
 
-		mScene->simulate(step, nullptr, scratchBuffer, SCRATCH_BUFFER_SIZE);
+	void PhysX::fetchResults()
+	{
+		if (!mSimulationInProgress)
+			return;
 
 		UINT32 errorState;
 		if (!mScene->fetchResults(true, &errorState))
 			LOGWRN("Physics simulation failed. Error code: " + toString(errorState));
 
-		bs_frame_free_aligned(scratchBuffer);
-		bs_frame_clear();
+		mSimulationInProgress = false;
 
-		// Update rigidbodies with new transforms
+		// All tasks of the step have executed by now
+		mDispatchStats.numTasks = gPhysXDispatchCounters.numTasks.exchange(0, std::memory_order_relaxed);
+		mDispatchStats.maxLatencyUs = gPhysXDispatchCounters.maxLatency.exchange(0, std::memory_order_relaxed);
+
+		UINT64 totalLatency = gPhysXDispatchCounters.totalLatency.exchange(0, std::memory_order_relaxed);
+		mDispatchStats.avgLatencyUs = mDispatchStats.numTasks > 0 ? totalLatency / mDispatchStats.numTasks : 0;
+
+		const bool interpolate = mFlags.isSet(PhysicsFlag::InterpolateTransforms);
+		for (auto& entry : mInterpolatedTransforms)
+			entry.second.active = false;
+
+		// Gather new transforms into a contiguous list first, so that converting them from the PhysX data doesn't get
+		// interleaved with the writes to the scene objects, which touch a lot of unrelated memory
 		PxU32 numActiveTransforms;
 		const PxActiveTransform* activeTransforms = mScene->getActiveTransforms(numActiveTransforms);
 
+		mTransformWriteback.clear();
+		mTransformWriteback.reserve(numActiveTransforms);
+
 		for (PxU32 i = 0; i < numActiveTransforms; i++)
 		{
 			Rigidbody* rigidbody = static_cast<Rigidbody*>(activeTransforms[i].userData);
@@ -553,21 +754,90 @@ namespace bs
 				continue;
 
 			const PxTransform& transform = activeTransforms[i].actor2World;
+			const Vector3 position = fromPxVector(transform.p);
+			const Quaternion rotation = fromPxQuaternion(transform.q);
+
+			mTransformWriteback.push_back({ rigidbody, position, rotation });
+
+			if (interpolate)
+			{
+				auto iterFind = mInterpolatedTransforms.find(rigidbody);
+				if (iterFind == mInterpolatedTransforms.end())
+				{
+					// No previous transform is known, start interpolating from the next step
+					mInterpolatedTransforms[rigidbody] = { position, rotation, position, rotation, true };
+				}
+				else
+				{
+					InterpolatedTransform& entry = iterFind->second;
+					entry.prevPosition = entry.position;
+					entry.prevRotation = entry.rotation;
+					entry.position = position;
+					entry.rotation = rotation;
+					entry.active = true;
+				}
+			}
+		}
 
-			// Note: Make this faster, avoid dereferencing Rigidbody and attempt to access pos/rot destination directly,
-			//       use non-temporal writes
-			rigidbody->_setTransform(fromPxVector(transform.p), fromPxQuaternion(transform.q));
+		// Update rigidbodies with new transforms
+		mUpdateInProgress = true;
+
+		for (auto& entry : mTransformWriteback)
+			entry.rigidbody->_setTransform(entry.position, entry.rotation);
+
+		// Rigidbodies that didn't move during this step came to rest, but were last displayed at an interpolated transform
+		for (auto iter = mInterpolatedTransforms.begin(); iter != mInterpolatedTransforms.end();)
+		{
+			if (!iter->second.active)
+			{
+				iter->first->_setTransform(iter->second.position, iter->second.rotation);
+				iter = mInterpolatedTransforms.erase(iter);
+			}
+			else
+				++iter;
 		}
 
-		// Note: Consider extrapolating for the remaining "simulationAmount" value
 		mUpdateInProgress = false;
 
 		triggerEvents();
 	}
 
+	void PhysX::clearInterpolatedTransforms()
+	{
+		mUpdateInProgress = true;
+
+		for (auto& entry : mInterpolatedTransforms)
+			entry.first->_setTransform(entry.second.position, entry.second.rotation);
+
+		mUpdateInProgress = false;
+		mInterpolatedTransforms.clear();
+	}
+
 	void PhysX::update()
 	{
-		// Note: Potentially interpolate (would mean a one frame delay needs to be introduced)
+		if (mInterpolatedTransforms.empty())
+			return;
+
+		if (!mFlags.isSet(PhysicsFlag::InterpolateTransforms))
+		{
+			clearInterpolatedTransforms();
+			return;
+		}
+
+		// Note: Interpolating between the last two steps delays the displayed transforms by up to one fixed step
+		const float t = gCoreApplication().getFixedUpdateAlpha();
+
+		mUpdateInProgress = true;
+		for (auto& entry : mInterpolatedTransforms)
+		{
+			const InterpolatedTransform& transform = entry.second;
+
+			entry.first->_setTransform(
+				Vector3::lerp(t, transform.prevPosition, transform.position),
+				Quaternion::lerp(t, transform.prevRotation, transform.rotation));
+		}
+
+		mUpdateInProgress = false;
 	}
 
 	void PhysX::_reportContactEvent(const ContactEvent& event)
@@ -585,6 +855,78 @@ namespace bs
 		mJointBreakEvents.push_back(event);
 	}
 
+	void PhysX::_notifyRigidbodyDestroyed(Rigidbody* rigidbody)
+	{
+		mInterpolatedTransforms.erase(rigidbody);
+
+		auto iterFind = mRigidbodyLODs.find(static_cast<PhysXRigidbody*>(rigidbody));
+		if (iterFind != mRigidbodyLODs.end())
+		{
+			if (iterFind->second != RigidbodyLOD::Full)
+				mNumReducedRigidbodies--;
+
+			mRigidbodyLODs.erase(iterFind);
+		}
+	}
+
+	void PhysX::updateLOD()
+	{
+		const bool enabled = mLODSettings.enabled && !mFocusPoints.empty();
+
+		// Nothing to do, unless some rigidbodies need to be restored after LOD was disabled
+		if (!enabled && mNumReducedRigidbodies == 0)
+			return;
+
+		const float sleepDistance = mLODSettings.sleepDistance;
+		const float removeDistance = std::max(mLODSettings.removeDistance, sleepDistance);
+		const float hysteresis = mLODSettings.hysteresis;
+
+		mNumReducedRigidbodies = 0;
+		for (auto& entry : mRigidbodyLODs)
+		{
+			PhysXRigidbody* rigidbody = entry.first;
+			const RigidbodyLOD oldLOD = entry.second;
+
+			RigidbodyLOD newLOD = RigidbodyLOD::Full;
+			if (enabled)
+			{
+				const Vector3 position = rigidbody->getPosition();
+
+				float minDistanceSqrd = std::numeric_limits<float>::max();
+				for (auto& focusPoint : mFocusPoints)
+					minDistanceSqrd = std::min(minDistanceSqrd, position.squaredDistance(focusPoint.second));
+
+				const float minDistance = std::sqrt(minDistanceSqrd);
+
+				// Only move to a more detailed level once the rigidbody is past the band boundary by the hysteresis amount
+				const float sleepThreshold = oldLOD != RigidbodyLOD::Full ? sleepDistance - hysteresis : sleepDistance;
+				const float removeThreshold = oldLOD == RigidbodyLOD::Removed ? removeDistance - hysteresis : removeDistance;
+
+				if (minDistance >= removeThreshold)
+					newLOD = RigidbodyLOD::Removed;
+				else if (minDistance >= sleepThreshold)
+					newLOD = RigidbodyLOD::Asleep;
+			}
+
+			if (newLOD != RigidbodyLOD::Full)
+				mNumReducedRigidbodies++;
+
+			rigidbody->_setInScene(newLOD != RigidbodyLOD::Removed);
+
+			// Kinematic bodies are driven by the user and cannot be put to sleep. Others may be woken up by collisions, so
+			// keep putting them back to sleep.
+			if (!rigidbody->getIsKinematic())
+			{
+				if (newLOD == RigidbodyLOD::Asleep && !rigidbody->isSleeping())
+					rigidbody->sleep();
+				else if (newLOD == RigidbodyLOD::Full && oldLOD != RigidbodyLOD::Full)
+					rigidbody->wakeUp();
+			}
+
+			entry.second = newLOD;
+		}
+	}
+
 	void PhysX::triggerEvents()
 	{
 		CollisionDataRaw data;
@@ -609,11 +951,11 @@ namespace bs
 		}
 
 		auto notifyContact = [&](Collider* obj, Collider* other, ContactEventType type, 
-			const Vector<ContactPoint>& points, bool flipNormals = false)
+			const SmallVector<ContactPoint, 4>& points, bool flipNormals = false)
 		{
 			data.colliders[0] = obj;
 			data.colliders[1] = other;
-			data.contactPoints = points;
+			data.contactPoints.assign(points.begin(), points.end());
 
 			if(flipNormals)
 			{
@@ -699,7 +1041,10 @@ namespace bs
 
 	SPtr<Rigidbody> PhysX::createRigidbody(const HSceneObject& linkedSO)
 	{
-		return bs_shared_ptr_new<PhysXRigidbody>(mPhysics, mScene, linkedSO);
+		SPtr<PhysXRigidbody> rigidbody = bs_shared_ptr_new<PhysXRigidbody>(mPhysics, mScene, linkedSO);
+		mRigidbodyLODs[rigidbody.get()] = RigidbodyLOD::Full;
+
+		return rigidbody;
 	}
 
 	SPtr<BoxCollider> PhysX::createBoxCollider(const Vector3& extents, const Vector3& position,
@@ -729,6 +1074,11 @@ namespace bs
 		return bs_shared_ptr_new<PhysXMeshCollider>(mPhysics, position, rotation);
 	}
 
+	SPtr<HeightFieldCollider> PhysX::createHeightFieldCollider(const Vector3& position, const Quaternion& rotation)
+	{
+		return bs_shared_ptr_new<PhysXHeightFieldCollider>(mPhysics, position, rotation);
+	}
+
 	SPtr<FixedJoint> PhysX::createFixedJoint(const FIXED_JOINT_DESC& desc)
 	{
 		return bs_shared_ptr_new<PhysXFixedJoint>(mPhysics, desc);
@@ -1108,6 +1458,112 @@ namespace bs
 		return output.data;
 	}
 
+	UINT32 PhysX::rayCastBatch(const RayCastQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const
+	{
+		executeBatch(numQueries, [this, queries, hits](UINT32 begin, UINT32 end)
+		{
+			for(UINT32 i = begin; i < end; i++)
+			{
+				const RayCastQuery& query = queries[i];
+
+				PxRaycastBuffer output;
+
+				PxQueryFilterData filterData;
+				memcpy(&filterData.data.word0, &query.layer, sizeof(query.layer));
+
+				hits[i] = PhysicsQueryHit();
+				if(mScene->raycast(toPxVector(query.origin), toPxVector(query.unitDir), query.maxDist, output,
+					PxHitFlag::eDEFAULT | PxHitFlag::eUV, filterData))
+				{
+					parseHit(output.block, hits[i]);
+				}
+			}
+		});
+
+		UINT32 numHits = 0;
+		for(UINT32 i = 0; i < numQueries; i++)
+		{
+			if(hits[i].colliderRaw != nullptr)
+				numHits++;
+		}
+
+		return numHits;
+	}
+
+	UINT32 PhysX::sweepBatch(const SweepQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const
+	{
+		executeBatch(numQueries, [this, queries, hits](UINT32 begin, UINT32 end)
+		{
+			for(UINT32 i = begin; i < end; i++)
+			{
+				const SweepQuery& query = queries[i];
+
+				PxTransform transform;
+				PxGeometryHolder geometry = toPxGeometry(query.geometry, transform);
+
+				hits[i] = PhysicsQueryHit();
+				sweep(geometry.any(), transform, query.unitDir, hits[i], query.layer, query.maxDist);
+			}
+		});
+
+		UINT32 numHits = 0;
+		for(UINT32 i = 0; i < numQueries; i++)
+		{
+			if(hits[i].colliderRaw != nullptr)
+				numHits++;
+		}
+
+		return numHits;
+	}
+
+	UINT32 PhysX::overlapBatch(const OverlapQuery* queries, UINT32 numQueries, Collider** colliders,
+		UINT32 maxCollidersPerQuery, UINT32* numColliders) const
+	{
+		executeBatch(numQueries, [this, queries, colliders, maxCollidersPerQuery, numColliders](UINT32 begin, UINT32 end)
+		{
+			for(UINT32 i = begin; i < end; i++)
+			{
+				const OverlapQuery& query = queries[i];
+
+				numColliders[i] = 0;
+				if(maxCollidersPerQuery == 0)
+					continue;
+
+				PxTransform transform;
+				PxGeometryHolder geometry = toPxGeometry(query.geometry, transform);
+
+				PhysXOverlapBatchCallback output(&colliders[i * maxCollidersPerQuery], maxCollidersPerQuery);
+
+				PxQueryFilterData filterData;
+				memcpy(&filterData.data.word0, &query.layer, sizeof(query.layer));
+
+				mScene->overlap(geometry.any(), transform, output, filterData);
+				numColliders[i] = output.count;
+			}
+		});
+
+		UINT32 numOverlapping = 0;
+		for(UINT32 i = 0; i < numQueries; i++)
+		{
+			if(numColliders[i] > 0)
+				numOverlapping++;
+		}
+
+		return numOverlapping;
+	}
+
+	void PhysX::executeBatch(UINT32 count, const std::function<void(UINT32, UINT32)>& func) const
+	{
+		// Scene queries only read from the scene, and PhysX allows concurrent reads as long as nothing is writing to it
+		if(count <= BATCH_QUERY_GRAIN_SIZE || !TaskScheduler::isStarted())
+		{
+			func(0, count);
+			return;
+		}
+
+		TaskScheduler::instance().parallelFor(0, count, BATCH_QUERY_GRAIN_SIZE, func);
+	}
+
 	void PhysX::setFlag(PhysicsFlags flag, bool enabled)
 	{
 		Physics::setFlag(flag, enabled);
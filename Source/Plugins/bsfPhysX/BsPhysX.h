@@ -16,6 +16,14 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Statistics about the tasks PhysX dispatched to the TaskScheduler during a single simulation step. */
+	struct PhysXDispatchStats
+	{
+		UINT32 numTasks = 0; /**< Number of tasks executed during the step. */
+		UINT64 avgLatencyUs = 0; /**< Average time between a task being submitted and starting to execute. */
+		UINT64 maxLatencyUs = 0; /**< Longest time between a task being submitted and starting to execute. */
+	};
+
 	/** NVIDIA PhysX implementation of Physics. */
 	class PhysX : public Physics
 	{
@@ -41,8 +49,7 @@ namespace bs
 			Collider* colliderA; /** First collider. */
 			Collider* colliderB; /** Second collider. */
 			ContactEventType type; /** Exact type of the event. */
-			// Note: Not too happy this is heap allocated, use static allocator?
-			Vector<ContactPoint> points; /** Information about all contact points between the colliders. */
+			SmallVector<ContactPoint, 4> points; /** Information about all contact points between the colliders. */
 		};
 
 		/** Event reported when a joint breaks. */
@@ -58,6 +65,9 @@ namespace bs
 		/** @copydoc Physics::fixedUpdate */
 		void fixedUpdate(float step) override;
 
+		/** @copydoc Physics::fetchResults */
+		void fetchResults() override;
+
 		/** @copydoc Physics::update */
 		void update() override;
 
@@ -87,6 +97,10 @@ namespace bs
 		/** @copydoc Physics::createMeshCollider */
 		SPtr<MeshCollider> createMeshCollider(const Vector3& position, const Quaternion& rotation) override;
 
+		/** @copydoc Physics::createHeightFieldCollider */
+		SPtr<HeightFieldCollider> createHeightFieldCollider(const Vector3& position,
+			const Quaternion& rotation) override;
+
 		/** @copydoc Physics::createFixedJoint */
 		SPtr<FixedJoint> createFixedJoint(const FIXED_JOINT_DESC& desc) override;
 
@@ -183,6 +197,16 @@ namespace bs
 		bool convexOverlapAny(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
 			UINT64 layer = BS_ALL_LAYERS) const override;
 
+		/** @copydoc Physics::rayCastBatch */
+		UINT32 rayCastBatch(const RayCastQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const override;
+
+		/** @copydoc Physics::sweepBatch */
+		UINT32 sweepBatch(const SweepQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const override;
+
+		/** @copydoc Physics::overlapBatch */
+		UINT32 overlapBatch(const OverlapQuery* queries, UINT32 numQueries, Collider** colliders,
+			UINT32 maxCollidersPerQuery, UINT32* numColliders) const override;
+
 		/** @copydoc Physics::setFlag */
 		void setFlag(PhysicsFlags flags, bool enabled) override;
 
@@ -238,6 +262,12 @@ namespace bs
 		/** Triggered by the PhysX simulation when a joint breaks. */
 		void _reportJointBreakEvent(const JointBreakEvent& event);
 
+		/** Returns statistics about the tasks dispatched during the last completed simulation step. */
+		const PhysXDispatchStats& getDispatchStats() const { return mDispatchStats; }
+
+		/** Notifies the system that a rigidbody is about to be destroyed. */
+		void _notifyRigidbodyDestroyed(Rigidbody* rigidbody);
+
 		/** Returns the default PhysX material. */
 		physx::PxMaterial* getDefaultMaterial() const { return mDefaultMaterial; }
 
@@ -256,6 +286,41 @@ namespace bs
 	private:
 		friend class PhysXEventCallback;
 
+		/** Transform of a rigidbody resulting from the simulation, waiting to be applied to the rigidbody. */
+		struct TransformWriteback
+		{
+			Rigidbody* rigidbody;
+			Vector3 position;
+			Quaternion rotation;
+		};
+
+		/** Rigidbody transforms at the end of the last two simulation steps, used for interpolation. */
+		struct InterpolatedTransform
+		{
+			Vector3 prevPosition;
+			Quaternion prevRotation;
+			Vector3 position;
+			Quaternion rotation;
+			bool active;
+		};
+
+		/** Moves all interpolated rigidbodies to their latest simulated transforms, and stops interpolating them. */
+		void clearInterpolatedTransforms();
+
+		/** Level of detail a rigidbody is simulated with, based on its distance from the physics focus points. */
+		enum class RigidbodyLOD
+		{
+			Full, /**< Simulated normally. */
+			Asleep, /**< Kept asleep, but still present in the scene. */
+			Removed /**< Removed from the scene. */
+		};
+
+		/** 
+		 * Moves rigidbodies between simulation levels of detail according to their distance from the focus points, and
+		 * the current LOD settings. Must not be called while the simulation is running.
+		 */
+		void updateLOD();
+
 		/** Sends out all events recorded during simulation to the necessary physics objects. */
 		void triggerEvents();
 
@@ -288,14 +353,30 @@ namespace bs
 		/** Helper method that checks if the provided geometry overlaps any physics object. */
 		inline bool overlapAny(const physx::PxGeometry& geometry, const physx::PxTransform& tfrm, UINT64 layer) const;
 
+		/**
+		 * Executes @p func for each index in range [0, @p count), in parallel on the worker threads if there are enough
+		 * queries to be worth it. Used for batched scene queries, which only read from the scene.
+		 */
+		void executeBatch(UINT32 count, const std::function<void(UINT32, UINT32)>& func) const;
+
+		/** Number of queries executed by a single worker task in a batched query. */
+		static const UINT32 BATCH_QUERY_GRAIN_SIZE;
+
 		float mTesselationLength = 3.0f;
 		UINT32 mNextRegionIdx = 1;
 		bool mPaused = false;
+		bool mSimulationInProgress = false;
+		UINT8* mScratchBuffer = nullptr;
+		PhysXDispatchStats mDispatchStats;
 
 		Vector<TriggerEvent> mTriggerEvents;
 		Vector<ContactEvent> mContactEvents;
 		Vector<JointBreakEvent> mJointBreakEvents;
 		UnorderedMap<UINT32, UINT32> mBroadPhaseRegionHandles;
+		UnorderedMap<Rigidbody*, InterpolatedTransform> mInterpolatedTransforms;
+		UnorderedMap<PhysXRigidbody*, RigidbodyLOD> mRigidbodyLODs;
+		UINT32 mNumReducedRigidbodies = 0;
+		Vector<TransformWriteback> mTransformWriteback;
 
 		physx::PxFoundation* mFoundation = nullptr;
 		physx::PxPhysics* mPhysics = nullptr;
@@ -0,0 +1,134 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsPhysXHeightFieldCollider.h"
+#include "BsPhysX.h"
+#include "PxPhysics.h"
+#include "BsFPhysXCollider.h"
+#include "Physics/BsHeightField.h"
+#include "cooking/PxCooking.h"
+#include "geometry/PxHeightFieldDesc.h"
+#include "geometry/PxHeightFieldSample.h"
+
+using namespace physx;
+
+namespace bs
+{
+	/** Largest value of a PhysX height field sample, to which normalized height of one maps to. */
+	static const float MAX_SAMPLE_HEIGHT = 32767.0f;
+
+	PhysXHeightFieldCollider::PhysXHeightFieldCollider(PxPhysics* physx, const Vector3& position,
+		const Quaternion& rotation)
+	{
+		PxSphereGeometry geometry(0.01f); // Dummy
+
+		PxShape* shape = physx->createShape(geometry, *gPhysX().getDefaultMaterial(), true);
+		shape->setLocalPose(toPxTransform(position, rotation));
+		shape->userData = this;
+
+		mInternal = bs_new<FPhysXCollider>(shape);
+	}
+
+	PhysXHeightFieldCollider::~PhysXHeightFieldCollider()
+	{
+		bs_delete(mInternal);
+
+		if (mPxHeightField != nullptr)
+			mPxHeightField->release();
+	}
+
+	void PhysXHeightFieldCollider::setScale(const Vector3& scale)
+	{
+		HeightFieldCollider::setScale(scale);
+		applyGeometry();
+	}
+
+	void PhysXHeightFieldCollider::onHeightFieldChanged()
+	{
+		rebuildHeightField();
+		applyGeometry();
+	}
+
+	void PhysXHeightFieldCollider::rebuildHeightField()
+	{
+		if (mPxHeightField != nullptr)
+		{
+			mPxHeightField->release();
+			mPxHeightField = nullptr;
+		}
+
+		if (!mHeightField.isLoaded())
+			return;
+
+		PxCooking* cooking = gPhysX().getCooking();
+		if (cooking == nullptr)
+		{
+			LOGWRN("Height field colliders require cooking to be enabled when initializing physics.");
+			return;
+		}
+
+		// PhysX rows run along the X axis and columns along the Z axis, which is the opposite of the height field
+		mNumRows = mHeightField->getNumColumns();
+		mNumColumns = mHeightField->getNumRows();
+
+		Vector<PxHeightFieldSample> samples(mNumRows * mNumColumns);
+		for (UINT32 x = 0; x < mNumRows; x++)
+		{
+			for (UINT32 z = 0; z < mNumColumns; z++)
+			{
+				PxHeightFieldSample& sample = samples[x * mNumColumns + z];
+				sample.height = (PxI16)Math::roundToInt(mHeightField->getHeight(z, x) * MAX_SAMPLE_HEIGHT);
+				sample.materialIndex0 = 0;
+				sample.materialIndex1 = 0;
+			}
+		}
+
+		PxHeightFieldDesc desc;
+		desc.format = PxHeightFieldFormat::eS16_TM;
+		desc.nbRows = mNumRows;
+		desc.nbColumns = mNumColumns;
+		desc.samples.data = samples.data();
+		desc.samples.stride = sizeof(PxHeightFieldSample);
+
+		mPxHeightField = cooking->createHeightField(desc, gPhysX().getPhysX()->getPhysicsInsertionCallback());
+	}
+
+	void PhysXHeightFieldCollider::applyGeometry()
+	{
+		if (mPxHeightField == nullptr)
+		{
+			setGeometry(PxSphereGeometry(0.01f)); // Dummy
+			return;
+		}
+
+		// Height field spans [0, 1] range on all axes, before scale is applied
+		Vector3 scale = getScale();
+		float width = std::max(Math::abs(scale.x), 0.0001f);
+		float height = std::max(Math::abs(scale.y), 0.0001f);
+		float length = std::max(Math::abs(scale.z), 0.0001f);
+
+		PxHeightFieldGeometry geometry;
+		geometry.heightField = mPxHeightField;
+		geometry.heightScale = std::max(height / MAX_SAMPLE_HEIGHT, PX_MIN_HEIGHTFIELD_Y_SCALE);
+		geometry.rowScale = width / (mNumRows - 1);
+		geometry.columnScale = length / (mNumColumns - 1);
+
+		setGeometry(geometry);
+	}
+
+	void PhysXHeightFieldCollider::setGeometry(const PxGeometry& geometry)
+	{
+		PxShape* shape = getInternal()->_getShape();
+		if (shape->getGeometryType() != geometry.getType())
+		{
+			PxShape* newShape = gPhysX().getPhysX()->createShape(geometry, *gPhysX().getDefaultMaterial(), true);
+			getInternal()->_setShape(newShape);
+		}
+		else
+			getInternal()->_getShape()->setGeometry(geometry);
+	}
+
+	FPhysXCollider* PhysXHeightFieldCollider::getInternal() const
+	{
+		return static_cast<FPhysXCollider*>(mInternal);
+	}
+}
@@ -0,0 +1,47 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPhysXPrerequisites.h"
+#include "Physics/BsHeightFieldCollider.h"
+#include "PxPhysics.h"
+
+namespace bs
+{
+	/** @addtogroup PhysX
+	 *  @{
+	 */
+
+	/** PhysX implementation of a HeightFieldCollider. */
+	class PhysXHeightFieldCollider : public HeightFieldCollider
+	{
+	public:
+		PhysXHeightFieldCollider(physx::PxPhysics* physx, const Vector3& position, const Quaternion& rotation);
+		~PhysXHeightFieldCollider();
+
+		/** @copydoc HeightFieldCollider::setScale */
+		void setScale(const Vector3& scale) override;
+
+	private:
+		/** Returns the PhysX collider implementation common to all colliders. */
+		FPhysXCollider* getInternal() const;
+
+		/** @copydoc HeightFieldCollider::onHeightFieldChanged */
+		void onHeightFieldChanged() override;
+
+		/** Creates the PhysX height field from the set height field resource, releasing the previous one. */
+		void rebuildHeightField();
+
+		/** Applies height field geometry using the current PhysX height field and scale. */
+		void applyGeometry();
+
+		/** Sets new geometry to the underlying shape. Rebuilds the shape if necessary. */
+		void setGeometry(const physx::PxGeometry& geometry);
+
+		physx::PxHeightField* mPxHeightField = nullptr;
+		UINT32 mNumRows = 0;
+		UINT32 mNumColumns = 0;
+	};
+
+	/** @} */
+}
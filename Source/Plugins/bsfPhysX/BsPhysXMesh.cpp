@@ -11,6 +11,7 @@
 #include "geometry/PxConvexMesh.h"
 #include "cooking/PxConvexMeshDesc.h"
 #include "extensions/PxDefaultStreams.h"
+#include "Threading/BsTaskScheduler.h"
 
 using namespace physx;
 
@@ -92,6 +93,25 @@ namespace bs
 		return false;
 	}
 
+	/** 
+	 * Returns a hash of the PhysX version and the cooking parameters that affect the cooked data. Cooked data produced
+	 * with a different hash cannot be assumed to be valid for the current cooking setup.
+	 */
+	UINT64 getCookingParamsHash(PxCooking* cooking)
+	{
+		const PxCookingParams& params = cooking->getParams();
+
+		size_t hash = 0;
+		bs::hash_combine(hash, (UINT32)PX_PHYSICS_VERSION);
+		bs::hash_combine(hash, params.scale.length);
+		bs::hash_combine(hash, params.scale.speed);
+		bs::hash_combine(hash, (UINT32)params.meshPreprocessParams);
+		bs::hash_combine(hash, params.meshWeldTolerance);
+
+		// Zero is reserved for data cooked before the hash was recorded
+		return hash != 0 ? (UINT64)hash : 1;
+	}
+
 	/**
 	 * Attempts to cook a triangle or convex mesh from the provided mesh data. Will log a warning and return false if it is
 	 * unable to cook the mesh. If the method returns true the resulting convex mesh will be output in the @p data buffer,
@@ -191,12 +211,49 @@ namespace bs
 	{
 		// Perform cooking if needed
 		if (meshData != nullptr)
+			startCooking(meshData);
+	}
+
+	FPhysXMesh::~FPhysXMesh()
+	{
+		blockUntilCooked();
+		release();
+	}
+
+	void FPhysXMesh::startCooking(const SPtr<MeshData>& meshData)
+	{
+		PxCooking* cooking = gPhysX().getCooking();
+		if (cooking != nullptr)
+			mCookingParamsHash = getCookingParamsHash(cooking);
+
+		auto cook = [this, meshData]()
+		{
 			cookMesh(meshData, mType, &mCookedData, mCookedDataSize);
+			initialize();
+		};
+
+		if (!TaskScheduler::isStarted())
+		{
+			cook();
+			return;
+		}
 
-		initialize();
+		mCookTask = Task::create("PhysXMeshCook", cook);
+		TaskScheduler::instance().addTask(mCookTask);
 	}
 
-	FPhysXMesh::~FPhysXMesh()
+	bool FPhysXMesh::isCooked() const
+	{
+		return mCookTask == nullptr || mCookTask->isComplete();
+	}
+
+	void FPhysXMesh::blockUntilCooked() const
+	{
+		if (mCookTask != nullptr)
+			mCookTask->wait();
+	}
+
+	void FPhysXMesh::release()
 	{
 		if (mCookedData != nullptr)
 		{
@@ -233,8 +290,27 @@ namespace bs
 		}
 	}
 
+	void FPhysXMesh::recookIfStale()
+	{
+		PxCooking* cooking = gPhysX().getCooking();
+		if (cooking == nullptr || mCookedData == nullptr)
+			return;
+
+		// Data saved before the parameters were recorded is assumed to be valid, as there is nothing to compare against
+		if (mCookingParamsHash == 0 || mCookingParamsHash == getCookingParamsHash(cooking))
+			return;
+
+		// The original source mesh isn't saved with the resource, so re-cook from the geometry of the existing mesh
+		SPtr<MeshData> meshData = getMeshData();
+
+		release();
+		startCooking(meshData);
+	}
+
 	SPtr<MeshData> FPhysXMesh::getMeshData() const
 	{
+		blockUntilCooked();
+
 		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
 		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
 
@@ -39,27 +39,63 @@ namespace bs
 		/** @copydoc PhysicsMesh::getMeshData */
 		SPtr<MeshData> getMeshData() const override;
 
+		/** @copydoc PhysicsMesh::isCooked */
+		bool isCooked() const override;
+
+		/** @copydoc PhysicsMesh::blockUntilCooked */
+		void blockUntilCooked() const override;
+
 		/** 
 		 * Returns the internal PhysX representation of a triangle mesh. Caller must ensure the physics mesh type is 
-		 * triangle. 
+		 * triangle. Blocks until cooking completes.
 		 */
-		physx::PxTriangleMesh* _getTriangle() const { assert(mType == PhysicsMeshType::Triangle); return mTriangleMesh; }
+		physx::PxTriangleMesh* _getTriangle() const
+		{
+			assert(mType == PhysicsMeshType::Triangle);
+
+			blockUntilCooked();
+			return mTriangleMesh;
+		}
 
 		/** 
 		 * Returns the internal PhysX representation of a convex mesh. Caller must ensure the physics mesh type is 
-		 * convex. 
+		 * convex. Blocks until cooking completes.
 		 */
-		physx::PxConvexMesh* _getConvex() const { assert(mType == PhysicsMeshType::Convex); return mConvexMesh; }
+		physx::PxConvexMesh* _getConvex() const
+		{
+			assert(mType == PhysicsMeshType::Convex);
+
+			blockUntilCooked();
+			return mConvexMesh;
+		}
 
 	private:
 		/** Creates the internal triangle/convex mesh */
 		void initialize();
 
+		/** 
+		 * Cooks the provided mesh data and creates the internal triangle/convex mesh from it. Cooking is performed on a
+		 * worker thread if the task scheduler is running, or immediately otherwise.
+		 */
+		void startCooking(const SPtr<MeshData>& meshData);
+
+		/** Releases the internal triangle/convex mesh and the cooked data. */
+		void release();
+
+		/** 
+		 * Checks were the deserialized cooked data produced with different cooking parameters than the ones currently in
+		 * use, and if so re-cooks the mesh.
+		 */
+		void recookIfStale();
+
 		physx::PxTriangleMesh* mTriangleMesh = nullptr;
 		physx::PxConvexMesh* mConvexMesh = nullptr;
 
 		UINT8* mCookedData = nullptr;
 		UINT32 mCookedDataSize = 0;
+		UINT64 mCookingParamsHash = 0;
+
+		SPtr<Task> mCookTask;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
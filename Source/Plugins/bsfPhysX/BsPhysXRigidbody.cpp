@@ -45,7 +45,7 @@ namespace bs
 	}
 
 	PhysXRigidbody::PhysXRigidbody(PxPhysics* physx, PxScene* scene, const HSceneObject& linkedSO)
-		:Rigidbody(linkedSO)
+		:Rigidbody(linkedSO), mScene(scene)
 	{
 
 		const Transform& tfrm = linkedSO->getTransform();
@@ -59,14 +59,35 @@ namespace bs
 
 	PhysXRigidbody::~PhysXRigidbody()
 	{
+		gPhysX()._notifyRigidbodyDestroyed(this);
+
 		mInternal->userData = nullptr;
 		mInternal->release();
 	}
 
+	void PhysXRigidbody::_setInScene(bool inScene)
+	{
+		if (mInScene == inScene)
+			return;
+
+		if (inScene)
+			mScene->addActor(*mInternal);
+		else
+			mScene->removeActor(*mInternal);
+
+		mInScene = inScene;
+	}
+
 	void PhysXRigidbody::move(const Vector3& position)
 	{
 		if (getIsKinematic())
 		{
+			if (!mInScene)
+			{
+				setTransform(position, getRotation());
+				return;
+			}
+
 			PxTransform target;
 			if (!mInternal->getKinematicTarget(target))
 				target = PxTransform(PxIdentity);
@@ -85,6 +106,12 @@ namespace bs
 	{
 		if (getIsKinematic())
 		{
+			if (!mInScene)
+			{
+				setTransform(getPosition(), rotation);
+				return;
+			}
+
 			PxTransform target;
 			if (!mInternal->getKinematicTarget(target))
 				target = PxTransform(PxIdentity);
@@ -142,16 +169,26 @@ namespace bs
 
 	bool PhysXRigidbody::isSleeping() const
 	{
+		// Rigidbodies removed from the scene by the level of detail system aren't simulated, same as if they were asleep
+		if (!mInScene)
+			return true;
+
 		return mInternal->isSleeping();
 	}
 
 	void PhysXRigidbody::sleep()
 	{
+		if (!mInScene)
+			return;
+
 		mInternal->putToSleep();
 	}
 
 	void PhysXRigidbody::wakeUp()
 	{
+		if (!mInScene)
+			return;
+
 		mInternal->wakeUp();
 	}
 
@@ -325,16 +362,25 @@ namespace bs
 
 	void PhysXRigidbody::addForce(const Vector3& force, ForceMode mode)
 	{
+		if (!mInScene)
+			return;
+
 		mInternal->addForce(toPxVector(force), toPxForceMode(mode));
 	}
 
 	void PhysXRigidbody::addTorque(const Vector3& force, ForceMode mode)
 	{
+		if (!mInScene)
+			return;
+
 		mInternal->addTorque(toPxVector(force), toPxForceMode(mode));
 	}
 
 	void PhysXRigidbody::addForceAtPoint(const Vector3& force, const Vector3& position, PointForceMode mode)
 	{
+		if (!mInScene)
+			return;
+
 		const PxVec3& pxForce = toPxVector(force);
 		const PxVec3& pxPos = toPxVector(position);
 
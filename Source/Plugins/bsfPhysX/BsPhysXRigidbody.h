@@ -157,8 +157,19 @@ namespace bs
 		/** Returns the internal PhysX dynamic actor. */
 		physx::PxRigidDynamic* _getInternal() const { return mInternal; }
 
+		/** 
+		 * Adds or removes the actor from the scene it was created in. Used by the physics level of detail system for 
+		 * temporarily removing far away rigidbodies from the simulation.
+		 */
+		void _setInScene(bool inScene);
+
+		/** Checks is the actor currently a part of the scene. */
+		bool _isInScene() const { return mInScene; }
+
 	private:
 		physx::PxRigidDynamic* mInternal;
+		physx::PxScene* mScene;
+		bool mInScene = true;
 	};
 
 	/** @} */
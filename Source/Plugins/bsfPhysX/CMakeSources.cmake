@@ -10,6 +10,7 @@ set(BS_PHYSX_INC_NOFILTER
 	"BsPhysXCapsuleCollider.h"
 	"BsPhysXMesh.h"
 	"BsPhysXMeshCollider.h"
+	"BsPhysXHeightFieldCollider.h"
 	"BsFPhysXJoint.h"
 	"BsPhysXFixedJoint.h"
 	"BsPhysXDistanceJoint.h"
@@ -32,6 +33,7 @@ set(BS_PHYSX_SRC_NOFILTER
 	"BsPhysXCapsuleCollider.cpp"
 	"BsPhysXMesh.cpp"
 	"BsPhysXMeshCollider.cpp"
+	"BsPhysXHeightFieldCollider.cpp"
 	"BsFPhysXJoint.cpp"
 	"BsPhysXFixedJoint.cpp"
 	"BsPhysXDistanceJoint.cpp"
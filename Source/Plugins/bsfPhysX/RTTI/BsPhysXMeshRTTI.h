@@ -19,6 +19,7 @@ namespace bs
 	private:
 		SPtr<DataStream> getCookedData(FPhysXMesh* obj, UINT32& size)
 		{
+			obj->blockUntilCooked();
 			size = obj->mCookedDataSize;
 
 			return bs_shared_ptr_new<MemoryDataStream>(obj->mCookedData, obj->mCookedDataSize, false);
@@ -32,10 +33,15 @@ namespace bs
 			value->read(obj->mCookedData, size);
 		}
 
+		UINT64& getCookingParamsHash(FPhysXMesh* obj) { return obj->mCookingParamsHash; }
+		void setCookingParamsHash(FPhysXMesh* obj, UINT64& value) { obj->mCookingParamsHash = value; }
+
 	public:
 		FPhysXMeshRTTI()
 		{
 			addDataBlockField("mCookedData", 0, &FPhysXMeshRTTI::getCookedData, &FPhysXMeshRTTI::setCookedData, 0);
+			addPlainField("mCookingParamsHash", 1, &FPhysXMeshRTTI::getCookingParamsHash,
+				&FPhysXMeshRTTI::setCookingParamsHash);
 		}
 
 		/** @copydoc IReflectable::onDeserializationEnded */
@@ -43,6 +49,7 @@ namespace bs
 		{
 			FPhysXMesh* mesh = static_cast<FPhysXMesh*>(obj);
 			mesh->initialize();
+			mesh->recookIfStale();
 		}
 
 		const String& getRTTIName() override
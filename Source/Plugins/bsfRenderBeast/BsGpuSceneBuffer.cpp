@@ -0,0 +1,101 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsGpuSceneBuffer.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs { namespace ct
+{
+	void GpuSceneBuffer::setObject(UINT32 id, const PerObjectInstanceData& data, const Bounds& bounds)
+	{
+		assert(id <= mNumObjects);
+
+		if(id == mNumObjects)
+		{
+			mNumObjects++;
+			mData.resize(mNumObjects * NUM_ENTRIES);
+		}
+
+		Vector4* entries = &mData[id * NUM_ENTRIES];
+		for(UINT32 i = 0; i < PerObjectInstanceData::NUM_ENTRIES; i++)
+			entries[i] = data.entries[i];
+
+		const AABox& box = bounds.getBox();
+		entries[PerObjectInstanceData::NUM_ENTRIES + 0] = Vector4(box.getCenter(), bounds.getSphere().getRadius());
+		entries[PerObjectInstanceData::NUM_ENTRIES + 1] = Vector4(box.getHalfSize(), 0.0f);
+
+		mDirtyObjects.push_back(id);
+	}
+
+	void GpuSceneBuffer::removeObject(UINT32 id)
+	{
+		assert(id < mNumObjects);
+
+		UINT32 lastId = mNumObjects - 1;
+		if(id != lastId)
+		{
+			memcpy(&mData[id * NUM_ENTRIES], &mData[lastId * NUM_ENTRIES], NUM_ENTRIES * sizeof(Vector4));
+			mDirtyObjects.push_back(id);
+		}
+
+		mNumObjects--;
+		mData.resize(mNumObjects * NUM_ENTRIES);
+	}
+
+	void GpuSceneBuffer::update()
+	{
+		if(mNumObjects == 0)
+		{
+			mDirtyObjects.clear();
+			return;
+		}
+
+		const UINT32 entrySize = NUM_ENTRIES * sizeof(Vector4);
+		if(mBuffer == nullptr || mBuffer->getProperties().getElementCount() < mNumObjects * NUM_ENTRIES)
+		{
+			GPU_BUFFER_DESC desc;
+			desc.elementCount = Bitwise::nextPow2(mNumObjects) * NUM_ENTRIES;
+			desc.elementSize = 0;
+			desc.format = BF_32X4F;
+			desc.type = GBT_STANDARD;
+
+			mBuffer = GpuBuffer::create(desc);
+
+			// New buffer, everything needs to be uploaded
+			mBuffer->writeData(0, mNumObjects * entrySize, mData.data());
+			mDirtyObjects.clear();
+			return;
+		}
+
+		if(mDirtyObjects.empty())
+			return;
+
+		// Coalesce sequential objects so they can be uploaded using a single write
+		std::sort(mDirtyObjects.begin(), mDirtyObjects.end());
+
+		const UINT32 numDirty = (UINT32)mDirtyObjects.size();
+		for(UINT32 i = 0; i < numDirty;)
+		{
+			UINT32 rangeStart = mDirtyObjects[i];
+			UINT32 rangeEnd = rangeStart + 1;
+
+			for(i++; i < numDirty; i++)
+			{
+				if(mDirtyObjects[i] > rangeEnd)
+					break;
+
+				rangeEnd = mDirtyObjects[i] + 1;
+			}
+
+			// Objects might have been removed since they were modified
+			rangeEnd = std::min(rangeEnd, mNumObjects);
+			if(rangeStart >= rangeEnd)
+				continue;
+
+			mBuffer->writeData(rangeStart * entrySize, (rangeEnd - rangeStart) * entrySize,
+				&mData[rangeStart * NUM_ENTRIES]);
+		}
+
+		mDirtyObjects.clear();
+	}
+}}
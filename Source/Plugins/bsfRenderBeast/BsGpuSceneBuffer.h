@@ -0,0 +1,55 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Math/BsBounds.h"
+#include "BsRendererObject.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Persistent GPU buffer containing per-object data for all renderables in the scene, indexed by renderable ID. A CPU
+	 * copy of the data is kept, and only the ranges of objects that were modified are uploaded to the GPU.
+	 *
+	 * Each object is represented by NUM_ENTRIES 4-component float entries: all entries of PerObjectInstanceData, followed
+	 * by the world space bounds stored as (box center, sphere radius) and (box extents, 0).
+	 */
+	class GpuSceneBuffer
+	{
+	public:
+		/** Number of 4-component entries used for storing the data of a single object. */
+		static constexpr UINT32 NUM_ENTRIES = PerObjectInstanceData::NUM_ENTRIES + 2;
+
+		/**
+		 * Updates the data of the object with the specified ID, and marks it for upload. Objects must be added with
+		 * sequential IDs.
+		 */
+		void setObject(UINT32 id, const PerObjectInstanceData& data, const Bounds& bounds);
+
+		/**
+		 * Removes the object with the specified ID. The object with the last ID is moved in its place, the same way
+		 * renderer IDs are re-assigned when a renderable is removed.
+		 */
+		void removeObject(UINT32 id);
+
+		/** Uploads the data of all objects modified since the last call. Must be called on the core thread. */
+		void update();
+
+		/** Returns the GPU buffer containing the data of all objects. Only valid after update() has been called. */
+		const SPtr<GpuBuffer>& getBuffer() const { return mBuffer; }
+
+	private:
+		Vector<Vector4> mData;
+		Vector<UINT32> mDirtyObjects;
+		UINT32 mNumObjects = 0;
+
+		SPtr<GpuBuffer> mBuffer;
+	};
+
+	/** @} */
+}}
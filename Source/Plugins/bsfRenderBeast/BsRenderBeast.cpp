@@ -12,6 +12,7 @@
 #include "RenderAPI/BsGpuParamBlockBuffer.h"
 #include "Profiling/BsProfilerCPU.h"
 #include "Profiling/BsProfilerGPU.h"
+#include "RenderAPI/BsTimerQuery.h"
 #include "Utility/BsTime.h"
 #include "Animation/BsAnimationManager.h"
 #include "Animation/BsSkeleton.h"
@@ -52,6 +53,13 @@ namespace bs { namespace ct
 	{
 		Renderer::initialize();
 
+		// Tile-based GPUs are usually limited by memory bandwidth, so default to the smaller render target formats
+		if (bs::RenderAPI::getAPIInfo().isFlagSet(RenderAPIFeatureFlag::TileBasedGPU))
+		{
+			mOptions->gbufferLayout = RenderBeastGBufferLayout::Compact;
+			mOptions->compactSceneColor = true;
+		}
+
 		gCoreThread().queueCommand(std::bind(&RenderBeast::initializeCore, this), CTQF_InternalQueue);
 	}
 
@@ -82,9 +90,10 @@ namespace bs { namespace ct
 		RendererTextures::startUp();
 
 		mCoreOptions = bs_shared_ptr_new<RenderBeastOptions>(); 
+		GpuResourcePool::instance().setMemoryBudget((UINT64)mCoreOptions->resourcePoolBudget * 1024 * 1024);
 		mScene = bs_shared_ptr_new<RendererScene>(mCoreOptions);
 
-		mMainViewGroup = bs_new<RendererViewGroup>();
+		mMainViewGroup = bs_new<RendererViewGroup, RendererAlloc>();
 
 		StandardDeferred::startUp();
 
@@ -101,8 +110,10 @@ namespace bs { namespace ct
 		RenderCompositor::registerNodeType<RCNodeTonemapping>();
 		RenderCompositor::registerNodeType<RCNodeGaussianDOF>();
 		RenderCompositor::registerNodeType<RCNodeFXAA>();
+		RenderCompositor::registerNodeType<RCNodeTemporalAA>();
 		RenderCompositor::registerNodeType<RCNodeResolvedSceneDepth>();
 		RenderCompositor::registerNodeType<RCNodeHiZ>();
+		RenderCompositor::registerNodeType<RCNodeOcclusionCulling>();
 		RenderCompositor::registerNodeType<RCNodeSSAO>();
 		RenderCompositor::registerNodeType<RCNodeClusteredForward>();
 		RenderCompositor::registerNodeType<RCNodeSSR>();
@@ -114,13 +125,16 @@ namespace bs { namespace ct
 		// Make sure all tasks finish first
 		processTasks(true);
 
+		mTimeSliceQueries.clear();
+		mFreeTimeSliceQueries.clear();
+
 		mScene = nullptr;
 
 		RenderCompositor::cleanUp();
 
 		StandardDeferred::shutDown();
 
-		bs_delete(mMainViewGroup);
+		bs_delete<RendererViewGroup, RendererAlloc>(mMainViewGroup);
 
 		RendererTextures::shutDown();
 		IBLUtility::shutDown();
@@ -217,6 +231,9 @@ namespace bs { namespace ct
 	{
 		mOptions = std::static_pointer_cast<RenderBeastOptions>(options);
 		mOptionsDirty = true;
+
+		if (AnimationManager::isStarted())
+			gAnimation().setGPUMorphBlending(mOptions->computeMorphShapes);
 	}
 
 	SPtr<RendererOptions> RenderBeast::getOptions() const
@@ -239,6 +256,11 @@ namespace bs { namespace ct
 
 		ShadowRendering& shadowRenderer = mMainViewGroup->getShadowRenderer();
 		shadowRenderer.setShadowMapSize(mCoreOptions->shadowMapSize);
+		shadowRenderer.setShadowMapUpdateBudget(mCoreOptions->shadowMapUpdateBudget);
+
+		mMainViewGroup->setAsyncCompute(mCoreOptions->asyncCompute);
+
+		GpuResourcePool::instance().setMemoryBudget((UINT64)mCoreOptions->resourcePoolBudget * 1024 * 1024);
 	}
 
 	ShaderExtensionPointInfo RenderBeast::getShaderExtensionPointInfo(const String& name)
@@ -325,6 +347,7 @@ namespace bs { namespace ct
 
 		// Update global per-frame hardware buffers
 		mScene->setParamFrameParams(timings.time);
+		mScene->updateRenderableData();
 
 		// Retrieve animation data
 		sceneInfo.renderableReady.resize(sceneInfo.renderables.size(), false);
@@ -338,6 +361,9 @@ namespace bs { namespace ct
 		// Update reflection probe array if required
 		updateReflProbeArray();
 
+		// Note: Only available after a delay of a few frames, as the GPU needs to finish executing them first
+		float gpuFrameTime = gProfilerGPU().getLastFrameTime();
+
 		// Gather all views
 		for (auto& rtInfo : sceneInfo.renderTargets)
 		{
@@ -350,6 +376,8 @@ namespace bs { namespace ct
 			{
 				UINT32 viewIdx = sceneInfo.cameraToView.at(cameras[i]);
 				RendererView* viewInfo = sceneInfo.views[viewIdx];
+				viewInfo->updateResolutionScale(gpuFrameTime);
+
 				views.push_back(viewInfo);
 			}
 
@@ -363,10 +391,88 @@ namespace bs { namespace ct
 				RenderAPI::instance().swapBuffers(rtInfo.target);
 		}
 
+		GpuResourcePool::instance()._update();
+
 		gProfilerGPU().endFrame();
 		gProfilerCPU().endSample("renderAllCore");
 	}
 
+	void RenderBeast::processTimeSlicedTasks(const Vector<SPtr<RendererTask>>& tasks)
+	{
+		// Update the estimated cost of a single step, using measurements from previous frames
+		UINT32 numResolvedQueries = 0;
+		for (auto& entry : mTimeSliceQueries)
+		{
+			if (!entry.query->isReady())
+				break;
+
+			float stepCost = entry.query->getTimeMs() / entry.numSteps;
+			if (mTimeSliceStepCost > 0.0f)
+				mTimeSliceStepCost = mTimeSliceStepCost * 0.9f + stepCost * 0.1f;
+			else
+				mTimeSliceStepCost = stepCost;
+
+			mFreeTimeSliceQueries.push_back(entry.query);
+			numResolvedQueries++;
+		}
+
+		mTimeSliceQueries.erase(mTimeSliceQueries.begin(), mTimeSliceQueries.begin() + numResolvedQueries);
+
+		// Prioritize tasks closest to any of the views
+		const SceneInfo& sceneInfo = mScene->getSceneInfo();
+
+		Vector<std::pair<float, RendererTask*>> sortedTasks;
+		sortedTasks.reserve(tasks.size());
+
+		for (auto& entry : tasks)
+		{
+			float minDistance = std::numeric_limits<float>::max();
+			for (auto& view : sceneInfo.views)
+			{
+				const Vector3& viewOrigin = view->getProperties().viewOrigin;
+				minDistance = std::min(minDistance, entry->getLocation().squaredDistance(viewOrigin));
+			}
+
+			sortedTasks.push_back(std::make_pair(minDistance, entry.get()));
+		}
+
+		std::stable_sort(sortedTasks.begin(), sortedTasks.end(), 
+			[](const std::pair<float, RendererTask*>& a, const std::pair<float, RendererTask*>& b)
+		{
+			return a.first < b.first;
+		});
+
+		SPtr<TimerQuery> query;
+		if (!mFreeTimeSliceQueries.empty())
+		{
+			query = mFreeTimeSliceQueries.back();
+			mFreeTimeSliceQueries.pop_back();
+		}
+		else
+			query = TimerQuery::create();
+
+		query->begin();
+
+		// Execute a single step of each task until the budget is spent. Until the cost of a step is known, only execute
+		// one step per frame.
+		float budget = mCoreOptions->timeSlicedTaskBudget;
+		float estimatedTime = 0.0f;
+		UINT32 numSteps = 0;
+		for (auto& entry : sortedTasks)
+		{
+			if (numSteps > 0 && (mTimeSliceStepCost <= 0.0f || (estimatedTime + mTimeSliceStepCost) > budget))
+				break;
+
+			executeTaskStep(*entry.second);
+
+			estimatedTime += mTimeSliceStepCost;
+			numSteps++;
+		}
+
+		query->end();
+		mTimeSliceQueries.push_back({ query, numSteps });
+	}
+
 	void RenderBeast::renderViews(RendererViewGroup& viewGroup, const FrameInfo& frameInfo)
 	{
 		const SceneInfo& sceneInfo = mScene->getSceneInfo();
@@ -376,6 +482,10 @@ namespace bs { namespace ct
 		ShadowRendering& shadowRenderer = viewGroup.getShadowRenderer();
 		shadowRenderer.renderShadowMaps(*mScene, viewGroup, frameInfo);
 
+		// Shadow maps don't depend on any asynchronous compute work, so submit them separately and allow them to overlap
+		if(mCoreOptions->asyncCompute)
+			RenderAPI::instance().submitCommandBuffer(nullptr, viewGroup.getAsyncComputeSyncMask());
+
 		// Update various buffers required by each renderable
 		UINT32 numRenderables = (UINT32)sceneInfo.renderables.size();
 		for (UINT32 i = 0; i < numRenderables; i++)
@@ -406,6 +516,10 @@ namespace bs { namespace ct
 		const SceneInfo& sceneInfo = mScene->getSceneInfo();
 		auto& viewProps = view.getProperties();
 
+		// Projection jitter changes every frame
+		if(view.getRenderSettings().enableTemporalAA)
+			view.updatePerViewBuffer();
+
 		SPtr<GpuParamBlockBuffer> perCameraBuffer = view.getPerViewBuffer();
 		perCameraBuffer->flushToGPU();
 
@@ -650,8 +764,13 @@ namespace bs { namespace ct
 		// flip is required due to the fact how cubemap faces are defined. Another option would be to change the view
 		// orientation matrix, but that also requires a culling mode flip which is inconvenient to do globally.
 		RendererView views[6];
+		RendererView* viewPtrs[6];
+		UINT32 numViews = 0;
 		for(UINT32 i = 0; i < 6; i++)
 		{
+			if (settings.face >= 0 && (UINT32)settings.face != i)
+				continue;
+
 			// Calculate view matrix
 			Vector3 forward;
 			Vector3 up = Vector3::UNIT_Y;
@@ -712,14 +831,16 @@ namespace bs { namespace ct
 			
 			viewDesc.target.target = RenderTexture::create(cubeFaceRTDesc);
 
-			views[i].setView(viewDesc);
-			views[i].setRenderSettings(renderSettings);
-			views[i].updatePerViewBuffer();
-		}
+			RendererView& view = views[numViews];
+			view.setView(viewDesc);
+			view.setRenderSettings(renderSettings);
+			view.updatePerViewBuffer();
 
-		RendererView* viewPtrs[] = { &views[0], &views[1], &views[2], &views[3], &views[4], &views[5] };
+			viewPtrs[numViews] = &view;
+			numViews++;
+		}
 
-		RendererViewGroup viewGroup(viewPtrs, 6, mCoreOptions->shadowMapSize);
+		RendererViewGroup viewGroup(viewPtrs, numViews, mCoreOptions->shadowMapSize);
 		viewGroup.determineVisibility(sceneInfo);
 
 		FrameInfo frameInfo({ 0.0f, 1.0f / 60.0f, 0 });
@@ -53,6 +53,13 @@ namespace bs
 			UINT32 matVersion;
 		};
 
+		/** Measures the GPU time of time-sliced task steps executed during a single frame. */
+		struct TimeSliceQuery
+		{
+			SPtr<TimerQuery> query;
+			UINT32 numSteps;
+		};
+
 	public:
 		RenderBeast();
 		~RenderBeast() { }
@@ -140,6 +147,14 @@ namespace bs
 		/** @copydoc Renderer::notifySkyboxRemoved */
 		void notifySkyboxRemoved(Skybox* skybox) override;
 
+		/** 
+		 * @copydoc Renderer::processTimeSlicedTasks 
+		 *
+		 * Executes a single step of tasks closest to any of the scene views, until the estimated GPU time of the executed
+		 * steps reaches RenderBeastOptions::timeSlicedTaskBudget.
+		 */
+		void processTimeSlicedTasks(const Vector<SPtr<RendererTask>>& tasks) override;
+
 		/**
 		 * Updates the render options on the core thread.
 		 *
@@ -198,6 +213,11 @@ namespace bs
 		// Helpers to avoid memory allocations
 		RendererViewGroup* mMainViewGroup = nullptr;
 
+		// Time-sliced task scheduling
+		Vector<TimeSliceQuery> mTimeSliceQueries;
+		Vector<SPtr<TimerQuery>> mFreeTimeSliceQueries;
+		float mTimeSliceStepCost = 0.0f;
+
 		// Sim thread only fields
 		SPtr<RenderBeastOptions> mOptions;
 		bool mOptionsDirty = true;
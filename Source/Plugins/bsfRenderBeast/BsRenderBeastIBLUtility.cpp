@@ -388,37 +388,50 @@ namespace bs { namespace ct
 			scratchCubemap = Texture::create(cubemapDesc);
 		}
 
+		UINT32 step = 0;
+		while (!filterCubemapForSpecular(cubemap, scratchCubemap, step))
+			step++;
+	}
+
+	bool RenderBeastIBLUtility::filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch,
+		UINT32 step) const
+	{
+		auto& props = cubemap->getProperties();
+
 		// We sample the cubemaps using importance sampling to generate roughness
 		UINT32 numMips = props.getNumMipmaps();
 
-		// Before importance sampling the cubemaps we first create box filtered versions for each mip level. This helps fix
-		// the aliasing artifacts that would otherwise be noticeable on importance sampled cubemaps. The aliasing happens
-		// because: 
-		//  1. We use the same random samples for all pixels, which appears to duplicate reflections instead of creating
-		//     noise, which is usually more acceptable 
-		//  2. Even if we were to use fully random samples we would need a lot to avoid noticeable noise, which isn't
-		//     practical
-
-		// Copy base mip level to scratch cubemap
-		for (UINT32 face = 0; face < 6; face++)
+		if (step == 0)
 		{
-			TEXTURE_COPY_DESC copyDesc;
-			copyDesc.srcFace = face;
-			copyDesc.dstFace = face;
+			// Before importance sampling the cubemaps we first create box filtered versions for each mip level. This
+			// helps fix the aliasing artifacts that would otherwise be noticeable on importance sampled cubemaps. The
+			// aliasing happens because: 
+			//  1. We use the same random samples for all pixels, which appears to duplicate reflections instead of
+			//     creating noise, which is usually more acceptable 
+			//  2. Even if we were to use fully random samples we would need a lot to avoid noticeable noise, which isn't
+			//     practical
+
+			// Copy base mip level to scratch cubemap
+			for (UINT32 face = 0; face < 6; face++)
+			{
+				TEXTURE_COPY_DESC copyDesc;
+				copyDesc.srcFace = face;
+				copyDesc.dstFace = face;
 
-			cubemap->copy(scratchCubemap, copyDesc);
-		}
+				cubemap->copy(scratch, copyDesc);
+			}
 
-		// Fill out remaining scratch mip levels by downsampling
-		for (UINT32 mip = 1; mip < numMips; mip++)
-		{
-			UINT32 sourceMip = mip - 1;
-			downsampleCubemap(scratchCubemap, sourceMip, scratchCubemap, mip);
+			// Fill out remaining scratch mip levels by downsampling
+			for (UINT32 mip = 1; mip < numMips; mip++)
+			{
+				UINT32 sourceMip = mip - 1;
+				downsampleCubemap(scratch, sourceMip, scratch, mip);
+			}
 		}
-
-		// Importance sample
-		for (UINT32 mip = 1; mip < numMips; mip++)
+		else if (step < numMips)
 		{
+			// Importance sample a single mip level
+			UINT32 mip = step;
 			for (UINT32 face = 0; face < 6; face++)
 			{
 				RENDER_TEXTURE_DESC cubeFaceRTDesc;
@@ -430,12 +443,14 @@ namespace bs { namespace ct
 				SPtr<RenderTarget> target = RenderTexture::create(cubeFaceRTDesc);
 
 				ReflectionCubeImportanceSampleMat* material = ReflectionCubeImportanceSampleMat::get();
-				material->execute(scratchCubemap, face, mip, target);
+				material->execute(scratch, face, mip, target);
 			}
 		}
 
 		RenderAPI& rapi = RenderAPI::instance();
 		rapi.setRenderTarget(nullptr);
+
+		return step + 1 >= numMips;
 	}
 
 	bool supportsComputeSH()
@@ -124,7 +124,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("SH_ORDER", shOrder)
 			});
 
@@ -177,7 +177,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("SH_ORDER", shOrder)
 			});
 
@@ -349,9 +349,13 @@ namespace bs { namespace ct
 	class RenderBeastIBLUtility : public IBLUtility
 	{
 	public:
-		/** @copydoc IBLUtility::filterCubemapForSpecular */
+		/** @copydoc IBLUtility::filterCubemapForSpecular(const SPtr<Texture>&, const SPtr<Texture>&) const */
 		void filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch) const override;
 
+		/** @copydoc IBLUtility::filterCubemapForSpecular(const SPtr<Texture>&, const SPtr<Texture>&, UINT32) const */
+		bool filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch, 
+			UINT32 step) const override;
+
 		/** @copydoc IBLUtility::filterCubemapForIrradiance(const SPtr<Texture>&, const SPtr<Texture>&) const */
 		void filterCubemapForIrradiance(const SPtr<Texture>& cubemap, const SPtr<Texture>& output) const override;
 
@@ -20,6 +20,19 @@ namespace bs { namespace ct
 		Anisotropic /**< High quality dynamic filtering that improves quality of angled surfaces */
 	};
 
+	/** Determines the formats of the render targets the base pass writes surface properties to. */
+	enum class RenderBeastGBufferLayout
+	{
+		/** Roughness and metalness are stored with 16-bit floating point precision. */
+		Standard,
+		/**
+		 * Roughness and metalness are stored with 8-bit precision, reducing the size of the GBuffer by two bytes per
+		 * sample. Shaders write the values unchanged, as both are in [0, 1] range and are quantized to 1/255 steps by
+		 * the normalized format.
+		 */
+		Compact
+	};
+
 	/** A set of options used for controlling the rendering of the RenderBeast renderer. */
 	struct RenderBeastOptions : public RendererOptions
 	{
@@ -43,6 +56,101 @@ namespace bs { namespace ct
 		 * shadows far away, but will never increase the resolution past the provided value.
 		 */
 		UINT32 shadowMapSize = 2048;
+
+		/**
+		 * Maximum number of spot and radial light shadow maps that will be re-rendered per frame. Lights that cover
+		 * more of the screen are updated every frame, while the rest are updated in a round-robin fashion and reuse
+		 * their last rendered shadow map in between. Set to zero to update all shadow maps every frame.
+		 */
+		UINT32 shadowMapUpdateBudget = 0;
+
+		/**
+		 * When enabled, objects hidden behind other objects will be culled using GPU occlusion tests against the depth
+		 * buffer. Results of the tests are available with a delay of at least one frame, so objects that become visible
+		 * might appear a frame late. Only supported on feature sets with compute shader support.
+		 */
+		bool occlusionCulling = false;
+
+		/**
+		 * When enabled, compute work that doesn't depend on the current frame's rasterization output (such as light grid
+		 * generation for clustered forward rendering) is submitted to an asynchronous compute queue, allowing it to
+		 * overlap with shadow map rendering. Only has an effect on render backends and devices that expose a separate
+		 * compute queue, and falls back to regular execution otherwise.
+		 *
+		 * This also switches eye adaptation to use the luminance of the previous frame, so its histogram can be
+		 * generated on the same queue. Exposure therefore reacts to changes in the scene one frame later.
+		 */
+		bool asyncCompute = false;
+
+		/**
+		 * Margin by which the size of an object on screen must pass the screen size of a mesh level of detail before the
+		 * renderer switches to that level, as a fraction of the level's screen size. Higher values reduce switching
+		 * between levels when objects are close to the switch point, at the cost of switching later.
+		 */
+		float lodHysteresis = 0.1f;
+
+		/**
+		 * When enabled, skinned meshes are animated once per frame in a compute pass that writes the animated vertices
+		 * into a vertex buffer cached for each object. All passes that render the object (base pass, shadows, forward
+		 * passes) then draw those vertices as a static mesh, instead of each of them repeating the skinning in the
+		 * vertex program. Only supported on feature sets with compute shader support, and on render backends that can
+		 * write to vertex buffers from compute programs. Objects that also use morph shapes, and meshes with vertex 
+		 * layouts the compute pass doesn't support, are skinned in the vertex program as usual. Only affects objects
+		 * added to the scene after the option is changed.
+		 */
+		bool computeSkinning = false;
+
+		/**
+		 * When enabled, morph shapes are blended in a compute pass, from per-shape weights provided by the animation
+		 * system, instead of being blended on the CPU and uploaded every frame. Shape deltas are uploaded to the GPU once
+		 * per mesh and shared between all objects using it. Only supported on feature sets with compute shader support,
+		 * and on render backends that can write to vertex buffers from compute programs, otherwise morph shapes are
+		 * blended on the CPU by the render thread. Only affects objects added to the scene after the option is changed.
+		 */
+		bool computeMorphShapes = false;
+
+		/**
+		 * When enabled, execution of each render compositor node is wrapped in a ProfilerGPU sample named after the
+		 * node, reporting the GPU time, draw statistics and the number of drawn samples of individual rendering passes.
+		 * Adds a timer and an occlusion query per node, and can be disabled to avoid that overhead. CPU samples for each
+		 * node are always recorded.
+		 */
+		bool profileCompositorNodes = true;
+
+		/**
+		 * Maximum GPU time, in milliseconds, to spend each frame on time-sliced renderer tasks, such as capturing and
+		 * filtering reflection probes. Such tasks are split into small steps (e.g. rendering a single cubemap face or
+		 * filtering a single mip level), which are executed in order of proximity to the viewer until the budget is
+		 * spent. The cost of a step is estimated from GPU timings of previous frames. At least one step is executed each
+		 * frame, regardless of the budget.
+		 */
+		float timeSlicedTaskBudget = 1.0f;
+
+		/**
+		 * Amount of GPU memory, in megabytes, that pooled render targets and buffers used for intermediate rendering
+		 * results should stay under. When exceeded, pooled resources not used in the current frame are released, least
+		 * recently used first. Zero means no budget, in which case unused resources are only released after not being
+		 * used for a while.
+		 */
+		UINT32 resourcePoolBudget = 512;
+
+		/**
+		 * Determines the formats of the GBuffer render targets. The compact layout reduces the memory bandwidth used by
+		 * the base pass and by all the lighting passes that read the GBuffer, at a small cost in precision. Defaults to
+		 * the compact layout on tile-based GPUs.
+		 */
+		RenderBeastGBufferLayout gbufferLayout = RenderBeastGBufferLayout::Standard;
+
+		/**
+		 * When enabled, lighting is accumulated in a scene color target using a packed 32-bit floating point format
+		 * with no alpha channel (PF_RG11B10F), instead of a 64-bit one (PF_RGBA16F), at the cost of lower color
+		 * precision. Enabled by default on tile-based GPUs.
+		 *
+		 * Without MSAA, tiled deferred image based lighting writes to scene color as a load-store texture. On devices
+		 * that don't support load-store access to PF_RG11B10F textures this option is ignored in that case, and
+		 * scene color stays PF_RGBA16F.
+		 */
+		bool compactSceneColor = false;
 	};
 
 	/** @} */
@@ -31,6 +31,8 @@ namespace bs { namespace ct
 
 	struct RenderBeastOptions;
 	struct PooledRenderTexture;
+	struct PooledVertexBuffer;
+	class GpuMorphShapes;
 	class RenderTargets;
 	class RendererView;
 	struct LightData;
@@ -6,8 +6,14 @@
 #include "Renderer/BsCamera.h"
 #include "Renderer/BsRendererUtility.h"
 #include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsCommandBuffer.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Profiling/BsProfilerCPU.h"
+#include "Profiling/BsProfilerGPU.h"
+#include "Profiling/BsRenderStats.h"
 #include "Utility/BsBitwise.h"
 #include "Mesh/BsMesh.h"
+#include "Managers/BsTextureManager.h"
 #include "Material/BsGpuParamsSet.h"
 #include "Utility/BsGpuResourcePool.h"
 #include "Utility/BsRendererTextures.h"
@@ -17,6 +23,7 @@
 #include "Shading/BsPostProcessing.h"
 #include "Shading/BsShadowRendering.h"
 #include "Shading/BsLightGrid.h"
+#include "Shading/BsOcclusionCulling.h"
 #include "BsRendererView.h"
 #include "BsRenderBeastOptions.h"
 #include "BsRendererScene.h"
@@ -85,6 +92,8 @@ namespace bs { namespace ct
 					NodeInfo& nodeInfo = mNodeInfos.back();
 					nodeInfo.node = nodeType->create();
 					nodeInfo.lastUseIdx = -1;
+					nodeInfo.name = nodeId.cstr();
+					nodeInfo.id = nodeId;
 
 					for (auto& depId : depIds)
 					{
@@ -127,43 +136,50 @@ namespace bs { namespace ct
 
 			if (!mIsValid)
 				clear();
+			else
+				computeReleasePoints();
 		}
 		bs_frame_clear();
 	}
 
+	void RenderCompositor::computeReleasePoints()
+	{
+		// Nodes are registered in dependency order, so a node can be cleared right after its last dependant. The final
+		// node has no dependants and is cleared once the whole hierarchy executes.
+		for (auto& entry : mNodeInfos)
+		{
+			if (entry.lastUseIdx == (UINT32)-1)
+				continue;
+
+			mNodeInfos[entry.lastUseIdx].nodesToClear.push_back(entry.node);
+		}
+	}
+
 	void RenderCompositor::execute(RenderCompositorNodeInputs& inputs) const
 	{
 		if (!mIsValid)
 			return;
 
-		bs_frame_mark();
+		bool profileNodesGPU = inputs.options.profileCompositorNodes;
+
+		for (auto& entry : mNodeInfos)
 		{
-			FrameVector<const NodeInfo*> activeNodes;
+			inputs.inputNodes = entry.inputs;
 
-			UINT32 idx = 0;
-			for (auto& entry : mNodeInfos)
-			{
-				inputs.inputNodes = entry.inputs;
-				entry.node->render(inputs);
+			// CPU samples measure the time spent recording the node's commands
+			gProfilerCPU().beginSample(entry.id);
+			if (profileNodesGPU)
+				gProfilerGPU().beginSample(entry.name);
 
-				activeNodes.push_back(&entry);
+			entry.node->render(inputs);
 
-				for (UINT32 i = 0; i < (UINT32)activeNodes.size(); ++i)
-				{
-					if (activeNodes[i] == nullptr)
-						continue;
-
-					if (activeNodes[i]->lastUseIdx <= idx)
-					{
-						activeNodes[i]->node->clear();
-						activeNodes[i] = nullptr;
-					}
-				}
+			if (profileNodesGPU)
+				gProfilerGPU().endSample(entry.name);
+			gProfilerCPU().endSample(entry.id);
 
-				idx++;
-			}
+			for (auto& node : entry.nodesToClear)
+				node->clear();
 		}
-		bs_frame_clear();
 
 		if (!mNodeInfos.empty())
 			mNodeInfos.back().node->clear();
@@ -202,6 +218,233 @@ namespace bs { namespace ct
 		return {};
 	}
 
+	/** Minimum number of queue elements recorded into a single command buffer when recording in parallel. */
+	static constexpr UINT32 PARALLEL_RECORD_MIN_ELEMENTS = 256;
+
+	/** Maximum number of command buffers a single render queue is split into when recording in parallel. */
+	static constexpr UINT32 PARALLEL_RECORD_MAX_CHUNKS = 8;
+
+	/** 
+	 * Renders elements in range [@p start, @p end) of a sorted render queue belonging to the provided view. Groups of
+	 * instanced elements are rendered using a single draw call each. The range must not start or end in the middle of an
+	 * instanced group, and @p instancedGroup must point to the first instanced group at or after @p start.
+	 */
+	static void renderQueueElements(const RendererView& view, const SceneInfo& scene, const RenderQueue& queue,
+		UINT32 start, UINT32 end, const InstancedDrawGroup* instancedGroup, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		const RendererInstancing& instancing = view.getInstancing();
+
+		UINT32 prevTechniqueIdx = (UINT32)-1;
+
+		const Vector<RenderQueueElement>& elements = queue.getSortedElements();
+		for (UINT32 i = start; i < end; i++)
+		{
+			const RenderQueueElement& entry = elements[i];
+			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(entry.renderElem);
+
+			const RenderableDrawPacket& packet = renderElem->drawPacket;
+
+			// Queue only tracks pass changes per shader, but elements using the same shader can use different techniques
+			// (e.g. animated and instanced variations). The first element of the range always needs its pass applied, as
+			// the range might be recorded into a fresh command buffer.
+			if (i == start || entry.applyPass || renderElem->techniqueIdx != prevTechniqueIdx)
+			{
+				packet.bindPass(entry.passIdx, commandBuffer);
+				prevTechniqueIdx = renderElem->techniqueIdx;
+			}
+
+			if (renderElem->instanced)
+			{
+				// Groups are stored in queue order, and each instanced element starts a new group unless it was
+				// already rendered as part of the previous one
+				const SPtr<GpuParams>& gpuParams = packet.passes[entry.passIdx].gpuParams;
+				for (UINT32 j = 0; j < GPT_COUNT; j++)
+				{
+					const GpuParamBinding& binding = renderElem->perInstanceBindings[j];
+					if (binding.slot != (UINT32)-1)
+						gpuParams->setParamBlockBuffer(binding.set, binding.slot, instancedGroup->paramBuffer);
+				}
+
+				renderElem->instanceObjectIdsParam.set(instancing.getInstanceBuffer());
+				renderElem->objectDataParam.set(scene.renderableData.getBuffer());
+
+				packet.bindParams(entry.passIdx, commandBuffer);
+
+				const SPtr<GpuBuffer>& argsBuffer = instancing.getArgsBuffer();
+				if (argsBuffer != nullptr)
+					packet.drawIndirect(argsBuffer, instancedGroup->argsOffset, commandBuffer);
+				else
+					packet.draw(instancedGroup->numInstances, commandBuffer);
+
+				i += instancedGroup->numInstances - 1;
+				instancedGroup++;
+				continue;
+			}
+
+			packet.bindParams(entry.passIdx, commandBuffer);
+			packet.draw(1, commandBuffer);
+		}
+	}
+
+	/** 
+	 * Renders all elements of a sorted render queue belonging to the provided view. Groups of instanced elements are
+	 * rendered using a single draw call each.
+	 */
+	static void renderQueueElements(const RendererView& view, const SceneInfo& scene, const RenderQueue& queue)
+	{
+		const InstancedDrawGroup* instancedGroup = view.getInstancing().getGroups(queue);
+		const UINT32 numElements = (UINT32)queue.getSortedElements().size();
+
+		renderQueueElements(view, scene, queue, 0, numElements, instancedGroup, nullptr);
+	}
+
+	/** 
+	 * Uploads all modified parameter block buffers bound to the provided parameters. Binding parameters to a command
+	 * buffer normally does this, but uploads must not be issued from worker threads.
+	 */
+	static void flushParamBlocks(const GpuParams& gpuParams, UINT32 queueIdx)
+	{
+		for (UINT32 i = 0; i < GPT_COUNT; i++)
+		{
+			SPtr<GpuParamDesc> paramDesc = gpuParams.getParamDesc((GpuProgramType)i);
+			if (paramDesc == nullptr)
+				continue;
+
+			for (auto& entry : paramDesc->paramBlocks)
+			{
+				SPtr<GpuParamBlockBuffer> buffer = gpuParams.getParamBlockBuffer(entry.second.set, entry.second.slot);
+				if (buffer != nullptr)
+					buffer->flushToGPU(queueIdx);
+			}
+		}
+	}
+
+	/**
+	 * Renders all elements of a sorted render queue the same as renderQueueElements(), except that the queue is split
+	 * into chunks recorded into separate command buffers on worker threads. Everything queued on the main command buffer
+	 * so far is submitted first, followed by the chunk command buffers in queue order, so the GPU executes the commands
+	 * in the same order as if they were recorded serially.
+	 *
+	 * Falls back to serial recording on the main command buffer if the render API doesn't natively support
+	 * multi-threaded command buffer recording, or if the queue is too small to benefit from it.
+	 *
+	 * @param[in]	view			View the queue belongs to.
+	 * @param[in]	scene			Scene the queue elements belong to.
+	 * @param[in]	queue			Queue whose elements to render. 
+	 * @param[in]	target			Render target the elements are rendered to. Must already be bound on the main command
+	 *								buffer. Contents of all its surfaces are preserved between chunks.
+	 * @param[in]	viewport		Viewport the elements are rendered to, in normalized coordinates. Must already be
+	 *								set on the main command buffer.
+	 * @param[in]	commandBuffers	Command buffers to record the chunks into. Populated as needed and re-used between
+	 *								calls.
+	 */
+	static void renderQueueElementsParallel(const RendererView& view, const SceneInfo& scene, const RenderQueue& queue,
+		const SPtr<RenderTarget>& target, const Rect2& viewport, Vector<SPtr<CommandBuffer>>& commandBuffers)
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+
+		const Vector<RenderQueueElement>& elements = queue.getSortedElements();
+		const UINT32 numElements = (UINT32)elements.size();
+
+		const bool multiThreadedCB = rapi.getAPIInfo().isFlagSet(RenderAPIFeatureFlag::MultiThreadedCB);
+		if (!multiThreadedCB || numElements < PARALLEL_RECORD_MIN_ELEMENTS * 2)
+		{
+			renderQueueElements(view, scene, queue);
+			return;
+		}
+
+		/** Range of queue elements recorded into a single command buffer. */
+		struct Chunk
+		{
+			UINT32 start;
+			UINT32 end;
+			const InstancedDrawGroup* instancedGroup;
+		};
+
+		const UINT32 numWorkers = std::max(1U, TaskScheduler::instance().getNumWorkers());
+		const UINT32 maxChunks = std::min(numWorkers, PARALLEL_RECORD_MAX_CHUNKS);
+		const UINT32 chunkSize = std::max(PARALLEL_RECORD_MIN_ELEMENTS, Math::divideAndRoundUp(numElements, maxChunks));
+
+		bs_frame_mark();
+		{
+			FrameVector<Chunk> chunks;
+
+			// Split the queue so that instanced groups never cross chunk boundaries
+			const InstancedDrawGroup* instancedGroup = view.getInstancing().getGroups(queue);
+
+			Chunk chunk = { 0, 0, instancedGroup };
+			for (UINT32 i = 0; i < numElements;)
+			{
+				const auto* renderElem = static_cast<const BeastRenderableElement*>(elements[i].renderElem);
+				if (renderElem->instanced)
+				{
+					i += instancedGroup->numInstances;
+					instancedGroup++;
+				}
+				else
+					i++;
+
+				if ((i - chunk.start) >= chunkSize || i == numElements)
+				{
+					chunk.end = i;
+					chunks.push_back(chunk);
+
+					chunk.start = i;
+					chunk.instancedGroup = instancedGroup;
+				}
+			}
+
+			// Parameters are uploaded before recording, so the workers only ever bind them
+			const UINT32 queueIdx = CommandSyncMask::getGlobalQueueIdx(GQT_GRAPHICS, 0);
+			for (auto& entry : elements)
+			{
+				const auto* renderElem = static_cast<const BeastRenderableElement*>(entry.renderElem);
+
+				SPtr<GpuParams> gpuParams = renderElem->params->getGpuParams(entry.passIdx);
+				if (gpuParams != nullptr)
+					flushParamBlocks(*gpuParams, queueIdx);
+			}
+
+			// Command buffers must be created on the core thread
+			const UINT32 numChunks = (UINT32)chunks.size();
+			while ((UINT32)commandBuffers.size() < numChunks)
+				commandBuffers.push_back(CommandBuffer::create(GQT_GRAPHICS));
+
+			// Render statistics aren't thread safe, so each chunk collects its own and they're merged after recording
+			FrameVector<RenderStatsData> chunkStats(numChunks);
+
+			TaskScheduler::instance().parallelFor(0, numChunks, 1, 
+				[&view, &scene, &queue, &target, &viewport, &chunks, &commandBuffers, &chunkStats](UINT32 begin, 
+					UINT32 end)
+			{
+				RenderAPI& rapi = RenderAPI::instance();
+				for (UINT32 i = begin; i < end; i++)
+				{
+					const Chunk& chunk = chunks[i];
+					const SPtr<CommandBuffer>& commandBuffer = commandBuffers[i];
+
+					RenderStats::instance().setThreadData(&chunkStats[i]);
+
+					rapi.setRenderTarget(target, 0, RT_ALL | RT_DEPTH_STENCIL, commandBuffer);
+					rapi.setViewport(viewport, commandBuffer);
+
+					renderQueueElements(view, scene, queue, chunk.start, chunk.end, chunk.instancedGroup, commandBuffer);
+
+					RenderStats::instance().setThreadData(nullptr);
+				}
+			});
+
+			for (auto& entry : chunkStats)
+				RenderStats::instance().merge(entry);
+
+			rapi.submitCommandBuffer(nullptr);
+
+			for (UINT32 i = 0; i < numChunks; i++)
+				rapi.submitCommandBuffer(commandBuffers[i]);
+		}
+		bs_frame_clear();
+	}
+
 	void RCNodeGBuffer::render(const RenderCompositorNodeInputs& inputs)
 	{
 		// Allocate necessary textures & targets
@@ -212,13 +455,23 @@ namespace bs { namespace ct
 		UINT32 height = viewProps.viewRect.height;
 		UINT32 numSamples = viewProps.numSamples;
 
-		// Note: Consider customizable formats. e.g. for testing if quality can be improved with higher precision normals.
+		// Roughness and metalness are both in [0, 1] range, so an 8-bit normalized format suffices unless the extra
+		// precision is requested
+		bool compactLayout = inputs.options.gbufferLayout == RenderBeastGBufferLayout::Compact;
+		PixelFormat roughMetalFormat = compactLayout ? PF_RG8 : PF_RG16F;
+
 		albedoTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA8, width, height, TU_RENDERTARGET,
 			numSamples, true));
 		normalTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGB10A2, width, height, TU_RENDERTARGET,
 			numSamples, false));
-		roughMetalTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RG16F, width, height, TU_RENDERTARGET,
-			numSamples, false)); // Note: Metal doesn't need 16-bit float
+		roughMetalTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(roughMetalFormat, width, height,
+			TU_RENDERTARGET, numSamples, false));
+
+		if(inputs.view.getRenderSettings().enableTemporalAA)
+		{
+			velocityTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RG16S, width, height, TU_RENDERTARGET,
+				numSamples, false));
+		}
 
 		RCNodeSceneDepth* sceneDepthNode = static_cast<RCNodeSceneDepth*>(inputs.inputNodes[0]);
 		SPtr<PooledRenderTexture> sceneDepthTex = sceneDepthNode->depthTex;
@@ -229,6 +482,7 @@ namespace bs { namespace ct
 			rebuildRT |= renderTarget->getColorTexture(0) != albedoTex->texture;
 			rebuildRT |= renderTarget->getColorTexture(1) != normalTex->texture;
 			rebuildRT |= renderTarget->getColorTexture(2) != roughMetalTex->texture;
+			rebuildRT |= renderTarget->getColorTexture(3) != (velocityTex != nullptr ? velocityTex->texture : nullptr);
 			rebuildRT |= renderTarget->getDepthStencilTexture() != sceneDepthTex->texture;
 		}
 		else
@@ -252,6 +506,14 @@ namespace bs { namespace ct
 			gbufferDesc.colorSurfaces[2].numFaces = 1;
 			gbufferDesc.colorSurfaces[2].mipLevel = 0;
 
+			if(velocityTex != nullptr)
+			{
+				gbufferDesc.colorSurfaces[3].texture = velocityTex->texture;
+				gbufferDesc.colorSurfaces[3].face = 0;
+				gbufferDesc.colorSurfaces[3].numFaces = 1;
+				gbufferDesc.colorSurfaces[3].mipLevel = 0;
+			}
+
 			gbufferDesc.depthStencilSurface.texture = sceneDepthTex->texture;
 			gbufferDesc.depthStencilSurface.face = 0;
 			gbufferDesc.depthStencilSurface.mipLevel = 0;
@@ -307,32 +569,21 @@ namespace bs { namespace ct
 		// Trigger pre-base-pass callbacks
 		if (sceneCamera != nullptr)
 		{
+			RendererViewContext context;
+			context.target = renderTarget;
+			context.ndcToUV = inputs.view.getNDCToUV();
+			context.perViewBuffer = inputs.view.getPerViewBuffer();
+
 			for(auto& extension : inputs.extPreBasePass)
 			{
 				if (extension->check(*sceneCamera))
-					extension->render(*sceneCamera);
+					extension->renderView(*sceneCamera, context);
 			}
 		}
 
 		// Render all visible opaque elements that use the deferred pipeline
-		const Vector<RenderQueueElement>& opaqueElements = inputs.view.getOpaqueQueue(false)->getSortedElements();
-		for (auto iter = opaqueElements.begin(); iter != opaqueElements.end(); ++iter)
-		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-
-			SPtr<Material> material = renderElem->material;
-
-			if (iter->applyPass)
-				gRendererUtility().setPass(material, iter->passIdx, renderElem->techniqueIdx);
-
-			gRendererUtility().setPassParams(renderElem->params, iter->passIdx);
-
-			if(renderElem->morphVertexDeclaration == nullptr)
-				gRendererUtility().draw(renderElem->mesh, renderElem->subMesh);
-			else
-				gRendererUtility().drawMorph(renderElem->mesh, renderElem->subMesh, renderElem->morphShapeBuffer, 
-					renderElem->morphVertexDeclaration);
-		}
+		renderQueueElementsParallel(inputs.view, inputs.scene, *inputs.view.getOpaqueQueue(false), renderTarget, area,
+			mCommandBuffers);
 
 		// Make sure that any compute shaders are able to read g-buffer by unbinding it
 		rapi.setRenderTarget(nullptr);
@@ -355,6 +606,12 @@ namespace bs { namespace ct
 		resPool.release(albedoTex);
 		resPool.release(normalTex);
 		resPool.release(roughMetalTex);
+
+		if(velocityTex != nullptr)
+		{
+			resPool.release(velocityTex);
+			velocityTex = nullptr;
+		}
 	}
 
 	SmallVector<StringID, 4> RCNodeGBuffer::getDependencies(const RendererView& view)
@@ -362,6 +619,18 @@ namespace bs { namespace ct
 		return { RCNodeSceneDepth::getNodeId() };
 	}
 
+	/** 
+	 * Checks if the device can write to a PF_RG11B10F texture through a load-store binding, as required for compact
+	 * scene color when it is written by tiled deferred image based lighting.
+	 */
+	static bool supportsCompactLoadStoreSceneColor()
+	{
+		static bool supported = bs::TextureManager::instance().getNativeFormat(TEX_TYPE_2D, PF_RG11B10F,
+			TU_RENDERTARGET | TU_LOADSTORE, false) == PF_RG11B10F;
+
+		return supported;
+	}
+
 	void RCNodeSceneColor::render(const RenderCompositorNodeInputs& inputs)
 	{
 		GpuResourcePool& resPool = GpuResourcePool::instance();
@@ -373,12 +642,17 @@ namespace bs { namespace ct
 
 		UINT32 usageFlags = TU_RENDERTARGET;
 
+		// Without MSAA, tiled deferred image based lighting writes directly to scene color through a load-store
+		// binding. It can write the compact format, but not every device supports it for load-store textures.
 		bool tiledDeferredSupported = inputs.featureSet != RenderBeastFeatureSet::DesktopMacOS;
-		if(tiledDeferredSupported)
+		bool sceneColorLoadStore = tiledDeferredSupported && numSamples == 1;
+		if(sceneColorLoadStore)
 			usageFlags |= TU_LOADSTORE;
 
-		// Note: Consider customizable HDR format via options? e.g. smaller PF_FLOAT_R11G11B10 or larger 32-bit format
-		sceneColorTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height, usageFlags, 
+		bool compactSceneColor = inputs.options.compactSceneColor &&
+			(!sceneColorLoadStore || supportsCompactLoadStoreSceneColor());
+		PixelFormat sceneColorFormat = compactSceneColor ? PF_RG11B10F : PF_RGBA16F;
+		sceneColorTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(sceneColorFormat, width, height, usageFlags,
 			numSamples, false));
 
 		RCNodeSceneDepth* sceneDepthNode = static_cast<RCNodeSceneDepth*>(inputs.inputNodes[0]);
@@ -884,11 +1158,15 @@ namespace bs { namespace ct
 				msaaCoverage = coverageNode->output->texture;
 			}
 
-			TiledDeferredImageBasedLightingMat* material = TiledDeferredImageBasedLightingMat::getVariation(viewProps.numSamples);
+			SPtr<Texture> sceneColorTex = sceneColorNode->sceneColorTex->texture;
+			bool compactSceneColor = sceneColorTex->getProperties().getFormat() == PF_RG11B10F;
+
+			TiledDeferredImageBasedLightingMat* material = TiledDeferredImageBasedLightingMat::getVariation(
+				viewProps.numSamples, compactSceneColor);
 
 			TiledDeferredImageBasedLightingMat::Inputs iblInputs;
 			iblInputs.gbuffer = gbuffer;
-			iblInputs.sceneColorTex = sceneColorNode->sceneColorTex->texture;
+			iblInputs.sceneColorTex = sceneColorTex;
 			iblInputs.lightAccumulation = lightAccumNode->lightAccumulationTex->texture;
 			iblInputs.preIntegratedGF = RendererTextures::preintegratedEnvGF;
 			iblInputs.ambientOcclusion = ssaoNode->output;
@@ -1230,34 +1508,25 @@ namespace bs { namespace ct
 		};
 
 		for(UINT32 i = 0; i < bs_size(queues); i++)
-		{
-			const Vector<RenderQueueElement>& elements = queues[i]->getSortedElements();
-			for (auto iter = elements.begin(); iter != elements.end(); ++iter)
-			{
-				BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-				SPtr<Material> material = renderElem->material;
-
-				if (iter->applyPass)
-					gRendererUtility().setPass(material, iter->passIdx, renderElem->techniqueIdx);
-
-				gRendererUtility().setPassParams(renderElem->params, iter->passIdx);
-
-				if (renderElem->morphVertexDeclaration == nullptr)
-					gRendererUtility().draw(renderElem->mesh, renderElem->subMesh);
-				else
-					gRendererUtility().drawMorph(renderElem->mesh, renderElem->subMesh, renderElem->morphShapeBuffer,
-						renderElem->morphVertexDeclaration);
-			}
-		}
+			renderQueueElements(inputs.view, inputs.scene, *queues[i]);
 
 		// Trigger post-lighting callbacks
 		Camera* sceneCamera = inputs.view.getSceneCamera();
 		if (sceneCamera != nullptr)
 		{
+			RendererViewContext context;
+			context.target = renderTarget;
+			context.ndcToUV = inputs.view.getNDCToUV();
+			context.perViewBuffer = inputs.view.getPerViewBuffer();
+
+			// Multisampled depth can't be read as a normal texture
+			if (sceneDepthNode->depthTex->texture->getProperties().getNumSamples() <= 1)
+				context.sceneDepth = sceneDepthNode->depthTex->texture;
+
 			for(auto& extension : inputs.extPostLighting)
 			{
 				if (extension->check(*sceneCamera))
-					extension->render(*sceneCamera);
+					extension->renderView(*sceneCamera, context);
 			}
 		}
 	}
@@ -1320,7 +1589,15 @@ namespace bs { namespace ct
 		const RendererViewProperties& viewProps = inputs.view.getProperties();
 
 		SPtr<Texture> input;
-		if(viewProps.runPostProcessing)
+		bool nativeResolution = inputs.view.getResolutionScale() == 1.0f;
+		if(viewProps.runPostProcessing && inputs.view.getRenderSettings().enableTemporalAA)
+		{
+			// Temporal AA output is already upsampled to native resolution
+			RCNodeTemporalAA* temporalAANode = static_cast<RCNodeTemporalAA*>(inputs.inputNodes[2]);
+			input = temporalAANode->output;
+			nativeResolution = true;
+		}
+		else if(viewProps.runPostProcessing)
 		{
 			RCNodePostProcess* postProcessNode = static_cast<RCNodePostProcess*>(inputs.inputNodes[0]);
 
@@ -1339,7 +1616,16 @@ namespace bs { namespace ct
 		rapi.setRenderTarget(target);
 		rapi.setViewport(viewProps.nrmViewRect);
 
-		gRendererUtility().blit(input, Rect2I::EMPTY, viewProps.flipView);
+		// Scene was rendered at a reduced resolution, upscale to the native resolution before rendering the overlays
+		if(!nativeResolution)
+		{
+			const DynamicResolutionSettings& settings = inputs.view.getRenderSettings().dynamicResolution;
+
+			UpscaleMat* upscaleMat = UpscaleMat::get();
+			upscaleMat->execute(input, settings.sharpness, viewProps.flipView);
+		}
+		else
+			gRendererUtility().blit(input, Rect2I::EMPTY, viewProps.flipView);
 
 		if(viewProps.encodeDepth)
 		{
@@ -1374,6 +1660,9 @@ namespace bs { namespace ct
 		{
 			deps.push_back(RCNodePostProcess::getNodeId());
 			deps.push_back(RCNodeFXAA::getNodeId());
+
+			if(view.getRenderSettings().enableTemporalAA)
+				deps.push_back(RCNodeTemporalAA::getNodeId());
 		}
 		else
 		{
@@ -1384,6 +1673,9 @@ namespace bs { namespace ct
 		if(viewProps.encodeDepth)
 			deps.push_back(RCNodeResolvedSceneDepth::getNodeId());
 
+		if(view.getOcclusionCulling() != nullptr)
+			deps.push_back(RCNodeOcclusionCulling::getNodeId());
+
 		return deps;
 	}
 
@@ -1475,7 +1767,25 @@ namespace bs { namespace ct
 		bool hdr = settings.enableHDR;
 		bool msaa = viewProps.numSamples > 1;
 
-		if(hdr && settings.enableAutoExposure)
+		const SPtr<LatentEyeAdaptation>& latentEyeAdaptation = inputs.view.getLatentEyeAdaptation();
+		if(hdr && settings.enableAutoExposure && latentEyeAdaptation && useHistogramEyeAdapatation(inputs))
+		{
+			// Histogram was generated earlier in the frame from the previous frame's scene color, so only the reduction
+			// remains to be done here
+			SPtr<Texture> prevFrameEyeAdaptation;
+			if (prevEyeAdaptation != nullptr)
+				prevFrameEyeAdaptation = prevEyeAdaptation->texture;
+
+			eyeAdaptation = latentEyeAdaptation->resolve(
+				prevFrameEyeAdaptation,
+				inputs.frameInfo.timeDelta,
+				settings.autoExposure,
+				settings.exposureScale);
+
+			// Keep a low resolution copy of the scene color, to generate the histogram from during the next frame
+			latentEyeAdaptation->storeSceneColor(sceneColor);
+		}
+		else if(hdr && settings.enableAutoExposure)
 		{
 			// Downsample scene
 			DownsampleMat* downsampleMat = DownsampleMat::getVariation(1, msaa);
@@ -1607,7 +1917,8 @@ namespace bs { namespace ct
 			else
 				gammaOnly = true;
 
-			autoExposure = settings.enableAutoExposure;
+			// Eye adaptation might not be available yet if it is calculated with latency
+			autoExposure = settings.enableAutoExposure && eyeAdaptation != nullptr;
 		}
 		else
 		{
@@ -1749,7 +2060,9 @@ namespace bs { namespace ct
 	void RCNodeFXAA::render(const RenderCompositorNodeInputs& inputs)
 	{
 		const RenderSettings& settings = inputs.view.getRenderSettings();
-		if (!settings.enableFXAA)
+
+		// Temporal anti-aliasing supersedes FXAA when enabled
+		if (!settings.enableFXAA || settings.enableTemporalAA)
 			return;
 
 		RCNodePostProcess* postProcessNode = static_cast<RCNodePostProcess*>(inputs.inputNodes[1]);
@@ -1773,6 +2086,80 @@ namespace bs { namespace ct
 		return { RCNodeGaussianDOF::getNodeId(), RCNodePostProcess::getNodeId() };
 	}
 
+	RCNodeTemporalAA::~RCNodeTemporalAA()
+	{
+		deallocOutputs();
+	}
+
+	void RCNodeTemporalAA::render(const RenderCompositorNodeInputs& inputs)
+	{
+		RCNodePostProcess* postProcessNode = static_cast<RCNodePostProcess*>(inputs.inputNodes[0]);
+		RCNodeSceneDepth* sceneDepthNode = static_cast<RCNodeSceneDepth*>(inputs.inputNodes[2]);
+		RCNodeGBuffer* gbufferNode = static_cast<RCNodeGBuffer*>(inputs.inputNodes[3]);
+
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+		const RendererViewProperties& viewProps = inputs.view.getProperties();
+
+		SPtr<Texture> input = postProcessNode->getLastOutput();
+
+		// Output at native resolution, regardless of the resolution the scene was rendered at
+		const Rect2I& nativeRect = inputs.view.getTargetDesc().viewRect;
+		mPooledOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(input->getProperties().getFormat(),
+			nativeRect.width, nativeRect.height, TU_RENDERTARGET));
+
+		RenderAPI& rapi = RenderAPI::instance();
+
+		// Velocity is only available if the view was rendered using the deferred pipeline
+		if (mPrevFrame && gbufferNode->velocityTex)
+		{
+			TemporalAAMat* temporalAAMat = TemporalAAMat::getVariation(viewProps.numSamples > 1);
+			temporalAAMat->execute(inputs.view, mPrevFrame->texture, input, sceneDepthNode->depthTex->texture, 
+				gbufferNode->velocityTex->texture, mPooledOutput->renderTexture);
+		}
+		else
+		{
+			// No history yet, just bring the current frame to the output resolution
+			rapi.setRenderTarget(mPooledOutput->renderTexture);
+
+			UpscaleMat* upscaleMat = UpscaleMat::get();
+			upscaleMat->execute(input, 0.0f, false);
+		}
+
+		rapi.setRenderTarget(nullptr);
+		output = mPooledOutput->texture;
+	}
+
+	void RCNodeTemporalAA::clear()
+	{
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+
+		if(mPrevFrame)
+			resPool.release(mPrevFrame);
+
+		mPrevFrame = mPooledOutput;
+		mPooledOutput = nullptr;
+		output = nullptr;
+	}
+
+	void RCNodeTemporalAA::deallocOutputs()
+	{
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+		
+		if(mPrevFrame)
+		{
+			resPool.release(mPrevFrame);
+			mPrevFrame = nullptr;
+		}
+
+		output = nullptr;
+	}
+
+	SmallVector<StringID, 4> RCNodeTemporalAA::getDependencies(const RendererView& view)
+	{
+		return { RCNodePostProcess::getNodeId(), RCNodeFXAA::getNodeId(), RCNodeSceneDepth::getNodeId(), 
+			RCNodeGBuffer::getNodeId() };
+	}
+
 	void RCNodeResolvedSceneDepth::render(const RenderCompositorNodeInputs& inputs)
 	{
 		GpuResourcePool& resPool = GpuResourcePool::instance();
@@ -1819,12 +2206,14 @@ namespace bs { namespace ct
 		return { RCNodeSceneDepth::getNodeId(), RCNodeGBuffer::getNodeId() };
 	}
 
-	void RCNodeHiZ::render(const RenderCompositorNodeInputs& inputs)
+	/** 
+	 * Generates a hierarchical Z buffer from the provided depth buffer, with each texel storing the closest depth of the 
+	 * texels it covers, or the farthest one if @p farthest is true.
+	 */
+	static SPtr<PooledRenderTexture> buildHiZ(const RendererViewProperties& viewProps, const SPtr<Texture>& depth,
+		bool farthest)
 	{
 		GpuResourcePool& resPool = GpuResourcePool::instance();
-		const RendererViewProperties& viewProps = inputs.view.getProperties();
-
-		RCNodeResolvedSceneDepth* resolvedSceneDepth = static_cast<RCNodeResolvedSceneDepth*>(inputs.inputNodes[0]);
 
 		UINT32 width = viewProps.viewRect.width;
 		UINT32 height = viewProps.viewRect.height;
@@ -1836,8 +2225,8 @@ namespace bs { namespace ct
 		// Note: Use the 32-bit buffer here as 16-bit causes too much banding (most of the scene gets assigned 4-5 different
 		// depth values). 
 		//  - When I add UNORM 16-bit format I should be able to switch to that
-		output = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R32F, size, size, TU_RENDERTARGET, 1, false, 1, 
-			numMips));
+		SPtr<PooledRenderTexture> output = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R32F, size, size, 
+			TU_RENDERTARGET, 1, false, 1, numMips));
 
 		Rect2 srcRect = viewProps.nrmViewRect;
 
@@ -1848,7 +2237,7 @@ namespace bs { namespace ct
 		const RenderAPIInfo& rapiInfo = RenderAPI::instance().getAPIInfo();
 		bool noTextureViews = !rapiInfo.isFlagSet(RenderAPIFeatureFlag::TextureViews);
 
-		BuildHiZMat* material = BuildHiZMat::getVariation(noTextureViews);
+		BuildHiZMat* material = BuildHiZMat::getVariation(noTextureViews, farthest);
 
 		// Generate first mip
 		RENDER_TEXTURE_DESC rtDesc;
@@ -1866,7 +2255,7 @@ namespace bs { namespace ct
 				Math::ceilToInt(viewProps.viewRect.width / 2.0f) / (float)size,
 				Math::ceilToInt(viewProps.viewRect.height / 2.0f) / (float)size);
 
-			material->execute(resolvedSceneDepth->output->texture, 0, srcRect, destRect, rt);
+			material->execute(depth, 0, srcRect, destRect, rt);
 		}
 		else // First level is just a copy of the depth buffer
 		{
@@ -1884,7 +2273,7 @@ namespace bs { namespace ct
 			srcAreaInt.width = (UINT32)(srcRect.width * viewProps.viewRect.width);
 			srcAreaInt.height = (UINT32)(srcRect.height * viewProps.viewRect.height);
 
-			gRendererUtility().blit(resolvedSceneDepth->output->texture, srcAreaInt);
+			gRendererUtility().blit(depth, srcAreaInt);
 			rapi.setViewport(Rect2(0, 0, 1, 1));
 		}
 
@@ -1896,6 +2285,16 @@ namespace bs { namespace ct
 
 			material->execute(output->texture, i - 1, destRect, destRect, rt);
 		}
+
+		return output;
+	}
+
+	void RCNodeHiZ::render(const RenderCompositorNodeInputs& inputs)
+	{
+		const RendererViewProperties& viewProps = inputs.view.getProperties();
+		RCNodeResolvedSceneDepth* resolvedSceneDepth = static_cast<RCNodeResolvedSceneDepth*>(inputs.inputNodes[0]);
+
+		output = buildHiZ(viewProps, resolvedSceneDepth->output->texture, false);
 	}
 
 	void RCNodeHiZ::clear()
@@ -1912,6 +2311,53 @@ namespace bs { namespace ct
 		return { RCNodeResolvedSceneDepth::getNodeId(), RCNodeGBuffer::getNodeId() };
 	}
 
+	void RCNodeOcclusionCulling::render(const RenderCompositorNodeInputs& inputs)
+	{
+		const SPtr<OcclusionCulling>& occlusionCulling = inputs.view.getOcclusionCulling();
+		if(occlusionCulling == nullptr || inputs.view.getRenderSettings().overlayOnly)
+			return;
+
+		const RendererViewProperties& viewProps = inputs.view.getProperties();
+		RCNodeResolvedSceneDepth* resolvedSceneDepth = static_cast<RCNodeResolvedSceneDepth*>(inputs.inputNodes[0]);
+
+		mHiZ = buildHiZ(viewProps, resolvedSceneDepth->output->texture, true);
+		occlusionCulling->execute(inputs.view, mHiZ->texture);
+	}
+
+	void RCNodeOcclusionCulling::clear()
+	{
+		if(mHiZ)
+		{
+			GpuResourcePool& resPool = GpuResourcePool::instance();
+			resPool.release(mHiZ);
+			mHiZ = nullptr;
+		}
+	}
+
+	SmallVector<StringID, 4> RCNodeOcclusionCulling::getDependencies(const RendererView& view)
+	{
+		// Note: Only the base pass depth is used for occlusion, as forward rendered objects are drawn after deferred
+		// lighting, and are often transparent.
+		return { RCNodeResolvedSceneDepth::getNodeId(), RCNodeGBuffer::getNodeId() };
+	}
+
+	/** 
+	 * Returns the mode in which reduced rate effects should be rendered for the provided view. Falls back to half
+	 * resolution rendering if variable rate shading was requested, but isn't supported by the render API.
+	 */
+	static ReducedRateShadingMode getReducedRateShadingMode(const RendererView& view)
+	{
+		ReducedRateShadingMode mode = view.getRenderSettings().reducedRateShading;
+		if(mode == ReducedRateShadingMode::VariableRate)
+		{
+			const RenderAPICapabilities& caps = RenderAPI::instance().getCapabilities(0);
+			if(!caps.hasCapability(RSC_VARIABLE_RATE_SHADING))
+				mode = ReducedRateShadingMode::HalfResolution;
+		}
+
+		return mode;
+	}
+
 	void RCNodeSSAO::render(const RenderCompositorNodeInputs& inputs)
 	{
 		/** Maximum valid depth range within samples in a sample set. In meters. */
@@ -1950,8 +2396,12 @@ namespace bs { namespace ct
 			sceneNormals = resolvedNormals->texture;
 		}
 
+		ReducedRateShadingMode rateMode = getReducedRateShadingMode(inputs.view);
+		bool halfRes = rateMode == ReducedRateShadingMode::HalfResolution;
+
 		// Multiple downsampled AO levels are used to minimize cache trashing. Downsampled AO targets use larger radius,
-		// whose contents are then blended with the higher level.
+		// whose contents are then blended with the higher level. When rendering at half resolution the final AO pass
+		// is evaluated at the resolution of the first downsampled level, so that level is skipped.
 		UINT32 quality = settings.quality;
 		UINT32 numDownsampleLevels = 0;
 		if (quality == 2)
@@ -1962,7 +2412,7 @@ namespace bs { namespace ct
 		SSAODownsampleMat* downsample = SSAODownsampleMat::get();
 
 		SPtr<PooledRenderTexture> setupTex0;
-		if(numDownsampleLevels > 0)
+		if(numDownsampleLevels > 0 && !halfRes)
 		{
 			Vector2I downsampledSize(
 				std::max(1, Math::divideAndRoundUp((INT32)viewProps.viewRect.width, 2)),
@@ -2013,12 +2463,16 @@ namespace bs { namespace ct
 			SSAOMat* ssaoMat = SSAOMat::getVariation(false, false, quality);
 			ssaoMat->execute(inputs.view, textures, downAOTex1->renderTexture, settings);
 
-			GpuResourcePool::instance().release(setupTex1);
-			setupTex1 = nullptr;
+			// Still required for upsampling in the final pass, when rendering at half resolution
+			if(!halfRes)
+			{
+				GpuResourcePool::instance().release(setupTex1);
+				setupTex1 = nullptr;
+			}
 		}
 
 		SPtr<PooledRenderTexture> downAOTex0;
-		if(numDownsampleLevels > 0)
+		if(numDownsampleLevels > 0 && !halfRes)
 		{
 			textures.aoSetup = setupTex0->texture;
 
@@ -2047,7 +2501,14 @@ namespace bs { namespace ct
 
 		UINT32 width = viewProps.viewRect.width;
 		UINT32 height = viewProps.viewRect.height;
-		mPooledOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, width, height, TU_RENDERTARGET));
+		if(halfRes)
+		{
+			width = (UINT32)std::max(1, Math::divideAndRoundUp((INT32)width, 2));
+			height = (UINT32)std::max(1, Math::divideAndRoundUp((INT32)height, 2));
+		}
+
+		SPtr<PooledRenderTexture> aoOutput = 
+			resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, width, height, TU_RENDERTARGET));
 
 		{
 			if(setupTex0)
@@ -2055,10 +2516,21 @@ namespace bs { namespace ct
 
 			if(downAOTex0)
 				textures.aoDownsampled = downAOTex0->texture;
+			else if(downAOTex1)
+				textures.aoDownsampled = downAOTex1->texture;
 
-			bool upsample = numDownsampleLevels > 0;
+			bool upsample = textures.aoDownsampled != nullptr;
 			SSAOMat* ssaoMat = SSAOMat::getVariation(upsample, true, quality);
-			ssaoMat->execute(inputs.view, textures, mPooledOutput->renderTexture, settings);
+
+			// AO is low frequency, so shading a block of pixels at once yields nearly identical results
+			bool variableRate = rateMode == ReducedRateShadingMode::VariableRate;
+			if(variableRate)
+				rapi.setShadingRate(SR_2X2);
+
+			ssaoMat->execute(inputs.view, textures, aoOutput->renderTexture, settings);
+
+			if(variableRate)
+				rapi.setShadingRate(SR_1X1);
 		}
 
 		if(resolvedNormals)
@@ -2067,18 +2539,24 @@ namespace bs { namespace ct
 			resolvedNormals = nullptr;
 		}
 
-		if(numDownsampleLevels > 0)
-		{
+		if(setupTex0)
 			GpuResourcePool::instance().release(setupTex0);
+
+		if(downAOTex0)
 			GpuResourcePool::instance().release(downAOTex0);
-		}
+
+		if(setupTex1)
+			GpuResourcePool::instance().release(setupTex1);
+
+		if(downAOTex1)
+			GpuResourcePool::instance().release(downAOTex1);
 
 		// Blur the output
 		// Note: If I implement temporal AA then this can probably be avoided. I can instead jitter the sample offsets
 		// each frame, and averaging them out should yield blurred AO.
 		if(quality > 1) // On level 0 we don't blur at all, on level 1 we use the ad-hoc blur in shader
 		{
-			const RenderTargetProperties& rtProps = mPooledOutput->renderTexture->getProperties();
+			const RenderTargetProperties& rtProps = aoOutput->renderTexture->getProperties();
 
 			POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, rtProps.width, 
 				rtProps.height, TU_RENDERTARGET);
@@ -2087,12 +2565,25 @@ namespace bs { namespace ct
 			SSAOBlurMat* blurHorz = SSAOBlurMat::getVariation(true);
 			SSAOBlurMat* blurVert = SSAOBlurMat::getVariation(false);
 
-			blurHorz->execute(inputs.view, mPooledOutput->texture, sceneDepth, blurIntermediateTex->renderTexture, DEPTH_RANGE);
-			blurVert->execute(inputs.view, blurIntermediateTex->texture, sceneDepth, mPooledOutput->renderTexture, DEPTH_RANGE);
+			blurHorz->execute(inputs.view, aoOutput->texture, sceneDepth, blurIntermediateTex->renderTexture, DEPTH_RANGE);
+			blurVert->execute(inputs.view, blurIntermediateTex->texture, sceneDepth, aoOutput->renderTexture, DEPTH_RANGE);
 
 			GpuResourcePool::instance().release(blurIntermediateTex);
 		}
 
+		if(halfRes)
+		{
+			mPooledOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, viewProps.viewRect.width, 
+				viewProps.viewRect.height, TU_RENDERTARGET));
+
+			BilateralUpsampleMat* upsampleMat = BilateralUpsampleMat::get();
+			upsampleMat->execute(inputs.view, aoOutput->texture, sceneDepth, mPooledOutput->renderTexture);
+
+			GpuResourcePool::instance().release(aoOutput);
+		}
+		else
+			mPooledOutput = aoOutput;
+
 		RenderAPI::instance().setRenderTarget(nullptr);
 		output = mPooledOutput->texture;
 	}
@@ -2168,33 +2659,76 @@ namespace bs { namespace ct
 		gbuffer.roughMetal = gbufferNode->roughMetalTex->texture;
 		gbuffer.depth = sceneDepthNode->depthTex->texture;
 
-		SSRStencilMat* stencilMat = SSRStencilMat::getVariation(viewProps.numSamples > 1, true);
+		// Half resolution tracing relies on the gbuffer being sampled using UV coordinates, which is not the case with
+		// MSAA, so MSAA views always trace at full resolution
+		ReducedRateShadingMode rateMode = getReducedRateShadingMode(inputs.view);
+		bool halfRes = rateMode == ReducedRateShadingMode::HalfResolution && viewProps.numSamples == 1;
 
-		// Note: Making the assumption that the stencil buffer is clear at this point
-		rapi.setRenderTarget(resolvedSceneDepthNode->output->renderTexture, FBT_DEPTH, RT_DEPTH_STENCIL);
-		stencilMat->execute(inputs.view, gbuffer, settings);
+		SPtr<PooledRenderTexture> traceOutput;
+		SPtr<RenderTexture> traceRt;
+		if (!halfRes)
+		{
+			SSRStencilMat* stencilMat = SSRStencilMat::getVariation(viewProps.numSamples > 1, true);
 
-		SPtr<PooledRenderTexture> traceOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width,
-			height, TU_RENDERTARGET));
+			// Note: Making the assumption that the stencil buffer is clear at this point
+			rapi.setRenderTarget(resolvedSceneDepthNode->output->renderTexture, FBT_DEPTH, RT_DEPTH_STENCIL);
+			stencilMat->execute(inputs.view, gbuffer, settings);
 
-		RENDER_TEXTURE_DESC traceRtDesc;
-		traceRtDesc.colorSurfaces[0].texture = traceOutput->texture;
-		traceRtDesc.depthStencilSurface.texture = resolvedSceneDepthNode->output->texture;
+			traceOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height,
+				TU_RENDERTARGET));
+
+			RENDER_TEXTURE_DESC traceRtDesc;
+			traceRtDesc.colorSurfaces[0].texture = traceOutput->texture;
+			traceRtDesc.depthStencilSurface.texture = resolvedSceneDepthNode->output->texture;
 
-		SPtr<RenderTexture> traceRt = RenderTexture::create(traceRtDesc);
+			traceRt = RenderTexture::create(traceRtDesc);
+			rapi.setRenderTarget(traceRt, FBT_DEPTH | FBT_STENCIL, RT_DEPTH_STENCIL);
+		}
+		else
+		{
+			// The stencil mask is skipped, as its size wouldn't match the trace target. The trace shader fades out
+			// reflections on rough surfaces on its own.
+			UINT32 halfWidth = (UINT32)std::max(1, Math::divideAndRoundUp((INT32)width, 2));
+			UINT32 halfHeight = (UINT32)std::max(1, Math::divideAndRoundUp((INT32)height, 2));
+
+			traceOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, halfWidth, halfHeight,
+				TU_RENDERTARGET));
+
+			traceRt = traceOutput->renderTexture;
+			rapi.setRenderTarget(traceRt);
+		}
 
-		rapi.setRenderTarget(traceRt, FBT_DEPTH | FBT_STENCIL, RT_DEPTH_STENCIL);
 		rapi.clearRenderTarget(FBT_COLOR, Color::ZERO);
 
+		bool variableRate = rateMode == ReducedRateShadingMode::VariableRate;
+		if (variableRate)
+			rapi.setShadingRate(SR_2X2);
+
 		SSRTraceMat* traceMat = SSRTraceMat::getVariation(settings.quality, viewProps.numSamples > 1, true);
 		traceMat->execute(inputs.view, gbuffer, sceneColor, hiZ, settings, traceRt);
 
+		if (variableRate)
+			rapi.setShadingRate(SR_1X1);
+
 		if (resolvedSceneColor)
 		{
 			resPool.release(resolvedSceneColor);
 			resolvedSceneColor = nullptr;
 		}
 
+		if (halfRes)
+		{
+			SPtr<PooledRenderTexture> upsampledOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F,
+				width, height, TU_RENDERTARGET));
+
+			BilateralUpsampleMat* upsampleMat = BilateralUpsampleMat::get();
+			upsampleMat->execute(inputs.view, traceOutput->texture, resolvedSceneDepthNode->output->texture,
+				upsampledOutput->renderTexture);
+
+			resPool.release(traceOutput);
+			traceOutput = upsampledOutput;
+		}
+
 		if (mPrevFrame)
 		{
 			mPooledOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height, TU_RENDERTARGET));
@@ -83,6 +83,11 @@ namespace ct
 			RenderCompositorNode* node;
 			UINT32 lastUseIdx;
 			SmallVector<RenderCompositorNode*, 4> inputs;
+			ProfilerString name;
+			StringID id;
+
+			/** Nodes whose resources are no longer needed once this node executes. See computeReleasePoints(). */
+			SmallVector<RenderCompositorNode*, 4> nodesToClear;
 		};
 	public:
 		~RenderCompositor();
@@ -102,6 +107,13 @@ namespace ct
 		void execute(RenderCompositorNodeInputs& inputs) const;
 
 	private:
+		/** 
+		 * Determines after which node each node's resources can be released, from the node inputs. Resources of a node
+		 * are released as soon as its last dependant executes, so the GpuResourcePool can hand them out to the nodes
+		 * that follow, if their descriptors match.
+		 */
+		void computeReleasePoints();
+
 		/** Clears the render node hierarchy. */
 		void clear();
 
@@ -200,6 +212,9 @@ namespace ct
 		SPtr<PooledRenderTexture> normalTex;
 		SPtr<PooledRenderTexture> roughMetalTex;
 
+		/** Screen space velocity of each pixel, in NDC. Only available when temporal anti-aliasing is enabled. */
+		SPtr<PooledRenderTexture> velocityTex;
+
 		SPtr<RenderTexture> renderTarget;
 
 		static StringID getNodeId() { return "GBuffer"; }
@@ -210,6 +225,9 @@ namespace ct
 
 		/** @copydoc RenderCompositorNode::clear */
 		void clear() override;
+
+		/** Command buffers used for recording the base pass on worker threads. */
+		Vector<SPtr<CommandBuffer>> mCommandBuffers;
 	};
 
 	/** Initializes the scene color texture and/or buffer. Does not perform any rendering. */
@@ -512,6 +530,34 @@ namespace ct
 		void clear() override;
 	};
 
+	/** 
+	 * Renders temporal anti-aliasing by blending the post-processed scene with the reprojected output of the previous
+	 * frame. Output is always at the native resolution of the view, upsampling the scene if it was rendered at a lower
+	 * resolution.
+	 */
+	class RCNodeTemporalAA : public RenderCompositorNode
+	{
+	public:
+		SPtr<Texture> output;
+
+		~RCNodeTemporalAA();
+
+		static StringID getNodeId() { return "TemporalAA"; }
+		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
+	protected:
+		/** @copydoc RenderCompositorNode::render */
+		void render(const RenderCompositorNodeInputs& inputs) override;
+
+		/** @copydoc RenderCompositorNode::clear */
+		void clear() override;
+
+		/** Cleans up any outputs. */
+		void deallocOutputs();
+
+		SPtr<PooledRenderTexture> mPooledOutput;
+		SPtr<PooledRenderTexture> mPrevFrame;
+	};
+
 	/************************************************************************/
 	/* 							SCREEN SPACE								*/
 	/************************************************************************/
@@ -550,6 +596,25 @@ namespace ct
 		void clear() override;
 	};
 
+	/** 
+	 * Tests renderables visible in the view for occlusion, against a HiZ buffer generated from the base pass depth. 
+	 * Results are used for culling renderables on later frames.
+	 */
+	class RCNodeOcclusionCulling : public RenderCompositorNode
+	{
+	public:
+		static StringID getNodeId() { return "OcclusionCulling"; }
+		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
+	protected:
+		/** @copydoc RenderCompositorNode::render */
+		void render(const RenderCompositorNodeInputs& inputs) override;
+
+		/** @copydoc RenderCompositorNode::clear */
+		void clear() override;
+
+		SPtr<PooledRenderTexture> mHiZ;
+	};
+
 	/** Renders screen space ambient occlusion. */
 	class RCNodeSSAO : public RenderCompositorNode
 	{
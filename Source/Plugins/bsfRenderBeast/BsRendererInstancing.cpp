@@ -0,0 +1,148 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsRendererInstancing.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "Mesh/BsMesh.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs { namespace ct
+{
+	/** Checks can two elements be rendered using the same instanced draw call. */
+	static bool canInstanceTogether(const BeastRenderableElement& a, UINT32 passIdxA, const BeastRenderableElement& b,
+		UINT32 passIdxB)
+	{
+		return a.mesh == b.mesh &&
+			a.subMesh.indexOffset == b.subMesh.indexOffset &&
+			a.subMesh.indexCount == b.subMesh.indexCount &&
+			a.subMesh.drawOp == b.subMesh.drawOp &&
+			a.material == b.material &&
+			a.techniqueIdx == b.techniqueIdx &&
+			passIdxA == passIdxB;
+	}
+
+	void RendererInstancing::clear()
+	{
+		mQueues.clear();
+		mInstanceObjectIds.clear();
+		mNumGroups = 0;
+	}
+
+	void RendererInstancing::addQueue(const RenderQueue& queue)
+	{
+		QueueGroups queueGroups;
+		queueGroups.queue = &queue;
+		queueGroups.firstGroup = mNumGroups;
+
+		const BeastRenderableElement* prevElem = nullptr;
+		UINT32 prevPassIdx = 0;
+
+		const Vector<RenderQueueElement>& elements = queue.getSortedElements();
+		for(auto& entry : elements)
+		{
+			const auto* renderElem = static_cast<const BeastRenderableElement*>(entry.renderElem);
+			if(!renderElem->instanced)
+			{
+				prevElem = nullptr;
+				continue;
+			}
+
+			if(prevElem == nullptr || !canInstanceTogether(*prevElem, prevPassIdx, *renderElem, entry.passIdx))
+			{
+				// Groups are never removed so their param buffers can be re-used between frames
+				if(mNumGroups == (UINT32)mGroups.size())
+					mGroups.push_back(InstancedDrawGroup());
+
+				InstancedDrawGroup& group = mGroups[mNumGroups++];
+				group.instanceOffset = (UINT32)mInstanceObjectIds.size();
+				group.numInstances = 0;
+
+				group.drawArgs.indexCount = renderElem->subMesh.indexCount;
+				group.drawArgs.instanceCount = 0;
+				group.drawArgs.firstIndex = renderElem->subMesh.indexOffset + renderElem->mesh->getIndexOffset();
+				group.drawArgs.vertexOffset = (INT32)renderElem->mesh->getVertexOffset();
+				group.drawArgs.firstInstance = 0;
+			}
+
+			InstancedDrawGroup& group = mGroups[mNumGroups - 1];
+			group.numInstances++;
+			group.drawArgs.instanceCount = group.numInstances;
+			mInstanceObjectIds.push_back(renderElem->renderableId);
+
+			prevElem = renderElem;
+			prevPassIdx = entry.passIdx;
+		}
+
+		queueGroups.numGroups = mNumGroups - queueGroups.firstGroup;
+		if(queueGroups.numGroups > 0)
+			mQueues.push_back(queueGroups);
+	}
+
+	void RendererInstancing::update()
+	{
+		for(UINT32 i = 0; i < mNumGroups; i++)
+		{
+			InstancedDrawGroup& group = mGroups[i];
+			if(group.paramBuffer == nullptr)
+				group.paramBuffer = gPerInstanceParamDef.createBuffer();
+
+			gPerInstanceParamDef.gInstanceOffset.set(group.paramBuffer, (INT32)group.instanceOffset);
+			group.paramBuffer->flushToGPU();
+		}
+
+		// Draw arguments are generated on the CPU for now, but keeping them in a GPU buffer allows culling passes to
+		// modify them without a read-back
+		const RenderAPICapabilities& caps = RenderAPI::instance().getCapabilities(0);
+		if(mNumGroups > 0 && caps.hasCapability(RSC_DRAW_INDIRECT))
+		{
+			mDrawArgs.resize(mNumGroups);
+			for(UINT32 i = 0; i < mNumGroups; i++)
+			{
+				mGroups[i].argsOffset = i * sizeof(DrawIndexedIndirectArgs);
+				mDrawArgs[i] = mGroups[i].drawArgs;
+			}
+
+			if(mArgsBuffer == nullptr || mArgsBuffer->getProperties().getElementCount() < mNumGroups)
+			{
+				GPU_BUFFER_DESC desc;
+				desc.elementCount = Bitwise::nextPow2(mNumGroups);
+				desc.elementSize = sizeof(DrawIndexedIndirectArgs);
+				desc.format = BF_UNKNOWN;
+				desc.type = GBT_INDIRECTARGUMENT;
+				desc.usage = GBU_DYNAMIC;
+
+				mArgsBuffer = GpuBuffer::create(desc);
+			}
+
+			mArgsBuffer->writeData(0, mNumGroups * sizeof(DrawIndexedIndirectArgs), mDrawArgs.data(), BWT_DISCARD);
+		}
+
+		const UINT32 numInstances = (UINT32)mInstanceObjectIds.size();
+		if(numInstances == 0)
+			return;
+
+		if(mInstanceBuffer == nullptr || mInstanceBuffer->getProperties().getElementCount() < numInstances)
+		{
+			GPU_BUFFER_DESC desc;
+			desc.elementCount = Bitwise::nextPow2(numInstances);
+			desc.elementSize = 0;
+			desc.format = BF_32X1U;
+			desc.type = GBT_STANDARD;
+			desc.usage = GBU_DYNAMIC;
+
+			mInstanceBuffer = GpuBuffer::create(desc);
+		}
+
+		mInstanceBuffer->writeData(0, numInstances * sizeof(UINT32), mInstanceObjectIds.data(), BWT_DISCARD);
+	}
+
+	const InstancedDrawGroup* RendererInstancing::getGroups(const RenderQueue& queue) const
+	{
+		for(auto& entry : mQueues)
+		{
+			if(entry.queue == &queue)
+				return &mGroups[entry.firstGroup];
+		}
+
+		return nullptr;
+	}
+}}
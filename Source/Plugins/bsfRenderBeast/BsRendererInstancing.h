@@ -0,0 +1,100 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Renderer/BsRenderQueue.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "BsRendererObject.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Range of sequential render queue elements that share the same mesh, sub-mesh, material and pass, and can be
+	 * rendered using a single instanced draw call.
+	 */
+	struct InstancedDrawGroup
+	{
+		/** Index of the first instance of the group in the instance buffer. */
+		UINT32 instanceOffset = 0;
+
+		/** Number of render queue elements (instances) in the group. */
+		UINT32 numInstances = 0;
+
+		/** Buffer containing the PerInstanceParamDef parameters for the group. */
+		SPtr<GpuParamBlockBuffer> paramBuffer;
+
+		/** 
+		 * Offset of the group's DrawIndexedIndirectArgs in the buffer returned by RendererInstancing::getArgsBuffer(), 
+		 * in bytes. 
+		 */
+		UINT32 argsOffset = 0;
+
+		/** Arguments of the indexed draw call that renders the group. */
+		DrawIndexedIndirectArgs drawArgs;
+	};
+
+	/**
+	 * Finds instanced elements in sorted render queues that can be rendered together, and generates a buffer mapping
+	 * each instance to the renderable ID used for looking up its data in GpuSceneBuffer. Every element flagged as instanced in a registered queue belongs to exactly one
+	 * group, and groups are stored in the same order as their elements appear in the queue.
+	 */
+	class RendererInstancing
+	{
+	public:
+		/** Clears all groups and per-instance data. Should be called before queues for a new frame are added. */
+		void clear();
+
+		/**
+		 * Generates instanced draw groups from the sorted elements of the provided render queue. Doesn't access any GPU
+		 * objects and can be called from any thread, as long as the queue remains unmodified until rendering completes.
+		 */
+		void addQueue(const RenderQueue& queue);
+
+		/**
+		 * Uploads the instance buffer and per-group parameters for all groups added since the last call to clear().
+		 * Must be called on the core thread, after all queues have been added.
+		 */
+		void update();
+
+		/**
+		 * Returns the first instanced draw group belonging to the provided queue. Subsequent groups of the same queue
+		 * follow sequentially. Returns null if the queue has no instanced elements.
+		 */
+		const InstancedDrawGroup* getGroups(const RenderQueue& queue) const;
+
+		/** Returns the buffer containing renderable IDs of all instances, as expected by gInstanceObjectIds. */
+		const SPtr<GpuBuffer>& getInstanceBuffer() const { return mInstanceBuffer; }
+
+		/** 
+		 * Returns the buffer containing draw arguments for all groups, for use with indirect draw calls. Null if the
+		 * render API doesn't support indirect draws. 
+		 */
+		const SPtr<GpuBuffer>& getArgsBuffer() const { return mArgsBuffer; }
+
+	private:
+		/** Information about groups belonging to a single render queue. */
+		struct QueueGroups
+		{
+			const RenderQueue* queue;
+			UINT32 firstGroup;
+			UINT32 numGroups;
+		};
+
+		Vector<QueueGroups> mQueues;
+		Vector<InstancedDrawGroup> mGroups;
+		UINT32 mNumGroups = 0;
+
+		Vector<UINT32> mInstanceObjectIds;
+		SPtr<GpuBuffer> mInstanceBuffer;
+
+		Vector<DrawIndexedIndirectArgs> mDrawArgs;
+		SPtr<GpuBuffer> mArgsBuffer;
+	};
+
+	/** @} */
+}}
@@ -61,6 +61,12 @@ namespace ct
 		Vector3 getShiftedLightPosition() const;
 
 		Light* internal;
+
+		/** 
+		 * Value that changes whenever the light or any of the static shadow casters in its range change. Unique across
+		 * all lights in the scene. Used for determining when should cached static shadow maps be re-rendered.
+		 */
+		UINT64 staticShadowVersion = 0;
 	};
 
 	/** Container for all GBuffer textures. */
@@ -141,6 +147,12 @@ namespace ct
 
 		/** Returns a list of all visible lights of the specified type. */
 		const Vector<const RendererLight*>& getLights(LightType type) const { return mVisibleLights[(UINT32)type]; }
+
+		/** 
+		 * Returns information about a light at the specified index in the light buffer. Lights are ordered by type: 
+		 * directional, radial, spot. 
+		 */
+		const LightData& getLightData(UINT32 idx) const { return mVisibleLightData[idx]; }
 	private:
 		SPtr<GpuBuffer> mLightBuffer;
 
@@ -1,11 +1,151 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsRendererObject.h"
+#include "Material/BsMaterial.h"
+#include "Material/BsPass.h"
+#include "Material/BsGpuParamsSet.h"
+#include "Mesh/BsMesh.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "RenderAPI/BsVertexData.h"
 
 namespace bs { namespace ct
 {
 	PerObjectParamDef gPerObjectParamDef;
 	PerCallParamDef gPerCallParamDef;
+	PerInstanceParamDef gPerInstanceParamDef;
+
+	/** Writes the first three rows of an affine matrix into the provided output array. */
+	static void writeAffineRows(const Matrix4& matrix, Vector4* output)
+	{
+		for(UINT32 i = 0; i < 3; i++)
+			output[i] = matrix[i];
+	}
+
+	void RenderableDrawPacket::bindPass(UINT32 passIdx, const SPtr<CommandBuffer>& commandBuffer) const
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+
+		const PassState& pass = passes[passIdx];
+		rapi.setGraphicsPipeline(pass.pipeline, commandBuffer);
+		rapi.setStencilRef(pass.stencilRef, commandBuffer);
+	}
+
+	void RenderableDrawPacket::bindParams(UINT32 passIdx, const SPtr<CommandBuffer>& commandBuffer) const
+	{
+		const PassState& pass = passes[passIdx];
+		if (pass.gpuParams == nullptr)
+			return;
+
+		RenderAPI::instance().setGpuParams(pass.gpuParams, commandBuffer);
+	}
+
+	void RenderableDrawPacket::draw(UINT32 numInstances, const SPtr<CommandBuffer>& commandBuffer) const
+	{
+		bindGeometry(commandBuffer);
+
+		RenderAPI::instance().drawIndexed(indexOffset, indexCount, vertexOffset, vertexCount, numInstances,
+			commandBuffer);
+
+		mesh->_notifyUsedOnGPU();
+	}
+
+	void RenderableDrawPacket::drawIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset,
+		const SPtr<CommandBuffer>& commandBuffer) const
+	{
+		bindGeometry(commandBuffer);
+
+		RenderAPI::instance().drawIndexedIndirect(argsBuffer, offset, commandBuffer);
+
+		mesh->_notifyUsedOnGPU();
+	}
+
+	void RenderableDrawPacket::bindGeometry(const SPtr<CommandBuffer>& commandBuffer) const
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+
+		rapi.setVertexDeclaration(vertexDeclaration, commandBuffer);
+
+		if (!vertexBuffers.empty())
+		{
+			rapi.setVertexBuffers(vertexBufferStart, const_cast<SPtr<VertexBuffer>*>(vertexBuffers.data()), 
+				(UINT32)vertexBuffers.size(), commandBuffer);
+		}
+
+		rapi.setIndexBuffer(indexBuffer, commandBuffer);
+		rapi.setDrawOperation(drawOp, commandBuffer);
+	}
+
+	void BeastRenderableElement::updateDrawPacket()
+	{
+		drawPacket = RenderableDrawPacket();
+
+		if (material == nullptr || mesh == nullptr)
+			return;
+
+		UINT32 numPasses = material->getNumPasses(techniqueIdx);
+		drawPacket.passes.resize(numPasses);
+		for (UINT32 i = 0; i < numPasses; i++)
+		{
+			SPtr<Pass> pass = material->getPass(i, techniqueIdx);
+
+			RenderableDrawPacket::PassState& passState = drawPacket.passes[i];
+			passState.pipeline = pass->getGraphicsPipelineState();
+			passState.stencilRef = pass->getStencilRefValue();
+			passState.gpuParams = params != nullptr ? params->getGpuParams(i) : nullptr;
+		}
+
+		SPtr<VertexData> vertexData = mesh->getVertexData();
+
+		drawPacket.mesh = mesh.get();
+		drawPacket.indexBuffer = mesh->getIndexBuffer();
+		drawPacket.drawOp = subMesh.drawOp;
+		drawPacket.indexOffset = subMesh.indexOffset + mesh->getIndexOffset();
+		drawPacket.indexCount = subMesh.indexCount;
+		drawPacket.vertexOffset = mesh->getVertexOffset();
+		drawPacket.vertexCount = vertexData->vertexCount;
+
+		// Skinned elements draw vertices animated by the compute pass, in place of the mesh's own
+		if (skinnedVertexBuffer != nullptr)
+		{
+			drawPacket.vertexDeclaration = vertexData->vertexDeclaration;
+			drawPacket.vertexBuffers.push_back(skinnedVertexBuffer);
+			return;
+		}
+
+		const bool isMorph = morphVertexDeclaration != nullptr;
+		drawPacket.vertexDeclaration = isMorph ? morphVertexDeclaration : vertexData->vertexDeclaration;
+
+		auto& meshBuffers = vertexData->getBuffers();
+		if (meshBuffers.empty() && !isMorph)
+			return;
+
+		UINT32 endSlot = 0;
+		UINT32 startSlot = BS_MAX_BOUND_VERTEX_BUFFERS;
+		for (auto& entry : meshBuffers)
+		{
+			if (entry.first >= BS_MAX_BOUND_VERTEX_BUFFERS)
+				BS_EXCEPT(InvalidParametersException, "Buffer index out of range");
+
+			startSlot = std::min(entry.first, startSlot);
+			endSlot = std::max(entry.first, endSlot);
+		}
+
+		// Morph shape vertices are always bound to the second slot
+		if (isMorph)
+		{
+			startSlot = std::min(1U, startSlot);
+			endSlot = std::max(1U, endSlot);
+		}
+
+		drawPacket.vertexBufferStart = startSlot;
+		drawPacket.vertexBuffers.resize(endSlot - startSlot + 1);
+
+		for (auto& entry : meshBuffers)
+			drawPacket.vertexBuffers[entry.first - startSlot] = entry.second;
+
+		if (isMorph)
+			drawPacket.vertexBuffers[1 - startSlot] = morphShapeBuffer;
+	}
 
 	RendererObject::RendererObject()
 	{
@@ -15,14 +155,26 @@ namespace bs { namespace ct
 
 	void RendererObject::updatePerObjectBuffer()
 	{
-		Matrix4 worldTransform = renderable->getMatrix();
+		worldTransform = renderable->getMatrix();
 		Matrix4 worldNoScaleTransform = renderable->getMatrixNoScale();
 
+		Matrix4 invWorldTransform = worldTransform.inverseAffine();
+		Matrix4 invWorldNoScaleTransform = worldNoScaleTransform.inverseAffine();
+		float worldDeterminantSign = worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
+
 		gPerObjectParamDef.gMatWorld.set(perObjectParamBuffer, worldTransform);
-		gPerObjectParamDef.gMatInvWorld.set(perObjectParamBuffer, worldTransform.inverseAffine());
+		gPerObjectParamDef.gMatInvWorld.set(perObjectParamBuffer, invWorldTransform);
 		gPerObjectParamDef.gMatWorldNoScale.set(perObjectParamBuffer, worldNoScaleTransform);
-		gPerObjectParamDef.gMatInvWorldNoScale.set(perObjectParamBuffer, worldNoScaleTransform.inverseAffine());
-		gPerObjectParamDef.gWorldDeterminantSign.set(perObjectParamBuffer, worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f);
+		gPerObjectParamDef.gMatInvWorldNoScale.set(perObjectParamBuffer, invWorldNoScaleTransform);
+		gPerObjectParamDef.gWorldDeterminantSign.set(perObjectParamBuffer, worldDeterminantSign);
+		gPerObjectParamDef.gMatPrevWorld.set(perObjectParamBuffer, prevWorldTransform);
+
+		writeAffineRows(worldTransform, &instanceData.entries[0]);
+		writeAffineRows(invWorldTransform, &instanceData.entries[3]);
+		writeAffineRows(worldNoScaleTransform, &instanceData.entries[6]);
+		writeAffineRows(invWorldNoScaleTransform, &instanceData.entries[9]);
+		instanceData.entries[12] = Vector4(worldDeterminantSign, 0.0f, 0.0f, 0.0f);
+		writeAffineRows(prevWorldTransform, &instanceData.entries[13]);
 	}
 
 	void RendererObject::updatePerCallBuffer(const Matrix4& viewProj, bool flush)
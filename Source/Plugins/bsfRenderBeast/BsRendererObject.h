@@ -9,6 +9,7 @@
 #include "Material/BsMaterialParam.h"
 #include "RenderAPI/BsGpuPipelineParamInfo.h"
 #include "BsRendererReflectionProbe.h"
+#include "Utility/BsOctree.h"
 
 namespace bs { namespace ct
 {
@@ -22,6 +23,7 @@ namespace bs { namespace ct
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatWorldNoScale)
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatInvWorldNoScale)
 		BS_PARAM_BLOCK_ENTRY(float, gWorldDeterminantSign)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatPrevWorld)
 	BS_PARAM_BLOCK_END
 
 	extern PerObjectParamDef gPerObjectParamDef;
@@ -32,8 +34,71 @@ namespace bs { namespace ct
 
 	extern PerCallParamDef gPerCallParamDef;
 
+	BS_PARAM_BLOCK_BEGIN(PerInstanceParamDef)
+		BS_PARAM_BLOCK_ENTRY(INT32, gInstanceOffset)
+	BS_PARAM_BLOCK_END
+
+	extern PerInstanceParamDef gPerInstanceParamDef;
+
+	/** 
+	 * Per-object data in the format expected by instanced shaders. Contains the same data as PerObjectParamDef, except
+	 * that the matrices are stored as three rows of an affine transform.
+	 */
+	struct PerObjectInstanceData
+	{
+		/** Number of 4-component entries required to store the data of a single instance. */
+		static constexpr UINT32 NUM_ENTRIES = 16;
+
+		Vector4 entries[NUM_ENTRIES];
+	};
+
 	struct MaterialSamplerOverrides;
 
+	/**
+	 * Everything required to draw a renderable element, resolved once when the element is created instead of on every
+	 * draw. Contains the pipeline and parameters of each pass of the element's technique, as well as the buffers and
+	 * ranges of the element's mesh.
+	 */
+	struct RenderableDrawPacket
+	{
+		/** State used when drawing with a single pass. */
+		struct PassState
+		{
+			SPtr<GraphicsPipelineState> pipeline;
+			SPtr<GpuParams> gpuParams;
+			UINT32 stencilRef = 0;
+		};
+
+		/** Binds the pipeline of the pass with the specified index. */
+		void bindPass(UINT32 passIdx, const SPtr<CommandBuffer>& commandBuffer) const;
+
+		/** Binds the GPU parameters of the pass with the specified index. */
+		void bindParams(UINT32 passIdx, const SPtr<CommandBuffer>& commandBuffer) const;
+
+		/** Binds the mesh buffers and draws the specified number of instances. */
+		void draw(UINT32 numInstances, const SPtr<CommandBuffer>& commandBuffer) const;
+
+		/** Binds the mesh buffers and draws using arguments from @p argsBuffer at the specified byte offset. */
+		void drawIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, const SPtr<CommandBuffer>& commandBuffer) const;
+
+		Vector<PassState> passes;
+
+		MeshBase* mesh = nullptr;
+		SPtr<VertexDeclaration> vertexDeclaration;
+		Vector<SPtr<VertexBuffer>> vertexBuffers;
+		UINT32 vertexBufferStart = 0;
+		SPtr<IndexBuffer> indexBuffer;
+		DrawOperationType drawOp = DOT_TRIANGLE_LIST;
+		UINT32 indexOffset = 0;
+		UINT32 indexCount = 0;
+		UINT32 vertexOffset = 0;
+		UINT32 vertexCount = 0;
+
+	private:
+		/** Binds the vertex and index buffers, and the draw operation. */
+		void bindGeometry(const SPtr<CommandBuffer>& commandBuffer) const;
+	};
+
 	/**
 	 * @copydoc	RenderableElement
 	 *
@@ -42,6 +107,12 @@ namespace bs { namespace ct
 	class BeastRenderableElement : public RenderableElement
 	{
 	public:
+		/** 
+		 * Rebuilds @p drawPacket from the element's current material, technique, parameters and mesh. Must be called
+		 * whenever any of those change.
+		 */
+		void updateDrawPacket();
+
 		/**
 		 * Optional overrides for material sampler states. Used when renderer wants to override certain sampling properties
 		 * on a global scale (for example filtering most commonly).
@@ -113,6 +184,30 @@ namespace bs { namespace ct
 
 		/** Version of the morph shape vertices in the buffer. */
 		mutable UINT32 morphShapeVersion;
+
+		/** 
+		 * Vertex buffer containing the element's vertices as animated during the current frame, if the element is skinned
+		 * in a compute pass. Drawn in place of the mesh's own vertices.
+		 */
+		SPtr<VertexBuffer> skinnedVertexBuffer;
+
+		/** 
+		 * True if the element is rendered using the instanced variation of its material, in which case it must be drawn
+		 * through RendererInstancing, rather than on its own.
+		 */
+		bool instanced = false;
+
+		/** Binding indices representing where should the per-instance param block buffer be bound to. */
+		GpuParamBinding perInstanceBindings[GPT_COUNT];
+
+		/** Parameter to which to bind the buffer containing object IDs of each instance, for instanced elements. */
+		GpuParamBuffer instanceObjectIdsParam;
+
+		/** Parameter to which to bind the buffer containing data of all objects in the scene, for instanced elements. */
+		GpuParamBuffer objectDataParam;
+
+		/** Pre-resolved state used for drawing the element. */
+		RenderableDrawPacket drawPacket;
 	};
 
 	 /** Contains information about a Renderable, used by the Renderer. */
@@ -131,9 +226,79 @@ namespace bs { namespace ct
 		 */
 		void updatePerCallBuffer(const Matrix4& viewProj, bool flush = true);
 
+		/** 
+		 * Returns true if the object's contribution to shadow maps can be cached, as it is neither movable nor animated.
+		 * Only valid once the object has been registered with the scene.
+		 */
+		bool hasStaticShadow() const
+		{
+			return dynamicIdx == (UINT32)-1 && renderable->getAnimType() == RenderableAnimType::None;
+		}
+
+		/** 
+		 * Returns the elements to render at the specified level of detail. Level zero represents the full detail mesh,
+		 * while other levels correspond to entries in @p lodElements.
+		 */
+		Vector<BeastRenderableElement>& getElements(UINT32 lod)
+		{
+			return lod == 0 ? elements : lodElements[lod - 1];
+		}
+
 		Renderable* renderable;
 		Vector<BeastRenderableElement> elements;
 
+		/**
+		 * Elements to render in place of @p elements at lower levels of detail, one set for each LOD of the renderable's
+		 * mesh. Each element is a copy of the matching entry in @p elements that references the LOD's mesh, and shares
+		 * the GPU parameters of the original.
+		 */
+		Vector<Vector<BeastRenderableElement>> lodElements;
+
+		/** Screen size, as a fraction of the view height, below which the matching entry in @p lodElements is used. */
+		Vector<float> lodScreenSizes;
+
+		/** Per-object data in the format used by GpuSceneBuffer. */
+		PerObjectInstanceData instanceData;
+
+		/** World transform of the object, as of the last call to updatePerObjectBuffer(). */
+		Matrix4 worldTransform = Matrix4::IDENTITY;
+
+		/** World transform the object was rendered with during the previous frame. Used for calculating velocity. */
+		Matrix4 prevWorldTransform = Matrix4::IDENTITY;
+
+		/** True if the object's transform changed since the start of the previous frame. */
+		bool moving = false;
+
+		/** True if the object's transform changed since the start of the current frame. */
+		bool movedThisFrame = false;
+
+		/** Identifier of the object in the static renderable octree. Only valid for static objects. */
+		OctreeElementId octreeId;
+
+		/** Index of the object in SceneInfo::dynamicRenderables, or -1 if the object is static. */
+		UINT32 dynamicIdx = (UINT32)-1;
+
+		/** 
+		 * Buffer that the object's vertices are skinned into every frame, if the object is skinned in a compute pass
+		 * rather than in the vertex program. See RenderBeastOptions::computeSkinning.
+		 */
+		SPtr<PooledVertexBuffer> skinnedVertices;
+
+		/** 
+		 * Buffer that the object's morph shapes are blended into, if they are blended in a compute pass. See
+		 * RenderBeastOptions::computeMorphShapes.
+		 */
+		SPtr<PooledVertexBuffer> morphedVertices;
+
+		/** Morph shape deltas used for blending into @p morphedVertices. */
+		SPtr<GpuMorphShapes> gpuMorphShapes;
+
+		/** Buffer containing the most recent weight of each morph shape. */
+		SPtr<GpuBuffer> morphShapeWeights;
+
+		/** Version of the morph shape weights last blended into @p morphedVertices. */
+		UINT32 morphShapeVersion = 0;
+
 		SPtr<GpuParamBlockBuffer> perObjectParamBuffer;
 		SPtr<GpuParamBlockBuffer> perCallParamBuffer;
 	};
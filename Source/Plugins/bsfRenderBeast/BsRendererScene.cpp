@@ -12,11 +12,92 @@
 #include "Utility/BsSamplerOverrides.h"
 #include "BsRenderBeastOptions.h"
 #include "BsRenderBeast.h"
+#include "Utility/BsBitwise.h"
+#include "Utility/BsGpuResourcePool.h"
+#include "Shading/BsGpuSkinning.h"
+#include "Shading/BsGpuMorphShapes.h"
+#include "Animation/BsMorphShapes.h"
+#include "Animation/BsAnimationManager.h"
+#include "RenderAPI/BsGpuBuffer.h"
 
 namespace bs {	namespace ct
 {
 	PerFrameParamDef gPerFrameParamDef;
 
+	simd::AABox RenderableOctreeOptions::getBounds(RendererObject* renderable, void* context)
+	{
+		const SceneInfo* sceneInfo = (const SceneInfo*)context;
+		UINT32 renderableId = renderable->renderable->getRendererId();
+
+		return simd::AABox(sceneInfo->renderableCullInfos[renderableId].bounds.getBox());
+	}
+
+	void RenderableOctreeOptions::setElementId(RendererObject* renderable, const OctreeElementId& id, void* context)
+	{
+		renderable->octreeId = id;
+	}
+
+	void findIntersectingRenderables(const SceneInfo& sceneInfo, const ConvexVolume& volume, UINT64 layers,
+		VisibilityMask& visibility)
+	{
+		findIntersectingStaticRenderables(sceneInfo, volume, layers, visibility);
+
+		const UINT32 numDynamicRenderables = (UINT32)sceneInfo.dynamicRenderables.size();
+		if(numDynamicRenderables == 0)
+			return;
+
+		VisibilityMask dynamicVisibility;
+		dynamicVisibility.reset(numDynamicRenderables);
+
+		sceneInfo.dynamicRenderableCullBounds.findIntersecting(volume, true, dynamicVisibility.getWords());
+		resolveDynamicRenderableVisibility(sceneInfo, dynamicVisibility, layers, visibility);
+	}
+
+	void findIntersectingStaticRenderables(const SceneInfo& sceneInfo, const ConvexVolume& volume, UINT64 layers,
+		VisibilityMask& visibility)
+	{
+		const Vector<CullInfo>& cullInfos = sceneInfo.renderableCullInfos;
+
+		RenderableOctree::VolumeIntersectIterator iter(sceneInfo.staticRenderables, volume);
+		while(iter.moveNext())
+		{
+			UINT32 renderableId = iter.getElement()->renderable->getRendererId();
+			const CullInfo& cullInfo = cullInfos[renderableId];
+
+			if((cullInfo.layer & layers) == 0)
+				continue;
+
+			// Boxes of partially visible nodes were already tested by the octree, but the sphere can sometimes cull more
+			if(!iter.isFullyInside() && !volume.intersects(cullInfo.bounds.getSphere()))
+				continue;
+
+			visibility.set(renderableId);
+		}
+	}
+
+	void resolveDynamicRenderableVisibility(const SceneInfo& sceneInfo, const VisibilityMask& dynamicVisibility,
+		UINT64 layers, VisibilityMask& visibility)
+	{
+		const Vector<CullInfo>& cullInfos = sceneInfo.renderableCullInfos;
+		const Vector<UINT32>& dynamicRenderables = sceneInfo.dynamicRenderables;
+		const UINT32 numDynamicRenderables = (UINT32)dynamicRenderables.size();
+
+		const UINT32* words = dynamicVisibility.getWords();
+		for(UINT32 i = 0; i < numDynamicRenderables; i += VisibilityMask::BITS_PER_WORD)
+		{
+			UINT32 word = words[i / VisibilityMask::BITS_PER_WORD];
+			while(word != 0)
+			{
+				UINT32 bit = Bitwise::getBitShift(word);
+				word &= word - 1;
+
+				UINT32 renderableId = dynamicRenderables[i + bit];
+				if((cullInfos[renderableId].layer & layers) != 0)
+					visibility.set(renderableId);
+			}
+		}
+	}
+
 	RendererScene::RendererScene(const SPtr<RenderBeastOptions>& options)
 		:mOptions(options)
 	{
@@ -26,10 +107,10 @@ namespace bs {	namespace ct
 	RendererScene::~RendererScene()
 	{
 		for (auto& entry : mInfo.renderables)
-			bs_delete(entry);
+			bs_delete<RendererObject, RendererAlloc>(entry);
 
 		for (auto& entry : mInfo.views)
-			bs_delete(entry);
+			bs_delete<RendererView, RendererAlloc>(entry);
 
 		assert(mSamplerOverrides.empty());
 	}
@@ -38,7 +119,7 @@ namespace bs {	namespace ct
 	{
 		RENDERER_VIEW_DESC viewDesc = createViewDesc(camera);
 
-		RendererView* view = bs_new<RendererView>(viewDesc);
+		RendererView* view = bs_new<RendererView, RendererAlloc>(viewDesc);
 		view->setRenderSettings(camera->getRenderSettings());
 		view->updatePerViewBuffer();
 
@@ -107,7 +188,7 @@ namespace bs {	namespace ct
 		
 		// Last element is the one we want to erase
 		RendererView* view = mInfo.views[mInfo.views.size() - 1];
-		bs_delete(view);
+		bs_delete<RendererView, RendererAlloc>(view);
 
 		mInfo.views.erase(mInfo.views.end() - 1);
 
@@ -135,7 +216,8 @@ namespace bs {	namespace ct
 				light->setRendererId(lightId);
 
 				mInfo.radialLights.push_back(RendererLight(light));
-				mInfo.radialLightWorldBounds.push_back(light->getBounds());
+				mInfo.radialLights.back().staticShadowVersion = mNextStaticShadowVersion++;
+				mInfo.radialLightCullIndex.add(light->getBounds(), light->getMobility() == ObjectMobility::Movable);
 			}
 			else // Spot
 			{
@@ -143,7 +225,8 @@ namespace bs {	namespace ct
 				light->setRendererId(lightId);
 
 				mInfo.spotLights.push_back(RendererLight(light));
-				mInfo.spotLightWorldBounds.push_back(light->getBounds());
+				mInfo.spotLights.back().staticShadowVersion = mNextStaticShadowVersion++;
+				mInfo.spotLightCullIndex.add(light->getBounds(), light->getMobility() == ObjectMobility::Movable);
 			}
 		}
 	}
@@ -153,9 +236,15 @@ namespace bs {	namespace ct
 		UINT32 lightId = light->getRendererId();
 
 		if (light->getType() == LightType::Radial)
-			mInfo.radialLightWorldBounds[lightId] = light->getBounds();
+		{
+			mInfo.radialLightCullIndex.set(lightId, light->getBounds());
+			mInfo.radialLights[lightId].staticShadowVersion = mNextStaticShadowVersion++;
+		}
 		else if(light->getType() == LightType::Spot)
-			mInfo.spotLightWorldBounds[lightId] = light->getBounds();
+		{
+			mInfo.spotLightCullIndex.set(lightId, light->getBounds());
+			mInfo.spotLights[lightId].staticShadowVersion = mNextStaticShadowVersion++;
+		}
 	}
 
 	void RendererScene::unregisterLight(Light* light)
@@ -187,14 +276,13 @@ namespace bs {	namespace ct
 				{
 					// Swap current last element with the one we want to erase
 					std::swap(mInfo.radialLights[lightId], mInfo.radialLights[lastLightId]);
-					std::swap(mInfo.radialLightWorldBounds[lightId], mInfo.radialLightWorldBounds[lastLightId]);
 
 					lastLight->setRendererId(lightId);
 				}
 
 				// Last element is the one we want to erase
 				mInfo.radialLights.erase(mInfo.radialLights.end() - 1);
-				mInfo.radialLightWorldBounds.erase(mInfo.radialLightWorldBounds.end() - 1);
+				mInfo.radialLightCullIndex.remove(lightId);
 			}
 			else // Spot
 			{
@@ -205,36 +293,131 @@ namespace bs {	namespace ct
 				{
 					// Swap current last element with the one we want to erase
 					std::swap(mInfo.spotLights[lightId], mInfo.spotLights[lastLightId]);
-					std::swap(mInfo.spotLightWorldBounds[lightId], mInfo.spotLightWorldBounds[lastLightId]);
 
 					lastLight->setRendererId(lightId);
 				}
 
 				// Last element is the one we want to erase
 				mInfo.spotLights.erase(mInfo.spotLights.end() - 1);
-				mInfo.spotLightWorldBounds.erase(mInfo.spotLightWorldBounds.end() - 1);
+				mInfo.spotLightCullIndex.remove(lightId);
 			}
 		}
 	}
 
+	/** 
+	 * Checks should the vertices of the provided renderable be skinned in a compute pass, rather than in the vertex
+	 * programs of every pass that renders it.
+	 */
+	static bool useComputeSkinning(Renderable* renderable, const RenderBeastOptions& options)
+	{
+		if (!options.computeSkinning || gRenderBeast()->getFeatureSet() != RenderBeastFeatureSet::Desktop)
+			return false;
+
+		// Morph shapes are provided in a separate, CPU-written vertex stream, so only purely skinned objects are supported
+		if (renderable->getAnimType() != RenderableAnimType::Skinned || renderable->getBoneMatrixBuffer() == nullptr)
+			return false;
+
+		SPtr<Mesh> mesh = renderable->getMesh();
+		SPtr<VertexData> vertexData = mesh->getVertexData();
+		if (vertexData->getBufferCount() != 1 || vertexData->getBuffer(0) == nullptr)
+			return false;
+
+		if (!SkinVerticesMat::isSupported(vertexData->vertexDeclaration->getProperties()))
+			return false;
+
+		return vertexData->getBuffer(0)->getLoadStore() != nullptr;
+	}
+
+	/** Checks should the morph shapes of the provided renderable be blended in a compute pass. */
+	static bool useComputeMorphShapes(Renderable* renderable, const RenderBeastOptions& options)
+	{
+		if (!options.computeMorphShapes || gRenderBeast()->getFeatureSet() != RenderBeastFeatureSet::Desktop)
+			return false;
+
+		RenderableAnimType animType = renderable->getAnimType();
+		if (animType != RenderableAnimType::Morph && animType != RenderableAnimType::SkinnedMorph)
+			return false;
+
+		return renderable->getMesh()->getMorphShapes() != nullptr;
+	}
+
 	void RendererScene::registerRenderable(Renderable* renderable)
 	{
 		UINT32 renderableId = (UINT32)mInfo.renderables.size();
 
 		renderable->setRendererId(renderableId);
 
-		mInfo.renderables.push_back(bs_new<RendererObject>());
+		mInfo.renderables.push_back(bs_new<RendererObject, RendererAlloc>());
 		mInfo.renderableCullInfos.push_back(CullInfo(renderable->getBounds(), renderable->getLayer()));
 
 		RendererObject* rendererObject = mInfo.renderables.back();
 		rendererObject->renderable = renderable;
+
+		if(renderable->getMobility() == ObjectMobility::Movable)
+		{
+			rendererObject->dynamicIdx = (UINT32)mInfo.dynamicRenderables.size();
+
+			mInfo.dynamicRenderables.push_back(renderableId);
+			mInfo.dynamicRenderableCullBounds.add(mInfo.renderableCullInfos[renderableId].bounds);
+		}
+		else
+			mInfo.staticRenderables.addElement(rendererObject);
+
+		rendererObject->prevWorldTransform = renderable->getMatrix();
 		rendererObject->updatePerObjectBuffer();
+		mInfo.renderableData.setObject(renderableId, rendererObject->instanceData, 
+			mInfo.renderableCullInfos[renderableId].bounds);
+
+		if(rendererObject->hasStaticShadow())
+			invalidateStaticShadows(mInfo.renderableCullInfos[renderableId].bounds.getSphere());
 
 		SPtr<Mesh> mesh = renderable->getMesh();
 		if (mesh != nullptr)
 		{
 			const MeshProperties& meshProps = mesh->getProperties();
-			SPtr<VertexDeclaration> vertexDecl = mesh->getVertexData()->vertexDeclaration;
+			SPtr<VertexData> vertexData = mesh->getVertexData();
+			SPtr<VertexDeclaration> vertexDecl = vertexData->vertexDeclaration;
+
+			if (useComputeSkinning(renderable, *mOptions))
+			{
+				SPtr<VertexBuffer> meshVertices = vertexData->getBuffer(0);
+				const VertexBufferProperties& vbProps = meshVertices->getProperties();
+
+				rendererObject->skinnedVertices = GpuResourcePool::instance().get(
+					POOLED_VERTEX_BUFFER_DESC::create(vbProps.getVertexSize(), vbProps.getNumVertices()));
+			}
+
+			if (useComputeMorphShapes(renderable, *mOptions))
+			{
+				SPtr<MorphShapes> morphShapes = mesh->getMorphShapes();
+
+				// Matches the layout of Renderable::getMorphShapeBuffer()
+				UINT32 vertexSize = sizeof(Vector3) + sizeof(UINT32);
+				rendererObject->morphedVertices = GpuResourcePool::instance().get(
+					POOLED_VERTEX_BUFFER_DESC::create(vertexSize, morphShapes->getNumVertices()));
+
+				if (rendererObject->morphedVertices != nullptr)
+				{
+					rendererObject->gpuMorphShapes = GpuMorphShapes::get(morphShapes);
+
+					UINT32 numShapes = std::max(morphShapes->getNumShapes(), 1U);
+
+					GPU_BUFFER_DESC weightsDesc;
+					weightsDesc.type = GBT_STANDARD;
+					weightsDesc.format = BF_32X1F;
+					weightsDesc.elementCount = numShapes;
+					weightsDesc.usage = GBU_DYNAMIC;
+
+					rendererObject->morphShapeWeights = GpuBuffer::create(weightsDesc);
+
+					Vector<float> zeroWeights(numShapes, 0.0f);
+					rendererObject->morphShapeWeights->writeData(0, numShapes * sizeof(float), zeroWeights.data(),
+						BWT_DISCARD);
+
+					// Ensures the buffer gets blended before first use, even if no animation data is available yet
+					rendererObject->morphShapeVersion = (UINT32)-1;
+				}
+			}
 
 			for (UINT32 i = 0; i < meshProps.getNumSubMeshes(); i++)
 			{
@@ -245,9 +428,21 @@ namespace bs {	namespace ct
 				renElement.subMesh = meshProps.getSubMesh(i);
 				renElement.renderableId = renderableId;
 				renElement.animType = renderable->getAnimType();
+
+				// Elements skinned in a compute pass are rendered as static meshes
+				if (rendererObject->skinnedVertices != nullptr)
+				{
+					renElement.animType = RenderableAnimType::None;
+					renElement.skinnedVertexBuffer = rendererObject->skinnedVertices->buffer;
+				}
 				renElement.animationId = renderable->getAnimationId();
 				renElement.morphShapeVersion = 0;
-				renElement.morphShapeBuffer = renderable->getMorphShapeBuffer();
+
+				if (rendererObject->morphedVertices != nullptr)
+					renElement.morphShapeBuffer = rendererObject->morphedVertices->buffer;
+				else
+					renElement.morphShapeBuffer = renderable->getMorphShapeBuffer();
+
 				renElement.boneMatrixBuffer = renderable->getBoneMatrixBuffer();
 				renElement.morphVertexDeclaration = renderable->getMorphVertexDeclaration();
 
@@ -268,42 +463,64 @@ namespace bs {	namespace ct
 				ShaderFlags shaderFlags = renElement.material->getShader()->getFlags();
 				bool useForwardRendering = shaderFlags.isSet(ShaderFlag::Forward) || shaderFlags.isSet(ShaderFlag::Transparent);
 				
-				RenderableAnimType animType = renderable->getAnimType();
+				RenderableAnimType animType = renElement.animType;
+				bool supportsClusteredForward = gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
 
 				static const ShaderVariation* VAR_LOOKUP[4];
+				const ShaderVariation* instancedVariation;
 				if(useForwardRendering)
 				{
-					bool supportsClusteredForward = gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
-
 					if(supportsClusteredForward)
 					{
-						VAR_LOOKUP[0] = &getForwardRenderingVariation<false, false, true>();
-						VAR_LOOKUP[1] = &getForwardRenderingVariation<true, false, true>();
-						VAR_LOOKUP[2] = &getForwardRenderingVariation<false, true, true>();
-						VAR_LOOKUP[3] = &getForwardRenderingVariation<true, true, true>();
+						VAR_LOOKUP[0] = &getForwardRenderingVariation<false, false, true, false>();
+						VAR_LOOKUP[1] = &getForwardRenderingVariation<true, false, true, false>();
+						VAR_LOOKUP[2] = &getForwardRenderingVariation<false, true, true, false>();
+						VAR_LOOKUP[3] = &getForwardRenderingVariation<true, true, true, false>();
+
+						instancedVariation = &getForwardRenderingVariation<false, false, true, true>();
 					}
 					else
 					{
-						VAR_LOOKUP[0] = &getForwardRenderingVariation<false, false, false>();
-						VAR_LOOKUP[1] = &getForwardRenderingVariation<true, false, false>();
-						VAR_LOOKUP[2] = &getForwardRenderingVariation<false, true, false>();
-						VAR_LOOKUP[3] = &getForwardRenderingVariation<true, true, false>();
+						VAR_LOOKUP[0] = &getForwardRenderingVariation<false, false, false, false>();
+						VAR_LOOKUP[1] = &getForwardRenderingVariation<true, false, false, false>();
+						VAR_LOOKUP[2] = &getForwardRenderingVariation<false, true, false, false>();
+						VAR_LOOKUP[3] = &getForwardRenderingVariation<true, true, false, false>();
+
+						// Non-clustered forward rendering binds lights per-object, so the objects cannot be instanced
+						instancedVariation = nullptr;
 					}
 				}
 				else
 				{
-					VAR_LOOKUP[0] = &getVertexInputVariation<false, false>();
-					VAR_LOOKUP[1] = &getVertexInputVariation<true, false>();
-					VAR_LOOKUP[2] = &getVertexInputVariation<false, true>();
-					VAR_LOOKUP[3] = &getVertexInputVariation<true, true>();
+					VAR_LOOKUP[0] = &getBasePassVariation<false, false, false>();
+					VAR_LOOKUP[1] = &getBasePassVariation<true, false, false>();
+					VAR_LOOKUP[2] = &getBasePassVariation<false, true, false>();
+					VAR_LOOKUP[3] = &getBasePassVariation<true, true, false>();
+
+					instancedVariation = &getBasePassVariation<false, false, true>();
 				}
 
-				const ShaderVariation* variation = VAR_LOOKUP[(int)animType];
+				// Animated elements use per-object bone, morph or skinned vertex buffers, so only static meshes can be
+				// instanced
+				if(animType != RenderableAnimType::None || renElement.skinnedVertexBuffer != nullptr)
+					instancedVariation = nullptr;
 
 				FIND_TECHNIQUE_DESC findDesc;
-				findDesc.variation = variation;
+				UINT32 techniqueIdx = (UINT32)-1;
 
-				UINT32 techniqueIdx = renElement.material->findTechnique(findDesc);
+				if(instancedVariation != nullptr)
+				{
+					findDesc.variation = instancedVariation;
+					techniqueIdx = renElement.material->findTechnique(findDesc);
+				}
+
+				renElement.instanced = techniqueIdx != (UINT32)-1;
+
+				if (techniqueIdx == (UINT32)-1)
+				{
+					findDesc.variation = VAR_LOOKUP[(int)animType];
+					techniqueIdx = renElement.material->findTechnique(findDesc);
+				}
 
 				if (techniqueIdx == (UINT32)-1)
 					techniqueIdx = renElement.material->getDefaultTechnique();
@@ -354,6 +571,9 @@ namespace bs {	namespace ct
 
 				// Generate or assigned renderer specific data for the material
 				renElement.params = renElement.material->createParamsSet(techniqueIdx);
+
+				// Elements using materials with identical parameters share the material parameter buffers
+				renElement.params->setShareParamBlocks(true);
 				renElement.material->updateParamsSet(renElement.params, true);
 
 				// Generate or assign sampler state overrides
@@ -405,6 +625,21 @@ namespace bs {	namespace ct
 			if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "boneMatrices"))
 				gpuParams->setBuffer(GPT_VERTEX_PROGRAM, "boneMatrices", element.boneMatrixBuffer);
 
+			if (element.instanced)
+			{
+				gpuParams->getParamInfo()->getBindings(
+					GpuPipelineParamInfoBase::ParamType::ParamBlock,
+					"PerInstance",
+					element.perInstanceBindings
+				);
+
+				if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "gInstanceObjectIds"))
+					gpuParams->getBufferParam(GPT_VERTEX_PROGRAM, "gInstanceObjectIds", element.instanceObjectIdsParam);
+
+				if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "gObjectData"))
+					gpuParams->getBufferParam(GPT_VERTEX_PROGRAM, "gObjectData", element.objectDataParam);
+			}
+
 			ShaderFlags shaderFlags = shader->getFlags();
 			bool useForwardRendering = shaderFlags.isSet(ShaderFlag::Forward) || shaderFlags.isSet(ShaderFlag::Transparent);
 
@@ -453,6 +688,36 @@ namespace bs {	namespace ct
 				element.imageBasedParams.populate(gpuParams, GPT_FRAGMENT_PROGRAM, true, supportsClusteredForward,
 					supportsClusteredForward);
 			}
+
+			element.updateDrawPacket();
+		}
+
+		// Elements for lower levels of detail only differ in the mesh they render. Morph shapes are defined for the 
+		// vertices of the full detail mesh, so morph animated objects always use it. Same goes for objects skinned in a
+		// compute pass, as their vertices are skinned from the full detail mesh.
+		RenderableAnimType animType = renderable->getAnimType();
+		bool isMorphAnimated = animType == RenderableAnimType::Morph || animType == RenderableAnimType::SkinnedMorph;
+
+		if (mesh != nullptr && !isMorphAnimated && rendererObject->skinnedVertices == nullptr)
+		{
+			for (auto& lod : mesh->getLODs())
+			{
+				if (lod.mesh == nullptr)
+					break;
+
+				const MeshProperties& lodMeshProps = lod.mesh->getProperties();
+
+				Vector<BeastRenderableElement> lodElements = rendererObject->elements;
+				for (UINT32 i = 0; i < (UINT32)lodElements.size(); i++)
+				{
+					lodElements[i].mesh = lod.mesh;
+					lodElements[i].subMesh = lodMeshProps.getSubMesh(i);
+					lodElements[i].updateDrawPacket();
+				}
+
+				rendererObject->lodElements.push_back(lodElements);
+				rendererObject->lodScreenSizes.push_back(lod.screenSize);
+			}
 		}
 	}
 
@@ -460,8 +725,40 @@ namespace bs {	namespace ct
 	{
 		UINT32 renderableId = renderable->getRendererId();
 
-		mInfo.renderables[renderableId]->updatePerObjectBuffer();
+		RendererObject* rendererObject = mInfo.renderables[renderableId];
+
+		// Keep the transform from the start of the frame as the previous one, even if updated multiple times
+		if(!rendererObject->movedThisFrame)
+			rendererObject->prevWorldTransform = rendererObject->worldTransform;
+
+		rendererObject->movedThisFrame = true;
+		if(!rendererObject->moving)
+		{
+			rendererObject->moving = true;
+			mMovingRenderables.push_back(rendererObject);
+		}
+
+		rendererObject->updatePerObjectBuffer();
+
+		// Both the old and the new area need to be re-rendered in any affected shadow maps
+		if(rendererObject->hasStaticShadow())
+		{
+			invalidateStaticShadows(mInfo.renderableCullInfos[renderableId].bounds.getSphere());
+			invalidateStaticShadows(renderable->getBounds().getSphere());
+		}
+
 		mInfo.renderableCullInfos[renderableId].bounds = renderable->getBounds();
+		mInfo.renderableData.setObject(renderableId, rendererObject->instanceData, 
+			mInfo.renderableCullInfos[renderableId].bounds);
+
+		if(rendererObject->dynamicIdx != (UINT32)-1)
+			mInfo.dynamicRenderableCullBounds.set(rendererObject->dynamicIdx, mInfo.renderableCullInfos[renderableId].bounds);
+		else
+		{
+			// Static objects shouldn't normally change their bounds, but re-insert them in case they did
+			mInfo.staticRenderables.removeElement(rendererObject->octreeId);
+			mInfo.staticRenderables.addElement(rendererObject);
+		}
 	}
 
 	void RendererScene::unregisterRenderable(Renderable* renderable)
@@ -490,6 +787,30 @@ namespace bs {	namespace ct
 			element.samplerOverrides = nullptr;
 		}
 
+		if(rendererObject->hasStaticShadow())
+			invalidateStaticShadows(mInfo.renderableCullInfos[renderableId].bounds.getSphere());
+
+		if(rendererObject->dynamicIdx != (UINT32)-1)
+		{
+			UINT32 dynamicIdx = rendererObject->dynamicIdx;
+			UINT32 lastDynamicIdx = (UINT32)mInfo.dynamicRenderables.size() - 1;
+
+			if(dynamicIdx != lastDynamicIdx)
+			{
+				// Swap current last element with the one we want to erase
+				UINT32 lastDynamicRenderableId = mInfo.dynamicRenderables[lastDynamicIdx];
+
+				mInfo.dynamicRenderables[dynamicIdx] = lastDynamicRenderableId;
+				mInfo.dynamicRenderableCullBounds.swap(dynamicIdx, lastDynamicIdx);
+				mInfo.renderables[lastDynamicRenderableId]->dynamicIdx = dynamicIdx;
+			}
+
+			mInfo.dynamicRenderables.erase(mInfo.dynamicRenderables.end() - 1);
+			mInfo.dynamicRenderableCullBounds.removeLast();
+		}
+		else
+			mInfo.staticRenderables.removeElement(rendererObject->octreeId);
+
 		if (renderableId != lastRenderableId)
 		{
 			// Swap current last element with the one we want to erase
@@ -498,15 +819,34 @@ namespace bs {	namespace ct
 
 			lastRenerable->setRendererId(renderableId);
 
+			RendererObject* lastRendererObject = mInfo.renderables[renderableId];
+			if(lastRendererObject->dynamicIdx != (UINT32)-1)
+				mInfo.dynamicRenderables[lastRendererObject->dynamicIdx] = renderableId;
+
 			for (auto& element : elements)
 				element.renderableId = renderableId;
 		}
 
+		if (rendererObject->moving)
+		{
+			auto iterFind = std::find(mMovingRenderables.begin(), mMovingRenderables.end(), rendererObject);
+			if (iterFind != mMovingRenderables.end())
+				mMovingRenderables.erase(iterFind);
+		}
+
+		if (rendererObject->skinnedVertices != nullptr)
+			GpuResourcePool::instance().release(rendererObject->skinnedVertices);
+
+		if (rendererObject->morphedVertices != nullptr)
+			GpuResourcePool::instance().release(rendererObject->morphedVertices);
+
 		// Last element is the one we want to erase
 		mInfo.renderables.erase(mInfo.renderables.end() - 1);
 		mInfo.renderableCullInfos.erase(mInfo.renderableCullInfos.end() - 1);
+		mInfo.renderableData.removeObject(renderableId);
+		mInfo.renderableIdVersion++;
 
-		bs_delete(rendererObject);
+		bs_delete<RendererObject, RendererAlloc>(rendererObject);
 	}
 
 	void RendererScene::registerReflectionProbe(ReflectionProbe* probe)
@@ -517,7 +857,7 @@ namespace bs {	namespace ct
 		mInfo.reflProbes.push_back(RendererReflectionProbe(probe));
 		RendererReflectionProbe& probeInfo = mInfo.reflProbes.back();
 
-		mInfo.reflProbeWorldBounds.push_back(probe->getBounds());
+		mInfo.reflProbeCullIndex.add(probe->getBounds(), probe->getMobility() == ObjectMobility::Movable);
 
 		// Find a spot in cubemap array
 		UINT32 numArrayEntries = (UINT32)mInfo.reflProbeCubemapArrayUsedSlots.size();
@@ -549,7 +889,7 @@ namespace bs {	namespace ct
 	{
 		// Should only get called if transform changes, any other major changes and ReflProbeInfo entry gets rebuild
 		UINT32 probeId = probe->getRendererId();
-		mInfo.reflProbeWorldBounds[probeId] = probe->getBounds();
+		mInfo.reflProbeCullIndex.set(probeId, probe->getBounds());
 
 		if (texture)
 		{
@@ -573,14 +913,13 @@ namespace bs {	namespace ct
 		{
 			// Swap current last element with the one we want to erase
 			std::swap(mInfo.reflProbes[probeId], mInfo.reflProbes[lastProbeId]);
-			std::swap(mInfo.reflProbeWorldBounds[probeId], mInfo.reflProbeWorldBounds[lastProbeId]);
 
 			lastProbe->setRendererId(probeId);
 		}
 
 		// Last element is the one we want to erase
 		mInfo.reflProbes.erase(mInfo.reflProbes.end() - 1);
-		mInfo.reflProbeWorldBounds.erase(mInfo.reflProbeWorldBounds.end() - 1);
+		mInfo.reflProbeCullIndex.remove(probeId);
 	}
 
 	void RendererScene::setReflectionProbeArrayIndex(UINT32 probeIdx, UINT32 arrayIdx, bool markAsClean)
@@ -628,7 +967,11 @@ namespace bs {	namespace ct
 		mOptions = options;
 
 		for (auto& entry : mInfo.views)
+		{
 			entry->setStateReductionMode(mOptions->stateReductionMode);
+			entry->setOcclusionCulling(mOptions->occlusionCulling);
+			entry->setLODHysteresis(mOptions->lodHysteresis);
+		}
 	}
 
 	RENDERER_VIEW_DESC RendererScene::createViewDesc(Camera* camera) const
@@ -685,12 +1028,29 @@ namespace bs {	namespace ct
 		viewDesc.viewTransform = camera->getViewMatrix();
 		viewDesc.projType = camera->getProjectionType();
 
+		viewDesc.occlusionCulling = mOptions->occlusionCulling;
+		viewDesc.lodHysteresis = mOptions->lodHysteresis;
 		viewDesc.stateReduction = mOptions->stateReductionMode;
 		viewDesc.sceneCamera = camera;
 
 		return viewDesc;
 	}
 
+	void RendererScene::invalidateStaticShadows(const Sphere& bounds)
+	{
+		for (auto& light : mInfo.spotLights)
+		{
+			if (light.internal->getBounds().intersects(bounds))
+				light.staticShadowVersion = mNextStaticShadowVersion++;
+		}
+
+		for (auto& light : mInfo.radialLights)
+		{
+			if (light.internal->getBounds().intersects(bounds))
+				light.staticShadowVersion = mNextStaticShadowVersion++;
+		}
+	}
+
 	void RendererScene::updateCameraRenderTargets(Camera* camera, bool remove)
 	{
 		SPtr<RenderTarget> renderTarget = camera->getViewport()->getTarget();
@@ -856,14 +1216,63 @@ namespace bs {	namespace ct
 		gPerFrameParamDef.gTime.set(mPerFrameParamBuffer, time);
 	}
 
+	void RendererScene::updateRenderableData()
+	{
+		// Objects that moved during the previous frame but not during this one no longer have any velocity, so their
+		// previous transform needs to be brought up to date
+		for(auto iter = mMovingRenderables.begin(); iter != mMovingRenderables.end();)
+		{
+			RendererObject* rendererObject = *iter;
+			if(rendererObject->movedThisFrame)
+			{
+				rendererObject->movedThisFrame = false;
+				++iter;
+				continue;
+			}
+
+			rendererObject->prevWorldTransform = rendererObject->worldTransform;
+			rendererObject->updatePerObjectBuffer();
+			rendererObject->moving = false;
+
+			UINT32 renderableId = rendererObject->renderable->getRendererId();
+			mInfo.renderableData.setObject(renderableId, rendererObject->instanceData, 
+				mInfo.renderableCullInfos[renderableId].bounds);
+
+			iter = mMovingRenderables.erase(iter);
+		}
+
+		mInfo.renderableData.update();
+	}
+
 	void RendererScene::prepareRenderable(UINT32 idx, const FrameInfo& frameInfo)
 	{
 		if (mInfo.renderableReady[idx])
 			return;
 		
+		RendererObject* rendererObject = mInfo.renderables[idx];
+
 		// Note: Before uploading bone matrices perhaps check if they has actually been changed since last frame
 		if(frameInfo.animData != nullptr)
-			mInfo.renderables[idx]->renderable->updateAnimationBuffers(*frameInfo.animData);
+		{
+			bool updateMorphShapes = rendererObject->morphedVertices == nullptr;
+			rendererObject->renderable->updateAnimationBuffers(*frameInfo.animData, updateMorphShapes);
+		}
+
+		// Blend the morph shapes once, so all passes rendering the object this frame can use the result
+		if(rendererObject->morphedVertices != nullptr)
+			blendMorphShapes(*rendererObject, frameInfo);
+
+		// Skin the vertices once, so all passes rendering the object this frame can use the result
+		if(rendererObject->skinnedVertices != nullptr)
+		{
+			Renderable* renderable = rendererObject->renderable;
+			SPtr<VertexData> vertexData = renderable->getMesh()->getVertexData();
+
+			SkinVerticesMat* skinMat = SkinVerticesMat::get();
+			skinMat->execute(vertexData->vertexDeclaration->getProperties(), vertexData->vertexCount,
+				vertexData->getBuffer(0)->getLoadStore(), renderable->getBoneMatrixBuffer(),
+				rendererObject->skinnedVertices->loadStore);
+		}
 		
 		// Note: Could this step be moved in notifyRenderableUpdated, so it only triggers when material actually gets
 		// changed? Although it shouldn't matter much because if the internal versions keeping track of dirty params.
@@ -873,4 +1282,47 @@ namespace bs {	namespace ct
 		mInfo.renderables[idx]->perObjectParamBuffer->flushToGPU();
 		mInfo.renderableReady[idx] = true;
 	}
+
+	void RendererScene::blendMorphShapes(RendererObject& rendererObject, const FrameInfo& frameInfo)
+	{
+		const EvaluatedAnimationData::MorphShapeInfo* morphShapeInfo = nullptr;
+		if(frameInfo.animData != nullptr)
+		{
+			auto iterFind = frameInfo.animData->infos.find(rendererObject.renderable->getAnimationId());
+			if(iterFind != frameInfo.animData->infos.end())
+				morphShapeInfo = &iterFind->second.morphShapeInfo;
+		}
+
+		bool blendRequired = rendererObject.morphShapeVersion == (UINT32)-1;
+		if(morphShapeInfo != nullptr && morphShapeInfo->version != rendererObject.morphShapeVersion)
+		{
+			// Shapes were already blended by the animation system (GPU blending was disabled after registration)
+			if(morphShapeInfo->meshData != nullptr)
+			{
+				SPtr<MeshData> meshData = morphShapeInfo->meshData;
+				rendererObject.morphedVertices->buffer->writeData(0, meshData->getSize(), meshData->getData(),
+					BWT_DISCARD);
+
+				rendererObject.morphShapeVersion = morphShapeInfo->version;
+				return;
+			}
+
+			UINT32 numShapes = rendererObject.gpuMorphShapes->getNumShapes();
+			if(morphShapeInfo->shapeWeights.size() == numShapes && numShapes > 0)
+			{
+				rendererObject.morphShapeWeights->writeData(0, numShapes * sizeof(float), 
+					morphShapeInfo->shapeWeights.data(), BWT_DISCARD);
+			}
+
+			rendererObject.morphShapeVersion = morphShapeInfo->version;
+			blendRequired = true;
+		}
+
+		if(!blendRequired)
+			return;
+
+		BlendMorphShapesMat* blendMat = BlendMorphShapesMat::get();
+		blendMat->execute(*rendererObject.gpuMorphShapes, rendererObject.morphShapeWeights, 
+			rendererObject.morphedVertices->loadStore);
+	}
 }}
@@ -5,6 +5,7 @@
 #include "BsRenderBeastPrerequisites.h"
 #include "BsRendererLight.h"
 #include "BsRendererView.h"
+#include "BsGpuSceneBuffer.h"
 #include "Shading/BsLightProbes.h"
 #include "Utility/BsSamplerOverrides.h"
 
@@ -23,6 +24,30 @@ namespace bs
 	// Limited by max number of array elements in texture for DX11 hardware
 	constexpr UINT32 MaxReflectionCubemaps = 2048 / 6;
 
+	/** Options used for the octree containing static renderables. */
+	struct RenderableOctreeOptions
+	{
+		enum { LoosePadding = 8 };
+		enum { MinElementsPerNode = 8 };
+		enum { MaxElementsPerNode = 16 };
+		enum { MaxDepth = 12 };
+
+		/** Returns the bounds of the provided renderable. Context must point to the owning SceneInfo. */
+		static simd::AABox getBounds(RendererObject* renderable, void* context);
+
+		/** Updates the octree element identifier stored in the provided renderable. */
+		static void setElementId(RendererObject* renderable, const OctreeElementId& id, void* context);
+	};
+
+	/** Spatial partitioning tree containing renderables that cannot move. */
+	using RenderableOctree = Octree<RendererObject*, RenderableOctreeOptions>;
+
+	/**
+	 * Extent of the root node of the octrees containing static scene objects. Objects outside of this area are still
+	 * handled correctly, but aren't partitioned and must always be tested individually.
+	 */
+	constexpr float SceneOctreeExtent = 4096.0f;
+
 	/** Contains most scene objects relevant to the renderer. */
 	struct SceneInfo
 	{
@@ -35,16 +60,27 @@ namespace bs
 		Vector<RendererObject*> renderables;
 		Vector<CullInfo> renderableCullInfos;
 
+		// Incremented whenever a renderable is removed, as renderer IDs of other renderables can change or be reused
+		UINT32 renderableIdVersion = 0;
+
+		// Per-object data of all renderables, indexed by renderable ID
+		GpuSceneBuffer renderableData;
+
+		// Renderables that cannot move are stored in an octree, while the rest are culled as a flat list
+		RenderableOctree staticRenderables { Vector3::ZERO, SceneOctreeExtent, this };
+		Vector<UINT32> dynamicRenderables;
+		BoundsArray dynamicRenderableCullBounds;
+
 		// Lights
 		Vector<RendererLight> directionalLights;
 		Vector<RendererLight> radialLights;
 		Vector<RendererLight> spotLights;
-		Vector<Sphere> radialLightWorldBounds;
-		Vector<Sphere> spotLightWorldBounds;
+		SceneCullIndex radialLightCullIndex { SceneOctreeExtent };
+		SceneCullIndex spotLightCullIndex { SceneOctreeExtent };
 
 		// Reflection probes
 		Vector<RendererReflectionProbe> reflProbes;
-		Vector<Sphere> reflProbeWorldBounds;
+		SceneCullIndex reflProbeCullIndex { SceneOctreeExtent };
 		Vector<bool> reflProbeCubemapArrayUsedSlots;
 		SPtr<Texture> reflProbeCubemapsTex;
 
@@ -59,6 +95,36 @@ namespace bs
 		mutable Vector<bool> renderableReady;
 	};
 
+	/**
+	 * Finds all renderables whose bounds intersect the provided volume. Static renderables are found by traversing the
+	 * octree, while dynamic renderables are tested one by one.
+	 *
+	 * @param[in]	sceneInfo	Scene containing the renderables to test.
+	 * @param[in]	volume		Volume to test the renderable bounds against.
+	 * @param[in]	layers		Renderables that don't share any layers with this mask will be ignored.
+	 * @param[out]	visibility	Visibility flags for all renderables in the scene, indexed by renderable ID. Flags will
+	 *							be set for all renderables intersecting the volume, while others will be left as is. Must
+	 *							be large enough to hold all renderables.
+	 */
+	void findIntersectingRenderables(const SceneInfo& sceneInfo, const ConvexVolume& volume, UINT64 layers,
+		VisibilityMask& visibility);
+
+	/** 
+	 * Performs the same operation as findIntersectingRenderables(), except only static renderables are considered. 
+	 *
+	 * @note	Thread safe, as long as the scene isn't modified and the output mask isn't accessed by other threads.
+	 */
+	void findIntersectingStaticRenderables(const SceneInfo& sceneInfo, const ConvexVolume& volume, UINT64 layers,
+		VisibilityMask& visibility);
+
+	/**
+	 * Sets the flags in @p visibility, indexed by renderable ID, for every dynamic renderable whose flag is set in 
+	 * @p dynamicVisibility and that shares at least one layer with @p layers. @p dynamicVisibility is indexed the same
+	 * as SceneInfo::dynamicRenderables and is normally populated by culling SceneInfo::dynamicRenderableCullBounds.
+	 */
+	void resolveDynamicRenderableVisibility(const SceneInfo& sceneInfo, const VisibilityMask& dynamicVisibility,
+		UINT64 layers, VisibilityMask& visibility);
+
 	/** Contains information about the scene (e.g. renderables, lights, cameras) required by the renderer. */
 	class RendererScene
 	{
@@ -143,6 +209,13 @@ namespace bs
 		/** Updates global per frame parameter buffers with new values. To be called at the start of every frame. */
 		void setParamFrameParams(float time);
 
+		/** 
+		 * Uploads per-object data of renderables that were added or modified since the last call to the GPU. Also
+		 * updates the previous frame transforms of objects that stopped moving. To be called once at the start of 
+		 * every frame.
+		 */
+		void updateRenderableData();
+
 		/**
 		 * Performs necessary steps to make a renderable ready for rendering. This must be called at least once every frame,
 		 * for every renderable that will be drawn. Multiple calls for the same renderable during a single frame will result
@@ -165,11 +238,27 @@ namespace bs
 		 */
 		void updateCameraRenderTargets(Camera* camera, bool remove = false);
 
+		/** 
+		 * Invalidates cached static shadow maps of all spot and radial lights whose range intersects the provided bounds.
+		 * Should be called whenever a static shadow caster is added, removed or modified.
+		 */
+		void invalidateStaticShadows(const Sphere& bounds);
+
+		/** 
+		 * Blends the morph shapes of an object that uses compute morph shape blending, if its shape weights changed 
+		 * since the last time.
+		 */
+		void blendMorphShapes(RendererObject& rendererObject, const FrameInfo& frameInfo);
+
 		SceneInfo mInfo;
 		SPtr<GpuParamBlockBuffer> mPerFrameParamBuffer;
 		UnorderedMap<SamplerOverrideKey, MaterialSamplerOverrides*> mSamplerOverrides;
 
+		/** Objects whose transform changed during the current or the previous frame, and therefore have velocity. */
+		Vector<RendererObject*> mMovingRenderables;
+
 		SPtr<RenderBeastOptions> mOptions;
+		UINT64 mNextStaticShadowVersion = 1;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(PerFrameParamDef)
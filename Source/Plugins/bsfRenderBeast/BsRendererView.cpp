@@ -10,12 +10,178 @@
 #include "BsRendererLight.h"
 #include "BsRendererScene.h"
 #include "BsRenderBeast.h"
+#include "Math/BsSIMD.h"
+#include "Threading/BsTaskScheduler.h"
+#include "RenderAPI/BsCommandBuffer.h"
+#include "Shading/BsOcclusionCulling.h"
+#include "Shading/BsPostProcessing.h"
+#include "Managers/BsTextureStreamingManager.h"
 
 namespace bs { namespace ct
 {
 	PerCameraParamDef gPerCameraParamDef;
 	SkyboxParamDef gSkyboxParamDef;
 
+	/** Granularity of the dynamic resolution scale. Keeps the number of distinct render target sizes low. */
+	static constexpr float RESOLUTION_SCALE_STEP = 0.05f;
+
+	/** Minimum number of frames between two dynamic resolution scale changes. */
+	static constexpr UINT32 RESOLUTION_SCALE_INTERVAL = 30;
+
+	/** 
+	 * Fraction of the frame time budget the frame time needs to fall under before the resolution scale is increased.
+	 * Prevents the scale from oscillating when the frame time is close to the budget.
+	 */
+	static constexpr float RESOLUTION_SCALE_HEADROOM = 0.85f;
+
+	/** Number of distinct sub-pixel offsets the projection is jittered by when temporal anti-aliasing is enabled. */
+	static constexpr UINT32 TEMPORAL_AA_JITTER_COUNT = 8;
+
+	/** Returns the element with the specified index of the Halton low-discrepancy sequence, in range [0, 1). */
+	static float halton(UINT32 index, UINT32 base)
+	{
+		float output = 0.0f;
+		float fraction = 1.0f / base;
+
+		while(index > 0)
+		{
+			output += (index % base) * fraction;
+			index /= base;
+			fraction /= base;
+		}
+
+		return output;
+	}
+
+	simd::AABox SceneCullIndex::OctreeOptions::getBounds(UINT32 id, void* context)
+	{
+		const SceneCullIndex* index = (const SceneCullIndex*)context;
+		return simd::AABox(index->mBounds[id]);
+	}
+
+	void SceneCullIndex::OctreeOptions::setElementId(UINT32 id, const OctreeElementId& elemId, void* context)
+	{
+		SceneCullIndex* index = (SceneCullIndex*)context;
+		index->mOctreeIds[id] = elemId;
+	}
+
+	SceneCullIndex::SceneCullIndex(float extent)
+		:mStaticObjects(Vector3::ZERO, extent, this)
+	{ }
+
+	void SceneCullIndex::add(const Sphere& bounds, bool movable)
+	{
+		UINT32 id = (UINT32)mBounds.size();
+
+		mBounds.push_back(bounds);
+		mOctreeIds.push_back(OctreeElementId());
+		mDynamicIdx.push_back((UINT32)-1);
+
+		addToPartition(id, movable);
+	}
+
+	void SceneCullIndex::set(UINT32 id, const Sphere& bounds)
+	{
+		mBounds[id] = bounds;
+
+		if(mDynamicIdx[id] != (UINT32)-1)
+			mDynamicBounds.set(mDynamicIdx[id], bounds);
+		else
+		{
+			// Static objects shouldn't normally change their bounds, but re-insert them in case they did
+			mStaticObjects.removeElement(mOctreeIds[id]);
+			mStaticObjects.addElement(id);
+		}
+	}
+
+	void SceneCullIndex::remove(UINT32 id)
+	{
+		removeFromPartition(id);
+
+		UINT32 lastId = (UINT32)mBounds.size() - 1;
+		if(id != lastId)
+		{
+			// The octree stores IDs directly, so the last object needs to be re-inserted under its new ID
+			bool movable = mDynamicIdx[lastId] != (UINT32)-1;
+			removeFromPartition(lastId);
+
+			mBounds[id] = mBounds[lastId];
+			addToPartition(id, movable);
+		}
+
+		mBounds.erase(mBounds.end() - 1);
+		mOctreeIds.erase(mOctreeIds.end() - 1);
+		mDynamicIdx.erase(mDynamicIdx.end() - 1);
+	}
+
+	void SceneCullIndex::findIntersecting(const ConvexVolume& volume, VisibilityMask& visibility) const
+	{
+		Octree<UINT32, OctreeOptions>::VolumeIntersectIterator iter(mStaticObjects, volume);
+		while(iter.moveNext())
+		{
+			UINT32 id = iter.getElement();
+
+			// Boxes of partially visible nodes were already tested by the octree, but the sphere can sometimes cull more
+			if(!iter.isFullyInside() && !volume.intersects(mBounds[id]))
+				continue;
+
+			visibility.set(id);
+		}
+
+		const UINT32 numDynamicObjects = (UINT32)mDynamicObjects.size();
+		if(numDynamicObjects == 0)
+			return;
+
+		VisibilityMask dynamicVisibility;
+		dynamicVisibility.reset(numDynamicObjects);
+
+		mDynamicBounds.findIntersecting(volume, false, dynamicVisibility.getWords());
+		dynamicVisibility.forEachSet([this, &visibility](UINT32 dynamicIdx)
+		{
+			visibility.set(mDynamicObjects[dynamicIdx]);
+		});
+	}
+
+	void SceneCullIndex::addToPartition(UINT32 id, bool movable)
+	{
+		if(movable)
+		{
+			mDynamicIdx[id] = (UINT32)mDynamicObjects.size();
+
+			mDynamicObjects.push_back(id);
+			mDynamicBounds.add(mBounds[id]);
+		}
+		else
+		{
+			mDynamicIdx[id] = (UINT32)-1;
+			mStaticObjects.addElement(id);
+		}
+	}
+
+	void SceneCullIndex::removeFromPartition(UINT32 id)
+	{
+		UINT32 dynamicIdx = mDynamicIdx[id];
+		if(dynamicIdx == (UINT32)-1)
+		{
+			mStaticObjects.removeElement(mOctreeIds[id]);
+			return;
+		}
+
+		UINT32 lastDynamicIdx = (UINT32)mDynamicObjects.size() - 1;
+		if(dynamicIdx != lastDynamicIdx)
+		{
+			// Swap current last element with the one we want to erase
+			UINT32 lastDynamicId = mDynamicObjects[lastDynamicIdx];
+
+			mDynamicObjects[dynamicIdx] = lastDynamicId;
+			mDynamicBounds.swap(dynamicIdx, lastDynamicIdx);
+			mDynamicIdx[lastDynamicId] = dynamicIdx;
+		}
+
+		mDynamicObjects.erase(mDynamicObjects.end() - 1);
+		mDynamicBounds.removeLast();
+	}
+
 	SkyboxMat::SkyboxMat()
 	{
 		if(mParams->hasTexture(GPT_FRAGMENT_PROGRAM, "gSkyTex"))
@@ -48,7 +214,7 @@ namespace bs { namespace ct
 	}
 
 	RendererViewData::RendererViewData()
-		:encodeDepth(false), depthEncodeNear(0.0f), depthEncodeFar(0.0f)
+		:encodeDepth(false), occlusionCulling(false), depthEncodeNear(0.0f), depthEncodeFar(0.0f), lodHysteresis(0.1f)
 	{
 		
 	}
@@ -82,6 +248,7 @@ namespace bs { namespace ct
 		mProperties.prevViewProjTransform = mProperties.viewProjTransform;
 
 		setStateReductionMode(desc.stateReduction);
+		updateOcclusionCulling();
 	}
 
 	void RendererView::setStateReductionMode(StateReduction reductionMode)
@@ -106,6 +273,12 @@ namespace bs { namespace ct
 
 		mRenderSettingsHash++;
 
+		if (!mRenderSettings->dynamicResolution.enabled && mResolutionScale != 1.0f)
+		{
+			mResolutionScale = 1.0f;
+			applyResolutionScale();
+		}
+
 		// Update compositor hierarchy (Note: Needs to be called even when viewport size (or other information) changes,
 		// but we're currently calling it here as all such calls are followed by setRenderSettings.
 		mCompositor.build(*this, RCNodeFinalResolve::getNodeId());
@@ -130,7 +303,99 @@ namespace bs { namespace ct
 		mProperties.prevViewProjTransform = Matrix4::IDENTITY;
 		mTargetDesc = desc.target;
 
+		applyResolutionScale();
 		setStateReductionMode(desc.stateReduction);
+		updateOcclusionCulling();
+	}
+
+	void RendererView::setOcclusionCulling(bool enabled)
+	{
+		if (mProperties.occlusionCulling == enabled)
+			return;
+
+		mProperties.occlusionCulling = enabled;
+		updateOcclusionCulling();
+
+		// Occlusion tests are executed by a compositor node, so the hierarchy needs to be rebuilt
+		if (mRenderSettings != nullptr)
+			mCompositor.build(*this, RCNodeFinalResolve::getNodeId());
+	}
+
+	void RendererView::updateOcclusionCulling()
+	{
+		// Occlusion tests require compute shaders
+		bool supported = gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
+		if (mProperties.occlusionCulling && supported)
+		{
+			if (mOcclusionCulling == nullptr)
+				mOcclusionCulling = bs_shared_ptr_new<OcclusionCulling>();
+			else
+				mOcclusionCulling->reset();
+		}
+		else
+			mOcclusionCulling = nullptr;
+	}
+
+	void RendererView::updateResolutionScale(float gpuFrameTime)
+	{
+		const DynamicResolutionSettings& settings = mRenderSettings->dynamicResolution;
+
+		// Upscaling happens when resolving to the final target, which requires the image to go through post-processing,
+		// and the encoded depth must match the target size
+		bool supported = settings.enabled && !mRenderSettings->overlayOnly && mProperties.runPostProcessing &&
+			!mProperties.encodeDepth;
+
+		if (!supported || gpuFrameTime <= 0.0f || settings.targetFrameTime <= 0.0f)
+		{
+			if (mResolutionScale != 1.0f)
+			{
+				mResolutionScale = 1.0f;
+				applyResolutionScale();
+				updatePerViewBuffer();
+			}
+
+			return;
+		}
+
+		// Frame time measurements lag behind by a few frames, so only react once the previous change had time to settle
+		mFramesSinceScaleChange++;
+		if (mFramesSinceScaleChange < RESOLUTION_SCALE_INTERVAL)
+			return;
+
+		float maxScale = Math::clamp(settings.maxScale, RESOLUTION_SCALE_STEP, 1.0f);
+		float minScale = Math::clamp(settings.minScale, RESOLUTION_SCALE_STEP, maxScale);
+
+		// Most of the frame cost scales with the number of pixels, so each dimension scales with the square root
+		float newScale = mResolutionScale * std::sqrt(settings.targetFrameTime / gpuFrameTime);
+		newScale = Math::clamp(newScale, minScale, maxScale);
+		newScale = Math::clamp(Math::roundToInt(newScale / RESOLUTION_SCALE_STEP) * RESOLUTION_SCALE_STEP, minScale, maxScale);
+
+		if (Math::abs(newScale - mResolutionScale) < RESOLUTION_SCALE_STEP * 0.5f)
+			return;
+
+		if (newScale > mResolutionScale && gpuFrameTime > settings.targetFrameTime * RESOLUTION_SCALE_HEADROOM)
+			return;
+
+		mResolutionScale = newScale;
+		mFramesSinceScaleChange = 0;
+
+		applyResolutionScale();
+		updatePerViewBuffer();
+	}
+
+	void RendererView::applyResolutionScale()
+	{
+		const Rect2I& nativeRect = mTargetDesc.viewRect;
+		if (mResolutionScale == 1.0f)
+		{
+			mProperties.viewRect = nativeRect;
+			return;
+		}
+
+		mProperties.viewRect.x = Math::floorToInt(nativeRect.x * mResolutionScale);
+		mProperties.viewRect.y = Math::floorToInt(nativeRect.y * mResolutionScale);
+		mProperties.viewRect.width = std::max(1, Math::roundToInt(nativeRect.width * mResolutionScale));
+		mProperties.viewRect.height = std::max(1, Math::roundToInt(nativeRect.height * mResolutionScale));
 	}
 
 	void RendererView::beginFrame()
@@ -141,6 +406,7 @@ namespace bs { namespace ct
 		Matrix4 NDCToPrevNDC = mProperties.prevViewProjTransform * invViewProj;
 		
 		gPerCameraParamDef.gNDCToPrevNDC.set(mParamBuffer, NDCToPrevNDC);
+		gPerCameraParamDef.gMatPrevViewProj.set(mParamBuffer, mProperties.prevViewProjTransform);
 	}
 
 	void RendererView::endFrame()
@@ -157,16 +423,55 @@ namespace bs { namespace ct
 		mTransparentQueue->clear();
 	}
 
-	void RendererView::determineVisible(const Vector<RendererObject*>& renderables, const Vector<CullInfo>& cullInfos,
-		Vector<bool>* visibility)
+	void RendererView::beginVisibility(const SceneInfo& sceneInfo)
+	{
+		mVisibility.renderables.reset((UINT32)sceneInfo.renderables.size());
+		mVisibility.radialLights.reset((UINT32)sceneInfo.radialLights.size());
+		mVisibility.spotLights.reset((UINT32)sceneInfo.spotLights.size());
+		mVisibility.reflProbes.reset((UINT32)sceneInfo.reflProbes.size());
+		mDynamicRenderableVisibility.reset((UINT32)sceneInfo.dynamicRenderables.size());
+		mRenderableLODs.resize(sceneInfo.renderables.size(), 0);
+		mInstancing.clear();
+
+		if (mOcclusionCulling != nullptr)
+			mOcclusionCulling->update(sceneInfo);
+	}
+
+	void RendererView::cullStatic(const SceneInfo& sceneInfo)
+	{
+		if (mRenderSettings->overlayOnly)
+			return;
+
+		findIntersectingStaticRenderables(sceneInfo, mProperties.cullFrustum, mProperties.visibleLayers, 
+			mVisibility.renderables);
+
+		calculateVisibility(sceneInfo.radialLightCullIndex, mVisibility.radialLights);
+		calculateVisibility(sceneInfo.spotLightCullIndex, mVisibility.spotLights);
+
+		// Don't recursively render reflection probes when generating reflection probe maps
+		if (!mProperties.capturingReflections)
+			calculateVisibility(sceneInfo.reflProbeCullIndex, mVisibility.reflProbes);
+	}
+
+	void RendererView::cullDynamicRenderables(const SceneInfo& sceneInfo, UINT32 begin, UINT32 end)
 	{
-		mVisibility.renderables.clear();
-		mVisibility.renderables.resize(renderables.size(), false);
+		if (mRenderSettings->overlayOnly)
+			return;
+
+		sceneInfo.dynamicRenderableCullBounds.findIntersecting(mProperties.cullFrustum, true, 
+			mDynamicRenderableVisibility.getWords(), begin, end);
+	}
 
+	void RendererView::endVisibility(const SceneInfo& sceneInfo)
+	{
 		if (mRenderSettings->overlayOnly)
 			return;
 
-		calculateVisibility(cullInfos, mVisibility.renderables);
+		resolveDynamicRenderableVisibility(sceneInfo, mDynamicRenderableVisibility, mProperties.visibleLayers, 
+			mVisibility.renderables);
+
+		const Vector<RendererObject*>& renderables = sceneInfo.renderables;
+		const Vector<CullInfo>& cullInfos = sceneInfo.renderableCullInfos;
 
 		// Update per-object param buffers and queue render elements
 		for(UINT32 i = 0; i < (UINT32)cullInfos.size(); i++)
@@ -175,10 +480,27 @@ namespace bs { namespace ct
 				continue;
 
 			const AABox& boundingBox = cullInfos[i].bounds.getBox();
+
+			// Renderables are re-tested every frame, even when occluded, so they become visible once disoccluded
+			if (mOcclusionCulling != nullptr)
+			{
+				mOcclusionCulling->addTest(i, boundingBox);
+
+				if (mOcclusionCulling->isOccluded(i))
+				{
+					mVisibility.renderables.clear(i);
+					continue;
+				}
+			}
+
 			float distanceToCamera = (mProperties.viewOrigin - boundingBox.getCenter()).length();
+			UINT32 screenSize = getScreenSize(cullInfos[i].bounds.getSphere(), distanceToCamera);
 
-			for (auto& renderElem : renderables[i]->elements)
+			UINT32 lod = selectLOD(*renderables[i], i, screenSize);
+			for (auto& renderElem : renderables[i]->getElements(lod))
 			{
+				addTextureStreamingRequests(*renderElem.material, screenSize);
+
 				// Note: I could keep renderables in multiple separate arrays, so I don't need to do the check here
 				ShaderFlags shaderFlags = renderElem.material->getShader()->getFlags();
 
@@ -191,110 +513,101 @@ namespace bs { namespace ct
 			}
 		}
 
-		if(visibility != nullptr)
+		if (!mTextureStreamingRequests.empty())
 		{
-			for (UINT32 i = 0; i < (UINT32)renderables.size(); i++)
-			{
-				bool visible = (*visibility)[i];
-
-				(*visibility)[i] = visible || mVisibility.renderables[i];
-			}
+			bs::TextureStreamingManager::instance()._notifyRequiredSizes(mTextureStreamingRequests);
+			mTextureStreamingRequests.clear();
 		}
 
 		mForwardOpaqueQueue->sort();
 		mDeferredOpaqueQueue->sort();
 		mTransparentQueue->sort();
+
+		mInstancing.addQueue(*mForwardOpaqueQueue);
+		mInstancing.addQueue(*mDeferredOpaqueQueue);
+		mInstancing.addQueue(*mTransparentQueue);
 	}
 
-	void RendererView::determineVisible(const Vector<RendererLight>& lights, const Vector<Sphere>& bounds, 
-		LightType lightType, Vector<bool>* visibility)
+	UINT32 RendererView::getScreenSize(const Sphere& bounds, float distanceToCamera) const
 	{
-		// Special case for directional lights, they're always visible
-		if(lightType == LightType::Directional)
-		{
-			if (visibility)
-				visibility->assign(lights.size(), true);
+		// Projected diameter in NDC is 2 * radius * proj[1][1] / distance, and NDC spans two units
+		float scale = mProperties.projTransform[1][1] * bounds.getRadius();
+		if (mProperties.projType == PT_PERSPECTIVE)
+			scale /= std::max(distanceToCamera - bounds.getRadius(), mProperties.nearPlane);
 
-			return;
-		}
+		float screenSize = scale * (float)mTargetDesc.viewRect.height;
+		return (UINT32)Math::clamp(screenSize, 1.0f, (float)std::numeric_limits<INT32>::max());
+	}
 
-		Vector<bool>* perViewVisibility;
-		if(lightType == LightType::Radial)
-		{
-			mVisibility.radialLights.clear();
-			mVisibility.radialLights.resize(lights.size(), false);
+	void RendererView::addTextureStreamingRequests(const Material& material, UINT32 screenSize)
+	{
+		SPtr<MaterialParams> params = material._getInternalParams();
+		if (params == nullptr)
+			return;
 
-			perViewVisibility = &mVisibility.radialLights;
-		}
-		else // Spot
+		UINT32 numParams = params->getNumParams();
+		for (UINT32 i = 0; i < numParams; i++)
 		{
-			mVisibility.spotLights.clear();
-			mVisibility.spotLights.resize(lights.size(), false);
-
-			perViewVisibility = &mVisibility.spotLights;
-		}
-
-		if (mRenderSettings->overlayOnly)
-			return;
+			const MaterialParams::ParamData* paramData = params->getParamData(i);
+			if (paramData->type != MaterialParams::ParamType::Texture)
+				continue;
 
-		calculateVisibility(bounds, *perViewVisibility);
+			SPtr<Texture> texture;
+			TextureSurface surface;
+			params->getTexture(*paramData, texture, surface);
 
-		if(visibility != nullptr)
-		{
-			for (UINT32 i = 0; i < (UINT32)lights.size(); i++)
-			{
-				bool visible = (*visibility)[i];
+			if (texture == nullptr || (texture->getProperties().getUsage() & TU_STREAMED) == 0)
+				continue;
 
-				(*visibility)[i] = visible || (*perViewVisibility)[i];
-			}
+			auto iterFind = mTextureStreamingRequests.find(texture.get());
+			if (iterFind != mTextureStreamingRequests.end())
+				iterFind->second = std::max(iterFind->second, screenSize);
+			else
+				mTextureStreamingRequests[texture.get()] = screenSize;
 		}
 	}
 
-	void RendererView::calculateVisibility(const Vector<CullInfo>& cullInfos, Vector<bool>& visibility) const
+	UINT32 RendererView::selectLOD(const RendererObject& renderable, UINT32 renderableIdx, UINT32 screenSize)
 	{
-		UINT64 cameraLayers = mProperties.visibleLayers;
-		const ConvexVolume& worldFrustum = mProperties.cullFrustum;
+		const Vector<float>& lodScreenSizes = renderable.lodScreenSizes;
+		UINT32 numLODs = (UINT32)lodScreenSizes.size();
 
-		for (UINT32 i = 0; i < (UINT32)cullInfos.size(); i++)
+		// Note: Renderable indices change as renderables are removed, in which case the previous level is only a hint
+		UINT32 lod = std::min((UINT32)mRenderableLODs[renderableIdx], numLODs);
+		if (numLODs > 0)
 		{
-			if ((cullInfos[i].layer & cameraLayers) == 0)
-				continue;
+			float size = screenSize / (float)std::max(mTargetDesc.viewRect.height, 1U);
+			float hysteresis = mProperties.lodHysteresis;
 
-			// Do frustum culling
-			// Note: This is bound to be a bottleneck at some point. When it is ensure that intersect methods use vector
-			// operations, as it is trivial to update them. Also consider spatial partitioning.
-			const Sphere& boundingSphere = cullInfos[i].bounds.getSphere();
-			if (worldFrustum.intersects(boundingSphere))
-			{
-				// More precise with the box
-				const AABox& boundingBox = cullInfos[i].bounds.getBox();
+			while (lod < numLODs && size < lodScreenSizes[lod] * (1.0f - hysteresis))
+				lod++;
 
-				if (worldFrustum.intersects(boundingBox))
-					visibility[i] = true;
-			}
+			while (lod > 0 && size > lodScreenSizes[lod - 1] * (1.0f + hysteresis))
+				lod--;
 		}
+
+		mRenderableLODs[renderableIdx] = (UINT8)lod;
+		return lod;
 	}
 
-	void RendererView::calculateVisibility(const Vector<Sphere>& bounds, Vector<bool>& visibility) const
+	void RendererView::updateInstancing()
 	{
-		const ConvexVolume& worldFrustum = mProperties.cullFrustum;
+		mInstancing.update();
+	}
 
-		for (UINT32 i = 0; i < (UINT32)bounds.size(); i++)
-		{
-			if (worldFrustum.intersects(bounds[i]))
-				visibility[i] = true;
-		}
+	void RendererView::determineVisible(const SceneInfo& sceneInfo)
+	{
+		beginVisibility(sceneInfo);
+		cullStatic(sceneInfo);
+		cullDynamicRenderables(sceneInfo, 0, (UINT32)sceneInfo.dynamicRenderables.size());
+		endVisibility(sceneInfo);
+		updateInstancing();
 	}
 
-	void RendererView::calculateVisibility(const Vector<AABox>& bounds, Vector<bool>& visibility) const
+	void RendererView::calculateVisibility(const SceneCullIndex& index, VisibilityMask& visibility) const
 	{
 		const ConvexVolume& worldFrustum = mProperties.cullFrustum;
-
-		for (UINT32 i = 0; i < (UINT32)bounds.size(); i++)
-		{
-			if (worldFrustum.intersects(bounds[i]))
-				visibility[i] = true;
-		}
+		index.findIntersecting(worldFrustum, visibility);
 	}
 
 	Vector2 RendererView::getDeviceZToViewZ(const Matrix4& projMatrix)
@@ -423,12 +736,40 @@ namespace bs { namespace ct
 
 	void RendererView::updatePerViewBuffer()
 	{
-		Matrix4 viewProj = mProperties.projTransform * mProperties.viewTransform;
-		Matrix4 invProj = invertProjectionMatrix(mProperties.projTransform);
+		Matrix4 proj = mProperties.projTransform;
+		Matrix4 nonJitteredViewProj = mProperties.projTransform * mProperties.viewTransform;
+
+		// Offset the projection by a different sub-pixel amount every frame, so the temporal resolve can accumulate
+		// samples from multiple positions within a pixel
+		if (mRenderSettings->enableTemporalAA)
+		{
+			UINT32 sampleIdx = (mProperties.frameIdx % TEMPORAL_AA_JITTER_COUNT) + 1;
+			mTemporalJitter.x = halton(sampleIdx, 2) - 0.5f;
+			mTemporalJitter.y = halton(sampleIdx, 3) - 0.5f;
+
+			// Jitter is in pixels with Y pointing down the texture, convert it to NDC
+			const RenderAPIInfo& rapiInfo = RenderAPI::instance().getAPIInfo();
+			float ySign = rapiInfo.isFlagSet(RenderAPIFeatureFlag::UVYAxisUp) ^ 
+				rapiInfo.isFlagSet(RenderAPIFeatureFlag::NDCYAxisDown) ? 1.0f : -1.0f;
+
+			float offsetX = mTemporalJitter.x * 2.0f / mProperties.viewRect.width;
+			float offsetY = ySign * mTemporalJitter.y * 2.0f / mProperties.viewRect.height;
+
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				proj[0][i] += offsetX * proj[3][i];
+				proj[1][i] += offsetY * proj[3][i];
+			}
+		}
+		else
+			mTemporalJitter = Vector2(BsZero);
+
+		Matrix4 viewProj = proj * mProperties.viewTransform;
+		Matrix4 invProj = invertProjectionMatrix(proj);
 		Matrix4 invView = mProperties.viewTransform.inverseAffine();
 		Matrix4 invViewProj = invView * invProj;
 
-		gPerCameraParamDef.gMatProj.set(mParamBuffer, mProperties.projTransform);
+		gPerCameraParamDef.gMatProj.set(mParamBuffer, proj);
 		gPerCameraParamDef.gMatView.set(mParamBuffer, mProperties.viewTransform);
 		gPerCameraParamDef.gMatViewProj.set(mParamBuffer, viewProj);
 		gPerCameraParamDef.gMatInvViewProj.set(mParamBuffer, invViewProj);
@@ -440,15 +781,18 @@ namespace bs { namespace ct
 
 		// Only projects z/w coordinates (cancels out with the inverse matrix below)
 		Matrix4 projZ = Matrix4::IDENTITY;
-		projZ[2][2] = mProperties.projTransform[2][2];
-		projZ[2][3] = mProperties.projTransform[2][3];
-		projZ[3][2] = mProperties.projTransform[3][2];
+		projZ[2][2] = proj[2][2];
+		projZ[2][3] = proj[2][3];
+		projZ[3][2] = proj[3][2];
 		projZ[3][3] = 0.0f;
 
-		Matrix4 NDCToPrevNDC = mProperties.prevViewProjTransform * invViewProj;
+		// Reprojection is performed using non-jittered matrices, as the jitter is accounted for by the resolve filter
+		Matrix4 NDCToPrevNDC = mProperties.prevViewProjTransform * nonJitteredViewProj.inverse();
 		
 		gPerCameraParamDef.gMatScreenToWorld.set(mParamBuffer, invViewProj * projZ);
 		gPerCameraParamDef.gNDCToPrevNDC.set(mParamBuffer, NDCToPrevNDC);
+		gPerCameraParamDef.gMatNonJitteredViewProj.set(mParamBuffer, nonJitteredViewProj);
+		gPerCameraParamDef.gMatPrevViewProj.set(mParamBuffer, mProperties.prevViewProjTransform);
 		gPerCameraParamDef.gViewDir.set(mParamBuffer, mProperties.viewDirection);
 		gPerCameraParamDef.gViewOrigin.set(mParamBuffer, mProperties.viewOrigin);
 		gPerCameraParamDef.gDeviceZToWorldZ.set(mParamBuffer, getDeviceZToViewZ(mProperties.projTransform));
@@ -458,7 +802,7 @@ namespace bs { namespace ct
 		Vector2 nearFar(mProperties.nearPlane, mProperties.farPlane);
 		gPerCameraParamDef.gNearFar.set(mParamBuffer, nearFar);
 
-		const Rect2I& viewRect = mTargetDesc.viewRect;
+		const Rect2I& viewRect = mProperties.viewRect;
 
 		Vector4I viewportRect;
 		viewportRect[0] = viewRect.x;
@@ -481,13 +825,13 @@ namespace bs { namespace ct
 	{
 		RenderAPI& rapi = RenderAPI::instance();
 		const RenderAPIInfo& rapiInfo = rapi.getAPIInfo();
-		const Rect2I& viewRect = mTargetDesc.viewRect;
+		const Rect2I& viewRect = mProperties.viewRect;
 		
 		float halfWidth = viewRect.width * 0.5f;
 		float halfHeight = viewRect.height * 0.5f;
 
-		float rtWidth = mTargetDesc.targetWidth != 0 ? (float)mTargetDesc.targetWidth : 20.0f;
-		float rtHeight = mTargetDesc.targetHeight != 0 ? (float)mTargetDesc.targetHeight : 20.0f;
+		float rtWidth = mTargetDesc.targetWidth != 0 ? (float)mTargetDesc.targetWidth * mResolutionScale : 20.0f;
+		float rtHeight = mTargetDesc.targetHeight != 0 ? (float)mTargetDesc.targetHeight * mResolutionScale : 20.0f;
 
 		Vector4 ndcToUV;
 		ndcToUV.x = halfWidth / rtWidth;
@@ -503,9 +847,27 @@ namespace bs { namespace ct
 	}
 
 	void RendererView::updateLightGrid(const VisibleLightData& visibleLightData, 
-		const VisibleReflProbeData& visibleReflProbeData)
+		const VisibleReflProbeData& visibleReflProbeData, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		mLightGrid.updateGrid(*this, visibleLightData, visibleReflProbeData, !mRenderSettings->enableLighting,
+			commandBuffer);
+	}
+
+	bool RendererView::updateLatentEyeAdaptation(bool enabled, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mLightGrid.updateGrid(*this, visibleLightData, visibleReflProbeData, !mRenderSettings->enableLighting);
+		bool autoExposure = mRenderSettings->enableHDR && mRenderSettings->enableAutoExposure && 
+			!mRenderSettings->overlayOnly && mProperties.runPostProcessing;
+
+		if (!enabled || !autoExposure)
+		{
+			mLatentEyeAdaptation = nullptr;
+			return false;
+		}
+
+		if (mLatentEyeAdaptation == nullptr)
+			mLatentEyeAdaptation = bs_shared_ptr_new<LatentEyeAdaptation>();
+
+		return mLatentEyeAdaptation->queueHistogram(mRenderSettings->autoExposure, commandBuffer);
 	}
 
 	RendererViewGroup::RendererViewGroup()
@@ -547,49 +909,63 @@ namespace bs { namespace ct
 		if (allViewsOverlay)
 			return;
 
-		// Generate render queues per camera
-		mVisibility.renderables.resize(sceneInfo.renderables.size(), false);
-		mVisibility.renderables.assign(sceneInfo.renderables.size(), false);
-
-		for(UINT32 i = 0; i < numViews; i++)
-			mViews[i]->determineVisible(sceneInfo.renderables, sceneInfo.renderableCullInfos, &mVisibility.renderables);
+		for (UINT32 i = 0; i < numViews; i++)
+			mViews[i]->beginVisibility(sceneInfo);
 
-		// Calculate light visibility for all views
-		UINT32 numRadialLights = (UINT32)sceneInfo.radialLights.size();
-		mVisibility.radialLights.resize(numRadialLights, false);
-		mVisibility.radialLights.assign(numRadialLights, false);
+		// Cull static objects per view, and split dynamic renderables into chunks so large scenes with few views can
+		// still use all workers. Chunk sizes must be a multiple of the visibility mask word size, so different chunks
+		// never write to the same word.
+		static constexpr UINT32 DYNAMIC_CHUNK_SIZE = 32 * VisibilityMask::BITS_PER_WORD;
 
-		UINT32 numSpotLights = (UINT32)sceneInfo.spotLights.size();
-		mVisibility.spotLights.resize(numSpotLights, false);
-		mVisibility.spotLights.assign(numSpotLights, false);
+		const UINT32 numDynamic = (UINT32)sceneInfo.dynamicRenderables.size();
+		const UINT32 numDynamicChunks = Math::divideAndRoundUp(numDynamic, DYNAMIC_CHUNK_SIZE);
+		const UINT32 numCullTasks = numViews + numViews * numDynamicChunks;
 
-		for (UINT32 i = 0; i < numViews; i++)
+		TaskScheduler::instance().parallelFor(0, numCullTasks, 1, 
+			[this, &sceneInfo, numViews, numDynamicChunks, numDynamic](UINT32 begin, UINT32 end)
 		{
-			if (mViews[i]->getRenderSettings().overlayOnly)
-				continue;
+			for (UINT32 i = begin; i < end; i++)
+			{
+				if (i < numViews)
+				{
+					mViews[i]->cullStatic(sceneInfo);
+					continue;
+				}
 
-			mViews[i]->determineVisible(sceneInfo.radialLights, sceneInfo.radialLightWorldBounds, LightType::Radial,
-				&mVisibility.radialLights);
+				const UINT32 dynamicTaskIdx = i - numViews;
+				const UINT32 viewIdx = dynamicTaskIdx / numDynamicChunks;
+				const UINT32 chunkIdx = dynamicTaskIdx % numDynamicChunks;
 
-			mViews[i]->determineVisible(sceneInfo.spotLights, sceneInfo.spotLightWorldBounds, LightType::Spot,
-				&mVisibility.spotLights);
-		}
+				const UINT32 chunkBegin = chunkIdx * DYNAMIC_CHUNK_SIZE;
+				const UINT32 chunkEnd = std::min(chunkBegin + DYNAMIC_CHUNK_SIZE, numDynamic);
+
+				mViews[viewIdx]->cullDynamicRenderables(sceneInfo, chunkBegin, chunkEnd);
+			}
+		});
+
+		// Generate render queues per view
+		TaskScheduler::instance().parallelFor(0, numViews, 1, [this, &sceneInfo](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+				mViews[i]->endVisibility(sceneInfo);
+		});
 
-		// Calculate refl. probe visibility for all views
-		UINT32 numProbes = (UINT32)sceneInfo.reflProbes.size();
-		mVisibility.reflProbes.resize(numProbes, false);
-		mVisibility.reflProbes.assign(numProbes, false);
+		// Merge per-view visibility into visibility for the entire group
+		mVisibility.renderables.reset((UINT32)sceneInfo.renderables.size());
+		mVisibility.radialLights.reset((UINT32)sceneInfo.radialLights.size());
+		mVisibility.spotLights.reset((UINT32)sceneInfo.spotLights.size());
+		mVisibility.reflProbes.reset((UINT32)sceneInfo.reflProbes.size());
 
-		// Note: Per-view visibility for refl. probes currently isn't calculated
 		for (UINT32 i = 0; i < numViews; i++)
 		{
-			const auto& viewProps = mViews[i]->getProperties();
+			const VisibilityInfo& viewVisibility = mViews[i]->getVisibilityMasks();
 
-			// Don't recursively render reflection probes when generating reflection probe maps
-			if (viewProps.capturingReflections)
-				continue;
+			mVisibility.renderables.merge(viewVisibility.renderables);
+			mVisibility.radialLights.merge(viewVisibility.radialLights);
+			mVisibility.spotLights.merge(viewVisibility.spotLights);
+			mVisibility.reflProbes.merge(viewVisibility.reflProbes);
 
-			mViews[i]->calculateVisibility(sceneInfo.reflProbeWorldBounds, mVisibility.reflProbes);
+			mViews[i]->updateInstancing();
 		}
 
 		// Organize light and refl. probe visibility infomation in a more GPU friendly manner
@@ -600,16 +976,50 @@ namespace bs { namespace ct
 		mVisibleLightData.update(sceneInfo, *this);
 		mVisibleReflProbeData.update(sceneInfo, *this);
 
+		mAsyncComputeQueued = false;
+
 		bool supportsClusteredForward = gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
 		if(supportsClusteredForward)
 		{
+			// Light grid only depends on visibility information and not on any rasterization output, so it can be
+			// generated on the compute queue while shadow maps are being rendered
+			SPtr<CommandBuffer> commandBuffer;
+			if(mAsyncCompute)
+			{
+				if(mAsyncComputeCB == nullptr)
+					mAsyncComputeCB = CommandBuffer::create(GQT_COMPUTE);
+
+				commandBuffer = mAsyncComputeCB;
+			}
+
 			for (UINT32 i = 0; i < numViews; i++)
 			{
 				if (mViews[i]->getRenderSettings().overlayOnly)
 					continue;
 
-				mViews[i]->updateLightGrid(mVisibleLightData, mVisibleReflProbeData);
+				mViews[i]->updateLightGrid(mVisibleLightData, mVisibleReflProbeData, commandBuffer);
+				mAsyncComputeQueued |= commandBuffer != nullptr;
+
+				// Eye adaptation histogram is generated from the previous frame's scene color, so it doesn't depend on
+				// anything rendered this frame either
+				if(mViews[i]->updateLatentEyeAdaptation(mAsyncCompute, commandBuffer))
+					mAsyncComputeQueued |= commandBuffer != nullptr;
 			}
+
+			if(mAsyncComputeQueued)
+				RenderAPI::instance().submitCommandBuffer(mAsyncComputeCB);
 		}
 	}
+
+	UINT32 RendererViewGroup::getAsyncComputeSyncMask() const
+	{
+		if(!mAsyncComputeQueued)
+			return 0xFFFFFFFF;
+
+		// Sync with all queues except the one executing the asynchronous compute work
+		CommandSyncMask computeMask;
+		computeMask.addDependency(mAsyncComputeCB);
+
+		return ~computeMask.getMask();
+	}
 }}
@@ -8,16 +8,21 @@
 #include "Renderer/BsRenderSettings.h"
 #include "Math/BsBounds.h"
 #include "Math/BsConvexVolume.h"
+#include "Math/BsBoundsArray.h"
+#include "Utility/BsBitwise.h"
 #include "Shading/BsLightGrid.h"
 #include "Shading/BsShadowRendering.h"
 #include "BsRendererView.h"
 #include "BsRendererObject.h"
+#include "BsRendererInstancing.h"
 #include "BsRenderCompositor.h"
 
 namespace bs { namespace ct
 {
 	struct SceneInfo;
 	class RendererLight;
+	class OcclusionCulling;
+	class LatentEyeAdaptation;
 
 	/** @addtogroup RenderBeast
 	 *  @{
@@ -33,6 +38,8 @@ namespace bs { namespace ct
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatInvViewProj)
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatScreenToWorld)
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gNDCToPrevNDC)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatNonJitteredViewProj)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatPrevViewProj)
 		BS_PARAM_BLOCK_ENTRY(Vector2, gDeviceZToWorldZ)
 		BS_PARAM_BLOCK_ENTRY(Vector2, gNDCZToWorldZ)
 		BS_PARAM_BLOCK_ENTRY(Vector2, gNDCZToDeviceZ)
@@ -60,7 +67,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("SOLID_COLOR", color)
 			});
 
@@ -119,6 +126,12 @@ namespace bs { namespace ct
 		 */
 		bool encodeDepth : 1;
 
+		/** 
+		 * When enabled, renderables visible in the view will be tested for occlusion against the view's depth buffer. 
+		 * Renderables found to be occluded will be skipped during rendering on later frames.
+		 */
+		bool occlusionCulling : 1;
+
 		/**
 		 * Controls at which position to start encoding depth, in view space. Only relevant with @p encodeDepth is enabled.
 		 * Depth will be linearly interpolated between this value and @p depthEncodeFar.
@@ -131,6 +144,13 @@ namespace bs { namespace ct
 		 */
 		float depthEncodeFar;
 
+		/**
+		 * Margin, as a fraction of the LOD screen size, by which the size of a renderable on screen must pass the screen
+		 * size of a mesh level of detail before the view switches to that level. Prevents renderables close to the switch
+		 * point from continuously switching between two levels.
+		 */
+		float lodHysteresis;
+
 		UINT64 visibleLayers;
 		ConvexVolume cullFrustum;
 	};
@@ -186,13 +206,77 @@ namespace bs { namespace ct
 		UINT16 clearStencilValue;
 	};
 
+	/**
+	 * Packed set of visibility flags, one bit per object. Flags are stored in 32-bit words so they can be written to
+	 * directly by the culling code, multiple objects at a time.
+	 */
+	class VisibilityMask
+	{
+	public:
+		/** Number of flags stored in a single word. Matches the layout of masks written by BoundsArray queries. */
+		static constexpr UINT32 BITS_PER_WORD = BoundsArray::BITS_PER_WORD;
+
+		/** Resizes the mask so it holds @p count flags, and sets all of them to @p value. */
+		void reset(UINT32 count, bool value = false)
+		{
+			mCount = count;
+			mWords.assign((count + 31) / 32, value ? 0xFFFFFFFF : 0);
+		}
+
+		/** Returns the number of flags in the mask. */
+		UINT32 size() const { return mCount; }
+
+		/** Returns the flag at the specified index. */
+		bool operator[](UINT32 idx) const { return (mWords[idx >> 5] & (1U << (idx & 31))) != 0; }
+
+		/** Sets the flag at the specified index. */
+		void set(UINT32 idx) { mWords[idx >> 5] |= 1U << (idx & 31); }
+
+		/** Clears the flag at the specified index. */
+		void clear(UINT32 idx) { mWords[idx >> 5] &= ~(1U << (idx & 31)); }
+
+		/** Sets all the flags that are set in @p other. Both masks must be of the same size. */
+		void merge(const VisibilityMask& other)
+		{
+			assert(other.mCount == mCount);
+
+			for(UINT32 i = 0; i < (UINT32)mWords.size(); i++)
+				mWords[i] |= other.mWords[i];
+		}
+
+		/** Calls @p func with the index of every flag that is set, in increasing order. */
+		template<class Func>
+		void forEachSet(Func func) const
+		{
+			for(UINT32 i = 0; i < (UINT32)mWords.size(); i++)
+			{
+				UINT32 word = mWords[i];
+				while(word != 0)
+				{
+					func(i * BITS_PER_WORD + Bitwise::getBitShift(word));
+					word &= word - 1;
+				}
+			}
+		}
+
+		/** Returns the words storing the flags. Each word stores 32 flags, starting with the least significant bit. */
+		UINT32* getWords() { return mWords.data(); }
+
+		/** @copydoc getWords() */
+		const UINT32* getWords() const { return mWords.data(); }
+
+	private:
+		Vector<UINT32> mWords;
+		UINT32 mCount = 0;
+	};
+
 	/** Information whether certain scene objects are visible in a view, per object type. */
 	struct VisibilityInfo
 	{
-		Vector<bool> renderables;
-		Vector<bool> radialLights;
-		Vector<bool> spotLights;
-		Vector<bool> reflProbes;
+		VisibilityMask renderables;
+		VisibilityMask radialLights;
+		VisibilityMask spotLights;
+		VisibilityMask reflProbes;
 	};
 
 	/** Information used for culling an object against a view. */
@@ -206,6 +290,78 @@ namespace bs { namespace ct
 		UINT64 layer;
 	};
 
+	/**
+	 * Spatial index over bounding spheres of scene objects of a single type (e.g. lights or reflection probes),
+	 * identified by sequential IDs. Objects that cannot move are stored in an octree, while movable objects are kept in
+	 * a BoundsArray and tested one by one, as re-inserting them into the tree whenever they move would cost more
+	 * than it saves.
+	 */
+	class SceneCullIndex
+	{
+	public:
+		/** 
+		 * @param[in]	extent	Extent of the root node of the octree. Objects outside of this area are still handled
+		 *						correctly, but aren't partitioned.
+		 */
+		SceneCullIndex(float extent);
+
+		SceneCullIndex(const SceneCullIndex&) = delete;
+		SceneCullIndex& operator=(const SceneCullIndex&) = delete;
+
+		/** Appends a new object, with an ID equal to the number of objects in the index before the call. */
+		void add(const Sphere& bounds, bool movable);
+
+		/** Updates bounds of the object with the specified ID. */
+		void set(UINT32 id, const Sphere& bounds);
+
+		/** 
+		 * Removes the object with the specified ID. If it isn't the last object, the last object is moved to its ID,
+		 * mirroring the swap-and-pop removal used for the scene object arrays.
+		 */
+		void remove(UINT32 id);
+
+		/** Returns the number of objects in the index. */
+		UINT32 size() const { return (UINT32)mBounds.size(); }
+
+		/**
+		 * Sets the visibility flags, indexed by object ID, of all objects whose bounds intersect the provided volume. 
+		 * Flags of other objects are left as is.
+		 */
+		void findIntersecting(const ConvexVolume& volume, VisibilityMask& visibility) const;
+
+	private:
+		/** Options used for the octree containing static objects. Elements are object IDs. */
+		struct OctreeOptions
+		{
+			enum { LoosePadding = 8 };
+			enum { MinElementsPerNode = 8 };
+			enum { MaxElementsPerNode = 16 };
+			enum { MaxDepth = 12 };
+
+			/** Returns the bounds of the object with the provided ID. Context must point to the owning index. */
+			static simd::AABox getBounds(UINT32 id, void* context);
+
+			/** Updates the octree element identifier stored for the object with the provided ID. */
+			static void setElementId(UINT32 id, const OctreeElementId& elemId, void* context);
+		};
+
+		/** Inserts the object into the octree or the array of movable objects. */
+		void addToPartition(UINT32 id, bool movable);
+
+		/** Removes the object from the octree or the array of movable objects. */
+		void removeFromPartition(UINT32 id);
+
+		Octree<UINT32, OctreeOptions> mStaticObjects;
+
+		// Indexed by object ID
+		Vector<Sphere> mBounds;
+		Vector<OctreeElementId> mOctreeIds;
+		Vector<UINT32> mDynamicIdx;
+
+		Vector<UINT32> mDynamicObjects;
+		BoundsArray mDynamicBounds;
+	};
+
 	/**	Renderer information specific to a single render target. */
 	struct RendererRenderTarget
 	{
@@ -223,6 +379,12 @@ namespace bs { namespace ct
 		/** Sets state reduction mode that determines how do render queues group & sort renderables. */
 		void setStateReductionMode(StateReduction reductionMode);
 
+		/** Enables or disables occlusion culling for the view. See RendererViewData::occlusionCulling. */
+		void setOcclusionCulling(bool enabled);
+
+		/** Sets the hysteresis used when switching mesh levels of detail. See RendererViewData::lodHysteresis. */
+		void setLODHysteresis(float hysteresis) { mProperties.lodHysteresis = hysteresis; }
+
 		/** Updates the internal camera render settings. */
 		void setRenderSettings(const SPtr<RenderSettings>& settings);
 
@@ -236,6 +398,12 @@ namespace bs { namespace ct
 		/** Returns a structure describing the view. */
 		const RendererViewProperties& getProperties() const { return mProperties; }
 
+		/** 
+		 * Returns a structure describing the render target the view outputs to. Unlike RendererViewProperties::viewRect
+		 * the view rectangle in this structure is always at native resolution, regardless of the resolution scale.
+		 */
+		const RENDERER_VIEW_TARGET_DESC& getTargetDesc() const { return mTargetDesc; }
+
 		/** Returns the scene camera this object is based of. This can be null for manually constructed renderer cameras. */
 		Camera* getSceneCamera() const { return mCamera; }
 
@@ -263,59 +431,45 @@ namespace bs { namespace ct
 		const RenderCompositor& getCompositor() const { return mCompositor; }
 
 		/**
-		 * Populates view render queues by determining visible renderable objects. 
-		 *
-		 * @param[in]	renderables			A set of renderable objects to iterate over and determine visibility for.
-		 * @param[in]	cullInfos			A set of world bounds & other information relevant for culling the provided
-		 *									renderable objects. Must be the same size as the @p renderables array.
-		 * @param[out]	visibility			Output parameter that will have the true bit set for any visible renderable
-		 *									object. If the bit for an object is already set to true, the method will never
-		 *									change it to false which allows the same bitfield to be provided to multiple
-		 *									renderer views. Must be the same size as the @p renderables array.
-		 *									
-		 *									As a side-effect, per-view visibility data is also calculated and can be
-		 *									retrieved by calling getVisibilityMask().
-		 */
-		void determineVisible(const Vector<RendererObject*>& renderables, const Vector<CullInfo>& cullInfos,
-			Vector<bool>* visibility = nullptr);
+		 * Prepares the per-view visibility masks for determining visibility of objects in the provided scene. Must be
+		 * called before any calls to cullStatic() or cullDynamicRenderables(), and followed by a call to 
+		 * endVisibility() once all of those complete.
+		 */
+		void beginVisibility(const SceneInfo& sceneInfo);
 
-		/**
-		 * Calculates the visibility masks for all the lights of the provided type.
-		 * 
-		 * @param[in]	lights				A set of lights to determine visibility for.
-		 * @param[in]	bounds				Bounding sphere for each provided light. Must be the same size as the @p lights
-		 *									array.
-		 * @param[in]	type				Type of all the lights in the @p lights array.
-		 * @param[out]	visibility			Output parameter that will have the true bit set for any visible light. If the
-		 *									bit for a light is already set to true, the method will never change it to false
-		 *									which allows the same bitfield to be provided to multiple renderer views. Must
-		 *									be the same size as the @p lights array.
-		 *									
-		 *									As a side-effect, per-view visibility data is also calculated and can be
-		 *									retrieved by calling getVisibilityMask().
-		 */
-		void determineVisible(const Vector<RendererLight>& lights, const Vector<Sphere>& bounds, LightType type, 
-			Vector<bool>* visibility = nullptr);
+		/** 
+		 * Determines visibility of static renderables, lights and reflection probes, and stores the results in the
+		 * per-view visibility masks. Can be called in parallel with cullDynamicRenderables(), as well as with calls on
+		 * other views. 
+		 */
+		void cullStatic(const SceneInfo& sceneInfo);
 
 		/**
-		 * Culls the provided set of bounds against the current frustum and outputs a set of visibility flags determining
-		 * which entry is or isn't visible by this view. Both inputs must be arrays of the same size.
+		 * Determines visibility for dynamic renderables in range [@p begin, @p end) of the SceneInfo::dynamicRenderables
+		 * array. Can be called in parallel for non-overlapping ranges, as well as with cullStatic() and calls on other
+		 * views. Both @p begin and @p end must be multiples of VisibilityMask::BITS_PER_WORD, unless @p end is the
+		 * end of the array.
 		 */
-		void calculateVisibility(const Vector<CullInfo>& cullInfos, Vector<bool>& visibility) const;
+		void cullDynamicRenderables(const SceneInfo& sceneInfo, UINT32 begin, UINT32 end);
 
 		/**
-		 * Culls the provided set of bounds against the current frustum and outputs a set of visibility flags determining
-		 * which entry is or isn't visible by this view. Both inputs must be arrays of the same size.
+		 * Finalizes visibility of the renderables after all culling for this view has completed, and populates the view 
+		 * render queues with the visible renderables. Per-view visibility data can be retrieved by calling 
+		 * getVisibilityMasks() afterwards.
 		 */
-		void calculateVisibility(const Vector<Sphere>& bounds, Vector<bool>& visibility) const;
+		void endVisibility(const SceneInfo& sceneInfo);
+
+		/** Populates view render queues and per-view visibility masks, by performing all the culling steps in sequence. */
+		void determineVisible(const SceneInfo& sceneInfo);
 
 		/**
-		 * Culls the provided set of bounds against the current frustum and outputs a set of visibility flags determining
-		 * which entry is or isn't visible by this view. Both inputs must be arrays of the same size.
+		 * Culls the objects in the provided index against the current frustum and sets the visibility flags of the 
+		 * entries visible by this view. Only the bounding spheres are tested. Flags of entries that aren't visible are
+		 * left unchanged. Both inputs must be of the same size.
 		 */
-		void calculateVisibility(const Vector<AABox>& bounds, Vector<bool>& visibility) const;
+		void calculateVisibility(const SceneCullIndex& index, VisibilityMask& visibility) const;
 
-		/** Returns the visibility mask calculated with the last call to determineVisible(). */
+		/** Returns the visibility mask calculated with the last call to determineVisible() or endVisibility(). */
 		const VisibilityInfo& getVisibilityMasks() const { return mVisibility; }
 
 		/** Returns per-view settings that control rendering. */
@@ -327,7 +481,11 @@ namespace bs { namespace ct
 		 */
 		UINT64 getRenderSettingsHash() const { return mRenderSettingsHash; }
 
-		/** Updates the GPU buffer containing per-view information, with the latest internal data. */
+		/** 
+		 * Updates the GPU buffer containing per-view information, with the latest internal data. If temporal 
+		 * anti-aliasing is enabled this also jitters the projection according to the current frame index, and should
+		 * therefore be called every frame.
+		 */
 		void updatePerViewBuffer();
 
 		/** Returns a buffer that stores per-view parameters. */
@@ -339,8 +497,43 @@ namespace bs { namespace ct
 		 */
 		const LightGrid& getLightGrid() const { return mLightGrid; }
 
-		/** Updates the light grid used for forward rendering. */
-		void updateLightGrid(const VisibleLightData& visibleLightData, const VisibleReflProbeData& visibleReflProbeData);
+		/** 
+		 * Updates the light grid used for forward rendering. If @p commandBuffer is provided the grid generation is queued
+		 * on it, instead of the main command buffer.
+		 */
+		void updateLightGrid(const VisibleLightData& visibleLightData, const VisibleReflProbeData& visibleReflProbeData,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/** 
+		 * Returns the object keeping track of occlusion culling results for the view. Null if occlusion culling is
+		 * disabled, or not supported by the current feature set.
+		 */
+		const SPtr<OcclusionCulling>& getOcclusionCulling() const { return mOcclusionCulling; }
+
+		/**
+		 * Queues generation of the eye adaptation histogram from the previous frame's scene color, if @p enabled is
+		 * true and the view uses auto exposure. If @p commandBuffer is provided the work is queued on it, instead of
+		 * the main command buffer. Returns true if any work was queued. See LatentEyeAdaptation.
+		 */
+		bool updateLatentEyeAdaptation(bool enabled, const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/** 
+		 * Returns the object used for calculating eye adaptation with a frame of latency. Null if latent eye adaptation
+		 * is not used by the view.
+		 */
+		const SPtr<LatentEyeAdaptation>& getLatentEyeAdaptation() const { return mLatentEyeAdaptation; }
+
+		/** 
+		 * Returns groups of elements in the view's render queues that can be rendered using instancing. Only valid after 
+		 * a call to updateInstancing().
+		 */
+		const RendererInstancing& getInstancing() const { return mInstancing; }
+
+		/** 
+		 * Uploads per-instance data for instanced elements found during the last visibility determination. Must be 
+		 * called on the core thread, after endVisibility(). 
+		 */
+		void updateInstancing();
 
 		/**
 		 * Returns a value that can be used for transforming x, y coordinates from NDC into UV coordinates that can be used
@@ -350,6 +543,26 @@ namespace bs { namespace ct
 		 */
 		Vector4 getNDCToUV() const;
 
+		/**
+		 * Adjusts the resolution the scene is rendered at, if dynamic resolution is enabled in the view's render settings.
+		 * Should be called once per frame, before rendering the view. 
+		 *
+		 * @param[in]	gpuFrameTime	GPU time of the most recently completed frame, in milliseconds.
+		 */
+		void updateResolutionScale(float gpuFrameTime);
+
+		/** 
+		 * Returns the scale of the resolution the scene is currently rendered at, relative to the native resolution of
+		 * the view. Values smaller than one mean the scene needs to be upscaled before output.
+		 */
+		float getResolutionScale() const { return mResolutionScale; }
+
+		/** 
+		 * Returns the sub-pixel offset, in pixels, the projection matrix is currently jittered by. Only non-zero when
+		 * temporal anti-aliasing is enabled in the view's render settings.
+		 */
+		Vector2 getTemporalJitter() const { return mTemporalJitter; }
+
 		/** Returns an index of this view within the parent view group. */
 		UINT32 getViewIdx() const { return mViewIdx; }
 
@@ -382,6 +595,24 @@ namespace bs { namespace ct
 		 */
 		static Vector2 getNDCZToDeviceZ();
 	private:
+		/** Creates or destroys the occlusion culling state, depending on the current view properties. */
+		void updateOcclusionCulling();
+
+		/** Updates the view rectangle the scene is rendered at, according to the current resolution scale. */
+		void applyResolutionScale();
+
+		/** Returns the approximate size, in pixels, of an object with the provided bounds when rendered by this view. */
+		UINT32 getScreenSize(const Sphere& bounds, float distanceToCamera) const;
+
+		/** Records the size streamed textures used by the material are rendered at, see TextureStreamingManager. */
+		void addTextureStreamingRequests(const Material& material, UINT32 screenSize);
+
+		/** 
+		 * Determines the mesh level of detail to render the renderable with the provided index at, based on its size on
+		 * screen in pixels and the level it was rendered at previously.
+		 */
+		UINT32 selectLOD(const RendererObject& renderable, UINT32 renderableIdx, UINT32 screenSize);
+
 		RendererViewProperties mProperties;
 		RENDERER_VIEW_TARGET_DESC mTargetDesc;
 		Camera* mCamera;
@@ -396,8 +627,19 @@ namespace bs { namespace ct
 
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
 		VisibilityInfo mVisibility;
+		VisibilityMask mDynamicRenderableVisibility;
+		SPtr<OcclusionCulling> mOcclusionCulling;
+		SPtr<LatentEyeAdaptation> mLatentEyeAdaptation;
+		RendererInstancing mInstancing;
 		LightGrid mLightGrid;
 		UINT32 mViewIdx;
+
+		float mResolutionScale = 1.0f;
+		UINT32 mFramesSinceScaleChange = 0;
+		Vector2 mTemporalJitter = Vector2(BsZero);
+
+		UnorderedMap<const Texture*, UINT32> mTextureStreamingRequests;
+		Vector<UINT8> mRenderableLODs;
 	};
 
 	/** Contains one or multiple RendererView%s that are in some way related. */
@@ -451,6 +693,20 @@ namespace bs { namespace ct
 		 */
 		void determineVisibility(const SceneInfo& sceneInfo);
 
+		/** 
+		 * Determines should compute work that doesn't depend on rasterization output be executed on the asynchronous
+		 * compute queue. See RenderBeastOptions::asyncCompute.
+		 */
+		void setAsyncCompute(bool enabled) { mAsyncCompute = enabled; }
+
+		/**
+		 * Returns a sync mask to use when submitting graphics work that doesn't depend on the results of the 
+		 * asynchronous compute work queued by the last call to determineVisibility(). This allows the submitted work to
+		 * execute in parallel with the compute work. Returns a mask that syncs with all queues if no asynchronous compute
+		 * work was queued.
+		 */
+		UINT32 getAsyncComputeSyncMask() const;
+
 	private:
 		Vector<RendererView*> mViews;
 		VisibilityInfo mVisibility;
@@ -463,6 +719,10 @@ namespace bs { namespace ct
 		// multiple times. Since non-primary view groups are used for pre-processing tasks exclusively (at the moment) 
 		// this isn't an issue right now.
 		ShadowRendering mShadowRenderer;
+
+		bool mAsyncCompute = false;
+		bool mAsyncComputeQueued = false;
+		SPtr<CommandBuffer> mAsyncComputeCB;
 	};
 
 	/** @} */
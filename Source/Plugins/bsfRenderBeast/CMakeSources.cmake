@@ -6,6 +6,8 @@ set(BS_RENDERBEAST_INC_NOFILTER
 	"BsRendererLight.h"
 	"BsRendererView.h"
 	"BsRendererObject.h"
+	"BsRendererInstancing.h"
+	"BsGpuSceneBuffer.h"
 	"BsRendererReflectionProbe.h"
 	"BsRendererScene.h"
 	"BsRenderCompositor.h"
@@ -19,6 +21,8 @@ set(BS_RENDERBEAST_SRC_NOFILTER
 	"BsRendererLight.cpp"
 	"BsRendererView.cpp"
 	"BsRendererObject.cpp"
+	"BsRendererInstancing.cpp"
+	"BsGpuSceneBuffer.cpp"
 	"BsRendererReflectionProbe.cpp"
 	"BsRendererScene.cpp"
 	"BsRenderCompositor.cpp"
@@ -32,6 +36,9 @@ set(BS_RENDERBEAST_INC_SHADING
 	"Shading/BsLightProbes.h"
 	"Shading/BsShadowRendering.h"
 	"Shading/BsPostProcessing.h"
+	"Shading/BsOcclusionCulling.h"
+	"Shading/BsGpuSkinning.h"
+	"Shading/BsGpuMorphShapes.h"
 )
 
 set(BS_RENDERBEAST_SRC_SHADING
@@ -41,6 +48,9 @@ set(BS_RENDERBEAST_SRC_SHADING
 	"Shading/BsLightProbes.cpp"
 	"Shading/BsShadowRendering.cpp"
 	"Shading/BsPostProcessing.cpp"
+	"Shading/BsOcclusionCulling.cpp"
+	"Shading/BsGpuSkinning.cpp"
+	"Shading/BsGpuMorphShapes.cpp"
 )
 
 set(BS_RENDERBEAST_INC_UTILITY
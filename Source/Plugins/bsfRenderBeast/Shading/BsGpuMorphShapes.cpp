@@ -0,0 +1,137 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsGpuMorphShapes.h"
+#include "Animation/BsMorphShapes.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "Material/BsGpuParamsSet.h"
+
+namespace bs { namespace ct
+{
+	static const UINT32 THREADGROUP_SIZE = 64;
+
+	BlendMorphShapesParamDef gBlendMorphShapesParamDef;
+
+	GpuMorphShapes::GpuMorphShapes(const SPtr<MorphShapes>& morphShapes)
+		:mMorphShapes(morphShapes), mNumVertices(morphShapes->getNumVertices()), mNumShapes(morphShapes->getNumShapes())
+	{
+		// Count the deltas affecting each vertex, and turn the counts into offsets
+		Vector<UINT32> offsets(mNumVertices + 1, 0);
+		for (auto& channel : morphShapes->getChannels())
+		{
+			for (auto& shape : channel->getShapes())
+			{
+				for (auto& vertex : shape->getVertices())
+					offsets[vertex.sourceIdx + 1]++;
+			}
+		}
+
+		for (UINT32 i = 0; i < mNumVertices; i++)
+			offsets[i + 1] += offsets[i];
+
+		UINT32 numDeltas = offsets[mNumVertices];
+		Vector<UINT32> writeIdx(offsets.begin(), offsets.end() - 1);
+		Vector<Vector4> deltas(std::max(numDeltas, 1U) * 2);
+
+		UINT32 shapeIdx = 0;
+		for (auto& channel : morphShapes->getChannels())
+		{
+			for (auto& shape : channel->getShapes())
+			{
+				float shapeIdxBits;
+				memcpy(&shapeIdxBits, &shapeIdx, sizeof(shapeIdxBits));
+
+				for (auto& vertex : shape->getVertices())
+				{
+					UINT32 deltaIdx = writeIdx[vertex.sourceIdx]++;
+
+					const Vector3& pos = vertex.deltaPosition;
+					const Vector3& normal = vertex.deltaNormal;
+
+					deltas[deltaIdx * 2 + 0] = Vector4(pos.x, pos.y, pos.z, shapeIdxBits);
+					deltas[deltaIdx * 2 + 1] = Vector4(normal.x, normal.y, normal.z, 0.0f);
+				}
+
+				shapeIdx++;
+			}
+		}
+
+		GPU_BUFFER_DESC offsetsDesc;
+		offsetsDesc.type = GBT_STANDARD;
+		offsetsDesc.format = BF_32X1U;
+		offsetsDesc.elementCount = mNumVertices + 1;
+		offsetsDesc.usage = GBU_STATIC;
+
+		mVertexOffsets = GpuBuffer::create(offsetsDesc);
+		mVertexOffsets->writeData(0, (UINT32)(offsets.size() * sizeof(UINT32)), offsets.data(), BWT_DISCARD);
+
+		GPU_BUFFER_DESC deltasDesc;
+		deltasDesc.type = GBT_STANDARD;
+		deltasDesc.format = BF_32X4F;
+		deltasDesc.elementCount = (UINT32)deltas.size();
+		deltasDesc.usage = GBU_STATIC;
+
+		mDeltas = GpuBuffer::create(deltasDesc);
+		mDeltas->writeData(0, (UINT32)(deltas.size() * sizeof(Vector4)), deltas.data(), BWT_DISCARD);
+	}
+
+	SPtr<GpuMorphShapes> GpuMorphShapes::get(const SPtr<MorphShapes>& morphShapes)
+	{
+		static UnorderedMap<MorphShapes*, std::weak_ptr<GpuMorphShapes>> cache;
+
+		auto iterFind = cache.find(morphShapes.get());
+		if (iterFind != cache.end())
+		{
+			SPtr<GpuMorphShapes> existing = iterFind->second.lock();
+			if (existing != nullptr)
+				return existing;
+		}
+
+		// Drop entries whose data is no longer referenced, so the cache doesn't grow unbounded
+		for (auto iter = cache.begin(); iter != cache.end();)
+		{
+			if (iter->second.expired())
+				iter = cache.erase(iter);
+			else
+				++iter;
+		}
+
+		SPtr<GpuMorphShapes> output = bs_shared_ptr_new<GpuMorphShapes>(morphShapes);
+		cache[morphShapes.get()] = output;
+
+		return output;
+	}
+
+	BlendMorphShapesMat::BlendMorphShapesMat()
+	{
+		mParamBuffer = gBlendMorphShapesParamDef.createBuffer();
+		mParams->setParamBlockBuffer("Params", mParamBuffer);
+
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gVertexOffsets", mVertexOffsetsParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDeltas", mDeltasParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gWeights", mWeightsParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gOutput", mOutputParam);
+	}
+
+	void BlendMorphShapesMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("THREADGROUP_SIZE", THREADGROUP_SIZE);
+	}
+
+	void BlendMorphShapesMat::execute(const GpuMorphShapes& morphShapes, const SPtr<GpuBuffer>& weights,
+		const SPtr<GpuBuffer>& output)
+	{
+		UINT32 numVertices = morphShapes.getNumVertices();
+		gBlendMorphShapesParamDef.gNumVertices.set(mParamBuffer, (INT32)numVertices);
+
+		mVertexOffsetsParam.set(morphShapes.getVertexOffsets());
+		mDeltasParam.set(morphShapes.getDeltas());
+		mWeightsParam.set(weights);
+		mOutputParam.set(output);
+
+		UINT32 numGroups = Math::divideAndRoundUp(numVertices, THREADGROUP_SIZE);
+
+		bind();
+		RenderAPI::instance().dispatchCompute(numGroups);
+	}
+}}
@@ -0,0 +1,88 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Renderer/BsRendererMaterial.h"
+#include "Renderer/BsParamBlocks.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Morph shape vertex deltas stored in GPU buffers, in a layout suitable for blending by BlendMorphShapesMat. Deltas
+	 * are grouped per vertex: for each vertex an offset buffer stores the index of the first delta affecting it, followed
+	 * by all the deltas affecting that vertex in shape order. Each delta consists of two float4 elements, the first one
+	 * containing the position delta and the shape index (as integer bits), and the second one the normal delta.
+	 */
+	class GpuMorphShapes
+	{
+	public:
+		GpuMorphShapes(const SPtr<MorphShapes>& morphShapes);
+
+		/** Returns a buffer containing numVertices + 1 entries, each containing an index of the first vertex delta. */
+		const SPtr<GpuBuffer>& getVertexOffsets() const { return mVertexOffsets; }
+
+		/** Returns a buffer containing the vertex deltas of all morph shapes. */
+		const SPtr<GpuBuffer>& getDeltas() const { return mDeltas; }
+
+		/** Returns the number of vertices affected by the morph shapes. */
+		UINT32 getNumVertices() const { return mNumVertices; }
+
+		/** Returns the total number of morph shapes. */
+		UINT32 getNumShapes() const { return mNumShapes; }
+
+		/**
+		 * Returns GPU data for the provided set of morph shapes. Data is shared between all callers using the same morph
+		 * shapes, for as long as any of them holds a reference to it. Must be called on the core thread.
+		 */
+		static SPtr<GpuMorphShapes> get(const SPtr<MorphShapes>& morphShapes);
+
+	private:
+		SPtr<MorphShapes> mMorphShapes;
+		SPtr<GpuBuffer> mVertexOffsets;
+		SPtr<GpuBuffer> mDeltas;
+		UINT32 mNumVertices = 0;
+		UINT32 mNumShapes = 0;
+	};
+
+	BS_PARAM_BLOCK_BEGIN(BlendMorphShapesParamDef)
+		BS_PARAM_BLOCK_ENTRY(INT32, gNumVertices)
+	BS_PARAM_BLOCK_END
+
+	extern BlendMorphShapesParamDef gBlendMorphShapesParamDef;
+
+	/**
+	 * Shader that blends morph shapes according to a set of per-shape weights, and outputs the result in the layout of
+	 * the morph shape vertex stream used for rendering (see MorphShapes::blend()).
+	 */
+	class BlendMorphShapesMat : public RendererMaterial<BlendMorphShapesMat>
+	{
+		RMAT_DEF_CUSTOMIZED("BlendMorphShapes.bsl");
+
+	public:
+		BlendMorphShapesMat();
+
+		/**
+		 * Executes the material, blending the provided morph shapes.
+		 *
+		 * @param[in]	morphShapes		Morph shapes to blend.
+		 * @param[in]	weights			Buffer containing a single float weight for each of the morph shapes.
+		 * @param[in]	output			Buffer to receive the blended vertices, as returned by VertexBuffer::getLoadStore().
+		 *								Must have room for a 16 byte vertex for each vertex of the morph shapes.
+		 */
+		void execute(const GpuMorphShapes& morphShapes, const SPtr<GpuBuffer>& weights, const SPtr<GpuBuffer>& output);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamBuffer mVertexOffsetsParam;
+		GpuParamBuffer mDeltasParam;
+		GpuParamBuffer mWeightsParam;
+		GpuParamBuffer mOutputParam;
+	};
+
+	/** @} */
+}}
@@ -0,0 +1,109 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsGpuSkinning.h"
+#include "RenderAPI/BsVertexDeclaration.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "Material/BsGpuParamsSet.h"
+
+namespace bs { namespace ct
+{
+	static const UINT32 THREADGROUP_SIZE = 64;
+
+	SkinVerticesParamDef gSkinVerticesParamDef;
+
+	/** Returns the offset of the element with the provided semantic in 32-bit words, or -1 if the element is missing. */
+	static INT32 getWordOffset(const VertexDeclarationProperties& vertexProps, VertexElementSemantic semantic)
+	{
+		const VertexElement* element = vertexProps.findElementBySemantic(semantic);
+		if (element == nullptr)
+			return -1;
+
+		return (INT32)(element->getOffset() / sizeof(UINT32));
+	}
+
+	SkinVerticesMat::SkinVerticesMat()
+	{
+		mParamBuffer = gSkinVerticesParamDef.createBuffer();
+		mParams->setParamBlockBuffer("Params", mParamBuffer);
+
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gSrcVertices", mSourceParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gBoneMatrices", mBoneMatricesParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDstVertices", mOutputParam);
+	}
+
+	void SkinVerticesMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("THREADGROUP_SIZE", THREADGROUP_SIZE);
+	}
+
+	bool SkinVerticesMat::isSupported(const VertexDeclarationProperties& vertexProps)
+	{
+		if ((vertexProps.getVertexSize(0) % sizeof(UINT32)) != 0)
+			return false;
+
+		bool hasPosition = false;
+		bool hasBlendIndices = false;
+		bool hasBlendWeights = false;
+		for (auto& element : vertexProps.getElements())
+		{
+			if (element.getStreamIdx() != 0 || (element.getOffset() % sizeof(UINT32)) != 0)
+				return false;
+
+			if (element.getSemanticIdx() != 0)
+				continue;
+
+			switch (element.getSemantic())
+			{
+			case VES_POSITION:
+				if (element.getType() != VET_FLOAT3)
+					return false;
+
+				hasPosition = true;
+				break;
+			case VES_BLEND_INDICES:
+				if (element.getType() != VET_UBYTE4)
+					return false;
+
+				hasBlendIndices = true;
+				break;
+			case VES_BLEND_WEIGHTS:
+				if (element.getType() != VET_FLOAT4)
+					return false;
+
+				hasBlendWeights = true;
+				break;
+			case VES_NORMAL:
+			case VES_TANGENT:
+				if (element.getType() != VET_UBYTE4_NORM)
+					return false;
+				break;
+			default:
+				break;
+			}
+		}
+
+		return hasPosition && hasBlendIndices && hasBlendWeights;
+	}
+
+	void SkinVerticesMat::execute(const VertexDeclarationProperties& vertexProps, UINT32 numVertices,
+		const SPtr<GpuBuffer>& source, const SPtr<GpuBuffer>& boneMatrices, const SPtr<GpuBuffer>& output)
+	{
+		gSkinVerticesParamDef.gNumVertices.set(mParamBuffer, (INT32)numVertices);
+		gSkinVerticesParamDef.gVertexStride.set(mParamBuffer, (INT32)(vertexProps.getVertexSize(0) / sizeof(UINT32)));
+		gSkinVerticesParamDef.gPositionOffset.set(mParamBuffer, getWordOffset(vertexProps, VES_POSITION));
+		gSkinVerticesParamDef.gBlendIndicesOffset.set(mParamBuffer, getWordOffset(vertexProps, VES_BLEND_INDICES));
+		gSkinVerticesParamDef.gBlendWeightsOffset.set(mParamBuffer, getWordOffset(vertexProps, VES_BLEND_WEIGHTS));
+		gSkinVerticesParamDef.gNormalOffset.set(mParamBuffer, getWordOffset(vertexProps, VES_NORMAL));
+		gSkinVerticesParamDef.gTangentOffset.set(mParamBuffer, getWordOffset(vertexProps, VES_TANGENT));
+
+		mSourceParam.set(source);
+		mBoneMatricesParam.set(boneMatrices);
+		mOutputParam.set(output);
+
+		UINT32 numGroups = Math::divideAndRoundUp(numVertices, THREADGROUP_SIZE);
+
+		bind();
+		RenderAPI::instance().dispatchCompute(numGroups);
+	}
+}}
@@ -0,0 +1,70 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Renderer/BsRendererMaterial.h"
+#include "Renderer/BsParamBlocks.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	BS_PARAM_BLOCK_BEGIN(SkinVerticesParamDef)
+		BS_PARAM_BLOCK_ENTRY(INT32, gNumVertices)
+		BS_PARAM_BLOCK_ENTRY(INT32, gVertexStride)
+		BS_PARAM_BLOCK_ENTRY(INT32, gPositionOffset)
+		BS_PARAM_BLOCK_ENTRY(INT32, gBlendIndicesOffset)
+		BS_PARAM_BLOCK_ENTRY(INT32, gBlendWeightsOffset)
+		BS_PARAM_BLOCK_ENTRY(INT32, gNormalOffset)
+		BS_PARAM_BLOCK_ENTRY(INT32, gTangentOffset)
+	BS_PARAM_BLOCK_END
+
+	extern SkinVerticesParamDef gSkinVerticesParamDef;
+
+	/**
+	 * Shader that applies skeletal animation to a set of vertices, and outputs the skinned vertices in the same layout
+	 * as the source vertices. Positions, normals and tangents are transformed, while all other attributes are copied
+	 * unchanged.
+	 */
+	class SkinVerticesMat : public RendererMaterial<SkinVerticesMat>
+	{
+		RMAT_DEF_CUSTOMIZED("SkinVertices.bsl");
+
+	public:
+		SkinVerticesMat();
+
+		/**
+		 * Checks can vertices in the layout described by the provided vertex declaration be skinned by this material.
+		 * All vertex elements must be in stream 0, positions must be three component floats, blend indices must be
+		 * four unsigned bytes and blend weights four component floats. Normals and tangents, if present, must be 
+		 * stored as normalized unsigned bytes.
+		 */
+		static bool isSupported(const VertexDeclarationProperties& vertexProps);
+
+		/**
+		 * Executes the material, skinning the provided vertices.
+		 *
+		 * @param[in]	vertexProps		Layout of the source and output vertices. Must be supported, as reported by
+		 *								isSupported().
+		 * @param[in]	numVertices		Number of vertices to skin.
+		 * @param[in]	source			Buffer containing the source vertices, as returned by 
+		 *								VertexBuffer::getLoadStore().
+		 * @param[in]	boneMatrices	Buffer containing three rows of an affine transform per bone.
+		 * @param[in]	output			Buffer to receive the skinned vertices, as returned by
+		 *								VertexBuffer::getLoadStore().
+		 */
+		void execute(const VertexDeclarationProperties& vertexProps, UINT32 numVertices, const SPtr<GpuBuffer>& source,
+			const SPtr<GpuBuffer>& boneMatrices, const SPtr<GpuBuffer>& output);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamBuffer mSourceParam;
+		GpuParamBuffer mBoneMatricesParam;
+		GpuParamBuffer mOutputParam;
+	};
+
+	/** @} */
+}}
@@ -2,11 +2,14 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsLightGrid.h"
 #include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsCommandBuffer.h"
 #include "Material/BsGpuParamsSet.h"
 #include "Renderer/BsRendererUtility.h"
 #include "BsRendererView.h"
 #include "BsRendererLight.h"
 #include "BsRendererReflectionProbe.h"
+#include "Math/BsSIMD.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs { namespace ct
 {
@@ -15,6 +18,16 @@ namespace bs { namespace ct
 	static const UINT32 MAX_LIGHTS_PER_CELL = 32;
 	static const UINT32 THREADGROUP_SIZE = 4;
 
+	/** Maximum number of radial lights, spot lights and reflection probes for which the grid is built on the CPU. */
+	static const UINT32 CPU_ASSIGNMENT_MAX_ELEMENTS = 64;
+
+	/** Calculates the view space depth at the start of the specified depth slice. Must match LightGridCommon.bslinc. */
+	static float calcViewZFromCellZ(UINT32 cellZ, UINT32 numSlices, const Vector2& nearFar)
+	{
+		float slice = cellZ / (float)numSlices;
+		return -(slice * slice * (nearFar.y - nearFar.x) + nearFar.x);
+	}
+
 	LightGridParamDef gLightGridParamDefDef;
 
 	LightGridLLCreationMat::LightGridLLCreationMat()
@@ -50,7 +63,7 @@ namespace bs { namespace ct
 	}
 
 	void LightGridLLCreationMat::setParams(const Vector3I& gridSize, const SPtr<GpuParamBlockBuffer>& gridParams,
-		const SPtr<GpuBuffer>& lightsBuffer, const SPtr<GpuBuffer>& probesBuffer)
+		const SPtr<GpuBuffer>& lightsBuffer, const SPtr<GpuBuffer>& probesBuffer, UINT32 queueIdx)
 	{
 		mGridSize = gridSize;
 		UINT32 numCells = gridSize[0] * gridSize[1] * gridSize[2];
@@ -84,20 +97,20 @@ namespace bs { namespace ct
 		}
 
 		UINT32 zero = 0;
-		mLightsCounter->writeData(0, sizeof(UINT32), &zero, BWT_DISCARD);
-		mProbesCounter->writeData(0, sizeof(UINT32), &zero, BWT_DISCARD);
+		mLightsCounter->writeData(0, sizeof(UINT32), &zero, BWT_DISCARD, queueIdx);
+		mProbesCounter->writeData(0, sizeof(UINT32), &zero, BWT_DISCARD, queueIdx);
 
 		// Note: Add a method to clear buffer data directly? e.g. GpuBuffer->clear(value);
 		UINT32* headsClearData = (UINT32*)bs_stack_alloc(mLightsLLHeads->getSize());
 		memset(headsClearData, 0xFFFFFFFF, mLightsLLHeads->getSize());
 
-		mLightsLLHeads->writeData(0, mLightsLLHeads->getSize(), headsClearData, BWT_DISCARD);
+		mLightsLLHeads->writeData(0, mLightsLLHeads->getSize(), headsClearData, BWT_DISCARD, queueIdx);
 		bs_stack_free(headsClearData);
 
 		headsClearData = (UINT32*)bs_stack_alloc(mProbesLLHeads->getSize());
 		memset(headsClearData, 0xFFFFFFFF, mProbesLLHeads->getSize());
 
-		mProbesLLHeads->writeData(0, mProbesLLHeads->getSize(), headsClearData, BWT_DISCARD);
+		mProbesLLHeads->writeData(0, mProbesLLHeads->getSize(), headsClearData, BWT_DISCARD, queueIdx);
 		bs_stack_free(headsClearData);
 
 		mParams->setParamBlockBuffer("GridParams", gridParams);
@@ -105,7 +118,7 @@ namespace bs { namespace ct
 		mProbesBufferParam.set(probesBuffer);
 	}
 
-	void LightGridLLCreationMat::execute(const RendererView& view)
+	void LightGridLLCreationMat::execute(const RendererView& view, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		mParams->setParamBlockBuffer("PerCamera", view.getPerViewBuffer());
 
@@ -113,8 +126,8 @@ namespace bs { namespace ct
 		UINT32 numGroupsY = (mGridSize[1] + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE;
 		UINT32 numGroupsZ = (mGridSize[2] + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE;
 
-		bind();
-		RenderAPI::instance().dispatchCompute(numGroupsX, numGroupsY, numGroupsZ);
+		bind(commandBuffer);
+		RenderAPI::instance().dispatchCompute(numGroupsX, numGroupsY, numGroupsZ, commandBuffer);
 	}
 
 	void LightGridLLCreationMat::getOutputs(SPtr<GpuBuffer>& lightsLLHeads, SPtr<GpuBuffer>& lightsLL, 
@@ -161,7 +174,7 @@ namespace bs { namespace ct
 
 	void LightGridLLReductionMat::setParams(const Vector3I& gridSize, const SPtr<GpuParamBlockBuffer>& gridParams,
 		const SPtr<GpuBuffer>& lightsLLHeads, const SPtr<GpuBuffer>& lightsLL,
-		const SPtr<GpuBuffer>& probeLLHeads, const SPtr<GpuBuffer>& probeLL)
+		const SPtr<GpuBuffer>& probeLLHeads, const SPtr<GpuBuffer>& probeLL, UINT32 queueIdx)
 	{
 		mGridSize = gridSize;
 		UINT32 numCells = gridSize[0] * gridSize[1] * gridSize[2];
@@ -196,7 +209,7 @@ namespace bs { namespace ct
 
 		// Note: Add a method to clear buffer data directly? e.g. GpuBuffer->clear(value);
 		UINT32 zeros[] = { 0, 0 };
-		mGridDataCounter->writeData(0, sizeof(UINT32) * 2, zeros, BWT_DISCARD);
+		mGridDataCounter->writeData(0, sizeof(UINT32) * 2, zeros, BWT_DISCARD, queueIdx);
 
 		mParams->setParamBlockBuffer("GridParams", gridParams);
 
@@ -207,7 +220,7 @@ namespace bs { namespace ct
 		mProbesLLParam.set(probeLL);
 	}
 
-	void LightGridLLReductionMat::execute(const RendererView& view)
+	void LightGridLLReductionMat::execute(const RendererView& view, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		mParams->setParamBlockBuffer("PerCamera", view.getPerViewBuffer());
 
@@ -215,8 +228,8 @@ namespace bs { namespace ct
 		UINT32 numGroupsY = (mGridSize[1] + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE;
 		UINT32 numGroupsZ = (mGridSize[2] + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE;
 
-		bind();
-		RenderAPI::instance().dispatchCompute(numGroupsX, numGroupsY, numGroupsZ);
+		bind(commandBuffer);
+		RenderAPI::instance().dispatchCompute(numGroupsX, numGroupsY, numGroupsZ, commandBuffer);
 	}
 
 	void LightGridLLReductionMat::getOutputs(SPtr<GpuBuffer>& gridLightOffsetsAndSize, SPtr<GpuBuffer>& gridLightIndices,
@@ -234,7 +247,7 @@ namespace bs { namespace ct
 	}
 
 	void LightGrid::updateGrid(const RendererView& view, const VisibleLightData& lightData, const VisibleReflProbeData& probeData,
-		bool noLighting)
+		bool noLighting, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		const RendererViewProperties& viewProps = view.getProperties();
 
@@ -279,9 +292,22 @@ namespace bs { namespace ct
 		gLightGridParamDefDef.gMaxNumLightsPerCell.set(mGridParamBuffer, MAX_LIGHTS_PER_CELL);
 		gLightGridParamDefDef.gGridPixelSize.set(mGridParamBuffer, Vector2I(CELL_XY_SIZE, CELL_XY_SIZE));
 
+		UINT32 queueIdx = 0;
+		if(commandBuffer)
+			queueIdx = CommandSyncMask::getGlobalQueueIdx(commandBuffer->getType(), commandBuffer->getQueueIdx());
+
+		UINT32 numLocalLights = lightCount[1] + lightCount[2];
+		mCPUAssigned = useCPUAssignment(numLocalLights, probeData.getNumProbes(), commandBuffer != nullptr);
+		if(mCPUAssigned)
+		{
+			assignOnCPU(view, gridSize, lightStrides, lightData, probeData, noLighting, queueIdx);
+			return;
+		}
+
 		LightGridLLCreationMat* creationMat = LightGridLLCreationMat::get();
-		creationMat->setParams(gridSize, mGridParamBuffer, lightData.getLightBuffer(), probeData.getProbeBuffer());
-		creationMat->execute(view);
+		creationMat->setParams(gridSize, mGridParamBuffer, lightData.getLightBuffer(), probeData.getProbeBuffer(),
+			queueIdx);
+		creationMat->execute(view, commandBuffer);
 
 		SPtr<GpuBuffer> lightLLHeads;
 		SPtr<GpuBuffer> lightLL;
@@ -290,16 +316,289 @@ namespace bs { namespace ct
 		creationMat->getOutputs(lightLLHeads, lightLL, probeLLHeads, probeLL);
 
 		LightGridLLReductionMat* reductionMat = LightGridLLReductionMat::get();
-		reductionMat->setParams(gridSize, mGridParamBuffer, lightLLHeads, lightLL, probeLLHeads, probeLL);
-		reductionMat->execute(view);
+		reductionMat->setParams(gridSize, mGridParamBuffer, lightLLHeads, lightLL, probeLLHeads, probeLL, queueIdx);
+		reductionMat->execute(view, commandBuffer);
 	}
 
 	void LightGrid::getOutputs(SPtr<GpuBuffer>& gridLightOffsetsAndSize, SPtr<GpuBuffer>& gridLightIndices,
 		SPtr<GpuBuffer>& gridProbeOffsetsAndSize, SPtr<GpuBuffer>& gridProbeIndices, 
 		SPtr<GpuParamBlockBuffer>& gridParams) const
 	{
-		LightGridLLReductionMat* reductionMat = LightGridLLReductionMat::get();
-		reductionMat->getOutputs(gridLightOffsetsAndSize, gridLightIndices, gridProbeOffsetsAndSize, gridProbeIndices);
+		if(mCPUAssigned)
+		{
+			gridLightOffsetsAndSize = mGridLightOffsetsAndSize;
+			gridLightIndices = mGridLightIndices;
+			gridProbeOffsetsAndSize = mGridProbeOffsetsAndSize;
+			gridProbeIndices = mGridProbeIndices;
+		}
+		else
+		{
+			LightGridLLReductionMat* reductionMat = LightGridLLReductionMat::get();
+			reductionMat->getOutputs(gridLightOffsetsAndSize, gridLightIndices, gridProbeOffsetsAndSize, 
+				gridProbeIndices);
+		}
+
 		gridParams = mGridParamBuffer;
 	}
+
+	bool LightGrid::useCPUAssignment(UINT32 numLocalLights, UINT32 numProbes, bool asyncCompute)
+	{
+		// Building the grid on the CPU avoids two compute dispatches, and clears of the linked list buffers, which for a
+		// small number of lights costs more GPU time than the CPU spends on the assignment. When the GPU path runs on
+		// an asynchronous compute queue it overlaps with shadow map rendering, so only skip it if there is nothing to
+		// assign.
+		UINT32 numElements = numLocalLights + numProbes;
+		if(asyncCompute)
+			return numElements == 0;
+
+		return numElements <= CPU_ASSIGNMENT_MAX_ELEMENTS;
+	}
+
+	void LightGrid::assignOnCPU(const RendererView& view, const Vector3I& gridSize, const Vector2I& lightStrides,
+		const VisibleLightData& lightData, const VisibleReflProbeData& probeData, bool noLighting, UINT32 queueIdx)
+	{
+		const RendererViewProperties& viewProps = view.getProperties();
+		const Matrix4& viewTransform = viewProps.viewTransform;
+
+		// Transform the bounds of all lights and probes into view space
+		mRadialLights.clear();
+		mSpotLights.clear();
+		mProbes.clear();
+
+		if(!noLighting)
+		{
+			UINT32 numRadialLights = lightData.getNumRadialLights();
+			for(UINT32 i = 0; i < numRadialLights; i++)
+			{
+				const LightData& light = lightData.getLightData(lightStrides[0] + i);
+				mRadialLights.add(viewTransform.multiplyAffine(light.position), light.boundsRadius);
+			}
+
+			UINT32 numSpotLights = lightData.getNumSpotLights();
+			for(UINT32 i = 0; i < numSpotLights; i++)
+			{
+				const LightData& light = lightData.getLightData(lightStrides[1] + i);
+				mSpotLights.add(viewTransform.multiplyAffine(light.position), light.boundsRadius);
+			}
+		}
+
+		UINT32 numProbes = probeData.getNumProbes();
+		for(UINT32 i = 0; i < numProbes; i++)
+		{
+			const ReflProbeData& probe = probeData.getProbeData(i);
+			mProbes.add(viewTransform.multiplyAffine(probe.position), probe.radius);
+		}
+
+		mRadialLights.pad();
+		mSpotLights.pad();
+		mProbes.pad();
+
+		// Assign to cells, each depth slice in parallel
+		UINT32 numCells = gridSize[0] * gridSize[1] * gridSize[2];
+		mCellLightOffsetsAndSize.resize(numCells * 4);
+		mCellProbeOffsetsAndSize.resize(numCells * 2);
+		mSliceIndices.resize(gridSize[2]);
+
+		const Matrix4& proj = viewProps.projTransform;
+		Matrix4 invProj = proj.inverse();
+		Vector2 nearFar(viewProps.nearPlane, viewProps.farPlane);
+
+		TaskScheduler::instance().parallelFor(0, gridSize[2], 1, 
+			[this, &gridSize, &proj, &invProj, &nearFar, &lightStrides](UINT32 begin, UINT32 end)
+		{
+			for(UINT32 i = begin; i < end; i++)
+				assignSlice(i, gridSize, proj, invProj, nearFar, lightStrides);
+		});
+
+		// Merge the per-slice lists into a single list, and offset the cells to point into it
+		mLightIndices.clear();
+		mProbeIndices.clear();
+
+		UINT32 numCellsPerSlice = gridSize[0] * gridSize[1];
+		for(UINT32 i = 0; i < (UINT32)gridSize[2]; i++)
+		{
+			const SliceIndices& sliceIndices = mSliceIndices[i];
+
+			UINT32 lightOffset = (UINT32)mLightIndices.size();
+			UINT32 probeOffset = (UINT32)mProbeIndices.size();
+
+			UINT32 firstCell = i * numCellsPerSlice;
+			for(UINT32 j = firstCell; j < firstCell + numCellsPerSlice; j++)
+			{
+				mCellLightOffsetsAndSize[j * 4] += lightOffset;
+				mCellProbeOffsetsAndSize[j * 2] += probeOffset;
+			}
+
+			mLightIndices.insert(mLightIndices.end(), sliceIndices.lights.begin(), sliceIndices.lights.end());
+			mProbeIndices.insert(mProbeIndices.end(), sliceIndices.probes.begin(), sliceIndices.probes.end());
+		}
+
+		// Upload to the GPU
+		auto upload = [queueIdx](SPtr<GpuBuffer>& buffer, GpuBufferFormat format, UINT32 elementSize, 
+			const Vector<UINT32>& data)
+		{
+			// Allocate at least one element even if empty, to avoid issues with null buffers
+			UINT32 numElements = std::max(1U, (UINT32)(data.size() * sizeof(UINT32) / elementSize));
+
+			if(buffer == nullptr || buffer->getProperties().getElementCount() < numElements)
+			{
+				GPU_BUFFER_DESC desc;
+				desc.elementCount = numElements + numElements / 2;
+				desc.format = format;
+				desc.type = GBT_STANDARD;
+				desc.elementSize = 0;
+				desc.usage = GBU_DYNAMIC;
+
+				buffer = GpuBuffer::create(desc);
+			}
+
+			if(!data.empty())
+				buffer->writeData(0, (UINT32)data.size() * sizeof(UINT32), data.data(), BWT_DISCARD, queueIdx);
+		};
+
+		upload(mGridLightOffsetsAndSize, BF_32X4U, sizeof(UINT32) * 4, mCellLightOffsetsAndSize);
+		upload(mGridLightIndices, BF_32X1U, sizeof(UINT32), mLightIndices);
+		upload(mGridProbeOffsetsAndSize, BF_32X2U, sizeof(UINT32) * 2, mCellProbeOffsetsAndSize);
+		upload(mGridProbeIndices, BF_32X1U, sizeof(UINT32), mProbeIndices);
+	}
+
+	void LightGrid::assignSlice(UINT32 slice, const Vector3I& gridSize, const Matrix4& proj, const Matrix4& invProj,
+		const Vector2& nearFar, const Vector2I& lightStrides)
+	{
+		SliceIndices& output = mSliceIndices[slice];
+		output.lights.clear();
+		output.probes.clear();
+
+		// Mirrors calcCellAABB() in LightGridLLCreation.bsl. Cells are bounded by an axis aligned box in view space.
+
+		// Because we're viewing along negative Z, farther end is the minimum
+		float viewZMin = calcViewZFromCellZ(slice + 1, gridSize[2], nearFar);
+		float viewZMax = calcViewZFromCellZ(slice, gridSize[2], nearFar);
+
+		auto convertToNDCZ = [&proj](float viewZ)
+		{
+			Vector4 clip = proj.multiply(Vector4(0.0f, 0.0f, viewZ, 1.0f));
+			return clip.z / clip.w;
+		};
+
+		float ndcZ[2] = { convertToNDCZ(viewZMax), convertToNDCZ(viewZMin) };
+
+		// Flip Y depending on render API, depending if Y in NDC is facing up or down
+		float flipY = -Math::sign(proj[1][1]);
+		Vector2 cellNDCSize(2.0f / gridSize[0], 2.0f / gridSize[1]);
+
+		for(UINT32 y = 0; y < (UINT32)gridSize[1]; y++)
+		{
+			float ndcY[2] = { (y * cellNDCSize.y - 1.0f) * flipY, ((y + 1) * cellNDCSize.y - 1.0f) * flipY };
+
+			for(UINT32 x = 0; x < (UINT32)gridSize[0]; x++)
+			{
+				float ndcX[2] = { x * cellNDCSize.x - 1.0f, (x + 1) * cellNDCSize.x - 1.0f };
+
+				Vector2 viewMin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+				Vector2 viewMax(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+
+				for(UINT32 i = 0; i < 8; i++)
+				{
+					Vector4 corner = invProj.multiply(Vector4(ndcX[i & 1], ndcY[(i >> 1) & 1], ndcZ[i >> 2], 1.0f));
+					Vector2 cornerXY(corner.x / corner.w, corner.y / corner.w);
+
+					viewMin = Vector2::min(viewMin, cornerXY);
+					viewMax = Vector2::max(viewMax, cornerXY);
+				}
+
+				Vector3 extent = Vector3(viewMax.x - viewMin.x, viewMax.y - viewMin.y, viewZMax - viewZMin) * 0.5f;
+				Vector3 center = Vector3(viewMin.x, viewMin.y, viewZMin) + extent;
+
+				// Offsets are relative to the start of the slice until the slices are merged. Radial lights come first,
+				// followed by spot lights, as expected by the shaders.
+				UINT32 cellIdx = (slice * gridSize[1] + y) * gridSize[0] + x;
+				UINT32* lightEntry = &mCellLightOffsetsAndSize[cellIdx * 4];
+				lightEntry[0] = (UINT32)output.lights.size();
+				lightEntry[1] = mRadialLights.findIntersecting(center, extent, lightStrides[0], output.lights);
+				lightEntry[2] = mSpotLights.findIntersecting(center, extent, lightStrides[1], output.lights);
+				lightEntry[3] = 0;
+
+				UINT32* probeEntry = &mCellProbeOffsetsAndSize[cellIdx * 2];
+				probeEntry[0] = (UINT32)output.probes.size();
+				probeEntry[1] = mProbes.findIntersecting(center, extent, 0, output.probes);
+			}
+		}
+	}
+
+	void LightGrid::SphereArray::clear()
+	{
+		centerX.clear();
+		centerY.clear();
+		centerZ.clear();
+		radiusSqrd.clear();
+		count = 0;
+	}
+
+	void LightGrid::SphereArray::add(const Vector3& center, float radius)
+	{
+		centerX.push_back(center.x);
+		centerY.push_back(center.y);
+		centerZ.push_back(center.z);
+		radiusSqrd.push_back(radius * radius);
+		count++;
+	}
+
+	void LightGrid::SphereArray::pad()
+	{
+		// Negative squared radius ensures the padding spheres fail the intersection test
+		UINT32 paddedCount = (count + 3) & ~3U;
+		centerX.resize(paddedCount, 0.0f);
+		centerY.resize(paddedCount, 0.0f);
+		centerZ.resize(paddedCount, 0.0f);
+		radiusSqrd.resize(paddedCount, -1.0f);
+	}
+
+	UINT32 LightGrid::SphereArray::findIntersecting(const Vector3& boxCenter, const Vector3& boxExtent, 
+		UINT32 indexOffset, Vector<UINT32>& output) const
+	{
+		const simd::uint32x4 laneBits = simd::make_uint(1, 2, 4, 8);
+		const simd::float32x4 zero = simd::make_zero();
+
+		simd::float32x4 boxCenterX = simd::splat<simd::float32x4>(boxCenter.x);
+		simd::float32x4 boxCenterY = simd::splat<simd::float32x4>(boxCenter.y);
+		simd::float32x4 boxCenterZ = simd::splat<simd::float32x4>(boxCenter.z);
+
+		simd::float32x4 boxExtentX = simd::splat<simd::float32x4>(boxExtent.x);
+		simd::float32x4 boxExtentY = simd::splat<simd::float32x4>(boxExtent.y);
+		simd::float32x4 boxExtentZ = simd::splat<simd::float32x4>(boxExtent.z);
+
+		UINT32 numIntersecting = 0;
+		UINT32 paddedCount = (UINT32)radiusSqrd.size();
+		for(UINT32 i = 0; i < paddedCount; i += 4)
+		{
+			// Distance from the sphere center to the closest point on the box, per axis
+			simd::float32x4 distX = simd::max(simd::sub(simd::abs(simd::sub(
+				simd::load_u<simd::float32x4>(centerX.data() + i), boxCenterX)), boxExtentX), zero);
+			simd::float32x4 distY = simd::max(simd::sub(simd::abs(simd::sub(
+				simd::load_u<simd::float32x4>(centerY.data() + i), boxCenterY)), boxExtentY), zero);
+			simd::float32x4 distZ = simd::max(simd::sub(simd::abs(simd::sub(
+				simd::load_u<simd::float32x4>(centerZ.data() + i), boxCenterZ)), boxExtentZ), zero);
+
+			simd::float32x4 distSqrd = simd::add(simd::add(
+				simd::mul(distX, distX), 
+				simd::mul(distY, distY)), 
+				simd::mul(distZ, distZ));
+
+			simd::float32x4 radius = simd::load_u<simd::float32x4>(radiusSqrd.data() + i);
+			simd::uint32x4 inside = simd::bit_cast<simd::uint32x4>(simd::cmp_le(distSqrd, radius));
+
+			UINT32 bits = simd::reduce_or(simd::bit_and(laneBits, inside));
+			for(UINT32 j = 0; bits != 0; j++, bits >>= 1)
+			{
+				if(bits & 1)
+				{
+					output.push_back(indexOffset + i + j);
+					numIntersecting++;
+				}
+			}
+		}
+
+		return numIntersecting;
+	}
 }}
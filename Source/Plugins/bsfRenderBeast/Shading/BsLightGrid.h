@@ -38,12 +38,18 @@ namespace bs { namespace ct
 	public:
 		LightGridLLCreationMat();
 
-		/** Binds parameter buffers and prepares any internal buffers. Must be called before execute(). */
+		/** 
+		 * Binds parameter buffers and prepares any internal buffers. Must be called before execute(). @p queueIdx is the
+		 * global index of the queue the material will be executed on.
+		 */
 		void setParams(const Vector3I& gridSize, const SPtr<GpuParamBlockBuffer>& gridParams, 
-					   const SPtr<GpuBuffer>& lightsBuffer, const SPtr<GpuBuffer>& probesBuffer);
+					   const SPtr<GpuBuffer>& lightsBuffer, const SPtr<GpuBuffer>& probesBuffer, UINT32 queueIdx = 0);
 
-		/** Binds the material for rendering, sets up per-camera parameters and executes it. */
-		void execute(const RendererView& view);
+		/** 
+		 * Binds the material for rendering, sets up per-camera parameters and executes it. If @p commandBuffer is
+		 * provided the dispatch is queued on it, instead of the main command buffer.
+		 */
+		void execute(const RendererView& view, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/** Returns the buffers generated by execute(). */
 		void getOutputs(SPtr<GpuBuffer>& lightsLLHeads, SPtr<GpuBuffer>& lightsLL, SPtr<GpuBuffer>& probesLLHeads, 
@@ -79,13 +85,19 @@ namespace bs { namespace ct
 	public:
 		LightGridLLReductionMat();
 
-		/** Binds parameter buffers and prepares any internal buffers. Must be called before execute(). */
+		/** 
+		 * Binds parameter buffers and prepares any internal buffers. Must be called before execute(). @p queueIdx is the
+		 * global index of the queue the material will be executed on.
+		 */
 		void setParams(const Vector3I& gridSize, const SPtr<GpuParamBlockBuffer>& gridParams, 
 			const SPtr<GpuBuffer>& lightLLHeads, const SPtr<GpuBuffer>& lightLL,
-			const SPtr<GpuBuffer>& probeLLHeads, const SPtr<GpuBuffer>& probeLL);
+			const SPtr<GpuBuffer>& probeLLHeads, const SPtr<GpuBuffer>& probeLL, UINT32 queueIdx = 0);
 
-		/** Binds the material for renderingand executes it. */
-		void execute(const RendererView& view);
+		/** 
+		 * Binds the material for rendering and executes it. If @p commandBuffer is provided the dispatch is queued on it,
+		 * instead of the main command buffer.
+		 */
+		void execute(const RendererView& view, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/** Returns the buffers generated by execute(). */
 		void getOutputs(SPtr<GpuBuffer>& gridLightOffsetsAndSize, SPtr<GpuBuffer>& gridLightIndices,
@@ -126,9 +138,12 @@ namespace bs { namespace ct
 	public:
 		LightGrid();
 
-		/** Updates the light grid from the provided view. */
+		/** 
+		 * Updates the light grid from the provided view. If @p commandBuffer is provided the grid generation is queued on
+		 * it (e.g. a command buffer executing on a compute queue), instead of the main command buffer.
+		 */
 		void updateGrid(const RendererView& view, const VisibleLightData& lightData, const VisibleReflProbeData& probeData, 
-			bool noLighting);
+			bool noLighting, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/** 
 		 * Returns the buffers containing light indices per grid cell and global grid parameters. 
@@ -151,7 +166,76 @@ namespace bs { namespace ct
 			SPtr<GpuParamBlockBuffer>& gridParams) const;
 
 	private:
+		/** 
+		 * View space bounding spheres of lights or reflection probes, stored as a structure of arrays so that four 
+		 * spheres can be tested against a grid cell at once. 
+		 */
+		struct SphereArray
+		{
+			/** Removes all spheres from the array. */
+			void clear();
+
+			/** Appends a new sphere to the array. */
+			void add(const Vector3& center, float radius);
+
+			/** Pads the arrays to a multiple of four entries, with spheres that never intersect a cell. */
+			void pad();
+
+			/** 
+			 * Finds all spheres intersecting the provided box, and appends their indices, offset by @p indexOffset, to
+			 * @p output. Must be called after pad(). Returns the number of intersecting spheres.
+			 */
+			UINT32 findIntersecting(const Vector3& boxCenter, const Vector3& boxExtent, UINT32 indexOffset, 
+				Vector<UINT32>& output) const;
+
+			Vector<float> centerX;
+			Vector<float> centerY;
+			Vector<float> centerZ;
+			Vector<float> radiusSqrd;
+			UINT32 count = 0;
+		};
+
+		/** Light and reflection probe indices of all cells in a single depth slice of the grid. */
+		struct SliceIndices
+		{
+			Vector<UINT32> lights;
+			Vector<UINT32> probes;
+		};
+
+		/** 
+		 * Determines whether lights and reflection probes should be assigned to grid cells on the CPU, rather than 
+		 * through LightGridLLCreationMat and LightGridLLReductionMat.
+		 */
+		static bool useCPUAssignment(UINT32 numLocalLights, UINT32 numProbes, bool asyncCompute);
+
+		/** 
+		 * Assigns lights and reflection probes to grid cells on the CPU, and uploads the resulting lists to the GPU. 
+		 * Outputs are in the same format as generated by LightGridLLReductionMat.
+		 */
+		void assignOnCPU(const RendererView& view, const Vector3I& gridSize, const Vector2I& lightStrides,
+			const VisibleLightData& lightData, const VisibleReflProbeData& probeData, bool noLighting, UINT32 queueIdx);
+
+		/** Assigns spheres to all cells in a single depth slice of the grid, as part of assignOnCPU(). */
+		void assignSlice(UINT32 slice, const Vector3I& gridSize, const Matrix4& proj, const Matrix4& invProj, 
+			const Vector2& nearFar, const Vector2I& lightStrides);
+
 		SPtr<GpuParamBlockBuffer> mGridParamBuffer;
+		bool mCPUAssigned = false;
+
+		// CPU light assignment
+		SphereArray mRadialLights;
+		SphereArray mSpotLights;
+		SphereArray mProbes;
+		Vector<SliceIndices> mSliceIndices;
+		Vector<UINT32> mCellLightOffsetsAndSize;
+		Vector<UINT32> mCellProbeOffsetsAndSize;
+		Vector<UINT32> mLightIndices;
+		Vector<UINT32> mProbeIndices;
+
+		SPtr<GpuBuffer> mGridLightOffsetsAndSize;
+		SPtr<GpuBuffer> mGridLightIndices;
+		SPtr<GpuBuffer> mGridProbeOffsetsAndSize;
+		SPtr<GpuBuffer> mGridProbeIndices;
 	};
 
 	/** @} */
@@ -11,6 +11,7 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Renderer/BsSkybox.h"
 #include "Utility/BsRendererTextures.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs { namespace ct 
 {
@@ -66,7 +67,9 @@ namespace bs { namespace ct
 		UINT32 numSamples = viewProps.numSamples;
 
 		colorDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_R16U, width, height, TU_RENDERTARGET, numSamples);
-		depthDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_D32, width, height, TU_DEPTHSTENCIL, numSamples);
+		// Depth is only used for depth testing while rendering the tetrahedra, and is discarded afterwards
+		depthDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_D32, width, height, TU_DEPTHSTENCIL | TU_TRANSIENT,
+			numSamples);
 	}
 
 	TetrahedraRenderMat* TetrahedraRenderMat::getVariation(bool msaa, bool singleSampleMSAA)
@@ -210,10 +213,40 @@ namespace bs { namespace ct
 		float padding[3];
 	};
 
+	/** Probe data and results of a tetrahedralization performed on a worker thread. */
+	struct TetrahedralizationJob
+	{
+		// Inputs
+		/** World space positions of all probes. Extrapolation volume vertices are appended during tetrahedralization. */
+		Vector<Vector3> positions;
+		/** Index of the SH coefficients in the global coefficient buffer, for each entry in @p positions. */
+		Vector<UINT32> bufferIndices;
+		/** Location of the SH coefficients in the volume's coefficient texture, for each entry in @p positions. */
+		Vector<Vector2I> bufferOffsets;
+		/** Coefficient textures of all the volumes the probes belong to, in the order they are laid out in. */
+		Vector<SPtr<Texture>> coefficients;
+
+		// Outputs
+		SPtr<MeshData> meshData;
+		Vector<TetrahedronDataGPU> tetrahedraGPU;
+		Vector<TetrahedronFaceDataGPU> facesGPU;
+		UINT32 numValidTetrahedra = 0;
+		UINT32 numValidFaces = 0;
+
+		SPtr<Task> task;
+	};
+
 	LightProbes::LightProbes()
 		:mTetrahedronVolumeDirty(false), mMaxCoefficientRows(0), mMaxTetrahedra(0), mMaxFaces(0), mNumValidTetrahedra(0)
 	{ }
 
+	LightProbes::~LightProbes()
+	{
+		// Worker references the job data, so it must finish before the job can be destroyed
+		if (mPendingJob != nullptr)
+			mPendingJob->task->wait();
+	}
+
 	void LightProbes::notifyAdded(LightProbeVolume* volume)
 	{
 		UINT32 handle = (UINT32)mVolumes.size();
@@ -226,6 +259,7 @@ namespace bs { namespace ct
 		volume->setRendererId(handle);
 
 		notifyDirty(volume);
+		mTetrahedronVolumeDirty = true;
 	}
 
 	void LightProbes::notifyDirty(LightProbeVolume* volume)
@@ -233,7 +267,9 @@ namespace bs { namespace ct
 		UINT32 handle = volume->getRendererId();
 		mVolumes[handle].isDirty = true;
 
-		mTetrahedronVolumeDirty = true;
+		// Whether the tetrahedralization needs to be rebuilt is determined on the next update, as most of the time only
+		// the probe coefficients change
+		mCoefficientsDirty = true;
 	}
 
 	void LightProbes::notifyRemoved(LightProbeVolume* volume)
@@ -258,84 +294,126 @@ namespace bs { namespace ct
 
 	void LightProbes::updateProbes()
 	{
-		if (!mTetrahedronVolumeDirty)
-			return;
+		// Activate the results of a tetrahedralization once the worker is done with it
+		if (mPendingJob != nullptr && mPendingJob->task->isComplete())
+		{
+			applyTetrahedralization(*mPendingJob);
+			mPendingJob = nullptr;
+		}
 
-		// Move all coefficients into the global buffer
-		UINT32 numRows = 0;
+		// Only rebuild the tetrahedralization if the probe positions actually changed
 		for(auto& entry : mVolumes)
 		{
-			SPtr<Texture> localTexture = entry.volume->getCoefficientsTexture();
-			numRows += localTexture->getProperties().getHeight();
+			if (!entry.isDirty)
+				continue;
+
+			if (updateCachedPositions(entry))
+				mTetrahedronVolumeDirty = true;
+
+			entry.isDirty = false;
 		}
 
-		if(numRows > mMaxCoefficientRows)
-			resizeCoefficientTexture(numRows + 4);
+		// If a tetrahedralization is already in progress, start the next one once it completes
+		if (mTetrahedronVolumeDirty && mPendingJob == nullptr)
+		{
+			startTetrahedralization();
+			mTetrahedronVolumeDirty = false;
+		}
 
-		UINT32 rowIdx = 0;
-		for(auto& entry : mVolumes)
+		if (mCoefficientsDirty)
 		{
-			TEXTURE_COPY_DESC copyDesc;
-			copyDesc.dstPosition = Vector3I(0, rowIdx, 0);
+			copyCoefficients();
+			mCoefficientsDirty = false;
+		}
+	}
+
+	bool LightProbes::updateCachedPositions(VolumeInfo& info)
+	{
+		const Vector<LightProbeInfo>& infos = info.volume->getLightProbeInfos();
+		const Vector<Vector3>& positions = info.volume->getLightProbePositions();
 
-			SPtr<Texture> localTexture = entry.volume->getCoefficientsTexture();
-			localTexture->copy(mProbeCoefficientsGPU, copyDesc);
-			
-			rowIdx += localTexture->getProperties().getHeight();
+		UINT32 numProbes = info.volume->getNumActiveProbes();
+
+		const Transform& tfrm = info.volume->getTransform();
+		Vector3 offset = tfrm.getPosition();
+		Quaternion rotation = tfrm.getRotation();
+
+		bool changed = info.positions.size() != numProbes;
+		info.positions.resize(numProbes);
+		info.bufferIndices.resize(numProbes);
+
+		for (UINT32 i = 0; i < numProbes; i++)
+		{
+			Vector3 transformedPos = rotation.rotate(positions[i]) + offset;
+			if (!changed && (info.positions[i] != transformedPos || info.bufferIndices[i] != infos[i].bufferIdx))
+				changed = true;
+
+			info.positions[i] = transformedPos;
+			info.bufferIndices[i] = infos[i].bufferIdx;
 		}
 
+		return changed;
+	}
+
+	void LightProbes::startTetrahedralization()
+	{
+		SPtr<TetrahedralizationJob> job = bs_shared_ptr_new<TetrahedralizationJob>();
+
 		// Gather all positions
 		UINT32 bufferOffset = 0;
-		rowIdx = 0;
 		for(auto& entry : mVolumes)
 		{
-			const Vector<LightProbeInfo>& infos = entry.volume->getLightProbeInfos();
-			const Vector<Vector3>& positions = entry.volume->getLightProbePositions();
-
-			UINT32 numProbes = entry.volume->getNumActiveProbes();
-
-			if (numProbes == 0)
-				continue;
-
-			const Transform& tfrm = entry.volume->getTransform();
-			Vector3 offset = tfrm.getPosition();
-			Quaternion rotation = tfrm.getRotation();
+			job->coefficients.push_back(entry.volume->getCoefficientsTexture());
 
+			UINT32 numProbes = (UINT32)entry.positions.size();
 			for (UINT32 i = 0; i < numProbes; i++)
 			{
-				Vector3 localPos = positions[i];
-				Vector3 transformedPos = rotation.rotate(localPos) + offset;
-				mTempTetrahedronPositions.push_back(transformedPos);
+				job->positions.push_back(entry.positions[i]);
+				job->bufferIndices.push_back(bufferOffset + entry.bufferIndices[i]);
+				job->bufferOffsets.push_back(IBLUtility::getSHCoeffXYFromIdx(entry.bufferIndices[i], 3));
+			}
 
-				mTempTetrahedronBufferIndices.push_back(bufferOffset + infos[i].bufferIdx);
+			bufferOffset += (UINT32)entry.volume->getLightProbePositions().size();
+		}
 
-				Vector2I offset = IBLUtility::getSHCoeffXYFromIdx(infos[i].bufferIdx, 3);
-				mTempTetrahedronBufferOffsets.push_back(offset);
-			}
+		// Nothing to tetrahedralize, clear the active data immediately
+		if (job->positions.empty())
+		{
+			mVolumeMesh = nullptr;
+			mNumValidTetrahedra = 0;
+			mActiveCoefficients.clear();
 
-			SPtr<Texture> localTexture = entry.volume->getCoefficientsTexture();
-			rowIdx += localTexture->getProperties().getHeight();
-			bufferOffset += (UINT32)positions.size();
+			return;
 		}
 
-		mTetrahedronInfos.clear();
+		TetrahedralizationJob* jobPtr = job.get();
+		job->task = Task::create("LightProbeTetrahedralization", [jobPtr]() { buildTetrahedralization(*jobPtr); });
+		TaskScheduler::instance().addTask(job->task);
+
+		mPendingJob = job;
+	}
+
+	void LightProbes::buildTetrahedralization(TetrahedralizationJob& job)
+	{
+		Vector<Vector3>& positions = job.positions;
 
+		Vector<TetrahedronData> tetrahedra;
 		Vector<TetrahedronFaceData> outerFaces;
-		generateTetrahedronData(mTempTetrahedronPositions, mTetrahedronInfos, outerFaces, true);
+		generateTetrahedronData(positions, tetrahedra, outerFaces, true);
 
 		// Find valid tetrahedrons
-		UINT32 numTetrahedra = (UINT32)mTetrahedronInfos.size();
+		UINT32 numTetrahedra = (UINT32)tetrahedra.size();
 
-		bool* validTets = (bool*)bs_stack_alloc(sizeof(bool) * numTetrahedra);
-		mNumValidTetrahedra = 0;
-		for (UINT32 i = 0; i < (UINT32)mTetrahedronInfos.size(); i++)
+		Vector<bool> validTets(numTetrahedra);
+		job.numValidTetrahedra = 0;
+		for (UINT32 i = 0; i < (UINT32)tetrahedra.size(); i++)
 		{
-			const TetrahedronData& entry = mTetrahedronInfos[i];
+			const TetrahedronData& entry = tetrahedra[i];
 
-			const Vector3& P1 = mTempTetrahedronPositions[entry.volume.vertices[0]];
-			const Vector3& P2 = mTempTetrahedronPositions[entry.volume.vertices[1]];
-			const Vector3& P3 = mTempTetrahedronPositions[entry.volume.vertices[2]];
-			const Vector3& P4 = mTempTetrahedronPositions[entry.volume.vertices[3]];
+			const Vector3& P1 = positions[entry.volume.vertices[0]];
+			const Vector3& P2 = positions[entry.volume.vertices[1]];
+			const Vector3& P3 = positions[entry.volume.vertices[2]];
+			const Vector3& P4 = positions[entry.volume.vertices[3]];
 
 			Vector3 E1 = P1 - P4;
 			Vector3 E2 = P2 - P4;
@@ -347,43 +425,43 @@ namespace bs { namespace ct
 			validTets[i] = fabs(Vector3::dot(Vector3::normalize(Vector3::cross(E1, E2)), E3)) > 0.0001f;
 
 			if (validTets[i])
-				mNumValidTetrahedra++;
+				job.numValidTetrahedra++;
 		}
 
-		UINT32 numValidFaces = 0;
+		job.numValidFaces = 0;
 		for(auto& entry : outerFaces)
 		{
 			if (validTets[entry.tetrahedron])
-				numValidFaces++;
+				job.numValidFaces++;
 		}
 
 		// Generate a mesh out of all the tetrahedron triangles
 		// Note: Currently the entire volume is rendered as a single large mesh, which will isn't optimal as we can't
 		// perform frustum culling. A better option would be to split the mesh into multiple smaller volumes, do
 		// frustum culling and possibly even sort by distance from camera.
-		UINT32 numVertices = mNumValidTetrahedra * 4 * 3 + numValidFaces * 9 * 3;
+		UINT32 numVertices = job.numValidTetrahedra * 4 * 3 + job.numValidFaces * 9 * 3;
 
 		SPtr<VertexDataDesc> vertexDesc = bs_shared_ptr_new<VertexDataDesc>();
 		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
 		vertexDesc->addVertElem(VET_UINT1, VES_TEXCOORD);
 
-		SPtr<MeshData> meshData = MeshData::create(numVertices, numVertices, vertexDesc);
-		auto posIter = meshData->getVec3DataIter(VES_POSITION);
-		auto idIter = meshData->getDWORDDataIter(VES_TEXCOORD);
-		UINT32* indices = meshData->getIndices32();
+		job.meshData = MeshData::create(numVertices, numVertices, vertexDesc);
+		auto posIter = job.meshData->getVec3DataIter(VES_POSITION);
+		auto idIter = job.meshData->getDWORDDataIter(VES_TEXCOORD);
+		UINT32* indices = job.meshData->getIndices32();
 
 		// Insert inner tetrahedron triangles
 		UINT32 tetIdx = 0;
-		for (UINT32 i = 0; i < (UINT32)mTetrahedronInfos.size(); i++)
+		for (UINT32 i = 0; i < (UINT32)tetrahedra.size(); i++)
 		{
 			if (!validTets[i])
 				continue;
 
-			const Tetrahedron& volume = mTetrahedronInfos[i].volume;
+			const Tetrahedron& volume = tetrahedra[i].volume;
 
 			Vector3 center(BsZero);
 			for(UINT32 j = 0; j < 4; j++)
-				center += mTempTetrahedronPositions[volume.vertices[j]];
+				center += positions[volume.vertices[j]];
 
 			center /= 4.0f;
 
@@ -397,9 +475,9 @@ namespace bs { namespace ct
 
 			for(UINT32 j = 0; j < 4; j++)
 			{
-				Vector3 A = mTempTetrahedronPositions[volume.vertices[Permutations[j][0]]];
-				Vector3 B = mTempTetrahedronPositions[volume.vertices[Permutations[j][1]]];
-				Vector3 C = mTempTetrahedronPositions[volume.vertices[Permutations[j][2]]];
+				Vector3 A = positions[volume.vertices[Permutations[j][0]]];
+				Vector3 B = positions[volume.vertices[Permutations[j][1]]];
+				Vector3 C = positions[volume.vertices[Permutations[j][2]]];
 
 				// Make sure the triangle is clockwise, facing away from the center
 				Vector3 e0 = A - C;
@@ -435,7 +513,7 @@ namespace bs { namespace ct
 			UINT32 face[2];
 		};
 
-		FrameUnorderedMap<std::pair<INT32, INT32>, Edge, pair_hash> edgeMap;
+		UnorderedMap<std::pair<INT32, INT32>, Edge, pair_hash> edgeMap;
 		for(UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
 		{
 			if (!validTets[outerFaces[i].tetrahedron])
@@ -485,8 +563,8 @@ namespace bs { namespace ct
 			Vector3 center(BsZero);
 			for (UINT32 k = 0; k < 3; k++)
 			{
-				center += mTempTetrahedronPositions[entry.innerVertices[k]];
-				center += mTempTetrahedronPositions[entry.outerVertices[k]];
+				center += positions[entry.innerVertices[k]];
+				center += positions[entry.outerVertices[k]];
 			}
 
 			center /= 6.0f;
@@ -501,9 +579,9 @@ namespace bs { namespace ct
 				idxB = idxB > 2 ? entry.outerVertices[idxB - 3] : entry.innerVertices[idxB];
 				idxC = idxC > 2 ? entry.outerVertices[idxC - 3] : entry.innerVertices[idxC];
 				
-				Vector3 A = mTempTetrahedronPositions[idxA];
-				Vector3 B = mTempTetrahedronPositions[idxB];
-				Vector3 C = mTempTetrahedronPositions[idxC];
+				Vector3 A = positions[idxA];
+				Vector3 B = positions[idxB];
+				Vector3 C = positions[idxC];
 
 				Vector3 e0 = A - C;
 				Vector3 e1 = B - C;
@@ -544,8 +622,8 @@ namespace bs { namespace ct
 				Vector3 center(BsZero);
 				for (UINT32 k = 0; k < 3; k++)
 				{
-					center += mTempTetrahedronPositions[face.innerVertices[k]];
-					center += mTempTetrahedronPositions[face.outerVertices[k]];
+					center += positions[face.innerVertices[k]];
+					center += positions[face.outerVertices[k]];
 				}
 
 				center /= 6.0f;
@@ -561,9 +639,9 @@ namespace bs { namespace ct
 					idxB = idxB > 1 ? edge.vertOuter[idxB - 2] : edge.vertInner[idxB];
 					idxC = idxC > 1 ? edge.vertOuter[idxC - 2] : edge.vertInner[idxC];
 					
-					Vector3 A = mTempTetrahedronPositions[idxA];
-					Vector3 B = mTempTetrahedronPositions[idxB];
-					Vector3 C = mTempTetrahedronPositions[idxC];
+					Vector3 A = positions[idxA];
+					Vector3 B = positions[idxB];
+					Vector3 C = positions[idxC];
 
 					Vector3 e0 = A - C;
 					Vector3 e1 = B - C;
@@ -600,16 +678,16 @@ namespace bs { namespace ct
 
 			const TetrahedronFaceData& entry = outerFaces[i];
 
-			Vector3 A = mTempTetrahedronPositions[entry.outerVertices[0]];
-			Vector3 B = mTempTetrahedronPositions[entry.outerVertices[1]];
-			Vector3 C = mTempTetrahedronPositions[entry.outerVertices[2]];
+			Vector3 A = positions[entry.outerVertices[0]];
+			Vector3 B = positions[entry.outerVertices[1]];
+			Vector3 C = positions[entry.outerVertices[2]];
 
 			// Make sure the triangle is clockwise, facing toward the center
-			const Tetrahedron& tet = mTetrahedronInfos[entry.tetrahedron].volume;
+			const Tetrahedron& tet = tetrahedra[entry.tetrahedron].volume;
 
 			Vector3 center(BsZero);
 			for(UINT32 j = 0; j < 4; j++)
-				center += mTempTetrahedronPositions[tet.vertices[j]];
+				center += positions[tet.vertices[j]];
 
 			center /= 4.0f;
 
@@ -636,31 +714,23 @@ namespace bs { namespace ct
 			capIdx++;
 		}
 
-		mVolumeMesh = Mesh::create(meshData);
-
-		// Map vertices to actual SH coefficient indices, and write GPU buffer with tetrahedron information
-		if ((mNumValidTetrahedra + numValidFaces) > mMaxTetrahedra)
-		{
-			UINT32 newSize = Math::divideAndRoundUp(mNumValidTetrahedra + numValidFaces, 64U) * 64U;
-			resizeTetrahedronBuffer(newSize);
-		}
-
-		TetrahedronDataGPU* dst = (TetrahedronDataGPU*)mTetrahedronInfosGPU->lock(0, mTetrahedronInfosGPU->getSize(), 
-			GBL_WRITE_ONLY_DISCARD);
+		// Map vertices to actual SH coefficient indices, and generate the contents of the GPU tetrahedron buffer
+		job.tetrahedraGPU.resize(job.numValidTetrahedra + job.numValidFaces);
+		TetrahedronDataGPU* dst = job.tetrahedraGPU.data();
 
 		// Write inner tetrahedron data
-		for (UINT32 i = 0; i < (UINT32)mTetrahedronInfos.size(); i++)
+		for (UINT32 i = 0; i < (UINT32)tetrahedra.size(); i++)
 		{
 			if (!validTets[i])
 				continue;
 
-			TetrahedronData& entry = mTetrahedronInfos[i];
+			TetrahedronData& entry = tetrahedra[i];
 
 			Vector2I offsets[4];
 			for(UINT32 j = 0; j < 4; ++j)
 			{
-				entry.volume.vertices[j] = mTempTetrahedronBufferIndices[entry.volume.vertices[j]];
-				offsets[j] = mTempTetrahedronBufferOffsets[entry.volume.vertices[j]];
+				entry.volume.vertices[j] = job.bufferIndices[entry.volume.vertices[j]];
+				offsets[j] = job.bufferOffsets[entry.volume.vertices[j]];
 			}
 
 			memcpy(dst->indices, entry.volume.vertices, sizeof(UINT32) * 4);
@@ -682,8 +752,8 @@ namespace bs { namespace ct
 			Vector2I offsets[4];
 			for(UINT32 j = 0; j < 3; j++)
 			{
-				indices[j] = mTempTetrahedronBufferIndices[entry.innerVertices[j]];
-				offsets[j] = mTempTetrahedronBufferOffsets[entry.innerVertices[j]];
+				indices[j] = job.bufferIndices[entry.innerVertices[j]];
+				offsets[j] = job.bufferOffsets[entry.innerVertices[j]];
 			}
 
 			indices[3] = -1;
@@ -695,17 +765,10 @@ namespace bs { namespace ct
 			dst++;
 		}
 
-		mTetrahedronInfosGPU->unlock();
 
-		// Write data specific to faces
-		if (numValidFaces > mMaxFaces)
-		{
-			UINT32 newSize = Math::divideAndRoundUp(numValidFaces, 64U) * 64U;
-			resizeTetrahedronFaceBuffer(newSize);
-		}
-
-		TetrahedronFaceDataGPU* faceDst = (TetrahedronFaceDataGPU*)mTetrahedronFaceInfosGPU->lock(0, 
-			mTetrahedronFaceInfosGPU->getSize(), GBL_WRITE_ONLY_DISCARD);
+		// Generate data specific to faces
+		job.facesGPU.resize(job.numValidFaces);
+		TetrahedronFaceDataGPU* faceDst = job.facesGPU.data();
 
 		for (UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
 		{
@@ -716,33 +779,75 @@ namespace bs { namespace ct
 
 			for (UINT32 j = 0; j < 3; j++)
 			{
-				faceDst->corners[j] = mTempTetrahedronPositions[entry.innerVertices[j]];
+				faceDst->corners[j] = positions[entry.innerVertices[j]];
 				faceDst->normals[j] = entry.normals[j];
 			}
 
 			faceDst->isQuadratic = entry.quadratic ? 1 : 0;
 			faceDst++;
 		}
+	}
+
+	void LightProbes::applyTetrahedralization(TetrahedralizationJob& job)
+	{
+		mVolumeMesh = Mesh::create(job.meshData);
+
+		UINT32 numEntries = job.numValidTetrahedra + job.numValidFaces;
+		if (numEntries > mMaxTetrahedra)
+		{
+			UINT32 newSize = Math::divideAndRoundUp(numEntries, 64U) * 64U;
+			resizeTetrahedronBuffer(newSize);
+		}
+
+		if (numEntries > 0)
+		{
+			mTetrahedronInfosGPU->writeData(0, numEntries * sizeof(TetrahedronDataGPU), job.tetrahedraGPU.data(), 
+				BWT_DISCARD);
+		}
+
+		if (job.numValidFaces > mMaxFaces)
+		{
+			UINT32 newSize = Math::divideAndRoundUp(job.numValidFaces, 64U) * 64U;
+			resizeTetrahedronFaceBuffer(newSize);
+		}
 
-		mTetrahedronFaceInfosGPU->unlock();
+		if (job.numValidFaces > 0)
+		{
+			mTetrahedronFaceInfosGPU->writeData(0, job.numValidFaces * sizeof(TetrahedronFaceDataGPU), 
+				job.facesGPU.data(), BWT_DISCARD);
+		}
 
-		bs_stack_free(validTets);
+		mNumValidTetrahedra = job.numValidTetrahedra;
 
-		mTempTetrahedronPositions.clear();
-		mTempTetrahedronBufferIndices.clear();
-		mTetrahedronVolumeDirty = false;
+		// Coefficient layout changes along with the tetrahedralization, as it references them by index
+		mActiveCoefficients = std::move(job.coefficients);
+		mCoefficientsDirty = true;
 	}
 
-	bool LightProbes::hasAnyProbes() const
+	void LightProbes::copyCoefficients()
 	{
-		for(auto& entry : mVolumes)
+		// Move all coefficients into the global buffer
+		UINT32 numRows = 0;
+		for(auto& entry : mActiveCoefficients)
+			numRows += entry->getProperties().getHeight();
+
+		if(numRows > mMaxCoefficientRows)
+			resizeCoefficientTexture(numRows + 4);
+
+		UINT32 rowIdx = 0;
+		for(auto& entry : mActiveCoefficients)
 		{
-			UINT32 numProbes = entry.volume->getNumActiveProbes();
-			if (numProbes > 0)
-				return true;
+			TEXTURE_COPY_DESC copyDesc;
+			copyDesc.dstPosition = Vector3I(0, rowIdx, 0);
+
+			entry->copy(mProbeCoefficientsGPU, copyDesc);
+			rowIdx += entry->getProperties().getHeight();
 		}
+	}
 
-		return false;
+	bool LightProbes::hasAnyProbes() const
+	{
+		return mVolumeMesh != nullptr;
 	}
 
 	LightProbesInfo LightProbes::getInfo() const
@@ -16,6 +16,7 @@ namespace bs { namespace ct
 	struct LightProbesInfo;
 	struct GBufferTextures;
 	struct FrameInfo;
+	struct TetrahedralizationJob;
 	class LightProbeVolume;
 
 	/** @addtogroup RenderBeast
@@ -41,7 +42,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("MSAA", msaa),
 				ShaderVariation::Param("MSAA_RESOLVE_0TH", singleSampleMSAA)
 			});
@@ -100,7 +101,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("MSAA", msaa),
 				ShaderVariation::Param("MSAA_RESOLVE_0TH", singleSampleMSAA),
 				ShaderVariation::Param("SKY_ONLY", skyOnly)
@@ -185,8 +186,13 @@ namespace bs { namespace ct
 		{
 			/** Volume containing the information about the probes. */
 			LightProbeVolume* volume;
-			/** Remains true as long as there are dirty probes in the volume. */
+			/** True if the volume was modified since the last call to updateProbes(). */
 			bool isDirty;
+
+			/** World space positions of all active probes in the volume, as of the last call to updateProbes(). */
+			Vector<Vector3> positions;
+			/** Index of the coefficients in the volume's coefficient texture, for each entry in @p positions. */
+			Vector<UINT32> bufferIndices;
 		};
 
 		/** 
@@ -215,6 +221,7 @@ namespace bs { namespace ct
 		};
 	public:
 		LightProbes();
+		~LightProbes();
 
 		/** Notifies sthe manager that the provided light probe volume has been added. */
 		void notifyAdded(LightProbeVolume* volume);
@@ -225,10 +232,17 @@ namespace bs { namespace ct
 		/** Notifies the manager that all the probes in the provided volume have been removed. */
 		void notifyRemoved(LightProbeVolume* volume);
 
-		/** Updates light probe tetrahedron data after probes changed (added/removed/moved). */
+		/** 
+		 * Updates light probe tetrahedron data after probes changed (added/removed/moved). Tetrahedralization is 
+		 * performed on a worker thread, and until it completes the previous tetrahedralization remains in use. Should be
+		 * called every frame while light probes are in use, in order to pick up the results once they are ready.
+		 */
 		void updateProbes();
 
-		/** Returns true if there are any registered light probes. */
+		/** 
+		 * Returns true if there are any light probes ready for rendering. Light probes only become available once their
+		 * tetrahedralization finishes on a worker thread.
+		 */
 		bool hasAnyProbes() const;
 
 		/** 
@@ -253,9 +267,33 @@ namespace bs { namespace ct
 		 * @param[in]		generateExtrapolationVolume	If true, the tetrahedron volume will be surrounded with points
 		 *												at "infinity" (technically just far away).
 		 */
-		void generateTetrahedronData(Vector<Vector3>& positions, Vector<TetrahedronData>& tetrahedra, 
+		static void generateTetrahedronData(Vector<Vector3>& positions, Vector<TetrahedronData>& tetrahedra, 
 			Vector<TetrahedronFaceData>& faces, bool generateExtrapolationVolume = false);
 
+		/** 
+		 * Tetrahedralizes the probe positions in @p job and generates the volume mesh and GPU buffer contents from the 
+		 * result. Doesn't access any GPU resources and is safe to call from worker threads.
+		 */
+		static void buildTetrahedralization(TetrahedralizationJob& job);
+
+		/** 
+		 * Refreshes the cached world space probe positions of the provided volume. Returns true if they differ from 
+		 * the previously cached positions, meaning the tetrahedralization needs to be rebuilt.
+		 */
+		static bool updateCachedPositions(VolumeInfo& info);
+
+		/** Starts tetrahedralization of all currently registered probes on a worker thread. */
+		void startTetrahedralization();
+
+		/** Uploads the results of a completed tetrahedralization to the GPU and makes them active. */
+		void applyTetrahedralization(TetrahedralizationJob& job);
+
+		/** 
+		 * Copies the coefficients of all volumes that are part of the active tetrahedralization into the global
+		 * coefficient texture.
+		 */
+		void copyCoefficients();
+
 		/** Resizes the GPU buffer used for holding tetrahedron data, to the specified size (in number of tetraheda). */
 		void resizeTetrahedronBuffer(UINT32 count);
 
@@ -270,23 +308,20 @@ namespace bs { namespace ct
 
 		Vector<VolumeInfo> mVolumes;
 		bool mTetrahedronVolumeDirty;
+		bool mCoefficientsDirty = false;
+
+		SPtr<TetrahedralizationJob> mPendingJob;
+		Vector<SPtr<Texture>> mActiveCoefficients;
 
 		UINT32 mMaxCoefficientRows;
 		UINT32 mMaxTetrahedra;
 		UINT32 mMaxFaces;
 
-		Vector<TetrahedronData> mTetrahedronInfos;
-
 		SPtr<Texture> mProbeCoefficientsGPU;
 		SPtr<GpuBuffer> mTetrahedronInfosGPU;
 		SPtr<GpuBuffer> mTetrahedronFaceInfosGPU;
 		SPtr<Mesh> mVolumeMesh;
 		UINT32 mNumValidTetrahedra;
-
-		// Temporary buffers
-		Vector<Vector3> mTempTetrahedronPositions;
-		Vector<UINT32> mTempTetrahedronBufferIndices;
-		Vector<Vector2I> mTempTetrahedronBufferOffsets;
 	};
 
 	/** @} */
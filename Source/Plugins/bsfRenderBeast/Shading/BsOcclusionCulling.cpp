@@ -0,0 +1,183 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsOcclusionCulling.h"
+#include "Utility/BsBitwise.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsEventQuery.h"
+#include "Material/BsGpuParamsSet.h"
+#include "Image/BsTexture.h"
+#include "BsRendererScene.h"
+
+namespace bs { namespace ct
+{
+	static const UINT32 THREADGROUP_SIZE = 64;
+
+	OcclusionCullParamDef gOcclusionCullParamDef;
+
+	OcclusionCullMat::OcclusionCullMat()
+	{
+		mParamBuffer = gOcclusionCullParamDef.createBuffer();
+		mParams->setParamBlockBuffer("Params", mParamBuffer);
+
+		mParams->getTextureParam(GPT_COMPUTE_PROGRAM, "gHiZ", mHiZParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gBounds", mBoundsParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gOutput", mOutputParam);
+	}
+
+	void OcclusionCullMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("THREADGROUP_SIZE", THREADGROUP_SIZE);
+	}
+
+	void OcclusionCullMat::execute(const RendererView& view, const SPtr<Texture>& hiZ, const SPtr<GpuBuffer>& bounds,
+		UINT32 numBounds, const SPtr<GpuBuffer>& output)
+	{
+		const RendererViewProperties& viewProps = view.getProperties();
+		const TextureProperties& hiZProps = hiZ->getProperties();
+		const Rect2I& viewRect = viewProps.viewRect;
+
+		// Maps from NDC to UV [0, 1]
+		Vector4 ndcToHiZUV;
+		ndcToHiZUV.x = 0.5f;
+		ndcToHiZUV.y = -0.5f;
+		ndcToHiZUV.z = 0.5f;
+		ndcToHiZUV.w = 0.5f;
+
+		// Either of these flips the Y axis, but if they're both true they cancel out
+		const RenderAPIInfo& rapiInfo = RenderAPI::instance().getAPIInfo();
+		if (rapiInfo.isFlagSet(RenderAPIFeatureFlag::UVYAxisUp) ^ rapiInfo.isFlagSet(RenderAPIFeatureFlag::NDCYAxisDown))
+			ndcToHiZUV.y = -ndcToHiZUV.y;
+
+		// Maps from [0, 1] to area of HiZ where depth is stored in
+		ndcToHiZUV.x *= (float)viewRect.width / hiZProps.getWidth();
+		ndcToHiZUV.y *= (float)viewRect.height / hiZProps.getHeight();
+		ndcToHiZUV.z *= (float)viewRect.width / hiZProps.getWidth();
+		ndcToHiZUV.w *= (float)viewRect.height / hiZProps.getHeight();
+
+		Vector2I hiZSize(hiZProps.getWidth(), hiZProps.getHeight());
+		gOcclusionCullParamDef.gNDCToHiZUV.set(mParamBuffer, ndcToHiZUV);
+		gOcclusionCullParamDef.gHiZSize.set(mParamBuffer, hiZSize);
+		gOcclusionCullParamDef.gHiZNumMips.set(mParamBuffer, hiZProps.getNumMipmaps());
+		gOcclusionCullParamDef.gNumBounds.set(mParamBuffer, numBounds);
+
+		mParams->setParamBlockBuffer("PerCamera", view.getPerViewBuffer());
+		mHiZParam.set(hiZ);
+		mBoundsParam.set(bounds);
+		mOutputParam.set(output);
+
+		UINT32 numGroups = Math::divideAndRoundUp(numBounds, THREADGROUP_SIZE);
+
+		bind();
+		RenderAPI::instance().dispatchCompute(numGroups);
+	}
+
+	OcclusionCulling::OcclusionCulling()
+	{
+		for(auto& entry : mPendingTests)
+			entry.query = EventQuery::create();
+	}
+
+	void OcclusionCulling::update(const SceneInfo& sceneInfo)
+	{
+		mTestIds.clear();
+		mTestBounds.clear();
+
+		const UINT32 numRenderables = (UINT32)sceneInfo.renderables.size();
+
+		// Renderer IDs changed, any earlier results no longer map to the correct renderables
+		if(mSceneVersion != sceneInfo.renderableIdVersion || mOccluded.size() != numRenderables)
+		{
+			mOccluded.reset(numRenderables);
+			mSceneVersion = sceneInfo.renderableIdVersion;
+		}
+
+		// Go from oldest to newest so the latest finished results are the ones that end up being used
+		for(UINT32 i = 0; i < MAX_PENDING_TESTS; i++)
+		{
+			PendingTests& pending = mPendingTests[(mNextPendingTests + i) % MAX_PENDING_TESTS];
+			if(!pending.active)
+				continue;
+
+			if(!pending.query->isReady())
+				break;
+
+			pending.active = false;
+			if(pending.sceneVersion != mSceneVersion)
+				continue;
+
+			mResultData.resize(pending.numResults);
+			pending.results->readData(0, pending.numResults * sizeof(UINT32), mResultData.data());
+
+			mOccluded.reset(numRenderables);
+			for(UINT32 j = 0; j < pending.numResults; j++)
+			{
+				UINT32 renderableId = pending.renderableIds[j];
+				if(mResultData[j] == 0 && renderableId < numRenderables)
+					mOccluded.set(renderableId);
+			}
+		}
+	}
+
+	void OcclusionCulling::addTest(UINT32 renderableId, const AABox& bounds)
+	{
+		mTestIds.push_back(renderableId);
+		mTestBounds.push_back(Vector4(bounds.getCenter(), 0.0f));
+		mTestBounds.push_back(Vector4(bounds.getHalfSize(), 0.0f));
+	}
+
+	void OcclusionCulling::execute(const RendererView& view, const SPtr<Texture>& hiZ)
+	{
+		const UINT32 numTests = (UINT32)mTestIds.size();
+		if(numTests == 0)
+			return;
+
+		// If the GPU fell too far behind, the oldest tests are dropped
+		PendingTests& pending = mPendingTests[mNextPendingTests];
+		mNextPendingTests = (mNextPendingTests + 1) % MAX_PENDING_TESTS;
+
+		if(mBoundsBuffer == nullptr || mBoundsBuffer->getProperties().getElementCount() < numTests * 2)
+		{
+			GPU_BUFFER_DESC desc;
+			desc.elementCount = Bitwise::nextPow2(numTests * 2);
+			desc.elementSize = 0;
+			desc.format = BF_32X4F;
+			desc.type = GBT_STANDARD;
+			desc.usage = GBU_DYNAMIC;
+
+			mBoundsBuffer = GpuBuffer::create(desc);
+		}
+
+		if(pending.results == nullptr || pending.results->getProperties().getElementCount() < numTests)
+		{
+			GPU_BUFFER_DESC desc;
+			desc.elementCount = Bitwise::nextPow2(numTests);
+			desc.elementSize = 0;
+			desc.format = BF_32X1U;
+			desc.type = GBT_STANDARD;
+			desc.randomGpuWrite = true;
+
+			pending.results = GpuBuffer::create(desc);
+		}
+
+		mBoundsBuffer->writeData(0, numTests * 2 * sizeof(Vector4), mTestBounds.data(), BWT_DISCARD);
+
+		OcclusionCullMat* material = OcclusionCullMat::get();
+		material->execute(view, hiZ, mBoundsBuffer, numTests, pending.results);
+
+		pending.renderableIds = mTestIds;
+		pending.numResults = numTests;
+		pending.sceneVersion = mSceneVersion;
+		pending.active = true;
+		pending.query->begin();
+	}
+
+	void OcclusionCulling::reset()
+	{
+		for(auto& entry : mPendingTests)
+			entry.active = false;
+
+		mTestIds.clear();
+		mTestBounds.clear();
+		mOccluded.reset(0);
+	}
+}}
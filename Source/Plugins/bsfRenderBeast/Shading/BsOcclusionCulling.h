@@ -0,0 +1,125 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Renderer/BsRendererMaterial.h"
+#include "Renderer/BsParamBlocks.h"
+#include "BsRendererView.h"
+
+namespace bs { namespace ct
+{
+	struct SceneInfo;
+
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	BS_PARAM_BLOCK_BEGIN(OcclusionCullParamDef)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gNDCToHiZUV)
+		BS_PARAM_BLOCK_ENTRY(Vector2I, gHiZSize)
+		BS_PARAM_BLOCK_ENTRY(INT32, gHiZNumMips)
+		BS_PARAM_BLOCK_ENTRY(INT32, gNumBounds)
+	BS_PARAM_BLOCK_END
+
+	extern OcclusionCullParamDef gOcclusionCullParamDef;
+
+	/**
+	 * Shader that tests a set of world space bounding boxes against a HiZ buffer containing farthest depths, and outputs
+	 * which of them are potentially visible.
+	 */
+	class OcclusionCullMat : public RendererMaterial<OcclusionCullMat>
+	{
+		RMAT_DEF_CUSTOMIZED("OcclusionCullHiZ.bsl");
+
+	public:
+		OcclusionCullMat();
+
+		/**
+		 * Executes the occlusion tests.
+		 *
+		 * @param[in]	view		View whose depth the HiZ buffer was generated from.
+		 * @param[in]	hiZ			HiZ buffer generated with the BuildHiZMat material, with farthest depth enabled.
+		 * @param[in]	bounds		Buffer containing two 4-component float entries per box, the first containing the box
+		 *							center and the second containing the box extents.
+		 * @param[in]	numBounds	Number of boxes in the @p bounds buffer.
+		 * @param[in]	output		Buffer to receive a single 32-bit value per box. Value is 1 if the box is potentially
+		 *							visible, or 0 if it is occluded.
+		 */
+		void execute(const RendererView& view, const SPtr<Texture>& hiZ, const SPtr<GpuBuffer>& bounds,
+			UINT32 numBounds, const SPtr<GpuBuffer>& output);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamTexture mHiZParam;
+		GpuParamBuffer mBoundsParam;
+		GpuParamBuffer mOutputParam;
+	};
+
+	/**
+	 * Keeps track of which renderables visible in a view were found to be occluded, using GPU occlusion tests against
+	 * the view's HiZ buffer. Renderables are tested every frame after the base pass, and the results are read back
+	 * once the GPU finishes the tests, normally on the next frame, so the occlusion information lags behind by at least
+	 * one frame.
+	 */
+	class OcclusionCulling
+	{
+	public:
+		OcclusionCulling();
+
+		/**
+		 * Reads back results of any finished occlusion tests, and clears the list of renderables queued for testing.
+		 * Should be called once per frame, before visibility for the view is determined.
+		 */
+		void update(const SceneInfo& sceneInfo);
+
+		/**
+		 * Returns true if the renderable with the provided ID was found occluded by the most recent finished test, or
+		 * false if it was visible or not tested.
+		 */
+		bool isOccluded(UINT32 renderableId) const
+		{
+			return renderableId < mOccluded.size() && mOccluded[renderableId];
+		}
+
+		/** Queues a renderable for occlusion testing during the next call to execute(). */
+		void addTest(UINT32 renderableId, const AABox& bounds);
+
+		/**
+		 * Executes all occlusion tests queued since the last call to update(), against the provided HiZ buffer. Results
+		 * will be available through isOccluded() after a later call to update().
+		 */
+		void execute(const RendererView& view, const SPtr<Texture>& hiZ);
+
+		/** Discards all results and pending tests. */
+		void reset();
+
+	private:
+		/** Maximum number of tests that can be in flight on the GPU at once. */
+		static constexpr UINT32 MAX_PENDING_TESTS = 3;
+
+		/** Set of occlusion tests submitted to the GPU. */
+		struct PendingTests
+		{
+			SPtr<GpuBuffer> results;
+			SPtr<EventQuery> query;
+			Vector<UINT32> renderableIds;
+			UINT32 numResults = 0;
+			UINT32 sceneVersion = 0;
+			bool active = false;
+		};
+
+		PendingTests mPendingTests[MAX_PENDING_TESTS];
+		UINT32 mNextPendingTests = 0;
+
+		Vector<UINT32> mTestIds;
+		Vector<Vector4> mTestBounds;
+		SPtr<GpuBuffer> mBoundsBuffer;
+		Vector<UINT32> mResultData;
+
+		VisibilityMask mOccluded;
+		UINT32 mSceneVersion = 0;
+	};
+
+	/** @} */
+}}
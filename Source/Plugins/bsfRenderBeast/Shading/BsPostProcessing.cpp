@@ -128,7 +128,7 @@ namespace bs { namespace ct
 	}
 
 	void EyeAdaptHistogramMat::execute(const SPtr<Texture>& input, const SPtr<Texture>& output, 
-		const AutoExposureSettings& settings)
+		const AutoExposureSettings& settings, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		// Set parameters
 		mSceneColor.set(input);
@@ -145,10 +145,10 @@ namespace bs { namespace ct
 		// Dispatch
 		mOutputTex.set(output);
 
-		bind();
+		bind(commandBuffer);
 
 		RenderAPI& rapi = RenderAPI::instance();
-		rapi.dispatchCompute(threadGroupCount.x, threadGroupCount.y);
+		rapi.dispatchCompute(threadGroupCount.x, threadGroupCount.y, 1, commandBuffer);
 	}
 
 	POOLED_RENDER_TEXTURE_DESC EyeAdaptHistogramMat::getOutputDesc(const SPtr<Texture>& target)
@@ -300,6 +300,84 @@ namespace bs { namespace ct
 		gEyeAdaptationParamDef.gEyeAdaptationParams.set(paramBuffer, eyeAdaptationParams[2], 2);
 	}
 
+	LatentEyeAdaptation::~LatentEyeAdaptation()
+	{
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+
+		if (mSceneColor)
+			resPool.release(mSceneColor);
+
+		if (mHistogram)
+			resPool.release(mHistogram);
+	}
+
+	bool LatentEyeAdaptation::queueHistogram(const AutoExposureSettings& settings, 
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mSceneColor == nullptr)
+			return false;
+
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+		if (mHistogram)
+			resPool.release(mHistogram);
+
+		mHistogram = resPool.get(EyeAdaptHistogramMat::getOutputDesc(mSceneColor->texture));
+
+		EyeAdaptHistogramMat* eyeAdaptHistogramMat = EyeAdaptHistogramMat::get();
+		eyeAdaptHistogramMat->execute(mSceneColor->texture, mHistogram->texture, settings, commandBuffer);
+
+		return true;
+	}
+
+	SPtr<PooledRenderTexture> LatentEyeAdaptation::resolve(const SPtr<Texture>& prevEyeAdaptation, float frameDelta,
+		const AutoExposureSettings& settings, float exposureScale)
+	{
+		if (mHistogram == nullptr)
+			return nullptr;
+
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+
+		// Reduce histogram
+		SPtr<PooledRenderTexture> reducedHistogram = resPool.get(EyeAdaptHistogramReduceMat::getOutputDesc());
+
+		EyeAdaptHistogramReduceMat* eyeAdaptHistogramReduce = EyeAdaptHistogramReduceMat::get();
+		eyeAdaptHistogramReduce->execute(
+			mSceneColor->texture,
+			mHistogram->texture,
+			prevEyeAdaptation,
+			reducedHistogram->renderTexture);
+
+		resPool.release(mHistogram);
+		mHistogram = nullptr;
+
+		// Generate eye adaptation value
+		SPtr<PooledRenderTexture> eyeAdaptation = resPool.get(EyeAdaptationMat::getOutputDesc());
+
+		EyeAdaptationMat* eyeAdaptationMat = EyeAdaptationMat::get();
+		eyeAdaptationMat->execute(
+			reducedHistogram->texture,
+			eyeAdaptation->renderTexture,
+			frameDelta,
+			settings,
+			exposureScale);
+
+		resPool.release(reducedHistogram);
+		return eyeAdaptation;
+	}
+
+	void LatentEyeAdaptation::storeSceneColor(const SPtr<Texture>& sceneColor)
+	{
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+		if (mSceneColor)
+			resPool.release(mSceneColor);
+
+		bool msaa = sceneColor->getProperties().getNumSamples() > 1;
+		DownsampleMat* downsampleMat = DownsampleMat::getVariation(1, msaa);
+
+		mSceneColor = resPool.get(DownsampleMat::getOutputDesc(sceneColor));
+		downsampleMat->execute(sceneColor, mSceneColor->renderTexture);
+	}
+
 	EyeAdaptationBasicSetupMat::EyeAdaptationBasicSetupMat()
 	{
 		mParamBuffer = gEyeAdaptationParamDef.createBuffer();
@@ -1009,12 +1087,20 @@ namespace bs { namespace ct
 		rapi.setViewport(Rect2(0, 0, 1, 1));
 	}
 
-	BuildHiZMat* BuildHiZMat::getVariation(bool noTextureViews)
+	BuildHiZMat* BuildHiZMat::getVariation(bool noTextureViews, bool farthest)
 	{
 		if (noTextureViews)
-			return get(getVariation<true>());
-		
-		return get(getVariation<false>());
+		{
+			if (farthest)
+				return get(getVariation<true, true>());
+
+			return get(getVariation<true, false>());
+		}
+
+		if (farthest)
+			return get(getVariation<false, true>());
+
+		return get(getVariation<false, false>());
 	}
 
 	FXAAParamDef gFXAAParamDef;
@@ -1043,6 +1129,87 @@ namespace bs { namespace ct
 		gRendererUtility().drawScreenQuad();
 	}
 
+	UpscaleParamDef gUpscaleParamDef;
+
+	UpscaleMat::UpscaleMat()
+	{
+		mParamBuffer = gUpscaleParamDef.createBuffer();
+
+		mParams->setParamBlockBuffer("Input", mParamBuffer);
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gInputTex", mInputTexture);
+
+		SAMPLER_STATE_DESC desc;
+		desc.minFilter = FO_LINEAR;
+		desc.magFilter = FO_LINEAR;
+		desc.mipFilter = FO_POINT;
+		desc.addressMode.u = TAM_CLAMP;
+		desc.addressMode.v = TAM_CLAMP;
+		desc.addressMode.w = TAM_CLAMP;
+
+		SPtr<SamplerState> samplerState = SamplerState::create(desc);
+		setSamplerState(mParams, GPT_FRAGMENT_PROGRAM, "gInputSamp", "gInputTex", samplerState);
+	}
+
+	void UpscaleMat::execute(const SPtr<Texture>& source, float sharpness, bool flipUV)
+	{
+		const TextureProperties& srcProps = source->getProperties();
+
+		Vector2 invTexSize(1.0f / srcProps.getWidth(), 1.0f / srcProps.getHeight());
+		gUpscaleParamDef.gInvTexSize.set(mParamBuffer, invTexSize);
+		gUpscaleParamDef.gSharpness.set(mParamBuffer, Math::clamp01(sharpness));
+
+		mInputTexture.set(source);
+
+		bind();
+		gRendererUtility().drawScreenQuad(Rect2(0.0f, 0.0f, 1.0f, 1.0f), Vector2I(1, 1), 1, flipUV);
+	}
+
+	BilateralUpsampleParamDef gBilateralUpsampleParamDef;
+
+	BilateralUpsampleMat::BilateralUpsampleMat()
+	{
+		mParamBuffer = gBilateralUpsampleParamDef.createBuffer();
+
+		mParams->setParamBlockBuffer("Input", mParamBuffer);
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gInputTex", mInputTexture);
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gDepthTex", mDepthTexture);
+
+		SAMPLER_STATE_DESC desc;
+		desc.minFilter = FO_POINT;
+		desc.magFilter = FO_POINT;
+		desc.mipFilter = FO_POINT;
+		desc.addressMode.u = TAM_CLAMP;
+		desc.addressMode.v = TAM_CLAMP;
+		desc.addressMode.w = TAM_CLAMP;
+
+		SPtr<SamplerState> samplerState = SamplerState::create(desc);
+		setSamplerState(mParams, GPT_FRAGMENT_PROGRAM, "gPointSamp", "gInputTex", samplerState);
+	}
+
+	void BilateralUpsampleMat::execute(const RendererView& view, const SPtr<Texture>& source, 
+		const SPtr<Texture>& sceneDepth, const SPtr<RenderTexture>& destination)
+	{
+		const TextureProperties& srcProps = source->getProperties();
+
+		Vector2 lowResSize((float)srcProps.getWidth(), (float)srcProps.getHeight());
+		Vector2 lowResPixelSize(1.0f / lowResSize.x, 1.0f / lowResSize.y);
+
+		gBilateralUpsampleParamDef.gLowResSize.set(mParamBuffer, lowResSize);
+		gBilateralUpsampleParamDef.gLowResPixelSize.set(mParamBuffer, lowResPixelSize);
+
+		mInputTexture.set(source);
+		mDepthTexture.set(sceneDepth);
+
+		SPtr<GpuParamBlockBuffer> perView = view.getPerViewBuffer();
+		mParams->setParamBlockBuffer("PerCamera", perView);
+
+		RenderAPI& rapi = RenderAPI::instance();
+		rapi.setRenderTarget(destination);
+
+		bind();
+		gRendererUtility().drawScreenQuad();
+	}
+
 	SSAOParamDef gSSAOParamDef;
 
 	SSAOMat::SSAOMat()
@@ -1538,6 +1705,90 @@ namespace bs { namespace ct
 	TemporalResolveParamDef gTemporalResolveParamDef;
 	SSRResolveParamDef gSSRResolveParamDef;
 
+	/** 
+	 * Fills out the sample weights used by the TemporalResolve shader mixin.
+	 * 
+	 * @param[in]	buffer		Buffer created from TemporalResolveParamDef to write the weights to.
+	 * @param[in]	jitter		Sub-pixel offset, in pixels, the current frame was rendered with.
+	 * @param[in]	sharpness	Determines how wide the reconstruction filter is. Larger values result in a sharper image.
+	 * @param[in]	useYCoCg	True if the resolve is performed in YCoCg color space, in which case only a cross
+	 *							shaped neighborhood is sampled.
+	 */
+	static void populateTemporalResolveParams(const SPtr<GpuParamBlockBuffer>& buffer, const Vector2& jitter,
+		float sharpness, bool useYCoCg)
+	{
+		float sampleWeights[9];
+		float sampleWeightsLowPass[9];
+
+		float totalWeights = 0.0f;
+		float totalWeightsLowPass = 0.0f;
+
+		// Weights are generated using an exponential fit to Blackman-Harris 3.3
+		if(useYCoCg)
+		{
+			static const Vector2 sampleOffsets[] = 
+			{
+				{  0.0f, -1.0f },
+				{ -1.0f,  0.0f },
+				{  0.0f,  0.0f },
+				{  1.0f,  0.0f },
+				{  0.0f,  1.0f },
+			};
+
+			for (UINT32 i = 0; i < 5; ++i)
+			{
+				// Get rid of jitter introduced by the projection matrix
+				Vector2 offset = sampleOffsets[i] - jitter;
+
+				offset *= 1.0f + sharpness * 0.5f;
+				sampleWeights[i] = exp(-2.29f * offset.dot(offset));
+				totalWeights += sampleWeights[i];
+			}
+
+			for (UINT32 i = 5; i < 9; ++i)
+				sampleWeights[i] = 0.0f;
+			
+			memset(sampleWeightsLowPass, 0, sizeof(sampleWeightsLowPass));
+			totalWeightsLowPass = 1.0f;
+		}
+		else
+		{
+			static const Vector2 sampleOffsets[] = 
+			{
+				{ -1.0f, -1.0f },
+				{  0.0f, -1.0f },
+				{  1.0f, -1.0f },
+				{ -1.0f,  0.0f },
+				{  0.0f,  0.0f },
+				{  1.0f,  0.0f },
+				{ -1.0f,  1.0f },
+				{  0.0f,  1.0f },
+				{  1.0f,  1.0f },
+			};
+
+			for (UINT32 i = 0; i < 9; ++i)
+			{
+				// Get rid of jitter introduced by the projection matrix
+				Vector2 offset = sampleOffsets[i] - jitter;
+
+				offset *= 1.0f + sharpness * 0.5f;
+				sampleWeights[i] = exp(-2.29f * offset.dot(offset));
+				totalWeights += sampleWeights[i];
+
+				// Low pass
+				offset *= 0.25f;
+				sampleWeightsLowPass[i] = exp(-2.29f * offset.dot(offset));
+				totalWeightsLowPass += sampleWeightsLowPass[i];
+			}
+		}
+
+		for (UINT32 i = 0; i < 9; ++i)
+		{
+			gTemporalResolveParamDef.gSampleWeights.set(buffer, sampleWeights[i] / totalWeights, i);
+			gTemporalResolveParamDef.gSampleWeightsLowpass.set(buffer, sampleWeightsLowPass[i] / totalWeightsLowPass, i);
+		}
+	}
+
 	SSRResolveMat::SSRResolveMat()
 	{
 		mSSRParamBuffer = gSSRResolveParamDef.createBuffer();
@@ -1605,84 +1856,106 @@ namespace bs { namespace ct
 		gSSRResolveParamDef.gSceneDepthTexelSize.set(mSSRParamBuffer, depthPixelSize);
 		gSSRResolveParamDef.gManualExposure.set(mSSRParamBuffer, 1.0f);
 
-		// Generate samples
-		// Note: Move this code to a more general spot where it can be used by other temporal shaders.
+		// Jitter is only relevant for temporal anti-aliasing, SSR isn't rendered with a jittered projection
+		populateTemporalResolveParams(mTemporalParamBuffer, Vector2(BsZero), 1.0f, false);
 		
-		float sampleWeights[9];
-		float sampleWeightsLowPass[9];
-
-		float totalWeights = 0.0f;
-		float totalWeightsLowPass = 0.0f;
+		SPtr<GpuParamBlockBuffer> perView = view.getPerViewBuffer();
+		mParams->setParamBlockBuffer("PerCamera", perView);
 
-		Vector2 jitter(BsZero); // Only relevant for general case, not using this type of jitter for SSR
+		RenderAPI& rapi = RenderAPI::instance();
+		rapi.setRenderTarget(destination);
 
-		// Weights are generated using an exponential fit to Blackman-Harris 3.3
-		bool useYCoCg = false; // Only relevant for general case, not using it for SSR
-		float sharpness = 1.0f; // Make this a customizable parameter eventually
-		if(useYCoCg)
-		{
-			static const Vector2 sampleOffsets[] = 
-			{
-				{  0.0f, -1.0f },
-				{ -1.0f,  0.0f },
-				{  0.0f,  0.0f },
-				{  1.0f,  0.0f },
-				{  0.0f,  1.0f },
-			};
+		const RendererViewProperties& viewProps = view.getProperties();
+		const Rect2I& viewRect = viewProps.viewRect;
 
-			for (UINT32 i = 0; i < 5; ++i)
-			{
-				// Get rid of jitter introduced by the projection matrix
-				Vector2 offset = sampleOffsets[i] - jitter;
+		bind();
 
-				offset *= 1.0f + sharpness * 0.5f;
-				sampleWeights[i] = exp(-2.29f * offset.dot(offset));
-				totalWeights += sampleWeights[i];
-			}
+		if(viewProps.numSamples > 1)
+			gRendererUtility().drawScreenQuad(Rect2(0.0f, 0.0f, (float)viewRect.width, (float)viewRect.height));
+		else
+			gRendererUtility().drawScreenQuad();
+	}
 
-			for (UINT32 i = 5; i < 9; ++i)
-				sampleWeights[i] = 0.0f;
-			
-			memset(sampleWeightsLowPass, 0, sizeof(sampleWeightsLowPass));
-			totalWeightsLowPass = 1.0f;
-		}
+	SSRResolveMat* SSRResolveMat::getVariation(bool msaa)
+	{
+		if (msaa)
+			return get(getVariation<true>());
 		else
-		{
-			static const Vector2 sampleOffsets[] = 
-			{
-				{ -1.0f, -1.0f },
-				{  0.0f, -1.0f },
-				{  1.0f, -1.0f },
-				{ -1.0f,  0.0f },
-				{  0.0f,  0.0f },
-				{  1.0f,  0.0f },
-				{ -1.0f,  1.0f },
-				{  0.0f,  1.0f },
-				{  1.0f,  1.0f },
-			};
+			return get(getVariation<false>());
+	}
 
-			for (UINT32 i = 0; i < 9; ++i)
-			{
-				// Get rid of jitter introduced by the projection matrix
-				Vector2 offset = sampleOffsets[i] - jitter;
+	TemporalAAParamDef gTemporalAAParamDef;
 
-				offset *= 1.0f + sharpness * 0.5f;
-				sampleWeights[i] = exp(-2.29f * offset.dot(offset));
-				totalWeights += sampleWeights[i];
+	TemporalAAMat::TemporalAAMat()
+	{
+		mParamBuffer = gTemporalAAParamDef.createBuffer();
+		mTemporalParamBuffer = gTemporalResolveParamDef.createBuffer();
 
-				// Low pass
-				offset *= 0.25f;
-				sampleWeightsLowPass[i] = exp(-2.29f * offset.dot(offset));
-				totalWeightsLowPass += sampleWeightsLowPass[i];
-			}
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gSceneDepth", mSceneDepthTexture);
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gVelocity", mVelocityTexture);
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gSceneColor", mSceneColorTexture);
+		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gPrevColor", mPrevColorTexture);
+
+		mParams->setParamBlockBuffer(GPT_FRAGMENT_PROGRAM, "Input", mParamBuffer);
+		mParams->setParamBlockBuffer(GPT_FRAGMENT_PROGRAM, "TemporalInput", mTemporalParamBuffer);
+
+		SAMPLER_STATE_DESC pointSampDesc;
+		pointSampDesc.minFilter = FO_POINT;
+		pointSampDesc.magFilter = FO_POINT;
+		pointSampDesc.mipFilter = FO_POINT;
+		pointSampDesc.addressMode.u = TAM_CLAMP;
+		pointSampDesc.addressMode.v = TAM_CLAMP;
+		pointSampDesc.addressMode.w = TAM_CLAMP;
+
+		SPtr<SamplerState> pointSampState = SamplerState::create(pointSampDesc);
+
+		if(mParams->hasSamplerState(GPT_FRAGMENT_PROGRAM, "gPointSampler"))
+			mParams->setSamplerState(GPT_FRAGMENT_PROGRAM, "gPointSampler", pointSampState);
+		else
+		{
+			mParams->setSamplerState(GPT_FRAGMENT_PROGRAM, "gSceneDepth", pointSampState);
+			mParams->setSamplerState(GPT_FRAGMENT_PROGRAM, "gVelocity", pointSampState);
 		}
 
-		for (UINT32 i = 0; i < 9; ++i)
+		// Color is sampled in between texels when upsampling, and when reprojecting history
+		SAMPLER_STATE_DESC linearSampDesc;
+		linearSampDesc.minFilter = FO_LINEAR;
+		linearSampDesc.magFilter = FO_LINEAR;
+		linearSampDesc.mipFilter = FO_POINT;
+		linearSampDesc.addressMode.u = TAM_CLAMP;
+		linearSampDesc.addressMode.v = TAM_CLAMP;
+		linearSampDesc.addressMode.w = TAM_CLAMP;
+
+		SPtr<SamplerState> linearSampState = SamplerState::create(linearSampDesc);
+		if(mParams->hasSamplerState(GPT_FRAGMENT_PROGRAM, "gLinearSampler"))
+			mParams->setSamplerState(GPT_FRAGMENT_PROGRAM, "gLinearSampler", linearSampState);
+		else
 		{
-			gTemporalResolveParamDef.gSampleWeights.set(mTemporalParamBuffer, sampleWeights[i] / totalWeights, i);
-			gTemporalResolveParamDef.gSampleWeightsLowpass.set(mTemporalParamBuffer, sampleWeightsLowPass[i] / totalWeightsLowPass, i);
+			mParams->setSamplerState(GPT_FRAGMENT_PROGRAM, "gSceneColor", linearSampState);
+			mParams->setSamplerState(GPT_FRAGMENT_PROGRAM, "gPrevColor", linearSampState);
 		}
-		
+	}
+
+	void TemporalAAMat::execute(const RendererView& view, const SPtr<Texture>& prevFrame, 
+		const SPtr<Texture>& curFrame, const SPtr<Texture>& sceneDepth, const SPtr<Texture>& velocity,
+		const SPtr<RenderTarget>& destination)
+	{
+		mPrevColorTexture.set(prevFrame);
+		mSceneColorTexture.set(curFrame);
+		mSceneDepthTexture.set(sceneDepth);
+		mVelocityTexture.set(velocity);
+
+		auto& colorProps = curFrame->getProperties();
+		auto& depthProps = sceneDepth->getProperties();
+
+		Vector2 colorPixelSize(1.0f / colorProps.getWidth(), 1.0f / colorProps.getHeight());
+		Vector2 depthPixelSize(1.0f / depthProps.getWidth(), 1.0f / depthProps.getHeight());
+
+		gTemporalAAParamDef.gSceneColorTexelSize.set(mParamBuffer, colorPixelSize);
+		gTemporalAAParamDef.gSceneDepthTexelSize.set(mParamBuffer, depthPixelSize);
+
+		populateTemporalResolveParams(mTemporalParamBuffer, view.getTemporalJitter(), 1.0f, false);
+
 		SPtr<GpuParamBlockBuffer> perView = view.getPerViewBuffer();
 		mParams->setParamBlockBuffer("PerCamera", perView);
 
@@ -1694,13 +1967,14 @@ namespace bs { namespace ct
 
 		bind();
 
+		// Multisampled textures are sampled using pixel coordinates of the (possibly lower resolution) scene
 		if(viewProps.numSamples > 1)
 			gRendererUtility().drawScreenQuad(Rect2(0.0f, 0.0f, (float)viewRect.width, (float)viewRect.height));
 		else
 			gRendererUtility().drawScreenQuad();
 	}
 
-	SSRResolveMat* SSRResolveMat::getVariation(bool msaa)
+	TemporalAAMat* TemporalAAMat::getVariation(bool msaa)
 	{
 		if (msaa)
 			return get(getVariation<true>());
@@ -33,7 +33,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("QUALITY", quality),
 				ShaderVariation::Param("MSAA", MSAA)
 			});
@@ -74,8 +74,12 @@ namespace bs { namespace ct
 	public:
 		EyeAdaptHistogramMat();
 
-		/** Executes the post-process effect with the provided parameters. */
-		void execute(const SPtr<Texture>& input, const SPtr<Texture>& output, const AutoExposureSettings& settings);
+		/** 
+		 * Executes the post-process effect with the provided parameters. Optionally a command buffer to queue the
+		 * dispatch on can be provided, in which case it is up to the caller to submit it.
+		 */
+		void execute(const SPtr<Texture>& input, const SPtr<Texture>& output, const AutoExposureSettings& settings,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/** Returns the texture descriptor that can be used for initializing the output render target. */
 		static POOLED_RENDER_TEXTURE_DESC getOutputDesc(const SPtr<Texture>& target);
@@ -161,6 +165,44 @@ namespace bs { namespace ct
 		GpuParamTexture mReducedHistogramTex;
 	};
 
+	/**
+	 * Calculates histogram based eye adaptation with a frame of latency. The luminance histogram is generated from a
+	 * downsampled copy of the previous frame's scene color, early in the frame (normally on the asynchronous compute
+	 * queue), so that only the cheap histogram reduction remains on the path leading to tonemapping.
+	 */
+	class LatentEyeAdaptation
+	{
+	public:
+		~LatentEyeAdaptation();
+
+		/**
+		 * Queues generation of the luminance histogram for the scene color stored by the last call to 
+		 * storeSceneColor(). Returns false if there was no stored scene color and nothing was queued.
+		 *
+		 * @param[in]	settings		Auto exposure settings to generate the histogram with.
+		 * @param[in]	commandBuffer	Command buffer to queue the work on. If null the work is executed on the main
+		 *								command buffer.
+		 */
+		bool queueHistogram(const AutoExposureSettings& settings, const SPtr<CommandBuffer>& commandBuffer);
+
+		/**
+		 * Reduces the histogram generated by the last call to queueHistogram() and calculates the eye adaptation value
+		 * from it. Returns the texture containing the eye adaptation value, or null if no histogram was generated.
+		 */
+		SPtr<PooledRenderTexture> resolve(const SPtr<Texture>& prevEyeAdaptation, float frameDelta, 
+			const AutoExposureSettings& settings, float exposureScale);
+
+		/** 
+		 * Stores a downsampled copy of the provided scene color, to be used for generating the histogram during the 
+		 * next frame. 
+		 */
+		void storeSceneColor(const SPtr<Texture>& sceneColor);
+
+	private:
+		SPtr<PooledRenderTexture> mSceneColor;
+		SPtr<PooledRenderTexture> mHistogram;
+	};
+
 	/** 
 	 * Shader that computes luminance of all the pixels in the provided texture, and stores them in log2 format, scaled
 	 * to [0, 1] range (according to eye adapatation parameters) and stores those values in the alpha channel of the
@@ -248,7 +290,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("VOLUME_LUT", is3D),
 			});
 
@@ -313,7 +355,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("VOLUME_LUT", volumeLUT),
 				ShaderVariation::Param("GAMMA_ONLY", gammaOnly),
 				ShaderVariation::Param("AUTO_EXPOSURE", autoExposure),
@@ -411,7 +453,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("NEAR", near),
 				ShaderVariation::Param("FAR", far)
 			});
@@ -475,7 +517,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("NEAR", near),
 				ShaderVariation::Param("FAR", far),
 			});
@@ -533,12 +575,13 @@ namespace bs { namespace ct
 		RMAT_DEF("PPBuildHiZ.bsl");
 
 		/** Helper method used for initializing variations of this material. */
-		template<bool noTextureViews>
+		template<bool noTextureViews, bool farthest>
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("NO_TEXTURE_VIEWS", noTextureViews),
+				ShaderVariation::Param("FARTHEST", farthest),
 			});
 
 			return variation;
@@ -564,8 +607,10 @@ namespace bs { namespace ct
 		 *
 		 * @param	noTextureViews		Specify as true if the current render backend doesn't support texture views, in
 		 *								which case the implementation falls back on using a simpler version of the shader.
+		 * @param	farthest			When true each texel will store the farthest depth of the texels it covers, instead
+		 *								of the closest one. Farthest depth is needed for conservative occlusion tests.
 		 */
-		static BuildHiZMat* getVariation(bool noTextureViews);
+		static BuildHiZMat* getVariation(bool noTextureViews, bool farthest = false);
 	private:
 		GpuParamTexture mInputTexture;
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
@@ -599,6 +644,74 @@ namespace bs { namespace ct
 		GpuParamTexture mInputTexture;
 	};
 
+	BS_PARAM_BLOCK_BEGIN(UpscaleParamDef)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gInvTexSize)
+		BS_PARAM_BLOCK_ENTRY(float, gSharpness)
+	BS_PARAM_BLOCK_END
+
+	extern UpscaleParamDef gUpscaleParamDef;
+
+	/** 
+	 * Shader that upscales an image rendered at a reduced resolution (see DynamicResolutionSettings) to the size of the
+	 * currently bound viewport, using bilinear filtering followed by a sharpening filter.
+	 */
+	class UpscaleMat : public RendererMaterial<UpscaleMat>
+	{
+		RMAT_DEF("PPUpscale.bsl");
+
+	public:
+		UpscaleMat();
+
+		/** 
+		 * Renders the post-process effect with the provided parameters. Output is written to the currently bound render
+		 * target and viewport.
+		 * 
+		 * @param[in]	source		Input texture to upscale.
+		 * @param[in]	sharpness	Strength of the sharpening filter, in range [0, 1].
+		 * @param[in]	flipUV		If true, vertical UV coordinate will be flipped upside down.
+		 */
+		void execute(const SPtr<Texture>& source, float sharpness, bool flipUV);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamTexture mInputTexture;
+	};
+
+	BS_PARAM_BLOCK_BEGIN(BilateralUpsampleParamDef)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gLowResSize)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gLowResPixelSize)
+	BS_PARAM_BLOCK_END
+
+	extern BilateralUpsampleParamDef gBilateralUpsampleParamDef;
+
+	/** 
+	 * Shader that upsamples an effect rendered at a reduced resolution to full resolution, using the full resolution
+	 * scene depth to avoid bleeding the effect across depth discontinuities.
+	 */
+	class BilateralUpsampleMat : public RendererMaterial<BilateralUpsampleMat>
+	{
+		RMAT_DEF("PPBilateralUpsample.bsl");
+
+	public:
+		BilateralUpsampleMat();
+
+		/** 
+		 * Renders the post-process effect with the provided parameters. 
+		 * 
+		 * @param[in]	view			Information about the view we're rendering from.
+		 * @param[in]	source			Reduced resolution input texture to upsample.
+		 * @param[in]	sceneDepth		Full resolution, non-MSAA, scene depth buffer.
+		 * @param[in]	destination		Full resolution render target to write the upsampled results to.
+		 */
+		void execute(const RendererView& view, const SPtr<Texture>& source, const SPtr<Texture>& sceneDepth, 
+			const SPtr<RenderTexture>& destination);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamTexture mInputTexture;
+		GpuParamTexture mDepthTexture;
+	};
+
 	BS_PARAM_BLOCK_BEGIN(SSAOParamDef)
 		BS_PARAM_BLOCK_ENTRY(float, gSampleRadius)
 		BS_PARAM_BLOCK_ENTRY(float, gWorldSpaceRadiusMask)
@@ -643,7 +756,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("MIX_WITH_UPSAMPLED", upsample),
 				ShaderVariation::Param("FINAL_AO", finalPass),
 				ShaderVariation::Param("QUALITY", quality)
@@ -743,7 +856,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("DIR_HORZ", horizontal)
 			});
 
@@ -789,7 +902,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("MSAA_COUNT", msaa ? 2 : 1),
 				ShaderVariation::Param("MSAA_RESOLVE_0TH", singleSampleMSAA)
 			});
@@ -844,7 +957,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("MSAA_COUNT", msaa ? 2 : 1),
 				ShaderVariation::Param("QUALITY", quality),
 				ShaderVariation::Param("MSAA_RESOLVE_0TH", singleSampleMSAA)
@@ -918,7 +1031,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("MSAA", msaa)
 			});
 
@@ -958,6 +1071,68 @@ namespace bs { namespace ct
 		GpuParamTexture mEyeAdaptationTexture;
 	};
 
+	BS_PARAM_BLOCK_BEGIN(TemporalAAParamDef)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gSceneDepthTexelSize)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gSceneColorTexelSize)
+	BS_PARAM_BLOCK_END
+
+	extern TemporalAAParamDef gTemporalAAParamDef;
+
+	/** 
+	 * Shader that performs temporal anti-aliasing by blending the current frame with the reprojected output of the
+	 * previous frame. The output can be of higher resolution than the current frame, in which case the shader also
+	 * performs temporal upsampling.
+	 */
+	class TemporalAAMat : public RendererMaterial<TemporalAAMat>
+	{
+		RMAT_DEF("PPTemporalAA.bsl");
+
+		/** Helper method used for initializing variations of this material. */
+		template<bool msaa>
+		static const ShaderVariation& getVariation()
+		{
+			static ShaderVariation variation = ShaderVariation(
+			SmallVector<ShaderVariation::Param, 4>{
+				ShaderVariation::Param("MSAA", msaa)
+			});
+
+			return variation;
+		}
+	public:
+		TemporalAAMat();
+
+		/** 
+		 * Renders the effect with the provided parameters. 
+		 * 
+		 * @param[in]	view			Information about the view we're rendering from.
+		 * @param[in]	prevFrame		Anti-aliased output of the previous frame.
+		 * @param[in]	curFrame		Color of the current frame, rendered with a jittered projection.
+		 * @param[in]	sceneDepth		Buffer containing scene depth.
+		 * @param[in]	velocity		Buffer containing per-pixel screen space velocity.
+		 * @param[in]	destination		Render target to which to write the results to.
+		 */
+		void execute(const RendererView& view, const SPtr<Texture>& prevFrame, const SPtr<Texture>& curFrame, 
+			const SPtr<Texture>& sceneDepth, const SPtr<Texture>& velocity, const SPtr<RenderTarget>& destination);
+
+		/** 
+		 * Returns the material variation matching the provided parameters. 
+		 * 
+		 * @param[in]	msaa				True if the depth and velocity buffers are multisampled. Note that previous
+		 *									and current frame color textures must be non-MSAA, regardless of this parameter.
+		 * @return							Requested variation of the material.
+		 */
+		static TemporalAAMat* getVariation(bool msaa);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		SPtr<GpuParamBlockBuffer> mTemporalParamBuffer;
+
+		GpuParamTexture mSceneColorTexture;
+		GpuParamTexture mPrevColorTexture;
+		GpuParamTexture mSceneDepthTexture;
+		GpuParamTexture mVelocityTexture;
+	};
+
 	BS_PARAM_BLOCK_BEGIN(EncodeDepthParamDef)
 		BS_PARAM_BLOCK_ENTRY(float, gNear)
 		BS_PARAM_BLOCK_ENTRY(float, gFar)
@@ -1006,7 +1181,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("MSAA_COUNT", msaa)
 			});
 
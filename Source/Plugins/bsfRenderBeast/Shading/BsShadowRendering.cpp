@@ -3,6 +3,7 @@
 #include "BsShadowRendering.h"
 #include "BsRendererView.h"
 #include "BsRendererScene.h"
+#include "BsRenderBeast.h"
 #include "Renderer/BsLight.h"
 #include "Renderer/BsRendererUtility.h"
 #include "Material/BsGpuParamsSet.h"
@@ -434,6 +435,17 @@ namespace bs { namespace ct
 		return mTargets[cascadeIdx];
 	}
 
+	/** Determines which shadow casters should ShadowRenderQueue render. */
+	enum class ShadowCasterFilter
+	{
+		/** All shadow casters. */
+		All,
+		/** Only shadow casters whose shadows can be cached. See RendererObject::hasStaticShadow(). */
+		Static,
+		/** Only shadow casters whose shadows cannot be cached, as they move or animate. */
+		Dynamic
+	};
+
 	/** 
 	 * Provides a common way for all types of shadow depth rendering to render the relevant objects into the depth map. 
 	 * Iterates over all relevant objects in the scene, binds the relevant materials and renders the objects into the depth
@@ -463,7 +475,8 @@ namespace bs { namespace ct
 		};
 
 		template<class Options>
-		static void execute(RendererScene& scene, const FrameInfo& frameInfo, const Options& opt)
+		static void execute(RendererScene& scene, const FrameInfo& frameInfo, const Options& opt,
+			ShadowCasterFilter filter = ShadowCasterFilter::All)
 		{
 			static_assert((UINT32)RenderableAnimType::Count == 4, "RenderableAnimType is expected to have four sequential entries.");
 
@@ -473,12 +486,27 @@ namespace bs { namespace ct
 			{
 				FrameVector<Command> commands[4];
 
-				// Make a list of relevant renderables and prepare them for rendering
-				for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+				// Find renderables overlapping the shadow volume
+				VisibilityMask visibility;
+				visibility.reset((UINT32)sceneInfo.renderables.size());
+
+				if(filter == ShadowCasterFilter::Static)
+					findIntersectingStaticRenderables(sceneInfo, opt.boundingVolume, (UINT64)-1, visibility);
+				else
+					findIntersectingRenderables(sceneInfo, opt.boundingVolume, (UINT64)-1, visibility);
+
+				// Make a list of relevant renderables and prepare them for rendering. Only the renderables found by the
+				// query above are visited, rather than every renderable in the scene.
+				visibility.forEachSet([&](UINT32 i)
 				{
+					if (filter != ShadowCasterFilter::All)
+					{
+						bool isStatic = sceneInfo.renderables[i]->hasStaticShadow();
+						if (isStatic != (filter == ShadowCasterFilter::Static))
+							return;
+					}
+
 					const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
-					if (!opt.intersects(bounds))
-						continue;
 
 					scene.prepareRenderable(i, frameInfo);
 
@@ -506,7 +534,7 @@ namespace bs { namespace ct
 
 						commands[arrayIdx].push_back(Command(&element));
 					}
-				}
+				});
 
 				static const ShaderVariation* VAR_LOOKUP[4];
 				VAR_LOOKUP[0] = &getVertexInputVariation<false, false>();
@@ -524,7 +552,9 @@ namespace bs { namespace ct
 						{
 							const BeastRenderableElement& element = *command.element;
 
-							if (element.morphVertexDeclaration == nullptr)
+							if (element.skinnedVertexBuffer != nullptr)
+								gRendererUtility().drawSkinned(element.mesh, element.subMesh, element.skinnedVertexBuffer);
+							else if (element.morphVertexDeclaration == nullptr)
 								gRendererUtility().draw(element.mesh, element.subMesh);
 							else
 								gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer,
@@ -552,11 +582,6 @@ namespace bs { namespace ct
 			, shadowCubeMatricesBuffer(shadowCubeMatricesBuffer), shadowCubeMasksBuffer(shadowCubeMasksBuffer)
 		{ }
 
-		bool intersects(const Sphere& bounds) const
-		{
-			return boundingVolume.intersects(bounds);
-		}
-
 		void prepare(ShadowRenderQueue::Command& command, const Sphere& bounds) const
 		{
 			for (UINT32 j = 0; j < 6; j++)
@@ -597,11 +622,6 @@ namespace bs { namespace ct
 				: boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
 		{ }
 
-		bool intersects(const Sphere& bounds) const
-		{
-			return boundingVolume.intersects(bounds);
-		}
-
 		void prepare(ShadowRenderQueue::Command& command, const Sphere& bounds) const
 		{
 		}
@@ -634,11 +654,6 @@ namespace bs { namespace ct
 			: boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
 		{ }
 
-		bool intersects(const Sphere& bounds) const
-		{
-			return boundingVolume.intersects(bounds);
-		}
-
 		void prepare(ShadowRenderQueue::Command& command, const Sphere& bounds) const
 		{
 		}
@@ -671,11 +686,6 @@ namespace bs { namespace ct
 			: boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
 		{ }
 
-		bool intersects(const Sphere& bounds) const
-		{
-			return boundingVolume.intersects(bounds);
-		}
-
 		void prepare(ShadowRenderQueue::Command& command, const Sphere& bounds) const
 		{
 		}
@@ -769,17 +779,27 @@ namespace bs { namespace ct
 		mCascadedShadowMaps.clear();
 		mDynamicShadowMaps.clear();
 		mShadowCubemaps.clear();
+		mCachedShadowMaps.clear();
+		mThrottledShadowMaps.clear();
 
 		mShadowMapSize = size;
 	}
 
+	void ShadowRendering::setShadowMapUpdateBudget(UINT32 budget)
+	{
+		mShadowMapUpdateBudget = budget;
+
+		if (mShadowMapUpdateBudget == 0)
+			mThrottledShadowMaps.clear();
+	}
+
 	void ShadowRendering::renderShadowMaps(RendererScene& scene, const RendererViewGroup& viewGroup, 
 		const FrameInfo& frameInfo)
 	{
-		// Note: Currently all shadows are dynamic and are rebuilt every frame. I should later added support for static
-		// shadow maps which can be used for immovable lights. Such a light can then maintain a set of shadow maps,
-		// one of which is static and only effects the static geometry, while the rest are per-object shadow maps used
-		// for dynamic objects. Then only a small subset of geometry needs to be redrawn, instead of everything.
+		// Note: Spot and radial lights that aren't movable keep a cached shadow map containing only the static geometry,
+		// which is re-rendered only when the light or a static caster in its range changes. Dynamic casters are then
+		// rendered on top of a copy of the cached map every frame. Directional lights still re-render everything, as their
+		// cascades follow the view.
 
 		// Note: Add support for per-object shadows and a way to force a renderable to use per-object shadows. This can be
 		// used for adding high quality shadows on specific objects (e.g. important characters during cinematics).
@@ -830,6 +850,8 @@ namespace bs { namespace ct
 			if (maxFadePercent < 0.005f)
 				continue;
 
+			options.priority = options.mapSize * maxFadePercent;
+
 			mSpotLightShadowOptions.push_back(options);
 			shadowInfoCount++; // For now, always a single fully dynamic shadow for a single light, but that may change
 		}
@@ -855,6 +877,8 @@ namespace bs { namespace ct
 			if (maxFadePercent < 0.005f)
 				continue;
 
+			options.priority = options.mapSize * maxFadePercent;
+
 			mRadialLightShadowOptions.push_back(options);
 
 			shadowInfoCount++; // For now, always a single fully dynamic shadow for a single light, but that may change
@@ -864,6 +888,10 @@ namespace bs { namespace ct
 		std::sort(mSpotLightShadowOptions.begin(), mSpotLightShadowOptions.end(),
 			[](const ShadowMapOptions& a, const ShadowMapOptions& b) { return a.mapSize > b.mapSize; } );
 
+		// Decide which maps to re-render, if limited by the budget
+		if (mShadowMapUpdateBudget > 0)
+			applyShadowMapUpdateBudget(sceneInfo);
+
 		// Reserve space for shadow infos
 		mShadowInfos.resize(shadowInfoCount);
 
@@ -894,6 +922,22 @@ namespace bs { namespace ct
 				++iter;
 		}
 
+		for(auto iter = mCachedShadowMaps.begin(); iter != mCachedShadowMaps.end();)
+		{
+			if (++iter->second.lastUsedCounter >= MAX_UNUSED_FRAMES)
+				iter = mCachedShadowMaps.erase(iter);
+			else
+				++iter;
+		}
+
+		for(auto iter = mThrottledShadowMaps.begin(); iter != mThrottledShadowMaps.end();)
+		{
+			if (++iter->second.lastUsedCounter >= MAX_UNUSED_FRAMES)
+				iter = mThrottledShadowMaps.erase(iter);
+			else
+				++iter;
+		}
+
 		// Render shadow maps
 		for (UINT32 i = 0; i < (UINT32)sceneInfo.directionalLights.size(); ++i)
 		{
@@ -1242,7 +1286,7 @@ namespace bs { namespace ct
 		shadowInfo.area = Rect2I(0, 0, mapSize, mapSize);
 		shadowInfo.updateNormArea(mapSize);
 
-		UINT32 numCascades = view.getRenderSettings().shadowSettings.numCascades;
+		UINT32 numCascades = getNumCascades(view);
 		for (UINT32 i = 0; i < (UINT32)mCascadedShadowMaps.size(); i++)
 		{
 			ShadowCascadedMap& shadowMap = mCascadedShadowMaps[i];
@@ -1348,6 +1392,25 @@ namespace bs { namespace ct
 		lightShadows.numShadows = 1;
 	}
 
+	/** 
+	 * Replaces the projection and depth parameters of @p info with the ones from @p rendered, describing a shadow map
+	 * rendered during one of the previous frames. Placement of the map and fade parameters are kept.
+	 */
+	static void restoreThrottledShadowInfo(const ShadowInfo& rendered, ShadowInfo& info)
+	{
+		info.depthNear = rendered.depthNear;
+		info.depthFar = rendered.depthFar;
+		info.depthFade = rendered.depthFade;
+		info.fadeRange = rendered.fadeRange;
+		info.depthBias = rendered.depthBias;
+		info.depthRange = rendered.depthRange;
+		info.shadowVPTransform = rendered.shadowVPTransform;
+		info.subjectBounds = rendered.subjectBounds;
+
+		for (UINT32 i = 0; i < 6; i++)
+			info.shadowVPTransforms[i] = rendered.shadowVPTransforms[i];
+	}
+
 	void ShadowRendering::renderSpotShadowMap(const RendererLight& rendererLight, const ShadowMapOptions& options,
 		RendererScene& scene, const FrameInfo& frameInfo)
 	{
@@ -1386,11 +1449,6 @@ namespace bs { namespace ct
 		mapInfo.updateNormArea(MAX_ATLAS_SIZE);
 		ShadowMapAtlas& atlas = mDynamicShadowMaps[mapInfo.textureIdx];
 
-		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(atlas.getTarget());
-		rapi.setViewport(mapInfo.normArea);
-		rapi.clearViewport(FBT_DEPTH);
-
 		mapInfo.depthNear = 0.05f;
 		mapInfo.depthFar = light->getAttenuationRadius();
 		mapInfo.depthFade = mapInfo.depthFar;
@@ -1433,7 +1491,66 @@ namespace bs { namespace ct
 			worldFrustum,
 			shadowParamsBuffer);
 
-		ShadowRenderQueue::execute(scene, frameInfo, spotOptions);
+		RenderAPI& rapi = RenderAPI::instance();
+
+		// When updates are throttled the map is rendered into a texture kept between frames, and copied into the atlas
+		ThrottledShadowMap* throttledMap = getThrottledShadowMap(rendererLight, options.mapSize, false);
+
+		SPtr<RenderTarget> target = atlas.getTarget();
+		Rect2 targetArea = mapInfo.normArea;
+		if (throttledMap)
+		{
+			target = throttledMap->texture->renderTexture;
+			targetArea = Rect2(0.0f, 0.0f, 1.0f, 1.0f);
+		}
+
+		if (options.update)
+		{
+			CachedShadowMap* cachedMap = getCachedShadowMap(rendererLight, options.mapSize, false);
+			if (cachedMap)
+			{
+				if (cachedMap->version != rendererLight.staticShadowVersion)
+				{
+					rapi.setRenderTarget(cachedMap->texture->renderTexture);
+					rapi.clearRenderTarget(FBT_DEPTH);
+
+					ShadowRenderQueue::execute(scene, frameInfo, spotOptions, ShadowCasterFilter::Static);
+					cachedMap->version = rendererLight.staticShadowVersion;
+				}
+
+				// Copy static caster depth into the target, and render dynamic casters on top
+				rapi.setRenderTarget(target);
+				rapi.setViewport(targetArea);
+
+				gRendererUtility().blit(cachedMap->texture->texture, Rect2I::EMPTY, false, true);
+				ShadowRenderQueue::execute(scene, frameInfo, spotOptions, ShadowCasterFilter::Dynamic);
+			}
+			else
+			{
+				rapi.setRenderTarget(target);
+				rapi.setViewport(targetArea);
+				rapi.clearViewport(FBT_DEPTH);
+
+				ShadowRenderQueue::execute(scene, frameInfo, spotOptions);
+			}
+
+			if (throttledMap)
+			{
+				throttledMap->info = mapInfo;
+				throttledMap->lastUpdateFrame = frameInfo.frameIdx;
+			}
+		}
+
+		if (throttledMap)
+		{
+			// Use the projection the map was rendered with, as the light might have moved since
+			restoreThrottledShadowInfo(throttledMap->info, mapInfo);
+
+			rapi.setRenderTarget(atlas.getTarget());
+			rapi.setViewport(mapInfo.normArea);
+
+			gRendererUtility().blit(throttledMap->texture->texture, Rect2I::EMPTY, false, true);
+		}
 
 		// Restore viewport
 		rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
@@ -1529,6 +1646,7 @@ namespace bs { namespace ct
 		gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
 
 		ConvexVolume frustums[6];
+		Matrix4 faceViewProj[6];
 		Vector<Plane> boundingPlanes;
 		for (UINT32 i = 0; i < 6; i++)
 		{
@@ -1569,7 +1687,7 @@ namespace bs { namespace ct
 			Matrix4 view = Matrix4(viewRotationMat.transpose()) * viewOffsetMat;
 			mapInfo.shadowVPTransforms[i] = proj * view;
 
-			Matrix4 shadowViewProj = adjustedProj * view;
+			faceViewProj[i] = adjustedProj * view;
 
 			// Calculate world frustum for culling
 			const Vector<Plane>& frustumPlanes = localFrustum.getPlanes();
@@ -1584,57 +1702,122 @@ namespace bs { namespace ct
 				j++;
 			}
 
-			ConvexVolume frustum(worldPlanes);
+			frustums[i] = ConvexVolume(worldPlanes);
+
+			// Register far plane of all frustums
+			boundingPlanes.push_back(worldPlanes.back());
+
+			if(renderAllFacesAtOnce)
+				gShadowCubeMatricesDef.gFaceVPMatrices.set(shadowCubeMatricesBuffer, faceViewProj[i], i);
+		}
+
+		ConvexVolume boundingVolume(boundingPlanes);
 
+		// Renders the shadow casters accepted by the filter into all faces of the provided cubemap
+		auto renderCasters = [&](const SPtr<Texture>& texture, const SPtr<RenderTexture>& target, 
+			ShadowCasterFilter filter, bool clear)
+		{
 			if(renderAllFacesAtOnce)
 			{
-				frustums[i] = frustum;
+				rapi.setRenderTarget(target);
+
+				if(clear)
+					rapi.clearRenderTarget(FBT_DEPTH);
+
+				ShadowRenderQueueCubeOptions cubeOptions(
+						frustums,
+						boundingVolume,
+						shadowParamsBuffer,
+						shadowCubeMatricesBuffer,
+						shadowCubeMasksBuffer
+				);
 
-				// Register far plane of all frustums
-				boundingPlanes.push_back(worldPlanes.back());
-				gShadowCubeMatricesDef.gFaceVPMatrices.set(shadowCubeMatricesBuffer, shadowViewProj, i);
+				ShadowRenderQueue::execute(scene, frameInfo, cubeOptions, filter);
 			}
 			else
 			{
-				gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, shadowViewProj);
+				for (UINT32 i = 0; i < 6; i++)
+				{
+					gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, faceViewProj[i]);
 
-				RENDER_TEXTURE_DESC rtDesc;
-				rtDesc.depthStencilSurface.texture = cubemap.getTexture();
-				rtDesc.depthStencilSurface.face = i;
-				rtDesc.depthStencilSurface.numFaces = 1;
+					RENDER_TEXTURE_DESC rtDesc;
+					rtDesc.depthStencilSurface.texture = texture;
+					rtDesc.depthStencilSurface.face = i;
+					rtDesc.depthStencilSurface.numFaces = 1;
 
-				SPtr<RenderTarget> faceRt = RenderTexture::create(rtDesc);
+					SPtr<RenderTarget> faceRt = RenderTexture::create(rtDesc);
 
-				rapi.setRenderTarget(faceRt);
-				rapi.clearRenderTarget(FBT_DEPTH);
+					rapi.setRenderTarget(faceRt);
 
-				// Render all renderables into the shadow map
-				ConvexVolume boundingVolume(boundingPlanes);
-				ShadowRenderQueueCubeSingleOptions cubeOptions(
-						frustum,
-						shadowParamsBuffer
-				);
+					if(clear)
+						rapi.clearRenderTarget(FBT_DEPTH);
 
-				ShadowRenderQueue::execute(scene, frameInfo, cubeOptions);
+					ShadowRenderQueueCubeSingleOptions cubeOptions(
+							frustums[i],
+							shadowParamsBuffer
+					);
+
+					ShadowRenderQueue::execute(scene, frameInfo, cubeOptions, filter);
+				}
 			}
+		};
+
+		// Copies all faces of one cubemap shadow map into another
+		auto copyFaces = [](const SPtr<Texture>& src, const SPtr<Texture>& dst)
+		{
+			for (UINT32 i = 0; i < 6; i++)
+			{
+				TEXTURE_COPY_DESC copyDesc;
+				copyDesc.srcFace = i;
+				copyDesc.dstFace = i;
+
+				src->copy(dst, copyDesc);
+			}
+		};
+
+		// When updates are throttled the map is rendered into a texture kept between frames, and copied into the
+		// shadow cubemap
+		ThrottledShadowMap* throttledMap = getThrottledShadowMap(rendererLight, options.mapSize, true);
+
+		SPtr<Texture> targetTex = cubemap.getTexture();
+		SPtr<RenderTexture> target = cubemap.getTarget();
+		if(throttledMap)
+		{
+			targetTex = throttledMap->texture->texture;
+			target = throttledMap->texture->renderTexture;
 		}
 
-		if(renderAllFacesAtOnce)
+		if(options.update)
 		{
-			rapi.setRenderTarget(cubemap.getTarget());
-			rapi.clearRenderTarget(FBT_DEPTH);
+			CachedShadowMap* cachedMap = getCachedShadowMap(rendererLight, options.mapSize, true);
+			if(cachedMap)
+			{
+				const SPtr<PooledRenderTexture>& cachedTex = cachedMap->texture;
+				if(cachedMap->version != rendererLight.staticShadowVersion)
+				{
+					renderCasters(cachedTex->texture, cachedTex->renderTexture, ShadowCasterFilter::Static, true);
+					cachedMap->version = rendererLight.staticShadowVersion;
+				}
 
-			// Render all renderables into the shadow map
-			ConvexVolume boundingVolume(boundingPlanes);
-			ShadowRenderQueueCubeOptions cubeOptions(
-					frustums,
-					boundingVolume,
-					shadowParamsBuffer,
-					shadowCubeMatricesBuffer,
-					shadowCubeMasksBuffer
-			);
+				// Copy static caster depth into the shadow map, and render dynamic casters on top
+				copyFaces(cachedTex->texture, targetTex);
+				renderCasters(targetTex, target, ShadowCasterFilter::Dynamic, false);
+			}
+			else
+				renderCasters(targetTex, target, ShadowCasterFilter::All, true);
 
-			ShadowRenderQueue::execute(scene, frameInfo, cubeOptions);
+			if(throttledMap)
+			{
+				throttledMap->info = mapInfo;
+				throttledMap->lastUpdateFrame = frameInfo.frameIdx;
+			}
+		}
+
+		if(throttledMap)
+		{
+			// Use the projection the map was rendered with, as the light might have moved since
+			restoreThrottledShadowInfo(throttledMap->info, mapInfo);
+			copyFaces(throttledMap->texture->texture, cubemap.getTexture());
 		}
 
 		LightShadows& lightShadows = mRadialLightShadows[options.lightIdx];
@@ -1643,6 +1826,132 @@ namespace bs { namespace ct
 		lightShadows.numShadows++;
 	}
 
+	ShadowRendering::CachedShadowMap* ShadowRendering::getCachedShadowMap(const RendererLight& light, UINT32 mapSize, 
+		bool cube)
+	{
+		// Movable lights would likely need to re-render the map every frame, so they always render all casters directly
+		if (light.internal->getMobility() == ObjectMobility::Movable)
+			return nullptr;
+
+		CachedShadowMap& cachedMap = mCachedShadowMaps[light.internal];
+		cachedMap.lastUsedCounter = 0;
+
+		if (cachedMap.texture == nullptr || cachedMap.mapSize != mapSize)
+		{
+			POOLED_RENDER_TEXTURE_DESC desc;
+			if (cube)
+				desc = POOLED_RENDER_TEXTURE_DESC::createCube(SHADOW_MAP_FORMAT, mapSize, mapSize, TU_DEPTHSTENCIL);
+			else
+				desc = POOLED_RENDER_TEXTURE_DESC::create2D(SHADOW_MAP_FORMAT, mapSize, mapSize, TU_DEPTHSTENCIL);
+
+			cachedMap.texture = GpuResourcePool::instance().get(desc);
+			cachedMap.mapSize = mapSize;
+			cachedMap.version = 0;
+		}
+
+		return &cachedMap;
+	}
+
+	ShadowRendering::ThrottledShadowMap* ShadowRendering::getThrottledShadowMap(const RendererLight& light, 
+		UINT32 mapSize, bool cube)
+	{
+		if (mShadowMapUpdateBudget == 0)
+			return nullptr;
+
+		ThrottledShadowMap& throttledMap = mThrottledShadowMaps[light.internal];
+		throttledMap.lastUsedCounter = 0;
+
+		if (throttledMap.texture == nullptr || throttledMap.mapSize != mapSize || throttledMap.cube != cube)
+		{
+			POOLED_RENDER_TEXTURE_DESC desc;
+			if (cube)
+				desc = POOLED_RENDER_TEXTURE_DESC::createCube(SHADOW_MAP_FORMAT, mapSize, mapSize, TU_DEPTHSTENCIL);
+			else
+				desc = POOLED_RENDER_TEXTURE_DESC::create2D(SHADOW_MAP_FORMAT, mapSize, mapSize, TU_DEPTHSTENCIL);
+
+			throttledMap.texture = GpuResourcePool::instance().get(desc);
+			throttledMap.mapSize = mapSize;
+			throttledMap.cube = cube;
+		}
+
+		return &throttledMap;
+	}
+
+	void ShadowRendering::applyShadowMapUpdateBudget(const SceneInfo& sceneInfo)
+	{
+		struct Candidate
+		{
+			ShadowMapOptions* options;
+			UINT64 lastUpdateFrame;
+		};
+
+		Vector<Candidate> candidates;
+		UINT32 budget = mShadowMapUpdateBudget;
+
+		auto addCandidates = [this, &candidates, &budget](Vector<ShadowMapOptions>& optionsList, 
+			const Vector<RendererLight>& lights, bool cube)
+		{
+			for (auto& entry : optionsList)
+			{
+				auto iterFind = mThrottledShadowMaps.find(lights[entry.lightIdx].internal);
+
+				// Lights without a usable map from one of the previous frames must be rendered regardless of the budget
+				bool hasMap = iterFind != mThrottledShadowMaps.end() && iterFind->second.texture != nullptr &&
+					iterFind->second.mapSize == entry.mapSize && iterFind->second.cube == cube;
+
+				if (!hasMap)
+				{
+					entry.update = true;
+					budget = budget > 0 ? budget - 1 : 0;
+					continue;
+				}
+
+				entry.update = false;
+				candidates.push_back({ &entry, iterFind->second.lastUpdateFrame });
+			}
+		};
+
+		addCandidates(mSpotLightShadowOptions, sceneInfo.spotLights, false);
+		addCandidates(mRadialLightShadowOptions, sceneInfo.radialLights, true);
+
+		if (budget == 0 || candidates.empty())
+			return;
+
+		// Most important lights are updated every frame, using up to half of the budget
+		std::sort(candidates.begin(), candidates.end(),
+			[](const Candidate& a, const Candidate& b) { return a.options->priority > b.options->priority; });
+
+		UINT32 numHighPriority = std::min(std::max(budget / 2, 1U), (UINT32)candidates.size());
+		for (UINT32 i = 0; i < numHighPriority; i++)
+			candidates[i].options->update = true;
+
+		budget -= numHighPriority;
+
+		// Remaining budget is spent on the rest of the lights, least recently updated first
+		auto lowPriorityStart = candidates.begin() + numHighPriority;
+		std::stable_sort(lowPriorityStart, candidates.end(),
+			[](const Candidate& a, const Candidate& b) { return a.lastUpdateFrame < b.lastUpdateFrame; });
+
+		UINT32 numLowPriority = std::min(budget, (UINT32)(candidates.end() - lowPriorityStart));
+		for (UINT32 i = 0; i < numLowPriority; i++)
+			(lowPriorityStart + i)->options->update = true;
+	}
+
+	UINT32 ShadowRendering::getNumCascades(const RendererView& view)
+	{
+		UINT32 numCascades = std::max(view.getRenderSettings().shadowSettings.numCascades, 1U);
+
+		// Near cascades are too small to be discernible in low resolution views (e.g. reflection probes, or secondary
+		// cameras rendering into small textures)
+		UINT32 viewHeight = view.getProperties().viewRect.height;
+		if (viewHeight <= 256)
+			numCascades = 1;
+		else if (viewHeight <= 512)
+			numCascades = std::min(numCascades, 2U);
+
+		return numCascades;
+	}
+
 	void ShadowRendering::calcShadowMapProperties(const RendererLight& light, const RendererViewGroup& viewGroup, 
 		UINT32 border, UINT32& size, SmallVector<float, 6>& fadePercents, float& maxFadePercent) const
 	{
@@ -42,7 +42,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("SKINNED", skinned),
 				ShaderVariation::Param("MORPH", morph)
 			});
@@ -78,7 +78,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-					Vector<ShaderVariation::Param>{
+					SmallVector<ShaderVariation::Param, 4>{
 							ShaderVariation::Param("SKINNED", skinned),
 							ShaderVariation::Param("MORPH", morph)
 					});
@@ -114,7 +114,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("SKINNED", skinned),
 				ShaderVariation::Param("MORPH", morph)
 			});
@@ -161,7 +161,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("SKINNED", skinned),
 				ShaderVariation::Param("MORPH", morph)
 			});
@@ -203,7 +203,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("NEEDS_TRANSFORM", !directional),
 				ShaderVariation::Param("USE_ZFAIL_STENCIL", useZFailStencil)
 			});
@@ -277,7 +277,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("SHADOW_QUALITY", quality),
 				ShaderVariation::Param("CASCADING", directional),
 				ShaderVariation::Param("NEEDS_TRANSFORM", !directional),
@@ -330,7 +330,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("SHADOW_QUALITY", quality),
 				ShaderVariation::Param("VIEWER_INSIDE_VOLUME", inside),
 				ShaderVariation::Param("NEEDS_TRANSFORM", true),
@@ -518,6 +518,15 @@ namespace bs { namespace ct
 			UINT32 lightIdx;
 			UINT32 mapSize;
 			SmallVector<float, 6> fadePercents;
+
+			/** Importance of the shadow, based on its size on screen. Used for ranking lights against the budget. */
+			float priority = 0.0f;
+
+			/** 
+			 * True if the shadow map should be re-rendered this frame. If false the shadow map rendered during one of
+			 * the previous frames is re-used. Only relevant if shadow map updates are throttled.
+			 */
+			bool update = true;
 		};
 
 		/** Contains references to all shadows cast by a specific light. */
@@ -532,6 +541,35 @@ namespace bs { namespace ct
 		{
 			SmallVector<LightShadows, 6> viewShadows;
 		};
+
+		/** Shadow map containing depth of only the static shadow casters of a single light, re-used between frames. */
+		struct CachedShadowMap
+		{
+			SPtr<PooledRenderTexture> texture;
+			UINT32 mapSize = 0;
+			UINT32 lastUsedCounter = 0;
+
+			/** RendererLight::staticShadowVersion at the time the map was rendered, or zero if it wasn't rendered yet. */
+			UINT64 version = 0;
+		};
+
+		/** 
+		 * Complete shadow map (both static and dynamic casters) of a single light, kept between frames so the light's 
+		 * shadows can be displayed on frames in which the map isn't re-rendered due to the update budget.
+		 */
+		struct ThrottledShadowMap
+		{
+			SPtr<PooledRenderTexture> texture;
+			UINT32 mapSize = 0;
+			bool cube = false;
+			UINT32 lastUsedCounter = 0;
+
+			/** Index of the frame the map was last rendered on. */
+			UINT64 lastUpdateFrame = 0;
+
+			/** Projection and depth parameters the map was rendered with. */
+			ShadowInfo info;
+		};
 	public:
 		ShadowRendering(UINT32 shadowMapSize);
 
@@ -546,6 +584,14 @@ namespace bs { namespace ct
 
 		/** Changes the default shadow map size. Will cause all shadow maps to be rebuilt. */
 		void setShadowMapSize(UINT32 size);
+
+		/**
+		 * Sets the maximum number of spot and radial light shadow maps to render each frame. When more shadowed lights
+		 * are visible, lights are ranked by their size on screen. The most important ones are updated every frame,
+		 * while the rest are updated in a round-robin fashion using the remaining budget, re-using their shadow maps
+		 * from previous frames in the meantime. Zero means no limit.
+		 */
+		void setShadowMapUpdateBudget(UINT32 budget);
 	private:
 		/** Renders cascaded shadow maps for the provided directional light viewed from the provided view. */
 		void renderCascadedShadowMaps(const RendererView& view, UINT32 lightIdx, RendererScene& scene, 
@@ -559,6 +605,40 @@ namespace bs { namespace ct
 		void renderRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene, 
 			const FrameInfo& frameInfo);
 
+		/**
+		 * Returns the cached static shadow map for the provided light, or null if the light's shadows shouldn't be
+		 * cached. A new texture is allocated if the light doesn't have one or if the shadow map size changed, in which
+		 * case the returned map will need to be re-rendered.
+		 * 
+		 * @param[in]	light		Spot or radial light to retrieve the cached shadow map for.
+		 * @param[in]	mapSize		Size of the shadow map (a single face for cubemaps), in pixels.
+		 * @param[in]	cube		True if the shadow map is a cubemap used for radial lights.
+		 */
+		CachedShadowMap* getCachedShadowMap(const RendererLight& light, UINT32 mapSize, bool cube);
+
+		/**
+		 * Returns the shadow map of the provided light kept between frames, or null if shadow map updates aren't
+		 * throttled. A new texture is allocated if the light doesn't have one or if the shadow map size changed, in
+		 * which case the map must be rendered this frame.
+		 * 
+		 * @param[in]	light		Spot or radial light to retrieve the shadow map for.
+		 * @param[in]	mapSize		Size of the shadow map (a single face for cubemaps), in pixels.
+		 * @param[in]	cube		True if the shadow map is a cubemap used for radial lights.
+		 */
+		ThrottledShadowMap* getThrottledShadowMap(const RendererLight& light, UINT32 mapSize, bool cube);
+
+		/** 
+		 * Decides which of the spot and radial light shadow maps queued for this frame will be re-rendered, according
+		 * to the update budget. 
+		 */
+		void applyShadowMapUpdateBudget(const SceneInfo& sceneInfo);
+
+		/** 
+		 * Returns the number of cascades to use for the cascaded shadow maps rendered for the provided view. Views with
+		 * low resolution use fewer cascades than requested by their settings, as they can't resolve the extra detail.
+		 */
+		static UINT32 getNumCascades(const RendererView& view);
+
 		/** 
 		 * Calculates optimal shadow map size, taking into account all views in the scene. Also calculates a fade value
 		 * that can be used for fading out small shadow maps.
@@ -664,10 +744,13 @@ namespace bs { namespace ct
 		static const float CASCADE_FRACTION_FADE;
 
 		UINT32 mShadowMapSize;
+		UINT32 mShadowMapUpdateBudget = 0;
 
 		Vector<ShadowMapAtlas> mDynamicShadowMaps;
 		Vector<ShadowCascadedMap> mCascadedShadowMaps;
 		Vector<ShadowCubemap> mShadowCubemaps;
+		UnorderedMap<const Light*, CachedShadowMap> mCachedShadowMaps;
+		UnorderedMap<const Light*, ThrottledShadowMap> mThrottledShadowMaps;
 
 		Vector<ShadowInfo> mShadowInfos;
 
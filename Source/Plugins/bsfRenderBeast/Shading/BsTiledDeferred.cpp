@@ -253,19 +253,23 @@ namespace bs { namespace ct
 		RenderAPI::instance().dispatchCompute(numTilesX, numTilesY);
 	}
 
-	TiledDeferredImageBasedLightingMat* TiledDeferredImageBasedLightingMat::getVariation(UINT32 msaaCount)
+	TiledDeferredImageBasedLightingMat* TiledDeferredImageBasedLightingMat::getVariation(UINT32 msaaCount,
+		bool compactOutput)
 	{
 		switch(msaaCount)
 		{
 		case 1:
-			return get(getVariation<1>());
+			if(compactOutput)
+				return get(getVariation<1, true>());
+
+			return get(getVariation<1, false>());
 		case 2:
-			return get(getVariation<2>());
+			return get(getVariation<2, false>());
 		case 4:
-			return get(getVariation<4>());
+			return get(getVariation<4, false>());
 		case 8:
 		default:
-			return get(getVariation<8>());
+			return get(getVariation<8, false>());
 		}
 	}
 }}
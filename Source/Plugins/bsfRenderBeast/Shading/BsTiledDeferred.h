@@ -37,7 +37,7 @@ namespace bs { namespace ct
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
+			SmallVector<ShaderVariation::Param, 4>{
 				ShaderVariation::Param("MSAA_COUNT", msaa)
 			});
 
@@ -99,12 +99,13 @@ namespace bs { namespace ct
 		RMAT_DEF_CUSTOMIZED("TiledDeferredImageBasedLighting.bsl");
 
 		/** Helper method used for initializing variations of this material. */
-		template<UINT32 msaa>
+		template<UINT32 msaa, bool compactOutput>
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
-			Vector<ShaderVariation::Param>{
-				ShaderVariation::Param("MSAA_COUNT", msaa)
+			SmallVector<ShaderVariation::Param, 4>{
+				ShaderVariation::Param("MSAA_COUNT", msaa),
+				ShaderVariation::Param("COMPACT_OUTPUT", compactOutput)
 			});
 
 			return variation;
@@ -129,8 +130,14 @@ namespace bs { namespace ct
 		void execute(const RendererView& view, const SceneInfo& sceneInfo, const VisibleReflProbeData& probeData, 
 			const Inputs& inputs);
 
-		/** Returns the material variation matching the provided parameters. */
-		static TiledDeferredImageBasedLightingMat* getVariation(UINT32 msaaCount);
+		/**
+		 * Returns the material variation matching the provided parameters.
+		 *
+		 * @param[in]	msaaCount		Number of MSAA samples used by the view.
+		 * @param[in]	compactOutput	True if the output scene color texture uses the PF_RG11B10F format, instead of
+		 *								PF_RGBA16F. Only relevant without MSAA, where scene color is written directly.
+		 */
+		static TiledDeferredImageBasedLightingMat* getVariation(UINT32 msaaCount, bool compactOutput);
 
 	private:
 		UINT32 mSampleCount;
@@ -4,11 +4,17 @@
 #include "RenderAPI/BsRenderTexture.h"
 #include "Image/BsTexture.h"
 #include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "Debug/BsDebug.h"
 
 namespace bs { namespace ct
 {
+	PooledResource::PooledResource(GpuResourcePool* pool)
+		:mPool(pool), mIsFree(false), mLastUsedFrame(0), mMemorySize(0)
+	{ }
+
 	PooledRenderTexture::PooledRenderTexture(GpuResourcePool* pool)
-		:mPool(pool), mIsFree(false)
+		:PooledResource(pool)
 	{ }
 
 	PooledRenderTexture::~PooledRenderTexture()
@@ -17,8 +23,14 @@ namespace bs { namespace ct
 			mPool->_unregisterTexture(this);
 	}
 
+	void PooledRenderTexture::evict()
+	{
+		texture = nullptr;
+		renderTexture = nullptr;
+	}
+
 	PooledStorageBuffer::PooledStorageBuffer(GpuResourcePool* pool)
-		:mPool(pool), mIsFree(false)
+		:PooledResource(pool)
 	{ }
 
 	PooledStorageBuffer::~PooledStorageBuffer()
@@ -27,6 +39,27 @@ namespace bs { namespace ct
 			mPool->_unregisterBuffer(this);
 	}
 
+	void PooledStorageBuffer::evict()
+	{
+		buffer = nullptr;
+	}
+
+	PooledVertexBuffer::PooledVertexBuffer(GpuResourcePool* pool)
+		:PooledResource(pool)
+	{ }
+
+	PooledVertexBuffer::~PooledVertexBuffer()
+	{
+		if (mPool != nullptr)
+			mPool->_unregisterVertexBuffer(this);
+	}
+
+	void PooledVertexBuffer::evict()
+	{
+		buffer = nullptr;
+		loadStore = nullptr;
+	}
+
 	GpuResourcePool::~GpuResourcePool()
 	{
 		for (auto& texture : mTextures)
@@ -34,10 +67,16 @@ namespace bs { namespace ct
 
 		for (auto& buffer : mBuffers)
 			buffer.second.lock()->mPool = nullptr;
+
+		for (auto& buffer : mVertexBuffers)
+			buffer.second.lock()->mPool = nullptr;
 	}
 
 	SPtr<PooledRenderTexture> GpuResourcePool::get(const POOLED_RENDER_TEXTURE_DESC& desc)
 	{
+		SPtr<PooledRenderTexture> bestLarger;
+		UINT64 bestLargerArea = std::numeric_limits<UINT64>::max();
+
 		for (auto& texturePair : mTextures)
 		{
 			SPtr<PooledRenderTexture> textureData = texturePair.second.lock();
@@ -50,9 +89,30 @@ namespace bs { namespace ct
 
 			if (matches(textureData->texture, desc))
 			{
-				textureData->mIsFree = false;
+				onRetrieved(*textureData, true);
 				return textureData;
 			}
+
+			// Keep looking for an exact match, but remember the smallest larger texture in case there is none
+			if (desc.allowLarger && isCompatibleLarger(textureData->texture, desc))
+			{
+				const TextureProperties& texProps = textureData->texture->getProperties();
+				UINT64 area = (UINT64)texProps.getWidth() * texProps.getHeight();
+
+				if (area < bestLargerArea)
+				{
+					bestLarger = textureData;
+					bestLargerArea = area;
+				}
+			}
+		}
+
+		if (bestLarger != nullptr)
+		{
+			onRetrieved(*bestLarger, true);
+			mStats.numReusedLarger++;
+
+			return bestLarger;
 		}
 
 		SPtr<PooledRenderTexture> newTextureData = bs_shared_ptr_new<PooledRenderTexture>(this);
@@ -97,6 +157,10 @@ namespace bs { namespace ct
 			newTextureData->renderTexture = RenderTexture::create(rtDesc);
 		}
 
+		newTextureData->mMemorySize = getMemorySize(newTextureData->texture);
+		mMemoryUsed += newTextureData->mMemorySize;
+		onRetrieved(*newTextureData, false);
+
 		return newTextureData;
 	}
 
@@ -114,7 +178,7 @@ namespace bs { namespace ct
 
 			if (matches(bufferData->buffer, desc))
 			{
-				bufferData->mIsFree = false;
+				onRetrieved(*bufferData, true);
 				return bufferData;
 			}
 		}
@@ -131,19 +195,81 @@ namespace bs { namespace ct
 
 		newBufferData->buffer = GpuBuffer::create(bufferDesc);
 
+		newBufferData->mMemorySize = newBufferData->buffer->getSize();
+		mMemoryUsed += newBufferData->mMemorySize;
+		onRetrieved(*newBufferData, false);
+
+		return newBufferData;
+	}
+
+	SPtr<PooledVertexBuffer> GpuResourcePool::get(const POOLED_VERTEX_BUFFER_DESC& desc)
+	{
+		for (auto& bufferPair : mVertexBuffers)
+		{
+			SPtr<PooledVertexBuffer> bufferData = bufferPair.second.lock();
+
+			if (!bufferData->mIsFree)
+				continue;
+
+			if (bufferData->buffer == nullptr)
+				continue;
+
+			if (matches(bufferData->buffer, desc))
+			{
+				onRetrieved(*bufferData, true);
+				return bufferData;
+			}
+		}
+
+		VERTEX_BUFFER_DESC bufferDesc;
+		bufferDesc.vertexSize = desc.vertexSize;
+		bufferDesc.numVerts = desc.numVerts;
+		bufferDesc.usage = GBU_STATIC;
+		bufferDesc.supportsLoadStore = true;
+
+		SPtr<VertexBuffer> buffer = VertexBuffer::create(bufferDesc);
+		SPtr<GpuBuffer> loadStore = buffer->getLoadStore();
+		if (loadStore == nullptr)
+			return nullptr;
+
+		SPtr<PooledVertexBuffer> newBufferData = bs_shared_ptr_new<PooledVertexBuffer>(this);
+		_registerVertexBuffer(newBufferData);
+
+		newBufferData->buffer = buffer;
+		newBufferData->loadStore = loadStore;
+
+		newBufferData->mMemorySize = buffer->getSize();
+		mMemoryUsed += newBufferData->mMemorySize;
+		onRetrieved(*newBufferData, false);
+
 		return newBufferData;
 	}
 
 	void GpuResourcePool::release(const SPtr<PooledRenderTexture>& texture)
 	{
 		auto iterFind = mTextures.find(texture.get());
-		iterFind->second.lock()->mIsFree = true;
+
+		SPtr<PooledResource> resource = iterFind->second.lock();
+		resource->mIsFree = true;
+		resource->mLastUsedFrame = mFrameIdx;
 	}
 
 	void GpuResourcePool::release(const SPtr<PooledStorageBuffer>& buffer)
 	{
 		auto iterFind = mBuffers.find(buffer.get());
-		iterFind->second.lock()->mIsFree = true;
+
+		SPtr<PooledResource> resource = iterFind->second.lock();
+		resource->mIsFree = true;
+		resource->mLastUsedFrame = mFrameIdx;
+	}
+
+	void GpuResourcePool::release(const SPtr<PooledVertexBuffer>& buffer)
+	{
+		auto iterFind = mVertexBuffers.find(buffer.get());
+
+		SPtr<PooledResource> resource = iterFind->second.lock();
+		resource->mIsFree = true;
+		resource->mLastUsedFrame = mFrameIdx;
 	}
 
 	bool GpuResourcePool::matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
@@ -170,6 +296,208 @@ namespace bs { namespace ct
 		return match;
 	}
 
+	bool GpuResourcePool::isCompatibleLarger(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
+	{
+		const TextureProperties& texProps = texture->getProperties();
+
+		if (desc.type != TEX_TYPE_2D || desc.numMipLevels != 0)
+			return false;
+
+		if (texProps.getWidth() < desc.width || texProps.getHeight() < desc.height)
+			return false;
+
+		// Don't waste too much memory on a texture much larger than needed, better to create a new one
+		float areaRatio = (texProps.getWidth() * (float)texProps.getHeight()) / (desc.width * (float)desc.height);
+		if (areaRatio > MAX_LARGER_AREA_RATIO)
+			return false;
+
+		return texProps.getTextureType() == desc.type
+			&& texProps.getFormat() == desc.format
+			&& (texProps.getUsage() & desc.flag) == desc.flag
+			&& texProps.isHardwareGammaEnabled() == desc.hwGamma
+			&& texProps.getNumSamples() == desc.numSamples
+			&& texProps.getNumArraySlices() == desc.arraySize
+			&& texProps.getNumMipmaps() == 0;
+	}
+
+	UINT64 GpuResourcePool::getMemorySize(const SPtr<Texture>& texture)
+	{
+		const TextureProperties& texProps = texture->getProperties();
+
+		UINT64 size = 0;
+		for (UINT32 mip = 0; mip <= texProps.getNumMipmaps(); mip++)
+		{
+			UINT32 width = std::max(1U, texProps.getWidth() >> mip);
+			UINT32 height = std::max(1U, texProps.getHeight() >> mip);
+			UINT32 depth = std::max(1U, texProps.getDepth() >> mip);
+
+			size += PixelUtil::getMemorySize(width, height, depth, texProps.getFormat());
+		}
+
+		return size * texProps.getNumFaces() * std::max(1U, texProps.getNumSamples());
+	}
+
+	void GpuResourcePool::onRetrieved(PooledResource& resource, bool reused)
+	{
+		resource.mIsFree = false;
+		resource.mLastUsedFrame = mFrameIdx;
+
+		mStats.numRequests++;
+		if (reused)
+			mStats.numReused++;
+		else
+			mStats.numCreated++;
+	}
+
+	void GpuResourcePool::evict(PooledResource& resource)
+	{
+		resource.evict();
+
+		mMemoryUsed -= resource.mMemorySize;
+		resource.mMemorySize = 0;
+		mStats.numEvicted++;
+	}
+
+	void GpuResourcePool::_update()
+	{
+		mFrameIdx++;
+
+		Vector<PooledResource*> freeResources;
+		const auto gatherFree = [&freeResources](auto& entries)
+		{
+			for (auto& entry : entries)
+			{
+				PooledResource* resource = entry.first;
+				if (resource->mIsFree && resource->mMemorySize > 0)
+					freeResources.push_back(resource);
+			}
+		};
+
+		gatherFree(mTextures);
+		gatherFree(mBuffers);
+		gatherFree(mVertexBuffers);
+
+		// Release resources that weren't used in a while
+		if (mMaxUnusedFrames > 0)
+		{
+			for (auto& resource : freeResources)
+			{
+				if ((mFrameIdx - resource->mLastUsedFrame) > mMaxUnusedFrames)
+					evict(*resource);
+			}
+		}
+
+		// Release least recently used resources until under budget
+		if (mMemoryBudget > 0 && mMemoryUsed > mMemoryBudget)
+		{
+			std::sort(freeResources.begin(), freeResources.end(),
+				[](const PooledResource* lhs, const PooledResource* rhs)
+			{
+				return lhs->mLastUsedFrame < rhs->mLastUsedFrame;
+			});
+
+			for (auto& resource : freeResources)
+			{
+				if (mMemoryUsed <= mMemoryBudget)
+					break;
+
+				if (resource->mMemorySize > 0)
+					evict(*resource);
+			}
+		}
+	}
+
+	GpuResourcePoolStats GpuResourcePool::getStats() const
+	{
+		GpuResourcePoolStats stats = mStats;
+		stats.memoryUsed = mMemoryUsed;
+
+		const auto gatherStats = [&stats](const auto& entries)
+		{
+			for (auto& entry : entries)
+			{
+				PooledResource* resource = entry.first;
+				if (resource->mMemorySize == 0)
+					continue;
+
+				stats.numResources++;
+
+				if (resource->mIsFree)
+				{
+					stats.numFreeResources++;
+					stats.memoryFree += resource->mMemorySize;
+				}
+			}
+		};
+
+		gatherStats(mTextures);
+		gatherStats(mBuffers);
+		gatherStats(mVertexBuffers);
+
+		return stats;
+	}
+
+	void GpuResourcePool::resetStats()
+	{
+		mStats = GpuResourcePoolStats();
+	}
+
+	void GpuResourcePool::logContents() const
+	{
+		const auto getStateString = [this](const PooledResource& resource)
+		{
+			if (!resource.mIsFree)
+				return String("in use");
+
+			return "free for " + toString(mFrameIdx - resource.mLastUsedFrame) + " frames";
+		};
+
+		StringStream output;
+		output << "GPU resource pool contents:\n";
+
+		for (auto& entry : mTextures)
+		{
+			PooledRenderTexture* resource = entry.first;
+			if (resource->texture == nullptr)
+				continue;
+
+			const TextureProperties& texProps = resource->texture->getProperties();
+			output << "  Texture " << texProps.getWidth() << "x" << texProps.getHeight() << "x" << texProps.getDepth()
+				<< ", format " << (UINT32)texProps.getFormat() << ", faces " << texProps.getNumFaces()
+				<< ", mips " << texProps.getNumMipmaps() << ", samples " << texProps.getNumSamples()
+				<< ": " << resource->mMemorySize / 1024 << " KB, " << getStateString(*resource) << "\n";
+		}
+
+		for (auto& entry : mBuffers)
+		{
+			PooledStorageBuffer* resource = entry.first;
+			if (resource->buffer == nullptr)
+				continue;
+
+			const GpuBufferProperties& props = resource->buffer->getProperties();
+			output << "  Storage buffer " << props.getElementCount() << " elements of " << props.getElementSize()
+				<< " bytes: " << resource->mMemorySize / 1024 << " KB, " << getStateString(*resource) << "\n";
+		}
+
+		for (auto& entry : mVertexBuffers)
+		{
+			PooledVertexBuffer* resource = entry.first;
+			if (resource->buffer == nullptr)
+				continue;
+
+			const VertexBufferProperties& props = resource->buffer->getProperties();
+			output << "  Vertex buffer " << props.getNumVertices() << " vertices of " << props.getVertexSize()
+				<< " bytes: " << resource->mMemorySize / 1024 << " KB, " << getStateString(*resource) << "\n";
+		}
+
+		GpuResourcePoolStats stats = getStats();
+		output << "Total: " << stats.numResources << " resources, " << stats.memoryUsed / 1024 << " KB ("
+			<< stats.memoryFree / 1024 << " KB free). Reuse rate: " << stats.getReuseRate() * 100.0f << "% of "
+			<< stats.numRequests << " requests, " << stats.numEvicted << " evicted.";
+
+		LOGDBG(output.str());
+	}
+
 	bool GpuResourcePool::matches(const SPtr<GpuBuffer>& buffer, const POOLED_STORAGE_BUFFER_DESC& desc)
 	{
 		const GpuBufferProperties& props = buffer->getProperties();
@@ -186,6 +514,13 @@ namespace bs { namespace ct
 		return match;
 	}
 
+	bool GpuResourcePool::matches(const SPtr<VertexBuffer>& buffer, const POOLED_VERTEX_BUFFER_DESC& desc)
+	{
+		const VertexBufferProperties& props = buffer->getProperties();
+
+		return props.getVertexSize() == desc.vertexSize && props.getNumVertices() == desc.numVerts;
+	}
+
 	void GpuResourcePool::_registerTexture(const SPtr<PooledRenderTexture>& texture)
 	{
 		mTextures.insert(std::make_pair(texture.get(), texture));
@@ -193,6 +528,7 @@ namespace bs { namespace ct
 
 	void GpuResourcePool::_unregisterTexture(PooledRenderTexture* texture)
 	{
+		mMemoryUsed -= texture->mMemorySize;
 		mTextures.erase(texture);
 	}
 
@@ -203,9 +539,21 @@ namespace bs { namespace ct
 
 	void GpuResourcePool::_unregisterBuffer(PooledStorageBuffer* buffer)
 	{
+		mMemoryUsed -= buffer->mMemorySize;
 		mBuffers.erase(buffer);
 	}
 
+	void GpuResourcePool::_registerVertexBuffer(const SPtr<PooledVertexBuffer>& buffer)
+	{
+		mVertexBuffers.insert(std::make_pair(buffer.get(), buffer));
+	}
+
+	void GpuResourcePool::_unregisterVertexBuffer(PooledVertexBuffer* buffer)
+	{
+		mMemoryUsed -= buffer->mMemorySize;
+		mVertexBuffers.erase(buffer);
+	}
+
 	POOLED_RENDER_TEXTURE_DESC POOLED_RENDER_TEXTURE_DESC::create2D(PixelFormat format, UINT32 width, UINT32 height,
 		INT32 usage, UINT32 samples, bool hwGamma, UINT32 arraySize, UINT32 mipCount)
 	{
@@ -281,4 +629,13 @@ namespace bs { namespace ct
 
 		return desc;
 	}
+
+	POOLED_VERTEX_BUFFER_DESC POOLED_VERTEX_BUFFER_DESC::create(UINT32 vertexSize, UINT32 numVerts)
+	{
+		POOLED_VERTEX_BUFFER_DESC desc;
+		desc.vertexSize = vertexSize;
+		desc.numVerts = numVerts;
+
+		return desc;
+	}
 }}
\ No newline at end of file
@@ -16,9 +16,31 @@ namespace bs { namespace ct
 	class GpuResourcePool;
 	struct POOLED_RENDER_TEXTURE_DESC;
 	struct POOLED_STORAGE_BUFFER_DESC;
+	struct POOLED_VERTEX_BUFFER_DESC;
+
+	/** Contains state common to all resources in the GPU resource pool. */
+	struct PooledResource
+	{
+		PooledResource(GpuResourcePool* pool);
+		virtual ~PooledResource() = default;
+
+	protected:
+		friend class GpuResourcePool;
+
+		/**
+		 * Releases the GPU resource held by the entry. The entry stays registered with the pool, but will never be
+		 * returned by GpuResourcePool::get() again.
+		 */
+		virtual void evict() = 0;
+
+		GpuResourcePool* mPool;
+		bool mIsFree;
+		UINT64 mLastUsedFrame; /**< Frame the resource was last retrieved or released on. */
+		UINT64 mMemorySize; /**< Estimated GPU memory used by the resource, in bytes. Zero if evicted. */
+	};
 
 	/**	Contains data about a single render texture in the GPU resource pool. */
-	struct PooledRenderTexture
+	struct PooledRenderTexture : PooledResource
 	{
 		PooledRenderTexture(GpuResourcePool* pool);
 		~PooledRenderTexture();
@@ -27,14 +49,12 @@ namespace bs { namespace ct
 		SPtr<RenderTexture> renderTexture;
 
 	private:
-		friend class GpuResourcePool;
-
-		GpuResourcePool* mPool;
-		bool mIsFree;
+		/** @copydoc PooledResource::evict */
+		void evict() override;
 	};
 
 	/**	Contains data about a single storage buffer in the GPU resource pool. */
-	struct PooledStorageBuffer
+	struct PooledStorageBuffer : PooledResource
 	{
 		PooledStorageBuffer(GpuResourcePool* pool);
 		~PooledStorageBuffer();
@@ -42,15 +62,49 @@ namespace bs { namespace ct
 		SPtr<GpuBuffer> buffer;
 
 	private:
-		friend class GpuResourcePool;
+		/** @copydoc PooledResource::evict */
+		void evict() override;
+	};
 
-		GpuResourcePool* mPool;
-		bool mIsFree;
+	/**	Contains data about a single vertex buffer, writable from compute shaders, in the GPU resource pool. */
+	struct PooledVertexBuffer : PooledResource
+	{
+		PooledVertexBuffer(GpuResourcePool* pool);
+		~PooledVertexBuffer();
+
+		SPtr<VertexBuffer> buffer;
+		SPtr<GpuBuffer> loadStore;
+
+	private:
+		/** @copydoc PooledResource::evict */
+		void evict() override;
+	};
+
+	/** Information about the use of the GPU resource pool. Counters accumulate until GpuResourcePool::resetStats(). */
+	struct GpuResourcePoolStats
+	{
+		UINT32 numRequests = 0; /**< Number of resources requested through GpuResourcePool::get(). */
+		UINT32 numReused = 0; /**< Number of requests served by an existing resource. */
+		UINT32 numReusedLarger = 0; /**< Number of requests served by a larger, compatible, render texture. */
+		UINT32 numCreated = 0; /**< Number of requests that required a new resource to be created. */
+		UINT32 numEvicted = 0; /**< Number of unused resources released by the pool. */
+
+		UINT32 numResources = 0; /**< Number of resources currently held by the pool, in use or not. */
+		UINT32 numFreeResources = 0; /**< Number of resources currently not in use. */
+		UINT64 memoryUsed = 0; /**< Estimated GPU memory used by all the resources held by the pool, in bytes. */
+		UINT64 memoryFree = 0; /**< Estimated GPU memory used by resources not in use, in bytes. */
+
+		/** Returns the fraction of requests that were served by existing resources, in [0, 1] range. */
+		float getReuseRate() const { return numRequests > 0 ? numReused / (float)numRequests : 0.0f; }
 	};
 
 	/** 
 	 * Contains a pool of textures and buffers meant to accommodate reuse of such resources for the main purpose of using
 	 * them as write targets on the GPU.
+	 *
+	 * Resources that aren't in use are released by _update() once they haven't been used for a number of frames, or
+	 * sooner if the memory used by the pool exceeds its budget, in which case the least recently used ones are released
+	 * first. Resources in use are never released by the pool.
 	 */
 	class GpuResourcePool : public Module<GpuResourcePool>
 	{
@@ -73,6 +127,15 @@ namespace bs { namespace ct
 		 */
 		SPtr<PooledStorageBuffer> get(const POOLED_STORAGE_BUFFER_DESC& desc);
 
+		/**
+		 * Attempts to find the unused vertex buffer with the specified parameters in the pool, or creates a new buffer
+		 * otherwise. When done with the buffer make sure to call release(const SPtr<PooledVertexBuffer>&). Returns null
+		 * if the render backend doesn't support writing to vertex buffers from compute shaders.
+		 *
+		 * @param[in]	desc		Descriptor structure that describes what kind of buffer to retrieve.
+		 */
+		SPtr<PooledVertexBuffer> get(const POOLED_VERTEX_BUFFER_DESC& desc);
+
 		/**
 		 * Releases a texture previously allocated with get(const POOLED_RENDER_TEXTURE_DESC&). The texture is returned to
 		 * the pool so that it may be reused later.
@@ -93,9 +156,38 @@ namespace bs { namespace ct
 		 */
 		void release(const SPtr<PooledStorageBuffer>& buffer);
 
+		/**
+		 * Releases a buffer previously allocated with get(const POOLED_VERTEX_BUFFER_DESC&). The buffer is returned to the
+		 * pool so that it may be reused later.
+		 */
+		void release(const SPtr<PooledVertexBuffer>& buffer);
+
+		/**
+		 * Sets the amount of GPU memory the pool should stay under, in bytes. When exceeded, resources not in use are
+		 * released, least recently used first. Resources in use are never released, so the budget may still be
+		 * exceeded. Zero means no budget.
+		 */
+		void setMemoryBudget(UINT64 bytes) { mMemoryBudget = bytes; }
+
+		/** Sets the number of frames after which a resource that isn't in use is released. Zero to never release. */
+		void setMaxUnusedFrames(UINT32 frames) { mMaxUnusedFrames = frames; }
+
+		/** Returns information about the use of the pool. */
+		GpuResourcePoolStats getStats() const;
+
+		/** Resets the request counters reported by getStats(). */
+		void resetStats();
+
+		/** Logs a list of all resources held by the pool, along with their memory use and state. */
+		void logContents() const;
+
+		/** Releases resources that weren't used recently, or that are over the memory budget. Call once per frame. */
+		void _update();
+
 	private:
 		friend struct PooledRenderTexture;
 		friend struct PooledStorageBuffer;
+		friend struct PooledVertexBuffer;
 
 		/**	Registers a newly created render texture in the pool. */
 		void _registerTexture(const SPtr<PooledRenderTexture>& texture);
@@ -109,6 +201,12 @@ namespace bs { namespace ct
 		/**	Unregisters a created storage buffer in the pool. */
 		void _unregisterBuffer(PooledStorageBuffer* buffer);
 
+		/**	Registers a newly created vertex buffer in the pool. */
+		void _registerVertexBuffer(const SPtr<PooledVertexBuffer>& buffer);
+
+		/**	Unregisters a created vertex buffer in the pool. */
+		void _unregisterVertexBuffer(PooledVertexBuffer* buffer);
+
 		/**
 		 * Checks does the provided texture match the parameters.
 		 * 
@@ -125,8 +223,44 @@ namespace bs { namespace ct
 		 */
 		static bool matches(const SPtr<GpuBuffer>& buffer, const POOLED_STORAGE_BUFFER_DESC& desc);
 
+		/**
+		 * Checks does the provided vertex buffer match the parameters.
+		 * 
+		 * @param[in]	desc	Descriptor structure that describes what kind of buffer to match.
+		 * @return				True if the buffer matches the descriptor, false otherwise.
+		 */
+		static bool matches(const SPtr<VertexBuffer>& buffer, const POOLED_VERTEX_BUFFER_DESC& desc);
+
+		/**
+		 * Checks if the provided texture can be used in place of a texture described by the parameters, even though
+		 * it is larger.
+		 */
+		static bool isCompatibleLarger(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc);
+
+		/** Returns an estimate of the GPU memory used by the texture, in bytes. */
+		static UINT64 getMemorySize(const SPtr<Texture>& texture);
+
+		/** Marks the resource as in use by a caller of get(), and updates statistics accordingly. */
+		void onRetrieved(PooledResource& resource, bool reused);
+
+		/** Releases the GPU resource of an entry not in use. */
+		void evict(PooledResource& resource);
+
+		/**
+		 * Maximum ratio between the area of a larger render texture returned for a request and the requested area.
+		 * See POOLED_RENDER_TEXTURE_DESC::setAllowLarger().
+		 */
+		static constexpr float MAX_LARGER_AREA_RATIO = 2.0f;
+
+		UINT64 mFrameIdx = 0;
+		UINT64 mMemoryBudget = 0;
+		UINT32 mMaxUnusedFrames = 120;
+		UINT64 mMemoryUsed = 0;
+		GpuResourcePoolStats mStats;
+
 		Map<PooledRenderTexture*, std::weak_ptr<PooledRenderTexture>> mTextures;
 		Map<PooledStorageBuffer*, std::weak_ptr<PooledStorageBuffer>> mBuffers;
+		Map<PooledVertexBuffer*, std::weak_ptr<PooledVertexBuffer>> mVertexBuffers;
 	};
 
 	/** Structure used for creating a new pooled render texture. */
@@ -177,6 +311,14 @@ namespace bs { namespace ct
 		static POOLED_RENDER_TEXTURE_DESC createCube(PixelFormat format, UINT32 width, UINT32 height,
 			INT32 usage = TU_STATIC, UINT32 arraySize = 1);
 
+		/**
+		 * Allows the pool to return a texture larger than the requested size, if no texture of the exact size is free.
+		 * Only supported for two dimensional textures without mipmaps. Callers must then limit rendering and sampling
+		 * to the requested area through viewports and UV scaling. Avoids creating new textures when the requested size
+		 * changes often, for example with dynamic resolution.
+		 */
+		void setAllowLarger(bool allow) { allowLarger = allow; }
+
 	private:
 		friend class GpuResourcePool;
 
@@ -190,6 +332,7 @@ namespace bs { namespace ct
 		bool hwGamma;
 		UINT32 arraySize;
 		UINT32 numMipLevels;
+		bool allowLarger = false;
 	};
 
 	/** Structure used for describing a pooled storage buffer. */
@@ -223,5 +366,26 @@ namespace bs { namespace ct
 		UINT32 elementSize;
 	};
 
+	/** Structure used for describing a pooled vertex buffer. */
+	struct POOLED_VERTEX_BUFFER_DESC
+	{
+	public:
+		POOLED_VERTEX_BUFFER_DESC() {}
+
+		/**
+		 * Creates a descriptor for a vertex buffer that can be written to from compute shaders.
+		 *
+		 * @param[in]	vertexSize	Size of a single vertex, in bytes. Must be a multiple of four.
+		 * @param[in]	numVerts	Number of vertices in the buffer.
+		 */
+		static POOLED_VERTEX_BUFFER_DESC create(UINT32 vertexSize, UINT32 numVerts);
+
+	private:
+		friend class GpuResourcePool;
+
+		UINT32 vertexSize;
+		UINT32 numVerts;
+	};
+
 	/** @} */
 }}
\ No newline at end of file
@@ -58,6 +58,7 @@ OptionInfo OPTION_LOOKUP[] =
 	{ OT_Variations, ODT_Complex },
 	{ OT_Variation, ODT_Complex },
 	{ OT_VariationValue, ODT_Int },
+	{ OT_VariationAttribute, ODT_String },
 	{ OT_Forward, ODT_Bool },
 };
 
@@ -81,6 +81,7 @@ enum tagOptionType
 	OT_Variations,
 	OT_Variation,
 	OT_VariationValue,
+	OT_VariationAttribute,
 	OT_Forward,
 	OT_Count
 };
@@ -163,6 +164,7 @@ struct tagNodeLink
 struct tagIncludeData
 {
 	char* filename;
+	char* includer;
 	char* buffer;
 };
 
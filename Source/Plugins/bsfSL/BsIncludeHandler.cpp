@@ -48,6 +48,7 @@ char* includePush(ParseState* state, const char* filename, int line, int column,
 		linkData[filenameLen] = '\0';
 
 		includeData->filename = linkData;
+		includeData->includer = state->includeStack ? state->includeStack->data->filename : nullptr;
 		includeData->buffer = output;
 
 		newLink->data = includeData;
@@ -181,16 +181,16 @@ YYID (i)
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  16
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   366
+#define YYLAST   378
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  66
+#define YYNTOKENS  68
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  61
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  125
+#define YYNRULES  126
 /* YYNRULES -- Number of states.  */
-#define YYNSTATES  335
+#define YYNSTATES  340
 /* YYMAXRHS -- Maximum number of symbols on right-hand side of rule.  */
 #define YYMAXRHS 8
 /* YYMAXLEFT -- Maximum number of symbols to the left of a handle
@@ -216,7 +216,7 @@ static const unsigned char yytranslate[] =
        2,    64,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    66,     2,    67,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,    61,     2,    62,     2,     2,     2,     2,
@@ -251,67 +251,67 @@ static const unsigned short int yyprhs[] =
       63,    66,    68,    70,    72,    74,    79,    83,    85,    87,
       93,    96,    97,    99,   103,   112,   115,   121,   123,   124,
      127,   129,   131,   133,   135,   137,   139,   145,   147,   148,
-     151,   156,   163,   170,   173,   174,   177,   180,   183,   189,
-     191,   192,   195,   200,   205,   210,   215,   220,   225,   230,
-     235,   241,   243,   244,   247,   252,   257,   262,   268,   270,
-     271,   274,   279,   284,   289,   295,   301,   307,   313,   318,
-     324,   326,   327,   330,   335,   340,   342,   351,   353,   356,
-     359,   367,   368,   371,   376,   381,   386,   391,   397,   399,
-     400,   403,   408,   413,   419,   425,   431,   437,   442,   445,
-     448,   449,   452,   458,   463,   468
+     151,   156,   163,   170,   173,   179,   180,   183,   186,   189,
+     195,   197,   198,   201,   206,   211,   216,   221,   226,   231,
+     236,   241,   247,   249,   250,   253,   258,   263,   268,   274,
+     276,   277,   280,   285,   290,   295,   301,   307,   313,   319,
+     324,   330,   332,   333,   336,   341,   346,   348,   357,   359,
+     362,   365,   373,   374,   377,   382,   387,   392,   397,   403,
+     405,   406,   409,   414,   419,   425,   431,   437,   443,   448,
+     451,   454,   455,   458,   464,   469,   474
 };
 
 /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const signed char yyrhs[] =
+static const short int yyrhs[] =
 {
-      67,     0,    -1,    -1,    68,    67,    -1,    69,    -1,    73,
-      -1,    81,    -1,    70,    61,    71,    62,    63,    -1,    14,
-      -1,    -1,    72,    71,    -1,    18,    64,     5,    63,    -1,
+      69,     0,    -1,    -1,    70,    69,    -1,    71,    -1,    75,
+      -1,    83,    -1,    72,    61,    73,    62,    63,    -1,    14,
+      -1,    -1,    74,    73,    -1,    18,    64,     5,    63,    -1,
       19,    64,     9,    63,    -1,    20,    64,     3,    63,    -1,
       21,    64,     5,    63,    -1,    22,    64,     5,    63,    -1,
-      74,    61,    75,    62,    63,    -1,    15,     7,    -1,    17,
-       7,    -1,    -1,    76,    75,    -1,    77,    -1,    83,    -1,
-      87,    -1,   111,    -1,    23,    64,     7,    63,    -1,    17,
-       7,    63,    -1,    78,    -1,    88,    -1,    79,    61,    80,
+      76,    61,    77,    62,    63,    -1,    15,     7,    -1,    17,
+       7,    -1,    -1,    78,    77,    -1,    79,    -1,    85,    -1,
+      89,    -1,   113,    -1,    23,    64,     7,    63,    -1,    17,
+       7,    63,    -1,    80,    -1,    90,    -1,    81,    61,    82,
       62,    63,    -1,    25,    64,    -1,    -1,     6,    -1,     6,
-      65,    80,    -1,    82,    61,    55,    64,     3,    63,    62,
-      63,    -1,    16,     7,    -1,    84,    61,    85,    62,    63,
-      -1,    24,    -1,    -1,    86,    85,    -1,    87,    -1,   111,
-      -1,    95,    -1,    99,    -1,   103,    -1,   107,    -1,    89,
-      61,    90,    62,    63,    -1,    26,    -1,    -1,    91,    90,
-      -1,    92,    61,    62,    63,    -1,    92,    61,     5,    93,
-      62,    63,    -1,    92,    61,     3,    93,    62,    63,    -1,
-       7,    64,    -1,    -1,    94,    93,    -1,    65,     5,    -1,
-      65,     3,    -1,    96,    61,    97,    62,    63,    -1,    29,
-      -1,    -1,    98,    97,    -1,    33,    64,     8,    63,    -1,
-      34,    64,     9,    63,    -1,    38,    64,     5,    63,    -1,
-      39,    64,     5,    63,    -1,    40,    64,     5,    63,    -1,
-      35,    64,     4,    63,    -1,    36,    64,     4,    63,    -1,
-      37,    64,     5,    63,    -1,   100,    61,   101,    62,    63,
-      -1,    30,    -1,    -1,   102,   101,    -1,    41,    64,     5,
-      63,    -1,    42,    64,     5,    63,    -1,    43,    64,    10,
-      63,    -1,   104,    61,   105,    62,    63,    -1,    31,    -1,
-      -1,   106,   105,    -1,    45,    64,     5,    63,    -1,    46,
-      64,     3,    63,    -1,    47,    64,     3,    63,    -1,   113,
-      61,   116,    62,    63,    -1,   114,    61,   116,    62,    63,
-      -1,   113,    61,   115,    62,    63,    -1,   114,    61,   115,
-      62,    63,    -1,    44,    64,     3,    63,    -1,   108,    61,
-     109,    62,    63,    -1,    28,    -1,    -1,   110,   109,    -1,
-      52,    64,     5,    63,    -1,    53,    64,     5,    63,    -1,
-     118,    -1,   112,    61,    55,    64,     3,    63,    62,    63,
-      -1,    27,    -1,    48,    64,    -1,    49,    64,    -1,    11,
-      65,    11,    65,    11,    65,    10,    -1,    -1,   117,   116,
-      -1,    50,    64,    11,    63,    -1,    51,    64,    11,    63,
-      -1,    24,    64,    11,    63,    -1,    43,    64,    10,    63,
-      -1,   119,    61,   120,    62,    63,    -1,    54,    -1,    -1,
-     121,   120,    -1,    55,    64,     3,    63,    -1,    45,    64,
-       5,    63,    -1,   122,    61,   124,    62,    63,    -1,   123,
-      61,   124,    62,    63,    -1,   122,    61,   125,    62,    63,
-      -1,   123,    61,   125,    62,    63,    -1,    47,    64,    13,
-      63,    -1,    56,    64,    -1,    57,    64,    -1,    -1,   126,
-     124,    -1,    11,    65,    11,    65,    12,    -1,    58,    64,
-      11,    63,    -1,    59,    64,    11,    63,    -1,    60,    64,
-      12,    63,    -1
+      65,    82,    -1,    84,    61,    55,    64,     3,    63,    62,
+      63,    -1,    16,     7,    -1,    86,    61,    87,    62,    63,
+      -1,    24,    -1,    -1,    88,    87,    -1,    89,    -1,   113,
+      -1,    97,    -1,   101,    -1,   105,    -1,   109,    -1,    91,
+      61,    92,    62,    63,    -1,    26,    -1,    -1,    93,    92,
+      -1,    94,    61,    62,    63,    -1,    94,    61,     5,    95,
+      62,    63,    -1,    94,    61,     3,    95,    62,    63,    -1,
+       7,    64,    -1,    66,     7,    67,     7,    64,    -1,    -1,
+      96,    95,    -1,    65,     5,    -1,    65,     3,    -1,    98,
+      61,    99,    62,    63,    -1,    29,    -1,    -1,   100,    99,
+      -1,    33,    64,     8,    63,    -1,    34,    64,     9,    63,
+      -1,    38,    64,     5,    63,    -1,    39,    64,     5,    63,
+      -1,    40,    64,     5,    63,    -1,    35,    64,     4,    63,
+      -1,    36,    64,     4,    63,    -1,    37,    64,     5,    63,
+      -1,   102,    61,   103,    62,    63,    -1,    30,    -1,    -1,
+     104,   103,    -1,    41,    64,     5,    63,    -1,    42,    64,
+       5,    63,    -1,    43,    64,    10,    63,    -1,   106,    61,
+     107,    62,    63,    -1,    31,    -1,    -1,   108,   107,    -1,
+      45,    64,     5,    63,    -1,    46,    64,     3,    63,    -1,
+      47,    64,     3,    63,    -1,   115,    61,   118,    62,    63,
+      -1,   116,    61,   118,    62,    63,    -1,   115,    61,   117,
+      62,    63,    -1,   116,    61,   117,    62,    63,    -1,    44,
+      64,     3,    63,    -1,   110,    61,   111,    62,    63,    -1,
+      28,    -1,    -1,   112,   111,    -1,    52,    64,     5,    63,
+      -1,    53,    64,     5,    63,    -1,   120,    -1,   114,    61,
+      55,    64,     3,    63,    62,    63,    -1,    27,    -1,    48,
+      64,    -1,    49,    64,    -1,    11,    65,    11,    65,    11,
+      65,    10,    -1,    -1,   119,   118,    -1,    50,    64,    11,
+      63,    -1,    51,    64,    11,    63,    -1,    24,    64,    11,
+      63,    -1,    43,    64,    10,    63,    -1,   121,    61,   122,
+      62,    63,    -1,    54,    -1,    -1,   123,   122,    -1,    55,
+      64,     3,    63,    -1,    45,    64,     5,    63,    -1,   124,
+      61,   126,    62,    63,    -1,   125,    61,   126,    62,    63,
+      -1,   124,    61,   127,    62,    63,    -1,   125,    61,   127,
+      62,    63,    -1,    47,    64,    13,    63,    -1,    56,    64,
+      -1,    57,    64,    -1,    -1,   128,   126,    -1,    11,    65,
+      11,    65,    12,    -1,    58,    64,    11,    63,    -1,    59,
+      64,    11,    63,    -1,    60,    64,    12,    63,    -1
 };
 
 /* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
@@ -322,14 +322,14 @@ static const unsigned short int yyrline[] =
      241,   245,   246,   247,   248,   252,   253,   254,   255,   260,
      264,   271,   273,   278,   288,   302,   315,   319,   326,   328,
      332,   333,   337,   338,   339,   340,   346,   350,   357,   359,
-     363,   364,   372,   383,   393,   395,   399,   400,   405,   409,
-     416,   418,   422,   423,   424,   425,   426,   427,   428,   429,
-     434,   438,   445,   447,   451,   452,   453,   458,   462,   469,
-     471,   475,   476,   477,   478,   479,   480,   481,   482,   487,
-     491,   498,   500,   504,   505,   506,   512,   526,   536,   544,
-     552,   566,   568,   572,   573,   574,   575,   580,   584,   591,
-     593,   597,   598,   599,   600,   601,   602,   603,   608,   616,
-     623,   625,   629,   642,   643,   644
+     363,   364,   372,   383,   391,   404,   406,   410,   411,   416,
+     420,   427,   429,   433,   434,   435,   436,   437,   438,   439,
+     440,   445,   449,   456,   458,   462,   463,   464,   469,   473,
+     480,   482,   486,   487,   488,   489,   490,   491,   492,   493,
+     498,   502,   509,   511,   515,   516,   517,   523,   537,   547,
+     555,   563,   577,   579,   583,   584,   585,   586,   591,   595,
+     602,   604,   608,   609,   610,   611,   612,   613,   614,   619,
+     627,   634,   636,   640,   653,   654,   655
 };
 #endif
 
@@ -355,11 +355,11 @@ static const char *const yytname[] =
   "TOKEN_ZFAIL", "TOKEN_ALPHATOCOVERAGE", "TOKEN_INDEPENDANTBLEND",
   "TOKEN_TARGET", "TOKEN_INDEX", "TOKEN_COLOR", "TOKEN_ALPHA",
   "TOKEN_SOURCE", "TOKEN_DEST", "TOKEN_OP", "'{'", "'}'", "';'", "'='",
-  "','", "$accept", "root", "root_statement", "options", "options_header",
-  "options_body", "options_option", "shader", "shader_header",
-  "shader_body", "shader_statement", "shader_option", "tags",
-  "tags_header", "tags_body", "subshader", "subshader_header", "pass",
-  "pass_header", "pass_body", "pass_statement", "pass_option",
+  "','", "'['", "']'", "$accept", "root", "root_statement", "options",
+  "options_header", "options_body", "options_option", "shader",
+  "shader_header", "shader_body", "shader_statement", "shader_option",
+  "tags", "tags_header", "tags_body", "subshader", "subshader_header",
+  "pass", "pass_header", "pass_body", "pass_statement", "pass_option",
   "variations", "variations_header", "variations_body", "variation",
   "variation_header", "variation_body", "variation_option", "raster",
   "raster_header", "raster_body", "raster_option", "depth", "depth_header",
@@ -376,19 +376,19 @@ static const char *const yytname[] =
 /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const unsigned char yyr1[] =
 {
-       0,    66,    67,    67,    68,    68,    68,    69,    70,    71,
-      71,    72,    72,    72,    72,    72,    73,    74,    74,    75,
-      75,    76,    76,    76,    76,    77,    77,    77,    77,    78,
-      79,    80,    80,    80,    81,    82,    83,    84,    85,    85,
-      86,    86,    87,    87,    87,    87,    88,    89,    90,    90,
-      91,    91,    91,    92,    93,    93,    94,    94,    95,    96,
-      97,    97,    98,    98,    98,    98,    98,    98,    98,    98,
-      99,   100,   101,   101,   102,   102,   102,   103,   104,   105,
-     105,   106,   106,   106,   106,   106,   106,   106,   106,   107,
-     108,   109,   109,   110,   110,   110,   111,   112,   113,   114,
-     115,   116,   116,   117,   117,   117,   117,   118,   119,   120,
-     120,   121,   121,   121,   121,   121,   121,   121,   122,   123,
-     124,   124,   125,   126,   126,   126
+       0,    68,    69,    69,    70,    70,    70,    71,    72,    73,
+      73,    74,    74,    74,    74,    74,    75,    76,    76,    77,
+      77,    78,    78,    78,    78,    79,    79,    79,    79,    80,
+      81,    82,    82,    82,    83,    84,    85,    86,    87,    87,
+      88,    88,    89,    89,    89,    89,    90,    91,    92,    92,
+      93,    93,    93,    94,    94,    95,    95,    96,    96,    97,
+      98,    99,    99,   100,   100,   100,   100,   100,   100,   100,
+     100,   101,   102,   103,   103,   104,   104,   104,   105,   106,
+     107,   107,   108,   108,   108,   108,   108,   108,   108,   108,
+     109,   110,   111,   111,   112,   112,   112,   113,   114,   115,
+     116,   117,   118,   118,   119,   119,   119,   119,   120,   121,
+     122,   122,   123,   123,   123,   123,   123,   123,   123,   124,
+     125,   126,   126,   127,   128,   128,   128
 };
 
 /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
@@ -399,14 +399,14 @@ static const unsigned char yyr2[] =
        2,     1,     1,     1,     1,     4,     3,     1,     1,     5,
        2,     0,     1,     3,     8,     2,     5,     1,     0,     2,
        1,     1,     1,     1,     1,     1,     5,     1,     0,     2,
-       4,     6,     6,     2,     0,     2,     2,     2,     5,     1,
-       0,     2,     4,     4,     4,     4,     4,     4,     4,     4,
-       5,     1,     0,     2,     4,     4,     4,     5,     1,     0,
-       2,     4,     4,     4,     5,     5,     5,     5,     4,     5,
-       1,     0,     2,     4,     4,     1,     8,     1,     2,     2,
-       7,     0,     2,     4,     4,     4,     4,     5,     1,     0,
-       2,     4,     4,     5,     5,     5,     5,     4,     2,     2,
-       0,     2,     5,     4,     4,     4
+       4,     6,     6,     2,     5,     0,     2,     2,     2,     5,
+       1,     0,     2,     4,     4,     4,     4,     4,     4,     4,
+       4,     5,     1,     0,     2,     4,     4,     4,     5,     1,
+       0,     2,     4,     4,     4,     5,     5,     5,     5,     4,
+       5,     1,     0,     2,     4,     4,     1,     8,     1,     2,
+       2,     7,     0,     2,     4,     4,     4,     4,     5,     1,
+       0,     2,     4,     4,     5,     5,     5,     5,     4,     2,
+       2,     0,     2,     5,     4,     4,     4
 };
 
 /* YYDPREC[RULE-NUM] -- Dynamic precedence of rule #RULE-NUM (0 if none).  */
@@ -424,7 +424,7 @@ static const unsigned char yydprec[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0
+       0,     0,     0,     0,     0,     0,     0
 };
 
 /* YYMERGER[RULE-NUM] -- Index of merging function for rule #RULE-NUM.  */
@@ -442,7 +442,7 @@ static const unsigned char yymerger[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0
+       0,     0,     0,     0,     0,     0,     0
 };
 
 /* YYDEFACT[S] -- default reduction number in state S.  Performed when
@@ -453,37 +453,37 @@ static const unsigned char yydefact[] =
        2,     8,     0,     0,     0,     0,     2,     4,     0,     5,
        0,     6,     0,    17,    35,    18,     1,     3,     9,    19,
        0,     0,     0,     0,     0,     0,     0,     9,     0,     0,
-      37,     0,    47,    97,    90,    59,    71,    78,     0,    19,
+      37,     0,    47,    98,    91,    60,    72,    79,     0,    19,
       21,    27,     0,    22,     0,    23,    28,     0,    42,     0,
       43,     0,    44,     0,    45,     0,    24,     0,     0,     0,
        0,     0,     0,     0,     0,    10,     0,     0,    30,     0,
-      20,    31,    38,    48,    60,    72,    79,    91,     0,     0,
+      20,    31,    38,    48,    61,    73,    80,    92,     0,     0,
        0,     0,     0,     0,     0,     7,    26,     0,    16,    32,
-       0,     0,    38,    40,    41,     0,     0,    48,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    60,     0,
-       0,     0,     0,    72,     0,     0,     0,     0,     0,     0,
-       0,    79,     0,     0,     0,     0,   108,     0,    91,    95,
-       0,     0,     0,    11,    12,    13,    14,    15,    25,    31,
-       0,     0,    39,    53,     0,    49,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    61,     0,     0,     0,
-       0,    73,     0,     0,     0,     0,    98,    99,     0,    80,
-     101,   101,     0,     0,     0,    92,   109,     0,     0,    33,
-      29,    36,    46,    54,    54,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    58,     0,     0,     0,    70,     0,
-       0,     0,     0,    77,     0,     0,     0,     0,     0,     0,
-       0,   101,     0,     0,     0,     0,    89,     0,     0,     0,
-       0,     0,     0,   109,     0,     0,     0,     0,     0,     0,
-      54,     0,    50,    62,    63,    67,    68,    69,    64,    65,
-      66,    74,    75,    76,    88,    81,    82,    83,     0,     0,
-       0,     0,     0,     0,     0,   102,     0,     0,    93,    94,
-       0,     0,     0,   118,   119,     0,   110,   120,   120,     0,
-      34,    57,    56,     0,    55,     0,     0,     0,     0,     0,
-       0,    86,    84,    87,    85,     0,     0,     0,   107,     0,
-       0,     0,     0,     0,     0,   120,     0,     0,     0,    52,
-      51,     0,   105,   106,   103,   104,   112,   117,   111,     0,
-       0,     0,     0,     0,     0,   121,     0,     0,    96,     0,
-       0,     0,     0,     0,   113,   115,   114,   116,     0,     0,
-     123,   124,   125,   100,   122
+       0,     0,    38,    40,    41,     0,     0,     0,    48,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    61,
+       0,     0,     0,     0,    73,     0,     0,     0,     0,     0,
+       0,     0,    80,     0,     0,     0,     0,   109,     0,    92,
+      96,     0,     0,     0,    11,    12,    13,    14,    15,    25,
+      31,     0,     0,    39,    53,     0,     0,    49,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    62,     0,
+       0,     0,     0,    74,     0,     0,     0,     0,    99,   100,
+       0,    81,   102,   102,     0,     0,     0,    93,   110,     0,
+       0,    33,    29,    36,     0,    46,    55,    55,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    59,     0,     0,
+       0,    71,     0,     0,     0,     0,    78,     0,     0,     0,
+       0,     0,     0,     0,   102,     0,     0,     0,     0,    90,
+       0,     0,     0,     0,     0,     0,   110,     0,     0,     0,
+       0,     0,     0,     0,    55,     0,    50,    63,    64,    68,
+      69,    70,    65,    66,    67,    75,    76,    77,    89,    82,
+      83,    84,     0,     0,     0,     0,     0,     0,     0,   103,
+       0,     0,    94,    95,     0,     0,     0,   119,   120,     0,
+     111,   121,   121,     0,    34,    54,    58,    57,     0,    56,
+       0,     0,     0,     0,     0,     0,    87,    85,    88,    86,
+       0,     0,     0,   108,     0,     0,     0,     0,     0,     0,
+     121,     0,     0,     0,    52,    51,     0,   106,   107,   104,
+     105,   113,   118,   112,     0,     0,     0,     0,     0,     0,
+     122,     0,     0,    97,     0,     0,     0,     0,     0,   114,
+     116,   115,   117,     0,     0,   124,   125,   126,   101,   123
 };
 
 /* YYPDEFGOTO[NTERM-NUM].  */
@@ -491,64 +491,64 @@ static const short int yydefgoto[] =
 {
       -1,     5,     6,     7,     8,    26,    27,     9,    10,    38,
       39,    40,    41,    42,    90,    11,    12,    43,    44,    91,
-      92,    45,    46,    47,    96,    97,    98,   229,   230,    48,
-      49,   107,   108,    50,    51,   112,   113,    52,    53,   120,
-     121,    54,    55,   127,   128,    56,    57,   122,   123,   209,
-     210,   211,   129,   130,   222,   223,   224,   225,   293,   294,
-     295
+      92,    45,    46,    47,    97,    98,    99,   233,   234,    48,
+      49,   108,   109,    50,    51,   113,   114,    52,    53,   121,
+     122,    54,    55,   128,   129,    56,    57,   123,   124,   212,
+     213,   214,   130,   131,   225,   226,   227,   228,   298,   299,
+     300
 };
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -262
+#define YYPACT_NINF -268
 static const short int yypact[] =
 {
-      41,  -262,     4,    16,    20,    30,    41,  -262,   -30,  -262,
-     -20,  -262,    -9,  -262,  -262,  -262,  -262,  -262,    18,    37,
-      -2,    24,    25,    26,    27,    28,    31,    18,    87,    32,
-    -262,    34,  -262,  -262,  -262,  -262,  -262,  -262,    35,    37,
-    -262,  -262,    38,  -262,    39,  -262,  -262,    40,  -262,    42,
-    -262,    43,  -262,    44,  -262,    45,  -262,    46,    47,    90,
-      93,   105,   104,   107,    50,  -262,    51,   103,  -262,    52,
-    -262,   110,    56,   111,    36,   -28,    33,    -7,    62,   116,
-      57,    58,    59,    60,    61,  -262,  -262,    63,  -262,    64,
-      65,    66,    56,  -262,  -262,    67,    68,   111,    71,    69,
-      70,    72,    73,    74,    75,    76,    77,    80,    36,    79,
-      81,    82,    85,   -28,    84,    86,    88,    89,    91,    92,
-      95,    33,    83,    97,    96,    98,  -262,    99,    -7,  -262,
-     102,   100,   106,  -262,  -262,  -262,  -262,  -262,  -262,   110,
-     108,   109,  -262,  -262,   112,  -262,    -3,   117,   126,   145,
-     147,   149,   154,   160,   161,   113,  -262,   162,   163,   164,
-     114,  -262,   167,   168,   175,   176,  -262,  -262,   118,  -262,
-      -8,    -8,   177,   178,   121,  -262,   -35,   182,   124,  -262,
-    -262,  -262,  -262,   115,   115,   125,   127,   128,   129,   130,
-     131,   132,   133,   134,  -262,   135,   136,   137,  -262,   138,
-     139,   140,   141,  -262,   122,   142,   143,   144,   146,   150,
-     151,   -18,   152,   153,   148,   155,  -262,   156,   157,   158,
-     159,   165,   166,   -35,   169,   170,   171,   172,    21,   174,
-     115,   179,  -262,  -262,  -262,  -262,  -262,  -262,  -262,  -262,
-    -262,  -262,  -262,  -262,  -262,  -262,  -262,  -262,   194,   198,
-     206,   208,   213,   180,   181,  -262,   183,   184,  -262,  -262,
-     212,   214,   186,  -262,  -262,   185,  -262,   -10,   -10,   187,
-    -262,  -262,  -262,   188,  -262,   189,   173,   190,   191,   192,
-     193,  -262,  -262,  -262,  -262,   195,   196,   197,  -262,   199,
-     201,   202,   203,   200,   207,   -41,   209,   210,   205,  -262,
-    -262,   215,  -262,  -262,  -262,  -262,  -262,  -262,  -262,   221,
-     222,   226,   227,   211,   216,  -262,   217,   218,  -262,   219,
-     220,   223,   224,   225,  -262,  -262,  -262,  -262,   230,   233,
-    -262,  -262,  -262,  -262,  -262
+      69,  -268,     5,    21,    24,    32,    69,  -268,   -13,  -268,
+     -12,  -268,    -7,  -268,  -268,  -268,  -268,  -268,    22,    38,
+      33,    26,    27,    28,    29,    30,    34,    22,    88,    35,
+    -268,    36,  -268,  -268,  -268,  -268,  -268,  -268,    39,    38,
+    -268,  -268,    41,  -268,    42,  -268,  -268,    43,  -268,    44,
+    -268,    45,  -268,    46,  -268,    47,  -268,    48,    49,    92,
+      89,   107,   106,   109,    52,  -268,    53,   105,  -268,    54,
+    -268,   112,    51,    -6,    37,   -17,   -30,     4,    64,   117,
+      58,    59,    60,    61,    62,  -268,  -268,    63,  -268,    65,
+      66,    67,    51,  -268,  -268,    68,   120,    71,    -6,    70,
+      72,    73,    74,    75,    76,    77,    78,    79,    82,    37,
+      81,    83,    85,    86,   -17,    87,    90,    91,    93,    94,
+      95,    98,   -30,   100,   101,    99,   102,  -268,   103,     4,
+    -268,   108,   104,   110,  -268,  -268,  -268,  -268,  -268,  -268,
+     112,   111,   113,  -268,  -268,    97,   114,  -268,    -3,   126,
+     137,   131,   146,   147,   148,   151,   162,   115,  -268,   165,
+     166,   169,   118,  -268,   172,   167,   177,   179,  -268,  -268,
+     121,  -268,    -4,    -4,   178,   180,   123,  -268,   -34,   184,
+     127,  -268,  -268,  -268,   181,  -268,   125,   125,   128,   129,
+     130,   132,   133,   134,   135,   136,   138,  -268,   139,   140,
+     141,  -268,   142,   143,   144,   145,  -268,   149,   152,   153,
+     154,   155,   150,   158,   -16,   159,   160,   161,   163,  -268,
+     164,   168,   170,   171,   173,   174,   -34,   182,   183,   175,
+     176,   185,    84,   186,   125,   188,  -268,  -268,  -268,  -268,
+    -268,  -268,  -268,  -268,  -268,  -268,  -268,  -268,  -268,  -268,
+    -268,  -268,   189,   198,   200,   202,   204,   190,   191,  -268,
+     192,   193,  -268,  -268,   206,   210,   222,  -268,  -268,   194,
+    -268,    -8,    -8,   196,  -268,  -268,  -268,  -268,   197,  -268,
+     199,   187,   201,   203,   205,   207,  -268,  -268,  -268,  -268,
+     208,   209,   211,  -268,   212,   195,   214,   215,   213,   218,
+     -22,   219,   220,   221,  -268,  -268,   216,  -268,  -268,  -268,
+    -268,  -268,  -268,  -268,   229,   230,   231,   217,   223,   224,
+    -268,   225,   226,  -268,   227,   228,   232,   233,   234,  -268,
+    -268,  -268,  -268,   235,   239,  -268,  -268,  -268,  -268,  -268
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const short int yypgoto[] =
 {
-    -262,   236,  -262,  -262,  -262,   234,  -262,  -262,  -262,   231,
-    -262,  -262,  -262,  -262,   204,  -262,  -262,  -262,  -262,   228,
-    -262,   -64,  -262,  -262,   229,  -262,  -262,  -179,  -262,  -262,
-    -262,   232,  -262,  -262,  -262,   235,  -262,  -262,  -262,   237,
-    -262,  -262,  -262,   238,  -262,   -63,  -262,  -262,  -262,    54,
-    -167,  -262,  -262,  -262,    53,  -262,  -262,  -262,  -261,   -11,
-    -262
+    -268,   240,  -268,  -268,  -268,   236,  -268,  -268,  -268,   237,
+    -268,  -268,  -268,  -268,   238,  -268,  -268,  -268,  -268,   241,
+    -268,   -63,  -268,  -268,    96,  -268,  -268,  -181,  -268,  -268,
+    -268,   122,  -268,  -268,  -268,   116,  -268,  -268,  -268,   242,
+    -268,  -268,  -268,   156,  -268,   -62,  -268,  -268,  -268,   157,
+    -169,  -268,  -268,  -268,     7,  -268,  -268,  -268,  -267,   -25,
+    -268
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
@@ -557,43 +557,44 @@ static const short int yypgoto[] =
 #define YYTABLE_NINF -1
 static const unsigned short int yytable[] =
 {
-     183,   289,   184,   204,   213,   231,   205,   296,    93,    94,
-     217,    13,   218,   109,   110,   111,   205,   290,   291,   292,
-     219,   220,   221,    14,   271,   206,   272,    15,    93,    94,
-      16,    18,   207,   208,   315,   206,    21,    22,    23,    24,
-      25,    19,   207,   208,   255,   124,   125,   126,   290,   291,
-     292,   274,    20,    58,    28,     1,     2,     3,     4,   185,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    99,
-     100,   101,   102,   103,   104,   105,   106,   114,   115,   116,
-     117,   118,   119,    33,    34,    35,    36,    37,    59,    60,
-      61,    62,    63,    64,    66,    80,    67,    69,    68,    71,
-      72,    73,    81,    74,    75,    76,    77,    78,    82,    83,
-      87,    79,    84,    85,    86,    88,    89,   131,    95,   132,
-     133,   134,   135,   136,   137,   186,   138,   140,   141,   139,
-     144,   143,   146,   147,   148,   187,   149,   150,   151,   152,
-     153,   154,   155,   157,   170,   158,   159,   160,   162,   188,
-     163,   189,   164,   165,   190,   166,   167,   168,   171,   191,
-     172,   174,   173,   176,   177,   192,   193,   195,   196,   178,
-     199,   180,   181,   200,   197,   182,   194,   198,   201,   202,
-     228,   203,   214,   215,   216,   226,   227,   248,   232,   287,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   276,   249,   250,   251,   277,
-     252,   258,   253,   254,   256,   257,   278,   285,   259,   279,
-     260,   261,   262,   263,   280,   212,   319,   286,   265,   264,
-     267,   268,   320,   321,   269,   270,   273,   322,   301,   323,
-     333,   275,    17,   281,   282,   334,   283,   284,   288,   298,
-       0,   299,   300,   302,   303,   304,   305,   297,   306,   307,
-     308,    65,   313,     0,   309,   310,   311,   312,   318,   314,
-      70,   316,   317,     0,   324,     0,   266,     0,     0,   325,
-     326,   327,     0,     0,   328,   329,   330,   331,   332,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     142,     0,     0,     0,     0,     0,   145,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     156,     0,     0,   179,     0,     0,     0,     0,   161,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   169,     0,
-       0,     0,     0,     0,     0,     0,   175
+     186,    95,   187,   294,   216,   301,   235,   207,   208,    93,
+      94,   220,    13,   221,   115,   116,   117,   118,   119,   120,
+     208,   222,   223,   224,   110,   111,   112,   209,    14,    93,
+      94,    15,    16,   320,   210,   211,   295,   296,   297,   209,
+      21,    22,    23,    24,    25,   259,   210,   211,    18,    19,
+     295,   296,   297,   279,    20,    28,   125,   126,   127,   188,
+      96,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+     100,   101,   102,   103,   104,   105,   106,   107,    33,    34,
+      35,    36,    37,     1,     2,     3,     4,   276,    58,   277,
+      59,    60,    61,    62,    63,    66,    64,    80,    81,    67,
+      68,    69,    71,    72,    73,    74,    75,    76,    77,    78,
+      82,    83,    87,    79,    84,    85,    86,    88,    89,   132,
+     133,   134,   135,   136,   137,   138,   139,   145,   141,   142,
+     140,   148,   144,   146,   189,   191,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,   159,   190,   160,   162,   161,
+     192,   164,   193,   194,   165,   166,   195,   167,   168,   169,
+     170,   172,   173,   174,   184,   176,   175,   196,   179,   178,
+     198,   199,   203,   180,   182,   202,   183,   185,   197,   200,
+     204,   201,   205,   217,   206,   218,   219,   229,   231,   230,
+     232,   236,   237,   238,   147,   239,   240,   241,   242,   243,
+     281,   244,   245,   246,   247,   248,   249,   250,   251,   282,
+     283,   290,   257,   284,   252,   285,   253,   254,   255,   256,
+     258,   260,   261,   291,   262,   292,   263,   324,   264,   328,
+     163,   158,   265,   270,   266,   267,   269,   268,   273,   274,
+     325,   326,   327,   271,   272,   338,    17,   302,   278,   275,
+     280,   339,   306,   286,   287,   288,   289,   293,   303,   315,
+     304,     0,   305,    65,   307,     0,   308,     0,   309,     0,
+     310,   311,   312,     0,   313,   318,    70,   314,   316,   317,
+     319,   321,   322,     0,   323,   177,   329,   330,   331,   332,
+       0,     0,   333,   334,     0,   335,   336,   337,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     215,     0,     0,   143,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   171,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   181
 };
 
 /* YYCONFLP[YYPACT[STATE-NUM]] -- Pointer into YYCONFL of start of
@@ -638,7 +639,8 @@ static const unsigned char yyconflp[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0
 };
 
 /* YYCONFL[I] -- lists of conflicting rule numbers, each terminated by
@@ -650,83 +652,84 @@ static const short int yyconfl[] =
 
 static const short int yycheck[] =
 {
-       3,    11,     5,    11,   171,   184,    24,   268,    72,    72,
-      45,     7,    47,    41,    42,    43,    24,    58,    59,    60,
-      55,    56,    57,     7,     3,    43,     5,     7,    92,    92,
-       0,    61,    50,    51,   295,    43,    18,    19,    20,    21,
-      22,    61,    50,    51,   211,    52,    53,    54,    58,    59,
-      60,   230,    61,    55,    17,    14,    15,    16,    17,    62,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    33,
-      34,    35,    36,    37,    38,    39,    40,    44,    45,    46,
-      47,    48,    49,    27,    28,    29,    30,    31,    64,    64,
-      64,    64,    64,    62,     7,     5,    64,    62,    64,    61,
-      61,    61,     9,    61,    61,    61,    61,    61,     3,     5,
-       7,    64,     5,    63,    63,    63,     6,    55,     7,     3,
-      63,    63,    63,    63,    63,     8,    63,    62,    62,    65,
-      62,    64,    61,    64,    64,     9,    64,    64,    64,    64,
-      64,    64,    62,    64,    61,    64,    64,    62,    64,     4,
-      64,     4,    64,    64,     5,    64,    64,    62,    61,     5,
-      64,    62,    64,    61,    64,     5,     5,     5,     5,    63,
-       3,    63,    63,     5,    10,    63,    63,    63,     3,     3,
-      65,    63,     5,     5,    63,     3,    62,    65,    63,     3,
-      63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
-      63,    63,    63,    63,    63,    11,    64,    64,    64,    11,
-      64,    63,    62,    62,    62,    62,    10,     5,    63,    11,
-      64,    64,    64,    64,    11,   171,    11,    13,    62,    64,
-      61,    61,    11,    11,    63,    63,    62,    11,    65,    12,
-      10,    62,     6,    63,    63,    12,    63,    63,    63,    62,
-      -1,    63,    63,    63,    63,    63,    63,   268,    63,    63,
-      63,    27,    62,    -1,    65,    64,    64,    64,    63,    62,
-      39,    62,    62,    -1,    63,    -1,   223,    -1,    -1,    63,
-      63,    63,    -1,    -1,    65,    65,    63,    63,    63,    -1,
+       3,     7,     5,    11,   173,   272,   187,    11,    24,    72,
+      72,    45,     7,    47,    44,    45,    46,    47,    48,    49,
+      24,    55,    56,    57,    41,    42,    43,    43,     7,    92,
+      92,     7,     0,   300,    50,    51,    58,    59,    60,    43,
+      18,    19,    20,    21,    22,   214,    50,    51,    61,    61,
+      58,    59,    60,   234,    61,    17,    52,    53,    54,    62,
+      66,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      33,    34,    35,    36,    37,    38,    39,    40,    27,    28,
+      29,    30,    31,    14,    15,    16,    17,     3,    55,     5,
+      64,    64,    64,    64,    64,     7,    62,     5,     9,    64,
+      64,    62,    61,    61,    61,    61,    61,    61,    61,    61,
+       3,     5,     7,    64,     5,    63,    63,    63,     6,    55,
+       3,    63,    63,    63,    63,    63,    63,     7,    62,    62,
+      65,    61,    64,    62,     8,     4,    64,    64,    64,    64,
+      64,    64,    64,    64,    62,    64,     9,    64,    62,    64,
+       4,    64,     5,     5,    64,    64,     5,    64,    64,    64,
+      62,    61,    61,    64,    67,    62,    64,     5,    64,    61,
+       5,     5,     5,    63,    63,     3,    63,    63,    63,    10,
+       3,    63,     3,     5,    63,     5,    63,     3,     7,    62,
+      65,    63,    63,    63,    98,    63,    63,    63,    63,    63,
+      11,    63,    63,    63,    63,    63,    63,    63,    63,    11,
+      10,     5,    62,    11,    65,    11,    64,    64,    64,    64,
+      62,    62,    62,    13,    63,     3,    63,    11,    64,    12,
+     114,   109,    64,   226,    64,    64,    62,    64,    63,    63,
+      11,    11,    11,    61,    61,    10,     6,   272,    62,    64,
+      62,    12,    65,    63,    63,    63,    63,    63,    62,    64,
+      63,    -1,    63,    27,    63,    -1,    63,    -1,    63,    -1,
+      63,    63,    63,    -1,    63,    62,    39,    65,    64,    64,
+      62,    62,    62,    -1,    63,   129,    63,    63,    63,    63,
+      -1,    -1,    65,    65,    -1,    63,    63,    63,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      92,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,
+     173,    -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     108,    -1,    -1,   139,    -1,    -1,    -1,    -1,   113,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   128
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   122,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   140
 };
 
 /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
    symbol of state STATE-NUM.  */
 static const unsigned char yystos[] =
 {
-       0,    14,    15,    16,    17,    67,    68,    69,    70,    73,
-      74,    81,    82,     7,     7,     7,     0,    67,    61,    61,
-      61,    18,    19,    20,    21,    22,    71,    72,    17,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    75,    76,
-      77,    78,    79,    83,    84,    87,    88,    89,    95,    96,
-      99,   100,   103,   104,   107,   108,   111,   112,    55,    64,
-      64,    64,    64,    64,    62,    71,     7,    64,    64,    62,
-      75,    61,    61,    61,    61,    61,    61,    61,    61,    64,
+       0,    14,    15,    16,    17,    69,    70,    71,    72,    75,
+      76,    83,    84,     7,     7,     7,     0,    69,    61,    61,
+      61,    18,    19,    20,    21,    22,    73,    74,    17,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    77,    78,
+      79,    80,    81,    85,    86,    89,    90,    91,    97,    98,
+     101,   102,   105,   106,   109,   110,   113,   114,    55,    64,
+      64,    64,    64,    64,    62,    73,     7,    64,    64,    62,
+      77,    61,    61,    61,    61,    61,    61,    61,    61,    64,
        5,     9,     3,     5,     5,    63,    63,     7,    63,     6,
-      80,    85,    86,    87,   111,     7,    90,    91,    92,    33,
-      34,    35,    36,    37,    38,    39,    40,    97,    98,    41,
-      42,    43,   101,   102,    44,    45,    46,    47,    48,    49,
-     105,   106,   113,   114,    52,    53,    54,   109,   110,   118,
-     119,    55,     3,    63,    63,    63,    63,    63,    63,    65,
-      62,    62,    85,    64,    62,    90,    61,    64,    64,    64,
-      64,    64,    64,    64,    64,    62,    97,    64,    64,    64,
-      62,   101,    64,    64,    64,    64,    64,    64,    62,   105,
-      61,    61,    64,    64,    62,   109,    61,    64,    63,    80,
-      63,    63,    63,     3,     5,    62,     8,     9,     4,     4,
-       5,     5,     5,     5,    63,     5,     5,    10,    63,     3,
-       5,     3,     3,    63,    11,    24,    43,    50,    51,   115,
-     116,   117,   115,   116,     5,     5,    63,    45,    47,    55,
-      56,    57,   120,   121,   122,   123,     3,    62,    65,    93,
-      94,    93,    63,    63,    63,    63,    63,    63,    63,    63,
-      63,    63,    63,    63,    63,    63,    63,    63,    65,    64,
-      64,    64,    64,    62,    62,   116,    62,    62,    63,    63,
-      64,    64,    64,    64,    64,    62,   120,    61,    61,    63,
-      63,     3,     5,    62,    93,    62,    11,    11,    10,    11,
-      11,    63,    63,    63,    63,     5,    13,     3,    63,    11,
-      58,    59,    60,   124,   125,   126,   124,   125,    62,    63,
-      63,    65,    63,    63,    63,    63,    63,    63,    63,    65,
-      64,    64,    64,    62,    62,   124,    62,    62,    63,    11,
-      11,    11,    11,    12,    63,    63,    63,    63,    65,    65,
-      63,    63,    63,    10,    12
+      82,    87,    88,    89,   113,     7,    66,    92,    93,    94,
+      33,    34,    35,    36,    37,    38,    39,    40,    99,   100,
+      41,    42,    43,   103,   104,    44,    45,    46,    47,    48,
+      49,   107,   108,   115,   116,    52,    53,    54,   111,   112,
+     120,   121,    55,     3,    63,    63,    63,    63,    63,    63,
+      65,    62,    62,    87,    64,     7,    62,    92,    61,    64,
+      64,    64,    64,    64,    64,    64,    64,    62,    99,    64,
+      64,    64,    62,   103,    64,    64,    64,    64,    64,    64,
+      62,   107,    61,    61,    64,    64,    62,   111,    61,    64,
+      63,    82,    63,    63,    67,    63,     3,     5,    62,     8,
+       9,     4,     4,     5,     5,     5,     5,    63,     5,     5,
+      10,    63,     3,     5,     3,     3,    63,    11,    24,    43,
+      50,    51,   117,   118,   119,   117,   118,     5,     5,    63,
+      45,    47,    55,    56,    57,   122,   123,   124,   125,     3,
+      62,     7,    65,    95,    96,    95,    63,    63,    63,    63,
+      63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
+      63,    63,    65,    64,    64,    64,    64,    62,    62,   118,
+      62,    62,    63,    63,    64,    64,    64,    64,    64,    62,
+     122,    61,    61,    63,    63,    64,     3,     5,    62,    95,
+      62,    11,    11,    10,    11,    11,    63,    63,    63,    63,
+       5,    13,     3,    63,    11,    58,    59,    60,   126,   127,
+     128,   126,   127,    62,    63,    63,    65,    63,    63,    63,
+      63,    63,    63,    63,    65,    64,    64,    64,    62,    62,
+     126,    62,    62,    63,    11,    11,    11,    11,    12,    63,
+      63,    63,    63,    65,    65,    63,    63,    63,    10,    12
 };
 
 /* Error token number */
@@ -1534,14 +1537,23 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 55:
+  case 54:
 
-    { nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &(((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (2))].yystate.yysemantics.yysval.nodeOption)); }
+    { 
+			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_Variation); 
+			nodePush(parse_state, ((*yyvalp).nodePtr));
+			
+			NodeOption attrEntry; attrEntry.type = OT_VariationAttribute; attrEntry.value.strValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((2) - (5))].yystate.yysemantics.yysval.strValue);
+			nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &attrEntry); 
+
+			NodeOption entry; entry.type = OT_Identifier; entry.value.strValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((4) - (5))].yystate.yysemantics.yysval.strValue);
+			nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &entry); 		
+		}
     break;
 
   case 56:
 
-    { ((*yyvalp).nodeOption).type = OT_VariationValue; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((2) - (2))].yystate.yysemantics.yysval.intValue); }
+    { nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &(((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (2))].yystate.yysemantics.yysval.nodeOption)); }
     break;
 
   case 57:
@@ -1551,68 +1563,73 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 
   case 58:
 
-    { nodePop(parse_state); ((*yyvalp).nodePtr) = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
+    { ((*yyvalp).nodeOption).type = OT_VariationValue; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((2) - (2))].yystate.yysemantics.yysval.intValue); }
     break;
 
   case 59:
 
+    { nodePop(parse_state); ((*yyvalp).nodePtr) = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
+    break;
+
+  case 60:
+
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_Raster); 
 			nodePush(parse_state, ((*yyvalp).nodePtr));
 		}
     break;
 
-  case 61:
+  case 62:
 
     { nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &(((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (2))].yystate.yysemantics.yysval.nodeOption)); }
     break;
 
-  case 62:
+  case 63:
 
     { ((*yyvalp).nodeOption).type = OT_FillMode; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 63:
+  case 64:
 
     { ((*yyvalp).nodeOption).type = OT_CullMode; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 64:
+  case 65:
 
     { ((*yyvalp).nodeOption).type = OT_Scissor; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 65:
+  case 66:
 
     { ((*yyvalp).nodeOption).type = OT_Multisample; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 66:
+  case 67:
 
     { ((*yyvalp).nodeOption).type = OT_AALine; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 67:
+  case 68:
 
     { ((*yyvalp).nodeOption).type = OT_DepthBias; ((*yyvalp).nodeOption).value.floatValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.floatValue); }
     break;
 
-  case 68:
+  case 69:
 
     { ((*yyvalp).nodeOption).type = OT_SDepthBias; ((*yyvalp).nodeOption).value.floatValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.floatValue); }
     break;
 
-  case 69:
+  case 70:
 
     { ((*yyvalp).nodeOption).type = OT_DepthClip; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 70:
+  case 71:
 
     { nodePop(parse_state); ((*yyvalp).nodePtr) = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 71:
+  case 72:
 
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_Depth); 
@@ -1620,32 +1637,32 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 73:
+  case 74:
 
     { nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &(((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (2))].yystate.yysemantics.yysval.nodeOption)); }
     break;
 
-  case 74:
+  case 75:
 
     { ((*yyvalp).nodeOption).type = OT_DepthRead; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 75:
+  case 76:
 
     { ((*yyvalp).nodeOption).type = OT_DepthWrite; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 76:
+  case 77:
 
     { ((*yyvalp).nodeOption).type = OT_CompareFunc; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 77:
+  case 78:
 
     { nodePop(parse_state); ((*yyvalp).nodePtr) = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 78:
+  case 79:
 
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_Stencil); 
@@ -1653,57 +1670,57 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 80:
+  case 81:
 
     { nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &(((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (2))].yystate.yysemantics.yysval.nodeOption)); }
     break;
 
-  case 81:
+  case 82:
 
     { ((*yyvalp).nodeOption).type = OT_Enabled; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 82:
+  case 83:
 
     { ((*yyvalp).nodeOption).type = OT_StencilReadMask; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 83:
+  case 84:
 
     { ((*yyvalp).nodeOption).type = OT_StencilWriteMask; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 84:
+  case 85:
 
     { nodePop(parse_state); ((*yyvalp).nodeOption).type = OT_StencilOpFront; ((*yyvalp).nodeOption).value.nodePtr = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 85:
+  case 86:
 
     { nodePop(parse_state); ((*yyvalp).nodeOption).type = OT_StencilOpBack; ((*yyvalp).nodeOption).value.nodePtr = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 86:
+  case 87:
 
     { nodePop(parse_state); ((*yyvalp).nodeOption).type = OT_StencilOpFront; ((*yyvalp).nodeOption).value.nodePtr = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 87:
+  case 88:
 
     { nodePop(parse_state); ((*yyvalp).nodeOption).type = OT_StencilOpBack; ((*yyvalp).nodeOption).value.nodePtr = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 88:
+  case 89:
 
     { ((*yyvalp).nodeOption).type = OT_StencilRef; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 89:
+  case 90:
 
     { nodePop(parse_state); ((*yyvalp).nodePtr) = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 90:
+  case 91:
 
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_Blend); 
@@ -1711,27 +1728,27 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 92:
+  case 93:
 
     { nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &(((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (2))].yystate.yysemantics.yysval.nodeOption)); }
     break;
 
-  case 93:
+  case 94:
 
     { ((*yyvalp).nodeOption).type = OT_AlphaToCoverage; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 94:
+  case 95:
 
     { ((*yyvalp).nodeOption).type = OT_IndependantBlend; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 95:
+  case 96:
 
     { ((*yyvalp).nodeOption).type = OT_Target; ((*yyvalp).nodeOption).value.nodePtr = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (1))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 96:
+  case 97:
 
     {
 		NodeOption index;
@@ -1745,7 +1762,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 	}
     break;
 
-  case 97:
+  case 98:
 
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_Code); 
@@ -1753,7 +1770,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 98:
+  case 99:
 
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_StencilOp); 
@@ -1761,7 +1778,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 99:
+  case 100:
 
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_StencilOp); 
@@ -1769,7 +1786,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 100:
+  case 101:
 
     {
 			NodeOption fail; fail.type = OT_Fail; fail.value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (7))].yystate.yysemantics.yysval.intValue);
@@ -1784,37 +1801,37 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 102:
+  case 103:
 
     { nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &(((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (2))].yystate.yysemantics.yysval.nodeOption)); }
     break;
 
-  case 103:
+  case 104:
 
     { ((*yyvalp).nodeOption).type = OT_Fail; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 104:
+  case 105:
 
     { ((*yyvalp).nodeOption).type = OT_ZFail; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 105:
+  case 106:
 
     { ((*yyvalp).nodeOption).type = OT_PassOp; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 106:
+  case 107:
 
     { ((*yyvalp).nodeOption).type = OT_CompareFunc; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 107:
+  case 108:
 
     { nodePop(parse_state); ((*yyvalp).nodePtr) = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 108:
+  case 109:
 
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_Target); 
@@ -1822,47 +1839,47 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 110:
+  case 111:
 
     { nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &(((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (2))].yystate.yysemantics.yysval.nodeOption)); }
     break;
 
-  case 111:
+  case 112:
 
     { ((*yyvalp).nodeOption).type = OT_Index; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 112:
+  case 113:
 
     { ((*yyvalp).nodeOption).type = OT_Enabled; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 113:
+  case 114:
 
     { nodePop(parse_state); ((*yyvalp).nodeOption).type = OT_Color; ((*yyvalp).nodeOption).value.nodePtr = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 114:
+  case 115:
 
     { nodePop(parse_state); ((*yyvalp).nodeOption).type = OT_Alpha; ((*yyvalp).nodeOption).value.nodePtr = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 115:
+  case 116:
 
     { nodePop(parse_state); ((*yyvalp).nodeOption).type = OT_Color; ((*yyvalp).nodeOption).value.nodePtr = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 116:
+  case 117:
 
     { nodePop(parse_state); ((*yyvalp).nodeOption).type = OT_Alpha; ((*yyvalp).nodeOption).value.nodePtr = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.nodePtr); }
     break;
 
-  case 117:
+  case 118:
 
     { ((*yyvalp).nodeOption).type = OT_WriteMask; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 118:
+  case 119:
 
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_BlendDef); 
@@ -1870,7 +1887,7 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 119:
+  case 120:
 
     { 
 			((*yyvalp).nodePtr) = nodeCreate(parse_state->memContext, NT_BlendDef); 
@@ -1878,12 +1895,12 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 121:
+  case 122:
 
     { nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &(((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (2))].yystate.yysemantics.yysval.nodeOption)); }
     break;
 
-  case 122:
+  case 123:
 
     {
 			NodeOption src; src.type = OT_Source; src.value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((1) - (5))].yystate.yysemantics.yysval.intValue);
@@ -1896,17 +1913,17 @@ yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
 		}
     break;
 
-  case 123:
+  case 124:
 
     { ((*yyvalp).nodeOption).type = OT_Source; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 124:
+  case 125:
 
     { ((*yyvalp).nodeOption).type = OT_Dest; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
 
-  case 125:
+  case 126:
 
     { ((*yyvalp).nodeOption).type = OT_Op; ((*yyvalp).nodeOption).value.intValue = (((yyGLRStackItem const *)yyvsp)[YYFILL ((3) - (4))].yystate.yysemantics.yysval.intValue); }
     break;
@@ -2016,7 +2033,7 @@ yylhsNonterm (yyRuleNum yyrule)
 }
 
 #define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-262)))
+  (!!((Yystate) == (-268)))
 
 /** True iff LR state STATE has only a default reduction (regardless
  *  of token).  */
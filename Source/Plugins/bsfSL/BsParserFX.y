@@ -388,6 +388,17 @@ variation_header
 			NodeOption entry; entry.type = OT_Identifier; entry.value.strValue = $1;
 			nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &entry); 		
 		}
+	| '[' TOKEN_IDENTIFIER ']' TOKEN_IDENTIFIER '='
+		{ 
+			$$ = nodeCreate(parse_state->memContext, NT_Variation); 
+			nodePush(parse_state, $$);
+			
+			NodeOption attrEntry; attrEntry.type = OT_VariationAttribute; attrEntry.value.strValue = $2;
+			nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &attrEntry); 
+
+			NodeOption entry; entry.type = OT_Identifier; entry.value.strValue = $4;
+			nodeOptionsAdd(parse_state->memContext, parse_state->topNode->options, &entry); 		
+		}
 	;
 	
 variation_body
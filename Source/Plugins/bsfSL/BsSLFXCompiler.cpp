@@ -18,6 +18,9 @@
 #include "Renderer/BsRendererManager.h"
 #include "FileSystem/BsFileSystem.h"
 #include "FileSystem/BsDataStream.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Material/BsShaderCompileCache.h"
+#include "Material/BsShaderLazyVariations.h"
 
 #define XSC_ENABLE_LANGUAGE_EXT 1
 #include "Xsc/Xsc.h"
@@ -538,7 +541,8 @@ namespace bs
 	};
 
 	String crossCompile(const String& hlsl, GpuProgramType type, CrossCompileOutput outputType, bool optionalEntry, 
-		UINT32& startBindingSlot, SHADER_DESC* shaderDesc = nullptr, Vector<GpuProgramType>* detectedTypes = nullptr)
+		UINT32& startBindingSlot, Xsc::Reflection::ReflectionData* outReflection = nullptr, 
+		Vector<GpuProgramType>* detectedTypes = nullptr)
 	{
 		SPtr<StringStream> input = bs_shared_ptr_new<StringStream>();
 
@@ -683,8 +687,8 @@ namespace bs
 			}
 		}
 
-		if (shaderDesc != nullptr)
-			parseParameters(reflectionData, *shaderDesc);
+		if (outReflection != nullptr)
+			*outReflection = std::move(reflectionData);
 
 		return output.str();
 	}
@@ -692,31 +696,208 @@ namespace bs
 	// Convert HLSL code to GLSL
 	String HLSLtoGLSL(const String& hlsl, GpuProgramType type, CrossCompileOutput outputType, UINT32& startBindingSlot)
 	{
-		return crossCompile(hlsl, type, outputType, false, startBindingSlot);
+		if (!ShaderCompileCache::isStarted())
+			return crossCompile(hlsl, type, outputType, false, startBindingSlot);
+
+		// Output options passed to the cross compiler are fixed, so the compiler version identifies them as well
+		const String cacheKey = ShaderCompileCache::generateKey({ "Xsc", XSC_VERSION_STRING,
+			toString((UINT32)type), toString((UINT32)outputType), toString(startBindingSlot), hlsl });
+
+		// Entry contains the binding slot following the compiled program, followed by the compiled code
+		SPtr<MemoryDataStream> cachedData = ShaderCompileCache::instance().find(cacheKey);
+		if (cachedData != nullptr && cachedData->size() >= sizeof(UINT32))
+		{
+			cachedData->read(&startBindingSlot, sizeof(startBindingSlot));
+
+			const size_t codeSize = cachedData->size() - sizeof(UINT32);
+			return String((const char*)cachedData->getCurrentPtr(), codeSize);
+		}
+
+		String output = crossCompile(hlsl, type, outputType, false, startBindingSlot);
+
+		// Only cache successful compilations, so that the errors are reported every time
+		if (!output.empty())
+		{
+			Vector<UINT8> entry(sizeof(UINT32) + output.size());
+			memcpy(entry.data(), &startBindingSlot, sizeof(UINT32));
+			memcpy(entry.data() + sizeof(UINT32), output.data(), output.size());
+
+			ShaderCompileCache::instance().store(cacheKey, entry.data(), (UINT32)entry.size());
+		}
+
+		return output;
 	}
 
-	void reflectHLSL(const String& hlsl, SHADER_DESC& shaderDesc, Vector<GpuProgramType>& entryPoints)
+	void reflectHLSL(const String& hlsl, Xsc::Reflection::ReflectionData& reflection, Vector<GpuProgramType>& entryPoints)
 	{
 		UINT32 dummy = 0;
-		crossCompile(hlsl, GPT_VERTEX_PROGRAM, CrossCompileOutput::GLSL45, true, dummy, &shaderDesc, &entryPoints);
+		crossCompile(hlsl, GPT_VERTEX_PROGRAM, CrossCompileOutput::GLSL45, true, dummy, &reflection, &entryPoints);
+	}
+
+	/** 
+	 * A set of programs that need to be cross-compiled from the same HLSL source. Programs within a single job are 
+	 * compiled sequentially as binding slots of a program depend on the bindings assigned to the previous one.
+	 */
+	struct CrossCompileJob
+	{
+		const String* hlsl = nullptr;
+		CrossCompileOutput outputType = CrossCompileOutput::GLSL45;
+		Vector<std::pair<GpuProgramType, String*>> programs;
+	};
+
+	/** Cross-compiles all programs in the provided job, writing the output code in the job's program entries. */
+	void executeCrossCompileJob(const CrossCompileJob& job)
+	{
+		UINT32 bindingSlot = 0;
+		for(auto& entry : job.programs)
+			*entry.second = HLSLtoGLSL(*job.hlsl, entry.first, job.outputType, bindingSlot);
+	}
+
+	/** Registers an edge in the include graph, noting that @p include is included by @p includer. */
+	void addIncludeEdge(ShaderIncludeGraph& graph, const String& include, const String& includer)
+	{
+		Vector<String>& includers = graph[include];
+		if (std::find(includers.begin(), includers.end(), includer) == includers.end())
+			includers.push_back(includer);
+	}
+
+	/** Variation parameter provided to programs as a constant, instead of a define. */
+	struct SpecializationConstantData
+	{
+		String identifier;
+		UINT32 id = 0;
+		INT32 value = 0;
+		INT32 defaultValue = 0;
+	};
+
+	/** 
+	 * Generates HLSL code declaring constants for specialized variation parameters. Declared constants hold either the
+	 * variation's values, or the parameter default values if @p useDefaults is true.
+	 */
+	String getSpecializationConstantsCode(const Vector<SpecializationConstantData>& constants, bool useDefaults)
+	{
+		String output;
+		for (auto& entry : constants)
+		{
+			const INT32 value = useDefaults ? entry.defaultValue : entry.value;
+			output += "static const int " + entry.identifier + " = " + toString(value) + ";\n";
+		}
+
+		return output;
+	}
+
+	/** Returns a regex matching the declaration of a specialized parameter's constant in cross-compiled VKSL code. */
+	std::regex getSpecializationConstantRegex(const String& identifier)
+	{
+		return std::regex("\\bconst\\s+int\\s+" + identifier + "\\s*=");
+	}
+
+	/** 
+	 * Checks can all specialized parameters referenced by the provided VKSL code be turned into specialization
+	 * constants. This is not possible if the cross-compiler output the constant in an unexpected form.
+	 */
+	bool canDeclareSpecializationConstants(const String& vksl, const Vector<SpecializationConstantData>& constants)
+	{
+		for (auto& entry : constants)
+		{
+			// Parameter not referenced by this program
+			const std::regex identifierRegex("\\b" + entry.identifier + "\\b");
+			if (!std::regex_search(vksl, identifierRegex))
+				continue;
+
+			if (!std::regex_search(vksl, getSpecializationConstantRegex(entry.identifier)))
+				return false;
+		}
+
+		return true;
 	}
 
+	/** 
+	 * Marks constants of specialized variation parameters in the provided VKSL code as specialization constants, so their
+	 * values can be provided when creating the pipeline instead. Caller must ensure the code passes 
+	 * canDeclareSpecializationConstants().
+	 */
+	String declareSpecializationConstants(const String& vksl, const Vector<SpecializationConstantData>& constants)
+	{
+		String output = vksl;
+		for (auto& entry : constants)
+		{
+			output = regex_replace(output, getSpecializationConstantRegex(entry.identifier), 
+				"layout(constant_id = " + toString(entry.id) + ") const int " + entry.identifier + " =");
+		}
+
+		return output;
+	}
+
+	/** Cross-compilation of a single pass, for all programs in the pass. */
+	struct PassCrossCompileInfo
+	{
+		UINT32 glslTechniqueIdx;
+		UINT32 vkslTechniqueIdx;
+		UINT32 passIdx;
+		CrossCompileOutput glslVersion;
+		Vector<GpuProgramType> types;
+	};
+
+	/** Intermediate data generated when parsing and cross-compiling a single shader variation. */
+	struct BSLFXCompiler::VariationOutput
+	{
+		String name;
+		ShaderVariation variation;
+
+		BSLFXCompileResult result;
+		bool parsed = false;
+		bool deferred = false;
+
+		ShaderIncludeGraph includes;
+		Vector<SpecializationConstantData> specializationConstants;
+		bool bakeSpecializationConstants = false;
+		Vector<ShaderData> techniques;
+		Vector<PassCrossCompileInfo> passes;
+		Vector<Xsc::Reflection::ReflectionData> reflection;
+	};
+
 	BSLFXCompileResult BSLFXCompiler::compile(const String& name, const String& source, 
-		const UnorderedMap<String, String>& defines)
+		const UnorderedMap<String, String>& defines, bool compileVariationsOnDemand)
 	{
 		// Parse global shader options & shader meta-data
 		SHADER_DESC shaderDesc;
-		Vector<String> includes;
+		ShaderIncludeGraph includes;
+
+		VariationFilter filter;
+		filter.deferNonDefault = compileVariationsOnDemand;
 		
-		BSLFXCompileResult output = compileShader(source, defines, shaderDesc, includes);
+		BSLFXCompileResult output = compileShader(source, defines, shaderDesc, includes, filter);
+
+		if (!filter.deferred.empty())
+			shaderDesc.lazyVariations = bs_shared_ptr_new<ShaderLazyVariations>(name, source, defines, filter.deferred);
 
 		// Generate a shader from the parsed information
 		output.shader = Shader::_createPtr(name, shaderDesc);
-		output.shader->setIncludeFiles(includes);
+		output.shader->setIncludeGraph(includes);
 
 		return output;
 	}
 
+	Vector<SPtr<Technique>> BSLFXCompiler::compileVariation(const String& name, const String& source,
+		const UnorderedMap<String, String>& defines, const ShaderVariation& variation)
+	{
+		SHADER_DESC shaderDesc;
+		ShaderIncludeGraph includes;
+
+		VariationFilter filter;
+		filter.variation = &variation;
+
+		BSLFXCompileResult output = compileShader(source, defines, shaderDesc, includes, filter);
+		if (!output.errorMessage.empty())
+		{
+			LOGERR("Failed compiling a variation of shader \"" + name + "\": " + output.errorMessage);
+			return Vector<SPtr<Technique>>();
+		}
+
+		return shaderDesc.techniques;
+	}
+
 	BSLFXCompileResult BSLFXCompiler::parseFX(ParseState* parseState, const char* source, const UnorderedMap<String, String>& defines)
 	{
 		for(auto& define : defines)
@@ -890,6 +1071,12 @@ namespace bs
 			case OT_VariationValue:
 				variationData.values.push_back(option->value.intValue);
 				break;
+			case OT_VariationAttribute:
+				if (strcmp(option->value.strValue, "specialize") == 0)
+					variationData.specialize = true;
+				else
+					LOGWRN("Unknown variation attribute \"" + String(option->value.strValue) + "\". Ignoring.");
+				break;
 			default:
 				break;
 			}
@@ -1657,12 +1844,13 @@ namespace bs
 
 	BSLFXCompileResult BSLFXCompiler::compileTechniques(
 		const Vector<std::pair<ASTFXNode*, ShaderMetaData>>& shaderMetaData, const String& source, 
-		const UnorderedMap<String, String>& defines, SHADER_DESC& shaderDesc, Vector<String>& includes)
+		const UnorderedMap<String, String>& defines, SHADER_DESC& shaderDesc, ShaderIncludeGraph& includes, 
+		VariationFilter& filter)
 	{
 		BSLFXCompileResult output;
 
 		// Build a list of different variations and re-parse the source using the relevant defines
-		UnorderedSet<String> includeSet;
+		Vector<VariationOutput> variationOutputs;
 		for (auto& entry : shaderMetaData)
 		{
 			const ShaderMetaData& metaData = entry.second;
@@ -1745,45 +1933,204 @@ namespace bs
 				}
 			}
 
-			// For every variation, re-parse the file with relevant defines
-			for (auto& variation : variations)
+			// Default variation has all boolean parameters undefined, and all other parameters set to their first value
+			auto isDefault = [&metaData](const ShaderVariation& variation)
 			{
-				UnorderedMap<String, String> globalDefines = defines;
-				UnorderedMap<String, String> variationDefines = variation.getDefines().getAll();
+				const auto& params = variation.getParams();
+				for (auto& param : metaData.variations)
+				{
+					auto iterFind = params.find(param.identifier);
+					const INT32 value = iterFind != params.end() ? iterFind->second.i : 0;
+					const INT32 defaultValue = param.values.empty() ? 0 : (INT32)param.values[0];
 
-				for (auto& define : variationDefines)
-					globalDefines[define.first] = define.second;
+					if (value != defaultValue)
+						return false;
+				}
 
-				ParseState* variationParseState = parseStateCreate();
-				output = parseFX(variationParseState, source.c_str(), globalDefines);
+				return true;
+			};
 
-				if (!output.errorMessage.empty())
-					parseStateDelete(variationParseState);
-				else
+			for (auto& variation : variations)
+			{
+				if (filter.variation && !(*filter.variation == variation))
+					continue;
+
+				variationOutputs.push_back(VariationOutput());
+				variationOutputs.back().name = metaData.name;
+				variationOutputs.back().variation = variation;
+				variationOutputs.back().deferred = filter.deferNonDefault && !isDefault(variation);
+
+				const auto& params = variation.getParams();
+				for (auto& param : metaData.variations)
 				{
-					Vector<String> codeBlocks;
-					RawCode* rawCode = variationParseState->rawCodeBlock[RCT_CodeBlock];
-					while (rawCode != nullptr)
-					{
-						while ((INT32)codeBlocks.size() <= rawCode->index)
-							codeBlocks.push_back(String());
+					if (!param.specialize)
+						continue;
 
-						codeBlocks[rawCode->index] = String(rawCode->code, rawCode->size);
-						rawCode = rawCode->next;
-					}
+					auto iterFind = params.find(param.identifier);
 
-					output = compileTechniques(variationParseState, entry.second.name, codeBlocks, variation, includeSet, 
-						shaderDesc);
+					SpecializationConstantData constant;
+					constant.identifier = param.identifier;
+					constant.id = (UINT32)variationOutputs.back().specializationConstants.size();
+					constant.value = iterFind != params.end() ? iterFind->second.i : 0;
+					constant.defaultValue = param.values.empty() ? 0 : (INT32)param.values[0];
 
-					if (!output.errorMessage.empty())
-						return output;
+					variationOutputs.back().specializationConstants.push_back(constant);
 				}
 			}
 		}
 
-		// Generate a shader from the parsed techniques
-		for (auto& entry : includeSet)
-			includes.push_back(entry);
+		const bool isParallel = TaskScheduler::isStarted();
+		auto runJobs = [isParallel](UINT32 count, const std::function<void(UINT32)>& func)
+		{
+			auto runRange = [&func](UINT32 begin, UINT32 end)
+			{
+				for (UINT32 i = begin; i < end; i++)
+					func(i);
+			};
+
+			if (isParallel)
+				TaskScheduler::instance().parallelFor(0, count, 1, runRange);
+			else
+				runRange(0, count);
+		};
+
+		// For every variation, re-parse the file with relevant defines. Each variation is independent and parsed in 
+		// parallel, after which all the GPU programs of all the variations are cross-compiled in parallel as well.
+		runJobs((UINT32)variationOutputs.size(), [&](UINT32 idx)
+		{
+			parseVariationSource(source, defines, variationOutputs[idx]);
+		});
+
+		auto getProgramCode = [](PassData& passData, GpuProgramType type) -> String*
+		{
+			switch(type)
+			{
+			case GPT_VERTEX_PROGRAM: return &passData.vertexCode;
+			case GPT_FRAGMENT_PROGRAM: return &passData.fragmentCode;
+			case GPT_GEOMETRY_PROGRAM: return &passData.geometryCode;
+			case GPT_HULL_PROGRAM: return &passData.hullCode;
+			case GPT_DOMAIN_PROGRAM: return &passData.domainCode;
+			case GPT_COMPUTE_PROGRAM: return &passData.computeCode;
+			default: return nullptr;
+			}
+		};
+
+		Vector<CrossCompileJob> crossCompileJobs;
+		for (auto& variationOutput : variationOutputs)
+		{
+			if (variationOutput.deferred)
+				continue;
+
+			for (auto& passInfo : variationOutput.passes)
+			{
+				PassData& glslPassData = variationOutput.techniques[passInfo.glslTechniqueIdx].passes[passInfo.passIdx];
+				PassData& vkslPassData = variationOutput.techniques[passInfo.vkslTechniqueIdx].passes[passInfo.passIdx];
+
+				// GLSL doesn't use automatic binding, so each program can be compiled on its own
+				for (auto& type : passInfo.types)
+				{
+					CrossCompileJob glslJob;
+					glslJob.hlsl = &glslPassData.code;
+					glslJob.outputType = passInfo.glslVersion;
+					glslJob.programs.push_back(std::make_pair(type, getProgramCode(glslPassData, type)));
+
+					crossCompileJobs.push_back(glslJob);
+				}
+
+				CrossCompileJob vkslJob;
+				vkslJob.hlsl = &vkslPassData.code;
+				vkslJob.outputType = CrossCompileOutput::VKSL45;
+
+				for (auto& type : passInfo.types)
+					vkslJob.programs.push_back(std::make_pair(type, getProgramCode(vkslPassData, type)));
+
+				crossCompileJobs.push_back(vkslJob);
+			}
+		}
+
+		runJobs((UINT32)crossCompileJobs.size(), [&](UINT32 idx)
+		{
+			executeCrossCompileJob(crossCompileJobs[idx]);
+		});
+
+		// Specialized parameters that can't be found in the cross-compiled VKSL code fall back to having their values
+		// baked in, same as with other backends
+		Vector<CrossCompileJob> fallbackJobs;
+		for (auto& variationOutput : variationOutputs)
+		{
+			const Vector<SpecializationConstantData>& constants = variationOutput.specializationConstants;
+			if (variationOutput.deferred || constants.empty())
+				continue;
+
+			bool canSpecialize = true;
+			for (auto& passInfo : variationOutput.passes)
+			{
+				PassData& vkslPassData = variationOutput.techniques[passInfo.vkslTechniqueIdx].passes[passInfo.passIdx];
+				for (auto& type : passInfo.types)
+					canSpecialize &= canDeclareSpecializationConstants(*getProgramCode(vkslPassData, type), constants);
+			}
+
+			if (canSpecialize)
+				continue;
+
+			LOGWRN("Unable to declare specialization constants for shader \"" + variationOutput.name + "\". Values of "
+				"specialized variation parameters will be baked into the Vulkan programs instead.");
+
+			variationOutput.bakeSpecializationConstants = true;
+
+			const String constantsCode = getSpecializationConstantsCode(constants, false);
+			const String vkslConstantsCode = getSpecializationConstantsCode(constants, true);
+			for (auto& passInfo : variationOutput.passes)
+			{
+				PassData& vkslPassData = variationOutput.techniques[passInfo.vkslTechniqueIdx].passes[passInfo.passIdx];
+				vkslPassData.code = constantsCode + vkslPassData.code.substr(vkslConstantsCode.size());
+
+				CrossCompileJob vkslJob;
+				vkslJob.hlsl = &vkslPassData.code;
+				vkslJob.outputType = CrossCompileOutput::VKSL45;
+
+				for (auto& type : passInfo.types)
+					vkslJob.programs.push_back(std::make_pair(type, getProgramCode(vkslPassData, type)));
+
+				fallbackJobs.push_back(vkslJob);
+			}
+		}
+
+		runJobs((UINT32)fallbackJobs.size(), [&](UINT32 idx)
+		{
+			executeCrossCompileJob(fallbackJobs[idx]);
+		});
+
+		// Register the results in the same order as the variations were generated in, so the output is deterministic
+		for (auto& variationOutput : variationOutputs)
+		{
+			output = variationOutput.result;
+
+			// Note: Variations that fail to parse are skipped
+			if (!variationOutput.parsed)
+				continue;
+
+			if (!output.errorMessage.empty())
+				return output;
+
+			for (auto& entry : variationOutput.includes)
+			{
+				for (auto& includer : entry.second)
+					addIncludeEdge(includes, entry.first, includer);
+			}
+
+			for (auto& entry : variationOutput.reflection)
+				parseParameters(entry, shaderDesc);
+
+			// Parameters and includes of deferred variations are still registered, so the shader interface is complete
+			if (variationOutput.deferred)
+			{
+				filter.deferred.push_back(variationOutput.variation);
+				continue;
+			}
+
+			createTechniques(variationOutput, shaderDesc);
+		}
 
 		// Verify techniques compile correctly
 		bool hasError = false;
@@ -1841,7 +2188,7 @@ namespace bs
 	}
 
 	BSLFXCompileResult BSLFXCompiler::compileShader(String source, const UnorderedMap<String, String>& defines, 
-		SHADER_DESC& shaderDesc, Vector<String>& includes)
+		SHADER_DESC& shaderDesc, ShaderIncludeGraph& includes, VariationFilter& filter)
 	{
 		SPtr<ct::Renderer> renderer = RendererManager::instance().getActive();
 
@@ -1886,11 +2233,15 @@ namespace bs
 		if (!output.errorMessage.empty())
 			return output;
 
-		output = compileTechniques(shaderMetaData, source, defines, shaderDesc, includes);
+		output = compileTechniques(shaderMetaData, source, defines, shaderDesc, includes, filter);
 
 		if (!output.errorMessage.empty())
 			return output;
 
+		// Sub-shaders are compiled along with the parent shader, and are not needed when compiling a single variation
+		if (filter.variation)
+			return output;
+
 		// Parse sub-shaders
 		for (auto& entry : subShaderData)
 		{
@@ -1921,8 +2272,9 @@ namespace bs
 
 				SHADER_DESC subShaderDesc;
 				Vector<String> subShaderIncludes;
+				VariationFilter subShaderFilter;
 				BSLFXCompileResult subShaderOutput = compileShader(subShaderSource.str(), subShaderDefines, subShaderDesc, 
-					subShaderIncludes);
+					subShaderIncludes, subShaderFilter);
 
 				if (!subShaderOutput.errorMessage.empty())
 					return subShaderOutput;
@@ -1943,9 +2295,46 @@ namespace bs
 		return output;
 	}
 
-	BSLFXCompileResult BSLFXCompiler::compileTechniques(ParseState* parseState, const String& name, 
-		const Vector<String>& codeBlocks, const ShaderVariation& variation, UnorderedSet<String>& includes, 
-		SHADER_DESC& shaderDesc)
+	void BSLFXCompiler::parseVariationSource(const String& source, const UnorderedMap<String, String>& defines, 
+		VariationOutput& output)
+	{
+		UnorderedMap<String, String> globalDefines = defines;
+		UnorderedMap<String, String> variationDefines = output.variation.getDefines().getAll();
+
+		// Specialized parameters are declared as constants in the program code instead
+		for (auto& entry : output.specializationConstants)
+			variationDefines.erase(entry.identifier);
+
+		for (auto& define : variationDefines)
+			globalDefines[define.first] = define.second;
+
+		ParseState* parseState = parseStateCreate();
+		output.result = parseFX(parseState, source.c_str(), globalDefines);
+
+		if (!output.result.errorMessage.empty())
+		{
+			parseStateDelete(parseState);
+			return;
+		}
+
+		output.parsed = true;
+
+		Vector<String> codeBlocks;
+		RawCode* rawCode = parseState->rawCodeBlock[RCT_CodeBlock];
+		while (rawCode != nullptr)
+		{
+			while ((INT32)codeBlocks.size() <= rawCode->index)
+				codeBlocks.push_back(String());
+
+			codeBlocks[rawCode->index] = String(rawCode->code, rawCode->size);
+			rawCode = rawCode->next;
+		}
+
+		output.result = parseTechniques(parseState, codeBlocks, output);
+	}
+
+	BSLFXCompileResult BSLFXCompiler::parseTechniques(ParseState* parseState, const Vector<String>& codeBlocks, 
+		VariationOutput& variationOutput)
 	{
 		BSLFXCompileResult output;
 
@@ -1972,7 +2361,7 @@ namespace bs
 				ShaderMetaData metaData = parseShaderMetaData(option->value.nodePtr);
 
 				// Skip all techniques except the one we're parsing
-				if(metaData.name != name && !metaData.isMixin)
+				if(metaData.name != variationOutput.name && !metaData.isMixin)
 					continue;
 
 				shaderData.push_back(std::make_pair(option->value.nodePtr, ShaderData()));
@@ -1986,7 +2375,8 @@ namespace bs
 			}
 		}
 
-		bool* mixinWasParsed = bs_stack_alloc<bool>((UINT32)shaderData.size());
+		// Note: Not using stack allocation as this may execute on a task worker thread
+		Vector<bool> mixinWasParsed(shaderData.size());
 		std::function<bool(const ShaderMetaData&, ShaderData&)> parseInherited = 
 			[&](const ShaderMetaData& metaData, ShaderData& outShader)
 		{
@@ -2046,44 +2436,50 @@ namespace bs
 			if (metaData.isMixin)
 				continue;
 
-			bs_zero_out(mixinWasParsed, shaderData.size());
+			std::fill(mixinWasParsed.begin(), mixinWasParsed.end(), false);
 			if (!parseInherited(metaData, entry.second))
 			{
 				parseStateDelete(parseState);
-				bs_stack_free(mixinWasParsed);
 				return output;
 			}
 
 			parseShader(entry.first, codeBlocks, entry.second);
 		}
 
-		bs_stack_free(mixinWasParsed);
-
 		IncludeLink* includeLink = parseState->includes;
 		while(includeLink != nullptr)
 		{
-			String includeFilename = includeLink->data->filename;
-
-			auto iterFind = std::find(includes.begin(), includes.end(), includeFilename);
-			if (iterFind == includes.end())
-				includes.insert(includeFilename);
+			const char* includer = includeLink->data->includer;
+			addIncludeEdge(variationOutput.includes, includeLink->data->filename, includer ? includer : "");
 
 			includeLink = includeLink->next;
 		}
 
 		parseStateDelete(parseState);
 
-		// Parse extended HLSL code and generate per-program code, also convert to GLSL/VKSL
+		// Parse extended HLSL code and generate per-program code. Conversion to GLSL/VKSL is deferred so it can be
+		// performed in parallel for all variations and programs.
 		UINT32 end = (UINT32)shaderData.size();
 		for(UINT32 i = 0; i < end; i++)
 		{
-			const ShaderMetaData& metaData = shaderData[i].second.metaData;
-			if (metaData.isMixin)
+			if (shaderData[i].second.metaData.isMixin)
 				continue;
 
-			ShaderData& hlslTechnique = shaderData[i].second;
+			variationOutput.techniques.push_back(shaderData[i].second);
+		}
+
+		// Specialized variation parameters are declared as constants holding the variation's values. Vulkan programs
+		// instead declare them with their default values, overridden by specialization constants when the pipeline is
+		// created, so their code is the same for all values of the parameters.
+		const Vector<SpecializationConstantData>& constants = variationOutput.specializationConstants;
+		const String constantsCode = getSpecializationConstantsCode(constants, false);
+		const String vkslConstantsCode = getSpecializationConstantsCode(constants, true);
 
-			ShaderData glslTechnique = shaderData[i].second;
+		UINT32 numHLSLTechniques = (UINT32)variationOutput.techniques.size();
+		for(UINT32 i = 0; i < numHLSLTechniques; i++)
+		{
+			// Note: Not using a reference as the array is being appended to
+			ShaderData glslTechnique = variationOutput.techniques[i];
 
 			// When working with OpenGL, lower-end feature sets are supported. For other backends, high-end is always assumed.
 			CrossCompileOutput glslVersion = CrossCompileOutput::GLSL41;
@@ -2095,16 +2491,44 @@ namespace bs
 			else
 				glslTechnique.metaData.language = "glsl4_1";
 
-			ShaderData vkslTechnique = shaderData[i].second;
+			ShaderData vkslTechnique = variationOutput.techniques[i];
 			vkslTechnique.metaData.language = "vksl";
 
+			UINT32 glslTechniqueIdx = (UINT32)variationOutput.techniques.size();
+			UINT32 vkslTechniqueIdx = glslTechniqueIdx + 1;
+
+			variationOutput.techniques.push_back(glslTechnique);
+			variationOutput.techniques.push_back(vkslTechnique);
+
+			ShaderData& hlslTechnique = variationOutput.techniques[i];
 			UINT32 numPasses = (UINT32)hlslTechnique.passes.size();
 
 			for(UINT32 j = 0; j < numPasses; j++)
 			{
 				PassData& hlslPassData = hlslTechnique.passes[j];
-				PassData& glslPassData = glslTechnique.passes[j];
-				PassData& vkslPassData = vkslTechnique.passes[j];
+
+				if (!variationOutput.specializationConstants.empty())
+				{
+					PassData& glslPassData = variationOutput.techniques[glslTechniqueIdx].passes[j];
+					PassData& vkslPassData = variationOutput.techniques[vkslTechniqueIdx].passes[j];
+
+					hlslPassData.code = constantsCode + hlslPassData.code;
+					glslPassData.code = constantsCode + glslPassData.code;
+					vkslPassData.code = vkslConstantsCode + vkslPassData.code;
+				}
+
+				// Find valid entry points and parameters
+				// Note: XShaderCompiler needs to do a full pass when doing reflection, and for each individual program
+				// type. If performance is ever important here it could be good to update XShaderCompiler so it can
+				// somehow save the AST and then re-use it for multiple actions.
+				PassCrossCompileInfo passInfo;
+				passInfo.glslTechniqueIdx = glslTechniqueIdx;
+				passInfo.vkslTechniqueIdx = vkslTechniqueIdx;
+				passInfo.passIdx = j;
+				passInfo.glslVersion = glslVersion;
+
+				variationOutput.reflection.push_back(Xsc::Reflection::ReflectionData());
+				reflectHLSL(hlslPassData.code, variationOutput.reflection.back(), passInfo.types);
 
 				// Clean non-standard HLSL 
 				// Note: Ideally we add a full HLSL output module to XShaderCompiler, instead of using simple regex. This
@@ -2118,84 +2542,54 @@ namespace bs
 					R"(Texture2D\s*(\S*)\s*=.*;)");
 				hlslPassData.code = regex_replace(hlslPassData.code, initializerRegex, "Texture2D $1;");
 
-				// Find valid entry points and parameters
-				// Note: XShaderCompiler needs to do a full pass when doing reflection, and for each individual program
-				// type. If performance is ever important here it could be good to update XShaderCompiler so it can
-				// somehow save the AST and then re-use it for multiple actions.
-				Vector<GpuProgramType> types;
-				reflectHLSL(glslPassData.code, shaderDesc, types);
-
-				UINT32 glslBinding = 0;
-				UINT32 vkslBinding = 0;
-
-				// Cross-compile for all detected shader types
 				// Note: I'm just copying HLSL code as-is. This code will contain all entry points which could have
 				// an effect on compile time. It would be ideal to remove dead code depending on program type. This would
 				// involve adding a HLSL code generator to XShaderCompiler.
-				for(auto& type : types)
+				for(auto& type : passInfo.types)
 				{
 					switch(type)
 					{
-					case GPT_VERTEX_PROGRAM:
-						hlslPassData.vertexCode = hlslPassData.code;
-						glslPassData.vertexCode = HLSLtoGLSL(glslPassData.code, GPT_VERTEX_PROGRAM, 
-							glslVersion, glslBinding);
-						vkslPassData.vertexCode = HLSLtoGLSL(glslPassData.code, GPT_VERTEX_PROGRAM, 
-							CrossCompileOutput::VKSL45, vkslBinding);
-						break;
-					case GPT_FRAGMENT_PROGRAM:
-						hlslPassData.fragmentCode = hlslPassData.code;
-						glslPassData.fragmentCode = HLSLtoGLSL(glslPassData.code, GPT_FRAGMENT_PROGRAM, 
-							glslVersion, glslBinding);
-						vkslPassData.fragmentCode = HLSLtoGLSL(glslPassData.code, GPT_FRAGMENT_PROGRAM, 
-							CrossCompileOutput::VKSL45, vkslBinding);
-						break;
-					case GPT_GEOMETRY_PROGRAM:
-						hlslPassData.geometryCode = hlslPassData.code;
-						glslPassData.geometryCode = HLSLtoGLSL(glslPassData.code, GPT_GEOMETRY_PROGRAM, 
-							glslVersion, glslBinding);
-						vkslPassData.geometryCode = HLSLtoGLSL(glslPassData.code, GPT_GEOMETRY_PROGRAM, 
-							CrossCompileOutput::VKSL45, vkslBinding);
-						break;
-					case GPT_HULL_PROGRAM:
-						hlslPassData.hullCode = hlslPassData.code;
-						glslPassData.hullCode = HLSLtoGLSL(glslPassData.code, GPT_HULL_PROGRAM, 
-							glslVersion, glslBinding);
-						vkslPassData.hullCode = HLSLtoGLSL(glslPassData.code, GPT_HULL_PROGRAM, 
-							CrossCompileOutput::VKSL45, vkslBinding);
-						break;
-					case GPT_DOMAIN_PROGRAM:
-						hlslPassData.domainCode = hlslPassData.code;
-						glslPassData.domainCode = HLSLtoGLSL(glslPassData.code, GPT_DOMAIN_PROGRAM, 
-							glslVersion, glslBinding);
-						vkslPassData.domainCode = HLSLtoGLSL(glslPassData.code, GPT_DOMAIN_PROGRAM, 
-							CrossCompileOutput::VKSL45, vkslBinding);
-						break;
-					case GPT_COMPUTE_PROGRAM:
-						hlslPassData.computeCode = hlslPassData.code;
-						glslPassData.computeCode = HLSLtoGLSL(glslPassData.code, GPT_COMPUTE_PROGRAM, 
-							glslVersion, glslBinding);
-						vkslPassData.computeCode = HLSLtoGLSL(glslPassData.code, GPT_COMPUTE_PROGRAM, 
-							CrossCompileOutput::VKSL45, vkslBinding);
-						break;
-					default:
-						break;
+					case GPT_VERTEX_PROGRAM: hlslPassData.vertexCode = hlslPassData.code; break;
+					case GPT_FRAGMENT_PROGRAM: hlslPassData.fragmentCode = hlslPassData.code; break;
+					case GPT_GEOMETRY_PROGRAM: hlslPassData.geometryCode = hlslPassData.code; break;
+					case GPT_HULL_PROGRAM: hlslPassData.hullCode = hlslPassData.code; break;
+					case GPT_DOMAIN_PROGRAM: hlslPassData.domainCode = hlslPassData.code; break;
+					case GPT_COMPUTE_PROGRAM: hlslPassData.computeCode = hlslPassData.code; break;
+					default: break;
 					}
 				}
-			}
 
-			shaderData.push_back(std::make_pair(nullptr, glslTechnique));
-			shaderData.push_back(std::make_pair(nullptr, vkslTechnique));
+				variationOutput.passes.push_back(passInfo);
+			}
 		}
 
-		for(auto& entry : shaderData)
+		return output;
+	}
+
+	void BSLFXCompiler::createTechniques(const VariationOutput& variationOutput, SHADER_DESC& shaderDesc)
+	{
+		for(auto& entry : variationOutput.techniques)
 		{
-			const ShaderMetaData& metaData = entry.second.metaData;
-			if (metaData.isMixin)
-				continue;
+			const ShaderMetaData& metaData = entry.metaData;
+
+			// Only Vulkan supports specialization constants, other backends have the values baked into the code
+			const bool isVKSL = metaData.language == "vksl" && !variationOutput.bakeSpecializationConstants;
+
+			Vector<GpuProgramSpecializationConstant> specializationConstants;
+			if (isVKSL)
+			{
+				for (auto& constantData : variationOutput.specializationConstants)
+				{
+					GpuProgramSpecializationConstant constant;
+					constant.id = constantData.id;
+					constant.value = constantData.value;
+
+					specializationConstants.push_back(constant);
+				}
+			}
 
 			Map<UINT32, SPtr<Pass>, std::greater<UINT32>> passes;
-			for (auto& passData : entry.second.passes)
+			for (auto& passData : entry.passes)
 			{
 				PASS_DESC passDesc;
 				passDesc.blendStateDesc = passData.blendDesc;
@@ -2203,14 +2597,21 @@ namespace bs
 				passDesc.depthStencilStateDesc = passData.depthStencilDesc;
 
 				auto createProgram =
-					[](const String& language, const String& entry, const String& code, GpuProgramType type) -> GPU_PROGRAM_DESC
+					[&](const String& language, const String& entry, const String& code, GpuProgramType type) -> GPU_PROGRAM_DESC
 				{
 					GPU_PROGRAM_DESC desc;
 					desc.language = language;
 					desc.entryPoint = entry;
-					desc.source = code;
 					desc.type = type;
 
+					if (!specializationConstants.empty() && !code.empty())
+					{
+						desc.source = declareSpecializationConstants(code, variationOutput.specializationConstants);
+						desc.specializationConstants = specializationConstants;
+					}
+					else
+						desc.source = code;
+
 					return desc;
 				};
 
@@ -2264,12 +2665,11 @@ namespace bs
 
 			if (orderedPasses.size() > 0)
 			{
-				SPtr<Technique> technique = Technique::create(metaData.language, metaData.tags, variation, orderedPasses);
+				SPtr<Technique> technique = Technique::create(metaData.language, metaData.tags, variationOutput.variation,
+					orderedPasses);
 				shaderDesc.techniques.push_back(technique);
 			}
 		}
-
-		return output;
 	}
 
 	String BSLFXCompiler::removeQuotes(const char* input)
@@ -4,6 +4,7 @@
 
 #include "BsSLPrerequisites.h"
 #include "Material/BsShader.h"
+#include "Material/BsShaderManager.h"
 #include "RenderAPI/BsGpuProgram.h"
 #include "RenderAPI/BsRasterizerState.h"
 #include "RenderAPI/BsDepthStencilState.h"
@@ -66,6 +67,12 @@ namespace bs
 		{
 			String identifier;
 			Vector<UINT32> values;
+
+			/** 
+			 * If true the parameter is provided to programs as a constant instead of a define, which allows backends
+			 * supporting specialization constants to share a single program between all values of the parameter.
+			 */
+			bool specialize = false;
 		};
 
 		/** Information describing a shader/mixin node, without the actual contents. */
@@ -96,10 +103,45 @@ namespace bs
 			UINT32 codeBlockIndex;
 		};
 
+		/** Determines which shader variations are to be compiled, and which are to be deferred for later. */
+		struct VariationFilter
+		{
+			/** If not null, only the variation matching this one is compiled. */
+			const ShaderVariation* variation = nullptr;
+
+			/** 
+			 * If true, only the default variation (all parameters at their first value) is compiled, while the others
+			 * are output to @p deferred. 
+			 */
+			bool deferNonDefault = false;
+
+			/** Variations that weren't compiled as they are to be compiled on demand. */
+			Vector<ShaderVariation> deferred;
+		};
+
+		/** Intermediate data generated when parsing and cross-compiling a single shader variation. */
+		struct VariationOutput;
+
 	public:
-		/**	Transforms a source file written in BSL FX syntax into a Shader object. */
+		/**
+		 * Transforms a source file written in BSL FX syntax into a Shader object. 
+		 *
+		 * @param[in]	name						Name of the shader.
+		 * @param[in]	source						BSL source to compile.
+		 * @param[in]	defines						A set of defines to apply to all variations.
+		 * @param[in]	compileVariationsOnDemand	If true only the default variation will be compiled, while other
+		 *											variations will be compiled on demand when first requested.
+		 *											@see ShaderImportOptions::compileVariationsOnDemand.
+		 */
 		static BSLFXCompileResult compile(const String& name, const String& source, 
-			const UnorderedMap<String, String>& defines);
+			const UnorderedMap<String, String>& defines, bool compileVariationsOnDemand = false);
+
+		/** 
+		 * Compiles a single variation of the shader in the provided BSL source, and returns the techniques implementing
+		 * it. Returns an empty list if the compilation fails.
+		 */
+		static Vector<SPtr<Technique>> compileVariation(const String& name, const String& source,
+			const UnorderedMap<String, String>& defines, const ShaderVariation& variation);
 
 	private:
 		/** Converts the provided source into an abstract syntax tree using the lexer & parser for BSL FX syntax. */
@@ -243,11 +285,14 @@ namespace bs
 		 *									applied to all variations.
 		 * @param[out]	shaderDesc			Shader descriptor that resulting techniques, sub-shaders, and parameters will be
 		 *									registered with.
-		 * @param[out]	includes			A list of all include files included by the BSL source.
+		 * @param[out]	includes			Include graph containing all include files included by the BSL source.
+		 * @param[in, out]	filter			Determines which variations to compile. Receives a list of variations whose
+		 *									compilation was deferred. Sub-shaders are not compiled if the filter limits
+		 *									compilation to a single variation.
 		 * @return							A result object containing an error message if not successful.
 		 */
 		static BSLFXCompileResult compileShader(String source, const UnorderedMap<String, String>& defines, 
-				SHADER_DESC& shaderDesc, Vector<String>& includes);
+				SHADER_DESC& shaderDesc, ShaderIncludeGraph& includes, VariationFilter& filter);
 
 		/**
 		 * Uses the provided list of shaders/mixins to generate a list of techniques. A technique is generated for
@@ -261,30 +306,49 @@ namespace bs
 		 *									applied to all variations.
 		 * @param[out]	shaderDesc			Shader descriptor that resulting techniques, and non-internal parameters will be
 		 *									registered with.
-		 * @param[out]	includes			A list of all include files included by the BSL source.
+		 * @param[out]	includes			Include graph containing all include files included by the BSL source.
+		 * @param[in, out]	filter			Determines which variations to compile. Receives a list of variations whose
+		 *									compilation was deferred. Deferred variations are still parsed so their 
+		 *									parameters and includes are registered, but are not cross-compiled and
+		 *									have no techniques created.
 		 * @return							A result object containing an error message if not successful.
 		 */
 		static BSLFXCompileResult compileTechniques(const Vector<std::pair<ASTFXNode*, ShaderMetaData>>& shaderMetaData,
 			const String& source, const UnorderedMap<String, String>& defines, SHADER_DESC& shaderDesc, 
-			Vector<String>& includes);
+			ShaderIncludeGraph& includes, VariationFilter& filter);
 
 		/**
-		 * Generates a set of techniques for a single variation. Uses AST parse state as input, which must be created using
-		 * the defines of the relevant variation.
+		 * Parses the source using the defines of the variation specified in @p output, and outputs per-pass HLSL code
+		 * and reflection information for the relevant shader. Outputs a list of passes that still require cross-compilation
+		 * for other backends. Doesn't access any shared state, and can therefore be called from multiple threads at once.
 		 *
-		 * @param[in, out]	parseState	Parser state object that has previously been initialized with the AST using 
-		 *								parseFX().
-		 * @param[in]	name			Name of the shader to generate the variation for.
-		 * @param[in]	codeBlocks		Blocks containing GPU program source code that are referenced by the AST.
-		 * @param[in]	variation		Shader variation the AST was parsed with.
-		 * @param[out]	includes		Set to append newly found includes to.
-		 * @param[out]	shaderDesc		Shader descriptor that resulting techniques, and non-internal parameters will be
-		 *								registered with.
-		 * @return						A result object containing an error message if not successful.
+		 * @param[in]		source		BSL source that needs to be parsed.
+		 * @param[in]		defines		An optional set of defines to set before parsing the source, that is to be applied
+		 *								to all variations.
+		 * @param[in, out]	output		Object with the shader name and variation to parse populated, which will receive
+		 *								the parsing results.
 		 */
-		static BSLFXCompileResult compileTechniques(ParseState* parseState, const String& name, 
-			const Vector<String>& codeBlocks, const ShaderVariation& variation, UnorderedSet<String>& includes, 
-			SHADER_DESC& shaderDesc);
+		static void parseVariationSource(const String& source, const UnorderedMap<String, String>& defines, 
+			VariationOutput& output);
+
+		/**
+		 * Parses techniques for a single variation. Uses AST parse state as input, which must be created using the defines
+		 * of the relevant variation.
+		 *
+		 * @param[in, out]	parseState		Parser state object that has previously been initialized with the AST using 
+		 *									parseFX().
+		 * @param[in]		codeBlocks		Blocks containing GPU program source code that are referenced by the AST.
+		 * @param[in, out]	variationOutput	Object to output the parsed techniques, includes and reflection data to.
+		 * @return							A result object containing an error message if not successful.
+		 */
+		static BSLFXCompileResult parseTechniques(ParseState* parseState, const Vector<String>& codeBlocks, 
+			VariationOutput& variationOutput);
+
+		/** 
+		 * Creates techniques for all backends from a fully cross-compiled variation, and registers them with
+		 * @p shaderDesc. 
+		 */
+		static void createTechniques(const VariationOutput& variationOutput, SHADER_DESC& shaderDesc);
 
 		/**
 		 * Converts a null-terminated string into a standard string, and eliminates quotes that are assumed to be at the 
@@ -293,5 +357,17 @@ namespace bs
 		static String removeQuotes(const char* input);
 	};
 
+	/** Compiles shader variations that were deferred during import, using the BSL compiler. */
+	class BSLVariationCompiler : public IShaderVariationCompiler
+	{
+	public:
+		/** @copydoc IShaderVariationCompiler::compileVariation */
+		Vector<SPtr<Technique>> compileVariation(const String& name, const String& source,
+			const UnorderedMap<String, String>& defines, const ShaderVariation& variation) const override
+		{
+			return BSLFXCompiler::compileVariation(name, source, defines, variation);
+		}
+	};
+
 	/** @} */
 }
\ No newline at end of file
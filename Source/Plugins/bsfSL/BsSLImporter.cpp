@@ -44,7 +44,8 @@ namespace bs
 
 		SPtr<const ShaderImportOptions> io = std::static_pointer_cast<const ShaderImportOptions>(importOptions);
 		String shaderName = filePath.getFilename(false);
-		BSLFXCompileResult result = BSLFXCompiler::compile(shaderName, source, io->getDefines());
+		BSLFXCompileResult result = BSLFXCompiler::compile(shaderName, source, io->getDefines(), 
+			io->compileVariationsOnDemand);
 
 		if (result.shader != nullptr)
 			result.shader->setName(shaderName);
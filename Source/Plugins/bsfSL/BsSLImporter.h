@@ -30,6 +30,9 @@ namespace bs
 		/** @copydoc SpecificImporter::getAsyncMode */
 		ImporterAsyncMode getAsyncMode() const override { return ImporterAsyncMode::Single; }
 
+		/** @copydoc SpecificImporter::getImportStage */
+		ImportStage getImportStage() const override { return ImportStage::Composite; }
+
 		/** @copydoc SpecificImporter::import */
 		SPtr<Resource> import(const Path& filePath, SPtr<const ImportOptions> importOptions) override;
 
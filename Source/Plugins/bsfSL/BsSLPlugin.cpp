@@ -2,7 +2,9 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsSLPrerequisites.h"
 #include "BsSLImporter.h"
+#include "BsSLFXCompiler.h"
 #include "Importer/BsImporter.h"
+#include "Material/BsShaderManager.h"
 
 namespace bs
 {
@@ -20,6 +22,8 @@ namespace bs
 		SLImporter* importer = bs_new<SLImporter>();
 		Importer::instance()._registerAssetImporter(importer);
 
+		ShaderManager::instance().setVariationCompiler(bs_shared_ptr_new<BSLVariationCompiler>());
+
 		return nullptr;
 	}
 }
@@ -0,0 +1,209 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsVulkanBindlessTextures.h"
+#include "BsVulkanDevice.h"
+#include "BsVulkanDescriptorLayout.h"
+#include "BsVulkanTexture.h"
+#include "BsVulkanSamplerState.h"
+#include "BsVulkanCommandBuffer.h"
+
+namespace bs { namespace ct
+{
+	VulkanBindlessTextures::VulkanBindlessTextures(VulkanDevice& device, UINT32 maxTextures)
+		:mDevice(device), mMaxTextures(maxTextures)
+	{
+		VkDescriptorSetLayoutBinding binding;
+		binding.binding = 0;
+		binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		binding.descriptorCount = mMaxTextures;
+		binding.stageFlags = VK_SHADER_STAGE_ALL;
+		binding.pImmutableSamplers = nullptr;
+
+		// Slots not holding a texture are never accessed, and new textures are written while the set is in use
+		VkDescriptorBindingFlagsEXT bindingFlags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT |
+			VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT;
+
+		VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsCI;
+		bindingFlagsCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+		bindingFlagsCI.pNext = nullptr;
+		bindingFlagsCI.bindingCount = 1;
+		bindingFlagsCI.pBindingFlags = &bindingFlags;
+
+		mLayout = bs_new<VulkanDescriptorLayout>(mDevice, &binding, 1,
+			VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT, &bindingFlagsCI);
+
+		VkDescriptorPoolSize poolSize;
+		poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		poolSize.descriptorCount = mMaxTextures;
+
+		VkDescriptorPoolCreateInfo poolCI;
+		poolCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		poolCI.pNext = nullptr;
+		poolCI.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+		poolCI.maxSets = 1;
+		poolCI.poolSizeCount = 1;
+		poolCI.pPoolSizes = &poolSize;
+
+		VkResult result = vkCreateDescriptorPool(mDevice.getLogical(), &poolCI, gVulkanAllocator, &mPool);
+		assert(result == VK_SUCCESS);
+
+		VkDescriptorSetLayout layout = mLayout->getHandle();
+
+		VkDescriptorSetAllocateInfo allocateInfo;
+		allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocateInfo.pNext = nullptr;
+		allocateInfo.descriptorPool = mPool;
+		allocateInfo.descriptorSetCount = 1;
+		allocateInfo.pSetLayouts = &layout;
+
+		result = vkAllocateDescriptorSets(mDevice.getLogical(), &allocateInfo, &mSet);
+		assert(result == VK_SUCCESS);
+	}
+
+	VulkanBindlessTextures::~VulkanBindlessTextures()
+	{
+		// Set is released along with the pool
+		vkDestroyDescriptorPool(mDevice.getLogical(), mPool, gVulkanAllocator);
+		bs_delete(mLayout);
+	}
+
+	UINT32 VulkanBindlessTextures::registerTexture(VulkanTexture* texture)
+	{
+		VulkanImage* image = texture->getResource(mDevice.getIndex());
+		if (image == nullptr)
+			return (UINT32)-1;
+
+		Lock lock(mMutex);
+
+		auto iterFind = mLookup.find(texture);
+		if (iterFind != mLookup.end())
+			return iterFind->second;
+
+		UINT32 slot;
+		if (!mFreeSlots.empty())
+		{
+			slot = mFreeSlots.back();
+			mFreeSlots.pop_back();
+		}
+		else
+		{
+			if ((UINT32)mEntries.size() >= mMaxTextures)
+			{
+				LOGERR("Unable to register a bindless texture, the maximum of " + toString(mMaxTextures) +
+					" textures was reached.");
+				return (UINT32)-1;
+			}
+
+			slot = (UINT32)mEntries.size();
+			mEntries.push_back(Entry());
+		}
+
+		mEntries[slot].texture = texture;
+		mEntries[slot].image = image->getHandle();
+		mLookup[texture] = slot;
+
+		writeDescriptor(slot, image, getSampleLayout(texture));
+		return slot;
+	}
+
+	void VulkanBindlessTextures::unregisterTexture(VulkanTexture* texture)
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mLookup.find(texture);
+		if (iterFind == mLookup.end())
+			return;
+
+		UINT32 slot = iterFind->second;
+		mLookup.erase(iterFind);
+
+		// Descriptor is left as is, command buffers still executing might reference it. Partially bound descriptors are
+		// allowed to be invalid as long as they aren't accessed.
+		mEntries[slot].texture = nullptr;
+		mEntries[slot].image = VK_NULL_HANDLE;
+
+		mRetiredSlots.push_back({ slot, mFrameIdx });
+	}
+
+	void VulkanBindlessTextures::prepareForBind(VulkanCmdBuffer& buffer)
+	{
+		UINT32 deviceIdx = mDevice.getIndex();
+
+		Lock lock(mMutex);
+
+		// Note: Makes the assumption that none of the textures will be modified on another thread while being bound,
+		// same as VulkanGpuParams.
+		for (UINT32 i = 0; i < (UINT32)mEntries.size(); i++)
+		{
+			Entry& entry = mEntries[i];
+			if (entry.texture == nullptr)
+				continue;
+
+			VulkanImage* image = entry.texture->getResource(deviceIdx);
+			if (image == nullptr)
+				continue;
+
+			VkImageLayout layout = getSampleLayout(entry.texture);
+			buffer.registerResource(image, image->getRange(), layout, layout, VulkanUseFlag::Read,
+				ResourceUsage::ShaderBind);
+
+			// Internal image might change due to resource writes discarding the previous contents
+			VkImage vkImage = image->getHandle();
+			if (entry.image != vkImage)
+			{
+				entry.image = vkImage;
+				writeDescriptor(i, image, layout);
+			}
+		}
+	}
+
+	void VulkanBindlessTextures::advanceFrame()
+	{
+		Lock lock(mMutex);
+
+		mFrameIdx++;
+		for (auto iter = mRetiredSlots.begin(); iter != mRetiredSlots.end();)
+		{
+			if ((mFrameIdx - iter->frameIdx) > SLOT_REUSE_DELAY)
+			{
+				mFreeSlots.push_back(iter->slot);
+				iter = mRetiredSlots.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	void VulkanBindlessTextures::writeDescriptor(UINT32 slot, VulkanImage* image, VkImageLayout layout)
+	{
+		VulkanSamplerState* defaultSampler = static_cast<VulkanSamplerState*>(SamplerState::getDefault().get());
+
+		VkDescriptorImageInfo imageInfo;
+		imageInfo.sampler = defaultSampler->getResource(mDevice.getIndex())->getHandle();
+		imageInfo.imageView = image->getView(false);
+		imageInfo.imageLayout = layout;
+
+		VkWriteDescriptorSet writeSetInfo;
+		writeSetInfo.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		writeSetInfo.pNext = nullptr;
+		writeSetInfo.dstSet = mSet;
+		writeSetInfo.dstBinding = 0;
+		writeSetInfo.dstArrayElement = slot;
+		writeSetInfo.descriptorCount = 1;
+		writeSetInfo.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		writeSetInfo.pImageInfo = &imageInfo;
+		writeSetInfo.pBufferInfo = nullptr;
+		writeSetInfo.pTexelBufferView = nullptr;
+
+		vkUpdateDescriptorSets(mDevice.getLogical(), 1, &writeSetInfo, 0, nullptr);
+	}
+
+	VkImageLayout VulkanBindlessTextures::getSampleLayout(VulkanTexture* texture)
+	{
+		// Keep dynamic textures in general layout, so they can be easily mapped by CPU
+		if (texture->getProperties().getUsage() & TU_DYNAMIC)
+			return VK_IMAGE_LAYOUT_GENERAL;
+
+		return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	}
+}}
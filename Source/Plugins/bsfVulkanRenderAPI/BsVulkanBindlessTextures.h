@@ -0,0 +1,98 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsVulkanPrerequisites.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup Vulkan
+	 *  @{
+	 */
+
+	/**
+	 * Global array of sampled textures, contained in a single descriptor set that GPU programs index into, instead of
+	 * binding textures individually. Requires descriptor indexing support (VK_EXT_descriptor_indexing). Textures are
+	 * registered on first use and remain in the array until they are destroyed, after which their slot is re-used once
+	 * the GPU can no longer reference it.
+	 *
+	 * @note	Thread safe.
+	 */
+	class VulkanBindlessTextures
+	{
+	public:
+		/**
+		 * @param[in]	device		Device to create the texture array on.
+		 * @param[in]	maxTextures	Maximum number of textures the array can hold.
+		 */
+		VulkanBindlessTextures(VulkanDevice& device, UINT32 maxTextures);
+		~VulkanBindlessTextures();
+
+		/**
+		 * Returns the index of the provided texture in the array, registering it if needed. Returns -1 if the array is
+		 * full.
+		 */
+		UINT32 registerTexture(VulkanTexture* texture);
+
+		/** Removes the texture from the array. Called when the texture is destroyed. */
+		void unregisterTexture(VulkanTexture* texture);
+
+		/**
+		 * Registers all textures in the array with the provided command buffer, and updates the descriptors of any
+		 * textures whose internal image changed since they were last bound. Must be called whenever the set is bound.
+		 */
+		void prepareForBind(VulkanCmdBuffer& buffer);
+
+		/** Makes slots of textures destroyed a few frames ago available for re-use. Should be called once per frame. */
+		void advanceFrame();
+
+		/** Returns the layout of the descriptor set containing the texture array. */
+		VulkanDescriptorLayout* getLayout() const { return mLayout; }
+
+		/** Returns the handle of the descriptor set containing the texture array. */
+		VkDescriptorSet getHandle() const { return mSet; }
+
+		/** Upper limit on the number of textures in the array, the actual limit might be lower depending on the device. */
+		static constexpr UINT32 MAX_TEXTURES = 16384;
+
+		/** Number of frames to wait after a texture is destroyed before its slot can be assigned to another texture. */
+		static constexpr UINT32 SLOT_REUSE_DELAY = 8;
+
+	private:
+		/** Information about a single texture in the array. */
+		struct Entry
+		{
+			VulkanTexture* texture;
+			VkImage image;
+		};
+
+		/** Slot waiting for the GPU to finish using it. */
+		struct RetiredSlot
+		{
+			UINT32 slot;
+			UINT64 frameIdx;
+		};
+
+		/** Writes the descriptor for the texture in the provided slot. */
+		void writeDescriptor(UINT32 slot, VulkanImage* image, VkImageLayout layout);
+
+		/** Returns the layout the texture will be in when it is sampled. */
+		static VkImageLayout getSampleLayout(VulkanTexture* texture);
+
+		VulkanDevice& mDevice;
+		VulkanDescriptorLayout* mLayout = nullptr;
+		VkDescriptorPool mPool = VK_NULL_HANDLE;
+		VkDescriptorSet mSet = VK_NULL_HANDLE;
+		UINT32 mMaxTextures;
+
+		Vector<Entry> mEntries;
+		UnorderedMap<VulkanTexture*, UINT32> mLookup;
+		Vector<UINT32> mFreeSlots;
+		Vector<RetiredSlot> mRetiredSlots;
+		UINT64 mFrameIdx = 0;
+
+		Mutex mMutex;
+	};
+
+	/** @} */
+}}
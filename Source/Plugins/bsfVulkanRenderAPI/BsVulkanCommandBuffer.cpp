@@ -17,6 +17,8 @@
 #include "BsVulkanSwapChain.h"
 #include "BsVulkanTimerQuery.h"
 #include "BsVulkanOcclusionQuery.h"
+#include "Profiling/BsRenderStats.h"
+#include "RenderAPI/BsRenderAPI.h"
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 #include "Win32/BsWin32RenderWindow.h"
@@ -191,15 +193,19 @@ namespace bs { namespace ct
 		, mIntraQueueSemaphore(nullptr), mInterQueueSemaphores(), mNumUsedInterQueueSemaphores(0)
 		, mFramebuffer(nullptr), mRenderTargetWidth(0)
 		, mRenderTargetHeight(0), mRenderTargetReadOnlyFlags(0), mRenderTargetLoadMask(RT_NONE), mGlobalQueueIdx(-1)
-		, mViewport(0.0f, 0.0f, 1.0f, 1.0f), mScissor(0, 0, 0, 0), mStencilRef(0), mDrawOp(DOT_TRIANGLE_LIST)
-		, mNumBoundDescriptorSets(0), mGfxPipelineRequiresBind(true), mCmpPipelineRequiresBind(true)
-		, mViewportRequiresBind(true), mStencilRefRequiresBind(true), mScissorRequiresBind(true), mBoundParamsDirty(false)
+		, mViewport(0.0f, 0.0f, 1.0f, 1.0f), mScissor(0, 0, 0, 0), mStencilRef(0), mShadingRate(SR_1X1)
+		, mDrawOp(DOT_TRIANGLE_LIST), mNumBoundDescriptorSets(0), mNumBoundDynamicOffsets(0)
+		, mGfxPipelineRequiresBind(true), mCmpPipelineRequiresBind(true), mViewportRequiresBind(true), mStencilRefRequiresBind(true)
+		, mShadingRateRequiresBind(true), mScissorRequiresBind(true), mBoundParamsDirty(false)
 		, mClearValues(), mClearMask(), mSemaphoresTemp(BS_MAX_UNIQUE_QUEUES), mVertexBuffersTemp()
-		, mVertexBufferOffsetsTemp()
+		, mVertexBufferOffsetsTemp(), mQueuedBarrierSrcStages(0), mQueuedBarrierDstStages(0), mNumPipelineBarriers(0)
 	{
 		UINT32 maxBoundDescriptorSets = device.getDeviceProperties().limits.maxBoundDescriptorSets;
 		mDescriptorSetsTemp = (VkDescriptorSet*)bs_alloc(sizeof(VkDescriptorSet) * maxBoundDescriptorSets);
 
+		UINT32 maxDynamicUniformBuffers = device.getDeviceProperties().limits.maxDescriptorSetUniformBuffersDynamic;
+		mDynamicOffsetsTemp = (UINT32*)bs_alloc(sizeof(UINT32) * std::max(1U, maxDynamicUniformBuffers));
+
 		VkCommandBufferAllocateInfo cmdBufferAllocInfo;
 		cmdBufferAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
 		cmdBufferAllocInfo.pNext = nullptr;
@@ -280,6 +286,7 @@ namespace bs { namespace ct
 		vkFreeCommandBuffers(device, mPool, 1, &mCmdBuffer);
 
 		bs_free(mDescriptorSetsTemp);
+		bs_free(mDynamicOffsetsTemp);
 	}
 
 	UINT32 VulkanCmdBuffer::getDeviceIdx() const
@@ -311,6 +318,8 @@ namespace bs { namespace ct
 		if (mClearMask)
 			executeClearPass();
 
+		flushBarriers();
+
 		VkResult result = vkEndCommandBuffer(mCmdBuffer);
 		assert(result == VK_SUCCESS);
 
@@ -591,6 +600,7 @@ namespace bs { namespace ct
 								 0, 0, nullptr,
 								 numBufferBarriers, barriers.bufferBarriers.data(),
 								 numImgBarriers, barriers.imageBarriers.data());
+			mNumPipelineBarriers++;
 
 			// Find an appropriate queue to execute on
 			UINT32 otherQueueIdx = 0;
@@ -680,6 +690,7 @@ namespace bs { namespace ct
 								 0, 0, nullptr,
 								 numBufferBarriers, barriers.bufferBarriers.data(),
 								 numImgBarriers, barriers.imageBarriers.data());
+			mNumPipelineBarriers++;
 
 			cmdBuffer->end();
 			queue->queueSubmit(cmdBuffer, mSemaphoresTemp.data(), numSemaphores);
@@ -741,6 +752,9 @@ namespace bs { namespace ct
 		mQueuedLayoutTransitions.clear();
 		mBoundParams = nullptr;
 		mSwapChains.clear();
+
+		BS_ADD_RENDER_STAT(NumPipelineBarriers, mNumPipelineBarriers);
+		mNumPipelineBarriers = 0;
 	}
 
 	bool VulkanCmdBuffer::checkFenceStatus(bool block) const
@@ -807,6 +821,11 @@ namespace bs { namespace ct
 		mImageInfos.clear();
 		mSubresourceInfoStorage.clear();
 		mPassTouchedSubresourceInfos.clear();
+		mQueuedBufferBarriers.clear();
+		mQueuedImageBarriers.clear();
+		mQueuedBarrierSrcStages = 0;
+		mQueuedBarrierDstStages = 0;
+		mNumPipelineBarriers = 0;
 	}
 
 	void VulkanCmdBuffer::setRenderTarget(const SPtr<RenderTarget>& rt, UINT32 readOnlyFlags, 
@@ -1171,6 +1190,15 @@ namespace bs { namespace ct
 		mStencilRefRequiresBind = true;
 	}
 
+	void VulkanCmdBuffer::setShadingRate(ShadingRate rate)
+	{
+		if (mShadingRate == rate)
+			return;
+
+		mShadingRate = rate;
+		mShadingRateRequiresBind = true;
+	}
+
 	void VulkanCmdBuffer::setDrawOp(DrawOperationType drawOp)
 	{
 		if (mDrawOp == drawOp)
@@ -1321,6 +1349,23 @@ namespace bs { namespace ct
 			mStencilRefRequiresBind = false;
 		}
 
+		if((mShadingRateRequiresBind || forceAll) && mDevice.hasFragmentShadingRate())
+		{
+			VkExtent2D fragmentSize;
+			fragmentSize.width = (mShadingRate == SR_2X1 || mShadingRate == SR_2X2) ? 2 : 1;
+			fragmentSize.height = (mShadingRate == SR_1X2 || mShadingRate == SR_2X2) ? 2 : 1;
+
+			VkFragmentShadingRateCombinerOpKHR combinerOps[2] = 
+			{ 
+				VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR, 
+				VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR 
+			};
+
+			PFN_vkCmdSetFragmentShadingRateKHR setFragmentShadingRate = mDevice.getCmdSetFragmentShadingRate();
+			setFragmentShadingRate(mCmdBuffer, &fragmentSize, combinerOps);
+			mShadingRateRequiresBind = false;
+		}
+
 		if(mScissorRequiresBind || forceAll)
 		{
 			VkRect2D scissorRect;
@@ -1352,7 +1397,7 @@ namespace bs { namespace ct
 			if (mBoundParams != nullptr)
 			{
 				mNumBoundDescriptorSets = mBoundParams->getNumSets();
-				mBoundParams->prepareForBind(*this, mDescriptorSetsTemp);
+				mBoundParams->prepareForBind(*this, mDescriptorSetsTemp, mDynamicOffsetsTemp, mNumBoundDynamicOffsets);
 			}
 			else
 				mNumBoundDescriptorSets = 0;
@@ -1377,8 +1422,8 @@ namespace bs { namespace ct
 				if (!subresourceInfo.hasTransitioned || subresourceInfo.currentLayout == subresourceInfo.requiredLayout)
 					continue;
 
-				mLayoutTransitionBarriersTemp.push_back(VkImageMemoryBarrier());
-				VkImageMemoryBarrier& barrier = mLayoutTransitionBarriersTemp.back();
+				mQueuedImageBarriers.push_back(VkImageMemoryBarrier());
+				VkImageMemoryBarrier& barrier = mQueuedImageBarriers.back();
 				barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 				barrier.pNext = nullptr;
 				barrier.srcAccessMask = image->getAccessFlags(subresourceInfo.currentLayout);
@@ -1390,6 +1435,9 @@ namespace bs { namespace ct
 				barrier.image = image->getHandle();
 				barrier.subresourceRange = subresourceInfo.range;
 
+				mQueuedBarrierSrcStages |= getPipelineStageFlags(barrier.srcAccessMask);
+				mQueuedBarrierDstStages |= getPipelineStageFlags(barrier.dstAccessMask);
+
 				subresourceInfo.currentLayout = subresourceInfo.requiredLayout;
 				subresourceInfo.isReadOnly = true;
 				subresourceInfo.hasTransitioned = true;
@@ -1407,18 +1455,100 @@ namespace bs { namespace ct
 			createLayoutTransitionBarrier(entry.first, imageInfo);
 		}
 
-		VkPipelineStageFlags srcStage = 0;
-		VkPipelineStageFlags dstStage = 0;
-		getPipelineStageFlags(mLayoutTransitionBarriersTemp, srcStage, dstStage);
+		mQueuedLayoutTransitions.clear();
 
-		vkCmdPipelineBarrier(mCmdBuffer,
-							 srcStage, dstStage,
-							 0, 0, nullptr,
-							 0, nullptr,
-							 (UINT32)mLayoutTransitionBarriersTemp.size(), mLayoutTransitionBarriersTemp.data());
+		flushBarriers();
+	}
 
-		mQueuedLayoutTransitions.clear();
-		mLayoutTransitionBarriersTemp.clear();
+	void VulkanCmdBuffer::queueMemoryBarrier(VkBuffer buffer, VkAccessFlags srcAccessFlags, VkAccessFlags dstAccessFlags,
+		VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+	{
+		mQueuedBarrierSrcStages |= srcStage;
+		mQueuedBarrierDstStages |= dstStage;
+
+		for(auto& entry : mQueuedBufferBarriers)
+		{
+			if(entry.buffer == buffer)
+			{
+				entry.srcAccessMask |= srcAccessFlags;
+				entry.dstAccessMask |= dstAccessFlags;
+				return;
+			}
+		}
+
+		mQueuedBufferBarriers.push_back(VkBufferMemoryBarrier());
+		VkBufferMemoryBarrier& barrier = mQueuedBufferBarriers.back();
+		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		barrier.pNext = nullptr;
+		barrier.srcAccessMask = srcAccessFlags;
+		barrier.dstAccessMask = dstAccessFlags;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.buffer = buffer;
+		barrier.offset = 0;
+		barrier.size = VK_WHOLE_SIZE;
+	}
+
+	void VulkanCmdBuffer::queueMemoryBarrier(VkImage image, VkAccessFlags srcAccessFlags, VkAccessFlags dstAccessFlags,
+		VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage, VkImageLayout layout, 
+		const VkImageSubresourceRange& range)
+	{
+		mQueuedBarrierSrcStages |= srcStage;
+		mQueuedBarrierDstStages |= dstStage;
+
+		for(auto& entry : mQueuedImageBarriers)
+		{
+			// Only merge with other memory barriers, layout transitions need to stay as they are
+			if(entry.image != image || entry.oldLayout != layout || entry.newLayout != layout)
+				continue;
+
+			const VkImageSubresourceRange& entryRange = entry.subresourceRange;
+			if(entryRange.aspectMask == range.aspectMask &&
+				entryRange.baseMipLevel == range.baseMipLevel && entryRange.levelCount == range.levelCount &&
+				entryRange.baseArrayLayer == range.baseArrayLayer && entryRange.layerCount == range.layerCount)
+			{
+				entry.srcAccessMask |= srcAccessFlags;
+				entry.dstAccessMask |= dstAccessFlags;
+				return;
+			}
+		}
+
+		mQueuedImageBarriers.push_back(VkImageMemoryBarrier());
+		VkImageMemoryBarrier& barrier = mQueuedImageBarriers.back();
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.pNext = nullptr;
+		barrier.srcAccessMask = srcAccessFlags;
+		barrier.dstAccessMask = dstAccessFlags;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = image;
+		barrier.subresourceRange = range;
+		barrier.oldLayout = layout;
+		barrier.newLayout = layout;
+	}
+
+	void VulkanCmdBuffer::flushBarriers()
+	{
+		if(mQueuedBufferBarriers.empty() && mQueuedImageBarriers.empty())
+			return;
+
+		VkPipelineStageFlags srcStage = mQueuedBarrierSrcStages;
+		VkPipelineStageFlags dstStage = mQueuedBarrierDstStages;
+
+		if (srcStage == 0)
+			srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+		if (dstStage == 0)
+			dstStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+		pipelineBarrier(srcStage, dstStage,
+						(UINT32)mQueuedBufferBarriers.size(), mQueuedBufferBarriers.data(),
+						(UINT32)mQueuedImageBarriers.size(), mQueuedImageBarriers.data());
+
+		mQueuedBufferBarriers.clear();
+		mQueuedImageBarriers.clear();
+		mQueuedBarrierSrcStages = 0;
+		mQueuedBarrierDstStages = 0;
 	}
 
 	void VulkanCmdBuffer::updateFinalLayouts()
@@ -1476,10 +1606,10 @@ namespace bs { namespace ct
 		mClearMask = CLEAR_NONE;
 	}
 
-	void VulkanCmdBuffer::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
+	bool VulkanCmdBuffer::prepareForDraw()
 	{
 		if (!isReadyForRender())
-			return;
+			return false;
 
 		// Need to bind gpu params before starting render pass, in order to make sure any layout transitions execute
 		bindGpuParams();
@@ -1490,7 +1620,7 @@ namespace bs { namespace ct
 		if (mGfxPipelineRequiresBind)
 		{
 			if (!bindGraphicsPipeline())
-				return;
+				return false;
 		}
 		else
 			bindDynamicStates(false);
@@ -1503,55 +1633,96 @@ namespace bs { namespace ct
 				VkPipelineLayout pipelineLayout = mGraphicsPipeline->getPipelineLayout(deviceIdx);
 
 				vkCmdBindDescriptorSets(mCmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0,
-										mNumBoundDescriptorSets, mDescriptorSetsTemp, 0, nullptr);
+										mNumBoundDescriptorSets, mDescriptorSetsTemp, mNumBoundDynamicOffsets,
+										mDynamicOffsetsTemp);
 			}
 
 			mDescriptorSetsBindState.unset(DescriptorSetBindFlag::Graphics);
 		}
 
+		return true;
+	}
+
+	void VulkanCmdBuffer::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
+	{
+		if (!prepareForDraw())
+			return;
+
 		if (instanceCount <= 0)
 			instanceCount = 1;
 
+		// Write hazard barriers for resources written earlier in the same render pass
+		flushBarriers();
+
 		vkCmdDraw(mCmdBuffer, vertexCount, instanceCount, vertexOffset, 0);
 	}
 
 	void VulkanCmdBuffer::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 instanceCount)
 	{
-		if (!isReadyForRender())
+		if (!prepareForDraw())
 			return;
 
-		// Need to bind gpu params before starting render pass, in order to make sure any layout transitions execute
-		bindGpuParams();
+		if (instanceCount <= 0)
+			instanceCount = 1;
 
-		if (!isInRenderPass())
-			beginRenderPass();
+		// Write hazard barriers for resources written earlier in the same render pass
+		flushBarriers();
 
-		if (mGfxPipelineRequiresBind)
+		vkCmdDrawIndexed(mCmdBuffer, indexCount, instanceCount, startIndex, vertexOffset, 0);
+	}
+
+	void VulkanCmdBuffer::drawIndirect(VulkanBuffer* argsBuffer, UINT32 offset, UINT32 drawCount)
+	{
+		// Register before starting the render pass, in case a barrier is required for earlier writes to the arguments
+		registerResource(argsBuffer, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, VulkanUseFlag::Read);
+
+		if (!prepareForDraw())
+			return;
+
+		// Write hazard barriers for resources written earlier in the same render pass
+		flushBarriers();
+
+		const UINT32 stride = sizeof(DrawIndirectArgs);
+		if (mDevice.getDeviceFeatures().multiDrawIndirect)
+			vkCmdDrawIndirect(mCmdBuffer, argsBuffer->getHandle(), offset, drawCount, stride);
+		else
 		{
-			if (!bindGraphicsPipeline())
-				return;
+			for (UINT32 i = 0; i < drawCount; i++)
+				vkCmdDrawIndirect(mCmdBuffer, argsBuffer->getHandle(), offset + i * stride, 1, stride);
 		}
-		else
-			bindDynamicStates(false);
+	}
 
-		if (mDescriptorSetsBindState.isSet(DescriptorSetBindFlag::Graphics))
-		{
-			if (mNumBoundDescriptorSets > 0)
-			{
-				UINT32 deviceIdx = mDevice.getIndex();
-				VkPipelineLayout pipelineLayout = mGraphicsPipeline->getPipelineLayout(deviceIdx);
+	void VulkanCmdBuffer::drawIndexedIndirect(VulkanBuffer* argsBuffer, UINT32 offset, UINT32 drawCount,
+		VulkanBuffer* countBuffer, UINT32 countOffset)
+	{
+		// Register before starting the render pass, in case a barrier is required for earlier writes to the arguments
+		registerResource(argsBuffer, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, VulkanUseFlag::Read);
 
-				vkCmdBindDescriptorSets(mCmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0,
-										mNumBoundDescriptorSets, mDescriptorSetsTemp, 0, nullptr);
-			}
+		if (countBuffer != nullptr && mDevice.hasDrawIndirectCount())
+			registerResource(countBuffer, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, VulkanUseFlag::Read);
+		else
+			countBuffer = nullptr;
 
-			mDescriptorSetsBindState.unset(DescriptorSetBindFlag::Graphics);
-		}
+		if (!prepareForDraw())
+			return;
 
-		if (instanceCount <= 0)
-			instanceCount = 1;
+		// Write hazard barriers for resources written earlier in the same render pass
+		flushBarriers();
 
-		vkCmdDrawIndexed(mCmdBuffer, indexCount, instanceCount, startIndex, vertexOffset, 0);
+		const UINT32 stride = sizeof(DrawIndexedIndirectArgs);
+		if (countBuffer != nullptr)
+		{
+			PFN_vkCmdDrawIndexedIndirectCountKHR drawIndirectCount = mDevice.getCmdDrawIndexedIndirectCount();
+			drawIndirectCount(mCmdBuffer, argsBuffer->getHandle(), offset, countBuffer->getHandle(),
+				countOffset, drawCount, stride);
+		}
+		else if (mDevice.getDeviceFeatures().multiDrawIndirect)
+			vkCmdDrawIndexedIndirect(mCmdBuffer, argsBuffer->getHandle(), offset, drawCount, stride);
+		else
+		{
+			for (UINT32 i = 0; i < drawCount; i++)
+				vkCmdDrawIndexedIndirect(mCmdBuffer, argsBuffer->getHandle(), offset + i * stride, 1, stride);
+		}
 	}
 
 	void VulkanCmdBuffer::dispatch(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ)
@@ -1590,12 +1761,14 @@ namespace bs { namespace ct
 			{
 				VkPipelineLayout pipelineLayout = mComputePipeline->getPipelineLayout(deviceIdx);
 				vkCmdBindDescriptorSets(mCmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0,
-										mNumBoundDescriptorSets, mDescriptorSetsTemp, 0, nullptr);
+										mNumBoundDescriptorSets, mDescriptorSetsTemp, mNumBoundDynamicOffsets,
+										mDynamicOffsetsTemp);
 			}
 
 			mDescriptorSetsBindState.unset(DescriptorSetBindFlag::Compute);
 		}
 
+		flushBarriers();
 		vkCmdDispatch(mCmdBuffer, numGroupsX, numGroupsY, numGroupsZ);
 
 		// Update any layout transitions that were performed by subpass dependencies, reset flags that signal image usage
@@ -1644,12 +1817,7 @@ namespace bs { namespace ct
 		barrier.offset = 0;
 		barrier.size = VK_WHOLE_SIZE;
 
-		vkCmdPipelineBarrier(getHandle(),
-							 srcStage,
-							 dstStage,
-							 0, 0, nullptr,
-							 1, &barrier,
-							 0, nullptr);
+		pipelineBarrier(srcStage, dstStage, 1, &barrier, 0, nullptr);
 	}
 
 	void VulkanCmdBuffer::memoryBarrier(VkImage image, VkAccessFlags srcAccessFlags, VkAccessFlags dstAccessFlags,
@@ -1668,12 +1836,7 @@ namespace bs { namespace ct
 		barrier.oldLayout = layout;
 		barrier.newLayout = layout;
 
-		vkCmdPipelineBarrier(getHandle(),
-							 srcStage,
-							 dstStage,
-							 0, 0, nullptr,
-							 0, nullptr,
-							 1, &barrier);
+		pipelineBarrier(srcStage, dstStage, 0, nullptr, 1, &barrier);
 	}
 
 	void VulkanCmdBuffer::setLayout(VkImage image, VkAccessFlags srcAccessFlags, VkAccessFlags dstAccessFlags,
@@ -1694,12 +1857,20 @@ namespace bs { namespace ct
 		VkPipelineStageFlags srcStage = getPipelineStageFlags(srcAccessFlags);
 		VkPipelineStageFlags dstStage = getPipelineStageFlags(dstAccessFlags);
 		
-		vkCmdPipelineBarrier(getHandle(),
-							 srcStage,
-							 dstStage,
+		pipelineBarrier(srcStage, dstStage, 0, nullptr, 1, &barrier);
+	}
+
+	void VulkanCmdBuffer::pipelineBarrier(VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage, 
+		UINT32 numBufferBarriers, const VkBufferMemoryBarrier* bufferBarriers, UINT32 numImageBarriers, 
+		const VkImageMemoryBarrier* imageBarriers)
+	{
+		vkCmdPipelineBarrier(mCmdBuffer,
+							 srcStage, dstStage,
 							 0, 0, nullptr,
-							 0, nullptr,
-							 1, &barrier);
+							 numBufferBarriers, bufferBarriers,
+							 numImageBarriers, imageBarriers);
+
+		mNumPipelineBarriers++;
 	}
 
 	VkImageLayout VulkanCmdBuffer::getCurrentLayout(VulkanImage* image, const VkImageSubresourceRange& range, 
@@ -2038,7 +2209,8 @@ namespace bs { namespace ct
 			// If the buffer was written to previously in this pass, and is now being used by a shader we need to issue
 			// a barrier to make those writes visible.
 			bool isShaderRead = (accessFlags & VK_ACCESS_SHADER_READ_BIT) != 0;
-			if(bufferInfo.needsBarrier && (isShaderRead || isShaderWrite))
+			bool isIndirectRead = (accessFlags & VK_ACCESS_INDIRECT_COMMAND_READ_BIT) != 0;
+			if(bufferInfo.needsBarrier && (isShaderRead || isShaderWrite || isIndirectRead))
 			{
 				// Need to end render pass in order to execute the barrier. Hopefully this won't trigger much since most
 				// shader writes are done during compute
@@ -2053,8 +2225,12 @@ namespace bs { namespace ct
 					VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
 					VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
 
+				VkPipelineStageFlags dstStages = stages;
+				if (isIndirectRead)
+					dstStages |= VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+
 				VkBuffer buffer = res->getHandle();
-				memoryBarrier(buffer, VK_ACCESS_SHADER_WRITE_BIT, accessFlags, stages, stages);
+				queueMemoryBarrier(buffer, VK_ACCESS_SHADER_WRITE_BIT, accessFlags, stages, dstStages);
 
 				bufferInfo.needsBarrier = isShaderWrite;
 			}
@@ -2268,9 +2444,9 @@ namespace bs { namespace ct
 					VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
 					VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
 
-				memoryBarrier(image->getHandle(), VK_ACCESS_SHADER_WRITE_BIT, 
-							  image->getAccessFlags(subresourceInfo.requiredLayout, !isWrite),
-							  stages, stages, subresourceInfo.requiredLayout, subresourceInfo.range);
+				queueMemoryBarrier(image->getHandle(), VK_ACCESS_SHADER_WRITE_BIT, 
+								   image->getAccessFlags(subresourceInfo.requiredLayout, !isWrite),
+								   stages, stages, subresourceInfo.requiredLayout, subresourceInfo.range);
 
 				subresourceInfo.needsBarrier = isWrite;
 			}
@@ -2386,6 +2562,8 @@ namespace bs { namespace ct
 
 		UINT32 queueFamily = mDevice.getQueueFamily(mType);
 		mBuffer = pool.getBuffer(queueFamily, mIsSecondary);
+
+		mBoundState.reset();
 	}
 
 	void VulkanCommandBuffer::submit(UINT32 syncMask)
@@ -288,6 +288,12 @@ namespace bs { namespace ct
 		/** Sets a stencil reference value that will be used for comparisons in stencil operations, if enabled. */
 		void setStencilRef(UINT32 value);
 
+		/** 
+		 * Sets the size of the pixel block shaded by a single fragment program invocation. Ignored if the device doesn't
+		 * support VK_KHR_fragment_shading_rate.
+		 */
+		void setShadingRate(ShadingRate rate);
+
 		/** Changes how are primitives interpreted as during rendering. */
 		void setDrawOp(DrawOperationType drawOp);
 
@@ -306,6 +312,20 @@ namespace bs { namespace ct
 		/** Executes a draw command using the currently bound graphics pipeline, index & vertex buffer and render target. */
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 instanceCount);
 
+		/** 
+		 * Executes one or multiple draw commands whose parameters are read from @p argsBuffer, starting at @p offset. 
+		 * Arguments must be tightly packed DrawIndirectArgs structures.
+		 */
+		void drawIndirect(VulkanBuffer* argsBuffer, UINT32 offset, UINT32 drawCount);
+
+		/** 
+		 * Executes one or multiple indexed draw commands whose parameters are read from @p argsBuffer, starting at 
+		 * @p offset. Arguments must be tightly packed DrawIndexedIndirectArgs structures. If @p countBuffer is provided
+		 * and the device supports it, the number of draws is read from it at @p countOffset, clamped to @p drawCount.
+		 */
+		void drawIndexedIndirect(VulkanBuffer* argsBuffer, UINT32 offset, UINT32 drawCount, VulkanBuffer* countBuffer, 
+			UINT32 countOffset);
+
 		/** Executes a dispatch command using the currently bound compute pipeline. */
 		void dispatch(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ);
 
@@ -343,6 +363,13 @@ namespace bs { namespace ct
 		void setLayout(VkImage image, VkAccessFlags srcAccessFlags, VkAccessFlags dstAccessFlags, 
 			VkImageLayout oldLayout, VkImageLayout newLayout, const VkImageSubresourceRange& range);
 
+		/** 
+		 * Issues a single pipeline barrier containing all the provided buffer and image barriers. See 
+		 * vkCmdPipelineBarrier in Vulkan spec. for usage information.
+		 */
+		void pipelineBarrier(VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage, UINT32 numBufferBarriers,
+			const VkBufferMemoryBarrier* bufferBarriers, UINT32 numImageBarriers, const VkImageMemoryBarrier* imageBarriers);
+
 		/**
 		 * Returns the current layout of the specified image, as seen by this command buffer. This is different from the
 		 * global layout stored in VulkanImage itself, as it includes any transitions performed by the command buffer
@@ -435,6 +462,12 @@ namespace bs { namespace ct
 		/** Binds the currently stored GPU parameters object, if dirty. */
 		void bindGpuParams();
 
+		/** 
+		 * Binds the GPU parameters, pipeline and descriptor sets, and starts the render pass if needed, in preparation
+		 * for a draw call. Returns false if the draw cannot be executed.
+		 */
+		bool prepareForDraw();
+
 		/** Clears the specified area of the currently bound render target. */
 		void clearViewport(const Rect2I& area, UINT32 buffers, const Color& color, float depth, UINT16 stencil, 
 			UINT8 targetMask);
@@ -442,9 +475,33 @@ namespace bs { namespace ct
 		/** Starts and ends a render pass, intended only for a clear operation. */
 		void executeClearPass();
 
-		/** Executes any queued layout transitions by issuing a pipeline barrier. */
+		/** 
+		 * Executes any queued layout transitions, along with any other queued memory barriers, by issuing a single 
+		 * pipeline barrier.
+		 */
 		void executeLayoutTransitions();
 
+		/** 
+		 * Queues a memory barrier on the provided buffer, to be executed on the next call to flushBarriers(). If a barrier
+		 * for the same buffer is already queued the two barriers are merged.
+		 */
+		void queueMemoryBarrier(VkBuffer buffer, VkAccessFlags srcAccessFlags, VkAccessFlags dstAccessFlags,
+			VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage);
+
+		/** 
+		 * Queues a memory barrier on the provided image sub-resource range, to be executed on the next call to 
+		 * flushBarriers(). If a barrier for the same range is already queued the two barriers are merged.
+		 */
+		void queueMemoryBarrier(VkImage image, VkAccessFlags srcAccessFlags, VkAccessFlags dstAccessFlags,
+			VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage, VkImageLayout layout, 
+			const VkImageSubresourceRange& range);
+
+		/** 
+		 * Issues all barriers queued by queueMemoryBarrier() and executeLayoutTransitions() as a single pipeline barrier,
+		 * using combined stage masks of all the barriers. Does nothing if no barriers are queued.
+		 */
+		void flushBarriers();
+
 		/** 
 		 * Updates final layouts for images used by the current framebuffer, reflecting layout changes performed by render
 		 * pass' automatic layout transitions. 
@@ -501,12 +558,15 @@ namespace bs { namespace ct
 		Rect2 mViewport;
 		Rect2I mScissor;
 		UINT32 mStencilRef;
+		ShadingRate mShadingRate;
 		DrawOperationType mDrawOp;
 		UINT32 mNumBoundDescriptorSets;
+		UINT32 mNumBoundDynamicOffsets;
 		bool mGfxPipelineRequiresBind : 1;
 		bool mCmpPipelineRequiresBind : 1;
 		bool mViewportRequiresBind : 1;
 		bool mStencilRefRequiresBind : 1;
+		bool mShadingRateRequiresBind : 1;
 		bool mScissorRequiresBind : 1;
 		bool mBoundParamsDirty : 1;
 		DescriptorSetBindFlags mDescriptorSetsBindState;
@@ -520,9 +580,14 @@ namespace bs { namespace ct
 		VkBuffer mVertexBuffersTemp[BS_MAX_BOUND_VERTEX_BUFFERS];
 		VkDeviceSize mVertexBufferOffsetsTemp[BS_MAX_BOUND_VERTEX_BUFFERS];
 		VkDescriptorSet* mDescriptorSetsTemp;
+		UINT32* mDynamicOffsetsTemp;
 		UnorderedMap<UINT32, TransitionInfo> mTransitionInfoTemp;
-		Vector<VkImageMemoryBarrier> mLayoutTransitionBarriersTemp;
 		UnorderedMap<VulkanImage*, UINT32> mQueuedLayoutTransitions;
+		Vector<VkBufferMemoryBarrier> mQueuedBufferBarriers;
+		Vector<VkImageMemoryBarrier> mQueuedImageBarriers;
+		VkPipelineStageFlags mQueuedBarrierSrcStages;
+		VkPipelineStageFlags mQueuedBarrierDstStages;
+		UINT32 mNumPipelineBarriers;
 		Vector<VulkanEvent*> mQueuedEvents;
 		Vector<VulkanQuery*> mQueuedQueryResets;
 		UnorderedSet<VulkanSwapChain*> mSwapChains;
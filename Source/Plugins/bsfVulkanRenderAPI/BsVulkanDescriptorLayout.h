@@ -14,7 +14,17 @@ namespace bs { namespace ct
 	class VulkanDescriptorLayout
 	{
 	public:
-		VulkanDescriptorLayout(VulkanDevice& device, VkDescriptorSetLayoutBinding* bindings, UINT32 numBindings);
+		/**
+		 * Creates a new descriptor set layout.
+		 *
+		 * @param[in]	device		Device to create the layout on.
+		 * @param[in]	bindings	Bindings contained in the layout.
+		 * @param[in]	numBindings	Number of entries in the @p bindings array.
+		 * @param[in]	flags		Optional flags used when creating the layout.
+		 * @param[in]	next		Optional extension structure chained to the layout create info.
+		 */
+		VulkanDescriptorLayout(VulkanDevice& device, VkDescriptorSetLayoutBinding* bindings, UINT32 numBindings,
+			VkDescriptorSetLayoutCreateFlags flags = 0, const void* next = nullptr);
 		~VulkanDescriptorLayout();
 
 		/** Returns a handle to the Vulkan set layout object. */
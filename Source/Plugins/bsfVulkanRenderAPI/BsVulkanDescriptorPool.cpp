@@ -5,33 +5,36 @@
 
 namespace bs { namespace ct
 {
-	VulkanDescriptorPool::VulkanDescriptorPool(VulkanDevice& device)
-		:mDevice(device)
+	VulkanDescriptorPool::VulkanDescriptorPool(VulkanDevice& device, UINT32 sizeScale, bool freeable)
+		:mDevice(device), mSizeScale(sizeScale)
 	{
-		VkDescriptorPoolSize poolSizes[6];
+		VkDescriptorPoolSize poolSizes[7];
 		poolSizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-		poolSizes[0].descriptorCount = sMaxSampledImages;
+		poolSizes[0].descriptorCount = sMaxSampledImages * sizeScale;
 
 		poolSizes[1].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-		poolSizes[1].descriptorCount = sMaxUniformBuffers;
+		poolSizes[1].descriptorCount = sMaxUniformBuffers * sizeScale;
 
 		poolSizes[2].type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-		poolSizes[2].descriptorCount = sMaxImages;
+		poolSizes[2].descriptorCount = sMaxImages * sizeScale;
 
 		poolSizes[3].type = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
-		poolSizes[3].descriptorCount = sMaxSampledBuffers;
+		poolSizes[3].descriptorCount = sMaxSampledBuffers * sizeScale;
 
 		poolSizes[4].type = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
-		poolSizes[4].descriptorCount = sMaxBuffers;
+		poolSizes[4].descriptorCount = sMaxBuffers * sizeScale;
 
 		poolSizes[5].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-		poolSizes[5].descriptorCount = sMaxBuffers;
+		poolSizes[5].descriptorCount = sMaxBuffers * sizeScale;
+
+		poolSizes[6].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+		poolSizes[6].descriptorCount = sMaxUniformBuffers * sizeScale;
 
 		VkDescriptorPoolCreateInfo poolCI;
 		poolCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
 		poolCI.pNext = nullptr;
-		poolCI.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
-		poolCI.maxSets = sMaxSets;
+		poolCI.flags = freeable ? VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT : 0;
+		poolCI.maxSets = sMaxSets * sizeScale;
 		poolCI.poolSizeCount = sizeof(poolSizes)/sizeof(poolSizes[0]);
 		poolCI.pPoolSizes = poolSizes;
 
@@ -43,4 +46,31 @@ namespace bs { namespace ct
 	{
 		vkDestroyDescriptorPool(mDevice.getLogical(), mPool, gVulkanAllocator);
 	}
+
+	VulkanTransientDescriptorPool::VulkanTransientDescriptorPool(VulkanResourceManager* owner, UINT32 sizeScale)
+		:VulkanResource(owner, true), mPool(owner->getDevice(), sizeScale, false)
+	{ }
+
+	VkDescriptorSet VulkanTransientDescriptorPool::allocate(VkDescriptorSetLayout layout)
+	{
+		VkDescriptorSetAllocateInfo allocateInfo;
+		allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocateInfo.pNext = nullptr;
+		allocateInfo.descriptorPool = mPool.getHandle();
+		allocateInfo.descriptorSetCount = 1;
+		allocateInfo.pSetLayouts = &layout;
+
+		VkDescriptorSet set;
+		VkResult result = vkAllocateDescriptorSets(mOwner->getDevice().getLogical(), &allocateInfo, &set);
+		if (result < 0)
+			return VK_NULL_HANDLE;
+
+		return set;
+	}
+
+	void VulkanTransientDescriptorPool::reset()
+	{
+		VkResult result = vkResetDescriptorPool(mOwner->getDevice().getLogical(), mPool.getHandle(), 0);
+		assert(result == VK_SUCCESS);
+	}
 }}
\ No newline at end of file
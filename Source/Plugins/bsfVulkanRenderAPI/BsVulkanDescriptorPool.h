@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsVulkanPrerequisites.h"
+#include "BsVulkanResource.h"
 
 namespace bs { namespace ct
 {
@@ -14,12 +15,24 @@ namespace bs { namespace ct
 	class VulkanDescriptorPool
 	{
 	public:
-		VulkanDescriptorPool(VulkanDevice& device);
+		/**
+		 * Creates a new descriptor pool.
+		 *
+		 * @param[in]	device		Device to create the pool on.
+		 * @param[in]	sizeScale	Multiplier applied to the default maximum number of sets and descriptors of each type
+		 *							the pool can hold.
+		 * @param[in]	freeable	If true, sets allocated from the pool can be freed individually. If false sets can
+		 *							only be released by resetting the entire pool.
+		 */
+		VulkanDescriptorPool(VulkanDevice& device, UINT32 sizeScale = 1, bool freeable = true);
 		~VulkanDescriptorPool();
 
 		/** Returns a handle to the internal Vulkan descriptor pool. */
 		VkDescriptorPool getHandle() const { return mPool; }
 
+		/** Returns the multiplier the pool size was created with. */
+		UINT32 getSizeScale() const { return mSizeScale; }
+
 	private:
 		static const UINT32 sMaxSets = 8192;
 		static const UINT32 sMaxSampledImages = 4096;
@@ -30,6 +43,30 @@ namespace bs { namespace ct
 
 		VulkanDevice& mDevice;
 		VkDescriptorPool mPool;
+		UINT32 mSizeScale;
+	};
+
+	/** 
+	 * Descriptor pool used for allocating descriptor sets that are only used during a single frame. Sets are never freed
+	 * individually, instead the entire pool is reset once the GPU is done with all the command buffers that used it.
+	 * Command buffers using a set allocated from this pool must register the pool as a resource.
+	 */
+	class VulkanTransientDescriptorPool : public VulkanResource
+	{
+	public:
+		VulkanTransientDescriptorPool(VulkanResourceManager* owner, UINT32 sizeScale);
+
+		/** Allocates a new descriptor set with the provided layout. Returns null if the pool is out of space. */
+		VkDescriptorSet allocate(VkDescriptorSetLayout layout);
+
+		/** Releases all sets allocated from the pool. Caller must ensure the pool is not used by the GPU. */
+		void reset();
+
+		/** Returns the multiplier the pool size was created with. */
+		UINT32 getSizeScale() const { return mPool.getSizeScale(); }
+
+	private:
+		VulkanDescriptorPool mPool;
 	};
 
 	/** @} */
@@ -5,12 +5,33 @@
 #include "BsVulkanCommandBuffer.h"
 #include "Managers/BsVulkanDescriptorManager.h"
 #include "Managers/BsVulkanQueryManager.h"
+#include "BsVulkanUniformRingBuffer.h"
+#include "BsVulkanStagingBufferPool.h"
+#include "BsVulkanBindlessTextures.h"
+#include "BsVulkanRenderAPI.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include <iomanip>
 
 #define VMA_IMPLEMENTATION
 #include "ThirdParty/vk_mem_alloc.h"
 
 namespace bs { namespace ct
 {
+	/** Identifies pipeline cache files written by VulkanDevice::savePipelineCache(). Spells 'BSPC'. */
+	static constexpr UINT32 PIPELINE_CACHE_MAGIC = 0x43505342;
+
+	/** Header written in front of the pipeline cache data in the files written by VulkanDevice::savePipelineCache(). */
+	struct PipelineCacheFileHeader
+	{
+		UINT32 magic;
+		UINT32 vendorID;
+		UINT32 deviceID;
+		UINT32 driverVersion;
+		UINT8 pipelineCacheUUID[VK_UUID_SIZE];
+		UINT64 dataSize;
+	};
+
 	VulkanDevice::VulkanDevice(VkPhysicalDevice device, UINT32 deviceIdx)
 		: mPhysicalDevice(device), mLogicalDevice(nullptr), mIsPrimary(false), mDeviceIdx(deviceIdx), mQueueInfos()
 	{
@@ -22,6 +43,15 @@ namespace bs { namespace ct
 		vkGetPhysicalDeviceFeatures(device, &mDeviceFeatures);
 		vkGetPhysicalDeviceMemoryProperties(device, &mMemoryProperties);
 
+		for (uint32_t i = 0; i < mMemoryProperties.memoryTypeCount; i++)
+		{
+			if ((mMemoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0)
+			{
+				mIsTileBased = true;
+				break;
+			}
+		}
+
 		uint32_t numQueueFamilies;
 		vkGetPhysicalDeviceQueueFamilyProperties(device, &numQueueFamilies, nullptr);
 
@@ -81,7 +111,7 @@ namespace bs { namespace ct
 		}
 
 		// Set up extensions
-		const char* extensions[5];
+		const char* extensions[13];
 		uint32_t numExtensions = 0;
 
 		extensions[numExtensions++] = VK_KHR_SWAPCHAIN_EXTENSION_NAME;
@@ -91,6 +121,14 @@ namespace bs { namespace ct
 		// Enumerate supported extensions
 		bool dedicatedAllocExt = false;
 		bool getMemReqExt = false;
+		bool descriptorIndexingExt = false;
+		bool maintenance3Ext = false;
+		bool drawIndirectCountExt = false;
+		bool fragmentShadingRateExt = false;
+		bool createRenderPass2Ext = false;
+		bool multiviewExt = false;
+		bool presentIdExt = false;
+		bool presentWaitExt = false;
 
 		uint32_t numAvailableExtensions = 0;
 		vkEnumerateDeviceExtensionProperties(device, nullptr, &numAvailableExtensions, nullptr);
@@ -112,12 +150,163 @@ namespace bs { namespace ct
 						getMemReqExt = true;
 					}
 				}
+
+				for (auto& entry : availableExtensions)
+				{
+					if (strcmp(entry.extensionName, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) == 0)
+						descriptorIndexingExt = true;
+					else if (strcmp(entry.extensionName, VK_KHR_MAINTENANCE3_EXTENSION_NAME) == 0)
+						maintenance3Ext = true;
+					else if (strcmp(entry.extensionName, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME) == 0)
+						drawIndirectCountExt = true;
+					else if (strcmp(entry.extensionName, VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME) == 0)
+						fragmentShadingRateExt = true;
+					else if (strcmp(entry.extensionName, VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME) == 0)
+						createRenderPass2Ext = true;
+					else if (strcmp(entry.extensionName, VK_KHR_MULTIVIEW_EXTENSION_NAME) == 0)
+						multiviewExt = true;
+					else if (strcmp(entry.extensionName, VK_KHR_PRESENT_ID_EXTENSION_NAME) == 0)
+						presentIdExt = true;
+					else if (strcmp(entry.extensionName, VK_KHR_PRESENT_WAIT_EXTENSION_NAME) == 0)
+						presentWaitExt = true;
+				}
 			}
 		}
 
+		// Check if the device supports the descriptor indexing features required by bindless textures. Querying them
+		// requires the VK_KHR_get_physical_device_properties2 instance extension.
+		VkPhysicalDeviceDescriptorIndexingFeaturesEXT indexingFeatures = {};
+		indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+
+		VkPhysicalDeviceDescriptorIndexingPropertiesEXT indexingProperties = {};
+		indexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+
+		bool supportsBindless = false;
+		if (descriptorIndexingExt && maintenance3Ext && vkGetPhysicalDeviceFeatures2KHR != nullptr && 
+			vkGetPhysicalDeviceProperties2KHR != nullptr)
+		{
+			VkPhysicalDeviceFeatures2KHR features2 = {};
+			features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+			features2.pNext = &indexingFeatures;
+			vkGetPhysicalDeviceFeatures2KHR(device, &features2);
+
+			VkPhysicalDeviceProperties2KHR properties2 = {};
+			properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+			properties2.pNext = &indexingProperties;
+			vkGetPhysicalDeviceProperties2KHR(device, &properties2);
+
+			supportsBindless = indexingFeatures.shaderSampledImageArrayNonUniformIndexing &&
+				indexingFeatures.descriptorBindingSampledImageUpdateAfterBind &&
+				indexingFeatures.descriptorBindingUpdateUnusedWhilePending &&
+				indexingFeatures.descriptorBindingPartiallyBound &&
+				indexingFeatures.runtimeDescriptorArray;
+		}
+
+		// Check if the device supports changing the shading rate per draw call
+		VkPhysicalDeviceFragmentShadingRateFeaturesKHR shadingRateFeatures = {};
+		shadingRateFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
+
+		bool supportsShadingRate = false;
+		if (fragmentShadingRateExt && createRenderPass2Ext && multiviewExt && vkGetPhysicalDeviceFeatures2KHR != nullptr)
+		{
+			VkPhysicalDeviceFeatures2KHR features2 = {};
+			features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+			features2.pNext = &shadingRateFeatures;
+			vkGetPhysicalDeviceFeatures2KHR(device, &features2);
+
+			supportsShadingRate = shadingRateFeatures.pipelineFragmentShadingRate == VK_TRUE;
+		}
+
+		// Check if the device supports waiting until a specific present is displayed, used for frame pacing
+		VkPhysicalDevicePresentIdFeaturesKHR presentIdFeatures = {};
+		presentIdFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+
+		VkPhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures = {};
+		presentWaitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+
+		bool supportsPresentWait = false;
+		if (presentIdExt && presentWaitExt && vkGetPhysicalDeviceFeatures2KHR != nullptr)
+		{
+			presentIdFeatures.pNext = &presentWaitFeatures;
+
+			VkPhysicalDeviceFeatures2KHR features2 = {};
+			features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+			features2.pNext = &presentIdFeatures;
+			vkGetPhysicalDeviceFeatures2KHR(device, &features2);
+
+			supportsPresentWait = presentIdFeatures.presentId == VK_TRUE && presentWaitFeatures.presentWait == VK_TRUE;
+		}
+
+		// Only enable the features we use
+		VkPhysicalDeviceDescriptorIndexingFeaturesEXT enabledIndexingFeatures = {};
+		enabledIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+
+		if (supportsBindless)
+		{
+			extensions[numExtensions++] = VK_KHR_MAINTENANCE3_EXTENSION_NAME;
+			extensions[numExtensions++] = VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME;
+
+			enabledIndexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+			enabledIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+			enabledIndexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+			enabledIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+			enabledIndexingFeatures.runtimeDescriptorArray = VK_TRUE;
+		}
+
+		VkPhysicalDeviceFragmentShadingRateFeaturesKHR enabledShadingRateFeatures = {};
+		enabledShadingRateFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
+
+		if (supportsShadingRate)
+		{
+			extensions[numExtensions++] = VK_KHR_MULTIVIEW_EXTENSION_NAME;
+			extensions[numExtensions++] = VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME;
+			extensions[numExtensions++] = VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME;
+
+			enabledShadingRateFeatures.pipelineFragmentShadingRate = VK_TRUE;
+		}
+
+		if (drawIndirectCountExt)
+			extensions[numExtensions++] = VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME;
+
+		VkPhysicalDevicePresentIdFeaturesKHR enabledPresentIdFeatures = {};
+		enabledPresentIdFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+
+		VkPhysicalDevicePresentWaitFeaturesKHR enabledPresentWaitFeatures = {};
+		enabledPresentWaitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+
+		if (supportsPresentWait)
+		{
+			extensions[numExtensions++] = VK_KHR_PRESENT_ID_EXTENSION_NAME;
+			extensions[numExtensions++] = VK_KHR_PRESENT_WAIT_EXTENSION_NAME;
+
+			enabledPresentIdFeatures.presentId = VK_TRUE;
+			enabledPresentWaitFeatures.presentWait = VK_TRUE;
+		}
+
+		// Chain the extension feature structures
+		void* enabledFeaturesChain = nullptr;
+		if (supportsShadingRate)
+		{
+			enabledShadingRateFeatures.pNext = enabledFeaturesChain;
+			enabledFeaturesChain = &enabledShadingRateFeatures;
+		}
+
+		if (supportsBindless)
+		{
+			enabledIndexingFeatures.pNext = enabledFeaturesChain;
+			enabledFeaturesChain = &enabledIndexingFeatures;
+		}
+
+		if (supportsPresentWait)
+		{
+			enabledPresentIdFeatures.pNext = enabledFeaturesChain;
+			enabledPresentWaitFeatures.pNext = &enabledPresentIdFeatures;
+			enabledFeaturesChain = &enabledPresentWaitFeatures;
+		}
+
 		VkDeviceCreateInfo deviceInfo;
 		deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-		deviceInfo.pNext = nullptr;
+		deviceInfo.pNext = enabledFeaturesChain;
 		deviceInfo.flags = 0;
 		deviceInfo.queueCreateInfoCount = (uint32_t)queueCreateInfos.size();
 		deviceInfo.pQueueCreateInfos = queueCreateInfos.data();
@@ -130,6 +319,21 @@ namespace bs { namespace ct
 		VkResult result = vkCreateDevice(device, &deviceInfo, gVulkanAllocator, &mLogicalDevice);
 		assert(result == VK_SUCCESS);
 
+		if (drawIndirectCountExt)
+		{
+			mCmdDrawIndexedIndirectCount = (PFN_vkCmdDrawIndexedIndirectCountKHR)vkGetDeviceProcAddr(mLogicalDevice,
+				"vkCmdDrawIndexedIndirectCountKHR");
+		}
+
+		if (supportsShadingRate)
+		{
+			mCmdSetFragmentShadingRate = (PFN_vkCmdSetFragmentShadingRateKHR)vkGetDeviceProcAddr(mLogicalDevice,
+				"vkCmdSetFragmentShadingRateKHR");
+		}
+
+		if (supportsPresentWait)
+			mWaitForPresent = (PFN_vkWaitForPresentKHR)vkGetDeviceProcAddr(mLogicalDevice, "vkWaitForPresentKHR");
+
 		// Retrieve queues
 		for(UINT32 i = 0; i < GQT_COUNT; i++)
 		{
@@ -159,6 +363,34 @@ namespace bs { namespace ct
 		mQueryPool = bs_new<VulkanQueryPool>(*this);
 		mDescriptorManager = bs_new<VulkanDescriptorManager>(*this);
 		mResourceManager = bs_new<VulkanResourceManager>(*this);
+		mUniformRingBuffer = bs_new<VulkanUniformRingBuffer>(*this);
+		mStagingBufferPool = bs_new<VulkanStagingBufferPool>(*this);
+
+		if (supportsBindless)
+		{
+			UINT32 maxBindlessTextures = VulkanBindlessTextures::MAX_TEXTURES;
+			maxBindlessTextures = std::min(maxBindlessTextures,
+				indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages);
+			maxBindlessTextures = std::min(maxBindlessTextures,
+				indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages);
+			maxBindlessTextures = std::min(maxBindlessTextures,
+				indexingProperties.maxDescriptorSetUpdateAfterBindSamplers);
+			maxBindlessTextures = std::min(maxBindlessTextures,
+				indexingProperties.maxPerStageDescriptorUpdateAfterBindSamplers);
+
+			mBindlessTextures = bs_new<VulkanBindlessTextures>(*this, maxBindlessTextures);
+		}
+
+		// Create an empty pipeline cache, contents can later be provided through loadPipelineCache()
+		VkPipelineCacheCreateInfo pipelineCacheCI;
+		pipelineCacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		pipelineCacheCI.pNext = nullptr;
+		pipelineCacheCI.flags = 0;
+		pipelineCacheCI.initialDataSize = 0;
+		pipelineCacheCI.pInitialData = nullptr;
+
+		result = vkCreatePipelineCache(mLogicalDevice, &pipelineCacheCI, gVulkanAllocator, &mPipelineCache);
+		assert(result == VK_SUCCESS);
 	}
 
 	VulkanDevice::~VulkanDevice()
@@ -175,17 +407,117 @@ namespace bs { namespace ct
 			}
 		}
 
+		if (mBindlessTextures != nullptr)
+			bs_delete(mBindlessTextures);
+
+		bs_delete(mStagingBufferPool);
+		bs_delete(mUniformRingBuffer);
 		bs_delete(mDescriptorManager);
 		bs_delete(mQueryPool);
 		bs_delete(mCommandBufferPool);
 
 		// Needs to happen after query pool & command buffer pool shutdown, to ensure their resources are destroyed
 		bs_delete(mResourceManager);
+
+		vkDestroyPipelineCache(mLogicalDevice, mPipelineCache, gVulkanAllocator);
 		
 		vmaDestroyAllocator(mAllocator);
 		vkDestroyDevice(mLogicalDevice, gVulkanAllocator);
 	}
 
+	void VulkanDevice::loadPipelineCache(const Path& folder)
+	{
+		Path path = folder + getPipelineCacheFilename();
+		if (!FileSystem::isFile(path))
+			return;
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		if (stream == nullptr)
+			return;
+
+		PipelineCacheFileHeader header;
+		if (stream->read(&header, sizeof(header)) != sizeof(header))
+			return;
+
+		// Data from a different device or driver would be rejected by the driver in the best case, so don't even try
+		bool isValid = header.magic == PIPELINE_CACHE_MAGIC &&
+			header.vendorID == mDeviceProperties.vendorID &&
+			header.deviceID == mDeviceProperties.deviceID &&
+			header.driverVersion == mDeviceProperties.driverVersion &&
+			memcmp(header.pipelineCacheUUID, mDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0 &&
+			header.dataSize == stream->size() - sizeof(header);
+
+		if (!isValid)
+		{
+			LOGWRN("Ignoring pipeline cache file \"" + path.toString() + "\" as it is outdated or corrupt.");
+			return;
+		}
+
+		Vector<UINT8> data((size_t)header.dataSize);
+		if (stream->read(data.data(), data.size()) != data.size())
+			return;
+
+		VkPipelineCacheCreateInfo pipelineCacheCI;
+		pipelineCacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		pipelineCacheCI.pNext = nullptr;
+		pipelineCacheCI.flags = 0;
+		pipelineCacheCI.initialDataSize = data.size();
+		pipelineCacheCI.pInitialData = data.data();
+
+		VkPipelineCache pipelineCache;
+		VkResult result = vkCreatePipelineCache(mLogicalDevice, &pipelineCacheCI, gVulkanAllocator, &pipelineCache);
+		if (result != VK_SUCCESS)
+			return;
+
+		vkDestroyPipelineCache(mLogicalDevice, mPipelineCache, gVulkanAllocator);
+		mPipelineCache = pipelineCache;
+	}
+
+	void VulkanDevice::savePipelineCache(const Path& folder) const
+	{
+		size_t dataSize = 0;
+		VkResult result = vkGetPipelineCacheData(mLogicalDevice, mPipelineCache, &dataSize, nullptr);
+		if (result != VK_SUCCESS || dataSize == 0)
+			return;
+
+		Vector<UINT8> data(dataSize);
+		result = vkGetPipelineCacheData(mLogicalDevice, mPipelineCache, &dataSize, data.data());
+		if (result != VK_SUCCESS)
+			return;
+
+		PipelineCacheFileHeader header;
+		header.magic = PIPELINE_CACHE_MAGIC;
+		header.vendorID = mDeviceProperties.vendorID;
+		header.deviceID = mDeviceProperties.deviceID;
+		header.driverVersion = mDeviceProperties.driverVersion;
+		memcpy(header.pipelineCacheUUID, mDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+		header.dataSize = dataSize;
+
+		if (!FileSystem::exists(folder))
+			FileSystem::createDir(folder);
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(folder + getPipelineCacheFilename());
+		if (stream == nullptr)
+			return;
+
+		stream->write(&header, sizeof(header));
+		stream->write(data.data(), dataSize);
+		stream->close();
+	}
+
+	String VulkanDevice::getPipelineCacheFilename() const
+	{
+		StringStream name;
+		name << "PipelineCache_" << std::hex << mDeviceProperties.vendorID << "_" << mDeviceProperties.deviceID << "_" 
+			<< mDeviceProperties.driverVersion << "_";
+
+		for (UINT32 i = 0; i < VK_UUID_SIZE; i++)
+			name << std::setw(2) << std::setfill('0') << (UINT32)mDeviceProperties.pipelineCacheUUID[i];
+
+		name << ".bin";
+		return name.str();
+	}
+
 	void VulkanDevice::waitIdle() const
 	{
 		VkResult result = vkDeviceWaitIdle(mLogicalDevice);
@@ -321,11 +653,14 @@ namespace bs { namespace ct
 		return allocation;
 	}
 
-	VmaAllocation VulkanDevice::allocateMemory(VkBuffer buffer, VkMemoryPropertyFlags flags)
+	VmaAllocation VulkanDevice::allocateMemory(VkBuffer buffer, VkMemoryPropertyFlags flags, bool dedicated)
 	{
 		VmaAllocationCreateInfo allocCI = {};
 		allocCI.requiredFlags = flags;
 
+		if (dedicated)
+			allocCI.flags |= VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+
 		VmaAllocationInfo allocInfo;
 		VmaAllocation memory;
 		VkResult result = vmaAllocateMemoryForBuffer(mAllocator, buffer, &allocCI, &memory, &allocInfo);
@@ -351,6 +686,25 @@ namespace bs { namespace ct
 		offset = allocInfo.offset;
 	}
 
+	Vector<GpuMemoryHeapStats> VulkanDevice::getMemoryHeapStats() const
+	{
+		VmaStats vmaStats;
+		vmaCalculateStats(mAllocator, &vmaStats);
+
+		Vector<GpuMemoryHeapStats> output(mMemoryProperties.memoryHeapCount);
+		for(uint32_t i = 0; i < mMemoryProperties.memoryHeapCount; i++)
+		{
+			const VkMemoryHeap& heap = mMemoryProperties.memoryHeaps[i];
+
+			output[i].size = heap.size;
+			output[i].usedBytes = vmaStats.memoryHeap[i].usedBytes;
+			output[i].numAllocations = vmaStats.memoryHeap[i].allocationCount;
+			output[i].deviceLocal = (heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+		}
+
+		return output;
+	}
+
 	uint32_t VulkanDevice::findMemoryType(uint32_t requirementBits, VkMemoryPropertyFlags wantedFlags)
 	{
 		for (uint32_t i = 0; i < mMemoryProperties.memoryTypeCount; i++)
@@ -84,6 +84,70 @@ namespace bs { namespace ct
 		/** Returns a manager that can be used for allocating Vulkan objects wrapped as managed resources. */
 		VulkanResourceManager& getResourceManager() const { return *mResourceManager; }
 
+		/** Returns the allocator used for frequently updated uniform buffer data. */
+		VulkanUniformRingBuffer& getUniformRingBuffer() const { return *mUniformRingBuffer; }
+
+		/** Returns a pool of re-usable buffers for transferring data between the CPU and the GPU. */
+		VulkanStagingBufferPool& getStagingBufferPool() const { return *mStagingBufferPool; }
+
+		/** 
+		 * Returns the global array of textures accessible by GPU programs through indexing, or null if the device doesn't
+		 * support descriptor indexing.
+		 */
+		VulkanBindlessTextures* getBindlessTextures() const { return mBindlessTextures; }
+
+		/** 
+		 * Checks if the device supports indirect draws whose draw count is read from a GPU buffer 
+		 * (VK_KHR_draw_indirect_count). 
+		 */
+		bool hasDrawIndirectCount() const { return mCmdDrawIndexedIndirectCount != nullptr; }
+
+		/** 
+		 * Returns the entry point of vkCmdDrawIndexedIndirectCountKHR for this device, or null if not supported. 
+		 */
+		PFN_vkCmdDrawIndexedIndirectCountKHR getCmdDrawIndexedIndirectCount() const 
+		{ return mCmdDrawIndexedIndirectCount; }
+
+		/** 
+		 * Checks if the device supports changing the fragment shading rate per draw call 
+		 * (VK_KHR_fragment_shading_rate). 
+		 */
+		bool hasFragmentShadingRate() const { return mCmdSetFragmentShadingRate != nullptr; }
+
+		/** Returns the entry point of vkCmdSetFragmentShadingRateKHR for this device, or null if not supported. */
+		PFN_vkCmdSetFragmentShadingRateKHR getCmdSetFragmentShadingRate() const { return mCmdSetFragmentShadingRate; }
+
+		/** 
+		 * Checks if the device supports tagging presents with an ID and waiting until a present is displayed 
+		 * (VK_KHR_present_id and VK_KHR_present_wait).
+		 */
+		bool hasPresentWait() const { return mWaitForPresent != nullptr; }
+
+		/** Returns the entry point of vkWaitForPresentKHR for this device, or null if not supported. */
+		PFN_vkWaitForPresentKHR getWaitForPresent() const { return mWaitForPresent; }
+
+		/**
+		 * Checks if the device is a tile-based GPU. Detected by the presence of lazily allocated memory, which only
+		 * tile-based GPUs expose, as they can keep transient attachments in on-chip memory.
+		 */
+		bool isTileBased() const { return mIsTileBased; }
+
+		/** Returns the pipeline cache that should be used when creating any pipelines on this device. */
+		VkPipelineCache getPipelineCache() const { return mPipelineCache; }
+
+		/** 
+		 * Replaces the contents of the pipeline cache with the data in the cache file in the specified folder, if one
+		 * exists. Files that were saved using a different device or driver version are ignored. Should be called before
+		 * any pipelines are created.
+		 */
+		void loadPipelineCache(const Path& folder);
+
+		/** 
+		 * Saves the contents of the pipeline cache into the specified folder. The file name is unique for the device and
+		 * the driver version.
+		 */
+		void savePipelineCache(const Path& folder) const;
+
 		/** 
 		 * Allocates memory for the provided image, and binds it to the image. Returns null if it cannot find memory
 		 * with the specified flags.
@@ -92,9 +156,10 @@ namespace bs { namespace ct
 
 		/** 
 		 * Allocates memory for the provided buffer, and binds it to the buffer. Returns null if it cannot find memory
-		 * with the specified flags.
+		 * with the specified flags. If @p dedicated is true the buffer will get its own memory block instead of sharing
+		 * one with other allocations, which is required if the memory is to remain mapped.
 		 */
-		VmaAllocation allocateMemory(VkBuffer buffer, VkMemoryPropertyFlags flags);
+		VmaAllocation allocateMemory(VkBuffer buffer, VkMemoryPropertyFlags flags, bool dedicated = false);
 
 		/** Frees a previously allocated block of memory. */
 		void freeMemory(VmaAllocation allocation);
@@ -102,6 +167,9 @@ namespace bs { namespace ct
 		/** Returns the device memory block and offset into the block for a specific memory allocation. */
 		void getAllocationInfo(VmaAllocation allocation, VkDeviceMemory& memory, VkDeviceSize& offset);
 
+		/** Returns the size and current usage of all the memory heaps of the device. */
+		Vector<GpuMemoryHeapStats> getMemoryHeapStats() const;
+
 	private:
 		friend class VulkanRenderAPI;
 
@@ -111,16 +179,27 @@ namespace bs { namespace ct
 		/** Marks the device as a primary device. */
 		void setIsPrimary() { mIsPrimary = true; }
 
+		/** Returns the name of the file used for storing the pipeline cache of this device. */
+		String getPipelineCacheFilename() const;
+
 		VkPhysicalDevice mPhysicalDevice;
 		VkDevice mLogicalDevice;
 		bool mIsPrimary;
+		bool mIsTileBased = false;
 		UINT32 mDeviceIdx;
 
 		VulkanCmdBufferPool* mCommandBufferPool;
 		VulkanQueryPool* mQueryPool;
 		VulkanDescriptorManager* mDescriptorManager;
 		VulkanResourceManager* mResourceManager;
+		VulkanUniformRingBuffer* mUniformRingBuffer;
+		VulkanStagingBufferPool* mStagingBufferPool;
+		VulkanBindlessTextures* mBindlessTextures = nullptr;
+		PFN_vkCmdDrawIndexedIndirectCountKHR mCmdDrawIndexedIndirectCount = nullptr;
+		PFN_vkCmdSetFragmentShadingRateKHR mCmdSetFragmentShadingRate = nullptr;
+		PFN_vkWaitForPresentKHR mWaitForPresent = nullptr;
 		VmaAllocator mAllocator;
+		VkPipelineCache mPipelineCache = VK_NULL_HANDLE;
 
 		VkPhysicalDeviceProperties mDeviceProperties;
 		VkPhysicalDeviceFeatures mDeviceFeatures;
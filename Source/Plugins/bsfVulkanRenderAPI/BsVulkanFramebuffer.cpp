@@ -49,7 +49,8 @@ namespace bs { namespace ct
 			attachmentDesc.format = desc.color[i].format;
 			attachmentDesc.samples = mSampleFlags;
 			attachmentDesc.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-			attachmentDesc.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+			attachmentDesc.storeOp = desc.color[i].image->isTransient() ?
+				VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
 			attachmentDesc.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
 			attachmentDesc.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
 			attachmentDesc.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
@@ -87,10 +88,14 @@ namespace bs { namespace ct
 			attachmentDesc.flags = 0;
 			attachmentDesc.format = desc.depth.format;
 			attachmentDesc.samples = mSampleFlags;
+			// Transient attachments are discarded at the end of the pass, so tile-based GPUs never write them out
+			VkAttachmentStoreOp storeOp = desc.depth.image->isTransient() ?
+				VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
+
 			attachmentDesc.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-			attachmentDesc.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+			attachmentDesc.storeOp = storeOp;
 			attachmentDesc.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-			attachmentDesc.stencilStoreOp = VK_ATTACHMENT_STORE_OP_STORE;
+			attachmentDesc.stencilStoreOp = storeOp;
 			attachmentDesc.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 			attachmentDesc.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 
@@ -16,9 +16,17 @@ namespace bs { namespace ct
 			assert(desc.elementSize == 0 && "No element size can be provided for standard buffer. Size is determined from format.");
 	}
 
+	VulkanGpuBuffer::VulkanGpuBuffer(const GPU_BUFFER_DESC& desc, VulkanHardwareBuffer* buffer, 
+		const SPtr<VertexBuffer>& source, GpuDeviceFlags deviceMask)
+		: GpuBuffer(desc, deviceMask), mBuffer(buffer), mDeviceMask(deviceMask)
+	{
+		mSourceVertexBuffer = source;
+	}
+
 	VulkanGpuBuffer::~VulkanGpuBuffer()
 	{ 
-		if (mBuffer != nullptr)
+		// Memory of buffers created from vertex buffers is owned by the vertex buffer
+		if (mBuffer != nullptr && mSourceVertexBuffer == nullptr)
 			bs_delete(mBuffer);
 
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuBuffer);
@@ -33,6 +41,8 @@ namespace bs { namespace ct
 		VulkanHardwareBuffer::BufferType bufferType;
 		if (props.getType() == GBT_STRUCTURED)
 			bufferType = VulkanHardwareBuffer::BT_STRUCTURED;
+		else if (props.getType() == GBT_INDIRECTARGUMENT)
+			bufferType = VulkanHardwareBuffer::BT_INDIRECT;
 		else
 		{
 			if (props.getRandomGpuWrite())
@@ -41,8 +51,11 @@ namespace bs { namespace ct
 				bufferType = VulkanHardwareBuffer::BT_GENERIC;
 		}
 
-		UINT32 size = props.getElementCount() * props.getElementSize();;
-		mBuffer = bs_new<VulkanHardwareBuffer>(bufferType, props.getFormat(), props.getUsage(), size, mDeviceMask);
+		if (mBuffer == nullptr)
+		{
+			UINT32 size = props.getElementCount() * props.getElementSize();
+			mBuffer = bs_new<VulkanHardwareBuffer>(bufferType, props.getFormat(), props.getUsage(), size, mDeviceMask);
+		}
 
 		GpuBuffer::initialize();
 	}
@@ -41,9 +41,14 @@ namespace bs { namespace ct
 		VulkanBuffer* getResource(UINT32 deviceIdx) const;
 	protected:
 		friend class VulkanHardwareBufferManager;
+		friend class VulkanVertexBuffer;
 
 		VulkanGpuBuffer(const GPU_BUFFER_DESC& desc, GpuDeviceFlags deviceMask);
 
+		/** Creates a buffer that shares the memory of a vertex buffer. See VertexBuffer::getLoadStore(). */
+		VulkanGpuBuffer(const GPU_BUFFER_DESC& desc, VulkanHardwareBuffer* buffer, const SPtr<VertexBuffer>& source,
+			GpuDeviceFlags deviceMask);
+
 		/** @copydoc GpuBuffer::initialize */
 		void initialize() override;
 	private:
@@ -2,13 +2,16 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsVulkanGpuParamBlockBuffer.h"
 #include "BsVulkanHardwareBuffer.h"
+#include "BsVulkanRenderAPI.h"
+#include "BsVulkanDevice.h"
+#include "BsVulkanUtility.h"
 #include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
 {
 	VulkanGpuParamBlockBuffer::VulkanGpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage,
 		GpuDeviceFlags deviceMask)
-		:GpuParamBlockBuffer(size, usage, deviceMask), mBuffer(nullptr), mDeviceMask(deviceMask)
+		:GpuParamBlockBuffer(size, usage, deviceMask), mBuffer(nullptr), mDeviceMask(deviceMask), mRingBuffers()
 	{ }
 
 	VulkanGpuParamBlockBuffer::~VulkanGpuParamBlockBuffer()
@@ -23,22 +26,84 @@ namespace bs { namespace ct
 	{
 		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_GpuParamBuffer);
 
-		GpuBufferUsage usage = mUsage == GPBU_STATIC ? GBU_STATIC : GBU_DYNAMIC;
+		bool useRingBuffer = mUsage == GPBU_DYNAMIC;
+		if(useRingBuffer)
+		{
+			VulkanRenderAPI& rapi = static_cast<VulkanRenderAPI&>(RenderAPI::instance());
 
-		mBuffer = bs_new<VulkanHardwareBuffer>(VulkanHardwareBuffer::BT_UNIFORM, BF_UNKNOWN, usage, mSize, mDeviceMask);
+			VulkanDevice* devices[BS_MAX_DEVICES];
+			VulkanUtility::getDevices(rapi, mDeviceMask, devices);
+
+			for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
+			{
+				if (devices[i] == nullptr)
+					continue;
+
+				VulkanUniformRingBuffer& ringBuffer = devices[i]->getUniformRingBuffer();
+				if(mSize > ringBuffer.getMaxAllocationSize())
+				{
+					useRingBuffer = false;
+					break;
+				}
+
+				mRingBuffers[i] = &ringBuffer;
+			}
+		}
+
+		if(!useRingBuffer)
+		{
+			bs_zero_out(mRingBuffers);
+
+			GpuBufferUsage usage = mUsage == GPBU_STATIC ? GBU_STATIC : GBU_DYNAMIC;
+			mBuffer = bs_new<VulkanHardwareBuffer>(VulkanHardwareBuffer::BT_UNIFORM, BF_UNKNOWN, usage, mSize, 
+				mDeviceMask);
+		}
 
 		GpuParamBlockBuffer::initialize();
 	}
 
 	void VulkanGpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 queueIdx)
 	{
-		mBuffer->writeData(0, mSize, data, BWT_DISCARD, queueIdx);
+		if(mBuffer != nullptr)
+			mBuffer->writeData(0, mSize, data, BWT_DISCARD, queueIdx);
+		else
+		{
+			Lock lock(mMutex);
+
+			for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
+			{
+				if (mRingBuffers[i] != nullptr)
+					mRingBuffers[i]->write(data, mSize, mAllocations[i]);
+			}
+		}
 
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
 	}
 
-	VulkanBuffer* VulkanGpuParamBlockBuffer::getResource(UINT32 deviceIdx) const
+	VulkanBuffer* VulkanGpuParamBlockBuffer::getResource(UINT32 deviceIdx, UINT32& offset)
 	{
-		return mBuffer->getResource(deviceIdx);
+		if(mBuffer != nullptr)
+		{
+			offset = 0;
+			return mBuffer->getResource(deviceIdx);
+		}
+
+		VulkanUniformRingBuffer* ringBuffer = mRingBuffers[deviceIdx];
+		if(ringBuffer == nullptr)
+		{
+			offset = 0;
+			return nullptr;
+		}
+
+		Lock lock(mMutex);
+
+		// Ring buffer allocations expire at the end of the frame, in which case the data must be uploaded again. Blocks
+		// are only ever written from their cached data, so it can be used as the source.
+		VulkanUniformRingBuffer::Allocation& allocation = mAllocations[deviceIdx];
+		if(!ringBuffer->isValid(allocation))
+			ringBuffer->write(mCachedData, mSize, allocation);
+
+		offset = allocation.offset;
+		return allocation.buffer;
 	}
-}}
\ No newline at end of file
+}}
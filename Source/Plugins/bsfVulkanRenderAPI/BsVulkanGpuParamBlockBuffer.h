@@ -4,6 +4,7 @@
 
 #include "BsVulkanPrerequisites.h"
 #include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "BsVulkanUniformRingBuffer.h"
 
 namespace bs { namespace ct
 {
@@ -11,7 +12,11 @@ namespace bs { namespace ct
 	 *  @{
 	 */
 
-	/**	Vulkan implementation of a parameter block buffer (uniform buffer in Vulkan lingo). */
+	/**
+	 * Vulkan implementation of a parameter block buffer (uniform buffer in Vulkan lingo). Dynamic buffers are
+	 * sub-allocated from the per-device VulkanUniformRingBuffer, and must be bound using the returned offset. Static
+	 * buffers use a dedicated uniform buffer, always bound at offset zero.
+	 */
 	class VulkanGpuParamBlockBuffer : public GpuParamBlockBuffer
 	{
 	public:
@@ -24,8 +29,14 @@ namespace bs { namespace ct
 		/** 
 		 * Gets the resource wrapping the buffer object, on the specified device. If GPU param block buffer's device mask
 		 * doesn't include the provided device, null is returned. 
+		 * 
+		 * @param[in]	deviceIdx	Index of the device to retrieve the buffer for.
+		 * @param[out]	offset		Offset into the buffer at which the block's data is located, in bytes.
+		 * 
+		 * @note	If the block's data was written during a previous frame it will be re-uploaded to a new location.
+		 *			Thread safe.
 		 */
-		VulkanBuffer* getResource(UINT32 deviceIdx) const;
+		VulkanBuffer* getResource(UINT32 deviceIdx, UINT32& offset);
 	protected:
 		/** @copydoc GpuParamBlockBuffer::initialize */
 		void initialize() override;
@@ -33,6 +44,10 @@ namespace bs { namespace ct
 	private:
 		VulkanHardwareBuffer* mBuffer;
 		GpuDeviceFlags mDeviceMask;
+
+		VulkanUniformRingBuffer* mRingBuffers[BS_MAX_DEVICES];
+		VulkanUniformRingBuffer::Allocation mAllocations[BS_MAX_DEVICES];
+		Mutex mMutex;
 	};
 
 	/** @} */
@@ -13,6 +13,7 @@
 #include "BsVulkanSamplerState.h"
 #include "BsVulkanGpuPipelineParamInfo.h"
 #include "BsVulkanCommandBuffer.h"
+#include "BsVulkanBindlessTextures.h"
 #include "Managers/BsVulkanTextureManager.h"
 #include "Managers/BsVulkanHardwareBufferManager.h"
 #include "RenderAPI/BsGpuParamDesc.h"
@@ -81,6 +82,7 @@ namespace bs { namespace ct
 			.reserve<VkImage>(numTextures * numDevices)
 			.reserve<VkImage>(numStorageTextures * numDevices)
 			.reserve<VkBuffer>(numParamBlocks * numDevices)
+			.reserve<UINT32>(numParamBlocks * numDevices)
 			.reserve<VkBuffer>(numBuffers * numDevices)
 			.reserve<VkSampler>(numSamplers * numDevices)
 			.init();
@@ -108,12 +110,14 @@ namespace bs { namespace ct
 			mPerDeviceData[i].sampledImages = mAlloc.alloc<VkImage>(numTextures);
 			mPerDeviceData[i].storageImages = mAlloc.alloc<VkImage>(numStorageTextures);
 			mPerDeviceData[i].uniformBuffers = mAlloc.alloc<VkBuffer>(numParamBlocks);
+			mPerDeviceData[i].uniformBufferOffsets = mAlloc.alloc<UINT32>(numParamBlocks);
 			mPerDeviceData[i].buffers = mAlloc.alloc<VkBuffer>(numBuffers);
 			mPerDeviceData[i].samplers = mAlloc.alloc<VkSampler>(numSamplers);
 
 			bs_zero_out(mPerDeviceData[i].sampledImages, numTextures);
 			bs_zero_out(mPerDeviceData[i].storageImages, numStorageTextures);
 			bs_zero_out(mPerDeviceData[i].uniformBuffers, numParamBlocks);
+			bs_zero_out(mPerDeviceData[i].uniformBufferOffsets, numParamBlocks);
 			bs_zero_out(mPerDeviceData[i].buffers, numBuffers);
 			bs_zero_out(mPerDeviceData[i].samplers, numSamplers);
 
@@ -130,6 +134,17 @@ namespace bs { namespace ct
 				perSetData.writeSetInfos = mAlloc.alloc<VkWriteDescriptorSet>(numBindingsPerSet);
 				perSetData.writeInfos = mAlloc.alloc<WriteInfo>(numBindingsPerSet);
 
+				perSetData.isTransient = false;
+				perSetData.isBindless = vkParamInfo.isBindlessSet(j);
+
+				// Contents of bindless sets are managed by the device
+				if (perSetData.isBindless)
+				{
+					perSetData.numElements = 0;
+					perSetData.latestSet = nullptr;
+					continue;
+				}
+
 				VulkanDescriptorLayout* layout = vkParamInfo.getLayout(i, j);
 				perSetData.numElements = numBindingsPerSet;
 				perSetData.latestSet = descManager.createSet(layout);
@@ -178,8 +193,10 @@ namespace bs { namespace ct
 					}
 					else
 					{
-						bool useView = writeSetInfo.descriptorType != VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER && 
-							writeSetInfo.descriptorType != VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+						bool isUniform = writeSetInfo.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
+							writeSetInfo.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
+						bool useView = !isUniform && writeSetInfo.descriptorType != VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
 
 						if (!useView)
 						{
@@ -187,7 +204,7 @@ namespace bs { namespace ct
 							bufferInfo.offset = 0;
 							bufferInfo.range = VK_WHOLE_SIZE;
 
-							if(writeSetInfo.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+							if(isUniform)
 								bufferInfo.buffer = vkBufManager.getDummyUniformBuffer(i);
 							else
 								bufferInfo.buffer = vkBufManager.getDummyStructuredBuffer(i);
@@ -245,26 +262,40 @@ namespace bs { namespace ct
 				continue;
 
 			VulkanBuffer* bufferRes;
+			UINT32 offset = 0;
 			if (vulkanParamBlockBuffer != nullptr)
-				bufferRes = vulkanParamBlockBuffer->getResource(i);
+				bufferRes = vulkanParamBlockBuffer->getResource(i, offset);
 			else
 				bufferRes = nullptr;
 
 			PerSetData& perSetData = mPerDeviceData[i].perSetData[set];
+			VkDescriptorBufferInfo& bufferInfo = perSetData.writeInfos[bindingIdx].buffer;
+			bool isDynamic = perSetData.writeSetInfos[bindingIdx].descriptorType == 
+				VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
 			if (bufferRes != nullptr)
 			{
 				VkBuffer buffer = bufferRes->getHandle();
 
-				perSetData.writeInfos[bindingIdx].buffer.buffer = buffer;
+				// Dynamic offsets are provided when binding the descriptor set
+				bufferInfo.buffer = buffer;
+				bufferInfo.offset = isDynamic ? 0 : offset;
+				bufferInfo.range = vulkanParamBlockBuffer->getSize();
+
 				mPerDeviceData[i].uniformBuffers[sequentialIdx] = buffer;
+				mPerDeviceData[i].uniformBufferOffsets[sequentialIdx] = offset;
 			}
 			else
 			{
 				VulkanHardwareBufferManager& vkBufManager = static_cast<VulkanHardwareBufferManager&>(
 					HardwareBufferManager::instance());
 
-				perSetData.writeInfos[bindingIdx].buffer.buffer = vkBufManager.getDummyUniformBuffer(i);
+				bufferInfo.buffer = vkBufManager.getDummyUniformBuffer(i);
+				bufferInfo.offset = 0;
+				bufferInfo.range = VK_WHOLE_SIZE;
+
 				mPerDeviceData[i].uniformBuffers[sequentialIdx] = VK_NULL_HANDLE;
+				mPerDeviceData[i].uniformBufferOffsets[sequentialIdx] = 0;
 			}
 		}
 
@@ -273,9 +304,14 @@ namespace bs { namespace ct
 
 	void VulkanGpuParams::setTexture(UINT32 set, UINT32 slot, const SPtr<Texture>& texture, const TextureSurface& surface)
 	{
+		VulkanGpuPipelineParamInfo& vkParamInfo = static_cast<VulkanGpuPipelineParamInfo&>(*mParamInfo);
+
+		// Textures in bindless sets are registered through RenderAPI::getBindlessTextureIndex() instead
+		if (set < vkParamInfo.getNumSets() && vkParamInfo.isBindlessSet(set))
+			return;
+
 		GpuParams::setTexture(set, slot, texture, surface);
 
-		VulkanGpuPipelineParamInfo& vkParamInfo = static_cast<VulkanGpuPipelineParamInfo&>(*mParamInfo);
 		UINT32 bindingIdx = vkParamInfo.getBindingIdx(set, slot);
 		if (bindingIdx == (UINT32)-1)
 		{
@@ -525,9 +561,11 @@ namespace bs { namespace ct
 		return mParamInfo->getNumSets();
 	}
 
-	void VulkanGpuParams::prepareForBind(VulkanCmdBuffer& buffer, VkDescriptorSet* sets)
+	void VulkanGpuParams::prepareForBind(VulkanCmdBuffer& buffer, VkDescriptorSet* sets, UINT32* dynamicOffsets,
+		UINT32& numDynamicOffsets)
 	{
 		UINT32 deviceIdx = buffer.getDeviceIdx();
+		numDynamicOffsets = 0;
 
 		PerDeviceData& perDeviceData = mPerDeviceData[deviceIdx];
 		if (perDeviceData.perSetData == nullptr)
@@ -555,7 +593,9 @@ namespace bs { namespace ct
 				continue;
 
 			VulkanGpuParamBlockBuffer* element = static_cast<VulkanGpuParamBlockBuffer*>(mParamBlockBuffers[i].get());
-			VulkanBuffer* resource = element->getResource(deviceIdx);
+
+			UINT32 offset;
+			VulkanBuffer* resource = element->getResource(deviceIdx, offset);
 			if (resource == nullptr)
 				continue;
 
@@ -566,17 +606,30 @@ namespace bs { namespace ct
 			assert(perDeviceData.uniformBuffers[i] != VK_NULL_HANDLE);
 
 			VkBuffer vkBuffer = resource->getHandle();
-			if(perDeviceData.uniformBuffers[i] != vkBuffer)
+			bool offsetChanged = perDeviceData.uniformBufferOffsets[i] != offset;
+			if(perDeviceData.uniformBuffers[i] != vkBuffer || offsetChanged)
 			{
 				perDeviceData.uniformBuffers[i] = vkBuffer;
+				perDeviceData.uniformBufferOffsets[i] = offset;
 			
 				UINT32 set, slot;
 				mParamInfo->getBinding(GpuPipelineParamInfo::ParamType::ParamBlock, i, set, slot);
 
 				UINT32 bindingIdx = vkParamInfo.getBindingIdx(set, slot);
-				perDeviceData.perSetData[set].writeInfos[bindingIdx].buffer.buffer = vkBuffer;
+				PerSetData& perSetData = perDeviceData.perSetData[set];
+				VkDescriptorBufferInfo& bufferInfo = perSetData.writeInfos[bindingIdx].buffer;
 
-				mSetsDirty[set] = true;
+				// Offset changes of dynamic uniform buffers don't require the set to be updated
+				bool isDynamic = perSetData.writeSetInfos[bindingIdx].descriptorType == 
+					VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
+				if(bufferInfo.buffer != vkBuffer || (!isDynamic && offsetChanged))
+				{
+					bufferInfo.buffer = vkBuffer;
+					bufferInfo.offset = isDynamic ? 0 : offset;
+
+					mSetsDirty[set] = true;
+				}
 			}
 		}
 
@@ -763,46 +816,77 @@ namespace bs { namespace ct
 		{
 			PerSetData& perSetData = perDeviceData.perSetData[i];
 
-			if (!mSetsDirty[i]) // Set not dirty, just use the last one we wrote (this is fine even across multiple command buffers)
-				continue;
-
-			// Set is dirty, we need to update
-			//// Use latest unless already used, otherwise try to find an unused one
-			if(perSetData.latestSet->isBound()) // Checking this is okay, because it's only modified below when we call registerResource, which is under the same lock as this
+			if (perSetData.isBindless)
 			{
-				perSetData.latestSet = nullptr;
+				VulkanBindlessTextures* bindlessTextures = device.getBindlessTextures();
+				bindlessTextures->prepareForBind(buffer);
 
-				for(auto& entry : perSetData.sets)
-				{
-					if(!entry->isBound())
-					{
-						perSetData.latestSet = entry;
-						break;
-					}
-				}
+				sets[i] = bindlessTextures->getHandle();
+				continue;
+			}
 
-				// Cannot find an empty set, allocate a new one
-				if (perSetData.latestSet == nullptr)
+			if (!mSetsDirty[i]) // Set not dirty, just use the last one we wrote (this is fine even across multiple command buffers)
+			{
+				// Transient sets are only valid for a single frame, so they must be re-acquired on every bind. This will
+				// return the same set if it was already written this frame.
+				if (perSetData.isTransient)
 				{
 					VulkanDescriptorLayout* layout = vkParamInfo.getLayout(deviceIdx, i);
-					perSetData.latestSet = descManager.createSet(layout);
-					perSetData.sets.push_back(perSetData.latestSet);
+					sets[i] = descManager.getTransientSet(layout, perSetData.writeSetInfos, perSetData.numElements,
+						buffer);
 				}
+
+				continue;
+			}
+
+			mSetsDirty[i] = false;
+
+			// Set is dirty, we need to update. If the latest set is still in use by the GPU (or by a command buffer 
+			// that's still recording), write to a transient set instead of allocating new persistent sets, which are
+			// never released until the parameters are destroyed. Checking this is okay, because it's only modified when we
+			// call registerResource, which is under the same lock as this.
+			if (perSetData.latestSet->isBound())
+			{
+				VulkanDescriptorLayout* layout = vkParamInfo.getLayout(deviceIdx, i);
+				sets[i] = descManager.getTransientSet(layout, perSetData.writeSetInfos, perSetData.numElements, buffer);
+
+				perSetData.isTransient = true;
+				continue;
 			}
 
 			// Note: Currently I write to the entire set at once, but it might be beneficial to remember only the exact
 			// entries that were updated, and only write to them individually.
 			perSetData.latestSet->write(perSetData.writeSetInfos, perSetData.numElements);
-
-			mSetsDirty[i] = false;
+			perSetData.isTransient = false;
 		}
 
 		for (UINT32 i = 0; i < numSets; i++)
 		{
-			VulkanDescriptorSet* set = perDeviceData.perSetData[i].latestSet;
+			PerSetData& perSetData = perDeviceData.perSetData[i];
+			if (perSetData.isTransient || perSetData.isBindless)
+				continue;
+
+			VulkanDescriptorSet* set = perSetData.latestSet;
 
 			buffer.registerResource(set, VulkanUseFlag::Read);
 			sets[i] = set->getHandle();
 		}
+
+		// Dynamic offsets are expected in the order of sets, and then bindings within a set
+		for (UINT32 i = 0; i < numSets; i++)
+		{
+			PerSetData& perSetData = perDeviceData.perSetData[i];
+			for (UINT32 j = 0; j < perSetData.numElements; j++)
+			{
+				const VkWriteDescriptorSet& writeSetInfo = perSetData.writeSetInfos[j];
+				if (writeSetInfo.descriptorType != VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+					continue;
+
+				UINT32 sequentialIdx = vkParamInfo.getSequentialSlot(GpuPipelineParamInfo::ParamType::ParamBlock, i, 
+					writeSetInfo.dstBinding);
+
+				dynamicOffsets[numDynamicOffsets++] = perDeviceData.uniformBufferOffsets[sequentialIdx];
+			}
+		}
 	}
 }}
\ No newline at end of file
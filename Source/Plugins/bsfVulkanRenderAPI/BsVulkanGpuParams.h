@@ -45,13 +45,18 @@ namespace bs { namespace ct
 		 * Caller must perform external locking if some other thread could write to this object while it is being bound. 
 		 * The same applies to any resources held by this object.
 		 * 
-		 * @param[in]	buffer	Buffer on which the parameters will be bound to.
-		 * @param[out]	sets	Pre-allocated buffer in which the descriptor set handled will be written. Must be of
-		 *						getNumSets() size.
+		 * @param[in]	buffer				Buffer on which the parameters will be bound to.
+		 * @param[out]	sets				Pre-allocated buffer in which the descriptor set handled will be written. Must
+		 *									be of getNumSets() size.
+		 * @param[out]	dynamicOffsets		Pre-allocated buffer in which the offsets of dynamic uniform buffers will be
+		 *									written, in the order expected by vkCmdBindDescriptorSets(). Must be large
+		 *									enough to hold maxDescriptorSetUniformBuffersDynamic entries.
+		 * @param[out]	numDynamicOffsets	Number of entries written to @p dynamicOffsets.
 		 * 
 		 * @note	Thread safe.
 		 */
-		void prepareForBind(VulkanCmdBuffer& buffer, VkDescriptorSet* sets);
+		void prepareForBind(VulkanCmdBuffer& buffer, VkDescriptorSet* sets, UINT32* dynamicOffsets, 
+			UINT32& numDynamicOffsets);
 
 	protected:
 		/** Contains data about writing to either buffer or a texture descriptor. */
@@ -68,6 +73,15 @@ namespace bs { namespace ct
 			VulkanDescriptorSet* latestSet;
 			Vector<VulkanDescriptorSet*> sets;
 
+			/** 
+			 * True if the latest contents of the set were written to a transient set (valid for a single frame only) 
+			 * instead of to @p latestSet.
+			 */
+			bool isTransient;
+
+			/** True if the device's global bindless texture set is bound in place of this set. */
+			bool isBindless;
+
 			VkWriteDescriptorSet* writeSetInfos;
 			WriteInfo* writeInfos;
 
@@ -82,6 +96,7 @@ namespace bs { namespace ct
 			VkImage* sampledImages;
 			VkImage* storageImages;
 			VkBuffer* uniformBuffers;
+			UINT32* uniformBufferOffsets;
 			VkBuffer* buffers;
 			VkSampler* samplers;
 		};
@@ -4,12 +4,13 @@
 #include "BsVulkanUtility.h"
 #include "BsVulkanRenderAPI.h"
 #include "BsVulkanDevice.h"
+#include "BsVulkanBindlessTextures.h"
 #include "RenderAPI/BsGpuParamDesc.h"
 
 namespace bs { namespace ct
 {
 	VulkanGpuPipelineParamInfo::VulkanGpuPipelineParamInfo(const GPU_PIPELINE_PARAMS_DESC& desc, GpuDeviceFlags deviceMask)
-		: GpuPipelineParamInfo(desc, deviceMask), mDeviceMask(deviceMask), mSetExtraInfos(nullptr), mLayouts()
+		: GpuPipelineParamInfo(desc, deviceMask), mDeviceMask(deviceMask), mSetExtraInfos(nullptr), mBindlessSets(nullptr), mLayouts()
 		, mLayoutInfos()
 	{ }
 
@@ -42,6 +43,7 @@ namespace bs { namespace ct
 			.reserve<VulkanDescriptorLayout*>(mNumSets * numDevices)
 			.reserve<SetExtraInfo>(mNumSets)
 			.reserve<UINT32>(totalNumSlots)
+			.reserve<bool>(mNumSets)
 			.init();
 
 		mLayoutInfos = mAlloc.alloc<LayoutInfo>(mNumSets);
@@ -60,6 +62,10 @@ namespace bs { namespace ct
 		}
 
 		mSetExtraInfos = mAlloc.alloc<SetExtraInfo>(mNumSets);
+		mBindlessSets = mAlloc.alloc<bool>(mNumSets);
+
+		if (mBindlessSets != nullptr)
+			bs_zero_out(mBindlessSets, mNumSets);
 
 		if(bindings != nullptr)
 			bs_zero_out(bindings, mNumElements);
@@ -109,6 +115,22 @@ namespace bs { namespace ct
 		stageFlagsLookup[GPT_FRAGMENT_PROGRAM] = VK_SHADER_STAGE_FRAGMENT_BIT;
 		stageFlagsLookup[GPT_COMPUTE_PROGRAM] = VK_SHADER_STAGE_COMPUTE_BIT;
 
+		// Param blocks use dynamic uniform buffers, so blocks sub-allocated from the uniform ring buffer can be bound at
+		// a different offset without requiring a descriptor set update. Fall back to normal uniform buffers if the
+		// pipeline uses more blocks than supported.
+		VkDescriptorType paramBlockDescType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
+		UINT32 numParamBlocks = mNumElementsPerType[(int)ParamType::ParamBlock];
+		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
+		{
+			if (devices[i] == nullptr)
+				continue;
+
+			const VkPhysicalDeviceLimits& limits = devices[i]->getDeviceProperties().limits;
+			if (numParamBlocks > limits.maxDescriptorSetUniformBuffersDynamic)
+				paramBlockDescType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+		}
+
 		UINT32 numParamDescs = sizeof(mParamDescs) / sizeof(mParamDescs[0]);
 		for (UINT32 i = 0; i < numParamDescs; i++)
 		{
@@ -149,7 +171,7 @@ namespace bs { namespace ct
 			};
 
 			// Note: Assuming all textures and samplers use the same set/slot combination, and that they're combined
-			setUpBlockBindings(paramDesc->paramBlocks, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+			setUpBlockBindings(paramDesc->paramBlocks, paramBlockDescType);
 			setUpBindings(paramDesc->textures, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
 			setUpBindings(paramDesc->loadStoreTextures, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
 			//setUpBindings(paramDesc->samplers, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
@@ -184,6 +206,34 @@ namespace bs { namespace ct
 			}
 		}
 
+		// Find the set holding the bindless texture array, if any. It's replaced by the global bindless set of the device.
+		for (UINT32 i = 0; i < numParamDescs; i++)
+		{
+			const SPtr<GpuParamDesc>& paramDesc = mParamDescs[i];
+			if (paramDesc == nullptr)
+				continue;
+
+			auto iterFind = paramDesc->textures.find(RenderAPI::BINDLESS_TEXTURES_PARAM_NAME);
+			if (iterFind == paramDesc->textures.end())
+				continue;
+
+			UINT32 set = iterFind->second.set;
+			if (mLayoutInfos[set].numBindings != 1)
+			{
+				LOGERR("Bindless texture array must be the only parameter in its set. Falling back to regular binding.");
+				continue;
+			}
+
+			bool supported = true;
+			for (UINT32 j = 0; j < BS_MAX_DEVICES; j++)
+			{
+				if (devices[j] != nullptr && devices[j]->getBindlessTextures() == nullptr)
+					supported = false;
+			}
+
+			mBindlessSets[set] = supported;
+		}
+
 		// Allocate layouts per-device
 		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
 		{
@@ -192,7 +242,12 @@ namespace bs { namespace ct
 
 			VulkanDescriptorManager& descManager = devices[i]->getDescriptorManager();
 			for (UINT32 j = 0; j < mNumSets; j++)
-				mLayouts[i][j] = descManager.getLayout(mLayoutInfos[j].bindings, mLayoutInfos[j].numBindings);
+			{
+				if (mBindlessSets[j])
+					mLayouts[i][j] = devices[i]->getBindlessTextures()->getLayout();
+				else
+					mLayouts[i][j] = descManager.getLayout(mLayoutInfos[j].bindings, mLayoutInfos[j].numBindings);
+			}
 		}
 	}
 
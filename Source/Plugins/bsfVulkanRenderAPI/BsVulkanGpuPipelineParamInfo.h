@@ -37,6 +37,13 @@ namespace bs { namespace ct
 		 */
 		VulkanDescriptorLayout* getLayout(UINT32 deviceIdx, UINT32 layoutIdx) const;
 
+		/** 
+		 * Returns true if the set at the specified index contains only the bindless texture array (see 
+		 * RenderAPI::BINDLESS_TEXTURES_PARAM_NAME), in which case the device's global bindless descriptor set is bound
+		 * in its place.
+		 */
+		bool isBindlessSet(UINT32 set) const { return mBindlessSets[set]; }
+
 	private:
 		/**	@copydoc GpuPipelineParamInfo::initialize */
 		void initialize() override;
@@ -58,6 +65,7 @@ namespace bs { namespace ct
 		GpuDeviceFlags mDeviceMask;
 
 		SetExtraInfo* mSetExtraInfos;
+		bool* mBindlessSets;
 		VulkanDescriptorLayout** mLayouts[BS_MAX_DEVICES];
 		LayoutInfo* mLayoutInfos;
 
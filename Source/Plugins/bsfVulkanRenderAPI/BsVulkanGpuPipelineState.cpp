@@ -122,7 +122,7 @@ namespace bs { namespace ct
 			stageCI.stage = stages[i].first;
 			stageCI.module = VK_NULL_HANDLE;
 			stageCI.pName = program->getEntryPoint().c_str();
-			stageCI.pSpecializationInfo = nullptr;
+			stageCI.pSpecializationInfo = program->getSpecializationInfo();
 
 			stageOutputIdx++;
 		}
@@ -253,8 +253,10 @@ namespace bs { namespace ct
 		mDynamicStates[0] = VK_DYNAMIC_STATE_VIEWPORT;
 		mDynamicStates[1] = VK_DYNAMIC_STATE_SCISSOR;
 		mDynamicStates[2] = VK_DYNAMIC_STATE_STENCIL_REFERENCE;
+		mDynamicStates[3] = VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR;
 
-		UINT32 numDynamicStates = sizeof(mDynamicStates) / sizeof(mDynamicStates[0]);
+		// Shading rate state is only included if supported by the device, see createPipeline()
+		UINT32 numDynamicStates = sizeof(mDynamicStates) / sizeof(mDynamicStates[0]) - 1;
 		assert(numDynamicStates == 3);
 
 		mDynamicStateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
@@ -477,8 +479,11 @@ namespace bs { namespace ct
 		VulkanDevice* device = mPerDeviceData[deviceIdx].device;
 		VkDevice vkDevice = mPerDeviceData[deviceIdx].device->getLogical();
 
+		mDynamicStateInfo.dynamicStateCount = device->hasFragmentShadingRate() ? 4 : 3;
+
 		VkPipeline pipeline;
-		VkResult result = vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &mPipelineInfo, gVulkanAllocator, &pipeline);
+		VkResult result = vkCreateGraphicsPipelines(vkDevice, device->getPipelineCache(), 1, &mPipelineInfo, 
+			gVulkanAllocator, &pipeline);
 		assert(result == VK_SUCCESS);
 
 		// Restore previous stencil op states
@@ -529,7 +534,7 @@ namespace bs { namespace ct
 		stageCI.stage = VK_SHADER_STAGE_COMPUTE_BIT;
 		stageCI.module = VK_NULL_HANDLE;
 		stageCI.pName = vkProgram->getEntryPoint().c_str();
-		stageCI.pSpecializationInfo = nullptr;
+		stageCI.pSpecializationInfo = vkProgram->getSpecializationInfo();
 
 		VkComputePipelineCreateInfo pipelineCI;
 		pipelineCI.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
@@ -571,8 +576,8 @@ namespace bs { namespace ct
 			pipelineCI.layout = descManager.getPipelineLayout(layouts, numLayouts);
 
 			VkPipeline pipeline;
-			VkResult result = vkCreateComputePipelines(devices[i]->getLogical(), VK_NULL_HANDLE, 1, &pipelineCI,
-														gVulkanAllocator, &pipeline);
+			VkResult result = vkCreateComputePipelines(devices[i]->getLogical(), devices[i]->getPipelineCache(), 1, 
+														&pipelineCI, gVulkanAllocator, &pipeline);
 			assert(result == VK_SUCCESS);
 
 
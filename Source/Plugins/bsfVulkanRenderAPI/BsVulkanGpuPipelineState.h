@@ -144,7 +144,7 @@ namespace bs { namespace ct
 		VkPipelineColorBlendAttachmentState mAttachmentBlendStates[BS_MAX_MULTIPLE_RENDER_TARGETS];
 		VkPipelineColorBlendStateCreateInfo mColorBlendStateInfo;
 		VkPipelineDynamicStateCreateInfo mDynamicStateInfo;
-		VkDynamicState mDynamicStates[3];
+		VkDynamicState mDynamicStates[4];
 		VkGraphicsPipelineCreateInfo mPipelineInfo;
 		bool mScissorEnabled;
 		SPtr<VertexDeclaration> mVertexDecl;
@@ -12,9 +12,64 @@
 #include "Profiling/BsRenderStats.h"
 #include "FileSystem/BsFileSystem.h"
 #include "FileSystem/BsDataStream.h"
+#include "Material/BsShaderCompileCache.h"
 
 namespace bs { namespace ct
 {
+	/** 
+	 * Modules of all live programs, keyed by their bytecode and device mask. Programs that only differ in their 
+	 * specialization constants (e.g. specialized shader variations) compile to the same bytecode and share the modules.
+	 */
+	static UnorderedMap<String, std::weak_ptr<VulkanShaderModules>> sShaderModules;
+	static Mutex sShaderModulesMutex;
+
+	/** 
+	 * Returns modules created from the provided bytecode. Modules are re-used if another live program was created from
+	 * the same bytecode.
+	 */
+	static SPtr<VulkanShaderModules> getShaderModules(const String& key, const DataBlob& bytecode, 
+		GpuDeviceFlags deviceMask)
+	{
+		Lock lock(sShaderModulesMutex);
+
+		std::weak_ptr<VulkanShaderModules>& cachedModules = sShaderModules[key];
+		SPtr<VulkanShaderModules> modules = cachedModules.lock();
+		if (modules != nullptr)
+			return modules;
+
+		VulkanRenderAPI& rapi = static_cast<VulkanRenderAPI&>(RenderAPI::instance());
+		VulkanDevice* devices[BS_MAX_DEVICES];
+
+		// Create Vulkan module
+		VkShaderModuleCreateInfo moduleCI;
+		moduleCI.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+		moduleCI.pNext = nullptr;
+		moduleCI.flags = 0;
+		moduleCI.codeSize = bytecode.size;
+		moduleCI.pCode = (uint32_t*)bytecode.data;
+
+		VulkanUtility::getDevices(rapi, deviceMask, devices);
+
+		modules = bs_shared_ptr_new<VulkanShaderModules>();
+		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
+		{
+			if (devices[i] != nullptr)
+			{
+				VkDevice vkDevice = devices[i]->getLogical();
+				VulkanResourceManager& rescManager = devices[i]->getResourceManager();
+
+				VkShaderModule shaderModule;
+				VkResult result = vkCreateShaderModule(vkDevice, &moduleCI, gVulkanAllocator, &shaderModule);
+				assert(result == VK_SUCCESS);
+
+				modules->modules[i] = rescManager.create<VulkanShaderModule>(shaderModule);
+			}
+		}
+
+		cachedModules = modules;
+		return modules;
+	}
+
 	VulkanShaderModule::VulkanShaderModule(VulkanResourceManager* owner, VkShaderModule module)
 		:VulkanResource(owner, true), mModule(module)
 	{ }
@@ -24,18 +79,31 @@ namespace bs { namespace ct
 		vkDestroyShaderModule(mOwner->getDevice().getLogical(), mModule, gVulkanAllocator);
 	}
 
+	VulkanShaderModules::~VulkanShaderModules()
+	{
+		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
+		{
+			if (modules[i] != nullptr)
+				modules[i]->destroy();
+		}
+	}
+
 	VulkanGpuProgram::VulkanGpuProgram(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
-		: GpuProgram(desc, deviceMask), mDeviceMask(deviceMask), mModules()
+		: GpuProgram(desc, deviceMask), mDeviceMask(deviceMask), mSpecializationInfo()
 	{
 
 	}
 
 	VulkanGpuProgram::~VulkanGpuProgram()
 	{
-		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
+		if (mModules != nullptr)
 		{
-			if (mModules[i] != nullptr)
-				mModules[i]->destroy();
+			Lock lock(sShaderModulesMutex);
+			mModules = nullptr;
+
+			auto iterFind = sShaderModules.find(mModulesKey);
+			if (iterFind != sShaderModules.end() && iterFind->second.expired())
+				sShaderModules.erase(iterFind);
 		}
 
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuProgram);
@@ -68,34 +136,27 @@ namespace bs { namespace ct
 
 		if(mIsCompiled)
 		{
-			VulkanRenderAPI& rapi = static_cast<VulkanRenderAPI&>(RenderAPI::instance());
-			VulkanDevice* devices[BS_MAX_DEVICES];
-
-			// Create Vulkan module
-			VkShaderModuleCreateInfo moduleCI;
-			moduleCI.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-			moduleCI.pNext = nullptr;
-			moduleCI.flags = 0;
-			moduleCI.codeSize = mBytecode->instructions.size;
-			moduleCI.pCode = (uint32_t*)mBytecode->instructions.data;
+			const String bytecode((const char*)mBytecode->instructions.data, mBytecode->instructions.size);
+			mModulesKey = ShaderCompileCache::generateKey({ bytecode, toString((UINT32)mDeviceMask) });
+			mModules = getShaderModules(mModulesKey, mBytecode->instructions, mDeviceMask);
 
-			VulkanUtility::getDevices(rapi, mDeviceMask, devices);
-
-			for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
+			// Constant values are read directly from the program's list of constants
+			for (UINT32 i = 0; i < (UINT32)mSpecializationConstants.size(); i++)
 			{
-				if (devices[i] != nullptr)
-				{
-					VkDevice vkDevice = devices[i]->getLogical();
-					VulkanResourceManager& rescManager = devices[i]->getResourceManager();
-
-					VkShaderModule shaderModule;
-					VkResult result = vkCreateShaderModule(vkDevice, &moduleCI, gVulkanAllocator, &shaderModule);
-					assert(result == VK_SUCCESS);
+				VkSpecializationMapEntry entry;
+				entry.constantID = mSpecializationConstants[i].id;
+				entry.offset = (uint32_t)(i * sizeof(GpuProgramSpecializationConstant) + 
+					offsetof(GpuProgramSpecializationConstant, value));
+				entry.size = sizeof(INT32);
 
-					mModules[i] = rescManager.create<VulkanShaderModule>(shaderModule);
-				}
+				mSpecializationEntries.push_back(entry);
 			}
 
+			mSpecializationInfo.mapEntryCount = (uint32_t)mSpecializationEntries.size();
+			mSpecializationInfo.pMapEntries = mSpecializationEntries.data();
+			mSpecializationInfo.dataSize = mSpecializationConstants.size() * sizeof(GpuProgramSpecializationConstant);
+			mSpecializationInfo.pData = mSpecializationConstants.data();
+
 			mParametersDesc = mBytecode->paramDesc;
 
 			if (mType == GPT_VERTEX_PROGRAM)
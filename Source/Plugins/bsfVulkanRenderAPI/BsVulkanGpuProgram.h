@@ -26,6 +26,14 @@ namespace bs { namespace ct
 		VkShaderModule mModule;
 	};
 
+	/** Shader modules for all devices, shared by all programs created from identical bytecode. */
+	struct VulkanShaderModules
+	{
+		~VulkanShaderModules();
+
+		VulkanShaderModule* modules[BS_MAX_DEVICES] = {};
+	};
+
 	/**	Abstraction of a Vulkan shader object. */
 	class VulkanGpuProgram : public GpuProgram
 	{
@@ -36,11 +44,23 @@ namespace bs { namespace ct
 		 * Returns the shader module for the specified device. If program device mask doesn't include the provided device, 
 		 * null is returned.  
 		 */
-		VulkanShaderModule* getShaderModule(UINT32 deviceIdx) const { return mModules[deviceIdx]; }
+		VulkanShaderModule* getShaderModule(UINT32 deviceIdx) const
+		{
+			return mModules != nullptr ? mModules->modules[deviceIdx] : nullptr;
+		}
 
 		/** Returns the name of the program entry point function. */
 		const String& getEntryPoint() const { return mEntryPoint; }
 
+		/** 
+		 * Returns information about the specialization constants to specialize the program with when creating a
+		 * pipeline, or null if the program has no specialization constants.
+		 */
+		const VkSpecializationInfo* getSpecializationInfo() const 
+		{
+			return mSpecializationEntries.empty() ? nullptr : &mSpecializationInfo;
+		}
+
 	protected:
 		friend class VulkanGLSLProgramFactory;
 
@@ -51,7 +71,11 @@ namespace bs { namespace ct
 
 	private:
 		GpuDeviceFlags mDeviceMask;
-		VulkanShaderModule* mModules[BS_MAX_DEVICES];
+		SPtr<VulkanShaderModules> mModules;
+		String mModulesKey;
+
+		Vector<VkSpecializationMapEntry> mSpecializationEntries;
+		VkSpecializationInfo mSpecializationInfo;
 	};
 
 	/** Identifier of the compiler used for compiling Vulkan GPU programs. */
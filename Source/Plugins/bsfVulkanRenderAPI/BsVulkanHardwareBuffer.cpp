@@ -3,10 +3,12 @@
 #include "BsVulkanHardwareBuffer.h"
 #include "BsVulkanRenderAPI.h"
 #include "BsVulkanDevice.h"
+#include "BsVulkanStagingBufferPool.h"
 #include "BsVulkanUtility.h"
 #include "Managers/BsVulkanCommandBufferManager.h"
 #include "BsVulkanCommandBuffer.h"
 #include "BsVulkanTexture.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
 
 namespace bs { namespace ct
 {
@@ -20,6 +22,16 @@ namespace bs { namespace ct
 			mSliceHeight = 0;
 	}
 
+	void VulkanBuffer::setPitch(UINT32 rowPitch, UINT32 slicePitch)
+	{
+		mRowPitch = rowPitch;
+
+		if (rowPitch != 0)
+			mSliceHeight = slicePitch / rowPitch;
+		else
+			mSliceHeight = 0;
+	}
+
 	VulkanBuffer::~VulkanBuffer()
 	{
 		VulkanDevice& device = mOwner->getDevice();
@@ -29,6 +41,9 @@ namespace bs { namespace ct
 
 		vkDestroyBuffer(device.getLogical(), mBuffer, gVulkanAllocator);
 		device.freeMemory(mAllocation);
+
+		// Only registered for staging buffers
+		BS_GPU_MEMORY_FREE(this);
 	}
 
 	UINT8* VulkanBuffer::map(VkDeviceSize offset, VkDeviceSize length) const
@@ -93,7 +108,7 @@ namespace bs { namespace ct
 		UINT32 size, GpuDeviceFlags deviceMask)
 		: HardwareBuffer(size), mBuffers(), mStagingBuffer(nullptr), mStagingMemory(nullptr), mMappedDeviceIdx(-1)
 		, mMappedGlobalQueueIdx(-1), mMappedOffset(0), mMappedSize(0), mMappedLockOptions(GBL_WRITE_ONLY)
-		, mDirectlyMappable((usage & GBU_DYNAMIC) != 0), mSupportsGPUWrites(type == BT_STORAGE), mRequiresView(false)
+		, mDirectlyMappable((usage & GBU_DYNAMIC) != 0), mSupportsGPUWrites(type == BT_STORAGE || type == BT_VERTEX_STORAGE), mRequiresView(false)
 		, mIsMapped(false)
 	{
 		VkBufferUsageFlags usageFlags = 0;
@@ -120,6 +135,15 @@ namespace bs { namespace ct
 		case BT_STRUCTURED:
 			usageFlags = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 			break;
+		case BT_VERTEX_STORAGE:
+			usageFlags = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | 
+				VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+			mRequiresView = true;
+			break;
+		case BT_INDIRECT:
+			usageFlags = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | 
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+			break;
 		}
 
 		mBufferCI.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -379,8 +403,8 @@ namespace bs { namespace ct
 			return mStagingMemory;
 		}
 
-		// Create a staging buffer
-		mStagingBuffer = createBuffer(device, length, true, needRead);
+		// Grab a staging buffer from the pool
+		mStagingBuffer = device.getStagingBufferPool().acquire(length, needRead);
 
 		if (needRead)
 		{
@@ -524,7 +548,9 @@ namespace bs { namespace ct
 
 			if (mStagingBuffer != nullptr)
 			{
-				mStagingBuffer->destroy();
+				VulkanRenderAPI& rapi = static_cast<VulkanRenderAPI&>(RenderAPI::instance());
+				rapi._getDevice(mMappedDeviceIdx)->getStagingBufferPool().release(mStagingBuffer);
+
 				mStagingBuffer = nullptr;
 			}
 
@@ -46,6 +46,12 @@ namespace bs { namespace ct
 		 */
 		UINT32 getSliceHeight() const { return mSliceHeight; }
 
+		/** 
+		 * Changes the layout of the image sub-resource the buffer maps to. Used when re-purposing pooled staging buffers.
+		 * See constructor for parameter details.
+		 */
+		void setPitch(UINT32 rowPitch, UINT32 slicePitch);
+
 		/** 
 		 * Returns a pointer to internal buffer memory. Must be followed by unmap(). Caller must ensure the buffer was
 		 * created in CPU readable memory, and that buffer isn't currently being written to by the GPU.
@@ -104,7 +110,11 @@ namespace bs { namespace ct
 			/** Generic read/write GPU buffer containing non-formatted data. */
 			BT_STORAGE,
 			/** Read/write GPU buffer containing structured data. */
-			BT_STRUCTURED
+			BT_STRUCTURED,
+			/** Vertex buffer that can also be read and written as a generic buffer containing formatted data. */
+			BT_VERTEX_STORAGE,
+			/** Contains arguments for indirect draw calls. Can also be written to by a compute shader. */
+			BT_INDIRECT
 		};
 
 		VulkanHardwareBuffer(BufferType type, GpuBufferFormat format, GpuBufferUsage usage, UINT32 size,
@@ -59,6 +59,10 @@ namespace bs { namespace ct
 	class VulkanBuffer;
 	class VulkanImage;
 	class VulkanDescriptorPool;
+	class VulkanTransientDescriptorPool;
+	class VulkanUniformRingBuffer;
+	class VulkanStagingBufferPool;
+	class VulkanBindlessTextures;
 	class VulkanGpuParams;
 	class VulkanTransferBuffer;
 	class VulkanEvent;
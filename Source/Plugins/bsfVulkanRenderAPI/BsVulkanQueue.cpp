@@ -161,6 +161,21 @@ namespace bs { namespace ct
 		presentInfo.pImageIndices = &backBufferIdx;
 		presentInfo.pResults = nullptr;
 
+		// Tag the present so the swap chain can later wait until it's displayed
+		UINT64 presentId = 0;
+		VkPresentIdKHR presentIdInfo;
+		if (swapChain->usesPresentId())
+		{
+			presentId = swapChain->notifyPresentIssued();
+
+			presentIdInfo.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+			presentIdInfo.pNext = nullptr;
+			presentIdInfo.swapchainCount = 1;
+			presentIdInfo.pPresentIds = &presentId;
+
+			presentInfo.pNext = &presentIdInfo;
+		}
+
 		// Wait before presenting, if required
 		if (semaphoresCount > 0)
 		{
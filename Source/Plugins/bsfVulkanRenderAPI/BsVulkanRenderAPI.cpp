@@ -16,10 +16,17 @@
 #include "BsVulkanCommandBuffer.h"
 #include "BsVulkanGpuParams.h"
 #include "Managers/BsVulkanVertexInputManager.h"
+#include "Managers/BsVulkanDescriptorManager.h"
+#include "BsVulkanUniformRingBuffer.h"
+#include "BsVulkanStagingBufferPool.h"
+#include "BsVulkanBindlessTextures.h"
+#include "BsVulkanTexture.h"
 #include "BsVulkanGpuParamBlockBuffer.h"
+#include "BsVulkanGpuBuffer.h"
 
 #include <vulkan/vulkan.h>
 #include "BsVulkanUtility.h"
+#include "FileSystem/BsFileSystem.h"
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 	#include "Win32/BsWin32VideoModeInfo.h"
@@ -48,6 +55,9 @@ namespace bs { namespace ct
 	PFN_vkAcquireNextImageKHR vkAcquireNextImageKHR = nullptr;
 	PFN_vkQueuePresentKHR vkQueuePresentKHR = nullptr;
 
+	PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR = nullptr;
+	PFN_vkGetPhysicalDeviceProperties2KHR vkGetPhysicalDeviceProperties2KHR = nullptr;
+
 	VkBool32 debugMsgCallback(VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objType, uint64_t srcObject,
 		size_t location, int32_t msgCode, const char* pLayerPrefix, const char* pMsg, void* pUserData)
 	{
@@ -82,8 +92,23 @@ namespace bs { namespace ct
 		return VK_FALSE;
 	}
 
+	/** Returns the feature flags supported by the Vulkan render API regardless of the device used. */
+	static RenderAPIFeatures getBaseFeatureFlags()
+	{
+		return
+			RenderAPIFeatureFlag::NDCYAxisDown |
+			RenderAPIFeatureFlag::ColumnMajorMatrices |
+			RenderAPIFeatureFlag::MultiThreadedCB |
+			RenderAPIFeatureFlag::MSAAImageStores |
+			RenderAPIFeatureFlag::TextureViews |
+			RenderAPIFeatureFlag::Compute |
+			RenderAPIFeatureFlag::LoadStore |
+			RenderAPIFeatureFlag::ByteCodeCaching |
+			RenderAPIFeatureFlag::RenderTargetLayers;
+	}
+
 	VulkanRenderAPI::VulkanRenderAPI()
-		:mInstance(nullptr)
+		:mInstance(nullptr), mAPIInfo(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, getBaseFeatureFlags())
 	{
 #if BS_DEBUG_MODE
 		mDebugCallback = nullptr;
@@ -101,6 +126,12 @@ namespace bs { namespace ct
 		return strName;
 	}
 
+	/** Returns the folder in which pipeline caches of all devices are stored between runs. */
+	static Path getPipelineCacheFolder()
+	{
+		return FileSystem::getTempDirectoryPath() + Path("bsf/VulkanPipelineCache/");
+	}
+
 	void VulkanRenderAPI::initialize()
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -150,7 +181,29 @@ namespace bs { namespace ct
 		extensions[1] = VK_KHR_XLIB_SURFACE_EXTENSION_NAME;
 #endif
 
-		uint32_t numExtensions = sizeof(extensions) / sizeof(extensions[0]);
+		Vector<const char*> enabledExtensions(extensions, extensions + sizeof(extensions) / sizeof(extensions[0]));
+
+		// Optional extension, required for querying support for descriptor indexing (used by bindless textures)
+		bool physicalDeviceProperties2Ext = false;
+
+		uint32_t numAvailableExtensions = 0;
+		vkEnumerateInstanceExtensionProperties(nullptr, &numAvailableExtensions, nullptr);
+		if (numAvailableExtensions > 0)
+		{
+			Vector<VkExtensionProperties> availableExtensions(numAvailableExtensions);
+			if (vkEnumerateInstanceExtensionProperties(nullptr, &numAvailableExtensions, availableExtensions.data()) == VK_SUCCESS)
+			{
+				for (auto& entry : availableExtensions)
+				{
+					if (strcmp(entry.extensionName, VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) == 0)
+					{
+						enabledExtensions.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+						physicalDeviceProperties2Ext = true;
+						break;
+					}
+				}
+			}
+		}
 
 		VkInstanceCreateInfo instanceInfo;
 		instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
@@ -159,8 +212,8 @@ namespace bs { namespace ct
 		instanceInfo.pApplicationInfo = &appInfo;
 		instanceInfo.enabledLayerCount = numLayers;
 		instanceInfo.ppEnabledLayerNames = layers;
-		instanceInfo.enabledExtensionCount = numExtensions;
-		instanceInfo.ppEnabledExtensionNames = extensions;
+		instanceInfo.enabledExtensionCount = (uint32_t)enabledExtensions.size();
+		instanceInfo.ppEnabledExtensionNames = enabledExtensions.data();
 
 		VkResult result = vkCreateInstance(&instanceInfo, gVulkanAllocator, &mInstance);
 		assert(result == VK_SUCCESS);
@@ -184,6 +237,13 @@ namespace bs { namespace ct
 		assert(result == VK_SUCCESS);
 #endif
 
+		// Needed by the devices to query support for optional features
+		if (physicalDeviceProperties2Ext)
+		{
+			GET_INSTANCE_PROC_ADDR(mInstance, GetPhysicalDeviceFeatures2KHR);
+			GET_INSTANCE_PROC_ADDR(mInstance, GetPhysicalDeviceProperties2KHR);
+		}
+
 		// Enumerate all devices
 		result = vkEnumeratePhysicalDevices(mInstance, &mNumDevices, nullptr);
 		assert(result == VK_SUCCESS);
@@ -196,6 +256,10 @@ namespace bs { namespace ct
 		for(uint32_t i = 0; i < mNumDevices; i++)
 			mDevices[i] = bs_shared_ptr_new<VulkanDevice>(physicalDevices[i], i);
 
+		// Restore pipelines compiled during previous runs, to avoid recompiling them on first use
+		for(uint32_t i = 0; i < mNumDevices; i++)
+			mDevices[i]->loadPipelineCache(getPipelineCacheFolder());
+
 		// Find primary device
 		// Note: MULTIGPU - Detect multiple similar devices here if supporting multi-GPU
 		for (uint32_t i = 0; i < mNumDevices; i++)
@@ -213,6 +277,13 @@ namespace bs { namespace ct
 		if (mPrimaryDevices.size() == 0)
 			mPrimaryDevices.push_back(mDevices[0]);
 
+		// Device specific feature flags are only known once the devices are created
+		RenderAPIFeatures featureFlags = getBaseFeatureFlags();
+		if (mPrimaryDevices[0]->isTileBased())
+			featureFlags |= RenderAPIFeatureFlag::TileBasedGPU;
+
+		mAPIInfo = RenderAPIInfo(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, featureFlags);
+
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 		mVideoModeInfo = bs_shared_ptr_new<Win32VideoModeInfo>();
 #elif BS_PLATFORM == BS_PLATFORM_LINUX
@@ -310,6 +381,9 @@ namespace bs { namespace ct
 
 		CommandBufferManager::shutDown();
 
+		for (UINT32 i = 0; i < (UINT32)mDevices.size(); i++)
+			mDevices[i]->savePipelineCache(getPipelineCacheFolder());
+
 		mPrimaryDevices.clear();
 		mDevices.clear();
 
@@ -327,6 +401,9 @@ namespace bs { namespace ct
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getBoundState().setGraphicsPipeline(pipelineState))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setPipelineState(pipelineState);
@@ -338,6 +415,9 @@ namespace bs { namespace ct
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getBoundState().setComputePipeline(pipelineState))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setPipelineState(pipelineState);
@@ -449,6 +529,52 @@ namespace bs { namespace ct
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
+	void VulkanRenderAPI::drawIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		VulkanCmdBuffer* vkCB = cb->getInternal();
+
+		VulkanGpuBuffer* vkArgsBuffer = static_cast<VulkanGpuBuffer*>(argsBuffer.get());
+		VulkanBuffer* argsResource = vkArgsBuffer->getResource(vkCB->getDeviceIdx());
+		if (argsResource == nullptr)
+			return;
+
+		vkCB->drawIndirect(argsResource, offset, 1);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+	}
+
+	void VulkanRenderAPI::drawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		multiDrawIndexedIndirect(argsBuffer, offset, 1, nullptr, 0, commandBuffer);
+	}
+
+	void VulkanRenderAPI::multiDrawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, UINT32 drawCount,
+		const SPtr<GpuBuffer>& countBuffer, UINT32 countOffset, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		VulkanCmdBuffer* vkCB = cb->getInternal();
+		UINT32 deviceIdx = vkCB->getDeviceIdx();
+
+		VulkanGpuBuffer* vkArgsBuffer = static_cast<VulkanGpuBuffer*>(argsBuffer.get());
+		VulkanBuffer* argsResource = vkArgsBuffer->getResource(deviceIdx);
+		if (argsResource == nullptr)
+			return;
+
+		VulkanBuffer* countResource = nullptr;
+		if (countBuffer != nullptr)
+		{
+			VulkanGpuBuffer* vkCountBuffer = static_cast<VulkanGpuBuffer*>(countBuffer.get());
+			countResource = vkCountBuffer->getResource(deviceIdx);
+		}
+
+		vkCB->drawIndexedIndirect(argsResource, offset, drawCount, countResource, countOffset);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+	}
+
 	void VulkanRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
@@ -478,6 +604,14 @@ namespace bs { namespace ct
 		vkCB->setStencilRef(value);
 	}
 
+	void VulkanRenderAPI::setShadingRate(ShadingRate rate, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		VulkanCmdBuffer* vkCB = cb->getInternal();
+
+		vkCB->setShadingRate(rate);
+	}
+
 	void VulkanRenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
@@ -522,8 +656,21 @@ namespace bs { namespace ct
 		VulkanCommandBufferManager& cbm = static_cast<VulkanCommandBufferManager&>(CommandBufferManager::instance());
 		
 		for (UINT32 i = 0; i < (UINT32)mDevices.size(); i++)
+		{
 			cbm.refreshStates(i);
 
+			// Release transient descriptor sets and uniform buffer pages the GPU is done with, and trim unused staging
+			// buffers
+			mDevices[i]->getDescriptorManager().advanceFrame();
+			mDevices[i]->getUniformRingBuffer().advanceFrame();
+			mDevices[i]->getStagingBufferPool().advanceFrame();
+
+			// Release bindless texture slots the GPU can no longer access
+			VulkanBindlessTextures* bindlessTextures = mDevices[i]->getBindlessTextures();
+			if (bindlessTextures != nullptr)
+				bindlessTextures->advanceFrame();
+		}
+
 		BS_INC_RENDER_STAT(NumPresents);
 	}
 
@@ -561,19 +708,29 @@ namespace bs { namespace ct
 
 	const RenderAPIInfo& VulkanRenderAPI::getAPIInfo() const
 	{
-		RenderAPIFeatures featureFlags =
-			RenderAPIFeatureFlag::NDCYAxisDown |
-			RenderAPIFeatureFlag::ColumnMajorMatrices |
-			RenderAPIFeatureFlag::MultiThreadedCB |
-			RenderAPIFeatureFlag::MSAAImageStores |
-			RenderAPIFeatureFlag::TextureViews |
-			RenderAPIFeatureFlag::Compute |
-			RenderAPIFeatureFlag::LoadStore |
-			RenderAPIFeatureFlag::ByteCodeCaching |
-			RenderAPIFeatureFlag::RenderTargetLayers;
+		return mAPIInfo;
+	}
+
+	GpuMemoryStats VulkanRenderAPI::getGpuMemoryStats(UINT32 deviceIdx) const
+	{
+		GpuMemoryStats stats = RenderAPI::getGpuMemoryStats(deviceIdx);
+
+		if(deviceIdx < (UINT32)mDevices.size())
+			stats.heaps = mDevices[deviceIdx]->getMemoryHeapStats();
 
-		static RenderAPIInfo info(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, featureFlags);
-		return info;
+		return stats;
+	}
+
+	UINT32 VulkanRenderAPI::getBindlessTextureIndex(const SPtr<Texture>& texture, UINT32 deviceIdx)
+	{
+		if (texture == nullptr || deviceIdx >= (UINT32)mDevices.size())
+			return (UINT32)-1;
+
+		VulkanBindlessTextures* bindlessTextures = mDevices[deviceIdx]->getBindlessTextures();
+		if (bindlessTextures == nullptr)
+			return (UINT32)-1;
+
+		return bindlessTextures->registerTexture(static_cast<VulkanTexture*>(texture.get()));
 	}
 
 	GpuParamBlockDesc VulkanRenderAPI::generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params)
@@ -683,6 +840,19 @@ namespace bs { namespace ct
 			caps.setNumMultiRenderTargets(deviceLimits.maxColorAttachments);
 
 			caps.setCapability(RSC_COMPUTE_PROGRAM);
+			caps.setCapability(RSC_DRAW_INDIRECT);
+
+			if (deviceFeatures.multiDrawIndirect)
+				caps.setCapability(RSC_MULTI_DRAW_INDIRECT);
+
+			if (device->hasDrawIndirectCount())
+				caps.setCapability(RSC_DRAW_INDIRECT_COUNT);
+
+			if (device->hasFragmentShadingRate())
+				caps.setCapability(RSC_VARIABLE_RATE_SHADING);
+
+			if (device->getBindlessTextures() != nullptr)
+				caps.setCapability(RSC_BINDLESS_TEXTURES);
 
 			caps.setNumTextureUnits(GPT_FRAGMENT_PROGRAM, deviceLimits.maxPerStageDescriptorSampledImages);
 			caps.setNumTextureUnits(GPT_VERTEX_PROGRAM, deviceLimits.maxPerStageDescriptorSampledImages);
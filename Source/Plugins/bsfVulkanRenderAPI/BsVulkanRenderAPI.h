@@ -55,6 +55,9 @@ namespace bs { namespace ct
 		/** @copydoc RenderAPI::setStencilRef */
 		void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
 
+		/** @copydoc RenderAPI::setShadingRate */
+		void setShadingRate(ShadingRate rate, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
 		/** @copydoc RenderAPI::setVertexBuffers */
 		void setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
 			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
@@ -79,6 +82,19 @@ namespace bs { namespace ct
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, 
 			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
 
+		/** @copydoc RenderAPI::drawIndirect */
+		void drawIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::drawIndexedIndirect */
+		void drawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::multiDrawIndexedIndirect */
+		void multiDrawIndexedIndirect(const SPtr<GpuBuffer>& argsBuffer, UINT32 offset, UINT32 drawCount,
+			const SPtr<GpuBuffer>& countBuffer = nullptr, UINT32 countOffset = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
 		/** @copydoc RenderAPI::dispatchCompute */
 		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1,
 			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
@@ -98,6 +114,12 @@ namespace bs { namespace ct
 		/** @copydoc RenderAPI::getAPIInfo */
 		const RenderAPIInfo& getAPIInfo() const override;
 
+		/** @copydoc RenderAPI::getGpuMemoryStats */
+		GpuMemoryStats getGpuMemoryStats(UINT32 deviceIdx = 0) const override;
+
+		/** @copydoc RenderAPI::getBindlessTextureIndex */
+		UINT32 getBindlessTextureIndex(const SPtr<Texture>& texture, UINT32 deviceIdx = 0) override;
+
 		/** @copydoc RenderAPI::generateParamBlockDesc() */
 		GpuParamBlockDesc generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params) override;
 
@@ -154,6 +176,7 @@ namespace bs { namespace ct
 		SPtr<VulkanCommandBuffer> mMainCommandBuffer;
 
 		VulkanGLSLProgramFactory* mGLSLFactory;
+		RenderAPIInfo mAPIInfo;
 
 #if BS_DEBUG_MODE
 		VkDebugReportCallbackEXT mDebugCallback;
@@ -174,5 +197,8 @@ namespace bs { namespace ct
 	extern PFN_vkAcquireNextImageKHR vkAcquireNextImageKHR;
 	extern PFN_vkQueuePresentKHR vkQueuePresentKHR;
 
+	extern PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR;
+	extern PFN_vkGetPhysicalDeviceProperties2KHR vkGetPhysicalDeviceProperties2KHR;
+
 	/** @} */
 }}
\ No newline at end of file
@@ -119,6 +119,9 @@ namespace bs { namespace ct
 		/** Returns on how many command buffers is the buffer currently bound on. */
 		UINT32 getBoundCount() const { return mNumBoundHandles; }
 
+		/** Returns the manager that created this resource. */
+		VulkanResourceManager* getOwner() const { return mOwner; }
+
 		/** Returns true if the resource is only allowed to be used by a single queue family at once. */
 		bool isExclusive() const { Lock lock(mMutex); return mState != State::Shared; }
 
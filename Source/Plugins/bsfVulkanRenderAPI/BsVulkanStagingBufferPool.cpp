@@ -0,0 +1,132 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsVulkanStagingBufferPool.h"
+#include "BsVulkanDevice.h"
+#include "BsVulkanHardwareBuffer.h"
+#include "Utility/BsBitwise.h"
+#include "Profiling/BsGpuMemoryProfiler.h"
+
+namespace bs { namespace ct
+{
+	VulkanStagingBufferPool::VulkanStagingBufferPool(VulkanDevice& device)
+		:mDevice(device)
+	{ }
+
+	VulkanStagingBufferPool::~VulkanStagingBufferPool()
+	{
+		for(auto& entry : mFreeBuffers)
+			entry.buffer->destroy();
+
+		// Buffers should have been released by now, but destroy them anyway as the device is going away
+		for(auto& entry : mAcquiredBuffers)
+			entry.first->destroy();
+	}
+
+	VulkanBuffer* VulkanStagingBufferPool::acquire(UINT32 size, bool readable)
+	{
+		if(size > MAX_BUFFER_SIZE)
+			return createBuffer(size, readable);
+
+		UINT32 bufferSize = std::max(MIN_BUFFER_SIZE, Bitwise::nextPow2(size));
+
+		Lock lock(mMutex);
+
+		// Readable buffers can be used for writes as well, but prefer an exact match so they remain available for reads
+		INT32 foundIdx = -1;
+		for(UINT32 i = 0; i < (UINT32)mFreeBuffers.size(); i++)
+		{
+			const Entry& entry = mFreeBuffers[i];
+			if(entry.size != bufferSize || (readable && !entry.readable))
+				continue;
+
+			if(entry.buffer->isBound() || entry.buffer->isUsed())
+				continue;
+
+			foundIdx = (INT32)i;
+			if(entry.readable == readable)
+				break;
+		}
+
+		Entry entry;
+		if(foundIdx != -1)
+		{
+			entry = mFreeBuffers[foundIdx];
+			mFreeBuffers.erase(mFreeBuffers.begin() + foundIdx);
+		}
+		else
+		{
+			entry.buffer = createBuffer(bufferSize, readable);
+			entry.size = bufferSize;
+			entry.readable = readable;
+		}
+
+		entry.lastUsedFrame = mFrameIdx;
+		mAcquiredBuffers[entry.buffer] = entry;
+
+		return entry.buffer;
+	}
+
+	void VulkanStagingBufferPool::release(VulkanBuffer* buffer)
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mAcquiredBuffers.find(buffer);
+		if(iterFind == mAcquiredBuffers.end())
+		{
+			// Not pooled
+			buffer->destroy();
+			return;
+		}
+
+		iterFind->second.lastUsedFrame = mFrameIdx;
+		mFreeBuffers.push_back(iterFind->second);
+		mAcquiredBuffers.erase(iterFind);
+	}
+
+	void VulkanStagingBufferPool::advanceFrame()
+	{
+		Lock lock(mMutex);
+
+		mFrameIdx++;
+
+		for(auto iter = mFreeBuffers.begin(); iter != mFreeBuffers.end();)
+		{
+			if((mFrameIdx - iter->lastUsedFrame) > MAX_UNUSED_FRAMES)
+			{
+				// Destruction is delayed until the GPU is done with the buffer, if it is still in use
+				iter->buffer->destroy();
+				iter = mFreeBuffers.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	VulkanBuffer* VulkanStagingBufferPool::createBuffer(UINT32 size, bool readable)
+	{
+		VkBufferCreateInfo bufferCI;
+		bufferCI.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		bufferCI.pNext = nullptr;
+		bufferCI.flags = 0;
+		bufferCI.size = size;
+		bufferCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		bufferCI.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+		bufferCI.queueFamilyIndexCount = 0;
+		bufferCI.pQueueFamilyIndices = nullptr;
+
+		if (readable)
+			bufferCI.usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
+		VkBuffer buffer;
+		VkResult result = vkCreateBuffer(mDevice.getLogical(), &bufferCI, gVulkanAllocator, &buffer);
+		assert(result == VK_SUCCESS);
+
+		VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+		VmaAllocation allocation = mDevice.allocateMemory(buffer, flags);
+
+		VulkanBuffer* output = mDevice.getResourceManager().create<VulkanBuffer>(buffer, VK_NULL_HANDLE, allocation);
+		BS_GPU_MEMORY_ALLOC(GpuMemoryCategory::Staging, output, size);
+
+		return output;
+	}
+}}
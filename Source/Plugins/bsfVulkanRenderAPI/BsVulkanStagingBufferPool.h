@@ -0,0 +1,75 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsVulkanPrerequisites.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup Vulkan
+	 *  @{
+	 */
+
+	/**
+	 * Keeps a pool of host visible buffers used as a source or destination for transfers between the CPU and GPU
+	 * resources. Buffers are re-used once the GPU is done with them, so frequent writes (e.g. when streaming textures) 
+	 * don't need to create and allocate memory for a new buffer on each write.
+	 *
+	 * @note	Thread safe.
+	 */
+	class VulkanStagingBufferPool
+	{
+	public:
+		VulkanStagingBufferPool(VulkanDevice& device);
+		~VulkanStagingBufferPool();
+
+		/**
+		 * Returns a host visible buffer of at least @p size bytes, usable as a transfer source. If @p readable is true the
+		 * buffer can also be used as a transfer destination. The buffer should be returned using release() when no longer
+		 * needed.
+		 */
+		VulkanBuffer* acquire(UINT32 size, bool readable);
+
+		/** 
+		 * Returns a buffer previously retrieved through acquire() back to the pool. The buffer can still be in use by the
+		 * GPU, in which case it will only be handed out again once the GPU is done with it. The caller must not use the
+		 * buffer after this call.
+		 */
+		void release(VulkanBuffer* buffer);
+
+		/** Destroys pooled buffers that haven't been used for a while. Should be called once per frame. */
+		void advanceFrame();
+
+		/** Size of the smallest buffer in the pool. Smaller requested sizes are rounded up to it. */
+		static constexpr UINT32 MIN_BUFFER_SIZE = 64 * 1024;
+
+		/** Buffers larger than this size are never pooled, and are instead destroyed when released. */
+		static constexpr UINT32 MAX_BUFFER_SIZE = 64 * 1024 * 1024;
+
+		/** Number of frames a buffer can remain unused in the pool before it is destroyed. */
+		static constexpr UINT32 MAX_UNUSED_FRAMES = 120;
+
+	private:
+		/** Information about a single pooled buffer. */
+		struct Entry
+		{
+			VulkanBuffer* buffer;
+			UINT32 size;
+			bool readable;
+			UINT64 lastUsedFrame;
+		};
+
+		/** Creates a new host visible staging buffer. */
+		VulkanBuffer* createBuffer(UINT32 size, bool readable);
+
+		VulkanDevice& mDevice;
+
+		Vector<Entry> mFreeBuffers;
+		UnorderedMap<VulkanBuffer*, Entry> mAcquiredBuffers;
+		UINT64 mFrameIdx = 0;
+
+		Mutex mMutex;
+	};
+
+	/** @} */
+}}
@@ -13,6 +13,13 @@ namespace bs { namespace ct
 		clear(mSwapChain);
 	}
 
+	void VulkanSwapChain::setPresentSettings(PresentMode presentMode, UINT32 numImages, UINT32 maxFrameLatency)
+	{
+		mPresentMode = presentMode;
+		mRequestedNumImages = numImages;
+		mMaxFrameLatency = maxFrameLatency;
+	}
+
 	void VulkanSwapChain::rebuild(const SPtr<VulkanDevice>& device, VkSurfaceKHR surface, UINT32 width, UINT32 height, 
 		bool vsync, VkFormat colorFormat, VkColorSpaceKHR colorSpace, bool createDepth, VkFormat depthFormat)
 	{
@@ -49,8 +56,32 @@ namespace bs { namespace ct
 		result = vkGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, &numPresentModes, presentModes);
 		assert(result == VK_SUCCESS);
 
+		// Use the explicitly requested mode, if supported
+		VkPresentModeKHR requestedMode = VK_PRESENT_MODE_MAX_ENUM_KHR;
+		switch(mPresentMode)
+		{
+		case PresentMode::Immediate: requestedMode = VK_PRESENT_MODE_IMMEDIATE_KHR; break;
+		case PresentMode::Mailbox: requestedMode = VK_PRESENT_MODE_MAILBOX_KHR; break;
+		case PresentMode::Fifo: requestedMode = VK_PRESENT_MODE_FIFO_KHR; break;
+		case PresentMode::FifoRelaxed: requestedMode = VK_PRESENT_MODE_FIFO_RELAXED_KHR; break;
+		default: break;
+		}
+
+		bool foundRequestedMode = false;
+		for (UINT32 i = 0; i < numPresentModes; i++)
+		{
+			if (presentModes[i] == requestedMode)
+			{
+				foundRequestedMode = true;
+				break;
+			}
+		}
+
+		// FIFO is always supported
 		VkPresentModeKHR presentMode = VK_PRESENT_MODE_FIFO_KHR;
-		if(!vsync)
+		if(foundRequestedMode)
+			presentMode = requestedMode;
+		else if(!vsync)
 		{
 			for (UINT32 i = 0; i < numPresentModes; i++)
 			{
@@ -83,7 +114,9 @@ namespace bs { namespace ct
 
 		bs_stack_free(presentModes);
 
-		uint32_t numImages = surfaceCaps.minImageCount;
+		uint32_t numImages = std::max(surfaceCaps.minImageCount, mRequestedNumImages);
+		if (surfaceCaps.maxImageCount > 0) // Zero means there is no limit
+			numImages = std::min(numImages, surfaceCaps.maxImageCount);
 
 		VkSurfaceTransformFlagsKHR transform;
 		if (surfaceCaps.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR)
@@ -117,6 +150,7 @@ namespace bs { namespace ct
 		assert(result == VK_SUCCESS);
 
 		clear(oldSwapChain);
+		mLastPresentId = 0;
 
 		result = vkGetSwapchainImagesKHR(logicalDevice, mSwapChain, &numImages, nullptr);
 		assert(result == VK_SUCCESS);
@@ -241,6 +275,21 @@ namespace bs { namespace ct
 		return true;
 	}
 
+	bool VulkanSwapChain::usesPresentId() const
+	{
+		return mMaxFrameLatency > 0 && mDevice->hasPresentWait();
+	}
+
+	void VulkanSwapChain::waitForFrameLatency()
+	{
+		if (!usesPresentId() || mLastPresentId <= mMaxFrameLatency)
+			return;
+
+		// Time out after a second, in case the present never gets displayed (e.g. the window is minimized)
+		const UINT64 timeout = 1000000000;
+		mDevice->getWaitForPresent()(mDevice->getLogical(), mSwapChain, mLastPresentId - mMaxFrameLatency, timeout);
+	}
+
 	void VulkanSwapChain::notifyBackBufferWaitIssued()
 	{
 		if (!mSurfaces[mCurrentBackBufferIdx].acquired)
@@ -4,6 +4,7 @@
 
 #include "BsVulkanPrerequisites.h"
 #include "BsVulkanFramebuffer.h"
+#include "RenderAPI/BsRenderWindow.h"
 
 namespace bs { namespace ct
 {
@@ -29,6 +30,17 @@ namespace bs { namespace ct
 	public:
 		~VulkanSwapChain();
 
+		/**
+		 * Sets how are frames presented. Takes effect on the next rebuild().
+		 *
+		 * @param[in]	presentMode			Requested present mode. PresentMode::Default picks a mode depending on the
+		 *									vsync flag provided to rebuild().
+		 * @param[in]	numImages			Requested number of swap chain images, zero for the surface minimum. 
+		 * @param[in]	maxFrameLatency		Maximum number of presented frames waiting to be displayed, zero for no
+		 *									limit. Only enforced if the device supports VK_KHR_present_wait.
+		 */
+		void setPresentSettings(PresentMode presentMode, UINT32 numImages, UINT32 maxFrameLatency);
+
 		/** 
 		 * Rebuilds the swap chain with the provided properties. Destroys any previously existing swap chain. Caller must
 		 * ensure the swap chain is not used at the device when this is called.
@@ -75,6 +87,19 @@ namespace bs { namespace ct
 
 		/** Returns the internal swap chain handle. */
 		VkSwapchainKHR getHandle() const { return mSwapChain; }
+
+		/** Checks if presents of this swap chain should be tagged with an ID provided by notifyPresentIssued(). */
+		bool usesPresentId() const;
+
+		/** Returns the ID to tag the present that is about to be issued with. */
+		UINT64 notifyPresentIssued() { return ++mLastPresentId; }
+
+		/** 
+		 * Blocks until the number of presented frames waiting to be displayed drops to the maximum frame latency. 
+		 * Should be called after a present, before rendering the next frame.
+		 */
+		void waitForFrameLatency();
+
 	private:
 		/** Destroys current swap chain and depth stencil image (if any). */
 		void clear(VkSwapchainKHR swapChain);
@@ -90,6 +115,11 @@ namespace bs { namespace ct
 
 		UINT32 mCurrentSemaphoreIdx = 0;
 		UINT32 mCurrentBackBufferIdx = 0;
+
+		PresentMode mPresentMode = PresentMode::Default;
+		UINT32 mRequestedNumImages = 0;
+		UINT32 mMaxFrameLatency = 0;
+		UINT64 mLastPresentId = 0;
 	};
 
 	/** @} */
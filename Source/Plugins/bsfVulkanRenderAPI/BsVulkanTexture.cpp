@@ -3,6 +3,8 @@
 #include "BsVulkanTexture.h"
 #include "BsVulkanRenderAPI.h"
 #include "BsVulkanDevice.h"
+#include "BsVulkanStagingBufferPool.h"
+#include "BsVulkanBindlessTextures.h"
 #include "BsVulkanUtility.h"
 #include "Managers/BsVulkanCommandBufferManager.h"
 #include "BsVulkanHardwareBuffer.h"
@@ -588,11 +590,16 @@ namespace bs { namespace ct
 
 	VulkanTexture::~VulkanTexture()
 	{ 
+		VulkanRenderAPI& rapi = static_cast<VulkanRenderAPI&>(RenderAPI::instance());
 		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
 		{
 			if (mImages[i] == nullptr)
 				return;
 
+			VulkanBindlessTextures* bindlessTextures = rapi._getDevice(i)->getBindlessTextures();
+			if (bindlessTextures != nullptr)
+				bindlessTextures->unregisterTexture(this);
+
 			mImages[i]->destroy();
 		}
 
@@ -651,6 +658,14 @@ namespace bs { namespace ct
 			mImageCI.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
 			mSupportsGPUWrites = true;
 		}
+		else if ((usage & TU_TRANSIENT) != 0 && (usage & (TU_RENDERTARGET | TU_DEPTHSTENCIL)) != 0)
+		{
+			// Transient attachments may only be used as attachments, which lets tile-based GPUs avoid allocating
+			// device memory for them. Input attachment usage is allowed and keeps the read-only layout valid.
+			mImageCI.usage &= ~(VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+				VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+			mImageCI.usage |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+		}
 
 		VkImageTiling tiling = VK_IMAGE_TILING_OPTIMAL;
 		VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
@@ -713,6 +728,9 @@ namespace bs { namespace ct
 			(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) : // Note: Try using cached memory
 			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
 
+		if ((mImageCI.usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) != 0 && device.isTileBased())
+			flags |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+
 		VkDevice vkDevice = device.getLogical();
 
 		mImageCI.format = VulkanUtility::getPixelFormat(format, mProperties.isHardwareGammaEnabled());;
@@ -727,32 +745,10 @@ namespace bs { namespace ct
 
 	VulkanBuffer* VulkanTexture::createStaging(VulkanDevice& device, const PixelData& pixelData, bool readable)
 	{
-		VkBufferCreateInfo bufferCI;
-		bufferCI.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-		bufferCI.pNext = nullptr;
-		bufferCI.flags = 0;
-		bufferCI.size = pixelData.getSize();
-		bufferCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		bufferCI.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-		bufferCI.queueFamilyIndexCount = 0;
-		bufferCI.pQueueFamilyIndices = nullptr;
-
-		if (readable)
-			bufferCI.usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-
-		VkDevice vkDevice = device.getLogical();
-
-		VkBuffer buffer;
-		VkResult result = vkCreateBuffer(vkDevice, &bufferCI, gVulkanAllocator, &buffer);
-		assert(result == VK_SUCCESS);
+		VulkanBuffer* buffer = device.getStagingBufferPool().acquire(pixelData.getSize(), readable);
+		buffer->setPitch(pixelData.getRowPitch(), pixelData.getSlicePitch());
 
-		VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-		VmaAllocation allocation = device.allocateMemory(buffer, flags);
-
-		VkBufferView view = VK_NULL_HANDLE;
-
-		return device.getResourceManager().create<VulkanBuffer>(buffer, view, allocation,
-			pixelData.getRowPitch(), pixelData.getSlicePitch());
+		return buffer;
 	}
 
 	void VulkanTexture::copyImage(VulkanTransferBuffer* cb, VulkanImage* srcImage, VulkanImage* dstImage, 
@@ -1374,7 +1370,9 @@ namespace bs { namespace ct
 				// done automatically before next "normal" command buffer submission.
 			}
 
-			mStagingBuffer->destroy();
+			VulkanRenderAPI& rapi = static_cast<VulkanRenderAPI&>(RenderAPI::instance());
+			rapi._getDevice(mMappedDeviceIdx)->getStagingBufferPool().release(mStagingBuffer);
+
 			mStagingBuffer = nullptr;
 		}
 
@@ -58,6 +58,12 @@ namespace bs { namespace ct
 		/** Returns the preferred (not necessarily current) layout of the image. */
 		VkImageLayout getOptimalLayout() const;
 
+		/**
+		 * Checks if the image is a transient attachment, whose contents don't need to be preserved once the render pass
+		 * it is used in ends. See TU_TRANSIENT.
+		 */
+		bool isTransient() const { return (mUsage & (TU_TRANSIENT | TU_LOADSTORE)) == TU_TRANSIENT; }
+
 		/** 
 		 * Returns an image view that covers all faces and mip maps of the texture. 
 		 * 
@@ -226,12 +232,13 @@ namespace bs { namespace ct
 		VulkanImage* createImage(VulkanDevice& device, PixelFormat format);
 
 		/** 
-		 * Creates a staging buffer that can be used for texture transfer operations.
+		 * Retrieves a staging buffer that can be used for texture transfer operations. The buffer is allocated from the 
+		 * device's staging buffer pool, and should be returned to it once no longer needed.
 		 * 
 		 * @param[in]	device		Device to create the buffer on.
 		 * @param[in]	pixelData	Object that describes the image sub-resource that will be in the buffer.
 		 * @param[in]	needsRead	True if we will be copying data from the buffer, false if just reading. True if both.
-		 * @return					Newly allocated buffer.
+		 * @return					Staging buffer large enough to hold the sub-resource.
 		 */
 		VulkanBuffer* createStaging(VulkanDevice& device, const PixelData& pixelData, bool needsRead);
 
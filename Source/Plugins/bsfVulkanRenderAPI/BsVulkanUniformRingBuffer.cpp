@@ -0,0 +1,133 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsVulkanUniformRingBuffer.h"
+#include "BsVulkanDevice.h"
+#include "BsVulkanHardwareBuffer.h"
+
+namespace bs { namespace ct
+{
+	VulkanUniformRingBuffer::VulkanUniformRingBuffer(VulkanDevice& device)
+		:mDevice(device)
+	{
+		const VkPhysicalDeviceLimits& limits = device.getDeviceProperties().limits;
+
+		mAlignment = std::max(1U, (UINT32)limits.minUniformBufferOffsetAlignment);
+		mMaxAllocationSize = std::min(PAGE_SIZE, (UINT32)limits.maxUniformBufferRange);
+	}
+
+	VulkanUniformRingBuffer::~VulkanUniformRingBuffer()
+	{
+		auto destroyPages = [](Vector<Page>& pages)
+		{
+			for(auto& page : pages)
+			{
+				page.buffer->unmap();
+				page.buffer->destroy();
+			}
+
+			pages.clear();
+		};
+
+		destroyPages(mActivePages);
+		destroyPages(mRetiredPages);
+		destroyPages(mFreePages);
+	}
+
+	bool VulkanUniformRingBuffer::write(const UINT8* data, UINT32 size, Allocation& output)
+	{
+		if (size > mMaxAllocationSize)
+			return false;
+
+		UINT8* dst;
+		{
+			Lock lock(mMutex);
+
+			// Alignment is guaranteed to be a power of two
+			UINT32 offset = (mPageOffset + mAlignment - 1) & ~(mAlignment - 1);
+			if (offset + size > PAGE_SIZE)
+			{
+				mActivePages.push_back(acquirePage());
+				offset = 0;
+			}
+
+			const Page& page = mActivePages.back();
+			mPageOffset = offset + size;
+
+			output.buffer = page.buffer;
+			output.offset = offset;
+			output.frameIdx = mFrameIdx;
+
+			dst = page.data + offset;
+		}
+
+		// The range is exclusively ours, no need to hold the lock while copying
+		memcpy(dst, data, size);
+		return true;
+	}
+
+	bool VulkanUniformRingBuffer::isValid(const Allocation& allocation) const
+	{
+		Lock lock(mMutex);
+		return allocation.buffer != nullptr && allocation.frameIdx == mFrameIdx;
+	}
+
+	void VulkanUniformRingBuffer::advanceFrame()
+	{
+		Lock lock(mMutex);
+
+		mRetiredPages.insert(mRetiredPages.end(), mActivePages.begin(), mActivePages.end());
+		mActivePages.clear();
+
+		mPageOffset = PAGE_SIZE;
+		mFrameIdx++;
+
+		// Pages can be re-used once all command buffers referencing them are done executing. Old allocations pointing to
+		// them are no longer valid, so nothing else can reference them past this point.
+		for(auto iter = mRetiredPages.begin(); iter != mRetiredPages.end();)
+		{
+			if (!iter->buffer->isBound() && !iter->buffer->isUsed())
+			{
+				mFreePages.push_back(*iter);
+				iter = mRetiredPages.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	VulkanUniformRingBuffer::Page VulkanUniformRingBuffer::acquirePage()
+	{
+		if (!mFreePages.empty())
+		{
+			Page page = mFreePages.back();
+			mFreePages.pop_back();
+
+			return page;
+		}
+
+		VkBufferCreateInfo bufferCI;
+		bufferCI.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		bufferCI.pNext = nullptr;
+		bufferCI.flags = 0;
+		bufferCI.size = PAGE_SIZE;
+		bufferCI.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+		bufferCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		bufferCI.queueFamilyIndexCount = 0;
+		bufferCI.pQueueFamilyIndices = nullptr;
+
+		VkBuffer buffer;
+		VkResult result = vkCreateBuffer(mDevice.getLogical(), &bufferCI, gVulkanAllocator, &buffer);
+		assert(result == VK_SUCCESS);
+
+		// Use dedicated memory, since the page remains mapped for its entire lifetime, and memory blocks shared with other
+		// allocations could otherwise get mapped twice
+		VmaAllocation allocation = mDevice.allocateMemory(buffer,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, true);
+
+		Page page;
+		page.buffer = mDevice.getResourceManager().create<VulkanBuffer>(buffer, VK_NULL_HANDLE, allocation);
+		page.data = page.buffer->map(0, PAGE_SIZE);
+
+		return page;
+	}
+}}
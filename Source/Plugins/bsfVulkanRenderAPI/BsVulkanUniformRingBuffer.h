@@ -0,0 +1,90 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsVulkanPrerequisites.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup Vulkan
+	 *  @{
+	 */
+
+	/**
+	 * Allocator for frequently updated uniform buffer data. Data is sub-allocated from large, persistently mapped,
+	 * host-visible buffers (pages) so that writes require neither creation of new buffers, nor GPU transfers. Allocations
+	 * made during a frame stay valid until the end of that frame, after which their pages get re-used as soon as the GPU
+	 * finishes with them.
+	 *
+	 * @note	Thread safe.
+	 */
+	class VulkanUniformRingBuffer
+	{
+	public:
+		/** Location of data written to the ring buffer. */
+		struct Allocation
+		{
+			/** Buffer containing the data. Null if the allocation is not valid. */
+			VulkanBuffer* buffer = nullptr;
+
+			/** Offset of the data in the buffer, in bytes. */
+			UINT32 offset = 0;
+
+			/** Index of the frame in which the allocation was made. */
+			UINT64 frameIdx = 0;
+		};
+
+		VulkanUniformRingBuffer(VulkanDevice& device);
+		~VulkanUniformRingBuffer();
+
+		/**
+		 * Allocates @p size bytes and copies the provided data into them. Returns false if the size is larger than supported
+		 * by the ring buffer, in which case the caller is expected to use a normal uniform buffer instead.
+		 */
+		bool write(const UINT8* data, UINT32 size, Allocation& output);
+
+		/**
+		 * Checks is the allocation still valid. Allocations stop being valid once the frame they were allocated in ends,
+		 * and the caller must write the data again before binding it.
+		 */
+		bool isValid(const Allocation& allocation) const;
+
+		/**
+		 * Ends the current frame, invalidating all allocations made during it. Pages used by the frame are queued for
+		 * re-use once the GPU is done with them. Should be called once per frame, after command buffer states have been
+		 * refreshed.
+		 */
+		void advanceFrame();
+
+		/** Returns the maximum size of a single allocation. */
+		UINT32 getMaxAllocationSize() const { return mMaxAllocationSize; }
+
+		/** Size of a single page, in bytes. */
+		static constexpr UINT32 PAGE_SIZE = 4 * 1024 * 1024;
+
+	private:
+		/** Single persistently mapped buffer from which allocations are made. */
+		struct Page
+		{
+			VulkanBuffer* buffer;
+			UINT8* data;
+		};
+
+		/** Returns a page that's not used by the GPU, creating a new one if none are available. */
+		Page acquirePage();
+
+		VulkanDevice& mDevice;
+		UINT32 mAlignment;
+		UINT32 mMaxAllocationSize;
+
+		Vector<Page> mActivePages;
+		Vector<Page> mRetiredPages;
+		Vector<Page> mFreePages;
+		UINT32 mPageOffset = PAGE_SIZE;
+		UINT64 mFrameIdx = 1;
+
+		mutable Mutex mMutex;
+	};
+
+	/** @} */
+}}
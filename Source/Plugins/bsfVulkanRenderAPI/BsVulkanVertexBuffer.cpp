@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsVulkanVertexBuffer.h"
 #include "BsVulkanHardwareBuffer.h"
+#include "BsVulkanGpuBuffer.h"
 #include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
@@ -20,7 +21,14 @@ namespace bs { namespace ct
 
 	void VulkanVertexBuffer::initialize()
 	{
-		mBuffer = bs_new<VulkanHardwareBuffer>(VulkanHardwareBuffer::BT_VERTEX, BF_UNKNOWN, mUsage, mSize, mDeviceMask);
+		// Load-store access goes through a view containing 32-bit elements, see VertexBuffer::getLoadStore()
+		if (mSupportsLoadStore)
+		{
+			mBuffer = bs_new<VulkanHardwareBuffer>(VulkanHardwareBuffer::BT_VERTEX_STORAGE, BF_32X1U, mUsage, mSize, 
+				mDeviceMask);
+		}
+		else
+			mBuffer = bs_new<VulkanHardwareBuffer>(VulkanHardwareBuffer::BT_VERTEX, BF_UNKNOWN, mUsage, mSize, mDeviceMask);
 
 		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_VertexBuffer);
 		VertexBuffer::initialize();
@@ -73,4 +81,16 @@ namespace bs { namespace ct
 	{
 		return mBuffer->getResource(deviceIdx);
 	}
-}}
\ No newline at end of file
+
+	SPtr<GpuBuffer> VulkanVertexBuffer::createLoadStore(const GPU_BUFFER_DESC& desc)
+	{
+		SPtr<VertexBuffer> thisPtr = std::static_pointer_cast<VertexBuffer>(getThisPtr());
+		VulkanGpuBuffer* buffer = new (bs_alloc<VulkanGpuBuffer>()) VulkanGpuBuffer(desc, mBuffer, thisPtr, mDeviceMask);
+
+		SPtr<VulkanGpuBuffer> bufferPtr = bs_shared_ptr<VulkanGpuBuffer>(buffer);
+		bufferPtr->_setThisPtr(bufferPtr);
+		bufferPtr->initialize();
+
+		return bufferPtr;
+	}
+}}
@@ -45,6 +45,9 @@ namespace bs { namespace ct
 		/** @copydoc VertexBuffer::initialize */
 		void initialize() override;
 
+		/** @copydoc VertexBuffer::createLoadStore */
+		SPtr<GpuBuffer> createLoadStore(const GPU_BUFFER_DESC& desc) override;
+
 	private:
 		VulkanHardwareBuffer* mBuffer;
 		GpuBufferUsage mUsage;
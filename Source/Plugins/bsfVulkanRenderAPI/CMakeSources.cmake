@@ -26,6 +26,9 @@ set(BS_VULKANRENDERAPI_INC_NOFILTER
 	"BsVulkanDescriptorSet.h"
 	"BsVulkanSamplerState.h"
 	"BsVulkanGpuPipelineParamInfo.h"
+	"BsVulkanUniformRingBuffer.h"
+	"BsVulkanStagingBufferPool.h"
+	"BsVulkanBindlessTextures.h"
 )
 
 set(BS_VULKANRENDERAPI_INC_MANAGERS
@@ -69,6 +72,9 @@ set(BS_VULKANRENDERAPI_SRC_NOFILTER
 	"BsVulkanDescriptorSet.cpp"
 	"BsVulkanSamplerState.cpp"
 	"BsVulkanGpuPipelineParamInfo.cpp"
+	"BsVulkanUniformRingBuffer.cpp"
+	"BsVulkanStagingBufferPool.cpp"
+	"BsVulkanBindlessTextures.cpp"
 )
 
 set(BS_VULKANRENDERAPI_SRC_MANAGERS
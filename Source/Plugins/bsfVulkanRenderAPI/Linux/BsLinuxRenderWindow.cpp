@@ -206,6 +206,7 @@ namespace bs
 
 		// Create swap chain
 		mSwapChain = bs_shared_ptr_new<VulkanSwapChain>();
+		mSwapChain->setPresentSettings(mDesc.presentMode, mDesc.swapChainImageCount, mDesc.maxFrameLatency);
 		mSwapChain->rebuild(presentDevice, mSurface, props.width, props.height, props.vsync, mColorFormat, mColorSpace,
 				mDesc.depthBuffer, mDepthFormat);
 
@@ -621,6 +622,9 @@ namespace bs
 		mRequiresNewBackBuffer = true;
 
 		LinuxPlatform::unlockX();
+
+		// Limit the number of frames queued for display, if requested. Done outside of the X lock as it can block.
+		mSwapChain->waitForFrameLatency();
 	}
 
 	void LinuxRenderWindow::copyToMemory(PixelData &dst, FrameBuffer buffer)
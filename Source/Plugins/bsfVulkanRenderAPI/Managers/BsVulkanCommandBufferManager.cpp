@@ -86,11 +86,11 @@ namespace bs { namespace ct
 			entry.newLayout = newLayout;
 		}
 
-		vkCmdPipelineBarrier(mCB->getHandle(),
-							 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-							 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-							 0, 0, nullptr,
-							 0, nullptr,
+		// All the sub-resources might already be in the requested layout
+		if (mBarriersTemp.empty())
+			return;
+
+		mCB->pipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0, nullptr,
 							 (UINT32)mBarriersTemp.size(), mBarriersTemp.data());
 
 		mBarriersTemp.clear();		
@@ -6,6 +6,7 @@
 #include "BsVulkanDescriptorPool.h"
 #include "BsVulkanDevice.h"
 #include "BsVulkanResource.h"
+#include "BsVulkanCommandBuffer.h"
 
 namespace bs { namespace ct
 {
@@ -91,6 +92,15 @@ namespace bs { namespace ct
 
 		for (auto& entry : mPools)
 			bs_delete(entry);
+
+		for (auto& entry : mActiveTransientPools)
+			entry->destroy();
+
+		for (auto& entry : mRetiredTransientPools)
+			entry->destroy();
+
+		for (auto& entry : mFreeTransientPools)
+			entry->destroy();
 	}
 
 	VulkanDescriptorLayout* VulkanDescriptorManager::getLayout(VkDescriptorSetLayoutBinding* bindings, UINT32 numBindings)
@@ -119,6 +129,8 @@ namespace bs { namespace ct
 		// a major resource waste.
 		VkDescriptorSetLayout setLayout = layout->getHandle();
 
+		Lock lock(mPoolMutex);
+
 		VkDescriptorSetAllocateInfo allocateInfo;
 		allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
 		allocateInfo.pNext = nullptr;
@@ -128,9 +140,12 @@ namespace bs { namespace ct
 
 		VkDescriptorSet set;
 		VkResult result = vkAllocateDescriptorSets(mDevice.getLogical(), &allocateInfo, &set);
-		if(result < 0) // Possible fragmentation, try in a new pool
+		if(result < 0) // Possible fragmentation or out of space, try in a new pool
 		{
-			mPools.push_back(bs_new<VulkanDescriptorPool>(mDevice));
+			// Grow the pool size, in case we're running out of space rather than being fragmented
+			UINT32 sizeScale = mPools.back()->getSizeScale() * 2;
+
+			mPools.push_back(bs_new<VulkanDescriptorPool>(mDevice, sizeScale));
 			allocateInfo.descriptorPool = mPools.back()->getHandle();
 
 			result = vkAllocateDescriptorSets(mDevice.getLogical(), &allocateInfo, &set);
@@ -174,4 +189,150 @@ namespace bs { namespace ct
 		mPipelineLayouts.insert(std::make_pair(key, pipelineLayout));
 		return pipelineLayout;
 	}
+
+	VkDescriptorSet VulkanDescriptorManager::getTransientSet(VulkanDescriptorLayout* layout, 
+		VkWriteDescriptorSet* entries, UINT32 count, VulkanCmdBuffer& cmdBuffer)
+	{
+		Lock lock(mPoolMutex);
+
+		getTransientSetKey(layout, entries, count, mTransientKeyTemp);
+
+		size_t hash = 0;
+		for (auto& entry : mTransientKeyTemp)
+			hash_combine(hash, entry);
+
+		// Return an existing set if one with the same contents was already written this frame
+		auto iterFind = mTransientSets.find(hash);
+		if (iterFind != mTransientSets.end() && iterFind->second.key == mTransientKeyTemp)
+		{
+			cmdBuffer.registerResource(iterFind->second.pool, VulkanUseFlag::Read);
+			return iterFind->second.set;
+		}
+
+		VkDescriptorSet set = VK_NULL_HANDLE;
+		if (!mActiveTransientPools.empty())
+			set = mActiveTransientPools.back()->allocate(layout->getHandle());
+
+		if (set == VK_NULL_HANDLE)
+		{
+			VulkanTransientDescriptorPool* pool = nullptr;
+			if (mActiveTransientPools.empty() && !mFreeTransientPools.empty())
+			{
+				pool = mFreeTransientPools.back();
+				mFreeTransientPools.pop_back();
+			}
+			else
+			{
+				// Out of space in the current pool. Grow the new pool, since this usage will likely repeat next frame.
+				UINT32 sizeScale = 1;
+				if (!mActiveTransientPools.empty())
+					sizeScale = mActiveTransientPools.back()->getSizeScale() * 2;
+
+				pool = mDevice.getResourceManager().create<VulkanTransientDescriptorPool>(sizeScale);
+			}
+
+			mActiveTransientPools.push_back(pool);
+
+			set = pool->allocate(layout->getHandle());
+			assert(set != VK_NULL_HANDLE);
+		}
+
+		for (UINT32 i = 0; i < count; i++)
+			entries[i].dstSet = set;
+
+		vkUpdateDescriptorSets(mDevice.getLogical(), count, entries, 0, nullptr);
+
+		VulkanTransientDescriptorPool* pool = mActiveTransientPools.back();
+		cmdBuffer.registerResource(pool, VulkanUseFlag::Read);
+
+		// Note: On a hash collision with different contents the new set simply isn't cached
+		if (iterFind == mTransientSets.end())
+		{
+			TransientSetEntry& cacheEntry = mTransientSets[hash];
+			cacheEntry.key = mTransientKeyTemp;
+			cacheEntry.set = set;
+			cacheEntry.pool = pool;
+		}
+
+		return set;
+	}
+
+	void VulkanDescriptorManager::advanceFrame()
+	{
+		Lock lock(mPoolMutex);
+
+		mTransientSets.clear();
+
+		for (auto& entry : mActiveTransientPools)
+			mRetiredTransientPools.push_back(entry);
+
+		mActiveTransientPools.clear();
+
+		// Reset any pools the GPU is done with
+		for (auto iter = mRetiredTransientPools.begin(); iter != mRetiredTransientPools.end();)
+		{
+			VulkanTransientDescriptorPool* pool = *iter;
+			if (pool->isUsed() || pool->isBound())
+			{
+				++iter;
+				continue;
+			}
+
+			pool->reset();
+			mFreeTransientPools.push_back(pool);
+
+			iter = mRetiredTransientPools.erase(iter);
+		}
+	}
+
+	void VulkanDescriptorManager::getTransientSetKey(VulkanDescriptorLayout* layout, const VkWriteDescriptorSet* entries,
+		UINT32 count, Vector<UINT8>& output)
+	{
+		output.clear();
+
+		auto write = [&output](const void* data, UINT32 size)
+		{
+			const UINT8* bytes = (const UINT8*)data;
+			output.insert(output.end(), bytes, bytes + size);
+		};
+
+		write(&layout, sizeof(layout));
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const VkWriteDescriptorSet& entry = entries[i];
+			write(&entry.dstBinding, sizeof(entry.dstBinding));
+			write(&entry.descriptorType, sizeof(entry.descriptorType));
+
+			for (UINT32 j = 0; j < entry.descriptorCount; j++)
+			{
+				switch (entry.descriptorType)
+				{
+				case VK_DESCRIPTOR_TYPE_SAMPLER:
+				case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+				case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+				case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+				case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+				{
+					const VkDescriptorImageInfo& info = entry.pImageInfo[j];
+					write(&info.sampler, sizeof(info.sampler));
+					write(&info.imageView, sizeof(info.imageView));
+					write(&info.imageLayout, sizeof(info.imageLayout));
+				}
+					break;
+				case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+				case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+					write(&entry.pTexelBufferView[j], sizeof(VkBufferView));
+					break;
+				default:
+				{
+					const VkDescriptorBufferInfo& info = entry.pBufferInfo[j];
+					write(&info.buffer, sizeof(info.buffer));
+					write(&info.offset, sizeof(info.offset));
+					write(&info.range, sizeof(info.range));
+				}
+					break;
+				}
+			}
+		}
+	}
 }}
\ No newline at end of file
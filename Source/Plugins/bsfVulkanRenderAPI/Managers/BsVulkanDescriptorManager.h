@@ -87,18 +87,61 @@ namespace bs { namespace ct
 		/** Attempts to find an existing one, or allocates a new descriptor set layout from the provided set of bindings. */
 		VulkanDescriptorLayout* getLayout(VkDescriptorSetLayoutBinding* bindings, UINT32 numBindings);
 
-		/** Allocates a new empty descriptor set matching the provided layout. */
+		/** 
+		 * Allocates a new empty descriptor set matching the provided layout. 
+		 *
+		 * @note	Thread safe, as sets are allocated when GPU parameters are bound to command buffers, which may be
+		 *			recorded on different threads.
+		 */
 		VulkanDescriptorSet* createSet(VulkanDescriptorLayout* layout);
 
 		/** Attempts to find an existing one, or allocates a new pipeline layout based on the provided descriptor layouts. */
 		VkPipelineLayout getPipelineLayout(VulkanDescriptorLayout** layouts, UINT32 numLayouts);
 
+		/**
+		 * Returns a descriptor set matching the provided layout, with its contents set to the provided descriptor writes.
+		 * The set is allocated from a transient pool and is only valid for the current frame (until the next call to
+		 * advanceFrame()). Requests with the same layout and identical descriptors during a single frame return the same
+		 * set, without re-writing it. The transient pool the set was allocated from is registered with the provided
+		 * command buffer.
+		 *
+		 * @note	Thread safe.
+		 */
+		VkDescriptorSet getTransientSet(VulkanDescriptorLayout* layout, VkWriteDescriptorSet* entries, UINT32 count,
+			VulkanCmdBuffer& cmdBuffer);
+
+		/** 
+		 * Ends the current frame of transient descriptor set allocations. Sets returned by getTransientSet() before this
+		 * call must no longer be bound. Transient pools are reset and re-used once the GPU finishes executing all command
+		 * buffers that used them. Should be called once per frame, after command buffer states have been refreshed.
+		 */
+		void advanceFrame();
+
 	protected:
+		/** Cached transient descriptor set allocated during the current frame. */
+		struct TransientSetEntry
+		{
+			Vector<UINT8> key;
+			VkDescriptorSet set;
+			VulkanTransientDescriptorPool* pool;
+		};
+
+		/** Writes all the data identifying the contents of a descriptor set into @p output. */
+		static void getTransientSetKey(VulkanDescriptorLayout* layout, const VkWriteDescriptorSet* entries, UINT32 count,
+			Vector<UINT8>& output);
+
 		VulkanDevice& mDevice;
 
 		UnorderedSet<VulkanLayoutKey> mLayouts; 
 		UnorderedMap<VulkanPipelineLayoutKey, VkPipelineLayout> mPipelineLayouts;
 		Vector<VulkanDescriptorPool*> mPools;
+		Mutex mPoolMutex;
+
+		Vector<VulkanTransientDescriptorPool*> mActiveTransientPools;
+		Vector<VulkanTransientDescriptorPool*> mRetiredTransientPools;
+		Vector<VulkanTransientDescriptorPool*> mFreeTransientPools;
+		UnorderedMap<size_t, TransientSetEntry> mTransientSets;
+		Vector<UINT8> mTransientKeyTemp;
 	};
 
 	/** @} */
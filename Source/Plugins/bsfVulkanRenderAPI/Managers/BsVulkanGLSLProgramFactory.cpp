@@ -743,4 +743,10 @@ cleanup:
 
 		return bytecode;
 	}
+
+	String VulkanGLSLProgramFactory::getCompilerVersion() const
+	{
+		// Compile options are fixed: Vulkan rules and GLSL version 450
+		return "glslang_" + String(glslang::GetGlslVersionString()) + "_vulkan_450";
+	}
 }}
@@ -105,10 +105,9 @@ namespace bs { namespace ct
 		Lock lock(mMutex);
 
 		VulkanQuery* query = getQuery(VK_QUERY_TYPE_TIMESTAMP);
-		query->mFree = false;
+		onQueryBegin(query, cb);
 
 		VkCommandBuffer vkCmdBuf = cb->getHandle();
-		cb->resetQuery(query);
 		vkCmdWriteTimestamp(vkCmdBuf, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, query->mPool, query->mQueryIdx);
 
 		// Note: Must happen only here because we need to check VulkanResource::isBound under the same mutex
@@ -121,11 +120,10 @@ namespace bs { namespace ct
 	{
 		Lock lock(mMutex);
 
-		VulkanQuery* query = getQuery(VK_QUERY_TYPE_TIMESTAMP);
-		query->mFree = false;
+		VulkanQuery* query = getQuery(VK_QUERY_TYPE_OCCLUSION);
+		onQueryBegin(query, cb);
 
 		VkCommandBuffer vkCmdBuf = cb->getHandle();
-		cb->resetQuery(query);
 		vkCmdBeginQuery(vkCmdBuf, query->mPool, query->mQueryIdx, precise ? VK_QUERY_CONTROL_PRECISE_BIT : 0);
 
 		// Note: Must happen only here because we need to check VulkanResource::isBound under the same mutex
@@ -148,6 +146,72 @@ namespace bs { namespace ct
 
 		query->mFree = true;
 		query->mNeedsReset = true;
+		query->mResolved = false;
+	}
+
+	void VulkanQueryPool::onQueryBegin(VulkanQuery* query, VulkanCmdBuffer* cb)
+	{
+		query->mFree = false;
+		query->mResolved = false;
+		query->mBeginFrame = QueryManager::instance().getFrameIdx();
+
+		cb->resetQuery(query);
+	}
+
+	void VulkanQueryPool::resolveResults(UINT64 frameIdx, UINT32 minLatency)
+	{
+		Lock lock(mMutex);
+
+		resolveResults(mTimerQueries, mTimerPools, frameIdx, minLatency);
+		resolveResults(mOcclusionQueries, mOcclusionPools, frameIdx, minLatency);
+	}
+
+	void VulkanQueryPool::resolveResults(const Vector<VulkanQuery*>& queries, const Vector<PoolInfo>& poolInfos, 
+		UINT64 frameIdx, UINT32 minLatency)
+	{
+		const auto canResolve = [frameIdx, minLatency](VulkanQuery* query)
+		{
+			// Queries no longer bound to a command buffer have finished executing, so their results are available
+			return query != nullptr && !query->mFree && !query->mResolved && !query->isBound() &&
+				(frameIdx - query->mBeginFrame) >= minLatency;
+		};
+
+		VkDevice vkDevice = mDevice.getLogical();
+		UINT64 results[NUM_QUERIES_PER_POOL];
+
+		for (UINT32 poolIdx = 0; poolIdx < (UINT32)poolInfos.size(); poolIdx++)
+		{
+			UINT32 poolStart = poolIdx * NUM_QUERIES_PER_POOL;
+
+			UINT32 i = 0;
+			while (i < NUM_QUERIES_PER_POOL)
+			{
+				if (!canResolve(queries[poolStart + i]))
+				{
+					i++;
+					continue;
+				}
+
+				UINT32 rangeStart = i;
+				while (i < NUM_QUERIES_PER_POOL && canResolve(queries[poolStart + i]))
+					i++;
+
+				UINT32 rangeCount = i - rangeStart;
+				VkResult result = vkGetQueryPoolResults(vkDevice, poolInfos[poolIdx].pool, rangeStart, rangeCount,
+					rangeCount * sizeof(UINT64), results, sizeof(UINT64), VK_QUERY_RESULT_64_BIT);
+				assert(result == VK_SUCCESS || result == VK_NOT_READY);
+
+				if (result != VK_SUCCESS)
+					continue;
+
+				for (UINT32 j = 0; j < rangeCount; j++)
+				{
+					VulkanQuery* query = queries[poolStart + rangeStart + j];
+					query->mResult = results[j];
+					query->mResolved = true;
+				}
+			}
+		}
 	}
 
 	VulkanQueryManager::VulkanQueryManager(VulkanRenderAPI& rapi)
@@ -159,6 +223,12 @@ namespace bs { namespace ct
 		
 	}
 
+	void VulkanQueryManager::resolveQueries()
+	{
+		for (UINT32 i = 0; i < mRenderAPI._getNumDevices(); i++)
+			mRenderAPI._getDevice(i)->getQueryPool().resolveResults(mFrameIdx, mMinLatency);
+	}
+
 	SPtr<EventQuery> VulkanQueryManager::createEventQuery(UINT32 deviceIdx) const
 	{
 		SPtr<VulkanDevice> device = mRenderAPI._getDevice(deviceIdx);
@@ -199,13 +269,20 @@ namespace bs { namespace ct
 
 	bool VulkanQuery::getResult(UINT64& result) const
 	{
-		// Note: A potentially better approach to get results is to make the query pool a VulkanResource, which we attach
-		// to a command buffer upon use. Then when CB finishes executing we perform vkGetQueryPoolResults on all queries
-		// in the pool at once.
+		if (mResolved)
+		{
+			result = mResult;
+			return true;
+		}
+
+		const QueryManager& queryManager = QueryManager::instance();
+		if ((queryManager.getFrameIdx() - mBeginFrame) < queryManager.getMinLatency())
+			return false;
 
+		// Query finished after the last batched read, read it on its own
 		VkDevice vkDevice = mOwner->getDevice().getLogical();
-		VkResult vkResult = vkGetQueryPoolResults(vkDevice, mPool, 0, 1, sizeof(result), &result, sizeof(result),
-												  VK_QUERY_RESULT_64_BIT);
+		VkResult vkResult = vkGetQueryPoolResults(vkDevice, mPool, mQueryIdx, 1, sizeof(result), &result, 
+			sizeof(result), VK_QUERY_RESULT_64_BIT);
 		assert(vkResult == VK_SUCCESS || vkResult == VK_NOT_READY);
 
 		return vkResult == VK_SUCCESS;
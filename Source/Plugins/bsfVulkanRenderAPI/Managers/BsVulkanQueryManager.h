@@ -55,6 +55,16 @@ namespace bs { namespace ct
 		/** Releases a previously retrieved query, ensuring it can be re-used. */
 		void releaseQuery(VulkanQuery* query);
 
+		/**
+		 * Reads the results of all queries the GPU has finished executing, issuing a single read for each contiguous
+		 * range of such queries in a pool. Later VulkanQuery::getResult() calls on those queries return the stored
+		 * result without accessing the device.
+		 *
+		 * @param[in]	frameIdx	Current frame index, as reported by QueryManager::getFrameIdx().
+		 * @param[in]	minLatency	Minimum number of frames since a query was issued before its result is read.
+		 */
+		void resolveResults(UINT64 frameIdx, UINT32 minLatency);
+
 	private:
 		/** Query buffer pool and related information. */
 		struct PoolInfo
@@ -69,7 +79,14 @@ namespace bs { namespace ct
 		/** Creates a new Vulkan query pool object. */
 		PoolInfo& allocatePool(VkQueryType type);
 
-		static const UINT32 NUM_QUERIES_PER_POOL = 16;
+		/** Prepares a query retrieved from getQuery() for use. */
+		void onQueryBegin(VulkanQuery* query, VulkanCmdBuffer* cb);
+
+		/** Resolves results of the provided queries, for all pools of a single type. See resolveResults(). */
+		void resolveResults(const Vector<VulkanQuery*>& queries, const Vector<PoolInfo>& poolInfos, UINT64 frameIdx,
+			UINT32 minLatency);
+
+		static const UINT32 NUM_QUERIES_PER_POOL = 128;
 
 		VulkanDevice& mDevice;
 
@@ -98,6 +115,10 @@ namespace bs { namespace ct
 		/** @copydoc QueryManager::createOcclusionQuery */
 		SPtr<OcclusionQuery> createOcclusionQuery(bool binary, UINT32 deviceIdx = 0) const override;
 
+	protected:
+		/** @copydoc QueryManager::resolveQueries */
+		void resolveQueries() override;
+
 	private:
 		VulkanRenderAPI& mRenderAPI;
 	};
@@ -110,7 +131,9 @@ namespace bs { namespace ct
 
 		/** 
 		 * Attempts to retrieve the result from the query. The result is only valid if the query stopped executing on the
-		 * GPU (otherwise previous query results could be accessed, if the reset command hasn't executed yet).
+		 * GPU (otherwise previous query results could be accessed, if the reset command hasn't executed yet). Returns
+		 * the result read by VulkanQueryPool::resolveResults() if available, and reports the query as not ready until
+		 * the latency set by QueryManager::setMinLatency() has passed.
 		 * 
 		 * @param[out]	result	Value of the query, if the method return true. Undefined otherwise.
 		 * @return				True if the result is ready, false otherwise.
@@ -127,6 +150,10 @@ namespace bs { namespace ct
 		UINT32 mQueryIdx;
 		bool mFree;
 		bool mNeedsReset;
+
+		UINT64 mBeginFrame = 0;
+		UINT64 mResult = 0;
+		bool mResolved = false;
 	};
 
 	/** @} */
@@ -4,6 +4,11 @@
 #include "BsVulkanGpuPipelineState.h"
 #include "BsVulkanGpuPipelineParamInfo.h"
 #include "BsVulkanSamplerState.h"
+#include "BsVulkanFramebuffer.h"
+#include "BsVulkanDevice.h"
+#include "Managers/BsVulkanVertexInputManager.h"
+#include "RenderAPI/BsRenderTarget.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs { namespace ct
 {
@@ -49,4 +54,65 @@ namespace bs { namespace ct
 
 		return paramInfo;
 	}
-}}
\ No newline at end of file
+
+	void VulkanRenderStateManager::precompileGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+		const SPtr<VertexDeclaration>& vertexDecl, const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+		DrawOperationType drawOp)
+	{
+		if (pipelineState == nullptr || vertexDecl == nullptr || target == nullptr)
+			return;
+
+		if (target->getProperties().isWindow)
+			return;
+
+		SPtr<VulkanGraphicsPipelineState> vkPipelineState = 
+			std::static_pointer_cast<VulkanGraphicsPipelineState>(pipelineState);
+
+		SPtr<VertexDeclaration> inputDecl = vkPipelineState->getInputDeclaration();
+		if (inputDecl == nullptr)
+			return;
+
+		VulkanFramebuffer* framebuffer = nullptr;
+		target->getCustomAttribute("FB", &framebuffer);
+
+		if (framebuffer == nullptr)
+			return;
+
+		SPtr<VulkanVertexInput> vertexInput = VulkanVertexInputManager::instance().getVertexInfo(vertexDecl, inputDecl);
+		UINT32 deviceIdx = framebuffer->getOwner()->getDevice().getIndex();
+
+		// Prevent the framebuffer from being destroyed before the worker is done with it
+		framebuffer->notifyBound();
+
+		auto worker = [vkPipelineState, deviceIdx, framebuffer, readOnlyFlags, drawOp, vertexInput]()
+		{
+			// Pipeline gets created and cached on the pipeline state, ready for when it is first used for drawing
+			vkPipelineState->getPipeline(deviceIdx, framebuffer, readOnlyFlags, drawOp, vertexInput);
+			framebuffer->notifyUnbound();
+		};
+
+		auto iterRemove = std::remove_if(mPrecompileTasks.begin(), mPrecompileTasks.end(),
+			[](const SPtr<Task>& task) { return task->isComplete(); });
+		mPrecompileTasks.erase(iterRemove, mPrecompileTasks.end());
+
+		SPtr<Task> task = Task::create("PipelinePrecompile", worker);
+		TaskScheduler::instance().addTask(task);
+
+		mPrecompileTasks.push_back(task);
+	}
+
+	void VulkanRenderStateManager::waitUntilPrecompiled()
+	{
+		for (auto& entry : mPrecompileTasks)
+			entry->wait();
+
+		mPrecompileTasks.clear();
+	}
+
+	void VulkanRenderStateManager::onShutDown()
+	{
+		waitUntilPrecompiled();
+
+		RenderStateManager::onShutDown();
+	}
+}}
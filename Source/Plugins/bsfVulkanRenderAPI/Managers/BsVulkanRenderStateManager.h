@@ -14,7 +14,23 @@ namespace bs { namespace ct
 	/**	Handles creation of Vulkan pipeline states. */
 	class VulkanRenderStateManager : public RenderStateManager
 	{
+	public:
+		/**
+		 * @copydoc RenderStateManager::precompileGraphicsPipeline
+		 *
+		 * @note	Render windows are not supported as their framebuffers change with every presented frame.
+		 */
+		void precompileGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+			const SPtr<VertexDeclaration>& vertexDecl, const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+			DrawOperationType drawOp) override;
+
+		/** @copydoc RenderStateManager::waitUntilPrecompiled */
+		void waitUntilPrecompiled() override;
+
 	protected:
+		/** @copydoc RenderStateManager::onShutDown */
+		void onShutDown() override;
+
 		/** @copydoc RenderStateManager::createSamplerStateInternal */
 		SPtr<SamplerState> createSamplerStateInternal(const SAMPLER_STATE_DESC& desc,
 			GpuDeviceFlags deviceMask) const override;
@@ -30,6 +46,8 @@ namespace bs { namespace ct
 		/** @copydoc RenderStateManager::_createPipelineParamInfo */
 		SPtr<GpuPipelineParamInfo> _createPipelineParamInfo(const GPU_PIPELINE_PARAMS_DESC& desc,
 			 GpuDeviceFlags deviceMask = GDF_DEFAULT) const override;
+
+		Vector<SPtr<Task>> mPrecompileTasks;
 	};
 
 	/** @} */
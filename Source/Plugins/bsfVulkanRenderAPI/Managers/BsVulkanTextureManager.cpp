@@ -5,6 +5,8 @@
 #include "BsVulkanRenderTexture.h"
 #include "BsVulkanResource.h"
 #include "BsVulkanUtility.h"
+#include "BsVulkanRenderAPI.h"
+#include "BsVulkanDevice.h"
 
 namespace bs
 {
@@ -42,6 +44,15 @@ namespace bs
 		if (ct::VulkanUtility::getPixelFormat(format, hwGamma) == VK_FORMAT_UNDEFINED)
 			return PF_RGBA8;
 
+		// Check the device the same way texture creation does, so the returned format is the one actually used
+		ct::VulkanRenderAPI& rapi = static_cast<ct::VulkanRenderAPI&>(ct::RenderAPI::instance());
+		const Vector<SPtr<ct::VulkanDevice>> primaryDevices = rapi._getPrimaryDevices();
+		if (!primaryDevices.empty())
+		{
+			return ct::VulkanUtility::getClosestSupportedPixelFormat(*primaryDevices[0], format, ttype, usage, true,
+				hwGamma);
+		}
+
 		return format;
 	}
 
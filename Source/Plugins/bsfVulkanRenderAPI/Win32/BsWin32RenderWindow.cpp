@@ -207,6 +207,7 @@ namespace bs
 
 		// Create swap chain
 		mSwapChain = bs_shared_ptr_new<VulkanSwapChain>();
+		mSwapChain->setPresentSettings(mDesc.presentMode, mDesc.swapChainImageCount, mDesc.maxFrameLatency);
 		mSwapChain->rebuild(presentDevice, mSurface, props.width, props.height, props.vsync, mColorFormat, mColorSpace, 
 			mDesc.depthBuffer, mDepthFormat);
 
@@ -299,6 +300,9 @@ namespace bs
 
 		queue->present(mSwapChain.get(), mSemaphoresTemp, numSemaphores);
 		mRequiresNewBackBuffer = true;
+
+		// Limit the number of frames queued for display, if requested
+		mSwapChain->waitForFrameLatency();
 	}
 
 	void Win32RenderWindow::move(INT32 left, INT32 top)